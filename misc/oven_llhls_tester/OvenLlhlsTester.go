@@ -0,0 +1,532 @@
+package main
+
+import (
+	"bufio"
+	"flag"
+	"fmt"
+	"io"
+	"io/ioutil"
+	"math"
+	"net/http"
+	"net/url"
+	"os"
+	"os/signal"
+	"sort"
+	"strconv"
+	"strings"
+	"sync"
+	"time"
+)
+
+const requestTimeout = 10000         // ms (longer than the blocking playlist reload)
+const retryInterval = 500            // ms
+const clockTicksPerSecond = 100      // USER_HZ of Linux (/proc/<pid>/stat)
+const latencyWarningThreshold = 3000 // ms
+
+func main() {
+	requestURL := flag.String("url", "undefined", "[Required] OvenMediaEngine's LLHLS streaming URL (e.g. http://host:3333/app/stream/llhls.m3u8)")
+	numberOfClient := flag.Int("n", 1, "[Optional] Number of client")
+	connectionInterval := flag.Int("cint", 100, "[Optional] Client start interval (milliseconds)")
+	summaryInterval := flag.Int("sint", 5000, "[Optional] Summary information output cycle (milliseconds)")
+	lifetime := flag.Int("life", 0, "[Optional] Number of times to execute the test (seconds) (default \"indefinitely\")")
+	omePid := flag.Int("pid", 0, "[Optional] PID of OvenMediaEngine to report the CPU usage per viewer (only if the tester runs on the same Linux host)")
+
+	flag.Usage = func() {
+		flag.PrintDefaults()
+	}
+
+	flag.Parse()
+	_, err := url.ParseRequestURI(*requestURL)
+	// URL is mandatory
+	if err != nil {
+		fmt.Printf("-url parameter is required and must be vaild. (input : %s)\n", *requestURL)
+		flag.PrintDefaults()
+		return
+	}
+
+	// Each client has its own connection like a player
+	transport := http.DefaultTransport.(*http.Transport).Clone()
+	transport.MaxIdleConnsPerHost = 1
+
+	clientChan := make(chan *omeClient)
+	quit := make(chan bool)
+	go func() {
+		for i := 0; i < *numberOfClient; i++ {
+			select {
+			case <-quit:
+				return
+			case <-time.After(time.Millisecond * time.Duration(*connectionInterval)):
+				client := &omeClient{
+					name: fmt.Sprintf("client_%d", i),
+					httpClient: &http.Client{
+						Transport: transport.Clone(),
+						Timeout:   time.Millisecond * requestTimeout,
+					},
+					quit: quit,
+				}
+
+				err := client.run(*requestURL)
+				if err != nil {
+					fmt.Printf("%s failed to run (reason - %s)\n", client.name, err)
+					return
+				}
+
+				clientChan <- client
+				fmt.Printf("%s has started\n", client.name)
+			}
+		}
+	}()
+
+	closed := make(chan os.Signal, 1)
+	signal.Notify(closed, os.Interrupt)
+
+	var clients = make([]*omeClient, 0, *numberOfClient)
+	summaryTimeout := time.After(time.Millisecond * time.Duration(*summaryInterval))
+
+	lifetimeDuration := time.Duration(0)
+	if *lifetime == 0 {
+		lifetimeDuration = math.MaxInt64
+	} else {
+		lifetimeDuration = time.Second * time.Duration(*lifetime)
+	}
+	lifeTimeout := time.After(lifetimeDuration)
+
+	cpu := cpuSampler{pid: *omePid}
+	cpu.sample()
+
+F:
+	for {
+		select {
+		case client := <-clientChan:
+			clients = append(clients, client)
+
+		case <-summaryTimeout:
+			reportSummary(clients, &cpu)
+			// Reset timer
+			summaryTimeout = time.After(time.Millisecond * time.Duration(*summaryInterval))
+
+		case <-lifeTimeout:
+			fmt.Printf("Test ended (lifetime : %d seconds)\n", *lifetime)
+			close(quit)
+			break F
+
+		case <-closed:
+			fmt.Printf("Test stopped by user\n")
+			close(quit)
+			break F
+		}
+	}
+
+	fmt.Println("***************************")
+	fmt.Println("Reports")
+	fmt.Println("***************************")
+
+	reportSummary(clients, &cpu)
+
+	fmt.Println("<Details>")
+	for _, client := range clients {
+		client.report()
+	}
+}
+
+// The CPU usage of the OvenMediaEngine process, from /proc/<pid>/stat
+type cpuSampler struct {
+	pid        int
+	lastTicks  int64
+	lastSample time.Time
+}
+
+func readProcessTicks(pid int) (int64, error) {
+	data, err := ioutil.ReadFile(fmt.Sprintf("/proc/%d/stat", pid))
+	if err != nil {
+		return 0, err
+	}
+
+	// The process name (2nd field) can contain spaces, so the fields are counted after ')'
+	stat := string(data)
+	fields := strings.Fields(stat[strings.LastIndex(stat, ")")+1:])
+	if len(fields) < 13 {
+		return 0, fmt.Errorf("invalid stat: %s", stat)
+	}
+
+	// utime (14th) and stime (15th)
+	utime, _ := strconv.ParseInt(fields[11], 10, 64)
+	stime, _ := strconv.ParseInt(fields[12], 10, 64)
+
+	return utime + stime, nil
+}
+
+// Returns the CPU usage (100% = 1 core) since the last call, or -1 if it is not available
+func (s *cpuSampler) sample() float64 {
+	if s.pid == 0 {
+		return -1
+	}
+
+	ticks, err := readProcessTicks(s.pid)
+	if err != nil {
+		fmt.Printf("Could not read the CPU usage of pid %d (reason - %s)\n", s.pid, err)
+		s.pid = 0
+		return -1
+	}
+
+	now := time.Now()
+	usage := float64(-1)
+
+	if s.lastSample.IsZero() == false {
+		elapsed := now.Sub(s.lastSample).Seconds()
+		if elapsed > 0 {
+			usage = float64(ticks-s.lastTicks) / clockTicksPerSecond / elapsed * 100
+		}
+	}
+
+	s.lastTicks = ticks
+	s.lastSample = now
+
+	return usage
+}
+
+// The latencies of the parts received since the last summary
+var latencyMutex sync.Mutex
+var latencySamples []float64
+
+func recordLatency(latency float64) {
+	latencyMutex.Lock()
+	latencySamples = append(latencySamples, latency)
+	latencyMutex.Unlock()
+}
+
+func takeLatencySamples() []float64 {
+	latencyMutex.Lock()
+	samples := latencySamples
+	latencySamples = nil
+	latencyMutex.Unlock()
+
+	sort.Float64s(samples)
+
+	return samples
+}
+
+func percentile(sorted []float64, p float64) float64 {
+	if len(sorted) == 0 {
+		return 0
+	}
+
+	index := int(math.Ceil(float64(len(sorted))*p/100)) - 1
+	if index < 0 {
+		index = 0
+	}
+
+	return sorted[index]
+}
+
+func reportSummary(clients []*omeClient, cpu *cpuSampler) {
+	fmt.Println("<Summary>")
+
+	clientCount := int64(len(clients))
+	if clientCount > 0 {
+		fmt.Printf("Running time : %s\n", time.Since(clients[0].stat.startTime).Round(time.Second))
+	}
+
+	fmt.Printf("Number of clients : %d\n", clientCount)
+
+	var playing, totalParts, totalBytes, failedRequests int64
+	for _, client := range clients {
+		stat := client.getStat()
+
+		if stat.playing {
+			playing++
+		}
+
+		totalParts += stat.totalParts
+		totalBytes += stat.totalBytes
+		failedRequests += stat.failedRequests
+	}
+
+	fmt.Printf("Playing(%d) Total Parts(%d) Total Bytes(%sBytes) Failed Requests(%d)\n", playing, totalParts, CountDecimal(totalBytes), failedRequests)
+
+	samples := takeLatencySamples()
+	if len(samples) > 0 {
+		fmt.Printf("Part Delivery Latency : p50(%.2f ms) p90(%.2f ms) p99(%.2f ms) Max(%.2f ms) (%d parts)\n",
+			percentile(samples, 50), percentile(samples, 90), percentile(samples, 99), samples[len(samples)-1], len(samples))
+
+		if percentile(samples, 99) > latencyWarningThreshold {
+			fmt.Printf("Warning: p99 latency is over %d ms\n", latencyWarningThreshold)
+		}
+	}
+
+	usage := cpu.sample()
+	if usage >= 0 {
+		fmt.Printf("OvenMediaEngine CPU : %.2f%%", usage)
+		if playing > 0 {
+			fmt.Printf(" (%.4f%% per viewer)", usage/float64(playing))
+		}
+		fmt.Printf("\n")
+	}
+
+	fmt.Printf("\n")
+}
+
+type llhlsPart struct {
+	msn   int64
+	index int
+	uri   string
+	// The wall clock time of the end of the part (EXT-X-PROGRAM-DATE-TIME + the durations of the parts)
+	endTime time.Time
+}
+
+type sessionStat struct {
+	startTime time.Time
+
+	playing bool
+
+	totalParts     int64
+	totalBytes     int64
+	failedRequests int64
+	lastError      string
+}
+
+type omeClient struct {
+	name string
+
+	httpClient   *http.Client
+	chunklistURL *url.URL
+
+	mutex sync.Mutex
+	stat  sessionStat
+
+	quit chan bool
+}
+
+func (c *omeClient) getStat() sessionStat {
+	c.mutex.Lock()
+	defer c.mutex.Unlock()
+
+	return c.stat
+}
+
+func (c *omeClient) report() {
+	stat := c.getStat()
+
+	fmt.Printf("[%s] Running time(%s) Playing(%t) Parts(%d) Bytes(%sBytes) Failed Requests(%d)",
+		c.name, time.Since(stat.startTime).Round(time.Second), stat.playing, stat.totalParts, CountDecimal(stat.totalBytes), stat.failedRequests)
+
+	if stat.lastError != "" {
+		fmt.Printf(" Last Error(%s)", stat.lastError)
+	}
+
+	fmt.Printf("\n")
+}
+
+func (c *omeClient) get(requestURL string) ([]byte, error) {
+	response, err := c.httpClient.Get(requestURL)
+	if err != nil {
+		return nil, err
+	}
+	defer response.Body.Close()
+
+	body, err := io.ReadAll(response.Body)
+	if err != nil {
+		return nil, err
+	}
+
+	if response.StatusCode != http.StatusOK {
+		return nil, fmt.Errorf("%s: %s", requestURL, response.Status)
+	}
+
+	return body, nil
+}
+
+func (c *omeClient) onError(err error) {
+	c.mutex.Lock()
+	c.stat.failedRequests++
+	c.stat.lastError = err.Error()
+	c.mutex.Unlock()
+}
+
+func (c *omeClient) run(playlistURL string) error {
+	c.stat.startTime = time.Now()
+
+	baseURL, _ := url.Parse(playlistURL)
+	body, err := c.get(playlistURL)
+	if err != nil {
+		return err
+	}
+
+	// Uses the first rendition of the master playlist
+	c.chunklistURL = baseURL
+	scanner := bufio.NewScanner(strings.NewReader(string(body)))
+	for scanner.Scan() {
+		if strings.HasPrefix(scanner.Text(), "#EXT-X-STREAM-INF") && scanner.Scan() {
+			c.chunklistURL, err = baseURL.Parse(strings.TrimSpace(scanner.Text()))
+			if err != nil {
+				return err
+			}
+
+			break
+		}
+	}
+
+	go c.play()
+
+	return nil
+}
+
+func (c *omeClient) sleep(msec int) bool {
+	select {
+	case <-c.quit:
+		return false
+	case <-time.After(time.Millisecond * time.Duration(msec)):
+		return true
+	}
+}
+
+// Reloads the chunklist with the blocking request (_HLS_msn, _HLS_part) and fetches the new parts, like a LLHLS player
+func (c *omeClient) play() {
+	lastMsn := int64(-1)
+	lastIndex := -1
+	mapFetched := false
+
+	for {
+		select {
+		case <-c.quit:
+			return
+		default:
+		}
+
+		requestURL := *c.chunklistURL
+		if lastMsn >= 0 {
+			query := requestURL.Query()
+			query.Set("_HLS_msn", strconv.FormatInt(lastMsn, 10))
+			query.Set("_HLS_part", strconv.Itoa(lastIndex+1))
+			requestURL.RawQuery = query.Encode()
+		}
+
+		body, err := c.get(requestURL.String())
+		if err != nil {
+			c.onError(err)
+			if c.sleep(retryInterval) == false {
+				return
+			}
+			continue
+		}
+
+		mapURI, parts := parseChunklist(string(body), c.chunklistURL)
+		if len(parts) == 0 {
+			if c.sleep(retryInterval) == false {
+				return
+			}
+			continue
+		}
+
+		if mapFetched == false && mapURI != "" {
+			if _, err := c.get(mapURI); err != nil {
+				c.onError(err)
+				continue
+			}
+			mapFetched = true
+		}
+
+		if lastMsn < 0 {
+			// Starts from the last part (live edge)
+			last := parts[len(parts)-1]
+			lastMsn = last.msn
+			lastIndex = last.index - 1
+		}
+
+		for _, part := range parts {
+			if part.msn < lastMsn || (part.msn == lastMsn && part.index <= lastIndex) {
+				continue
+			}
+
+			data, err := c.get(part.uri)
+			if err != nil {
+				c.onError(err)
+				break
+			}
+
+			// Requires the clocks of OvenMediaEngine and the tester to be synchronized (e.g. NTP)
+			recordLatency(float64(time.Since(part.endTime).Microseconds()) / 1000)
+
+			c.mutex.Lock()
+			c.stat.playing = true
+			c.stat.totalParts++
+			c.stat.totalBytes += int64(len(data))
+			c.mutex.Unlock()
+
+			lastMsn = part.msn
+			lastIndex = part.index
+		}
+	}
+}
+
+func parseAttribute(line string, name string) string {
+	for _, attribute := range strings.Split(line[strings.Index(line, ":")+1:], ",") {
+		if strings.HasPrefix(attribute, name+"=") {
+			return strings.Trim(attribute[len(name)+1:], "\"")
+		}
+	}
+
+	return ""
+}
+
+func parseChunklist(chunklist string, baseURL *url.URL) (string, []llhlsPart) {
+	var parts []llhlsPart
+	var mapURI string
+
+	mediaSequence := int64(0)
+	segmentIndex := int64(-1)
+	partIndex := 0
+	var partTime time.Time
+
+	scanner := bufio.NewScanner(strings.NewReader(chunklist))
+	for scanner.Scan() {
+		line := strings.TrimSpace(scanner.Text())
+
+		switch {
+		case strings.HasPrefix(line, "#EXT-X-MEDIA-SEQUENCE:"):
+			mediaSequence, _ = strconv.ParseInt(line[len("#EXT-X-MEDIA-SEQUENCE:"):], 10, 64)
+
+		case strings.HasPrefix(line, "#EXT-X-MAP:"):
+			if uri, err := baseURL.Parse(parseAttribute(line, "URI")); err == nil {
+				mapURI = uri.String()
+			}
+
+		case strings.HasPrefix(line, "#EXT-X-PROGRAM-DATE-TIME:"):
+			// OvenMediaEngine writes EXT-X-PROGRAM-DATE-TIME at the beginning of every segment
+			segmentIndex++
+			partIndex = 0
+			partTime, _ = time.Parse(time.RFC3339Nano, line[len("#EXT-X-PROGRAM-DATE-TIME:"):])
+
+		case strings.HasPrefix(line, "#EXT-X-PART:"):
+			duration, _ := strconv.ParseFloat(parseAttribute(line, "DURATION"), 64)
+			partTime = partTime.Add(time.Duration(duration * float64(time.Second)))
+
+			uri, err := baseURL.Parse(parseAttribute(line, "URI"))
+			if err == nil && segmentIndex >= 0 {
+				parts = append(parts, llhlsPart{
+					msn:     mediaSequence + segmentIndex,
+					index:   partIndex,
+					uri:     uri.String(),
+					endTime: partTime,
+				})
+			}
+
+			partIndex++
+		}
+	}
+
+	return mapURI, parts
+}
+
+func CountDecimal(b int64) string {
+	const unit = 1000
+	if b < unit {
+		return fmt.Sprintf("%d ", b)
+	}
+	div, exp := int64(unit), 0
+	for n := b / unit; n >= unit; n /= unit {
+		div *= unit
+		exp++
+	}
+	return fmt.Sprintf("%.2f %c", float64(b)/float64(div), "kMGTPE"[exp])
+}
@@ -0,0 +1,3 @@
+module github.com/airensoft/OvenMediaEngine/OvenLlhlsTester
+
+go 1.17
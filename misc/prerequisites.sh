@@ -9,6 +9,7 @@ SRTP_VERSION=2.4.2
 SRT_VERSION=1.5.1
 OPUS_VERSION=1.3.1
 VPX_VERSION=1.11.0
+SVTAV1_VERSION=0.9.1
 FDKAAC_VERSION=2.0.2
 NASM_VERSION=2.15.05
 FFMPEG_VERSION=5.0.1
@@ -146,6 +147,19 @@ install_libvpx()
     rm -rf ${DIR}) || fail_exit "vpx"
 }
 
+install_libsvtav1()
+{
+    (DIR=${TEMP_PATH}/svtav1 && \
+    mkdir -p ${DIR} && \
+    cd ${DIR} && \
+    curl -sLf https://gitlab.com/AOMediaCodec/SVT-AV1/-/archive/v${SVTAV1_VERSION}/SVT-AV1-v${SVTAV1_VERSION}.tar.gz | tar -xz --strip-components=1 && \
+    mkdir -p Build/linux && cd Build/linux && \
+    cmake ../.. -DCMAKE_INSTALL_PREFIX="${PREFIX}" -DCMAKE_INSTALL_LIBDIR=lib -DCMAKE_BUILD_TYPE=Release -DBUILD_SHARED_LIBS=ON -DBUILD_APPS=OFF -DBUILD_DEC=OFF -DBUILD_TESTING=OFF && \
+    make -j$(nproc) && \
+    sudo make install && \
+    rm -rf ${DIR}) || fail_exit "svtav1"
+}
+
 install_fdk_aac()
 {
     (DIR=${TEMP_PATH}/aac && \
@@ -270,11 +284,11 @@ install_ffmpeg()
     --disable-doc \
     --disable-programs  \
     --disable-avdevice --disable-dct --disable-dwt --disable-lsp --disable-lzo --disable-rdft --disable-faan --disable-pixelutils \
-    --enable-zlib --enable-libopus --enable-libvpx --enable-libfdk_aac --enable-libopenh264 --enable-openssl ${ADDI_LIBS} \
+    --enable-zlib --enable-libopus --enable-libvpx --enable-libfdk_aac --enable-libopenh264 --enable-libsvtav1 --enable-openssl ${ADDI_LIBS} \
     --disable-everything \
     --disable-fast-unaligned \
     ${ADDI_HWACCEL} \
-    --enable-encoder=libvpx_vp8,libopus,libfdk_aac,libopenh264,mjpeg,png${ADDI_ENCODER} \
+    --enable-encoder=libvpx_vp8,libopus,libfdk_aac,libopenh264,libsvtav1,mjpeg,png${ADDI_ENCODER} \
     --enable-decoder=aac,aac_latm,aac_fixed,h264,hevc,opus,vp8${ADDI_DECODER} \
     --enable-parser=aac,aac_latm,aac_fixed,h264,hevc,opus,vp8 \
     --enable-network --enable-protocol=tcp --enable-protocol=udp --enable-protocol=rtp,file,rtmp,tls,rtmps --enable-demuxer=rtsp,flv,live_flv,mp4 --enable-muxer=mp4,webm,mpegts,flv,mpjpeg \
@@ -324,12 +338,12 @@ install_hiredis()
 
 install_base_ubuntu()
 {
-    sudo apt install -y build-essential autoconf libtool zlib1g-dev tclsh cmake curl pkg-config bc uuid-dev
+    sudo apt install -y build-essential autoconf libtool zlib1g-dev libbrotli-dev tclsh cmake curl pkg-config bc uuid-dev
 }
 
 install_base_fedora()
 {
-    sudo yum install -y gcc-c++ make autoconf libtool zlib-devel tcl cmake bc libuuid-devel 
+    sudo yum install -y gcc-c++ make autoconf libtool zlib-devel brotli-devel tcl cmake bc libuuid-devel 
     sudo yum install -y perl-IPC-Cmd
 }
 
@@ -347,7 +361,7 @@ install_base_centos()
         sudo yum install -y make git which
     fi
 
-    sudo yum install -y bc gcc-c++ autoconf libtool tcl bzip2 zlib-devel cmake libuuid-devel
+    sudo yum install -y bc gcc-c++ autoconf libtool tcl bzip2 zlib-devel brotli-devel cmake libuuid-devel
     sudo yum install -y perl-IPC-Cmd
 }
 
@@ -359,7 +373,7 @@ install_base_macos()
     fi
 
     # the default make on macOS does not work with these makefiles
-    brew install pkg-config nasm automake libtool xz cmake make
+    brew install pkg-config nasm automake libtool xz cmake make brotli
 
     # the nasm that comes with macOS does not work with libvpx thus put the path where the homebrew stuff is installed in front of PATH
     export PATH=/usr/local/bin:$PATH
@@ -472,6 +486,7 @@ install_libsrt
 install_libopus
 install_libopenh264
 install_libvpx
+install_libsvtav1
 install_fdk_aac
 install_nvcc_hdr
 install_ffmpeg
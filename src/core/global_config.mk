@@ -60,4 +60,6 @@ GLOBAL_LDFLAGS_RELEASE := $(GLOBAL_LDFLAGS_DEBUG) -O3
 ifneq ($(OS_VERSION), darwin)
     # -Wl,--export-dynamic: backtrace 출력가능
     GLOBAL_LDFLAGS_DEBUG := $(GLOBAL_LDFLAGS_DEBUG) -Wl,--export-dynamic
+    # The profiler (/v1/stats/current/internals/profile) also resolves the function names with it
+    GLOBAL_LDFLAGS_RELEASE := $(GLOBAL_LDFLAGS_RELEASE) -Wl,--export-dynamic
 endif
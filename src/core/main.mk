@@ -38,9 +38,11 @@ BUILD_TARGET_LIST :=
 # File list to delete
 BUILD_FILES_TO_CLEAN :=
 
-.PHONY: all help release
+.PHONY: all help release benchmarks
 all: directories_to_prepare build_target_list
 release: all
+# projects/benchmarks is added to BUILD_TARGET_LIST only for this goal
+benchmarks: all
 help:
 	@echo ""
 	@echo " $(ANSI_GREEN)* AMS Help Page$(ANSI_RESET)"
@@ -50,6 +52,7 @@ help:
 	@echo "   Commands:"
 	@echo "       $(ANSI_YELLOW)help$(ANSI_RESET): show this page"
 	@echo "       $(ANSI_YELLOW)release$(ANSI_RESET): make project to release"
+	@echo "       $(ANSI_YELLOW)benchmarks$(ANSI_RESET): make project with the micro-benchmarks (OvenMediaEngineBenchmarks)"
 	@echo ""
 
 # clean할 때 target이 삭제될 수 있도록 함
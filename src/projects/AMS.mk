@@ -11,7 +11,8 @@ PROJECT_CXX_INCLUDES := \
 PROJECT_CFLAGS := \
 	-D__STDC_CONSTANT_MACROS \
 	-Wfatal-errors \
-	-Wno-unused-function
+	-Wno-unused-function \
+	$(shell pkg-config --cflags libbrotlienc 2>/dev/null)
 
 PROJECT_CXXFLAGS := \
 	$(PROJECT_CFLAGS) \
@@ -19,7 +20,8 @@ PROJECT_CXXFLAGS := \
 	-std=c++17
 
 PROJECT_LDFLAGS := \
-	-ldl -lz
+	-ldl -lz \
+	$(shell pkg-config --libs-only-L libbrotlienc 2>/dev/null) -lbrotlienc
 
 include $(CLEAR_VARIABLES)
 include $(BUILD_SUB_AMS)
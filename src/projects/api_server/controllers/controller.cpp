@@ -43,6 +43,13 @@ namespace api
 		SetResponse(http::StatusCode::OK, nullptr, json);
 	}
 
+	ApiResponse::ApiResponse(const ov::JsonWriter &writer)
+	{
+		SetResponse(http::StatusCode::OK);
+
+		_serialized_response = writer.GetString();
+	}
+
 	ApiResponse::ApiResponse(const std::exception *error)
 	{
 		if (error == nullptr)
@@ -61,16 +68,28 @@ namespace api
 		SetResponse(http::StatusCode::InternalServerError, error->what());
 	}
 
+	ApiResponse::ApiResponse(const std::shared_ptr<const ov::String> &body, const ov::String &etag)
+		: _body(body),
+		  _etag(etag)
+	{
+	}
+
 	ApiResponse::ApiResponse(const ApiResponse &response)
 	{
 		_status_code = response._status_code;
 		_json = response._json;
+		_serialized_response = response._serialized_response;
+		_body = response._body;
+		_etag = response._etag;
 	}
 
 	ApiResponse::ApiResponse(ApiResponse &&response)
 	{
 		_status_code = std::move(response._status_code);
 		_json = std::move(response._json);
+		_serialized_response = std::move(response._serialized_response);
+		_body = std::move(response._body);
+		_etag = std::move(response._etag);
 	}
 
 	void ApiResponse::SetResponse(http::StatusCode status_code)
@@ -93,13 +112,90 @@ namespace api
 		_json["response"] = json;
 	}
 
+	ov::String ApiResponse::Serialize() const
+	{
+		if (_body != nullptr)
+		{
+			return *_body;
+		}
+
+		if (_serialized_response.IsEmpty() == false)
+		{
+			ov::JsonWriter writer(_serialized_response.GetLength() + 64);
+
+			writer.BeginObject();
+			writer.Write("statusCode", _json["statusCode"]);
+			writer.Write("message", _json["message"]);
+			writer.Key("response").Raw(_serialized_response);
+			writer.EndObject();
+
+			return writer.GetString();
+		}
+
+		return (_json.isNull() == false) ? ov::Json::Stringify(_json) : "";
+	}
+
 	bool ApiResponse::SendToClient(const std::shared_ptr<http::svr::HttpExchange> &client)
 	{
 		const auto &response = client->GetResponse();
 
+		if (_etag.IsEmpty() == false)
+		{
+			response->SetHeader("ETag", _etag);
+
+			if (http::IsETagMatched(client->GetRequest()->GetHeader("If-None-Match"), _etag))
+			{
+				response->SetStatusCode(http::StatusCode::NotModified);
+				return true;
+			}
+		}
+
 		response->SetStatusCode(_status_code);
 		response->SetHeader("Content-Type", "application/json;charset=UTF-8");
 
-		return (_json.isNull() == false) ? response->AppendString(ov::Json::Stringify(_json)) : true;
+		if (_body != nullptr)
+		{
+			return response->AppendString(*_body);
+		}
+
+		auto body = Serialize();
+
+		return body.IsEmpty() ? true : response->AppendString(body);
+	}
+
+	ApiResponse ResponseCache::Get(const ov::String &key, uint64_t generation, const std::function<ApiResponse()> &maker)
+	{
+		auto etag = ov::String::FormatString("\"%" PRIx64 "\"", generation);
+
+		{
+			std::lock_guard lock_guard(_mutex);
+
+			auto entry = _entries.find(key);
+			if ((entry != _entries.end()) && (entry->second.generation == generation))
+			{
+				return {entry->second.body, etag};
+			}
+		}
+
+		// The response is made without the lock. If the registry is changed meanwhile, the response may be newer than
+		// <generation>, which is harmless since it is replaced at the next generation.
+		auto response = maker();
+		if (response.IsSucceeded() == false)
+		{
+			return response;
+		}
+
+		auto body = std::make_shared<const ov::String>(response.Serialize());
+
+		std::lock_guard lock_guard(_mutex);
+
+		if ((_entries.size() >= API_RESPONSE_CACHE_MAX_ENTRIES) && (_entries.find(key) == _entries.end()))
+		{
+			_entries.clear();
+		}
+
+		_entries[key] = {generation, body};
+
+		return {body, etag};
 	}
 }  // namespace api
\ No newline at end of file
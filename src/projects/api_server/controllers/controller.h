@@ -16,6 +16,9 @@
 
 #include "../helpers/helpers.h"
 
+// The responses of this number of URLs are cached per controller at most (all of them are dropped when it is exceeded)
+#define API_RESPONSE_CACHE_MAX_ENTRIES 1024
+
 namespace api
 {
 	class Server;
@@ -55,12 +58,23 @@ namespace api
 		// }
 		ApiResponse(const Json::Value &json);
 
+		// {
+		//     "statusCode": 200,
+		//     "message": "OK",
+		//     "response": <JSON written by writer>
+		// }
+		ApiResponse(const ov::JsonWriter &writer);
+
 		// {
 		//     "statusCode": <error->GetCode()>,
 		//     "message": <error->GetMessage()>
 		// }
 		ApiResponse(const std::exception *error);
 
+		// The response that is serialized in advance (see ResponseCache), and its entity tag.
+		// If the entity tag is in If-None-Match of the request, 304 Not Modified is sent without the body.
+		ApiResponse(const std::shared_ptr<const ov::String> &body, const ov::String &etag);
+
 		// Copy ctor
 		ApiResponse(const ApiResponse &response);
 		// Move ctor
@@ -72,6 +86,9 @@ namespace api
 			return (static_cast<int>(_status_code) / 100) == 2;
 		}
 
+		// The body as it is sent (empty if there is nothing to send)
+		ov::String Serialize() const;
+
 		bool SendToClient(const std::shared_ptr<http::svr::HttpExchange> &client);
 
 	protected:
@@ -81,6 +98,34 @@ namespace api
 
 		http::StatusCode _status_code = http::StatusCode::OK;
 		Json::Value _json = Json::Value::null;
+		// The "response" that is already serialized (the stats of many streams are written without Json::Value)
+		ov::String _serialized_response;
+
+		// The whole body that is already serialized (shared with ResponseCache)
+		std::shared_ptr<const ov::String> _body;
+		ov::String _etag;
+	};
+
+	// Caches the serialized responses of the listings until the registry they are made from is changed, so the
+	// periodic polling of the listings does not rebuild the JSON every time.
+	// The generation of the registry (see mon::CommonMetrics::NextGeneration()) is the version of the cached response,
+	// and it is also used as the entity tag for the conditional requests.
+	class ResponseCache
+	{
+	public:
+		// Returns the cached response of <key> if it was made at <generation>. Otherwise, makes it with <maker> and caches it
+		// (the responses of the errors are not cached).
+		ApiResponse Get(const ov::String &key, uint64_t generation, const std::function<ApiResponse()> &maker);
+
+	private:
+		struct Entry
+		{
+			uint64_t generation = 0;
+			std::shared_ptr<const ov::String> body;
+		};
+
+		std::mutex _mutex;
+		std::map<ov::String, Entry> _entries;
 	};
 
 	class ControllerInterface
@@ -124,6 +169,8 @@ namespace api
 
 	protected:
 		using Handler = std::function<void(Tclass *clazz, const std::shared_ptr<http::svr::HttpExchange> &client)>;
+		// If the handler returns NextHandler::DoNotCallAndDoNotResponse, it must send the response and release the exchange later
+		using AsyncHandler = std::function<http::svr::NextHandler(Tclass *clazz, const std::shared_ptr<http::svr::HttpExchange> &client)>;
 
 		// API Handlers
 		using ApiHandler = ApiResponse (Tclass::*)(const std::shared_ptr<http::svr::HttpExchange> &client);
@@ -174,6 +221,38 @@ namespace api
 			});
 		}
 
+		void RegisterAsync(http::Method method, const ov::String &pattern, const AsyncHandler &handler)
+		{
+			auto new_pattern = ov::String::FormatString("^%s%s$", _prefix.CStr(), pattern.CStr());
+			auto that = dynamic_cast<Tclass *>(this);
+
+			_interceptor->Register(method, new_pattern, [that, handler](const std::shared_ptr<http::svr::HttpExchange> &client) -> http::svr::NextHandler {
+				if (that != nullptr)
+				{
+					try
+					{
+						return handler(that, client);
+					}
+					catch (const http::HttpError &error)
+					{
+						logw("APIController", "HTTP error occurred: %s", error.What());
+						ApiResponse(&error).SendToClient(client);
+					}
+					catch (const std::exception &error)
+					{
+						logw("APIController", "Unknown error occurred: %s", error.what());
+						ApiResponse(&error).SendToClient(client);
+					}
+				}
+				else
+				{
+					OV_ASSERT2(false);
+				}
+
+				return http::svr::NextHandler::DoNotCall;
+			});
+		}
+
 		void Register(http::Method method, const ov::String &pattern, const ApiHandler &handler)
 		{
 			Register(method, pattern, [handler](Tclass *clazz, const std::shared_ptr<http::svr::HttpExchange> &client) {
@@ -348,6 +427,15 @@ namespace api
 		API_CONTROLLER_REGISTER_HANDLERS(Delete)
 
 	protected:
+		// Returns the response of the request from the cache of this controller if the registry has not changed since it was
+		// cached (<generation>), or makes it with <maker>
+		ApiResponse GetCachedResponse(const std::shared_ptr<http::svr::HttpExchange> &client, uint64_t generation, const std::function<ApiResponse()> &maker)
+		{
+			return _response_cache.Get(client->GetRequest()->GetParsedUri()->Path(), generation, maker);
+		}
+
+		ResponseCache _response_cache;
+
 		// For all Handler registrations, prefix before pattern
 		ov::String _prefix;
 		std::shared_ptr<http::svr::DefaultInterceptor> _interceptor;
@@ -0,0 +1,154 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "metrics_controller.h"
+
+#include <base/ovcrypto/openssl/tls_server_data.h>
+#include <modules/dtls_srtp/dtls_handshake_worker_pool.h>
+#include <modules/dtls_srtp/dtls_transport.h>
+#include <orchestrator/orchestrator.h>
+
+#define OPEN_METRICS_CONTENT_TYPE "application/openmetrics-text; version=1.0.0; charset=utf-8"
+
+namespace api
+{
+	void MetricsController::PrepareHandlers()
+	{
+		Register(http::Method::Get, R"()", [](MetricsController *controller, const std::shared_ptr<http::svr::HttpExchange> &client) {
+			controller->OnGetMetrics(client);
+		});
+	}
+
+	void MetricsController::OnGetMetrics(const std::shared_ptr<http::svr::HttpExchange> &client)
+	{
+		ov::String metrics;
+
+		AppendServerMetrics(metrics);
+		AppendDtlsMetrics(metrics);
+		AppendTlsMetrics(metrics);
+		AppendStartupMetrics(metrics);
+		AppendHistograms(metrics);
+
+		metrics.Append("# EOF\n");
+
+		auto response = client->GetResponse();
+
+		response->SetStatusCode(http::StatusCode::OK);
+		response->SetHeader("Content-Type", OPEN_METRICS_CONTENT_TYPE);
+		response->AppendString(metrics);
+	}
+
+	void MetricsController::AppendServerMetrics(ov::String &metrics)
+	{
+		auto server_metrics = MonitorInstance->GetServerMetrics();
+
+		if (server_metrics == nullptr)
+		{
+			return;
+		}
+
+		metrics.Append("# TYPE ome_bytes_in counter\n");
+		metrics.Append("# HELP ome_bytes_in Bytes received from the providers\n");
+		metrics.AppendFormat("ome_bytes_in_total %" PRIu64 "\n", server_metrics->GetTotalBytesIn());
+
+		metrics.Append("# TYPE ome_bytes_out counter\n");
+		metrics.Append("# HELP ome_bytes_out Bytes sent by the publishers\n");
+		for (int i = 0; i < static_cast<int>(PublisherType::NumberOfPublishers); i++)
+		{
+			auto type = static_cast<PublisherType>(i);
+
+			if (type != PublisherType::Unknown)
+			{
+				metrics.AppendFormat("ome_bytes_out_total{publisher=\"%s\"} %" PRIu64 "\n", ::StringFromPublisherType(type).CStr(), server_metrics->GetBytesOut(type));
+			}
+		}
+
+		metrics.Append("# TYPE ome_connections gauge\n");
+		metrics.Append("# HELP ome_connections Concurrent sessions of the publishers\n");
+		for (int i = 0; i < static_cast<int>(PublisherType::NumberOfPublishers); i++)
+		{
+			auto type = static_cast<PublisherType>(i);
+
+			if (type != PublisherType::Unknown)
+			{
+				metrics.AppendFormat("ome_connections{publisher=\"%s\"} %" PRIu64 "\n", ::StringFromPublisherType(type).CStr(), server_metrics->GetConnections(type));
+			}
+		}
+	}
+
+	void MetricsController::AppendDtlsMetrics(ov::String &metrics)
+	{
+		auto pool = DtlsHandshakeWorkerPool::GetInstance();
+
+		metrics.Append("# TYPE ome_dtls_handshaking_sessions gauge\n");
+		metrics.Append("# HELP ome_dtls_handshaking_sessions Sessions waiting for the DTLS handshake to complete\n");
+		metrics.AppendFormat("ome_dtls_handshaking_sessions %zu\n", DtlsTransport::GetHandshakingCount());
+
+		metrics.Append("# TYPE ome_dtls_handshake_queue gauge\n");
+		metrics.Append("# HELP ome_dtls_handshake_queue Sessions waiting for a DTLS handshake worker\n");
+		metrics.AppendFormat("ome_dtls_handshake_queue %zu\n", pool->GetPendingCount());
+
+		metrics.Append("# TYPE ome_dtls_handshake_rejected counter\n");
+		metrics.Append("# HELP ome_dtls_handshake_rejected Handshake packets dropped because too many sessions were waiting for a worker\n");
+		metrics.AppendFormat("ome_dtls_handshake_rejected_total %" PRIu64 "\n", pool->GetRejectedCount());
+	}
+
+	void MetricsController::AppendTlsMetrics(ov::String &metrics)
+	{
+		auto stats = ov::TlsServerData::GetHandshakeStats();
+
+		metrics.Append("# TYPE ome_tls_handshakes counter\n");
+		metrics.Append("# HELP ome_tls_handshakes TLS handshakes completed by the HTTPS servers\n");
+		metrics.AppendFormat("ome_tls_handshakes_total %" PRIu64 "\n", stats.handshake_count);
+
+		metrics.Append("# TYPE ome_tls_resumed_handshakes counter\n");
+		metrics.Append("# HELP ome_tls_resumed_handshakes TLS handshakes that resumed a session with a session ID or a session ticket\n");
+		metrics.AppendFormat("ome_tls_resumed_handshakes_total %" PRIu64 "\n", stats.resumed_count);
+	}
+
+	void MetricsController::AppendStartupMetrics(ov::String &metrics)
+	{
+		int64_t elapsed_ms = 0;
+		auto timeline = ocst::Orchestrator::GetInstance()->GetStartupTimeline(&elapsed_ms);
+
+		if (timeline.empty())
+		{
+			return;
+		}
+
+		metrics.Append("# TYPE ome_startup_applications_seconds gauge\n");
+		metrics.Append("# HELP ome_startup_applications_seconds Time taken to create the applications of the configuration when the server started\n");
+		metrics.AppendFormat("ome_startup_applications_seconds %.3f\n", elapsed_ms / 1000.0);
+
+		metrics.Append("# TYPE ome_startup_module_seconds gauge\n");
+		metrics.Append("# HELP ome_startup_module_seconds Time taken by each module to create the applications of the configuration when the server started\n");
+		for (const auto &module_time : timeline)
+		{
+			metrics.AppendFormat("ome_startup_module_seconds{module=\"%s\"} %.3f\n", module_time.module_name.CStr(), module_time.elapsed_ms / 1000.0);
+		}
+	}
+
+	void MetricsController::AppendHistograms(ov::String &metrics)
+	{
+		ov::Histogram::ForEach([&metrics](const ov::Histogram &histogram) {
+			auto name = histogram.GetName().CStr();
+			auto snapshot = histogram.GetSnapshot();
+
+			metrics.AppendFormat("# TYPE %s histogram\n", name);
+			metrics.AppendFormat("# HELP %s %s\n", name, histogram.GetHelp().CStr());
+
+			for (const auto &bucket : snapshot.buckets)
+			{
+				metrics.AppendFormat("%s_bucket{le=\"%.9g\"} %" PRIu64 "\n", name, bucket.upper_bound, bucket.count);
+			}
+
+			metrics.AppendFormat("%s_bucket{le=\"+Inf\"} %" PRIu64 "\n", name, snapshot.count);
+			metrics.AppendFormat("%s_sum %.9g\n", name, snapshot.sum);
+			metrics.AppendFormat("%s_count %" PRIu64 "\n", name, snapshot.count);
+		});
+	}
+}  // namespace api
@@ -0,0 +1,29 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include "../controller.h"
+
+namespace api
+{
+	// Exports the metrics of the server in OpenMetrics text format for Prometheus (GET /metrics)
+	class MetricsController : public Controller<MetricsController>
+	{
+	public:
+		void PrepareHandlers() override;
+
+	protected:
+		void OnGetMetrics(const std::shared_ptr<http::svr::HttpExchange> &client);
+
+		void AppendServerMetrics(ov::String &metrics);
+		void AppendDtlsMetrics(ov::String &metrics);
+		void AppendTlsMetrics(ov::String &metrics);
+		void AppendStartupMetrics(ov::String &metrics);
+		void AppendHistograms(ov::String &metrics);
+	};
+}  // namespace api
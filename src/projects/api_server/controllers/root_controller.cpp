@@ -10,6 +10,7 @@
 
 #include <base/ovcrypto/ovcrypto.h>
 
+#include "metrics/metrics_controller.h"
 #include "v1/v1_controller.h"
 
 namespace api
@@ -37,6 +38,9 @@ namespace api
 		// Currently only v1 is supported
 		CreateSubController<v1::V1Controller>(R"(\/v1)");
 
+		// OpenMetrics endpoint for Prometheus
+		CreateSubController<MetricsController>(R"(\/metrics)");
+
 		// This handler is called if it does not match all other registered handlers
 		Register(http::Method::All, R"(.+)", &RootController::OnNotFound);
 	}
@@ -0,0 +1,36 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "load_controller.h"
+
+#include <orchestrator/orchestrator.h>
+
+#include "../../../api_private.h"
+
+namespace api
+{
+	namespace v1
+	{
+		void LoadController::PrepareHandlers()
+		{
+			RegisterGet(R"()", &LoadController::OnGetLoad);
+		};
+
+		// GET /v1/load
+		ApiResponse LoadController::OnGetLoad(const std::shared_ptr<http::svr::HttpExchange> &client)
+		{
+			// The report is made by the timer of LoadReporter, so the load balancers can poll it frequently
+			auto report = ocst::Orchestrator::GetInstance()->GetLoadReport();
+			if (report == nullptr)
+			{
+				throw http::HttpError(http::StatusCode::NotFound, "LoadReport module is disabled");
+			}
+
+			return report->json;
+		}
+	}  // namespace v1
+}  // namespace api
@@ -0,0 +1,26 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include "../../controller.h"
+
+namespace api
+{
+	namespace v1
+	{
+		class LoadController : public Controller<LoadController>
+		{
+		public:
+			void PrepareHandlers() override;
+
+		protected:
+			// GET /v1/load
+			ApiResponse OnGetLoad(const std::shared_ptr<http::svr::HttpExchange> &client);
+		};
+	}  // namespace v1
+}  // namespace api
@@ -0,0 +1,125 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "server_actions_controller.h"
+
+#include <monitoring/monitoring.h>
+#include <orchestrator/orchestrator.h>
+
+#include "../../../api_private.h"
+
+namespace api
+{
+	namespace v1
+	{
+		void ServerActionsController::PrepareHandlers()
+		{
+			RegisterGet(R"((drain))", &ServerActionsController::OnGetDrain);
+			RegisterPost(R"((drain))", &ServerActionsController::OnPostDrain);
+			RegisterPost(R"((resume))", &ServerActionsController::OnPostResume);
+		};
+
+		// POST /v1/server:drain
+		ApiResponse ServerActionsController::OnPostDrain(const std::shared_ptr<http::svr::HttpExchange> &client,
+														 const Json::Value &request_body)
+		{
+			std::vector<ocst::DrainAlternative> alternatives;
+
+			if (request_body.isObject() && request_body.isMember("alternatives"))
+			{
+				auto &alternatives_value = request_body["alternatives"];
+
+				if (alternatives_value.isArray() == false)
+				{
+					throw http::HttpError(http::StatusCode::BadRequest, "alternatives must be an array");
+				}
+
+				for (const auto &alternative_value : alternatives_value)
+				{
+					ocst::DrainAlternative alternative;
+
+					// "<host>" or {"host": "<host>", "weight": <weight>}
+					if (alternative_value.isString())
+					{
+						alternative.host = alternative_value.asCString();
+					}
+					else if (alternative_value.isObject() && alternative_value["host"].isString())
+					{
+						alternative.host = alternative_value["host"].asCString();
+
+						if (alternative_value.isMember("weight"))
+						{
+							if (alternative_value["weight"].isUInt() == false)
+							{
+								throw http::HttpError(http::StatusCode::BadRequest, "weight of %s must be an unsigned integer", alternative.host.CStr());
+							}
+
+							alternative.weight = alternative_value["weight"].asUInt();
+						}
+					}
+
+					if (alternative.host.IsEmpty())
+					{
+						throw http::HttpError(http::StatusCode::BadRequest, "host of the alternative is required");
+					}
+
+					alternatives.push_back(alternative);
+				}
+			}
+
+			ocst::Orchestrator::GetInstance()->StartDrain(alternatives);
+
+			return MakeDrainStatus();
+		}
+
+		// POST /v1/server:resume
+		ApiResponse ServerActionsController::OnPostResume(const std::shared_ptr<http::svr::HttpExchange> &client,
+														  const Json::Value &request_body)
+		{
+			ocst::Orchestrator::GetInstance()->StopDrain();
+
+			return MakeDrainStatus();
+		}
+
+		// GET /v1/server:drain
+		ApiResponse ServerActionsController::OnGetDrain(const std::shared_ptr<http::svr::HttpExchange> &client)
+		{
+			return MakeDrainStatus();
+		}
+
+		Json::Value ServerActionsController::MakeDrainStatus() const
+		{
+			auto orchestrator = ocst::Orchestrator::GetInstance();
+			Json::Value status(Json::ValueType::objectValue);
+
+			status["draining"] = orchestrator->IsDraining();
+
+			auto start_time = orchestrator->GetDrainStartTimeMSec();
+			if (start_time > 0)
+			{
+				status["elapsedMSec"] = static_cast<Json::Int64>(ov::Clock::NowMSec() - start_time);
+			}
+
+			// The tooling waits for the existing sessions to end before it stops the server
+			status["totalConnections"] = MonitorInstance->GetServerMetrics()->GetTotalConnections();
+
+			Json::Value alternatives_value(Json::ValueType::arrayValue);
+			for (const auto &alternative : orchestrator->GetDrainAlternatives())
+			{
+				Json::Value alternative_value;
+
+				alternative_value["host"] = alternative.host.CStr();
+				alternative_value["weight"] = alternative.weight;
+
+				alternatives_value.append(alternative_value);
+			}
+			status["alternatives"] = alternatives_value;
+
+			return status;
+		}
+	}  // namespace v1
+}  // namespace api
@@ -0,0 +1,38 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include "../../controller.h"
+
+namespace api
+{
+	namespace v1
+	{
+		class ServerActionsController : public Controller<ServerActionsController>
+		{
+		public:
+			void PrepareHandlers() override;
+
+		protected:
+			// POST /v1/server:drain
+			// {"alternatives": [{"host": "<host>[:<port>]", "weight": <weight>}, ...]}
+			ApiResponse OnPostDrain(const std::shared_ptr<http::svr::HttpExchange> &client,
+									const Json::Value &request_body);
+
+			// POST /v1/server:resume
+			ApiResponse OnPostResume(const std::shared_ptr<http::svr::HttpExchange> &client,
+									 const Json::Value &request_body);
+
+			// GET /v1/server:drain
+			ApiResponse OnGetDrain(const std::shared_ptr<http::svr::HttpExchange> &client);
+
+		private:
+			Json::Value MakeDrainStatus() const;
+		};
+	}  // namespace v1
+}  // namespace api
@@ -28,7 +28,10 @@ namespace api
 			ApiResponse CurrentController::OnGetServerMetrics(const std::shared_ptr<http::svr::HttpExchange> &client)
 			{
 				auto serverMetric = MonitorInstance->GetServerMetrics();
-				return ::serdes::JsonFromMetrics(serverMetric);
+				ov::JsonWriter writer;
+				::serdes::WriteMetrics(writer, serverMetric);
+
+				return writer;
 			}
 		}  // namespace stats
 	}	   // namespace v1
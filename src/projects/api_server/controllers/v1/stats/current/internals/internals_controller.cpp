@@ -8,6 +8,22 @@
 //==============================================================================
 #include "internals_controller.h"
 
+// Default/maximum duration of /profile
+#define INTERNALS_PROFILE_DEFAULT_DURATION_MS 10000
+#define INTERNALS_PROFILE_MAX_DURATION_MS 60000
+// Default/maximum sampling frequency of /profile (99 Hz avoids the lockstep with the timers of 100 Hz)
+#define INTERNALS_PROFILE_DEFAULT_FREQUENCY 99
+#define INTERNALS_PROFILE_MAX_FREQUENCY 1000
+// Default/maximum interval of /threads to calculate the CPU usage
+#define INTERNALS_THREADS_DEFAULT_INTERVAL_MS 1000
+#define INTERNALS_THREADS_MAX_INTERVAL_MS 10000
+// Default/maximum number of the call stacks of /dataCopies
+#define INTERNALS_DATA_COPIES_DEFAULT_STACK_COUNT 20
+#define INTERNALS_DATA_COPIES_MAX_STACK_COUNT OV_DATA_COPY_AUDIT_MAX_STACK_COUNT
+// Default/maximum number of the locks of /locks
+#define INTERNALS_LOCKS_DEFAULT_COUNT 20
+#define INTERNALS_LOCKS_MAX_COUNT 1000
+
 namespace api
 {
 	namespace v1
@@ -18,6 +34,15 @@ namespace api
 			{
 				RegisterGet(R"()", &InternalsController::OnGetInternals);
 				RegisterGet(R"(\/queues)", &InternalsController::OnGetQueues);
+				RegisterGet(R"(\/dataPools)", &InternalsController::OnGetDataPools);
+				RegisterGet(R"(\/ktls)", &InternalsController::OnGetKtls);
+				RegisterGet(R"(\/segmentWorkers)", &InternalsController::OnGetSegmentWorkers);
+				RegisterGet(R"(\/latency)", &InternalsController::OnGetLatency);
+				RegisterGet(R"(\/threads)", &InternalsController::OnGetThreads);
+				RegisterGet(R"(\/locks)", &InternalsController::OnGetLocks);
+				RegisterGet(R"(\/dataCopies)", &InternalsController::OnGetDataCopies);
+				RegisterPost(R"(\/dataCopies)", &InternalsController::OnPostDataCopies);
+				RegisterAsync(http::Method::Get, R"(\/profile)", &InternalsController::OnGetProfile);
 			};
 
 			ApiResponse InternalsController::OnGetInternals(const std::shared_ptr<http::svr::HttpExchange> &client)
@@ -25,6 +50,14 @@ namespace api
 				Json::Value response(Json::ValueType::arrayValue);
 
 				response.append("/v1/stats/current/internals/queues");
+				response.append("/v1/stats/current/internals/dataPools");
+				response.append("/v1/stats/current/internals/ktls");
+				response.append("/v1/stats/current/internals/segmentWorkers");
+				response.append("/v1/stats/current/internals/latency");
+				response.append("/v1/stats/current/internals/threads");
+				response.append("/v1/stats/current/internals/locks");
+				response.append("/v1/stats/current/internals/dataCopies");
+				response.append("/v1/stats/current/internals/profile");
 
 				return response;
 			}
@@ -47,6 +80,230 @@ namespace api
 
 				return response;
 			}
+
+			ApiResponse InternalsController::OnGetDataPools(const std::shared_ptr<http::svr::HttpExchange> &client)
+			{
+				Json::Value response(Json::ValueType::arrayValue);
+
+				auto serverMetric = MonitorInstance->GetServerMetrics();
+
+				for (auto &stats : serverMetric->GetDataPoolStats())
+				{
+					response.append(serdes::JsonFromDataPoolStats(stats));
+				}
+
+				return response;
+			}
+
+			ApiResponse InternalsController::OnGetKtls(const std::shared_ptr<http::svr::HttpExchange> &client)
+			{
+				auto serverMetric = MonitorInstance->GetServerMetrics();
+
+				return serdes::JsonFromKtlsStats(serverMetric->GetKtlsStats());
+			}
+
+			ApiResponse InternalsController::OnGetSegmentWorkers(const std::shared_ptr<http::svr::HttpExchange> &client)
+			{
+				Json::Value response(Json::ValueType::arrayValue);
+
+				for (auto &stats : SegmentWorkerManager::GetStatsList())
+				{
+					response.append(serdes::JsonFromSegmentWorkerManagerStats(stats));
+				}
+
+				return response;
+			}
+
+			ApiResponse InternalsController::OnGetLatency(const std::shared_ptr<http::svr::HttpExchange> &client)
+			{
+				ov::JsonWriter writer;
+
+				auto serverMetric = MonitorInstance->GetServerMetrics();
+
+				writer.BeginArray();
+
+				for (auto &[host_id, host_metrics] : serverMetric->GetHostMetricsList())
+				{
+					for (auto &[app_id, app_metrics] : host_metrics->GetApplicationMetricsList())
+					{
+						for (auto &[stream_id, stream_metrics] : app_metrics->GetStreamMetricsMap())
+						{
+							auto latency_metrics = stream_metrics->FindLatencyMetrics();
+							if (latency_metrics == nullptr)
+							{
+								continue;
+							}
+
+							writer.BeginObject();
+
+							serdes::WriteLatencyMetricsFields(writer, latency_metrics);
+
+							writer.Write("vhost", app_metrics->GetName().GetVHostName());
+							writer.Write("app", app_metrics->GetName().GetAppName());
+							writer.Write("stream", stream_metrics->GetName());
+
+							writer.EndObject();
+						}
+					}
+				}
+
+				writer.EndArray();
+
+				return writer;
+			}
+
+			ApiResponse InternalsController::OnGetThreads(const std::shared_ptr<http::svr::HttpExchange> &client)
+			{
+				auto url = ov::Url::Parse(client->GetRequest()->GetUri());
+
+				int64_t interval_ms = INTERNALS_THREADS_DEFAULT_INTERVAL_MS;
+
+				if ((url != nullptr) && url->HasQueryKey("interval"))
+				{
+					interval_ms = ov::Converter::ToInt64(url->GetQueryValue("interval"));
+				}
+
+				if ((interval_ms <= 0) || (interval_ms > INTERNALS_THREADS_MAX_INTERVAL_MS))
+				{
+					throw http::HttpError(http::StatusCode::BadRequest, "interval must be between 1 and %d (ms)", INTERNALS_THREADS_MAX_INTERVAL_MS);
+				}
+
+				Json::Value response(Json::ValueType::arrayValue);
+
+				// Sorted by the CPU usage
+				for (auto &info : ov::ThreadRegistry::GetThreadInfoList(interval_ms))
+				{
+					response.append(serdes::JsonFromThreadInfo(info));
+				}
+
+				return response;
+			}
+
+			ApiResponse InternalsController::OnGetLocks(const std::shared_ptr<http::svr::HttpExchange> &client)
+			{
+				auto url = ov::Url::Parse(client->GetRequest()->GetUri());
+
+				int64_t count = INTERNALS_LOCKS_DEFAULT_COUNT;
+
+				if ((url != nullptr) && url->HasQueryKey("count"))
+				{
+					count = ov::Converter::ToInt64(url->GetQueryValue("count"));
+				}
+
+				if ((count <= 0) || (count > INTERNALS_LOCKS_MAX_COUNT))
+				{
+					throw http::HttpError(http::StatusCode::BadRequest, "count must be between 1 and %d", INTERNALS_LOCKS_MAX_COUNT);
+				}
+
+				// Sorted by the total time waited for the lock
+				return serdes::JsonFromLockStatsList(ov::LockProfiler::GetTopContendedLocks(count));
+			}
+
+			ApiResponse InternalsController::OnGetDataCopies(const std::shared_ptr<http::svr::HttpExchange> &client)
+			{
+				auto url = ov::Url::Parse(client->GetRequest()->GetUri());
+
+				int64_t count = INTERNALS_DATA_COPIES_DEFAULT_STACK_COUNT;
+
+				if ((url != nullptr) && url->HasQueryKey("count"))
+				{
+					count = ov::Converter::ToInt64(url->GetQueryValue("count"));
+				}
+
+				if ((count < 0) || (count > INTERNALS_DATA_COPIES_MAX_STACK_COUNT))
+				{
+					throw http::HttpError(http::StatusCode::BadRequest, "count must be between 0 and %d", INTERNALS_DATA_COPIES_MAX_STACK_COUNT);
+				}
+
+				return serdes::JsonFromDataCopyAuditStats(ov::DataCopyAudit::GetStats(count));
+			}
+
+			ApiResponse InternalsController::OnPostDataCopies(const std::shared_ptr<http::svr::HttpExchange> &client, const Json::Value &request_body)
+			{
+				if (request_body.isObject() == false)
+				{
+					throw http::HttpError(http::StatusCode::BadRequest, "Request body must be an object");
+				}
+
+				auto &enabled = request_body["enabled"];
+				auto &reset = request_body["reset"];
+
+				if ((enabled.isNull() == false) && (enabled.isBool() == false))
+				{
+					throw http::HttpError(http::StatusCode::BadRequest, "enabled must be a boolean");
+				}
+
+				if ((reset.isNull() == false) && (reset.isBool() == false))
+				{
+					throw http::HttpError(http::StatusCode::BadRequest, "reset must be a boolean");
+				}
+
+				if (reset.asBool())
+				{
+					ov::DataCopyAudit::Reset();
+				}
+
+				if (enabled.isBool())
+				{
+					ov::DataCopyAudit::SetEnabled(enabled.asBool());
+				}
+
+				return serdes::JsonFromDataCopyAuditStats(ov::DataCopyAudit::GetStats(0));
+			}
+
+			http::svr::NextHandler InternalsController::OnGetProfile(const std::shared_ptr<http::svr::HttpExchange> &client)
+			{
+				auto url = ov::Url::Parse(client->GetRequest()->GetUri());
+
+				int64_t duration_ms = INTERNALS_PROFILE_DEFAULT_DURATION_MS;
+				int32_t frequency = INTERNALS_PROFILE_DEFAULT_FREQUENCY;
+
+				if ((url != nullptr) && url->HasQueryKey("duration"))
+				{
+					duration_ms = ov::Converter::ToInt64(url->GetQueryValue("duration"));
+				}
+
+				if ((url != nullptr) && url->HasQueryKey("frequency"))
+				{
+					frequency = ov::Converter::ToInt32(url->GetQueryValue("frequency"));
+				}
+
+				if ((duration_ms <= 0) || (duration_ms > INTERNALS_PROFILE_MAX_DURATION_MS))
+				{
+					throw http::HttpError(http::StatusCode::BadRequest, "duration must be between 1 and %d (ms)", INTERNALS_PROFILE_MAX_DURATION_MS);
+				}
+
+				if ((frequency <= 0) || (frequency > INTERNALS_PROFILE_MAX_FREQUENCY))
+				{
+					throw http::HttpError(http::StatusCode::BadRequest, "frequency must be between 1 and %d (Hz)", INTERNALS_PROFILE_MAX_FREQUENCY);
+				}
+
+				// The profile takes <duration_ms>, so it is collected by its own thread instead of blocking the worker of the API server,
+				// and the response is sent from there
+				std::thread([client, duration_ms, frequency]() {
+					::pthread_setname_np(::pthread_self(), "APIProfile");
+
+					auto response = client->GetResponse();
+					ov::String folded_stacks;
+
+					if (ov::Profiler::CollectFoldedStacks(duration_ms, frequency, &folded_stacks))
+					{
+						response->SetStatusCode(http::StatusCode::OK);
+						response->SetHeader("Content-Type", "text/plain; charset=utf-8");
+						response->AppendString(folded_stacks);
+					}
+					else
+					{
+						http::HttpError error(http::StatusCode::Conflict, "Could not start the profiler (another profile may be in progress)");
+						ApiResponse(&error).SendToClient(client);
+					}
+
+					response->Response();
+					client->Release();
+				}).detach();
+
+				return http::svr::NextHandler::DoNotCallAndDoNotResponse;
+			}
 		}  // namespace stats
 	}	   // namespace v1
-}  // namespace api
\ No newline at end of file
+}  // namespace api
@@ -24,6 +24,17 @@ namespace api
 			protected:
 				ApiResponse OnGetInternals(const std::shared_ptr<http::svr::HttpExchange> &client);
 				ApiResponse OnGetQueues(const std::shared_ptr<http::svr::HttpExchange> &client);
+				ApiResponse OnGetDataPools(const std::shared_ptr<http::svr::HttpExchange> &client);
+				ApiResponse OnGetKtls(const std::shared_ptr<http::svr::HttpExchange> &client);
+				ApiResponse OnGetSegmentWorkers(const std::shared_ptr<http::svr::HttpExchange> &client);
+				ApiResponse OnGetLatency(const std::shared_ptr<http::svr::HttpExchange> &client);
+				ApiResponse OnGetThreads(const std::shared_ptr<http::svr::HttpExchange> &client);
+				ApiResponse OnGetLocks(const std::shared_ptr<http::svr::HttpExchange> &client);
+				ApiResponse OnGetDataCopies(const std::shared_ptr<http::svr::HttpExchange> &client);
+				// Enables/disables/resets the copy audit of ov::Data
+				ApiResponse OnPostDataCopies(const std::shared_ptr<http::svr::HttpExchange> &client, const Json::Value &request_body);
+				// Responds the folded stacks as text/plain instead of JSON, after the profile is collected by another thread
+				http::svr::NextHandler OnGetProfile(const std::shared_ptr<http::svr::HttpExchange> &client);
 			};
 		}  // namespace stats
 	}	   // namespace v1
@@ -27,7 +27,10 @@ namespace api
 												 const std::shared_ptr<mon::HostMetrics> &vhost,
 												 const std::shared_ptr<mon::ApplicationMetrics> &app)
 			{
-				return ::serdes::JsonFromMetrics(app);
+				ov::JsonWriter writer;
+				::serdes::WriteMetrics(writer, app);
+
+				return writer;
 			}
 		}  // namespace stats
 	}	   // namespace v1
@@ -25,7 +25,10 @@ namespace api
 													   const std::shared_ptr<mon::StreamMetrics> &stream,
 													   const std::vector<std::shared_ptr<mon::StreamMetrics>> &output_streams)
 			{
-				return ::serdes::JsonFromMetrics(stream);
+				ov::JsonWriter writer;
+				::serdes::WriteStreamMetrics(writer, stream);
+
+				return writer;
 			}
 		}  // namespace stats
 	}	   // namespace v1
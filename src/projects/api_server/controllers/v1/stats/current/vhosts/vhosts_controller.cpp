@@ -26,7 +26,10 @@ namespace api
 			ApiResponse VHostsController::OnGetVhost(const std::shared_ptr<http::svr::HttpExchange> &client,
 													 const std::shared_ptr<mon::HostMetrics> &vhost)
 			{
-				return ::serdes::JsonFromMetrics(vhost);
+				ov::JsonWriter writer;
+				::serdes::WriteMetrics(writer, vhost);
+
+				return writer;
 			}
 		}  // namespace stats
 	}	   // namespace v1
@@ -8,6 +8,8 @@
 //==============================================================================
 #include "v1_controller.h"
 
+#include "load/load_controller.h"
+#include "server/server_actions_controller.h"
 #include "stats/stats_controller.h"
 #include "vhosts/vhosts_controller.h"
 
@@ -20,6 +22,10 @@ namespace api
 			CreateSubController<VHostsController>(R"(\/vhosts)");
 			
 			CreateSubController<stats::StatsController>(R"(\/stats)");
+
+			CreateSubController<ServerActionsController>(R"(\/server:)");
+
+			CreateSubController<LoadController>(R"(\/load)");
 		};
 	}  // namespace v1
 }  // namespace api
\ No newline at end of file
@@ -37,6 +37,7 @@ namespace api
 			//----------------------------------------
 			RegisterPost(R"((pushes))", &AppActionsController::OnPostPushes);
 			RegisterPost(R"((startPush))", &AppActionsController::OnPostStartPush);
+			RegisterPost(R"((startPushes))", &AppActionsController::OnPostStartPushes);
 			RegisterPost(R"((stopPush))", &AppActionsController::OnPostStopPush);
 			// @GET action will be deprecated
 			RegisterGet(R"((pushes))", &AppActionsController::OnGetPushes);
@@ -271,14 +272,12 @@ namespace api
 			return {http::StatusCode::OK, std::move(response)};
 		}
 
-		ApiResponse AppActionsController::OnPostStartPush(const std::shared_ptr<http::svr::HttpExchange> &client,
-														  const Json::Value &request_body,
-														  const std::shared_ptr<mon::HostMetrics> &vhost,
-														  const std::shared_ptr<mon::ApplicationMetrics> &app)
+		Json::Value AppActionsController::StartPush(const std::shared_ptr<http::svr::HttpExchange> &client,
+													const Json::Value &request_push,
+													const std::shared_ptr<mon::HostMetrics> &vhost,
+													const std::shared_ptr<mon::ApplicationMetrics> &app)
 		{
-			Json::Value response;
-
-			auto push{::serdes::PushFromJson(request_body)};
+			auto push{::serdes::PushFromJson(request_push)};
 			if (push == nullptr)
 			{
 				throw http::HttpError(http::StatusCode::BadRequest,
@@ -335,11 +334,56 @@ namespace api
 				ocst::Orchestrator::GetInstance()->RequestPullStreamWithOriginMap(url, app_name, stream_name);
 			}
 
-			response.append(::serdes::JsonFromPush(push));
+			return ::serdes::JsonFromPush(push);
+		}
+
+		ApiResponse AppActionsController::OnPostStartPush(const std::shared_ptr<http::svr::HttpExchange> &client,
+														  const Json::Value &request_body,
+														  const std::shared_ptr<mon::HostMetrics> &vhost,
+														  const std::shared_ptr<mon::ApplicationMetrics> &app)
+		{
+			Json::Value response;
+
+			response.append(StartPush(client, request_body, vhost, app));
 
 			return {http::StatusCode::OK, std::move(response)};
 		}
 
+		ApiResponse AppActionsController::OnPostStartPushes(const std::shared_ptr<http::svr::HttpExchange> &client,
+															const Json::Value &request_body,
+															const std::shared_ptr<mon::HostMetrics> &vhost,
+															const std::shared_ptr<mon::ApplicationMetrics> &app)
+		{
+			if (request_body.isArray() == false)
+			{
+				throw http::HttpError(http::StatusCode::BadRequest, "Request body must be an array");
+			}
+
+			Json::Value response_value(Json::ValueType::arrayValue);
+			MultipleStatus status_codes;
+
+			for (const auto &request_push : request_body)
+			{
+				try
+				{
+					Json::Value response;
+					response["statusCode"] = static_cast<int>(http::StatusCode::OK);
+					response["message"] = StringFromStatusCode(http::StatusCode::OK);
+					response["response"] = StartPush(client, request_push, vhost, app);
+
+					status_codes.AddStatusCode(http::StatusCode::OK);
+					response_value.append(std::move(response));
+				}
+				catch (const http::HttpError &error)
+				{
+					status_codes.AddStatusCode(error.GetStatusCode());
+					response_value.append(::serdes::JsonFromError(error));
+				}
+			}
+
+			return {status_codes, std::move(response_value)};
+		}
+
 		ApiResponse AppActionsController::OnPostStopPush(const std::shared_ptr<http::svr::HttpExchange> &client,
 														 const Json::Value &request_body,
 														 const std::shared_ptr<mon::HostMetrics> &vhost,
@@ -54,6 +54,11 @@ namespace api
 										const std::shared_ptr<mon::HostMetrics> &vhost,
 										const std::shared_ptr<mon::ApplicationMetrics> &app);
 			
+			// POST /v1/vhosts/<vhost_name>/apps/<app_name>:startPushes
+			ApiResponse OnPostStartPushes(const std::shared_ptr<http::svr::HttpExchange> &client, const Json::Value &request_body,
+										  const std::shared_ptr<mon::HostMetrics> &vhost,
+										  const std::shared_ptr<mon::ApplicationMetrics> &app);
+
 			// POST /v1/vhosts/<vhost_name>/apps/<app_name>:stopPush
 			ApiResponse OnPostStopPush(const std::shared_ptr<http::svr::HttpExchange> &client, const Json::Value &request_body,
 									   const std::shared_ptr<mon::HostMetrics> &vhost,
@@ -63,6 +68,12 @@ namespace api
 			ApiResponse OnGetDummyAction(const std::shared_ptr<http::svr::HttpExchange> &client,
 										 const std::shared_ptr<mon::HostMetrics> &vhost,
 										 const std::shared_ptr<mon::ApplicationMetrics> &app);
+
+		private:
+			// Starts a push of <request_push>, and returns the push (throws http::HttpError if failed)
+			Json::Value StartPush(const std::shared_ptr<http::svr::HttpExchange> &client, const Json::Value &request_push,
+								  const std::shared_ptr<mon::HostMetrics> &vhost,
+								  const std::shared_ptr<mon::ApplicationMetrics> &app);
 		};
 	}  // namespace v1
 }  // namespace api
@@ -51,72 +51,102 @@ namespace api
 				throw http::HttpError(http::StatusCode::BadRequest, "Request body must be an array");
 			}
 
-			Json::Value response_value(Json::ValueType::arrayValue);
 			// Copy values to fill default values
 			Json::Value requested_app_list = request_body;
+			auto app_count = requested_app_list.size();
 
-			MultipleStatus status_codes;
+			// Parse all applications first, and create them at once so the orchestrator is locked only once for the request
+			std::vector<Json::Value> response_list(app_count);
+			std::vector<http::StatusCode> status_code_list(app_count, http::StatusCode::OK);
+			std::vector<cfg::vhost::app::Application> app_config_list;
+			std::vector<Json::ArrayIndex> app_index_list;
 
-			for (auto &requested_app : requested_app_list)
+			for (Json::ArrayIndex index = 0; index < app_count; index++)
 			{
-				FillDefaultAppConfigValues(requested_app);
-
-				cfg::vhost::app::Application app_config;
-				::serdes::ApplicationFromJson(requested_app, &app_config);
+				auto &requested_app = requested_app_list[index];
 
 				try
 				{
+					FillDefaultAppConfigValues(requested_app);
+
+					cfg::vhost::app::Application app_config;
+					::serdes::ApplicationFromJson(requested_app, &app_config);
+
 					app_config.FromJson(requested_app);
 
+					app_config_list.push_back(std::move(app_config));
+					app_index_list.push_back(index);
+				}
+				catch (const cfg::ConfigError &error)
+				{
+					status_code_list[index] = http::StatusCode::BadRequest;
+					response_list[index] = ::serdes::JsonFromError(http::HttpError(http::StatusCode::BadRequest, error.What()));
+				}
+				catch (const http::HttpError &error)
+				{
+					status_code_list[index] = error.GetStatusCode();
+					response_list[index] = ::serdes::JsonFromError(error);
+				}
+			}
+
+			auto result_list = ocst::Orchestrator::GetInstance()->CreateApplications(*vhost, app_config_list);
+
+			for (size_t index = 0; index < result_list.size(); index++)
+			{
+				auto &app_config = app_config_list[index];
+				auto app_index = app_index_list[index];
+				auto &response = response_list[app_index];
+
+				try
+				{
 					ThrowIfOrchestratorNotSucceeded(
-						ocst::Orchestrator::GetInstance()->CreateApplication(*vhost, app_config),
+						result_list[index],
 						"create",
 						"application",
 						ov::String::FormatString("%s/%s", vhost->GetName().CStr(), app_config.GetName().CStr()));
 
 					auto app = GetApplication(vhost, app_config.GetName().CStr());
-					auto app_json = ::serdes::JsonFromApplication(app);
 
-					Json::Value response;
 					response["statusCode"] = static_cast<int>(http::StatusCode::OK);
 					response["message"] = StringFromStatusCode(http::StatusCode::OK);
-					response["response"] = app_json;
-
-					status_codes.AddStatusCode(http::StatusCode::OK);
-					response_value.append(std::move(response));
-				}
-				catch (const cfg::ConfigError &error)
-				{
-					auto http_error = http::HttpError(http::StatusCode::BadRequest, error.What());
-
-					status_codes.AddStatusCode(http_error.GetStatusCode());
-					response_value.append(::serdes::JsonFromError(http_error));
+					response["response"] = ::serdes::JsonFromApplication(app);
 				}
 				catch (const http::HttpError &error)
 				{
-					status_codes.AddStatusCode(error.GetStatusCode());
-					response_value.append(::serdes::JsonFromError(error));
+					status_code_list[app_index] = error.GetStatusCode();
+					response = ::serdes::JsonFromError(error);
 				}
 			}
 
+			Json::Value response_value(Json::ValueType::arrayValue);
+			MultipleStatus status_codes;
+
+			for (Json::ArrayIndex index = 0; index < app_count; index++)
+			{
+				status_codes.AddStatusCode(status_code_list[index]);
+				response_value.append(std::move(response_list[index]));
+			}
+
 			return {status_codes, std::move(response_value)};
 		}
 
 		ApiResponse AppsController::OnGetAppList(const std::shared_ptr<http::svr::HttpExchange> &client,
 												 const std::shared_ptr<mon::HostMetrics> &vhost)
 		{
-			Json::Value response(Json::ValueType::arrayValue);
+			return GetCachedResponse(client, vhost->GetApplicationsGeneration(), [&vhost]() -> ApiResponse {
+				Json::Value response(Json::ValueType::arrayValue);
 
-			auto app_list = GetApplicationList(vhost);
+				auto app_list = GetApplicationList(vhost);
 
-			for (auto &item : app_list)
-			{
-				auto &app = item.second;
+				for (auto &item : app_list)
+				{
+					auto &app = item.second;
 
-				response.append(app->GetName().GetAppName().CStr());
-			}
+					response.append(app->GetName().GetAppName().CStr());
+				}
 
-			return response;
+				return response;
+			});
 		}
 
 		ApiResponse AppsController::OnGetApp(const std::shared_ptr<http::svr::HttpExchange> &client,
@@ -9,6 +9,7 @@
 #include "stream_actions_controller.h"
 #include "../../../../../api_private.h"
 
+#include <base/ovlibrary/directory.h>
 #include <base/provider/application.h>
 #include <modules/id3v2/id3v2.h>
 #include <modules/id3v2/frames/id3v2_frames.h>
@@ -24,6 +25,8 @@ namespace api
 			RegisterPost(R"((hlsDumps))", &StreamActionsController::OnPostHLSDumps);
 			RegisterPost(R"((startHlsDump))", &StreamActionsController::OnPostStartHLSDump);
 			RegisterPost(R"((stopHlsDump))", &StreamActionsController::OnPostStopHLSDump);
+			RegisterPost(R"((exportClip))", &StreamActionsController::OnPostExportClip);
+			RegisterPost(R"((dumpIngestCapture))", &StreamActionsController::OnPostDumpIngestCapture);
 			RegisterPost(R"((sendEvent))", &StreamActionsController::OnPostSendEvent);
 		}
 
@@ -216,6 +219,144 @@ namespace api
 			return {http::StatusCode::OK};
 		}
 
+		// POST /v1/vhosts/<vhost_name>/apps/<app_name>/streams/<stream_name>:exportClip
+		// {
+		// 	"outputStreamName": "stream",
+		// 	"duration": 30,
+		// 	"outputPath": "/tmp/clips/clip.mp4"
+		// }
+		ApiResponse StreamActionsController::OnPostExportClip(const std::shared_ptr<http::svr::HttpExchange> &client, const Json::Value &request_body,
+										const std::shared_ptr<mon::HostMetrics> &vhost,
+										const std::shared_ptr<mon::ApplicationMetrics> &app,
+										const std::shared_ptr<mon::StreamMetrics> &stream,
+										const std::vector<std::shared_ptr<mon::StreamMetrics>> &output_streams)
+		{
+			if (request_body.isObject() == false ||
+				request_body["outputStreamName"].isString() == false ||
+				request_body["outputPath"].isString() == false ||
+				request_body["duration"].isNumeric() == false)
+			{
+				throw http::HttpError(http::StatusCode::BadRequest,
+									  "outputStreamName, outputPath and duration are required");
+			}
+
+			ov::String output_stream_name = request_body["outputStreamName"].asCString();
+			ov::String output_path = request_body["outputPath"].asCString();
+			auto duration = request_body["duration"].asDouble();
+
+			if (output_path.IsEmpty() || duration <= 0.0)
+			{
+				throw http::HttpError(http::StatusCode::BadRequest,
+									  "outputPath must not be empty and duration must be greater than 0");
+			}
+
+			auto output_stream_it = std::find_if(output_streams.begin(), output_streams.end(), [&](const auto &output_stream) {
+				return output_stream->GetName() == output_stream_name;
+			});
+
+			if (output_stream_it == output_streams.end())
+			{
+				throw http::HttpError(http::StatusCode::NotFound,
+									  "Could not find output stream: [%s/%s/%s]",
+									  vhost->GetName().CStr(), app->GetName().GetAppName().CStr(), output_stream_name.CStr());
+			}
+
+			auto llhls_stream = GetLLHlsStream(*output_stream_it);
+			if (llhls_stream == nullptr)
+			{
+				throw http::HttpError(http::StatusCode::NotFound,
+									  "Could not find LLHLS stream: [%s/%s/%s]",
+									  vhost->GetName().CStr(), app->GetName().GetAppName().CStr(), output_stream_name.CStr());
+			}
+
+			LLHlsStream::ClipInfo clip_info;
+			auto [result, reason] = llhls_stream->ExportClip(output_path, duration * 1000.0, clip_info);
+			if (result == false)
+			{
+				throw http::HttpError(http::StatusCode::InternalServerError,
+									  "Could not export clip: [%s/%s/%s] (%s)",
+									  vhost->GetName().CStr(), app->GetName().GetAppName().CStr(), output_stream_name.CStr(), reason.CStr());
+			}
+
+			Json::Value response;
+			response["outputPath"] = clip_info.file_path.CStr();
+			response["size"] = static_cast<Json::UInt64>(clip_info.size);
+			response["duration"] = clip_info.duration_ms / 1000.0;
+			response["firstSegmentNumber"] = static_cast<Json::Int64>(clip_info.first_segment_number);
+			response["lastSegmentNumber"] = static_cast<Json::Int64>(clip_info.last_segment_number);
+
+			return response;
+		}
+
+		// POST /v1/vhosts/<vhost_name>/apps/<app_name>/streams/<stream_name>:dumpIngestCapture
+		// {
+		// 	"outputPath": "/tmp/captures/stream.flv"
+		// }
+		ApiResponse StreamActionsController::OnPostDumpIngestCapture(const std::shared_ptr<http::svr::HttpExchange> &client, const Json::Value &request_body,
+												const std::shared_ptr<mon::HostMetrics> &vhost,
+												const std::shared_ptr<mon::ApplicationMetrics> &app,
+												const std::shared_ptr<mon::StreamMetrics> &stream,
+												const std::vector<std::shared_ptr<mon::StreamMetrics>> &output_streams)
+		{
+			if (request_body.isObject() == false ||
+				request_body["outputPath"].isString() == false)
+			{
+				throw http::HttpError(http::StatusCode::BadRequest, "outputPath is required");
+			}
+
+			ov::String output_path = request_body["outputPath"].asCString();
+			if (output_path.IsEmpty())
+			{
+				throw http::HttpError(http::StatusCode::BadRequest, "outputPath must not be empty");
+			}
+
+			auto source_stream = GetSourceStream(stream);
+			if (source_stream == nullptr)
+			{
+				throw http::HttpError(http::StatusCode::NotFound,
+									  "Could not find stream: [%s/%s/%s]",
+									  vhost->GetName().CStr(), app->GetName().GetAppName().CStr(), stream->GetName().CStr());
+			}
+
+			auto ingest_capture = source_stream->GetIngestCapture();
+			if (ingest_capture == nullptr)
+			{
+				throw http::HttpError(http::StatusCode::NotImplemented,
+									  "Ingest capture is disabled or not supported by the provider: [%s/%s/%s]",
+									  vhost->GetName().CStr(), app->GetName().GetAppName().CStr(), stream->GetName().CStr());
+			}
+
+			mdl::IngestCapture::Stats stats;
+			auto capture = ingest_capture->Dump(&stats);
+			if (capture == nullptr)
+			{
+				throw http::HttpError(http::StatusCode::NotFound,
+									  "Nothing has been captured yet: [%s/%s/%s]",
+									  vhost->GetName().CStr(), app->GetName().GetAppName().CStr(), stream->GetName().CStr());
+			}
+
+			if ((ov::CreateDirectories(ov::PathManager::ExtractPath(output_path)) == false) ||
+				(ov::DumpToFile(output_path, capture) == nullptr))
+			{
+				throw http::HttpError(http::StatusCode::InternalServerError,
+									  "Could not write the capture to %s: [%s/%s/%s]",
+									  output_path.CStr(), vhost->GetName().CStr(), app->GetName().GetAppName().CStr(), stream->GetName().CStr());
+			}
+
+			logti("Ingest capture dumped: stream = %s/%s/%s, file = %s, records = %zu, duration = %" PRId64 " ms, size = %zu",
+				  vhost->GetName().CStr(), app->GetName().GetAppName().CStr(), stream->GetName().CStr(),
+				  output_path.CStr(), stats.record_count, stats.duration_ms, capture->GetLength());
+
+			Json::Value response;
+			response["outputPath"] = output_path.CStr();
+			response["format"] = mdl::IngestCapture::StringFromFormat(ingest_capture->GetFormat());
+			response["size"] = static_cast<Json::UInt64>(capture->GetLength());
+			response["duration"] = stats.duration_ms / 1000.0;
+			response["recordCount"] = static_cast<Json::UInt64>(stats.record_count);
+
+			return response;
+		}
+
 		// POST /v1/vhosts/<vhost_name>/apps/<app_name>/streams/<stream_name>:injectHLSEvent
 		ApiResponse StreamActionsController::OnPostSendEvent(const std::shared_ptr<http::svr::HttpExchange> &client, const Json::Value &request_body,
 										const std::shared_ptr<mon::HostMetrics> &vhost,
@@ -40,6 +40,20 @@ namespace api
 										  const std::shared_ptr<mon::StreamMetrics> &stream,
 										  const std::vector<std::shared_ptr<mon::StreamMetrics>> &output_streams);
 
+			// POST /v1/vhosts/<vhost_name>/apps/<app_name>/streams/<stream_name>:exportClip
+			ApiResponse OnPostExportClip(const std::shared_ptr<http::svr::HttpExchange> &client, const Json::Value &request_body,
+										 const std::shared_ptr<mon::HostMetrics> &vhost,
+										 const std::shared_ptr<mon::ApplicationMetrics> &app,
+										 const std::shared_ptr<mon::StreamMetrics> &stream,
+										 const std::vector<std::shared_ptr<mon::StreamMetrics>> &output_streams);
+
+			// POST /v1/vhosts/<vhost_name>/apps/<app_name>/streams/<stream_name>:dumpIngestCapture
+			ApiResponse OnPostDumpIngestCapture(const std::shared_ptr<http::svr::HttpExchange> &client, const Json::Value &request_body,
+												const std::shared_ptr<mon::HostMetrics> &vhost,
+												const std::shared_ptr<mon::ApplicationMetrics> &app,
+												const std::shared_ptr<mon::StreamMetrics> &stream,
+												const std::vector<std::shared_ptr<mon::StreamMetrics>> &output_streams);
+
 			// POST /v1/vhosts/<vhost_name>/apps/<app_name>/streams/<stream_name>:sendEvent
 			ApiResponse OnPostSendEvent(const std::shared_ptr<http::svr::HttpExchange> &client, const Json::Value &request_body,
 										   const std::shared_ptr<mon::HostMetrics> &vhost,
@@ -137,21 +137,23 @@ namespace api
 													   const std::shared_ptr<mon::HostMetrics> &vhost,
 													   const std::shared_ptr<mon::ApplicationMetrics> &app)
 		{
-			Json::Value response = Json::arrayValue;
+			return GetCachedResponse(client, app->GetStreamsGeneration(), [&app]() -> ApiResponse {
+				Json::Value response = Json::arrayValue;
 
-			auto stream_list = app->GetStreamMetricsMap();
+				auto stream_list = app->GetStreamMetricsMap();
 
-			for (auto &item : stream_list)
-			{
-				auto &stream = item.second;
-
-				if (stream->GetLinkedInputStream() == nullptr)
+				for (auto &item : stream_list)
 				{
-					response.append(stream->GetName().CStr());
+					auto &stream = item.second;
+
+					if (stream->GetLinkedInputStream() == nullptr)
+					{
+						response.append(stream->GetName().CStr());
+					}
 				}
-			}
 
-			return response;
+				return response;
+			});
 		}
 
 		ApiResponse StreamsController::OnGetStream(const std::shared_ptr<http::svr::HttpExchange> &client,
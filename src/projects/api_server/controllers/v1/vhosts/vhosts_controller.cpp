@@ -86,15 +86,19 @@ namespace api
 
 		ApiResponse VHostsController::OnGetVHostList(const std::shared_ptr<http::svr::HttpExchange> &client)
 		{
-			auto vhost_list = GetVirtualHostList();
-			Json::Value response(Json::ValueType::arrayValue);
+			auto generation = MonitorInstance->GetServerMetrics()->GetHostsGeneration();
 
-			for (const auto &item : vhost_list)
-			{
-				response.append(item.second->GetName().CStr());
-			}
+			return GetCachedResponse(client, generation, []() -> ApiResponse {
+				auto vhost_list = GetVirtualHostList();
+				Json::Value response(Json::ValueType::arrayValue);
+
+				for (const auto &item : vhost_list)
+				{
+					response.append(item.second->GetName().CStr());
+				}
 
-			return response;
+				return response;
+			});
 		}
 
 		ApiResponse VHostsController::OnGetVHost(const std::shared_ptr<http::svr::HttpExchange> &client,
@@ -93,6 +93,7 @@ enum class PublisherType : int8_t
 	Ovt,
 	File,
 	Thumbnail,
+	Srt,
 	NumberOfPublishers,
 };
 
@@ -252,6 +253,19 @@ struct CodecSpecificInfoVp8
 	int8_t key_idx = -1;   // Negative value to skip keyIdx.
 };
 
+struct CodecSpecificInfoVp9
+{
+	int16_t picture_id = -1;  // Negative value to skip pictureId.
+	int tl0_pic_idx = -1;	  // Negative value to skip tl0PicIdx.
+	bool inter_pic_predicted = false;
+	uint8_t simulcast_idx = 0;
+	uint8_t temporal_idx = 0;
+	bool temporal_up_switch = false;
+	uint8_t num_temporal_layers = 1;
+	uint16_t width = 0;
+	uint16_t height = 0;
+};
+
 struct CodecSpecificInfoOpus
 {
 	int sample_rate_hz = 0;
@@ -266,8 +280,7 @@ union CodecSpecificInfoUnion
 	CodecSpecificInfoGeneric generic;
 	CodecSpecificInfoVp8 vp8;
 	CodecSpecificInfoH26X h26X;
-	// In the future
-	// RTPVideoHeaderVP9 vp9;
+	CodecSpecificInfoVp9 vp9;
 	CodecSpecificInfoOpus opus;
 };
 
@@ -374,6 +387,8 @@ static ov::String StringFromPublisherType(const PublisherType &type)
 			return "File";
 		case PublisherType::Thumbnail:
 			return "Thumbnail";			
+		case PublisherType::Srt:
+			return "SRT";
 	}
 
 	return "Unknown";
@@ -391,6 +406,8 @@ static ov::String StringFromMediaCodecId(const cmn::MediaCodecId &type)
 			return "VP8";
 		case cmn::MediaCodecId::Vp9:
 			return "VP9";
+		case cmn::MediaCodecId::Av1:
+			return "AV1";
 		case cmn::MediaCodecId::Flv:
 			return "FLV";
 		case cmn::MediaCodecId::Aac:
@@ -153,6 +153,18 @@ namespace info
 		return false;
 	}
 
+	std::vector<ov::String> Certificate::GetHostNameList() const
+	{
+		std::vector<ov::String> host_name_list;
+
+		for (const auto &host_name_entry : _host_name_entry_list)
+		{
+			host_name_list.push_back(host_name_entry.host_name);
+		}
+
+		return host_name_list;
+	}
+
 	ov::String Certificate::GetName() const
 	{
 		return _certificate_name;
@@ -31,6 +31,8 @@ namespace info
 		ov::String GetName() const;
 
 		bool IsCertificateForHost(const ov::String &host_name) const;
+		// The host names (wildcard can be used) passed to CreateCertificate()
+		std::vector<ov::String> GetHostNameList() const;
 
 		ov::String ToString() const;
 
@@ -370,6 +370,7 @@ bool MediaTrack::IsValid()
 		}
 		break;
 		case MediaCodecId::Vp9:
+		case MediaCodecId::Av1:
 		case MediaCodecId::Flv: {
 			if (_width > 0 &&
 				_height > 0 &&
@@ -565,6 +566,24 @@ int32_t MediaTrack::GetBitrateByConfig() const
 	return _bitrate_conf;
 }
 
+int32_t MediaTrack::GetTemporalLayerBitrate(uint8_t temporal_layer_id) const
+{
+	auto bitrate = GetBitrate();
+
+	if ((temporal_layer_id + 1) >= GetTemporalLayers())
+	{
+		return bitrate;
+	}
+
+	if (GetTemporalLayers() == 2)
+	{
+		return static_cast<int64_t>(bitrate) * 6 / 10;
+	}
+
+	// 50%, 75%
+	return static_cast<int64_t>(bitrate) * (temporal_layer_id + 2) / 4;
+}
+
 void MediaTrack::SetBypassByConfig(bool flag)
 {
 	_bypass_conf = flag;
@@ -614,8 +633,11 @@ std::shared_ptr<MediaTrack> MediaTrack::Clone()
 	track->_key_frame_interval_conf = _key_frame_interval_conf;
 	track->_b_frames = _b_frames;
 	track->_has_bframe = _has_bframe;
+	track->_low_latency = _low_latency;
+	track->_temporal_layers = _temporal_layers;
 	track->_preset = _preset;
 	track->_use_hwaccel = _use_hwaccel;
+	track->_hwaccel_device_id = _hwaccel_device_id;
 	track->_colorspace = _colorspace;
 
 	// Audio Track
@@ -79,6 +79,10 @@ public:
 	// Bitrate (Set by user)
 	void SetBitrateByConfig(int32_t bitrate);
 	int32_t GetBitrateByConfig() const;
+
+	// Bitrate of the temporal layers from 0 to temporal_layer_id
+	// The layers are encoded with the fixed ratios of the bitrate (2 layers: 60/100%, 3 layers: 50/75/100%)
+	int32_t GetTemporalLayerBitrate(uint8_t temporal_layer_id) const;
 	
 	// Frame Time 
 	void SetStartFrameTime(int64_t time);
@@ -100,7 +104,8 @@ public:
 		AVCSpsPpsWithStartCode,
 		HEVCVps,
 		HEVCSps,
-		HEVCPps
+		HEVCPps,
+		AV1CodecConfigurationRecord
 	};
 
 	bool HasCodecComponentData(const CodecComponentDataType &type) const;
@@ -35,6 +35,10 @@ namespace info
 		_record_total_bytes = 0;
 		_record_total_time = 0;
 
+		_dropped_packets = 0;
+		_average_write_latency = 0;
+		_max_write_latency = 0;
+
 		_sequence = 0;
 		_interval = 0;
 		_schedule = "";
@@ -320,6 +324,24 @@ namespace info
 	{
 		_record_time = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now() - _record_start_time).count();
 	}
+	void Record::SetWriterStatistics(uint64_t dropped_packets, int64_t average_write_latency_us, int64_t max_write_latency_us)
+	{
+		_dropped_packets = dropped_packets;
+		_average_write_latency = average_write_latency_us;
+		_max_write_latency = max_write_latency_us;
+	}
+	uint64_t Record::GetDroppedPackets()
+	{
+		return _dropped_packets;
+	}
+	int64_t Record::GetAverageWriteLatency()
+	{
+		return _average_write_latency;
+	}
+	int64_t Record::GetMaxWriteLatency()
+	{
+		return _max_write_latency;
+	}
 	void Record::IncreaseSequence()
 	{
 		_sequence++;
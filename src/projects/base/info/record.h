@@ -114,6 +114,12 @@ namespace info
 		void SetRecordTime(uint64_t time);
 		void SetRecordTotalTime(uint64_t time);
 
+		// Statistics of the writer of the current file (see AsyncFileWriter module)
+		void SetWriterStatistics(uint64_t dropped_packets, int64_t average_write_latency_us, int64_t max_write_latency_us);
+		uint64_t GetDroppedPackets();
+		int64_t GetAverageWriteLatency();
+		int64_t GetMaxWriteLatency();
+
 		void IncreaseSequence();
 
 		void UpdateRecordStartTime();
@@ -222,6 +228,12 @@ namespace info
 		uint64_t _record_time;
 		uint64_t _record_total_time;
 
+		// Packets dropped because the disk could not keep up
+		uint64_t _dropped_packets;
+		// Time taken to write a chunk to the disk (microseconds)
+		int64_t _average_write_latency;
+		int64_t _max_write_latency;
+
 		// Timestamp Rules for Split Recording
 		//  continuity - The start of the split-recorded file PTS leads to the last PTS of the previously recorded file.
 		//  discontiuity - The start PTS of the split-recorded file begins with zero.
@@ -20,10 +20,10 @@ namespace info
 	VHostAppName::VHostAppName(const ov::String &vhost_name, const ov::String &app_name)
 		: _is_valid(true),
 
+		  _vhost_app_name(ov::String::FormatString("#%s#%s", vhost_name.Replace("#", "_").CStr(), app_name.Replace("#", "_").CStr())),
 		  _vhost_name(vhost_name),
 		  _app_name(app_name)
 	{
-		_vhost_app_name.Format("#%s#%s", vhost_name.Replace("#", "_").CStr(), app_name.Replace("#", "_").CStr());
 	}
 
 	VHostAppName::VHostAppName(const ov::String &vhost_app_name)
@@ -93,17 +93,17 @@ namespace info
 
 	const ov::String &VHostAppName::GetVHostName() const
 	{
-		return _vhost_name;
+		return _vhost_name.ToString();
 	}
 
 	const ov::String &VHostAppName::GetAppName() const
 	{
-		return _app_name;
+		return _app_name.ToString();
 	}
 
 	const ov::String &VHostAppName::ToString() const
 	{
-		return _vhost_app_name;
+		return _vhost_app_name.ToString();
 	}
 
 	const char *VHostAppName::CStr() const
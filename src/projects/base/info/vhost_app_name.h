@@ -15,6 +15,8 @@ namespace info
 	/// VHostAppName is a name that consists of the same form as "#vhost#app_name"
 	/// This is a combination of the VHost name and app_name.
 	/// VHostAppName is immutable object
+	///
+	/// The names are interned, so copying/comparing/hashing a VHostAppName does not touch the bytes of the names
 	class VHostAppName
 	{
 		friend class Application;
@@ -37,9 +39,7 @@ namespace info
 		std::size_t Hash() const
 		{
 			return std::hash<bool>()(_is_valid) ^
-				   std::hash<ov::String>()(_vhost_app_name) ^
-				   std::hash<ov::String>()(_vhost_name) ^
-				   std::hash<ov::String>()(_app_name);
+				   std::hash<ov::InternedString>()(_vhost_app_name);
 		}
 
 	protected:
@@ -47,9 +47,9 @@ namespace info
 
 		bool _is_valid = false;
 
-		ov::String _vhost_app_name;
-		ov::String _vhost_name;
-		ov::String _app_name;
+		ov::InternedString _vhost_app_name;
+		ov::InternedString _vhost_name;
+		ov::InternedString _app_name;
 	};
 }  // namespace info
 
@@ -19,6 +19,11 @@ VideoTrack::VideoTrack()
 	  _key_frame_interval_conf(0),
 	  _b_frames(0),
 	  _has_bframe(false),
+	  _key_frame_aligned(false),
+	  _low_latency(false),
+	  _temporal_layers(1),
+	  _hwaccel_device_id(0),
+	  _key_frame_only_decoding(false),
 	  _preset(""),
 	  _thread_count(0)
 {
@@ -136,6 +141,36 @@ int32_t VideoTrack::GetBFrames()
 	return _b_frames;
 }
 
+void VideoTrack::SetKeyFrameAligned(bool key_frame_aligned)
+{
+	_key_frame_aligned = key_frame_aligned;
+}
+
+bool VideoTrack::IsKeyFrameAligned() const
+{
+	return _key_frame_aligned;
+}
+
+void VideoTrack::SetLowLatency(bool low_latency)
+{
+	_low_latency = low_latency;
+}
+
+bool VideoTrack::IsLowLatency() const
+{
+	return _low_latency;
+}
+
+void VideoTrack::SetTemporalLayers(int32_t temporal_layers)
+{
+	_temporal_layers = temporal_layers;
+}
+
+int32_t VideoTrack::GetTemporalLayers() const
+{
+	return _temporal_layers;
+}
+
 void VideoTrack::SetColorspace(int colorspace)
 {
 	_colorspace = colorspace;
@@ -217,3 +252,23 @@ bool VideoTrack::GetHardwareAccel() const
 {
 	return _use_hwaccel;
 }
+
+void VideoTrack::SetHardwareAccelDeviceId(int32_t device_id)
+{
+	_hwaccel_device_id = device_id;
+}
+
+int32_t VideoTrack::GetHardwareAccelDeviceId() const
+{
+	return _hwaccel_device_id;
+}
+
+void VideoTrack::SetKeyFrameOnlyDecoding(bool key_frame_only)
+{
+	_key_frame_only_decoding = key_frame_only;
+}
+
+bool VideoTrack::IsKeyFrameOnlyDecoding() const
+{
+	return _key_frame_only_decoding;
+}
@@ -75,9 +75,29 @@ public:
 	void SetBFrames(int32_t b_frames);
 	int32_t GetBFrames();
 
+	// Force the keyframes on the timestamps that are multiples of the keyframe interval, so the renditions of a stream have the keyframes at the same timestamps (set by user)
+	void SetKeyFrameAligned(bool key_frame_aligned);
+	bool IsKeyFrameAligned() const;
+
+	// Encode without lookahead/B-frames, and refresh with intra blocks instead of IDR frames (set by user)
+	void SetLowLatency(bool low_latency);
+	bool IsLowLatency() const;
+
+	// Number of temporal layers of the scalable encoding (set by user)
+	void SetTemporalLayers(int32_t temporal_layers);
+	int32_t GetTemporalLayers() const;
+
 	void SetHardwareAccel(bool hwaccel);
 	bool GetHardwareAccel() const;
 
+	// Index of the GPU that the codecs of this track use (set by transcoder)
+	void SetHardwareAccelDeviceId(int32_t device_id);
+	int32_t GetHardwareAccelDeviceId() const;
+
+	// Decode with the cheaper settings, as only the key frames are decoded for the thumbnails (set by transcoder)
+	void SetKeyFrameOnlyDecoding(bool key_frame_only);
+	bool IsKeyFrameOnlyDecoding() const;
+
 protected:
 
 	// framerate (measurement)
@@ -108,12 +128,25 @@ protected:
 	// B-frame (set by mediarouter)
 	bool _has_bframe;
 
+	// Keyframe alignment (set by user)
+	bool _key_frame_aligned;
+
+	// Low latency encoding (set by user)
+	bool _low_latency;
+
+	// Number of temporal layers (set by user)
+	int32_t _temporal_layers;
+
 	// Colorspace of video
 	// This variable is temporarily used in the Pixel Format defined by FFMPEG.
 	int _colorspace;	
 
 	// Enable hardware acceleration
 	bool _use_hwaccel;
+	int32_t _hwaccel_device_id;
+
+	// Key frame only decoding (set by transcoder)
+	bool _key_frame_only_decoding;
 
 	// Preset for encoder (set by user)
 	ov::String _preset;
@@ -12,10 +12,17 @@
 #include <base/common_types.h>
 
 #include <cstdint>
+#include <functional>
 #include <map>
+#include <mutex>
+#include <vector>
 
+#include "media_packet_trace.h"
 #include "media_type.h"
 
+// modules/rtp_rtcp/rtp_packet.h
+class RtpPacket;
+
 
 enum class MediaPacketFlag : uint8_t
 {
@@ -118,6 +125,33 @@ public:
 	void SetData(std::shared_ptr<ov::Data> &data)
 	{
 		_data = data;
+
+		_converted_data_cache.Clear();
+	}
+
+	// Returns the payload converted to <format> by <converter>.
+	// A packet is shared by all publishers, so the conversion is done only once per packet and the result
+	// is kept until the payload is replaced by SetData().
+	std::shared_ptr<const ov::Data> GetConvertedData(cmn::BitstreamFormat format, const std::function<std::shared_ptr<ov::Data>(const std::shared_ptr<const ov::Data> &data)> &converter) const
+	{
+		std::lock_guard<std::mutex> lock_guard(_converted_data_cache.mutex);
+
+		for (const auto &item : _converted_data_cache.data_list)
+		{
+			if (item.first == format)
+			{
+				return item.second;
+			}
+		}
+
+		std::shared_ptr<const ov::Data> converted_data = converter(_data);
+
+		if (converted_data != nullptr)
+		{
+			_converted_data_cache.data_list.emplace_back(format, converted_data);
+		}
+
+		return converted_data;
 	}
 
 	const std::shared_ptr<const ov::Data> GetData() const noexcept
@@ -130,7 +164,7 @@ public:
 		return _data;
 	}
 
-	size_t GetDataLength() noexcept
+	size_t GetDataLength() const noexcept
 	{
 		return _data->GetLength();
 	}
@@ -214,6 +248,50 @@ public:
 		_packet_type = type;
 	}
 
+	// The temporal layer of the frame (set by the encoder of temporal scalability), 0 is the base layer
+	uint8_t GetTemporalLayerId() const noexcept
+	{
+		return _temporal_layer_id;
+	}
+
+	void SetTemporalLayerId(uint8_t temporal_layer_id)
+	{
+		_temporal_layer_id = temporal_layer_id;
+	}
+
+	// The time when the packet is received from the source (microseconds since epoch, 0 if the provider doesn't set it)
+	uint64_t GetIngestTime() const noexcept
+	{
+		return _ingest_time;
+	}
+
+	void SetIngestTime(uint64_t ingest_time)
+	{
+		_ingest_time = ingest_time;
+	}
+
+	// The trace of the stages if the packet is sampled (nullptr otherwise)
+	const std::shared_ptr<MediaPacketTrace> &GetTrace() const noexcept
+	{
+		return _trace;
+	}
+
+	void SetTrace(const std::shared_ptr<MediaPacketTrace> &trace)
+	{
+		_trace = trace;
+	}
+
+	// RTP packets that the frame was assembled from (set by the WebRTC provider), to be relayed to the WebRTC players
+	const std::vector<std::shared_ptr<const RtpPacket>> &GetOriginRtpPackets() const noexcept
+	{
+		return _origin_rtp_packets;
+	}
+
+	void SetOriginRtpPackets(std::vector<std::shared_ptr<const RtpPacket>> rtp_packets)
+	{
+		_origin_rtp_packets = std::move(rtp_packets);
+	}
+
 	void SetFragHeader(const FragmentationHeader *header)
 	{
 		_frag_hdr = *header;
@@ -229,13 +307,14 @@ public:
 		return &_frag_hdr;
 	}
 
-	std::shared_ptr<MediaPacket> ClonePacket() const
+	// If <copy_data> is false, the payload is shared with this packet, so it must not be modified in place
+	std::shared_ptr<MediaPacket> ClonePacket(bool copy_data = true) const
 	{
 		auto packet = std::make_shared<MediaPacket>(
 			GetMsid(),
 			GetMediaType(),
 			GetTrackId(),
-			GetData()->Clone(),
+			copy_data ? GetData()->Clone() : _data,
 			GetPts(),
 			GetDts(),
 			GetDuration(),
@@ -244,6 +323,10 @@ public:
 			GetPacketType());
 
 		packet->_frag_hdr = _frag_hdr;
+		packet->_temporal_layer_id = _temporal_layer_id;
+		packet->_ingest_time = _ingest_time;
+		packet->_trace = _trace;
+		packet->_origin_rtp_packets = _origin_rtp_packets;
 
 		return packet;
 	}
@@ -278,5 +361,34 @@ protected:
 	cmn::BitstreamFormat _bitstream_format = cmn::BitstreamFormat::Unknown;
 	cmn::PacketType _packet_type = cmn::PacketType::Unknown;
 	FragmentationHeader _frag_hdr;
+	uint8_t _temporal_layer_id = 0;
+	uint64_t _ingest_time = 0;
+	std::shared_ptr<MediaPacketTrace> _trace;
+	std::vector<std::shared_ptr<const RtpPacket>> _origin_rtp_packets;
+
+	// The cache is not copied with the packet, since the payload of the copy may be replaced
+	struct ConvertedDataCache
+	{
+		ConvertedDataCache() = default;
+		ConvertedDataCache(const ConvertedDataCache &) {}
+
+		ConvertedDataCache &operator=(const ConvertedDataCache &)
+		{
+			Clear();
+			return *this;
+		}
+
+		void Clear()
+		{
+			std::lock_guard<std::mutex> lock_guard(mutex);
+			data_list.clear();
+		}
+
+		std::mutex mutex;
+		// A packet is converted to one or two formats at most, so a list is enough
+		std::vector<std::pair<cmn::BitstreamFormat, std::shared_ptr<const ov::Data>>> data_list;
+	};
+
+	mutable ConvertedDataCache _converted_data_cache;
 };
 
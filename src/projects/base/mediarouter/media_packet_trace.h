@@ -0,0 +1,121 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+
+// 1 of N packets received from the provider is traced
+#define MEDIA_PACKET_TRACE_SAMPLING_INTERVAL	100
+
+// The stages that a packet passes through, in order
+enum class PacketTraceStage : uint8_t
+{
+	ProviderReceived = 0,
+	MediaRouterInboundIn,
+	MediaRouterInboundOut,
+	TranscoderDecoded,
+	TranscoderFiltered,
+	TranscoderEncoded,
+	MediaRouterOutboundIn,
+	MediaRouterOutboundOut,
+	PublisherDequeued,
+	PublisherSent,
+
+	NumberOfStages
+};
+
+constexpr const char *StringFromPacketTraceStage(PacketTraceStage stage)
+{
+	switch (stage)
+	{
+		case PacketTraceStage::ProviderReceived:
+			return "providerReceived";
+		case PacketTraceStage::MediaRouterInboundIn:
+			return "mediaRouterInboundIn";
+		case PacketTraceStage::MediaRouterInboundOut:
+			return "mediaRouterInboundOut";
+		case PacketTraceStage::TranscoderDecoded:
+			return "transcoderDecoded";
+		case PacketTraceStage::TranscoderFiltered:
+			return "transcoderFiltered";
+		case PacketTraceStage::TranscoderEncoded:
+			return "transcoderEncoded";
+		case PacketTraceStage::MediaRouterOutboundIn:
+			return "mediaRouterOutboundIn";
+		case PacketTraceStage::MediaRouterOutboundOut:
+			return "mediaRouterOutboundOut";
+		case PacketTraceStage::PublisherDequeued:
+			return "publisherDequeued";
+		case PacketTraceStage::PublisherSent:
+			return "publisherSent";
+		case PacketTraceStage::NumberOfStages:
+			break;
+	}
+
+	return "unknown";
+}
+
+// The monotonic timestamps of the stages of a sampled packet.
+//
+// A trace is shared by the clones of a packet (e.g. a packet that is sent to the transcoder and the publishers
+// at the same time), and the first mark of a stage wins. Where a packet branches into the renditions
+// (the encoders, the publishers), the trace is cloned so that the branches don't overwrite each other.
+class MediaPacketTrace
+{
+public:
+	// Returns a new trace (ProviderReceived is marked) for 1 of MEDIA_PACKET_TRACE_SAMPLING_INTERVAL calls, otherwise nullptr
+	static std::shared_ptr<MediaPacketTrace> Sample()
+	{
+		static std::atomic<uint32_t> counter{0};
+
+		if ((counter.fetch_add(1, std::memory_order_relaxed) % MEDIA_PACKET_TRACE_SAMPLING_INTERVAL) != 0)
+		{
+			return nullptr;
+		}
+
+		auto trace = std::make_shared<MediaPacketTrace>();
+		trace->Mark(PacketTraceStage::ProviderReceived);
+
+		return trace;
+	}
+
+	// Microseconds of the steady clock
+	static int64_t Now()
+	{
+		return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+	}
+
+	void Mark(PacketTraceStage stage, int64_t time = Now())
+	{
+		int64_t expected = 0;
+		_times[static_cast<size_t>(stage)].compare_exchange_strong(expected, time, std::memory_order_relaxed);
+	}
+
+	// Returns 0 if the stage is not marked
+	int64_t GetTime(PacketTraceStage stage) const
+	{
+		return _times[static_cast<size_t>(stage)].load(std::memory_order_relaxed);
+	}
+
+	std::shared_ptr<MediaPacketTrace> Clone() const
+	{
+		auto trace = std::make_shared<MediaPacketTrace>();
+
+		for (size_t index = 0; index < static_cast<size_t>(PacketTraceStage::NumberOfStages); index++)
+		{
+			trace->_times[index].store(_times[index].load(std::memory_order_relaxed), std::memory_order_relaxed);
+		}
+
+		return trace;
+	}
+
+private:
+	std::atomic<int64_t> _times[static_cast<size_t>(PacketTraceStage::NumberOfStages)]{};
+};
@@ -43,6 +43,10 @@ namespace cmn
 
 		// For Data Track
 		ID3v2,
+
+		AV1,/*Low Overhead Bitstream Format*/	// OME's default internal bitstream format for AV1 (a temporal unit per packet)
+		VP9,/*raw*/			// OME's default internal bitstream format for VP9 (a frame or superframe per packet)
+		H265_RTP_RFC_7798,
 	};
 
 	enum class PacketType : int8_t
@@ -88,6 +92,8 @@ namespace cmn
 		Opus,
 		Jpeg,
 		Png,
+		// Added at the end to keep the values of the codecs above (OVT sends the value)
+		Av1,
 	};
 
 	enum class MediaCodecLibraryId : uint8_t
@@ -100,12 +106,13 @@ namespace cmn
 		LIBVPX,
 		FDKAAC,
 		LIBOPUS,
+		LIBSVTAV1,
 		NB
 	};
 
 	static bool IsVideoCodec(cmn::MediaCodecId codec_id)
 	{
-		if (codec_id == cmn::MediaCodecId::H264 || codec_id == cmn::MediaCodecId::H265 || codec_id == cmn::MediaCodecId::Vp8 || codec_id == cmn::MediaCodecId::Flv || codec_id == cmn::MediaCodecId::Vp9)
+		if (codec_id == cmn::MediaCodecId::H264 || codec_id == cmn::MediaCodecId::H265 || codec_id == cmn::MediaCodecId::Vp8 || codec_id == cmn::MediaCodecId::Flv || codec_id == cmn::MediaCodecId::Vp9 || codec_id == cmn::MediaCodecId::Av1)
 		{
 			return true;
 		}
@@ -207,6 +214,12 @@ namespace cmn
 				return "PNG";
 			case cmn::BitstreamFormat::ID3v2:
 				return "ID3v2";
+			case cmn::BitstreamFormat::AV1:
+				return "AV1";
+			case cmn::BitstreamFormat::VP9:
+				return "VP9";
+			case cmn::BitstreamFormat::H265_RTP_RFC_7798:
+				return "H265_RTP_RFC_7798";
 			default:
 				return "Unknown";
 		}
@@ -262,6 +275,8 @@ namespace cmn
 				return "fdkaac";
 			case cmn::MediaCodecLibraryId::LIBOPUS:
 				return "libopus";				
+			case cmn::MediaCodecLibraryId::LIBSVTAV1:
+				return "libsvtav1";
 			case cmn::MediaCodecLibraryId::AUTO:
 			default:
 				break;
@@ -282,6 +297,8 @@ namespace cmn
 				return "VP8";
 			case cmn::MediaCodecId::Vp9:
 				return "VP9";
+			case cmn::MediaCodecId::Av1:
+				return "AV1";
 			case cmn::MediaCodecId::Aac:
 				return "AAC";
 			case cmn::MediaCodecId::Opus:
@@ -318,6 +335,10 @@ namespace cmn
 		{
 			return cmn::MediaCodecId::Vp9;
 		}
+		else if (name == "AV1")
+		{
+			return cmn::MediaCodecId::Av1;
+		}
 		else if (name == "FLV")
 		{
 			return cmn::MediaCodecId::Flv;
@@ -81,6 +81,13 @@ public:
 		return ConnectorType::Provider;
 	}
 
+	// Called when a publisher requests a keyframe of the track of <stream> that this connector has created.
+	// Returns false if the connector cannot make a keyframe on demand (e.g. providers)
+	virtual bool OnKeyFrameRequested(const std::shared_ptr<info::Stream> &stream, MediaTrackId track_id)
+	{
+		return false;
+	}
+
 public:
 	// @see: media_router_application.cpp / MediaRouteApplication::RegisterConnectorApp
 	inline void SetMediaRouterApplication(const std::shared_ptr<MediaRouteApplicationInterface> &route_application)
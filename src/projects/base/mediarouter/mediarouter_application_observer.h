@@ -5,11 +5,83 @@
 #include <stdint.h>
 
 #include <memory>
+#include <set>
 #include <vector>
 
 #include "mediarouter_application_interface.h"
 #include "mediarouter_interface.h"
 
+// Packets that an observer receives through OnSendFrame()
+// The MediaRouter drops the other packets before they are delivered, so they never reach the queue of the observer.
+class MediaRouteSubscription
+{
+public:
+	// Subscribes all packets
+	MediaRouteSubscription() = default;
+
+	MediaRouteSubscription &SetMediaTypes(std::initializer_list<cmn::MediaType> media_types)
+	{
+		_media_type_mask = 0;
+
+		for (auto media_type : media_types)
+		{
+			_media_type_mask |= GetMediaTypeBit(media_type);
+		}
+
+		return *this;
+	}
+
+	// Only the key frames of the video tracks are delivered (the other media types are not affected)
+	MediaRouteSubscription &SetKeyFrameOnly(bool key_frame_only)
+	{
+		_key_frame_only = key_frame_only;
+		return *this;
+	}
+
+	// Only the packets of <track_ids> are delivered (all tracks if empty)
+	MediaRouteSubscription &SetTrackIds(const std::set<uint32_t> &track_ids)
+	{
+		_track_ids = track_ids;
+		return *this;
+	}
+
+	bool IsSubscribed(const MediaPacket &packet) const
+	{
+		auto media_type = packet.GetMediaType();
+
+		if ((_media_type_mask & GetMediaTypeBit(media_type)) == 0)
+		{
+			return false;
+		}
+
+		if (_key_frame_only && (media_type == cmn::MediaType::Video) && (packet.GetFlag() != MediaPacketFlag::Key))
+		{
+			return false;
+		}
+
+		if ((_track_ids.empty() == false) && (_track_ids.find(packet.GetTrackId()) == _track_ids.end()))
+		{
+			return false;
+		}
+
+		return true;
+	}
+
+private:
+	static constexpr uint32_t ALL_MEDIA_TYPES = 0xFFFFFFFF;
+
+	static uint32_t GetMediaTypeBit(cmn::MediaType media_type)
+	{
+		// Unknown is not in the range of the mask, so it is delivered only to the observers that subscribe all
+		auto index = static_cast<int>(media_type);
+		return ((index >= 0) && (index < static_cast<int>(cmn::MediaType::Nb))) ? (1U << index) : (1U << 31);
+	}
+
+	uint32_t _media_type_mask = ALL_MEDIA_TYPES;
+	bool _key_frame_only = false;
+	std::set<uint32_t> _track_ids;
+};
+
 class MediaRouteApplicationObserver : public ov::EnableSharedFromThis<MediaRouteApplicationObserver>
 {
 public:
@@ -38,4 +110,20 @@ public:
 	{
 		return ObserverType::Publisher;
 	}
+
+	const MediaRouteSubscription &GetSubscription() const
+	{
+		return _subscription;
+	}
+
+protected:
+	// Must be called before the observer is registered to the MediaRouter (e.g. in the constructor),
+	// since the MediaRouter workers read it without a lock
+	void SetSubscription(const MediaRouteSubscription &subscription)
+	{
+		_subscription = subscription;
+	}
+
+private:
+	MediaRouteSubscription _subscription;
 };
@@ -6,6 +6,8 @@
 
 #include <base/ovlibrary/ovlibrary.h>
 #include <base/info/application.h>
+#include <base/info/stream.h>
+#include <base/mediarouter/media_buffer.h>
 #include <modules/physical_port/physical_port.h>
 
 class MediaRouteApplicationObserver;
@@ -37,5 +39,17 @@ public:
 	virtual bool UnregisterObserverApp(
 		const info::Application &application_info,
 		const std::shared_ptr<MediaRouteApplicationObserver> &application_observer) = 0;
+
+	// Returns the packets of the last GOP of the output stream (empty if the GOP cache is disabled or not filled yet)
+	virtual std::vector<std::shared_ptr<MediaPacket>> GetGopCache(
+		const info::Application &application_info,
+		info::stream_id_t stream_id) = 0;
+
+	// Requests a keyframe of the track of the output stream from the transcoder that encodes it
+	// (rate limited and coalesced by the encoder). Returns false if the track is not encoded.
+	virtual bool RequestKeyFrame(
+		const info::Application &application_info,
+		info::stream_id_t stream_id,
+		MediaTrackId track_id) = 0;
 };
 
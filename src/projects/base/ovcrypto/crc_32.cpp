@@ -8,55 +8,218 @@
 //==============================================================================
 #include "crc_32.h"
 
+#include <string.h>
+
+#if OV_CPU_DISPATCH_X86
+#	include <emmintrin.h>
+#	include <wmmintrin.h>
+#elif OV_CPU_DISPATCH_ARM64
+#	include <arm_acle.h>
+#endif
+
 namespace ov
 {
-	static unsigned long crc_table[256];
-	static int crc_table_computed = false;
+	// The functions below take/return the CRC register (the complement of the CRC)
+	using UpdateCrcFunction = uint32_t (*)(uint32_t crc, const uint8_t *buf, size_t len);
 
-	static void MakeCrcTable()
+	// 8 tables for slicing-by-8 (table[0] is the table of RFC1952)
+	struct CrcTable
 	{
-		unsigned long c;
+		uint32_t table[8][256];
 
-		int n, k;
-		for(n = 0; n < 256; n++)
+		CrcTable()
 		{
-			c = (unsigned long)n;
-			for(k = 0; k < 8; k++)
+			for (uint32_t n = 0; n < 256; n++)
 			{
-				if(c & 1)
+				uint32_t c = n;
+
+				for (int k = 0; k < 8; k++)
 				{
-					c = 0xEDB88320L ^ (c >> 1L);
+					c = (c & 1) ? (0xEDB88320 ^ (c >> 1)) : (c >> 1);
 				}
-				else
+
+				table[0][n] = c;
+			}
+
+			for (uint32_t n = 0; n < 256; n++)
+			{
+				for (int slice = 1; slice < 8; slice++)
 				{
-					c = c >> 1;
+					table[slice][n] = table[0][table[slice - 1][n] & 0xFF] ^ (table[slice - 1][n] >> 8);
 				}
 			}
-			crc_table[n] = c;
 		}
+	};
+
+	// Created before any thread calls the CRC functions
+	static const CrcTable crc_table;
+
+	static uint32_t UpdateCrcBaseline(uint32_t crc, const uint8_t *buf, size_t len)
+	{
+		const auto &table = crc_table.table;
+
+		// 8 bytes at a time (slicing-by-8)
+		while (len >= 8)
+		{
+			uint32_t low;
+			uint32_t high;
+			::memcpy(&low, buf, 4);
+			::memcpy(&high, buf + 4, 4);
+
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+			low = __builtin_bswap32(low);
+			high = __builtin_bswap32(high);
+#endif
+			low ^= crc;
+
+			crc = table[7][low & 0xFF] ^ table[6][(low >> 8) & 0xFF] ^ table[5][(low >> 16) & 0xFF] ^ table[4][low >> 24] ^
+				  table[3][high & 0xFF] ^ table[2][(high >> 8) & 0xFF] ^ table[1][(high >> 16) & 0xFF] ^ table[0][high >> 24];
 
-		crc_table_computed = true;
+			buf += 8;
+			len -= 8;
+		}
+
+		while (len-- > 0)
+		{
+			crc = table[0][(crc ^ *buf++) & 0xFF] ^ (crc >> 8);
+		}
+
+		return crc;
 	}
 
-	static unsigned long UpdateCrc(unsigned long initial, const unsigned char *buf, ssize_t len)
+#if OV_CPU_DISPATCH_X86
+	// Folds 64 bytes at a time with carry-less multiplication, and reduces the result with Barrett reduction
+	// ("Fast CRC Computation for Generic Polynomials Using PCLMULQDQ Instruction", Intel, 2009).
+	// The bytes that are not a multiple of 16 are processed by the table.
+	OV_TARGET_PCLMUL static uint32_t UpdateCrcPclmul(uint32_t crc, const uint8_t *buf, size_t len)
 	{
-		unsigned long c = initial ^0xFFFFFFFFL;
-		ssize_t n;
+		if (len < 64)
+		{
+			return UpdateCrcBaseline(crc, buf, len);
+		}
 
-		if(crc_table_computed == false)
+		// x^(4*128+32) mod P, x^(4*128-32) mod P (bit-reflected)
+		const __m128i k1k2 = _mm_set_epi64x(0x01c6e41596, 0x0154442bd4);
+		// x^(128+32) mod P, x^(128-32) mod P
+		const __m128i k3k4 = _mm_set_epi64x(0x00ccaa009e, 0x01751997d0);
+		// x^64 mod P
+		const __m128i k5 = _mm_set_epi64x(0, 0x0163cd6124);
+		// P and mu = floor(x^64 / P)
+		const __m128i poly = _mm_set_epi64x(0x01f7011641, 0x01db710641);
+		const __m128i mask32 = _mm_setr_epi32(~0, 0, ~0, 0);
+
+		auto x1 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(buf + 0x00));
+		auto x2 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(buf + 0x10));
+		auto x3 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(buf + 0x20));
+		auto x4 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(buf + 0x30));
+
+		x1 = _mm_xor_si128(x1, _mm_cvtsi32_si128(static_cast<int>(crc)));
+
+		buf += 64;
+		len -= 64;
+
+		while (len >= 64)
 		{
-			MakeCrcTable();
+			auto x5 = _mm_clmulepi64_si128(x1, k1k2, 0x00);
+			auto x6 = _mm_clmulepi64_si128(x2, k1k2, 0x00);
+			auto x7 = _mm_clmulepi64_si128(x3, k1k2, 0x00);
+			auto x8 = _mm_clmulepi64_si128(x4, k1k2, 0x00);
+
+			x1 = _mm_clmulepi64_si128(x1, k1k2, 0x11);
+			x2 = _mm_clmulepi64_si128(x2, k1k2, 0x11);
+			x3 = _mm_clmulepi64_si128(x3, k1k2, 0x11);
+			x4 = _mm_clmulepi64_si128(x4, k1k2, 0x11);
+
+			x1 = _mm_xor_si128(_mm_xor_si128(x1, x5), _mm_loadu_si128(reinterpret_cast<const __m128i *>(buf + 0x00)));
+			x2 = _mm_xor_si128(_mm_xor_si128(x2, x6), _mm_loadu_si128(reinterpret_cast<const __m128i *>(buf + 0x10)));
+			x3 = _mm_xor_si128(_mm_xor_si128(x3, x7), _mm_loadu_si128(reinterpret_cast<const __m128i *>(buf + 0x20)));
+			x4 = _mm_xor_si128(_mm_xor_si128(x4, x8), _mm_loadu_si128(reinterpret_cast<const __m128i *>(buf + 0x30)));
+
+			buf += 64;
+			len -= 64;
+		}
+
+		// Fold 512 bits into 128 bits
+		for (auto next : {x2, x3, x4})
+		{
+			auto x5 = _mm_clmulepi64_si128(x1, k3k4, 0x00);
+			x1 = _mm_clmulepi64_si128(x1, k3k4, 0x11);
+			x1 = _mm_xor_si128(_mm_xor_si128(x1, next), x5);
+		}
+
+		// Fold the remaining blocks of 16 bytes
+		while (len >= 16)
+		{
+			auto x5 = _mm_clmulepi64_si128(x1, k3k4, 0x00);
+			x1 = _mm_clmulepi64_si128(x1, k3k4, 0x11);
+			x1 = _mm_xor_si128(_mm_xor_si128(x1, _mm_loadu_si128(reinterpret_cast<const __m128i *>(buf))), x5);
+
+			buf += 16;
+			len -= 16;
+		}
+
+		// Fold 128 bits into 64 bits
+		x2 = _mm_clmulepi64_si128(x1, k3k4, 0x10);
+		x1 = _mm_xor_si128(_mm_srli_si128(x1, 8), x2);
+
+		x2 = _mm_srli_si128(x1, 4);
+		x1 = _mm_and_si128(x1, mask32);
+		x1 = _mm_clmulepi64_si128(x1, k5, 0x00);
+		x1 = _mm_xor_si128(x1, x2);
+
+		// Barrett reduction into 32 bits
+		x2 = _mm_and_si128(x1, mask32);
+		x2 = _mm_clmulepi64_si128(x2, poly, 0x10);
+		x2 = _mm_and_si128(x2, mask32);
+		x2 = _mm_clmulepi64_si128(x2, poly, 0x00);
+		x1 = _mm_xor_si128(x1, x2);
+
+		crc = static_cast<uint32_t>(_mm_cvtsi128_si32(_mm_srli_si128(x1, 4)));
+
+		return UpdateCrcBaseline(crc, buf, len);
+	}
+#endif
+
+#if OV_CPU_DISPATCH_ARM64
+	OV_TARGET_ARM_CRC32 static uint32_t UpdateCrcArm(uint32_t crc, const uint8_t *buf, size_t len)
+	{
+		while (len >= 8)
+		{
+			uint64_t value;
+			::memcpy(&value, buf, 8);
+
+			crc = __crc32d(crc, value);
+
+			buf += 8;
+			len -= 8;
 		}
-		for(n = 0; n < len; n++)
+
+		while (len-- > 0)
 		{
-			c = crc_table[(c ^ buf[n]) & 0xFF] ^ (c >> 8);
+			crc = __crc32b(crc, *buf++);
 		}
-		return c ^ 0xFFFFFFFFL;
+
+		return crc;
 	}
+#endif
+
+	static const UpdateCrcFunction UpdateCrc = CpuFeatures::Select<UpdateCrcFunction>("crc32", {
+#if OV_CPU_DISPATCH_X86
+		{CpuFeature::Pclmul, "pclmul", UpdateCrcPclmul},
+#elif OV_CPU_DISPATCH_ARM64
+		{CpuFeature::ArmCrc32, "armv8", UpdateCrcArm},
+#endif
+		{CpuFeature::None, "slice8", UpdateCrcBaseline},
+	});
 
 	uint32_t Crc32::Update(uint32_t initial, const void *buffer, ssize_t length)
 	{
-		return static_cast<uint32_t>(UpdateCrc(initial, static_cast<const uint8_t *>(buffer), length));
+		if (length <= 0)
+		{
+			return initial;
+		}
+
+		return ~UpdateCrc(~initial, static_cast<const uint8_t *>(buffer), static_cast<size_t>(length));
 	}
 
 	uint32_t Crc32::Update(uint32_t initial, const ov::Data *data)
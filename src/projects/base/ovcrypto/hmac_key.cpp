@@ -0,0 +1,171 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "hmac_key.h"
+
+#include <openssl/evp.h>
+
+#include "ovcrypto_private.h"
+
+namespace ov
+{
+	static const EVP_MD *GetMessageDigest(CryptoAlgorithm algorithm)
+	{
+		switch (algorithm)
+		{
+			case CryptoAlgorithm::Md5:
+				return EVP_md5();
+
+			case CryptoAlgorithm::Sha1:
+				return EVP_sha1();
+
+			case CryptoAlgorithm::Sha224:
+				return EVP_sha224();
+
+			case CryptoAlgorithm::Sha256:
+				return EVP_sha256();
+
+			case CryptoAlgorithm::Sha384:
+				return EVP_sha384();
+
+			case CryptoAlgorithm::Sha512:
+				return EVP_sha512();
+
+			default:
+				return nullptr;
+		}
+	}
+
+	// The context that Compute() works on, so no context is created per call
+	static EVP_MD_CTX *GetThreadContext()
+	{
+		static thread_local std::unique_ptr<EVP_MD_CTX, decltype(&EVP_MD_CTX_free)> context(EVP_MD_CTX_new(), EVP_MD_CTX_free);
+
+		return context.get();
+	}
+
+	std::shared_ptr<HmacKey> HmacKey::Create(CryptoAlgorithm algorithm, const void *key, size_t key_length)
+	{
+		auto hmac_key = std::make_shared<HmacKey>();
+
+		if (hmac_key->Prepare(algorithm, key, key_length) == false)
+		{
+			return nullptr;
+		}
+
+		return hmac_key;
+	}
+
+	std::shared_ptr<HmacKey> HmacKey::Create(CryptoAlgorithm algorithm, const std::shared_ptr<const ov::Data> &key)
+	{
+		return Create(algorithm, key->GetData(), key->GetLength());
+	}
+
+	HmacKey::~HmacKey()
+	{
+		EVP_MD_CTX_free(static_cast<EVP_MD_CTX *>(_inner_context));
+		EVP_MD_CTX_free(static_cast<EVP_MD_CTX *>(_outer_context));
+	}
+
+	bool HmacKey::Prepare(CryptoAlgorithm algorithm, const void *key, size_t key_length)
+	{
+		auto md = GetMessageDigest(algorithm);
+
+		if (md == nullptr)
+		{
+			logtw("Could not create HmacKey for algorithm: %d", algorithm);
+			return false;
+		}
+
+		// RFC 2104 HMAC: H(K XOR opad, H(K XOR ipad, text))
+		auto block_length = static_cast<size_t>(EVP_MD_block_size(md));
+		uint8_t key_block[EVP_MAX_MD_SIZE * 2] = {0};
+
+		OV_ASSERT2(block_length <= sizeof(key_block));
+
+		if (key_length > block_length)
+		{
+			// A key longer than the block is hashed first
+			if (EVP_Digest(key, key_length, key_block, nullptr, md, nullptr) == 0)
+			{
+				return false;
+			}
+		}
+		else
+		{
+			::memcpy(key_block, key, key_length);
+		}
+
+		uint8_t input_pad[sizeof(key_block)];
+		uint8_t output_pad[sizeof(key_block)];
+
+		for (size_t index = 0; index < block_length; index++)
+		{
+			input_pad[index] = 0x36 ^ key_block[index];
+			output_pad[index] = 0x5C ^ key_block[index];
+		}
+
+		auto inner_context = EVP_MD_CTX_new();
+		auto outer_context = EVP_MD_CTX_new();
+
+		_inner_context = inner_context;
+		_outer_context = outer_context;
+
+		if ((inner_context == nullptr) || (outer_context == nullptr))
+		{
+			logtw("Could not allocate context");
+			return false;
+		}
+
+		bool result = true;
+
+		result = result && (EVP_DigestInit_ex(inner_context, md, nullptr) == 1);
+		result = result && (EVP_DigestUpdate(inner_context, input_pad, block_length) == 1);
+		result = result && (EVP_DigestInit_ex(outer_context, md, nullptr) == 1);
+		result = result && (EVP_DigestUpdate(outer_context, output_pad, block_length) == 1);
+
+		_algorithm = algorithm;
+
+		return result;
+	}
+
+	unsigned int HmacKey::Size() const noexcept
+	{
+		return MessageDigest::Size(_algorithm);
+	}
+
+	bool HmacKey::Compute(std::initializer_list<Input> inputs, void *output, size_t output_length) const
+	{
+		auto context = GetThreadContext();
+
+		if ((context == nullptr) || (_inner_context == nullptr) || (output_length < Size()))
+		{
+			return false;
+		}
+
+		uint8_t inner[EVP_MAX_MD_SIZE];
+		unsigned int inner_length = 0;
+		bool result = true;
+
+		// inner hash
+		result = result && (EVP_MD_CTX_copy_ex(context, static_cast<const EVP_MD_CTX *>(_inner_context)) == 1);
+
+		for (const auto &input : inputs)
+		{
+			result = result && (EVP_DigestUpdate(context, input.data, input.length) == 1);
+		}
+
+		result = result && (EVP_DigestFinal_ex(context, inner, &inner_length) == 1);
+
+		// outer hash
+		result = result && (EVP_MD_CTX_copy_ex(context, static_cast<const EVP_MD_CTX *>(_outer_context)) == 1);
+		result = result && (EVP_DigestUpdate(context, inner, inner_length) == 1);
+		result = result && (EVP_DigestFinal_ex(context, static_cast<unsigned char *>(output), nullptr) == 1);
+
+		return result;
+	}
+}  // namespace ov
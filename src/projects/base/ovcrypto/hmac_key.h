@@ -0,0 +1,55 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/ovlibrary/ovlibrary.h>
+
+#include <initializer_list>
+
+#include "message_digest.h"
+
+namespace ov
+{
+	// HMAC with a fixed key.
+	//
+	// MessageDigest::ComputeHmac() creates the digest contexts and hashes the padded key blocks on every call.
+	// HmacKey keeps the digest states after the inner/outer padded key blocks, and each Compute() continues from a copy of them.
+	class HmacKey
+	{
+	public:
+		struct Input
+		{
+			const void *data;
+			size_t length;
+		};
+
+		static std::shared_ptr<HmacKey> Create(CryptoAlgorithm algorithm, const void *key, size_t key_length);
+		static std::shared_ptr<HmacKey> Create(CryptoAlgorithm algorithm, const std::shared_ptr<const ov::Data> &key);
+
+		HmacKey() = default;
+		~HmacKey();
+
+		HmacKey(const HmacKey &) = delete;
+		HmacKey &operator=(const HmacKey &) = delete;
+
+		unsigned int Size() const noexcept;
+
+		// Computes the HMAC of the concatenation of <inputs>.
+		// The precomputed states are not modified, so it can be called from multiple threads.
+		bool Compute(std::initializer_list<Input> inputs, void *output, size_t output_length) const;
+
+	private:
+		bool Prepare(CryptoAlgorithm algorithm, const void *key, size_t key_length);
+
+		CryptoAlgorithm _algorithm = CryptoAlgorithm::Unknown;
+
+		// EVP_MD_CTX * after the inner/outer padded key blocks (declared as void * to hide openssl)
+		void *_inner_context = nullptr;
+		void *_outer_context = nullptr;
+	};
+}  // namespace ov
@@ -13,6 +13,7 @@
 #include <openssl/md5.h>
 #include <openssl/ossl_typ.h>
 #include <openssl/evp.h>
+#include <openssl/core_names.h>
 
 #include <base/ovlibrary/ovlibrary.h>
 
@@ -200,86 +201,139 @@ namespace ov
 		return data;
 	}
 
-	bool MessageDigest::ComputeHmac(CryptoAlgorithm algorithm, const void *key, size_t key_length, const void *input, size_t input_length, void *output, size_t output_length)
+	static const char *GetDigestName(CryptoAlgorithm algorithm)
 	{
-		MessageDigest digest;
-
-		if(digest.Create(algorithm) == false)
+		switch(algorithm)
 		{
-			return false;
-		}
+			case CryptoAlgorithm::Md5:
+				return "MD5";
+
+			case CryptoAlgorithm::Sha1:
+				return "SHA1";
+
+			case CryptoAlgorithm::Sha224:
+				return "SHA224";
+
+			case CryptoAlgorithm::Sha256:
+				return "SHA256";
+
+			case CryptoAlgorithm::Sha384:
+				return "SHA384";
 
-		// 현재 코드에서는 SHA-256 이하만 처리 가능
-		constexpr unsigned int block_length = 64;
-		const unsigned int digest_size = digest.Size();
+			case CryptoAlgorithm::Sha512:
+				return "SHA512";
 
-		// padding을 위해, 키를 임시 버퍼에 복사함
-		uint8_t new_key[block_length] = { 0 };
+			default:
+				return nullptr;
+		}
+	}
 
-		if(key_length > block_length)
+	// HMAC contexts of a thread, one for each algorithm.
+	// The HMACs are computed for every STUN message, so the contexts (and the digest set to them) are reused
+	// instead of being allocated for every call, and only the key is set for each HMAC.
+	class HmacContexts
+	{
+	public:
+		~HmacContexts()
 		{
-			// key 길이가 block 길이보다 크면 hash 한 뒤 그 결과를 key로 사용함
-			if(digest.Update(key, key_length) && digest.Finish(new_key, OV_COUNTOF(new_key)))
+			for(auto context : _contexts)
 			{
-				// key hash 성공
+				if(context != nullptr)
+				{
+					EVP_MAC_CTX_free(context);
+				}
+			}
+		}
 
-				// 아래에서 재사용 할 수 있게 초기화 함
-				digest.Reset();
+		EVP_MAC_CTX *Get(CryptoAlgorithm algorithm)
+		{
+			auto index = static_cast<size_t>(algorithm);
+
+			if(index >= OV_COUNTOF(_contexts))
+			{
+				return nullptr;
 			}
-			else
+
+			if(_contexts[index] == nullptr)
 			{
-				// key hash 도중 오류 발생
-				digest.Destroy();
-				return false;
+				_contexts[index] = Create(algorithm);
 			}
+
+			return _contexts[index];
 		}
-		else
+
+	private:
+		static EVP_MAC_CTX *Create(CryptoAlgorithm algorithm)
 		{
-			// key 길이가 block 길이보다 작으면 그냥 복사
-			::memcpy(new_key, key, key_length);
+			auto digest_name = GetDigestName(algorithm);
+
+			if(digest_name == nullptr)
+			{
+				return nullptr;
+			}
+
+			// Fetched once for the process
+			static EVP_MAC *mac = EVP_MAC_fetch(nullptr, OSSL_MAC_NAME_HMAC, nullptr);
+
+			if(mac == nullptr)
+			{
+				logte("Could not fetch HMAC");
+				return nullptr;
+			}
+
+			auto context = EVP_MAC_CTX_new(mac);
+
+			if(context == nullptr)
+			{
+				logtw("Could not allocate HMAC context");
+				return nullptr;
+			}
+
+			OSSL_PARAM params[] = {
+				OSSL_PARAM_construct_utf8_string(OSSL_MAC_PARAM_DIGEST, const_cast<char *>(digest_name), 0),
+				OSSL_PARAM_construct_end()};
+
+			if(EVP_MAC_CTX_set_params(context, params) != 1)
+			{
+				logtw("Could not set the digest of HMAC: %s", digest_name);
+				EVP_MAC_CTX_free(context);
+				return nullptr;
+			}
+
+			return context;
 		}
 
-		// salt를 위해 위에서 계산한 key로 부터 패딩 계산
+		EVP_MAC_CTX *_contexts[static_cast<size_t>(CryptoAlgorithm::Sha512) + 1] = {};
+	};
+
+	bool MessageDigest::ComputeHmac(CryptoAlgorithm algorithm, const void *key, size_t key_length, const void *input, size_t input_length, void *output, size_t output_length)
+	{
+		static thread_local HmacContexts hmac_contexts;
 
-		// input padding
-		uint8_t input_pad[block_length] = { 0 };
-		// output padding
-		uint8_t output_pad[block_length] = { 0 };
+		auto context = hmac_contexts.Get(algorithm);
 
-		for(unsigned int index = 0; index < block_length; index++)
+		if(context == nullptr)
 		{
-			input_pad[index] = 0x36 ^ new_key[index];
-			output_pad[index] = 0x5C ^ new_key[index];
+			return false;
 		}
 
-		// padding 데이터 및 입력 데이터를 hash
-#if defined(__clang__)
-		uint8_t inner[digest_size];
-		memset(&inner, 0, digest_size);
-#else
-		uint8_t inner[digest_size] = { 0 };
-#endif
-		bool result = true;
-
-		// inner hash
-		// digest input padding
-		result = result && digest.Update(input_pad, OV_COUNTOF(input_pad));
-		// digest input
-		result = result && digest.Update(input, input_length);
-		result = result && digest.Finish(inner, digest_size);
+		if(output_length < Size(algorithm))
+		{
+			OV_ASSERT(false, "Not enough buffer");
+			return false;
+		}
 
-		result = result && digest.Reset();
+		// If the key is nullptr, EVP_MAC_init() keeps the key of the previous HMAC
+		static const uint8_t empty_key = 0;
+		auto key_buffer = (key != nullptr) ? static_cast<const unsigned char *>(key) : &empty_key;
 
-		// outer hash
-		// digest output padding
-		result = result && digest.Update(output_pad, OV_COUNTOF(output_pad));
-		// digest inner hash
-		result = result && digest.Update(inner, digest_size);
-		result = result && digest.Finish(output, output_length);
+		size_t final_length = 0;
 
-		digest.Destroy();
+		bool result = (EVP_MAC_init(context, key_buffer, key_length, nullptr) == 1) &&
+					  (EVP_MAC_update(context, static_cast<const unsigned char *>(input), input_length) == 1) &&
+					  (EVP_MAC_final(context, static_cast<unsigned char *>(output), &final_length, output_length) == 1);
 
-		return result;
+		return result && (final_length == Size(algorithm));
 	}
 
 	std::shared_ptr<ov::Data> MessageDigest::ComputeHmac(CryptoAlgorithm algorithm, const std::shared_ptr<const ov::Data> &key, const std::shared_ptr<const ov::Data> &input)
@@ -382,6 +382,19 @@ namespace ov
 		return Write(data->GetData(), data->GetLength(), written_bytes);
 	}
 
+	bool Tls::EnableKtlsSend()
+	{
+#if defined(SSL_OP_ENABLE_KTLS) && !defined(OPENSSL_NO_KTLS)
+		OV_ASSERT2(_ssl != nullptr);
+
+		::SSL_set_options(_ssl, SSL_OP_ENABLE_KTLS);
+
+		return true;
+#else	// defined(SSL_OP_ENABLE_KTLS) && !defined(OPENSSL_NO_KTLS)
+		return false;
+#endif	// defined(SSL_OP_ENABLE_KTLS) && !defined(OPENSSL_NO_KTLS)
+	}
+
 	bool Tls::FlushInput()
 	{
 		unsigned char buf[1024];
@@ -629,6 +642,44 @@ namespace ov
 		return ov::String(reinterpret_cast<const char *>(data), len);
 	}
 
+	std::shared_ptr<SSL_SESSION> Tls::GetSession() const
+	{
+		if (_ssl == nullptr)
+		{
+			return nullptr;
+		}
+
+		auto session = ::SSL_get1_session(_ssl);
+
+		if (session == nullptr)
+		{
+			return nullptr;
+		}
+
+		if (::SSL_SESSION_is_resumable(session) == 0)
+		{
+			::SSL_SESSION_free(session);
+			return nullptr;
+		}
+
+		return std::shared_ptr<SSL_SESSION>(session, ::SSL_SESSION_free);
+	}
+
+	bool Tls::SetSession(const std::shared_ptr<SSL_SESSION> &session)
+	{
+		if ((_ssl == nullptr) || (session == nullptr))
+		{
+			return false;
+		}
+
+		return (::SSL_set_session(_ssl, session.get()) == 1);
+	}
+
+	bool Tls::IsSessionReused() const
+	{
+		return (_ssl != nullptr) && (::SSL_session_reused(_ssl) == 1);
+	}
+
 	long Tls::GetVersion() const
 	{
 		// Holds _peer_certificate to prevent referencing nullptr
@@ -40,6 +40,12 @@ namespace ov
 
 		bool FlushInput();
 
+		// Lets OpenSSL hand the keys of the sending direction to the BIO (BIO_CTRL_SET_KTLS) after the handshake,
+		// so the encryption can be offloaded to the kernel (kTLS)
+		//
+		// @return Returns false if OpenSSL is built without kTLS
+		bool EnableKtlsSend();
+
 		// @return The number of buffered and processed application data bytes that are pending and are available for immediate read
 		int Pending() const;
 
@@ -57,6 +63,13 @@ namespace ov
 		ov::String GetServerName() const;
 		ov::String GetSelectedAlpnName() const;
 
+		// Returns the session of the connection to resume later with SetSession() (nullptr if it is not resumable)
+		std::shared_ptr<SSL_SESSION> GetSession() const;
+		// Must be called before Connect()
+		bool SetSession(const std::shared_ptr<SSL_SESSION> &session);
+		// Whether the handshake resumed a session (with a session ID or a ticket)
+		bool IsSessionReused() const;
+
 		// Obtains a string in the BIO which allocated using BIO_new(BIO_s_mem())
 		static ov::String StringFromX509Name(const X509_NAME *name);
 
@@ -58,6 +58,16 @@ namespace ov
 		return error;
 	}
 
+	std::shared_ptr<SSL_SESSION> TlsClientData::GetSession() const
+	{
+		return (_state == State::Connected) ? _tls.GetSession() : nullptr;
+	}
+
+	bool TlsClientData::SetSession(const std::shared_ptr<SSL_SESSION> &session)
+	{
+		return (_state == State::WaitingForConnect) ? _tls.SetSession(session) : false;
+	}
+
 	bool TlsClientData::Decrypt(std::shared_ptr<const Data> *plain_data)
 	{
 		if (_state == State::Invalid)
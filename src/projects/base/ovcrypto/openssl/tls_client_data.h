@@ -45,6 +45,10 @@ namespace ov
 
 		std::shared_ptr<const OpensslError> Connect();
 
+		// The session to resume the next connection to the same server (for example, TLS session tickets)
+		std::shared_ptr<SSL_SESSION> GetSession() const;
+		bool SetSession(const std::shared_ptr<SSL_SESSION> &session);
+
 		/// Read via _io_callback->OnTlsReadData() and decrypt it, and returns it
 		///
 		/// @param plain_data decrypted data if there is no error
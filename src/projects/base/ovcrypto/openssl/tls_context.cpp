@@ -8,14 +8,82 @@
 //==============================================================================
 #include "tls_context.h"
 
+#include <openssl/core_names.h>
+
 #include "./openssl_private.h"
 #include "./tls.h"
 
 #define DO_CALLBACK_IF_AVAILABLE(return_type, default_value, tls_context, callback_name, ...) \
 	DoCallback<return_type, default_value, decltype(&TlsContextCallback::callback_name), &TlsContextCallback::callback_name>(tls_context, ##__VA_ARGS__)
 
+// A new session ticket key is created at this interval
+#define TLS_TICKET_KEY_ROTATION_INTERVAL (60 * 60 * 1000)
+// The number of keys kept to decrypt the tickets issued before the rotation (including the current key)
+#define TLS_TICKET_KEY_COUNT 3
+
 namespace ov
 {
+	namespace
+	{
+		struct TicketKey
+		{
+			uint8_t name[16];
+			uint8_t aes_key[32];
+			uint8_t hmac_key[32];
+			int64_t created_time;
+		};
+
+		std::mutex g_ticket_keys_mutex;
+		// The first key is used to encrypt new tickets
+		std::deque<TicketKey> g_ticket_keys;
+
+		// g_ticket_keys_mutex must be held
+		bool RotateTicketKeysIfNeeded()
+		{
+			auto now = ov::Clock::NowMSec();
+
+			if ((g_ticket_keys.empty() == false) && ((now - g_ticket_keys.front().created_time) < TLS_TICKET_KEY_ROTATION_INTERVAL))
+			{
+				return true;
+			}
+
+			TicketKey key;
+
+			if ((::RAND_bytes(key.name, sizeof(key.name)) != 1) ||
+				(::RAND_bytes(key.aes_key, sizeof(key.aes_key)) != 1) ||
+				(::RAND_bytes(key.hmac_key, sizeof(key.hmac_key)) != 1))
+			{
+				logte("Could not generate a session ticket key: %s", OpensslError().What());
+				return (g_ticket_keys.empty() == false);
+			}
+
+			key.created_time = now;
+
+			g_ticket_keys.push_front(key);
+
+			while (g_ticket_keys.size() > TLS_TICKET_KEY_COUNT)
+			{
+				g_ticket_keys.pop_back();
+			}
+
+			logtd("Session ticket key is rotated");
+
+			return true;
+		}
+
+		bool SetTicketHmacKey(EVP_MAC_CTX *mac_context, const TicketKey &key)
+		{
+			static char digest_name[] = "SHA256";
+
+			OSSL_PARAM params[] = {
+				::OSSL_PARAM_construct_octet_string(OSSL_MAC_PARAM_KEY, const_cast<uint8_t *>(key.hmac_key), sizeof(key.hmac_key)),
+				::OSSL_PARAM_construct_utf8_string(OSSL_MAC_PARAM_DIGEST, digest_name, 0),
+				::OSSL_PARAM_construct_end()};
+
+			return (::EVP_MAC_CTX_set_params(mac_context, params) == 1);
+		}
+	}  // namespace
+
 	TlsContext::~TlsContext()
 	{
 		OV_SAFE_FUNC(_ssl_ctx, nullptr, ::SSL_CTX_free, );
@@ -54,6 +122,13 @@ namespace ov
 			return nullptr;
 		}
 
+		if (method == TlsMethod::Tls)
+		{
+			// The tickets issued by a context can be used to resume with the other contexts (e.g. the certificates selected by SNI)
+			::SSL_CTX_clear_options(context->_ssl_ctx, SSL_OP_NO_TICKET);
+			::SSL_CTX_set_tlsext_ticket_key_evp_cb(context->_ssl_ctx, OnTicketKeyCallback);
+		}
+
 		return context;
 	}
 
@@ -226,6 +301,60 @@ namespace ov
 		} while (false);
 	}
 
+	// https://www.openssl.org/docs/man3.0/man3/SSL_CTX_set_tlsext_ticket_key_evp_cb.html
+	int TlsContext::OnTicketKeyCallback(SSL *ssl, unsigned char key_name[16], unsigned char *iv, EVP_CIPHER_CTX *cipher_context, EVP_MAC_CTX *mac_context, int encrypt)
+	{
+		std::lock_guard lock_guard(g_ticket_keys_mutex);
+
+		if (encrypt)
+		{
+			if (RotateTicketKeysIfNeeded() == false)
+			{
+				// The ticket is not issued
+				return -1;
+			}
+
+			const auto &key = g_ticket_keys.front();
+
+			if (::RAND_bytes(iv, EVP_CIPHER_iv_length(EVP_aes_256_cbc())) != 1)
+			{
+				return -1;
+			}
+
+			::memcpy(key_name, key.name, sizeof(key.name));
+
+			if ((::EVP_EncryptInit_ex(cipher_context, EVP_aes_256_cbc(), nullptr, key.aes_key, iv) != 1) ||
+				(SetTicketHmacKey(mac_context, key) == false))
+			{
+				return -1;
+			}
+
+			return 1;
+		}
+
+		for (size_t index = 0; index < g_ticket_keys.size(); index++)
+		{
+			const auto &key = g_ticket_keys[index];
+
+			if (::memcmp(key_name, key.name, sizeof(key.name)) != 0)
+			{
+				continue;
+			}
+
+			if ((SetTicketHmacKey(mac_context, key) == false) ||
+				(::EVP_DecryptInit_ex(cipher_context, EVP_aes_256_cbc(), nullptr, key.aes_key, iv) != 1))
+			{
+				return -1;
+			}
+
+			// A new ticket is issued if the ticket is encrypted with an old key
+			return (index == 0) ? 1 : 2;
+		}
+
+		// Unknown (or expired) key - falls back to a full handshake
+		return 0;
+	}
+
 	int TlsContext::OnALPNSelectCallback(SSL *ssl, const unsigned char **out, unsigned char *outlen, const unsigned char *in, unsigned int inlen, void *arg)
 	{
 		// arg to TlsContext instance
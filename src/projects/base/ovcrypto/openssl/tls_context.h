@@ -92,6 +92,9 @@ namespace ov
 		static int OnServerNameCallback(SSL *s, int *ad, void *arg);
 		int OnServerName(SSL *ssl);
 
+		// Session tickets are encrypted with the keys shared by all server contexts, which are rotated periodically
+		static int OnTicketKeyCallback(SSL *ssl, unsigned char key_name[16], unsigned char *iv, EVP_CIPHER_CTX *cipher_context, EVP_MAC_CTX *mac_context, int encrypt);
+
 		static int OnALPNSelectCallback(SSL *ssl, const unsigned char **out, unsigned char *outlen, const unsigned char *in, unsigned int inlen, void *arg);
 		static bool SelectALPNProtocol(ov::String key, const unsigned char **out, unsigned char *outlen, const unsigned char *in, unsigned int inlen);
 
@@ -10,8 +10,45 @@
 
 #include "./openssl_private.h"
 
+#if IS_LINUX && defined(BIO_CTRL_GET_KTLS_SEND) && !defined(OPENSSL_NO_KTLS)
+#	define OV_TLS_KTLS_SUPPORTED 1
+#	include <linux/tls.h>
+#	include <netinet/tcp.h>
+#	include <sys/socket.h>
+
+// Not exported by the public headers of OpenSSL 3 (include/internal/bio.h)
+#	ifndef BIO_CTRL_SET_KTLS
+#		define BIO_CTRL_SET_KTLS 72
+#	endif	// BIO_CTRL_SET_KTLS
+#	ifndef BIO_CTRL_SET_KTLS_TX_SEND_CTRL_MSG
+#		define BIO_CTRL_SET_KTLS_TX_SEND_CTRL_MSG 74
+#	endif	// BIO_CTRL_SET_KTLS_TX_SEND_CTRL_MSG
+#	ifndef BIO_CTRL_CLEAR_KTLS_TX_CTRL_MSG
+#		define BIO_CTRL_CLEAR_KTLS_TX_CTRL_MSG 75
+#	endif	// BIO_CTRL_CLEAR_KTLS_TX_CTRL_MSG
+#	ifndef SOL_TLS
+#		define SOL_TLS 282
+#	endif	// SOL_TLS
+#	ifndef TCP_ULP
+#		define TCP_ULP 31
+#	endif	// TCP_ULP
+#else	// IS_LINUX && defined(BIO_CTRL_GET_KTLS_SEND) && !defined(OPENSSL_NO_KTLS)
+#	define OV_TLS_KTLS_SUPPORTED 0
+#endif	// IS_LINUX && defined(BIO_CTRL_GET_KTLS_SEND) && !defined(OPENSSL_NO_KTLS)
+
 namespace ov
 {
+	namespace
+	{
+		std::atomic<uint64_t> ktls_requested_count{0};
+		std::atomic<uint64_t> ktls_offloaded_count{0};
+		std::atomic<uint64_t> ktls_fallback_count{0};
+		std::atomic<int64_t> ktls_current_offloaded_count{0};
+
+		std::atomic<uint64_t> handshake_count{0};
+		std::atomic<uint64_t> resumed_handshake_count{0};
+	}  // namespace
+
 	TlsServerData::TlsServerData(const std::shared_ptr<TlsContext> &tls_context, bool is_nonblocking)
 	{
 		TlsBioCallback callback = {
@@ -38,6 +75,58 @@ namespace ov
 	TlsServerData::~TlsServerData()
 	{
 		_tls.Uninitialize();
+
+		if (_is_ktls_send_enabled)
+		{
+			ktls_current_offloaded_count--;
+		}
+	}
+
+	bool TlsServerData::EnableKtls(int socket_fd, std::function<bool()> is_send_queue_empty)
+	{
+		if (_state != State::WaitingForAccept)
+		{
+			// The keys are passed to the BIO during the handshake
+			return false;
+		}
+
+#if OV_TLS_KTLS_SUPPORTED
+		if (_tls.EnableKtlsSend() == false)
+		{
+			return false;
+		}
+
+		_ktls_socket_fd = socket_fd;
+		_is_send_queue_empty = std::move(is_send_queue_empty);
+
+		ktls_requested_count++;
+
+		return true;
+#else	// OV_TLS_KTLS_SUPPORTED
+		return false;
+#endif	// OV_TLS_KTLS_SUPPORTED
+	}
+
+	TlsServerData::KtlsStats TlsServerData::GetKtlsStats()
+	{
+		KtlsStats stats;
+
+		stats.requested_count = ktls_requested_count;
+		stats.offloaded_count = ktls_offloaded_count;
+		stats.fallback_count = ktls_fallback_count;
+		stats.current_offloaded_count = std::max(ktls_current_offloaded_count.load(), static_cast<int64_t>(0));
+
+		return stats;
+	}
+
+	TlsServerData::HandshakeStats TlsServerData::GetHandshakeStats()
+	{
+		HandshakeStats stats;
+
+		stats.handshake_count = handshake_count;
+		stats.resumed_count = resumed_handshake_count;
+
+		return stats;
 	}
 
 	bool TlsServerData::Decrypt(const std::shared_ptr<const Data> &cipher_data, std::shared_ptr<const Data> *plain_data)
@@ -83,11 +172,23 @@ namespace ov
 
 					int result = _tls.Accept();
 
+					if (FlushHandshakeData() == false)
+					{
+						logtd("Could not send the handshake data");
+						return false;
+					}
+
 					switch (result)
 					{
 						case SSL_ERROR_NONE: {
 							logtd("Accepted");
 							_state = State::Accepted;
+
+							handshake_count++;
+							if (_tls.IsSessionReused())
+							{
+								resumed_handshake_count++;
+							}
 							break;
 						}
 
@@ -157,6 +258,13 @@ namespace ov
 
 		logtd("Trying to encrypt the data for TLS\n%s", plain_data->Dump(32).CStr());
 
+		if (_is_ktls_send_enabled)
+		{
+			// The kernel encrypts the data
+			*cipher_data = plain_data;
+			return true;
+		}
+
 		size_t written_bytes = 0;
 		auto result = _tls.Write(plain_data, &written_bytes);
 		if (result == SSL_ERROR_NONE)
@@ -229,15 +337,24 @@ namespace ov
 
 	ssize_t TlsServerData::OnTlsWrite(Tls *tls, const void *data, size_t length)
 	{
+		if (_is_ktls_send_enabled && (_ktls_record_type >= 0))
+		{
+			return SendKtlsControlMessage(data, length);
+		}
+
 		if (_state == State::WaitingForAccept)
 		{
-			if (_write_callback != nullptr)
+			// OpenSSL writes each handshake message of a flight separately, so they are collected to be sent at once
+			if (_handshake_data == nullptr)
 			{
-				return _write_callback(data, length);
+				_handshake_data = std::make_shared<Data>(data, length);
+			}
+			else
+			{
+				_handshake_data->Append(data, length);
 			}
 
-			OV_ASSERT2(false);
-			return -1LL;
+			return length;
 		}
 		else
 		{
@@ -267,10 +384,162 @@ namespace ov
 				return 0;
 
 			case BIO_CTRL_FLUSH:
+				return FlushHandshakeData() ? 1 : 0;
+
+#if OV_TLS_KTLS_SUPPORTED
+			case BIO_CTRL_SET_KTLS:
+				// num: 1 for the sending direction, 0 for the receiving direction
+				return SetKtls(num != 0, arg) ? 1 : 0;
+
+			case BIO_CTRL_GET_KTLS_SEND:
+				return _is_ktls_send_enabled ? 1 : 0;
+
+			case BIO_CTRL_SET_KTLS_TX_SEND_CTRL_MSG:
+				_ktls_record_type = static_cast<int>(num);
+				return 1;
+
+			case BIO_CTRL_CLEAR_KTLS_TX_CTRL_MSG:
+				_ktls_record_type = -1;
 				return 1;
 
+			case BIO_CTRL_GET_KTLS_RECV:
+				// The received data is decrypted by OpenSSL
+				return 0;
+#endif	// OV_TLS_KTLS_SUPPORTED
+
 			default:
 				return 0;
 		}
 	}
-}  // namespace ov
\ No newline at end of file
+
+	bool TlsServerData::FlushHandshakeData()
+	{
+		if (_handshake_data == nullptr)
+		{
+			return true;
+		}
+
+		auto data = std::move(_handshake_data);
+
+		if (_write_callback == nullptr)
+		{
+			OV_ASSERT2(false);
+			return false;
+		}
+
+		return (_write_callback(data->GetData(), data->GetLength()) == static_cast<ssize_t>(data->GetLength()));
+	}
+
+	bool TlsServerData::SetKtls(bool is_send, const void *crypto_info)
+	{
+#if OV_TLS_KTLS_SUPPORTED
+		if ((is_send == false) || (_ktls_socket_fd < 0) || (crypto_info == nullptr) || _is_ktls_send_enabled)
+		{
+			return false;
+		}
+
+		// The handshake records written before must be sent without the encryption of the kernel
+		if (FlushHandshakeData() == false)
+		{
+			ktls_fallback_count++;
+			return false;
+		}
+
+		// The data queued in the socket is encrypted by OpenSSL already
+		if ((_is_send_queue_empty != nullptr) && (_is_send_queue_empty() == false))
+		{
+			logtd("Could not offload TLS to the kernel: there is data that is not sent yet");
+			ktls_fallback_count++;
+			return false;
+		}
+
+		socklen_t length = 0;
+
+		switch (static_cast<const tls_crypto_info *>(crypto_info)->cipher_type)
+		{
+			case TLS_CIPHER_AES_GCM_128:
+				length = sizeof(tls12_crypto_info_aes_gcm_128);
+				break;
+
+			case TLS_CIPHER_AES_GCM_256:
+				length = sizeof(tls12_crypto_info_aes_gcm_256);
+				break;
+
+#	ifdef TLS_CIPHER_CHACHA20_POLY1305
+			case TLS_CIPHER_CHACHA20_POLY1305:
+				length = sizeof(tls12_crypto_info_chacha20_poly1305);
+				break;
+#	endif	// TLS_CIPHER_CHACHA20_POLY1305
+
+			default:
+				logtd("Could not offload TLS to the kernel: unsupported cipher (%d)", static_cast<const tls_crypto_info *>(crypto_info)->cipher_type);
+				ktls_fallback_count++;
+				return false;
+		}
+
+		if ((::setsockopt(_ktls_socket_fd, SOL_TCP, TCP_ULP, "tls", sizeof("tls")) != 0) && (errno != EEXIST))
+		{
+			logtd("Could not offload TLS to the kernel: TCP_ULP is not available (%s)", ::strerror(errno));
+			ktls_fallback_count++;
+			return false;
+		}
+
+		if (::setsockopt(_ktls_socket_fd, SOL_TLS, TLS_TX, crypto_info, length) != 0)
+		{
+			logtd("Could not offload TLS to the kernel: TLS_TX is not available (%s)", ::strerror(errno));
+			ktls_fallback_count++;
+			return false;
+		}
+
+		_is_ktls_send_enabled = true;
+
+		ktls_offloaded_count++;
+		ktls_current_offloaded_count++;
+
+		logtd("TLS encryption is offloaded to the kernel (fd: %d)", _ktls_socket_fd);
+
+		return true;
+#else	// OV_TLS_KTLS_SUPPORTED
+		return false;
+#endif	// OV_TLS_KTLS_SUPPORTED
+	}
+
+	ssize_t TlsServerData::SendKtlsControlMessage(const void *data, size_t length)
+	{
+#if OV_TLS_KTLS_SUPPORTED
+		// The record is written to the socket directly, so it must not overtake the queued data
+		if ((_is_send_queue_empty != nullptr) && (_is_send_queue_empty() == false))
+		{
+			logtw("Could not send TLS record (type: %d): there is data that is not sent yet", _ktls_record_type);
+			return -1L;
+		}
+
+		char control_buffer[CMSG_SPACE(sizeof(unsigned char))]{};
+		iovec iov{const_cast<void *>(data), length};
+
+		msghdr message{};
+		message.msg_iov = &iov;
+		message.msg_iovlen = 1;
+		message.msg_control = control_buffer;
+		message.msg_controllen = sizeof(control_buffer);
+
+		auto control_message = CMSG_FIRSTHDR(&message);
+		control_message->cmsg_level = SOL_TLS;
+		control_message->cmsg_type = TLS_SET_RECORD_TYPE;
+		control_message->cmsg_len = CMSG_LEN(sizeof(unsigned char));
+		*CMSG_DATA(control_message) = static_cast<unsigned char>(_ktls_record_type);
+
+		auto sent = ::sendmsg(_ktls_socket_fd, &message, MSG_NOSIGNAL);
+
+		if (sent != static_cast<ssize_t>(length))
+		{
+			logtw("Could not send TLS record (type: %d, %zu bytes): %zd (%s)", _ktls_record_type, length, sent, ::strerror(errno));
+			return -1L;
+		}
+
+		return sent;
+#else	// OV_TLS_KTLS_SUPPORTED
+		return -1L;
+#endif	// OV_TLS_KTLS_SUPPORTED
+	}
+}  // namespace ov
@@ -73,6 +73,43 @@ namespace ov
 		// cipher_data can be null even if successful (It indicates accepting a new client)
 		bool Encrypt(const std::shared_ptr<const Data> &plain_data, std::shared_ptr<const Data> *cipher_data);
 
+		// Offloads the encryption to the kernel (kTLS) after the handshake if the kernel and OpenSSL support it.
+		// If it is not possible, the data is encrypted by OpenSSL as before.
+		//
+		// <is_send_queue_empty> must return true if all the data written to <socket_fd> is passed to the kernel,
+		// because the kernel encrypts everything sent after the keys are installed
+		bool EnableKtls(int socket_fd, std::function<bool()> is_send_queue_empty);
+
+		bool IsKtlsSendEnabled() const
+		{
+			return _is_ktls_send_enabled;
+		}
+
+		struct KtlsStats
+		{
+			// Number of connections that requested kTLS
+			uint64_t requested_count = 0;
+			// Number of connections whose encryption is offloaded to the kernel
+			uint64_t offloaded_count = 0;
+			// Number of connections that fell back to the encryption of OpenSSL
+			uint64_t fallback_count = 0;
+
+			// Number of connections currently offloaded
+			size_t current_offloaded_count = 0;
+		};
+
+		static KtlsStats GetKtlsStats();
+
+		struct HandshakeStats
+		{
+			// Number of completed handshakes
+			uint64_t handshake_count = 0;
+			// Number of completed handshakes that resumed a session
+			uint64_t resumed_count = 0;
+		};
+
+		static HandshakeStats GetHandshakeStats();
+
 		size_t GetDataLength() const;
 		std::shared_ptr<const Data> GetData() const;
 
@@ -87,6 +124,14 @@ namespace ov
 		// OpenSSL -> Tls::() -> Tls::TlsCtrl() -> TlsBioCallback.ctrl_callback -> TlsServerData.OnTlsCtrl()
 		long OnTlsCtrl(ov::Tls *tls, int cmd, long num, void *arg);
 
+		// Installs the keys passed by OpenSSL (BIO_CTRL_SET_KTLS) to the socket
+		bool SetKtls(bool is_send, const void *crypto_info);
+		// Sends a record other than the application data (handshake, alert) with the record type to the kernel
+		ssize_t SendKtlsControlMessage(const void *data, size_t length);
+
+		// Sends the records written during the handshake at once
+		bool FlushHandshakeData();
+
 	protected:
 		State _state = State::Invalid;
 
@@ -94,6 +139,8 @@ namespace ov
 
 		Tls _tls;
 		WriteCallback _write_callback;
+		// The records of a handshake flight, which are sent when OpenSSL flushes the BIO
+		std::shared_ptr<Data> _handshake_data;
 
 		std::mutex _cipher_data_mutex;
 		std::shared_ptr<Data> _cipher_data;
@@ -102,5 +149,11 @@ namespace ov
 		std::shared_ptr<Data> _plain_data;
 
 		AlpnProtocol _selected_alpn_protocol = AlpnProtocol::Http11;
+
+		int _ktls_socket_fd = -1;
+		std::function<bool()> _is_send_queue_empty;
+		bool _is_ktls_send_enabled = false;
+		// The type of the record written next (BIO_CTRL_SET_KTLS_TX_SEND_CTRL_MSG), -1 for the application data
+		int _ktls_record_type = -1;
 	};
 }  // namespace ov
@@ -12,6 +12,7 @@
 #include "./certificate.h"
 #include "./certificate_pair.h"
 #include "./crc_32.h"
+#include "./hmac_key.h"
 #include "./message_digest.h"
 
 // Related to OpenSSL
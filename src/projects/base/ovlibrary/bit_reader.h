@@ -7,6 +7,7 @@
 #include <base/ovlibrary/ovlibrary.h>
 
 #include "byte_io.h"
+#include "byte_ordering.h"
 
 class BitReader
 {
@@ -110,11 +111,27 @@ public:
 			return 0;
 		}
 
-        if (static_cast<size_t>((bits + 7) / 8) > static_cast<size_t>(_capacity - (_position - _buffer))) 
+        if (static_cast<size_t>(bits) > BitsRemained())
 		{
 			return false;
 		}
 
+		// Fast path: takes the bits from a 64-bit big-endian word at once (_bit_offset is 7 at most, so 57 bits are always in the word)
+		if ((bits <= 57) && (BytesRemained() >= sizeof(uint64_t)))
+		{
+			uint64_t word;
+			::memcpy(&word, _position, sizeof(word));
+			word = ov::BE64ToHost(word);
+
+			value = static_cast<T>((word << _bit_offset) >> (64 - bits));
+
+			const size_t consumed_bits = _bit_offset + bits;
+			_position += consumed_bits / 8;
+			_bit_offset = consumed_bits % 8;
+
+			return true;
+		}
+
         while (bits)
         {
             const uint8_t bits_from_this_byte = std::min(bits >= 8 ? 8 : bits % 8, 8 - _bit_offset);
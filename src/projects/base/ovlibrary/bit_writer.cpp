@@ -8,6 +8,10 @@
 //==============================================================================
 #include "bit_writer.h"
 
+#include <cstring>
+
+#include "byte_ordering.h"
+
 namespace ov
 {
 	BitWriter::BitWriter(uint32_t data_size)
@@ -30,11 +34,27 @@ namespace ov
 
 		data += _bit_count/8;
 
+		if ((bit_count > 0) && ((_bit_count/8) + sizeof(uint64_t) <= _data->size()))
+		{
+			// Fast path: merges the bits into a 64-bit big-endian word at once (bit offset(7 at most) + 32 bits fit in the word)
+			uint64_t mask = (bit_count == 32) ? 0xFFFFFFFF : ((1ULL << bit_count) - 1);
+			uint64_t word;
+
+			::memcpy(&word, data, sizeof(word));
+			word = ov::BE64ToHost(word);
+			word |= (value & mask) << (64 - (_bit_count%8) - bit_count);
+			word = ov::HostToBE64(word);
+			::memcpy(data, &word, sizeof(word));
+
+			_bit_count += bit_count;
+			return;
+		}
+
 		space = 8-(_bit_count%8);
 
 		while (bit_count) 
 		{
-			uint32_t mask = bit_count==32 ? 0xFFFFFFFF : ((1<<bit_count)-1);
+			uint32_t mask = bit_count==32 ? 0xFFFFFFFF : ((1u<<bit_count)-1);
 			
 			if (bit_count <= space)
 			{
@@ -83,6 +83,41 @@ namespace ov
 		return true;
 	}
 
+	ByteWriteCursor ByteStream::ReserveWrite(size_t bytes) noexcept
+	{
+		if (_data == nullptr)
+		{
+			OV_ASSERT(false, "Cannot write to read-only data");
+			return {};
+		}
+
+		if ((_offset + bytes) > _data->GetLength())
+		{
+			if (_data->SetLength(static_cast<size_t>(_offset + bytes)) == false)
+			{
+				return {};
+			}
+		}
+
+		ByteWriteCursor cursor(_data->GetWritableDataAs<uint8_t>() + _offset, bytes);
+		_offset += bytes;
+
+		return cursor;
+	}
+
+	ByteReadCursor ByteStream::ReserveRead(size_t bytes) noexcept
+	{
+		if (Remained() < bytes)
+		{
+			return {};
+		}
+
+		ByteReadCursor cursor(CurrentBuffer<uint8_t>(), bytes);
+		_offset += bytes;
+
+		return cursor;
+	}
+
 	bool ByteStream::Append(const void *data, size_t bytes) noexcept
 	{
 		if (_data == nullptr)
@@ -30,6 +30,161 @@
 
 namespace ov
 {
+	/// Writes the fields into a region that is already reserved by ByteStream::ReserveWrite(), without checking the capacity per field
+	///
+	/// The bounds are only checked by OV_ASSERT (in debug build)
+	class ByteWriteCursor
+	{
+	public:
+		ByteWriteCursor() = default;
+		ByteWriteCursor(uint8_t *buffer, size_t bytes)
+			: _position(buffer),
+			  _end(buffer + bytes)
+		{
+		}
+
+		/// Whether the region is reserved
+		bool IsValid() const noexcept
+		{
+			return _position != nullptr;
+		}
+
+		size_t Remained() const noexcept
+		{
+			return _end - _position;
+		}
+
+		inline ByteWriteCursor &Write(const void *data, size_t bytes) noexcept
+		{
+			OV_ASSERT(bytes <= Remained(), "Exceeded reserved region: %zu > %zu", bytes, Remained());
+
+			::memcpy(_position, data, bytes);
+			_position += bytes;
+
+			return *this;
+		}
+
+		inline ByteWriteCursor &Write8(uint8_t value) noexcept
+		{
+			OV_ASSERT(Remained() >= 1, "Exceeded reserved region");
+
+			*(_position++) = value;
+
+			return *this;
+		}
+
+		inline ByteWriteCursor &WriteBE16(uint16_t value) noexcept
+		{
+			value = HostToBE16(value);
+			return Write(&value, sizeof(value));
+		}
+
+		inline ByteWriteCursor &WriteBE24(uint32_t value) noexcept
+		{
+			OV_ASSERT(Remained() >= 3, "Exceeded reserved region");
+
+			_position[0] = static_cast<uint8_t>(value >> 16);
+			_position[1] = static_cast<uint8_t>(value >> 8);
+			_position[2] = static_cast<uint8_t>(value);
+			_position += 3;
+
+			return *this;
+		}
+
+		inline ByteWriteCursor &WriteBE32(uint32_t value) noexcept
+		{
+			value = HostToBE32(value);
+			return Write(&value, sizeof(value));
+		}
+
+		inline ByteWriteCursor &WriteBE64(uint64_t value) noexcept
+		{
+			value = HostToBE64(value);
+			return Write(&value, sizeof(value));
+		}
+
+	protected:
+		uint8_t *_position = nullptr;
+		uint8_t *_end = nullptr;
+	};
+
+	/// Reads the fields from a region that is already checked by ByteStream::ReserveRead(), without checking the length per field
+	///
+	/// The bounds are only checked by OV_ASSERT (in debug build)
+	class ByteReadCursor
+	{
+	public:
+		ByteReadCursor() = default;
+		ByteReadCursor(const uint8_t *buffer, size_t bytes)
+			: _position(buffer),
+			  _end(buffer + bytes)
+		{
+		}
+
+		/// Whether the region is reserved
+		bool IsValid() const noexcept
+		{
+			return _position != nullptr;
+		}
+
+		size_t Remained() const noexcept
+		{
+			return _end - _position;
+		}
+
+		inline ByteReadCursor &Read(void *data, size_t bytes) noexcept
+		{
+			OV_ASSERT(bytes <= Remained(), "Exceeded reserved region: %zu > %zu", bytes, Remained());
+
+			::memcpy(data, _position, bytes);
+			_position += bytes;
+
+			return *this;
+		}
+
+		inline uint8_t Read8() noexcept
+		{
+			OV_ASSERT(Remained() >= 1, "Exceeded reserved region");
+
+			return *(_position++);
+		}
+
+		inline uint16_t ReadBE16() noexcept
+		{
+			uint16_t value;
+			Read(&value, sizeof(value));
+			return BE16ToHost(value);
+		}
+
+		inline uint32_t ReadBE24() noexcept
+		{
+			OV_ASSERT(Remained() >= 3, "Exceeded reserved region");
+
+			uint32_t value = (static_cast<uint32_t>(_position[0]) << 16) | (static_cast<uint32_t>(_position[1]) << 8) | _position[2];
+			_position += 3;
+
+			return value;
+		}
+
+		inline uint32_t ReadBE32() noexcept
+		{
+			uint32_t value;
+			Read(&value, sizeof(value));
+			return BE32ToHost(value);
+		}
+
+		inline uint64_t ReadBE64() noexcept
+		{
+			uint64_t value;
+			Read(&value, sizeof(value));
+			return BE64ToHost(value);
+		}
+
+	protected:
+		const uint8_t *_position = nullptr;
+		const uint8_t *_end = nullptr;
+	};
+
 	class ByteStream
 	{
 	public:
@@ -345,6 +500,21 @@ namespace ov
 			return Write(buffer, 1);
 		}
 
+		/// Reserves ```bytes``` from the current offset, and moves the offset to the end of the region at once.
+		/// The fields can be written to the cursor with one capacity check, instead of Write*() per field.
+		///
+		/// @param bytes The size of the region to write
+		///
+		/// @return The cursor of the region (IsValid() is false if the data is read-only or cannot be expanded)
+		ByteWriteCursor ReserveWrite(size_t bytes) noexcept;
+
+		/// Checks that ```bytes``` remain from the current offset, and moves the offset to the end of the region at once.
+		///
+		/// @param bytes The size of the region to read
+		///
+		/// @return The cursor of the region (IsValid() is false if there is not enough data)
+		ByteReadCursor ReserveRead(size_t bytes) noexcept;
+
 		bool WriteText(const ov::String &text, bool null_terminate = false) noexcept
 		{
 			return Write(text.ToData(null_terminate));
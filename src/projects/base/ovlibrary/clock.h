@@ -16,6 +16,11 @@ namespace ov
 			return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
 		}
 
+		static uint64_t NowUSec()
+		{
+			return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+		}
+
 		// yy:mm:dd HH:MM:SS.ms
 		static ov::String Now()
 		{
@@ -0,0 +1,123 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "cpu_features.h"
+
+#include <map>
+#include <mutex>
+
+#if OV_CPU_DISPATCH_ARM64
+#	include <asm/hwcap.h>
+#	include <sys/auxv.h>
+#endif
+
+namespace ov
+{
+	uint32_t CpuFeatures::Detect()
+	{
+		uint32_t features = 0;
+
+#if OV_CPU_DISPATCH_X86
+		__builtin_cpu_init();
+
+		if (__builtin_cpu_supports("sse2"))
+		{
+			features |= static_cast<uint32_t>(CpuFeature::Sse2);
+		}
+
+		if (__builtin_cpu_supports("avx2"))
+		{
+			features |= static_cast<uint32_t>(CpuFeature::Avx2);
+		}
+
+		if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw"))
+		{
+			features |= static_cast<uint32_t>(CpuFeature::Avx512Bw);
+		}
+
+		if (__builtin_cpu_supports("pclmul"))
+		{
+			features |= static_cast<uint32_t>(CpuFeature::Pclmul);
+		}
+#elif OV_CPU_DISPATCH_ARM64
+		features |= static_cast<uint32_t>(CpuFeature::Neon);
+
+		if (::getauxval(AT_HWCAP) & HWCAP_CRC32)
+		{
+			features |= static_cast<uint32_t>(CpuFeature::ArmCrc32);
+		}
+#elif defined(__ARM_NEON)
+		// NEON is mandatory on AArch64, and the build uses it as the baseline on ARM
+		features |= static_cast<uint32_t>(CpuFeature::Neon);
+#endif
+
+		return features;
+	}
+
+	bool CpuFeatures::Has(CpuFeature feature)
+	{
+		static const uint32_t features = Detect();
+
+		return (features & static_cast<uint32_t>(feature)) == static_cast<uint32_t>(feature);
+	}
+
+	String CpuFeatures::GetFeaturesString()
+	{
+		String features;
+
+		for (auto [feature, name] : {
+				 std::make_pair(CpuFeature::Sse2, "sse2"),
+				 std::make_pair(CpuFeature::Avx2, "avx2"),
+				 std::make_pair(CpuFeature::Avx512Bw, "avx512bw"),
+				 std::make_pair(CpuFeature::Neon, "neon"),
+				 std::make_pair(CpuFeature::Pclmul, "pclmul"),
+				 std::make_pair(CpuFeature::ArmCrc32, "crc32"),
+			 })
+		{
+			if (Has(feature))
+			{
+				features.AppendFormat("%s%s", features.IsEmpty() ? "" : " ", name);
+			}
+		}
+
+		return features.IsEmpty() ? "none" : features;
+	}
+
+	// The selections are made by static initializers, so the map is created on the first use
+	static std::mutex &GetSelectionMutex()
+	{
+		static std::mutex mutex;
+		return mutex;
+	}
+
+	static std::map<String, String> &GetSelections()
+	{
+		static std::map<String, String> selections;
+		return selections;
+	}
+
+	void CpuFeatures::RegisterSelection(const char *name, const char *variant)
+	{
+		std::lock_guard<std::mutex> lock(GetSelectionMutex());
+
+		GetSelections()[name] = variant;
+	}
+
+	String CpuFeatures::GetSelectionsString()
+	{
+		std::lock_guard<std::mutex> lock(GetSelectionMutex());
+
+		String selections;
+
+		for (const auto &[name, variant] : GetSelections())
+		{
+			selections.AppendFormat("%s%s: %s", selections.IsEmpty() ? "" : ", ", name.CStr(), variant.CStr());
+		}
+
+		return selections;
+	}
+}  // namespace ov
@@ -0,0 +1,120 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <cstdint>
+#include <initializer_list>
+
+#include "./string.h"
+
+// The kernels built for an instruction set that is not in the baseline of the build (e.g. AVX2 on x86-64) are marked with these,
+// and they are called only if CpuFeatures reports the instruction set at runtime
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#	define OV_CPU_DISPATCH_X86 1
+#	define OV_TARGET_AVX2 __attribute__((target("avx2")))
+#	define OV_TARGET_AVX512BW __attribute__((target("avx512f,avx512bw")))
+#	define OV_TARGET_PCLMUL __attribute__((target("pclmul,sse2")))
+#else
+#	define OV_CPU_DISPATCH_X86 0
+#endif
+
+#if defined(__aarch64__) && defined(__linux__) && (defined(__GNUC__) || defined(__clang__))
+#	define OV_CPU_DISPATCH_ARM64 1
+#	if defined(__clang__)
+#		define OV_TARGET_ARM_CRC32 __attribute__((target("crc")))
+#	else
+#		define OV_TARGET_ARM_CRC32 __attribute__((target("+crc")))
+#	endif
+#else
+#	define OV_CPU_DISPATCH_ARM64 0
+#endif
+
+// Name of the kernels built for the baseline instruction set of the build
+#if defined(__SSE2__)
+#	define OV_CPU_BASELINE_NAME "sse2"
+#elif defined(__ARM_NEON)
+#	define OV_CPU_BASELINE_NAME "neon"
+#else
+#	define OV_CPU_BASELINE_NAME "scalar"
+#endif
+
+namespace ov
+{
+	enum class CpuFeature : uint32_t
+	{
+		// Always available (the kernels without SIMD)
+		None = 0,
+
+		Sse2 = 1 << 0,
+		Avx2 = 1 << 1,
+		Avx512Bw = 1 << 2,
+		Neon = 1 << 3,
+		// Carry-less multiplication (x86)
+		Pclmul = 1 << 4,
+		// CRC32 instructions of ARMv8 (the polynomial of IEEE 802.3)
+		ArmCrc32 = 1 << 5,
+	};
+
+	// Detects the SIMD instruction sets of the CPU at runtime, so one binary uses the best kernels on every host.
+	//
+	// A kernel is selected once with Select(), typically into a static function pointer:
+	//
+	//   static const auto XorBlock = ov::CpuFeatures::Select<XorBlockFunction>("fec.xor", {
+	//       {ov::CpuFeature::Avx2, "avx2", XorBlockAvx2},
+	//       {ov::CpuFeature::None, OV_CPU_BASELINE_NAME, XorBlockBaseline},
+	//   });
+	class CpuFeatures
+	{
+	public:
+		template <typename Tfunction>
+		struct Kernel
+		{
+			CpuFeature feature;
+			const char *variant;
+			Tfunction function;
+		};
+
+		static bool Has(CpuFeature feature);
+
+		// Returns the first of <kernels> (in the order of preference) whose instruction set is supported.
+		// The last kernel must be available on every CPU (CpuFeature::None)
+		template <typename Tfunction>
+		static Tfunction Select(const char *name, std::initializer_list<Kernel<Tfunction>> kernels)
+		{
+			const Kernel<Tfunction> *selected = nullptr;
+
+			for (const auto &kernel : kernels)
+			{
+				selected = &kernel;
+
+				if (Has(kernel.feature))
+				{
+					break;
+				}
+			}
+
+			if (selected == nullptr)
+			{
+				return nullptr;
+			}
+
+			RegisterSelection(name, selected->variant);
+
+			return selected->function;
+		}
+
+		// e.g. "sse2 avx2"
+		static String GetFeaturesString();
+		// e.g. "fec.xor: avx2, nal.start_code: avx2"
+		static String GetSelectionsString();
+
+	private:
+		static uint32_t Detect();
+		static void RegisterSelection(const char *name, const char *variant);
+	};
+}  // namespace ov
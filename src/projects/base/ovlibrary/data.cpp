@@ -11,6 +11,8 @@
 #include <cstdint>
 
 #include "./assert.h"
+#include "./data_copy_audit.h"
+#include "./data_pool.h"
 #include "./dump_utilities.h"
 
 namespace ov
@@ -47,21 +49,38 @@ namespace ov
 		}
 	}
 
+	Data::Data(const void *data, size_t length, const std::shared_ptr<const void> &owner)
+		: Data(data, length, true)
+	{
+		_reference_owner = owner;
+	}
+
 	Data::Data(const Data &data)
 	{
-		_reference_data = data._reference_data;
-		if (data._allocated_data != nullptr)
+		if (data._reference_data != nullptr)
+		{
+			_reference_data = data._reference_data;
+			_reference_owner = data._reference_owner;
+			_offset = data._offset;
+			_length = data._length;
+		}
+		else if (data._allocated_data != nullptr)
 		{
-			_allocated_data = std::make_shared<std::vector<uint8_t>>();
+			if (DataCopyAudit::IsEnabled())
+			{
+				DataCopyAudit::Record(DataCopyAudit::Reason::Copy, data.GetLength());
+			}
+
+			// The bytes are copied to the front of the new buffer (_offset: 0)
+			_allocated_data = DataPool::Allocate(data.GetLength());
 			Append(&data);
 		}
-		_offset = data._offset;
-		_length = data._length;
 	}
 
 	Data::Data(Data &&data) noexcept
 	{
 		std::swap(_reference_data, data._reference_data);
+		std::swap(_reference_owner, data._reference_owner);
 		std::swap(_allocated_data, data._allocated_data);
 		std::swap(_offset, data._offset);
 		std::swap(_length, data._length);
@@ -105,6 +124,9 @@ namespace ov
 		{
 			// Refer _reference_data
 			instance->_reference_data = _reference_data;
+			instance->_reference_owner = _reference_owner;
+			// The buffer allocated by the default constructor is not used (the copy constructor would copy it)
+			instance->_allocated_data = nullptr;
 		}
 		else
 		{
@@ -153,6 +175,7 @@ namespace ov
 
 		// ov::Data supports COW (Copy-on-write), so we just assign the variables of data to member variables.
 		_reference_data = data._reference_data;
+		_reference_owner = data._reference_owner;
 		_allocated_data = data._allocated_data;
 		_offset = data._offset;
 		_length = data._length;
@@ -221,13 +244,21 @@ namespace ov
 		{
 			// Copy from original data
 			const void *original_data = _reference_data;
+			// The original data must be alive until it is copied
+			auto original_owner = std::move(_reference_owner);
 			off_t offset = _offset;
 			size_t length = _length;
 
 			_reference_data = nullptr;
+			_reference_owner = nullptr;
 			_offset = 0;
 			_length = 0;
 
+			if (DataCopyAudit::IsEnabled())
+			{
+				DataCopyAudit::Record(DataCopyAudit::Reason::DetachReference, length);
+			}
+
 			return Reserve(length) && Append(static_cast<const uint8_t *>(original_data) + offset, length);
 		}
 
@@ -237,10 +268,13 @@ namespace ov
 			return false;
 		}
 
-		if (_allocated_data.use_count() == 1)
+		bool is_shared = (_allocated_data.use_count() != 1);
+
+		if (is_shared == false)
 		{
 			// Nobody references _allocated_data. So do not need to copy the data
-			if (_allocated_data->size() == GetLength())
+			// (the bytes before _offset are kept as the headroom)
+			if (_allocated_data->size() == static_cast<size_t>(_offset + _length))
 			{
 				return true;
 			}
@@ -248,19 +282,34 @@ namespace ov
 			// Need to shrink the vector size
 		}
 
+		if (DataCopyAudit::IsEnabled())
+		{
+			DataCopyAudit::Record(is_shared ? DataCopyAudit::Reason::DetachShared : DataCopyAudit::Reason::DetachShrink, _length);
+		}
+
 		// Copy data from <_offset> to <_offset + length>
 		auto old_data = _allocated_data;
 		auto old_offset = _offset;
-		auto begin = old_data->begin() + _offset;
+
+		// Keep (a part of) the headroom of the shared buffer, so the headers can still be prepended to the copy
+		size_t headroom = is_shared ? std::min(static_cast<size_t>(old_offset), static_cast<size_t>(OV_DATA_MAX_DETACHED_HEADROOM)) : 0;
+
+		_allocated_data = DataPool::Allocate(headroom + std::max(static_cast<size_t>(_length), old_data->capacity() - old_offset));
+
+		if (_allocated_data == nullptr)
+		{
+			return false;
+		}
+
+		auto begin = old_data->begin() + old_offset;
 		auto end = begin + _length;
 
-		// Reset the offset
-		_offset = 0L;
+		_allocated_data->assign(headroom, 0);
+		_allocated_data->insert(_allocated_data->end(), begin, end);
 
-		_allocated_data = std::make_shared<std::vector<uint8_t>>(begin, end);
-		_allocated_data->reserve(old_data->capacity() - old_offset);
+		_offset = headroom;
 
-		return (_allocated_data != nullptr);
+		return true;
 	}
 
 	bool Data::Reserve(size_t capacity)
@@ -276,18 +325,97 @@ namespace ov
 		}
 		else
 		{
-			_allocated_data = std::make_shared<std::vector<uint8_t>>();
+			_allocated_data = DataPool::Allocate(capacity);
+		}
+
+		_allocated_data->reserve(_offset + capacity);
+
+		return true;
+	}
+
+	size_t Data::GetHeadroom() const noexcept
+	{
+		if ((_reference_data != nullptr) || (_allocated_data == nullptr) || (_allocated_data.use_count() != 1))
+		{
+			// The bytes before _offset may be used by other instances
+			return 0;
+		}
+
+		return _offset;
+	}
+
+	bool Data::ReserveHeadroom(size_t headroom)
+	{
+		if (Detach() == false)
+		{
+			return false;
+		}
+
+		if (static_cast<size_t>(_offset) >= headroom)
+		{
+			return true;
 		}
 
-		_allocated_data->reserve(capacity);
+		// Move the data behind the headroom
+		auto new_data = DataPool::Allocate(headroom + std::max(_allocated_data->capacity() - _offset, _length));
+
+		new_data->resize(headroom + _length);
+		::memcpy(new_data->data() + headroom, _allocated_data->data() + _offset, _length);
+
+		_allocated_data = new_data;
+		_offset = headroom;
 
 		return true;
 	}
 
+	size_t Data::GetTailroom() const noexcept
+	{
+		if ((_reference_data != nullptr) || (_allocated_data == nullptr) || (_allocated_data.use_count() != 1))
+		{
+			return 0;
+		}
+
+		return _allocated_data->capacity() - (_offset + _length);
+	}
+
+	bool Data::Prepend(const void *data, size_t length)
+	{
+		if ((data == nullptr) && (length > 0))
+		{
+			OV_ASSERT(false, "Invalid parameter: length is greater than 0, but data is NULL");
+			return false;
+		}
+
+		if (GetHeadroom() >= length)
+		{
+			_offset -= length;
+			_length += length;
+			::memcpy(_allocated_data->data() + _offset, data, length);
+
+			return true;
+		}
+
+		return Insert(data, 0, length);
+	}
+
+	void *Data::PrependSpace(size_t length)
+	{
+		if ((GetHeadroom() < length) && (ReserveHeadroom(length) == false))
+		{
+			return nullptr;
+		}
+
+		_offset -= length;
+		_length += length;
+
+		return _allocated_data->data() + _offset;
+	}
+
 	bool Data::Clear() noexcept
 	{
 		// Reallocate the buffer (this method is faster than Detach() & clear());
 		_reference_data = nullptr;
+		_reference_owner = nullptr;
 		_allocated_data = std::make_shared<std::vector<uint8_t>>();
 		_offset = 0;
 		_length = 0;
@@ -376,12 +504,12 @@ namespace ov
 			return false;
 		}
 
-		auto begin = _allocated_data->begin() + offset;
+		auto begin = _allocated_data->begin() + (_offset + offset);
 
 		_allocated_data->erase(begin, begin + length);
 		_length -= length;
 
-		OV_ASSERT(_length == _allocated_data->size(), "length: %zu, allocated size: %zu", _length, _allocated_data->size());
+		OV_ASSERT((_offset + _length) == _allocated_data->size(), "offset: %jd, length: %zu, allocated size: %zu", static_cast<intmax_t>(_offset), _length, _allocated_data->size());
 
 		return true;
 	}
@@ -17,6 +17,10 @@
 #include <algorithm>
 #include <cstddef>
 
+// Maximum headroom kept when a shared buffer is copied by Detach(), so that the copy of a packet can still
+// have its headers prepended in place
+#define OV_DATA_MAX_DETACHED_HEADROOM 64
+
 namespace ov
 {
 	class Data
@@ -41,6 +45,13 @@ namespace ov
 		/// If reference_only is false, it will not be affected if the data changes because it allocates a new memory and copies it there.
 		Data(const void *data, size_t length, bool reference_only = false);
 
+		/// Constructs a instance that references <data> without copying it
+		///
+		/// @param data data to reference
+		/// @param length length of data
+		/// @param owner an object that keeps <data> alive (e.g. a memory-mapped file), shared by the copies/subdata of this instance
+		Data(const void *data, size_t length, const std::shared_ptr<const void> &owner);
+
 		// Copy constructor
 		Data(const Data &data);
 
@@ -124,7 +135,7 @@ namespace ov
 			// Detach() will called in Reserve()
 			if(Reserve(length))
 			{
-				_allocated_data->resize(length);
+				_allocated_data->resize(_offset + length);
 				_length = length;
 				return true;
 			}
@@ -144,10 +155,10 @@ namespace ov
 
 		/// 할당되어 있는 메모리 크기를 얻어옴.
 		///
-		/// @return 할당되어 있는 메모리 크기
+		/// @return 할당되어 있는 메모리 크기 (headroom 등 _offset 앞의 영역은 제외)
 		inline size_t GetCapacity() const noexcept
 		{
-			return (_allocated_data != nullptr) ? _allocated_data->capacity() : 0;
+			return (_allocated_data != nullptr) ? (_allocated_data->capacity() - _offset) : 0;
 		}
 
 		/// 버퍼에 있는 데이터 모두 삭제
@@ -162,12 +173,36 @@ namespace ov
 		bool Insert(const Data *data, off_t offset);
 
 		bool Append(const void *data, size_t length);
+		/// Adds <data> in front of the data. If there is enough headroom, <data> is written into it without moving the data.
+		bool Prepend(const void *data, size_t length);
+		/// Extends the data to the front by <length> bytes like Prepend(), but leaves the new bytes uninitialized
+		///
+		/// @return The writable pointer of the new beginning of the data (nullptr on failure)
+		void *PrependSpace(size_t length);
 		bool Append(const Data *data);
 		bool Append(const std::shared_ptr<Data> &data);
 		bool Append(const std::shared_ptr<const Data> &data);
 
 		bool Erase(off_t offset, size_t length);
 
+		/// Makes room of <headroom> bytes in front of the data (the data is moved if there is not enough room),
+		/// so that packetizers can add the headers with Prepend() without reallocating/moving the payload.
+		///
+		/// @remarks When the buffer is shared (e.g. Clone()) and detached, up to OV_DATA_MAX_DETACHED_HEADROOM bytes of
+		///          the headroom are kept.
+		bool ReserveHeadroom(size_t headroom);
+		/// The number of bytes that can be prepended without moving the data
+		size_t GetHeadroom() const noexcept;
+
+		/// Makes room of <tailroom> bytes after the data (e.g. for the authentication tag of SRTP).
+		/// The buffer is reallocated only if there is not enough room.
+		bool ReserveTailroom(size_t tailroom)
+		{
+			return Reserve(_length + tailroom);
+		}
+		/// The number of bytes that can be appended without reallocating the buffer
+		size_t GetTailroom() const noexcept;
+
 		/// this 데이터의 일부 영역만 참조하는 Data instance 생성
 		///
 		/// @param offset 원본 데이터에서 참조할 offset. 만약 offset이 음수라면, <GetLength() + offset> 부분부터 참조하는 instance를 생성함
@@ -215,6 +250,8 @@ namespace ov
 		bool Detach();
 
 		const void *_reference_data = nullptr;
+		// Keeps _reference_data alive while it is referenced (nullptr if the owner of _reference_data is not managed)
+		std::shared_ptr<const void> _reference_owner = nullptr;
 
 		// Allocated data. If this data is subdata, _current_data and _data can be different.
 		std::shared_ptr<std::vector<uint8_t>> _allocated_data = nullptr;
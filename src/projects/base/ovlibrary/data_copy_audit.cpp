@@ -0,0 +1,202 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "./data_copy_audit.h"
+
+#include <execinfo.h>
+
+#include <algorithm>
+#include <mutex>
+#include <unordered_map>
+
+#include "./stack_trace.h"
+
+// The frame of Record() (so that the stack starts from the function of ov::Data that copied)
+#define OV_DATA_COPY_AUDIT_SKIP_FRAMES 1
+
+namespace ov
+{
+	namespace
+	{
+		struct FramesHash
+		{
+			size_t operator()(const std::vector<void *> &frames) const
+			{
+				size_t hash = 0;
+
+				for (auto frame : frames)
+				{
+					hash = (hash * 31) ^ std::hash<void *>()(frame);
+				}
+
+				return hash;
+			}
+		};
+
+		struct SampledStack
+		{
+			uint64_t count = 0;
+			uint64_t bytes = 0;
+		};
+
+		struct ThreadAccumulator
+		{
+			// The copies/bytes since the last sample of this thread
+			uint64_t count = 0;
+			uint64_t bytes = 0;
+		};
+
+		std::atomic<uint64_t> copy_count[static_cast<int>(DataCopyAudit::Reason::Count)];
+		std::atomic<uint64_t> copy_bytes[static_cast<int>(DataCopyAudit::Reason::Count)];
+
+		std::mutex stack_mutex;
+		std::unordered_map<std::vector<void *>, SampledStack, FramesHash> stack_map;
+		uint64_t dropped_sample_count = 0;
+
+		thread_local ThreadAccumulator thread_accumulator;
+	}  // namespace
+
+#ifdef DEBUG
+	std::atomic<bool> DataCopyAudit::_enabled{true};
+#else	// DEBUG
+	std::atomic<bool> DataCopyAudit::_enabled{false};
+#endif	// DEBUG
+
+	void DataCopyAudit::SetEnabled(bool enabled)
+	{
+		_enabled = enabled;
+	}
+
+	void DataCopyAudit::Reset()
+	{
+		for (int index = 0; index < static_cast<int>(Reason::Count); index++)
+		{
+			copy_count[index] = 0;
+			copy_bytes[index] = 0;
+		}
+
+		std::lock_guard<std::mutex> lock(stack_mutex);
+
+		stack_map.clear();
+		dropped_sample_count = 0;
+	}
+
+	void DataCopyAudit::Record(Reason reason, size_t bytes)
+	{
+		auto index = static_cast<int>(reason);
+
+		copy_count[index].fetch_add(1, std::memory_order_relaxed);
+		copy_bytes[index].fetch_add(bytes, std::memory_order_relaxed);
+
+		auto &accumulator = thread_accumulator;
+
+		accumulator.count++;
+		accumulator.bytes += bytes;
+
+		if (accumulator.bytes < OV_DATA_COPY_AUDIT_SAMPLING_BYTES)
+		{
+			return;
+		}
+
+		// This sample represents all the copies since the last sample of this thread
+		void *frames[OV_DATA_COPY_AUDIT_MAX_STACK_DEPTH + OV_DATA_COPY_AUDIT_SKIP_FRAMES];
+		int depth = ::backtrace(frames, OV_DATA_COPY_AUDIT_MAX_STACK_DEPTH + OV_DATA_COPY_AUDIT_SKIP_FRAMES);
+
+		std::vector<void *> key;
+
+		if (depth > OV_DATA_COPY_AUDIT_SKIP_FRAMES)
+		{
+			key.assign(frames + OV_DATA_COPY_AUDIT_SKIP_FRAMES, frames + depth);
+		}
+
+		{
+			std::lock_guard<std::mutex> lock(stack_mutex);
+
+			auto item = stack_map.find(key);
+
+			if (item != stack_map.end())
+			{
+				item->second.count += accumulator.count;
+				item->second.bytes += accumulator.bytes;
+			}
+			else if (stack_map.size() < OV_DATA_COPY_AUDIT_MAX_STACK_COUNT)
+			{
+				stack_map.emplace(std::move(key), SampledStack{accumulator.count, accumulator.bytes});
+			}
+			else
+			{
+				dropped_sample_count++;
+			}
+		}
+
+		accumulator = {};
+	}
+
+	DataCopyAudit::Stats DataCopyAudit::GetStats(size_t max_call_stack_count)
+	{
+		Stats stats;
+
+		stats.enabled = IsEnabled();
+
+		for (int index = 0; index < static_cast<int>(Reason::Count); index++)
+		{
+			stats.count[index] = copy_count[index].load(std::memory_order_relaxed);
+			stats.bytes[index] = copy_bytes[index].load(std::memory_order_relaxed);
+		}
+
+		std::vector<std::pair<std::vector<void *>, SampledStack>> stack_list;
+
+		{
+			std::lock_guard<std::mutex> lock(stack_mutex);
+
+			stack_list.assign(stack_map.begin(), stack_map.end());
+			stats.dropped_sample_count = dropped_sample_count;
+		}
+
+		std::sort(stack_list.begin(), stack_list.end(), [](const auto &lhs, const auto &rhs) {
+			return lhs.second.bytes > rhs.second.bytes;
+		});
+
+		if (stack_list.size() > max_call_stack_count)
+		{
+			stack_list.resize(max_call_stack_count);
+		}
+
+		// Resolving the names takes time, so it is done only for the stacks to return
+		for (const auto &[frames, sampled_stack] : stack_list)
+		{
+			CallStack call_stack;
+
+			call_stack.frames = StackTrace::GetFunctionNames(frames.data(), static_cast<int>(frames.size()));
+			call_stack.count = sampled_stack.count;
+			call_stack.bytes = sampled_stack.bytes;
+
+			stats.call_stacks.push_back(std::move(call_stack));
+		}
+
+		return stats;
+	}
+
+	const char *DataCopyAudit::StringFromReason(Reason reason)
+	{
+		switch (reason)
+		{
+			case Reason::DetachReference:
+				return "detachReference";
+			case Reason::DetachShared:
+				return "detachShared";
+			case Reason::DetachShrink:
+				return "detachShrink";
+			case Reason::Copy:
+				return "copy";
+			case Reason::Count:
+				break;
+		}
+
+		return "unknown";
+	}
+}  // namespace ov
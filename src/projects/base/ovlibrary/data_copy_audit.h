@@ -0,0 +1,90 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "./string.h"
+
+// A call stack is sampled whenever a thread has copied this many bytes since its last sample
+#define OV_DATA_COPY_AUDIT_SAMPLING_BYTES (256 * 1024)
+// Maximum number of the frames of a sampled call stack
+#define OV_DATA_COPY_AUDIT_MAX_STACK_DEPTH 32
+// Maximum number of distinct call stacks to keep (the samples of new stacks after it are only counted)
+#define OV_DATA_COPY_AUDIT_MAX_STACK_COUNT 1024
+
+namespace ov
+{
+	// Counts the deep copies of ov::Data, which are made silently by copy-on-write (e.g. GetWritableData() of
+	// a packet shared by many sessions), and samples their call stacks weighted by the bytes copied.
+	//
+	// It is enabled by default in the debug build, and can be enabled at runtime.
+	class DataCopyAudit
+	{
+	public:
+		enum class Reason : int
+		{
+			// The data referenced without ownership (reference_only/memory-mapped) is copied to be modified
+			DetachReference = 0,
+			// The buffer shared with other instances (Clone()/Subdata()/operator=) is copied to be modified
+			DetachShared,
+			// The part of the buffer that is not shared anymore is moved to the front of a new buffer
+			DetachShrink,
+			// Copy constructor
+			Copy,
+
+			Count
+		};
+
+		struct CallStack
+		{
+			// Function names, from the function of ov::Data that copied
+			std::vector<String> frames;
+
+			// The copies/bytes represented by the samples of this stack
+			uint64_t count = 0;
+			uint64_t bytes = 0;
+		};
+
+		struct Stats
+		{
+			bool enabled = false;
+
+			uint64_t count[static_cast<int>(Reason::Count)] = {};
+			uint64_t bytes[static_cast<int>(Reason::Count)] = {};
+
+			// Sorted by bytes (descending)
+			std::vector<CallStack> call_stacks;
+			// Samples that are not kept because there are too many distinct stacks
+			uint64_t dropped_sample_count = 0;
+		};
+
+		static bool IsEnabled()
+		{
+			return _enabled.load(std::memory_order_relaxed);
+		}
+
+		static void SetEnabled(bool enabled);
+		// Clears the counters and the sampled call stacks
+		static void Reset();
+
+		// Must be called only if IsEnabled() is true (to avoid the call in the hot path)
+		static void Record(Reason reason, size_t bytes);
+
+		// <max_call_stack_count>: Maximum number of the call stacks to return
+		static Stats GetStats(size_t max_call_stack_count);
+
+		static const char *StringFromReason(Reason reason);
+
+	private:
+		static std::atomic<bool> _enabled;
+	};
+}  // namespace ov
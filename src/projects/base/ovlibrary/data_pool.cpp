@@ -0,0 +1,310 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "data_pool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+
+#include "./platform.h"
+
+namespace ov
+{
+	namespace
+	{
+		typedef std::vector<uint8_t> Buffer;
+
+		struct SizeClassInfo
+		{
+			size_t block_size;
+			// Maximum number of idle buffers per thread
+			size_t thread_cache_limit;
+			// Maximum number of idle buffers in the global pool of each NUMA node
+			size_t global_limit;
+		};
+
+		// 256B: RTCP/small packets, 1.5KB: RTP/TS packets (MTU), 8KB ~ 256KB: FLV tags/frames, 1MB: key frames
+		constexpr SizeClassInfo SizeClassInfoList[] = {
+			{256, 256, 4096},
+			{1536, 256, 4096},
+			{8 * 1024, 32, 512},
+			{64 * 1024, 4, 128},
+			{256 * 1024, 2, 32},
+			{1024 * 1024, 1, 16}};
+
+		constexpr size_t SizeClassCount = sizeof(SizeClassInfoList) / sizeof(SizeClassInfoList[0]);
+
+		// Idle buffers of a size class in a NUMA node
+		struct SizeClass
+		{
+			std::mutex mutex;
+			std::vector<Buffer *> free_list;
+		};
+
+		struct SizeClassStats
+		{
+			std::atomic<size_t> in_use_count{0};
+			std::atomic<size_t> pooled_count{0};
+			std::atomic<uint64_t> hit_count{0};
+			std::atomic<uint64_t> miss_count{0};
+		};
+
+		size_t GetNodeCount()
+		{
+			static const size_t node_count = std::max<size_t>(Platform::GetNumaNodeCount(), 1);
+			return node_count;
+		}
+
+		// Intentionally leaked to be available while static objects are destroyed
+		SizeClass *GetSizeClassList(size_t node)
+		{
+			static auto size_class_list = new SizeClass[GetNodeCount() * SizeClassCount];
+			return size_class_list + ((node % GetNodeCount()) * SizeClassCount);
+		}
+
+		SizeClassStats *GetSizeClassStatsList()
+		{
+			static auto size_class_stats_list = new SizeClassStats[SizeClassCount];
+			return size_class_stats_list;
+		}
+
+		void PushToGlobalPool(size_t node, size_t class_index, Buffer **buffers, size_t count)
+		{
+			auto &size_class = GetSizeClassList(node)[class_index];
+			auto limit = SizeClassInfoList[class_index].global_limit;
+			size_t index = 0;
+
+			{
+				std::lock_guard lock_guard(size_class.mutex);
+
+				for (; (index < count) && (size_class.free_list.size() < limit); index++)
+				{
+					size_class.free_list.push_back(buffers[index]);
+				}
+			}
+
+			// The global pool is full
+			for (size_t delete_index = index; delete_index < count; delete_index++)
+			{
+				delete buffers[delete_index];
+			}
+
+			GetSizeClassStatsList()[class_index].pooled_count -= (count - index);
+		}
+
+		// Set to true when the thread cache of the current thread is destroyed
+		thread_local bool tls_thread_cache_destroyed = false;
+
+		struct ThreadCache
+		{
+			// The node that the buffers in free_list were allocated on
+			size_t node = Platform::GetCurrentNumaNode();
+			std::vector<Buffer *> free_list[SizeClassCount];
+
+			// Returns the buffers to the global pool of the node
+			void Flush()
+			{
+				for (size_t class_index = 0; class_index < SizeClassCount; class_index++)
+				{
+					auto &list = free_list[class_index];
+					PushToGlobalPool(node, class_index, list.data(), list.size());
+					list.clear();
+				}
+			}
+
+			~ThreadCache()
+			{
+				Flush();
+
+				tls_thread_cache_destroyed = true;
+			}
+		};
+
+		ThreadCache *GetThreadCache()
+		{
+			if (tls_thread_cache_destroyed)
+			{
+				return nullptr;
+			}
+
+			thread_local ThreadCache thread_cache;
+			return &thread_cache;
+		}
+
+		int GetSizeClassIndex(size_t capacity)
+		{
+			for (size_t class_index = 0; class_index < SizeClassCount; class_index++)
+			{
+				if (capacity <= SizeClassInfoList[class_index].block_size)
+				{
+					return static_cast<int>(class_index);
+				}
+			}
+
+			return -1;
+		}
+
+		// <node> is set to the node that the buffer belongs to
+		Buffer *PopBuffer(size_t class_index, size_t *node)
+		{
+			auto thread_cache = GetThreadCache();
+
+			if (thread_cache != nullptr)
+			{
+				auto &list = thread_cache->free_list[class_index];
+
+				if (list.empty())
+				{
+					// The thread may have been moved to another node (e.g. pinned after the thread cache is created),
+					// so the node is checked only here to keep the fast path cheap
+					auto current_node = Platform::GetCurrentNumaNode();
+
+					if (current_node != thread_cache->node)
+					{
+						thread_cache->Flush();
+						thread_cache->node = current_node;
+					}
+
+					// Refill the thread cache from the global pool
+					auto &size_class = GetSizeClassList(current_node)[class_index];
+					auto refill_count = std::max<size_t>(SizeClassInfoList[class_index].thread_cache_limit / 2, 1);
+
+					std::lock_guard lock_guard(size_class.mutex);
+
+					while ((size_class.free_list.empty() == false) && (list.size() < refill_count))
+					{
+						list.push_back(size_class.free_list.back());
+						size_class.free_list.pop_back();
+					}
+				}
+
+				*node = thread_cache->node;
+
+				if (list.empty() == false)
+				{
+					auto buffer = list.back();
+					list.pop_back();
+					return buffer;
+				}
+
+				return nullptr;
+			}
+
+			*node = Platform::GetCurrentNumaNode();
+
+			auto &size_class = GetSizeClassList(*node)[class_index];
+			std::lock_guard lock_guard(size_class.mutex);
+
+			if (size_class.free_list.empty() == false)
+			{
+				auto buffer = size_class.free_list.back();
+				size_class.free_list.pop_back();
+				return buffer;
+			}
+
+			return nullptr;
+		}
+
+		void ReleaseBuffer(size_t node, size_t class_index, Buffer *buffer)
+		{
+			auto &size_class_stats = GetSizeClassStatsList()[class_index];
+			auto &size_class_info = SizeClassInfoList[class_index];
+
+			size_class_stats.in_use_count--;
+
+			if (buffer->capacity() > (size_class_info.block_size * 2))
+			{
+				// The buffer has grown too much to be reused in this size class
+				delete buffer;
+				return;
+			}
+
+			buffer->clear();
+			size_class_stats.pooled_count++;
+
+			auto thread_cache = GetThreadCache();
+
+			if ((thread_cache == nullptr) || (thread_cache->node != node))
+			{
+				// The buffer is returned to the node it was allocated on, so that the memory is reused by the threads of the node
+				PushToGlobalPool(node, class_index, &buffer, 1);
+				return;
+			}
+
+			auto &list = thread_cache->free_list[class_index];
+
+			if (list.size() >= size_class_info.thread_cache_limit)
+			{
+				// Move the older half to the global pool
+				auto count = std::max<size_t>(list.size() / 2, 1);
+				PushToGlobalPool(node, class_index, list.data(), count);
+				list.erase(list.begin(), list.begin() + count);
+			}
+
+			list.push_back(buffer);
+		}
+	}  // namespace
+
+	std::shared_ptr<std::vector<uint8_t>> DataPool::Allocate(size_t capacity)
+	{
+		auto class_index = GetSizeClassIndex(capacity);
+
+		if ((capacity == 0) || (class_index < 0))
+		{
+			// Not pooled
+			auto buffer = std::make_shared<Buffer>();
+			buffer->reserve(capacity);
+			return buffer;
+		}
+
+		auto &size_class_stats = GetSizeClassStatsList()[class_index];
+		size_t node = 0;
+		auto buffer = PopBuffer(class_index, &node);
+
+		if (buffer != nullptr)
+		{
+			size_class_stats.pooled_count--;
+			size_class_stats.hit_count++;
+		}
+		else
+		{
+			// The memory is placed on the current node when it is first touched
+			buffer = new Buffer();
+			buffer->reserve(SizeClassInfoList[class_index].block_size);
+			size_class_stats.miss_count++;
+		}
+
+		size_class_stats.in_use_count++;
+
+		return std::shared_ptr<Buffer>(buffer, [node, class_index](Buffer *buffer) {
+			ReleaseBuffer(node, class_index, buffer);
+		});
+	}
+
+	std::vector<DataPool::Stats> DataPool::GetStats()
+	{
+		std::vector<Stats> stats_list;
+		auto size_class_stats_list = GetSizeClassStatsList();
+
+		for (size_t class_index = 0; class_index < SizeClassCount; class_index++)
+		{
+			auto &size_class_stats = size_class_stats_list[class_index];
+			Stats stats;
+
+			stats.block_size = SizeClassInfoList[class_index].block_size;
+			stats.in_use_count = size_class_stats.in_use_count;
+			stats.pooled_count = size_class_stats.pooled_count;
+			stats.hit_count = size_class_stats.hit_count;
+			stats.miss_count = size_class_stats.miss_count;
+
+			stats_list.push_back(stats);
+		}
+
+		return stats_list;
+	}
+}  // namespace ov
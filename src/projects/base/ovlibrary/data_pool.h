@@ -0,0 +1,50 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace ov
+{
+	// Size-classed buffer pool for the backing buffer of ov::Data
+	//
+	// Each thread keeps a small cache of idle buffers per size class, and the buffers overflowed from
+	// the thread cache are kept in the global pool. A buffer is returned to the pool when the last
+	// ov::Data referencing it is released.
+	//
+	// The global pool is kept per NUMA node, and a buffer is always returned to the node it was allocated on,
+	// so the threads pinned to a node (See cfg::modules::NumaAffinity) reuse the memory of the node.
+	class DataPool
+	{
+	public:
+		struct Stats
+		{
+			// Capacity of the buffers in this size class
+			size_t block_size = 0;
+
+			// Number of buffers currently used by ov::Data
+			size_t in_use_count = 0;
+			// Number of idle buffers in the pool (including thread caches)
+			size_t pooled_count = 0;
+
+			// Number of allocations served from the pool
+			uint64_t hit_count = 0;
+			// Number of allocations that needed a new buffer
+			uint64_t miss_count = 0;
+		};
+
+		// Returns a buffer whose capacity is at least <capacity>.
+		// If <capacity> is larger than the largest size class, the buffer is not pooled.
+		static std::shared_ptr<std::vector<uint8_t>> Allocate(size_t capacity);
+
+		static std::vector<Stats> GetStats();
+	};
+}  // namespace ov
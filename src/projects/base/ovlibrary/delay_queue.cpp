@@ -17,12 +17,20 @@
 
 namespace ov
 {
+	namespace
+	{
+		int64_t GetNowMsec()
+		{
+			return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+		}
+	}  // namespace
+
 	DelayQueue::DelayQueue(const char *queue_name)
 		: _queue_name(queue_name),
 
-		  _index(0L),
+		  _stop(true),
 
-		  _stop(true)
+		  _wait_until_msec(INT64_MAX)
 	{
 	}
 
@@ -33,17 +41,18 @@ namespace ov
 
 	void DelayQueue::Push(const DelayQueueFunction &func, void *parameter, int after_msec)
 	{
-		std::lock_guard<std::mutex> lock(_mutex);
-
-		int64_t index = _index;
-		_index++;
-
 		logtd("Pushing new item: %p (after %d ms)", parameter, after_msec);
 
-		_queue.emplace(index, func, parameter, after_msec);
+		_timer_wheel.Schedule(after_msec, [func, parameter]() -> DelayQueueAction {
+			return func(parameter);
+		});
 
-		logtd("Notifying...");
-		_event.SetEvent();
+		// Repeated items and the items expiring later than the current wait do not need to wake up the thread
+		if ((GetNowMsec() + after_msec) < _wait_until_msec)
+		{
+			logtd("Notifying...");
+			_event.SetEvent();
+		}
 	}
 
 	void DelayQueue::Push(const DelayQueueFunction &func, int after_msec)
@@ -53,17 +62,12 @@ namespace ov
 
 	ssize_t DelayQueue::GetCount() const
 	{
-		std::lock_guard<std::mutex> lock(_mutex);
-
-		return _queue.size();
+		return _timer_wheel.GetCount();
 	}
 
 	void DelayQueue::Clear()
 	{
-		std::lock_guard<std::mutex> lock(_mutex);
-
-		// empty _queue
-		std::priority_queue<DelayQueueItem>().swap(_queue);
+		_timer_wheel.Clear();
 	}
 
 	bool DelayQueue::Start()
@@ -116,46 +120,16 @@ namespace ov
 	{
 		while (_stop == false)
 		{
-			if (_queue.empty())
-			{
-				logtd("Queue is empty. Waiting for new item...");
-
-				_event.Wait();
-
-				logtd("An item is pushed. Processing...");
-			}
-			else
-			{
-				// Handle the first enqueued item
-				auto first_item = _queue.top();
-
-				if (_event.Wait(first_item.time_point) == false)
-				{
-					// No other items pushed until waiting for first_item.time_point
-					DelayQueueAction action = first_item.function(first_item.parameter);
-
-					std::lock_guard<std::mutex> lock(_mutex);
-					// If we enter this step immediately after Clear(), there will be a problem
-					if (_queue.empty() == false)
-					{
-						_queue.pop();
-
-						if (action == DelayQueueAction::Repeat)
-						{
-							first_item.RecalculateTimePoint();
-							_queue.push(first_item);
-						}
-					}
-				}
-				else
-				{
-					// Another item was pushed while waiting for first_item.time_point
-
-					// Newly pushed items may be pointing to a time_point smaller than first_item.time_point,
-					// which needs to be recalculated
-					logtd("Another item is pushed while waiting the condition");
-				}
-			}
+			_timer_wheel.Advance();
+
+			// Push() called from now on wakes up the thread, since the time to wait is not decided yet
+			_wait_until_msec = INT64_MAX;
+
+			auto timeout_msec = _timer_wheel.GetNextTimeoutMsec();
+
+			_wait_until_msec = (timeout_msec == Infinite) ? (INT64_MAX - 1) : (GetNowMsec() + timeout_msec);
+
+			_event.Wait(timeout_msec);
 		}
 	}
-}  // namespace ov
\ No newline at end of file
+}  // namespace ov
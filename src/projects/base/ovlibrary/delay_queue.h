@@ -9,6 +9,7 @@
 #pragma once
 
 #include <algorithm>
+#include <atomic>
 #include <cstdio>
 #include <functional>
 #include <mutex>
@@ -18,18 +19,17 @@
 
 #include "./event.h"
 #include "./string.h"
+#include "./timer_wheel.h"
 
 namespace ov
 {
-	enum class DelayQueueAction : char
-	{
-		Stop,
-		Repeat
-	};
-
 	// Return false if need to stop when using repeat mode
 	typedef std::function<DelayQueueAction(void *parameter)> DelayQueueFunction;
 
+	// Runs the items on a dispatch thread after the delay.
+	//
+	// The items are kept in a TimerWheel, so pushing an item takes O(1), and the dispatch thread is woken up
+	// only if the new item expires before the time the thread is waiting for.
 	class DelayQueue
 	{
 	public:
@@ -45,58 +45,19 @@ namespace ov
 		bool Start();
 		bool Stop();
 
-	protected:
-		struct DelayQueueItem
-		{
-		public:
-			int64_t index;
-
-			DelayQueueFunction function;
-			void *parameter;
-
-			int after_msec;
-
-			std::chrono::time_point<std::chrono::system_clock> time_point;
-
-			DelayQueueItem(int64_t index, DelayQueueFunction function, void *parameter, int after_msec)
-				: index(index),
-
-				  function(std::move(function)),
-				  parameter(parameter),
-
-				  after_msec(after_msec)
-			{
-				RecalculateTimePoint();
-			}
-
-			void RecalculateTimePoint()
-			{
-				time_point = std::chrono::system_clock::now() + std::chrono::milliseconds(after_msec);
-			}
-
-			bool operator<(const DelayQueueItem &item) const
-			{
-				// item.interval has a high priority, followed by item.index
-				return (time_point == item.time_point) ? (index > item.index) : (time_point > item.time_point);
-			}
-		};
-
 	protected:
 		void DispatchThreadProc();
 
 		ov::String _queue_name;
 
-		int64_t _index;
-
 		std::thread _thread;
 		volatile bool _stop;
 
-		// A queue where the items to be executed are stored
-		mutable std::mutex _mutex;
-		std::priority_queue<DelayQueueItem> _queue;
+		TimerWheel _timer_wheel;
 
-		// If Push() is called while DelayQueue is waiting, the priority must be recalculated.
-		// _event is used to notice this.
+		// The time (steady clock, in milliseconds) until which the dispatch thread is waiting.
+		// INT64_MAX while the thread is calculating the time to wait.
+		std::atomic<int64_t> _wait_until_msec;
 		Event _event;
 	};
 }  // namespace ov
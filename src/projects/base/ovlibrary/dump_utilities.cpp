@@ -14,6 +14,10 @@
 #define __STDC_FORMAT_MACROS
 
 #include <cxxabi.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
 #include <cctype>
 #include <cinttypes>
@@ -243,4 +247,39 @@ namespace ov
 		return data;
 	}
 
+	std::shared_ptr<Data> MapFile(const char *file_name) noexcept
+	{
+		int fd = ::open(file_name, O_RDONLY | O_CLOEXEC);
+
+		if (fd < 0)
+		{
+			return nullptr;
+		}
+
+		struct stat file_stat;
+
+		if ((::fstat(fd, &file_stat) != 0) || (file_stat.st_size <= 0))
+		{
+			::close(fd);
+			return nullptr;
+		}
+
+		size_t length = static_cast<size_t>(file_stat.st_size);
+		void *address = ::mmap(nullptr, length, PROT_READ, MAP_SHARED, fd, 0);
+
+		// The mapping is valid after the file is closed
+		::close(fd);
+
+		if (address == MAP_FAILED)
+		{
+			return nullptr;
+		}
+
+		std::shared_ptr<const void> mapping(address, [length](const void *address) {
+			::munmap(const_cast<void *>(address), length);
+		});
+
+		return std::make_shared<Data>(address, length, mapping);
+	}
+
 }  // namespace ov
\ No newline at end of file
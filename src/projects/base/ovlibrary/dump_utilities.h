@@ -31,4 +31,7 @@ namespace ov
 	std::shared_ptr<FILE> DumpToFile(const char *file_name, const std::shared_ptr<const Data> &data, off_t offset = 0, bool append = false) noexcept;
 
 	std::shared_ptr<Data> LoadFromFile(const char *file_name) noexcept;
+	// Maps the file as read-only instead of reading it, so the pages are shared with the page cache (zero-copy).
+	// The mapping is kept until the data and its copies/subdata are released, even if the file is deleted.
+	std::shared_ptr<Data> MapFile(const char *file_name) noexcept;
 }
@@ -1,5 +1,7 @@
 #include "file.h"
 #include <dirent.h>
+#include <fcntl.h>
+#include <unistd.h>
 
 namespace ov
 {
@@ -24,4 +26,88 @@ namespace ov
 
 		return {true, file_list};
 	}
-}
\ No newline at end of file
+
+	std::shared_ptr<OpenedFile> OpenedFile::Open(const ov::String &path)
+	{
+		int fd = ::open(path.CStr(), O_RDONLY | O_CLOEXEC);
+
+		if (fd < 0)
+		{
+			return nullptr;
+		}
+
+		struct stat file_stat{};
+
+		if ((::fstat(fd, &file_stat) != 0) || (S_ISREG(file_stat.st_mode) == false))
+		{
+			::close(fd);
+			return nullptr;
+		}
+
+		return std::shared_ptr<OpenedFile>(new OpenedFile(fd, path, file_stat));
+	}
+
+	OpenedFile::OpenedFile(int fd, const ov::String &path, const struct stat &stat)
+		: _fd(fd),
+		  _path(path),
+		  _stat(stat)
+	{
+	}
+
+	OpenedFile::~OpenedFile()
+	{
+		if (_fd >= 0)
+		{
+			::close(_fd);
+		}
+	}
+
+	void OpenedFile::AdviseSequential() const
+	{
+		::posix_fadvise(_fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+	}
+
+	void OpenedFile::ReadAhead(off_t offset, size_t length) const
+	{
+		if (length > 0)
+		{
+			::posix_fadvise(_fd, offset, static_cast<off_t>(length), POSIX_FADV_WILLNEED);
+		}
+	}
+
+	std::shared_ptr<Data> OpenedFile::Read(off_t offset, size_t length) const
+	{
+		auto data = std::make_shared<Data>(length);
+		data->SetLength(length);
+
+		auto buffer = data->GetWritableDataAs<uint8_t>();
+		size_t read_bytes = 0;
+
+		while (read_bytes < length)
+		{
+			auto result = ::pread(_fd, buffer + read_bytes, length - read_bytes, offset + static_cast<off_t>(read_bytes));
+
+			if (result < 0)
+			{
+				if (errno == EINTR)
+				{
+					continue;
+				}
+
+				return nullptr;
+			}
+
+			if (result == 0)
+			{
+				// End of the file
+				break;
+			}
+
+			read_bytes += static_cast<size_t>(result);
+		}
+
+		data->SetLength(read_bytes);
+
+		return data;
+	}
+}
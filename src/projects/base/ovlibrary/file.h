@@ -7,6 +7,8 @@
 //
 //==============================================================================
 #pragma once
+#include <sys/stat.h>
+
 #include "ovlibrary.h"
 
 namespace ov
@@ -16,4 +18,51 @@ namespace ov
 	public:
 		static std::tuple<bool, std::vector<ov::String>> GetFileList(ov::String directory_path);
 	};
+
+	// A regular file opened for reading. The descriptor is closed when the last reference is released,
+	// so the file can be shared by the commands that send it (sendfile()) and outlive the request
+	class OpenedFile
+	{
+	public:
+		// Returns nullptr if <path> is not a regular file or could not be opened
+		static std::shared_ptr<OpenedFile> Open(const ov::String &path);
+
+		~OpenedFile();
+
+		int GetNativeHandle() const
+		{
+			return _fd;
+		}
+
+		const ov::String &GetPath() const
+		{
+			return _path;
+		}
+
+		// The attributes when the file is opened (the size of a file that is being written can be larger now)
+		const struct stat &GetStat() const
+		{
+			return _stat;
+		}
+
+		size_t GetSize() const
+		{
+			return static_cast<size_t>(_stat.st_size);
+		}
+
+		// Hints the kernel that the file is read sequentially (a larger readahead window)
+		void AdviseSequential() const;
+		// Starts reading the range into the page cache in the background, so the next read/sendfile() doesn't wait for the disk
+		void ReadAhead(off_t offset, size_t length) const;
+
+		// Returns nullptr if an error occurred, or the data can be shorter than <length> at the end of the file
+		std::shared_ptr<Data> Read(off_t offset, size_t length) const;
+
+	private:
+		OpenedFile(int fd, const ov::String &path, const struct stat &stat);
+
+		int _fd = -1;
+		ov::String _path;
+		struct stat _stat{};
+	};
 }
\ No newline at end of file
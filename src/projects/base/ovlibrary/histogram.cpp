@@ -0,0 +1,227 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "histogram.h"
+
+#include <algorithm>
+#include <cmath>
+#include <mutex>
+
+namespace ov
+{
+	// The list is created on first use, since the histograms are usually static objects of the other translation units
+	static std::mutex &GetHistogramListMutex()
+	{
+		static std::mutex mutex;
+		return mutex;
+	}
+
+	static std::vector<Histogram *> &GetHistogramList()
+	{
+		static std::vector<Histogram *> list;
+		return list;
+	}
+
+	Histogram::Histogram(const char *name, const char *help, double scale, uint64_t min_exported_value, uint64_t max_exported_value)
+		: _exported(true),
+		  _name(name),
+		  _help(help),
+		  _scale(scale),
+		  _min_exported_value(min_exported_value),
+		  _max_exported_value(max_exported_value),
+		  _shard_count(HISTOGRAM_SHARD_COUNT)
+	{
+		_shards = std::make_unique<Shard[]>(_shard_count);
+
+		std::lock_guard lock_guard(GetHistogramListMutex());
+		GetHistogramList().push_back(this);
+	}
+
+	Histogram::Histogram()
+	{
+		_shards = std::make_unique<Shard[]>(_shard_count);
+	}
+
+	Histogram::Histogram(size_t shard_count)
+		: _shard_count(std::clamp<size_t>(shard_count, 1, HISTOGRAM_SHARD_COUNT))
+	{
+		_shards = std::make_unique<Shard[]>(_shard_count);
+	}
+
+	Histogram::~Histogram()
+	{
+		if (_exported == false)
+		{
+			return;
+		}
+
+		std::lock_guard lock_guard(GetHistogramListMutex());
+		auto &list = GetHistogramList();
+		list.erase(std::remove(list.begin(), list.end(), this), list.end());
+	}
+
+	size_t Histogram::GetBucketIndex(uint64_t value)
+	{
+		constexpr uint64_t SUB_BUCKET_COUNT = (1 << HISTOGRAM_SUB_BUCKET_BITS);
+
+		if (value < SUB_BUCKET_COUNT)
+		{
+			return value;
+		}
+
+		int msb = 63 - __builtin_clzll(value);
+
+		if (msb >= HISTOGRAM_MAX_VALUE_BITS)
+		{
+			// Overflow
+			return BUCKET_COUNT - 1;
+		}
+
+		auto sub_bucket = (value >> (msb - HISTOGRAM_SUB_BUCKET_BITS)) & (SUB_BUCKET_COUNT - 1);
+
+		return ((msb - HISTOGRAM_SUB_BUCKET_BITS + 1) << HISTOGRAM_SUB_BUCKET_BITS) + sub_bucket;
+	}
+
+	uint64_t Histogram::GetBucketUpperBound(size_t index)
+	{
+		constexpr uint64_t SUB_BUCKET_COUNT = (1 << HISTOGRAM_SUB_BUCKET_BITS);
+
+		if (index < SUB_BUCKET_COUNT)
+		{
+			return index + 1;
+		}
+
+		auto group = index >> HISTOGRAM_SUB_BUCKET_BITS;
+		auto sub_bucket = index & (SUB_BUCKET_COUNT - 1);
+
+		return (SUB_BUCKET_COUNT + sub_bucket + 1) << (group - 1);
+	}
+
+	Histogram::Shard &Histogram::GetShard()
+	{
+		static std::atomic<uint32_t> next_shard_index{0};
+		static thread_local uint32_t shard_index = next_shard_index++ % HISTOGRAM_SHARD_COUNT;
+
+		return _shards[shard_index % _shard_count];
+	}
+
+	void Histogram::Record(uint64_t value)
+	{
+		auto &shard = GetShard();
+
+		shard.buckets[GetBucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+		shard.sum.fetch_add(value, std::memory_order_relaxed);
+	}
+
+	uint64_t Histogram::GetCount() const
+	{
+		uint64_t count = 0;
+
+		for (size_t index = 0; index < BUCKET_COUNT; index++)
+		{
+			for (size_t shard_index = 0; shard_index < _shard_count; shard_index++)
+			{
+				count += _shards[shard_index].buckets[index].load(std::memory_order_relaxed);
+			}
+		}
+
+		return count;
+	}
+
+	uint64_t Histogram::GetPercentile(double percentile) const
+	{
+		uint64_t counts[BUCKET_COUNT]{};
+		uint64_t total_count = 0;
+
+		for (size_t index = 0; index < BUCKET_COUNT; index++)
+		{
+			for (size_t shard_index = 0; shard_index < _shard_count; shard_index++)
+			{
+				counts[index] += _shards[shard_index].buckets[index].load(std::memory_order_relaxed);
+			}
+
+			total_count += counts[index];
+		}
+
+		if (total_count == 0)
+		{
+			return 0;
+		}
+
+		auto target_count = static_cast<uint64_t>(std::ceil(total_count * std::clamp(percentile, 0.0, 100.0) / 100.0));
+		uint64_t count = 0;
+
+		for (size_t index = 0; index < (BUCKET_COUNT - 1); index++)
+		{
+			count += counts[index];
+
+			if ((count >= target_count) && (count > 0))
+			{
+				return GetBucketUpperBound(index);
+			}
+		}
+
+		// Overflow
+		return (1ULL << HISTOGRAM_MAX_VALUE_BITS);
+	}
+
+	const ov::String &Histogram::GetName() const
+	{
+		return _name;
+	}
+
+	const ov::String &Histogram::GetHelp() const
+	{
+		return _help;
+	}
+
+	Histogram::Snapshot Histogram::GetSnapshot() const
+	{
+		Snapshot snapshot;
+		uint64_t sum = 0;
+
+		for (size_t shard_index = 0; shard_index < _shard_count; shard_index++)
+		{
+			sum += _shards[shard_index].sum.load(std::memory_order_relaxed);
+		}
+
+		for (size_t index = 0; index < BUCKET_COUNT; index++)
+		{
+			for (size_t shard_index = 0; shard_index < _shard_count; shard_index++)
+			{
+				snapshot.count += _shards[shard_index].buckets[index].load(std::memory_order_relaxed);
+			}
+
+			if (index == (BUCKET_COUNT - 1))
+			{
+				// The overflow bucket is exported as +Inf
+				break;
+			}
+
+			auto upper_bound = GetBucketUpperBound(index);
+
+			if ((upper_bound >= _min_exported_value) && (upper_bound <= _max_exported_value))
+			{
+				snapshot.buckets.push_back({upper_bound * _scale, snapshot.count});
+			}
+		}
+
+		snapshot.sum = sum * _scale;
+
+		return snapshot;
+	}
+
+	void Histogram::ForEach(const std::function<void(const Histogram &histogram)> &func)
+	{
+		std::lock_guard lock_guard(GetHistogramListMutex());
+
+		for (auto histogram : GetHistogramList())
+		{
+			func(*histogram);
+		}
+	}
+}  // namespace ov
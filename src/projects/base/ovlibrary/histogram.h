@@ -0,0 +1,99 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "string.h"
+
+// A power of two is divided into 2^N sub-buckets (the error of a bucket is less than 1/2^N)
+#define HISTOGRAM_SUB_BUCKET_BITS		2
+// Values greater than or equal to 2^N are counted in the overflow bucket
+#define HISTOGRAM_MAX_VALUE_BITS		40
+// The buckets are split into this number of shards, and the threads record to different shards
+#define HISTOGRAM_SHARD_COUNT			16
+
+namespace ov
+{
+	// A histogram of log-linear buckets (HDR style), which can be recorded from any thread without lock.
+	//
+	// Histograms are registered when they are created, so they are usually created as static objects of the module
+	// that records them, and the exporter (e.g. /metrics of API server) finds them with ForEach().
+	class Histogram
+	{
+	public:
+		struct Bucket
+		{
+			// The values less than or equal to <upper_bound> (scaled)
+			double upper_bound;
+			// Cumulative count
+			uint64_t count;
+		};
+
+		struct Snapshot
+		{
+			std::vector<Bucket> buckets;
+			uint64_t count = 0;
+			// Scaled
+			double sum = 0.0;
+		};
+
+		// name, help: The name/description of the metric (e.g. ome_managed_queue_waiting_seconds)
+		// scale: The recorded values are multiplied by it when they are exported (e.g. 0.000001 to export microseconds as seconds)
+		// min_exported_value, max_exported_value: The range of the buckets to export (not scaled)
+		Histogram(const char *name, const char *help, double scale, uint64_t min_exported_value, uint64_t max_exported_value);
+		// A histogram which is not exported (e.g. a metric of a stream).
+		// It has only one shard, so it is for the values recorded at a low rate.
+		Histogram();
+		// A histogram which is not exported, with <shard_count> shards for the values recorded at a high rate from many threads
+		explicit Histogram(size_t shard_count);
+		~Histogram();
+
+		void Record(uint64_t value);
+
+		uint64_t GetCount() const;
+		// Returns the upper bound of the bucket that contains the <percentile> (0.0 ~ 100.0) of the values (not scaled),
+		// or 0 if there is no value
+		uint64_t GetPercentile(double percentile) const;
+
+		const ov::String &GetName() const;
+		const ov::String &GetHelp() const;
+
+		Snapshot GetSnapshot() const;
+
+		static void ForEach(const std::function<void(const Histogram &histogram)> &func);
+
+	protected:
+		static constexpr size_t BUCKET_COUNT = ((HISTOGRAM_MAX_VALUE_BITS - HISTOGRAM_SUB_BUCKET_BITS + 1) << HISTOGRAM_SUB_BUCKET_BITS) + 1;
+
+		static size_t GetBucketIndex(uint64_t value);
+		// The values of the bucket are less than the returned value
+		static uint64_t GetBucketUpperBound(size_t index);
+
+		struct alignas(64) Shard
+		{
+			std::atomic<uint64_t> buckets[BUCKET_COUNT]{};
+			std::atomic<uint64_t> sum{0};
+		};
+
+		Shard &GetShard();
+
+		bool _exported = false;
+		ov::String _name;
+		ov::String _help;
+		double _scale = 1.0;
+		uint64_t _min_exported_value = 0;
+		uint64_t _max_exported_value = 0;
+
+		size_t _shard_count = 1;
+		std::unique_ptr<Shard[]> _shards;
+	};
+}  // namespace ov
@@ -0,0 +1,126 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "./interned_string.h"
+
+#include <mutex>
+#include <string_view>
+#include <unordered_map>
+
+namespace ov
+{
+	namespace
+	{
+		struct InternTable
+		{
+			struct Entry
+			{
+				// To check whether the entry is replaced while the string is being deleted
+				const String *string;
+				std::weak_ptr<const String> weak_string;
+			};
+
+			std::mutex mutex;
+			// key: a view of the buffer of Entry::string
+			std::unordered_map<std::string_view, Entry> entries;
+		};
+
+		InternTable &GetTable()
+		{
+			// Never deleted, since InternedStrings of static objects can be destroyed after the table
+			static auto table = new InternTable();
+			return *table;
+		}
+
+		std::string_view ToView(const String &string)
+		{
+			return std::string_view(string.CStr(), string.GetLength());
+		}
+
+		void Unintern(const String *string)
+		{
+			auto &table = GetTable();
+
+			{
+				std::lock_guard<std::mutex> lock(table.mutex);
+
+				auto item = table.entries.find(ToView(*string));
+
+				// The entry may be replaced by the same content while waiting for the lock
+				if ((item != table.entries.end()) && (item->second.string == string))
+				{
+					table.entries.erase(item);
+				}
+			}
+
+			delete string;
+		}
+
+		std::shared_ptr<const String> Intern(const char *string, size_t length)
+		{
+			if (length == 0)
+			{
+				return nullptr;
+			}
+
+			auto &table = GetTable();
+			std::lock_guard<std::mutex> lock(table.mutex);
+
+			auto item = table.entries.find(std::string_view(string, length));
+
+			if (item != table.entries.end())
+			{
+				auto shared_string = item->second.weak_string.lock();
+
+				if (shared_string != nullptr)
+				{
+					return shared_string;
+				}
+
+				// The string is being deleted - the key must not refer to it any longer
+				table.entries.erase(item);
+			}
+
+			std::shared_ptr<const String> shared_string(new String(string, length), Unintern);
+			table.entries.emplace(ToView(*shared_string), InternTable::Entry{shared_string.get(), shared_string});
+
+			return shared_string;
+		}
+	}  // namespace
+
+	InternedString::InternedString(const String &string)
+		: _string(Intern(string.CStr(), string.GetLength()))
+	{
+	}
+
+	InternedString::InternedString(const char *string)
+		: _string(Intern(string, (string == nullptr) ? 0 : ::strlen(string)))
+	{
+	}
+
+	const String &InternedString::ToString() const noexcept
+	{
+		static const String empty_string;
+
+		return (_string != nullptr) ? *_string : empty_string;
+	}
+
+	const char *InternedString::CStr() const noexcept
+	{
+		return ToString().CStr();
+	}
+
+	size_t InternedString::GetLength() const noexcept
+	{
+		return ToString().GetLength();
+	}
+
+	bool InternedString::IsEmpty() const noexcept
+	{
+		return _string == nullptr;
+	}
+}  // namespace ov
@@ -0,0 +1,69 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include "./string.h"
+
+namespace ov
+{
+	// A string that shares one instance with every other InternedString of the same content.
+	//
+	// Identifiers such as vhost/app/stream names are copied into many objects and compared frequently.
+	// Since the same content always refers to the same instance while it is alive, InternedString is
+	// copied by a reference count, and compared/hashed by the address of the instance instead of the bytes.
+	//
+	// Interning takes a global lock, so create it once (when a name is determined), not per lookup.
+	class InternedString
+	{
+	public:
+		InternedString() = default;
+		InternedString(const String &string);  // NOLINT
+		InternedString(const char *string);	   // NOLINT
+
+		const String &ToString() const noexcept;
+		const char *CStr() const noexcept;
+		size_t GetLength() const noexcept;
+		bool IsEmpty() const noexcept;
+
+		operator const String &() const noexcept  // NOLINT
+		{
+			return ToString();
+		}
+
+		bool operator==(const InternedString &other) const noexcept
+		{
+			return _string == other._string;
+		}
+
+		bool operator!=(const InternedString &other) const noexcept
+		{
+			return _string != other._string;
+		}
+
+		std::size_t Hash() const noexcept
+		{
+			return std::hash<const String *>()(_string.get());
+		}
+
+	protected:
+		// nullptr if the string is empty
+		std::shared_ptr<const String> _string;
+	};
+}  // namespace ov
+
+namespace std
+{
+	template <>
+	struct hash<ov::InternedString>
+	{
+		std::size_t operator()(ov::InternedString const &str) const
+		{
+			return str.Hash();
+		}
+	};
+}  // namespace std
@@ -0,0 +1,313 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "./json_writer.h"
+
+#include <cinttypes>
+#include <cmath>
+
+#include "./assert.h"
+
+namespace ov
+{
+	JsonWriter::JsonWriter(size_t capacity)
+	{
+		_buffer.SetCapacity(capacity);
+	}
+
+	void JsonWriter::BeginValue()
+	{
+		if (_is_key_written)
+		{
+			// The comma is written by Key()
+			_is_key_written = false;
+			return;
+		}
+
+		if (_has_item_stack.empty())
+		{
+			return;
+		}
+
+		if (_has_item_stack.back())
+		{
+			_buffer.Append(',');
+		}
+		else
+		{
+			_has_item_stack.back() = true;
+		}
+	}
+
+	JsonWriter &JsonWriter::BeginObject()
+	{
+		BeginValue();
+
+		_buffer.Append('{');
+		_has_item_stack.push_back(false);
+
+		return *this;
+	}
+
+	JsonWriter &JsonWriter::BeginObject(const char *key)
+	{
+		return Key(key).BeginObject();
+	}
+
+	JsonWriter &JsonWriter::EndObject()
+	{
+		OV_ASSERT2(_has_item_stack.empty() == false);
+
+		_buffer.Append('}');
+		_has_item_stack.pop_back();
+
+		return *this;
+	}
+
+	JsonWriter &JsonWriter::BeginArray()
+	{
+		BeginValue();
+
+		_buffer.Append('[');
+		_has_item_stack.push_back(false);
+
+		return *this;
+	}
+
+	JsonWriter &JsonWriter::BeginArray(const char *key)
+	{
+		return Key(key).BeginArray();
+	}
+
+	JsonWriter &JsonWriter::EndArray()
+	{
+		OV_ASSERT2(_has_item_stack.empty() == false);
+
+		_buffer.Append(']');
+		_has_item_stack.pop_back();
+
+		return *this;
+	}
+
+	JsonWriter &JsonWriter::Key(const char *key)
+	{
+		OV_ASSERT2(_is_key_written == false);
+
+		BeginValue();
+
+		WriteEscapedString(key, ::strlen(key));
+		_buffer.Append(':');
+
+		_is_key_written = true;
+
+		return *this;
+	}
+
+	JsonWriter &JsonWriter::Null()
+	{
+		BeginValue();
+		_buffer.Append("null", 4);
+
+		return *this;
+	}
+
+	JsonWriter &JsonWriter::String(const char *value)
+	{
+		if (value == nullptr)
+		{
+			return Null();
+		}
+
+		BeginValue();
+		WriteEscapedString(value, ::strlen(value));
+
+		return *this;
+	}
+
+	JsonWriter &JsonWriter::String(const ov::String &value)
+	{
+		BeginValue();
+		WriteEscapedString(value.CStr(), value.GetLength());
+
+		return *this;
+	}
+
+	JsonWriter &JsonWriter::Int(int32_t value)
+	{
+		BeginValue();
+		_buffer.AppendFormat("%" PRId32, value);
+
+		return *this;
+	}
+
+	JsonWriter &JsonWriter::Int64(int64_t value)
+	{
+		BeginValue();
+		_buffer.AppendFormat("%" PRId64, value);
+
+		return *this;
+	}
+
+	JsonWriter &JsonWriter::UInt64(uint64_t value)
+	{
+		BeginValue();
+		_buffer.AppendFormat("%" PRIu64, value);
+
+		return *this;
+	}
+
+	JsonWriter &JsonWriter::Double(double value)
+	{
+		if (std::isfinite(value) == false)
+		{
+			return Null();
+		}
+
+		BeginValue();
+		// Same precision as Json::StreamWriterBuilder
+		_buffer.AppendFormat("%.17g", value);
+
+		return *this;
+	}
+
+	JsonWriter &JsonWriter::Bool(bool value)
+	{
+		BeginValue();
+		value ? _buffer.Append("true", 4) : _buffer.Append("false", 5);
+
+		return *this;
+	}
+
+	JsonWriter &JsonWriter::Value(const ::Json::Value &value)
+	{
+		switch (value.type())
+		{
+			case ::Json::ValueType::nullValue:
+				return Null();
+
+			case ::Json::ValueType::intValue:
+				return Int64(value.asInt64());
+
+			case ::Json::ValueType::uintValue:
+				return UInt64(value.asUInt64());
+
+			case ::Json::ValueType::realValue:
+				return Double(value.asDouble());
+
+			case ::Json::ValueType::stringValue: {
+				const char *begin = nullptr;
+				const char *end = nullptr;
+				value.getString(&begin, &end);
+
+				BeginValue();
+				WriteEscapedString(begin, end - begin);
+
+				return *this;
+			}
+
+			case ::Json::ValueType::booleanValue:
+				return Bool(value.asBool());
+
+			case ::Json::ValueType::arrayValue:
+				BeginArray();
+
+				for (const auto &item : value)
+				{
+					Value(item);
+				}
+
+				return EndArray();
+
+			case ::Json::ValueType::objectValue:
+				BeginObject();
+
+				for (auto item = value.begin(); item != value.end(); ++item)
+				{
+					Key(item.name().c_str());
+					Value(*item);
+				}
+
+				return EndObject();
+		}
+
+		return *this;
+	}
+
+	JsonWriter &JsonWriter::Raw(const ov::String &json)
+	{
+		BeginValue();
+		_buffer.Append(json.CStr(), json.GetLength());
+
+		return *this;
+	}
+
+	void JsonWriter::WriteEscapedString(const char *value, size_t length)
+	{
+		static constexpr char HEX[] = "0123456789abcdef";
+
+		_buffer.Append('"');
+
+		auto current = value;
+		auto end = value + length;
+		// Appends the characters that don't need to be escaped at once
+		auto unescaped = current;
+
+		for (; current < end; current++)
+		{
+			auto c = static_cast<uint8_t>(*current);
+			char escaped = 0;
+
+			switch (c)
+			{
+				case '"':
+					escaped = '"';
+					break;
+				case '\\':
+					escaped = '\\';
+					break;
+				case '\b':
+					escaped = 'b';
+					break;
+				case '\f':
+					escaped = 'f';
+					break;
+				case '\n':
+					escaped = 'n';
+					break;
+				case '\r':
+					escaped = 'r';
+					break;
+				case '\t':
+					escaped = 't';
+					break;
+				default:
+					if (c >= 0x20)
+					{
+						continue;
+					}
+					break;
+			}
+
+			_buffer.Append(unescaped, current - unescaped);
+			unescaped = current + 1;
+
+			if (escaped != 0)
+			{
+				char sequence[2] = {'\\', escaped};
+				_buffer.Append(sequence, 2);
+			}
+			else
+			{
+				char sequence[6] = {'\\', 'u', '0', '0', HEX[c >> 4], HEX[c & 0x0F]};
+				_buffer.Append(sequence, 6);
+			}
+		}
+
+		_buffer.Append(unescaped, current - unescaped);
+		_buffer.Append('"');
+	}
+}  // namespace ov
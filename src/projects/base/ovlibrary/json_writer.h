@@ -0,0 +1,117 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <jsoncpp-1.9.3/json/json.h>
+
+#include <vector>
+
+#include "./string.h"
+
+namespace ov
+{
+	// Writes JSON into a growing buffer directly, without building a tree of Json::Value.
+	//
+	// A value in an object must be preceded by Key() (or use the overloads with <key>), and a value in an array must not.
+	//
+	// ov::JsonWriter writer;
+	// writer.BeginObject();
+	// writer.Write("name", "stream");
+	// writer.BeginArray("tracks");
+	// writer.Int(1).Int(2);
+	// writer.EndArray();
+	// writer.EndObject();
+	// => {"name":"stream","tracks":[1,2]}
+	class JsonWriter
+	{
+	public:
+		explicit JsonWriter(size_t capacity = 4096);
+
+		JsonWriter &BeginObject();
+		JsonWriter &BeginObject(const char *key);
+		JsonWriter &EndObject();
+
+		JsonWriter &BeginArray();
+		JsonWriter &BeginArray(const char *key);
+		JsonWriter &EndArray();
+
+		JsonWriter &Key(const char *key);
+
+		JsonWriter &Null();
+		JsonWriter &String(const char *value);
+		JsonWriter &String(const ov::String &value);
+		JsonWriter &Int(int32_t value);
+		JsonWriter &Int64(int64_t value);
+		JsonWriter &UInt64(uint64_t value);
+		// NaN/Infinity are written as null
+		JsonWriter &Double(double value);
+		JsonWriter &Bool(bool value);
+		// Writes the tree as it is (for the values that are already made as Json::Value)
+		JsonWriter &Value(const ::Json::Value &value);
+		// Writes a value that is already serialized as JSON
+		JsonWriter &Raw(const ov::String &json);
+
+		template <typename Tvalue>
+		JsonWriter &Write(const char *key, const Tvalue &value)
+		{
+			Key(key);
+
+			if constexpr (std::is_same_v<Tvalue, bool>)
+			{
+				return Bool(value);
+			}
+			else if constexpr (std::is_floating_point_v<Tvalue>)
+			{
+				return Double(value);
+			}
+			else if constexpr (std::is_integral_v<Tvalue> && std::is_signed_v<Tvalue> && (sizeof(Tvalue) <= sizeof(int32_t)))
+			{
+				return Int(value);
+			}
+			else if constexpr (std::is_integral_v<Tvalue> && std::is_signed_v<Tvalue>)
+			{
+				return Int64(value);
+			}
+			else if constexpr (std::is_integral_v<Tvalue>)
+			{
+				return UInt64(value);
+			}
+			else if constexpr (std::is_same_v<Tvalue, ::Json::Value>)
+			{
+				return Value(value);
+			}
+			else
+			{
+				return String(value);
+			}
+		}
+
+		const ov::String &GetString() const
+		{
+			return _buffer;
+		}
+
+		// Whether all objects/arrays are closed
+		bool IsCompleted() const
+		{
+			return _has_item_stack.empty() && (_buffer.IsEmpty() == false);
+		}
+
+	protected:
+		// Writes a comma if the value is not the first one of the object/array
+		void BeginValue();
+		void WriteEscapedString(const char *value, size_t length);
+
+		ov::String _buffer;
+
+		// Whether the object/array of each depth has an item
+		std::vector<bool> _has_item_stack;
+		// Key() is called, and the value is expected
+		bool _is_key_written = false;
+	};
+}  // namespace ov
@@ -0,0 +1,93 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "lock_profiler.h"
+
+#include <algorithm>
+#include <map>
+#include <memory>
+
+namespace ov
+{
+	// The sites are created on first use, since the locks are usually members of the objects created anywhere
+	static std::mutex &GetSiteMapMutex()
+	{
+		static std::mutex mutex;
+		return mutex;
+	}
+
+	static std::map<String, std::unique_ptr<LockProfiler::Site>> &GetSiteMap()
+	{
+		static std::map<String, std::unique_ptr<LockProfiler::Site>> site_map;
+		return site_map;
+	}
+
+	LockProfiler::Site::Site(const char *name)
+		: name(name),
+		  wait_histogram(HISTOGRAM_SHARD_COUNT),
+		  hold_histogram(HISTOGRAM_SHARD_COUNT)
+	{
+	}
+
+	LockProfiler::Site *LockProfiler::GetSite(const char *name)
+	{
+		std::lock_guard lock_guard(GetSiteMapMutex());
+
+		auto &site = GetSiteMap()[name];
+
+		if (site == nullptr)
+		{
+			site = std::make_unique<Site>(name);
+		}
+
+		return site.get();
+	}
+
+	std::vector<LockProfiler::Stats> LockProfiler::GetTopContendedLocks(size_t count)
+	{
+		std::vector<Stats> stats_list;
+
+		{
+			std::lock_guard lock_guard(GetSiteMapMutex());
+
+			for (auto &[name, site] : GetSiteMap())
+			{
+				Stats stats;
+
+				auto wait_snapshot = site->wait_histogram.GetSnapshot();
+				auto hold_snapshot = site->hold_histogram.GetSnapshot();
+
+				stats.name = name;
+
+				stats.lock_count = wait_snapshot.count;
+				stats.contended_count = site->contended_count.load(std::memory_order_relaxed);
+
+				stats.total_wait_ns = static_cast<uint64_t>(wait_snapshot.sum);
+				stats.wait_p50_ns = site->wait_histogram.GetPercentile(50.0);
+				stats.wait_p99_ns = site->wait_histogram.GetPercentile(99.0);
+				stats.wait_max_ns = site->wait_histogram.GetPercentile(100.0);
+
+				stats.total_hold_ns = static_cast<uint64_t>(hold_snapshot.sum);
+				stats.hold_p50_ns = site->hold_histogram.GetPercentile(50.0);
+				stats.hold_p99_ns = site->hold_histogram.GetPercentile(99.0);
+
+				stats_list.push_back(std::move(stats));
+			}
+		}
+
+		std::sort(stats_list.begin(), stats_list.end(), [](const Stats &a, const Stats &b) {
+			return a.total_wait_ns > b.total_wait_ns;
+		});
+
+		if (stats_list.size() > count)
+		{
+			stats_list.resize(count);
+		}
+
+		return stats_list;
+	}
+}  // namespace ov
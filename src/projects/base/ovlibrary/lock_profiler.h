@@ -0,0 +1,220 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <chrono>
+#include <mutex>
+#include <shared_mutex>
+#include <vector>
+
+#include "./histogram.h"
+#include "./string.h"
+
+// Set to 1 to measure the wait/hold time of the profiled locks (ov::ProfiledMutex, ...).
+// If 0, the profiled locks are the wrappers of the standard mutexes which are inlined away
+#ifndef OV_LOCK_PROFILER
+#	define OV_LOCK_PROFILER 0
+#endif	// OV_LOCK_PROFILER
+
+namespace ov
+{
+	// Collects the wait/hold time of the locks by name. The locks of the same name (e.g. _streams_lock of all applications)
+	// share the same statistics.
+	class LockProfiler
+	{
+	public:
+		struct Site
+		{
+			Site(const char *name);
+
+			String name;
+
+			// Nanoseconds waited to acquire the lock (0 if it is acquired without waiting)
+			Histogram wait_histogram;
+			// Nanoseconds the lock is held exclusively (the hold time of the shared locks is not measured)
+			Histogram hold_histogram;
+
+			std::atomic<uint64_t> contended_count{0};
+		};
+
+		struct Stats
+		{
+			String name;
+
+			uint64_t lock_count = 0;
+			uint64_t contended_count = 0;
+
+			uint64_t total_wait_ns = 0;
+			uint64_t wait_p50_ns = 0;
+			uint64_t wait_p99_ns = 0;
+			// The upper bound of the bucket of the longest wait
+			uint64_t wait_max_ns = 0;
+
+			uint64_t total_hold_ns = 0;
+			uint64_t hold_p50_ns = 0;
+			uint64_t hold_p99_ns = 0;
+		};
+
+		static constexpr bool IsAvailable()
+		{
+			return OV_LOCK_PROFILER;
+		}
+
+		// Returns the site of <name>, which is valid until the process ends
+		static Site *GetSite(const char *name);
+
+		// Returns up to <count> locks that are waited for the longest time (total)
+		static std::vector<Stats> GetTopContendedLocks(size_t count);
+
+		static uint64_t GetTimestampNs()
+		{
+			return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+		}
+	};
+
+#if OV_LOCK_PROFILER
+	// A mutex that records the time to acquire it and the time it is held into the site of its name.
+	// It meets the requirements of Lockable (and SharedLockable if Tmutex is std::shared_mutex),
+	// so it can be used with std::lock_guard/std::unique_lock/std::shared_lock, but not with std::condition_variable.
+	template <typename Tmutex>
+	class ProfiledMutexT
+	{
+	public:
+		explicit ProfiledMutexT(const char *name)
+			: _site(LockProfiler::GetSite(name))
+		{
+		}
+
+		void lock()
+		{
+			if (_mutex.try_lock())
+			{
+				_site->wait_histogram.Record(0);
+			}
+			else
+			{
+				auto start = LockProfiler::GetTimestampNs();
+				_mutex.lock();
+
+				_site->wait_histogram.Record(LockProfiler::GetTimestampNs() - start);
+				_site->contended_count.fetch_add(1, std::memory_order_relaxed);
+			}
+
+			// Only the outermost lock of a recursive mutex is measured
+			if (_depth++ == 0)
+			{
+				_hold_start = LockProfiler::GetTimestampNs();
+			}
+		}
+
+		bool try_lock()
+		{
+			if (_mutex.try_lock() == false)
+			{
+				return false;
+			}
+
+			if (_depth++ == 0)
+			{
+				_hold_start = LockProfiler::GetTimestampNs();
+			}
+
+			return true;
+		}
+
+		void unlock()
+		{
+			if (--_depth == 0)
+			{
+				_site->hold_histogram.Record(LockProfiler::GetTimestampNs() - _hold_start);
+			}
+
+			_mutex.unlock();
+		}
+
+		void lock_shared()
+		{
+			if (_mutex.try_lock_shared())
+			{
+				_site->wait_histogram.Record(0);
+				return;
+			}
+
+			auto start = LockProfiler::GetTimestampNs();
+			_mutex.lock_shared();
+
+			_site->wait_histogram.Record(LockProfiler::GetTimestampNs() - start);
+			_site->contended_count.fetch_add(1, std::memory_order_relaxed);
+		}
+
+		bool try_lock_shared()
+		{
+			return _mutex.try_lock_shared();
+		}
+
+		void unlock_shared()
+		{
+			_mutex.unlock_shared();
+		}
+
+	private:
+		Tmutex _mutex;
+		LockProfiler::Site *_site;
+
+		// Protected by _mutex
+		int _depth = 0;
+		uint64_t _hold_start = 0;
+	};
+#else	// OV_LOCK_PROFILER
+	template <typename Tmutex>
+	class ProfiledMutexT
+	{
+	public:
+		explicit ProfiledMutexT(const char *name)
+		{
+		}
+
+		void lock()
+		{
+			_mutex.lock();
+		}
+
+		bool try_lock()
+		{
+			return _mutex.try_lock();
+		}
+
+		void unlock()
+		{
+			_mutex.unlock();
+		}
+
+		void lock_shared()
+		{
+			_mutex.lock_shared();
+		}
+
+		bool try_lock_shared()
+		{
+			return _mutex.try_lock_shared();
+		}
+
+		void unlock_shared()
+		{
+			_mutex.unlock_shared();
+		}
+
+	private:
+		Tmutex _mutex;
+	};
+#endif	// OV_LOCK_PROFILER
+
+	using ProfiledMutex = ProfiledMutexT<std::mutex>;
+	using ProfiledRecursiveMutex = ProfiledMutexT<std::recursive_mutex>;
+	using ProfiledSharedMutex = ProfiledMutexT<std::shared_mutex>;
+}  // namespace ov
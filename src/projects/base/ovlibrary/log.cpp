@@ -26,21 +26,42 @@ static ov::LogInternal g_stat_hrs_log_internal(OV_STAT_HRS_LOG_FILE);
 static ov::LogInternal g_stat_hrr_log_internal(OV_STAT_HRR_LOG_FILE);
 static ov::LogInternal g_stat_hrv_log_internal(OV_STAT_HRV_LOG_FILE);
 
+namespace ov
+{
+	std::atomic<uint32_t> log_rule_generation{1};
+
+	bool LogCallSite::Resolve(const char *tag, OVLogLevel level)
+	{
+		// If the rules are changed while resolving, it is resolved again at the next call
+		auto generation = log_rule_generation.load(std::memory_order_acquire);
+		bool is_enabled = (level >= g_log_internal.GetLogLevel()) && g_log_internal.IsEnabled(tag, level);
+
+		_state.store((generation << 1) | (is_enabled ? 1 : 0), std::memory_order_relaxed);
+
+		return is_enabled;
+	}
+}  // namespace ov
+
 // log level 지정
 void ov_log_set_level(OVLogLevel level)
 {
 	g_log_internal.SetLogLevel(level);
+	ov::log_rule_generation++;
 }
 
 void ov_log_reset_enable()
 {
 	g_log_internal.ResetEnable();
+	ov::log_rule_generation++;
 }
 
 // tag는 정규식 사용 가능, 정규식에 대해서는 http://www.cplusplus.com/reference/regex/ECMAScript 참고
 bool ov_log_set_enable(const char *tag_regex, OVLogLevel level, bool is_enabled)
 {
-	return g_log_internal.SetEnable(tag_regex, level, is_enabled);
+	auto result = g_log_internal.SetEnable(tag_regex, level, is_enabled);
+	ov::log_rule_generation++;
+
+	return result;
 }
 
 bool ov_log_get_enabled(const char *tag, OVLogLevel level)
@@ -61,11 +61,19 @@ typedef enum StatLogType
 	STAT_LOG_HLS_EDGE_VIEWERS
 } StatLogType;
 
+// Each call site caches whether its tag/level is enabled, until the rules are changed (see ov::LogCallSite)
+#define OV_LOG_IS_ENABLED(tag, level)                                           \
+	([]() -> ::ov::LogCallSite & {                                              \
+		static ::ov::LogCallSite call_site;                                     \
+		return call_site;                                                       \
+	}()                                                                         \
+		 .IsEnabled(tag, level))
+
 #if DEBUG
 #	define logd(tag, format, ...)                                                                                     \
 		do                                                                                                             \
 		{                                                                                                              \
-			if (ov_log_get_enabled(tag, OVLogLevelDebug))                                                              \
+			if (OV_LOG_IS_ENABLED(tag, OVLogLevelDebug))                                                               \
 			{                                                                                                          \
 				ov_log_internal(OVLogLevelDebug, tag, __FILE__, __LINE__, __PRETTY_FUNCTION__, format, ##__VA_ARGS__); \
 			}                                                                                                          \
@@ -79,10 +87,11 @@ typedef enum StatLogType
 //--------------------------------------------------------------------
 // Logging APIs
 //--------------------------------------------------------------------
-#define logi(tag, format, ...)                        ov_log_internal(OVLogLevelInformation,    tag, __FILE__, __LINE__, __PRETTY_FUNCTION__, format, ## __VA_ARGS__)
-#define logw(tag, format, ...)                        ov_log_internal(OVLogLevelWarning,        tag, __FILE__, __LINE__, __PRETTY_FUNCTION__, format, ## __VA_ARGS__)
-#define loge(tag, format, ...)                        ov_log_internal(OVLogLevelError,          tag, __FILE__, __LINE__, __PRETTY_FUNCTION__, format, ## __VA_ARGS__)
-#define logc(tag, format, ...)                        ov_log_internal(OVLogLevelCritical,       tag, __FILE__, __LINE__, __PRETTY_FUNCTION__, format, ## __VA_ARGS__)
+#define OV_LOG_IF_ENABLED(level, tag, format, ...)    (OV_LOG_IS_ENABLED(tag, level) ? ov_log_internal(level, tag, __FILE__, __LINE__, __PRETTY_FUNCTION__, format, ## __VA_ARGS__) : (void)0)
+#define logi(tag, format, ...)                        OV_LOG_IF_ENABLED(OVLogLevelInformation,    tag, format, ## __VA_ARGS__)
+#define logw(tag, format, ...)                        OV_LOG_IF_ENABLED(OVLogLevelWarning,        tag, format, ## __VA_ARGS__)
+#define loge(tag, format, ...)                        OV_LOG_IF_ENABLED(OVLogLevelError,          tag, format, ## __VA_ARGS__)
+#define logc(tag, format, ...)                        OV_LOG_IF_ENABLED(OVLogLevelCritical,       tag, format, ## __VA_ARGS__)
 
 //--------------------------------------------------------------------
 // Logging APIs with tag
@@ -132,4 +141,37 @@ void ov_stat_log_set_path(StatLogType type, const char *log_path);
 
 #ifdef __cplusplus
 }
+
+#include <atomic>
+#include <cstdint>
+
+namespace ov
+{
+	// Incremented whenever the log level or the rules of the tags are changed
+	extern std::atomic<uint32_t> log_rule_generation;
+
+	// The result of the rules for the tag/level of a logging statement (logd, logi, ...).
+	// The rules are matched only once per generation, so a disabled log costs a comparison.
+	class LogCallSite
+	{
+	public:
+		bool IsEnabled(const char *tag, OVLogLevel level)
+		{
+			auto state = _state.load(std::memory_order_relaxed);
+
+			if ((state >> 1) == log_rule_generation.load(std::memory_order_relaxed))
+			{
+				return (state & 1) != 0;
+			}
+
+			return Resolve(tag, level);
+		}
+
+	private:
+		bool Resolve(const char *tag, OVLogLevel level);
+
+		// (generation << 1) | is_enabled (generation 0 is never used, so it is resolved at the first call)
+		std::atomic<uint32_t> _state{0};
+	};
+}  // namespace ov
 #endif // __cplusplus
@@ -0,0 +1,558 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "log_async.h"
+
+#include <pthread.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cinttypes>
+#include <cstdarg>
+#include <cstring>
+#include <ctime>
+#include <map>
+#include <string>
+#include <string_view>
+
+#include "log_internal.h"
+#include "platform.h"
+#include "string.h"
+
+#define OV_LOG_COLOR_RESET "\x1B[0m"
+
+#define OV_LOG_COLOR_FG_CYAN "\x1B[36m"
+#define OV_LOG_COLOR_FG_WHITE "\x1B[37m"
+#define OV_LOG_COLOR_FG_YELLOW "\x1B[33m"
+#define OV_LOG_COLOR_FG_BR_RED "\x1B[91m"
+#define OV_LOG_COLOR_FG_BR_WHITE "\x1B[97m"
+
+#define OV_LOG_COLOR_BG_RED "\x1B[41m"
+
+static_assert((OV_LOG_RING_BUFFER_SIZE & (OV_LOG_RING_BUFFER_SIZE - 1)) == 0, "OV_LOG_RING_BUFFER_SIZE must be a power of 2");
+
+namespace ov
+{
+	// A log in the ring buffer, followed by the tag and the message (not null-terminated)
+	struct LogAsyncWriter::Record
+	{
+		// Size of the record including the tag and the message (aligned to 8 bytes)
+		uint32_t size;
+		// nullptr if the record is a padding at the end of the ring buffer
+		LogWrite *log_file;
+
+		// Microseconds since epoch
+		int64_t time;
+		uint64_t thread_id;
+		char thread_name[16];
+
+		int32_t line;
+		OVLogLevel level;
+		bool show_format;
+
+		uint16_t tag_length;
+		// The name of the file (without the directory)
+		uint16_t file_length;
+		// The name of the function (only if OV_LOG_SHOW_FUNCTION_NAME is enabled)
+		uint16_t method_length;
+		uint32_t message_length;
+
+		// They are copied, since they are not always literals (e.g. the logs of the third parties)
+		const char *GetTag() const
+		{
+			return reinterpret_cast<const char *>(this + 1);
+		}
+
+		const char *GetFile() const
+		{
+			return GetTag() + tag_length;
+		}
+
+		const char *GetMethod() const
+		{
+			return GetFile() + file_length;
+		}
+
+		const char *GetMessage() const
+		{
+			return GetMethod() + method_length;
+		}
+	};
+
+	// A ring buffer written by a thread and read by the writer thread
+	struct LogAsyncWriter::Ring
+	{
+		std::unique_ptr<uint8_t[]> buffer = std::make_unique<uint8_t[]>(OV_LOG_RING_BUFFER_SIZE);
+
+		alignas(64) std::atomic<uint64_t> head{0};
+		alignas(64) std::atomic<uint64_t> tail{0};
+
+		std::atomic<uint64_t> dropped_count{0};
+		// The file of the last dropped log, to report the drop to the same file
+		std::atomic<LogWrite *> dropped_log_file{nullptr};
+		// Used by the writer thread only
+		uint64_t reported_dropped_count = 0;
+
+		// The thread is terminated, so the ring buffer is removed after it is drained
+		std::atomic<bool> closed{false};
+	};
+
+	struct LogAsyncWriter::ThreadRingHolder
+	{
+		~ThreadRingHolder()
+		{
+			if (ring != nullptr)
+			{
+				ring->closed = true;
+			}
+		}
+
+		std::shared_ptr<Ring> ring;
+	};
+
+	LogAsyncWriter::LogAsyncWriter()
+	{
+		::pthread_atfork(
+			[]() {
+				auto instance = GetInstance();
+				instance->_drain_mutex.lock();
+				instance->_rings_mutex.lock();
+			},
+			[]() {
+				auto instance = GetInstance();
+				instance->_rings_mutex.unlock();
+				instance->_drain_mutex.unlock();
+			},
+			[]() {
+				auto instance = GetInstance();
+				instance->_rings_mutex.unlock();
+				instance->_drain_mutex.unlock();
+
+				// The thread doesn't exist in the child process (std::thread of the parent is leaked intentionally)
+				instance->_thread = nullptr;
+				instance->_thread_started = false;
+			});
+	}
+
+	LogAsyncWriter *LogAsyncWriter::GetInstance()
+	{
+		// Never released, since the logs can be written while the static objects are destroyed
+		static auto instance = new LogAsyncWriter();
+		return instance;
+	}
+
+	std::shared_ptr<LogAsyncWriter::Ring> LogAsyncWriter::GetThreadRing()
+	{
+		static thread_local ThreadRingHolder holder;
+
+		if (holder.ring == nullptr)
+		{
+			holder.ring = std::make_shared<Ring>();
+
+			std::lock_guard<std::mutex> lock_guard(_rings_mutex);
+			_rings.push_back(holder.ring);
+		}
+
+		return holder.ring;
+	}
+
+	void LogAsyncWriter::StartThreadIfNeeded()
+	{
+		if (_thread_started.load(std::memory_order_acquire))
+		{
+			return;
+		}
+
+		std::lock_guard<std::mutex> lock_guard(_rings_mutex);
+
+		if (_thread_started.load(std::memory_order_relaxed) == false)
+		{
+			_thread = new std::thread(&LogAsyncWriter::WriterThread, this);
+			::pthread_setname_np(_thread->native_handle(), "LogWriter");
+			_thread->detach();
+
+			_thread_started.store(true, std::memory_order_release);
+		}
+	}
+
+	bool LogAsyncWriter::Push(LogWrite *log_file, bool show_format, OVLogLevel level, const char *tag, const char *file, int line, const char *method, const char *format, va_list &arg_list)
+	{
+		StartThreadIfNeeded();
+
+		// Format the message
+		static thread_local std::vector<char> message_buffer(1024);
+
+		va_list copied_arg_list;
+		va_copy(copied_arg_list, arg_list);
+		int result = ::vsnprintf(message_buffer.data(), message_buffer.size(), format, copied_arg_list);
+		va_end(copied_arg_list);
+
+		if (result < 0)
+		{
+			return false;
+		}
+
+		size_t message_length = std::min<size_t>(result, OV_LOG_MAX_MESSAGE_SIZE);
+
+		if (message_length >= message_buffer.size())
+		{
+			message_buffer.resize(message_length + 1);
+
+			va_copy(copied_arg_list, arg_list);
+			::vsnprintf(message_buffer.data(), message_buffer.size(), format, copied_arg_list);
+			va_end(copied_arg_list);
+		}
+
+		size_t tag_length = std::min<size_t>(::strlen(tag), UINT16_MAX);
+
+		const char *file_name = ::strrchr(file, '/');
+		file_name = (file_name == nullptr) ? file : (file_name + 1);
+		size_t file_length = std::min<size_t>(::strlen(file_name), UINT16_MAX);
+
+#if OV_LOG_SHOW_FUNCTION_NAME
+		// "void ov::Foo::Bar(int)" => "Bar"
+		std::string_view method_name = method;
+		method_name = method_name.substr(0, method_name.find('('));
+		method_name = method_name.substr(method_name.find_last_of(' ') + 1);
+		size_t method_length = std::min<size_t>(method_name.size(), UINT16_MAX);
+#else	// OV_LOG_SHOW_FUNCTION_NAME
+		std::string_view method_name;
+		size_t method_length = 0;
+#endif	// OV_LOG_SHOW_FUNCTION_NAME
+
+		size_t record_size = (sizeof(Record) + tag_length + file_length + method_length + message_length + 7) & ~static_cast<size_t>(7);
+
+		// Reserve the space of the ring buffer
+		auto ring = GetThreadRing();
+		auto head = ring->head.load(std::memory_order_relaxed);
+		auto tail = ring->tail.load(std::memory_order_acquire);
+		auto available = OV_LOG_RING_BUFFER_SIZE - (head - tail);
+		auto position = head & (OV_LOG_RING_BUFFER_SIZE - 1);
+		auto contiguous = OV_LOG_RING_BUFFER_SIZE - position;
+		auto padding = (record_size > contiguous) ? contiguous : 0;
+
+		if (available < (padding + record_size))
+		{
+			ring->dropped_log_file.store(log_file, std::memory_order_relaxed);
+			ring->dropped_count.fetch_add(1, std::memory_order_relaxed);
+			_dropped_count.fetch_add(1, std::memory_order_relaxed);
+
+			return false;
+		}
+
+		// If the rest is too small for a header, the reader skips it without a padding record
+		if (padding >= sizeof(Record))
+		{
+			auto padding_record = reinterpret_cast<Record *>(ring->buffer.get() + position);
+			padding_record->size = padding;
+			padding_record->log_file = nullptr;
+		}
+
+		if (padding > 0)
+		{
+			position = 0;
+		}
+
+		auto record = reinterpret_cast<Record *>(ring->buffer.get() + position);
+
+		record->size = record_size;
+		record->log_file = log_file;
+		record->time = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+		record->thread_id = ov::Platform::GetThreadId();
+		::strncpy(record->thread_name, ov::Platform::GetThreadName(), sizeof(record->thread_name) - 1);
+		record->thread_name[sizeof(record->thread_name) - 1] = '\0';
+		record->line = line;
+		record->level = level;
+		record->show_format = show_format;
+		record->tag_length = tag_length;
+		record->file_length = file_length;
+		record->method_length = method_length;
+		record->message_length = message_length;
+
+		::memcpy(const_cast<char *>(record->GetTag()), tag, tag_length);
+		::memcpy(const_cast<char *>(record->GetFile()), file_name, file_length);
+		::memcpy(const_cast<char *>(record->GetMethod()), method_name.data(), method_length);
+		::memcpy(const_cast<char *>(record->GetMessage()), message_buffer.data(), message_length);
+
+		ring->head.store(head + padding + record_size, std::memory_order_release);
+
+		// Wake up the writer thread early if the ring buffer is getting full
+		if ((available - padding - record_size) < (OV_LOG_RING_BUFFER_SIZE / 2))
+		{
+			std::lock_guard<std::mutex> lock_guard(_wake_mutex);
+			_wake = true;
+			_wake_condition.notify_one();
+		}
+
+		return true;
+	}
+
+	void LogAsyncWriter::Flush()
+	{
+		// The writer thread may be blocked (e.g. crashed while writing), so it doesn't wait forever
+		for (int retry = 0; retry < 1000; retry++)
+		{
+			if (_drain_mutex.try_lock())
+			{
+				Drain();
+				_drain_mutex.unlock();
+				return;
+			}
+
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+		}
+	}
+
+	uint64_t LogAsyncWriter::GetDroppedCount() const
+	{
+		return _dropped_count.load(std::memory_order_relaxed);
+	}
+
+	void LogAsyncWriter::WriterThread()
+	{
+		while (true)
+		{
+			{
+				std::unique_lock<std::mutex> lock(_wake_mutex);
+				_wake_condition.wait_for(lock, std::chrono::milliseconds(OV_LOG_WRITE_INTERVAL_MS), [this]() { return _wake; });
+				_wake = false;
+			}
+
+			std::lock_guard<std::mutex> lock_guard(_drain_mutex);
+			Drain();
+		}
+	}
+
+	static void AppendPrefix(std::string &output, const tm &local_time, int64_t time, const char *level, const char *thread_name, uint64_t thread_id,
+							 std::string_view tag, std::string_view file, int line, std::string_view method)
+	{
+		char prefix[256];
+
+		int length = ::snprintf(
+			prefix, sizeof(prefix),
+#if DEBUG
+			// In DEBUG mode, the year is not displayed
+			"["
+#else	// DEBUG
+			// date,
+			"[%04d-"
+#endif	// DEBUG
+			// time ([mm-dd hh:mm:ss.sss])
+			"%02d-%02d %02d:%02d:%02d.%03d]"
+			// <log level>
+			" %s"
+			// <thread id>
+			" [%s:%lu]",
+#if !DEBUG
+			1900 + local_time.tm_year,
+#endif	// !DEBUG
+			local_time.tm_mon + 1, local_time.tm_mday,
+			local_time.tm_hour, local_time.tm_min, local_time.tm_sec, static_cast<int>((time / 1000) % 1000),
+			level,
+			thread_name, thread_id);
+
+		output.append(prefix, std::min<size_t>(std::max(length, 0), sizeof(prefix) - 1));
+
+		// tag
+		if (tag.empty() == false)
+		{
+			output.append(" ");
+			output.append(tag);
+		}
+
+		output.append(" | ");
+
+#if OV_LOG_SHOW_FILE_NAME
+		// File:Line
+		length = ::snprintf(prefix, sizeof(prefix), "%.*s:%-4d | ", static_cast<int>(file.size()), file.data(), line);
+		output.append(prefix, std::min<size_t>(std::max(length, 0), sizeof(prefix) - 1));
+#endif	// OV_LOG_SHOW_FILE_NAME
+
+#if OV_LOG_SHOW_FUNCTION_NAME
+		// Method
+		output.append(method);
+		output.append("() | ");
+#endif	// OV_LOG_SHOW_FUNCTION_NAME
+	}
+
+	static void WriteAll(int fd, const std::string &data)
+	{
+		size_t offset = 0;
+
+		while (offset < data.size())
+		{
+			auto written = ::write(fd, data.data() + offset, data.size() - offset);
+
+			if (written < 0)
+			{
+				if (errno == EINTR)
+				{
+					continue;
+				}
+
+				break;
+			}
+
+			offset += written;
+		}
+	}
+
+	void LogAsyncWriter::Drain()
+	{
+		constexpr const char *log_level[] = {
+			"D",
+			"I",
+			"W",
+			"E",
+			"C"};
+
+		constexpr const char *color_prefix[] = {
+			OV_LOG_COLOR_FG_CYAN,
+			OV_LOG_COLOR_FG_WHITE,
+			OV_LOG_COLOR_FG_YELLOW,
+			OV_LOG_COLOR_FG_BR_RED,
+			OV_LOG_COLOR_FG_BR_WHITE OV_LOG_COLOR_BG_RED};
+
+		std::vector<std::shared_ptr<Ring>> rings;
+		{
+			std::lock_guard<std::mutex> lock_guard(_rings_mutex);
+
+			// Remove the rings of the terminated threads which have been drained
+			_rings.erase(std::remove_if(_rings.begin(), _rings.end(), [](const std::shared_ptr<Ring> &ring) {
+							 return ring->closed && (ring->head.load(std::memory_order_acquire) == ring->tail.load(std::memory_order_relaxed));
+						 }),
+						 _rings.end());
+
+			rings = _rings;
+		}
+
+		// Collect the records of all threads, and sort them by time
+		std::vector<const Record *> records;
+		std::vector<uint64_t> heads(rings.size());
+
+		for (size_t index = 0; index < rings.size(); index++)
+		{
+			auto &ring = rings[index];
+			auto tail = ring->tail.load(std::memory_order_relaxed);
+			auto head = ring->head.load(std::memory_order_acquire);
+
+			heads[index] = head;
+
+			while (tail < head)
+			{
+				auto position = tail & (OV_LOG_RING_BUFFER_SIZE - 1);
+
+				if ((OV_LOG_RING_BUFFER_SIZE - position) < sizeof(Record))
+				{
+					tail += (OV_LOG_RING_BUFFER_SIZE - position);
+					continue;
+				}
+
+				auto record = reinterpret_cast<const Record *>(ring->buffer.get() + position);
+
+				if (record->log_file != nullptr)
+				{
+					records.push_back(record);
+				}
+
+				tail += record->size;
+			}
+		}
+
+		std::stable_sort(records.begin(), records.end(), [](const Record *a, const Record *b) {
+			return a->time < b->time;
+		});
+
+		std::string stdout_data;
+		std::string stderr_data;
+		std::map<LogWrite *, std::string> file_data;
+
+		std::time_t last_second = -1;
+		std::tm local_time{};
+		std::string log;
+
+		for (auto record : records)
+		{
+			std::time_t second = record->time / 1000000;
+
+			if (second != last_second)
+			{
+				::localtime_r(&second, &local_time);
+				last_second = second;
+			}
+
+			log.clear();
+
+			if (record->show_format)
+			{
+				AppendPrefix(log, local_time, record->time, log_level[record->level], record->thread_name, record->thread_id,
+							 {record->GetTag(), record->tag_length}, {record->GetFile(), record->file_length}, record->line, {record->GetMethod(), record->method_length});
+			}
+
+			log.append(record->GetMessage(), record->message_length);
+
+			if (record->show_format)
+			{
+				auto &output = (record->level < OVLogLevelWarning) ? stdout_data : stderr_data;
+
+				output.append(color_prefix[record->level]);
+				output.append(log);
+				output.append(OV_LOG_COLOR_RESET "\n");
+			}
+
+			auto &data = file_data[record->log_file];
+			data.append(log);
+			data.append("\n");
+		}
+
+		// Report the dropped logs
+		for (auto &ring : rings)
+		{
+			auto dropped_count = ring->dropped_count.load(std::memory_order_relaxed);
+
+			if (dropped_count != ring->reported_dropped_count)
+			{
+				auto now = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+				std::time_t second = now / 1000000;
+				::localtime_r(&second, &local_time);
+
+				log.clear();
+				AppendPrefix(log, local_time, now, log_level[OVLogLevelWarning], "LogWriter", ov::Platform::GetThreadId(), "Log", "log_async.cpp", __LINE__, "Drain");
+				log.append(ov::String::FormatString("%" PRIu64 " logs were dropped since the ring buffer of a thread was full", dropped_count - ring->reported_dropped_count).CStr());
+
+				stderr_data.append(color_prefix[OVLogLevelWarning]);
+				stderr_data.append(log);
+				stderr_data.append(OV_LOG_COLOR_RESET "\n");
+
+				auto log_file = ring->dropped_log_file.load(std::memory_order_relaxed);
+				if (log_file != nullptr)
+				{
+					auto &data = file_data[log_file];
+					data.append(log);
+					data.append("\n");
+				}
+
+				ring->reported_dropped_count = dropped_count;
+			}
+		}
+
+		WriteAll(STDOUT_FILENO, stdout_data);
+		WriteAll(STDERR_FILENO, stderr_data);
+
+		for (auto &[log_file, data] : file_data)
+		{
+			log_file->Write(data.data(), data.size());
+		}
+
+		// Release the space of the ring buffers
+		for (size_t index = 0; index < rings.size(); index++)
+		{
+			rings[index]->tail.store(heads[index], std::memory_order_release);
+		}
+	}
+}  // namespace ov
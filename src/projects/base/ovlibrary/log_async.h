@@ -0,0 +1,81 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "./log.h"
+#include "./log_write.h"
+
+// Size of the ring buffer of each thread that writes logs (must be a power of 2)
+#define OV_LOG_RING_BUFFER_SIZE (256 * 1024)
+// The message longer than this is truncated
+#define OV_LOG_MAX_MESSAGE_SIZE (OV_LOG_RING_BUFFER_SIZE / 2)
+// The writer thread writes the queued logs at this interval (or when a ring buffer becomes half full)
+#define OV_LOG_WRITE_INTERVAL_MS 10
+
+namespace ov
+{
+	// Writes the logs on a dedicated thread.
+	//
+	// Each thread queues its logs into its own ring buffer without lock, and the writer thread formats the prefix
+	// (time, thread, tag, ...) and writes the logs to stdout/stderr/file in batches. If the ring buffer of a thread
+	// is full, the log is dropped and counted instead of blocking the thread.
+	//
+	// The message is formatted by the calling thread, since the arguments (e.g. %s) may not be valid after the call.
+	class LogAsyncWriter
+	{
+	public:
+		static LogAsyncWriter *GetInstance();
+
+		// show_format: If true, the log is written to stdout/stderr too with the prefix (otherwise, only the message is written to the file)
+		// Returns false if the log is dropped
+		bool Push(LogWrite *log_file, bool show_format, OVLogLevel level, const char *tag, const char *file, int line, const char *method, const char *format, va_list &arg_list);
+
+		// Writes all the queued logs on the calling thread (e.g. before the process is terminated)
+		void Flush();
+
+		// Number of the logs dropped since the ring buffer was full
+		uint64_t GetDroppedCount() const;
+
+	protected:
+		struct Record;
+		struct Ring;
+		struct ThreadRingHolder;
+
+		LogAsyncWriter();
+
+		std::shared_ptr<Ring> GetThreadRing();
+		void StartThreadIfNeeded();
+
+		void WriterThread();
+		// _drain_mutex must be locked
+		void Drain();
+
+		std::mutex _rings_mutex;
+		std::vector<std::shared_ptr<Ring>> _rings;
+
+		// Only one thread can read the ring buffers at a time
+		std::mutex _drain_mutex;
+
+		std::mutex _wake_mutex;
+		std::condition_variable _wake_condition;
+		bool _wake = false;
+
+		// The thread is not inherited by fork(), so it is started again in the child process
+		std::atomic<bool> _thread_started{false};
+		std::thread *_thread = nullptr;
+
+		std::atomic<uint64_t> _dropped_count{0};
+	};
+}  // namespace ov
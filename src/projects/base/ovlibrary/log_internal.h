@@ -17,6 +17,7 @@
 #include <ctime>
 #include <mutex>
 #include <regex>
+#include <shared_mutex>
 #include <unordered_map>
 
 #include "./assert.h"
@@ -44,6 +45,7 @@ namespace ov
 		///
 		/// @param level Log level to display
 		void SetLogLevel(OVLogLevel level);
+		OVLogLevel GetLogLevel() const;
 		void ResetEnable();
 		bool IsEnabled(const char *tag, OVLogLevel level);
 
@@ -74,7 +76,7 @@ namespace ov
 
 		OVLogLevel _level;
 
-		std::mutex _mutex;
+		std::shared_mutex _mutex;
 
 		LogWrite _log_file;
 
@@ -86,6 +88,8 @@ namespace ov
 			ov::String regex_string;
 		};
 
+		static bool IsEnabled(const EnableItem &item, OVLogLevel level);
+
 		std::vector<EnableItem> _enable_list;
 
 		// This map used for cache (It reduces regex matching cost)
@@ -75,12 +75,32 @@ namespace ov
 		}
     }
 
+    int64_t LogWrite::GetOffset()
+    {
+        std::lock_guard<std::mutex> lock_guard(_log_stream_mutex);
+
+        if (!_log_stream.is_open() || _log_stream.fail())
+        {
+            return -1;
+        }
+
+        return static_cast<int64_t>(_log_stream.tellp());
+    }
+
     void LogWrite::SetAsService(bool start_service)
     {
         _start_service = start_service;
     }
 
     void LogWrite::Write(const char *log, std::time_t time)
+    {
+        std::string line = log;
+        line.append("\n");
+
+        Write(line.c_str(), line.size(), time);
+    }
+
+    void LogWrite::Write(const char *data, size_t length, std::time_t time)
     {
     	if(time == 0)
 		{
@@ -115,7 +135,7 @@ namespace ov
         }
 
         std::lock_guard<std::mutex> lock_guard(_log_stream_mutex);
-        _log_stream << log << std::endl;
+        _log_stream.write(data, length);
         _log_stream.flush();
     }
 }
\ No newline at end of file
@@ -22,7 +22,11 @@ namespace ov
         LogWrite(std::string log_file_name, bool include_date_in_filename = false);
         virtual ~LogWrite() = default;
         void Write(const char* log, std::time_t time = 0);
+        // Writes the lines at once (<data> must end with a newline)
+        void Write(const char* data, size_t length, std::time_t time = 0);
         void SetLogPath(const char* log_path);
+        // The offset of the end of the file that is written now (-1 if no file is open)
+        int64_t GetOffset();
 
         static void SetAsService(bool start_service);
 
@@ -116,6 +116,11 @@ namespace ov
 		return SendDataToNextNode(GetNodeType(), data);	
 	}
 
+	bool Node::SendDataListToNextNode(const std::vector<std::shared_ptr<ov::Data>> &data_list)
+	{
+		return SendDataListToNextNode(GetNodeType(), data_list);
+	}
+
 	bool Node::SendDataToPrevNode(NodeType node_type, const std::shared_ptr<const ov::Data> &data)
 	{
 		auto node = GetPrevNode();
@@ -137,4 +142,27 @@ namespace ov
 
 		return node->OnDataReceivedFromPrevNode(node_type, data);
 	}
+
+	bool Node::SendDataListToNextNode(NodeType node_type, const std::vector<std::shared_ptr<ov::Data>> &data_list)
+	{
+		auto node = GetNextNode();
+		if(node == nullptr)
+		{
+			return false;
+		}
+
+		return node->OnDataListReceivedFromPrevNode(node_type, data_list);
+	}
+
+	bool Node::OnDataListReceivedFromPrevNode(NodeType from_node, const std::vector<std::shared_ptr<ov::Data>> &data_list)
+	{
+		bool result = true;
+
+		for(const auto &data : data_list)
+		{
+			result = OnDataReceivedFromPrevNode(from_node, data) && result;
+		}
+
+		return result;
+	}
 }  // namespace pub
\ No newline at end of file
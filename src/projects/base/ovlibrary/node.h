@@ -42,6 +42,9 @@ namespace ov
 
 		virtual bool OnDataReceivedFromPrevNode(NodeType from_node, const std::shared_ptr<ov::Data> &data) = 0;
 		virtual bool OnDataReceivedFromNextNode(NodeType from_node, const std::shared_ptr<const ov::Data> &data) = 0;
+		// Receives multiple data at once. The node that can process them together (e.g. sending them with one system call) overrides it,
+		// otherwise they are passed to OnDataReceivedFromPrevNode() one by one.
+		virtual bool OnDataListReceivedFromPrevNode(NodeType from_node, const std::vector<std::shared_ptr<ov::Data>> &data_list);
 
 	protected:
 		bool SendDataToPrevNode(NodeType node_type, const std::shared_ptr<const ov::Data> &data);
@@ -50,6 +53,9 @@ namespace ov
 		bool SendDataToPrevNode(const std::shared_ptr<const ov::Data> &data);
 		bool SendDataToNextNode(const std::shared_ptr<ov::Data> &data);
 
+		bool SendDataListToNextNode(NodeType node_type, const std::vector<std::shared_ptr<ov::Data>> &data_list);
+		bool SendDataListToNextNode(const std::vector<std::shared_ptr<ov::Data>> &data_list);
+
 		std::shared_ptr<Node> GetPrevNode();
 		std::shared_ptr<Node> GetNextNode();
 
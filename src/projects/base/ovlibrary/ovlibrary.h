@@ -16,18 +16,26 @@
 #include "./byte_stream.h"
 #include "./clock.h"
 #include "./converter.h"
+#include "./cpu_features.h"
 #include "./data.h"
+#include "./data_copy_audit.h"
+#include "./data_pool.h"
 #include "./delay_queue.h"
 #include "./dump_utilities.h"
 #include "./enable_shared_from_this.h"
 #include "./error.h"
+#include "./histogram.h"
+#include "./interned_string.h"
 #include "./json.h"
+#include "./json_writer.h"
+#include "./lock_profiler.h"
 #include "./log.h"
 #include "./memory_utilities.h"
 #include "./ovdata_structure.h"
 #include "./path_manager.h"
 #include "./pcm_utilities.h"
 #include "./platform.h"
+#include "./profiler.h"
 #include "./queue.h"
 #include "./random.h"
 #include "./regex.h"
@@ -36,7 +44,10 @@
 #include "./stack_trace.h"
 #include "./stop_watch.h"
 #include "./string.h"
+#include "./thread_registry.h"
 #include "./time.h"
+#include "./timer_wheel.h"
 #include "./type.h"
 #include "./unique.h"
-#include "./url.h"
\ No newline at end of file
+#include "./url.h"
+#include "./wakeup_event.h"
\ No newline at end of file
@@ -8,3 +8,84 @@
 //==============================================================================
 #include "pcm_utilities.h"
 
+
+#if defined(__SSE2__)
+#	include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#	include <arm_neon.h>
+#endif
+
+namespace ov
+{
+	template<>
+	bool Interleave<int16_t>(void *destination, const void *left, const void *right, int samples)
+	{
+		auto dst = static_cast<int16_t *>(destination);
+		auto l = static_cast<const int16_t *>(left);
+		auto r = static_cast<const int16_t *>(right);
+		int sample = 0;
+
+#if defined(__SSE2__)
+		for (; sample + 8 <= samples; sample += 8)
+		{
+			__m128i left_samples = _mm_loadu_si128(reinterpret_cast<const __m128i *>(l + sample));
+			__m128i right_samples = _mm_loadu_si128(reinterpret_cast<const __m128i *>(r + sample));
+
+			// L0 R0 L1 R1 L2 R2 L3 R3 / L4 R4 L5 R5 L6 R6 L7 R7
+			_mm_storeu_si128(reinterpret_cast<__m128i *>(dst + sample * 2), _mm_unpacklo_epi16(left_samples, right_samples));
+			_mm_storeu_si128(reinterpret_cast<__m128i *>(dst + sample * 2 + 8), _mm_unpackhi_epi16(left_samples, right_samples));
+		}
+#elif defined(__ARM_NEON)
+		for (; sample + 8 <= samples; sample += 8)
+		{
+			int16x8x2_t samples_to_store = {{vld1q_s16(l + sample), vld1q_s16(r + sample)}};
+
+			vst2q_s16(dst + sample * 2, samples_to_store);
+		}
+#endif
+
+		for (; sample < samples; ++sample)
+		{
+			dst[sample * 2] = l[sample];
+			dst[sample * 2 + 1] = r[sample];
+		}
+
+		return true;
+	}
+
+	template<>
+	bool Interleave<float>(void *destination, const void *left, const void *right, int samples)
+	{
+		auto dst = static_cast<float *>(destination);
+		auto l = static_cast<const float *>(left);
+		auto r = static_cast<const float *>(right);
+		int sample = 0;
+
+#if defined(__SSE2__)
+		for (; sample + 4 <= samples; sample += 4)
+		{
+			__m128 left_samples = _mm_loadu_ps(l + sample);
+			__m128 right_samples = _mm_loadu_ps(r + sample);
+
+			// L0 R0 L1 R1 / L2 R2 L3 R3
+			_mm_storeu_ps(dst + sample * 2, _mm_unpacklo_ps(left_samples, right_samples));
+			_mm_storeu_ps(dst + sample * 2 + 4, _mm_unpackhi_ps(left_samples, right_samples));
+		}
+#elif defined(__ARM_NEON)
+		for (; sample + 4 <= samples; sample += 4)
+		{
+			float32x4x2_t samples_to_store = {{vld1q_f32(l + sample), vld1q_f32(r + sample)}};
+
+			vst2q_f32(dst + sample * 2, samples_to_store);
+		}
+#endif
+
+		for (; sample < samples; ++sample)
+		{
+			dst[sample * 2] = l[sample];
+			dst[sample * 2 + 1] = r[sample];
+		}
+
+		return true;
+	}
+}  // namespace ov
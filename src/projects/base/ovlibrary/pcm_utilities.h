@@ -8,6 +8,8 @@
 //==============================================================================
 #pragma once
 
+#include <cstdint>
+
 namespace ov
 {
 // Interleave data of source and store it in destination
@@ -19,11 +21,20 @@ namespace ov
 	// Destination:
 	//  00 05 01 06 02 07 03 08 04 09
 	//  L0 R0 L1 R1 L2 R2 L3 R3 L4 R4
+	template<typename T>
+	bool Interleave(void *destination, const void *left, const void *right, int samples);
+
 	template<typename T>
 	bool Interleave(void *destination, const void *source, int channels, int samples)
 	{
 		const T *src = static_cast<const T *>(source);
 
+		if (channels == 2)
+		{
+			// Use the stereo version, which is vectorized for int16_t/float
+			return Interleave<T>(destination, src, src + samples, samples);
+		}
+
 		for(int channel = 0; channel < channels; ++channel)
 		{
 			T *dst = static_cast<T *>(destination) + channel;
@@ -67,4 +78,10 @@ namespace ov
 
 		return true;
 	}
-}
\ No newline at end of file
+
+	// Vectorized with SSE2 (x86_64) or NEON (aarch64), and falls back to the generic version on the other architectures
+	template<>
+	bool Interleave<int16_t>(void *destination, const void *left, const void *right, int samples);
+	template<>
+	bool Interleave<float>(void *destination, const void *left, const void *right, int samples);
+}  // namespace ov
@@ -8,11 +8,19 @@
 //==============================================================================
 #include "platform.h"
 
+#include <algorithm>
+#include <fstream>
 #include <pthread.h>
+#include <sched.h>
 #include <sys/syscall.h>
 #include <unistd.h>
 #include <zconf.h>
 
+#include <cstdio>
+
+// Followed by "<node>/cpulist"
+#define NUMA_NODE_CPU_LIST_PATH "/sys/devices/system/node/node"
+
 namespace ov
 {
 	const char *Platform::GetName()
@@ -48,4 +56,226 @@ namespace ov
 
 		return name;
 	}
+
+#if IS_LINUX
+	// The mask of the main thread (pid) is used, since the calling thread may have been pinned already
+	static bool GetProcessCpuSet(cpu_set_t *cpu_set)
+	{
+		CPU_ZERO(cpu_set);
+
+		return (::sched_getaffinity(::getpid(), sizeof(cpu_set_t), cpu_set) == 0) && (CPU_COUNT(cpu_set) > 0);
+	}
+
+	struct NumaTopology
+	{
+		// CPUs of each node that the process is allowed to run on (the nodes without the CPUs are excluded)
+		std::vector<std::vector<int>> node_cpu_list;
+		// CPU -> index of node_cpu_list
+		std::vector<size_t> cpu_node_index_list;
+	};
+
+	// Loaded once from sysfs. If it is not available, all CPUs are in a node.
+	// Intentionally leaked to be available while static objects are destroyed (See DataPool)
+	static const NumaTopology &GetNumaTopology()
+	{
+		static const auto topology = new NumaTopology([]() {
+			NumaTopology topology;
+			cpu_set_t allowed_cpu_set;
+
+			if (GetProcessCpuSet(&allowed_cpu_set) == false)
+			{
+				CPU_ZERO(&allowed_cpu_set);
+			}
+
+			topology.cpu_node_index_list.resize(CPU_SETSIZE, 0);
+
+			for (size_t node = 0;; node++)
+			{
+				std::ifstream fs(NUMA_NODE_CPU_LIST_PATH + std::to_string(node) + "/cpulist");
+
+				if (fs.is_open() == false)
+				{
+					break;
+				}
+
+				std::vector<int> cpu_list;
+				std::string range;
+
+				// Format: 0-3,8-11
+				while (std::getline(fs, range, ','))
+				{
+					int first = 0;
+					int last = 0;
+					auto count = ::sscanf(range.c_str(), "%d-%d", &first, &last);
+
+					if (count <= 0)
+					{
+						continue;
+					}
+
+					last = (count == 1) ? first : last;
+
+					for (int cpu = std::max(first, 0); (cpu <= last) && (cpu < CPU_SETSIZE); cpu++)
+					{
+						if (CPU_ISSET(cpu, &allowed_cpu_set))
+						{
+							cpu_list.push_back(cpu);
+							topology.cpu_node_index_list[cpu] = topology.node_cpu_list.size();
+						}
+					}
+				}
+
+				// Memory-only nodes have no CPU
+				if (cpu_list.empty() == false)
+				{
+					topology.node_cpu_list.push_back(std::move(cpu_list));
+				}
+			}
+
+			if (topology.node_cpu_list.empty())
+			{
+				std::vector<int> cpu_list;
+
+				for (int cpu = 0; cpu < CPU_SETSIZE; cpu++)
+				{
+					if (CPU_ISSET(cpu, &allowed_cpu_set))
+					{
+						cpu_list.push_back(cpu);
+					}
+				}
+
+				topology.node_cpu_list.push_back(std::move(cpu_list));
+				std::fill(topology.cpu_node_index_list.begin(), topology.cpu_node_index_list.end(), 0);
+			}
+
+			return topology;
+		}());
+
+		return *topology;
+	}
+
+	static bool SetThreadCpuList(std::thread &thread, const std::vector<int> &cpu_list)
+	{
+		if (cpu_list.empty())
+		{
+			return false;
+		}
+
+		cpu_set_t cpu_set;
+		CPU_ZERO(&cpu_set);
+
+		for (auto cpu : cpu_list)
+		{
+			CPU_SET(cpu, &cpu_set);
+		}
+
+		return ::pthread_setaffinity_np(thread.native_handle(), sizeof(cpu_set), &cpu_set) == 0;
+	}
+#endif	// IS_LINUX
+
+	size_t Platform::GetCpuCount()
+	{
+#if IS_LINUX
+		cpu_set_t cpu_set;
+
+		if (GetProcessCpuSet(&cpu_set))
+		{
+			return static_cast<size_t>(CPU_COUNT(&cpu_set));
+		}
+#endif	// IS_LINUX
+
+		return std::max(std::thread::hardware_concurrency(), 1U);
+	}
+
+	bool Platform::SetThreadAffinity(std::thread &thread, size_t index)
+	{
+#if IS_LINUX
+		auto &node_cpu_list = GetNumaTopology().node_cpu_list;
+		auto &cpu_list = node_cpu_list[index % node_cpu_list.size()];
+
+		if (cpu_list.empty())
+		{
+			return false;
+		}
+
+		return SetThreadCpuList(thread, {cpu_list[(index / node_cpu_list.size()) % cpu_list.size()]});
+#else	// IS_LINUX
+		return false;
+#endif	// IS_LINUX
+	}
+
+	size_t Platform::GetNumaNodeCount()
+	{
+#if IS_LINUX
+		return GetNumaTopology().node_cpu_list.size();
+#else	// IS_LINUX
+		return 1;
+#endif	// IS_LINUX
+	}
+
+	std::vector<int> Platform::GetNumaNodeCpuList(size_t node_index)
+	{
+#if IS_LINUX
+		auto &node_cpu_list = GetNumaTopology().node_cpu_list;
+		return node_cpu_list[node_index % node_cpu_list.size()];
+#else	// IS_LINUX
+		return {};
+#endif	// IS_LINUX
+	}
+
+	size_t Platform::GetCurrentNumaNode()
+	{
+#if IS_LINUX
+		auto &topology = GetNumaTopology();
+
+		if (topology.node_cpu_list.size() <= 1)
+		{
+			return 0;
+		}
+
+		auto cpu = ::sched_getcpu();
+
+		if ((cpu >= 0) && (static_cast<size_t>(cpu) < topology.cpu_node_index_list.size()))
+		{
+			return topology.cpu_node_index_list[cpu];
+		}
+#endif	// IS_LINUX
+
+		return 0;
+	}
+
+	bool Platform::SetThreadNumaNode(std::thread &thread, size_t node_index)
+	{
+#if IS_LINUX
+		return SetThreadCpuList(thread, GetNumaNodeCpuList(node_index));
+#else	// IS_LINUX
+		return false;
+#endif	// IS_LINUX
+	}
+
+	bool Platform::SetThreadCpuGroup(std::thread &thread, size_t group_index, size_t group_count)
+	{
+#if IS_LINUX
+		cpu_set_t allowed_cpu_set;
+
+		if ((group_count == 0) || (GetProcessCpuSet(&allowed_cpu_set) == false))
+		{
+			return false;
+		}
+
+		std::vector<int> cpu_list;
+
+		for (int cpu = 0; cpu < CPU_SETSIZE; cpu++)
+		{
+			if (CPU_ISSET(cpu, &allowed_cpu_set) && ((static_cast<size_t>(cpu) % group_count) == group_index))
+			{
+				cpu_list.push_back(cpu);
+			}
+		}
+
+		return SetThreadCpuList(thread, cpu_list);
+#else	// IS_LINUX
+		return false;
+#endif	// IS_LINUX
+	}
 }  // namespace ov
@@ -9,6 +9,8 @@
 #pragma once
 
 #include <string>
+#include <thread>
+#include <vector>
 
 #define IS_WINDOWS                              0
 #define IS_UNIX                                 0
@@ -117,5 +119,22 @@ namespace ov
 		static uint64_t GetProcessId();
 		static uint64_t GetThreadId();
 		static const char *GetThreadName();
+
+		// Returns the number of CPUs the process is allowed to run on
+		static size_t GetCpuCount();
+		// Pins <thread> to the <index>th CPU the process is allowed to run on (wraps around the CPU count).
+		// The CPUs are taken from the NUMA nodes in turn, so the <index>th CPU is on the node (index % GetNumaNodeCount()).
+		static bool SetThreadAffinity(std::thread &thread, size_t index);
+
+		// Number of the NUMA nodes that have CPUs the process is allowed to run on (1 if NUMA is not available)
+		static size_t GetNumaNodeCount();
+		// CPUs of the <node_index>th NUMA node (wraps around the node count)
+		static std::vector<int> GetNumaNodeCpuList(size_t node_index);
+		// Index of the NUMA node that the calling thread is running on
+		static size_t GetCurrentNumaNode();
+		// Pins <thread> to the CPUs of the <node_index>th NUMA node (wraps around the node count)
+		static bool SetThreadNumaNode(std::thread &thread, size_t node_index);
+		// Pins <thread> to the CPUs the process is allowed to run on whose number is (group_index) modulo <group_count>
+		static bool SetThreadCpuGroup(std::thread &thread, size_t group_index, size_t group_count);
 	};
 }
\ No newline at end of file
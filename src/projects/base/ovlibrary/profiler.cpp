@@ -0,0 +1,242 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "profiler.h"
+
+#include <errno.h>
+#include <execinfo.h>
+#include <sys/prctl.h>
+#include <sys/time.h>
+
+#include <algorithm>
+#include <cinttypes>
+#include <map>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "error.h"
+#include "log.h"
+#include "ovlibrary_private.h"
+#include "stack_trace.h"
+
+// #0: SignalHandler()
+// #1: Signal trampoline (__restore_rt)
+#define PROFILER_SKIP_FRAME_COUNT 2
+
+namespace ov
+{
+	std::mutex Profiler::_profile_mutex;
+
+	std::atomic<bool> Profiler::_is_running{false};
+	std::atomic<int> Profiler::_handler_count{0};
+
+	Profiler::Sample *Profiler::_samples = nullptr;
+	std::atomic<size_t> Profiler::_sample_index{0};
+	std::atomic<size_t> Profiler::_dropped_count{0};
+
+	static size_t sample_capacity = 0;
+
+	void Profiler::SignalHandler(int signum, siginfo_t *info, void *context)
+	{
+		// The handler must not change the errno of the interrupted code
+		int saved_errno = errno;
+
+		_handler_count++;
+
+		if (_is_running)
+		{
+			auto index = _sample_index++;
+
+			if (index < sample_capacity)
+			{
+				auto &sample = _samples[index];
+
+				::prctl(PR_GET_NAME, sample.thread_name, 0, 0, 0);
+				sample.thread_name[PROFILER_THREAD_NAME_LENGTH - 1] = '\0';
+				sample.depth = ::backtrace(sample.frames, PROFILER_MAX_STACK_DEPTH);
+			}
+			else
+			{
+				_dropped_count++;
+			}
+		}
+
+		_handler_count--;
+
+		errno = saved_errno;
+	}
+
+	bool Profiler::CollectFoldedStacks(int64_t duration_ms, int frequency, String *folded_stacks)
+	{
+		if ((duration_ms <= 0) || (frequency <= 0) || (folded_stacks == nullptr))
+		{
+			return false;
+		}
+
+		std::unique_lock lock(_profile_mutex, std::try_to_lock);
+
+		if (lock.owns_lock() == false)
+		{
+			logtw("[Profiler] Another profile is in progress");
+			return false;
+		}
+
+		// The samples are taken only by the threads that use the CPU, so all cores can take <frequency> samples per second at most
+		auto core_count = std::max(std::thread::hardware_concurrency(), 1U);
+		auto max_sample_count = static_cast<uint64_t>(duration_ms) * frequency / 1000 * core_count + core_count;
+		sample_capacity = std::min<uint64_t>(max_sample_count, PROFILER_MAX_SAMPLE_COUNT);
+
+		std::vector<Sample> samples(sample_capacity);
+		_samples = samples.data();
+		_sample_index = 0;
+		_dropped_count = 0;
+
+		// ::backtrace() loads libgcc at the first call, which is not safe in the signal handler
+		void *dummy_frames[1];
+		::backtrace(dummy_frames, 1);
+
+		struct sigaction action = {};
+		struct sigaction old_action = {};
+		action.sa_sigaction = SignalHandler;
+		action.sa_flags = SA_SIGINFO | SA_RESTART;
+		::sigemptyset(&action.sa_mask);
+
+		if (::sigaction(SIGPROF, &action, &old_action) != 0)
+		{
+			logtw("[Profiler] Could not install the handler of SIGPROF: %s", ov::Error::CreateErrorFromErrno()->What());
+			_samples = nullptr;
+			return false;
+		}
+
+		_is_running = true;
+
+		struct itimerval timer = {};
+		timer.it_interval.tv_sec = 0;
+		timer.it_interval.tv_usec = std::max(1000000 / frequency, 1);
+		timer.it_value = timer.it_interval;
+
+		bool result = (::setitimer(ITIMER_PROF, &timer, nullptr) == 0);
+
+		if (result)
+		{
+			logti("[Profiler] Profiling the CPU for %" PRId64 " ms (%d Hz)...", duration_ms, frequency);
+			std::this_thread::sleep_for(std::chrono::milliseconds(duration_ms));
+
+			timer = {};
+			::setitimer(ITIMER_PROF, &timer, nullptr);
+		}
+		else
+		{
+			logtw("[Profiler] Could not start the timer: %s", ov::Error::CreateErrorFromErrno()->What());
+		}
+
+		_is_running = false;
+
+		// SIGPROF terminates the process by default, so the pending signals are ignored instead of restoring the default action
+		if (old_action.sa_handler == SIG_DFL)
+		{
+			old_action.sa_handler = SIG_IGN;
+		}
+		::sigaction(SIGPROF, &old_action, nullptr);
+
+		while (_handler_count > 0)
+		{
+			std::this_thread::yield();
+		}
+
+		_samples = nullptr;
+
+		if (result == false)
+		{
+			return false;
+		}
+
+		auto sample_count = std::min<size_t>(_sample_index, sample_capacity);
+
+		if (_dropped_count > 0)
+		{
+			logtw("[Profiler] %zu samples are dropped (max: %zu)", _dropped_count.load(), sample_capacity);
+		}
+
+		*folded_stacks = FoldSamples(samples.data(), sample_count);
+
+		logti("[Profiler] %zu samples are collected", sample_count);
+
+		return true;
+	}
+
+	String Profiler::FoldSamples(const Sample *samples, size_t sample_count)
+	{
+		// Aggregates the same stacks before resolving the symbols, since it is much cheaper than resolving
+		std::map<std::pair<String, std::vector<void *>>, uint64_t> stack_map;
+		std::unordered_map<void *, String> symbol_map;
+
+		for (size_t index = 0; index < sample_count; index++)
+		{
+			auto &sample = samples[index];
+
+			if (sample.depth <= PROFILER_SKIP_FRAME_COUNT)
+			{
+				continue;
+			}
+
+			// From the outermost frame
+			std::vector<void *> frames(sample.frames + PROFILER_SKIP_FRAME_COUNT, sample.frames + sample.depth);
+			std::reverse(frames.begin(), frames.end());
+
+			for (auto frame : frames)
+			{
+				symbol_map.emplace(frame, "");
+			}
+
+			stack_map[{sample.thread_name, std::move(frames)}]++;
+		}
+
+		std::vector<void *> address_list;
+		address_list.reserve(symbol_map.size());
+		for (auto &item : symbol_map)
+		{
+			address_list.push_back(item.first);
+		}
+
+		auto names = StackTrace::GetFunctionNames(address_list.data(), static_cast<int>(address_list.size()));
+
+		for (size_t index = 0; index < address_list.size(); index++)
+		{
+			// ';' is the separator of the frames
+			symbol_map[address_list[index]] = names[index].Replace(";", ":");
+		}
+
+		// The stacks with the different addresses in the same functions are merged
+		std::map<String, uint64_t> folded_stack_map;
+
+		for (auto &[key, count] : stack_map)
+		{
+			auto &[thread_name, frames] = key;
+
+			String folded_stack = thread_name.IsEmpty() ? "?" : thread_name.Replace(";", ":").Replace(" ", "_");
+
+			for (auto frame : frames)
+			{
+				folded_stack.Append(';');
+				folded_stack.Append(symbol_map[frame]);
+			}
+
+			folded_stack_map[folded_stack] += count;
+		}
+
+		String folded_stacks;
+
+		for (auto &[folded_stack, count] : folded_stack_map)
+		{
+			folded_stacks.AppendFormat("%s %" PRIu64 "\n", folded_stack.CStr(), count);
+		}
+
+		return folded_stacks;
+	}
+}  // namespace ov
@@ -0,0 +1,65 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <signal.h>
+
+#include <atomic>
+#include <mutex>
+
+#include "string.h"
+
+// Maximum number of the frames of a sample
+#define PROFILER_MAX_STACK_DEPTH 48
+// Maximum number of the samples of a profile (the samples after it are dropped)
+#define PROFILER_MAX_SAMPLE_COUNT 100000
+// Length of the thread name including the null terminator (TASK_COMM_LEN)
+#define PROFILER_THREAD_NAME_LENGTH 16
+
+namespace ov
+{
+	// A sampling CPU profiler of the process.
+	//
+	// While profiling, SIGPROF is raised every 1/<frequency> seconds of the CPU time of the process (ITIMER_PROF), and
+	// the thread that is running when the signal is raised collects its call stack. The stacks are aggregated by the
+	// name of the thread, so each subsystem is distinguished by its thread name (e.g. SP<pool name>, StreamWorker).
+	class Profiler
+	{
+	public:
+		Profiler() = delete;
+
+		// Collects the samples during <duration_ms> and returns them as the folded stacks that can be used by
+		// flamegraph.pl (e.g. "StreamWorker;start_thread;...;ov::Data::Append 12").
+		//
+		// Returns false if another profile is in progress or the profiler cannot be started.
+		static bool CollectFoldedStacks(int64_t duration_ms, int frequency, String *folded_stacks);
+
+	private:
+		struct Sample
+		{
+			char thread_name[PROFILER_THREAD_NAME_LENGTH];
+			int depth;
+			void *frames[PROFILER_MAX_STACK_DEPTH];
+		};
+
+		static void SignalHandler(int signum, siginfo_t *info, void *context);
+
+		static String FoldSamples(const Sample *samples, size_t sample_count);
+
+		// Only one profile can be run at a time since ITIMER_PROF is per process
+		static std::mutex _profile_mutex;
+
+		static std::atomic<bool> _is_running;
+		// Number of the signal handlers that are being executed
+		static std::atomic<int> _handler_count;
+
+		static Sample *_samples;
+		static std::atomic<size_t> _sample_index;
+		static std::atomic<size_t> _dropped_count;
+	};
+}  // namespace ov
@@ -12,6 +12,7 @@
 #include <errno.h>
 #include <execinfo.h>
 #include <stdlib.h>
+#include <string.h>
 #include <unistd.h>
 
 #include <fstream>
@@ -344,6 +345,67 @@ namespace ov
 		return log;
 	}
 
+	std::vector<String> StackTrace::GetFunctionNames(void *const *address_list, int count)
+	{
+		std::vector<String> names;
+
+		if (count <= 0)
+		{
+			return names;
+		}
+
+		char **symbol_list = ::backtrace_symbols(address_list, count);
+
+		if (symbol_list == nullptr)
+		{
+			names.resize(count, "?");
+			return names;
+		}
+
+		names.reserve(count);
+
+		for (int i = 0; i < count; ++i)
+		{
+			char *line = symbol_list[i];
+			ParseResult parse_result;
+
+			if (ParseLinuxStyleLine(line, &parse_result) || ParseMacOsStyleLine(line, &parse_result))
+			{
+				const char *name = (parse_result.demangled_function_name == nullptr) ? parse_result.function_name : parse_result.demangled_function_name;
+
+				if ((name != nullptr) && (name[0] != '\0'))
+				{
+					names.emplace_back(name);
+				}
+				else if ((parse_result.module_name != nullptr) && (parse_result.module_name[0] != '\0'))
+				{
+					// The symbol is not exported (e.g. static function)
+					const char *module_name = ::strrchr(parse_result.module_name, '/');
+					module_name = (module_name == nullptr) ? parse_result.module_name : (module_name + 1);
+
+					names.emplace_back(String::FormatString("%s+%s", module_name, (parse_result.offset == nullptr) ? "0x0" : parse_result.offset));
+				}
+				else
+				{
+					names.emplace_back("?");
+				}
+
+				if (parse_result.demangled_function_name != nullptr)
+				{
+					::free(parse_result.demangled_function_name);
+				}
+			}
+			else
+			{
+				names.emplace_back(line);
+			}
+		}
+
+		::free(symbol_list);
+
+		return names;
+	}
+
 	void StackTrace::WriteStackTrace(std::ofstream &stream)
 	{
 		stream << GetStackTraceInternal(3);
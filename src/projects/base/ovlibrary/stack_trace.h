@@ -8,6 +8,7 @@
 //==============================================================================
 
 #include <csignal>
+#include <vector>
 
 #include "./string.h"
 
@@ -23,6 +24,10 @@ namespace ov
 		static String GetStackTrace(int line_count = -1);
 		static void WriteStackTrace(std::ofstream &stream);
 
+		// Resolves the function names of the addresses (e.g. the addresses collected by ::backtrace()).
+		// If the name of the function is not available, "<module>+<offset>" or "?" is returned.
+		static std::vector<String> GetFunctionNames(void *const *address_list, int count);
+
 	private:
 		struct ParseResult
 		{
@@ -45,6 +45,13 @@ namespace ov
 		  _length(string._length),
 		  _capacity(string._capacity)
 	{
+		if (string.IsInline())
+		{
+			// The inline buffer cannot be stolen
+			::memcpy(_inline_buffer, string._inline_buffer, sizeof(_inline_buffer));
+			_buffer = _inline_buffer;
+		}
+
 		string._buffer = nullptr;
 
 		string._length = 0;
@@ -979,13 +986,30 @@ namespace ov
 				}
 			}
 
-			// null문자가 들어갈 공간 더함
-			char *buffer = static_cast<char *>(::malloc(sizeof(char) * (allocated_length + 1L)));
+			char *buffer = nullptr;
 
-			if (buffer == nullptr)
+			if (allocated_length < OV_STRING_INLINE_CAPACITY)
 			{
-				// 메모리 할당 실패
-				return false;
+				// 짧은 문자열은 heap 할당 없이 inline buffer에 저장
+				if (IsInline())
+				{
+					// 이미 inline buffer를 사용 중
+					return true;
+				}
+
+				buffer = _inline_buffer;
+				allocated_length = OV_STRING_INLINE_CAPACITY - 1L;
+			}
+			else
+			{
+				// null문자가 들어갈 공간 더함
+				buffer = static_cast<char *>(::malloc(sizeof(char) * (allocated_length + 1L)));
+
+				if (buffer == nullptr)
+				{
+					// 메모리 할당 실패
+					return false;
+				}
 			}
 
 			::memset(buffer, 0, sizeof(char) * (allocated_length + 1L));
@@ -1007,7 +1031,7 @@ namespace ov
 			_buffer = buffer;
 
 			// Release()에 의해 길이 정보가 초기화 되었으므로 다시 대입해줌
-			_length = old_length;
+			_length = std::min(allocated_length, old_length);
 		}
 
 		return true;
@@ -1015,7 +1039,14 @@ namespace ov
 
 	bool String::Release() noexcept
 	{
-		OV_SAFE_FREE(_buffer);
+		if (IsInline())
+		{
+			_buffer = nullptr;
+		}
+		else
+		{
+			OV_SAFE_FREE(_buffer);
+		}
 
 		_capacity = 0L;
 		_length = 0L;
@@ -19,6 +19,9 @@
 #include <string>
 #include <vector>
 
+// Strings shorter than this (including the null character) are stored in the instance, without heap allocation
+#define OV_STRING_INLINE_CAPACITY 24
+
 namespace ov
 {
 	class Data;
@@ -27,7 +30,8 @@ namespace ov
 	class String
 	{
 	public:
-		String() = default;
+		// User-provided to leave _inline_buffer uninitialized, while a const instance can still be default-initialized
+		String() noexcept {}
 		String(const char *string);	 // NOLINT
 		String(const char *string, size_t length);
 		String(uint32_t capacity);
@@ -156,6 +160,12 @@ namespace ov
 		bool Release() noexcept;
 
 	private:
+		bool IsInline() const noexcept
+		{
+			return _buffer == _inline_buffer;
+		}
+
+		// Points to _inline_buffer for short strings, or the memory allocated from the heap
 		char *_buffer = nullptr;
 
 		// Actual string length
@@ -163,6 +173,8 @@ namespace ov
 
 		// Allocated memory size (Exponentially increasing)
 		size_t _capacity = 0;
+
+		char _inline_buffer[OV_STRING_INLINE_CAPACITY];
 	};
 
 	struct CaseInsensitiveHash
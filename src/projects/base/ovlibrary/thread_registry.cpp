@@ -0,0 +1,152 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "thread_registry.h"
+
+#include <dirent.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <thread>
+
+#include "platform.h"
+
+namespace ov
+{
+	std::mutex ThreadRegistry::_mutex;
+	std::unordered_map<uint64_t, ThreadRegistry::Role> ThreadRegistry::_role_map;
+
+	void ThreadRegistry::Register(const String &role, const String &app_name, const String &stream_name)
+	{
+		std::lock_guard lock_guard(_mutex);
+
+		_role_map[Platform::GetThreadId()] = {role, app_name, stream_name};
+	}
+
+	void ThreadRegistry::Unregister()
+	{
+		std::lock_guard lock_guard(_mutex);
+
+		_role_map.erase(Platform::GetThreadId());
+	}
+
+	std::unordered_map<uint64_t, int64_t> ThreadRegistry::GetCpuTimes(std::unordered_map<uint64_t, String> *names)
+	{
+		std::unordered_map<uint64_t, int64_t> cpu_times;
+
+		auto dir = ::opendir("/proc/self/task");
+
+		if (dir == nullptr)
+		{
+			return cpu_times;
+		}
+
+		static const auto ticks_per_second = std::max(::sysconf(_SC_CLK_TCK), 1L);
+
+		while (auto entry = ::readdir(dir))
+		{
+			if (entry->d_name[0] == '.')
+			{
+				continue;
+			}
+
+			std::ifstream fs(String::FormatString("/proc/self/task/%s/stat", entry->d_name).CStr());
+			std::string line;
+
+			if (std::getline(fs, line).fail())
+			{
+				// The thread has been terminated
+				continue;
+			}
+
+			// <tid> (<name>) <state> <ppid> ... <utime> <stime> ...
+			// The name can contain spaces and parentheses, so the fields are parsed after the last ')'
+			auto name_begin = line.find('(');
+			auto name_end = line.rfind(')');
+
+			if ((name_begin == std::string::npos) || (name_end == std::string::npos) || (name_end < name_begin))
+			{
+				continue;
+			}
+
+			auto thread_id = std::strtoull(entry->d_name, nullptr, 10);
+
+			// The fields from <state> (3rd field)
+			auto fields = String(line.substr(name_end + 2).c_str()).Split(" ");
+
+			// utime: 14th field, stime: 15th field
+			if (fields.size() < 13)
+			{
+				continue;
+			}
+
+			auto ticks = std::strtoll(fields[11].CStr(), nullptr, 10) + std::strtoll(fields[12].CStr(), nullptr, 10);
+			cpu_times[thread_id] = ticks * 1000 / ticks_per_second;
+
+			if (names != nullptr)
+			{
+				(*names)[thread_id] = line.substr(name_begin + 1, name_end - name_begin - 1).c_str();
+			}
+		}
+
+		::closedir(dir);
+
+		return cpu_times;
+	}
+
+	std::vector<ThreadRegistry::ThreadInfo> ThreadRegistry::GetThreadInfoList(int64_t interval_ms)
+	{
+		std::vector<ThreadInfo> thread_info_list;
+
+		auto start_time = std::chrono::steady_clock::now();
+		auto first_cpu_times = GetCpuTimes(nullptr);
+
+		if (interval_ms > 0)
+		{
+			std::this_thread::sleep_for(std::chrono::milliseconds(interval_ms));
+		}
+
+		std::unordered_map<uint64_t, String> names;
+		auto cpu_times = GetCpuTimes(&names);
+		auto elapsed_ms = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start_time).count();
+
+		std::lock_guard lock_guard(_mutex);
+
+		for (auto &[thread_id, cpu_time_ms] : cpu_times)
+		{
+			ThreadInfo info;
+
+			info.thread_id = thread_id;
+			info.name = names[thread_id];
+			info.cpu_time_ms = cpu_time_ms;
+
+			auto first_cpu_time = first_cpu_times.find(thread_id);
+			if ((first_cpu_time != first_cpu_times.end()) && (elapsed_ms > 0))
+			{
+				info.cpu_usage = (cpu_time_ms - first_cpu_time->second) * 100.0 / elapsed_ms;
+			}
+
+			auto role = _role_map.find(thread_id);
+			if (role != _role_map.end())
+			{
+				info.role = role->second.role;
+				info.app_name = role->second.app_name;
+				info.stream_name = role->second.stream_name;
+			}
+
+			thread_info_list.push_back(std::move(info));
+		}
+
+		std::sort(thread_info_list.begin(), thread_info_list.end(), [](const ThreadInfo &a, const ThreadInfo &b) {
+			return (a.cpu_usage != b.cpu_usage) ? (a.cpu_usage > b.cpu_usage) : (a.cpu_time_ms > b.cpu_time_ms);
+		});
+
+		return thread_info_list;
+	}
+}  // namespace ov
@@ -0,0 +1,84 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "string.h"
+
+namespace ov
+{
+	// Records the role of the threads (e.g. StreamWorker, Encoder) and the application/stream they work for, so that the
+	// CPU time of each thread (/proc/self/task/<tid>/stat) can be attributed to a subsystem or a stream.
+	//
+	// Usage (at the beginning of the thread function):
+	//   ov::ThreadRegistry::Registration registration("StreamWorker", app_name, stream_name);
+	class ThreadRegistry
+	{
+	public:
+		struct ThreadInfo
+		{
+			uint64_t thread_id = 0;
+			// The name set by pthread_setname_np()
+			String name;
+			// Empty if the thread is not registered
+			String role;
+			String app_name;
+			String stream_name;
+
+			// Total CPU time (user + system) of the thread
+			int64_t cpu_time_ms = 0;
+			// CPU usage during the interval of GetThreadInfoList() (100% == a core)
+			double cpu_usage = 0.0;
+		};
+
+		// Registers the calling thread while it is alive
+		class Registration
+		{
+		public:
+			Registration(const String &role, const String &app_name = "", const String &stream_name = "")
+			{
+				ThreadRegistry::Register(role, app_name, stream_name);
+			}
+
+			~Registration()
+			{
+				ThreadRegistry::Unregister();
+			}
+
+			Registration(const Registration &) = delete;
+			Registration &operator=(const Registration &) = delete;
+		};
+
+		ThreadRegistry() = delete;
+
+		// Registers/unregisters the calling thread
+		static void Register(const String &role, const String &app_name = "", const String &stream_name = "");
+		static void Unregister();
+
+		// Returns all threads of the process including the threads that are not registered (e.g. the threads of the libraries).
+		// The CPU time is sampled twice <interval_ms> apart to calculate the usage, so this blocks during <interval_ms>.
+		static std::vector<ThreadInfo> GetThreadInfoList(int64_t interval_ms);
+
+	private:
+		struct Role
+		{
+			String role;
+			String app_name;
+			String stream_name;
+		};
+
+		// thread id => CPU time (ms)
+		static std::unordered_map<uint64_t, int64_t> GetCpuTimes(std::unordered_map<uint64_t, String> *names);
+
+		static std::mutex _mutex;
+		static std::unordered_map<uint64_t, Role> _role_map;
+	};
+}  // namespace ov
@@ -0,0 +1,355 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "./timer_wheel.h"
+
+#include <algorithm>
+#include <chrono>
+
+#include "./ovdata_structure.h"
+
+namespace ov
+{
+	namespace
+	{
+		int64_t GetNowMsec()
+		{
+			return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+		}
+
+		// Number of slots from <start> to the first slot that has timers (wraps around the slots)
+		int GetDistanceToFirstSlot(uint64_t bitmap, int start)
+		{
+			auto rotated = (start == 0) ? bitmap : ((bitmap >> start) | (bitmap << (64 - start)));
+			return __builtin_ctzll(rotated);
+		}
+	}  // namespace
+
+	TimerWheel::TimerWheel(int tick_msec)
+		: _tick_msec(std::max(tick_msec, 1))
+	{
+		_current_tick = GetNowTick();
+	}
+
+	TimerWheel::~TimerWheel()
+	{
+		Clear();
+	}
+
+	uint64_t TimerWheel::GetNowTick() const
+	{
+		return static_cast<uint64_t>(GetNowMsec() / _tick_msec);
+	}
+
+	uint64_t TimerWheel::GetExpireTick(int after_msec) const
+	{
+		// Rounds up, so a timer never expires earlier than <after_msec>
+		return static_cast<uint64_t>((GetNowMsec() + std::max(after_msec, 0) + _tick_msec - 1) / _tick_msec);
+	}
+
+	TimerWheel::TimerId TimerWheel::Schedule(int after_msec, TimerFunction function)
+	{
+		auto timer = new Timer();
+
+		timer->after_msec = after_msec;
+		timer->expire_tick = GetExpireTick(after_msec);
+		timer->function = std::move(function);
+
+		std::lock_guard lock_guard(_mutex);
+
+		timer->id = ++_last_timer_id;
+		_timer_map[timer->id] = timer;
+		AddTimer(timer);
+
+		return timer->id;
+	}
+
+	bool TimerWheel::Reschedule(TimerId timer_id, int after_msec)
+	{
+		auto expire_tick = GetExpireTick(after_msec);
+
+		std::lock_guard lock_guard(_mutex);
+
+		auto item = _timer_map.find(timer_id);
+
+		if ((item == _timer_map.end()) || (item->second->level < 0))
+		{
+			return false;
+		}
+
+		auto timer = item->second;
+
+		RemoveTimer(timer);
+		timer->after_msec = after_msec;
+		timer->expire_tick = expire_tick;
+		AddTimer(timer);
+
+		return true;
+	}
+
+	bool TimerWheel::Cancel(TimerId timer_id)
+	{
+		std::lock_guard lock_guard(_mutex);
+
+		auto item = _timer_map.find(timer_id);
+
+		if (item == _timer_map.end())
+		{
+			return false;
+		}
+
+		auto timer = item->second;
+		_timer_map.erase(item);
+
+		if (timer->level < 0)
+		{
+			// Deleted by Advance() after it is run
+			timer->cancelled = true;
+		}
+		else
+		{
+			RemoveTimer(timer);
+			delete timer;
+		}
+
+		return true;
+	}
+
+	void TimerWheel::Clear()
+	{
+		std::lock_guard lock_guard(_mutex);
+
+		for (auto &item : _timer_map)
+		{
+			auto timer = item.second;
+
+			if (timer->level < 0)
+			{
+				timer->cancelled = true;
+			}
+			else
+			{
+				RemoveTimer(timer);
+				delete timer;
+			}
+		}
+
+		_timer_map.clear();
+	}
+
+	size_t TimerWheel::GetCount() const
+	{
+		std::lock_guard lock_guard(_mutex);
+
+		return _timer_map.size();
+	}
+
+	void TimerWheel::AddTimer(Timer *timer)
+	{
+		auto delta = std::min((std::max(timer->expire_tick, _current_tick) - _current_tick), MaxTicks);
+		auto expire_tick = _current_tick + delta;
+
+		// The lowest level that covers <delta>
+		int level = 0;
+		while ((level < (TIMER_WHEEL_LEVEL_COUNT - 1)) && (delta >= (1ULL << (TIMER_WHEEL_SLOT_BITS * (level + 1)))))
+		{
+			level++;
+		}
+
+		int slot_index = static_cast<int>((expire_tick >> (TIMER_WHEEL_SLOT_BITS * level)) & SlotMask);
+		auto &slot = _slot_list[level][slot_index];
+
+		timer->level = level;
+		timer->slot = slot_index;
+		timer->prev = slot.tail;
+		timer->next = nullptr;
+
+		if (slot.tail != nullptr)
+		{
+			slot.tail->next = timer;
+		}
+		else
+		{
+			slot.head = timer;
+		}
+
+		slot.tail = timer;
+		_slot_bitmap[level] |= (1ULL << slot_index);
+	}
+
+	void TimerWheel::RemoveTimer(Timer *timer)
+	{
+		auto &slot = _slot_list[timer->level][timer->slot];
+
+		((timer->prev != nullptr) ? timer->prev->next : slot.head) = timer->next;
+		((timer->next != nullptr) ? timer->next->prev : slot.tail) = timer->prev;
+
+		if (slot.head == nullptr)
+		{
+			_slot_bitmap[timer->level] &= ~(1ULL << timer->slot);
+		}
+
+		timer->level = -1;
+		timer->prev = nullptr;
+		timer->next = nullptr;
+	}
+
+	void TimerWheel::Cascade(int level, int slot_index)
+	{
+		auto &slot = _slot_list[level][slot_index];
+
+		while (slot.head != nullptr)
+		{
+			auto timer = slot.head;
+
+			RemoveTimer(timer);
+			AddTimer(timer);
+		}
+	}
+
+	int TimerWheel::GetNextTimeoutTicks() const
+	{
+		uint64_t next_ticks = UINT64_MAX;
+
+		for (int level = 0; level < TIMER_WHEEL_LEVEL_COUNT; level++)
+		{
+			auto bitmap = _slot_bitmap[level];
+
+			if (bitmap == 0)
+			{
+				continue;
+			}
+
+			// The slots of a level are processed (cascaded for the upper levels) at the ticks whose lower bits are 0
+			auto shift = TIMER_WHEEL_SLOT_BITS * level;
+			auto first_index = (_current_tick + (1ULL << shift) - 1) >> shift;
+			auto index = first_index + GetDistanceToFirstSlot(bitmap, static_cast<int>(first_index & SlotMask));
+
+			next_ticks = std::min<uint64_t>(next_ticks, (index << shift) - _current_tick);
+		}
+
+		return (next_ticks == UINT64_MAX) ? -1 : static_cast<int>(std::min<uint64_t>(next_ticks, INT32_MAX));
+	}
+
+	int TimerWheel::GetNextTimeoutMsec() const
+	{
+		std::lock_guard lock_guard(_mutex);
+
+		auto next_ticks = GetNextTimeoutTicks();
+
+		if (next_ticks < 0)
+		{
+			return Infinite;
+		}
+
+		auto next_msec = (static_cast<int64_t>(_current_tick) + next_ticks) * _tick_msec - GetNowMsec();
+
+		return static_cast<int>(std::clamp<int64_t>(next_msec, 0, Infinite));
+	}
+
+	size_t TimerWheel::Advance()
+	{
+		std::vector<Timer *> expired_list;
+
+		{
+			std::lock_guard lock_guard(_mutex);
+
+			auto now_tick = GetNowTick();
+
+			while (_current_tick <= now_tick)
+			{
+				auto next_ticks = GetNextTimeoutTicks();
+
+				if ((next_ticks < 0) || ((_current_tick + next_ticks) > now_tick))
+				{
+					// Nothing to do until now
+					_current_tick = now_tick + 1;
+					break;
+				}
+
+				// Skips the ticks that have nothing to do
+				_current_tick += next_ticks;
+
+				auto slot_index = static_cast<int>(_current_tick & SlotMask);
+
+				if (slot_index == 0)
+				{
+					// The lower level is wrapped around, so the timers of the upper level are moved down
+					for (int level = 1; level < TIMER_WHEEL_LEVEL_COUNT; level++)
+					{
+						auto upper_slot_index = static_cast<int>((_current_tick >> (TIMER_WHEEL_SLOT_BITS * level)) & SlotMask);
+
+						Cascade(level, upper_slot_index);
+
+						if (upper_slot_index != 0)
+						{
+							break;
+						}
+					}
+				}
+
+				auto &slot = _slot_list[0][slot_index];
+
+				while (slot.head != nullptr)
+				{
+					auto timer = slot.head;
+
+					RemoveTimer(timer);
+
+					if (timer->expire_tick > _current_tick)
+					{
+						// Scheduled beyond the range of the wheel
+						AddTimer(timer);
+					}
+					else
+					{
+						expired_list.push_back(timer);
+					}
+				}
+
+				_current_tick++;
+			}
+		}
+
+		size_t run_count = 0;
+
+		for (auto timer : expired_list)
+		{
+			{
+				std::lock_guard lock_guard(_mutex);
+
+				if (timer->cancelled)
+				{
+					delete timer;
+					continue;
+				}
+			}
+
+			auto action = timer->function();
+			run_count++;
+
+			std::lock_guard lock_guard(_mutex);
+
+			if (timer->cancelled)
+			{
+				delete timer;
+			}
+			else if (action == DelayQueueAction::Stop)
+			{
+				_timer_map.erase(timer->id);
+				delete timer;
+			}
+			else
+			{
+				timer->expire_tick = GetExpireTick(timer->after_msec);
+				AddTimer(timer);
+			}
+		}
+
+		return run_count;
+	}
+}  // namespace ov
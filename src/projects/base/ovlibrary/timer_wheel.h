@@ -0,0 +1,120 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+// Number of bits of the slot index of a level (64 slots per level)
+#define TIMER_WHEEL_SLOT_BITS 6
+// Number of levels. A timer can be scheduled up to (2 ^ (TIMER_WHEEL_SLOT_BITS * TIMER_WHEEL_LEVEL_COUNT)) ticks at once,
+// and the longer timers are rescheduled when they reach the end of the wheel
+#define TIMER_WHEEL_LEVEL_COUNT 4
+
+namespace ov
+{
+	enum class DelayQueueAction : char
+	{
+		Stop,
+		Repeat
+	};
+
+	// Hierarchical timer wheel
+	//
+	// A timer is put into the slot of the level that covers its remaining ticks, and moved to the lower levels
+	// as the wheel advances, so Schedule() and Cancel() take O(1) regardless of the number of timers.
+	// This is suitable for a large number of timers (e.g. a timer per session) that are mostly cancelled or
+	// rescheduled before they expire.
+	//
+	// The timers are scheduled/cancelled from any thread, and run by the thread that calls Advance()
+	// (usually the worker thread that owns the wheel, so the callbacks do not need to wake another thread).
+	class TimerWheel
+	{
+	public:
+		typedef uint64_t TimerId;
+		static constexpr TimerId InvalidTimerId = 0;
+
+		// Returns DelayQueueAction::Repeat to run the timer again after the same delay
+		typedef std::function<DelayQueueAction()> TimerFunction;
+
+		explicit TimerWheel(int tick_msec = 1);
+		~TimerWheel();
+
+		TimerId Schedule(int after_msec, TimerFunction function);
+		// Returns false if the timer is not found (already expired or cancelled)
+		bool Reschedule(TimerId timer_id, int after_msec);
+		// Returns false if the timer is not found. If the timer is running, it will not be repeated.
+		bool Cancel(TimerId timer_id);
+
+		void Clear();
+
+		size_t GetCount() const;
+
+		// Runs the timers expired until now, and returns the number of the timers that were run.
+		// Must not be called by several threads at the same time.
+		size_t Advance();
+
+		// Milliseconds until Advance() needs to be called again (Infinite if there is no timer)
+		int GetNextTimeoutMsec() const;
+
+	protected:
+		struct Timer
+		{
+			TimerId id = InvalidTimerId;
+			int after_msec = 0;
+			uint64_t expire_tick = 0;
+			TimerFunction function;
+
+			// The position in the wheel (level is -1 if the timer is not in the wheel)
+			int level = -1;
+			int slot = 0;
+			Timer *prev = nullptr;
+			Timer *next = nullptr;
+
+			// Cancel() is called while the timer is running
+			bool cancelled = false;
+		};
+
+		struct Slot
+		{
+			Timer *head = nullptr;
+			Timer *tail = nullptr;
+		};
+
+		static constexpr int SlotCount = 1 << TIMER_WHEEL_SLOT_BITS;
+		static constexpr uint64_t SlotMask = SlotCount - 1;
+		static constexpr uint64_t MaxTicks = (1ULL << (TIMER_WHEEL_SLOT_BITS * TIMER_WHEEL_LEVEL_COUNT)) - 1;
+
+		uint64_t GetNowTick() const;
+		uint64_t GetExpireTick(int after_msec) const;
+
+		// Must be called while _mutex is locked
+		void AddTimer(Timer *timer);
+		void RemoveTimer(Timer *timer);
+		void Cascade(int level, int slot);
+		int GetNextTimeoutTicks() const;
+
+		const int _tick_msec;
+
+		mutable std::mutex _mutex;
+
+		TimerId _last_timer_id = InvalidTimerId;
+		// The next tick to be processed
+		uint64_t _current_tick = 0;
+
+		Slot _slot_list[TIMER_WHEEL_LEVEL_COUNT][SlotCount];
+		// Bit N is set if the slot N of the level has timers
+		uint64_t _slot_bitmap[TIMER_WHEEL_LEVEL_COUNT] = {};
+
+		// Including the running timers
+		std::unordered_map<TimerId, Timer *> _timer_map;
+	};
+}  // namespace ov
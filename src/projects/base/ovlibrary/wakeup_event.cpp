@@ -0,0 +1,143 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "./wakeup_event.h"
+
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
+#if defined(__linux__)
+#	include <linux/futex.h>
+#	include <sys/syscall.h>
+#	include <unistd.h>
+#endif
+
+namespace ov
+{
+	void WakeupEvent::Notify()
+	{
+		// Already set: the waiter has not consumed the previous notification yet, so it will see this one too
+		if (_state.exchange(1, std::memory_order_seq_cst) != 0)
+		{
+			return;
+		}
+
+		if (_parked_count.load(std::memory_order_seq_cst) == 0)
+		{
+			return;
+		}
+
+#if defined(__linux__)
+		::syscall(SYS_futex, reinterpret_cast<uint32_t *>(&_state), FUTEX_WAKE_PRIVATE, 1, nullptr, nullptr, 0);
+#else
+		std::lock_guard<std::mutex> lock(_mutex);
+		_condition.notify_one();
+#endif
+	}
+
+	bool WakeupEvent::TryConsume()
+	{
+		// Reads first not to take the cache line from the notifier while spinning
+		return (_state.load(std::memory_order_relaxed) != 0) &&
+			   (_state.exchange(0, std::memory_order_acquire) != 0);
+	}
+
+	void WakeupEvent::Wait()
+	{
+		Park(-1);
+	}
+
+	bool WakeupEvent::WaitFor(uint32_t timeout_delta_msec)
+	{
+		return Park(timeout_delta_msec);
+	}
+
+	bool WakeupEvent::Park(int64_t timeout_delta_msec)
+	{
+		for (int spin = 0; spin < OV_WAKEUP_EVENT_SPIN_COUNT; spin++)
+		{
+			if (TryConsume())
+			{
+				return true;
+			}
+
+			CpuRelax();
+		}
+
+		for (int yield = 0; yield < OV_WAKEUP_EVENT_YIELD_COUNT; yield++)
+		{
+			if (TryConsume())
+			{
+				return true;
+			}
+
+			std::this_thread::yield();
+		}
+
+		auto expire = std::chrono::steady_clock::now() + std::chrono::milliseconds(std::max<int64_t>(timeout_delta_msec, 0));
+		bool signalled = false;
+
+		// Notify() reads _parked_count after setting _state, so either it wakes this thread up,
+		// or this thread sees _state set below
+		_parked_count.fetch_add(1, std::memory_order_seq_cst);
+
+		while (true)
+		{
+			if (_state.exchange(0, std::memory_order_seq_cst) != 0)
+			{
+				signalled = true;
+				break;
+			}
+
+			std::chrono::milliseconds remaining{0};
+
+			if (timeout_delta_msec >= 0)
+			{
+				remaining = std::chrono::duration_cast<std::chrono::milliseconds>(expire - std::chrono::steady_clock::now());
+
+				if (remaining.count() <= 0)
+				{
+					break;
+				}
+			}
+
+#if defined(__linux__)
+			struct timespec timeout;
+			struct timespec *timeout_ptr = nullptr;
+
+			if (timeout_delta_msec >= 0)
+			{
+				timeout.tv_sec = remaining.count() / 1000;
+				timeout.tv_nsec = (remaining.count() % 1000) * 1000000;
+				timeout_ptr = &timeout;
+			}
+
+			// Sleeps only if _state is still 0 (returns immediately with EAGAIN otherwise)
+			::syscall(SYS_futex, reinterpret_cast<uint32_t *>(&_state), FUTEX_WAIT_PRIVATE, 0, timeout_ptr, nullptr, 0);
+#else
+			std::unique_lock<std::mutex> lock(_mutex);
+
+			if (_state.load(std::memory_order_seq_cst) == 0)
+			{
+				if (timeout_delta_msec >= 0)
+				{
+					_condition.wait_for(lock, remaining);
+				}
+				else
+				{
+					_condition.wait(lock);
+				}
+			}
+#endif
+		}
+
+		_parked_count.fetch_sub(1, std::memory_order_seq_cst);
+
+		return signalled;
+	}
+}  // namespace ov
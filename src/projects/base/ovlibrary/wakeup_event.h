@@ -0,0 +1,77 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+#if defined(__x86_64__) || defined(__i386__)
+#	include <immintrin.h>
+#endif
+
+#if !defined(__linux__)
+#	include <condition_variable>
+#	include <mutex>
+#endif
+
+// Number of times the waiter checks the event before yielding the CPU
+#define OV_WAKEUP_EVENT_SPIN_COUNT 128
+// Number of times the waiter yields the CPU before sleeping in the kernel
+#define OV_WAKEUP_EVENT_YIELD_COUNT 4
+
+namespace ov
+{
+	// Hints the CPU that the thread is spinning
+	inline void CpuRelax()
+	{
+#if defined(__x86_64__) || defined(__i386__)
+		_mm_pause();
+#elif defined(__aarch64__)
+		asm volatile("yield" ::: "memory");
+#endif
+	}
+
+	// An auto-reset event for a worker thread that drains its queues:
+	//
+	//   while (running)
+	//   {
+	//       if (ProcessQueuedItem() == false)
+	//       {
+	//           event.Wait();
+	//       }
+	//   }
+	//
+	// Unlike Semaphore, the notifications are not counted. Notify() sets the event once, no matter how many
+	// items were queued until the waiter wakes up. Notify() enters the kernel (FUTEX_WAKE) only if the event
+	// changes from not-set to set and the waiter is sleeping. The waiter spins and yields briefly before
+	// sleeping (FUTEX_WAIT), so a busy worker does not sleep between the packets.
+	class WakeupEvent
+	{
+	public:
+		void Notify();
+
+		void Wait();
+		// return false : timed out, return true : signalled
+		bool WaitFor(uint32_t timeout_delta_msec);
+
+	private:
+		// Returns true and resets the event if it is set
+		bool TryConsume();
+		bool Park(int64_t timeout_delta_msec);
+
+		// 0: not set, 1: set (the futex word)
+		std::atomic<uint32_t> _state{0};
+		// Number of the threads sleeping in Park()
+		std::atomic<uint32_t> _parked_count{0};
+
+#if !defined(__linux__)
+		std::mutex _mutex;
+		std::condition_variable _condition;
+#endif
+	};
+}  // namespace ov
@@ -8,29 +8,41 @@
 //==============================================================================
 #pragma once
 
+#include <brotli/encode.h>
 #include <zlib.h>
+
 #include "ovlibrary.h"
 
+// Brotli quality (0~11) used when it is not specified. The playlists are compressed whenever they are updated,
+// so a middle quality is used, which is as fast as gzip and still gives smaller outputs.
+#define OV_ZIP_DEFAULT_BROTLI_QUALITY 5
+
 namespace ov
 {
 	class Zip
 	{
 	public:
-		static std::shared_ptr<ov::Data> CompressGzip(const std::shared_ptr<ov::Data> &input)
+		// <level>: 1 (fastest) ~ 9 (smallest), or Z_DEFAULT_COMPRESSION
+		static std::shared_ptr<ov::Data> CompressGzip(const std::shared_ptr<ov::Data> &input, int level = Z_DEFAULT_COMPRESSION)
 		{
-			auto output = std::make_shared<ov::Data>(input->GetLength());
-			output->SetLength(input->GetLength());
-
 			z_stream zs;
 			zs.zalloc = Z_NULL;
 			zs.zfree = Z_NULL;
 			zs.opaque = Z_NULL;
+
+			deflateInit2(&zs, level, Z_DEFLATED, 15 | 16, 8, Z_DEFAULT_STRATEGY);
+
+			// A small or incompressible input can be larger than the input after compressed (e.g. the gzip header),
+			// so the output is sized by the bound of deflate to finish in a call
+			auto output_length = deflateBound(&zs, input->GetLength());
+			auto output = std::make_shared<ov::Data>(output_length);
+			output->SetLength(output_length);
+
 			zs.avail_in = (uInt)input->GetLength();
 			zs.next_in = (Bytef *)input->GetDataAs<Bytef>();
 			zs.avail_out = (uInt)output->GetLength();
-			zs.next_out = (Bytef *)output->GetWritableDataAs<Bytef>();;
+			zs.next_out = (Bytef *)output->GetWritableDataAs<Bytef>();
 
-			deflateInit2(&zs, Z_DEFAULT_COMPRESSION, Z_DEFLATED, 15 | 16, 8, Z_DEFAULT_STRATEGY);
 			deflate(&zs, Z_FINISH);
 			deflateEnd(&zs);
 
@@ -38,6 +50,30 @@ namespace ov
 			return output;
 		}
 
+		// <quality>: BROTLI_MIN_QUALITY (0, fastest) ~ BROTLI_MAX_QUALITY (11, smallest)
+		static std::shared_ptr<ov::Data> CompressBrotli(const std::shared_ptr<const ov::Data> &input, int quality = OV_ZIP_DEFAULT_BROTLI_QUALITY)
+		{
+			size_t output_length = ::BrotliEncoderMaxCompressedSize(input->GetLength());
+			if (output_length == 0)
+			{
+				return nullptr;
+			}
+
+			auto output = std::make_shared<ov::Data>(output_length);
+			output->SetLength(output_length);
+
+			if (::BrotliEncoderCompress(
+					std::clamp(quality, BROTLI_MIN_QUALITY, BROTLI_MAX_QUALITY), BROTLI_DEFAULT_WINDOW, BROTLI_MODE_TEXT,
+					input->GetLength(), input->GetDataAs<uint8_t>(),
+					&output_length, output->GetWritableDataAs<uint8_t>()) == BROTLI_FALSE)
+			{
+				return nullptr;
+			}
+
+			output->SetLength(output_length);
+			return output;
+		}
+
 		static std::shared_ptr<ov::Data> DecompressGzip(const std::shared_ptr<ov::Data> &input)
 		{
 			return nullptr;
@@ -195,9 +195,16 @@ namespace ov
 
 		auto &data_callback = server_socket->GetDataCallback();
 
+		if (GetType() == SocketType::Srt)
+		{
+			ReadSrtMessages(data_callback);
+			return;
+		}
+
 		auto data = std::make_shared<Data>(TcpBufferSize);
 
-		while (true)
+		// If the read is paused in the callback, the rest is read after ResumeRead()
+		while (IsReadPaused() == false)
 		{
 			auto error = Recv(data);
 
@@ -240,6 +247,51 @@ namespace ov
 		}
 	}
 
+	// srt_recvmsg2() returns only one message (<= MaxSrtPacketSize) per call, so the messages are gathered
+	// into a single buffer until the receive buffer of libsrt is empty and then delivered at once
+	void ClientSocket::ReadSrtMessages(const ClientDataCallback &data_callback)
+	{
+		auto data = std::make_shared<Data>(MaxSrtPacketSize * MaxSrtRecvBatchCount);
+
+		while (IsReadPaused() == false)
+		{
+			data->SetLength(data->GetCapacity());
+
+			auto buffer = data->GetWritableDataAs<uint8_t>();
+			size_t offset = 0;
+			std::shared_ptr<const SocketError> error;
+
+			while ((data->GetCapacity() - offset) >= MaxSrtPacketSize)
+			{
+				size_t read_bytes = 0;
+				error = Recv(buffer + offset, MaxSrtPacketSize, &read_bytes);
+
+				if ((error != nullptr) || (read_bytes == 0))
+				{
+					break;
+				}
+
+				offset += read_bytes;
+			}
+
+			data->SetLength(offset);
+
+			// Deliver the messages received before the error (the socket is already closed by Recv() if it is disconnected)
+			if ((offset > 0) && (data_callback != nullptr))
+			{
+				data_callback(GetSharedPtrAs<ClientSocket>(), data->Clone());
+			}
+
+			if ((error != nullptr) || ((data->GetCapacity() - offset) >= MaxSrtPacketSize))
+			{
+				// An error occurred, or the receive buffer is empty (EAGAIN)
+				break;
+			}
+
+			// The buffer is full, so there may be more messages to read
+		}
+	}
+
 	void ClientSocket::OnClosed()
 	{
 		auto server_socket = _server_socket.lock();
@@ -35,6 +35,9 @@ namespace ov
 		bool StoreSrtStreamId();	// Only available if socket is SRT
 		bool RetrieveLocalAddress();
 
+		// Only available if socket is SRT
+		void ReadSrtMessages(const ClientDataCallback &data_callback);
+
 		//--------------------------------------------------------------------
 		// Implementation of SocketAsyncInterface
 		//--------------------------------------------------------------------
@@ -31,6 +31,28 @@ namespace ov
 	}
 
 	bool DatagramSocket::Prepare(const SocketAddress &address, DatagramCallback datagram_callback)
+	{
+		if (PrepareInternal(address))
+		{
+			_datagram_callback = std::move(datagram_callback);
+			return true;
+		}
+
+		return false;
+	}
+
+	bool DatagramSocket::Prepare(const SocketAddress &address, DatagramBatchCallback datagram_batch_callback)
+	{
+		if (PrepareInternal(address))
+		{
+			_datagram_batch_callback = std::move(datagram_batch_callback);
+			return true;
+		}
+
+		return false;
+	}
+
+	bool DatagramSocket::PrepareInternal(const SocketAddress &address)
 	{
 		CHECK_STATE(== SocketState::Created, false);
 
@@ -40,8 +62,6 @@ namespace ov
 				SetSockOpt<int>(SO_REUSEADDR, 1) &&
 				Bind(address)))
 		{
-			_datagram_callback = std::move(datagram_callback);
-
 			return true;
 		}
 
@@ -67,36 +87,69 @@ namespace ov
 	{
 		logtp("Trying to read UDP packets...");
 
-		auto data = std::make_shared<ov::Data>(UdpBufferSize);
+		if (_recv_buffer_list.empty())
+		{
+			_recv_buffer_list.reserve(MaxDatagramBatchCount);
+
+			for (int index = 0; index < MaxDatagramBatchCount; index++)
+			{
+				_recv_buffer_list.push_back(std::make_shared<ov::Data>(UdpBufferSize));
+			}
+		}
+
+		std::vector<Datagram> datagrams;
 
 		while (true)
 		{
-			SocketAddress remote;
-			auto error = RecvFrom(data, &remote);
+			size_t received_count = 0;
+			auto error = RecvFromMultiple(_recv_buffer_list, _recv_address_list, &received_count);
 
-			if (error == nullptr)
+			if (error != nullptr)
 			{
-				if (data->GetLength() == 0L)
-				{
-					// Try later
-					break;
-				}
-				else
+				// An error occurred
+				break;
+			}
+
+			if (received_count == 0)
+			{
+				// Try later
+				break;
+			}
+
+			// The received buffers are handed to the callback as they are, and replaced with the new ones from ov::DataPool.
+			// (a buffer returns to the pool when the consumer releases the datagram)
+			if (_datagram_batch_callback != nullptr)
+			{
+				datagrams.clear();
+				datagrams.reserve(received_count);
+
+				for (size_t index = 0; index < received_count; index++)
 				{
-					if (_datagram_callback != nullptr)
-					{
-						_datagram_callback(GetSharedPtrAs<DatagramSocket>(), remote, data->Clone());
-					}
+					datagrams.push_back({_recv_address_list[index], TakeRecvBuffer(index)});
 				}
+
+				_datagram_batch_callback(GetSharedPtrAs<DatagramSocket>(), datagrams);
 			}
-			else
+			else if (_datagram_callback != nullptr)
 			{
-				// An error occurred
-				break;
+				auto socket = GetSharedPtrAs<DatagramSocket>();
+
+				for (size_t index = 0; index < received_count; index++)
+				{
+					_datagram_callback(socket, _recv_address_list[index], TakeRecvBuffer(index));
+				}
 			}
 		}
 	}
 
+	std::shared_ptr<Data> DatagramSocket::TakeRecvBuffer(size_t index)
+	{
+		auto data = std::move(_recv_buffer_list[index]);
+		_recv_buffer_list[index] = std::make_shared<ov::Data>(UdpBufferSize);
+
+		return data;
+	}
+
 	String DatagramSocket::ToString() const
 	{
 		return Socket::ToString("DatagramSocket");
@@ -13,6 +13,15 @@
 
 namespace ov
 {
+	struct Datagram
+	{
+		SocketAddress remote_address;
+		std::shared_ptr<Data> data;
+	};
+
+	// Called once per recvmmsg() with all datagrams received at that time
+	typedef std::function<void(const std::shared_ptr<ov::DatagramSocket> &client, const std::vector<Datagram> &datagrams)> DatagramBatchCallback;
+
 	class DatagramSocket : public Socket, public SocketAsyncInterface
 	{
 	public:
@@ -27,6 +36,8 @@ namespace ov
 		bool Prepare(int port, DatagramCallback datagram_callback);
 		// address에 해당하는 주소로 bind
 		bool Prepare(const SocketAddress &address, DatagramCallback datagram_callback);
+		// address에 해당하는 주소로 bind, 수신된 datagram들을 한 번에 전달
+		bool Prepare(const SocketAddress &address, DatagramBatchCallback datagram_batch_callback);
 
 		using Socket::Close;
 		using Socket::Connect;
@@ -59,6 +70,15 @@ namespace ov
 			OV_ASSERT2(false);
 		}
 
+		bool PrepareInternal(const SocketAddress &address);
+		// Returns the buffer of the datagram received at <index>, and replaces it with a new buffer for the next recvmmsg()
+		std::shared_ptr<Data> TakeRecvBuffer(size_t index);
+
 		DatagramCallback _datagram_callback = nullptr;
+		DatagramBatchCallback _datagram_batch_callback = nullptr;
+
+		// Receive buffers of the next recvmmsg() call (only accessed from the worker thread)
+		std::vector<std::shared_ptr<Data>> _recv_buffer_list;
+		std::vector<SocketAddress> _recv_address_list;
 	};
 }  // namespace ov
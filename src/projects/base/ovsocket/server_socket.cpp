@@ -10,6 +10,10 @@
 
 #include <netinet/tcp.h>
 
+#if IS_LINUX
+#	include <linux/filter.h>
+#endif	// IS_LINUX
+
 #include "client_socket.h"
 #include "socket_pool/socket_pool.h"
 #include "socket_pool/socket_pool_worker.h"
@@ -92,7 +96,10 @@ namespace ov
 
 			logad("Trying to allocate a socket for client: %s", remote_address.ToString(false).CStr());
 
-			auto client = _pool->AllocSocket<ClientSocket>(remote_address.GetFamily(), GetSharedPtrAs<ServerSocket>(), client_socket, remote_address);
+			// When SO_REUSEPORT is used, every worker has its own listener, so the client stays on the same worker
+			auto client = _reuse_port
+							  ? _pool->AllocSocketOnWorker<ClientSocket>(GetSocketPoolWorker(), remote_address.GetFamily(), GetSharedPtrAs<ServerSocket>(), client_socket, remote_address)
+							  : _pool->AllocSocket<ClientSocket>(remote_address.GetFamily(), GetSharedPtrAs<ServerSocket>(), client_socket, remote_address);
 
 			if (client != nullptr)
 			{
@@ -120,6 +127,38 @@ namespace ov
 		}
 	}
 
+	bool ServerSocket::AttachReusePortCpuSteering(int group_size)
+	{
+		if ((_reuse_port == false) || (GetType() != SocketType::Tcp) || (group_size <= 0))
+		{
+			logae("Could not attach CPU steering program: not a SO_REUSEPORT TCP socket (group size: %d)", group_size);
+			return false;
+		}
+
+#if IS_LINUX && defined(SO_ATTACH_REUSEPORT_CBPF)
+		// A = current CPU, A = A % group_size, return A
+		sock_filter code[] = {
+			{BPF_LD | BPF_W | BPF_ABS, 0, 0, static_cast<uint32_t>(SKF_AD_OFF + SKF_AD_CPU)},
+			{BPF_ALU | BPF_MOD | BPF_K, 0, 0, static_cast<uint32_t>(group_size)},
+			{BPF_RET | BPF_A, 0, 0, 0}};
+
+		sock_fprog program{};
+		program.len = OV_COUNTOF(code);
+		program.filter = code;
+
+		if (SetSockOpt(SOL_SOCKET, SO_ATTACH_REUSEPORT_CBPF, &program, sizeof(program)))
+		{
+			logad("CPU steering program is attached (group size: %d)", group_size);
+			return true;
+		}
+
+		return false;
+#else	// IS_LINUX && defined(SO_ATTACH_REUSEPORT_CBPF)
+		logaw("SO_ATTACH_REUSEPORT_CBPF is not supported on this platform");
+		return false;
+#endif	// IS_LINUX && defined(SO_ATTACH_REUSEPORT_CBPF)
+	}
+
 	bool ServerSocket::OnClientDisconnected(const std::shared_ptr<ClientSocket> &client)
 	{
 		std::lock_guard lock_guard(_client_list_mutex);
@@ -180,6 +219,11 @@ namespace ov
 			case SocketType::Tcp: {
 				result &= SetSockOpt<int>(SO_REUSEADDR, 1);
 
+				if (_reuse_port)
+				{
+					result &= SetSockOpt<int>(SO_REUSEPORT, 1);
+				}
+
 				// Disable Nagle's algorithm
 				result &= SetSockOpt<int>(IPPROTO_TCP, TCP_NODELAY, 1);
 
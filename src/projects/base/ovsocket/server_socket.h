@@ -48,6 +48,25 @@ namespace ov
 
 		std::shared_ptr<ClientSocket> Accept();
 
+		// Must be called before Prepare()
+		//
+		// If enabled, SO_REUSEPORT is set so that each worker can have its own listening socket on the same address,
+		// and the clients accepted by this socket are kept on the worker of this socket
+		void SetReusePort(bool reuse_port)
+		{
+			_reuse_port = reuse_port;
+		}
+
+		bool IsReusePort() const
+		{
+			return _reuse_port;
+		}
+
+		// Attaches a classic BPF program to the SO_REUSEPORT group of this socket,
+		// which steers new connections to the listener at the index of (CPU % group_size).
+		// The listeners must be bound in the order of the index.
+		bool AttachReusePortCpuSteering(int group_size);
+
 		String ToString() const override;
 
 	protected:
@@ -95,5 +114,7 @@ namespace ov
 
 		ClientConnectionCallback _connection_callback = nullptr;
 		ClientDataCallback _data_callback = nullptr;
+
+		bool _reuse_port = false;
 	};
 }  // namespace ov
@@ -12,8 +12,14 @@
 #include <errno.h>
 #include <sys/fcntl.h>
 #include <sys/ioctl.h>
+#include <sys/sendfile.h>
+#include <sys/uio.h>
 #include <unistd.h>
 
+#if IS_LINUX
+#	include <netinet/udp.h>
+#endif	// IS_LINUX
+
 #include <algorithm>
 #include <atomic>
 #include <chrono>
@@ -39,6 +45,24 @@
 
 namespace ov
 {
+	// Number of the commands in the dispatch queue when a command is appended (from 1 to 64K)
+	static Histogram send_queue_depth_histogram(
+		"ome_socket_send_queue_depth",
+		"Number of the commands waiting in the send queue of a socket",
+		1.0, 1, 64 * 1024);
+
+	// Bytes waiting to be sent when a socket is evicted (the count is the number of the evicted sockets)
+	static Histogram evicted_queued_bytes_histogram(
+		"ome_socket_evicted_queued_bytes",
+		"Bytes waiting to be sent when a socket is evicted because the peer could not receive the data fast enough",
+		1.0, 64 * 1024, 4ULL * 1024 * 1024 * 1024);
+
+	static std::atomic<size_t> send_buffer_limit{OV_SOCKET_DEFAULT_MAX_QUEUED_BYTES};
+	// 0: unlimited
+	static std::atomic<size_t> total_send_buffer_limit{0};
+	// The bytes of the data waiting to be sent in all sockets
+	static std::atomic<size_t> total_queued_bytes{0};
+
 #if USE_SOCKET_PROFILER
 	// Calculate and callback the time before and after the mutex lock and the time until the method is completely processed
 
@@ -143,6 +167,9 @@ namespace ov
 
 	Socket::~Socket()
 	{
+		// The data that remains in the queue is no longer counted
+		OnQueuedDataConsumed(_queued_bytes);
+
 		// Verify that the socket is closed normally
 		OV_ASSERT(_socket.IsValid() == false, "Socket is not closed. Current state: %s", StringFromSocketState(GetState()));
 		CHECK_STATE2(== SocketState::Closed, >= SocketState::Disconnected, );
@@ -277,28 +304,150 @@ namespace ov
 
 	bool Socket::AppendCommand(DispatchCommand command)
 	{
+		if (_has_close_command)
+		{
+			// Socket was closed
+			return false;
+		}
+
+		if (_is_evicted)
+		{
+			return false;
+		}
+
+		size_t length = (command.data != nullptr) ? command.data->GetLength() : 0;
+
+		if (length > 0)
+		{
+			auto limit = GetSendBufferLimit();
+
+			if (_send_buffer_policy == SendBufferPolicy::DropByOwner)
+			{
+				// The owner didn't drop the data in time
+				limit *= 2;
+			}
+
+			if ((_queued_bytes + length) > limit)
+			{
+				Evict(length);
+				return false;
+			}
+
+			auto max_total = total_send_buffer_limit.load();
+
+			if ((max_total > 0) && ((total_queued_bytes + length) > max_total))
+			{
+				logad("Too much data is waiting to be sent in all sockets (%zu bytes), so the data (%zu bytes) is not queued", total_queued_bytes.load(), length);
+				return false;
+			}
+		}
+
 		SOCKET_PROFILER_INIT();
-		std::lock_guard lock_guard(_dispatch_queue_lock);
+		std::lock_guard lock_guard(_pending_commands_lock);
 		SOCKET_PROFILER_AFTER_LOCK();
 
 		SOCKET_PROFILER_POST_HANDLER([&](int64_t lock_elapsed, int64_t total_elapsed) {
-			if ((lock_elapsed > 100) || (_dispatch_queue.size() > 10))
+			if ((lock_elapsed > 100) || (_pending_commands.size() > 10))
 			{
-				logtw("[SockProfiler] AppendCommand() - %s, Queue: %zu, Lock: %dms, Total: %dms", ToString().CStr(), _dispatch_queue.size(), lock_elapsed, total_elapsed);
+				logtw("[SockProfiler] AppendCommand() - %s, Queue: %zu, Lock: %dms, Total: %dms", ToString().CStr(), _pending_commands.size(), lock_elapsed, total_elapsed);
 			}
 		});
 
+		// Close() sets _has_close_command before it takes the pending commands under this lock, so the command appended
+		// after that would be dispatched after the close command
 		if (_has_close_command)
 		{
-			// Socket was closed
 			return false;
 		}
 
-		_dispatch_queue.push_back(std::move(command));
+		_pending_commands.push_back(std::move(command));
+		_pending_command_count = _pending_commands.size();
+		_queued_bytes += length;
+		total_queued_bytes += length;
+
+		send_queue_depth_histogram.Record(_dispatch_queue.size() + _pending_commands.size());
+
+		return true;
+	}
+
+	bool Socket::TakePendingCommandsInternal()
+	{
+		if (_pending_command_count == 0)
+		{
+			return false;
+		}
+
+		std::lock_guard lock_guard(_pending_commands_lock);
+
+		if (_pending_commands.empty())
+		{
+			return false;
+		}
+
+		if (_dispatch_queue.empty())
+		{
+			_dispatch_queue.swap(_pending_commands);
+		}
+		else
+		{
+			std::move(_pending_commands.begin(), _pending_commands.end(), std::back_inserter(_dispatch_queue));
+			_pending_commands.clear();
+		}
+
+		_pending_command_count = 0;
 
 		return true;
 	}
 
+	void Socket::OnQueuedDataConsumed(size_t bytes)
+	{
+		auto queued_bytes = _queued_bytes.load();
+		size_t consumed;
+
+		do
+		{
+			consumed = std::min(queued_bytes, bytes);
+		} while (_queued_bytes.compare_exchange_weak(queued_bytes, queued_bytes - consumed) == false);
+
+		total_queued_bytes -= consumed;
+	}
+
+	void Socket::Evict(size_t length)
+	{
+		if (_is_evicted.exchange(true) == false)
+		{
+			logaw("Too much data is waiting to be sent (%zu bytes, limit: %zu bytes, new data: %zu bytes) - This socket is going to be evicted",
+				  _queued_bytes.load(), GetSendBufferLimit(), length);
+
+			evicted_queued_bytes_histogram.Record(_queued_bytes);
+		}
+	}
+
+	void Socket::SetSendBufferLimits(size_t max_queued_bytes, size_t max_total_queued_bytes)
+	{
+		send_buffer_limit = max_queued_bytes;
+		total_send_buffer_limit = max_total_queued_bytes;
+	}
+
+	size_t Socket::GetTotalQueuedBytes()
+	{
+		return total_queued_bytes;
+	}
+
+	bool Socket::IsUnderMemoryPressure()
+	{
+		auto max_total = total_send_buffer_limit.load();
+
+		return (max_total > 0) && ((total_queued_bytes * 100) > (max_total * OV_SOCKET_MEMORY_PRESSURE_PERCENT));
+	}
+
+	size_t Socket::GetSendBufferLimit() const
+	{
+		auto limit = send_buffer_limit.load();
+
+		return IsUnderMemoryPressure() ? (limit / OV_SOCKET_MEMORY_PRESSURE_DIVISOR) : limit;
+	}
+
 	bool Socket::AddToWorker(bool need_to_wait_first_epoll_event)
 	{
 		if (GetType() == SocketType::Srt)
@@ -715,6 +864,9 @@ namespace ov
 				return SetSockOpt(SO_RCVTIMEO, tv);
 
 			case SocketType::Srt:
+				// Used when SRTO_RCVSYN is true (blocking mode)
+				return SetSockOpt<int>(SRTO_RCVTIMEO, static_cast<int>((tv.tv_sec * 1000) + (tv.tv_usec / 1000)));
+
 			default:
 				OV_ASSERT(false, "Not implemented");
 				return false;
@@ -817,6 +969,23 @@ namespace ov
 		return _stream_id;
 	}
 
+	// Only Available if socket is SRT
+	bool Socket::GetSrtStats(SRT_TRACEBSTATS *stats, bool clear) const
+	{
+		if ((GetType() != SocketType::Srt) || (stats == nullptr))
+		{
+			return false;
+		}
+
+		if (::srt_bstats(GetNativeHandle(), stats, clear ? 1 : 0) == SRT_ERROR)
+		{
+			logad("Could not obtain SRT stats: %s", SrtError::CreateErrorFromSrt()->What());
+			return false;
+		}
+
+		return true;
+	}
+
 	bool Socket::OnConnectedEvent(const std::shared_ptr<const SocketError> &error)
 	{
 		if (error == nullptr)
@@ -878,6 +1047,9 @@ namespace ov
 				sent_bytes = SendToInternal(command.address, data);
 				break;
 
+			case DispatchCommand::Type::SendFile:
+				return SendFileInternal(command);
+
 			case DispatchCommand::Type::HalfClose:
 				return HalfClose();
 
@@ -905,16 +1077,21 @@ namespace ov
 
 		if (sent_bytes == static_cast<ssize_t>(command.data->GetLength()))
 		{
+			OnQueuedDataConsumed(sent_bytes);
 			return DispatchResult::Dispatched;
 		}
 
 		if (sent_bytes == -1)
 		{
+			// The command will be dropped
+			OnQueuedDataConsumed(command.data->GetLength());
 			return DispatchResult::Error;
 		}
 
 		if (sent_bytes > 0)
 		{
+			OnQueuedDataConsumed(sent_bytes);
+
 			// Since some data has been sent, the time needs to be updated.
 			command.UpdateTime();
 			data = data->Subdata(sent_bytes);
@@ -949,12 +1126,47 @@ namespace ov
 				}
 			});
 
+			TakePendingCommandsInternal();
+
 			if (_dispatch_queue.empty() == false)
 			{
 				logap("Dispatching events (count: %zu)...", _dispatch_queue.size());
 
-				while (_dispatch_queue.empty() == false)
+				// The commands appended while dispatching are sent in the same round
+				while ((_dispatch_queue.empty() == false) || TakePendingCommandsInternal())
 				{
+					if ((GetType() == SocketType::Udp) &&
+						(GetState() != SocketState::Closed) &&
+						(_dispatch_queue.size() > 1) &&
+						(_dispatch_queue.front().type == DispatchCommand::Type::SendTo))
+					{
+						// Send the queued datagrams at once
+						result = DispatchSendToCommandsInternal();
+
+						if (result == DispatchResult::Dispatched)
+						{
+							continue;
+						}
+
+						break;
+					}
+
+					if ((GetType() == SocketType::Tcp) &&
+						(GetState() != SocketState::Closed) &&
+						(_dispatch_queue.size() > 1) &&
+						(_dispatch_queue.front().type == DispatchCommand::Type::Send))
+					{
+						// Send the queued buffers at once
+						result = DispatchSendCommandsInternal();
+
+						if (result == DispatchResult::Dispatched)
+						{
+							continue;
+						}
+
+						break;
+					}
+
 					auto front = _dispatch_queue.front();
 					_dispatch_queue.pop_front();
 
@@ -964,12 +1176,15 @@ namespace ov
 					{
 						// If the socket is closed during dispatching, the rest of the data will not be sent.
 						logad("Some commands have not been dispatched: %zu commands", _dispatch_queue.size());
-#if DEBUG
+
+						OnQueuedDataConsumed((front.data != nullptr) ? front.data->GetLength() : 0);
 						for (auto &queue : _dispatch_queue)
 						{
+#if DEBUG
 							logad("  - Command: %s", queue.ToString().CStr());
-						}
 #endif	// DEBUG
+							OnQueuedDataConsumed((queue.data != nullptr) ? queue.data->GetLength() : 0);
+						}
 
 						_dispatch_queue.clear();
 
@@ -1011,6 +1226,126 @@ namespace ov
 		return result;
 	}
 
+	Socket::DispatchResult Socket::DispatchSendToCommandsInternal()
+	{
+		DatagramToSend datagrams[MaxDatagramBatchCount];
+		size_t count = 0;
+
+		for (auto &command : _dispatch_queue)
+		{
+			if ((command.type != DispatchCommand::Type::SendTo) || (count == MaxDatagramBatchCount))
+			{
+				break;
+			}
+
+			datagrams[count].address = &(command.address);
+			datagrams[count].data = command.data.get();
+			count++;
+		}
+
+		logap("Dispatching %zu SendTo commands at once...", count);
+
+		auto sent_count = SendToMultipleInternal(datagrams, count);
+
+		if (sent_count < 0L)
+		{
+			// Drop the command that caused the error, like DispatchEventInternal() does
+			OnQueuedDataConsumed(_dispatch_queue.front().data->GetLength());
+			_dispatch_queue.pop_front();
+			return DispatchResult::Error;
+		}
+
+		for (ssize_t index = 0; index < sent_count; index++)
+		{
+			OnQueuedDataConsumed(_dispatch_queue.front().data->GetLength());
+			_dispatch_queue.pop_front();
+		}
+
+		if (static_cast<size_t>(sent_count) < count)
+		{
+			if (_dispatch_queue.empty() == false)
+			{
+				_dispatch_queue.front().UpdateTime();
+			}
+
+			return DispatchResult::PartialDispatched;
+		}
+
+		return DispatchResult::Dispatched;
+	}
+
+	Socket::DispatchResult Socket::DispatchSendCommandsInternal()
+	{
+		const Data *data_list[MaxIovecBatchCount];
+		size_t count = 0;
+		size_t total_length = 0;
+
+		for (auto &command : _dispatch_queue)
+		{
+			if ((command.type != DispatchCommand::Type::Send) || (count == MaxIovecBatchCount))
+			{
+				break;
+			}
+
+			data_list[count] = command.data.get();
+			total_length += command.data->GetLength();
+			count++;
+		}
+
+		logap("Dispatching %zu Send commands at once (%zu bytes)...", count, total_length);
+
+		auto sent_bytes = SendMultipleInternal(data_list, count);
+
+		if (sent_bytes < 0L)
+		{
+			// Drop the command that caused the error, like DispatchEventInternal() does
+			OnQueuedDataConsumed(_dispatch_queue.front().data->GetLength());
+			_dispatch_queue.pop_front();
+			return DispatchResult::Error;
+		}
+
+		OnQueuedDataConsumed(sent_bytes);
+
+		size_t remained = sent_bytes;
+
+		while (_dispatch_queue.empty() == false)
+		{
+			auto &front = _dispatch_queue.front();
+			auto length = front.data->GetLength();
+
+			if (remained < length)
+			{
+				if (remained > 0)
+				{
+					front.data = front.data->Subdata(remained);
+				}
+
+				break;
+			}
+
+			remained -= length;
+			_dispatch_queue.pop_front();
+
+			if (remained == 0)
+			{
+				break;
+			}
+		}
+
+		if (static_cast<size_t>(sent_bytes) < total_length)
+		{
+			if (sent_bytes > 0L)
+			{
+				// Since some data has been sent, the time needs to be updated.
+				_dispatch_queue.front().UpdateTime();
+			}
+
+			return DispatchResult::PartialDispatched;
+		}
+
+		return DispatchResult::Dispatched;
+	}
+
 	Socket::DispatchResult Socket::DispatchEvents()
 	{
 		switch (_blocking_mode)
@@ -1026,9 +1361,30 @@ namespace ov
 				return DispatchResult::Dispatched;
 
 			case BlockingMode::NonBlocking: {
-				// Due to the connection callback point, the DispatchEventsInternal() specifically performs mutex.lock inside.
-				// std::lock_guard lock_guard(_dispatch_queue_lock);
-				auto result = DispatchEventsInternal();
+				auto result = DispatchResult::Dispatched;
+
+				while (true)
+				{
+					std::unique_lock lock(_dispatch_queue_lock, std::try_to_lock);
+
+					if (lock.owns_lock() == false)
+					{
+						// Another thread is sending, and it dispatches the commands appended so far before returning
+						result = DispatchResult::PartialDispatched;
+						break;
+					}
+
+					// Due to the connection callback point, the DispatchEventsInternal() specifically performs mutex.lock inside.
+					result = DispatchEventsInternal();
+
+					lock.unlock();
+
+					// Other threads may have appended commands while this thread was sending
+					if ((result != DispatchResult::Dispatched) || (_pending_command_count == 0))
+					{
+						break;
+					}
+				}
 
 				CallCloseCallbackIfNeeded();
 
@@ -1172,6 +1528,88 @@ namespace ov
 		return total_sent;
 	}
 
+	Socket::DispatchResult Socket::SendFileInternal(DispatchCommand &command)
+	{
+		if (GetState() == SocketState::Closed)
+		{
+			return DispatchResult::Error;
+		}
+
+		const auto &file = command.file;
+		const off_t end_offset = command.file_offset + static_cast<off_t>(command.file_length);
+		bool is_sent = false;
+
+		while ((command.file_length > 0) && (_force_stop == false))
+		{
+			// Keep the next window in the page cache before sendfile() reaches it, so it rarely waits for the disk
+			if ((command.file_readahead_end < end_offset) &&
+				((command.file_readahead_end - command.file_offset) < (OV_SOCKET_SENDFILE_READAHEAD_SIZE / 2)))
+			{
+				auto readahead_length = std::min<off_t>(OV_SOCKET_SENDFILE_READAHEAD_SIZE, end_offset - command.file_readahead_end);
+
+				file->ReadAhead(command.file_readahead_end, readahead_length);
+				command.file_readahead_end += readahead_length;
+			}
+
+			off_t offset = command.file_offset;
+			auto sent = ::sendfile(GetNativeHandle(), file->GetNativeHandle(), &offset, std::min<size_t>(command.file_length, OV_SOCKET_SENDFILE_CHUNK_SIZE));
+
+			if (sent < 0L)
+			{
+				if (errno == EINTR)
+				{
+					continue;
+				}
+
+				if (errno == EAGAIN)
+				{
+					// Socket buffer is full - retry later
+					STATS_COUNTER_INCREASE_RETRY();
+					break;
+				}
+
+				auto error = Error::CreateErrorFromErrno();
+
+				if ((error->GetCode() != EPIPE) && (error->GetCode() != ECONNRESET))
+				{
+					logaw("Could not send the file: %s (%s), %s", file->GetPath().CStr(), error->What(), ToString().CStr());
+				}
+
+				STATS_COUNTER_INCREASE_ERROR();
+
+				return DispatchResult::Error;
+			}
+
+			if (sent == 0L)
+			{
+				// The file is truncated after the response header is sent, so the response cannot be completed
+				logaw("The file is shorter than expected: %s (%zu bytes are left), %s", file->GetPath().CStr(), command.file_length, ToString().CStr());
+				return DispatchResult::Error;
+			}
+
+			STATS_COUNTER_INCREASE_PPS();
+
+			command.file_offset += sent;
+			command.file_length -= sent;
+			is_sent = true;
+
+			UpdateLastSentTime();
+		}
+
+		if (command.file_length == 0)
+		{
+			return DispatchResult::Dispatched;
+		}
+
+		if (is_sent)
+		{
+			// Since some data has been sent, the time needs to be updated.
+			command.UpdateTime();
+		}
+
+		return DispatchResult::PartialDispatched;
+	}
+
 	ssize_t Socket::SendToInternal(const SocketAddress &address, const std::shared_ptr<const Data> &data)
 	{
 		if (GetState() == SocketState::Closed)
@@ -1185,6 +1623,17 @@ namespace ov
 
 		logap("Trying to send data %zu bytes to %s...", remained, address.ToString(false).CStr());
 
+		if (GetType() == SocketType::Udp)
+		{
+			DatagramToSend datagram{&address, data.get()};
+
+			if (SendToWithXdpInternal(&datagram, 1) == 1)
+			{
+				logap("%zu bytes sent using XDP", remained);
+				return remained;
+			}
+		}
+
 		switch (GetType())
 		{
 			case SocketType::Udp:
@@ -1250,6 +1699,404 @@ namespace ov
 		return total_sent;
 	}
 
+	ssize_t Socket::SendToWithGsoInternal(const DatagramToSend *datagrams, size_t count)
+	{
+#if IS_LINUX && defined(UDP_SEGMENT)
+		if ((_is_gso_available == false) || (count < 2) || (count > MaxDatagramBatchCount))
+		{
+			return -2L;
+		}
+
+		// UDP_SEGMENT requires that all segments have the same size except the last one
+		auto segment_size = datagrams[0].data->GetLength();
+		size_t total_bytes = 0;
+		iovec iov_list[MaxDatagramBatchCount];
+
+		if ((segment_size == 0) || (segment_size > UINT16_MAX))
+		{
+			return -2L;
+		}
+
+		for (size_t index = 0; index < count; index++)
+		{
+			auto &datagram = datagrams[index];
+			auto length = datagram.data->GetLength();
+
+			if ((*(datagram.address) != *(datagrams[0].address)) ||
+				((index < (count - 1)) && (length != segment_size)) ||
+				(length > segment_size) || (length == 0))
+			{
+				return -2L;
+			}
+
+			total_bytes += length;
+
+			iov_list[index].iov_base = const_cast<void *>(datagram.data->GetData());
+			iov_list[index].iov_len = length;
+		}
+
+		if (total_bytes > MaxGsoPayloadSize)
+		{
+			return -2L;
+		}
+
+		auto &address = *(datagrams[0].address);
+
+		char control[CMSG_SPACE(sizeof(uint16_t))]{};
+		msghdr message{};
+
+		message.msg_name = const_cast<sockaddr *>(static_cast<const sockaddr *>(address));
+		message.msg_namelen = address.GetSockAddrInLength();
+		message.msg_iov = iov_list;
+		message.msg_iovlen = count;
+		message.msg_control = control;
+		message.msg_controllen = sizeof(control);
+
+		auto cmsg = CMSG_FIRSTHDR(&message);
+		cmsg->cmsg_level = SOL_UDP;
+		cmsg->cmsg_type = UDP_SEGMENT;
+		cmsg->cmsg_len = CMSG_LEN(sizeof(uint16_t));
+		*(reinterpret_cast<uint16_t *>(CMSG_DATA(cmsg))) = static_cast<uint16_t>(segment_size);
+
+		logap("Trying to send %zu datagrams (%zu bytes, segment: %zu bytes) to %s using GSO...",
+			  count, total_bytes, segment_size, address.ToString(false).CStr());
+
+		ssize_t sent = ::sendmsg(GetNativeHandle(), &message, MSG_NOSIGNAL | MSG_DONTWAIT);
+
+		if (sent < 0L)
+		{
+			auto error = Error::CreateErrorFromErrno();
+
+			switch (error->GetCode())
+			{
+				case EAGAIN:
+					// Socket buffer is full - retry later
+					STATS_COUNTER_INCREASE_RETRY();
+					return 0L;
+
+				case EIO:
+					// The NIC doesn't support checksum offload
+					[[fallthrough]];
+				case EINVAL:
+					[[fallthrough]];
+				case ENOPROTOOPT:
+					[[fallthrough]];
+				case EOPNOTSUPP:
+					// The kernel doesn't support UDP_SEGMENT
+					logad("GSO is not available for this socket (%s), fall back to sendmmsg()", error->What());
+					_is_gso_available = false;
+					return -2L;
+
+				case EBADF:
+					// Socket is closed somewhere in OME
+					break;
+
+				default:
+					logaw("Could not send data using GSO: %zd (%s)", sent, error->What());
+					break;
+			}
+
+			STATS_COUNTER_INCREASE_ERROR();
+			return -1L;
+		}
+
+		for (size_t index = 0; index < count; index++)
+		{
+			STATS_COUNTER_INCREASE_PPS();
+		}
+
+		UpdateLastSentTime();
+
+		return static_cast<ssize_t>(count);
+#else	// IS_LINUX && defined(UDP_SEGMENT)
+		return -2L;
+#endif	// IS_LINUX && defined(UDP_SEGMENT)
+	}
+
+	ssize_t Socket::SendMultipleInternal(const Data *const *data_list, size_t count)
+	{
+		if (GetState() == SocketState::Closed)
+		{
+			return -1L;
+		}
+
+		if (GetType() != SocketType::Tcp)
+		{
+			logac("SendMultipleInternal() is only available for TCP socket");
+			OV_ASSERT2(false);
+			return -1L;
+		}
+
+		iovec iov_list[MaxIovecBatchCount];
+		size_t iov_count = std::min(count, static_cast<size_t>(MaxIovecBatchCount));
+
+		for (size_t index = 0; index < iov_count; index++)
+		{
+			iov_list[index].iov_base = const_cast<void *>(data_list[index]->GetData());
+			iov_list[index].iov_len = data_list[index]->GetLength();
+		}
+
+		iovec *iov = iov_list;
+		size_t total_sent = 0L;
+
+		logap("Trying to send %zu buffers using sendmsg()...", iov_count);
+
+		while ((iov_count > 0) && (_force_stop == false))
+		{
+			msghdr message{};
+			message.msg_iov = iov;
+			message.msg_iovlen = iov_count;
+
+			ssize_t sent = ::sendmsg(GetNativeHandle(), &message, MSG_NOSIGNAL | MSG_DONTWAIT);
+
+			if (sent < 0L)
+			{
+				auto error = Error::CreateErrorFromErrno();
+
+				switch (error->GetCode())
+				{
+					// Errors that can occur under normal circumstances do not output
+					case EAGAIN:
+						// Socket buffer is full - retry later
+						STATS_COUNTER_INCREASE_RETRY();
+						return total_sent;
+
+					case EBADF:
+						// Socket is closed somewhere in OME
+						break;
+
+					case EPIPE:
+						// Broken pipe - maybe peer is disconnected
+						break;
+
+					case ECONNRESET:
+						// Connection reset - maybe peer is disconnected
+						break;
+
+					default:
+						logaw("Could not send data: %zd (%s), %s", sent, error->What(), ToString().CStr());
+						break;
+				}
+
+				STATS_COUNTER_INCREASE_ERROR();
+
+				return sent;
+			}
+
+			STATS_COUNTER_INCREASE_PPS();
+
+			total_sent += sent;
+			UpdateLastSentTime();
+
+			// Skip the buffers that have been sent
+			size_t remained = sent;
+
+			while ((iov_count > 0) && (remained >= iov->iov_len))
+			{
+				remained -= iov->iov_len;
+				iov++;
+				iov_count--;
+			}
+
+			if (iov_count > 0)
+			{
+				iov->iov_base = static_cast<uint8_t *>(iov->iov_base) + remained;
+				iov->iov_len -= remained;
+			}
+		}
+
+		return total_sent;
+	}
+
+	size_t Socket::SendToWithXdpInternal(const DatagramToSend *datagrams, size_t count)
+	{
+		auto &xdp_transmitter = _worker->_xdp_transmitter;
+
+		if ((xdp_transmitter == nullptr) || (_local_address == nullptr))
+		{
+			return 0;
+		}
+
+		XdpTransmitter::Datagram xdp_datagrams[MaxDatagramBatchCount];
+		size_t total_sent = 0;
+
+		while (total_sent < count)
+		{
+			auto batch_count = std::min(count - total_sent, static_cast<size_t>(MaxDatagramBatchCount));
+
+			for (size_t index = 0; index < batch_count; index++)
+			{
+				auto &datagram = datagrams[total_sent + index];
+
+				xdp_datagrams[index] = {datagram.address, datagram.data->GetData(), datagram.data->GetLength()};
+			}
+
+			auto sent = xdp_transmitter->Send(*_local_address, xdp_datagrams, batch_count);
+
+			for (size_t index = 0; index < sent; index++)
+			{
+				STATS_COUNTER_INCREASE_PPS();
+			}
+
+			total_sent += sent;
+
+			if (sent < batch_count)
+			{
+				break;
+			}
+		}
+
+		if (total_sent > 0)
+		{
+			UpdateLastSentTime();
+		}
+
+		return total_sent;
+	}
+
+	ssize_t Socket::SendToMultipleInternal(const DatagramToSend *datagrams, size_t count)
+	{
+		if (GetState() == SocketState::Closed)
+		{
+			return -1L;
+		}
+
+		if (GetType() != SocketType::Udp)
+		{
+			logac("SendToMultipleInternal() is only available for UDP socket");
+			OV_ASSERT2(false);
+			return -1L;
+		}
+
+		if (count == 0)
+		{
+			return 0L;
+		}
+
+		auto xdp_sent = SendToWithXdpInternal(datagrams, count);
+
+		if (xdp_sent > 0)
+		{
+			if (xdp_sent == count)
+			{
+				return xdp_sent;
+			}
+
+			// The rest is sent through the kernel (or through XDP again from the next datagram that can be sent)
+			auto sent = SendToMultipleInternal(datagrams + xdp_sent, count - xdp_sent);
+
+			return static_cast<ssize_t>(xdp_sent) + std::max<ssize_t>(sent, 0L);
+		}
+
+#if IS_LINUX
+		auto gso_result = SendToWithGsoInternal(datagrams, count);
+
+		if (gso_result != -2L)
+		{
+			return gso_result;
+		}
+
+		mmsghdr message_list[MaxDatagramBatchCount];
+		iovec iov_list[MaxDatagramBatchCount];
+		size_t total_sent = 0;
+
+		while ((total_sent < count) && (_force_stop == false))
+		{
+			auto batch_count = std::min(count - total_sent, static_cast<size_t>(MaxDatagramBatchCount));
+
+			::memset(message_list, 0, sizeof(mmsghdr) * batch_count);
+
+			for (size_t index = 0; index < batch_count; index++)
+			{
+				auto &datagram = datagrams[total_sent + index];
+				auto &message = message_list[index].msg_hdr;
+
+				iov_list[index].iov_base = const_cast<void *>(datagram.data->GetData());
+				iov_list[index].iov_len = datagram.data->GetLength();
+
+				message.msg_name = const_cast<sockaddr *>(static_cast<const sockaddr *>(*(datagram.address)));
+				message.msg_namelen = datagram.address->GetSockAddrInLength();
+				message.msg_iov = &(iov_list[index]);
+				message.msg_iovlen = 1;
+			}
+
+			logap("Trying to send %zu datagrams using sendmmsg()...", batch_count);
+
+			int sent = ::sendmmsg(GetNativeHandle(), message_list, batch_count, MSG_NOSIGNAL | MSG_DONTWAIT);
+
+			if (sent < 0)
+			{
+				auto error = Error::CreateErrorFromErrno();
+
+				switch (error->GetCode())
+				{
+					case EAGAIN:
+						// Socket buffer is full - retry later
+						STATS_COUNTER_INCREASE_RETRY();
+						return total_sent;
+
+					case EBADF:
+						// Socket is closed somewhere in OME
+						break;
+
+					case EPIPE:
+						// Broken pipe - maybe peer is disconnected
+						break;
+
+					default:
+						logaw("Could not send data: %d (%s)", sent, error->What());
+						break;
+				}
+
+				STATS_COUNTER_INCREASE_ERROR();
+
+				// If some datagrams have been sent, the error will be reported on the next call
+				return (total_sent > 0) ? static_cast<ssize_t>(total_sent) : -1L;
+			}
+
+			for (int index = 0; index < sent; index++)
+			{
+				STATS_COUNTER_INCREASE_PPS();
+			}
+
+			total_sent += sent;
+			UpdateLastSentTime();
+		}
+
+		logap("%zu datagrams sent", total_sent);
+
+		return total_sent;
+#else	// IS_LINUX
+		// sendmmsg() is not available - send datagrams one by one
+		size_t total_sent = 0;
+
+		for (; total_sent < count; total_sent++)
+		{
+			auto &datagram = datagrams[total_sent];
+			auto data = datagram.data;
+			auto sent = ::sendto(GetNativeHandle(), data->GetData(), data->GetLength(), MSG_NOSIGNAL | MSG_DONTWAIT,
+								 *(datagram.address), datagram.address->GetSockAddrInLength());
+
+			if (sent < 0L)
+			{
+				if (errno == EAGAIN)
+				{
+					STATS_COUNTER_INCREASE_RETRY();
+					break;
+				}
+
+				STATS_COUNTER_INCREASE_ERROR();
+				return (total_sent > 0) ? static_cast<ssize_t>(total_sent) : -1L;
+			}
+
+			STATS_COUNTER_INCREASE_PPS();
+			UpdateLastSentTime();
+		}
+
+		return total_sent;
+#endif	// IS_LINUX
+	}
+
 	PostProcessMethod Socket::OnDataWritableEvent()
 	{
 		switch (DispatchEvents())
@@ -1267,6 +2114,15 @@ namespace ov
 		return PostProcessMethod::Error;
 	}
 
+	void Socket::ResumeRead()
+	{
+		if (_is_read_paused.exchange(false) && (_worker != nullptr))
+		{
+			// Since the socket is edge-triggered, no more event will occur for the data already in the kernel buffer
+			_worker->EnqueueToReadLater(GetSharedPtr());
+		}
+	}
+
 	void Socket::OnDataAvailableEvent()
 	{
 		logad("Socket is ready to read");
@@ -1335,7 +2191,7 @@ namespace ov
 					CHECK_STATE2(== SocketState::Created, == SocketState::Bound, false);
 
 					// We don't have to be accurate here, because we'll acquire lock of _dispatch_queue_lock in DispatchEvents()
-					if (_dispatch_queue.empty() == false)
+					if (HasCommand())
 					{
 						// Send remaining data
 						if (DispatchEvents() == DispatchResult::Error)
@@ -1429,7 +2285,7 @@ namespace ov
 					CHECK_STATE2(== SocketState::Created, == SocketState::Bound, false);
 
 					// We don't have to be accurate here, because we'll acquire lock of _dispatch_queue_lock in DispatchEvents()
-					if (_dispatch_queue.empty() == false)
+					if (HasCommand())
 					{
 						// Send remaining data
 						if (DispatchEvents() == DispatchResult::Error)
@@ -1468,6 +2324,239 @@ namespace ov
 		return SendTo(address, (data == nullptr) ? nullptr : std::make_shared<Data>(data, length));
 	}
 
+	bool Socket::SendTo(const SocketAddress &address, const std::vector<std::shared_ptr<const Data>> &data_list)
+	{
+		if ((GetType() != SocketType::Udp) || (_blocking_mode == BlockingMode::Blocking))
+		{
+			for (auto &data : data_list)
+			{
+				if (SendTo(address, data) == false)
+				{
+					return false;
+				}
+			}
+
+			return true;
+		}
+
+		switch (GetState())
+		{
+			// When data transfer is requested after disconnection by a worker, etc., it enters here
+			case SocketState::Closed:
+				[[fallthrough]];
+			case SocketState::Disconnected:
+				[[fallthrough]];
+			case SocketState::Error:
+				return false;
+
+			default:
+				break;
+		}
+
+		CHECK_STATE2(== SocketState::Created, == SocketState::Bound, false);
+
+		// We don't have to be accurate here, because we'll acquire lock of _dispatch_queue_lock in DispatchEvents()
+		if (HasCommand())
+		{
+			// Send remaining data first to keep the order of the datagrams
+			if (DispatchEvents() == DispatchResult::Error)
+			{
+				return false;
+			}
+
+			if (HasCommand())
+			{
+				for (auto &data : data_list)
+				{
+					if ((data == nullptr) || (AppendCommand({address, data->Clone()}) == false))
+					{
+						return false;
+					}
+				}
+
+				return true;
+			}
+		}
+
+		size_t offset = 0;
+
+		while (offset < data_list.size())
+		{
+			DatagramToSend datagrams[MaxDatagramBatchCount];
+			auto count = std::min(data_list.size() - offset, static_cast<size_t>(MaxDatagramBatchCount));
+
+			for (size_t index = 0; index < count; index++)
+			{
+				auto &data = data_list[offset + index];
+
+				if (data == nullptr)
+				{
+					OV_ASSERT2(data != nullptr);
+					return false;
+				}
+
+				datagrams[index].address = &address;
+				datagrams[index].data = data.get();
+			}
+
+			auto sent_count = SendToMultipleInternal(datagrams, count);
+
+			if (sent_count < 0L)
+			{
+				// An error occurred
+				return false;
+			}
+
+			offset += sent_count;
+
+			if (static_cast<size_t>(sent_count) < count)
+			{
+				// Need to send later
+				for (; offset < data_list.size(); offset++)
+				{
+					if (AppendCommand({address, data_list[offset]->Clone()}) == false)
+					{
+						return false;
+					}
+				}
+			}
+		}
+
+		return true;
+	}
+
+	bool Socket::Send(const std::vector<std::shared_ptr<const Data>> &data_list)
+	{
+		if ((GetType() != SocketType::Tcp) || (_blocking_mode == BlockingMode::Blocking))
+		{
+			for (auto &data : data_list)
+			{
+				if (Send(data) == false)
+				{
+					return false;
+				}
+			}
+
+			return true;
+		}
+
+		switch (GetState())
+		{
+			// When data transfer is requested after disconnection by a worker, etc., it enters here
+			case SocketState::Closed:
+				[[fallthrough]];
+			case SocketState::Disconnected:
+				[[fallthrough]];
+			case SocketState::Error:
+				return false;
+
+			default:
+				break;
+		}
+
+		CHECK_STATE(== SocketState::Connected, false);
+
+		// The buffers are queued and coalesced into a sendmsg() call in DispatchEvents()
+		for (auto &data : data_list)
+		{
+			if (data == nullptr)
+			{
+				OV_ASSERT2(data != nullptr);
+				return false;
+			}
+
+			if (data->IsEmpty())
+			{
+				continue;
+			}
+
+			if (AppendCommand({data->Clone()}) == false)
+			{
+				return false;
+			}
+		}
+
+		switch (DispatchEvents())
+		{
+			case DispatchResult::Dispatched:
+				break;
+
+			case DispatchResult::PartialDispatched:
+				_worker->EnqueueToDispatchLater(GetSharedPtr());
+				break;
+
+			case DispatchResult::Error:
+				return false;
+		}
+
+		return true;
+	}
+
+	bool Socket::SendFile(const std::shared_ptr<const OpenedFile> &file, off_t offset, size_t length)
+	{
+		if ((file == nullptr) || (GetType() != SocketType::Tcp))
+		{
+			OV_ASSERT2((file != nullptr) && (GetType() == SocketType::Tcp));
+			return false;
+		}
+
+		if (length == 0)
+		{
+			return true;
+		}
+
+		switch (GetState())
+		{
+			// When data transfer is requested after disconnection by a worker, etc., it enters here
+			case SocketState::Closed:
+				[[fallthrough]];
+			case SocketState::Disconnected:
+				[[fallthrough]];
+			case SocketState::Error:
+				return false;
+
+			default:
+				break;
+		}
+
+		CHECK_STATE(== SocketState::Connected, false);
+
+		if (_blocking_mode == BlockingMode::Blocking)
+		{
+			DispatchCommand command(file, offset, length);
+
+			while (command.file_length > 0)
+			{
+				if (SendFileInternal(command) == DispatchResult::Error)
+				{
+					return false;
+				}
+			}
+
+			return true;
+		}
+
+		if (AppendCommand({file, offset, length}) == false)
+		{
+			return false;
+		}
+
+		switch (DispatchEvents())
+		{
+			case DispatchResult::Dispatched:
+				break;
+
+			case DispatchResult::PartialDispatched:
+				_worker->EnqueueToDispatchLater(GetSharedPtr());
+				break;
+
+			case DispatchResult::Error:
+				return false;
+		}
+
+		return true;
+	}
+
 	std::shared_ptr<const SocketError> Socket::Recv(std::shared_ptr<Data> &data, bool non_block)
 	{
 		OV_ASSERT2(data != nullptr);
@@ -1545,9 +2634,9 @@ namespace ov
 				{
 					auto error = SrtError::CreateErrorFromSrt();
 
-					if (error->GetCode() == SRT_EASYNCRCV)
+					if ((error->GetCode() == SRT_EASYNCRCV) || (error->GetCode() == SRT_ETIMEOUT))
 					{
-						// Timed out
+						// Timed out (SRT_ETIMEOUT: SRTO_RCVTIMEO is expired in blocking mode)
 						read_bytes = 0L;
 						// Actually, it is not an error
 						socket_error = nullptr;
@@ -1715,6 +2804,126 @@ namespace ov
 		return socket_error;
 	}
 
+	std::shared_ptr<const SocketError> Socket::RecvFromMultiple(std::vector<std::shared_ptr<Data>> &data_list, std::vector<SocketAddress> &address_list, size_t *received_count)
+	{
+		OV_ASSERT2(_socket.IsValid());
+		OV_ASSERT2(received_count != nullptr);
+
+		*received_count = 0;
+
+		if (GetType() != SocketType::Udp)
+		{
+			OV_ASSERT2(false);
+			return SocketError::CreateError("RecvFromMultiple() is only supported for UDP");
+		}
+
+		auto count = std::min(data_list.size(), static_cast<size_t>(MaxDatagramBatchCount));
+
+		if (count == 0)
+		{
+			return nullptr;
+		}
+
+		address_list.resize(data_list.size());
+
+#if IS_LINUX
+		mmsghdr message_list[MaxDatagramBatchCount];
+		iovec iov_list[MaxDatagramBatchCount];
+		sockaddr_storage remote_list[MaxDatagramBatchCount];
+
+		::memset(message_list, 0, sizeof(mmsghdr) * count);
+
+		for (size_t index = 0; index < count; index++)
+		{
+			auto &data = data_list[index];
+			OV_ASSERT2(data->GetCapacity() > 0);
+
+			data->SetLength(data->GetCapacity());
+
+			iov_list[index].iov_base = data->GetWritableData();
+			iov_list[index].iov_len = data->GetLength();
+
+			auto &message = message_list[index].msg_hdr;
+			message.msg_name = &(remote_list[index]);
+			message.msg_namelen = sizeof(sockaddr_storage);
+			message.msg_iov = &(iov_list[index]);
+			message.msg_iovlen = 1;
+		}
+
+		logap("Trying to read up to %zu datagrams from the socket...", count);
+
+		int read_count = ::recvmmsg(GetNativeHandle(), message_list, count, MSG_DONTWAIT, nullptr);
+
+		if (read_count < 0)
+		{
+			auto error = Error::CreateErrorFromErrno();
+
+			for (size_t index = 0; index < count; index++)
+			{
+				data_list[index]->SetLength(0L);
+			}
+
+			if (error->GetCode() == EAGAIN)
+			{
+				// Timed out
+				return nullptr;
+			}
+
+			auto socket_error = SocketError::CreateError(error);
+
+			logae("An error occurred while read data: %s\nStack trace: %s",
+				  socket_error->What(),
+				  StackTrace::GetStackTrace().CStr());
+
+			CloseWithState(SocketState::Error);
+
+			return socket_error;
+		}
+
+		for (int index = 0; index < read_count; index++)
+		{
+			data_list[index]->SetLength(message_list[index].msg_len);
+			address_list[index] = SocketAddress("", remote_list[index]);
+		}
+
+		for (size_t index = read_count; index < count; index++)
+		{
+			data_list[index]->SetLength(0L);
+		}
+
+		logap("%d datagrams read", read_count);
+
+		*received_count = read_count;
+
+		if (read_count > 0)
+		{
+			UpdateLastRecvTime();
+		}
+
+		return nullptr;
+#else	// IS_LINUX
+		// recvmmsg() is not available - read datagrams one by one
+		for (size_t index = 0; index < count; index++)
+		{
+			auto error = RecvFrom(data_list[index], &(address_list[index]));
+
+			if (error != nullptr)
+			{
+				return error;
+			}
+
+			if (data_list[index]->GetLength() == 0L)
+			{
+				break;
+			}
+
+			(*received_count)++;
+		}
+
+		return nullptr;
+#endif	// IS_LINUX
+	}
+
 	std::chrono::system_clock::time_point Socket::GetLastRecvTime() const
 	{
 		return _last_recv_time;
@@ -1740,7 +2949,7 @@ namespace ov
 		CHECK_STATE(== SocketState::Connected, false);
 
 		// Dispatch ALL commands
-		while (_dispatch_queue.size() > 0)
+		while (HasCommand())
 		{
 			if (DispatchEvents() == DispatchResult::Error)
 			{
@@ -1825,6 +3034,9 @@ namespace ov
 
 					_has_close_command = true;
 
+					// The data appended before Close() must be sent before the close commands
+					TakePendingCommandsInternal();
+
 					if ((GetState() != SocketState::Disconnected) && (GetState() != SocketState::Error))
 					{
 						_dispatch_queue.emplace_back(DispatchCommand::Type::HalfClose);
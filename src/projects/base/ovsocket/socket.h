@@ -8,6 +8,7 @@
 //==============================================================================
 #pragma once
 
+#include <base/ovlibrary/file.h>
 #include <netinet/in.h>
 #include <netinet/tcp.h>
 
@@ -25,10 +26,21 @@
 #include <map>
 #include <memory>
 #include <utility>
+#include <vector>
 
 // Failure to send data for the specified time period will be considered an error.
 // For example, it can occur when EAGAIN continues to occur for a period of time, or when the peer's TCP window is full and no longer receives data.
 #define OV_SOCKET_EXPIRE_TIMEOUT (10 * 1000)
+// Default limit of the data waiting to be sent per socket (see Socket::SetSendBufferLimits())
+#define OV_SOCKET_DEFAULT_MAX_QUEUED_BYTES (64 * 1024 * 1024)
+// When the data waiting to be sent in all sockets exceeds this percentage of the total limit, the limit per socket is tightened
+#define OV_SOCKET_MEMORY_PRESSURE_PERCENT 75
+// The limit per socket is divided by this value under memory pressure
+#define OV_SOCKET_MEMORY_PRESSURE_DIVISOR 4
+// The maximum bytes of a sendfile() call, so a connection of a large file doesn't hold the worker for long
+#define OV_SOCKET_SENDFILE_CHUNK_SIZE (512 * 1024)
+// The bytes of the file read into the page cache ahead of sendfile() (the next window is requested when half of it is sent)
+#define OV_SOCKET_SENDFILE_READAHEAD_SIZE (4 * 1024 * 1024)
 
 namespace ov
 {
@@ -170,12 +182,27 @@ namespace ov
 
 		// only available for SRT socket
 		String GetStreamId() const;
+		// only available for SRT socket (srt_bstats()), if clear is true, the interval values are reset
+		bool GetSrtStats(SRT_TRACEBSTATS *stats, bool clear = false) const;
 
 		bool Send(const std::shared_ptr<const Data> &data);
 		bool Send(const void *data, size_t length);
+		// Sends multiple buffers in order without concatenating them, with as few system calls as possible
+		// (sendmsg() with an iovec list for TCP).
+		// For non-TCP sockets, this is the same as calling Send() for each item.
+		bool Send(const std::vector<std::shared_ptr<const Data>> &data_list);
+
+		// Sends <length> bytes of <file> from <offset> using sendfile() after the data queued before (TCP only).
+		// The file is not read into the user space, and the bytes are not counted as the queued data.
+		// The data is sent as it is, so it must not be used for a TLS connection unless kTLS is enabled.
+		bool SendFile(const std::shared_ptr<const OpenedFile> &file, off_t offset, size_t length);
 
 		bool SendTo(const SocketAddress &address, const std::shared_ptr<const Data> &data);
 		bool SendTo(const SocketAddress &address, const void *data, size_t length);
+		// Sends multiple datagrams to the same destination with as few system calls as possible
+		// (UDP_SEGMENT if the kernel supports it, otherwise sendmmsg()).
+		// For non-UDP sockets, this is the same as calling SendTo() for each item.
+		bool SendTo(const SocketAddress &address, const std::vector<std::shared_ptr<const Data>> &data_list);
 
 		// When Recv is called in non-blocking mode,
 		//
@@ -192,6 +219,12 @@ namespace ov
 		// If MakeNonBlocking() is called, non_block is ignored
 		std::shared_ptr<const SocketError> RecvFrom(std::shared_ptr<Data> &data, SocketAddress *address, bool non_block = false);
 
+		// Receives up to data_list.size() datagrams with a single recvmmsg() call (UDP only)
+		//
+		// The capacity of each item in data_list must be reserved in advance, and address_list is resized to data_list.size().
+		// If received_count is 0, retry later (EAGAIN)
+		std::shared_ptr<const SocketError> RecvFromMultiple(std::vector<std::shared_ptr<Data>> &data_list, std::vector<SocketAddress> &address_list, size_t *received_count);
+
 		std::chrono::system_clock::time_point GetLastRecvTime() const;
 		std::chrono::system_clock::time_point GetLastSentTime() const;
 
@@ -209,21 +242,65 @@ namespace ov
 
 		bool HasCommand() const
 		{
-			return _dispatch_queue.size() > 0;
+			return (_dispatch_queue.size() > 0) || (_pending_command_count > 0);
 		}
 
 		bool HasExpiredCommand() const
 		{
+			if (_is_evicted)
+			{
+				return true;
+			}
+
 			std::lock_guard lock_guard(_dispatch_queue_lock);
 
-			if (HasCommand())
+			if (_dispatch_queue.empty() == false)
 			{
 				return _dispatch_queue.front().IsExpired(OV_SOCKET_EXPIRE_TIMEOUT);
 			}
 
+			std::lock_guard pending_lock_guard(_pending_commands_lock);
+
+			if (_pending_commands.empty() == false)
+			{
+				return _pending_commands.front().IsExpired(OV_SOCKET_EXPIRE_TIMEOUT);
+			}
+
 			return false;
 		}
 
+		// The number of bytes waiting to be sent
+		size_t GetQueuedBytes() const
+		{
+			return _queued_bytes;
+		}
+
+		// max_queued_bytes: The limit of the data waiting to be sent per socket
+		// max_total_queued_bytes: The limit of the data waiting to be sent in all sockets (0: unlimited)
+		static void SetSendBufferLimits(size_t max_queued_bytes, size_t max_total_queued_bytes);
+		static size_t GetTotalQueuedBytes();
+		// Whether the data waiting to be sent in all sockets is close to the total limit
+		static bool IsUnderMemoryPressure();
+
+		void SetSendBufferPolicy(SendBufferPolicy policy)
+		{
+			_send_buffer_policy = policy;
+		}
+
+		// The limit per socket, which is tightened under memory pressure
+		size_t GetSendBufferLimit() const;
+		// The owner with SendBufferPolicy::DropByOwner should drop the data until the buffer is drained
+		bool IsSendBufferFull() const
+		{
+			return _queued_bytes >= GetSendBufferLimit();
+		}
+
+		// The socket exceeded the send buffer limit, and will be closed by the worker
+		bool IsEvicted() const
+		{
+			return _is_evicted;
+		}
+
 		bool IsEndOfStream() const
 		{
 			return _end_of_stream;
@@ -239,6 +316,22 @@ namespace ov
 			return _has_close_command;
 		}
 
+		// While the read is paused, the received data is not read from the socket (TCP only).
+		// The data stays in the kernel buffer, so the TCP receive window advertised to the peer shrinks
+		// until the peer stops sending.
+		void PauseRead()
+		{
+			_is_read_paused = true;
+		}
+
+		// The data received while the read was paused is read by the socket pool worker
+		void ResumeRead();
+
+		bool IsReadPaused() const
+		{
+			return _is_read_paused;
+		}
+
 		virtual String ToString() const;
 
 	protected:
@@ -256,6 +349,8 @@ namespace ov
 				Send = 0x01,
 				// Need to send data using sendto()
 				SendTo = 0x02,
+				// Need to send a region of a file using sendfile()
+				SendFile = 0x03,
 
 				// Need to call shutdown(SHUT_WR) (TCP only)
 				HalfClose = CLOSE_TYPE_MASK | 0x01,
@@ -278,6 +373,9 @@ namespace ov
 					case Type::SendTo:
 						return "SendTo";
 
+					case Type::SendFile:
+						return "SendFile";
+
 					case Type::HalfClose:
 						return "HalfClose";
 
@@ -306,6 +404,16 @@ namespace ov
 			{
 			}
 
+			DispatchCommand(const std::shared_ptr<const OpenedFile> &file, off_t offset, size_t length)
+				: type(Type::SendFile),
+				  file(file),
+				  file_offset(offset),
+				  file_length(length),
+				  file_readahead_end(offset),
+				  enqueued_time(std::chrono::system_clock::now())
+			{
+			}
+
 			DispatchCommand(Type type)
 				: type(type),
 				  enqueued_time(std::chrono::system_clock::now())
@@ -325,6 +433,10 @@ namespace ov
 				  new_state(another_command.new_state),
 				  address(another_command.address),
 				  data(another_command.data),
+				  file(another_command.file),
+				  file_offset(another_command.file_offset),
+				  file_length(another_command.file_length),
+				  file_readahead_end(another_command.file_readahead_end),
 				  enqueued_time(another_command.enqueued_time)
 			{
 			}
@@ -336,6 +448,10 @@ namespace ov
 				std::swap(new_state, another_command.new_state);
 				std::swap(address, another_command.address);
 				std::swap(data, another_command.data);
+				std::swap(file, another_command.file);
+				std::swap(file_offset, another_command.file_offset);
+				std::swap(file_length, another_command.file_length);
+				std::swap(file_readahead_end, another_command.file_readahead_end);
 				std::swap(enqueued_time, another_command.enqueued_time);
 			}
 
@@ -374,6 +490,11 @@ namespace ov
 					description.AppendFormat(", data: %zu bytes", data->GetLength());
 				}
 
+				if (file != nullptr)
+				{
+					description.AppendFormat(", file: %s (offset: %jd, %zu bytes)", file->GetPath().CStr(), static_cast<intmax_t>(file_offset), file_length);
+				}
+
 				description.Append('>');
 
 				return description;
@@ -383,6 +504,12 @@ namespace ov
 			SocketState new_state = SocketState::Closed;
 			SocketAddress address;
 			std::shared_ptr<const Data> data;
+			// For SendFile (the offset/length are advanced as the file is sent)
+			std::shared_ptr<const OpenedFile> file;
+			off_t file_offset = 0;
+			size_t file_length = 0;
+			// The end of the range that is requested to be read ahead
+			off_t file_readahead_end = 0;
 			std::chrono::time_point<std::chrono::system_clock> enqueued_time;
 		};
 
@@ -395,6 +522,14 @@ namespace ov
 		bool SetBlockingInternal(BlockingMode mode);
 
 		bool AppendCommand(DispatchCommand command);
+		// Moves the commands appended by AppendCommand() to _dispatch_queue (_dispatch_queue_lock must be held)
+		//
+		// Returns true if any command is moved
+		bool TakePendingCommandsInternal();
+		// Called when the data of the queued commands is sent or dropped
+		void OnQueuedDataConsumed(size_t bytes);
+		// Marks the socket to be closed by the worker, because the peer doesn't receive the data fast enough
+		void Evict(size_t length);
 
 		//--------------------------------------------------------------------
 		// Implementation of SocketPoolEventInterface
@@ -406,8 +541,38 @@ namespace ov
 		DispatchResult DispatchEventInternal(DispatchCommand &command);
 
 		ssize_t SendInternal(const std::shared_ptr<const Data> &data);
+		// Sends the file of the SendFile command as much as possible, and advances the offset of the command
+		DispatchResult SendFileInternal(DispatchCommand &command);
 		ssize_t SendToInternal(const SocketAddress &address, const std::shared_ptr<const Data> &data);
 
+		struct DatagramToSend
+		{
+			const SocketAddress *address;
+			const Data *data;
+		};
+
+		// Sends the datagrams using sendmmsg()/UDP_SEGMENT (UDP only)
+		//
+		// Returns the number of datagrams sent (it can be less than count if EAGAIN occurred),
+		// or -1 if an error occurred before any datagram was sent
+		ssize_t SendToMultipleInternal(const DatagramToSend *datagrams, size_t count);
+		// Sends datagrams to the same destination at once using UDP_SEGMENT (GSO)
+		// Returns -2 if GSO cannot be used, and the caller must fall back to sendmmsg()
+		ssize_t SendToWithGsoInternal(const DatagramToSend *datagrams, size_t count);
+		// Sends the datagrams through the AF_XDP transmitter of the worker (UDP only)
+		// Returns the number of datagrams sent from the front, and the rest must be sent through the kernel
+		size_t SendToWithXdpInternal(const DatagramToSend *datagrams, size_t count);
+		// Coalesces consecutive SendTo commands at the front of _dispatch_queue into a single sendmmsg() call
+		DispatchResult DispatchSendToCommandsInternal();
+
+		// Sends the buffers using sendmsg() with an iovec list (TCP only)
+		//
+		// Returns the number of bytes sent (it can be less than the total length if EAGAIN occurred),
+		// or -1 if an error occurred
+		ssize_t SendMultipleInternal(const Data *const *data_list, size_t count);
+		// Coalesces consecutive Send commands at the front of _dispatch_queue into a single sendmsg() call
+		DispatchResult DispatchSendCommandsInternal();
+
 		std::shared_ptr<SocketError> RecvInternal(void *data, size_t length, size_t *received_length);
 
 		virtual String ToString(const char *class_name) const;
@@ -483,12 +648,24 @@ namespace ov
 
 		bool _end_of_stream = false;
 
+		std::atomic<bool> _is_read_paused{false};
+
 		std::shared_ptr<SocketAddress> _local_address = nullptr;
 		std::shared_ptr<SocketAddress> _remote_address = nullptr;
 
+		// Owned by the thread that dispatches the commands, which holds this lock during send()
 		mutable std::recursive_mutex _dispatch_queue_lock;
 		std::deque<DispatchCommand> _dispatch_queue;
-		bool _has_close_command = false;
+		// The commands appended by Send*() are queued here first, so the senders only wait for a push,
+		// not for the send() of the dispatching thread
+		mutable ProfiledMutex _pending_commands_lock{"ov::Socket::_pending_commands_lock"};
+		std::deque<DispatchCommand> _pending_commands;
+		std::atomic<size_t> _pending_command_count{0};
+		// The bytes of the data in _pending_commands and _dispatch_queue
+		std::atomic<size_t> _queued_bytes{0};
+		std::atomic<bool> _has_close_command{false};
+		SendBufferPolicy _send_buffer_policy = SendBufferPolicy::Evict;
+		std::atomic<bool> _is_evicted{false};
 
 		std::atomic<bool> _connection_event_fired{false};
 		std::shared_ptr<SocketAsyncInterface> _callback;
@@ -499,6 +676,9 @@ namespace ov
 
 		volatile bool _force_stop = false;
 
+		// Set to false when the kernel rejects UDP_SEGMENT, to avoid trying GSO again
+		bool _is_gso_available = true;
+
 		String _stream_id;	// only available for SRT socket
 
 	private:
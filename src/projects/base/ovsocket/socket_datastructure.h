@@ -44,10 +44,19 @@ namespace ov
 
 	constexpr const int EpollMaxEvents = 1024;
 	constexpr const int MaxSrtPacketSize = 1316;
+	// The maximum number of SRT messages to be gathered into a single buffer before delivering it to the callback
+	constexpr const int MaxSrtRecvBatchCount = 32;
 
 	const ssize_t TcpBufferSize = 4096;
 	const ssize_t UdpBufferSize = 4096;
 
+	// The maximum number of datagrams to be sent with a single sendmmsg()/UDP_SEGMENT call
+	constexpr const int MaxDatagramBatchCount = 64;
+	// The maximum size of a UDP payload that can be sent at once using UDP_SEGMENT (GSO)
+	constexpr const size_t MaxGsoPayloadSize = 65000;
+	// The maximum number of buffers to be sent with a single sendmsg() call (TCP, IOV_MAX is 1024 on Linux)
+	constexpr const int MaxIovecBatchCount = 256;
+
 	enum class SocketConnectionState : int8_t
 	{
 		/// Socket is connected
@@ -66,6 +75,16 @@ namespace ov
 		NonBlocking
 	};
 
+	// What to do when the data waiting to be sent exceeds the limit of a socket
+	enum class SendBufferPolicy : char
+	{
+		// The socket is evicted (closed by the worker)
+		Evict,
+		// The owner checks IsSendBufferFull() and drops the data by itself (e.g. skips to the next keyframe),
+		// and the socket is evicted only if the data exceeds twice the limit
+		DropByOwner
+	};
+
 	enum class SocketFamily : sa_family_t
 	{
 		Unknown = AF_UNSPEC,
@@ -82,6 +101,14 @@ namespace ov
 		Srt
 	};
 
+	// The mechanism used by SocketPoolWorker to wait for events of TCP/UDP sockets
+	enum class SocketEventBackend : char
+	{
+		Epoll,
+		// Falls back to Epoll if io_uring is not available
+		IoUring
+	};
+
 	constexpr const int SOCKET_STATE_CLOSABLE = 0x01000000;
 
 	enum class SocketState : int
@@ -170,6 +197,20 @@ namespace ov
 		}
 	}
 
+	static const char *StringFromSocketEventBackend(SocketEventBackend backend)
+	{
+		switch (backend)
+		{
+			case SocketEventBackend::Epoll:
+				return "epoll";
+
+			case SocketEventBackend::IoUring:
+				return "io_uring";
+		}
+
+		return "Unknown";
+	}
+
 	static const char *StringFromSocketFamily(SocketFamily family)
 	{
 		switch (family)
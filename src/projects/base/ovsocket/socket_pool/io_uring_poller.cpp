@@ -0,0 +1,576 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "io_uring_poller.h"
+
+#if OV_SOCKET_IO_URING_SUPPORTED
+#	include <sys/mman.h>
+#	include <sys/syscall.h>
+#	include <unistd.h>
+#endif	// OV_SOCKET_IO_URING_SUPPORTED
+
+#undef OV_LOG_TAG
+#define OV_LOG_TAG "Socket.Pool.IoUring"
+
+namespace ov
+{
+#if OV_SOCKET_IO_URING_SUPPORTED
+	namespace
+	{
+		int IoUringSetup(uint32_t entries, io_uring_params *params)
+		{
+			return static_cast<int>(::syscall(__NR_io_uring_setup, entries, params));
+		}
+
+		int IoUringEnter(int ring_fd, uint32_t to_submit, uint32_t min_complete, uint32_t flags, const void *arg, size_t arg_size)
+		{
+			return static_cast<int>(::syscall(__NR_io_uring_enter, ring_fd, to_submit, min_complete, flags, arg, arg_size));
+		}
+
+		inline uint32_t LoadAcquire(const uint32_t *value)
+		{
+			return __atomic_load_n(value, __ATOMIC_ACQUIRE);
+		}
+
+		inline void StoreRelease(uint32_t *value, uint32_t new_value)
+		{
+			__atomic_store_n(value, new_value, __ATOMIC_RELEASE);
+		}
+
+		// IORING_FEAT_EXT_ARG: Wait() needs a timeout without submitting IORING_OP_TIMEOUT (5.11+)
+		// IORING_FEAT_CQE_SKIP: POLL_REMOVE doesn't generate CQE on success (5.17+)
+		constexpr uint32_t RequiredFeatures = IORING_FEAT_EXT_ARG | IORING_FEAT_CQE_SKIP;
+	}  // namespace
+#endif	// OV_SOCKET_IO_URING_SUPPORTED
+
+	IoUringPoller::~IoUringPoller()
+	{
+		Destroy();
+	}
+
+	bool IoUringPoller::IsSupported()
+	{
+#if OV_SOCKET_IO_URING_SUPPORTED
+		static const bool supported = []() -> bool {
+			io_uring_params params{};
+			int ring_fd = IoUringSetup(2, &params);
+
+			if (ring_fd < 0)
+			{
+				logtd("io_uring is not available: %s", Error::CreateErrorFromErrno()->What());
+				return false;
+			}
+
+			::close(ring_fd);
+
+			if (OV_CHECK_FLAG(params.features, RequiredFeatures) == false)
+			{
+				logtd("io_uring is available, but required features are not supported (features: 0x%x)", params.features);
+				return false;
+			}
+
+			return true;
+		}();
+
+		return supported;
+#else	// OV_SOCKET_IO_URING_SUPPORTED
+		return false;
+#endif	// OV_SOCKET_IO_URING_SUPPORTED
+	}
+
+	bool IoUringPoller::Create(uint32_t entries)
+	{
+#if OV_SOCKET_IO_URING_SUPPORTED
+		if (_ring_fd != -1)
+		{
+			logte("io_uring is already created");
+			return false;
+		}
+
+		io_uring_params params{};
+
+		// Multishot polls can generate many completions per registration, so CQ is larger than SQ
+		params.flags = IORING_SETUP_CQSIZE;
+		params.cq_entries = entries * 4;
+
+		_ring_fd = IoUringSetup(entries, &params);
+
+		if (_ring_fd < 0)
+		{
+			_ring_fd = -1;
+			logte("Could not create io_uring: %s", Error::CreateErrorFromErrno()->What());
+			return false;
+		}
+
+		if ((OV_CHECK_FLAG(params.features, RequiredFeatures) == false) || (MapRings(params) == false))
+		{
+			logte("Could not initialize io_uring (features: 0x%x)", params.features);
+			Destroy();
+			return false;
+		}
+
+		logtd("io_uring is created: %s", ToString().CStr());
+
+		return true;
+#else	// OV_SOCKET_IO_URING_SUPPORTED
+		logte("io_uring is not supported on this platform");
+		return false;
+#endif	// OV_SOCKET_IO_URING_SUPPORTED
+	}
+
+	bool IoUringPoller::Destroy()
+	{
+#if OV_SOCKET_IO_URING_SUPPORTED
+		if (_ring_fd == -1)
+		{
+			return false;
+		}
+
+		UnmapRings();
+
+		// Closing the ring cancels all pending polls
+		::close(_ring_fd);
+		_ring_fd = -1;
+
+		std::lock_guard lock_guard(_mutex);
+		_pending_submit_count = 0;
+		_registration_map.clear();
+		_fd_map.clear();
+
+		return true;
+#else	// OV_SOCKET_IO_URING_SUPPORTED
+		return false;
+#endif	// OV_SOCKET_IO_URING_SUPPORTED
+	}
+
+#if OV_SOCKET_IO_URING_SUPPORTED
+	bool IoUringPoller::MapRings(const io_uring_params &params)
+	{
+		_sq_ring_size = params.sq_off.array + params.sq_entries * sizeof(uint32_t);
+		_cq_ring_size = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+
+		bool single_mmap = OV_CHECK_FLAG(params.features, IORING_FEAT_SINGLE_MMAP);
+
+		if (single_mmap)
+		{
+			_sq_ring_size = std::max(_sq_ring_size, _cq_ring_size);
+		}
+
+		_sq_ring = ::mmap(nullptr, _sq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, _ring_fd, IORING_OFF_SQ_RING);
+
+		if (_sq_ring == MAP_FAILED)
+		{
+			_sq_ring = nullptr;
+			return false;
+		}
+
+		if (single_mmap)
+		{
+			_cq_ring = _sq_ring;
+		}
+		else
+		{
+			_cq_ring = ::mmap(nullptr, _cq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, _ring_fd, IORING_OFF_CQ_RING);
+
+			if (_cq_ring == MAP_FAILED)
+			{
+				_cq_ring = nullptr;
+				return false;
+			}
+		}
+
+		_sqes_size = params.sq_entries * sizeof(io_uring_sqe);
+		auto sqes = ::mmap(nullptr, _sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, _ring_fd, IORING_OFF_SQES);
+
+		if (sqes == MAP_FAILED)
+		{
+			return false;
+		}
+
+		_sqes = static_cast<io_uring_sqe *>(sqes);
+
+		auto sq_ring = static_cast<uint8_t *>(_sq_ring);
+		_sq_head = reinterpret_cast<uint32_t *>(sq_ring + params.sq_off.head);
+		_sq_tail = reinterpret_cast<uint32_t *>(sq_ring + params.sq_off.tail);
+		_sq_mask = *reinterpret_cast<uint32_t *>(sq_ring + params.sq_off.ring_mask);
+		_sq_entries = params.sq_entries;
+		_sq_array = reinterpret_cast<uint32_t *>(sq_ring + params.sq_off.array);
+
+		auto cq_ring = static_cast<uint8_t *>(_cq_ring);
+		_cq_head = reinterpret_cast<uint32_t *>(cq_ring + params.cq_off.head);
+		_cq_tail = reinterpret_cast<uint32_t *>(cq_ring + params.cq_off.tail);
+		_cq_mask = *reinterpret_cast<uint32_t *>(cq_ring + params.cq_off.ring_mask);
+		_cqes = reinterpret_cast<io_uring_cqe *>(cq_ring + params.cq_off.cqes);
+
+		return true;
+	}
+
+	void IoUringPoller::UnmapRings()
+	{
+		if (_sqes != nullptr)
+		{
+			::munmap(_sqes, _sqes_size);
+			_sqes = nullptr;
+		}
+
+		if ((_cq_ring != nullptr) && (_cq_ring != _sq_ring))
+		{
+			::munmap(_cq_ring, _cq_ring_size);
+		}
+		_cq_ring = nullptr;
+
+		if (_sq_ring != nullptr)
+		{
+			::munmap(_sq_ring, _sq_ring_size);
+			_sq_ring = nullptr;
+		}
+
+		_sq_head = nullptr;
+		_sq_tail = nullptr;
+		_sq_array = nullptr;
+		_cq_head = nullptr;
+		_cq_tail = nullptr;
+		_cqes = nullptr;
+	}
+
+	int IoUringPoller::Enter(uint32_t to_submit, uint32_t min_complete, uint32_t flags, const void *arg, size_t arg_size)
+	{
+		while (true)
+		{
+			int result = IoUringEnter(_ring_fd, to_submit, min_complete, flags, arg, arg_size);
+
+			if ((result < 0) && (errno == EINTR) && (to_submit > 0))
+			{
+				// Retry to make sure the SQEs are consumed
+				continue;
+			}
+
+			return result;
+		}
+	}
+
+	io_uring_sqe *IoUringPoller::GetSqe()
+	{
+		uint32_t tail = *_sq_tail;
+
+		if ((tail - LoadAcquire(_sq_head)) >= _sq_entries)
+		{
+			// SQ is full - flush pending SQEs to make room
+			if (SubmitPending() == false)
+			{
+				return nullptr;
+			}
+
+			if ((tail - LoadAcquire(_sq_head)) >= _sq_entries)
+			{
+				errno = EBUSY;
+				return nullptr;
+			}
+		}
+
+		auto index = tail & _sq_mask;
+		auto sqe = &(_sqes[index]);
+
+		::memset(sqe, 0, sizeof(*sqe));
+		_sq_array[index] = index;
+
+		return sqe;
+	}
+
+	bool IoUringPoller::SubmitPollAdd(uint64_t id, const Registration &registration)
+	{
+		auto sqe = GetSqe();
+
+		if (sqe == nullptr)
+		{
+			return false;
+		}
+
+		sqe->opcode = IORING_OP_POLL_ADD;
+		sqe->fd = registration.fd;
+		// Multishot polls are always edge-triggered, so EPOLLET must not be passed
+		sqe->poll32_events = registration.events & ~static_cast<uint32_t>(EPOLLET);
+		sqe->len = IORING_POLL_ADD_MULTI;
+		sqe->user_data = id;
+
+		StoreRelease(_sq_tail, *_sq_tail + 1);
+		_pending_submit_count++;
+
+		return true;
+	}
+
+	bool IoUringPoller::SubmitPollRemove(uint64_t id)
+	{
+		auto sqe = GetSqe();
+
+		if (sqe == nullptr)
+		{
+			return false;
+		}
+
+		sqe->opcode = IORING_OP_POLL_REMOVE;
+		sqe->fd = -1;
+		sqe->addr = id;
+		sqe->flags = IOSQE_CQE_SKIP_SUCCESS;
+		sqe->user_data = 0;
+
+		StoreRelease(_sq_tail, *_sq_tail + 1);
+		_pending_submit_count++;
+
+		return true;
+	}
+
+	bool IoUringPoller::SubmitIfNeeded()
+	{
+		if ((_pending_submit_count == 0) || (std::this_thread::get_id() == _waiter_thread_id))
+		{
+			// Will be submitted in the next Wait()
+			return true;
+		}
+
+		return SubmitPending();
+	}
+
+	bool IoUringPoller::SubmitPending()
+	{
+		int result = Enter(_pending_submit_count, 0, 0, nullptr, 0);
+
+		if (result < 0)
+		{
+			// Nothing was submitted, so the SQEs are still pending
+			return false;
+		}
+
+		// The SQEs that the kernel did not consume are submitted later
+		_pending_submit_count -= std::min(static_cast<uint32_t>(result), _pending_submit_count);
+
+		return true;
+	}
+#endif	// OV_SOCKET_IO_URING_SUPPORTED
+
+	bool IoUringPoller::Add(int fd, uint32_t events, void *ptr)
+	{
+#if OV_SOCKET_IO_URING_SUPPORTED
+		std::lock_guard lock_guard(_mutex);
+
+		if (_fd_map.find(fd) != _fd_map.end())
+		{
+			errno = EEXIST;
+			return false;
+		}
+
+		_last_id++;
+		auto id = _last_id;
+
+		Registration registration{fd, events, ptr};
+
+		if (SubmitPollAdd(id, registration) == false)
+		{
+			return false;
+		}
+
+		_registration_map.emplace(id, registration);
+		_fd_map[fd] = id;
+
+		return SubmitIfNeeded();
+#else	// OV_SOCKET_IO_URING_SUPPORTED
+		errno = ENOSYS;
+		return false;
+#endif	// OV_SOCKET_IO_URING_SUPPORTED
+	}
+
+	bool IoUringPoller::Delete(int fd)
+	{
+#if OV_SOCKET_IO_URING_SUPPORTED
+		std::lock_guard lock_guard(_mutex);
+
+		auto item = _fd_map.find(fd);
+
+		if (item == _fd_map.end())
+		{
+			errno = ENOENT;
+			return false;
+		}
+
+		auto id = item->second;
+
+		// Completions for this id are ignored from now on, even if they are already in the CQ
+		_fd_map.erase(item);
+		_registration_map.erase(id);
+
+		if (SubmitPollRemove(id) == false)
+		{
+			return false;
+		}
+
+		return SubmitIfNeeded();
+#else	// OV_SOCKET_IO_URING_SUPPORTED
+		errno = ENOSYS;
+		return false;
+#endif	// OV_SOCKET_IO_URING_SUPPORTED
+	}
+
+	int IoUringPoller::Wait(epoll_event *events, int max_events, int timeout_msec)
+	{
+#if OV_SOCKET_IO_URING_SUPPORTED
+		if (_ring_fd == -1)
+		{
+			errno = EBADF;
+			return -1;
+		}
+
+		uint32_t to_submit = 0;
+		bool has_completions = false;
+
+		{
+			std::lock_guard lock_guard(_mutex);
+			to_submit = _pending_submit_count;
+			_pending_submit_count = 0;
+		}
+
+		has_completions = (LoadAcquire(_cq_tail) != *_cq_head);
+
+		if ((has_completions == false) || (to_submit > 0))
+		{
+			uint32_t min_complete = ((has_completions == false) && (timeout_msec != 0)) ? 1 : 0;
+			uint32_t flags = (min_complete > 0) ? IORING_ENTER_GETEVENTS : 0;
+
+			__kernel_timespec timeout{};
+			io_uring_getevents_arg arg{};
+			const void *arg_ptr = nullptr;
+			size_t arg_size = 0;
+
+			if ((min_complete > 0) && (timeout_msec != Infinite) && (timeout_msec >= 0))
+			{
+				timeout.tv_sec = timeout_msec / 1000;
+				timeout.tv_nsec = (timeout_msec % 1000) * 1000000LL;
+
+				arg.ts = reinterpret_cast<uint64_t>(&timeout);
+				arg_ptr = &arg;
+				arg_size = sizeof(arg);
+				flags |= IORING_ENTER_EXT_ARG;
+			}
+
+			int result = Enter(to_submit, min_complete, flags, arg_ptr, arg_size);
+			int error = errno;
+
+			// io_uring_enter() returns the number of the submitted SQEs (even if the wait fails after some are submitted),
+			// so the rest are pending again
+			uint32_t submitted = (result > 0) ? std::min(static_cast<uint32_t>(result), to_submit) : 0;
+
+			if (submitted < to_submit)
+			{
+				std::lock_guard lock_guard(_mutex);
+				_pending_submit_count += (to_submit - submitted);
+			}
+
+			if ((result < 0) && (error != ETIME) && (error != EINTR))
+			{
+				errno = error;
+				return -1;
+			}
+		}
+
+		std::lock_guard lock_guard(_mutex);
+
+		uint32_t head = *_cq_head;
+		uint32_t tail = LoadAcquire(_cq_tail);
+		int event_count = 0;
+
+		// Each CQE is converted to epoll_event. Completions of the same registration are merged
+		// to make sure that only one event is delivered per socket, like epoll.
+		std::unordered_map<uint64_t, int> index_map;
+
+		for (; (head != tail) && (event_count < max_events); head++)
+		{
+			const auto &cqe = _cqes[head & _cq_mask];
+			auto id = cqe.user_data;
+			auto registration_item = _registration_map.find(id);
+
+			if (registration_item == _registration_map.end())
+			{
+				// Already deleted, or a result of POLL_REMOVE
+				continue;
+			}
+
+			auto &registration = registration_item->second;
+			uint32_t event_mask = 0;
+			bool more = OV_CHECK_FLAG(cqe.flags, IORING_CQE_F_MORE);
+
+			if (cqe.res >= 0)
+			{
+				event_mask = static_cast<uint32_t>(cqe.res);
+
+				if (more == false)
+				{
+					// The multishot poll is terminated (CQ overflow, etc.) - rearm it
+					SubmitPollAdd(id, registration);
+				}
+			}
+			else if (cqe.res == -ECANCELED)
+			{
+				if (more == false)
+				{
+					SubmitPollAdd(id, registration);
+				}
+			}
+			else
+			{
+				logtd("Poll for fd #%d is failed: %s", registration.fd, ::strerror(-cqe.res));
+
+				event_mask = EPOLLERR | EPOLLHUP;
+
+				if (more == false)
+				{
+					_fd_map.erase(registration.fd);
+				}
+			}
+
+			if (event_mask != 0)
+			{
+				auto index_item = index_map.find(id);
+
+				if (index_item == index_map.end())
+				{
+					auto &event = events[event_count];
+					event.events = event_mask;
+					event.data.ptr = registration.ptr;
+
+					index_map.emplace(id, event_count);
+					event_count++;
+				}
+				else
+				{
+					events[index_item->second].events |= event_mask;
+				}
+			}
+
+			if ((cqe.res < 0) && (cqe.res != -ECANCELED) && (more == false))
+			{
+				_registration_map.erase(registration_item);
+			}
+		}
+
+		StoreRelease(_cq_head, head);
+
+		return event_count;
+#else	// OV_SOCKET_IO_URING_SUPPORTED
+		errno = ENOSYS;
+		return -1;
+#endif	// OV_SOCKET_IO_URING_SUPPORTED
+	}
+
+	String IoUringPoller::ToString() const
+	{
+#if OV_SOCKET_IO_URING_SUPPORTED
+		return String::FormatString("<IoUringPoller: %p, fd: %d, sq_entries: %u, registered: %zu>",
+									this, _ring_fd, _sq_entries, _registration_map.size());
+#else	// OV_SOCKET_IO_URING_SUPPORTED
+		return String::FormatString("<IoUringPoller: %p, not supported>", this);
+#endif	// OV_SOCKET_IO_URING_SUPPORTED
+	}
+}  // namespace ov
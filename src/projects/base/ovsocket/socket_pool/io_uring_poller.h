@@ -0,0 +1,129 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/ovlibrary/ovlibrary.h>
+
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+
+#include "../socket_datastructure.h"
+
+#if IS_LINUX
+#	if __has_include(<linux/io_uring.h>)
+#		include <linux/io_uring.h>
+#		define OV_SOCKET_IO_URING_SUPPORTED 1
+#	endif
+#endif	// IS_LINUX
+
+#ifndef OV_SOCKET_IO_URING_SUPPORTED
+#	define OV_SOCKET_IO_URING_SUPPORTED 0
+#endif	// OV_SOCKET_IO_URING_SUPPORTED
+
+namespace ov
+{
+	// An epoll-compatible readiness poller built on io_uring multishot IORING_OP_POLL_ADD.
+	//
+	// - Registrations/unregistrations made on the worker thread are queued in the SQ and submitted
+	//   together with the next Wait(), so they don't need a separate system call like epoll_ctl()
+	// - If completions are already in the CQ, Wait() returns them without entering the kernel
+	//
+	// Multishot polls are edge-triggered (like EPOLLET), and the events are returned as epoll_event,
+	// so SocketPoolWorker can process them in the same way as epoll.
+	class IoUringPoller
+	{
+	public:
+		IoUringPoller() = default;
+		~IoUringPoller();
+
+		// Checks whether the running kernel supports the features this poller needs
+		static bool IsSupported();
+
+		bool Create(uint32_t entries);
+		bool Destroy();
+
+		int GetNativeHandle() const
+		{
+			return _ring_fd;
+		}
+
+		// The thread that calls Wait(). Requests from this thread are submitted on the next Wait()
+		void SetWaiterThread(std::thread::id thread_id)
+		{
+			_waiter_thread_id = thread_id;
+		}
+
+		// events: EPOLLIN, EPOLLOUT, ... (EPOLLET is implied)
+		// Returns false with errno set if an error occurred
+		bool Add(int fd, uint32_t events, void *ptr);
+		bool Delete(int fd);
+
+		// Returns the number of events stored in events, or -1 with errno set if an error occurred
+		int Wait(epoll_event *events, int max_events, int timeout_msec);
+
+		String ToString() const;
+
+	protected:
+#if OV_SOCKET_IO_URING_SUPPORTED
+		struct Registration
+		{
+			int fd;
+			uint32_t events;
+			void *ptr;
+		};
+
+		bool MapRings(const io_uring_params &params);
+		void UnmapRings();
+
+		// Must be called while _mutex is locked
+		io_uring_sqe *GetSqe();
+		bool SubmitPollAdd(uint64_t id, const Registration &registration);
+		bool SubmitPollRemove(uint64_t id);
+		// Submits pending SQEs immediately unless called from the waiter thread
+		bool SubmitIfNeeded();
+		// Submits pending SQEs now. The SQEs that are not submitted (on error, or if the kernel consumes only some of them) stay pending
+		bool SubmitPending();
+		int Enter(uint32_t to_submit, uint32_t min_complete, uint32_t flags, const void *arg, size_t arg_size);
+
+		int _ring_fd = -1;
+
+		void *_sq_ring = nullptr;
+		size_t _sq_ring_size = 0;
+		void *_cq_ring = nullptr;
+		size_t _cq_ring_size = 0;
+		io_uring_sqe *_sqes = nullptr;
+		size_t _sqes_size = 0;
+
+		uint32_t *_sq_head = nullptr;
+		uint32_t *_sq_tail = nullptr;
+		uint32_t _sq_mask = 0;
+		uint32_t _sq_entries = 0;
+		uint32_t *_sq_array = nullptr;
+
+		uint32_t *_cq_head = nullptr;
+		uint32_t *_cq_tail = nullptr;
+		uint32_t _cq_mask = 0;
+		io_uring_cqe *_cqes = nullptr;
+
+		// Protects SQ and the registration maps
+		std::mutex _mutex;
+		uint32_t _pending_submit_count = 0;
+
+		// user_data 0 is used for requests whose completions are ignored
+		uint64_t _last_id = 0;
+		// key: user_data
+		std::unordered_map<uint64_t, Registration> _registration_map;
+		// key: fd, value: user_data
+		std::unordered_map<int, uint64_t> _fd_map;
+#endif	// OV_SOCKET_IO_URING_SUPPORTED
+
+		std::atomic<std::thread::id> _waiter_thread_id{};
+	};
+}  // namespace ov
@@ -44,6 +44,47 @@ namespace ov
 		return _type;
 	}
 
+	std::shared_ptr<XdpTransmitter> SocketPool::CreateXdpTransmitter()
+	{
+		std::lock_guard lock_guard(_xdp_mutex);
+
+		if (_xdp_interface_name.IsEmpty() || (_xdp_next_queue_id >= _xdp_queue_count))
+		{
+			return nullptr;
+		}
+
+		auto transmitter = std::make_shared<XdpTransmitter>();
+
+		if (transmitter->Create(_xdp_interface_name.CStr(), _xdp_next_queue_id, _xdp_frame_count, _xdp_zero_copy) == false)
+		{
+			logtw("Could not use XDP egress on %s queue %u, the datagrams will be sent through the kernel", _xdp_interface_name.CStr(), _xdp_next_queue_id);
+			return nullptr;
+		}
+
+		_xdp_next_queue_id++;
+
+		return transmitter;
+	}
+
+	bool SocketPool::PinWorkersToSteeredCpus()
+	{
+		std::lock_guard lock_guard(_worker_list_mutex);
+
+		auto worker_count = _worker_list.size();
+		bool succeeded = true;
+
+		for (size_t index = 0; index < worker_count; index++)
+		{
+			if (_worker_list[index]->SetCpuGroup(index, worker_count) == false)
+			{
+				logaw("Could not pin worker #%zu to the CPUs steered to it", index);
+				succeeded = false;
+			}
+		}
+
+		return succeeded;
+	}
+
 	bool SocketPool::Initialize(int worker_count)
 	{
 		if (_initialized)
@@ -82,6 +123,16 @@ namespace ov
 					break;
 				}
 
+				if (_use_worker_numa_node)
+				{
+					auto node_index = (_worker_numa_node >= 0) ? static_cast<size_t>(_worker_numa_node.load()) : static_cast<size_t>(index);
+
+					if (instance->SetNumaNode(node_index) == false)
+					{
+						logaw("Could not set the NUMA node of worker #%d to %zu", index, node_index);
+					}
+				}
+
 				_worker_list.emplace_back(instance);
 			}
 
@@ -75,6 +75,41 @@ namespace ov
 			return pool;
 		}
 
+		// Applies to the workers initialized after this call
+		static void SetDefaultEventBackend(SocketEventBackend backend)
+		{
+			_default_event_backend = backend;
+		}
+
+		static SocketEventBackend GetDefaultEventBackend()
+		{
+			return _default_event_backend;
+		}
+
+		// Pins the workers initialized after this call to the CPUs of the NUMA node <node_index>.
+		// If <node_index> is negative, the workers are distributed over the nodes.
+		static void SetWorkerNumaNode(int node_index)
+		{
+			_worker_numa_node = node_index;
+			_use_worker_numa_node = true;
+		}
+
+		// Creates an AF_XDP transmitter for each UDP worker initialized after this call.
+		// The workers are bound to the TX queues 0..<queue_count>-1 of <interface_name> in the order they are initialized,
+		// and the workers after that send the datagrams through the kernel
+		static void SetXdpEgress(const ov::String &interface_name, uint32_t queue_count, uint32_t frame_count, bool zero_copy)
+		{
+			std::lock_guard lock_guard(_xdp_mutex);
+
+			_xdp_interface_name = interface_name;
+			_xdp_queue_count = queue_count;
+			_xdp_frame_count = frame_count;
+			_xdp_zero_copy = zero_copy;
+		}
+
+		// Returns nullptr if XDP egress is not configured, or all the queues are taken
+		static std::shared_ptr<XdpTransmitter> CreateXdpTransmitter();
+
 		ov::String GetName() const
 		{
 			return _name;
@@ -84,6 +119,10 @@ namespace ov
 
 		bool Initialize(int worker_count);
 
+		// Pins the <n>th worker to the CPUs of which (number % worker count) is <n>, the CPUs that the CPU steering program
+		// of the SO_REUSEPORT listeners maps to the listener of the worker (See ServerSocket::AttachReusePortCpuSteering())
+		bool PinWorkersToSteeredCpus();
+
 		int GetWorkerCount() const
 		{
 			return static_cast<int>(_worker_list.size());
@@ -110,6 +149,36 @@ namespace ov
 			return nullptr;
 		}
 
+		// Allocates a socket on the specified worker instead of the idle one
+		// (Used to keep the sockets on the same worker, such as clients accepted by a SO_REUSEPORT listener)
+		template <typename Tsocket = ov::Socket, typename... Targuments>
+		std::shared_ptr<Tsocket> AllocSocketOnWorker(const std::shared_ptr<SocketPoolWorker> &worker, const SocketFamily family, Targuments... args)
+		{
+			if (worker == nullptr)
+			{
+				OV_ASSERT2(worker != nullptr);
+				return nullptr;
+			}
+
+			worker->IncreaseSocketCount();
+
+			auto socket = worker->AllocSocket<Tsocket>(family, args...);
+
+			if (socket == nullptr)
+			{
+				// Rollback
+				worker->DecreaseSocketCount();
+			}
+
+			return socket;
+		}
+
+		template <typename Tsocket = ov::Socket, typename... Targuments>
+		std::shared_ptr<Tsocket> AllocSocketOnWorker(int worker_index, const SocketFamily family, Targuments... args)
+		{
+			return AllocSocketOnWorker<Tsocket>(GetWorker(worker_index), family, args...);
+		}
+
 		bool ReleaseSocket(const std::shared_ptr<Socket> &socket)
 		{
 			return socket->GetSocketPoolWorker()->ReleaseSocket(socket);
@@ -139,8 +208,33 @@ namespace ov
 			return worker;
 		}
 
+		std::shared_ptr<SocketPoolWorker> GetWorker(int worker_index) const
+		{
+			std::lock_guard lock_guard(_worker_list_mutex);
+
+			if ((worker_index < 0) || (worker_index >= static_cast<int>(_worker_list.size())))
+			{
+				OV_ASSERT(false, "Invalid worker index: %d (worker count: %zu)", worker_index, _worker_list.size());
+				return nullptr;
+			}
+
+			return _worker_list[worker_index];
+		}
+
 		bool UninitializeInternal();
 
+		inline static std::atomic<SocketEventBackend> _default_event_backend{SocketEventBackend::Epoll};
+		inline static std::atomic<bool> _use_worker_numa_node{false};
+		inline static std::atomic<int> _worker_numa_node{-1};
+
+		inline static std::mutex _xdp_mutex;
+		inline static ov::String _xdp_interface_name;
+		inline static uint32_t _xdp_queue_count = 0;
+		inline static uint32_t _xdp_frame_count = 0;
+		inline static bool _xdp_zero_copy = false;
+		// The next TX queue to bind
+		inline static uint32_t _xdp_next_queue_id = 0;
+
 		ov::String _name;
 
 		SocketType _type = SocketType::Unknown;
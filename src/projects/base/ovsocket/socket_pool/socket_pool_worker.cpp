@@ -51,9 +51,19 @@ namespace ov
 			return false;
 		}
 
+		if (GetType() == SocketType::Udp)
+		{
+			_xdp_transmitter = SocketPool::CreateXdpTransmitter();
+		}
+
 		_stop_epoll_thread = false;
 		_epoll_thread = std::thread(&SocketPoolWorker::ThreadProc, this);
 
+		if (_io_uring != nullptr)
+		{
+			_io_uring->SetWaiterThread(_epoll_thread.get_id());
+		}
+
 		auto name = _pool->GetName();
 		name.Prepend("SP");
 		name = name.Replace(" ", "");
@@ -64,6 +74,16 @@ namespace ov
 		return true;
 	}
 
+	bool SocketPoolWorker::SetNumaNode(size_t node_index)
+	{
+		return _epoll_thread.joinable() && ov::Platform::SetThreadNumaNode(_epoll_thread, node_index);
+	}
+
+	bool SocketPoolWorker::SetCpuGroup(size_t group_index, size_t group_count)
+	{
+		return _epoll_thread.joinable() && ov::Platform::SetThreadCpuGroup(_epoll_thread, group_index, group_count);
+	}
+
 	bool SocketPoolWorker::Uninitialize()
 	{
 		if (GetNativeHandle() == InvalidSocket)
@@ -73,8 +93,6 @@ namespace ov
 			return false;
 		}
 
-		_connection_callback_queue.Clear();
-
 		_stop_epoll_thread = true;
 
 		if (_epoll_thread.joinable())
@@ -96,10 +114,24 @@ namespace ov
 			_sockets_to_dispatch.clear();
 		}
 
-		_connection_timed_out_queue.clear();
+		_timer_wheel.Clear();
 
 		_gc_candidates.clear();
 
+		if (_xdp_transmitter != nullptr)
+		{
+			_xdp_transmitter->Destroy();
+			_xdp_transmitter = nullptr;
+		}
+
+		if (_io_uring != nullptr)
+		{
+			// _epoll is owned by _io_uring
+			_io_uring->Destroy();
+			_io_uring = nullptr;
+			_epoll = InvalidSocket;
+		}
+
 		OV_SAFE_FUNC(_epoll, InvalidSocket, ::close, );
 		OV_SAFE_FUNC(_srt_epoll, InvalidSocket, ::srt_close, );
 
@@ -126,7 +158,29 @@ namespace ov
 		{
 			case SocketType::Udp:
 			case SocketType::Tcp:
-				_epoll = ::epoll_create1(0);
+				if (SocketPool::GetDefaultEventBackend() == SocketEventBackend::IoUring)
+				{
+					if (IoUringPoller::IsSupported())
+					{
+						auto io_uring = std::make_shared<IoUringPoller>();
+
+						if (io_uring->Create(EpollMaxEvents))
+						{
+							_io_uring = io_uring;
+							_epoll = _io_uring->GetNativeHandle();
+						}
+					}
+
+					if (_io_uring == nullptr)
+					{
+						logaw("Could not use io_uring for %s, epoll will be used instead", StringFromSocketType(GetType()));
+					}
+				}
+
+				if (_epoll == InvalidSocket)
+				{
+					_epoll = ::epoll_create1(0);
+				}
 
 				if (_epoll != InvalidSocket)
 				{
@@ -168,8 +222,9 @@ namespace ov
 		}
 		else
 		{
-			logad("Epoll is created for %s",
-				  StringFromSocketType(GetType()));
+			logad("Epoll is created for %s (backend: %s)",
+				  StringFromSocketType(GetType()),
+				  StringFromSocketEventBackend((_io_uring != nullptr) ? SocketEventBackend::IoUring : SocketEventBackend::Epoll));
 		}
 
 		return (error == nullptr);
@@ -214,8 +269,15 @@ namespace ov
 
 			if (socket->HasExpiredCommand())
 			{
-				// Sockets that have failed to send data for a long time are forced to shut down
-				logaw("Failed to send data for %dms - This socket is going to be garbage collected (%s)", OV_SOCKET_EXPIRE_TIMEOUT, socket->ToString().CStr());
+				// Sockets that have failed to send data for a long time (or too much data) are forced to shut down
+				if (socket->IsEvicted())
+				{
+					logaw("Too much data is waiting to be sent - This socket is going to be garbage collected (%s)", socket->ToString().CStr());
+				}
+				else
+				{
+					logaw("Failed to send data for %dms - This socket is going to be garbage collected (%s)", OV_SOCKET_EXPIRE_TIMEOUT, socket->ToString().CStr());
+				}
 
 				DeleteFromEpoll(socket);
 				socket->CloseImmediatelyWithState(SocketState::Disconnected);
@@ -235,37 +297,16 @@ namespace ov
 		}
 	}
 
-	void SocketPoolWorker::CallbackTimedOutConnections()
-	{
-		if (_connection_timed_out_queue.size() <= 0)
-		{
-			return;
-		}
-
-		_connection_timed_out_queue_mutex.lock();
-		auto timed_out_queue = std::move(_connection_timed_out_queue);
-		_connection_timed_out_queue_mutex.unlock();
-
-		auto socket_error = SocketError::CreateError("Connection timed out (by worker)");
-
-		for (auto socket : timed_out_queue)
-		{
-			if (socket->GetState() == SocketState::Connecting)
-			{
-				socket->OnConnectedEvent(socket_error);
-			}
-		}
-	}
-
 	void SocketPoolWorker::ThreadProc()
 	{
-		_connection_callback_queue.Start();
+		ov::ThreadRegistry::Registration registration("SocketPoolWorker");
 
 		_gc_interval.Start();
 
 		while (_stop_epoll_thread == false)
 		{
-			int count = EpollWait(100);
+			// Wakes up when the first timer expires
+			int count = EpollWait(std::min(100, _timer_wheel.GetNextTimeoutMsec()));
 
 			if (count < 0)
 			{
@@ -273,7 +314,7 @@ namespace ov
 			}
 			else
 			{
-				CallbackTimedOutConnections();
+				_timer_wheel.Advance();
 
 				for (int index = 0; index < count; index++)
 				{
@@ -447,6 +488,26 @@ namespace ov
 				}
 			}
 
+			if (_sockets_to_read.empty() == false)
+			{
+				std::unordered_map<std::shared_ptr<Socket>, std::shared_ptr<Socket>> socket_list;
+
+				{
+					std::lock_guard lock_guard(_sockets_to_read_mutex);
+					std::swap(socket_list, _sockets_to_read);
+				}
+
+				for (auto socket_item : socket_list)
+				{
+					auto socket = socket_item.second;
+
+					if (socket->GetState() == SocketState::Connected)
+					{
+						socket->OnDataAvailableEvent();
+					}
+				}
+			}
+
 			if (_sockets_to_dispatch.empty() == false)
 			{
 				// Move _extra_epoll_events to events to avoid blocking
@@ -501,8 +562,6 @@ namespace ov
 			MergeSocketList();
 		}
 
-		_connection_callback_queue.Stop();
-
 		// Clean up all sockets
 		for (auto &socket_item : _socket_map)
 		{
@@ -544,7 +603,11 @@ namespace ov
 
 				logad("Trying to add socket #%d to epoll...", native_handle);
 
-				if (::epoll_ctl(_epoll, EPOLL_CTL_ADD, native_handle, &event) == -1)
+				bool result = (_io_uring != nullptr)
+								  ? _io_uring->Add(native_handle, event.events, event.data.ptr)
+								  : (::epoll_ctl(_epoll, EPOLL_CTL_ADD, native_handle, &event) != -1);
+
+				if (result == false)
 				{
 					error = Error::CreateErrorFromErrno();
 				}
@@ -601,7 +664,9 @@ namespace ov
 		{
 			case SocketType::Udp:
 			case SocketType::Tcp:
-				event_count = ::epoll_wait(_epoll, _epoll_events.data(), EpollMaxEvents, timeout_msec);
+				event_count = (_io_uring != nullptr)
+								  ? _io_uring->Wait(_epoll_events.data(), EpollMaxEvents, timeout_msec)
+								  : ::epoll_wait(_epoll, _epoll_events.data(), EpollMaxEvents, timeout_msec);
 
 				if (event_count == 0)
 				{
@@ -733,16 +798,25 @@ namespace ov
 		_sockets_to_dispatch[socket] = socket;
 	}
 
+	void SocketPoolWorker::EnqueueToReadLater(const std::shared_ptr<Socket> &socket)
+	{
+		std::lock_guard lock_guard(_sockets_to_read_mutex);
+
+		_sockets_to_read[socket] = socket;
+	}
+
 	void SocketPoolWorker::EnqueueToCheckConnectionTimeOut(const std::shared_ptr<Socket> &socket, int timeout_msec)
 	{
-		_connection_callback_queue.Push(
-			[=](void *parameter) -> DelayQueueAction {
-				std::lock_guard lock_guard(_connection_timed_out_queue_mutex);
-				_connection_timed_out_queue.push_back(socket);
+		_timer_wheel.Schedule(
+			timeout_msec,
+			[socket]() -> DelayQueueAction {
+				if (socket->GetState() == SocketState::Connecting)
+				{
+					socket->OnConnectedEvent(SocketError::CreateError("Connection timed out (by worker)"));
+				}
+
 				return DelayQueueAction::Stop;
-			},
-			nullptr,
-			timeout_msec);
+			});
 	}
 
 	bool SocketPoolWorker::DeleteFromEpoll(const std::shared_ptr<Socket> &socket)
@@ -764,7 +838,11 @@ namespace ov
 		{
 			case SocketType::Udp:
 			case SocketType::Tcp: {
-				if (::epoll_ctl(_epoll, EPOLL_CTL_DEL, native_handle, nullptr) == -1)
+				bool result = (_io_uring != nullptr)
+								  ? _io_uring->Delete(native_handle)
+								  : (::epoll_ctl(_epoll, EPOLL_CTL_DEL, native_handle, nullptr) != -1);
+
+				if (result == false)
 				{
 					error = Error::CreateErrorFromErrno();
 				}
@@ -830,10 +908,10 @@ namespace ov
 		String description;
 
 		description.AppendFormat(
-			"<SocketPoolWorker: %p, socket_map: %zu, insert queue: %zu, delete queue: %zu, connection queue: %zu>",
+			"<SocketPoolWorker: %p, socket_map: %zu, insert queue: %zu, delete queue: %zu, timers: %zu>",
 			this, _socket_map.size(),
 			_sockets_to_insert.size(), _sockets_to_delete.size(),
-			_connection_timed_out_queue.size());
+			_timer_wheel.GetCount());
 
 		return description;
 	}
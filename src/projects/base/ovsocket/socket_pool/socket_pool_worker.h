@@ -10,6 +10,8 @@
 
 #include "../socket.h"
 #include "../socket_datastructure.h"
+#include "io_uring_poller.h"
+#include "xdp_transmitter.h"
 
 namespace ov
 {
@@ -31,6 +33,11 @@ namespace ov
 		bool Initialize();
 		bool Uninitialize();
 
+		// Pins the thread of the worker to the CPUs of the NUMA node (must be called after Initialize())
+		bool SetNumaNode(size_t node_index);
+		// Pins the thread of the worker to the CPUs of which (number % group_count) is <group_index> (must be called after Initialize())
+		bool SetCpuGroup(size_t group_index, size_t group_count);
+
 		int GetNativeHandle() const;
 
 		template <typename Tsocket = Socket, typename... Targuments>
@@ -78,8 +85,6 @@ namespace ov
 
 		void GarbageCollection();
 
-		void CallbackTimedOutConnections();
-
 		void ThreadProc();
 
 		bool AddToEpoll(const std::shared_ptr<Socket> &socket);
@@ -89,6 +94,7 @@ namespace ov
 		void ConvertSrtEventToEpollEvent(const SRT_EPOLL_EVENT &srt_event, epoll_event *event);
 
 		void EnqueueToDispatchLater(const std::shared_ptr<Socket> &socket);
+		void EnqueueToReadLater(const std::shared_ptr<Socket> &socket);
 		void EnqueueToCheckConnectionTimeOut(const std::shared_ptr<Socket> &socket, int timeout_msec);
 
 	protected:
@@ -115,10 +121,8 @@ namespace ov
 		StopWatch _gc_interval;
 		std::map<int, std::shared_ptr<Socket>> _gc_candidates;
 
-		// A queue for handling errors such as connection timeout in nonblocking mode.
-		inline static DelayQueue _connection_callback_queue{"ConnectionCB"};
-		std::mutex _connection_timed_out_queue_mutex;
-		std::deque<std::shared_ptr<Socket>> _connection_timed_out_queue;
+		// Timers run by the worker thread, such as the connection timeout in nonblocking mode
+		TimerWheel _timer_wheel;
 
 		// Common variables
 		std::thread _epoll_thread;
@@ -131,8 +135,17 @@ namespace ov
 		std::mutex _sockets_to_dispatch_mutex;
 		std::unordered_map<std::shared_ptr<Socket>, std::shared_ptr<Socket>> _sockets_to_dispatch;
 
+		// Sockets that need to be read without events from epolls (See Socket::ResumeRead())
+		std::mutex _sockets_to_read_mutex;
+		std::unordered_map<std::shared_ptr<Socket>, std::shared_ptr<Socket>> _sockets_to_read;
+
 		// Related to epoll
 		socket_t _epoll = InvalidSocket;
+		// If io_uring is used, _epoll is the file descriptor of the ring
+		std::shared_ptr<IoUringPoller> _io_uring;
+
+		// The UDP sockets of this worker send through this if XDP egress is enabled
+		std::shared_ptr<XdpTransmitter> _xdp_transmitter;
 
 		// Related to SRT
 		SRTSOCKET _srt_epoll = InvalidSocket;
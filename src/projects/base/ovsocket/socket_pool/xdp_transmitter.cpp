@@ -0,0 +1,571 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "xdp_transmitter.h"
+
+#if OV_SOCKET_XDP_SUPPORTED
+#	include <arpa/inet.h>
+#	include <net/ethernet.h>
+#	include <net/if.h>
+#	include <netinet/ip.h>
+#	include <netinet/udp.h>
+#	include <sys/ioctl.h>
+#	include <sys/mman.h>
+#	include <sys/socket.h>
+#	include <unistd.h>
+
+#	include <fstream>
+#endif	// OV_SOCKET_XDP_SUPPORTED
+
+#undef OV_LOG_TAG
+#define OV_LOG_TAG "Socket.Pool.Xdp"
+
+#ifndef AF_XDP
+#	define AF_XDP 44
+#endif	// AF_XDP
+
+#ifndef SOL_XDP
+#	define SOL_XDP 283
+#endif	// SOL_XDP
+
+namespace ov
+{
+#if OV_SOCKET_XDP_SUPPORTED
+	namespace
+	{
+		inline uint32_t LoadAcquire(const uint32_t *value)
+		{
+			return __atomic_load_n(value, __ATOMIC_ACQUIRE);
+		}
+
+		inline void StoreRelease(uint32_t *value, uint32_t new_value)
+		{
+			__atomic_store_n(value, new_value, __ATOMIC_RELEASE);
+		}
+
+		uint16_t ComputeIpv4HeaderChecksum(const void *header, size_t length)
+		{
+			auto words = static_cast<const uint16_t *>(header);
+			uint32_t sum = 0;
+
+			for (size_t index = 0; index < length / 2; index++)
+			{
+				sum += words[index];
+			}
+
+			while (sum >> 16)
+			{
+				sum = (sum & 0xFFFF) + (sum >> 16);
+			}
+
+			return static_cast<uint16_t>(~sum);
+		}
+
+		constexpr size_t HeadersSize = sizeof(ether_header) + sizeof(iphdr) + sizeof(udphdr);
+	}  // namespace
+#endif	// OV_SOCKET_XDP_SUPPORTED
+
+	XdpTransmitter::~XdpTransmitter()
+	{
+		Destroy();
+	}
+
+	bool XdpTransmitter::Create(const char *interface_name, uint32_t queue_id, uint32_t frame_count, bool zero_copy)
+	{
+#if OV_SOCKET_XDP_SUPPORTED
+		std::lock_guard lock_guard(_mutex);
+
+		if (_socket != -1)
+		{
+			logte("AF_XDP socket is already created: %s", ToString().CStr());
+			return false;
+		}
+
+		if (LoadInterfaceInfo(interface_name) == false)
+		{
+			return false;
+		}
+
+		_queue_id = queue_id;
+		_zero_copy = zero_copy;
+
+		// The sizes of the rings must be a power of 2
+		uint32_t ring_size = 64;
+		while (ring_size < frame_count)
+		{
+			ring_size <<= 1;
+		}
+
+		_socket = ::socket(AF_XDP, SOCK_RAW, 0);
+
+		if (_socket == -1)
+		{
+			logte("Could not create AF_XDP socket: %s", Error::CreateErrorFromErrno()->What());
+			return false;
+		}
+
+		do
+		{
+			_umem_size = static_cast<size_t>(ring_size) * XDP_TRANSMITTER_FRAME_SIZE;
+			auto umem = ::mmap(nullptr, _umem_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+			if (umem == MAP_FAILED)
+			{
+				logte("Could not allocate UMEM (%zu bytes): %s", _umem_size, Error::CreateErrorFromErrno()->What());
+				break;
+			}
+
+			_umem = static_cast<uint8_t *>(umem);
+
+			xdp_umem_reg umem_reg{};
+			umem_reg.addr = reinterpret_cast<uint64_t>(_umem);
+			umem_reg.len = _umem_size;
+			umem_reg.chunk_size = XDP_TRANSMITTER_FRAME_SIZE;
+			umem_reg.headroom = 0;
+
+			if (::setsockopt(_socket, SOL_XDP, XDP_UMEM_REG, &umem_reg, sizeof(umem_reg)) != 0)
+			{
+				logte("Could not register UMEM: %s", Error::CreateErrorFromErrno()->What());
+				break;
+			}
+
+			// The fill ring is required by bind() even though nothing is received
+			uint32_t fill_ring_size = 64;
+
+			if ((::setsockopt(_socket, SOL_XDP, XDP_UMEM_FILL_RING, &fill_ring_size, sizeof(fill_ring_size)) != 0) ||
+				(::setsockopt(_socket, SOL_XDP, XDP_UMEM_COMPLETION_RING, &ring_size, sizeof(ring_size)) != 0) ||
+				(::setsockopt(_socket, SOL_XDP, XDP_TX_RING, &ring_size, sizeof(ring_size)) != 0))
+			{
+				logte("Could not set the sizes of the rings: %s", Error::CreateErrorFromErrno()->What());
+				break;
+			}
+
+			xdp_mmap_offsets offsets{};
+			socklen_t offsets_length = sizeof(offsets);
+
+			if (::getsockopt(_socket, SOL_XDP, XDP_MMAP_OFFSETS, &offsets, &offsets_length) != 0)
+			{
+				logte("Could not get the offsets of the rings: %s", Error::CreateErrorFromErrno()->What());
+				break;
+			}
+
+			if ((MapRing(_tx_ring, offsets.tx, ring_size, sizeof(xdp_desc), XDP_PGOFF_TX_RING) == false) ||
+				(MapRing(_completion_ring, offsets.cr, ring_size, sizeof(uint64_t), XDP_UMEM_PGOFF_COMPLETION_RING) == false))
+			{
+				break;
+			}
+
+			sockaddr_xdp address{};
+			address.sxdp_family = AF_XDP;
+			address.sxdp_ifindex = _interface_index;
+			address.sxdp_queue_id = _queue_id;
+			address.sxdp_flags = _zero_copy ? XDP_ZEROCOPY : XDP_COPY;
+#	if defined(XDP_USE_NEED_WAKEUP)
+			address.sxdp_flags |= XDP_USE_NEED_WAKEUP;
+#	endif	// defined(XDP_USE_NEED_WAKEUP)
+
+			if (::bind(_socket, reinterpret_cast<const sockaddr *>(&address), sizeof(address)) != 0)
+			{
+				logte("Could not bind AF_XDP socket to %s queue %u: %s", _interface_name.CStr(), _queue_id, Error::CreateErrorFromErrno()->What());
+				break;
+			}
+
+			_free_frames.reserve(ring_size);
+
+			for (uint32_t index = 0; index < ring_size; index++)
+			{
+				_free_frames.push_back(static_cast<uint64_t>(index) * XDP_TRANSMITTER_FRAME_SIZE);
+			}
+
+			_tx_producer = *(_tx_ring.producer);
+
+			logti("AF_XDP transmitter is created: %s", ToString().CStr());
+
+			return true;
+		} while (false);
+
+		// Failed
+		DestroyInternal();
+
+		return false;
+#else	// OV_SOCKET_XDP_SUPPORTED
+		logte("AF_XDP is not supported on this platform");
+		return false;
+#endif	// OV_SOCKET_XDP_SUPPORTED
+	}
+
+	bool XdpTransmitter::Destroy()
+	{
+		std::lock_guard lock_guard(_mutex);
+
+		DestroyInternal();
+
+		return true;
+	}
+
+	void XdpTransmitter::DestroyInternal()
+	{
+#if OV_SOCKET_XDP_SUPPORTED
+		UnmapRing(_tx_ring);
+		UnmapRing(_completion_ring);
+
+		OV_SAFE_FUNC(_socket, -1, ::close, );
+
+		if (_umem != nullptr)
+		{
+			::munmap(_umem, _umem_size);
+			_umem = nullptr;
+			_umem_size = 0;
+		}
+
+		_free_frames.clear();
+#endif	// OV_SOCKET_XDP_SUPPORTED
+	}
+
+#if OV_SOCKET_XDP_SUPPORTED
+	bool XdpTransmitter::LoadInterfaceInfo(const char *interface_name)
+	{
+		_interface_name = interface_name;
+		_interface_index = static_cast<int>(::if_nametoindex(interface_name));
+
+		if (_interface_index == 0)
+		{
+			logte("Could not find the interface: %s", interface_name);
+			return false;
+		}
+
+		int fd = ::socket(AF_INET, SOCK_DGRAM, 0);
+
+		if (fd == -1)
+		{
+			logte("Could not create a socket to query the interface: %s", Error::CreateErrorFromErrno()->What());
+			return false;
+		}
+
+		ifreq request{};
+		::strncpy(request.ifr_name, interface_name, IFNAMSIZ - 1);
+
+		bool result = false;
+
+		do
+		{
+			if (::ioctl(fd, SIOCGIFHWADDR, &request) != 0)
+			{
+				logte("Could not get the MAC address of %s: %s", interface_name, Error::CreateErrorFromErrno()->What());
+				break;
+			}
+
+			::memcpy(_mac_address.data(), request.ifr_hwaddr.sa_data, _mac_address.size());
+
+			if (::ioctl(fd, SIOCGIFADDR, &request) != 0)
+			{
+				logte("Could not get the IPv4 address of %s: %s", interface_name, Error::CreateErrorFromErrno()->What());
+				break;
+			}
+
+			_ipv4_address = reinterpret_cast<const sockaddr_in *>(&request.ifr_addr)->sin_addr.s_addr;
+
+			if (::ioctl(fd, SIOCGIFMTU, &request) == 0)
+			{
+				_mtu = request.ifr_mtu;
+			}
+
+			result = true;
+		} while (false);
+
+		::close(fd);
+
+		return result;
+	}
+
+	bool XdpTransmitter::MapRing(Ring &ring, const xdp_ring_offset &offset, uint32_t entries, size_t desc_size, off_t page_offset)
+	{
+		ring.map_size = offset.desc + entries * desc_size;
+		ring.map = ::mmap(nullptr, ring.map_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, _socket, page_offset);
+
+		if (ring.map == MAP_FAILED)
+		{
+			logte("Could not map the ring: %s", Error::CreateErrorFromErrno()->What());
+			ring.map = nullptr;
+			return false;
+		}
+
+		auto base = static_cast<uint8_t *>(ring.map);
+
+		ring.producer = reinterpret_cast<uint32_t *>(base + offset.producer);
+		ring.consumer = reinterpret_cast<uint32_t *>(base + offset.consumer);
+		ring.flags = reinterpret_cast<uint32_t *>(base + offset.flags);
+		ring.descs = base + offset.desc;
+		ring.size = entries;
+
+		return true;
+	}
+
+	void XdpTransmitter::UnmapRing(Ring &ring)
+	{
+		if (ring.map != nullptr)
+		{
+			::munmap(ring.map, ring.map_size);
+		}
+
+		ring = Ring();
+	}
+
+	void XdpTransmitter::RefreshNeighborsIfNeeded()
+	{
+		if (_neighbors_loaded && (_neighbor_refresh_watch.IsElapsed(XDP_TRANSMITTER_NEIGHBOR_REFRESH_INTERVAL_MS) == false))
+		{
+			return;
+		}
+
+		_neighbors_loaded = true;
+		_neighbor_refresh_watch.Start();
+
+		_routes.clear();
+		_neighbors.clear();
+
+		std::string line;
+		char interface_name[IFNAMSIZ * 4];
+
+		// Iface Destination Gateway Flags RefCnt Use Metric Mask ... (the addresses are in network byte order)
+		std::ifstream route_file("/proc/net/route");
+		std::getline(route_file, line);
+
+		while (std::getline(route_file, line))
+		{
+			uint32_t destination, gateway, flags, mask;
+
+			if ((::sscanf(line.c_str(), "%63s %X %X %X %*d %*d %*d %X", interface_name, &destination, &gateway, &flags, &mask) == 5) &&
+				(_interface_name == interface_name) && (flags & 0x0001))  // RTF_UP
+			{
+				_routes.push_back({destination, mask, gateway});
+			}
+		}
+
+		// IP address, HW type, Flags, HW address, Mask, Device
+		std::ifstream arp_file("/proc/net/arp");
+		std::getline(arp_file, line);
+
+		while (std::getline(arp_file, line))
+		{
+			char ip_address[64];
+			char mac_address[64];
+			uint32_t type, flags;
+
+			if ((::sscanf(line.c_str(), "%63s 0x%x 0x%x %63s %*s %63s", ip_address, &type, &flags, mac_address, interface_name) != 5) ||
+				(_interface_name != interface_name) || ((flags & 0x02) == 0))  // ATF_COM
+			{
+				continue;
+			}
+
+			in_addr address;
+			MacAddress mac;
+
+			if ((::inet_pton(AF_INET, ip_address, &address) == 1) &&
+				(::sscanf(mac_address, "%hhx:%hhx:%hhx:%hhx:%hhx:%hhx", &mac[0], &mac[1], &mac[2], &mac[3], &mac[4], &mac[5]) == 6))
+			{
+				_neighbors[address.s_addr] = mac;
+			}
+		}
+	}
+
+	const XdpTransmitter::MacAddress *XdpTransmitter::GetNextHopMacAddress(uint32_t destination) const
+	{
+		const Route *best_route = nullptr;
+
+		// Longest prefix match
+		for (const auto &route : _routes)
+		{
+			if (((destination & route.mask) == route.destination) &&
+				((best_route == nullptr) || (ntohl(route.mask) > ntohl(best_route->mask))))
+			{
+				best_route = &route;
+			}
+		}
+
+		if (best_route == nullptr)
+		{
+			return nullptr;
+		}
+
+		auto next_hop = (best_route->gateway != 0) ? best_route->gateway : destination;
+		auto neighbor = _neighbors.find(next_hop);
+
+		return (neighbor != _neighbors.end()) ? &(neighbor->second) : nullptr;
+	}
+
+	void XdpTransmitter::ReapCompletions()
+	{
+		auto consumer = *(_completion_ring.consumer);
+		auto producer = LoadAcquire(_completion_ring.producer);
+
+		if (consumer == producer)
+		{
+			return;
+		}
+
+		auto addresses = static_cast<const uint64_t *>(_completion_ring.descs);
+		auto mask = _completion_ring.size - 1;
+
+		for (; consumer != producer; consumer++)
+		{
+			_free_frames.push_back(addresses[consumer & mask]);
+		}
+
+		StoreRelease(_completion_ring.consumer, consumer);
+	}
+
+	void XdpTransmitter::Kick()
+	{
+#	if defined(XDP_USE_NEED_WAKEUP)
+		if ((__atomic_load_n(_tx_ring.flags, __ATOMIC_RELAXED) & XDP_RING_NEED_WAKEUP) == 0)
+		{
+			return;
+		}
+#	endif	// defined(XDP_USE_NEED_WAKEUP)
+
+		if (::sendto(_socket, nullptr, 0, MSG_DONTWAIT, nullptr, 0) < 0)
+		{
+			switch (errno)
+			{
+				case EAGAIN:
+				case EBUSY:
+				case ENOBUFS:
+				case ENETDOWN:
+					// The frames are sent on the next kick
+					break;
+
+				default:
+					logtd("Could not kick the TX ring of %s: %s", _interface_name.CStr(), Error::CreateErrorFromErrno()->What());
+					break;
+			}
+		}
+	}
+
+	size_t XdpTransmitter::BuildFrame(uint8_t *frame, uint32_t source_ip, uint16_t source_port, const sockaddr_in *destination, const MacAddress &destination_mac, const void *data, size_t length)
+	{
+		auto ethernet = reinterpret_cast<ether_header *>(frame);
+		::memcpy(ethernet->ether_dhost, destination_mac.data(), ETH_ALEN);
+		::memcpy(ethernet->ether_shost, _mac_address.data(), ETH_ALEN);
+		ethernet->ether_type = htons(ETHERTYPE_IP);
+
+		auto ip = reinterpret_cast<iphdr *>(frame + sizeof(ether_header));
+		ip->version = 4;
+		ip->ihl = sizeof(iphdr) / 4;
+		ip->tos = 0;
+		ip->tot_len = htons(static_cast<uint16_t>(sizeof(iphdr) + sizeof(udphdr) + length));
+		ip->id = htons(_ip_id++);
+		ip->frag_off = htons(IP_DF);
+		ip->ttl = 64;
+		ip->protocol = IPPROTO_UDP;
+		ip->check = 0;
+		ip->saddr = source_ip;
+		ip->daddr = destination->sin_addr.s_addr;
+		ip->check = ComputeIpv4HeaderChecksum(ip, sizeof(iphdr));
+
+		auto udp = reinterpret_cast<udphdr *>(frame + sizeof(ether_header) + sizeof(iphdr));
+		udp->source = source_port;
+		udp->dest = destination->sin_port;
+		udp->len = htons(static_cast<uint16_t>(sizeof(udphdr) + length));
+		// The checksum is optional for UDP over IPv4, and the payloads (SRTP) are authenticated
+		udp->check = 0;
+
+		::memcpy(frame + HeadersSize, data, length);
+
+		return HeadersSize + length;
+	}
+#endif	// OV_SOCKET_XDP_SUPPORTED
+
+	size_t XdpTransmitter::Send(const SocketAddress &local_address, const Datagram *datagrams, size_t count)
+	{
+#if OV_SOCKET_XDP_SUPPORTED
+		if ((count == 0) || (local_address.IsIPv4() == false))
+		{
+			return 0;
+		}
+
+		auto local = local_address.ToSockAddrIn4();
+		auto source_ip = local->sin_addr.s_addr;
+
+		if (source_ip == htonl(INADDR_ANY))
+		{
+			source_ip = _ipv4_address;
+		}
+		else if (source_ip != _ipv4_address)
+		{
+			// The socket is bound to the address of another interface
+			return 0;
+		}
+
+		std::lock_guard lock_guard(_mutex);
+
+		if (_socket == -1)
+		{
+			return 0;
+		}
+
+		RefreshNeighborsIfNeeded();
+		ReapCompletions();
+
+		auto descs = static_cast<xdp_desc *>(_tx_ring.descs);
+		auto mask = _tx_ring.size - 1;
+		auto free_slots = _tx_ring.size - (_tx_producer - LoadAcquire(_tx_ring.consumer));
+		size_t sent_count = 0;
+
+		for (; sent_count < count; sent_count++)
+		{
+			const auto &datagram = datagrams[sent_count];
+
+			if ((free_slots == 0) || _free_frames.empty() ||
+				(datagram.address->IsIPv4() == false) ||
+				(HeadersSize + datagram.length > XDP_TRANSMITTER_FRAME_SIZE) ||
+				(sizeof(iphdr) + sizeof(udphdr) + datagram.length > static_cast<size_t>(_mtu)))
+			{
+				break;
+			}
+
+			auto destination = datagram.address->ToSockAddrIn4();
+			auto destination_mac = GetNextHopMacAddress(destination->sin_addr.s_addr);
+
+			if (destination_mac == nullptr)
+			{
+				break;
+			}
+
+			auto frame_address = _free_frames.back();
+			_free_frames.pop_back();
+
+			auto &desc = descs[_tx_producer & mask];
+			desc.addr = frame_address;
+			desc.len = static_cast<uint32_t>(BuildFrame(_umem + frame_address, source_ip, local->sin_port, destination, *destination_mac, datagram.data, datagram.length));
+			desc.options = 0;
+
+			_tx_producer++;
+			free_slots--;
+		}
+
+		if (sent_count > 0)
+		{
+			StoreRelease(_tx_ring.producer, _tx_producer);
+			Kick();
+
+			_sent_count += sent_count;
+		}
+
+		return sent_count;
+#else	// OV_SOCKET_XDP_SUPPORTED
+		return 0;
+#endif	// OV_SOCKET_XDP_SUPPORTED
+	}
+
+	String XdpTransmitter::ToString() const
+	{
+		return String::FormatString(
+			"<XdpTransmitter: %p, interface: %s(%d), queue: %u, mode: %s, socket: %d, sent: %" PRIu64 ">",
+			this, _interface_name.CStr(), _interface_index, _queue_id, _zero_copy ? "zero-copy" : "copy", _socket, _sent_count);
+	}
+}  // namespace ov
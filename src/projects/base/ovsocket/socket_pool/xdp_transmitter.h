@@ -0,0 +1,145 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/ovlibrary/ovlibrary.h>
+
+#include <array>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "../socket_address.h"
+
+#if IS_LINUX
+#	if __has_include(<linux/if_xdp.h>)
+#		include <linux/if_xdp.h>
+#		define OV_SOCKET_XDP_SUPPORTED 1
+#	endif
+#endif	// IS_LINUX
+
+#ifndef OV_SOCKET_XDP_SUPPORTED
+#	define OV_SOCKET_XDP_SUPPORTED 0
+#endif	// OV_SOCKET_XDP_SUPPORTED
+
+// Size of a UMEM frame (the Ethernet frame of a datagram must fit in a frame)
+#define XDP_TRANSMITTER_FRAME_SIZE 2048
+// The routes and the ARP table of the interface are reloaded at this interval
+#define XDP_TRANSMITTER_NEIGHBOR_REFRESH_INTERVAL_MS 1000
+
+namespace ov
+{
+	// Sends UDP/IPv4 datagrams through an AF_XDP socket bound to a TX queue of a NIC, bypassing the UDP/IP stack of the kernel.
+	//
+	// - Only the TX ring is used, so no XDP program is attached to the interface. All inbound traffic
+	//   (STUN, DTLS, RTCP, ...) is received by the normal sockets as before
+	// - The Ethernet/IPv4/UDP headers are built here. The next hop is looked up in the routes and the ARP table of
+	//   the kernel, so a datagram to a neighbor that is not resolved yet must be sent by the normal socket
+	//   (which makes the kernel resolve it)
+	// - The payload is copied into a UMEM frame, and the frame is recycled when it appears in the completion ring
+	class XdpTransmitter
+	{
+	public:
+		struct Datagram
+		{
+			const SocketAddress *address;
+			const void *data;
+			size_t length;
+		};
+
+		XdpTransmitter() = default;
+		~XdpTransmitter();
+
+		// <frame_count> is rounded up to a power of 2
+		bool Create(const char *interface_name, uint32_t queue_id, uint32_t frame_count, bool zero_copy);
+		bool Destroy();
+
+		// Sends the datagrams from <local_address> (the local address of the UDP socket).
+		// Returns the number of datagrams sent from the front of <datagrams>, and the rest must be sent by the normal socket
+		// (IPv6, too large, the next hop is not resolved, or the TX ring is full)
+		size_t Send(const SocketAddress &local_address, const Datagram *datagrams, size_t count);
+
+		String ToString() const;
+
+	protected:
+		void DestroyInternal();
+
+#if OV_SOCKET_XDP_SUPPORTED
+		struct Ring
+		{
+			void *map = nullptr;
+			size_t map_size = 0;
+
+			uint32_t *producer = nullptr;
+			uint32_t *consumer = nullptr;
+			uint32_t *flags = nullptr;
+			void *descs = nullptr;
+
+			uint32_t size = 0;
+		};
+
+		struct Route
+		{
+			// Network byte order
+			uint32_t destination;
+			uint32_t mask;
+			uint32_t gateway;
+		};
+
+		using MacAddress = std::array<uint8_t, 6>;
+
+		bool LoadInterfaceInfo(const char *interface_name);
+		bool MapRing(Ring &ring, const xdp_ring_offset &offset, uint32_t entries, size_t desc_size, off_t page_offset);
+		void UnmapRing(Ring &ring);
+
+		void RefreshNeighborsIfNeeded();
+		const MacAddress *GetNextHopMacAddress(uint32_t destination) const;
+
+		void ReapCompletions();
+		void Kick();
+
+		size_t BuildFrame(uint8_t *frame, uint32_t source_ip, uint16_t source_port, const sockaddr_in *destination, const MacAddress &destination_mac, const void *data, size_t length);
+#endif	// OV_SOCKET_XDP_SUPPORTED
+
+		String _interface_name;
+		int _interface_index = 0;
+		uint32_t _queue_id = 0;
+		bool _zero_copy = false;
+
+		int _socket = -1;
+
+		// Protects everything below (the sockets of a worker are used by many threads)
+		mutable std::mutex _mutex;
+
+#if OV_SOCKET_XDP_SUPPORTED
+		// Network byte order
+		uint32_t _ipv4_address = 0;
+		MacAddress _mac_address{};
+		int _mtu = 1500;
+
+		uint8_t *_umem = nullptr;
+		size_t _umem_size = 0;
+		std::vector<uint64_t> _free_frames;
+
+		Ring _tx_ring;
+		Ring _completion_ring;
+		// Producer index of the TX ring (only written by this instance)
+		uint32_t _tx_producer = 0;
+
+		uint16_t _ip_id = 0;
+
+		std::vector<Route> _routes;
+		// Network byte order IPv4 address : MAC address
+		std::unordered_map<uint32_t, MacAddress> _neighbors;
+		StopWatch _neighbor_refresh_watch;
+		bool _neighbors_loaded = false;
+#endif	// OV_SOCKET_XDP_SUPPORTED
+
+		uint64_t _sent_count = 0;
+	};
+}  // namespace ov
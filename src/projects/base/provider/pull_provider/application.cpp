@@ -56,6 +56,7 @@ namespace pvd
 		auto global_no_input_timeout_ms = GetHostInfo().GetOrigins().GetProperties().GetNoInputFailoverTimeout(); 
 		auto global_unused_stream_timeout_ms = GetHostInfo().GetOrigins().GetProperties().GetUnusedStreamDeletionTimeout();
 		auto global_failback_timeout_ms = GetHostInfo().GetOrigins().GetProperties().GetStreamFailbackTimeout();	
+		auto standby_stream_count = std::max(GetHostInfo().GetOrigins().GetProperties().GetStandbyStreamCount(), 0);
 		
 		while(!_stop_collector_thread_flag)
 		{
@@ -66,6 +67,9 @@ namespace pvd
 			auto streams = _streams;
 			lock.unlock();
 
+			// Streams that haven't been used for longer than the unused stream timeout
+			std::vector<std::pair<std::chrono::system_clock::time_point, std::shared_ptr<PullStream>>> unused_streams;
+
 			for (auto const &x : streams)
 			{
 				auto stream = std::dynamic_pointer_cast<PullStream>(x.second);
@@ -87,6 +91,7 @@ namespace pvd
 					// Default Properties of PullStream
 					auto is_persistent = false;
 					auto is_failback = false;
+					auto is_prefetched = false;
 					int64_t no_input_timeout_ms = global_no_input_timeout_ms;
 					int64_t unused_stream_timeout_ms = global_unused_stream_timeout_ms;
 					int64_t failback_timeout_ms = global_failback_timeout_ms;
@@ -96,6 +101,7 @@ namespace pvd
 					{
 						is_persistent = props->IsPersistent();
 						is_failback = props->IsFailback();
+						is_prefetched = props->IsPrefetched();
 
 						if (props->GetNoInputFailoverTimeout() > 0)
 						{
@@ -157,10 +163,19 @@ namespace pvd
 						auto elapsed_time_from_last_sent = std::chrono::duration_cast<std::chrono::milliseconds>(current - stream_metrics->GetLastSentTime()).count();
 						auto elapsed_time_from_last_recv = std::chrono::duration_cast<std::chrono::milliseconds>(current - stream_metrics->GetLastRecvTime()).count();
 
-						if((elapsed_time_from_last_sent > unused_stream_timeout_ms) && (!is_persistent))
+						// The prefetched stream waits for viewers, it is deleted when it is no longer popular
+						if((elapsed_time_from_last_sent > unused_stream_timeout_ms) && (!is_persistent) && (!is_prefetched))
 						{
-							logtw("%s/%s(%u) stream will be deleted because it hasn't been used for %u milliseconds", stream->GetApplicationInfo().GetName().CStr(), stream->GetName().CStr(), stream->GetId(), elapsed_time_from_last_sent);
-							DeleteStream(stream);
+							if ((standby_stream_count > 0) && (elapsed_time_from_last_recv <= no_input_timeout_ms))
+							{
+								// It is decided after the loop whether to delete it or keep it as a standby stream
+								unused_streams.emplace_back(stream_metrics->GetLastSentTime(), stream);
+							}
+							else
+							{
+								logtw("%s/%s(%u) stream will be deleted because it hasn't been used for %u milliseconds", stream->GetApplicationInfo().GetName().CStr(), stream->GetName().CStr(), stream->GetId(), elapsed_time_from_last_sent);
+								DeleteStream(stream);
+							}
 						}
 						// The stream type is pull stream, if packets do NOT arrive for more than 3 seconds, it is a seriously warning situation
 						else if(elapsed_time_from_last_recv > no_input_timeout_ms && (!is_persistent))
@@ -175,6 +190,28 @@ namespace pvd
 				}
 			}
 
+			// The most recently used streams are kept connected (up to <StandbyStreamCount>),
+			// so the next request for them is served from a live stream instead of reconnecting to the origin.
+			std::sort(unused_streams.begin(), unused_streams.end(), [](const auto &a, const auto &b) {
+				return a.first > b.first;
+			});
+
+			auto current = std::chrono::system_clock::now();
+			for (size_t index = 0; index < unused_streams.size(); index++)
+			{
+				auto &stream = unused_streams[index].second;
+				auto elapsed_time_from_last_sent = std::chrono::duration_cast<std::chrono::milliseconds>(current - unused_streams[index].first).count();
+
+				if (index < static_cast<size_t>(standby_stream_count))
+				{
+					logtd("%s/%s(%u) stream is kept as a standby stream although it hasn't been used for %lld milliseconds", stream->GetApplicationInfo().GetName().CStr(), stream->GetName().CStr(), stream->GetId(), elapsed_time_from_last_sent);
+					continue;
+				}
+
+				logtw("%s/%s(%u) stream will be deleted because it hasn't been used for %u milliseconds", stream->GetApplicationInfo().GetName().CStr(), stream->GetName().CStr(), stream->GetId(), elapsed_time_from_last_sent);
+				DeleteStream(stream);
+			}
+
 			sleep(1);
 		}
 	}
@@ -0,0 +1,196 @@
+//==============================================================================
+//
+//  PullProvider Base Class
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "origin_health.h"
+
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include "base/ovsocket/socket_address.h"
+#include "provider_private.h"
+
+namespace pvd
+{
+	ov::String OriginHealth::GetKey(const std::shared_ptr<const ov::Url> &url)
+	{
+		return ov::String::FormatString("%s://%s:%u", url->Scheme().CStr(), url->Host().CStr(), url->Port());
+	}
+
+	void OriginHealth::RecordSuccess(const std::shared_ptr<const ov::Url> &url)
+	{
+		if (url == nullptr)
+		{
+			return;
+		}
+
+		std::lock_guard<std::mutex> lock(_health_map_lock);
+		_health_map.erase(GetKey(url));
+	}
+
+	void OriginHealth::RecordFailure(const std::shared_ptr<const ov::Url> &url)
+	{
+		if (url == nullptr)
+		{
+			return;
+		}
+
+		std::lock_guard<std::mutex> lock(_health_map_lock);
+
+		auto &health = _health_map[GetKey(url)];
+
+		int64_t backoff_ms = ORIGIN_HEALTH_MIN_BACKOFF_MS;
+		for (uint32_t i = 0; (i < health.failure_count) && (backoff_ms < ORIGIN_HEALTH_MAX_BACKOFF_MS); i++)
+		{
+			backoff_ms *= 2;
+		}
+		backoff_ms = std::min<int64_t>(backoff_ms, ORIGIN_HEALTH_MAX_BACKOFF_MS);
+
+		health.failure_count++;
+		health.retry_time_ms = static_cast<int64_t>(ov::Clock::NowMSec()) + backoff_ms;
+
+		logtd("Origin %s has failed %u times in a row, it is skipped for %" PRId64 " ms", url->ToUrlString(false).CStr(), health.failure_count, backoff_ms);
+	}
+
+	bool OriginHealth::IsAvailable(const std::shared_ptr<const ov::Url> &url)
+	{
+		if (url == nullptr)
+		{
+			return false;
+		}
+
+		std::lock_guard<std::mutex> lock(_health_map_lock);
+
+		auto it = _health_map.find(GetKey(url));
+		if (it == _health_map.end())
+		{
+			return true;
+		}
+
+		return static_cast<int64_t>(ov::Clock::NowMSec()) >= it->second.retry_time_ms;
+	}
+
+	int OriginHealth::StartConnect(const ProbeTarget &target)
+	{
+		auto address = ov::SocketAddress::CreateAndGetFirst(target.url->Host(), target.port);
+		if (address.IsValid() == false)
+		{
+			return -1;
+		}
+
+		int fd = ::socket(address.ToSockAddr()->sa_family, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+		if (fd < 0)
+		{
+			return -1;
+		}
+
+		if ((::connect(fd, address.ToSockAddr(), address.GetSockAddrInLength()) < 0) && (errno != EINPROGRESS))
+		{
+			::close(fd);
+			return -1;
+		}
+
+		return fd;
+	}
+
+	int OriginHealth::Probe(const std::vector<ProbeTarget> &targets, int64_t timeout_ms)
+	{
+		std::vector<pollfd> poll_fds;
+		// Index of the target of each poll_fds
+		std::vector<size_t> target_indices;
+
+		ov::StopWatch stop_watch;
+		stop_watch.Start();
+
+		size_t next_target = 0;
+		int64_t next_start_ms = 0;
+		int winner = -1;
+
+		while (true)
+		{
+			auto elapsed_ms = stop_watch.Elapsed();
+
+			if ((next_target < targets.size()) && ((elapsed_ms >= next_start_ms) || poll_fds.empty()))
+			{
+				auto &target = targets[next_target];
+				auto fd = StartConnect(target);
+
+				if (fd >= 0)
+				{
+					poll_fds.push_back({fd, POLLOUT, 0});
+					target_indices.push_back(next_target);
+					next_start_ms = elapsed_ms + ORIGIN_PROBE_STAGGER_MS;
+				}
+				else
+				{
+					RecordFailure(target.url);
+				}
+
+				next_target++;
+				continue;
+			}
+
+			if (poll_fds.empty() || (elapsed_ms >= timeout_ms))
+			{
+				break;
+			}
+
+			auto wait_ms = timeout_ms - elapsed_ms;
+			if (next_target < targets.size())
+			{
+				wait_ms = std::min(wait_ms, next_start_ms - elapsed_ms);
+			}
+
+			if ((::poll(poll_fds.data(), poll_fds.size(), static_cast<int>(std::max<int64_t>(wait_ms, 0))) < 0) && (errno != EINTR))
+			{
+				break;
+			}
+
+			for (size_t i = 0; i < poll_fds.size();)
+			{
+				if (poll_fds[i].revents == 0)
+				{
+					i++;
+					continue;
+				}
+
+				int error = 0;
+				socklen_t error_length = sizeof(error);
+				if ((::getsockopt(poll_fds[i].fd, SOL_SOCKET, SO_ERROR, &error, &error_length) == 0) && (error == 0) && (poll_fds[i].revents & POLLOUT))
+				{
+					winner = static_cast<int>(target_indices[i]);
+					break;
+				}
+
+				RecordFailure(targets[target_indices[i]].url);
+
+				::close(poll_fds[i].fd);
+				poll_fds.erase(poll_fds.begin() + i);
+				target_indices.erase(target_indices.begin() + i);
+			}
+
+			if (winner >= 0)
+			{
+				break;
+			}
+		}
+
+		// The other attempts are cancelled (they have not connected within the timeout if there is no winner)
+		for (size_t i = 0; i < poll_fds.size(); i++)
+		{
+			if (winner < 0)
+			{
+				RecordFailure(targets[target_indices[i]].url);
+			}
+
+			::close(poll_fds[i].fd);
+		}
+
+		return winner;
+	}
+}  // namespace pvd
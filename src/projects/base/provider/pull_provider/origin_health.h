@@ -0,0 +1,59 @@
+//==============================================================================
+//
+//  PullProvider Base Class
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include "base/ovlibrary/ovlibrary.h"
+
+// An origin is skipped for this long after a failure, doubled on each consecutive failure up to ORIGIN_HEALTH_MAX_BACKOFF_MS
+#define ORIGIN_HEALTH_MIN_BACKOFF_MS	1000
+#define ORIGIN_HEALTH_MAX_BACKOFF_MS	60000
+// The next origin is probed if the previous one has not accepted the connection within this time (Happy Eyeballs, RFC 8305)
+#define ORIGIN_PROBE_STAGGER_MS	250
+#define ORIGIN_PROBE_TIMEOUT_MS	3000
+
+namespace pvd
+{
+	// Health of the origins that the pull streams connect to. It is shared by all pull streams,
+	// so an origin that failed for one request is skipped by the next requests until its backoff expires.
+	class OriginHealth : public ov::Singleton<OriginHealth>
+	{
+	public:
+		struct ProbeTarget
+		{
+			std::shared_ptr<const ov::Url> url;
+			uint16_t port = 0;
+		};
+
+		void RecordSuccess(const std::shared_ptr<const ov::Url> &url);
+		void RecordFailure(const std::shared_ptr<const ov::Url> &url);
+
+		// Returns false while the origin is in its backoff after a failure
+		bool IsAvailable(const std::shared_ptr<const ov::Url> &url);
+
+		// Connects to the targets over TCP, starting each one ORIGIN_PROBE_STAGGER_MS after the previous one
+		// or as soon as the previous one fails. The first connection established wins and the others are closed.
+		// Returns the index of the winner in <targets>, or -1 if none of them is reachable within <timeout_ms>.
+		int Probe(const std::vector<ProbeTarget> &targets, int64_t timeout_ms = ORIGIN_PROBE_TIMEOUT_MS);
+
+	private:
+		struct Health
+		{
+			// Number of the consecutive failures (0: healthy)
+			uint32_t failure_count = 0;
+			int64_t retry_time_ms = 0;
+		};
+
+		static ov::String GetKey(const std::shared_ptr<const ov::Url> &url);
+		// Returns the socket that is connecting to <target>, or -1 if it could not be started
+		static int StartConnect(const ProbeTarget &target);
+
+		std::mutex _health_map_lock;
+		// scheme://host:port, Health
+		std::unordered_map<ov::String, Health> _health_map;
+	};
+}  // namespace pvd
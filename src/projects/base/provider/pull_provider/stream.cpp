@@ -11,6 +11,7 @@
 
 #include "application.h"
 #include "base/info/application.h"
+#include "origin_health.h"
 #include "provider_private.h"
 #include "stream_props.h"
 
@@ -44,10 +45,18 @@ namespace pvd
 	{
 		std::lock_guard<std::mutex> lock(_start_stop_stream_lock);
 		_restart_count = 0;
+
+		ProbeOrigins();
+
 		while (true)
 		{
-			if (StartStream(GetNextURL()) == false)
+			StartFirstFrameMeasurement();
+
+			auto url = GetNextURL();
+			if (StartStream(url) == false)
 			{
+				OriginHealth::GetInstance()->RecordFailure(url);
+
 				_restart_count++;
 				if (_restart_count > (_url_list.size() * _properties->GetRetryConnectCount()))
 				{
@@ -57,6 +66,8 @@ namespace pvd
 			}
 			else
 			{
+				OriginHealth::GetInstance()->RecordSuccess(url);
+
 				_restart_count = 0;
 				break;
 			}
@@ -75,8 +86,13 @@ namespace pvd
 
 	bool PullStream::Resume()
 	{
-		if (RestartStream(GetNextURL()) == false)
+		StartFirstFrameMeasurement();
+
+		auto url = GetNextURL();
+		if (RestartStream(url) == false)
 		{
+			OriginHealth::GetInstance()->RecordFailure(url);
+
 			Stop();
 			_restart_count++;
 			if (_restart_count > _url_list.size() * _properties->GetRetryConnectCount())
@@ -87,10 +103,85 @@ namespace pvd
 			return false;
 		}
 
+		OriginHealth::GetInstance()->RecordSuccess(url);
+
 		_restart_count = 0;
 		return Stream::Start();
 	}
 
+	void PullStream::ProbeOrigins()
+	{
+		if (_url_list.size() < 2)
+		{
+			return;
+		}
+
+		std::vector<OriginHealth::ProbeTarget> targets;
+		// Index of the URL of each target
+		std::vector<int> url_indices;
+
+		for (size_t index = 0; index < _url_list.size(); index++)
+		{
+			auto &url = _url_list[index];
+
+			auto port = GetProbePort(url);
+			if (port == 0)
+			{
+				return;
+			}
+
+			if (OriginHealth::GetInstance()->IsAvailable(url))
+			{
+				targets.push_back({url, port});
+				url_indices.push_back(static_cast<int>(index));
+			}
+		}
+
+		if (targets.empty())
+		{
+			// All origins are in their backoff, so they are tried in order
+			return;
+		}
+
+		auto winner = OriginHealth::GetInstance()->Probe(targets);
+		if (winner < 0)
+		{
+			logtw("%s/%s(%u) None of the origins has accepted the connection", GetApplicationInfo().GetName().CStr(), GetName().CStr(), GetId());
+			return;
+		}
+
+		if (url_indices[winner] != 0)
+		{
+			logti("%s/%s(%u) %s is used because it has accepted the connection first", GetApplicationInfo().GetName().CStr(), GetName().CStr(), GetId(), targets[winner].url->ToUrlString(false).CStr());
+		}
+
+		_curr_url_index = url_indices[winner];
+	}
+
+	void PullStream::StartFirstFrameMeasurement()
+	{
+		_first_frame_stop_watch.Start();
+		_waiting_for_first_frame = true;
+	}
+
+	bool PullStream::SendFrame(const std::shared_ptr<MediaPacket> &packet)
+	{
+		if (_waiting_for_first_frame.exchange(false) == true)
+		{
+			auto elapsed_msec = _first_frame_stop_watch.Elapsed();
+
+			auto stream_metrics = StreamMetrics(*std::static_pointer_cast<info::Stream>(GetSharedPtr()));
+			if (stream_metrics != nullptr)
+			{
+				stream_metrics->SetOriginFirstFrameTimeMSec(elapsed_msec);
+			}
+
+			logti("%s/%s(%u) has received the first frame %lld ms after connecting to %s", GetApplicationInfo().GetName().CStr(), GetName().CStr(), GetId(), elapsed_msec, GetMediaSource().CStr());
+		}
+
+		return Stream::SendFrame(packet);
+	}
+
 	const std::shared_ptr<const ov::Url> PullStream::GetNextURL()
 	{
 		if (_url_list.size() == 0)
@@ -103,6 +194,17 @@ namespace pvd
 			_curr_url_index = 0;
 		}
 
+		// The origins in their backoff are skipped, unless all of them are
+		for (size_t count = 0; count < _url_list.size(); count++)
+		{
+			auto index = (_curr_url_index + count) % _url_list.size();
+			if (OriginHealth::GetInstance()->IsAvailable(_url_list[index]))
+			{
+				_curr_url_index = static_cast<int>(index);
+				break;
+			}
+		}
+
 		auto curr_url = _url_list[_curr_url_index];
 		SetMediaSource(curr_url->ToUrlString(true));
 
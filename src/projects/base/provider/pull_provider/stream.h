@@ -58,7 +58,23 @@ namespace pvd
 		virtual bool RestartStream(const std::shared_ptr<const ov::Url> &url) = 0; // Failover
 		virtual bool StopStream() = 0; // Stop
 
+		// TCP port of <url> to be probed before connecting, or 0 if the origins of this stream are not probed (e.g. UDP)
+		virtual uint16_t GetProbePort(const std::shared_ptr<const ov::Url> &url)
+		{
+			return 0;
+		}
+
+		// Measures the time from connecting to the origin until the first frame is received
+		bool SendFrame(const std::shared_ptr<MediaPacket> &packet) override;
+
 	private:
+		void StartFirstFrameMeasurement();
+		// Probes the origins in parallel and moves the URL index to the first one reachable
+		void ProbeOrigins();
+
+		ov::StopWatch _first_frame_stop_watch;
+		std::atomic<bool> _waiting_for_first_frame = false;
+
 		uint32_t	_restart_count = 0;
 		std::vector<std::shared_ptr<const ov::Url>> _url_list;
 		int _curr_url_index = 0;
@@ -67,6 +67,18 @@ namespace pvd
 			_from_origin_map_store = from_origin_map_store;
 		}
 
+		// The stream is pulled before its first viewer because it is popular in the cluster.
+		// It is not deleted for being unused while it is prefetched (changed by the orchestrator while the stream is running)
+		bool IsPrefetched()
+		{
+			return _prefetched;
+		}
+
+		void EnablePrefetched(bool prefetched)
+		{
+			_prefetched = prefetched;
+		}
+
 		int32_t GetFailbackTimeout()
 		{
 			return _failback_timeout;
@@ -128,6 +140,7 @@ namespace pvd
 		bool _failback = false;
 		bool _relay = false;
 		bool _from_origin_map_store = false;
+		std::atomic<bool> _prefetched{false};
 
 		// -1 means that the values in configuration file will be used. (Conf/Origins/Properties)
 		int32_t _failback_timeout = -1;
@@ -9,6 +9,8 @@
 
 #include "stream.h"
 
+#include <config/config.h>
+
 #include "application.h"
 #include "base/info/application.h"
 #include "provider_private.h"
@@ -74,6 +76,21 @@ namespace pvd
 		return true;
 	}
 
+	void Stream::CreateIngestCapture(mdl::IngestCapture::Format format)
+	{
+		auto &capture_config = cfg::ConfigManager::GetInstance()->GetServer()->GetModules().GetIngestCapture();
+
+		if (capture_config.IsEnabled() == false)
+		{
+			return;
+		}
+
+		_ingest_capture = std::make_shared<mdl::IngestCapture>(
+			format,
+			std::max(capture_config.GetDuration(), 1) * 1000LL,
+			static_cast<size_t>(std::max<int64_t>(capture_config.GetMaxBytes(), 0)));
+	}
+
 	// Consider the reconnection time and add it to the base timestamp
 	void Stream::UpdateReconnectTimeToBasetime()
 	{
@@ -171,6 +188,11 @@ namespace pvd
 
 		_last_pkt_received_time = std::chrono::system_clock::now();
 
+		if (packet->GetTrace() == nullptr)
+		{
+			packet->SetTrace(MediaPacketTrace::Sample());
+		}
+
 		return _application->SendFrame(GetSharedPtr(), packet);
 	}
 
@@ -13,6 +13,7 @@
 #include "monitoring/monitoring.h"
 
 #include <base/mediarouter/media_buffer.h>
+#include <modules/dump/ingest_capture.h>
 
 namespace pvd
 {
@@ -63,6 +64,12 @@ namespace pvd
 		std::shared_ptr<ov::Url> GetFinalUrl() const;
 		void SetFinalUrl(const std::shared_ptr<ov::Url> &final_url);
 
+		// Returns nullptr if the provider doesn't capture the ingest, or <Modules><IngestCapture> is disabled
+		const std::shared_ptr<mdl::IngestCapture> &GetIngestCapture() const
+		{
+			return _ingest_capture;
+		}
+
 	protected:
 		Stream(const std::shared_ptr<pvd::Application> &application, StreamSourceType source_type);
 		Stream(const std::shared_ptr<pvd::Application> &application, info::stream_id_t stream_id, StreamSourceType source_type);
@@ -72,7 +79,7 @@ namespace pvd
 		virtual ~Stream();
 
 		bool SetState(State state);
-		bool SendFrame(const std::shared_ptr<MediaPacket> &packet);
+		virtual bool SendFrame(const std::shared_ptr<MediaPacket> &packet);
 
 		void ResetSourceStreamTimestamp();
 		int64_t AdjustTimestampByBase(uint32_t track_id, int64_t pts,  int64_t dts, int64_t max_timestamp);
@@ -81,6 +88,9 @@ namespace pvd
 		int64_t GetBaseTimestamp(uint32_t track_id);
 		std::shared_ptr<pvd::Application> _application = nullptr;
 		void UpdateReconnectTimeToBasetime();
+
+		// Must be called in the constructor of the stream (before the stream is exposed to other threads)
+		void CreateIngestCapture(mdl::IngestCapture::Format format);
 	
 	private:
 		// TrackID : Timestamp(us)
@@ -95,5 +105,7 @@ namespace pvd
 
 		std::shared_ptr<ov::Url> _requested_url = nullptr;
 		std::shared_ptr<ov::Url> _final_url = nullptr;
+
+		std::shared_ptr<mdl::IngestCapture> _ingest_capture;
 	};
 }
\ No newline at end of file
@@ -7,13 +7,21 @@
 
 namespace pub
 {
-	ApplicationWorker::ApplicationWorker(uint32_t worker_id, ov::String vhost_app_name, ov::String worker_name)
-		: _stream_data_queue(nullptr, 500)
+	// From 128us to 16s
+	static ov::Histogram ingest_to_egress_histogram(
+		"ome_rtmp_ingest_to_egress_seconds",
+		"Time from an RTMP packet is received until a publisher has passed it to the sessions (bypassed tracks only)",
+		0.000001, 128, 16 * 1000 * 1000);
+
+	ApplicationWorker::ApplicationWorker(uint32_t worker_id, ov::String vhost_app_name, ov::String worker_name, int64_t max_lag_ms)
+		: _stream_data_queue(nullptr, 500),
+		  _data_lane_queue(nullptr, 100)
 	{
 		_worker_id = worker_id;
 		_vhost_app_name = vhost_app_name;
 		_worker_name = worker_name;
 		_stop_thread_flag = false;
+		_max_lag_ms = std::max<int64_t>(max_lag_ms, 0);
 	}
 
 	bool ApplicationWorker::Start()
@@ -22,10 +30,30 @@ namespace pub
 		_worker_thread = std::thread(&ApplicationWorker::WorkerThread, this);
 		pthread_setname_np(_worker_thread.native_handle(), ov::String::FormatString("AW-%s%d", _worker_name.CStr(), _worker_id).CStr());
 
+		// Same index as the mediarouter worker that feeds this worker, so they share the home core (or the NUMA node)
+		auto &modules_config = cfg::ConfigManager::GetInstance()->GetServer()->GetModules();
+		if (modules_config.GetStreamAffinity().IsEnabled())
+		{
+			if (ov::Platform::SetThreadAffinity(_worker_thread, _worker_id) == false)
+			{
+				logtw("Could not set the CPU affinity of %s ApplicationWorker #%u", _worker_name.CStr(), _worker_id);
+			}
+		}
+		else if (modules_config.GetNumaAffinity().IsEnabled())
+		{
+			if (ov::Platform::SetThreadNumaNode(_worker_thread, _worker_id) == false)
+			{
+				logtw("Could not set the NUMA node of %s ApplicationWorker #%u", _worker_name.CStr(), _worker_id);
+			}
+		}
+
 		ov::String urn;
 		urn = info::ManagedQueue::URN(_vhost_app_name.CStr(), nullptr, "pub", ov::String::FormatString("appworker_%s_%d", _worker_name.LowerCaseString().CStr(), _worker_id).CStr());
 		_stream_data_queue.SetUrn(urn.CStr());
 
+		urn = info::ManagedQueue::URN(_vhost_app_name.CStr(), nullptr, "pub", ov::String::FormatString("appworker_%s_%d_datalane", _worker_name.LowerCaseString().CStr(), _worker_id).CStr());
+		_data_lane_queue.SetUrn(urn.CStr());
+
 		logtd("%s ApplicationWorker has been created", _worker_name.CStr());
 
 		return true;
@@ -39,6 +67,7 @@ namespace pub
 		}
 
 		_stream_data_queue.Clear();
+		_data_lane_queue.Clear();
 
 		_stop_thread_flag = true;
 
@@ -55,7 +84,15 @@ namespace pub
 	bool ApplicationWorker::PushMediaPacket(const std::shared_ptr<Stream> &stream, const std::shared_ptr<MediaPacket> &media_packet)
 	{
 		auto data = std::make_shared<ApplicationWorker::StreamData>(stream, media_packet);
-		_stream_data_queue.Enqueue(std::move(data));
+
+		if (media_packet->GetMediaType() == cmn::MediaType::Data)
+		{
+			_data_lane_queue.Enqueue(std::move(data));
+		}
+		else
+		{
+			_stream_data_queue.Enqueue(std::move(data));
+		}
 
 		_queue_event.Notify();
 
@@ -64,6 +101,15 @@ namespace pub
 
 	std::shared_ptr<ApplicationWorker::StreamData> ApplicationWorker::PopStreamData()
 	{
+		if (_data_lane_queue.IsEmpty() == false)
+		{
+			auto data = _data_lane_queue.Dequeue(0);
+			if (data.has_value())
+			{
+				return data.value();
+			}
+		}
+
 		if (_stream_data_queue.IsEmpty())
 		{
 			return nullptr;
@@ -78,16 +124,90 @@ namespace pub
 		return nullptr;
 	}
 
+	bool ApplicationWorker::DropIfLagging(const std::shared_ptr<StreamData> &stream_data)
+	{
+		if (_max_lag_ms == 0)
+		{
+			return false;
+		}
+
+		auto &stream = stream_data->_stream;
+		auto &media_packet = stream_data->_media_packet;
+
+		// Data packets are small and rare, and the players need all of them
+		if (media_packet->GetMediaType() == cmn::MediaType::Data)
+		{
+			return false;
+		}
+
+		auto lag_ms = static_cast<int64_t>(ov::Clock::NowMSec()) - stream_data->_enqueued_time_ms;
+		auto skipping_item = _skipping_streams.find(stream->GetId());
+
+		if (skipping_item == _skipping_streams.end())
+		{
+			if (lag_ms <= _max_lag_ms)
+			{
+				return false;
+			}
+
+			logtw("%s ApplicationWorker #%u is %" PRId64 "ms behind, skipping to the next key frame: %s/%s",
+				  _worker_name.CStr(), _worker_id, lag_ms, _vhost_app_name.CStr(), stream->GetName().CStr());
+
+			skipping_item = _skipping_streams.emplace(stream->GetId(), 0).first;
+		}
+		else if (lag_ms <= _max_lag_ms)
+		{
+			// The stream resumes at a video key frame, or at any packet if there is no video track
+			bool resumable = (media_packet->GetMediaType() == cmn::MediaType::Video)
+								 ? (media_packet->GetFlag() == MediaPacketFlag::Key)
+								 : (stream->GetFirstTrackByType(cmn::MediaType::Video) == nullptr);
+
+			if (resumable)
+			{
+				logti("%s ApplicationWorker #%u has caught up, %" PRIu64 " packets were dropped: %s/%s",
+					  _worker_name.CStr(), _worker_id, skipping_item->second, _vhost_app_name.CStr(), stream->GetName().CStr());
+
+				_skipping_streams.erase(skipping_item);
+				return false;
+			}
+		}
+
+		skipping_item->second++;
+		_stream_data_queue.IncreaseDropCount();
+
+		return true;
+	}
+
 	void ApplicationWorker::WorkerThread()
 	{
+		ov::ThreadRegistry::Registration registration(ov::String::FormatString("ApplicationWorker(%s)", _worker_name.CStr()), _vhost_app_name);
+
 		while (!_stop_thread_flag)
 		{
-			_queue_event.Wait();
-
 			// Check media data is available
 			auto stream_data = PopStreamData();
-			if ((stream_data != nullptr) && (stream_data->_stream != nullptr) && (stream_data->_media_packet != nullptr))
+			if (stream_data == nullptr)
 			{
+				// Sleeps only when the queues are empty
+				_queue_event.Wait();
+				continue;
+			}
+
+			if ((stream_data->_stream != nullptr) && (stream_data->_media_packet != nullptr))
+			{
+				if (DropIfLagging(stream_data))
+				{
+					continue;
+				}
+
+				// The packet is shared by the publishers, so each publisher has its own trace
+				std::shared_ptr<MediaPacketTrace> trace;
+				if (stream_data->_media_packet->GetTrace() != nullptr)
+				{
+					trace = stream_data->_media_packet->GetTrace()->Clone();
+					trace->Mark(PacketTraceStage::PublisherDequeued);
+				}
+
 				if (stream_data->_media_packet->GetMediaType() == cmn::MediaType::Video)
 				{
 					stream_data->_stream->SendVideoFrame(stream_data->_media_packet);
@@ -104,6 +224,23 @@ namespace pub
 				{
 					// Nothing can do
 				}
+
+				auto ingest_time = stream_data->_media_packet->GetIngestTime();
+				if (ingest_time > 0)
+				{
+					ingest_to_egress_histogram.Record(ov::Clock::NowUSec() - ingest_time);
+				}
+
+				if (trace != nullptr)
+				{
+					trace->Mark(PacketTraceStage::PublisherSent);
+
+					auto stream_metrics = StreamMetrics(*stream_data->_stream);
+					if (stream_metrics != nullptr)
+					{
+						stream_metrics->GetLatencyMetrics()->Record(*trace);
+					}
+				}
 			}
 		}
 	}
@@ -160,7 +297,7 @@ namespace pub
 
 		for (uint32_t i = 0; i < _application_worker_count; i++)
 		{
-			auto app_worker = std::make_shared<ApplicationWorker>(i, GetName().CStr(), StringFromPublisherType(_publisher->GetPublisherType()));
+			auto app_worker = std::make_shared<ApplicationWorker>(i, GetName().CStr(), StringFromPublisherType(_publisher->GetPublisherType()), GetConfig().GetPublishers().GetMaxWorkerLag());
 			if (app_worker->Start() == false)
 			{
 				logte("Cannot create ApplicationWorker (%s/%s/%d)", GetApplicationTypeName(), GetName().CStr(), i);
@@ -244,6 +381,8 @@ namespace pub
 
 		lock.unlock();
 
+		_publisher->RemoveResolvedStream(GetName(), stream->GetName());
+
 		if (DeleteStream(info) == false)
 		{
 			return false;
@@ -304,6 +443,16 @@ namespace pub
 		return stream->OnStreamUpdated(info);
 	}
 
+	size_t Application::GetHomeCore(info::stream_id_t stream_id) const
+	{
+		if (_application_worker_count == 0)
+		{
+			return 0;
+		}
+
+		return (stream_id % _application_worker_count) % ov::Platform::GetCpuCount();
+	}
+
 	std::shared_ptr<ApplicationWorker> Application::GetWorkerByStreamID(info::stream_id_t stream_id)
 	{
 		if (_application_worker_count == 0)
@@ -359,6 +508,16 @@ namespace pub
 		return nullptr;
 	}
 
+	std::vector<std::shared_ptr<MediaPacket>> Application::GetGopCache(uint32_t stream_id)
+	{
+		return _publisher->GetGopCache(*this, stream_id);
+	}
+
+	bool Application::RequestKeyFrame(uint32_t stream_id, MediaTrackId track_id)
+	{
+		return _publisher->RequestKeyFrame(*this, stream_id, track_id);
+	}
+
 	PushApplication::PushApplication(const std::shared_ptr<Publisher> &publisher, const info::Application &application_info) :
 		Application(publisher, application_info)
 	{
@@ -2,6 +2,7 @@
 
 #include <utility>
 #include <shared_mutex>
+#include <unordered_map>
 #include "base/common_types.h"
 #include "base/info/stream.h"
 #include "base/info/session.h"
@@ -32,7 +33,7 @@ namespace pub
 	class ApplicationWorker
 	{
 	public:
-		ApplicationWorker(uint32_t worker_id, ov::String vhost_app_name, ov::String worker_name);
+		ApplicationWorker(uint32_t worker_id, ov::String vhost_app_name, ov::String worker_name, int64_t max_lag_ms);
 		bool Start();
 		bool Stop();
 		bool PushMediaPacket(const std::shared_ptr<Stream> &stream, const std::shared_ptr<MediaPacket> &media_packet);
@@ -52,18 +53,29 @@ namespace pub
 			{
 				_stream = stream;
 				_media_packet = media_packet;
+				_enqueued_time_ms = ov::Clock::NowMSec();
 			}
 
 			std::shared_ptr<Stream> _stream;
 			std::shared_ptr<MediaPacket> _media_packet;
+			int64_t _enqueued_time_ms;
 		};
 		std::shared_ptr<ApplicationWorker::StreamData> PopStreamData();
+		// Returns true if the packet is dropped because this worker is lagging behind
+		bool DropIfLagging(const std::shared_ptr<StreamData> &stream_data);
 
 		bool _stop_thread_flag;
 		std::thread _worker_thread;
-		ov::Semaphore _queue_event;
+		ov::WakeupEvent _queue_event;
 
 		ov::ManagedQueue<std::shared_ptr<StreamData>> _stream_data_queue;
+		// Data packets (timed metadata) are popped ahead of the media packets, and are never dropped by DropIfLagging()
+		ov::ManagedQueue<std::shared_ptr<StreamData>> _data_lane_queue;
+
+		// 0: disabled
+		int64_t _max_lag_ms = 0;
+		// Stream.id, the number of packets dropped since the stream started skipping to the next key frame
+		std::unordered_map<info::stream_id_t, uint64_t> _skipping_streams;
 
 		int64_t	_last_video_ts_ms = 0;
 		int64_t	_last_audio_ts_ms = 0;
@@ -89,6 +101,13 @@ namespace pub
 		std::shared_ptr<Stream> GetStream(uint32_t stream_id);
 		std::shared_ptr<Stream> GetStream(ov::String stream_name);
 
+		std::vector<std::shared_ptr<MediaPacket>> GetGopCache(uint32_t stream_id);
+		bool RequestKeyFrame(uint32_t stream_id, MediaTrackId track_id);
+
+		// Index of the CPU the ApplicationWorker of the stream is pinned to when StreamAffinity is enabled
+		// (the CPU is on the NUMA node (index % number of nodes), See ov::Platform::SetThreadAffinity())
+		size_t GetHomeCore(info::stream_id_t stream_id) const;
+
 		virtual bool Start();
 		virtual bool Stop();
 
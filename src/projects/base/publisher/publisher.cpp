@@ -39,6 +39,8 @@ namespace pub
 			it = _applications.erase(it);
 		}
 
+		_stream_resolution_cache.Clear();
+
 		logti("%s has been stopped.", GetPublisherName());
 		SetModuleAvailable(false);
 		return true;
@@ -140,6 +142,8 @@ namespace pub
 
 		lock.unlock();
 
+		_stream_resolution_cache.RemoveApplication(app_info.GetName());
+
 		_router->UnregisterObserverApp(*application.get(), application);
 		
 		bool result = OnDeletePublisherApplication(application);
@@ -247,6 +251,31 @@ namespace pub
 		return nullptr;
 	}
 
+	std::shared_ptr<Stream> Publisher::GetResolvedStream(const std::shared_ptr<const ov::Url> &request_url, info::VHostAppName *vhost_app_name) const
+	{
+		return _stream_resolution_cache.Find(request_url, ocst::Orchestrator::GetInstance()->GetDomainRoutingVersion(), vhost_app_name);
+	}
+
+	void Publisher::CacheResolvedStream(const std::shared_ptr<const ov::Url> &request_url, uint64_t routing_version, const info::VHostAppName &vhost_app_name, const std::shared_ptr<Stream> &stream)
+	{
+		_stream_resolution_cache.Insert(request_url, routing_version, vhost_app_name, stream);
+	}
+
+	void Publisher::RemoveResolvedStream(const info::VHostAppName &vhost_app_name, const ov::String &stream_name)
+	{
+		_stream_resolution_cache.RemoveStream(vhost_app_name, stream_name);
+	}
+
+	std::vector<std::shared_ptr<MediaPacket>> Publisher::GetGopCache(const info::Application &application_info, info::stream_id_t stream_id)
+	{
+		return _router->GetGopCache(application_info, stream_id);
+	}
+
+	bool Publisher::RequestKeyFrame(const info::Application &application_info, info::stream_id_t stream_id, MediaTrackId track_id)
+	{
+		return _router->RequestKeyFrame(application_info, stream_id, track_id);
+	}
+
 	bool Publisher::IsAccessControlEnabled(const std::shared_ptr<const ov::Url> &request_url)
 	{
 		auto orchestrator = ocst::Orchestrator::GetInstance();
@@ -14,6 +14,7 @@
 #include <base/ovcrypto/ovcrypto.h>
 #include <base/publisher/application.h>
 #include <base/publisher/stream.h>
+#include <base/publisher/stream_resolution_cache.h>
 
 #include <modules/ice/ice_port_manager.h>
 #include <modules/physical_port/physical_port.h>
@@ -118,6 +119,19 @@ namespace pub
 			return std::static_pointer_cast<T>(GetStream(application_id, stream_id));
 		}
 
+		// Returns the stream resolved from <host>/<app>/<stream> of <request_url> by a previous request (nullptr if not cached),
+		// without the Orchestrator, the application map and the stream map
+		std::shared_ptr<Stream> GetResolvedStream(const std::shared_ptr<const ov::Url> &request_url, info::VHostAppName *vhost_app_name) const;
+		// <routing_version> must be obtained before resolving <vhost_app_name> (see Orchestrator::GetDomainRoutingVersion())
+		void CacheResolvedStream(const std::shared_ptr<const ov::Url> &request_url, uint64_t routing_version, const info::VHostAppName &vhost_app_name, const std::shared_ptr<Stream> &stream);
+		// Called by Application when the stream is deleted
+		void RemoveResolvedStream(const info::VHostAppName &vhost_app_name, const ov::String &stream_name);
+
+		// Packets of the last GOP cached by MediaRouter (empty if the GopCache module is disabled)
+		std::vector<std::shared_ptr<MediaPacket>> GetGopCache(const info::Application &application_info, info::stream_id_t stream_id);
+		// Asks the transcoder for a keyframe of the track (false if the track is not encoded)
+		bool RequestKeyFrame(const info::Application &application_info, info::stream_id_t stream_id, MediaTrackId track_id);
+
 		//--------------------------------------------------------------------
 		// Implementation of ModuleInterface
 		//--------------------------------------------------------------------
@@ -156,5 +170,7 @@ namespace pub
 
 	private:
 		std::shared_ptr<AccessController> _access_controller = nullptr;
+
+		StreamResolutionCache _stream_resolution_cache;
 	};
 }  // namespace pub
@@ -0,0 +1,195 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "session_scheduler.h"
+
+#include "publisher_private.h"
+
+// Idle threads wake up periodically to check for stealable tasks
+#define SESSION_SCHEDULER_IDLE_TIMEOUT_IN_MSEC 100
+
+namespace pub
+{
+	SessionScheduler::~SessionScheduler()
+	{
+		Stop();
+	}
+
+	bool SessionScheduler::Start(size_t thread_count, bool pin_threads, bool pin_to_numa_node)
+	{
+		std::lock_guard lock_guard(_mutex);
+
+		if (_is_running)
+		{
+			logte("Session scheduler is already running");
+			return false;
+		}
+
+		if (thread_count == 0)
+		{
+			thread_count = ov::Platform::GetCpuCount();
+		}
+
+		_worker_list.clear();
+
+		for (size_t index = 0; index < thread_count; index++)
+		{
+			_worker_list.push_back(std::make_shared<Worker>());
+		}
+
+		_is_running = true;
+
+		for (size_t index = 0; index < thread_count; index++)
+		{
+			auto &worker = _worker_list[index];
+
+			worker->thread = std::thread(&SessionScheduler::WorkerThread, this, index);
+
+			auto name = ov::String::FormatString("SessSched%zu", index);
+			::pthread_setname_np(worker->thread.native_handle(), name.CStr());
+
+			if (pin_threads)
+			{
+				if (ov::Platform::SetThreadAffinity(worker->thread, index) == false)
+				{
+					logtw("Could not set the CPU affinity of %s", name.CStr());
+				}
+			}
+			else if (pin_to_numa_node && (ov::Platform::SetThreadNumaNode(worker->thread, index) == false))
+			{
+				logtw("Could not set the NUMA node of %s", name.CStr());
+			}
+		}
+
+		logti("Session scheduler is started with %zu threads", thread_count);
+
+		return true;
+	}
+
+	bool SessionScheduler::Stop()
+	{
+		std::lock_guard lock_guard(_mutex);
+
+		if (_is_running.exchange(false) == false)
+		{
+			return true;
+		}
+
+		{
+			std::lock_guard idle_lock_guard(_idle_mutex);
+			_idle_condition.notify_all();
+		}
+
+		for (auto &worker : _worker_list)
+		{
+			if (worker->thread.joinable())
+			{
+				worker->thread.join();
+			}
+
+			std::lock_guard worker_lock_guard(worker->mutex);
+			worker->task_queue.clear();
+		}
+
+		_queued_count = 0;
+
+		return true;
+	}
+
+	size_t SessionScheduler::GetNextAffinityHint()
+	{
+		return _next_affinity_hint++;
+	}
+
+	void SessionScheduler::Schedule(const std::shared_ptr<Task> &task, size_t affinity_hint)
+	{
+		if ((_is_running == false) || (task == nullptr))
+		{
+			return;
+		}
+
+		auto &worker = _worker_list[affinity_hint % _worker_list.size()];
+
+		{
+			std::lock_guard lock_guard(worker->mutex);
+			worker->task_queue.push_back(task);
+		}
+
+		_queued_count++;
+
+		// Either this thread sees the idle thread, or the idle thread sees _queued_count
+		if (_idle_count > 0)
+		{
+			std::lock_guard lock_guard(_idle_mutex);
+			_idle_condition.notify_one();
+		}
+	}
+
+	std::shared_ptr<SessionScheduler::Task> SessionScheduler::PopTask(size_t index)
+	{
+		{
+			auto &worker = _worker_list[index];
+			std::lock_guard lock_guard(worker->mutex);
+
+			if (worker->task_queue.empty() == false)
+			{
+				auto task = std::move(worker->task_queue.front());
+				worker->task_queue.pop_front();
+				return task;
+			}
+		}
+
+		// Steal a task from the other threads
+		auto worker_count = _worker_list.size();
+
+		for (size_t offset = 1; offset < worker_count; offset++)
+		{
+			auto &victim = _worker_list[(index + offset) % worker_count];
+			std::lock_guard lock_guard(victim->mutex);
+
+			if (victim->task_queue.empty() == false)
+			{
+				auto task = std::move(victim->task_queue.back());
+				victim->task_queue.pop_back();
+				return task;
+			}
+		}
+
+		return nullptr;
+	}
+
+	void SessionScheduler::WorkerThread(size_t index)
+	{
+		ov::ThreadRegistry::Registration registration("SessionScheduler");
+
+		while (_is_running)
+		{
+			auto task = PopTask(index);
+
+			if (task == nullptr)
+			{
+				std::unique_lock lock(_idle_mutex);
+
+				_idle_count++;
+				_idle_condition.wait_for(lock, std::chrono::milliseconds(SESSION_SCHEDULER_IDLE_TIMEOUT_IN_MSEC), [this]() -> bool {
+					return (_queued_count > 0) || (_is_running == false);
+				});
+				_idle_count--;
+
+				continue;
+			}
+
+			_queued_count--;
+
+			if (task->RunTask())
+			{
+				// Keep the task on this thread if nobody steals it
+				Schedule(task, index);
+			}
+		}
+	}
+}  // namespace pub
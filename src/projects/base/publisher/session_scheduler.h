@@ -0,0 +1,88 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/ovlibrary/ovlibrary.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+namespace pub
+{
+	// A process-wide work-stealing executor shared by the stream workers of all publishers
+	//
+	// A task is queued to the thread of its affinity hint, and a thread that has no task steals
+	// the most recently queued task of another thread. A task is never run by two threads at the
+	// same time (the task schedules itself only once until it is run).
+	class SessionScheduler
+	{
+	public:
+		class Task
+		{
+		public:
+			virtual ~Task() = default;
+
+			// Returns true if the task has more work and must be scheduled again
+			virtual bool RunTask() = 0;
+		};
+
+		static SessionScheduler *GetInstance()
+		{
+			static SessionScheduler instance;
+			return &instance;
+		}
+
+		// If <thread_count> is 0, the number of CPU cores is used
+		// If <pin_threads> is true, the Nth thread is pinned to the Nth CPU (used by StreamAffinity)
+		// If <pin_to_numa_node> is true, the Nth thread is pinned to the CPUs of the NUMA node (N % number of nodes) (used by NumaAffinity)
+		bool Start(size_t thread_count, bool pin_threads = false, bool pin_to_numa_node = false);
+		bool Stop();
+
+		bool IsRunning() const
+		{
+			return _is_running;
+		}
+
+		// Returns the affinity hint for a new task (round robin)
+		size_t GetNextAffinityHint();
+
+		void Schedule(const std::shared_ptr<Task> &task, size_t affinity_hint);
+
+	protected:
+		struct Worker
+		{
+			std::mutex mutex;
+			std::deque<std::shared_ptr<Task>> task_queue;
+
+			std::thread thread;
+		};
+
+		SessionScheduler() = default;
+		~SessionScheduler();
+
+		void WorkerThread(size_t index);
+		std::shared_ptr<Task> PopTask(size_t index);
+
+		std::atomic<bool> _is_running{false};
+
+		std::mutex _mutex;
+		// Not changed while the scheduler is running
+		std::vector<std::shared_ptr<Worker>> _worker_list;
+		std::atomic<size_t> _next_affinity_hint{0};
+
+		// Number of tasks queued in all workers
+		std::atomic<size_t> _queued_count{0};
+
+		std::mutex _idle_mutex;
+		std::condition_variable _idle_condition;
+		std::atomic<size_t> _idle_count{0};
+	};
+}  // namespace pub
@@ -4,8 +4,9 @@
 
 namespace pub
 {
-	StreamWorker::StreamWorker(const std::shared_ptr<Stream> &parent_stream)
-		: _packet_queue(nullptr, 500)
+	StreamWorker::StreamWorker(const std::shared_ptr<Stream> &parent_stream, const std::shared_ptr<StreamPacketQueueBase> &typed_packet_queue)
+		: _packet_queue(nullptr, 500),
+		  _typed_packet_queue(typed_packet_queue)
 	{
 		_stop_thread_flag = true;
 		_parent = parent_stream;
@@ -26,11 +27,43 @@ namespace pub
 		ov::String urn;
 		urn = info::ManagedQueue::URN(_parent->GetApplicationName(), _parent->GetName().CStr(), "pub", ov::String::FormatString("streamworker_%s", _parent->GetApplication()->GetPublisherTypeName()).LowerCaseString().CStr());
 		_packet_queue.SetUrn(urn.CStr());
-		
+		if (_typed_packet_queue != nullptr)
+		{
+			_typed_packet_queue->SetUrn(urn.CStr());
+		}
+
 		_stop_thread_flag = false;
+
+		auto scheduler = SessionScheduler::GetInstance();
+		if (scheduler->IsRunning())
+		{
+			_use_scheduler = true;
+
+			if (cfg::ConfigManager::GetInstance()->GetServer()->GetModules().GetStreamAffinity().IsEnabled())
+			{
+				// Run on the scheduler thread pinned to the home core of the stream
+				_affinity_hint = _parent->GetApplication()->GetHomeCore(_parent->GetId());
+			}
+			else
+			{
+				_affinity_hint = scheduler->GetNextAffinityHint();
+			}
+
+			return true;
+		}
+
 		_worker_thread = std::thread(&StreamWorker::WorkerThread, this);
 		pthread_setname_np(_worker_thread.native_handle(), "StreamWorker");
 
+		if (cfg::ConfigManager::GetInstance()->GetServer()->GetModules().GetNumaAffinity().IsEnabled())
+		{
+			// The NUMA node of the home core of the stream
+			if (ov::Platform::SetThreadNumaNode(_worker_thread, _parent->GetApplication()->GetHomeCore(_parent->GetId())) == false)
+			{
+				logtw("Could not set the NUMA node of StreamWorker");
+			}
+		}
+
 		return true;
 	}
 
@@ -44,6 +77,10 @@ namespace pub
 		_stop_thread_flag = true;
 		// Generate Event
 		_packet_queue.Stop();
+		if (_typed_packet_queue != nullptr)
+		{
+			_typed_packet_queue->Stop();
+		}
 		_session_message_queue.Stop();
 		
 		_queue_event.Notify();
@@ -52,7 +89,11 @@ namespace pub
 			_worker_thread.join();
 		}
 
-		std::lock_guard<std::shared_mutex> lock(_session_map_mutex);
+		// Wait for RunTask() running on SessionScheduler
+		std::unique_lock<std::mutex> task_lock(_task_mutex);
+		task_lock.unlock();
+
+		std::lock_guard lock(_session_map_mutex);
 		for (auto const &x : _sessions)
 		{
 			auto session = std::static_pointer_cast<Session>(x.second);
@@ -60,6 +101,11 @@ namespace pub
 		}
 		_sessions.clear();
 
+		if (_typed_packet_queue != nullptr)
+		{
+			_typed_packet_queue->OnSessionsChanged(_sessions);
+		}
+
 		return true;
 	}
 
@@ -71,9 +117,14 @@ namespace pub
 			return true;
 		}
 
-		std::lock_guard<std::shared_mutex> lock(_session_map_mutex);
+		std::lock_guard lock(_session_map_mutex);
 		_sessions[session->GetId()] = session;
 
+		if (_typed_packet_queue != nullptr)
+		{
+			_typed_packet_queue->OnSessionsChanged(_sessions);
+		}
+
 		return true;
 	}
 
@@ -85,7 +136,7 @@ namespace pub
 			return true;
 		}
 
-		std::unique_lock<std::shared_mutex> lock(_session_map_mutex);
+		std::unique_lock lock(_session_map_mutex);
 		if (_sessions.count(id) <= 0)
 		{
 			logte("Cannot find session : %u", id);
@@ -94,6 +145,11 @@ namespace pub
 
 		auto session = _sessions[id];
 		_sessions.erase(id);
+
+		if (_typed_packet_queue != nullptr)
+		{
+			_typed_packet_queue->OnSessionsChanged(_sessions);
+		}
 		lock.unlock();
 
 		session->Stop();
@@ -103,7 +159,7 @@ namespace pub
 
 	std::shared_ptr<Session> StreamWorker::GetSession(session_id_t id)
 	{
-		std::shared_lock<std::shared_mutex> lock(_session_map_mutex);
+		std::shared_lock lock(_session_map_mutex);
 		if (_sessions.count(id) <= 0)
 		{
 			// logte("Cannot find session : %u", id);
@@ -116,14 +172,35 @@ namespace pub
 	void StreamWorker::SendPacket(const std::any &packet)
 	{
 		_packet_queue.Enqueue(packet);
-		_queue_event.Notify();
+		NotifyQueued();
 	}
 
 	// Send to a specific session
 	void StreamWorker::SendMessage(const std::shared_ptr<Session> &session, const std::any &message)
 	{
 		_session_message_queue.Enqueue(std::make_shared<SessionMessage>(session, message));
-		_queue_event.Notify();
+		NotifyQueued();
+	}
+
+	void StreamWorker::NotifyQueued()
+	{
+		if (_use_scheduler == false)
+		{
+			_queue_event.Notify();
+			return;
+		}
+
+		if ((_stop_thread_flag == false) && (_is_scheduled.exchange(true) == false))
+		{
+			SessionScheduler::GetInstance()->Schedule(GetSharedPtr(), _affinity_hint);
+		}
+	}
+
+	bool StreamWorker::HasQueuedItems()
+	{
+		return (_session_message_queue.IsEmpty() == false) ||
+			   (_packet_queue.IsEmpty() == false) ||
+			   ((_typed_packet_queue != nullptr) && (_typed_packet_queue->IsEmpty() == false));
 	}
 
 	std::optional<std::any> StreamWorker::PopStreamPacket()
@@ -152,32 +229,89 @@ namespace pub
 		return nullptr;
 	}
 
+	bool StreamWorker::ProcessQueuedItems(std::shared_lock<ov::ProfiledSharedMutex> &session_lock)
+	{
+		bool processed = false;
+
+		auto session_message = PopSessionMessage();
+		if (session_message != nullptr && session_message->_session != nullptr && session_message->_message.has_value())
+		{
+			session_message->_session->OnMessageReceived(session_message->_message);
+			processed = true;
+		}
+
+		if (_typed_packet_queue != nullptr)
+		{
+			if (_typed_packet_queue->IsEmpty() == false)
+			{
+				session_lock.lock();
+				_typed_packet_queue->DispatchPackets();
+				session_lock.unlock();
+
+				processed = true;
+			}
+
+			return processed;
+		}
+
+		auto packet = PopStreamPacket();
+		if (packet.has_value())
+		{
+			session_lock.lock();
+			// The session is used by reference, not to change the reference count of every session for every packet
+			for (auto const &x : _sessions)
+			{
+				x.second->SendOutgoingData(packet.value());
+			}
+			session_lock.unlock();
+
+			processed = true;
+		}
+
+		return processed;
+	}
+
 	void StreamWorker::WorkerThread()
 	{
-		std::shared_lock<std::shared_mutex> session_lock(_session_map_mutex, std::defer_lock);
+		ov::ThreadRegistry::Registration registration(ov::String::FormatString("StreamWorker(%s)", _parent->GetApplication()->GetPublisherTypeName()), _parent->GetApplicationName(), _parent->GetName());
+
+		std::shared_lock session_lock(_session_map_mutex, std::defer_lock);
 
 		while (!_stop_thread_flag)
 		{
-			_queue_event.Wait();
-
-			auto session_message = PopSessionMessage();
-			if (session_message != nullptr && session_message->_session != nullptr && session_message->_message.has_value())
+			// Drains the queues, and sleeps only when they are empty
+			if (ProcessQueuedItems(session_lock) == false)
 			{
-				session_message->_session->OnMessageReceived(session_message->_message);
+				_queue_event.Wait();
 			}
+		}
+	}
 
-			auto packet = PopStreamPacket();
-			if (packet.has_value())
-			{		
-				session_lock.lock();
-				for (auto const &x : _sessions)
-				{
-					auto session = x.second;
-					session->SendOutgoingData(packet.value());
-				}
-				session_lock.unlock();
+	bool StreamWorker::RunTask()
+	{
+		std::lock_guard<std::mutex> task_lock(_task_mutex);
+		std::shared_lock session_lock(_session_map_mutex, std::defer_lock);
+
+		// Yield to the other tasks after processing this number of rounds
+		constexpr int MaxRoundsPerRun = 16;
+
+		for (int round = 0; (round < MaxRoundsPerRun) && (_stop_thread_flag == false); round++)
+		{
+			if (ProcessQueuedItems(session_lock) == false)
+			{
+				break;
 			}
 		}
+
+		_is_scheduled = false;
+
+		if (_stop_thread_flag)
+		{
+			return false;
+		}
+
+		// Items queued after the flag was cleared are scheduled by NotifyQueued() or here, but not twice
+		return HasQueuedItems() && (_is_scheduled.exchange(true) == false);
 	}
 
 	Stream::Stream(const std::shared_ptr<Application> application, const info::Stream &info)
@@ -222,6 +356,11 @@ namespace pub
 	}
 
 	bool Stream::CreateStreamWorker(uint32_t worker_count)
+	{
+		return CreateStreamWorker(worker_count, nullptr);
+	}
+
+	bool Stream::CreateStreamWorker(uint32_t worker_count, const std::function<std::shared_ptr<StreamPacketQueueBase>()> &packet_queue_creator)
 	{
 		std::unique_lock<std::shared_mutex> worker_lock(_stream_worker_lock);
 		
@@ -234,7 +373,7 @@ namespace pub
 		// Create WorkerThread
 		for (uint32_t i = 0; i < _worker_count; i++)
 		{
-			auto stream_worker = std::make_shared<StreamWorker>(GetSharedPtr());
+			auto stream_worker = std::make_shared<StreamWorker>(GetSharedPtr(), (packet_queue_creator != nullptr) ? packet_queue_creator() : nullptr);
 						
 			if (stream_worker->Start() == false)
 			{
@@ -272,7 +411,7 @@ namespace pub
 
 		worker_lock.unlock();
 
-		std::lock_guard<std::shared_mutex> session_lock(_session_map_mutex);
+		std::lock_guard session_lock(_session_map_mutex);
 		for(const auto &x : _sessions)
 		{
 			auto session = x.second;
@@ -303,6 +442,16 @@ namespace pub
 		return _application;
 	}
 
+	std::vector<std::shared_ptr<MediaPacket>> Stream::GetGopCache()
+	{
+		return _application->GetGopCache(GetId());
+	}
+
+	bool Stream::RequestKeyFrame(MediaTrackId track_id)
+	{
+		return _application->RequestKeyFrame(GetId(), track_id);
+	}
+
 	const char * Stream::GetApplicationTypeName() const
 	{
 		if(GetApplication() == nullptr)
@@ -333,7 +482,7 @@ namespace pub
 
 	bool Stream::AddSession(std::shared_ptr<Session> session)
 	{
-		std::lock_guard<std::shared_mutex> session_lock(_session_map_mutex);
+		std::lock_guard session_lock(_session_map_mutex);
 		// For getting session, all sessions
 		_sessions[session->GetId()] = session;
 
@@ -354,7 +503,7 @@ namespace pub
 
 	bool Stream::RemoveSession(session_id_t id)
 	{
-		std::unique_lock<std::shared_mutex> session_lock(_session_map_mutex);
+		std::unique_lock session_lock(_session_map_mutex);
 		if (_sessions.count(id) <= 0)
 		{
 			logtd("Cannot find session : %u", id);
@@ -381,7 +530,7 @@ namespace pub
 
 	std::shared_ptr<Session> Stream::GetSession(session_id_t id)
 	{
-		std::shared_lock<std::shared_mutex> session_lock(_session_map_mutex);
+		std::shared_lock session_lock(_session_map_mutex);
 		if (_sessions.count(id) <= 0)
 		{
 			return nullptr;
@@ -392,13 +541,13 @@ namespace pub
 
 	const std::map<session_id_t, std::shared_ptr<Session>> Stream::GetAllSessions()
 	{
-		std::shared_lock<std::shared_mutex> session_lock(_session_map_mutex);
+		std::shared_lock session_lock(_session_map_mutex);
 		return _sessions;
 	}
 
 	uint32_t Stream::GetSessionCount()
 	{
-		std::shared_lock<std::shared_mutex> session_lock(_session_map_mutex);
+		std::shared_lock session_lock(_session_map_mutex);
 		return _sessions.size();
 	}
 
@@ -414,11 +563,10 @@ namespace pub
 		}
 		else
 		{
-			std::shared_lock<std::shared_mutex> session_lock(_session_map_mutex);
+			std::shared_lock session_lock(_session_map_mutex);
 			for (auto const &x : _sessions)
 			{
-				auto session = std::static_pointer_cast<Session>(x.second);
-				session->SendOutgoingData(packet);
+				x.second->SendOutgoingData(packet);
 			}
 		}
 	
@@ -6,15 +6,20 @@
 #include "base/mediarouter/media_buffer.h"
 #include "modules/managed_queue/managed_queue.h"
 #include "session.h"
+#include "session_scheduler.h"
+#include "stream_packet_queue.h"
 
 #define MAX_STREAM_WORKER_THREAD_COUNT 72
 
 namespace pub
 {
-	class StreamWorker
+	// Delivers the packets/messages of a stream to the sessions assigned to it.
+	// Runs on its own thread, or as a task of SessionScheduler if the scheduler is running.
+	class StreamWorker : public SessionScheduler::Task, public ov::EnableSharedFromThis<StreamWorker>
 	{
 	public:
-		StreamWorker(const std::shared_ptr<Stream> &parent_stream);
+		// If <typed_packet_queue> is not nullptr, the packets are delivered through SendPacket<T>() instead of std::any
+		StreamWorker(const std::shared_ptr<Stream> &parent_stream, const std::shared_ptr<StreamPacketQueueBase> &typed_packet_queue = nullptr);
 		~StreamWorker();
 
 		bool Start();
@@ -30,16 +35,38 @@ namespace pub
 		// Send to all sessions
 		void SendPacket(const std::any &packet);
 
+		// Send to all sessions (typed packet queue must be created with the same type)
+		template <typename T>
+		void SendPacket(const std::shared_ptr<T> &packet)
+		{
+			OV_ASSERT2((_typed_packet_queue != nullptr) && (_typed_packet_queue->GetPacketType() == std::type_index(typeid(T))));
+
+			// Casts the raw pointer not to touch the reference count of the queue for every packet
+			static_cast<StreamPacketQueue<T> *>(_typed_packet_queue.get())->Enqueue(packet);
+			NotifyQueued();
+		}
+
+		// SessionScheduler::Task Interface
+		bool RunTask() override;
+
 	private:
 		void WorkerThread();
 
+		// Wakes up the worker thread, or schedules this worker to SessionScheduler
+		void NotifyQueued();
+		bool HasQueuedItems();
+		// Processes a session message and a packet (or a batch of typed packets)
+		// Returns false if there was nothing to process
+		bool ProcessQueuedItems(std::shared_lock<ov::ProfiledSharedMutex> &session_lock);
+
 		std::map<session_id_t, std::shared_ptr<Session>> _sessions;
-		std::shared_mutex _session_map_mutex;
+		ov::ProfiledSharedMutex _session_map_mutex{"pub::StreamWorker::_session_map_mutex"};
 		
-		ov::Semaphore _queue_event;
+		ov::WakeupEvent _queue_event;
 
 		std::optional<std::any> PopStreamPacket();
-		ov::ManagedQueue<std::any> _packet_queue;
+		ov::ManagedQueue<std::any, ov::ManagedQueueRingBuffer<512>> _packet_queue;
+		std::shared_ptr<StreamPacketQueueBase> _typed_packet_queue;
 
 		struct SessionMessage
 		{
@@ -56,9 +83,17 @@ namespace pub
 		std::shared_ptr<SessionMessage> PopSessionMessage();
 		ov::Queue<std::shared_ptr<SessionMessage>> _session_message_queue;
 
-		bool _stop_thread_flag;
+		std::atomic<bool> _stop_thread_flag;
 		std::thread _worker_thread;
 
+		// Used when the worker runs on SessionScheduler
+		bool _use_scheduler = false;
+		size_t _affinity_hint = 0;
+		// true while this worker is queued to (or running on) SessionScheduler
+		std::atomic<bool> _is_scheduled{false};
+		// Held while RunTask() is running, so Stop() can wait for it
+		std::mutex _task_mutex;
+
 		std::shared_ptr<Stream> _parent;
 	};
 
@@ -86,6 +121,38 @@ namespace pub
 		// A child call this function to delivery packet to all sessions
 		bool BroadcastPacket(const std::any &packet);
 
+		// Delivers the packet to the sessions that implement PacketSink<T> without type erasure
+		// (the stream workers must be created with CreateStreamWorker<T>())
+		template <typename T>
+		bool BroadcastPacket(const std::shared_ptr<T> &packet)
+		{
+			if (_worker_count > 0)
+			{
+				std::shared_lock<std::shared_mutex> worker_lock(_stream_worker_lock);
+				for (auto &stream_worker : _stream_workers)
+				{
+					stream_worker->SendPacket(packet);
+				}
+			}
+			else
+			{
+				// The sessions share the packet by reference, so no reference is taken per session
+				PacketBatch<T> batch(&packet, 1);
+
+				std::shared_lock session_lock(_session_map_mutex);
+				for (auto const &x : _sessions)
+				{
+					auto sink = PacketSink<T>::FromSession(x.second);
+					if (sink != nullptr)
+					{
+						sink->SendOutgoingPackets(batch);
+					}
+				}
+			}
+
+			return true;
+		}
+
 		bool SendMessage(const std::shared_ptr<Session> &session, const std::any &message);
 
 		// Child must implement this function for packetizing and call BroadcastPacket to delivery to all sessions.
@@ -101,8 +168,23 @@ namespace pub
 
 		bool CreateStreamWorker(uint32_t worker_count);
 
+		// Creates the stream workers that deliver the packets of type T in batches
+		template <typename T>
+		bool CreateStreamWorker(uint32_t worker_count)
+		{
+			return CreateStreamWorker(worker_count, []() -> std::shared_ptr<StreamPacketQueueBase> {
+				return std::make_shared<StreamPacketQueue<T>>();
+			});
+		}
+
 		uint32_t IssueUniqueSessionId();
 
+		// Packets from the last key frame, which a new session can send first instead of waiting for the next key frame
+		std::vector<std::shared_ptr<MediaPacket>> GetGopCache();
+		// Requests a keyframe of the track on demand, so a session switching to it does not wait for the next GOP.
+		// The requests of the sessions are coalesced and rate limited by the encoder.
+		bool RequestKeyFrame(MediaTrackId track_id);
+
 		std::shared_ptr<Application> GetApplication() const;
 		const char * GetApplicationTypeName() const;
 
@@ -124,9 +206,11 @@ namespace pub
 		virtual ~Stream();
 
 	private:
+		bool CreateStreamWorker(uint32_t worker_count, const std::function<std::shared_ptr<StreamPacketQueueBase>()> &packet_queue_creator);
+
 		std::shared_ptr<StreamWorker> GetWorkerBySessionID(session_id_t session_id);
 		std::map<session_id_t, std::shared_ptr<Session>> _sessions;
-		std::shared_mutex _session_map_mutex;
+		ov::ProfiledSharedMutex _session_map_mutex{"pub::Stream::_session_map_mutex"};
 
 		uint32_t _worker_count;
 		
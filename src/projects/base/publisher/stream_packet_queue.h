@@ -0,0 +1,197 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <typeindex>
+#include <vector>
+
+#include "base/common_types.h"
+#include "modules/managed_queue/managed_queue.h"
+#include "session.h"
+
+// Maximum number of packets delivered to a session at a time
+#define MAX_STREAM_PACKET_BATCH_SIZE 64
+
+namespace pub
+{
+	// A read-only view of contiguous packets (like std::span in C++20)
+	template <typename T>
+	class PacketBatch
+	{
+	public:
+		PacketBatch(const std::shared_ptr<T> *packets, size_t count)
+			: _packets(packets),
+			  _count(count)
+		{
+		}
+
+		PacketBatch(const std::vector<std::shared_ptr<T>> &packets)
+			: PacketBatch(packets.data(), packets.size())
+		{
+		}
+
+		const std::shared_ptr<T> *begin() const
+		{
+			return _packets;
+		}
+
+		const std::shared_ptr<T> *end() const
+		{
+			return _packets + _count;
+		}
+
+		const std::shared_ptr<T> &operator[](size_t index) const
+		{
+			return _packets[index];
+		}
+
+		size_t size() const
+		{
+			return _count;
+		}
+
+		bool empty() const
+		{
+			return _count == 0;
+		}
+
+	private:
+		const std::shared_ptr<T> *_packets;
+		size_t _count;
+	};
+
+	// A session that receives the packets of type T broadcast by Stream::BroadcastPacket<T>()
+	template <typename T>
+	class PacketSink
+	{
+	public:
+		virtual ~PacketSink() = default;
+
+		// Packets are delivered in the order they were broadcast
+		virtual void SendOutgoingPackets(const PacketBatch<T> &packets) = 0;
+
+		static PacketSink<T> *FromSession(const std::shared_ptr<Session> &session)
+		{
+			return dynamic_cast<PacketSink<T> *>(session.get());
+		}
+	};
+
+	// Typed packet queue of a StreamWorker
+	class StreamPacketQueueBase
+	{
+	public:
+		virtual ~StreamPacketQueueBase() = default;
+
+		virtual const std::type_index &GetPacketType() const = 0;
+
+		virtual void SetUrn(const char *urn) = 0;
+		virtual bool IsEmpty() const = 0;
+		virtual void Stop() = 0;
+
+		// Called when a session is added to/removed from the worker (with the exclusive session lock of the worker)
+		virtual void OnSessionsChanged(const std::map<session_id_t, std::shared_ptr<Session>> &sessions) = 0;
+
+		// Pops up to MAX_STREAM_PACKET_BATCH_SIZE packets and delivers them to all sessions at once
+		// (with the shared session lock of the worker)
+		virtual void DispatchPackets() = 0;
+	};
+
+	template <typename T>
+	class StreamPacketQueue : public StreamPacketQueueBase
+	{
+	public:
+		StreamPacketQueue()
+			: _queue(nullptr, 500)
+		{
+			_batch.reserve(MAX_STREAM_PACKET_BATCH_SIZE);
+		}
+
+		const std::type_index &GetPacketType() const override
+		{
+			return _packet_type;
+		}
+
+		void SetUrn(const char *urn) override
+		{
+			_queue.SetUrn(urn);
+		}
+
+		bool IsEmpty() const override
+		{
+			return _queue.IsEmpty();
+		}
+
+		void Stop() override
+		{
+			_queue.Stop();
+		}
+
+		void Enqueue(const std::shared_ptr<T> &packet)
+		{
+			_queue.Enqueue(packet);
+		}
+
+		void OnSessionsChanged(const std::map<session_id_t, std::shared_ptr<Session>> &sessions) override
+		{
+			_sink_list.clear();
+
+			for (const auto &item : sessions)
+			{
+				auto sink = PacketSink<T>::FromSession(item.second);
+
+				if (sink != nullptr)
+				{
+					_sink_list.push_back(sink);
+				}
+			}
+		}
+
+		void DispatchPackets() override
+		{
+			PopBatch();
+
+			if (_batch.empty())
+			{
+				return;
+			}
+
+			PacketBatch<T> batch(_batch);
+
+			for (auto sink : _sink_list)
+			{
+				sink->SendOutgoingPackets(batch);
+			}
+
+			_batch.clear();
+		}
+
+	private:
+		void PopBatch()
+		{
+			while (_batch.size() < MAX_STREAM_PACKET_BATCH_SIZE)
+			{
+				auto packet = _queue.Dequeue(0);
+
+				if (packet.has_value() == false)
+				{
+					break;
+				}
+
+				_batch.push_back(std::move(packet.value()));
+			}
+		}
+
+		const std::type_index _packet_type = std::type_index(typeid(T));
+
+		ov::ManagedQueue<std::shared_ptr<T>, ov::ManagedQueueRingBuffer<512>> _queue;
+
+		std::vector<std::shared_ptr<T>> _batch;
+		// Sessions that can receive T (updated when the sessions are changed)
+		std::vector<PacketSink<T> *> _sink_list;
+	};
+}  // namespace pub
@@ -0,0 +1,102 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "stream_resolution_cache.h"
+
+#include "publisher_private.h"
+#include "stream.h"
+
+namespace pub
+{
+	static_assert((PUB_STREAM_RESOLUTION_CACHE_SHARD_COUNT & (PUB_STREAM_RESOLUTION_CACHE_SHARD_COUNT - 1)) == 0,
+				  "PUB_STREAM_RESOLUTION_CACHE_SHARD_COUNT must be a power of 2");
+
+	ov::String StreamResolutionCache::MakeKey(const std::shared_ptr<const ov::Url> &url)
+	{
+		return ov::String::FormatString("%s/%s/%s", url->Host().CStr(), url->App().CStr(), url->Stream().CStr());
+	}
+
+	StreamResolutionCache::Shard &StreamResolutionCache::GetShard(const ov::String &key)
+	{
+		return _shards[std::hash<ov::String>()(key) & (PUB_STREAM_RESOLUTION_CACHE_SHARD_COUNT - 1)];
+	}
+
+	const StreamResolutionCache::Shard &StreamResolutionCache::GetShard(const ov::String &key) const
+	{
+		return _shards[std::hash<ov::String>()(key) & (PUB_STREAM_RESOLUTION_CACHE_SHARD_COUNT - 1)];
+	}
+
+	std::shared_ptr<Stream> StreamResolutionCache::Find(const std::shared_ptr<const ov::Url> &url, uint64_t routing_version, info::VHostAppName *vhost_app_name) const
+	{
+		if (url == nullptr)
+		{
+			return nullptr;
+		}
+
+		auto key = MakeKey(url);
+		auto &shard = GetShard(key);
+
+		std::shared_lock<std::shared_mutex> lock(shard.mutex);
+
+		auto item = shard.entries.find(key);
+		if ((item == shard.entries.end()) || (item->second.routing_version != routing_version))
+		{
+			return nullptr;
+		}
+
+		auto stream = item->second.stream.lock();
+		if ((stream == nullptr) || (stream->GetState() == Stream::State::STOPPED))
+		{
+			return nullptr;
+		}
+
+		if (vhost_app_name != nullptr)
+		{
+			*vhost_app_name = item->second.vhost_app_name;
+		}
+
+		return stream;
+	}
+
+	void StreamResolutionCache::Insert(const std::shared_ptr<const ov::Url> &url, uint64_t routing_version, const info::VHostAppName &vhost_app_name, const std::shared_ptr<Stream> &stream)
+	{
+		if ((url == nullptr) || (stream == nullptr))
+		{
+			return;
+		}
+
+		auto key = MakeKey(url);
+		auto &shard = GetShard(key);
+
+		std::unique_lock<std::shared_mutex> lock(shard.mutex);
+
+		shard.entries.insert_or_assign(key, Entry{routing_version, vhost_app_name, stream->GetName(), stream});
+	}
+
+	void StreamResolutionCache::RemoveStream(const info::VHostAppName &vhost_app_name, const ov::String &stream_name)
+	{
+		RemoveIf([&](const Entry &entry) -> bool {
+			return (entry.vhost_app_name == vhost_app_name) && (entry.stream_name == stream_name);
+		});
+	}
+
+	void StreamResolutionCache::RemoveApplication(const info::VHostAppName &vhost_app_name)
+	{
+		RemoveIf([&](const Entry &entry) -> bool {
+			return entry.vhost_app_name == vhost_app_name;
+		});
+	}
+
+	void StreamResolutionCache::Clear()
+	{
+		for (auto &shard : _shards)
+		{
+			std::unique_lock<std::shared_mutex> lock(shard.mutex);
+			shard.entries.clear();
+		}
+	}
+}  // namespace pub
@@ -0,0 +1,86 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/info/vhost_app_name.h>
+#include <base/ovlibrary/ovlibrary.h>
+#include <base/ovlibrary/url.h>
+
+#include <shared_mutex>
+#include <unordered_map>
+
+// The number of shards of StreamResolutionCache (must be a power of 2)
+#define PUB_STREAM_RESOLUTION_CACHE_SHARD_COUNT 16
+
+namespace pub
+{
+	class Stream;
+
+	// Caches the result of <host>/<app>/<stream> of a request -> (VHostAppName, Stream).
+	//
+	// Resolving a request takes the VirtualHost/domain lookup of the Orchestrator, the application map and
+	// the stream map, for every playlist/segment/part request. Once a stream is resolved, the following requests of
+	// the same host/app/stream only look up a shard of this cache.
+	//
+	// The stream is held as weak_ptr, and the entries are removed when the stream or the application is deleted.
+	// The entries made before the VirtualHost/domain configuration is changed are ignored (see <routing_version>).
+	class StreamResolutionCache
+	{
+	public:
+		// Returns nullptr if <url> has not been resolved (or the stream has gone)
+		std::shared_ptr<Stream> Find(const std::shared_ptr<const ov::Url> &url, uint64_t routing_version, info::VHostAppName *vhost_app_name) const;
+		void Insert(const std::shared_ptr<const ov::Url> &url, uint64_t routing_version, const info::VHostAppName &vhost_app_name, const std::shared_ptr<Stream> &stream);
+
+		void RemoveStream(const info::VHostAppName &vhost_app_name, const ov::String &stream_name);
+		void RemoveApplication(const info::VHostAppName &vhost_app_name);
+		void Clear();
+
+	private:
+		struct Entry
+		{
+			uint64_t routing_version;
+			info::VHostAppName vhost_app_name;
+			ov::String stream_name;
+			std::weak_ptr<Stream> stream;
+		};
+
+		struct Shard
+		{
+			mutable std::shared_mutex mutex;
+			// key: <host>/<app>/<stream>
+			std::unordered_map<ov::String, Entry> entries;
+		};
+
+		static ov::String MakeKey(const std::shared_ptr<const ov::Url> &url);
+		Shard &GetShard(const ov::String &key);
+		const Shard &GetShard(const ov::String &key) const;
+
+		template <typename Tpredicate>
+		void RemoveIf(Tpredicate predicate)
+		{
+			for (auto &shard : _shards)
+			{
+				std::unique_lock<std::shared_mutex> lock(shard.mutex);
+
+				for (auto it = shard.entries.begin(); it != shard.entries.end();)
+				{
+					if (predicate(it->second))
+					{
+						it = shard.entries.erase(it);
+					}
+					else
+					{
+						++it;
+					}
+				}
+			}
+		}
+
+		Shard _shards[PUB_STREAM_RESOLUTION_CACHE_SHARD_COUNT];
+	};
+}  // namespace pub
@@ -0,0 +1,91 @@
+# The benchmarks are built only by 'make benchmarks'
+ifeq ($(MAKECMDGOALS),benchmarks)
+
+LOCAL_PATH := $(call get_local_path)
+include $(DEFAULT_VARIABLES)
+
+# The primitives use the monitoring/config modules indirectly (e.g. ManagedQueue), so it links the same libraries as OvenMediaEngine
+LOCAL_STATIC_LIBRARIES := \
+	webrtc_publisher \
+	llhls_publisher \
+	segment_publishers \
+	ovt_publisher \
+	file_publisher \
+	mpegtspush_publisher \
+	rtmppush_publisher \
+	thumbnail_publisher \
+	srt_publisher \
+	ovt_provider \
+	rtmp_provider \
+	srt_provider \
+	mpegts_provider \
+	rtspc_provider \
+	webrtc_provider \
+	transcoder \
+	rtc_signalling \
+	whip \
+	address_utilities \
+	ice \
+	api_server \
+	json_serdes \
+	bitstream \
+	containers \
+	http \
+	dtls_srtp \
+	rtp_rtcp \
+	sdp \
+	id3v2 \
+	segment_writer \
+	web_console \
+	mediarouter \
+	rtsp_module \
+	jitter_buffer \
+	ovt_packetizer \
+	orchestrator \
+	origin_map_client \
+	publisher \
+	application \
+	access_controller \
+	physical_port \
+	socket \
+	ovcrypto \
+	config \
+	ovlibrary \
+	monitoring \
+	jsoncpp \
+	file \
+	dump \
+	srt \
+	rtmp \
+	file_provider \
+	managed_queue \
+
+LOCAL_PREBUILT_LIBRARIES := \
+	libpugixml.a
+
+LOCAL_LDFLAGS := -lpthread -luuid
+
+ifeq ($(shell echo $${OSTYPE}),linux-musl) 
+# For alpine linux
+LOCAL_LDFLAGS += -lexecinfo
+endif
+
+$(call add_pkg_config,srt)
+$(call add_pkg_config,libavformat)
+$(call add_pkg_config,libavfilter)
+$(call add_pkg_config,libavcodec)
+$(call add_pkg_config,libswresample)
+$(call add_pkg_config,libswscale)
+$(call add_pkg_config,libavutil)
+$(call add_pkg_config,openssl)
+$(call add_pkg_config,vpx)
+$(call add_pkg_config,opus)
+$(call add_pkg_config,libsrtp2)
+$(call add_pkg_config,libpcre2-8)
+$(call add_pkg_config,hiredis)
+
+LOCAL_TARGET := OvenMediaEngineBenchmarks
+
+include $(BUILD_EXECUTABLE)
+
+endif
@@ -0,0 +1,134 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/ovlibrary/ovlibrary.h>
+
+#include <chrono>
+#include <functional>
+#include <vector>
+
+// Minimum time to run a benchmark (the iterations are doubled until the run takes longer than this)
+#define BENCHMARK_MIN_TIME_MS 500
+// Number of the iterations of the first run
+#define BENCHMARK_INITIAL_ITERATIONS 16
+
+namespace bmk
+{
+	class State
+	{
+	public:
+		explicit State(uint64_t iterations)
+			: _iterations(iterations)
+		{
+		}
+
+		uint64_t GetIterations() const
+		{
+			return _iterations;
+		}
+
+		// The bytes processed by the benchmark (to print the throughput)
+		void SetProcessedBytes(uint64_t bytes)
+		{
+			_processed_bytes = bytes;
+		}
+
+		uint64_t GetProcessedBytes() const
+		{
+			return _processed_bytes;
+		}
+
+	private:
+		uint64_t _iterations = 0;
+		uint64_t _processed_bytes = 0;
+	};
+
+	using BenchmarkFunction = std::function<void(State &state)>;
+
+	struct Benchmark
+	{
+		ov::String name;
+		BenchmarkFunction function;
+	};
+
+	inline std::vector<Benchmark> &GetBenchmarkList()
+	{
+		static std::vector<Benchmark> list;
+		return list;
+	}
+
+	struct Registerer
+	{
+		Registerer(const char *name, BenchmarkFunction function)
+		{
+			GetBenchmarkList().push_back({name, std::move(function)});
+		}
+	};
+
+	// Prevents the compiler from optimizing out the value
+	template <typename T>
+	inline void DoNotOptimize(const T &value)
+	{
+		asm volatile(""
+					 :
+					 : "r,m"(value)
+					 : "memory");
+	}
+
+	// Runs the benchmarks whose name contains the filter (all benchmarks if the filter is empty)
+	inline int RunBenchmarks(const ov::String &filter)
+	{
+		::printf("%-48s %14s %14s %12s\n", "Benchmark", "Iterations", "ns/op", "MB/s");
+
+		for (auto &benchmark : GetBenchmarkList())
+		{
+			if ((filter.IsEmpty() == false) && (benchmark.name.IndexOf(filter) < 0))
+			{
+				continue;
+			}
+
+			uint64_t iterations = BENCHMARK_INITIAL_ITERATIONS;
+
+			while (true)
+			{
+				State state(iterations);
+
+				auto start = std::chrono::steady_clock::now();
+				benchmark.function(state);
+				auto elapsed_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+
+				if ((elapsed_ns >= (BENCHMARK_MIN_TIME_MS * 1000000LL)) || (iterations >= (1ULL << 40)))
+				{
+					double ns_per_op = static_cast<double>(elapsed_ns) / iterations;
+					double mb_per_sec = (state.GetProcessedBytes() > 0) ? (state.GetProcessedBytes() / 1000000.0) / (elapsed_ns / 1000000000.0) : 0.0;
+
+					::printf("%-48s %14" PRIu64 " %14.1f %12.1f\n", benchmark.name.CStr(), iterations, ns_per_op, mb_per_sec);
+					break;
+				}
+
+				iterations *= 2;
+			}
+		}
+
+		return 0;
+	}
+}  // namespace bmk
+
+#define BENCHMARK_CONCAT_INTERNAL(a, b) a##b
+#define BENCHMARK_CONCAT(a, b) BENCHMARK_CONCAT_INTERNAL(a, b)
+
+// Usage:
+//   BENCHMARK(DataAppend)
+//   {
+//       for (uint64_t i = 0; i < state.GetIterations(); i++) { ... }
+//   }
+#define BENCHMARK(name)                                                                                          \
+	static void BENCHMARK_CONCAT(Benchmark_, name)(bmk::State & state);                                          \
+	static bmk::Registerer BENCHMARK_CONCAT(benchmark_registerer_, name)(#name, BENCHMARK_CONCAT(Benchmark_, name)); \
+	static void BENCHMARK_CONCAT(Benchmark_, name)(bmk::State & state)
@@ -0,0 +1,15 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "./benchmark.h"
+
+// Usage: OvenMediaEngineBenchmarks [filter]
+//   filter: Runs only the benchmarks whose name contains the filter (e.g. ManagedQueue)
+int main(int argc, char *argv[])
+{
+	return bmk::RunBenchmarks((argc > 1) ? argv[1] : "");
+}
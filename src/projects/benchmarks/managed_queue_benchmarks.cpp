@@ -0,0 +1,68 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include <modules/managed_queue/managed_queue.h>
+
+#include <thread>
+
+#include "./benchmark.h"
+
+// Enqueues the items from the producers and dequeues them from a consumer (like the workers of the publishers)
+static void RunManagedQueue(bmk::State &state, int producer_count)
+{
+	ov::ManagedQueue<std::shared_ptr<ov::Data>> queue("benchmark");
+	auto item = std::make_shared<ov::Data>(16);
+
+	std::vector<std::thread> producers;
+	uint64_t items_per_producer = state.GetIterations() / producer_count;
+	uint64_t total_count = items_per_producer * producer_count;
+
+	std::thread consumer([&]() {
+		for (uint64_t count = 0; count < total_count; count++)
+		{
+			auto value = queue.Dequeue();
+			if (value.has_value() == false)
+			{
+				break;
+			}
+
+			bmk::DoNotOptimize(value.value());
+		}
+	});
+
+	for (int index = 0; index < producer_count; index++)
+	{
+		producers.emplace_back([&]() {
+			for (uint64_t count = 0; count < items_per_producer; count++)
+			{
+				queue.Enqueue(item);
+			}
+		});
+	}
+
+	for (auto &producer : producers)
+	{
+		producer.join();
+	}
+
+	consumer.join();
+}
+
+BENCHMARK(ManagedQueue1Producer)
+{
+	RunManagedQueue(state, 1);
+}
+
+BENCHMARK(ManagedQueue4Producers)
+{
+	RunManagedQueue(state, 4);
+}
+
+BENCHMARK(ManagedQueue16Producers)
+{
+	RunManagedQueue(state, 16);
+}
@@ -0,0 +1,72 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include <base/ovcrypto/ovcrypto.h>
+
+#include "./benchmark.h"
+
+// Similar to the size of an RTP packet
+#define BENCHMARK_PACKET_SIZE 1200
+
+static std::shared_ptr<ov::Data> GenerateData(size_t length)
+{
+	auto data = std::make_shared<ov::Data>(length);
+	data->SetLength(length);
+
+	auto buffer = data->GetWritableDataAs<uint8_t>();
+	for (size_t index = 0; index < length; index++)
+	{
+		buffer[index] = static_cast<uint8_t>(index * 31);
+	}
+
+	return data;
+}
+
+BENCHMARK(Base64Encode)
+{
+	auto data = GenerateData(BENCHMARK_PACKET_SIZE);
+
+	for (uint64_t i = 0; i < state.GetIterations(); i++)
+	{
+		auto encoded = ov::Base64::Encode(*data);
+		bmk::DoNotOptimize(encoded.CStr());
+	}
+
+	state.SetProcessedBytes(state.GetIterations() * BENCHMARK_PACKET_SIZE);
+}
+
+BENCHMARK(Base64Decode)
+{
+	auto encoded = ov::Base64::Encode(*GenerateData(BENCHMARK_PACKET_SIZE));
+
+	for (uint64_t i = 0; i < state.GetIterations(); i++)
+	{
+		auto decoded = ov::Base64::Decode(encoded);
+		bmk::DoNotOptimize(decoded->GetData());
+	}
+
+	state.SetProcessedBytes(state.GetIterations() * encoded.GetLength());
+}
+
+// Same as the message integrity of STUN (ICE)
+BENCHMARK(MessageDigestHmacSha1)
+{
+	auto key = GenerateData(32);
+	auto input = GenerateData(BENCHMARK_PACKET_SIZE);
+	uint8_t output[20];
+
+	for (uint64_t i = 0; i < state.GetIterations(); i++)
+	{
+		ov::MessageDigest::ComputeHmac(ov::CryptoAlgorithm::Sha1,
+									   key->GetData(), key->GetLength(),
+									   input->GetData(), input->GetLength(),
+									   output, sizeof(output));
+		bmk::DoNotOptimize(output);
+	}
+
+	state.SetProcessedBytes(state.GetIterations() * BENCHMARK_PACKET_SIZE);
+}
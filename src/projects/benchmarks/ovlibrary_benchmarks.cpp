@@ -0,0 +1,179 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include <base/ovlibrary/crc.h>
+
+#include "./benchmark.h"
+
+// Similar to the size of a video frame
+#define BENCHMARK_PAYLOAD_SIZE (64 * 1024)
+// Similar to the size of an RTP packet
+#define BENCHMARK_PACKET_SIZE 1200
+
+static const std::shared_ptr<ov::Data> &GetPayload()
+{
+	static auto payload = []() {
+		auto data = std::make_shared<ov::Data>(BENCHMARK_PAYLOAD_SIZE);
+		data->SetLength(BENCHMARK_PAYLOAD_SIZE);
+
+		auto buffer = data->GetWritableDataAs<uint8_t>();
+		for (size_t index = 0; index < BENCHMARK_PAYLOAD_SIZE; index++)
+		{
+			buffer[index] = static_cast<uint8_t>(index * 31);
+		}
+
+		return data;
+	}();
+
+	return payload;
+}
+
+BENCHMARK(DataAppendPacket)
+{
+	auto payload = GetPayload();
+	ov::Data data;
+
+	for (uint64_t i = 0; i < state.GetIterations(); i++)
+	{
+		if (data.GetLength() >= BENCHMARK_PAYLOAD_SIZE)
+		{
+			data.Clear();
+		}
+
+		data.Append(payload->GetData(), BENCHMARK_PACKET_SIZE);
+	}
+
+	bmk::DoNotOptimize(data.GetLength());
+	state.SetProcessedBytes(state.GetIterations() * BENCHMARK_PACKET_SIZE);
+}
+
+BENCHMARK(DataSubdata)
+{
+	auto payload = GetPayload();
+
+	for (uint64_t i = 0; i < state.GetIterations(); i++)
+	{
+		auto subdata = payload->Subdata((i * BENCHMARK_PACKET_SIZE) % (BENCHMARK_PAYLOAD_SIZE - BENCHMARK_PACKET_SIZE), BENCHMARK_PACKET_SIZE);
+		bmk::DoNotOptimize(subdata->GetData());
+	}
+}
+
+BENCHMARK(DataClone)
+{
+	auto payload = GetPayload();
+
+	for (uint64_t i = 0; i < state.GetIterations(); i++)
+	{
+		auto clone = payload->Clone();
+		bmk::DoNotOptimize(clone->GetData());
+	}
+}
+
+BENCHMARK(StringFormat)
+{
+	for (uint64_t i = 0; i < state.GetIterations(); i++)
+	{
+		auto str = ov::String::FormatString("#%s#%s/%s track: %u, pts: %" PRId64, "default", "app", "stream", static_cast<uint32_t>(i % 4), static_cast<int64_t>(i));
+		bmk::DoNotOptimize(str.CStr());
+	}
+}
+
+BENCHMARK(StringAppendFormat)
+{
+	ov::String str;
+
+	for (uint64_t i = 0; i < state.GetIterations(); i++)
+	{
+		if (str.GetLength() >= 4096)
+		{
+			str.Clear();
+		}
+
+		str.AppendFormat("%" PRIu64 ",", i);
+	}
+
+	bmk::DoNotOptimize(str.CStr());
+}
+
+BENCHMARK(ByteStreamWriteBE32)
+{
+	ov::ByteStream stream(BENCHMARK_PAYLOAD_SIZE);
+
+	for (uint64_t i = 0; i < state.GetIterations(); i++)
+	{
+		if (stream.GetLength() >= BENCHMARK_PAYLOAD_SIZE)
+		{
+			stream.GetDataPointer()->Clear();
+			stream.SetOffset(0);
+		}
+
+		stream.WriteBE32(static_cast<uint32_t>(i));
+	}
+
+	bmk::DoNotOptimize(stream.GetLength());
+	state.SetProcessedBytes(state.GetIterations() * sizeof(uint32_t));
+}
+
+BENCHMARK(ByteStreamReadBE32)
+{
+	std::shared_ptr<const ov::Data> payload = GetPayload();
+	ov::ByteStream stream(payload);
+	uint32_t sum = 0;
+
+	for (uint64_t i = 0; i < state.GetIterations(); i++)
+	{
+		if (stream.Remained() < sizeof(uint32_t))
+		{
+			stream.SetOffset(0);
+		}
+
+		sum += stream.ReadBE32();
+	}
+
+	bmk::DoNotOptimize(sum);
+	state.SetProcessedBytes(state.GetIterations() * sizeof(uint32_t));
+}
+
+BENCHMARK(BitReaderReadBits)
+{
+	auto payload = GetPayload();
+	uint32_t sum = 0;
+
+	// Reads 5, 3, 7, 1, 16 bits (32 bits) per iteration, like parsing a header
+	auto reader = std::make_unique<BitReader>(payload->GetDataAs<uint8_t>(), payload->GetLength());
+
+	for (uint64_t i = 0; i < state.GetIterations(); i++)
+	{
+		if (reader->BitsRemained() < 32)
+		{
+			reader = std::make_unique<BitReader>(payload->GetDataAs<uint8_t>(), payload->GetLength());
+		}
+
+		sum += reader->ReadBits<uint32_t>(5);
+		sum += reader->ReadBits<uint32_t>(3);
+		sum += reader->ReadBits<uint32_t>(7);
+		sum += reader->ReadBits<uint32_t>(1);
+		sum += reader->ReadBits<uint32_t>(16);
+	}
+
+	bmk::DoNotOptimize(sum);
+	state.SetProcessedBytes(state.GetIterations() * sizeof(uint32_t));
+}
+
+BENCHMARK(Crc32Packet)
+{
+	auto payload = GetPayload();
+	uint32_t crc = 0;
+
+	for (uint64_t i = 0; i < state.GetIterations(); i++)
+	{
+		crc = ov::CRC::Crc32(crc, payload->GetDataAs<uint8_t>(), BENCHMARK_PACKET_SIZE);
+	}
+
+	bmk::DoNotOptimize(crc);
+	state.SetProcessedBytes(state.GetIterations() * BENCHMARK_PACKET_SIZE);
+}
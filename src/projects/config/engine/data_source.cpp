@@ -16,6 +16,7 @@
 #include "./annotations.h"
 #include "./config_error.h"
 #include "./item.h"
+#include "./item_schema.h"
 #include "./variant.h"
 
 #define OV_LOG_TAG "Config.DataSource"
@@ -161,9 +162,7 @@ namespace cfg
 		}
 	}
 
-	void DataSource::CheckUnknownItems(const ov::String &path,
-									   const std::unordered_map<ov::String, std::shared_ptr<Child>> &children_for_xml,
-									   const std::unordered_map<ov::String, std::shared_ptr<Child>> &children_for_json) const
+	void DataSource::CheckUnknownItems(const ov::String &path, const ItemSchema &schema) const
 	{
 		if (_check_unknown_items == CheckUnknownItems::DontCheck)
 		{
@@ -171,25 +170,16 @@ namespace cfg
 			return;
 		}
 
-		auto file_path = GetFileName();
-
 		switch (_type)
 		{
 			case DataType::Xml:
 				for (auto &child_node : _node.children())
 				{
-					ov::String name(child_node.name());
+					auto name = child_node.name();
 
-					if (children_for_xml.find(name) == children_for_xml.end())
+					if (schema.HasXmlName(name) == false)
 					{
-						if (file_path.IsEmpty())
-						{
-							throw CreateConfigError("Unknown item found: %s.%s", path.CStr(), name.CStr());
-						}
-						else
-						{
-							throw CreateConfigError("Unknown item found: %s.%s in %s", path.CStr(), name.CStr(), file_path.CStr());
-						}
+						ThrowUnknownItemError(path, name);
 					}
 				}
 				break;
@@ -197,11 +187,11 @@ namespace cfg
 			case DataType::Json: {
 				if (_json.isObject())
 				{
-					auto members = _json.getMemberNames();
-
-					for (auto &member : members)
+					for (auto member = _json.begin(); member != _json.end(); ++member)
 					{
-						ov::String name(member.c_str());
+						const char *name_end = nullptr;
+						auto name_begin = member.memberName(&name_end);
+						std::string_view name(name_begin, name_end - name_begin);
 
 						if (name == "$")
 						{
@@ -209,16 +199,9 @@ namespace cfg
 							continue;
 						}
 
-						if (children_for_json.find(name) == children_for_json.end())
+						if (schema.HasJsonName(name) == false)
 						{
-							if (file_path.IsEmpty())
-							{
-								throw CreateConfigError("Unknown item found: %s.%s", path.CStr(), name.CStr());
-							}
-							else
-							{
-								throw CreateConfigError("Unknown item found: %s.%s in %s", path.CStr(), name.CStr(), file_path.CStr());
-							}
+							ThrowUnknownItemError(path, ov::String(name_begin, name.size()));
 						}
 					}
 				}
@@ -228,6 +211,18 @@ namespace cfg
 		}
 	}
 
+	void DataSource::ThrowUnknownItemError(const ov::String &path, const ov::String &name) const
+	{
+		auto file_path = GetFileName();
+
+		if (file_path.IsEmpty())
+		{
+			throw CreateConfigError("Unknown item found: %s.%s", path.CStr(), name.CStr());
+		}
+
+		throw CreateConfigError("Unknown item found: %s.%s in %s", path.CStr(), name.CStr(), file_path.CStr());
+	}
+
 	bool DataSource::IsArray(const ItemName &name) const
 	{
 		switch (_type)
@@ -537,27 +532,30 @@ namespace cfg
 		return {};
 	}
 
-	Json::Value GetJsonValue(const Json::Value &value, const ov::String &name)
+	// Returns a reference to avoid copying the whole subtree for every child
+	const Json::Value &GetJsonValue(const Json::Value &value, const ov::String &name)
 	{
 		if (value.isObject())
 		{
-			if (value.isMember(name))
+			auto child = value.find(name.CStr(), name.CStr() + name.GetLength());
+
+			if (child != nullptr)
 			{
-				return value[name];
+				return *child;
 			}
 		}
 
-		return Json::nullValue;
+		return Json::Value::nullSingleton();
 	}
 
-	Json::Value GetJsonAttribute(const Json::Value &value, const ov::String &attribute_name)
+	const Json::Value &GetJsonAttribute(const Json::Value &value, const ov::String &attribute_name)
 	{
 		if (value.isObject() && value.isMember("$"))
 		{
 			return GetJsonValue(value["$"], attribute_name);
 		}
 
-		return Json::nullValue;
+		return Json::Value::nullSingleton();
 	}
 
 	Variant GetJsonList(const ov::String &current_path, const ov::String &file_name, const Json::Value &json, const ov::String &name, bool omit_json, Json::Value *original_value, CheckUnknownItems check_unknown_items)
@@ -670,7 +668,7 @@ namespace cfg
 			}
 
 			case ValueType::Attribute: {
-				auto attribute = GetJsonAttribute(_json, name);
+				auto &attribute = GetJsonAttribute(_json, name);
 				*original_value = attribute;
 				return attribute.isNull() ? Variant() : Preprocess(_current_file_path, ov::Converter::ToString(attribute), resolve_path);
 			}
@@ -16,6 +16,8 @@
 
 namespace cfg
 {
+	class ItemSchema;
+
 	class DataSource
 	{
 	public:
@@ -58,9 +60,7 @@ namespace cfg
 		}
 
 		MAY_THROWS(cfg::ConfigError)
-		void CheckUnknownItems(const ov::String &path,
-							   const std::unordered_map<ov::String, std::shared_ptr<Child>> &children_for_xml,
-							   const std::unordered_map<ov::String, std::shared_ptr<Child>> &children_for_json) const;
+		void CheckUnknownItems(const ov::String &path, const ItemSchema &schema) const;
 
 		// Check weather the root value is array or not
 		bool IsArray(const ItemName &name) const;
@@ -103,6 +103,9 @@ namespace cfg
 		void LoadFromXmlFile(const ov::String &file_name, const ov::String &root_name);
 		void LoadFromJson(const ov::String &file_name, const ov::String &root_name);
 
+		MAY_THROWS(cfg::ConfigError)
+		[[noreturn]] void ThrowUnknownItemError(const ov::String &path, const ov::String &name) const;
+
 		MAY_THROWS(cfg::ConfigError)
 		Variant GetValueFromXml(ValueType value_type, const ov::String &name, bool is_child, bool resolve_path, Json::Value *original_value) const;
 		MAY_THROWS(cfg::ConfigError)
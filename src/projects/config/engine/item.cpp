@@ -148,8 +148,7 @@ namespace cfg
 		_item_name = item._item_name;
 
 		_children = item._children;
-		_children_for_xml = item._children_for_xml;
-		_children_for_json = item._children_for_json;
+		_schema = item._schema;
 	}
 
 	Item::Item(Item &&item)
@@ -163,8 +162,7 @@ namespace cfg
 		std::swap(_item_name, item._item_name);
 
 		std::swap(_children, item._children);
-		std::swap(_children_for_xml, item._children_for_xml);
-		std::swap(_children_for_json, item._children_for_json);
+		std::swap(_schema, item._schema);
 	}
 
 	Item &Item::operator=(const Item &item)
@@ -177,8 +175,7 @@ namespace cfg
 		_item_name = item._item_name;
 
 		_children = item._children;
-		_children_for_xml = item._children_for_xml;
-		_children_for_json = item._children_for_json;
+		_schema = item._schema;
 
 		RebuildListIfNeeded();
 
@@ -200,6 +197,8 @@ namespace cfg
 			_last_target = this;
 
 			MakeList();
+
+			_schema = ItemSchema::Get(typeid(*this), _children);
 		}
 	}
 
@@ -218,7 +217,7 @@ namespace cfg
 	void Item::AddChild(const std::shared_ptr<Child> &child)
 	{
 		std::shared_ptr<const Child> prev_child;
-		auto name = child->GetItemName();
+		const auto &name = child->GetItemName();
 
 		for (auto child_iterator = _children.begin(); child_iterator != _children.end(); ++child_iterator)
 		{
@@ -231,8 +230,6 @@ namespace cfg
 			}
 		}
 
-		_children_for_xml.insert_or_assign(name.xml_name, child);
-		_children_for_json.insert_or_assign(name.json_name, child);
 		_children.push_back(child);
 
 		if (prev_child != nullptr)
@@ -254,7 +251,7 @@ namespace cfg
 
 		RebuildListIfNeeded();
 
-		data_source.CheckUnknownItems(item_path, _children_for_xml, _children_for_json);
+		data_source.CheckUnknownItems(item_path, *_schema);
 
 		FromDataSourceInternal(item_path, data_source, allow_optional);
 	}
@@ -18,6 +18,7 @@
 #include "./data_source.h"
 #include "./declare_utilities.h"
 #include "./item_name.h"
+#include "./item_schema.h"
 #include "./list.h"
 
 #define CFG_VERBOSE_STRING 1
@@ -217,13 +218,21 @@ namespace cfg
 
 		void AddChild(const std::shared_ptr<Child> &child);
 
+		// Demangling is done once per type, not whenever the list is rebuilt
+		template <typename Ttype>
+		static const ov::String &GetTypeName()
+		{
+			static const ov::String type_name = ov::Demangle(typeid(Ttype).name());
+			return type_name;
+		}
+
 		// For primitive types
 		template <
 			typename Tannot1 = void, typename Tannot2 = void, typename Tannot3 = void,
 			typename Ttype, std::enable_if_t<!std::is_base_of_v<Item, Ttype> && !std::is_base_of_v<Text, Ttype>, int> = 0>
 		void Register(const ItemName &name, Ttype *value, OptionalCallback optional_callback = nullptr, ValidationCallback validation_callback = nullptr)
 		{
-			AddChild(name, ProbeType<Ttype>::type, ov::Demangle(typeid(Ttype).name()),
+			AddChild(name, ProbeType<Ttype>::type, GetTypeName<Ttype>(),
 					 CheckAnnotations<Optional, Tannot1, Tannot2, Tannot3>::value ? Optional::Optional : Optional::NotOptional,
 					 CheckAnnotations<ResolvePath, Tannot1, Tannot2, Tannot3>::value ? ResolvePath::Resolve : ResolvePath::DontResolve,
 					 CheckAnnotations<OmitJsonName, Tannot1, Tannot2, Tannot3>::value ? OmitJsonName::Omit : OmitJsonName::DontOmit,
@@ -237,7 +246,7 @@ namespace cfg
 			typename Ttype, std::enable_if_t<std::is_base_of_v<Text, Ttype>, int> = 0>
 		void Register(const ItemName &name, Ttype *value, OptionalCallback optional_callback = nullptr, ValidationCallback validation_callback = nullptr)
 		{
-			AddChild(name, ProbeType<Ttype>::type, ov::Demangle(typeid(Ttype).name()),
+			AddChild(name, ProbeType<Ttype>::type, GetTypeName<Ttype>(),
 					 CheckAnnotations<Optional, Tannot1, Tannot2, Tannot3>::value ? Optional::Optional : Optional::NotOptional,
 					 CheckAnnotations<ResolvePath, Tannot1, Tannot2, Tannot3>::value ? ResolvePath::Resolve : ResolvePath::DontResolve,
 					 CheckAnnotations<OmitJsonName, Tannot1, Tannot2, Tannot3>::value ? OmitJsonName::Omit : OmitJsonName::DontOmit,
@@ -251,7 +260,7 @@ namespace cfg
 			typename Ttype, std::enable_if_t<std::is_base_of_v<Item, Ttype>, int> = 0>
 		void Register(const ItemName &name, Ttype *value, OptionalCallback optional_callback = nullptr, ValidationCallback validation_callback = nullptr)
 		{
-			AddChild(name, ProbeType<Ttype>::type, ov::Demangle(typeid(Ttype).name()),
+			AddChild(name, ProbeType<Ttype>::type, GetTypeName<Ttype>(),
 					 CheckAnnotations<Optional, Tannot1, Tannot2, Tannot3>::value ? Optional::Optional : Optional::NotOptional,
 					 CheckAnnotations<ResolvePath, Tannot1, Tannot2, Tannot3>::value ? ResolvePath::Resolve : ResolvePath::DontResolve,
 					 CheckAnnotations<OmitJsonName, Tannot1, Tannot2, Tannot3>::value ? OmitJsonName::Omit : OmitJsonName::DontOmit,
@@ -269,7 +278,7 @@ namespace cfg
 		{
 			AddChild(
 				std::make_shared<List<Ttype>>(
-					name, ov::Demangle(typeid(Ttype).name()),
+					name, GetTypeName<Ttype>(),
 					CheckAnnotations<Optional, Tannot1, Tannot2, Tannot3>::value ? Optional::Optional : Optional::NotOptional,
 					CheckAnnotations<ResolvePath, Tannot1, Tannot2, Tannot3>::value ? ResolvePath::Resolve : ResolvePath::DontResolve,
 					CheckAnnotations<OmitJsonName, Tannot1, Tannot2, Tannot3>::value ? OmitJsonName::Omit : OmitJsonName::DontOmit,
@@ -289,7 +298,7 @@ namespace cfg
 		ItemName _item_name;
 
 		std::vector<std::shared_ptr<Child>> _children;
-		std::unordered_map<ov::String, std::shared_ptr<Child>> _children_for_xml;
-		std::unordered_map<ov::String, std::shared_ptr<Child>> _children_for_json;
+		// Shared by all instances of the same class
+		std::shared_ptr<const ItemSchema> _schema;
 	};
 }  // namespace cfg
@@ -0,0 +1,61 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "item_schema.h"
+
+#include <shared_mutex>
+#include <unordered_map>
+
+#include "./child.h"
+
+namespace cfg
+{
+	static std::shared_mutex schema_map_mutex;
+	static std::unordered_map<std::type_index, std::shared_ptr<const ItemSchema>> schema_map;
+
+	ItemSchema::ItemSchema(const std::vector<std::shared_ptr<Child>> &children)
+	{
+		// _names must not be reallocated after the views are made
+		_names.reserve(children.size());
+
+		for (const auto &child : children)
+		{
+			_names.push_back(child->GetItemName());
+		}
+
+		for (const auto &name : _names)
+		{
+			_xml_names.emplace(name.xml_name.CStr(), name.xml_name.GetLength());
+			_json_names.emplace(name.json_name.CStr(), name.json_name.GetLength());
+		}
+	}
+
+	std::shared_ptr<const ItemSchema> ItemSchema::Get(const std::type_info &type, const std::vector<std::shared_ptr<Child>> &children)
+	{
+		std::type_index key(type);
+
+		{
+			std::shared_lock<std::shared_mutex> lock(schema_map_mutex);
+
+			auto schema = schema_map.find(key);
+			if (schema != schema_map.end())
+			{
+				return schema->second;
+			}
+		}
+
+		std::unique_lock<std::shared_mutex> lock(schema_map_mutex);
+
+		auto &schema = schema_map[key];
+		if (schema == nullptr)
+		{
+			schema = std::shared_ptr<const ItemSchema>(new ItemSchema(children));
+		}
+
+		return schema;
+	}
+}  // namespace cfg
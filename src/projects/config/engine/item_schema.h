@@ -0,0 +1,49 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/ovlibrary/ovlibrary.h>
+
+#include <string_view>
+#include <typeindex>
+#include <unordered_set>
+
+#include "./item_name.h"
+
+namespace cfg
+{
+	// The names of the children of an Item class, used to find unknown items while loading.
+	//
+	// Every instance of an Item class registers the same children in MakeList(), so the table is built once
+	// per class and shared by all instances, instead of building name -> Child maps whenever the list is rebuilt.
+	class ItemSchema
+	{
+	public:
+		// Returns the schema of <type>, built from <children> if it is the first instance of the class
+		static std::shared_ptr<const ItemSchema> Get(const std::type_info &type, const std::vector<std::shared_ptr<Child>> &children);
+
+		bool HasXmlName(std::string_view name) const
+		{
+			return _xml_names.find(name) != _xml_names.end();
+		}
+
+		bool HasJsonName(std::string_view name) const
+		{
+			return _json_names.find(name) != _json_names.end();
+		}
+
+	protected:
+		explicit ItemSchema(const std::vector<std::shared_ptr<Child>> &children);
+
+		// Owns the names referenced by _xml_names and _json_names
+		std::vector<ItemName> _names;
+
+		std::unordered_set<std::string_view> _xml_names;
+		std::unordered_set<std::string_view> _json_names;
+	};
+}  // namespace cfg
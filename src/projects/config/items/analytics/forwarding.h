@@ -18,16 +18,21 @@ namespace cfg
 			bool _enable = false;
 			// Default OvenConsole URL
 			ov::String _collector = "tcp://collector.ovenconsole.io:21514";
+			// "gzip" sends each batch of the lines as a gzip member (the stream is decoded as a concatenated gzip),
+			// or the lines are sent as they are
+			ov::String _compression = "";
 
 		public:
 			CFG_DECLARE_CONST_REF_GETTER_OF(IsEnabled, _enable)
 			CFG_DECLARE_CONST_REF_GETTER_OF(GetCollector, _collector)
+			CFG_DECLARE_CONST_REF_GETTER_OF(GetCompression, _compression)
 
 		protected:
 			void MakeList() override
 			{
 				Register<Optional>("Enable", &_enable);
 				Register<Optional>("Collector", &_collector);
+				Register<Optional>("Compression", &_compression);
 			}
 		};
 	}  // namespace an
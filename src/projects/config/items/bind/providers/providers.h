@@ -28,7 +28,8 @@ namespace cfg
 				// PUSH Providers (Server)
 				Provider<cmn::SingularPort> _rtmp{"1935/tcp"};
 				Provider<cmn::SingularPort> _rtsp{"554/tcp"};
-				ProviderWithOptions<cmn::SingularPort> _srt{"9999/srt"};
+				// Each port has its own libsrt listener (and receive thread), e.g. "9999-10002/srt"
+				ProviderWithOptions<cmn::RangedPort> _srt{"9999/srt"};
 				Provider<cmn::RangedPort> _mpegts{"4000/udp"};
 
 				cmm::Webrtc _webrtc{"3333/tcp", "3334/tcp"};
@@ -0,0 +1,50 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include "../../common/options.h"
+#include "./publisher.h"
+
+namespace cfg
+{
+	namespace bind
+	{
+		namespace pub
+		{
+			template <typename Tport>
+			struct PublisherWithOptions : public Publisher<Tport>
+			{
+			protected:
+				cmn::Options _options;
+
+			public:
+				using Item::IsParsed;
+
+				explicit PublisherWithOptions(const char *port)
+					: Publisher<Tport>(port)
+				{
+				}
+
+				PublisherWithOptions(const char *port, const char *tls_port)
+					: Publisher<Tport>(port, tls_port)
+				{
+				}
+
+				CFG_DECLARE_CONST_REF_GETTER_OF(GetOptions, _options);
+
+			protected:
+				void MakeList() override
+				{
+					Publisher<Tport>::MakeList();
+
+					Item::Register<Optional>("Options", &_options);
+				};
+			};
+		}  // namespace pub
+	}	   // namespace bind
+}  // namespace cfg
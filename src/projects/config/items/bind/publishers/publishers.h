@@ -9,6 +9,7 @@
 #pragma once
 
 #include "./publisher.h"
+#include "./publisher_with_options.h"
 #include "../common/webrtc/webrtc.h"
 
 namespace cfg
@@ -27,6 +28,9 @@ namespace cfg
 				Publisher<cmn::SingularPort> _dash{"80/tcp", "443/tcp"};
 				Publisher<cmn::SingularPort> _lldash{"80/tcp", "1443/tcp"};
 				Publisher<cmn::SingularPort> _thumbnail{"80/tcp", "443/tcp"};
+				// Serves the recorded files of the File publisher
+				Publisher<cmn::SingularPort> _file{"80/tcp", "443/tcp"};
+				PublisherWithOptions<cmn::SingularPort> _srt{"9998/srt"};
 
 				cmm::Webrtc _webrtc{"3333/tcp", "3334/tcp"};
 
@@ -39,6 +43,8 @@ namespace cfg
 				CFG_DECLARE_CONST_REF_GETTER_OF(GetLLDash, _lldash)
 				CFG_DECLARE_CONST_REF_GETTER_OF(GetWebrtc, _webrtc)
 				CFG_DECLARE_CONST_REF_GETTER_OF(GetThumbnail, _thumbnail)
+				CFG_DECLARE_CONST_REF_GETTER_OF(GetFile, _file)
+				CFG_DECLARE_CONST_REF_GETTER_OF(GetSrt, _srt)
 
 				bool IsLLDashTlsPortSeparated() const
 				{
@@ -88,6 +94,8 @@ namespace cfg
 					Register<Optional>({"LLDASH", "lldash"}, &_lldash);
 					Register<Optional>({"WebRTC", "webrtc"}, &_webrtc);
 					Register<Optional>({"Thumbnail", "thumbnail"}, &_thumbnail);
+					Register<Optional>({"File", "file"}, &_file);
+					Register<Optional>({"SRT", "srt"}, &_srt);
 				};
 			};
 		}  // namespace pub
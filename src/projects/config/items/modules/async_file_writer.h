@@ -0,0 +1,50 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include "module_template.h"
+
+namespace cfg
+{
+	namespace modules
+	{
+		// The recorded files are written by a dedicated I/O thread per file, so a slow disk doesn't block the publisher workers
+		struct AsyncFileWriter : public ModuleTemplate
+		{
+		protected:
+			// Maximum bytes that are muxed but not written to the disk yet
+			int64_t _max_queue_size = 64 * 1024 * 1024;
+			// The file is extended by this size using fallocate() (0: disabled)
+			int64_t _preallocation_size = 64 * 1024 * 1024;
+			// What to do when the queue is full
+			// - Drop: Drops the packets until the next key frame
+			// - Block: Waits for the I/O thread up to BlockTimeout, then drops
+			ov::String _backpressure = "Drop";
+			int _block_timeout = 1000;
+
+		public:
+			CFG_DECLARE_CONST_REF_GETTER_OF(GetMaxQueueSize, _max_queue_size)
+			CFG_DECLARE_CONST_REF_GETTER_OF(GetPreallocationSize, _preallocation_size)
+			CFG_DECLARE_CONST_REF_GETTER_OF(GetBackpressure, _backpressure)
+			CFG_DECLARE_CONST_REF_GETTER_OF(GetBlockTimeout, _block_timeout)
+
+		protected:
+			void MakeList() override
+			{
+				// Experimental feature is disabled by default
+				SetEnable(false);
+
+				ModuleTemplate::MakeList();
+				Register<Optional>("MaxQueueSize", &_max_queue_size);
+				Register<Optional>("PreallocationSize", &_preallocation_size);
+				Register<Optional>("Backpressure", &_backpressure);
+				Register<Optional>("BlockTimeout", &_block_timeout);
+			}
+		};
+	}  // namespace modules
+}  // namespace cfg
@@ -0,0 +1,39 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include "module_template.h"
+
+namespace cfg
+{
+	namespace modules
+	{
+		// DTLS handshakes are processed by dedicated worker threads instead of the thread that receives the packets
+		struct DtlsHandshakeWorker : public ModuleTemplate
+		{
+		protected:
+			int _worker_count = 2;
+			int _max_pending_handshakes = 1000;
+
+		public:
+			CFG_DECLARE_CONST_REF_GETTER_OF(GetWorkerCount, _worker_count)
+			CFG_DECLARE_CONST_REF_GETTER_OF(GetMaxPendingHandshakes, _max_pending_handshakes)
+
+		protected:
+			void MakeList() override
+			{
+				// Experimental feature is disabled by default
+				SetEnable(false);
+
+				ModuleTemplate::MakeList();
+				Register<Optional>("WorkerCount", &_worker_count);
+				Register<Optional>("MaxPendingHandshakes", &_max_pending_handshakes);
+			}
+		};
+	}  // namespace modules
+}  // namespace cfg
@@ -0,0 +1,40 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include "module_template.h"
+
+namespace cfg
+{
+	namespace modules
+	{
+		// MediaRouter keeps the last GOP of each output stream so that new publisher sessions can start with it
+		struct GopCache : public ModuleTemplate
+		{
+		protected:
+			// A GOP that exceeds one of the limits is not cached
+			int _max_duration = 10000;
+			int64_t _max_bytes = 16 * 1024 * 1024;
+
+		public:
+			CFG_DECLARE_CONST_REF_GETTER_OF(GetMaxDuration, _max_duration)
+			CFG_DECLARE_CONST_REF_GETTER_OF(GetMaxBytes, _max_bytes)
+
+		protected:
+			void MakeList() override
+			{
+				// Experimental feature is disabled by default
+				SetEnable(false);
+
+				ModuleTemplate::MakeList();
+				Register<Optional>("MaxDuration", &_max_duration);
+				Register<Optional>("MaxBytes", &_max_bytes);
+			}
+		};
+	}  // namespace modules
+}  // namespace cfg
@@ -0,0 +1,42 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include "module_template.h"
+
+namespace cfg
+{
+	namespace modules
+	{
+		// Keeps the last few seconds of the raw ingest of every input stream in memory (See mdl::IngestCapture),
+		// so it can be dumped via the API when something goes wrong
+		struct IngestCapture : public ModuleTemplate
+		{
+		protected:
+			// The records older than this (from the newest record) are dropped
+			int _duration = 10;
+			// Upper bound of the memory used by the capture of a stream
+			int64_t _max_bytes = 32 * 1024 * 1024;
+
+		public:
+			CFG_DECLARE_CONST_REF_GETTER_OF(GetDuration, _duration)
+			CFG_DECLARE_CONST_REF_GETTER_OF(GetMaxBytes, _max_bytes)
+
+		protected:
+			void MakeList() override
+			{
+				// Experimental feature is disabled by default
+				SetEnable(false);
+
+				ModuleTemplate::MakeList();
+				Register<Optional>("Duration", &_duration);
+				Register<Optional>("MaxBytes", &_max_bytes);
+			}
+		};
+	}  // namespace modules
+}  // namespace cfg
@@ -0,0 +1,29 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include "module_template.h"
+
+namespace cfg
+{
+	namespace modules
+	{
+		// Socket pool workers wait for TCP/UDP socket events using io_uring instead of epoll
+		struct IoUring : public ModuleTemplate
+		{
+		protected:
+			void MakeList() override
+			{
+				// Experimental feature is disabled by default
+				SetEnable(false);
+
+				ModuleTemplate::MakeList();
+			}
+		};
+	}  // namespace modules
+}  // namespace cfg
@@ -0,0 +1,52 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include "module_template.h"
+
+namespace cfg
+{
+	namespace modules
+	{
+		// The load of the server is computed periodically for the load balancers (GET /v1/load),
+		// and optionally reported to the OriginMapStores of the VirtualHosts
+		struct LoadReport : public ModuleTemplate
+		{
+		protected:
+			// Interval to compute the load (ms)
+			int _interval = 500;
+			// Egress bitrate (bps) at which the egress is fully loaded (0: not included in the score)
+			int64_t _max_egress = 0;
+			// Number of sessions at which the server is fully loaded (0: not included in the score)
+			int _max_sessions = 0;
+			// Name of the server in the OriginMapStores (empty: not reported)
+			ov::String _host_name;
+
+		public:
+			CFG_DECLARE_CONST_REF_GETTER_OF(GetInterval, _interval)
+			CFG_DECLARE_CONST_REF_GETTER_OF(GetMaxEgress, _max_egress)
+			CFG_DECLARE_CONST_REF_GETTER_OF(GetMaxSessions, _max_sessions)
+			CFG_DECLARE_CONST_REF_GETTER_OF(GetHostName, _host_name)
+
+		protected:
+			void MakeList() override
+			{
+				// Experimental feature is disabled by default
+				SetEnable(false);
+
+				ModuleTemplate::MakeList();
+				Register<Optional>("Interval", &_interval, nullptr, [=]() -> std::shared_ptr<ConfigError> {
+					return (_interval >= 100) ? nullptr : CreateConfigErrorPtr("Interval must be at least 100");
+				});
+				Register<Optional>("MaxEgress", &_max_egress);
+				Register<Optional>("MaxSessions", &_max_sessions);
+				Register<Optional>("HostName", &_host_name);
+			}
+		};
+	}  // namespace modules
+}  // namespace cfg
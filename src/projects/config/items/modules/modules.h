@@ -8,10 +8,34 @@
 //==============================================================================
 #pragma once
 
+#include "async_file_writer.h"
+#include "dtls_handshake_worker.h"
+#include "gop_cache.h"
 #include "http2.h"
+#include "ingest_capture.h"
+#include "io_uring.h"
+#include "ktls.h"
 #include "ll_hls.h"
+#include "load_report.h"
+#include "multi_output_rescaler.h"
+#include "numa_affinity.h"
 #include "p2p.h"
 #include "recovery.h"
+#include "reuse_port.h"
+#include "rtmp_ingest_worker.h"
+#include "segment_worker_autoscale.h"
+#include "send_buffer_limit.h"
+#include "parallel_startup.h"
+#include "session_scheduler.h"
+#include "shared_decoder.h"
+#include "srtp_crypto_worker.h"
+#include "stream_affinity.h"
+#include "stream_memory_limit.h"
+#include "transcode_admission.h"
+#include "transcode_degradation.h"
+#include "transcode_scheduler.h"
+#include "xdp.h"
+#include "zero_copy_gpu.h"
 
 namespace cfg
 {
@@ -20,24 +44,96 @@ namespace cfg
 		struct modules : public Item
 		{
 		protected:
+			AsyncFileWriter _async_file_writer;
+			DtlsHandshakeWorker _dtls_handshake_worker;
+			GopCache _gop_cache;
 			HTTP2 _http2;
+			IngestCapture _ingest_capture;
+			IoUring _io_uring;
+			KTls _ktls;
 			LLHls _ll_hls;
+			LoadReport _load_report;
+			MultiOutputRescaler _multi_output_rescaler;
+			NumaAffinity _numa_affinity;
 			P2P _p2p;
 			Recovery _recovery;
+			ReusePort _reuse_port;
+			RtmpIngestWorker _rtmp_ingest_worker;
+			SegmentWorkerAutoscale _segment_worker_autoscale;
+			SendBufferLimit _send_buffer_limit;
+			ParallelStartup _parallel_startup;
+			SessionScheduler _session_scheduler;
+			SharedDecoder _shared_decoder;
+			SrtpCryptoWorker _srtp_crypto_worker;
+			StreamAffinity _stream_affinity;
+			StreamMemoryLimit _stream_memory_limit;
+			TranscodeAdmission _transcode_admission;
+			TranscodeDegradation _transcode_degradation;
+			TranscodeScheduler _transcode_scheduler;
+			Xdp _xdp;
+			ZeroCopyGPU _zero_copy_gpu;
 
 		public:
+			CFG_DECLARE_CONST_REF_GETTER_OF(GetAsyncFileWriter, _async_file_writer)
+			CFG_DECLARE_CONST_REF_GETTER_OF(GetDtlsHandshakeWorker, _dtls_handshake_worker)
+			CFG_DECLARE_CONST_REF_GETTER_OF(GetGopCache, _gop_cache)
 			CFG_DECLARE_CONST_REF_GETTER_OF(GetHttp2, _http2)
+			CFG_DECLARE_CONST_REF_GETTER_OF(GetIngestCapture, _ingest_capture)
+			CFG_DECLARE_CONST_REF_GETTER_OF(GetIoUring, _io_uring)
+			CFG_DECLARE_CONST_REF_GETTER_OF(GetKTls, _ktls)
 			CFG_DECLARE_CONST_REF_GETTER_OF(GetLLHls, _ll_hls)
+			CFG_DECLARE_CONST_REF_GETTER_OF(GetLoadReport, _load_report)
+			CFG_DECLARE_CONST_REF_GETTER_OF(GetMultiOutputRescaler, _multi_output_rescaler)
+			CFG_DECLARE_CONST_REF_GETTER_OF(GetNumaAffinity, _numa_affinity)
 			CFG_DECLARE_CONST_REF_GETTER_OF(GetP2P, _p2p)
 			CFG_DECLARE_CONST_REF_GETTER_OF(GetRecovery, _recovery)
+			CFG_DECLARE_CONST_REF_GETTER_OF(GetReusePort, _reuse_port)
+			CFG_DECLARE_CONST_REF_GETTER_OF(GetRtmpIngestWorker, _rtmp_ingest_worker)
+			CFG_DECLARE_CONST_REF_GETTER_OF(GetSegmentWorkerAutoscale, _segment_worker_autoscale)
+			CFG_DECLARE_CONST_REF_GETTER_OF(GetSendBufferLimit, _send_buffer_limit)
+			CFG_DECLARE_CONST_REF_GETTER_OF(GetParallelStartup, _parallel_startup)
+			CFG_DECLARE_CONST_REF_GETTER_OF(GetSessionScheduler, _session_scheduler)
+			CFG_DECLARE_CONST_REF_GETTER_OF(GetSharedDecoder, _shared_decoder)
+			CFG_DECLARE_CONST_REF_GETTER_OF(GetSrtpCryptoWorker, _srtp_crypto_worker)
+			CFG_DECLARE_CONST_REF_GETTER_OF(GetStreamAffinity, _stream_affinity)
+			CFG_DECLARE_CONST_REF_GETTER_OF(GetStreamMemoryLimit, _stream_memory_limit)
+			CFG_DECLARE_CONST_REF_GETTER_OF(GetTranscodeAdmission, _transcode_admission)
+			CFG_DECLARE_CONST_REF_GETTER_OF(GetTranscodeDegradation, _transcode_degradation)
+			CFG_DECLARE_CONST_REF_GETTER_OF(GetTranscodeScheduler, _transcode_scheduler)
+			CFG_DECLARE_CONST_REF_GETTER_OF(GetXdp, _xdp)
+			CFG_DECLARE_CONST_REF_GETTER_OF(GetZeroCopyGPU, _zero_copy_gpu)
 
 		protected:
 			void MakeList() override
 			{
+				Register<Optional>("AsyncFileWriter", &_async_file_writer);
+				Register<Optional>("DtlsHandshakeWorker", &_dtls_handshake_worker);
+				Register<Optional>("GopCache", &_gop_cache);
 				Register<Optional>("HTTP2", &_http2);
+				Register<Optional>("IngestCapture", &_ingest_capture);
+				Register<Optional>("IoUring", &_io_uring);
+				Register<Optional>("KTLS", &_ktls);
 				Register<Optional>("LLHLS", &_ll_hls);
+				Register<Optional>("LoadReport", &_load_report);
+				Register<Optional>("MultiOutputRescaler", &_multi_output_rescaler);
+				Register<Optional>("NumaAffinity", &_numa_affinity);
 				Register<Optional>({"P2P", "p2p"}, &_p2p);
 				Register<Optional>("Recovery", &_recovery);
+				Register<Optional>("ReusePort", &_reuse_port);
+				Register<Optional>("RtmpIngestWorker", &_rtmp_ingest_worker);
+				Register<Optional>("SegmentWorkerAutoscale", &_segment_worker_autoscale);
+				Register<Optional>("SendBufferLimit", &_send_buffer_limit);
+				Register<Optional>("ParallelStartup", &_parallel_startup);
+				Register<Optional>("SessionScheduler", &_session_scheduler);
+				Register<Optional>("SharedDecoder", &_shared_decoder);
+				Register<Optional>("SrtpCryptoWorker", &_srtp_crypto_worker);
+				Register<Optional>("StreamAffinity", &_stream_affinity);
+				Register<Optional>("StreamMemoryLimit", &_stream_memory_limit);
+				Register<Optional>("TranscodeAdmission", &_transcode_admission);
+				Register<Optional>("TranscodeDegradation", &_transcode_degradation);
+				Register<Optional>("TranscodeScheduler", &_transcode_scheduler);
+				Register<Optional>("XDP", &_xdp);
+				Register<Optional>("ZeroCopyGPU", &_zero_copy_gpu);
 			}
 		};
 	}  // namespace modules
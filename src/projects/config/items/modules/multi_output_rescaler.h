@@ -0,0 +1,29 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include "module_template.h"
+
+namespace cfg
+{
+	namespace modules
+	{
+		// The video outputs of an input track scaled by software are scaled in a filter graph (cascade scaling)
+		struct MultiOutputRescaler : public ModuleTemplate
+		{
+		protected:
+			void MakeList() override
+			{
+				// Experimental feature is disabled by default
+				SetEnable(false);
+
+				ModuleTemplate::MakeList();
+			}
+		};
+	}  // namespace modules
+}  // namespace cfg
@@ -0,0 +1,38 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include "module_template.h"
+
+namespace cfg
+{
+	namespace modules
+	{
+		// Pins the threads to the CPUs of the NUMA nodes, so the threads handling a stream
+		// (mediarouter, application, stream and codec workers) and the buffers they allocate stay on the same node
+		struct NumaAffinity : public ModuleTemplate
+		{
+		protected:
+			// Node of the socket pool workers (usually the node of the NIC). -1: the workers are distributed over the nodes
+			int _socket_pool_worker_node = -1;
+
+		public:
+			CFG_DECLARE_CONST_REF_GETTER_OF(GetSocketPoolWorkerNode, _socket_pool_worker_node)
+
+		protected:
+			void MakeList() override
+			{
+				// Experimental feature is disabled by default
+				SetEnable(false);
+
+				ModuleTemplate::MakeList();
+				Register<Optional>("SocketPoolWorkerNode", &_socket_pool_worker_node);
+			}
+		};
+	}  // namespace modules
+}  // namespace cfg
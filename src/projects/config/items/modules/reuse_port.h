@@ -0,0 +1,37 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include "module_template.h"
+
+namespace cfg
+{
+	namespace modules
+	{
+		// Each socket pool worker of a TCP port owns its own SO_REUSEPORT listening socket
+		struct ReusePort : public ModuleTemplate
+		{
+		protected:
+			// Steer new connections to the listener of the CPU that received them
+			bool _cpu_steering = false;
+
+		public:
+			CFG_DECLARE_CONST_REF_GETTER_OF(IsCpuSteeringEnabled, _cpu_steering)
+
+		protected:
+			void MakeList() override
+			{
+				// Experimental feature is disabled by default
+				SetEnable(false);
+
+				ModuleTemplate::MakeList();
+				Register<Optional>("CPUSteering", &_cpu_steering);
+			}
+		};
+	}  // namespace modules
+}  // namespace cfg
@@ -0,0 +1,41 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include "module_template.h"
+
+namespace cfg
+{
+	namespace modules
+	{
+		// The data received by the RTMP provider is parsed by dedicated worker threads instead of the socket worker
+		struct RtmpIngestWorker : public ModuleTemplate
+		{
+		protected:
+			int _worker_count = 4;
+			// If the data waiting for the worker exceeds this size, the connection stops reading from the socket
+			// until half of it is processed
+			int _max_buffer_size = 4 * 1024 * 1024;
+
+		public:
+			CFG_DECLARE_CONST_REF_GETTER_OF(GetWorkerCount, _worker_count)
+			CFG_DECLARE_CONST_REF_GETTER_OF(GetMaxBufferSize, _max_buffer_size)
+
+		protected:
+			void MakeList() override
+			{
+				// Experimental feature is disabled by default
+				SetEnable(false);
+
+				ModuleTemplate::MakeList();
+				Register<Optional>("WorkerCount", &_worker_count);
+				Register<Optional>("MaxBufferSize", &_max_buffer_size);
+			}
+		};
+	}  // namespace modules
+}  // namespace cfg
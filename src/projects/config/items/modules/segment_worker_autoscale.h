@@ -0,0 +1,46 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include "module_template.h"
+
+namespace cfg
+{
+	namespace modules
+	{
+		// The segment workers of the HLS/DASH publishers are added when they are busy, and removed when they are idle
+		// (the WorkerCount of the publisher is the minimum number of the workers)
+		struct SegmentWorkerAutoscale : public ModuleTemplate
+		{
+		protected:
+			// 0: Number of CPU cores
+			int _max_worker_count = 0;
+			// A worker is added when all workers have this number of requests queued
+			int _scale_up_queue_depth = 4;
+			// A worker that has processed nothing for this time is removed
+			int _idle_timeout = 30000;
+
+		public:
+			CFG_DECLARE_CONST_REF_GETTER_OF(GetMaxWorkerCount, _max_worker_count)
+			CFG_DECLARE_CONST_REF_GETTER_OF(GetScaleUpQueueDepth, _scale_up_queue_depth)
+			CFG_DECLARE_CONST_REF_GETTER_OF(GetIdleTimeout, _idle_timeout)
+
+		protected:
+			void MakeList() override
+			{
+				// Experimental feature is disabled by default
+				SetEnable(false);
+
+				ModuleTemplate::MakeList();
+				Register<Optional>("MaxWorkerCount", &_max_worker_count);
+				Register<Optional>("ScaleUpQueueDepth", &_scale_up_queue_depth);
+				Register<Optional>("IdleTimeout", &_idle_timeout);
+			}
+		};
+	}  // namespace modules
+}  // namespace cfg
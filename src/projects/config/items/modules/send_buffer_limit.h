@@ -0,0 +1,41 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include "module_template.h"
+
+namespace cfg
+{
+	namespace modules
+	{
+		// Limits the data waiting to be sent to the slow clients.
+		// A connection that exceeds the limit is closed, except OVT, which skips to the next keyframe.
+		struct SendBufferLimit : public ModuleTemplate
+		{
+		protected:
+			int64_t _max_bytes_per_connection = 64 * 1024 * 1024;
+			// The limit per connection is tightened when the data of all connections is close to this (0: unlimited)
+			int64_t _max_total_bytes = 1024 * 1024 * 1024;
+
+		public:
+			CFG_DECLARE_CONST_REF_GETTER_OF(GetMaxBytesPerConnection, _max_bytes_per_connection)
+			CFG_DECLARE_CONST_REF_GETTER_OF(GetMaxTotalBytes, _max_total_bytes)
+
+		protected:
+			void MakeList() override
+			{
+				// Experimental feature is disabled by default
+				SetEnable(false);
+
+				ModuleTemplate::MakeList();
+				Register<Optional>("MaxBytesPerConnection", &_max_bytes_per_connection);
+				Register<Optional>("MaxTotalBytes", &_max_total_bytes);
+			}
+		};
+	}  // namespace modules
+}  // namespace cfg
@@ -0,0 +1,36 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include "module_template.h"
+
+namespace cfg
+{
+	namespace modules
+	{
+		// Outgoing SRTP packets are protected by dedicated worker threads instead of StreamWorker
+		struct SrtpCryptoWorker : public ModuleTemplate
+		{
+		protected:
+			int _worker_count = 4;
+
+		public:
+			CFG_DECLARE_CONST_REF_GETTER_OF(GetWorkerCount, _worker_count)
+
+		protected:
+			void MakeList() override
+			{
+				// Experimental feature is disabled by default
+				SetEnable(false);
+
+				ModuleTemplate::MakeList();
+				Register<Optional>("WorkerCount", &_worker_count);
+			}
+		};
+	}  // namespace modules
+}  // namespace cfg
@@ -0,0 +1,41 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include "module_template.h"
+
+namespace cfg
+{
+	namespace modules
+	{
+		// Limits the memory used by the buffers of an input stream and its output streams (See mon::MemoryMetrics)
+		struct StreamMemoryLimit : public ModuleTemplate
+		{
+		protected:
+			// Over the soft limit, the GOP cache is released and fewer LLHLS segments are kept in memory
+			int64_t _soft_limit = 256 * 1024 * 1024;
+			// Over the hard limit, the stream is terminated
+			int64_t _hard_limit = 512 * 1024 * 1024;
+
+		public:
+			CFG_DECLARE_CONST_REF_GETTER_OF(GetSoftLimit, _soft_limit)
+			CFG_DECLARE_CONST_REF_GETTER_OF(GetHardLimit, _hard_limit)
+
+		protected:
+			void MakeList() override
+			{
+				// Experimental feature is disabled by default
+				SetEnable(false);
+
+				ModuleTemplate::MakeList();
+				Register<Optional>("SoftLimit", &_soft_limit);
+				Register<Optional>("HardLimit", &_hard_limit);
+			}
+		};
+	}  // namespace modules
+}  // namespace cfg
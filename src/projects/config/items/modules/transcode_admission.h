@@ -0,0 +1,46 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include "module_template.h"
+
+namespace cfg
+{
+	namespace modules
+	{
+		// Rejects a new stream if the encoders of its output profiles do not fit in the remaining encoding capacity,
+		// so the running streams are not degraded by it
+		struct TranscodeAdmission : public ModuleTemplate
+		{
+		protected:
+			// Ratio of the CPU cores of the host that the software encoders may reserve (%)
+			int _max_cpu_usage = 80;
+			// Ratio of the encoding time of each GPU that the hardware encoders may reserve (%)
+			int _max_gpu_usage = 90;
+
+		public:
+			CFG_DECLARE_CONST_REF_GETTER_OF(GetMaxCpuUsage, _max_cpu_usage)
+			CFG_DECLARE_CONST_REF_GETTER_OF(GetMaxGpuUsage, _max_gpu_usage)
+
+		protected:
+			void MakeList() override
+			{
+				// Experimental feature is disabled by default
+				SetEnable(false);
+
+				ModuleTemplate::MakeList();
+				Register<Optional>("MaxCpuUsage", &_max_cpu_usage, nullptr, [=]() -> std::shared_ptr<ConfigError> {
+					return (_max_cpu_usage > 0 && _max_cpu_usage <= 100) ? nullptr : CreateConfigErrorPtr("MaxCpuUsage must be between 1 and 100");
+				});
+				Register<Optional>("MaxGpuUsage", &_max_gpu_usage, nullptr, [=]() -> std::shared_ptr<ConfigError> {
+					return (_max_gpu_usage > 0 && _max_gpu_usage <= 100) ? nullptr : CreateConfigErrorPtr("MaxGpuUsage must be between 1 and 100");
+				});
+			}
+		};
+	}  // namespace modules
+}  // namespace cfg
@@ -0,0 +1,45 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include "module_template.h"
+
+namespace cfg
+{
+	namespace modules
+	{
+		// Degrades the low-priority renditions (lower bitrate) when the transcoder is overloaded, to keep the main rendition real-time
+		struct TranscodeDegradation : public ModuleTemplate
+		{
+		protected:
+			// CPU usage of the host (%) that is regarded as overloaded
+			int _cpu_threshold = 90;
+			// Average waiting time of the frames in an encoder queue (ms) that is regarded as overloaded
+			int _queue_waiting_time_threshold = 500;
+			// Interval to degrade/restore a rendition (ms)
+			int _check_interval = 2000;
+
+		public:
+			CFG_DECLARE_CONST_REF_GETTER_OF(GetCpuThreshold, _cpu_threshold)
+			CFG_DECLARE_CONST_REF_GETTER_OF(GetQueueWaitingTimeThreshold, _queue_waiting_time_threshold)
+			CFG_DECLARE_CONST_REF_GETTER_OF(GetCheckInterval, _check_interval)
+
+		protected:
+			void MakeList() override
+			{
+				// Experimental feature is disabled by default
+				SetEnable(false);
+
+				ModuleTemplate::MakeList();
+				Register<Optional>("CpuThreshold", &_cpu_threshold);
+				Register<Optional>("QueueWaitingTimeThreshold", &_queue_waiting_time_threshold);
+				Register<Optional>("CheckInterval", &_check_interval);
+			}
+		};
+	}  // namespace modules
+}  // namespace cfg
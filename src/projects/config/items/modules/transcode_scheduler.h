@@ -0,0 +1,37 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include "module_template.h"
+
+namespace cfg
+{
+	namespace modules
+	{
+		// Decoders, filters and encoders of all streams run on a bounded NUMA-aware thread pool instead of their own threads
+		struct TranscodeScheduler : public ModuleTemplate
+		{
+		protected:
+			// 0: Number of CPU cores
+			int _worker_count = 0;
+
+		public:
+			CFG_DECLARE_CONST_REF_GETTER_OF(GetWorkerCount, _worker_count)
+
+		protected:
+			void MakeList() override
+			{
+				// Experimental feature is disabled by default
+				SetEnable(false);
+
+				ModuleTemplate::MakeList();
+				Register<Optional>("WorkerCount", &_worker_count);
+			}
+		};
+	}  // namespace modules
+}  // namespace cfg
@@ -0,0 +1,49 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include "module_template.h"
+
+namespace cfg
+{
+	namespace modules
+	{
+		// The UDP socket pool workers send the IPv4 datagrams through AF_XDP sockets bound to the TX queues of a NIC,
+		// bypassing the UDP/IP stack of the kernel (egress only, the datagrams are received by the normal sockets)
+		struct Xdp : public ModuleTemplate
+		{
+		protected:
+			ov::String _interface;
+			// Number of the TX queues to use (one per UDP socket pool worker)
+			int _queue_count = 1;
+			// Number of the UMEM frames per queue
+			int _frame_count = 4096;
+			// Requires the driver support of AF_XDP zero-copy
+			bool _zero_copy = false;
+
+		public:
+			CFG_DECLARE_CONST_REF_GETTER_OF(GetInterface, _interface)
+			CFG_DECLARE_CONST_REF_GETTER_OF(GetQueueCount, _queue_count)
+			CFG_DECLARE_CONST_REF_GETTER_OF(GetFrameCount, _frame_count)
+			CFG_DECLARE_CONST_REF_GETTER_OF(IsZeroCopy, _zero_copy)
+
+		protected:
+			void MakeList() override
+			{
+				// Experimental feature is disabled by default
+				SetEnable(false);
+
+				ModuleTemplate::MakeList();
+				Register<Optional>("Interface", &_interface);
+				Register<Optional>("QueueCount", &_queue_count);
+				Register<Optional>("FrameCount", &_frame_count);
+				Register<Optional>("ZeroCopy", &_zero_copy);
+			}
+		};
+	}  // namespace modules
+}  // namespace cfg
@@ -20,14 +20,31 @@ namespace cfg
 				{
 				public:
 					CFG_DECLARE_CONST_REF_GETTER_OF(IsHardwareAcceleration, _hw_acceleration);
+					CFG_DECLARE_CONST_REF_GETTER_OF(GetThreadCount, _thread_count);
+					CFG_DECLARE_CONST_REF_GETTER_OF(GetThreadType, _thread_type);
 
 				protected:
 					void MakeList() override
 					{
 						Register("HardwareAcceleration", &_hw_acceleration);
+						Register<Optional>("ThreadCount", &_thread_count, nullptr, [=]() -> std::shared_ptr<ConfigError> {
+							return (_thread_count >= 0) ? nullptr : CreateConfigErrorPtr("ThreadCount must be greater than or equal to 0");
+						});
+						Register<Optional>("ThreadType", &_thread_type, nullptr, [=]() -> std::shared_ptr<ConfigError> {
+							auto thread_type = _thread_type.LowerCaseString();
+							if (thread_type == "auto" || thread_type == "frame" || thread_type == "slice")
+							{
+								return nullptr;
+							}
+							return CreateConfigErrorPtr("ThreadType must be auto, frame or slice");
+						});
 					}
 
 					bool _hw_acceleration = false;
+					// Number of threads of the software decoders (0: decided by the decoder)
+					int _thread_count = 0;
+					// auto: frame and slice threading, frame: lower per-frame cost but more latency, slice: lower latency
+					ov::String _thread_type = "auto";
 				};
 			}  // namespace dec
 		}	   // namespace app
@@ -27,6 +27,8 @@ namespace cfg
 					int _width = 0;
 					int _height = 0;
 					double _framerate = 0.0;
+					// Decodes only the key frames instead of all frames of the input
+					bool _key_frame_only = false;
 					BypassIfMatch _bypass_if_match;
 
 				public:
@@ -36,6 +38,7 @@ namespace cfg
 					CFG_DECLARE_CONST_REF_GETTER_OF(GetWidth, _width)
 					CFG_DECLARE_CONST_REF_GETTER_OF(GetHeight, _height)
 					CFG_DECLARE_CONST_REF_GETTER_OF(GetFramerate, _framerate)
+					CFG_DECLARE_CONST_REF_GETTER_OF(IsKeyFrameOnly, _key_frame_only)
 					CFG_DECLARE_CONST_REF_GETTER_OF(GetBypassIfMatch, _bypass_if_match)
 
 					void SetName(const ov::String &name){_name = name;}
@@ -49,6 +52,7 @@ namespace cfg
 						Register<Optional>("Width", &_width);
 						Register<Optional>("Height", &_height);
 						Register<Optional>("Framerate", &_framerate);
+						Register<Optional>("KeyFrameOnly", &_key_frame_only);
 						Register<Optional>("BypassIfMatch", &_bypass_if_match);
 					}
 				};
@@ -33,7 +33,10 @@ namespace cfg
 					ov::String _preset;
 					int _thread_count = -1;
 					int _key_frame_interval = 0;
+					bool _key_frame_alignment = false;
 					int _b_frames = 0;
+					bool _low_latency = false;
+					int _temporal_layers = 1;
 					BypassIfMatch _bypass_if_match;
 					ov::String _profile;
 
@@ -50,7 +53,10 @@ namespace cfg
 					CFG_DECLARE_CONST_REF_GETTER_OF(GetPreset, _preset)
 					CFG_DECLARE_CONST_REF_GETTER_OF(GetThreadCount, _thread_count)
 					CFG_DECLARE_CONST_REF_GETTER_OF(GetKeyFrameInterval, _key_frame_interval)
+					CFG_DECLARE_CONST_REF_GETTER_OF(IsKeyFrameAlignment, _key_frame_alignment)
 					CFG_DECLARE_CONST_REF_GETTER_OF(GetBFrames, _b_frames)
+					CFG_DECLARE_CONST_REF_GETTER_OF(IsLowLatency, _low_latency)
+					CFG_DECLARE_CONST_REF_GETTER_OF(GetTemporalLayers, _temporal_layers)
 					CFG_DECLARE_CONST_REF_GETTER_OF(GetBypassIfMatch, _bypass_if_match)
 					CFG_DECLARE_CONST_REF_GETTER_OF(GetProfile, _profile)
 
@@ -66,7 +72,10 @@ namespace cfg
 					void SetPreset(const ov::String &preset){_preset = preset;}
 					void SetThreadCount(int thread_count){_thread_count = thread_count;}
 					void SetKeyFrameInterval(int key_frame_interval){_key_frame_interval = key_frame_interval;}
+					void SetKeyFrameAlignment(bool key_frame_alignment){_key_frame_alignment = key_frame_alignment;}
 					void SetBFrames(int b_frames){_b_frames = b_frames;}
+					void SetLowLatency(bool low_latency){_low_latency = low_latency;}
+					void SetTemporalLayers(int temporal_layers){_temporal_layers = temporal_layers;}
 
 				protected:
 					void MakeList() override
@@ -115,9 +124,18 @@ namespace cfg
 						Register<Optional>("KeyFrameInterval", &_key_frame_interval, nullptr, [=]() -> std::shared_ptr<ConfigError> {
 								return (_key_frame_interval >= 0 && _key_frame_interval <= 600) ? nullptr : CreateConfigErrorPtr("KeyFrameInterval must be between 0 and 600");
 							});
+						// The keyframes are forced every <KeyFrameInterval> frames of <Framerate> on the timeline of the input stream,
+						// so the renditions with the same interval in seconds have the keyframes (and the LLHLS segments) at the same timestamps
+						Register<Optional>("KeyFrameAlignment", &_key_frame_alignment);
 						Register<Optional>("BFrames", &_b_frames, nullptr, [=]() -> std::shared_ptr<ConfigError> {
 								return (_b_frames >= 0 && _b_frames <= 16) ? nullptr : CreateConfigErrorPtr("BFrames must be between 0 and 16");
 							});
+						Register<Optional>("LowLatency", &_low_latency, nullptr, [=]() -> std::shared_ptr<ConfigError> {
+								return (_low_latency && (_b_frames > 0)) ? CreateConfigErrorPtr("BFrames must be 0 when LowLatency is true") : nullptr;
+							});
+						Register<Optional>("TemporalLayers", &_temporal_layers, nullptr, [=]() -> std::shared_ptr<ConfigError> {
+								return (_temporal_layers >= 1 && _temporal_layers <= 3) ? nullptr : CreateConfigErrorPtr("TemporalLayers must be between 1 and 3");
+							});
 						Register<Optional>("BypassIfMatch", &_bypass_if_match);
 						Register<Optional>("Profile", &_profile, nullptr, [=]() -> std::shared_ptr<ConfigError> {
 							auto profile = _profile.LowerCaseString();
@@ -0,0 +1,38 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+namespace cfg
+{
+	namespace vhost
+	{
+		namespace app
+		{
+			namespace pvd
+			{
+				namespace file
+				{
+					struct Schedule : public Item
+					{
+					protected:
+						std::vector<ov::String> _path_list;
+
+					public:
+						CFG_DECLARE_CONST_REF_GETTER_OF(GetPathList, _path_list)
+
+					protected:
+						void MakeList() override
+						{
+							Register<Optional>("Path", &_path_list);
+						}
+					};
+				}  // namespace file
+			}	   // namespace pvd
+		}		   // namespace app
+	}			   // namespace vhost
+}  // namespace cfg
@@ -8,6 +8,8 @@
 //==============================================================================
 #pragma once
 
+#include "schedule.h"
+
 namespace cfg
 {
 	namespace vhost
@@ -23,16 +25,20 @@ namespace cfg
 					protected:
 						ov::String _name;
 						ov::String _path;
+						// The files played after <Path> without recreating the stream
+						Schedule _schedule;
 
 					public:
 						CFG_DECLARE_CONST_REF_GETTER_OF(GetName, _name)
 						CFG_DECLARE_CONST_REF_GETTER_OF(GetPath, _path)
+						CFG_DECLARE_CONST_REF_GETTER_OF(GetSchedule, _schedule)
 
 					protected:
 						void MakeList() override
 						{
 							Register("Name", &_name);
 							Register("Path", &_path);
+							Register<Optional>("Schedule", &_schedule);
 						}
 					};
 				}  // namespace file
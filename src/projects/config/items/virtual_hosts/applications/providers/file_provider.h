@@ -29,6 +29,7 @@ namespace cfg
 					CFG_DECLARE_CONST_REF_GETTER_OF(GetRootPath, _root_path)
 					CFG_DECLARE_CONST_REF_GETTER_OF(GetStreamMap, _stream_map)
 					CFG_DECLARE_CONST_REF_GETTER_OF(IsPassthroughOutputProfile, _is_passthrough_output_profile)
+					CFG_DECLARE_CONST_REF_GETTER_OF(IsNativeMp4ReaderEnabled, _is_native_mp4_reader_enabled)
 
 				protected:
 					void MakeList() override
@@ -38,11 +39,14 @@ namespace cfg
 						Register<Optional>("RootPath", &_root_path);
 						Register<Optional>("StreamMap", &_stream_map);
 						Register<Optional>("PassthroughOutputProfile", &_is_passthrough_output_profile);
+						Register<Optional>("NativeMp4Reader", &_is_native_mp4_reader_enabled);
 					}
 
 					ov::String _root_path = "";
 					file::StreamMap _stream_map;
 					bool _is_passthrough_output_profile = false;
+					// Reads the MP4 files (H.264/AAC) with the cached sample table instead of libavformat
+					bool _is_native_mp4_reader_enabled = false;
 				};
 			}  // namespace pvd
 		}	   // namespace app
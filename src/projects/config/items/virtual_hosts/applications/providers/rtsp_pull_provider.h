@@ -26,6 +26,8 @@ namespace cfg
 					}
 
 					CFG_DECLARE_CONST_REF_GETTER_OF(IsBlockDuplicateStreamName, _is_block_duplicate_stream_name)
+					CFG_DECLARE_CONST_REF_GETTER_OF(IsKeyFrameOnly, _is_key_frame_only)
+					CFG_DECLARE_CONST_REF_GETTER_OF(IsPredictiveLipSync, _predictive_lip_sync)
 
 				protected:
 					void MakeList() override
@@ -33,11 +35,21 @@ namespace cfg
 						Provider::MakeList();
 
 						Register<Optional>("BlockDuplicateStreamName", &_is_block_duplicate_stream_name);
+						Register<Optional>("KeyFrameOnly", &_is_key_frame_only);
+						Register<Optional>("PredictiveLipSync", &_predictive_lip_sync);
 					}
 
 					// true: block(disconnect) new incoming stream
 					// false: don't block new incoming stream
 					bool _is_block_duplicate_stream_name = true;
+
+					// true: forward only H.264 key frames (for applications that only make thumbnails)
+					// false: forward every frame
+					bool _is_key_frame_only = false;
+
+					// true: the packets are forwarded before the RTCP SR arrives (the PTS is estimated from the arrival time)
+					// false: wait for the RTCP SR (up to 5 seconds)
+					bool _predictive_lip_sync = false;
 				};
 			}  // namespace pvd
 		}	   // namespace app
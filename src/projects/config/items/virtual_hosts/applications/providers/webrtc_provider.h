@@ -27,6 +27,7 @@ namespace cfg
 					}
 
 					CFG_DECLARE_CONST_REF_GETTER_OF(GetTimeout, _timeout)
+					CFG_DECLARE_CONST_REF_GETTER_OF(IsPredictiveLipSync, _predictive_lip_sync)
 
 				protected:
 					void MakeList() override
@@ -35,9 +36,13 @@ namespace cfg
 
 						Register<Optional>("Timeout", &_timeout);
 						Register<Optional>("CrossDomains", &_cross_domains);
+						Register<Optional>("PredictiveLipSync", &_predictive_lip_sync);
 					}
 
 					int _timeout = 30000;
+					// true: the packets are forwarded before the RTCP SR arrives (the PTS is estimated from the arrival time)
+					// false: the packets are dropped until the RTCP SR arrives
+					bool _predictive_lip_sync = false;
 				};
 			}  // namespace pvd
 		}	   // namespace app
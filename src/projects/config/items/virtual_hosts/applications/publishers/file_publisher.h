@@ -8,6 +8,7 @@
 //==============================================================================
 #pragma once
 
+#include "../../../common/cross_domain_support.h"
 #include "publisher.h"
 
 namespace cfg
@@ -18,7 +19,7 @@ namespace cfg
 		{
 			namespace pub
 			{
-				struct FilePublisher : public Publisher
+				struct FilePublisher : public Publisher, public cmn::CrossDomainSupport
 				{
 					PublisherType GetType() const override
 					{
@@ -28,6 +29,7 @@ namespace cfg
 					CFG_DECLARE_CONST_REF_GETTER_OF(GetFilePath, _file_path)
 					CFG_DECLARE_CONST_REF_GETTER_OF(GetInfoPath, _info_path)
 					CFG_DECLARE_CONST_REF_GETTER_OF(GetRootPath, _root_path)
+					CFG_DECLARE_CONST_REF_GETTER_OF(IsFragmentedMp4, _fragmented_mp4)
 
 				protected:
 					void MakeList() override
@@ -37,6 +39,9 @@ namespace cfg
 						Register<Optional>("RootPath", &_root_path);
 						Register<Optional>("FilePath", &_file_path);
 						Register<Optional>("InfoPath", &_info_path);
+						Register<Optional>("FragmentedMP4", &_fragmented_mp4);
+						// Used when the recorded files are served by the File publisher port of <Bind>
+						Register<Optional>("CrossDomains", &_cross_domains);
 
 						//@deprecated
 						Register<Optional>("FileInfoPath", &_info_path);
@@ -45,6 +50,8 @@ namespace cfg
 					ov::String _root_path = "";
 					ov::String _file_path = "";
 					ov::String _info_path = "";
+					// Records the mp4 files as fragmented MP4 without libavformat
+					bool _fragmented_mp4 = false;
 				};
 			}  // namespace pub
 		}	   // namespace app
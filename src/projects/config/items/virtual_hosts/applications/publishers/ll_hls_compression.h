@@ -0,0 +1,50 @@
+//=============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+namespace cfg
+{
+	namespace vhost
+	{
+		namespace app
+		{
+			namespace pub
+			{
+				// Compression of the playlists (llhls.m3u8, chunklists)
+				// The compressed playlists are cached for each version, so the levels trade the CPU for the egress
+				struct LLHlsCompression : public Item
+				{
+				protected:
+					// Brotli is used instead of gzip for the players which accept it (Accept-Encoding: br)
+					bool _brotli = true;
+					// 1 (fastest) ~ 9 (smallest)
+					int _gzip_level = 6;
+					// 0 (fastest) ~ 11 (smallest)
+					int _brotli_quality = 5;
+
+				public:
+					CFG_DECLARE_CONST_REF_GETTER_OF(IsBrotliEnabled, _brotli)
+					CFG_DECLARE_CONST_REF_GETTER_OF(GetGzipLevel, _gzip_level)
+					CFG_DECLARE_CONST_REF_GETTER_OF(GetBrotliQuality, _brotli_quality)
+
+				protected:
+					void MakeList() override
+					{
+						Register<Optional>("Brotli", &_brotli);
+						Register<Optional>("GzipLevel", &_gzip_level, nullptr, [=]() -> std::shared_ptr<ConfigError> {
+							return ((_gzip_level >= 1) && (_gzip_level <= 9)) ? nullptr : CreateConfigErrorPtr("GzipLevel must be between 1 and 9");
+						});
+						Register<Optional>("BrotliQuality", &_brotli_quality, nullptr, [=]() -> std::shared_ptr<ConfigError> {
+							return ((_brotli_quality >= 0) && (_brotli_quality <= 11)) ? nullptr : CreateConfigErrorPtr("BrotliQuality must be between 0 and 11");
+						});
+					}
+				};
+			}  // namespace pub
+		} // namespace app
+	} // namespace vhost
+}  // namespace cfg
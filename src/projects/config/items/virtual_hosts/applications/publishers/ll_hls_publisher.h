@@ -11,6 +11,7 @@
 #include "../../../common/cross_domain_support.h"
 #include "dumps/dumps.h"
 #include "ll_hls_cache_control.h"
+#include "ll_hls_compression.h"
 #include "ll_hls_dvr.h"
 #include "publisher.h"
 
@@ -31,8 +32,13 @@ namespace cfg
 					double _chunk_duration = 0.5;
 					double _part_hold_back = 0; // it will be set to 3 * chunk_duration automatically
 					int _segment_duration = 6;
+					bool _segment_alignment = false;
+					bool _dash_manifest = false;
+					bool _on_demand_packaging = false;
+					int _on_demand_idle_timeout = 30;
 					Dumps _dumps;
 					LLHlsCacheControl _cache_control;
+					LLHlsCompression _compression;
 					LLHlsDvr _dvr;
 
 				public:
@@ -46,8 +52,13 @@ namespace cfg
 					CFG_DECLARE_CONST_REF_GETTER_OF(GetChunkDuration, _chunk_duration)
 					CFG_DECLARE_CONST_REF_GETTER_OF(GetPartHoldBack, _part_hold_back)
 					CFG_DECLARE_CONST_REF_GETTER_OF(GetSegmentCount, _segment_count)
+					CFG_DECLARE_CONST_REF_GETTER_OF(IsSegmentAlignmentEnabled, _segment_alignment)
+					CFG_DECLARE_CONST_REF_GETTER_OF(IsDashManifestEnabled, _dash_manifest)
+					CFG_DECLARE_CONST_REF_GETTER_OF(IsOnDemandPackagingEnabled, _on_demand_packaging)
+					CFG_DECLARE_CONST_REF_GETTER_OF(GetOnDemandIdleTimeout, _on_demand_idle_timeout)
 					CFG_DECLARE_CONST_REF_GETTER_OF(GetDumps, _dumps)
 					CFG_DECLARE_CONST_REF_GETTER_OF(GetCacheControl, _cache_control)
+					CFG_DECLARE_CONST_REF_GETTER_OF(GetCompression, _compression)
 					CFG_DECLARE_CONST_REF_GETTER_OF(GetDvr, _dvr)
 
 				protected:
@@ -60,9 +71,16 @@ namespace cfg
 						Register<Optional>("PartHoldBack", &_part_hold_back);
 						Register<Optional>("SegmentDuration", &_segment_duration);
 						Register<Optional>("SegmentCount", &_segment_count);
+						// Cut the segments and the parts on the multiples of SegmentDuration/ChunkDuration on the timeline,
+						// so the renditions with <KeyFrameAlignment> have them at the same timestamps
+						Register<Optional>("SegmentAlignment", &_segment_alignment);
+						Register<Optional>("DashManifest", &_dash_manifest);
+						Register<Optional>("OnDemandPackaging", &_on_demand_packaging);
+						Register<Optional>("OnDemandIdleTimeout", &_on_demand_idle_timeout);
 						Register<Optional>("CrossDomains", &_cross_domains);
 						Register<Optional>("Dumps", &_dumps);
 						Register<Optional>("CacheControl", &_cache_control);
+						Register<Optional>("Compression", &_compression);
 						Register<Optional>("DVR", &_dvr);
 					}
 				};
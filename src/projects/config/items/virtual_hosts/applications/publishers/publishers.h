@@ -15,6 +15,7 @@
 #include "ovt_publisher.h"
 #include "mpegtspush_publisher.h"
 #include "rtmppush_publisher.h"
+#include "srt_publisher.h"
 #include "thumbnail_publisher.h"
 #include "webrtc_publisher.h"
 #include "ll_hls_publisher.h"
@@ -42,12 +43,14 @@ namespace cfg
 							&_ovt_publisher,
 							&_file_publisher,
 							&_rtmppush_publisher,
-							&_thumbnail_publisher
+							&_thumbnail_publisher,
+							&_srt_publisher
 						};
 					}
 
 					CFG_DECLARE_CONST_REF_GETTER_OF(GetAppWorkerCount, _app_worker_count)
 					CFG_DECLARE_CONST_REF_GETTER_OF(GetStreamWorkerCount, _stream_worker_count)
+					CFG_DECLARE_CONST_REF_GETTER_OF(GetMaxWorkerLag, _max_worker_lag)
 					CFG_DECLARE_CONST_REF_GETTER_OF(GetMpegtsPushPublisher, _mpegtspush_publisher)
 					CFG_DECLARE_CONST_REF_GETTER_OF(GetHlsPublisher, _hls_publisher)
 					CFG_DECLARE_CONST_REF_GETTER_OF(GetDashPublisher, _dash_publisher)
@@ -58,12 +61,14 @@ namespace cfg
 					CFG_DECLARE_CONST_REF_GETTER_OF(GetFilePublisher, _file_publisher)
 					CFG_DECLARE_CONST_REF_GETTER_OF(GetRtmpPushPublisher, _rtmppush_publisher)
 					CFG_DECLARE_CONST_REF_GETTER_OF(GetThumbnailPublisher, _thumbnail_publisher)
+					CFG_DECLARE_CONST_REF_GETTER_OF(GetSrtPublisher, _srt_publisher)
 
 				protected:
 					void MakeList() override
 					{
 						Register<Optional>("AppWorkerCount", &_app_worker_count);
 						Register<Optional>("StreamWorkerCount", &_stream_worker_count);
+						Register<Optional>("MaxWorkerLag", &_max_worker_lag);
 
 						Register<Optional>("MPEGTSPush", &_mpegtspush_publisher);
 						Register<Optional>({"HLS", "hls"}, &_hls_publisher);
@@ -75,10 +80,14 @@ namespace cfg
 						Register<Optional>({"FILE", "file"}, &_file_publisher);
 						Register<Optional>({"RTMPPush", "rtmpPush"}, &_rtmppush_publisher);
 						Register<Optional>({"Thumbnail", "thumbnail"}, &_thumbnail_publisher);
+						Register<Optional>({"SRT", "srt"}, &_srt_publisher);
 					}
 
 					int _app_worker_count = 1;
 					int _stream_worker_count = 8;
+					// If a packet waits longer than this (milliseconds) in the queue of an ApplicationWorker,
+					// the packets of the stream are dropped until the next key frame (0: disabled)
+					int _max_worker_lag = 0;
 
 					MpegtsPushPublisher _mpegtspush_publisher;
 					RtmpPushPublisher _rtmppush_publisher;
@@ -90,6 +99,7 @@ namespace cfg
 					OvtPublisher _ovt_publisher;
 					FilePublisher _file_publisher;
 					ThumbnailPublisher _thumbnail_publisher;
+					SrtPublisher _srt_publisher;
 				};
 			}  // namespace pub
 		}	   // namespace app
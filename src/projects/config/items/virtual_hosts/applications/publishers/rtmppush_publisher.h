@@ -27,11 +27,26 @@ namespace cfg
 						return PublisherType::RtmpPush;
 					}
 
+					CFG_DECLARE_CONST_REF_GETTER_OF(IsNativeSender, _native_sender)
+					CFG_DECLARE_CONST_REF_GETTER_OF(GetChunkSize, _chunk_size)
+					CFG_DECLARE_CONST_REF_GETTER_OF(IsAggregateMessages, _aggregate_messages)
+
 				protected:
 					void MakeList() override
 					{
 						Publisher::MakeList();
+
+						Register<Optional>("NativeSender", &_native_sender);
+						Register<Optional>("ChunkSize", &_chunk_size);
+						Register<Optional>("AggregateMessages", &_aggregate_messages);
 					}
+
+					// Pushes rtmp:// URLs with RtmpPushSender instead of FFmpeg
+					bool _native_sender = false;
+					// Chunk size announced to the server by RtmpPushSender
+					int _chunk_size = 60000;
+					// Sends the audio messages and the next video frame in an aggregate message
+					bool _aggregate_messages = true;
 				};
 			}  // namespace pub
 		}	   // namespace app
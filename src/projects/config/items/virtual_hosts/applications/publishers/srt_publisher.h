@@ -0,0 +1,30 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include "publisher.h"
+
+namespace cfg
+{
+	namespace vhost
+	{
+		namespace app
+		{
+			namespace pub
+			{
+				struct SrtPublisher : public Publisher
+				{
+					PublisherType GetType() const override
+					{
+						return PublisherType::Srt;
+					}
+				};
+			}  // namespace pub
+		}	   // namespace app
+	}		   // namespace vhost
+}  // namespace cfg
@@ -8,6 +8,7 @@
 //==============================================================================
 #pragma once
 
+#include "../../../common/cross_domain_support.h"
 #include "publisher.h"
 
 namespace cfg
@@ -36,7 +37,7 @@ namespace cfg
 					}
 				};
 
-				struct WebrtcPublisher : public Publisher
+				struct WebrtcPublisher : public Publisher, public cmn::CrossDomainSupport
 				{
 					PublisherType GetType() const override
 					{
@@ -49,6 +50,13 @@ namespace cfg
 					CFG_DECLARE_CONST_REF_GETTER_OF(IsJitterBufferEnabled, _jitter_buffer)
 					CFG_DECLARE_CONST_REF_GETTER_OF(GetPlayoutDelay, _playout_delay)
 					CFG_DECLARE_CONST_REF_GETTER_OF(GetBandwidthEstimationType, _bandwidth_estimation_type)
+					CFG_DECLARE_CONST_REF_GETTER_OF(IsPacingEnabled, _pacing)
+					// Sub-200ms mode: the jitter buffer and the duration stash of MediaRouter are bypassed,
+					// the playout delay is forced to 0, and only the bursts of the key frames are paced
+					CFG_DECLARE_CONST_REF_GETTER_OF(IsInteractive, _interactive)
+					// The RTP packets of the bypassed tracks from a WebRTC input are forwarded with the SSRC, sequence number
+					// and timestamp rewritten, instead of being packetized again from the frames
+					CFG_DECLARE_CONST_REF_GETTER_OF(IsRtpRelayEnabled, _rtp_relay)
 
 				protected:
 					void MakeList() override
@@ -60,6 +68,10 @@ namespace cfg
 						Register<Optional>("Rtx", &_rtx);
 						Register<Optional>("Ulpfec", &_ulpfec);
 						Register<Optional>("PlayoutDelay", &_playout_delay);
+						Register<Optional>("Pacing", &_pacing);
+						Register<Optional>("Interactive", &_interactive);
+						Register<Optional>("RtpRelay", &_rtp_relay);
+						Register<Optional>("CrossDomains", &_cross_domains);
 						Register<Optional>("BandwidthEstimation", &_bwe,	
 							[=]() -> std::shared_ptr<ConfigError> {
 								return nullptr;
@@ -69,12 +81,10 @@ namespace cfg
 								{
 									_bandwidth_estimation_type = WebRtcBandwidthEstimationType::REMB;
 								}
-								// Not yet supported
-								// else if (_bwe.UpperCaseString() == "TRANSPORTCC")
-								// {
-								// 	_bandwidth_estimation_type = BandwidthEstimationType::TransportCc;
-									
-								// }
+								else if (_bwe.UpperCaseString() == "TRANSPORTCC")
+								{
+									_bandwidth_estimation_type = WebRtcBandwidthEstimationType::TransportCc;
+								}
 								else
 								{
 									return CreateConfigErrorPtr("Invalid value for BWE. Valid values are 'TransportCC' or 'REMB'");
@@ -88,6 +98,9 @@ namespace cfg
 					bool _rtx = false;
 					bool _ulpfec = false;
 					bool _jitter_buffer = false;
+					bool _pacing = true;
+					bool _interactive = false;
+					bool _rtp_relay = false;
 					ov::String _bwe;
 
 					WebRtcBandwidthEstimationType _bandwidth_estimation_type = WebRtcBandwidthEstimationType::REMB;
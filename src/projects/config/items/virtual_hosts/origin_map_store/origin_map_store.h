@@ -8,6 +8,7 @@
 //==============================================================================
 #pragma once
 
+#include "prefetch.h"
 #include "redis_server.h"
 
 namespace cfg
@@ -20,16 +21,19 @@ namespace cfg
 			{
 				CFG_DECLARE_CONST_REF_GETTER_OF(GetRedisServer, _redis_server)
 				CFG_DECLARE_CONST_REF_GETTER_OF(GetOriginHostName, _origin_host_name)
+				CFG_DECLARE_CONST_REF_GETTER_OF(GetPrefetch, _prefetch)
 
 			protected:
 				void MakeList() override
 				{
 					Register("RedisServer", &_redis_server);
 					Register<Optional>("OriginHostName", &_origin_host_name);
+					Register<Optional>("Prefetch", &_prefetch);
 				}
 				
 				RedisServer _redis_server;
 				ov::String _origin_host_name;
+				Prefetch _prefetch;
 			};
 		}  // namespace orgn
 	}	   // namespace vhost
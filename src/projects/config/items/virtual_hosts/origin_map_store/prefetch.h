@@ -0,0 +1,36 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+namespace cfg
+{
+	namespace vhost
+	{
+		namespace orgn
+		{
+			// Edge pulls the most watched streams in the cluster before its first viewer comes
+			struct Prefetch : public Item
+			{
+				CFG_DECLARE_CONST_REF_GETTER_OF(GetStreamCount, _stream_count)
+				CFG_DECLARE_CONST_REF_GETTER_OF(GetMaxBitrate, _max_bitrate)
+
+			protected:
+				void MakeList() override
+				{
+					Register<Optional>("StreamCount", &_stream_count);
+					Register<Optional>("MaxBitrate", &_max_bitrate);
+				}
+
+				// Number of the most watched streams to prefetch (0: disabled)
+				int32_t _stream_count = 0;
+				// Total bitrate (bps) of the prefetched streams without viewers (0: unlimited)
+				int64_t _max_bitrate = 0;
+			};
+		}  // namespace orgn
+	}	   // namespace vhost
+}  // namespace cfg
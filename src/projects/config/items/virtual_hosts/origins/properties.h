@@ -19,6 +19,7 @@ namespace cfg
 				CFG_DECLARE_CONST_REF_GETTER_OF(GetNoInputFailoverTimeout, _no_input_failover_timeout)
 				CFG_DECLARE_CONST_REF_GETTER_OF(GetUnusedStreamDeletionTimeout, _unused_stream_deletion_timeout)
 				CFG_DECLARE_CONST_REF_GETTER_OF(GetStreamFailbackTimeout, _stream_failback_timeout)
+				CFG_DECLARE_CONST_REF_GETTER_OF(GetStandbyStreamCount, _standby_stream_count)
 
 			protected:
 				void MakeList() override
@@ -26,11 +27,14 @@ namespace cfg
 					Register<Optional>("NoInputFailoverTimeout", &_no_input_failover_timeout);
 					Register<Optional>("UnusedStreamDeletionTimeout", &_unused_stream_deletion_timeout);
 					Register<Optional>("StreamFailbackTimeout", &_stream_failback_timeout);
+					Register<Optional>("StandbyStreamCount", &_standby_stream_count);
 				}
 
 				int64_t _no_input_failover_timeout = 3000;
 				int64_t _unused_stream_deletion_timeout = 60000;
-				int64_t _stream_failback_timeout = 3000;				
+				int64_t _stream_failback_timeout = 3000;
+				// Number of unused pull streams per application that are kept connected instead of being deleted
+				int32_t _standby_stream_count = 0;
 			};
 		}  // namespace orgn
 	}	   // namespace vhost
@@ -10,11 +10,13 @@ LOCAL_STATIC_LIBRARIES := \
 	mpegtspush_publisher \
 	rtmppush_publisher \
 	thumbnail_publisher \
+	srt_publisher \
 	ovt_provider \
 	rtmp_provider \
 	srt_provider \
 	mpegts_provider \
 	rtspc_provider \
+	rtsp_provider \
 	webrtc_provider \
 	transcoder \
 	rtc_signalling \
@@ -56,8 +58,6 @@ LOCAL_STATIC_LIBRARIES := \
 	managed_queue \
 	
 
-# rtsp_provider 
-
 LOCAL_PREBUILT_LIBRARIES := \
 	libpugixml.a
 
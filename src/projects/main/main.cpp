@@ -16,6 +16,9 @@
 #include <config/config_manager.h>
 #include <mediarouter/mediarouter.h>
 #include <modules/address/address_utilities.h>
+#include <modules/dtls_srtp/dtls_handshake_worker_pool.h>
+#include <modules/dtls_srtp/srtp_crypto_worker_pool.h>
+#include <modules/physical_port/physical_port_manager.h>
 #include <modules/sdp/sdp_regex_pattern.h>
 #include <monitoring/monitoring.h>
 #include <orchestrator/orchestrator.h>
@@ -23,6 +26,9 @@
 #include <publishers/publishers.h>
 #include <sys/utsname.h>
 #include <transcoder/transcoder.h>
+#include <transcoder/transcoder_benchmark.h>
+#include <transcoder/transcoder_gpu.h>
+#include <transcoder/transcoder_pipeline_scheduler.h>
 #include <web_console/web_console.h>
 
 #include "banner.h"
@@ -107,6 +113,48 @@ int main(int argc, char *argv[])
 	}
 
 	logti("This host supports %s", ov::ipv6::Checker::GetInstance()->ToString().CStr());
+	logti("CPU features: %s (selected kernels: %s)", ov::CpuFeatures::GetFeaturesString().CStr(), ov::CpuFeatures::GetSelectionsString().CStr());
+
+	// SO_REUSEPORT must be configured before any port is created
+	auto &reuse_port_config = server_config->GetModules().GetReusePort();
+	if (reuse_port_config.IsEnabled())
+	{
+		PhysicalPortManager::GetInstance()->SetReusePort(true, reuse_port_config.IsCpuSteeringEnabled());
+		logti("SO_REUSEPORT listeners are enabled (CPU steering: %s)", reuse_port_config.IsCpuSteeringEnabled() ? "true" : "false");
+	}
+
+	// The event backend must be configured before any socket pool is initialized
+	if (server_config->GetModules().GetIoUring().IsEnabled())
+	{
+		ov::SocketPool::SetDefaultEventBackend(ov::SocketEventBackend::IoUring);
+		logti("io_uring event backend is enabled (supported: %s)", ov::IoUringPoller::IsSupported() ? "true" : "false");
+	}
+
+	// XDP egress must be configured before any socket pool is initialized
+	auto &xdp_config = server_config->GetModules().GetXdp();
+	if (xdp_config.IsEnabled())
+	{
+		ov::SocketPool::SetXdpEgress(xdp_config.GetInterface(), std::max(xdp_config.GetQueueCount(), 1), std::max(xdp_config.GetFrameCount(), 64), xdp_config.IsZeroCopy());
+		logti("XDP egress is enabled (interface: %s, queues: %d, frames: %d, zero-copy: %s)",
+			  xdp_config.GetInterface().CStr(), xdp_config.GetQueueCount(), xdp_config.GetFrameCount(), xdp_config.IsZeroCopy() ? "true" : "false");
+	}
+
+	// The NUMA node of the socket pool workers must be configured before any socket pool is initialized
+	auto &numa_affinity_config = server_config->GetModules().GetNumaAffinity();
+	if (numa_affinity_config.IsEnabled())
+	{
+		ov::SocketPool::SetWorkerNumaNode(numa_affinity_config.GetSocketPoolWorkerNode());
+		logti("NUMA affinity is enabled (nodes: %zu, socket pool worker node: %d)", ov::Platform::GetNumaNodeCount(), numa_affinity_config.GetSocketPoolWorkerNode());
+	}
+
+	auto &send_buffer_limit_config = server_config->GetModules().GetSendBufferLimit();
+	if (send_buffer_limit_config.IsEnabled())
+	{
+		ov::Socket::SetSendBufferLimits(std::max<int64_t>(send_buffer_limit_config.GetMaxBytesPerConnection(), 64 * 1024),
+										std::max<int64_t>(send_buffer_limit_config.GetMaxTotalBytes(), 0));
+		logti("Send buffer limit is enabled (per connection: %" PRId64 " bytes, total: %" PRId64 " bytes)",
+			  send_buffer_limit_config.GetMaxBytesPerConnection(), send_buffer_limit_config.GetMaxTotalBytes());
+	}
 
 	bool succeeded = true;
 
@@ -115,6 +163,52 @@ int main(int argc, char *argv[])
 	INIT_EXTERNAL_MODULE("OpenSSL", InitializeOpenSsl);
 	INIT_EXTERNAL_MODULE("SRTP", InitializeSrtp);
 
+	auto &srtp_crypto_worker_config = server_config->GetModules().GetSrtpCryptoWorker();
+	if (srtp_crypto_worker_config.IsEnabled())
+	{
+		SrtpCryptoWorkerPool::GetInstance()->Start(std::max(srtp_crypto_worker_config.GetWorkerCount(), 1));
+	}
+
+	auto &dtls_handshake_worker_config = server_config->GetModules().GetDtlsHandshakeWorker();
+	if (dtls_handshake_worker_config.IsEnabled())
+	{
+		DtlsHandshakeWorkerPool::GetInstance()->Start(std::max(dtls_handshake_worker_config.GetWorkerCount(), 1),
+													  std::max(dtls_handshake_worker_config.GetMaxPendingHandshakes(), 1));
+	}
+
+	// The scheduler must be started before any publisher stream is created
+	auto &session_scheduler_config = server_config->GetModules().GetSessionScheduler();
+	if (session_scheduler_config.IsEnabled())
+	{
+		pub::SessionScheduler::GetInstance()->Start(std::max(session_scheduler_config.GetWorkerCount(), 0),
+													server_config->GetModules().GetStreamAffinity().IsEnabled(),
+													server_config->GetModules().GetNumaAffinity().IsEnabled());
+	}
+
+	// The scheduler must be started before any transcoder stream is created
+	auto &transcode_scheduler_config = server_config->GetModules().GetTranscodeScheduler();
+	if (transcode_scheduler_config.IsEnabled())
+	{
+		TranscodePipelineScheduler::GetInstance()->Start(std::max(transcode_scheduler_config.GetWorkerCount(), 0));
+	}
+
+	if (parse_option.bench_transcode)
+	{
+		TranscodeBenchmark::GetInstance()->Start();
+	}
+
+	// Initializing the GPU drivers takes seconds, so the GPUs are probed while the modules below are initialized
+	for (auto &vhost_config : server_config->GetVirtualHostList())
+	{
+		for (auto &app_config : vhost_config.GetApplicationList())
+		{
+			if (app_config.GetOutputProfiles().IsHardwareAcceleration())
+			{
+				TranscodeGPU::GetInstance()->InitializeAsync();
+			}
+		}
+	}
+
 	//--------------------------------------------------------------------
 	// Create the modules
 	//--------------------------------------------------------------------
@@ -136,6 +230,7 @@ int main(int argc, char *argv[])
 	INIT_MODULE(mpegtspush_publisher, "MpegtsPush Publisher", MpegtsPushPublisher::Create(*server_config, media_router));
 	INIT_MODULE(rtmppush_publisher, "RtmpPush Publisher", RtmpPushPublisher::Create(*server_config, media_router));
 	INIT_MODULE(thumbnail_publisher, "Thumbnail Publisher", ThumbnailPublisher::Create(*server_config, media_router));
+	INIT_MODULE(srt_publisher, "SRT Publisher", SrtPublisher::Create(*server_config, media_router));
 
 	// Initialize Transcoder
 	INIT_MODULE(transcoder, "Transcoder", Transcoder::Create(media_router));
@@ -147,8 +242,8 @@ int main(int argc, char *argv[])
 	INIT_MODULE(rtmp_provider, "RTMP Provider", pvd::RtmpProvider::Create(*server_config, media_router));
 	INIT_MODULE(ovt_provider, "OVT Provider", pvd::OvtProvider::Create(*server_config, media_router));
 	INIT_MODULE(rtspc_provider, "RTSPC Provider", pvd::RtspcProvider::Create(*server_config, media_router));
+	INIT_MODULE(rtsp_provider, "RTSP Provider", pvd::RtspProvider::Create(*server_config, media_router));
 	INIT_MODULE(file_provider, "File Provider", pvd::FileProvider::Create(*server_config, media_router));
-	// PENDING : INIT_MODULE(rtsp_provider, "RTSP Provider", pvd::RtspProvider::Create(*server_config, media_router));
 
 	auto api_server = std::make_shared<api::Server>();
 
@@ -182,12 +277,14 @@ int main(int argc, char *argv[])
 	RELEASE_MODULE(rtmp_provider, "RTMP Provider");
 	RELEASE_MODULE(ovt_provider, "OVT Provider");
 	RELEASE_MODULE(rtspc_provider, "RTSPC Provider");
+	RELEASE_MODULE(rtsp_provider, "RTSP Provider");
 	RELEASE_MODULE(file_provider, "File Provider");
 
-	// PENDING : RELEASE_MODULE(rtsp_provider, "RTSP Provider");
-
 	RELEASE_MODULE(transcoder, "Transcoder");
 
+	TranscodeBenchmark::GetInstance()->Stop();
+	TranscodePipelineScheduler::GetInstance()->Stop();
+
 	RELEASE_MODULE(webrtc_publisher, "WebRTC Publisher");
 	RELEASE_MODULE(llhls_publisher, "LLHLS Publisher");
 	RELEASE_MODULE(hls_publisher, "HLS Publisher");
@@ -198,9 +295,15 @@ int main(int argc, char *argv[])
 	RELEASE_MODULE(mpegtspush_publisher, "MpegtsPush Publisher");
 	RELEASE_MODULE(rtmppush_publisher, "RtmpPush Publisher");
 	RELEASE_MODULE(thumbnail_publisher, "Thumbnail Publisher");
+	RELEASE_MODULE(srt_publisher, "SRT Publisher");
 
 	RELEASE_MODULE(media_router, "MediaRouter");
 
+	pub::SessionScheduler::GetInstance()->Stop();
+
+	DtlsHandshakeWorkerPool::GetInstance()->Stop();
+	SrtpCryptoWorkerPool::GetInstance()->Stop();
+
 	TERMINATE_EXTERNAL_MODULE("SRTP", TerminateSrtp);
 	TERMINATE_EXTERNAL_MODULE("OpenSSL", TerminateOpenSsl);
 	TERMINATE_EXTERNAL_MODULE("SRT", TerminateSrt);
@@ -224,6 +327,8 @@ static ov::Daemon::State Initialize(int argc, char *argv[], ParseOption *parse_o
 		::printf("\n");
 		::printf("    -c <path>   Specify a path of config files\n");
 		::printf("    -v          Print OME Version\n");
+		::printf("    -b, --bench-transcode\n");
+		::printf("                Measures the throughput of the transcoder with the streams of the File provider\n");
 		::printf("    -i          Ignores and executes the settings of %s\n", CFG_LAST_CONFIG_FILE_NAME);
 		::printf("                (The JSON file is automatically generated when RESTful API is called)\n");
 		return ov::Daemon::State::PARENT_FAIL;
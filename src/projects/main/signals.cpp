@@ -220,7 +220,7 @@ static void ReloadHandler(int signum, siginfo_t *si, void *unused)
 		return;
 	}
 
-	logti("Trying to apply OriginMap to Orchestrator...");
+	logti("Trying to apply VirtualHosts to Orchestrator...");
 
 	std::vector<info::Host> host_info_list;
 	// Create info::Host
@@ -233,7 +233,7 @@ static void ReloadHandler(int signum, siginfo_t *si, void *unused)
 
 	if (ocst::Orchestrator::GetInstance()->UpdateVirtualHosts(host_info_list) == false)
 	{
-		logte("Could not reload OriginMap");
+		logte("Could not apply some of the VirtualHosts");
 	}
 }
 
@@ -12,11 +12,14 @@
 
 bool TryParseOption(int argc, char *argv[], ParseOption *parse_option)
 {
-	constexpr const char *opt_string = "hvc:dp:";
+	constexpr const char *opt_string = "hvc:dp:b";
+	static const struct option long_options[] = {
+		{"bench-transcode", no_argument, nullptr, 'b'},
+		{nullptr, 0, nullptr, 0}};
 
 	while (true)
 	{
-		int name = ::getopt(argc, argv, opt_string);
+		int name = ::getopt_long(argc, argv, opt_string, long_options, nullptr);
 
 		switch (name)
 		{
@@ -45,6 +48,10 @@ bool TryParseOption(int argc, char *argv[], ParseOption *parse_option)
 				parse_option->pid_path = optarg;
 				break;
 
+			case 'b':
+				parse_option->bench_transcode = true;
+				break;
+
 			default:  // '?'
 				// invalid argument
 				return false;
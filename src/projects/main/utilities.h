@@ -31,6 +31,10 @@ struct ParseOption
 	// -p <pid_path>
 	// If -d is set then the path of the PID can be set
 	ov::String pid_path = "";
+
+	// -b, --bench-transcode
+	// Measure the throughput of the transcoder (the File provider sends the packets as fast as possible)
+	bool bench_transcode = false;
 };
 
 bool TryParseOption(int argc, char *argv[], ParseOption *parse_option);
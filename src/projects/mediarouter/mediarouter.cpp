@@ -183,3 +183,27 @@ bool MediaRouter::UnregisterObserverApp(
 
 	return media_route_app->UnregisterObserverApp(application_observer);
 }
+
+std::vector<std::shared_ptr<MediaPacket>> MediaRouter::GetGopCache(
+	const info::Application &application_info, info::stream_id_t stream_id)
+{
+	auto media_route_app = GetRouteApplicationById(application_info.GetId());
+	if (media_route_app == nullptr)
+	{
+		return {};
+	}
+
+	return media_route_app->GetGopCache(stream_id);
+}
+
+bool MediaRouter::RequestKeyFrame(
+	const info::Application &application_info, info::stream_id_t stream_id, MediaTrackId track_id)
+{
+	auto media_route_app = GetRouteApplicationById(application_info.GetId());
+	if (media_route_app == nullptr)
+	{
+		return false;
+	}
+
+	return media_route_app->RequestKeyFrame(stream_id, track_id);
+}
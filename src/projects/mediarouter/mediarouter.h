@@ -76,6 +76,15 @@ public:
 		const info::Application &application_info,
 		const std::shared_ptr<MediaRouteApplicationObserver> &application_observer) override;
 
+	std::vector<std::shared_ptr<MediaPacket>> GetGopCache(
+		const info::Application &application_info,
+		info::stream_id_t stream_id) override;
+
+	bool RequestKeyFrame(
+		const info::Application &application_info,
+		info::stream_id_t stream_id,
+		MediaTrackId track_id) override;
+
 private:
 	std::map<info::application_id_t, std::shared_ptr<MediaRouteApplication>> _route_apps;
 };
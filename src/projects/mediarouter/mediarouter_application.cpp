@@ -9,6 +9,9 @@
 #include "mediarouter_application.h"
 
 #include <base/info/stream.h>
+#include <config/config.h>
+
+#include <limits>
 
 #include "mediarouter_private.h"
 #include "monitoring/monitoring.h"
@@ -17,6 +20,9 @@
 #define MIN_APPLICATION_WORKER_COUNT 1
 #define MAX_APPLICATION_WORKER_COUNT 64
 
+// Maximum number of packets of a stream processed before the worker moves on to the next stream
+#define MAX_PACKETS_PER_STREAM_VISIT 256
+
 #define CONNECTOR(var) MediaRouteApplicationConnector::ConnectorType::var
 #define OBSERVER(var) MediaRouteApplicationObserver::ObserverType::var
 
@@ -54,13 +60,13 @@ MediaRouteApplication::MediaRouteApplication(const info::Application &applicatio
 	{
 		{
 			auto urn = info::ManagedQueue::URN(_application_info.GetName().CStr(), nullptr, "imr", ov::String::FormatString("appworker_%d", worker_id));
-			auto stream_data = std::make_shared<ov::ManagedQueue<std::shared_ptr<MediaRouteStream>>>(urn.CStr(), 500);
+			auto stream_data = std::make_shared<StreamIndicatorQueue>(urn.CStr(), 500);
 			_inbound_stream_indicator.push_back(stream_data);
 		}
 
 		{
 			auto urn = info::ManagedQueue::URN(_application_info.GetName().CStr(), nullptr, "omr", ov::String::FormatString("appworker_%d", worker_id));
-			auto stream_data = std::make_shared<ov::ManagedQueue<std::shared_ptr<MediaRouteStream>>>(urn.CStr(), 500);
+			auto stream_data = std::make_shared<StreamIndicatorQueue>(urn.CStr(), 500);
 			_outbound_stream_indicator.push_back(stream_data);
 		}
 	}
@@ -75,12 +81,31 @@ bool MediaRouteApplication::Start()
 {
 	_kill_flag = false;
 
+	// A stream is handled by the inbound/outbound worker of the same index (stream_id % worker count),
+	// so both workers are pinned to the home core of the stream (or the NUMA node of the index)
+	auto &modules_config = cfg::ConfigManager::GetInstance()->GetServer()->GetModules();
+	auto use_stream_affinity = modules_config.GetStreamAffinity().IsEnabled();
+	auto use_numa_affinity = modules_config.GetNumaAffinity().IsEnabled();
+
 	for (uint32_t worker_id = 0; worker_id < _max_worker_thread_count; worker_id++)
 	{
 		try
 		{
 			auto inbound_thread = std::thread(&MediaRouteApplication::InboundWorkerThread, this, worker_id);
 			pthread_setname_np(inbound_thread.native_handle(), "InboundWorker");
+
+			if (use_stream_affinity)
+			{
+				if (ov::Platform::SetThreadAffinity(inbound_thread, worker_id) == false)
+				{
+					logtw("Could not set the CPU affinity of Inbound worker #%u", worker_id);
+				}
+			}
+			else if (use_numa_affinity && (ov::Platform::SetThreadNumaNode(inbound_thread, worker_id) == false))
+			{
+				logtw("Could not set the NUMA node of Inbound worker #%u", worker_id);
+			}
+
 			_inbound_threads.push_back(std::move(inbound_thread));
 		}
 		catch (const std::system_error &e)
@@ -97,6 +122,19 @@ bool MediaRouteApplication::Start()
 		{
 			auto outbound_thread = std::thread(&MediaRouteApplication::OutboundWorkerThread, this, worker_id);
 			pthread_setname_np(outbound_thread.native_handle(), "OutboundWorker");
+
+			if (use_stream_affinity)
+			{
+				if (ov::Platform::SetThreadAffinity(outbound_thread, worker_id) == false)
+				{
+					logtw("Could not set the CPU affinity of Outbound worker #%u", worker_id);
+				}
+			}
+			else if (use_numa_affinity && (ov::Platform::SetThreadNumaNode(outbound_thread, worker_id) == false))
+			{
+				logtw("Could not set the NUMA node of Outbound worker #%u", worker_id);
+			}
+
 			_outbound_threads.push_back(std::move(outbound_thread));
 		}
 		catch (const std::system_error &e)
@@ -150,8 +188,16 @@ bool MediaRouteApplication::Stop()
 	_inbound_threads.clear();
 	_outbound_threads.clear();
 
-	_connectors.clear();
-	_observers.clear();
+	{
+		std::lock_guard<std::mutex> lock(_connectors_lock);
+		std::atomic_store(&_connectors, std::make_shared<const ConnectorList>());
+	}
+
+	{
+		std::lock_guard lock(_observers_lock);
+		std::atomic_store(&_observers, std::make_shared<const ObserverList>());
+		_observers_version++;
+	}
 
 	logtd("[%s(%u)] Mediarouter application has been stopped", _application_info.GetName().CStr(), _application_info.GetId());
 
@@ -161,7 +207,7 @@ bool MediaRouteApplication::Stop()
 // Called when an application is created
 bool MediaRouteApplication::RegisterConnectorApp(std::shared_ptr<MediaRouteApplicationConnector> connector)
 {
-	std::lock_guard<std::shared_mutex> lock(_connectors_lock);
+	std::lock_guard<std::mutex> lock(_connectors_lock);
 
 	if (connector == nullptr)
 	{
@@ -170,7 +216,9 @@ bool MediaRouteApplication::RegisterConnectorApp(std::shared_ptr<MediaRouteAppli
 
 	connector->SetMediaRouterApplication(GetSharedPtr());
 
-	_connectors.push_back(connector);
+	auto connectors = std::make_shared<ConnectorList>(*_connectors);
+	connectors->push_back(connector);
+	std::atomic_store(&_connectors, std::shared_ptr<const ConnectorList>(connectors));
 
 	logtd("Registered connector. app(%s) type(%d)", _application_info.GetName().CStr(), connector->GetConnectorType());
 
@@ -180,20 +228,22 @@ bool MediaRouteApplication::RegisterConnectorApp(std::shared_ptr<MediaRouteAppli
 // Called when an application is removed
 bool MediaRouteApplication::UnregisterConnectorApp(std::shared_ptr<MediaRouteApplicationConnector> connector)
 {
-	std::lock_guard<std::shared_mutex> lock(_connectors_lock);
+	std::lock_guard<std::mutex> lock(_connectors_lock);
 
 	if (!connector)
 	{
 		return false;
 	}
 
-	auto position = std::find(_connectors.begin(), _connectors.end(), connector);
-	if (position == _connectors.end())
+	auto connectors = std::make_shared<ConnectorList>(*_connectors);
+	auto position = std::find(connectors->begin(), connectors->end(), connector);
+	if (position == connectors->end())
 	{
 		return true;
 	}
 
-	_connectors.erase(position);
+	connectors->erase(position);
+	std::atomic_store(&_connectors, std::shared_ptr<const ConnectorList>(connectors));
 
 	logti("Unregistered connector. app(%s) type(%d)", _application_info.GetName().CStr(), connector->GetConnectorType());
 
@@ -202,14 +252,17 @@ bool MediaRouteApplication::UnregisterConnectorApp(std::shared_ptr<MediaRouteApp
 
 bool MediaRouteApplication::RegisterObserverApp(std::shared_ptr<MediaRouteApplicationObserver> observer)
 {
-	std::lock_guard<std::shared_mutex> lock(_observers_lock);
+	std::lock_guard lock(_observers_lock);
 
 	if (!observer)
 	{
 		return false;
 	}
 
-	_observers.push_back(observer);
+	auto observers = std::make_shared<ObserverList>(*_observers);
+	observers->push_back(observer);
+	std::atomic_store(&_observers, std::shared_ptr<const ObserverList>(observers));
+	_observers_version++;
 
 	logtd("Registered observer. app(%s) type(%d)", _application_info.GetName().CStr(), observer->GetObserverType());
 
@@ -218,26 +271,68 @@ bool MediaRouteApplication::RegisterObserverApp(std::shared_ptr<MediaRouteApplic
 
 bool MediaRouteApplication::UnregisterObserverApp(std::shared_ptr<MediaRouteApplicationObserver> observer)
 {
-	std::lock_guard<std::shared_mutex> lock(_observers_lock);
+	std::lock_guard lock(_observers_lock);
 
 	if (!observer)
 	{
 		return false;
 	}
 
-	auto position = std::find(_observers.begin(), _observers.end(), observer);
-	if (position == _observers.end())
+	auto observers = std::make_shared<ObserverList>(*_observers);
+	auto position = std::find(observers->begin(), observers->end(), observer);
+	if (position == observers->end())
 	{
 		return true;
 	}
 
-	_observers.erase(position);
+	observers->erase(position);
+	std::atomic_store(&_observers, std::shared_ptr<const ObserverList>(observers));
+	_observers_version++;
 
 	logti("Unregistered observer. app(%s) type(%d)", _application_info.GetName().CStr(), observer->GetObserverType());
 
 	return true;
 }
 
+std::shared_ptr<const MediaRouteApplication::ObserverList> MediaRouteApplication::GetObservers() const
+{
+	return std::atomic_load(&_observers);
+}
+
+std::vector<std::shared_ptr<MediaPacket>> MediaRouteApplication::GetGopCache(info::stream_id_t stream_id)
+{
+	auto stream = GetOutboundStream(stream_id);
+	if (stream == nullptr)
+	{
+		return {};
+	}
+
+	return stream->GetGopCache();
+}
+
+bool MediaRouteApplication::RequestKeyFrame(info::stream_id_t stream_id, MediaTrackId track_id)
+{
+	auto stream = GetOutboundStream(stream_id);
+	if (stream == nullptr)
+	{
+		return false;
+	}
+
+	auto stream_info = stream->GetStream();
+	auto connectors = std::atomic_load(&_connectors);
+
+	for (const auto &connector : *connectors)
+	{
+		if ((connector->GetConnectorType() == MediaRouteApplicationConnector::ConnectorType::Transcoder) &&
+			connector->OnKeyFrameRequested(stream_info, track_id))
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
 // OnStreamCreated is called from Provider, Transcoder
 bool MediaRouteApplication::OnStreamCreated(const std::shared_ptr<MediaRouteApplicationConnector> &app_conn, const std::shared_ptr<info::Stream> &stream_info)
 {
@@ -315,7 +410,7 @@ bool MediaRouteApplication::OnStreamCreated(const std::shared_ptr<MediaRouteAppl
 
 std::shared_ptr<MediaRouteStream> MediaRouteApplication::CreateInboundStream(const std::shared_ptr<info::Stream> &stream_info)
 {
-	std::lock_guard<std::shared_mutex> lock_guard(_streams_lock);
+	std::lock_guard lock_guard(_streams_lock);
 
 	auto new_stream = std::make_shared<MediaRouteStream>(stream_info, MediaRouterStreamType::INBOUND);
 	if (!new_stream)
@@ -328,7 +423,7 @@ std::shared_ptr<MediaRouteStream> MediaRouteApplication::CreateInboundStream(con
 
 std::shared_ptr<MediaRouteStream> MediaRouteApplication::CreateOutboundStream(const std::shared_ptr<info::Stream> &stream_info)
 {
-	std::lock_guard<std::shared_mutex> lock_guard(_streams_lock);
+	std::lock_guard lock_guard(_streams_lock);
 
 	auto new_stream = std::make_shared<MediaRouteStream>(stream_info, MediaRouterStreamType::OUTBOUND);
 	if (!new_stream)
@@ -343,13 +438,13 @@ std::shared_ptr<MediaRouteStream> MediaRouteApplication::CreateOutboundStream(co
 
 bool MediaRouteApplication::NotifyStreamCreate(const std::shared_ptr<info::Stream> &stream_info, MediaRouteApplicationConnector::ConnectorType connector_type)
 {
-	std::shared_lock<std::shared_mutex> lock(_observers_lock);
+	auto observers = GetObservers();
 
 	logti("[%s/%s(%u)] Stream has been created", _application_info.GetName().CStr(), stream_info->GetName().CStr(), stream_info->GetId());
 
 	auto representation_type = stream_info->GetRepresentationType();
 
-	for (auto observer : _observers)
+	for (auto observer : *observers)
 	{
 		auto observer_type = observer->GetObserverType();
 
@@ -380,11 +475,11 @@ bool MediaRouteApplication::NotifyStreamCreate(const std::shared_ptr<info::Strea
 
 bool MediaRouteApplication::NotifyStreamPrepared(std::shared_ptr<MediaRouteStream> &stream)
 {
-	std::shared_lock<std::shared_mutex> lock(_observers_lock);
+	auto observers = GetObservers();
 
 	logti("[%s/%s(%u)] Stream has been prepared %s", _application_info.GetName().CStr(), stream->GetStream()->GetName().CStr(), stream->GetStream()->GetId(), stream->GetStream()->GetInfoString().CStr());
 
-	for (auto observer : _observers)
+	for (auto observer : *observers)
 	{
 		auto observer_type = observer->GetObserverType();
 
@@ -515,14 +610,14 @@ bool MediaRouteApplication::OnStreamDeleted(const std::shared_ptr<MediaRouteAppl
 
 bool MediaRouteApplication::DeleteInboundStream(const std::shared_ptr<info::Stream> &stream_info)
 {
-	std::lock_guard<std::shared_mutex> lock_guard(_streams_lock);
+	std::lock_guard lock_guard(_streams_lock);
 	_inbound_streams.erase(stream_info->GetId());
 
 	return true;
 }
 bool MediaRouteApplication::DeleteOutboundStream(const std::shared_ptr<info::Stream> &stream_info)
 {
-	std::lock_guard<std::shared_mutex> lock_guard(_streams_lock);
+	std::lock_guard lock_guard(_streams_lock);
 	_outbound_streams.erase(stream_info->GetId());
 
 	return true;
@@ -530,11 +625,11 @@ bool MediaRouteApplication::DeleteOutboundStream(const std::shared_ptr<info::Str
 
 bool MediaRouteApplication::NotifyStreamDeleted(const std::shared_ptr<info::Stream> &stream_info, const MediaRouteApplicationConnector::ConnectorType connector_type)
 {
-	std::shared_lock<std::shared_mutex> lock_guard(_observers_lock);
+	auto observers = GetObservers();
 
 	auto representation_type = stream_info->GetRepresentationType();
 
-	for (auto it = _observers.begin(); it != _observers.end(); ++it)
+	for (auto it = observers->begin(); it != observers->end(); ++it)
 	{
 		auto observer = *it;
 
@@ -574,11 +669,11 @@ bool MediaRouteApplication::NotifyStreamDeleted(const std::shared_ptr<info::Stre
 
 bool MediaRouteApplication::NotifyStreamUpdated(const std::shared_ptr<info::Stream> &stream_info, const MediaRouteApplicationConnector::ConnectorType connector_type)
 {
-	std::shared_lock<std::shared_mutex> lock_guard(_observers_lock);
+	auto observers = GetObservers();
 
 	auto representation_type = stream_info->GetRepresentationType();
 
-	for (auto it = _observers.begin(); it != _observers.end(); ++it)
+	for (auto it = observers->begin(); it != observers->end(); ++it)
 	{
 		auto observer = *it;
 
@@ -637,9 +732,18 @@ bool MediaRouteApplication::OnPacketReceived(const std::shared_ptr<MediaRouteApp
 			return false;
 		}
 
+		if (packet->GetTrace() != nullptr)
+		{
+			packet->GetTrace()->Mark(PacketTraceStage::MediaRouterInboundIn);
+		}
+
 		stream->Push(packet);
 
-		_inbound_stream_indicator[GetWorkerIDByStreamID(stream_info->GetId())]->Enqueue(stream);
+		// The stream is enqueued only when it becomes pending, and the worker drains all the packets of the stream per visit
+		if (stream->MarkAsPending() == true)
+		{
+			_inbound_stream_indicator[GetWorkerIDByStreamID(stream_info->GetId())]->Enqueue(stream);
+		}
 	}
 	// Provider(relay), Transcoder => Outbound Stream
 	else if ((IS_CONNECTOR_PROVIDER(connector_type) && IS_REPRENT_RELAY(representation_type)) ||
@@ -651,9 +755,17 @@ bool MediaRouteApplication::OnPacketReceived(const std::shared_ptr<MediaRouteApp
 			return false;
 		}
 
+		if (packet->GetTrace() != nullptr)
+		{
+			packet->GetTrace()->Mark(PacketTraceStage::MediaRouterOutboundIn);
+		}
+
 		stream->Push(packet);
 
-		_outbound_stream_indicator[GetWorkerIDByStreamID(stream_info->GetId())]->Enqueue(stream);
+		if (stream->MarkAsPending() == true)
+		{
+			_outbound_stream_indicator[GetWorkerIDByStreamID(stream_info->GetId())]->Enqueue(stream);
+		}
 	}
 	else
 	{
@@ -666,7 +778,7 @@ bool MediaRouteApplication::OnPacketReceived(const std::shared_ptr<MediaRouteApp
 
 std::shared_ptr<MediaRouteStream> MediaRouteApplication::GetInboundStream(uint32_t stream_id)
 {
-	std::shared_lock<std::shared_mutex> lock_guard(_streams_lock);
+	std::shared_lock lock_guard(_streams_lock);
 
 	auto bucket = _inbound_streams.find(stream_id);
 	if (bucket == _inbound_streams.end())
@@ -679,7 +791,7 @@ std::shared_ptr<MediaRouteStream> MediaRouteApplication::GetInboundStream(uint32
 
 std::shared_ptr<MediaRouteStream> MediaRouteApplication::GetOutboundStream(uint32_t stream_id)
 {
-	std::shared_lock<std::shared_mutex> lock_guard(_streams_lock);
+	std::shared_lock lock_guard(_streams_lock);
 
 	auto bucket = _outbound_streams.find(stream_id);
 	if (bucket == _outbound_streams.end())
@@ -692,7 +804,7 @@ std::shared_ptr<MediaRouteStream> MediaRouteApplication::GetOutboundStream(uint3
 
 std::shared_ptr<MediaRouteStream> MediaRouteApplication::GetInboundStreamByName(const ov::String stream_name)
 {
-	std::shared_lock<std::shared_mutex> lock_guard(_streams_lock);
+	std::shared_lock lock_guard(_streams_lock);
 
 	for (const auto &item : _inbound_streams)
 	{
@@ -708,7 +820,7 @@ std::shared_ptr<MediaRouteStream> MediaRouteApplication::GetInboundStreamByName(
 
 std::shared_ptr<MediaRouteStream> MediaRouteApplication::GetOutboundStreamByName(const ov::String stream_name)
 {
-	std::shared_lock<std::shared_mutex> lock_guard(_streams_lock);
+	std::shared_lock lock_guard(_streams_lock);
 
 	for (const auto &item : _outbound_streams)
 	{
@@ -724,7 +836,7 @@ std::shared_ptr<MediaRouteStream> MediaRouteApplication::GetOutboundStreamByName
 
 bool MediaRouteApplication::IsExistingInboundStream(ov::String stream_name)
 {
-	std::shared_lock<std::shared_mutex> lock_guard(_streams_lock);
+	std::shared_lock lock_guard(_streams_lock);
 
 	for (const auto &item : _inbound_streams)
 	{
@@ -745,8 +857,13 @@ uint32_t MediaRouteApplication::GetWorkerIDByStreamID(info::stream_id_t stream_i
 
 void MediaRouteApplication::InboundWorkerThread(uint32_t worker_id)
 {
+	ov::ThreadRegistry::Registration registration("MediaRouterInbound", _application_info.GetName().CStr());
+
 	logtd("Created Inbound worker thread #%d", worker_id);
 
+	std::shared_ptr<const ObserverList> observers;
+	uint64_t observers_version = std::numeric_limits<uint64_t>::max();
+
 	while (!_kill_flag)
 	{
 		auto msg = _inbound_stream_indicator[worker_id]->Dequeue(ov::Infinite);
@@ -762,34 +879,59 @@ void MediaRouteApplication::InboundWorkerThread(uint32_t worker_id)
 			continue;
 		}
 
-		// StreamDeliver media packet to Publisher(observer) of Transcoder(observer)
-		auto media_packet = stream->Pop();
-		if (media_packet == nullptr)
-		{
-			continue;
-		}
+		// Packets pushed from now on make the stream pending again
+		stream->ClearPending();
 
-		// When the inbound stream is finished parsing track information,
-		// Notify the Observer that the stream is parsed
-		if (stream->IsStreamPrepared() == false && stream->AreAllTracksReady() == true)
+		for (int count = 0; (count < MAX_PACKETS_PER_STREAM_VISIT) && stream->HasPendingPackets(); count++)
 		{
-			NotifyStreamPrepared(stream);
-		}
+			// StreamDeliver media packet to Publisher(observer) of Transcoder(observer)
+			auto media_packet = stream->Pop();
+			if (media_packet == nullptr)
+			{
+				continue;
+			}
 
-		std::shared_lock<std::shared_mutex> lock(_observers_lock);
-		for (const auto &observer : _observers)
-		{
-			auto observer_type = observer->GetObserverType();
+			if (media_packet->GetTrace() != nullptr)
+			{
+				media_packet->GetTrace()->Mark(PacketTraceStage::MediaRouterInboundOut);
+			}
 
-			if (observer_type == MediaRouteApplicationObserver::ObserverType::Transcoder)
+			// When the inbound stream is finished parsing track information,
+			// Notify the Observer that the stream is parsed
+			if (stream->IsStreamPrepared() == false && stream->AreAllTracksReady() == true)
 			{
-				// Get Stream Info
-				auto stream_info = stream->GetStream();
+				NotifyStreamPrepared(stream);
+			}
 
-				// observer->OnSendFrame(stream_info, std::move(media_packet->ClonePacket()));
-				observer->OnSendFrame(stream_info, media_packet);
+			// Reload the snapshot only if the observers have been changed
+			auto version = _observers_version.load();
+			if (version != observers_version)
+			{
+				observers = GetObservers();
+				observers_version = version;
+			}
+
+			for (const auto &observer : *observers)
+			{
+				auto observer_type = observer->GetObserverType();
+
+				if ((observer_type == MediaRouteApplicationObserver::ObserverType::Transcoder) &&
+					observer->GetSubscription().IsSubscribed(*media_packet))
+				{
+					// Get Stream Info
+					auto stream_info = stream->GetStream();
+
+					// observer->OnSendFrame(stream_info, std::move(media_packet->ClonePacket()));
+					observer->OnSendFrame(stream_info, media_packet);
+				}
 			}
 		}
+
+		// A busy stream is put back at the end of the queue so that it doesn't starve the other streams of this worker
+		if (stream->HasPendingPackets() && stream->MarkAsPending())
+		{
+			_inbound_stream_indicator[worker_id]->Enqueue(stream);
+		}
 	}
 
 	logtd("Inbound worker thread #%d has been stopped", worker_id);
@@ -797,8 +939,13 @@ void MediaRouteApplication::InboundWorkerThread(uint32_t worker_id)
 
 void MediaRouteApplication::OutboundWorkerThread(uint32_t worker_id)
 {
+	ov::ThreadRegistry::Registration registration("MediaRouterOutbound", _application_info.GetName().CStr());
+
 	logtd("Created outbound worker thread #%d", worker_id);
 
+	std::shared_ptr<const ObserverList> observers;
+	uint64_t observers_version = std::numeric_limits<uint64_t>::max();
+
 	while (!_kill_flag)
 	{
 		auto msg = _outbound_stream_indicator[worker_id]->Dequeue(ov::Infinite);
@@ -814,30 +961,56 @@ void MediaRouteApplication::OutboundWorkerThread(uint32_t worker_id)
 			continue;
 		}
 
-		// StreamDeliver media packet to Publisher(observer) of Transcoder(observer)
-		auto media_packet = stream->Pop();
-		if (media_packet == nullptr)
-		{
-			continue;
-		}
+		// Packets pushed from now on make the stream pending again
+		stream->ClearPending();
 
-		if (stream->IsStreamPrepared() == false && stream->AreAllTracksReady() == true)
+		for (int count = 0; (count < MAX_PACKETS_PER_STREAM_VISIT) && stream->HasPendingPackets(); count++)
 		{
-			NotifyStreamPrepared(stream);
-		}
+			// StreamDeliver media packet to Publisher(observer) of Transcoder(observer)
+			auto media_packet = stream->Pop();
+			if (media_packet == nullptr)
+			{
+				continue;
+			}
 
-		std::shared_lock<std::shared_mutex> lock(_observers_lock);
-		for (const auto &observer : _observers)
-		{
-			auto observer_type = observer->GetObserverType();
+			if (media_packet->GetTrace() != nullptr)
+			{
+				media_packet->GetTrace()->Mark(PacketTraceStage::MediaRouterOutboundOut);
+			}
 
-			if (observer_type == MediaRouteApplicationObserver::ObserverType::Publisher)
+			if (stream->IsStreamPrepared() == false && stream->AreAllTracksReady() == true)
 			{
-				// Get Stream Info
-				auto stream_info = stream->GetStream();
+				NotifyStreamPrepared(stream);
+			}
 
-				observer->OnSendFrame(stream_info, media_packet);
+			// Reload the snapshot only if the observers have been changed
+			auto version = _observers_version.load();
+			if (version != observers_version)
+			{
+				observers = GetObservers();
+				observers_version = version;
 			}
+
+			for (const auto &observer : *observers)
+			{
+				auto observer_type = observer->GetObserverType();
+
+				// The packets that the publisher doesn't need are dropped here, not to be queued in the publisher
+				if ((observer_type == MediaRouteApplicationObserver::ObserverType::Publisher) &&
+					observer->GetSubscription().IsSubscribed(*media_packet))
+				{
+					// Get Stream Info
+					auto stream_info = stream->GetStream();
+
+					observer->OnSendFrame(stream_info, media_packet);
+				}
+			}
+		}
+
+		// A busy stream is put back at the end of the queue so that it doesn't starve the other streams of this worker
+		if (stream->HasPendingPackets() && stream->MarkAsPending())
+		{
+			_outbound_stream_indicator[worker_id]->Enqueue(stream);
 		}
 	}
 
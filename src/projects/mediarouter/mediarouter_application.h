@@ -11,8 +11,10 @@
 #include <config/items/items.h>
 
 #include <algorithm>
+#include <atomic>
 #include <cstdint>
 #include <memory>
+#include <mutex>
 #include <vector>
 
 #include "base/mediarouter/mediarouter_application_connector.h"
@@ -62,6 +64,10 @@ public:
 	bool UnregisterObserverApp(
 		std::shared_ptr<MediaRouteApplicationObserver> observer);
 
+	std::vector<std::shared_ptr<MediaPacket>> GetGopCache(info::stream_id_t stream_id);
+	// Forwards the keyframe request of the outbound stream to the transcoder
+	bool RequestKeyFrame(info::stream_id_t stream_id, MediaTrackId track_id);
+
 public:
 	//////////////////////////////////////////////////////////////////////
 	// Interface for Stream and MediaPacket
@@ -120,12 +126,21 @@ private:
 	const info::Application _application_info;
 
 	// Information of Connector instance
-	std::vector<std::shared_ptr<MediaRouteApplicationConnector>> _connectors;
-	std::shared_mutex _connectors_lock;
+	// Connectors and observers are immutable snapshots replaced on registration (copy-on-write),
+	// so the packet path reads them without taking a lock
+	using ConnectorList = std::vector<std::shared_ptr<MediaRouteApplicationConnector>>;
+	std::shared_ptr<const ConnectorList> _connectors = std::make_shared<const ConnectorList>();
+	// Serializes the writers only
+	std::mutex _connectors_lock;
 
 	// Information of Observer instance
-	std::vector<std::shared_ptr<MediaRouteApplicationObserver>> _observers;
-	std::shared_mutex _observers_lock;
+	using ObserverList = std::vector<std::shared_ptr<MediaRouteApplicationObserver>>;
+	std::shared_ptr<const ObserverList> _observers = std::make_shared<const ObserverList>();
+	ov::ProfiledMutex _observers_lock{"MediaRouteApplication::_observers_lock"};
+	// Increased whenever _observers is replaced, so the workers reload their snapshot only when it has changed
+	std::atomic<uint64_t> _observers_version = 0;
+
+	std::shared_ptr<const ObserverList> GetObservers() const;
 
 	// Information of MediaStream instance
 	// Inbound Streams
@@ -135,7 +150,7 @@ private:
 	// Outbound Streams
 	// Key : Stream.id
 	std::map<uint32_t, std::shared_ptr<MediaRouteStream>> _outbound_streams;
-	std::shared_mutex _streams_lock;
+	ov::ProfiledSharedMutex _streams_lock{"MediaRouteApplication::_streams_lock"};
 
 private:
 	uint32_t GetWorkerIDByStreamID(info::stream_id_t stream_id);
@@ -149,6 +164,9 @@ private:
 	uint32_t _max_worker_thread_count;
 
 private:
-	std::vector<std::shared_ptr<ov::ManagedQueue<std::shared_ptr<MediaRouteStream>>>> _inbound_stream_indicator;
-	std::vector<std::shared_ptr<ov::ManagedQueue<std::shared_ptr<MediaRouteStream>>>> _outbound_stream_indicator;
+	// In ring buffer mode, the producers do not lock the queue or wake up the worker while it is busy
+	using StreamIndicatorQueue = ov::ManagedQueue<std::shared_ptr<MediaRouteStream>, ov::ManagedQueueRingBuffer<1024>>;
+
+	std::vector<std::shared_ptr<StreamIndicatorQueue>> _inbound_stream_indicator;
+	std::vector<std::shared_ptr<StreamIndicatorQueue>> _outbound_stream_indicator;
 };
@@ -29,17 +29,21 @@
 #include "mediarouter_stream.h"
 
 #include <base/ovlibrary/ovlibrary.h>
+#include <config/config.h>
 #include <modules/bitstream/aac/aac_adts.h>
 #include <modules/bitstream/aac/aac_converter.h>
 #include <modules/bitstream/aac/aac_specific_config.h>
+#include <modules/bitstream/av1/av1_codec_configuration_record.h>
 #include <modules/bitstream/h264/h264_converter.h>
 #include <modules/bitstream/h264/h264_decoder_configuration_record.h>
 #include <modules/bitstream/h264/h264_nal_unit_types.h>
 #include <modules/bitstream/h264/h264_parser.h>
+#include <modules/bitstream/h265/h265_decoder_configuration_record.h>
 #include <modules/bitstream/h265/h265_parser.h>
 #include <modules/bitstream/nalu/nal_unit_fragment_header.h>
 #include <modules/bitstream/opus/opus.h>
 #include <modules/bitstream/vp8/vp8.h>
+#include <modules/bitstream/vp9/vp9_parser.h>
 
 #include "mediarouter_private.h"
 
@@ -49,7 +53,8 @@ using namespace cmn;
 
 MediaRouteStream::MediaRouteStream(const std::shared_ptr<info::Stream> &stream)
 	: _stream(stream),
-	  _packets_queue(nullptr, 100)
+	  _packets_queue(nullptr, 100),
+	  _data_packets_queue(nullptr, 100)
 {
 	_inout_type = MediaRouterStreamType::UNKNOWN;
 
@@ -74,6 +79,13 @@ MediaRouteStream::~MediaRouteStream()
 	_stat_recv_pkt_ldts.clear();
 
 	_pts_last.clear();
+
+	auto memory_metrics = std::atomic_load(&_memory_metrics);
+	if (memory_metrics != nullptr)
+	{
+		memory_metrics->Set(mon::MemoryComponent::MediaRouterQueue, 0);
+		memory_metrics->Set(mon::MemoryComponent::GopCache, 0);
+	}
 }
 
 std::shared_ptr<info::Stream> MediaRouteStream::GetStream()
@@ -85,8 +97,22 @@ void MediaRouteStream::SetInoutType(MediaRouterStreamType inout_type)
 {
 	_inout_type = inout_type;
 
+	if (_inout_type == MediaRouterStreamType::OUTBOUND)
+	{
+		auto &gop_cache_config = cfg::ConfigManager::GetInstance()->GetServer()->GetModules().GetGopCache();
+
+		_gop_cache_enabled = gop_cache_config.IsEnabled();
+		_gop_cache_max_duration_ms = gop_cache_config.GetMaxDuration();
+		_gop_cache_max_bytes = gop_cache_config.GetMaxBytes();
+
+		_interactive = _stream->GetApplicationInfo().GetConfig().GetPublishers().GetWebrtcPublisher().IsInteractive();
+	}
+
 	auto urn = info::ManagedQueue::URN(_stream->GetApplicationInfo().GetName().CStr(), _stream->GetName().CStr(), _inout_type == MediaRouterStreamType::INBOUND ? "imr" : "omr", "streamworker");
 	_packets_queue.SetUrn(urn.CStr());
+
+	auto data_urn = info::ManagedQueue::URN(_stream->GetApplicationInfo().GetName().CStr(), _stream->GetName().CStr(), _inout_type == MediaRouterStreamType::INBOUND ? "imr" : "omr", "datalane");
+	_data_packets_queue.SetUrn(data_urn.CStr());
 }
 
 MediaRouterStreamType MediaRouteStream::GetInoutType()
@@ -108,12 +134,127 @@ void MediaRouteStream::Flush()
 {
 	// Clear queued packets
 	_packets_queue.Clear();
+	_data_packets_queue.Clear();
+	_queued_bytes = 0;
 	// Clear stashed Packets
 	_media_packet_stash.clear();
+	_media_packet_stash_time_us.clear();
+	_last_dts_map.clear();
 
 	_are_all_tracks_parsed = false;
 
 	_is_stream_prepared = false;
+
+	ClearGopCache();
+}
+
+std::vector<std::shared_ptr<MediaPacket>> MediaRouteStream::GetGopCache()
+{
+	std::lock_guard<std::mutex> lock(_gop_cache_lock);
+
+	return _gop_cache;
+}
+
+void MediaRouteStream::ClearGopCache()
+{
+	std::lock_guard<std::mutex> lock(_gop_cache_lock);
+
+	_gop_cache.clear();
+	_gop_cache_bytes = 0;
+	_gop_cache_duration_ms = 0;
+
+	if (_stream_metrics != nullptr)
+	{
+		_stream_metrics->UpdateGopCache(0, 0, 0);
+	}
+
+	auto memory_metrics = std::atomic_load(&_memory_metrics);
+	if (memory_metrics != nullptr)
+	{
+		memory_metrics->Set(mon::MemoryComponent::GopCache, 0);
+	}
+}
+
+void MediaRouteStream::UpdateGopCache(const std::shared_ptr<MediaTrack> &media_track, const std::shared_ptr<MediaPacket> &media_packet)
+{
+	if (_gop_cache_track_found == false)
+	{
+		// Audio-only streams don't need the GOP cache because every packet can be played independently
+		for (const auto &[track_id, track] : _stream->GetTracks())
+		{
+			if (track->GetMediaType() == MediaType::Video)
+			{
+				_gop_cache_track_id = track_id;
+				_gop_cache_track_found = true;
+				break;
+			}
+		}
+
+		if (_gop_cache_track_found == false)
+		{
+			return;
+		}
+	}
+
+	if ((_memory_metrics != nullptr) && (_memory_metrics->GetPressure() != mon::MemoryPressure::Normal))
+	{
+		// The GOP cache is only for the fast start of the players, so it is the first to be released under the memory pressure
+		if (_gop_cache_bytes > 0)
+		{
+			logtw("[%s/%s(%u)] The GOP cache is released because the stream uses too much memory",
+				  _stream->GetApplicationName(), _stream->GetName().CStr(), _stream->GetId());
+			ClearGopCache();
+		}
+
+		return;
+	}
+
+	int64_t timestamp_ms = static_cast<int64_t>(media_packet->GetDts() * media_track->GetTimeBase().GetExpr() * 1000);
+
+	std::lock_guard<std::mutex> lock(_gop_cache_lock);
+
+	if ((media_packet->GetTrackId() == _gop_cache_track_id) && (media_packet->GetFlag() == MediaPacketFlag::Key))
+	{
+		// A new GOP starts
+		_gop_cache.clear();
+		_gop_cache_bytes = 0;
+		_gop_cache_start_ms = timestamp_ms;
+		_gop_cache_duration_ms = 0;
+
+		if (_stream_metrics == nullptr)
+		{
+			_stream_metrics = StreamMetrics(*_stream);
+		}
+	}
+	else if (_gop_cache.empty())
+	{
+		// Wait for the key frame
+		return;
+	}
+
+	_gop_cache.push_back(media_packet);
+	_gop_cache_bytes += media_packet->GetDataLength();
+	_gop_cache_duration_ms = std::max(_gop_cache_duration_ms, timestamp_ms - _gop_cache_start_ms);
+
+	if ((_gop_cache_bytes > _gop_cache_max_bytes) || (_gop_cache_duration_ms > _gop_cache_max_duration_ms))
+	{
+		logtd("[%s/%s(%u)] The GOP exceeds the limit of the GOP cache (%" PRId64 " bytes, %" PRId64 " ms), so it is not cached",
+			  _stream->GetApplicationName(), _stream->GetName().CStr(), _stream->GetId(), _gop_cache_bytes, _gop_cache_duration_ms);
+
+		_gop_cache.clear();
+		_gop_cache_bytes = 0;
+		_gop_cache_duration_ms = 0;
+	}
+
+	if (_stream_metrics != nullptr)
+	{
+		_stream_metrics->UpdateGopCache(_gop_cache_bytes, _gop_cache_duration_ms, static_cast<int32_t>(_gop_cache.size()));
+	}
+
+	if (_memory_metrics != nullptr)
+	{
+		_memory_metrics->Set(mon::MemoryComponent::GopCache, _gop_cache_bytes);
+	}
 }
 
 #include <base/ovcrypto/base_64.h>
@@ -174,52 +315,79 @@ bool MediaRouteStream::ProcessH264AVCCStream(std::shared_ptr<MediaTrack> &media_
 	// Convert to AnnexB and Insert SPS/PPS if there are no SPS/PPS nal units.
 	else if (media_packet->GetPacketType() == cmn::PacketType::NALU)
 	{
-		auto converted_data = std::make_shared<ov::Data>(media_packet->GetDataLength() + (media_packet->GetDataLength() / 2));
 		FragmentationHeader fragment_header;
-		size_t nalu_offset = 0;
+		std::shared_ptr<ov::Data> converted_data;
 
 		const uint8_t START_CODE[4] = {0x00, 0x00, 0x00, 0x01};
 		const size_t START_CODE_LEN = sizeof(START_CODE);
 
-		bool has_idr = false;
-		bool has_sps = false;
-		bool has_pps = false;
-
-		ov::ByteStream read_stream(media_packet->GetData());
-		while (read_stream.Remained() > 0)
+		// The packet is not delivered to anyone yet, so the lengths are replaced with the start codes in place
+		if (H264Converter::ConvertAvccToAnnexbInPlace(*media_packet->GetData(), &fragment_header) == true)
 		{
-			if (read_stream.IsRemained(4) == false)
-			{
-				logte("Not enough data to parse NAL");
-				return false;
-			}
+			converted_data = media_packet->GetData();
+		}
+		else
+		{
+			converted_data = std::make_shared<ov::Data>(media_packet->GetDataLength() + (media_packet->GetDataLength() / 2));
+			size_t nalu_offset = 0;
 
-			size_t nal_length = read_stream.ReadBE32();
-			if (read_stream.IsRemained(nal_length) == false)
+			ov::ByteStream read_stream(media_packet->GetData());
+			while (read_stream.Remained() > 0)
 			{
-				logte("NAL length (%d) is greater than buffer length (%d)", nal_length, read_stream.Remained());
-				return false;
-			}
+				if (read_stream.IsRemained(4) == false)
+				{
+					logte("Not enough data to parse NAL");
+					return false;
+				}
+
+				size_t nal_length = read_stream.ReadBE32();
+				if (read_stream.IsRemained(nal_length) == false)
+				{
+					logte("NAL length (%d) is greater than buffer length (%d)", nal_length, read_stream.Remained());
+					return false;
+				}
 
-			// Convert to AnnexB
-			auto nalu = read_stream.GetRemainData(nal_length);
+				// Convert to AnnexB
+				auto nalu = read_stream.GetRemainData(nal_length);
 
-			// Exception handling for encoder that transmits AVCC in non-standard format ([Size][Start Code][NalU])
-			if ((nalu->GetLength() > 3 && nalu->GetDataAs<uint8_t>()[0] == 0x00 && nalu->GetDataAs<uint8_t>()[1] == 0x00 && nalu->GetDataAs<uint8_t>()[2] == 0x01) ||
-				(nalu->GetLength() > 4 && nalu->GetDataAs<uint8_t>()[0] == 0x00 && nalu->GetDataAs<uint8_t>()[1] == 0x00 && nalu->GetDataAs<uint8_t>()[2] == 0x00 && nalu->GetDataAs<uint8_t>()[3] == 0x01))
-			{
-				size_t start_code_size = (nalu->GetDataAs<uint8_t>()[2] == 0x01) ? 3 : 4;
+				// Exception handling for encoder that transmits AVCC in non-standard format ([Size][Start Code][NalU])
+				if ((nalu->GetLength() > 3 && nalu->GetDataAs<uint8_t>()[0] == 0x00 && nalu->GetDataAs<uint8_t>()[1] == 0x00 && nalu->GetDataAs<uint8_t>()[2] == 0x01) ||
+					(nalu->GetLength() > 4 && nalu->GetDataAs<uint8_t>()[0] == 0x00 && nalu->GetDataAs<uint8_t>()[1] == 0x00 && nalu->GetDataAs<uint8_t>()[2] == 0x00 && nalu->GetDataAs<uint8_t>()[3] == 0x01))
+				{
+					size_t start_code_size = (nalu->GetDataAs<uint8_t>()[2] == 0x01) ? 3 : 4;
 
-				read_stream.Skip(start_code_size);
-				nal_length -= start_code_size;
-				nalu = read_stream.GetRemainData(nal_length);
+					read_stream.Skip(start_code_size);
+					nal_length -= start_code_size;
+					nalu = read_stream.GetRemainData(nal_length);
+				}
+
+				[[maybe_unused]] auto skipped = read_stream.Skip(nal_length);
+				OV_ASSERT2(skipped == nal_length);
+
+				converted_data->Append(START_CODE, sizeof(START_CODE));
+				nalu_offset += START_CODE_LEN;
+
+				fragment_header.fragmentation_offset.push_back(nalu_offset);
+				fragment_header.fragmentation_length.push_back(nalu->GetLength());
+
+				converted_data->Append(nalu);
+				nalu_offset += nalu->GetLength();
 			}
+		}
+
+		bool has_idr = false;
+		bool has_sps = false;
+		bool has_pps = false;
 
-			[[maybe_unused]] auto skipped = read_stream.Skip(nal_length);
-			OV_ASSERT2(skipped == nal_length);
+		for (size_t i = 0; i < fragment_header.fragmentation_offset.size(); i++)
+		{
+			if (fragment_header.fragmentation_length[i] < H264_NAL_UNIT_HEADER_SIZE)
+			{
+				continue;
+			}
 
 			H264NalUnitHeader nal_header;
-			if (H264Parser::ParseNalUnitHeader(nalu->GetDataAs<uint8_t>(), H264_NAL_UNIT_HEADER_SIZE, nal_header) == true)
+			if (H264Parser::ParseNalUnitHeader(converted_data->GetDataAs<uint8_t>() + fragment_header.fragmentation_offset[i], H264_NAL_UNIT_HEADER_SIZE, nal_header) == true)
 			{
 				// logtd("nal_unit_type : %s", NalUnitTypeToStr((uint8_t)nal_header.GetNalUnitType()).CStr());
 
@@ -230,24 +398,13 @@ bool MediaRouteStream::ProcessH264AVCCStream(std::shared_ptr<MediaTrack> &media_
 				}
 				else if (nal_header.GetNalUnitType() == H264NalUnitType::Sps)
 				{
-					// logtd("[SPS] %s ", ov::Base64::Encode(nalu).CStr());
 					has_sps = true;
 				}
 				else if (nal_header.GetNalUnitType() == H264NalUnitType::Pps)
 				{
-					// logtd("[PPS] %s ", ov::Base64::Encode(nalu).CStr());
 					has_pps = true;
 				}
 			}
-
-			converted_data->Append(START_CODE, sizeof(START_CODE));
-			nalu_offset += START_CODE_LEN;
-
-			fragment_header.fragmentation_offset.push_back(nalu_offset);
-			fragment_header.fragmentation_length.push_back(nalu->GetLength());
-
-			converted_data->Append(nalu);
-			nalu_offset += nalu->GetLength();
 		}
 
 		if (has_idr == true && (has_sps == false || has_pps == false) && 
@@ -311,6 +468,7 @@ bool MediaRouteStream::ProcessH264AnnexBStream(std::shared_ptr<MediaTrack> &medi
 	auto bitstream = media_packet->GetData()->GetDataAs<uint8_t>();
 	auto bitstream_length = media_packet->GetData()->GetLength();
 	bool has_sps = false, has_pps = false, has_idr = false;
+	bool has_slice = false, has_reference_slice = false;
 	size_t annexb_start_code_size = 0;
 
 	while (offset < bitstream_length)
@@ -400,6 +558,12 @@ bool MediaRouteStream::ProcessH264AnnexBStream(std::shared_ptr<MediaTrack> &medi
 			media_packet->SetFlag(MediaPacketFlag::Key);
 		}
 
+		if (nal_header.GetNalUnitType() == H264NalUnitType::IdrSlice || nal_header.GetNalUnitType() == H264NalUnitType::NonIdrSlice)
+		{
+			has_slice = true;
+			has_reference_slice |= (nal_header.GetNalRefIdc() != 0);
+		}
+
 		// Last NalU
 		if (pos == -1)
 		{
@@ -409,6 +573,10 @@ bool MediaRouteStream::ProcessH264AnnexBStream(std::shared_ptr<MediaTrack> &medi
 		offset += pos;
 	}
 
+	// A picture that is not referenced by the other pictures can be dropped without breaking the decoding,
+	// so it is handled as the upper temporal layer (e.g. WebRTC sessions drop it when the network is congested)
+	media_packet->SetTemporalLayerId((has_slice && (has_reference_slice == false)) ? 1 : 0);
+
 	if (media_track->IsValid() == false &&
 		avc_decoder_configuration_record.NumOfSPS() > 0 && avc_decoder_configuration_record.NumOfPPS() > 0)
 	{
@@ -546,14 +714,52 @@ bool MediaRouteStream::ProcessAACAdtsStream(std::shared_ptr<MediaTrack> &media_t
 
 bool MediaRouteStream::ProcessH265AnnexBStream(std::shared_ptr<MediaTrack> &media_track, std::shared_ptr<MediaPacket> &media_packet)
 {
-	// Everytime : Generate fragmentation header, Check key frame
+	// Everytime : Generate fragmentation header, Check key frame, Append VPS/SPS/PPS nal units in front of IRAP frame
 	// One time : Parse SPS and Set width/height (track information)
 
-	// TODO : Append SPS/PPS nal units in front of IDR frame
+	// HEVCDecoderConfigurationRecord (e.g. Enhanced RTMP)
+	if (media_packet->GetPacketType() == cmn::PacketType::SEQUENCE_HEADER)
+	{
+		HEVCDecoderConfigurationRecord config;
+		if (HEVCDecoderConfigurationRecord::Parse(media_packet->GetData()->GetDataAs<uint8_t>(), media_packet->GetDataLength(), config) == false)
+		{
+			logte("Could not parse sequence header");
+			return false;
+		}
+
+		auto &vps_list = config.GetNalUnits(H265NALUnitType::VPS);
+		auto &sps_list = config.GetNalUnits(H265NALUnitType::SPS);
+		auto &pps_list = config.GetNalUnits(H265NALUnitType::PPS);
+
+		if (vps_list.empty() || sps_list.empty() || pps_list.empty())
+		{
+			logte("There is no VPS/SPS/PPS in the sequence header");
+			return false;
+		}
+
+		H265SPS sps;
+		if (H265Parser::ParseSPS(sps_list[0]->GetDataAs<uint8_t>(), sps_list[0]->GetLength(), sps) == false)
+		{
+			logte("Could not parse H265 SPS Unit");
+			return false;
+		}
+
+		media_track->SetWidth(sps.GetWidth());
+		media_track->SetHeight(sps.GetHeight());
+
+		media_track->SetCodecComponentData(MediaTrack::CodecComponentDataType::HEVCVps, vps_list[0]);
+		media_track->SetCodecComponentData(MediaTrack::CodecComponentDataType::HEVCSps, sps_list[0]);
+		media_track->SetCodecComponentData(MediaTrack::CodecComponentDataType::HEVCPps, pps_list[0]);
+		media_track->SetCodecComponentData(MediaTrack::CodecComponentDataType::HEVCDecoderConfigurationRecord, media_packet->GetData());
+
+		// The sequence header is not a frame
+		return false;
+	}
 
 	auto bitstream = media_packet->GetData()->GetDataAs<uint8_t>();
 	auto bitstream_length = media_packet->GetData()->GetLength();
 	FragmentationHeader fragment_header;
+	bool has_vps = false, has_sps = false, has_pps = false, has_irap = false;
 
 	size_t offset = 0, offset_length = 0;
 	while (offset < bitstream_length)
@@ -597,14 +803,33 @@ bool MediaRouteStream::ProcessH265AnnexBStream(std::shared_ptr<MediaTrack> &medi
 			header.GetNalUnitType() == H265NALUnitType::CRA_NUT ||
 			header.GetNalUnitType() == H265NALUnitType::BLA_W_RADL)
 		{
+			has_irap = true;
 			media_packet->SetFlag(MediaPacketFlag::Key);
-			return true;
 		}
+		else if (header.GetNalUnitType() == H265NALUnitType::VPS)
+		{
+			has_vps = true;
 
-		// Track info
-		if (media_track->IsValid() == false)
+			if (media_track->IsValid() == false)
+			{
+				media_track->SetCodecComponentData(MediaTrack::CodecComponentDataType::HEVCVps, std::make_shared<ov::Data>(bitstream + offset, offset_length));
+			}
+		}
+		else if (header.GetNalUnitType() == H265NALUnitType::PPS)
 		{
-			if (header.GetNalUnitType() == H265NALUnitType::SPS)
+			has_pps = true;
+
+			if (media_track->IsValid() == false)
+			{
+				media_track->SetCodecComponentData(MediaTrack::CodecComponentDataType::HEVCPps, std::make_shared<ov::Data>(bitstream + offset, offset_length));
+			}
+		}
+		else if (header.GetNalUnitType() == H265NALUnitType::SPS)
+		{
+			has_sps = true;
+
+			// Track info
+			if (media_track->IsValid() == false)
 			{
 				H265SPS sps;
 				if (H265Parser::ParseSPS(bitstream + offset, offset_length, sps) == false)
@@ -616,10 +841,50 @@ bool MediaRouteStream::ProcessH265AnnexBStream(std::shared_ptr<MediaTrack> &medi
 
 				media_track->SetWidth(sps.GetWidth());
 				media_track->SetHeight(sps.GetHeight());
+				media_track->SetCodecComponentData(MediaTrack::CodecComponentDataType::HEVCSps, std::make_shared<ov::Data>(bitstream + offset, offset_length));
 			}
 		}
 	}
 
+	// Bitstreams whose parameter sets are carried out-of-band (HEVCDecoderConfigurationRecord) need them in front of IRAP
+	if (has_irap && (has_vps == false || has_sps == false || has_pps == false) &&
+		media_track->HasCodecComponentData(MediaTrack::CodecComponentDataType::HEVCVps) == true &&
+		media_track->HasCodecComponentData(MediaTrack::CodecComponentDataType::HEVCSps) == true &&
+		media_track->HasCodecComponentData(MediaTrack::CodecComponentDataType::HEVCPps) == true)
+	{
+		const uint8_t START_CODE[4] = {0x00, 0x00, 0x00, 0x01};
+
+		auto processed_data = std::make_shared<ov::Data>(bitstream_length + 1024);
+		FragmentationHeader updated_frag_header;
+
+		for (auto type : {MediaTrack::CodecComponentDataType::HEVCVps, MediaTrack::CodecComponentDataType::HEVCSps, MediaTrack::CodecComponentDataType::HEVCPps})
+		{
+			auto parameter_set = media_track->GetCodecComponentData(type);
+
+			processed_data->Append(START_CODE, sizeof(START_CODE));
+			updated_frag_header.fragmentation_offset.push_back(processed_data->GetLength());
+			updated_frag_header.fragmentation_length.push_back(parameter_set->GetLength());
+			processed_data->Append(parameter_set);
+		}
+
+		// Existing fragment header offset because VPS/SPS/PPS was inserted at front
+		auto offset_offset = processed_data->GetLength();
+		for (size_t i = 0; i < fragment_header.fragmentation_offset.size(); i++)
+		{
+			updated_frag_header.fragmentation_offset.push_back(fragment_header.fragmentation_offset[i] + offset_offset);
+			updated_frag_header.fragmentation_length.push_back(fragment_header.fragmentation_length[i]);
+		}
+
+		processed_data->Append(media_packet->GetData());
+
+		media_packet->SetFragHeader(&updated_frag_header);
+		media_packet->SetData(processed_data);
+	}
+	else
+	{
+		media_packet->SetFragHeader(&fragment_header);
+	}
+
 	return true;
 }
 
@@ -649,6 +914,141 @@ bool MediaRouteStream::ProcessVP8Stream(std::shared_ptr<MediaTrack> &media_track
 	return true;
 }
 
+bool MediaRouteStream::ProcessVP9Stream(std::shared_ptr<MediaTrack> &media_track, std::shared_ptr<MediaPacket> &media_packet)
+{
+	// Everytime : Check key frame
+	// One time : Parse width, height
+	VP9Parser parser;
+	if (VP9Parser::Parse(media_packet->GetData()->GetDataAs<uint8_t>(), media_packet->GetDataLength(), parser) == false)
+	{
+		logte("Could not parse VP9 header");
+		return false;
+	}
+
+	if (parser.IsKeyFrame())
+	{
+		media_packet->SetFlag(MediaPacketFlag::Key);
+
+		if (media_track->IsValid() == false)
+		{
+			media_track->SetWidth(parser.GetWidth());
+			media_track->SetHeight(parser.GetHeight());
+		}
+	}
+	else
+	{
+		media_packet->SetFlag(MediaPacketFlag::NoFlag);
+	}
+
+	return true;
+}
+
+bool MediaRouteStream::ProcessAV1Stream(std::shared_ptr<MediaTrack> &media_track, std::shared_ptr<MediaPacket> &media_packet)
+{
+	// Everytime : Check key frame, Insert the sequence header in front of the key frame if it is carried out-of-band
+	// One time : Parse the sequence header and Set width/height, AV1CodecConfigurationRecord (track information)
+
+	// AV1CodecConfigurationRecord (e.g. Enhanced RTMP)
+	if (media_packet->GetPacketType() == cmn::PacketType::SEQUENCE_HEADER)
+	{
+		AV1CodecConfigurationRecord config;
+		if (AV1CodecConfigurationRecord::Parse(media_packet->GetData()->GetDataAs<uint8_t>(), media_packet->GetDataLength(), config) == false)
+		{
+			logte("Could not parse sequence header");
+			return false;
+		}
+
+		auto config_obus = config.ConfigObus();
+
+		std::vector<AV1Obu> obu_list;
+		if (AV1Parser::ParseObuList(config_obus->GetDataAs<uint8_t>(), config_obus->GetLength(), obu_list) == false)
+		{
+			logte("Could not parse configOBUs of the sequence header");
+			return false;
+		}
+
+		auto sequence_header_obu = AV1Parser::FindObu(obu_list, AV1ObuType::SequenceHeader);
+		AV1SequenceHeader sequence_header;
+		if ((sequence_header_obu == nullptr) ||
+			(AV1Parser::ParseSequenceHeader(sequence_header_obu->payload, sequence_header_obu->payload_length, sequence_header) == false))
+		{
+			logte("Could not parse AV1 sequence header OBU");
+			return false;
+		}
+
+		media_track->SetWidth(sequence_header.GetWidth());
+		media_track->SetHeight(sequence_header.GetHeight());
+
+		media_track->SetCodecComponentData(MediaTrack::CodecComponentDataType::AV1CodecConfigurationRecord, media_packet->GetData());
+
+		// The sequence header is not a frame
+		return false;
+	}
+
+	auto bitstream = media_packet->GetData()->GetDataAs<uint8_t>();
+	auto bitstream_length = media_packet->GetData()->GetLength();
+
+	std::vector<AV1Obu> obu_list;
+	if (AV1Parser::ParseObuList(bitstream, bitstream_length, obu_list) == false)
+	{
+		logte("Could not parse AV1 temporal unit");
+		return false;
+	}
+
+	auto sequence_header_obu = AV1Parser::FindObu(obu_list, AV1ObuType::SequenceHeader);
+
+	// Track info
+	if ((sequence_header_obu != nullptr) &&
+		((media_track->IsValid() == false) || (media_track->HasCodecComponentData(MediaTrack::CodecComponentDataType::AV1CodecConfigurationRecord) == false)))
+	{
+		AV1SequenceHeader sequence_header;
+		if (AV1Parser::ParseSequenceHeader(sequence_header_obu->payload, sequence_header_obu->payload_length, sequence_header) == false)
+		{
+			logte("Could not parse AV1 sequence header OBU");
+			return false;
+		}
+
+		media_track->SetWidth(sequence_header.GetWidth());
+		media_track->SetHeight(sequence_header.GetHeight());
+
+		media_track->SetCodecComponentData(MediaTrack::CodecComponentDataType::AV1CodecConfigurationRecord, AV1CodecConfigurationRecord::Build(*sequence_header_obu, sequence_header));
+	}
+
+	if (AV1Parser::IsKeyFrame(obu_list) == false)
+	{
+		return true;
+	}
+
+	media_packet->SetFlag(MediaPacketFlag::Key);
+
+	// Bitstreams whose sequence header is carried out-of-band (AV1CodecConfigurationRecord) need it in front of the key frame
+	if ((sequence_header_obu == nullptr) &&
+		(media_track->HasCodecComponentData(MediaTrack::CodecComponentDataType::AV1CodecConfigurationRecord) == true))
+	{
+		AV1CodecConfigurationRecord config;
+		auto config_data = media_track->GetCodecComponentData(MediaTrack::CodecComponentDataType::AV1CodecConfigurationRecord);
+
+		if (AV1CodecConfigurationRecord::Parse(config_data->GetDataAs<uint8_t>(), config_data->GetLength(), config) == true)
+		{
+			auto processed_data = std::make_shared<ov::Data>(bitstream_length + config.ConfigObus()->GetLength());
+
+			// The temporal delimiter must be the first OBU of the temporal unit
+			size_t offset = 0;
+			if ((obu_list.empty() == false) && (obu_list[0].type == AV1ObuType::TemporalDelimiter))
+			{
+				offset = obu_list[0].length;
+				processed_data->Append(bitstream, offset);
+			}
+
+			processed_data->Append(config.ConfigObus());
+			processed_data->Append(bitstream + offset, bitstream_length - offset);
+			media_packet->SetData(processed_data);
+		}
+	}
+
+	return true;
+}
+
 bool MediaRouteStream::ProcessOPUSStream(std::shared_ptr<MediaTrack> &media_track, std::shared_ptr<MediaPacket> &media_packet)
 {
 	// One time : parse samplerate, channel
@@ -689,6 +1089,12 @@ bool MediaRouteStream::ProcessInboundStream(std::shared_ptr<MediaTrack> &media_t
 		case cmn::BitstreamFormat::VP8:
 			result = ProcessVP8Stream(media_track, media_packet);
 			break;
+		case cmn::BitstreamFormat::VP9:
+			result = ProcessVP9Stream(media_track, media_packet);
+			break;
+		case cmn::BitstreamFormat::AV1:
+			result = ProcessAV1Stream(media_track, media_packet);
+			break;
 		case cmn::BitstreamFormat::AAC_RAW:
 			result = ProcessAACRawStream(media_track, media_packet);
 			break;
@@ -731,6 +1137,12 @@ bool MediaRouteStream::ProcessOutboundStream(std::shared_ptr<MediaTrack> &media_
 		case cmn::BitstreamFormat::VP8:
 			result = ProcessVP8Stream(media_track, media_packet);
 			break;
+		case cmn::BitstreamFormat::VP9:
+			result = ProcessVP9Stream(media_track, media_packet);
+			break;
+		case cmn::BitstreamFormat::AV1:
+			result = ProcessAV1Stream(media_track, media_packet);
+			break;
 		case cmn::BitstreamFormat::AAC_RAW:
 			result = ProcessAACRawStream(media_track, media_packet);
 			break;
@@ -975,6 +1387,7 @@ void MediaRouteStream::DropNonDecodingPackets()
 
 		if (media_packet->GetPts() < map_near_pts[media_packet->GetTrackId()].second)
 		{
+			_queued_bytes -= media_packet->GetDataLength();
 			dropped_packets++;
 			continue;
 		}
@@ -991,18 +1404,49 @@ void MediaRouteStream::DropNonDecodingPackets()
 
 void MediaRouteStream::Push(std::shared_ptr<MediaPacket> media_packet)
 {
+	_queued_bytes += media_packet->GetDataLength();
+
+	if (media_packet->GetMediaType() == MediaType::Data)
+	{
+		_data_packets_queue.Enqueue(std::move(media_packet));
+		return;
+	}
+
 	_packets_queue.Enqueue(std::move(media_packet));
 }
 
+bool MediaRouteStream::HasPendingPackets()
+{
+	return (_data_packets_queue.IsEmpty() == false) || (_packets_queue.IsEmpty() == false);
+}
+
+bool MediaRouteStream::MarkAsPending()
+{
+	return _is_pending.exchange(true) == false;
+}
+
+void MediaRouteStream::ClearPending()
+{
+	_is_pending = false;
+}
+
 std::shared_ptr<MediaPacket> MediaRouteStream::Pop()
 {
-	// Get Media Packet
-	if (_packets_queue.IsEmpty())
+	// Get Media Packet (the data packets first)
+	std::optional<std::shared_ptr<MediaPacket>> media_packet_ref;
+	if (_data_packets_queue.IsEmpty() == false)
+	{
+		media_packet_ref = _data_packets_queue.Dequeue();
+	}
+	else if (_packets_queue.IsEmpty() == false)
+	{
+		media_packet_ref = _packets_queue.Dequeue();
+	}
+	else
 	{
 		return nullptr;
 	}
 
-	auto media_packet_ref = _packets_queue.Dequeue();
 	if (media_packet_ref.has_value() == false)
 	{
 		return nullptr;
@@ -1010,6 +1454,22 @@ std::shared_ptr<MediaPacket> MediaRouteStream::Pop()
 
 	auto &media_packet = media_packet_ref.value();
 
+	_queued_bytes -= media_packet->GetDataLength();
+
+	if (_memory_metrics == nullptr)
+	{
+		auto stream_metrics = StreamMetrics(*_stream);
+		if (stream_metrics != nullptr)
+		{
+			std::atomic_store(&_memory_metrics, stream_metrics->GetMemoryMetrics());
+		}
+	}
+
+	if (_memory_metrics != nullptr)
+	{
+		_memory_metrics->Set(mon::MemoryComponent::MediaRouterQueue, _queued_bytes);
+	}
+
 	////////////////////////////////////////////////////////////////////////////////////
 	// [ Calculating Packet Timestamp, Duration]
 
@@ -1030,13 +1490,43 @@ std::shared_ptr<MediaPacket> MediaRouteStream::Pop()
 	//	- 3) and then, the current packet stash.
 	std::shared_ptr<MediaPacket> pop_media_packet = nullptr;
 
-	if ( (GetInoutType() == MediaRouterStreamType::OUTBOUND) && 
+	if ((GetInoutType() == MediaRouterStreamType::OUTBOUND) && (_interactive == true) &&
+		(media_packet->GetMediaType() == MediaType::Video || media_packet->GetMediaType() == MediaType::Audio))
+	{
+		// The packet is delivered without waiting for the next packet (it holds a frame interval),
+		// so the duration is the interval from the previous packet
+		auto track_id = media_packet->GetTrackId();
+		auto it = _last_dts_map.find(track_id);
+
+		if (it != _last_dts_map.end())
+		{
+			if (it->second >= media_packet->GetDts())
+			{
+				if (_warning_count_out_of_order++ < 10)
+				{
+					logtw("[%s/%s] Detected out of order DTS of packet. track_id:%d dts:%lld->%lld",
+						  _stream->GetApplicationName(), _stream->GetName().CStr(), track_id, it->second, media_packet->GetDts());
+				}
+
+				media_packet->SetPts(media_packet->GetPts() - media_packet->GetDts() + it->second + 1);
+				media_packet->SetDts(it->second + 1);
+			}
+
+			media_packet->SetDuration(media_packet->GetDts() - it->second);
+		}
+
+		_last_dts_map[track_id] = media_packet->GetDts();
+
+		pop_media_packet = std::move(media_packet);
+	}
+	else if ( (GetInoutType() == MediaRouterStreamType::OUTBOUND) && 
 		// The packet duration recalculation applies only to video and audio types.
 		 (media_packet->GetMediaType() == MediaType::Video || media_packet->GetMediaType() == MediaType::Audio) )
 	{
 		auto it = _media_packet_stash.find(media_packet->GetTrackId());
 		if (it == _media_packet_stash.end())
 		{
+			_media_packet_stash_time_us[media_packet->GetTrackId()] = (media_packet->GetTrace() != nullptr) ? ov::Clock::NowUSec() : 0;
 			_media_packet_stash[media_packet->GetTrackId()] = std::move(media_packet);
 
 			return nullptr;
@@ -1044,6 +1534,16 @@ std::shared_ptr<MediaPacket> MediaRouteStream::Pop()
 
 		pop_media_packet = std::move(it->second);
 
+		auto &stash_time_us = _media_packet_stash_time_us[pop_media_packet->GetTrackId()];
+		if (stash_time_us > 0)
+		{
+			auto stream_metrics = StreamMetrics(*_stream);
+			if (stream_metrics != nullptr)
+			{
+				stream_metrics->GetLatencyMetrics()->RecordBufferingDelay(mon::BufferingStage::MediaRouterStash, ov::Clock::NowUSec() - stash_time_us);
+			}
+		}
+
 		// [#743] Recording and HLS packetizing are failing due to non-monotonically increasing dts.
 		// So, the code below is a temporary measure to avoid this problem. A more fundamental solution should be considered.
 		if (pop_media_packet->GetDts() >= media_packet->GetDts())
@@ -1063,6 +1563,7 @@ std::shared_ptr<MediaPacket> MediaRouteStream::Pop()
 		int64_t duration = media_packet->GetDts() - pop_media_packet->GetDts();
 		pop_media_packet->SetDuration(duration);
 
+		stash_time_us = (media_packet->GetTrace() != nullptr) ? ov::Clock::NowUSec() : 0;
 		_media_packet_stash[media_packet->GetTrackId()] = std::move(media_packet);
 	}
 	else
@@ -1170,6 +1671,14 @@ std::shared_ptr<MediaPacket> MediaRouteStream::Pop()
 	// Statistics
 	UpdateStatistics(media_track, pop_media_packet);
 
+	// It is cached before being delivered to the publishers,
+	// so the cache always contains every packet that a publisher has received of the current GOP.
+	// The interactive stream does not keep the GOP, because the late joiners are not waited for.
+	if ((_gop_cache_enabled == true) && (_interactive == false))
+	{
+		UpdateGopCache(media_track, pop_media_packet);
+	}
+
 	return pop_media_packet;
 }
 
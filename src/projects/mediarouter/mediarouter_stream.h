@@ -10,7 +10,9 @@
 
 #include <stdint.h>
 
+#include <atomic>
 #include <memory>
+#include <mutex>
 #include <queue>
 #include <vector>
 
@@ -19,6 +21,7 @@
 #include "base/mediarouter/mediarouter_application_connector.h"
 #include "base/mediarouter/media_type.h"
 #include "modules/managed_queue/managed_queue.h"
+#include "monitoring/monitoring.h"
 
 enum class MediaRouterStreamType : int8_t
 {
@@ -45,6 +48,12 @@ public:
 	bool ProcessOutboundStream(std::shared_ptr<MediaTrack> &media_track,std::shared_ptr<MediaPacket> &media_packet);
 
 	std::shared_ptr<MediaPacket> Pop();
+	bool HasPendingPackets();
+
+	// Returns true if the stream was idle, so the caller has to enqueue it to the worker of MediaRouteApplication
+	bool MarkAsPending();
+	// Called by the worker before draining the packets of the stream
+	void ClearPending();
 
 	// Query original stream information
 	std::shared_ptr<info::Stream> GetStream();
@@ -54,8 +63,14 @@ public:
 	bool AreAllTracksReady();
 
 	void Flush();
+
+	// Packets from the last key frame of the first video track (outbound only, if the GopCache module is enabled)
+	std::vector<std::shared_ptr<MediaPacket>> GetGopCache();
 	
 private:
+	void UpdateGopCache(const std::shared_ptr<MediaTrack> &media_track, const std::shared_ptr<MediaPacket> &media_packet);
+	void ClearGopCache();
+
 	void DropNonDecodingPackets();
 
 	bool ProcessH264AVCCStream(std::shared_ptr<MediaTrack> &media_track, std::shared_ptr<MediaPacket> &media_packet);
@@ -64,11 +79,16 @@ private:
 	bool ProcessAACRawStream(std::shared_ptr<MediaTrack> &media_track, std::shared_ptr<MediaPacket> &media_packet);
 	bool ProcessAACAdtsStream(std::shared_ptr<MediaTrack> &media_track, std::shared_ptr<MediaPacket> &media_packet);
 	bool ProcessVP8Stream(std::shared_ptr<MediaTrack> &media_track, std::shared_ptr<MediaPacket> &media_packet);
+	bool ProcessVP9Stream(std::shared_ptr<MediaTrack> &media_track, std::shared_ptr<MediaPacket> &media_packet);
+	bool ProcessAV1Stream(std::shared_ptr<MediaTrack> &media_track, std::shared_ptr<MediaPacket> &media_packet);
 	bool ProcessOPUSStream(std::shared_ptr<MediaTrack> &media_track, std::shared_ptr<MediaPacket> &media_packet);
 
 	void UpdateStatistics(std::shared_ptr<MediaTrack> &media_track,  std::shared_ptr<MediaPacket> &media_packet);
 
 	bool _is_stream_prepared = false;
+
+	// true while the stream is queued to the worker of MediaRouteApplication
+	std::atomic<bool> _is_pending = false;
 	bool _are_all_tracks_parsed = false;
 
 	// Incoming/Outgoing Stream
@@ -82,9 +102,21 @@ private:
 
 	// Temporary packet store. for calculating packet duration
 	std::map<MediaTrackId, std::shared_ptr<MediaPacket>> _media_packet_stash;
+	// Time when the stashed packet is traced (0 if the packet is not traced), to report the delay of the stash
+	std::map<MediaTrackId, int64_t> _media_packet_stash_time_us;
+
+	// Interactive mode of the WebRTC publisher - the packets are not stashed, and the duration is estimated
+	// from the interval of the previous packet of the track (See cfg::vhost::app::pub::WebrtcPublisher::IsInteractive())
+	bool _interactive = false;
+	std::map<MediaTrackId, int64_t> _last_dts_map;
 
 	// Packets queue
-	ov::ManagedQueue<std::shared_ptr<MediaPacket>> _packets_queue;
+	ov::ManagedQueue<std::shared_ptr<MediaPacket>, ov::ManagedQueueRingBuffer<1024>> _packets_queue;
+	// Bytes of the packets in _packets_queue
+	std::atomic<int64_t> _queued_bytes = 0;
+	// Data packets (timed metadata) are queued separately and popped ahead of the media packets,
+	// so they are not delayed by the media packets queued before them
+	ov::ManagedQueue<std::shared_ptr<MediaPacket>> _data_packets_queue;
 
 	// TODO(Soulk) : Modified to use by tying statistical information into a class and creating a map with MediaTrackId as a key
 
@@ -114,6 +146,24 @@ private:
 	uint32_t _warning_count_bframe;
 	uint32_t _warning_count_out_of_order;
 
+	// GOP cache
+	bool _gop_cache_enabled = false;
+	int64_t _gop_cache_max_duration_ms = 0;
+	int64_t _gop_cache_max_bytes = 0;
+	// The track whose key frame starts the GOP
+	MediaTrackId _gop_cache_track_id = 0;
+	bool _gop_cache_track_found = false;
+	std::mutex _gop_cache_lock;
+	std::vector<std::shared_ptr<MediaPacket>> _gop_cache;
+	int64_t _gop_cache_bytes = 0;
+	int64_t _gop_cache_start_ms = 0;
+	int64_t _gop_cache_duration_ms = 0;
+	std::shared_ptr<mon::StreamMetrics> _stream_metrics;
+
+	// The bytes of _packets_queue and _gop_cache are reported to it.
+	// It is obtained in Pop() because the metrics of the stream may not be created when the packets are pushed.
+	std::shared_ptr<mon::MemoryMetrics> _memory_metrics;
+
 
 	void DumpPacket(std::shared_ptr<MediaPacket> &media_packet, bool dump = false);
 };
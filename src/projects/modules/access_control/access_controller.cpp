@@ -114,46 +114,22 @@ std::tuple<AccessController::VerificationResult, std::shared_ptr<const Admission
 		auto secret_key = webhooks_config.GetSecretKey();
 		auto timeout_msec = 500; //webhooks_config.GetTimeoutMsec();
 
-		std::shared_ptr<AdmissionWebhooks> admission_webhooks;
+		auto webhooks_request_info = std::make_shared<AdmissionWebhooks::RequestInfo>(request_url, request_info->GetNewUrl());
+		auto client_info = std::make_shared<AdmissionWebhooks::ClientInfo>(client_address, request_info->GetUserAgent());
+
+		// Nobody waits for the result of the closing webhooks, so they are sent in the background
 		if(_provider_type != ProviderType::Unknown)
 		{
-			auto webhooks_request_info = std::make_shared<AdmissionWebhooks::RequestInfo>(request_url, request_info->GetNewUrl());
-			auto client_info = std::make_shared<AdmissionWebhooks::ClientInfo>(client_address, request_info->GetUserAgent());
-
-			admission_webhooks = AdmissionWebhooks::Query(
+			AdmissionWebhooks::Notify(
 				_provider_type, control_server_url, timeout_msec, secret_key, webhooks_request_info, client_info, AdmissionWebhooks::Status::Code::CLOSING);
 		}
-		else if(_publisher_type != PublisherType::Unknown)
-		{
-			auto webhooks_request_info = std::make_shared<AdmissionWebhooks::RequestInfo>(request_url, request_info->GetNewUrl());
-			auto client_info = std::make_shared<AdmissionWebhooks::ClientInfo>(client_address, request_info->GetUserAgent());
-
-			admission_webhooks = AdmissionWebhooks::Query(
-				_publisher_type, control_server_url, timeout_msec, secret_key, webhooks_request_info, client_info, AdmissionWebhooks::Status::Code::CLOSING);
-		}
 		else
 		{
-			logte("Provider type or publisher type must be set");
-			return {AccessController::VerificationResult::Error, nullptr};
-		}
-
-		if(admission_webhooks == nullptr)
-		{
-			// Probably this doesn't happen
-			logte("Could not load admission webhooks");
-			return {AccessController::VerificationResult::Error, nullptr};
-		}
-
-		logti("AdmissionWebhooks queried %s whether client %s could access %s. (Result : %s Elapsed : %u ms)",
-			control_server_url_address.CStr(), client_address->ToString(false).CStr(), request_url->ToUrlString().CStr(),
-			admission_webhooks->GetErrCode()==AdmissionWebhooks::ErrCode::ALLOWED?"Allow":"Reject", admission_webhooks->GetElapsedTime());
-
-		if(admission_webhooks->GetErrCode() != AdmissionWebhooks::ErrCode::ALLOWED)
-		{
-			return {AccessController::VerificationResult::Fail, admission_webhooks};
+			AdmissionWebhooks::Notify(
+				_publisher_type, control_server_url, timeout_msec, secret_key, webhooks_request_info, client_info, AdmissionWebhooks::Status::Code::CLOSING);
 		}
 
-		return {AccessController::VerificationResult::Pass, admission_webhooks};
+		return {AccessController::VerificationResult::Pass, nullptr};
 	}
 
 	// Probably this doesn't happen
@@ -242,8 +218,9 @@ std::tuple<AccessController::VerificationResult, std::shared_ptr<const Admission
 			return {AccessController::VerificationResult::Error, nullptr};
 		}
 
-		logti("AdmissionWebhooks queried %s whether client %s could access %s. (Result : %s Elapsed : %u ms)",
-			control_server_url_address.CStr(), client_address->ToString(false).CStr(), request_url->ToUrlString().CStr(), admission_webhooks->GetErrCode()==AdmissionWebhooks::ErrCode::ALLOWED?"Allow":"Reject", admission_webhooks->GetElapsedTime());
+		logti("AdmissionWebhooks queried %s whether client %s could access %s. (Result : %s Elapsed : %u ms%s)",
+			control_server_url_address.CStr(), client_address->ToString(false).CStr(), request_url->ToUrlString().CStr(), admission_webhooks->GetErrCode()==AdmissionWebhooks::ErrCode::ALLOWED?"Allow":"Reject", admission_webhooks->GetElapsedTime(),
+			admission_webhooks->IsCached() ? ", Cached" : "");
 
 		if(admission_webhooks->GetErrCode() != AdmissionWebhooks::ErrCode::ALLOWED)
 		{
@@ -2,16 +2,121 @@
 
 #include <modules/http/client/http_client.h>
 
-std::shared_ptr<AdmissionWebhooks> AdmissionWebhooks::Query(ProviderType provider,
-															const std::shared_ptr<ov::Url> &control_server_url, uint32_t timeout_msec,
-															const ov::String secret_key,
-															const std::shared_ptr<const AdmissionWebhooks::RequestInfo> &request_info,
-															const std::shared_ptr<const AdmissionWebhooks::ClientInfo> &client_info,
-															const Status::Code status)
+#define OV_LOG_TAG "AdmissionWebhooks"
+
+// Notifications (closing status) are sent on these threads, not to delay the caller
+#define ADMISSION_WEBHOOKS_NOTIFICATION_THREAD_COUNT 2
+#define ADMISSION_WEBHOOKS_MAX_PENDING_NOTIFICATIONS 10000
+#define ADMISSION_WEBHOOKS_MAX_CACHE_ITEMS 10000
+
+namespace
+{
+	class NotificationQueue
+	{
+	public:
+		~NotificationQueue()
+		{
+			{
+				std::lock_guard lock_guard(_mutex);
+				_stop = true;
+			}
+
+			_condition.notify_all();
+
+			for (auto &thread : _threads)
+			{
+				if (thread.joinable())
+				{
+					thread.join();
+				}
+			}
+		}
+
+		void Push(const std::shared_ptr<AdmissionWebhooks> &hooks, std::function<void(const std::shared_ptr<AdmissionWebhooks> &)> runner)
+		{
+			{
+				std::lock_guard lock_guard(_mutex);
+
+				if (_stop)
+				{
+					return;
+				}
+
+				if (_queue.size() >= ADMISSION_WEBHOOKS_MAX_PENDING_NOTIFICATIONS)
+				{
+					logtw("Too many pending notifications (%zu), the notification is dropped", _queue.size());
+					return;
+				}
+
+				if (_threads.empty())
+				{
+					for (int index = 0; index < ADMISSION_WEBHOOKS_NOTIFICATION_THREAD_COUNT; index++)
+					{
+						_threads.emplace_back(&NotificationQueue::ThreadProc, this);
+						pthread_setname_np(_threads.back().native_handle(), "AWNotify");
+					}
+				}
+
+				_queue.emplace_back(hooks, std::move(runner));
+			}
+
+			_condition.notify_one();
+		}
+
+	private:
+		void ThreadProc()
+		{
+			while (true)
+			{
+				std::unique_lock lock(_mutex);
+				_condition.wait(lock, [this]() { return _stop || (_queue.empty() == false); });
+
+				if (_stop)
+				{
+					break;
+				}
+
+				auto [hooks, runner] = std::move(_queue.front());
+				_queue.pop_front();
+
+				lock.unlock();
+
+				runner(hooks);
+			}
+		}
+
+		std::mutex _mutex;
+		std::condition_variable _condition;
+		bool _stop = false;
+		std::vector<std::thread> _threads;
+		std::deque<std::pair<std::shared_ptr<AdmissionWebhooks>, std::function<void(const std::shared_ptr<AdmissionWebhooks> &)>>> _queue;
+	};
+
+	NotificationQueue g_notification_queue;
+
+	struct CachedResult
+	{
+		uint64_t expire_msec;
+		std::shared_ptr<ov::Url> new_url;
+		uint64_t lifetime;
+		ov::String reason;
+	};
+
+	std::mutex g_cache_mutex;
+	std::unordered_map<ov::String, CachedResult> g_cache;
+}  // namespace
+
+std::shared_ptr<AdmissionWebhooks> AdmissionWebhooks::Create(ProviderType provider, PublisherType publisher,
+															 const std::shared_ptr<ov::Url> &control_server_url, uint32_t timeout_msec,
+															 const ov::String &secret_key,
+															 const std::shared_ptr<const AdmissionWebhooks::RequestInfo> &request_info,
+															 const std::shared_ptr<const AdmissionWebhooks::ClientInfo> &client_info,
+															 const Status::Code status)
 {
 	auto hooks = std::make_shared<AdmissionWebhooks>();
 
 	hooks->_provider_type = provider;
+	hooks->_publisher_type = publisher;
 	hooks->_control_server_url = control_server_url;
 	hooks->_timeout_msec = timeout_msec;
 	hooks->_secret_key = secret_key;
@@ -19,7 +124,19 @@ std::shared_ptr<AdmissionWebhooks> AdmissionWebhooks::Query(ProviderType provide
 	hooks->_client_info = client_info;
 	hooks->_status = status;
 
-	hooks->Run();
+	return hooks;
+}
+
+std::shared_ptr<AdmissionWebhooks> AdmissionWebhooks::Query(ProviderType provider,
+															const std::shared_ptr<ov::Url> &control_server_url, uint32_t timeout_msec,
+															const ov::String secret_key,
+															const std::shared_ptr<const AdmissionWebhooks::RequestInfo> &request_info,
+															const std::shared_ptr<const AdmissionWebhooks::ClientInfo> &client_info,
+															const Status::Code status)
+{
+	auto hooks = Create(provider, PublisherType::Unknown, control_server_url, timeout_msec, secret_key, request_info, client_info, status);
+
+	hooks->Execute();
 
 	return hooks;
 }
@@ -31,21 +148,43 @@ std::shared_ptr<AdmissionWebhooks> AdmissionWebhooks::Query(PublisherType publis
 															const std::shared_ptr<const AdmissionWebhooks::ClientInfo> &client_info,
 															const Status::Code status)
 {
-	auto hooks = std::make_shared<AdmissionWebhooks>();
-
-	hooks->_publisher_type = publisher;
-	hooks->_control_server_url = control_server_url;
-	hooks->_timeout_msec = timeout_msec;
-	hooks->_secret_key = secret_key;
-	hooks->_request_info = request_info;
-	hooks->_client_info = client_info;
-	hooks->_status = status;
+	auto hooks = Create(ProviderType::Unknown, publisher, control_server_url, timeout_msec, secret_key, request_info, client_info, status);
 
-	hooks->Run();
+	hooks->Execute();
 
 	return hooks;
 }
 
+void AdmissionWebhooks::Notify(ProviderType provider,
+							   const std::shared_ptr<ov::Url> &control_server_url, uint32_t timeout_msec,
+							   const ov::String secret_key,
+							   const std::shared_ptr<const AdmissionWebhooks::RequestInfo> &request_info,
+							   const std::shared_ptr<const AdmissionWebhooks::ClientInfo> &client_info,
+							   const Status::Code status)
+{
+	auto hooks = Create(provider, PublisherType::Unknown, control_server_url, timeout_msec, secret_key, request_info, client_info, status);
+
+	g_notification_queue.Push(hooks, [](const std::shared_ptr<AdmissionWebhooks> &hooks) {
+		hooks->Execute();
+		hooks->LogNotification();
+	});
+}
+
+void AdmissionWebhooks::Notify(PublisherType publisher,
+							   const std::shared_ptr<ov::Url> &control_server_url, uint32_t timeout_msec,
+							   const ov::String secret_key,
+							   const std::shared_ptr<const AdmissionWebhooks::RequestInfo> &request_info,
+							   const std::shared_ptr<const AdmissionWebhooks::ClientInfo> &client_info,
+							   const Status::Code status)
+{
+	auto hooks = Create(ProviderType::Unknown, publisher, control_server_url, timeout_msec, secret_key, request_info, client_info, status);
+
+	g_notification_queue.Push(hooks, [](const std::shared_ptr<AdmissionWebhooks> &hooks) {
+		hooks->Execute();
+		hooks->LogNotification();
+	});
+}
+
 AdmissionWebhooks::ClientInfo::ClientInfo(const std::shared_ptr<ov::SocketAddress> &client_address)
 	: _client_address(client_address), _user_agent("")
 {
@@ -125,6 +264,143 @@ uint64_t AdmissionWebhooks::GetElapsedTime() const
 	return _elapsed_ms;
 }
 
+bool AdmissionWebhooks::IsCached() const
+{
+	return _is_cached;
+}
+
+void AdmissionWebhooks::LogNotification() const
+{
+	logti("AdmissionWebhooks notified %s of %s (%s) : %s (Elapsed : %llu ms)",
+		  _control_server_url->ToUrlString().CStr(), _request_info->GetUrl()->ToUrlString().CStr(), Status::Description(_status).CStr(),
+		  (_err_code == ErrCode::ALLOWED) ? "Success" : _err_reason.CStr(), static_cast<unsigned long long>(_elapsed_ms));
+}
+
+void AdmissionWebhooks::Execute()
+{
+	if ((_status == Status::Code::OPENING) && LoadFromCache())
+	{
+		return;
+	}
+
+	Run();
+
+	if (_status == Status::Code::OPENING)
+	{
+		StoreToCache();
+	}
+}
+
+ov::String AdmissionWebhooks::GetCacheKey() const
+{
+	// Clients in the same network (/24 for IPv4, /64 for IPv6) share the result
+	ov::String network;
+	auto client_address = (_client_info != nullptr) ? _client_info->GetClientAddress() : nullptr;
+
+	if (client_address == nullptr)
+	{
+		return "";
+	}
+
+	if (client_address->IsIPv4())
+	{
+		auto address = reinterpret_cast<const uint8_t *>(&(client_address->ToIn4Addr()->s_addr));
+		network.Format("%u.%u.%u.0/24", address[0], address[1], address[2]);
+	}
+	else if (client_address->IsIPv6())
+	{
+		auto address = client_address->ToIn6Addr()->s6_addr;
+		network.Format("%02x%02x:%02x%02x:%02x%02x:%02x%02x::/64",
+					   address[0], address[1], address[2], address[3], address[4], address[5], address[6], address[7]);
+	}
+	else
+	{
+		return "";
+	}
+
+	ov::String direction, protocol;
+	if (_provider_type != ProviderType::Unknown)
+	{
+		direction = "incoming";
+		protocol = StringFromProviderType(_provider_type);
+	}
+	else
+	{
+		direction = "outgoing";
+		protocol = StringFromPublisherType(_publisher_type);
+	}
+
+	return ov::String::FormatString("%s|%s|%s|%s|%s",
+									_control_server_url->ToUrlString(true).CStr(), direction.CStr(), protocol.CStr(),
+									_request_info->GetUrl()->ToUrlString(true).CStr(), network.CStr());
+}
+
+bool AdmissionWebhooks::LoadFromCache()
+{
+	auto key = GetCacheKey();
+	if (key.IsEmpty())
+	{
+		return false;
+	}
+
+	std::lock_guard lock_guard(g_cache_mutex);
+
+	auto item = g_cache.find(key);
+	if (item == g_cache.end())
+	{
+		return false;
+	}
+
+	if (item->second.expire_msec <= ov::Clock::NowMSec())
+	{
+		g_cache.erase(item);
+		return false;
+	}
+
+	_allowed = true;
+	_new_url = item->second.new_url;
+	_lifetime = item->second.lifetime;
+	_elapsed_ms = 0;
+	_is_cached = true;
+	SetError(ErrCode::ALLOWED, item->second.reason);
+
+	return true;
+}
+
+void AdmissionWebhooks::StoreToCache()
+{
+	// Only the allowed results are cached, so the denied clients are always checked again
+	if ((_err_code != ErrCode::ALLOWED) || (_cache_lifetime == 0))
+	{
+		return;
+	}
+
+	auto key = GetCacheKey();
+	if (key.IsEmpty())
+	{
+		return;
+	}
+
+	auto now = ov::Clock::NowMSec();
+
+	std::lock_guard lock_guard(g_cache_mutex);
+
+	if (g_cache.size() >= ADMISSION_WEBHOOKS_MAX_CACHE_ITEMS)
+	{
+		for (auto item = g_cache.begin(); item != g_cache.end();)
+		{
+			item = (item->second.expire_msec <= now) ? g_cache.erase(item) : std::next(item);
+		}
+
+		if (g_cache.size() >= ADMISSION_WEBHOOKS_MAX_CACHE_ITEMS)
+		{
+			return;
+		}
+	}
+
+	g_cache[key] = CachedResult{now + _cache_lifetime, _new_url, _lifetime, _err_reason};
+}
+
 void AdmissionWebhooks::SetError(ErrCode code, ov::String reason)
 {
 	_err_code = code;
@@ -216,12 +492,13 @@ void AdmissionWebhooks::ParseResponse(const std::shared_ptr<ov::Data> &data)
 
 	/*
 	Required : "allowed"
-	Optional : "new_url", "lifetime", "reason"
+	Optional : "new_url", "lifetime", "reason", "cache_lifetime"
 
 	{
 		"allowed": true,
 		"new_url": "scheme://host[:port]/app/stream/file?query=value&query2=value2",
 		"lifetime": seconds   // 0 : infinite
+		"cache_lifetime": milliseconds   // 0 : not cached
 	}
 
 	{
@@ -248,6 +525,7 @@ void AdmissionWebhooks::ParseResponse(const std::shared_ptr<ov::Data> &data)
 	Json::Value &jv_new_url = object.GetJsonValue()["new_url"];
 	Json::Value &jv_lifetime = object.GetJsonValue()["lifetime"];
 	Json::Value &jv_reason = object.GetJsonValue()["reason"];
+	Json::Value &jv_cache_lifetime = object.GetJsonValue()["cache_lifetime"];
 
 	if(jv_new_url.isNull() == false)
 	{
@@ -273,6 +551,14 @@ void AdmissionWebhooks::ParseResponse(const std::shared_ptr<ov::Data> &data)
 		}
 	}
 
+	if(jv_cache_lifetime.isNull() == false)
+	{
+		if(jv_cache_lifetime.isUInt64())
+		{
+			_cache_lifetime = jv_cache_lifetime.asUInt64();
+		}
+	}
+
 	SetError(_allowed ? ErrCode::ALLOWED : ErrCode::DENIED, _err_reason);
 }
 
@@ -299,6 +585,7 @@ void AdmissionWebhooks::Run()
 	auto client = std::make_shared<http::clnt::HttpClient>();
 	client->SetMethod(http::Method::Post);
 	client->SetBlockingMode(ov::BlockingMode::Blocking);
+	client->SetKeepAlive(true);
 	client->SetConnectionTimeout(_timeout_msec);
 	client->SetRequestHeader("X-OME-Signature", signature_sha1_base64);
 	client->SetRequestHeader("Content-Type", "application/json");
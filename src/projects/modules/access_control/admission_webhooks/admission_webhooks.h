@@ -84,14 +84,48 @@ public:
 													const std::shared_ptr<const AdmissionWebhooks::ClientInfo> &client_info,
 													const Status::Code status = Status::Code::OPENING);
 
+	// Sends the query on the notification threads without waiting for the response.
+	// It is for the queries of which the result is not used (closing status).
+	static void Notify(ProviderType provider,
+					   const std::shared_ptr<ov::Url> &control_server_url, uint32_t timeout_msec,
+					   const ov::String secret_key,
+					   const std::shared_ptr<const AdmissionWebhooks::RequestInfo> &request_info,
+					   const std::shared_ptr<const AdmissionWebhooks::ClientInfo> &client_info,
+					   const Status::Code status = Status::Code::CLOSING);
+
+	static void Notify(PublisherType publisher,
+					   const std::shared_ptr<ov::Url> &control_server_url, uint32_t timeout_msec,
+					   const ov::String secret_key,
+					   const std::shared_ptr<const AdmissionWebhooks::RequestInfo> &request_info,
+					   const std::shared_ptr<const AdmissionWebhooks::ClientInfo> &client_info,
+					   const Status::Code status = Status::Code::CLOSING);
+
 	ErrCode GetErrCode() const;
 	ov::String GetErrReason() const;
 	std::shared_ptr<ov::Url> GetNewURL() const;
 	uint64_t GetLifetime() const;
 	uint64_t GetElapsedTime() const;
+	// Whether the result is from the cache instead of the control server
+	bool IsCached() const;
 	
 private:
+	static std::shared_ptr<AdmissionWebhooks> Create(ProviderType provider, PublisherType publisher,
+													 const std::shared_ptr<ov::Url> &control_server_url, uint32_t timeout_msec,
+													 const ov::String &secret_key,
+													 const std::shared_ptr<const AdmissionWebhooks::RequestInfo> &request_info,
+													 const std::shared_ptr<const AdmissionWebhooks::ClientInfo> &client_info,
+													 const Status::Code status);
+
+	// Runs the query, or loads the result of the same query from the cache
+	void Execute();
+	void LogNotification() const;
 	void Run();
+
+	// The allowed results are cached by (control server, protocol, url, network of the client) for the "cache_lifetime" of the response
+	ov::String GetCacheKey() const;
+	bool LoadFromCache();
+	void StoreToCache();
+
 	ov::String GetMessageBody();
 	void SetError(ErrCode code, ov::String reason);
 
@@ -117,4 +151,6 @@ private:
 	ov::String _err_reason;
 	std::shared_ptr<ov::Url> _new_url = nullptr;
 	uint64_t _lifetime = 0;
+	uint64_t _cache_lifetime = 0;
+	bool _is_cached = false;
 };
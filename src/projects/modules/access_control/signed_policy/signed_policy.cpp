@@ -1,10 +1,65 @@
 #include <openssl/evp.h>
 #include <base/ovcrypto/base_64.h>
 #include <base/ovlibrary/converter.h>
-#include <base/ovcrypto/message_digest.h>
+#include <base/ovcrypto/hmac_key.h>
+
+#include <map>
 
 #include "signed_policy.h"
 
+// The verified policies are kept until "url_expire" of the policy
+// (if the cache is full, the policy that expires first is evicted)
+#define SIGNED_POLICY_MAX_CACHE_ITEMS 10000
+
+namespace
+{
+	struct VerifiedPolicy
+	{
+		uint64_t url_expire_epoch_msec;
+		uint64_t url_activate_epoch_msec;
+		uint64_t stream_expire_epoch_msec;
+		ov::String allow_ip_cidr;
+		std::shared_ptr<ov::CIDR> cidr;
+
+		// Position in g_verified_policy_expirations
+		std::multimap<uint64_t, ov::String>::iterator expiration;
+	};
+
+	std::mutex g_verified_policies_mutex;
+	std::unordered_map<ov::String, VerifiedPolicy> g_verified_policies;
+	// The keys of g_verified_policies ordered by url_expire, so the eviction does not scan the cache
+	std::multimap<uint64_t, ov::String> g_verified_policy_expirations;
+
+	// g_verified_policies_mutex must be locked
+	void EraseVerifiedPolicy(std::unordered_map<ov::String, VerifiedPolicy>::iterator item)
+	{
+		g_verified_policy_expirations.erase(item->second.expiration);
+		g_verified_policies.erase(item);
+	}
+
+	std::mutex g_hmac_keys_mutex;
+	std::unordered_map<ov::String, std::shared_ptr<const ov::HmacKey>> g_hmac_keys;
+
+	std::shared_ptr<const ov::HmacKey> GetHmacKey(const ov::String &secret_key)
+	{
+		std::lock_guard lock_guard(g_hmac_keys_mutex);
+
+		auto item = g_hmac_keys.find(secret_key);
+		if (item != g_hmac_keys.end())
+		{
+			return item->second;
+		}
+
+		std::shared_ptr<const ov::HmacKey> hmac_key = ov::HmacKey::Create(ov::CryptoAlgorithm::Sha1, secret_key.CStr(), secret_key.GetLength());
+		if (hmac_key != nullptr)
+		{
+			g_hmac_keys.emplace(secret_key, hmac_key);
+		}
+
+		return hmac_key;
+	}
+}  // namespace
+
 
 // requested_url ==> scheme://domain:port/app/stream[/file]?[query1=value&query2=value&]policy=value&signature=value
 std::shared_ptr<const SignedPolicy> SignedPolicy::Load(const ov::String &client_address, const ov::String &requested_url, const ov::String &policy_query_key, const ov::String &signature_query_key, const ov::String &secret_key)
@@ -43,25 +98,49 @@ bool SignedPolicy::Process(const ov::String &client_address, const ov::String &r
 	url->RemoveQueryKey(signature_query_key);
 	auto base_url = url->ToUrlString(true);
 
-	// Make signature
-	ov::String signature_base64;
-	if(MakeSignature(base_url, secret_key, signature_base64) == false)
-	{
-		SetError(ErrCode::NO_SIGNATURE_VALUE_IN_URL, ov::String::FormatString("Could not generate signature from url(%s).", requested_url.CStr()));
-		return false;
-	}
+	// The parts of the LLHLS stream are requested with the same policy and signature,
+	// so the signature and the policy are verified once until the policy expires
+	auto cache_key = ov::String::FormatString("%s\n%s\n%s", secret_key.CStr(), signature_query_value.CStr(), base_url.CStr());
 
-	if(signature_base64 != signature_query_value)
+	if (LoadFromCache(cache_key) == false)
 	{
-		SetError(ErrCode::INVALID_SIGNATURE, ov::String::FormatString("Signature value is invalid(expected : %s | input : %s).", signature_base64.CStr(), signature_query_value.CStr()));
-		return false;
-	}
+		// Make signature
+		ov::String signature_base64;
+		if(MakeSignature(base_url, secret_key, signature_base64) == false)
+		{
+			SetError(ErrCode::NO_SIGNATURE_VALUE_IN_URL, ov::String::FormatString("Could not generate signature from url(%s).", requested_url.CStr()));
+			return false;
+		}
 
-	// Extract policy
-	auto policy_base64 = url->GetQueryValue(policy_query_key);
-	auto policy = ov::Base64::Decode(policy_base64, true);
+		if(signature_base64 != signature_query_value)
+		{
+			SetError(ErrCode::INVALID_SIGNATURE, ov::String::FormatString("Signature value is invalid(expected : %s | input : %s).", signature_base64.CStr(), signature_query_value.CStr()));
+			return false;
+		}
+
+		// Extract policy
+		auto policy_base64 = url->GetQueryValue(policy_query_key);
+		auto policy = ov::Base64::Decode(policy_base64, true);
 
-	if(ProcessPolicyJson(policy->ToString()) == false)
+		if(policy == nullptr)
+		{
+			SetError(ErrCode::INVALID_POLICY, ov::String::FormatString("The policy is not base64url encoded (%s).", policy_base64.CStr()));
+			return false;
+		}
+
+		if(ProcessPolicyJson(policy->ToString()) == false)
+		{
+			return false;
+		}
+
+		if(CheckPolicyTime() == false)
+		{
+			return false;
+		}
+
+		StoreToCache(cache_key);
+	}
+	else if(CheckPolicyTime() == false)
 	{
 		return false;
 	}
@@ -80,8 +159,16 @@ bool SignedPolicy::Process(const ov::String &client_address, const ov::String &r
 
 bool SignedPolicy::MakeSignature(const ov::String &base_url, const ov::String &secret_key, ov::String &signature_base64)
 {
-	auto md = ov::MessageDigest::ComputeHmac(ov::CryptoAlgorithm::Sha1, secret_key.ToData(false), base_url.ToData(false));
-	if(md == nullptr)
+	auto hmac_key = GetHmacKey(secret_key);
+	if(hmac_key == nullptr)
+	{
+		return false;
+	}
+
+	ov::Data md(hmac_key->Size());
+	md.SetLength(hmac_key->Size());
+
+	if(hmac_key->Compute({{base_url.CStr(), base_url.GetLength()}}, md.GetWritableData(), md.GetLength()) == false)
 	{
 		return false;
 	}
@@ -91,6 +178,56 @@ bool SignedPolicy::MakeSignature(const ov::String &base_url, const ov::String &s
 	return true;
 }
 
+bool SignedPolicy::LoadFromCache(const ov::String &cache_key)
+{
+	std::lock_guard lock_guard(g_verified_policies_mutex);
+
+	auto item = g_verified_policies.find(cache_key);
+	if(item == g_verified_policies.end())
+	{
+		return false;
+	}
+
+	auto &policy = item->second;
+
+	if(policy.url_expire_epoch_msec < ov::Clock::NowMSec())
+	{
+		EraseVerifiedPolicy(item);
+		return false;
+	}
+
+	_url_expire_epoch_msec = policy.url_expire_epoch_msec;
+	_url_activate_epoch_msec = policy.url_activate_epoch_msec;
+	_stream_expire_epoch_msec = policy.stream_expire_epoch_msec;
+	_allow_ip_cidr = policy.allow_ip_cidr;
+	_cidr = policy.cidr;
+
+	return true;
+}
+
+void SignedPolicy::StoreToCache(const ov::String &cache_key) const
+{
+	auto now = ov::Clock::NowMSec();
+
+	std::lock_guard lock_guard(g_verified_policies_mutex);
+
+	auto old_item = g_verified_policies.find(cache_key);
+	if(old_item != g_verified_policies.end())
+	{
+		EraseVerifiedPolicy(old_item);
+	}
+
+	// Remove the expired policies, then the ones that expire first if the cache is still full
+	while((g_verified_policy_expirations.empty() == false) &&
+		  ((g_verified_policy_expirations.begin()->first < now) || (g_verified_policies.size() >= SIGNED_POLICY_MAX_CACHE_ITEMS)))
+	{
+		EraseVerifiedPolicy(g_verified_policies.find(g_verified_policy_expirations.begin()->second));
+	}
+
+	auto expiration = g_verified_policy_expirations.emplace(_url_expire_epoch_msec, cache_key);
+	g_verified_policies[cache_key] = VerifiedPolicy{_url_expire_epoch_msec, _url_activate_epoch_msec, _stream_expire_epoch_msec, _allow_ip_cidr, _cidr, expiration};
+}
+
 /*	Policy format
 {
 	"url_activate":1399721576,									
@@ -121,35 +258,16 @@ bool SignedPolicy::ProcessPolicyJson(const ov::String &policy_json)
 	else
 	{
 		_url_expire_epoch_msec = jv_url_expire.asUInt64();
-
-		// Policy expired
-		if(_url_expire_epoch_msec < ov::Clock::NowMSec())
-		{
-			SetError(ErrCode::INVALID_POLICY, ov::String::FormatString("URL has expired.(now:%llu policy_expire:%llu) ", ov::Clock::NowMSec(), _url_expire_epoch_msec));
-			return false;
-		}
 	}
 	
 	if(!jv_url_activate.isNull() && jv_url_activate.isUInt64())
 	{
 		_url_activate_epoch_msec = jv_url_activate.asUInt64();
-
-		// Policy is not activated yet
-		if(_url_activate_epoch_msec > ov::Clock::NowMSec())
-		{
-			SetError(ErrCode::INVALID_POLICY, ov::String::FormatString("The URL has not yet been activated.(now:%llu policy_activate:%llu) ", ov::Clock::NowMSec(), _url_activate_epoch_msec));
-			return false;
-		}
 	}
 
 	if(!jv_stream_expire.isNull() && jv_stream_expire.isUInt64())
 	{
 		_stream_expire_epoch_msec = jv_stream_expire.asUInt64();
-		if(_stream_expire_epoch_msec < ov::Clock::NowMSec())
-		{
-			SetError(ErrCode::INVALID_POLICY, ov::String::FormatString("Stream has expired.(now:%llu policy_expire:%llu) ", ov::Clock::NowMSec(), _url_expire_epoch_msec));
-			return false;
-		}
 	}
 	
 	if(!jv_allow_ip.isNull() && jv_allow_ip.isString())
@@ -166,6 +284,33 @@ bool SignedPolicy::ProcessPolicyJson(const ov::String &policy_json)
 	return true;
 }
 
+bool SignedPolicy::CheckPolicyTime()
+{
+	auto now = ov::Clock::NowMSec();
+
+	// Policy expired
+	if(_url_expire_epoch_msec < now)
+	{
+		SetError(ErrCode::INVALID_POLICY, ov::String::FormatString("URL has expired.(now:%llu policy_expire:%llu) ", now, _url_expire_epoch_msec));
+		return false;
+	}
+
+	// Policy is not activated yet
+	if(_url_activate_epoch_msec > now)
+	{
+		SetError(ErrCode::INVALID_POLICY, ov::String::FormatString("The URL has not yet been activated.(now:%llu policy_activate:%llu) ", now, _url_activate_epoch_msec));
+		return false;
+	}
+
+	if((_stream_expire_epoch_msec != 0) && (_stream_expire_epoch_msec < now))
+	{
+		SetError(ErrCode::INVALID_POLICY, ov::String::FormatString("Stream has expired.(now:%llu policy_expire:%llu) ", now, _url_expire_epoch_msec));
+		return false;
+	}
+
+	return true;
+}
+
 const ov::String& SignedPolicy::GetRequestedUrl() const
 {
 	return _requested_url;
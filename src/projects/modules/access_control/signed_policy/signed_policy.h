@@ -58,8 +58,13 @@ private:
 
     bool Process(const ov::String &client_address, const ov::String &requested_url, const ov::String &policy_query_key, const ov::String &signature_query_key, const ov::String &secret_key);
 	bool ProcessPolicyJson(const ov::String &policy_json);
+	bool CheckPolicyTime();
 	bool MakeSignature(const ov::String &base_url, const ov::String &secret_key, ov::String &signature_base64);
 
+	// The policies of which the signature is verified are cached by (secret key, signature, base url)
+	bool LoadFromCache(const ov::String &cache_key);
+	void StoreToCache(const ov::String &cache_key) const;
+
 private:
 	ErrCode	_error_code = ErrCode::INIT;
 	ov::String _error_message;
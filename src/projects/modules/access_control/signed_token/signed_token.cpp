@@ -3,8 +3,89 @@
 #include <base/ovcrypto/base_64.h>
 #include <base/ovlibrary/converter.h>
 
+#include <map>
+
 #include "signed_token.h"
 
+// The decrypted tokens are kept until the token expires (or for this time if the token does not expire)
+// (if the cache is full, the token that expires first is evicted)
+#define SIGNED_TOKEN_MAX_CACHE_ITEMS 10000
+#define SIGNED_TOKEN_MAX_CACHE_LIFETIME_MS (60 * 1000)
+
+namespace
+{
+	struct DecryptedToken
+	{
+		uint64_t expire_msec;
+		ov::String plain_string;
+
+		// Position in g_decrypted_token_expirations
+		std::multimap<uint64_t, ov::String>::iterator expiration;
+	};
+
+	std::mutex g_decrypted_tokens_mutex;
+	std::unordered_map<ov::String, DecryptedToken> g_decrypted_tokens;
+	// The keys of g_decrypted_tokens ordered by expire_msec, so the eviction does not scan the cache
+	std::multimap<uint64_t, ov::String> g_decrypted_token_expirations;
+
+	// g_decrypted_tokens_mutex must be locked
+	void EraseDecryptedToken(std::unordered_map<ov::String, DecryptedToken>::iterator item)
+	{
+		g_decrypted_token_expirations.erase(item->second.expiration);
+		g_decrypted_tokens.erase(item);
+	}
+
+	bool FindDecryptedToken(const ov::String &cache_key, ov::String *plain_string)
+	{
+		std::lock_guard lock_guard(g_decrypted_tokens_mutex);
+
+		auto item = g_decrypted_tokens.find(cache_key);
+		if (item == g_decrypted_tokens.end())
+		{
+			return false;
+		}
+
+		if (item->second.expire_msec < ov::Clock::NowMSec())
+		{
+			EraseDecryptedToken(item);
+			return false;
+		}
+
+		*plain_string = item->second.plain_string;
+
+		return true;
+	}
+
+	void StoreDecryptedToken(const ov::String &cache_key, const ov::String &plain_string, uint64_t token_expired_time)
+	{
+		auto now = ov::Clock::NowMSec();
+		auto expire_msec = now + SIGNED_TOKEN_MAX_CACHE_LIFETIME_MS;
+
+		if (token_expired_time != 0)
+		{
+			expire_msec = std::min(expire_msec, token_expired_time);
+		}
+
+		std::lock_guard lock_guard(g_decrypted_tokens_mutex);
+
+		auto old_item = g_decrypted_tokens.find(cache_key);
+		if (old_item != g_decrypted_tokens.end())
+		{
+			EraseDecryptedToken(old_item);
+		}
+
+		// Remove the expired tokens, then the ones that expire first if the cache is still full
+		while ((g_decrypted_token_expirations.empty() == false) &&
+			   ((g_decrypted_token_expirations.begin()->first < now) || (g_decrypted_tokens.size() >= SIGNED_TOKEN_MAX_CACHE_ITEMS)))
+		{
+			EraseDecryptedToken(g_decrypted_tokens.find(g_decrypted_token_expirations.begin()->second));
+		}
+
+		auto expiration = g_decrypted_token_expirations.emplace(expire_msec, cache_key);
+		g_decrypted_tokens[cache_key] = DecryptedToken{expire_msec, plain_string, expiration};
+	}
+}  // namespace
+
 /* 
     [Test Code]
 
@@ -130,21 +211,30 @@ bool SignedToken::Process(const ov::String &client_address, const ov::String &re
 		return false;
 	}
 
-    ov::Data final_data;
-    auto const decoded_data = ov::Base64::Decode(token_query_value);
-    if(decoded_data == nullptr)
-    {
-		SetError(ErrCode::DECRYPT_FAILED, ov::String::FormatString("Failed to base64 decode the token (%s).", token_query_value.CStr()));
-        return false;
-    }
+    // The segments/parts of a stream are requested with the same token, so it is decrypted once
+    auto cache_key = ov::String::FormatString("%s\n%s", secret_key.CStr(), token_query_value.CStr());
+    ov::String plain_string;
+    bool is_cached = FindDecryptedToken(cache_key, &plain_string);
 
-    if(!Decrypt_DES_ECB_PKCS5(secret_key, *decoded_data, final_data))
+    if(is_cached == false)
     {
-		SetError(ErrCode::DECRYPT_FAILED, ov::String::FormatString("Failed to DES decrypt the token (%s).", token_query_value.CStr()));
-        return false;
+        ov::Data final_data;
+        auto const decoded_data = ov::Base64::Decode(token_query_value);
+        if(decoded_data == nullptr)
+        {
+            SetError(ErrCode::DECRYPT_FAILED, ov::String::FormatString("Failed to base64 decode the token (%s).", token_query_value.CStr()));
+            return false;
+        }
+
+        if(!Decrypt_DES_ECB_PKCS5(secret_key, *decoded_data, final_data))
+        {
+            SetError(ErrCode::DECRYPT_FAILED, ov::String::FormatString("Failed to DES decrypt the token (%s).", token_query_value.CStr()));
+            return false;
+        }
+
+        plain_string = final_data.ToString();
     }
 
-    auto plain_string = final_data.ToString();
     auto items = plain_string.Split(",");
     if(items.size() != 5)
     {
@@ -159,6 +249,11 @@ bool SignedToken::Process(const ov::String &client_address, const ov::String &re
     _token_expired_time = ov::Converter::ToInt64(items[3]);
     _stream_expired_time = ov::Converter::ToInt64(items[4]);
 
+    if(is_cached == false)
+    {
+        StoreDecryptedToken(cache_key, plain_string, _token_expired_time);
+    }
+
 	if(IsTokenExpired())
 	{
 		SetError(ErrCode::TOKEN_EXPIRED, ov::String::FormatString("Token is expired: %lld (Now: %lld).", GetTokenExpiredTime(), ov::Clock::NowMSec()));
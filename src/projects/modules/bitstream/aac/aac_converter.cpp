@@ -32,30 +32,31 @@ bool AacConverter::GetExtraDataFromASC(const cmn::PacketType type, const std::sh
 
 std::shared_ptr<ov::Data> AacConverter::MakeAdtsHeader(uint8_t aac_profile, uint8_t aac_sample_rate, uint8_t aac_channels, int16_t data_length)
 {
-	uint8_t ADTS_HEADER_LENGTH = 7;
-	int16_t aac_frame_length = data_length + 7;
-
-	ov::BitWriter bits(ADTS_HEADER_LENGTH);
-
-	bits.Write(12, 0x0FFF);			   // syncword [12b]
-	bits.Write(1, 0);				   // ID - 0=MPEG-4, 1=MPEG-2 [1b]
-	bits.Write(2, 0);				   // layer - Always 0 [2b]
-	bits.Write(1, 1);				   // protection_absent  [1b]
-	bits.Write(2, aac_profile);		   // profile [2b]
-	bits.Write(4, aac_sample_rate);	   // sampling_frequency_index[[4b]
-	bits.Write(1, 0);				   // private_bit[1b]
-	bits.Write(3, aac_channels);	   // channel_configuration[3b]
-	bits.Write(1, 0);				   // Original/copy[1b]
-	bits.Write(1, 0);				   // Home[1b]
-	bits.Write(1, 0);				   // copyright_identification_bit[1b]
-	bits.Write(1, 0);				   // copyright_identification_start[1b]
-	bits.Write(13, aac_frame_length);  // aac_frame_length[13b]
-	bits.Write(11, 0x3F);			   // adts_buffer_fullness[11b]
-	bits.Write(2, 0);				   // no_raw_data_blocks_inframe[2b]
-
-	std::shared_ptr<ov::Data> data = std::make_shared<ov::Data>(bits.GetData(), bits.GetDataSize());
-
-	return data;
+	uint8_t header[ADTS_MIN_SIZE];
+
+	WriteAdtsHeader(header, aac_profile, aac_sample_rate, aac_channels, data_length);
+
+	return std::make_shared<ov::Data>(header, sizeof(header));
+}
+
+void AacConverter::WriteAdtsHeader(uint8_t *header, uint8_t aac_profile, uint8_t aac_sample_rate, uint8_t aac_channels, size_t data_length)
+{
+	// The bytes are written directly instead of using BitWriter, since this is called for every audio frame
+	// (the fields are the same as the ones in the comment below)
+	size_t aac_frame_length = data_length + ADTS_MIN_SIZE;
+	uint16_t adts_buffer_fullness = 0x3F;
+
+	header[0] = 0xFF;											// syncword [12b]
+	header[1] = 0xF1;											// syncword, ID = 0 (MPEG-4), layer = 0, protection_absent = 1
+	header[2] = ((aac_profile & 0x03) << 6) |					// profile [2b]
+				((aac_sample_rate & 0x0F) << 2) |				// sampling_frequency_index [4b], private_bit = 0
+				((aac_channels >> 2) & 0x01);					// channel_configuration [3b]
+	header[3] = ((aac_channels & 0x03) << 6) |					// original/copy, home, copyright bits = 0
+				((aac_frame_length >> 11) & 0x03);				// aac_frame_length [13b]
+	header[4] = (aac_frame_length >> 3) & 0xFF;
+	header[5] = ((aac_frame_length & 0x07) << 5) |
+				((adts_buffer_fullness >> 6) & 0x1F);			// adts_buffer_fullness [11b]
+	header[6] = (adts_buffer_fullness & 0x3F) << 2;				// no_raw_data_blocks_inframe [2b] = 0
 }
 
 /*
@@ -97,16 +98,18 @@ std::shared_ptr<ov::Data> AacConverter::MakeAdtsHeader(uint8_t aac_profile, uint
 // Raw audio data msut be 1 frame
 std::shared_ptr<ov::Data> AacConverter::ConvertRawToAdts(const uint8_t *data, size_t data_len, const AACSpecificConfig &aac_config)
 {
-	auto adts_data = std::make_shared<ov::Data>(data_len + 16);
+	auto adts_data = std::make_shared<ov::Data>(ADTS_MIN_SIZE + data_len);
 
 	//Get the AACSpecificConfig value from extradata;
 	uint8_t aac_profile = (uint8_t)aac_config.GetAacProfile();
 	uint8_t aac_sample_rate = (uint8_t)aac_config.SamplingFrequency();
 	uint8_t aac_channels = (uint8_t)aac_config.Channel();
 
-	auto adts_header = MakeAdtsHeader(aac_profile, aac_sample_rate, aac_channels, data_len);
+	// The header is written in the buffer of the frame, so only one buffer is allocated per frame
+	uint8_t adts_header[ADTS_MIN_SIZE];
+	WriteAdtsHeader(adts_header, aac_profile, aac_sample_rate, aac_channels, data_len);
 
-	adts_data->Append(adts_header);
+	adts_data->Append(adts_header, sizeof(adts_header));
 	adts_data->Append(data, data_len);
 
 	return adts_data;
@@ -140,7 +143,7 @@ std::shared_ptr<ov::Data> AacConverter::ConvertRawToAdts(const std::shared_ptr<c
 
 std::shared_ptr<ov::Data> AacConverter::ConvertAdtsToRaw(const std::shared_ptr<const ov::Data> &data, std::vector<size_t> *length_list)
 {
-	auto raw_data = std::make_shared<ov::Data>(data->GetLength());
+	std::shared_ptr<ov::Data> raw_data;
 	size_t remained = data->GetLength();
 	off_t offset = 0L;
 	auto buffer = data->GetDataAs<uint8_t>();
@@ -212,6 +215,22 @@ std::shared_ptr<ov::Data> AacConverter::ConvertAdtsToRaw(const std::shared_ptr<c
 
 		size_t payload_length = frame_length - header_length;
 
+		if ((offset == 0) && (frame_length == remained))
+		{
+			// Only one frame: refer the payload of <data> instead of copying it (the buffer is copied when either of them is modified)
+			if (length_list != nullptr)
+			{
+				length_list->push_back(payload_length);
+			}
+
+			return std::const_pointer_cast<ov::Data>(data->Subdata(header_length, payload_length));
+		}
+
+		if (raw_data == nullptr)
+		{
+			raw_data = std::make_shared<ov::Data>(data->GetLength());
+		}
+
 		// Skip ADTS header
 		buffer += header_length;
 
@@ -227,9 +246,22 @@ std::shared_ptr<ov::Data> AacConverter::ConvertAdtsToRaw(const std::shared_ptr<c
 		offset += frame_length;
 	}
 
+	if (raw_data == nullptr)
+	{
+		// Empty data
+		raw_data = std::make_shared<ov::Data>();
+	}
+
 	return raw_data;
 }
 
+std::shared_ptr<const ov::Data> AacConverter::ConvertAdtsToRaw(const std::shared_ptr<const MediaPacket> &packet)
+{
+	return packet->GetConvertedData(cmn::BitstreamFormat::AAC_RAW, [](const std::shared_ptr<const ov::Data> &data) {
+		return ConvertAdtsToRaw(data, nullptr);
+	});
+}
+
 ov::String AacConverter::GetProfileString(const std::shared_ptr<AACSpecificConfig> &aac_config)
 {
 	if(aac_config == nullptr)
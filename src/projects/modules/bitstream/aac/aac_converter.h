@@ -15,11 +15,16 @@ public:
 	static std::shared_ptr<ov::Data> ConvertRawToAdts(const uint8_t *data, size_t data_len, const AACSpecificConfig &aac_config);
 	static std::shared_ptr<ov::Data> ConvertRawToAdts(const std::shared_ptr<const ov::Data> &data, const std::shared_ptr<AACSpecificConfig> &aac_config);
 	static std::shared_ptr<ov::Data> ConvertRawToAdts(const std::shared_ptr<const ov::Data> &data, const std::shared_ptr<ov::Data> &aac_config);
+	// If <data> has only one ADTS frame (which is the most common), the returned data refers the payload of <data> without copying it
 	static std::shared_ptr<ov::Data> ConvertAdtsToRaw(const std::shared_ptr<const ov::Data> &data, std::vector<size_t> *length_list);
+	// The converted data is cached in the packet, so it is converted only once for all sessions
+	static std::shared_ptr<const ov::Data> ConvertAdtsToRaw(const std::shared_ptr<const MediaPacket> &packet);
 
 	static ov::String GetProfileString(const std::shared_ptr<AACSpecificConfig> &aac_config);
 	static ov::String GetProfileString(const std::shared_ptr<ov::Data> &aac_config_data);
 	static ov::String GetProfileString(const std::vector<uint8_t> &codec_extradata);
 
 	static std::shared_ptr<ov::Data> MakeAdtsHeader(uint8_t aac_profile, uint8_t aac_sample_rate, uint8_t aac_channels, int16_t data_length);
+	// Writes the ADTS header (ADTS_MIN_SIZE bytes, without CRC) of the raw frame of <data_length> bytes to <header>
+	static void WriteAdtsHeader(uint8_t *header, uint8_t aac_profile, uint8_t aac_sample_rate, uint8_t aac_channels, size_t data_length);
 };
@@ -0,0 +1,145 @@
+#include "av1_codec_configuration_record.h"
+
+#include <base/ovlibrary/bit_reader.h>
+#include <base/ovlibrary/ovlibrary.h>
+
+#define OV_LOG_TAG "AV1CodecConfigurationRecord"
+
+bool AV1CodecConfigurationRecord::Parse(const uint8_t *data, size_t data_length, AV1CodecConfigurationRecord &record)
+{
+	if (data_length < MIN_AV1CODECCONFIGURATIONRECORD_SIZE)
+	{
+		logte("The data inputted is too small for parsing (%zu must be bigger than %d)", data_length, MIN_AV1CODECCONFIGURATIONRECORD_SIZE);
+		return false;
+	}
+
+	BitReader parser(data, data_length);
+
+	auto marker = parser.ReadBits<uint8_t>(1);
+	record._version = parser.ReadBits<uint8_t>(7);
+
+	if ((marker != 1) || (record._version != 1))
+	{
+		logte("Invalid marker(%d) or version(%d)", marker, record._version);
+		return false;
+	}
+
+	record._seq_profile = parser.ReadBits<uint8_t>(3);
+	record._seq_level_idx_0 = parser.ReadBits<uint8_t>(5);
+	record._seq_tier_0 = parser.ReadBits<uint8_t>(1);
+	record._high_bitdepth = parser.ReadBoolBit();
+	record._twelve_bit = parser.ReadBoolBit();
+	record._monochrome = parser.ReadBoolBit();
+	record._chroma_subsampling_x = parser.ReadBits<uint8_t>(1);
+	record._chroma_subsampling_y = parser.ReadBits<uint8_t>(1);
+	record._chroma_sample_position = parser.ReadBits<uint8_t>(2);
+	// reserved(3) + initial_presentation_delay_present(1) + initial_presentation_delay_minus_one/reserved(4)
+	parser.ReadBytes<uint8_t>();
+
+	record._config_obus = std::make_shared<ov::Data>(parser.CurrentPosition(), parser.BytesRemained());
+
+	return true;
+}
+
+std::shared_ptr<ov::Data> AV1CodecConfigurationRecord::Build(const AV1Obu &sequence_header_obu, const AV1SequenceHeader &sequence_header)
+{
+	ov::ByteStream stream(MIN_AV1CODECCONFIGURATIONRECORD_SIZE + sequence_header_obu.length + 8);
+
+	// marker(1) + version(7)
+	stream.Write8(0x80 | 1);
+	// seq_profile(3) + seq_level_idx_0(5)
+	stream.Write8((sequence_header.GetProfile() << 5) | (sequence_header.GetLevelIdx() & 0x1F));
+	// seq_tier_0(1) + high_bitdepth(1) + twelve_bit(1) + monochrome(1) + chroma_subsampling_x(1) + chroma_subsampling_y(1) + chroma_sample_position(2)
+	stream.Write8(((sequence_header.GetTier() & 0x01) << 7) |
+				  ((sequence_header.IsHighBitDepth() ? 1 : 0) << 6) |
+				  ((sequence_header.IsTwelveBit() ? 1 : 0) << 5) |
+				  ((sequence_header.IsMonochrome() ? 1 : 0) << 4) |
+				  ((sequence_header.GetChromaSubsamplingX() & 0x01) << 3) |
+				  ((sequence_header.GetChromaSubsamplingY() & 0x01) << 2) |
+				  (sequence_header.GetChromaSamplePosition() & 0x03));
+	// reserved(3) + initial_presentation_delay_present(1) + initial_presentation_delay_minus_one(4)
+	if (sequence_header.IsInitialDisplayDelayPresent())
+	{
+		stream.Write8(0x10 | (sequence_header.GetInitialDisplayDelayMinusOne() & 0x0F));
+	}
+	else
+	{
+		stream.Write8(0x00);
+	}
+
+	// configOBUs - the sequence header OBU must have obu_size
+	if (OV_CHECK_FLAG(sequence_header_obu.header[0], AV1_OBU_HAS_SIZE_FIELD_MASK))
+	{
+		stream.Write(sequence_header_obu.data, sequence_header_obu.length);
+	}
+	else
+	{
+		uint8_t leb128[8];
+		auto leb128_size = AV1Parser::WriteLeb128(sequence_header_obu.payload_length, leb128);
+
+		stream.Write8(sequence_header_obu.header[0] | AV1_OBU_HAS_SIZE_FIELD_MASK);
+		stream.Write(sequence_header_obu.header + 1, sequence_header_obu.header_length - 1);
+		stream.Write(leb128, leb128_size);
+		stream.Write(sequence_header_obu.payload, sequence_header_obu.payload_length);
+	}
+
+	return stream.GetDataPointer();
+}
+
+uint8_t AV1CodecConfigurationRecord::Version() const
+{
+	return _version;
+}
+
+uint8_t AV1CodecConfigurationRecord::SeqProfile() const
+{
+	return _seq_profile;
+}
+
+uint8_t AV1CodecConfigurationRecord::SeqLevelIdx0() const
+{
+	return _seq_level_idx_0;
+}
+
+uint8_t AV1CodecConfigurationRecord::SeqTier0() const
+{
+	return _seq_tier_0;
+}
+
+uint8_t AV1CodecConfigurationRecord::BitDepth() const
+{
+	if (_high_bitdepth)
+	{
+		return _twelve_bit ? 12 : 10;
+	}
+
+	return 8;
+}
+
+const std::shared_ptr<ov::Data> &AV1CodecConfigurationRecord::ConfigObus() const
+{
+	return _config_obus;
+}
+
+ov::String AV1CodecConfigurationRecord::GetCodecsParameter() const
+{
+	// <sample entry 4CC>.<profile>.<level><tier>.<bitDepth>
+	return ov::String::FormatString("av01.%d.%02d%c.%02d", _seq_profile, _seq_level_idx_0, (_seq_tier_0 == 0) ? 'M' : 'H', BitDepth());
+}
+
+ov::String AV1CodecConfigurationRecord::GetInfoString() const
+{
+	ov::String out_str = ov::String::FormatString("\n[AV1CodecConfigurationRecord]\n");
+
+	out_str.AppendFormat("\tVersion(%d)\n", _version);
+	out_str.AppendFormat("\tSeqProfile(%d)\n", _seq_profile);
+	out_str.AppendFormat("\tSeqLevelIdx0(%d)\n", _seq_level_idx_0);
+	out_str.AppendFormat("\tSeqTier0(%d)\n", _seq_tier_0);
+	out_str.AppendFormat("\tBitDepth(%d)\n", BitDepth());
+	out_str.AppendFormat("\tMonochrome(%s)\n", _monochrome ? "true" : "false");
+	out_str.AppendFormat("\tChromaSubsampling(%d, %d)\n", _chroma_subsampling_x, _chroma_subsampling_y);
+	out_str.AppendFormat("\tChromaSamplePosition(%d)\n", _chroma_sample_position);
+	out_str.AppendFormat("\tConfigOBUs(%zu bytes)\n", (_config_obus != nullptr) ? _config_obus->GetLength() : 0);
+
+	return out_str;
+}
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <base/ovlibrary/ovlibrary.h>
+
+#include "av1_parser.h"
+
+//	AV1 Codec ISO Media File Format Binding, 2.3.3
+//
+//	aligned(8) class AV1CodecConfigurationRecord {
+//		unsigned int(1) marker = 1;
+//		unsigned int(7) version = 1;
+//		unsigned int(3) seq_profile;
+//		unsigned int(5) seq_level_idx_0;
+//		unsigned int(1) seq_tier_0;
+//		unsigned int(1) high_bitdepth;
+//		unsigned int(1) twelve_bit;
+//		unsigned int(1) monochrome;
+//		unsigned int(1) chroma_subsampling_x;
+//		unsigned int(1) chroma_subsampling_y;
+//		unsigned int(2) chroma_sample_position;
+//		unsigned int(3) reserved = 0;
+//		unsigned int(1) initial_presentation_delay_present;
+//		if (initial_presentation_delay_present) {
+//			unsigned int(4) initial_presentation_delay_minus_one;
+//		} else {
+//			unsigned int(4) reserved = 0;
+//		}
+//		unsigned int(8) configOBUs[];
+//	}
+
+#define MIN_AV1CODECCONFIGURATIONRECORD_SIZE 4
+
+class AV1CodecConfigurationRecord
+{
+public:
+	static bool Parse(const uint8_t *data, size_t data_length, AV1CodecConfigurationRecord &record);
+
+	// Makes the record of the OBU_SEQUENCE_HEADER (the whole OBU including obu_header())
+	static std::shared_ptr<ov::Data> Build(const AV1Obu &sequence_header_obu, const AV1SequenceHeader &sequence_header);
+
+	uint8_t Version() const;
+	uint8_t SeqProfile() const;
+	uint8_t SeqLevelIdx0() const;
+	uint8_t SeqTier0() const;
+	uint8_t BitDepth() const;
+
+	// configOBUs (OBU_SEQUENCE_HEADER and OBU_METADATA with obu_size)
+	const std::shared_ptr<ov::Data> &ConfigObus() const;
+
+	// "av01.P.LLT.DD" (AV1 Codec ISO Media File Format Binding, Annex A)
+	ov::String GetCodecsParameter() const;
+
+	ov::String GetInfoString() const;
+
+private:
+	uint8_t _version = 0;
+	uint8_t _seq_profile = 0;	  // (3 bits)
+	uint8_t _seq_level_idx_0 = 0;  // (5 bits)
+	uint8_t _seq_tier_0 = 0;	  // (1 bit)
+	bool _high_bitdepth = false;
+	bool _twelve_bit = false;
+	bool _monochrome = false;
+	uint8_t _chroma_subsampling_x = 0;
+	uint8_t _chroma_subsampling_y = 0;
+	uint8_t _chroma_sample_position = 0;  // (2 bits)
+
+	std::shared_ptr<ov::Data> _config_obus;
+};
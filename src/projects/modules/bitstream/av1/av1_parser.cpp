@@ -0,0 +1,538 @@
+#include "av1_parser.h"
+
+#include <base/ovlibrary/bit_reader.h>
+#include <base/ovlibrary/ovlibrary.h>
+
+#define OV_LOG_TAG "AV1Parser"
+
+// 4.10.5 uvlc()
+static bool ReadUvlc(BitReader &reader, uint32_t &value)
+{
+	uint8_t leading_zeros = 0;
+
+	while (true)
+	{
+		bool done;
+		if (reader.ReadBit(done) == false)
+		{
+			return false;
+		}
+
+		if (done)
+		{
+			break;
+		}
+
+		leading_zeros++;
+	}
+
+	if (leading_zeros >= 32)
+	{
+		value = UINT32_MAX;
+		return true;
+	}
+
+	uint32_t bits = 0;
+	if ((leading_zeros > 0) && (reader.ReadBits(leading_zeros, bits) == false))
+	{
+		return false;
+	}
+
+	value = bits + ((1U << leading_zeros) - 1);
+
+	return true;
+}
+
+ov::String AV1SequenceHeader::GetInfoString() const
+{
+	ov::String out_str = ov::String::FormatString("\n[AV1SequenceHeader]\n");
+
+	out_str.AppendFormat("\tProfile(%d)\n", _seq_profile);
+	out_str.AppendFormat("\tLevelIdx(%d)\n", _seq_level_idx_0);
+	out_str.AppendFormat("\tTier(%d)\n", _seq_tier_0);
+	out_str.AppendFormat("\tStillPicture(%s)\n", _still_picture ? "true" : "false");
+	out_str.AppendFormat("\tReducedStillPictureHeader(%s)\n", _reduced_still_picture_header ? "true" : "false");
+	out_str.AppendFormat("\tWidth(%u)\n", _max_frame_width);
+	out_str.AppendFormat("\tHeight(%u)\n", _max_frame_height);
+	out_str.AppendFormat("\tBitDepth(%d)\n", _bit_depth);
+	out_str.AppendFormat("\tMonochrome(%s)\n", _mono_chrome ? "true" : "false");
+	out_str.AppendFormat("\tSubsampling(%d, %d)\n", _subsampling_x, _subsampling_y);
+	out_str.AppendFormat("\tChromaSamplePosition(%d)\n", _chroma_sample_position);
+	out_str.AppendFormat("\tColor(primaries: %d, transfer: %d, matrix: %d, full range: %s)\n", _color_primaries, _transfer_characteristics, _matrix_coefficients, _color_range ? "true" : "false");
+
+	return out_str;
+}
+
+bool AV1Parser::ReadLeb128(const uint8_t *data, size_t data_length, uint64_t &value, size_t &read_bytes)
+{
+	value = 0;
+
+	// 4.10.5 leb128(): "It is a requirement of bitstream conformance that the most significant bit of leb128_byte is equal to 0 if i is equal to 7"
+	for (size_t i = 0; i < 8; i++)
+	{
+		if (i >= data_length)
+		{
+			return false;
+		}
+
+		uint8_t leb128_byte = data[i];
+		value |= static_cast<uint64_t>(leb128_byte & 0x7F) << (i * 7);
+
+		if ((leb128_byte & 0x80) == 0)
+		{
+			read_bytes = i + 1;
+			return value <= UINT32_MAX;
+		}
+	}
+
+	return false;
+}
+
+size_t AV1Parser::WriteLeb128(uint64_t value, uint8_t *buffer)
+{
+	size_t size = 0;
+
+	do
+	{
+		uint8_t leb128_byte = value & 0x7F;
+		value >>= 7;
+
+		if (value != 0)
+		{
+			leb128_byte |= 0x80;
+		}
+
+		buffer[size++] = leb128_byte;
+	} while ((value != 0) && (size < 8));
+
+	return size;
+}
+
+size_t AV1Parser::GetLeb128Size(uint64_t value)
+{
+	size_t size = 0;
+
+	do
+	{
+		value >>= 7;
+		size++;
+	} while (value != 0);
+
+	return size;
+}
+
+bool AV1Parser::ParseObuList(const uint8_t *bitstream, size_t length, std::vector<AV1Obu> &obu_list)
+{
+	size_t offset = 0;
+
+	while (offset < length)
+	{
+		AV1Obu obu;
+
+		obu.data = bitstream + offset;
+		obu.header = obu.data;
+
+		uint8_t header = obu.data[0];
+		if (OV_CHECK_FLAG(header, 0x80))
+		{
+			logtd("obu_forbidden_bit is set");
+			return false;
+		}
+
+		obu.type = static_cast<AV1ObuType>((header & AV1_OBU_TYPE_MASK) >> 3);
+		obu.header_length = AV1_OBU_HEADER_SIZE;
+
+		if (OV_CHECK_FLAG(header, AV1_OBU_EXTENSION_FLAG_MASK))
+		{
+			if (offset + AV1_OBU_HEADER_SIZE + AV1_OBU_EXTENSION_HEADER_SIZE > length)
+			{
+				return false;
+			}
+
+			uint8_t extension = obu.data[1];
+			obu.temporal_id = (extension >> 5) & 0x07;
+			obu.spatial_id = (extension >> 3) & 0x03;
+			obu.header_length += AV1_OBU_EXTENSION_HEADER_SIZE;
+		}
+
+		size_t position = offset + obu.header_length;
+
+		if (OV_CHECK_FLAG(header, AV1_OBU_HAS_SIZE_FIELD_MASK))
+		{
+			uint64_t obu_size;
+			size_t leb128_size;
+
+			if (ReadLeb128(bitstream + position, length - position, obu_size, leb128_size) == false)
+			{
+				return false;
+			}
+
+			position += leb128_size;
+
+			if (obu_size > length - position)
+			{
+				logtd("Invalid obu_size: %" PRIu64 " (remained: %zu)", obu_size, length - position);
+				return false;
+			}
+
+			obu.payload_length = obu_size;
+		}
+		else
+		{
+			// Only the last OBU of the temporal unit may omit obu_size
+			obu.payload_length = length - position;
+		}
+
+		obu.payload = bitstream + position;
+		obu.length = (position + obu.payload_length) - offset;
+
+		offset += obu.length;
+
+		obu_list.push_back(obu);
+	}
+
+	return true;
+}
+
+bool AV1Parser::ParseSequenceHeader(const uint8_t *payload, size_t length, AV1SequenceHeader &header)
+{
+	BitReader reader(payload, length);
+
+	header._seq_profile = reader.ReadBits<uint8_t>(3);
+	header._still_picture = reader.ReadBoolBit();
+	header._reduced_still_picture_header = reader.ReadBoolBit();
+
+	if (header._seq_profile > 2)
+	{
+		logtd("Invalid seq_profile: %d", header._seq_profile);
+		return false;
+	}
+
+	if (header._reduced_still_picture_header)
+	{
+		header._seq_level_idx_0 = reader.ReadBits<uint8_t>(5);
+		header._seq_tier_0 = 0;
+	}
+	else
+	{
+		bool decoder_model_info_present_flag = false;
+		uint8_t buffer_delay_length_minus_1 = 0;
+
+		bool timing_info_present_flag = reader.ReadBoolBit();
+		if (timing_info_present_flag)
+		{
+			// timing_info()
+			// num_units_in_display_tick(32) + time_scale(32)
+			reader.ReadBits<uint32_t>(32);
+			reader.ReadBits<uint32_t>(32);
+
+			bool equal_picture_interval = reader.ReadBoolBit();
+			if (equal_picture_interval)
+			{
+				uint32_t num_ticks_per_picture_minus_1;
+				if (ReadUvlc(reader, num_ticks_per_picture_minus_1) == false)
+				{
+					return false;
+				}
+			}
+
+			decoder_model_info_present_flag = reader.ReadBoolBit();
+			if (decoder_model_info_present_flag)
+			{
+				// decoder_model_info()
+				buffer_delay_length_minus_1 = reader.ReadBits<uint8_t>(5);
+				// num_units_in_decoding_tick(32) + buffer_removal_time_length_minus_1(5) + frame_presentation_time_length_minus_1(5)
+				reader.ReadBits<uint32_t>(32);
+				reader.ReadBits<uint8_t>(5);
+				reader.ReadBits<uint8_t>(5);
+			}
+		}
+
+		bool initial_display_delay_present_flag = reader.ReadBoolBit();
+		uint8_t operating_points_cnt_minus_1 = reader.ReadBits<uint8_t>(5);
+
+		for (int i = 0; i <= operating_points_cnt_minus_1; i++)
+		{
+			// operating_point_idc[i]
+			reader.ReadBits<uint16_t>(12);
+
+			uint8_t seq_level_idx = reader.ReadBits<uint8_t>(5);
+			uint8_t seq_tier = 0;
+			if (seq_level_idx > 7)
+			{
+				seq_tier = reader.ReadBits<uint8_t>(1);
+			}
+
+			if (decoder_model_info_present_flag)
+			{
+				bool decoder_model_present_for_this_op = reader.ReadBoolBit();
+				if (decoder_model_present_for_this_op)
+				{
+					// operating_parameters_info()
+					// decoder_buffer_delay(n) + encoder_buffer_delay(n) + low_delay_mode_flag(1)
+					uint8_t n = buffer_delay_length_minus_1 + 1;
+					reader.ReadBits<uint32_t>(n);
+					reader.ReadBits<uint32_t>(n);
+					reader.ReadBits<uint8_t>(1);
+				}
+			}
+
+			bool initial_display_delay_present_for_this_op = false;
+			uint8_t initial_display_delay_minus_1 = 0;
+			if (initial_display_delay_present_flag)
+			{
+				initial_display_delay_present_for_this_op = reader.ReadBoolBit();
+				if (initial_display_delay_present_for_this_op)
+				{
+					initial_display_delay_minus_1 = reader.ReadBits<uint8_t>(4);
+				}
+			}
+
+			if (i == 0)
+			{
+				header._seq_level_idx_0 = seq_level_idx;
+				header._seq_tier_0 = seq_tier;
+				header._initial_display_delay_present_for_op_0 = initial_display_delay_present_for_this_op;
+				header._initial_display_delay_minus_1_for_op_0 = initial_display_delay_minus_1;
+			}
+		}
+	}
+
+	uint8_t frame_width_bits_minus_1 = reader.ReadBits<uint8_t>(4);
+	uint8_t frame_height_bits_minus_1 = reader.ReadBits<uint8_t>(4);
+
+	uint32_t max_frame_width_minus_1;
+	uint32_t max_frame_height_minus_1;
+	if ((reader.ReadBits(frame_width_bits_minus_1 + 1, max_frame_width_minus_1) == false) ||
+		(reader.ReadBits(frame_height_bits_minus_1 + 1, max_frame_height_minus_1) == false))
+	{
+		logtd("Could not read the frame size");
+		return false;
+	}
+
+	header._max_frame_width = max_frame_width_minus_1 + 1;
+	header._max_frame_height = max_frame_height_minus_1 + 1;
+
+	bool frame_id_numbers_present_flag = false;
+	if (header._reduced_still_picture_header == false)
+	{
+		frame_id_numbers_present_flag = reader.ReadBoolBit();
+	}
+
+	if (frame_id_numbers_present_flag)
+	{
+		// delta_frame_id_length_minus_2(4) + additional_frame_id_length_minus_1(3)
+		reader.ReadBits<uint8_t>(4);
+		reader.ReadBits<uint8_t>(3);
+	}
+
+	// use_128x128_superblock(1) + enable_filter_intra(1) + enable_intra_edge_filter(1)
+	reader.ReadBits<uint8_t>(3);
+
+	if (header._reduced_still_picture_header == false)
+	{
+		// enable_interintra_compound(1) + enable_masked_compound(1) + enable_warped_motion(1) + enable_dual_filter(1)
+		reader.ReadBits<uint8_t>(4);
+
+		bool enable_order_hint = reader.ReadBoolBit();
+		if (enable_order_hint)
+		{
+			// enable_jnt_comp(1) + enable_ref_frame_mvs(1)
+			reader.ReadBits<uint8_t>(2);
+		}
+
+		// SELECT_SCREEN_CONTENT_TOOLS
+		uint8_t seq_force_screen_content_tools = 2;
+		bool seq_choose_screen_content_tools = reader.ReadBoolBit();
+		if (seq_choose_screen_content_tools == false)
+		{
+			seq_force_screen_content_tools = reader.ReadBits<uint8_t>(1);
+		}
+
+		if (seq_force_screen_content_tools > 0)
+		{
+			bool seq_choose_integer_mv = reader.ReadBoolBit();
+			if (seq_choose_integer_mv == false)
+			{
+				// seq_force_integer_mv
+				reader.ReadBits<uint8_t>(1);
+			}
+		}
+
+		if (enable_order_hint)
+		{
+			// order_hint_bits_minus_1
+			reader.ReadBits<uint8_t>(3);
+		}
+	}
+
+	// enable_superres(1) + enable_cdef(1) + enable_restoration(1)
+	reader.ReadBits<uint8_t>(3);
+
+	// color_config()
+	header._high_bitdepth = reader.ReadBoolBit();
+	if ((header._seq_profile == 2) && header._high_bitdepth)
+	{
+		header._twelve_bit = reader.ReadBoolBit();
+		header._bit_depth = header._twelve_bit ? 12 : 10;
+	}
+	else
+	{
+		header._bit_depth = header._high_bitdepth ? 10 : 8;
+	}
+
+	if (header._seq_profile != 1)
+	{
+		header._mono_chrome = reader.ReadBoolBit();
+	}
+
+	bool color_description_present_flag = reader.ReadBoolBit();
+	if (color_description_present_flag)
+	{
+		header._color_primaries = reader.ReadBits<uint8_t>(8);
+		header._transfer_characteristics = reader.ReadBits<uint8_t>(8);
+		header._matrix_coefficients = reader.ReadBits<uint8_t>(8);
+	}
+
+	if (header._mono_chrome)
+	{
+		header._color_range = reader.ReadBoolBit();
+		header._subsampling_x = 1;
+		header._subsampling_y = 1;
+		header._chroma_sample_position = 0;
+	}
+	// CP_BT_709, TC_SRGB, MC_IDENTITY
+	else if ((header._color_primaries == 1) && (header._transfer_characteristics == 13) && (header._matrix_coefficients == 0))
+	{
+		header._color_range = true;
+		header._subsampling_x = 0;
+		header._subsampling_y = 0;
+	}
+	else
+	{
+		header._color_range = reader.ReadBoolBit();
+
+		if (header._seq_profile == 0)
+		{
+			header._subsampling_x = 1;
+			header._subsampling_y = 1;
+		}
+		else if (header._seq_profile == 1)
+		{
+			header._subsampling_x = 0;
+			header._subsampling_y = 0;
+		}
+		else
+		{
+			if (header._bit_depth == 12)
+			{
+				header._subsampling_x = reader.ReadBits<uint8_t>(1);
+				header._subsampling_y = (header._subsampling_x == 1) ? reader.ReadBits<uint8_t>(1) : 0;
+			}
+			else
+			{
+				header._subsampling_x = 1;
+				header._subsampling_y = 0;
+			}
+		}
+
+		if ((header._subsampling_x == 1) && (header._subsampling_y == 1))
+		{
+			header._chroma_sample_position = reader.ReadBits<uint8_t>(2);
+		}
+	}
+
+	// separate_uv_delta_q(1) + film_grain_params_present(1)
+	uint8_t remained_flags;
+	if (reader.ReadBits(2, remained_flags) == false)
+	{
+		logtd("The sequence header is truncated");
+		return false;
+	}
+
+	return true;
+}
+
+bool AV1Parser::IsKeyFrame(const std::vector<AV1Obu> &obu_list, bool reduced_still_picture_header)
+{
+	for (const auto &obu : obu_list)
+	{
+		if ((obu.type != AV1ObuType::Frame) && (obu.type != AV1ObuType::FrameHeader))
+		{
+			continue;
+		}
+
+		// The base layer decides whether the temporal unit is a random access point
+		if (obu.spatial_id != 0)
+		{
+			continue;
+		}
+
+		if (reduced_still_picture_header)
+		{
+			return true;
+		}
+
+		// uncompressed_header()
+		BitReader reader(obu.payload, obu.payload_length);
+
+		bool show_existing_frame;
+		if (reader.ReadBit(show_existing_frame) == false)
+		{
+			return false;
+		}
+
+		if (show_existing_frame)
+		{
+			// Shows a frame decoded earlier, it cannot be decoded on its own
+			return false;
+		}
+
+		uint8_t frame_type;
+		bool show_frame;
+		if ((reader.ReadBits(2, frame_type) == false) || (reader.ReadBit(show_frame) == false))
+		{
+			return false;
+		}
+
+		return (static_cast<AV1FrameType>(frame_type) == AV1FrameType::KeyFrame) && show_frame;
+	}
+
+	return false;
+}
+
+bool AV1Parser::IsKeyFrame(const uint8_t *bitstream, size_t length)
+{
+	std::vector<AV1Obu> obu_list;
+	if (ParseObuList(bitstream, length, obu_list) == false)
+	{
+		return false;
+	}
+
+	bool reduced_still_picture_header = false;
+
+	auto sequence_header_obu = FindObu(obu_list, AV1ObuType::SequenceHeader);
+	if (sequence_header_obu != nullptr)
+	{
+		AV1SequenceHeader sequence_header;
+		if (ParseSequenceHeader(sequence_header_obu->payload, sequence_header_obu->payload_length, sequence_header))
+		{
+			reduced_still_picture_header = sequence_header.IsReducedStillPictureHeader();
+		}
+	}
+
+	return IsKeyFrame(obu_list, reduced_still_picture_header);
+}
+
+const AV1Obu *AV1Parser::FindObu(const std::vector<AV1Obu> &obu_list, AV1ObuType type)
+{
+	for (const auto &obu : obu_list)
+	{
+		if (obu.type == type)
+		{
+			return &obu;
+		}
+	}
+
+	return nullptr;
+}
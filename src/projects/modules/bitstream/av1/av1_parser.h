@@ -0,0 +1,145 @@
+#pragma once
+
+#include <base/ovlibrary/ovlibrary.h>
+
+#include "av1_types.h"
+
+// AV1 Bitstream & Decoding Process Specification, 5.5 (sequence_header_obu)
+class AV1SequenceHeader
+{
+public:
+	uint8_t GetProfile() const
+	{
+		return _seq_profile;
+	}
+
+	bool IsStillPicture() const
+	{
+		return _still_picture;
+	}
+
+	bool IsReducedStillPictureHeader() const
+	{
+		return _reduced_still_picture_header;
+	}
+
+	// seq_level_idx[0] and seq_tier[0] (the operating point 0)
+	uint8_t GetLevelIdx() const
+	{
+		return _seq_level_idx_0;
+	}
+
+	uint8_t GetTier() const
+	{
+		return _seq_tier_0;
+	}
+
+	uint32_t GetWidth() const
+	{
+		return _max_frame_width;
+	}
+
+	uint32_t GetHeight() const
+	{
+		return _max_frame_height;
+	}
+
+	bool IsHighBitDepth() const
+	{
+		return _high_bitdepth;
+	}
+
+	bool IsTwelveBit() const
+	{
+		return _twelve_bit;
+	}
+
+	uint8_t GetBitDepth() const
+	{
+		return _bit_depth;
+	}
+
+	bool IsMonochrome() const
+	{
+		return _mono_chrome;
+	}
+
+	uint8_t GetChromaSubsamplingX() const
+	{
+		return _subsampling_x;
+	}
+
+	uint8_t GetChromaSubsamplingY() const
+	{
+		return _subsampling_y;
+	}
+
+	uint8_t GetChromaSamplePosition() const
+	{
+		return _chroma_sample_position;
+	}
+
+	bool IsInitialDisplayDelayPresent() const
+	{
+		return _initial_display_delay_present_for_op_0;
+	}
+
+	uint8_t GetInitialDisplayDelayMinusOne() const
+	{
+		return _initial_display_delay_minus_1_for_op_0;
+	}
+
+	ov::String GetInfoString() const;
+
+private:
+	friend class AV1Parser;
+
+	uint8_t _seq_profile = 0;
+	bool _still_picture = false;
+	bool _reduced_still_picture_header = false;
+
+	uint8_t _seq_level_idx_0 = 0;
+	uint8_t _seq_tier_0 = 0;
+	bool _initial_display_delay_present_for_op_0 = false;
+	uint8_t _initial_display_delay_minus_1_for_op_0 = 0;
+
+	uint32_t _max_frame_width = 0;
+	uint32_t _max_frame_height = 0;
+
+	// color_config()
+	bool _high_bitdepth = false;
+	bool _twelve_bit = false;
+	uint8_t _bit_depth = 8;
+	bool _mono_chrome = false;
+	uint8_t _color_primaries = 2;
+	uint8_t _transfer_characteristics = 2;
+	uint8_t _matrix_coefficients = 2;
+	bool _color_range = false;
+	uint8_t _subsampling_x = 1;
+	uint8_t _subsampling_y = 1;
+	uint8_t _chroma_sample_position = 0;
+};
+
+// Parses the AV1 bitstream of the Low Overhead Bitstream Format (every OBU has obu_size),
+// which is OME's internal bitstream format for AV1 (a temporal unit per packet)
+class AV1Parser
+{
+public:
+	// leb128()
+	static bool ReadLeb128(const uint8_t *data, size_t data_length, uint64_t &value, size_t &read_bytes);
+	// Returns the number of bytes written (up to 8 bytes)
+	static size_t WriteLeb128(uint64_t value, uint8_t *buffer);
+	static size_t GetLeb128Size(uint64_t value);
+
+	// Splits the temporal unit into OBUs
+	static bool ParseObuList(const uint8_t *bitstream, size_t length, std::vector<AV1Obu> &obu_list);
+
+	// payload: the payload of OBU_SEQUENCE_HEADER (without obu_header() and obu_size)
+	static bool ParseSequenceHeader(const uint8_t *payload, size_t length, AV1SequenceHeader &header);
+
+	// Whether the temporal unit starts with a key frame which is shown (a random access point)
+	static bool IsKeyFrame(const std::vector<AV1Obu> &obu_list, bool reduced_still_picture_header = false);
+	static bool IsKeyFrame(const uint8_t *bitstream, size_t length);
+
+	static const AV1Obu *FindObu(const std::vector<AV1Obu> &obu_list, AV1ObuType type);
+};
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <base/ovlibrary/ovlibrary.h>
+
+// AV1 Bitstream & Decoding Process Specification, 6.2.2 (obu_type)
+enum class AV1ObuType : uint8_t
+{
+	Reserved = 0,
+	SequenceHeader = 1,
+	TemporalDelimiter = 2,
+	FrameHeader = 3,
+	TileGroup = 4,
+	Metadata = 5,
+	Frame = 6,
+	RedundantFrameHeader = 7,
+	TileList = 8,
+	Padding = 15
+};
+
+// AV1 Bitstream & Decoding Process Specification, 6.8.2 (frame_type)
+enum class AV1FrameType : uint8_t
+{
+	KeyFrame = 0,
+	InterFrame = 1,
+	IntraOnlyFrame = 2,
+	SwitchFrame = 3
+};
+
+//	obu_header() {
+//		obu_forbidden_bit			f(1)
+//		obu_type					f(4)
+//		obu_extension_flag			f(1)
+//		obu_has_size_field			f(1)
+//		obu_reserved_1bit			f(1)
+//		if (obu_extension_flag == 1) {
+//			temporal_id				f(3)
+//			spatial_id				f(2)
+//			extension_header_reserved_3bits	f(3)
+//		}
+//	}
+#define AV1_OBU_HEADER_SIZE				1
+#define AV1_OBU_EXTENSION_HEADER_SIZE	1
+
+#define AV1_OBU_TYPE_MASK				0x78
+#define AV1_OBU_EXTENSION_FLAG_MASK		0x04
+#define AV1_OBU_HAS_SIZE_FIELD_MASK		0x02
+
+// An OBU of the temporal unit, it refers to the bitstream without copying
+struct AV1Obu
+{
+	AV1ObuType type = AV1ObuType::Reserved;
+	uint8_t temporal_id = 0;
+	uint8_t spatial_id = 0;
+
+	// obu_header() (1 or 2 bytes)
+	const uint8_t *header = nullptr;
+	size_t header_length = 0;
+
+	// The payload after obu_size
+	const uint8_t *payload = nullptr;
+	size_t payload_length = 0;
+
+	// The whole OBU including obu_size
+	const uint8_t *data = nullptr;
+	size_t length = 0;
+};
@@ -12,6 +12,7 @@
 
 #include "h264/h264_converter.h"
 #include "aac/aac_converter.h"
+#include "av1/av1_codec_configuration_record.h"
 
 class CodecMediaType
 {
@@ -72,6 +73,18 @@ public:
 				break;
 			}
 
+			case cmn::MediaCodecId::Av1: {
+				// av01.P.LLT.DD (AV1 Codec ISO Media File Format Binding, Annex A)
+				auto av1c_data = track->GetCodecComponentData(MediaTrack::CodecComponentDataType::AV1CodecConfigurationRecord);
+
+				AV1CodecConfigurationRecord record;
+				if ((av1c_data != nullptr) && AV1CodecConfigurationRecord::Parse(av1c_data->GetDataAs<uint8_t>(), av1c_data->GetLength(), record))
+				{
+					codec_string = record.GetCodecsParameter();
+				}
+				break;
+			}
+
 			case cmn::MediaCodecId::Aac: {
 				auto profile_string = AacConverter::GetProfileString(track->GetCodecComponentData(MediaTrack::CodecComponentDataType::AACSpecificConfig));
 
@@ -1,6 +1,8 @@
 
 #include "h264_converter.h"
 
+#include <base/ovlibrary/byte_io.h>
+
 #include "h264_decoder_configuration_record.h"
 #include "h264_parser.h"
 
@@ -141,55 +143,6 @@ bool H264Converter::ConvertAvccToAnnexb(cmn::PacketType type, const std::shared_
 	return true;
 }
 
-static inline int GetStartPatternSize(const void *data, size_t length, int first_pattern_size)
-{
-	if (data != nullptr)
-	{
-		auto buffer = static_cast<const uint8_t *>(data);
-
-		if (first_pattern_size > 0)
-		{
-			if ((buffer[0] == 0x00) && (buffer[1] == 0x00))
-			{
-				if (
-					(first_pattern_size == 4) &&
-					((length >= 4) && (buffer[2] == 0x00) && (buffer[3] == 0x01)))
-				{
-					// 0x00 0x00 0x00 0x01 pattern
-					return 4;
-				}
-				else if (
-					(first_pattern_size == 3) &&
-					((length >= 3) && (buffer[2] == 0x01)))
-				{
-					// 0x00 0x00 0x01 pattern
-					return 3;
-				}
-			}
-
-			// pattern_size must be the same with the first_pattern_size
-			return -1;
-		}
-		else
-		{
-			// probe mode
-
-			if ((length >= 4) && ((buffer[0] == 0x00) && (buffer[1] == 0x00) && (buffer[2] == 0x00) && (buffer[3] == 0x01)))
-			{
-				// 0x00 0x00 0x00 0x01 pattern
-				return 4;
-			}
-			if ((length >= 3) && ((buffer[0] == 0x00) && (buffer[1] == 0x00) && (buffer[2] == 0x01)))
-			{
-				// 0x00 0x00 0x01 pattern
-				return 3;
-			}
-		}
-	}
-
-	return -1;
-}
-
 #if 0
 static bool ExtractSpsPpsOffset(const std::shared_ptr<const ov::Data> &data, const std::vector<size_t> &offset_list, const std::vector<size_t> &pattern_size_list,
 								const std::shared_ptr<ov::Data> &sps, const std::shared_ptr<ov::Data> &pps)
@@ -269,65 +222,206 @@ static bool ExtractSpsPpsOffset(const std::shared_ptr<const ov::Data> &data, con
 }
 #endif
 
+bool H264Converter::ConvertAvccToAnnexbInPlace(ov::Data &data, FragmentationHeader *fragment_header)
+{
+	auto buffer = data.GetDataAs<uint8_t>();
+	size_t length = data.GetLength();
+	std::vector<size_t> offset_list;
+
+	// Validate all the lengths first, so <data> is not modified on failure
+	size_t offset = 0;
+	while (offset < length)
+	{
+		if ((length - offset) < sizeof(START_CODE))
+		{
+			return false;
+		}
+
+		size_t nal_length = ByteReader<uint32_t>::ReadBigEndian(buffer + offset);
+		offset += sizeof(START_CODE);
+
+		if (nal_length > (length - offset))
+		{
+			return false;
+		}
+
+		// [Length][Start Code][NAL unit]
+		if (((nal_length >= 3) && (buffer[offset] == 0x00) && (buffer[offset + 1] == 0x00) && (buffer[offset + 2] == 0x01)) ||
+			((nal_length >= 4) && (buffer[offset] == 0x00) && (buffer[offset + 1] == 0x00) && (buffer[offset + 2] == 0x00) && (buffer[offset + 3] == 0x01)))
+		{
+			return false;
+		}
+
+		offset_list.push_back(offset);
+		offset += nal_length;
+	}
+
+	if (offset_list.empty())
+	{
+		return false;
+	}
+
+	auto writable_buffer = data.GetWritableDataAs<uint8_t>();
+	if (writable_buffer == nullptr)
+	{
+		return false;
+	}
+
+	if (fragment_header != nullptr)
+	{
+		fragment_header->Clear();
+	}
+
+	for (size_t index = 0; index < offset_list.size(); index++)
+	{
+		auto nal_offset = offset_list[index];
+		auto next_offset = (index + 1 < offset_list.size()) ? (offset_list[index + 1] - sizeof(START_CODE)) : length;
+
+		::memcpy(writable_buffer + nal_offset - sizeof(START_CODE), START_CODE, sizeof(START_CODE));
+
+		if (fragment_header != nullptr)
+		{
+			fragment_header->fragmentation_offset.push_back(nal_offset);
+			fragment_header->fragmentation_length.push_back(next_offset - nal_offset);
+		}
+	}
+
+	return true;
+}
+
+// Finds the offsets of the start codes if <buffer> can be converted to AVCC in place (4-byte start codes only)
+static bool FindStartCodesForInPlaceConversion(const uint8_t *buffer, size_t length, std::vector<size_t> &offset_list)
+{
+	size_t offset = 0;
+
+	while (offset < length)
+	{
+		size_t start_code_size = 0;
+		auto pos = H264Parser::FindAnnexBStartCode(buffer + offset, length - offset, start_code_size);
+
+		if (pos == -1)
+		{
+			break;
+		}
+
+		// The data before the first start code and the empty NAL units are handled by ConvertAnnexbToAvcc()
+		if ((start_code_size != sizeof(START_CODE)) || (offset_list.empty() != (pos == 0)))
+		{
+			return false;
+		}
+
+		offset += pos;
+		offset_list.push_back(offset);
+		offset += start_code_size;
+	}
+
+	return (offset_list.empty() == false) && (offset_list.back() + sizeof(START_CODE) != length);
+}
+
+// Replaces the start codes at <offset_list> with the lengths of the NAL units
+static void WriteNalLengthsInPlace(uint8_t *buffer, size_t length, const std::vector<size_t> &offset_list)
+{
+	for (size_t index = 0; index < offset_list.size(); index++)
+	{
+		auto start_code_offset = offset_list[index];
+		auto next_offset = (index + 1 < offset_list.size()) ? offset_list[index + 1] : length;
+
+		ByteWriter<uint32_t>::WriteBigEndian(buffer + start_code_offset, next_offset - start_code_offset - sizeof(START_CODE));
+	}
+}
+
+bool H264Converter::ConvertAnnexbToAvccInPlace(ov::Data &data)
+{
+	std::vector<size_t> offset_list;
+
+	// Find all the start codes first, so <data> is not modified on failure
+	if (FindStartCodesForInPlaceConversion(data.GetDataAs<uint8_t>(), data.GetLength(), offset_list) == false)
+	{
+		return false;
+	}
+
+	auto writable_buffer = data.GetWritableDataAs<uint8_t>();
+	if (writable_buffer == nullptr)
+	{
+		return false;
+	}
+
+	WriteNalLengthsInPlace(writable_buffer, data.GetLength(), offset_list);
+
+	return true;
+}
+
 std::shared_ptr<ov::Data> H264Converter::ConvertAnnexbToAvcc(const std::shared_ptr<const ov::Data> &data)
 {
-	// size_t total_pattern_length = 0;
+	{
+		// Most encoders use 4-byte start codes, so if the data can be converted in place, it is copied once and the lengths are written over the start codes
+		std::vector<size_t> offset_list;
+
+		if (FindStartCodesForInPlaceConversion(data->GetDataAs<uint8_t>(), data->GetLength(), offset_list))
+		{
+			auto avcc_data = data->Clone();
+			auto writable_buffer = avcc_data->GetWritableDataAs<uint8_t>();
+
+			if (writable_buffer != nullptr)
+			{
+				WriteNalLengthsInPlace(writable_buffer, avcc_data->GetLength(), offset_list);
+				return avcc_data;
+			}
+		}
+	}
 
 	auto buffer = data->GetDataAs<uint8_t>();
-	size_t remained = data->GetLength();
-	off_t offset = 0;
-	off_t last_offset = 0;
+	size_t length = data->GetLength();
+	size_t offset = 0;
+	size_t last_offset = 0;
 
 	auto avcc_data = std::make_shared<ov::Data>(data->GetLength() + 32);
 	ov::ByteStream byte_stream(avcc_data);
 
 	// This code assumes that (NALULengthSizeMinusOne == 3)
-	while (remained > 0)
+	while (offset < length)
 	{
-		if (*buffer == 0x00)
-		{
-			auto pattern_size = GetStartPatternSize(buffer, remained, 0);
-
-			if (pattern_size > 0)
-			{
-				if (last_offset < offset)
-				{
-					auto nalu = data->Subdata(last_offset, offset - last_offset);
+		size_t start_code_size = 0;
+		auto pos = H264Parser::FindAnnexBStartCode(buffer + offset, length - offset, start_code_size);
 
-					byte_stream.WriteBE32(nalu->GetLength());
-					byte_stream.Write(nalu);
+		if (pos == -1)
+		{
+			break;
+		}
 
-					last_offset = offset;
-				}
+		offset += pos;
 
-				buffer += pattern_size;
-				offset += pattern_size;
-				last_offset += pattern_size;
-				remained -= pattern_size;
+		if (last_offset < offset)
+		{
+			auto nalu = data->Subdata(last_offset, offset - last_offset);
 
-				continue;
-			}
+			byte_stream.WriteBE32(nalu->GetLength());
+			byte_stream.Write(nalu);
 		}
 
-		buffer++;
-		offset++;
-		remained--;
+		offset += start_code_size;
+		last_offset = offset;
 	}
 
-	if (last_offset < offset)
+	if (last_offset < length)
 	{
 		// Append remained data
-		auto nalu = data->Subdata(last_offset, offset - last_offset);
+		auto nalu = data->Subdata(last_offset, length - last_offset);
 
 		byte_stream.WriteBE32(nalu->GetLength());
 		byte_stream.Write(nalu);
-
-		last_offset = offset;
 	}
 
 	return avcc_data;
 }
 
+std::shared_ptr<const ov::Data> H264Converter::ConvertAnnexbToAvcc(const std::shared_ptr<const MediaPacket> &packet)
+{
+	return packet->GetConvertedData(cmn::BitstreamFormat::H264_AVCC, [](const std::shared_ptr<const ov::Data> &data) {
+		return ConvertAnnexbToAvcc(data);
+	});
+}
+
 ov::String H264Converter::GetProfileString(const std::shared_ptr<ov::Data> &avc_decoder_configuration_record)
 {
 	if (avc_decoder_configuration_record == nullptr)
@@ -19,6 +19,19 @@ public:
 
 	static std::shared_ptr<ov::Data> ConvertAvccToAnnexb(const std::shared_ptr<const ov::Data> &data);
 	static std::shared_ptr<ov::Data> ConvertAnnexbToAvcc(const std::shared_ptr<const ov::Data> &data);
+	// Converts the payload of <packet> only once, and the result is shared by all callers of the same packet
+	static std::shared_ptr<const ov::Data> ConvertAnnexbToAvcc(const std::shared_ptr<const MediaPacket> &packet);
+
+	// In-place conversions: since a 4-byte start code and a 4-byte NAL length have the same size, the NAL units are not moved.
+	// (<data> is copied only if its buffer is shared with another ov::Data)
+	//
+	// Returns false without modifying <data> if <data> is not AVCC with 4-byte lengths,
+	// or if a NAL unit starts with a start code (some encoders send [Length][Start Code][NAL unit]).
+	// If <fragment_header> is not nullptr, the offsets/lengths of the NAL units are stored.
+	static bool ConvertAvccToAnnexbInPlace(ov::Data &data, FragmentationHeader *fragment_header = nullptr);
+	// Returns false without modifying <data> if <data> has a 3-byte start code or does not start with a start code,
+	// since it cannot be converted without moving the NAL units.
+	static bool ConvertAnnexbToAvccInPlace(ov::Data &data);
 
 	static std::tuple<std::shared_ptr<ov::Data>, FragmentationHeader> ConvertSpsPpsAsAnnexB(uint8_t start_code_size, const std::shared_ptr<const ov::Data> &sps, const std::shared_ptr<const ov::Data> &pps);
 };
@@ -1,38 +1,12 @@
 #include "h264_parser.h"
 
+#include <modules/bitstream/nalu/nal_unit_start_code.h>
+
 #define OV_LOG_TAG "H264Parser"
 
 int H264Parser::FindAnnexBStartCode(const uint8_t *bitstream, size_t length, size_t &start_code_size)
 {
-	size_t offset = 0;
-	start_code_size = 0;
-
-	while (offset < length)
-	{
-		size_t remaining = length - offset;
-		const uint8_t *data = bitstream + offset;
-
-		if ((remaining >= 3 && data[0] == 0x00 && data[1] == 0x00 && data[2] == 0x01) ||
-			(remaining >= 4 && data[0] == 0x00 && data[1] == 0x00 && data[2] == 0x00 && data[3] == 0x01))
-		{
-			if (data[2] == 0x01)
-			{
-				start_code_size = 3;
-			}
-			else
-			{
-				start_code_size = 4;
-			}
-
-			return offset;
-		}
-		else
-		{
-			offset += 1;
-		}
-	}
-
-	return -1;
+	return NalUnitStartCode::Find(bitstream, length, start_code_size);
 }
 
 bool H264Parser::CheckAnnexBKeyframe(const uint8_t *bitstream, size_t length)
@@ -51,7 +51,7 @@ public:
         return _max_nr_of_reference_frames;
     }
 
-    ov::String GetInfoString()
+    ov::String GetInfoString() const
     {
         ov::String out_str = ov::String::FormatString("\n[H264Sps]\n");
 
@@ -89,6 +89,11 @@ public:
     {
         return _type;
     }
+    // 0 means that the NAL unit is not used for the prediction of the other pictures
+    uint8_t GetNalRefIdc()
+    {
+        return _nal_ref_idc;
+    }
 private:
     uint8_t _nal_ref_idc = 0;
     H264NalUnitType _type = H264NalUnitType::Unspecified;
@@ -16,4 +16,10 @@ std::shared_ptr<const ov::Data> H265Converter::ConvertAnnexbToLengthPrefixed(con
 {
 	// Same as H.264
 	return H264Converter::ConvertAnnexbToAvcc(data);
-}
\ No newline at end of file
+}
+
+bool H265Converter::ConvertAnnexbToLengthPrefixedInPlace(ov::Data &data)
+{
+	// Same as H.264
+	return H264Converter::ConvertAnnexbToAvccInPlace(data);
+}
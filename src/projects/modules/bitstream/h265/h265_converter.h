@@ -14,4 +14,6 @@ class H265Converter
 {
 public:
 	static std::shared_ptr<const ov::Data> ConvertAnnexbToLengthPrefixed(const std::shared_ptr<const ov::Data> &data);
+	// Same as H264Converter::ConvertAnnexbToAvccInPlace()
+	static bool ConvertAnnexbToLengthPrefixedInPlace(ov::Data &data);
 };
@@ -0,0 +1,134 @@
+#include "h265_decoder_configuration_record.h"
+
+#include <base/ovlibrary/bit_reader.h>
+#include <base/ovlibrary/ovlibrary.h>
+
+#define OV_LOG_TAG "HEVCDecoderConfigurationRecord"
+
+bool HEVCDecoderConfigurationRecord::Parse(const uint8_t *data, size_t data_length, HEVCDecoderConfigurationRecord &record)
+{
+	if (data_length < MIN_HEVCDECODERCONFIGURATIONRECORD_SIZE)
+	{
+		logte("The data inputted is too small for parsing (%zu must be bigger than %d)", data_length, MIN_HEVCDECODERCONFIGURATIONRECORD_SIZE);
+		return false;
+	}
+
+	BitReader parser(data, data_length);
+
+	record._version = parser.ReadBytes<uint8_t>();
+	record._general_profile_space = parser.ReadBits<uint8_t>(2);
+	record._general_tier_flag = parser.ReadBits<uint8_t>(1);
+	record._general_profile_idc = parser.ReadBits<uint8_t>(5);
+	// general_profile_compatibility_flags(32) + general_constraint_indicator_flags(48)
+	parser.SkipBytes(4 + 6);
+	record._general_level_idc = parser.ReadBytes<uint8_t>();
+	// reserved(4) + min_spatial_segmentation_idc(12) + reserved(6) + parallelismType(2)
+	parser.SkipBytes(3);
+	parser.ReadBits<uint8_t>(6);
+	record._chroma_format = parser.ReadBits<uint8_t>(2);
+	parser.ReadBits<uint8_t>(5);
+	record._bit_depth_luma_minus8 = parser.ReadBits<uint8_t>(3);
+	parser.ReadBits<uint8_t>(5);
+	record._bit_depth_chroma_minus8 = parser.ReadBits<uint8_t>(3);
+	// avgFrameRate(16)
+	parser.SkipBytes(2);
+	// constantFrameRate(2) + numTemporalLayers(3) + temporalIdNested(1)
+	parser.ReadBits<uint8_t>(6);
+	record._length_size_minus_one = parser.ReadBits<uint8_t>(2);
+
+	if (record._length_size_minus_one == 2)
+	{
+		logte("Invalid lengthSizeMinusOne: %d", record._length_size_minus_one);
+		return false;
+	}
+
+	uint8_t num_of_arrays = parser.ReadBytes<uint8_t>();
+
+	for (int array_index = 0; array_index < num_of_arrays; array_index++)
+	{
+		if (parser.BytesRemained() < 3)
+		{
+			return false;
+		}
+
+		// array_completeness(1) + reserved(1)
+		parser.ReadBits<uint8_t>(2);
+		uint8_t nal_unit_type = parser.ReadBits<uint8_t>(6);
+		uint16_t num_nalus = parser.ReadBytes<uint16_t>();
+
+		auto &nal_unit_list = record._nal_units[nal_unit_type];
+
+		for (int nalu_index = 0; nalu_index < num_nalus; nalu_index++)
+		{
+			uint16_t nal_unit_length = parser.ReadBytes<uint16_t>();
+			if ((nal_unit_length == 0) || (parser.BytesRemained() < nal_unit_length))
+			{
+				return false;
+			}
+
+			nal_unit_list.push_back(std::make_shared<ov::Data>(parser.CurrentPosition(), nal_unit_length));
+			parser.SkipBytes(nal_unit_length);
+		}
+	}
+
+	return true;
+}
+
+uint8_t HEVCDecoderConfigurationRecord::Version() const
+{
+	return _version;
+}
+
+uint8_t HEVCDecoderConfigurationRecord::GeneralProfileIdc() const
+{
+	return _general_profile_idc;
+}
+
+uint8_t HEVCDecoderConfigurationRecord::GeneralLevelIdc() const
+{
+	return _general_level_idc;
+}
+
+uint8_t HEVCDecoderConfigurationRecord::LengthOfNALUnit() const
+{
+	return _length_size_minus_one + 1;
+}
+
+const std::vector<std::shared_ptr<ov::Data>> &HEVCDecoderConfigurationRecord::GetNalUnits(H265NALUnitType type) const
+{
+	static const std::vector<std::shared_ptr<ov::Data>> empty_list;
+
+	auto item = _nal_units.find(static_cast<uint8_t>(type));
+
+	return (item != _nal_units.end()) ? item->second : empty_list;
+}
+
+std::shared_ptr<ov::Data> HEVCDecoderConfigurationRecord::GetParameterSetsAsAnnexB() const
+{
+	const uint8_t START_CODE[4] = {0x00, 0x00, 0x00, 0x01};
+
+	auto data = std::make_shared<ov::Data>();
+
+	for (auto type : {H265NALUnitType::VPS, H265NALUnitType::SPS, H265NALUnitType::PPS})
+	{
+		for (const auto &nal_unit : GetNalUnits(type))
+		{
+			data->Append(START_CODE, sizeof(START_CODE));
+			data->Append(nal_unit);
+		}
+	}
+
+	return data;
+}
+
+ov::String HEVCDecoderConfigurationRecord::GetInfoString() const
+{
+	return ov::String::FormatString(
+		"Version(%d) Profile(%d) Level(%d) ChromaFormat(%d) BitDepth(%d/%d) LengthOfNALUnit(%d) VPS(%zu) SPS(%zu) PPS(%zu)",
+		_version, _general_profile_idc, _general_level_idc,
+		_chroma_format, _bit_depth_luma_minus8 + 8, _bit_depth_chroma_minus8 + 8,
+		LengthOfNALUnit(),
+		GetNalUnits(H265NALUnitType::VPS).size(),
+		GetNalUnits(H265NALUnitType::SPS).size(),
+		GetNalUnits(H265NALUnitType::PPS).size());
+}
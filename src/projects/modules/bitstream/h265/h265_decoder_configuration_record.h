@@ -0,0 +1,79 @@
+#pragma once
+
+#include <base/ovlibrary/ovlibrary.h>
+
+#include "h265_types.h"
+
+//	ISO/IEC 14496-15, 8.3.3.1
+//
+//	aligned(8) class HEVCDecoderConfigurationRecord {
+//		unsigned int(8) configurationVersion = 1;
+//		unsigned int(2) general_profile_space;
+//		unsigned int(1) general_tier_flag;
+//		unsigned int(5) general_profile_idc;
+//		unsigned int(32) general_profile_compatibility_flags;
+//		unsigned int(48) general_constraint_indicator_flags;
+//		unsigned int(8) general_level_idc;
+//		bit(4) reserved = ‘1111’b;
+//		unsigned int(12) min_spatial_segmentation_idc;
+//		bit(6) reserved = ‘111111’b;
+//		unsigned int(2) parallelismType;
+//		bit(6) reserved = ‘111111’b;
+//		unsigned int(2) chromaFormat;
+//		bit(5) reserved = ‘11111’b;
+//		unsigned int(3) bitDepthLumaMinus8;
+//		bit(5) reserved = ‘11111’b;
+//		unsigned int(3) bitDepthChromaMinus8;
+//		bit(16) avgFrameRate;
+//		bit(2) constantFrameRate;
+//		bit(3) numTemporalLayers;
+//		bit(1) temporalIdNested;
+//		unsigned int(2) lengthSizeMinusOne;
+//		unsigned int(8) numOfArrays;
+//		for (j=0; j < numOfArrays; j++) {
+//			bit(1) array_completeness;
+//			unsigned int(1) reserved = 0;
+//			unsigned int(6) NAL_unit_type;
+//			unsigned int(16) numNalus;
+//			for (i=0; i< numNalus; i++) {
+//				unsigned int(16) nalUnitLength;
+//				bit(8*nalUnitLength) nalUnit;
+//			}
+//		}
+//	}
+
+#define MIN_HEVCDECODERCONFIGURATIONRECORD_SIZE 23
+
+class HEVCDecoderConfigurationRecord
+{
+public:
+	static bool Parse(const uint8_t *data, size_t data_length, HEVCDecoderConfigurationRecord &record);
+
+	uint8_t Version() const;
+	uint8_t GeneralProfileIdc() const;
+	uint8_t GeneralLevelIdc() const;
+	// Length of the NALUnitLength field (1, 2 or 4)
+	uint8_t LengthOfNALUnit() const;
+
+	// Returns the NAL units of the type (VPS, SPS, PPS, SEI)
+	const std::vector<std::shared_ptr<ov::Data>> &GetNalUnits(H265NALUnitType type) const;
+
+	// VPS, SPS and PPS with 4-byte start codes
+	std::shared_ptr<ov::Data> GetParameterSetsAsAnnexB() const;
+
+	ov::String GetInfoString() const;
+
+private:
+	uint8_t _version = 0;
+	uint8_t _general_profile_space = 0;	 // (2 bits)
+	uint8_t _general_tier_flag = 0;		 // (1 bit)
+	uint8_t _general_profile_idc = 0;	 // (5 bits)
+	uint8_t _general_level_idc = 0;
+	uint8_t _chroma_format = 0;			   // (2 bits)
+	uint8_t _bit_depth_luma_minus8 = 0;	   // (3 bits)
+	uint8_t _bit_depth_chroma_minus8 = 0;  // (3 bits)
+	uint8_t _length_size_minus_one = 0;	   // (2 bits) 0, 1, 3 corresponding to 1, 2, 4 (Usually 3)
+
+	// key: NAL_unit_type
+	std::map<uint8_t, std::vector<std::shared_ptr<ov::Data>>> _nal_units;
+};
@@ -113,7 +113,7 @@ public:
         return _id;
     }
 
-    ov::String GetInfoString()
+    ov::String GetInfoString() const
     {
         ov::String out_str = ov::String::FormatString("\n[H265Sps]\n");
 
@@ -1,49 +1,61 @@
 #include "nal_unit_bitstream_parser.h"
 
 NalUnitBitstreamParser::NalUnitBitstreamParser(const uint8_t *bitstream, size_t length)
-	: BitReader(nullptr, 0)
+	: _bitstream(bitstream),
+	  _length(length)
 {
-    // Parse the bitstream and skip emulation_prevention_three_byte
-   	_bitstream.reserve(length);
+}
+
+void NalUnitBitstreamParser::NextByte()
+{
+	_zero_count = (_bitstream[_offset] == 0x00) ? (_zero_count + 1) : 0;
+	_offset++;
+	_bit_offset = 0;
 
-	if (length < 4)
+	// 00 00 03 00 ==> 00 00 00
+	// 00 00 03 01 ==> 00 00 01
+	// 00 00 03 02 ==> 00 00 02
+	// 00 00 03 03 ==> 00 00 03
+	// 00 00 03 00 00 03 00 ==> 00 00 00 00 00
+	if ((_zero_count >= 2) &&
+		((_offset + 1) < _length) &&
+		(_bitstream[_offset] == 0x03) &&
+		((_bitstream[_offset + 1] | 0b11) == 0b11))
 	{
-		// No need to decode EBSP 
-		_bitstream.insert(_bitstream.end(), bitstream, bitstream + length);
+		// Skip the '03'
+		_offset++;
+		_zero_count = 0;
 	}
-	else
+}
+
+bool NalUnitBitstreamParser::ReadBit(uint8_t &value)
+{
+	return ReadBits(1, value);
+}
+
+bool NalUnitBitstreamParser::ReadBit(bool &value)
+{
+	uint8_t bit;
+
+	if (ReadBit(bit))
 	{
-		// EBSP to RBSP
-		for (size_t original_bitstream_offset = 0; original_bitstream_offset < length;)
-		{
-			// 00 00 03 00 ==> 00 00 00
-			// 00 00 03 01 ==> 00 00 01
-			// 00 00 03 02 ==> 00 00 02
-			// 00 00 03 03 ==> 00 00 03
-			// 00 00 03 00 00 03 00 ==> 00 00 00 00 00
-
-			if (original_bitstream_offset + 3 < length && 
-						bitstream[original_bitstream_offset] == 0x00 && 
-						bitstream[original_bitstream_offset + 1] == 0x00 && 
-						bitstream[original_bitstream_offset + 2] == 0x03 &&
-						((bitstream[original_bitstream_offset + 3] | 0b11) == 0b11)) 
-			{
-				_bitstream.emplace_back(bitstream[original_bitstream_offset]);
-				original_bitstream_offset ++;
-				_bitstream.emplace_back(bitstream[original_bitstream_offset]);
-				original_bitstream_offset += 2; // skip the '03'
-			}
-			else
-			{
-				_bitstream.emplace_back(bitstream[original_bitstream_offset]);
-				original_bitstream_offset ++;
-			}
-		}
+		value = (bit == 1);
+		return true;
 	}
-    
-	_buffer = _bitstream.data();
-	_capacity = _bitstream.size();
-	_position = _buffer;
+
+	return false;
+}
+
+uint8_t NalUnitBitstreamParser::ReadBit()
+{
+	uint8_t value;
+
+	if (ReadBit(value) == false)
+	{
+		return 0;
+	}
+
+	return value;
 }
 
 bool NalUnitBitstreamParser::ReadU8(uint8_t &value)
@@ -64,54 +76,74 @@ bool NalUnitBitstreamParser::ReadU32(uint32_t &value)
 bool NalUnitBitstreamParser::ReadUEV(uint32_t &value)
 {
 	value = 0;
-    int zero_bit_count = 0;
-    uint8_t bit;
-    while (true)
-    {
-        if (ReadBit(bit) == false)
-        {
-            return false;
-        }
-		
-        if (bit == 0)
-        {
-            zero_bit_count++;
-        }
-        else
-        {
-            break;
-        }
-    }
-
-    value = (1 << zero_bit_count) - 1;
-	
-	uint32_t rest;
-	ReadBits(zero_bit_count, rest);
-	value += rest;
-
-    return true;
+	int zero_bit_count = 0;
+	uint8_t bit;
+	while (true)
+	{
+		if (ReadBit(bit) == false)
+		{
+			return false;
+		}
+
+		if (bit == 1)
+		{
+			break;
+		}
+
+		zero_bit_count++;
+
+		// ue(v) is at most 32 bits in length
+		if (zero_bit_count > 31)
+		{
+			return false;
+		}
+	}
+
+	uint32_t rest = 0;
+	if ((zero_bit_count > 0) && (ReadBits(zero_bit_count, rest) == false))
+	{
+		return false;
+	}
+
+	value = ((1U << zero_bit_count) - 1) + rest;
+
+	return true;
 }
 
 bool NalUnitBitstreamParser::ReadSEV(int32_t &value)
 {
-    uint32_t uev_value;
-    if (ReadUEV(uev_value) == false)
-    {
-        return false;
-    }
-    if (uev_value % 2 == 0)
-    {
-        uev_value = (uev_value + 1) / 2;
-    }
-    else
-    {
-        uev_value /= -2;
-    }
-    return true;
+	uint32_t uev_value;
+	if (ReadUEV(uev_value) == false)
+	{
+		return false;
+	}
+
+	// 1 => 1, 2 => -1, 3 => 2, 4 => -2, ...
+	if (uev_value % 2 == 1)
+	{
+		value = static_cast<int32_t>((uev_value + 1) / 2);
+	}
+	else
+	{
+		value = -static_cast<int32_t>(uev_value / 2);
+	}
+
+	return true;
 }
 
 bool NalUnitBitstreamParser::Skip(uint32_t count)
 {
-    uint64_t dummy;
-	return ReadBits(count, dummy);
-}
\ No newline at end of file
+	uint64_t dummy;
+
+	while (count > 0)
+	{
+		const uint8_t bits = std::min<uint32_t>(count, 64);
+		if (ReadBits(bits, dummy) == false)
+		{
+			return false;
+		}
+		count -= bits;
+	}
+
+	return true;
+}
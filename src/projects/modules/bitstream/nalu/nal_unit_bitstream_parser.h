@@ -5,11 +5,55 @@
 #include <vector>
 
 // Parses the payload of the NAL unit without the starting byte
-class NalUnitBitstreamParser : public BitReader
+//
+// emulation_prevention_three_byte is skipped while reading, so the payload is neither copied nor converted to RBSP.
+// The payload must be kept until the parser is destroyed.
+class NalUnitBitstreamParser
 {
 public:
 	NalUnitBitstreamParser(const uint8_t *bitstream, size_t length);
 
+	template <typename T>
+	bool ReadBits(uint8_t bits, T &value)
+	{
+		if (bits > sizeof(value) * 8)
+		{
+			OV_ASSERT2(false);
+			return false;
+		}
+
+		value = 0;
+
+		while (bits > 0)
+		{
+			if (_offset >= _length)
+			{
+				return false;
+			}
+
+			const uint8_t bits_from_this_byte = std::min<uint8_t>(bits, 8 - _bit_offset);
+			const uint8_t shift = 8 - _bit_offset - bits_from_this_byte;
+			const uint8_t mask = (1 << bits_from_this_byte) - 1;
+
+			value <<= bits_from_this_byte;
+			value |= (_bitstream[_offset] >> shift) & mask;
+
+			bits -= bits_from_this_byte;
+			_bit_offset += bits_from_this_byte;
+
+			if (_bit_offset == 8)
+			{
+				NextByte();
+			}
+		}
+
+		return true;
+	}
+
+	bool ReadBit(uint8_t &value);
+	bool ReadBit(bool &value);
+	uint8_t ReadBit();
+
 	bool ReadU8(uint8_t &value);
 	bool ReadU16(uint16_t &value);
 	bool ReadU32(uint32_t &value);
@@ -18,5 +62,14 @@ public:
 	bool Skip(uint32_t count);
 
 private:
-	std::vector<uint8_t> _bitstream;
-};
\ No newline at end of file
+	// Moves to the next byte, skipping emulation_prevention_three_byte
+	void NextByte();
+
+	const uint8_t *_bitstream = nullptr;
+	size_t _length = 0;
+
+	size_t _offset = 0;
+	uint8_t _bit_offset = 0;
+	// Number of consecutive 0x00 bytes just before _offset
+	int _zero_count = 0;
+};
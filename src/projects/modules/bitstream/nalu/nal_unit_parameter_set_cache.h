@@ -0,0 +1,71 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <functional>
+#include <string_view>
+#include <vector>
+
+// Keeps the parsed parameter sets (VPS/SPS/PPS) of a stream, so that a parameter set that is repeated
+// on every key frame is parsed only once.
+// The entries are looked up by the hash of the raw bytes, and the bytes are compared to rule out collisions.
+// Not thread-safe: it is intended to be owned by a stream.
+template <typename T>
+class NalUnitParameterSetCache
+{
+public:
+	using ParseFunction = std::function<bool(const uint8_t *nalu, size_t length, T &parameter_set)>;
+
+	explicit NalUnitParameterSetCache(size_t max_count = 8)
+		: _max_count(max_count)
+	{
+	}
+
+	// Returns nullptr if the parameter set could not be parsed
+	const T *Get(const uint8_t *nalu, size_t length, const ParseFunction &parse)
+	{
+		auto hash = std::hash<std::string_view>()(std::string_view(reinterpret_cast<const char *>(nalu), length));
+
+		for (const auto &entry : _entry_list)
+		{
+			if ((entry.hash == hash) &&
+				(entry.raw.size() == length) &&
+				(::memcmp(entry.raw.data(), nalu, length) == 0))
+			{
+				return &entry.parameter_set;
+			}
+		}
+
+		T parameter_set;
+		if (parse(nalu, length, parameter_set) == false)
+		{
+			return nullptr;
+		}
+
+		if (_entry_list.size() >= _max_count)
+		{
+			_entry_list.pop_front();
+		}
+
+		_entry_list.push_back({hash, std::vector<uint8_t>(nalu, nalu + length), std::move(parameter_set)});
+
+		return &_entry_list.back().parameter_set;
+	}
+
+	void Clear()
+	{
+		_entry_list.clear();
+	}
+
+private:
+	struct Entry
+	{
+		size_t hash;
+		std::vector<uint8_t> raw;
+		T parameter_set;
+	};
+
+	size_t _max_count;
+	std::deque<Entry> _entry_list;
+};
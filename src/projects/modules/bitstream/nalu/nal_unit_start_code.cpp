@@ -0,0 +1,150 @@
+#include "nal_unit_start_code.h"
+
+#include <base/ovlibrary/cpu_features.h>
+
+#if defined(__SSE2__)
+#	include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#	include <arm_neon.h>
+#endif
+#if OV_CPU_DISPATCH_X86
+#	include <immintrin.h>
+#endif
+
+// Returns the offset of the first 0x00 0x00 0x01 at or after <offset>, or <length> if there is none
+static inline size_t FindThreeByteStartCodeScalar(const uint8_t *bitstream, size_t offset, size_t length)
+{
+	while (offset + 3 <= length)
+	{
+		auto third = bitstream[offset + 2];
+
+		if (third > 0x01)
+		{
+			// A start code cannot begin at offset, offset + 1 or offset + 2
+			offset += 3;
+		}
+		else if ((third == 0x01) && (bitstream[offset + 1] == 0x00) && (bitstream[offset] == 0x00))
+		{
+			return offset;
+		}
+		else
+		{
+			offset++;
+		}
+	}
+
+	return length;
+}
+
+using FindStartCodeFunction = size_t (*)(const uint8_t *bitstream, size_t length);
+
+// Returns the offset of the first 0x00 0x00 0x01, or <length> if there is none
+static size_t FindThreeByteStartCodeBaseline(const uint8_t *bitstream, size_t length)
+{
+	size_t offset = 0;
+
+	// 16 positions are tested at a time, which needs the 2 bytes after them
+#if defined(__SSE2__)
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i one = _mm_set1_epi8(0x01);
+
+	while (offset + 18 <= length)
+	{
+		auto byte0 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(bitstream + offset));
+		auto byte1 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(bitstream + offset + 1));
+		auto byte2 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(bitstream + offset + 2));
+
+		auto match = _mm_and_si128(_mm_and_si128(_mm_cmpeq_epi8(byte0, zero), _mm_cmpeq_epi8(byte1, zero)), _mm_cmpeq_epi8(byte2, one));
+		auto mask = static_cast<uint32_t>(_mm_movemask_epi8(match));
+
+		if (mask != 0)
+		{
+			return offset + __builtin_ctz(mask);
+		}
+
+		offset += 16;
+	}
+#elif defined(__ARM_NEON)
+	const uint8x16_t zero = vdupq_n_u8(0x00);
+	const uint8x16_t one = vdupq_n_u8(0x01);
+
+	while (offset + 18 <= length)
+	{
+		auto byte0 = vld1q_u8(bitstream + offset);
+		auto byte1 = vld1q_u8(bitstream + offset + 1);
+		auto byte2 = vld1q_u8(bitstream + offset + 2);
+
+		auto match = vandq_u8(vandq_u8(vceqq_u8(byte0, zero), vceqq_u8(byte1, zero)), vceqq_u8(byte2, one));
+		// NEON has no movemask, so each byte is narrowed to 4 bits of a 64-bit mask
+		auto mask = vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(match), 4)), 0);
+
+		if (mask != 0)
+		{
+			return offset + (__builtin_ctzll(mask) >> 2);
+		}
+
+		offset += 16;
+	}
+#endif
+
+	return FindThreeByteStartCodeScalar(bitstream, offset, length);
+}
+
+#if OV_CPU_DISPATCH_X86
+// Same as the baseline, but 32 positions are tested at a time
+OV_TARGET_AVX2 static size_t FindThreeByteStartCodeAvx2(const uint8_t *bitstream, size_t length)
+{
+	size_t offset = 0;
+
+	const __m256i zero = _mm256_setzero_si256();
+	const __m256i one = _mm256_set1_epi8(0x01);
+
+	while (offset + 34 <= length)
+	{
+		auto byte0 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(bitstream + offset));
+		auto byte1 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(bitstream + offset + 1));
+		auto byte2 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(bitstream + offset + 2));
+
+		auto match = _mm256_and_si256(_mm256_and_si256(_mm256_cmpeq_epi8(byte0, zero), _mm256_cmpeq_epi8(byte1, zero)), _mm256_cmpeq_epi8(byte2, one));
+		auto mask = static_cast<uint32_t>(_mm256_movemask_epi8(match));
+
+		if (mask != 0)
+		{
+			return offset + __builtin_ctz(mask);
+		}
+
+		offset += 32;
+	}
+
+	return FindThreeByteStartCodeScalar(bitstream, offset, length);
+}
+#endif
+
+static const FindStartCodeFunction FindThreeByteStartCode = ov::CpuFeatures::Select<FindStartCodeFunction>("nal.start_code", {
+#if OV_CPU_DISPATCH_X86
+	{ov::CpuFeature::Avx2, "avx2", FindThreeByteStartCodeAvx2},
+#endif
+	{ov::CpuFeature::None, OV_CPU_BASELINE_NAME, FindThreeByteStartCodeBaseline},
+});
+
+int NalUnitStartCode::Find(const uint8_t *bitstream, size_t length, size_t &start_code_size)
+{
+	start_code_size = 0;
+
+	auto offset = FindThreeByteStartCode(bitstream, length);
+
+	if (offset >= length)
+	{
+		return -1;
+	}
+
+	// 0x00 0x00 0x00 0x01 is found as 0x00 0x00 0x01 one byte later
+	if ((offset > 0) && (bitstream[offset - 1] == 0x00))
+	{
+		start_code_size = 4;
+		return static_cast<int>(offset - 1);
+	}
+
+	start_code_size = 3;
+	return static_cast<int>(offset);
+}
@@ -0,0 +1,14 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// Finds the Annex B start codes (0x00 0x00 0x01 or 0x00 0x00 0x00 0x01) of H.264/H.265 bitstreams.
+// 16 bytes are examined at a time with SSE2 (x86-64) or NEON (AArch64), and the other platforms use a scalar scanner.
+class NalUnitStartCode
+{
+public:
+	// returns offset (start point), start_code_size : 3(001) or 4(0001)
+	// returns -1 if there is no start code in the buffer
+	static int Find(const uint8_t *bitstream, size_t length, size_t &start_code_size);
+};
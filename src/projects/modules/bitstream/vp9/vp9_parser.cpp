@@ -0,0 +1,190 @@
+#include "vp9_parser.h"
+
+#include <base/ovlibrary/bit_reader.h>
+
+#define OV_LOG_TAG "VP9Parser"
+
+#define VP9_FRAME_MARKER		2
+#define VP9_SYNC_CODE			0x498342
+#define VP9_CS_RGB				7
+
+#define VP9_SUPERFRAME_MARKER_MASK	0xE0
+#define VP9_SUPERFRAME_MARKER		0xC0
+
+size_t VP9Parser::GetFirstFrameSize(const uint8_t *data, size_t data_length)
+{
+	// superframe_index() {
+	//		superframe_marker			f(3)
+	//		bytes_per_framesize_minus_1	f(2)
+	//		frames_in_superframe_minus_1	f(3)
+	//		for (i = 0; i < NumFrames; i++)
+	//			frame_sizes[i]			f(NumBytes * 8), little endian
+	//		superframe_marker ... (the same byte as the first one)
+	// }
+	uint8_t marker = data[data_length - 1];
+
+	if ((marker & VP9_SUPERFRAME_MARKER_MASK) != VP9_SUPERFRAME_MARKER)
+	{
+		return data_length;
+	}
+
+	size_t bytes_per_framesize = ((marker >> 3) & 0x03) + 1;
+	size_t frames_in_superframe = (marker & 0x07) + 1;
+	size_t index_size = 2 + (bytes_per_framesize * frames_in_superframe);
+
+	if ((data_length < index_size) || (data[data_length - index_size] != marker))
+	{
+		// It is not a superframe index
+		return data_length;
+	}
+
+	const uint8_t *frame_size_data = data + data_length - index_size + 1;
+	size_t frame_size = 0;
+
+	for (size_t i = 0; i < bytes_per_framesize; i++)
+	{
+		frame_size |= static_cast<size_t>(frame_size_data[i]) << (i * 8);
+	}
+
+	return std::min(frame_size, data_length - index_size);
+}
+
+bool VP9Parser::Parse(const uint8_t *data, size_t data_length, VP9Parser &parser)
+{
+	if (data == nullptr || data_length == 0)
+	{
+		logtw("Invalid VP9 bitstream");
+		return false;
+	}
+
+	// The first frame of the superframe tells whether it is a key frame
+	BitReader reader(data, GetFirstFrameSize(data, data_length));
+
+	if (reader.ReadBits<uint8_t>(2) != VP9_FRAME_MARKER)
+	{
+		logtw("Invalid VP9 frame marker");
+		return false;
+	}
+
+	uint8_t profile_low_bit = reader.ReadBit();
+	uint8_t profile_high_bit = reader.ReadBit();
+	parser._profile = (profile_high_bit << 1) + profile_low_bit;
+
+	if (parser._profile == 3)
+	{
+		// reserved_zero
+		reader.ReadBit();
+	}
+
+	parser._show_existing_frame = reader.ReadBoolBit();
+	if (parser._show_existing_frame)
+	{
+		// frame_to_show_map_idx(3), it shows a decoded frame again
+		parser._key_frame = false;
+		parser._show_frame = true;
+		return true;
+	}
+
+	parser._key_frame = (reader.ReadBit() == 0);
+	parser._show_frame = reader.ReadBoolBit();
+	parser._error_resilient_mode = reader.ReadBoolBit();
+
+	if (parser._key_frame)
+	{
+		if (reader.ReadBits<uint32_t>(24) != VP9_SYNC_CODE)
+		{
+			logtw("Invalid VP9 sync code");
+			return false;
+		}
+
+		// color_config()
+		if (parser._profile >= 2)
+		{
+			parser._bit_depth = reader.ReadBoolBit() ? 12 : 10;
+		}
+
+		parser._color_space = reader.ReadBits<uint8_t>(3);
+		if (parser._color_space != VP9_CS_RGB)
+		{
+			parser._color_range = reader.ReadBoolBit();
+
+			if (parser._profile == 1 || parser._profile == 3)
+			{
+				parser._subsampling_x = reader.ReadBit();
+				parser._subsampling_y = reader.ReadBit();
+				// reserved_zero
+				reader.ReadBit();
+			}
+		}
+		else
+		{
+			parser._color_range = true;
+			parser._subsampling_x = 0;
+			parser._subsampling_y = 0;
+
+			if (parser._profile == 1 || parser._profile == 3)
+			{
+				// reserved_zero
+				reader.ReadBit();
+			}
+		}
+
+		// frame_size()
+		uint32_t frame_width_minus_1 = 0;
+		uint32_t frame_height_minus_1 = 0;
+		if ((reader.ReadBits(16, frame_width_minus_1) == false) || (reader.ReadBits(16, frame_height_minus_1) == false))
+		{
+			logtw("Could not read the frame size of VP9 key frame");
+			return false;
+		}
+
+		parser._width = frame_width_minus_1 + 1;
+		parser._height = frame_height_minus_1 + 1;
+	}
+
+	return true;
+}
+
+bool VP9Parser::IsKeyFrame() const
+{
+	return _key_frame;
+}
+
+bool VP9Parser::IsShowFrame() const
+{
+	return _show_frame;
+}
+
+uint8_t VP9Parser::GetProfile() const
+{
+	return _profile;
+}
+
+uint8_t VP9Parser::GetBitDepth() const
+{
+	return _bit_depth;
+}
+
+uint16_t VP9Parser::GetWidth() const
+{
+	return _width;
+}
+
+uint16_t VP9Parser::GetHeight() const
+{
+	return _height;
+}
+
+ov::String VP9Parser::GetInfoString() const
+{
+	ov::String out_str = ov::String::FormatString("\n[VP9Parser]\n");
+
+	out_str.AppendFormat("\tProfile(%d)\n", _profile);
+	out_str.AppendFormat("\tKeyFrame(%s)\n", _key_frame ? "true" : "false");
+	out_str.AppendFormat("\tShowFrame(%s)\n", _show_frame ? "true" : "false");
+	out_str.AppendFormat("\tBitDepth(%d)\n", _bit_depth);
+	out_str.AppendFormat("\tColorSpace(%d)\n", _color_space);
+	out_str.AppendFormat("\tResolution(%dx%d)\n", _width, _height);
+
+	return out_str;
+}
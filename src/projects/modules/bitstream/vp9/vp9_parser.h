@@ -0,0 +1,41 @@
+#pragma once
+
+#include <base/ovlibrary/ovlibrary.h>
+
+#include <cstdint>
+
+// VP9 Bitstream & Decoding Process Specification, 6.2 (uncompressed_header)
+class VP9Parser
+{
+public:
+	static bool Parse(const uint8_t *data, size_t data_length, VP9Parser &parser);
+
+	bool IsKeyFrame() const;
+	bool IsShowFrame() const;
+	uint8_t GetProfile() const;
+	uint8_t GetBitDepth() const;
+	// Only available for the key frame
+	uint16_t GetWidth() const;
+	uint16_t GetHeight() const;
+
+	ov::String GetInfoString() const;
+
+private:
+	// If the data is a superframe, returns the size of the first frame in it (Annex B)
+	static size_t GetFirstFrameSize(const uint8_t *data, size_t data_length);
+
+	uint8_t _profile = 0;
+	bool _show_existing_frame = false;
+	bool _key_frame = false;
+	bool _show_frame = false;
+	bool _error_resilient_mode = false;
+
+	uint8_t _bit_depth = 8;
+	uint8_t _color_space = 0;
+	bool _color_range = false;
+	uint8_t _subsampling_x = 1;
+	uint8_t _subsampling_y = 1;
+
+	uint16_t _width = 0;
+	uint16_t _height = 0;
+};
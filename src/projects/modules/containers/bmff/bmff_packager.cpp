@@ -611,6 +611,14 @@ namespace bmff
 				return false;
 			}
 		}
+		else if (GetMediaTrack()->GetCodecId() == cmn::MediaCodecId::Av1)
+		{
+			if (WriteAv01Box(stream) == false)
+			{
+				logte("Packager::WriteStsdBox() - Failed to write av01 box");
+				return false;
+			}
+		}
 		else if (GetMediaTrack()->GetCodecId() == cmn::MediaCodecId::Aac)
 		{
 			if (WriteMp4aBox(stream) == false)
@@ -629,7 +637,7 @@ namespace bmff
 		return WriteFullBox(container_stream, "stsd", *stream.GetData(), 0, 0);
 	}
 
-	bool Packager::WriteAvc1Box(ov::ByteStream &container_stream)
+	bool Packager::WriteVisualSampleEntry(ov::ByteStream &stream)
 	{
 		// ISO/IEC 14496-12 8.5.2.2
 		// aligned(8) abstract class SampleEntry(unsigned int(32) format) extends Box(format)
@@ -655,22 +663,6 @@ namespace bmff
 		// 	int(16) pre_defined = -1;
 		// }
 
-		// ISO/IEC 14496-15 5.3.4.1
-		// class AVCSampleEntry() extends VisualSampleEntry(‘avc1’)
-		// {
-		// 	AVCConfigurationBox config;
-		// 	MPEG4BitRateBox();				 // optional
-		// 	MPEG4ExtensionDescriptorsBox();	 // optional
-		// }
-
-		// ISO/IEC 14496-15 5.3.4.1
-		// class AVCConfigurationBox extends Box(‘avcC’)
-		// {
-		// 	AVCDecoderConfigurationRecord() AVCConfig;
-		// }
-
-		ov::ByteStream stream(4096);
-
 		// Reserved int(8)[6]
 		for (int i=0; i<6; i++)
 		{
@@ -727,6 +719,33 @@ namespace bmff
 		// pre_defined is a 16-bit integer that must be set to -1.
 		stream.WriteBE16(-1);
 
+		return true;
+	}
+
+	bool Packager::WriteAvc1Box(ov::ByteStream &container_stream)
+	{
+		// ISO/IEC 14496-15 5.3.4.1
+		// class AVCSampleEntry() extends VisualSampleEntry(‘avc1’)
+		// {
+		// 	AVCConfigurationBox config;
+		// 	MPEG4BitRateBox();				 // optional
+		// 	MPEG4ExtensionDescriptorsBox();	 // optional
+		// }
+
+		// ISO/IEC 14496-15 5.3.4.1
+		// class AVCConfigurationBox extends Box(‘avcC’)
+		// {
+		// 	AVCDecoderConfigurationRecord() AVCConfig;
+		// }
+
+		ov::ByteStream stream(4096);
+
+		if (WriteVisualSampleEntry(stream) == false)
+		{
+			logte("Packager::WriteAvc1Box() - Failed to write visual sample entry");
+			return false;
+		}
+
 		if (WriteAvccBox(stream) == false)
 		{
 			logte("Packager::WriteAvc1Box() - Failed to write avcc box");
@@ -736,6 +755,49 @@ namespace bmff
 		return WriteBox(container_stream, "avc1", *stream.GetData());
 	}
 
+	bool Packager::WriteAv01Box(ov::ByteStream &container_stream)
+	{
+		// AV1 Codec ISO Media File Format Binding 2.2.3
+		// class AV1SampleEntry extends VisualSampleEntry('av01')
+		// {
+		// 	AV1CodecConfigurationBox config;
+		// }
+
+		ov::ByteStream stream(4096);
+
+		if (WriteVisualSampleEntry(stream) == false)
+		{
+			logte("Packager::WriteAv01Box() - Failed to write visual sample entry");
+			return false;
+		}
+
+		if (WriteAv1cBox(stream) == false)
+		{
+			logte("Packager::WriteAv01Box() - Failed to write av1C box");
+			return false;
+		}
+
+		return WriteBox(container_stream, "av01", *stream.GetData());
+	}
+
+	bool Packager::WriteAv1cBox(ov::ByteStream &container_stream)
+	{
+		// AV1 Codec ISO Media File Format Binding 2.3.3
+		// class AV1CodecConfigurationBox extends Box('av1C')
+		// {
+		// 	AV1CodecConfigurationRecord av1Config;
+		// }
+
+		auto av1c_data = GetMediaTrack()->GetCodecComponentData(MediaTrack::CodecComponentDataType::AV1CodecConfigurationRecord);
+		if (av1c_data == nullptr)
+		{
+			logte("Packager::WriteAv1cBox() - Failed to get AV1CodecConfigurationRecord");
+			return false;
+		}
+
+		return WriteBox(container_stream, "av1C", *av1c_data);
+	}
+
 	bool Packager::WriteAvccBox(ov::ByteStream &container_stream)
 	{
 		// ISO/IEC 14496-15 5.3.4.1
@@ -1434,47 +1496,30 @@ namespace bmff
 		// {
 		// }
 
-		auto start_offset = container_stream.GetLength();
-
 		if (samples->IsEmpty() == true)
 		{
 			logtw("Could not write moof box because input samples list is empty");
 			return false;
 		}
 
-		ov::ByteStream stream(4096);
-
-		if (WriteMfhdBox(stream, samples) == false)
+		if (WriteBoxHeader(container_stream, "moof", GetMoofBoxSize(samples)) == false)
 		{
-			logtw("Failed to write mfhd box");
+			logtw("Failed to write moof box");
 			return false;
 		}
 
-		if (WriteTrafBox(stream, samples) == false)
+		if (WriteMfhdBox(container_stream, samples) == false)
 		{
-			logtw("Failed to write traf box");
+			logtw("Failed to write mfhd box");
 			return false;
 		}
 
-		if (WriteBox(container_stream, "moof", *stream.GetData()) == false)
+		if (WriteTrafBox(container_stream, samples) == false)
 		{
-			logtw("Failed to write moof box");
+			logtw("Failed to write traf box");
 			return false;
 		}
 
-		// Update the data_offset field of the Trun box
-		// off_t offset = (-1 * (off_t)_last_trun_box_size) + (off_t)BMFF_FULL_BOX_HEADER_SIZE + (off_t)4/*[sample_count] field size*/;
-		// container_stream.MoveOffset(offset);
-		// container_stream.WriteBE32(container_stream.GetLength() + BMFF_BOX_HEADER_SIZE /* mdat header size */);
-		// // Restore
-		// container_stream.SetOffset(container_stream.GetLength());
-
-		auto container = container_stream.GetDataPointer();
-		auto p = container->GetWritableDataAs<uint8_t>();
-		auto pos = container_stream.GetLength() - _last_trun_box_size + BMFF_FULL_BOX_HEADER_SIZE + 4;
-
-		ByteWriter<uint32_t>::WriteBigEndian(p + pos, container_stream.GetLength() - start_offset + BMFF_BOX_HEADER_SIZE /* mdat header size */);
-
 		return true;
 	}
 
@@ -1486,12 +1531,13 @@ namespace bmff
 		// 	unsigned int(32) sequence_number;
 		// }
 
-		ov::ByteStream stream(8);
+		if (WriteFullBoxHeader(container_stream, "mfhd", GetMfhdBoxSize(), 0, 0) == false)
+		{
+			return false;
+		}
 
 		// unsigned int(32) sequence_number;
-		stream.WriteBE32(_sequence_number++);
-
-		return WriteFullBox(container_stream, "mfhd", *stream.GetData(), 0, 0);
+		return container_stream.WriteBE32(_sequence_number++);
 	}
 
 	bool Packager::WriteTrafBox(ov::ByteStream &container_stream, const std::shared_ptr<const Samples> &samples)
@@ -1501,27 +1547,30 @@ namespace bmff
 		// {
 		// }
 
-		ov::ByteStream stream(4096);
+		if (WriteBoxHeader(container_stream, "traf", GetTrafBoxSize(samples)) == false)
+		{
+			return false;
+		}
 
-		if (WriteTfhdBox(stream, samples) == false)
+		if (WriteTfhdBox(container_stream, samples) == false)
 		{
 			logtw("Failed to write tfhd box");
 			return false;
 		}
 
-		if (WriteTfdtBox(stream, samples) == false)
+		if (WriteTfdtBox(container_stream, samples) == false)
 		{
 			logtw("Failed to write tfdt box");
 			return false;
 		}
 
-		if (WriteTrunBox(stream, samples) == false)
+		if (WriteTrunBox(container_stream, samples) == false)
 		{
 			logtw("Failed to write trun box");
 			return false;
 		}
 
-		return WriteBox(container_stream, "traf", *stream.GetData());
+		return true;
 	}
 
 	bool Packager::WriteTfhdBox(ov::ByteStream &container_stream, const std::shared_ptr<const Samples> &samples)
@@ -1538,35 +1587,37 @@ namespace bmff
 		// 	unsigned int(32) default_sample_flags
 		// }
 
-		ov::ByteStream stream(64);
+		// tf_flags
+		// 0x000001 base-data-offset-present:
+		// 0x000002 sample-description-index-present:
+		// 0x000008 default-sample-duration-present
+		// 0x000010 default-sample-size-present
+		// 0x000020 default-sample-flags-present
+		// 0x010000 duration-is-empty:
+		// 0x020000 default‐base‐is‐moof: if base‐data‐offset‐present is 1, this flag is ignored. If base-data-offset-present is zero, this indicates that the base-data-offset for this track fragment is the position of the first byte of the enclosing Movie Fragment Box. Support for the default‐base‐is‐moof flag is required under the ‘iso5’ brand, and it shall not be used in brands or compatible brands earlier than iso5.
+		if (WriteFullBoxHeader(container_stream, "tfhd", GetTfhdBoxSize(), 0, 0x2 | 0x8 | 0x10 | 0x20 | 0x020000) == false)
+		{
+			return false;
+		}
 
 		// unsigned int(32) track_ID;
-		stream.WriteBE32(GetMediaTrack()->GetId()+1);
+		container_stream.WriteBE32(GetMediaTrack()->GetId()+1);
 
 		// unsigned int(64) base_data_offset;
 
 		// unsigned int(32) sample_description_index;
-		stream.WriteBE32(1);
+		container_stream.WriteBE32(1);
 
 		// unsigned int(32) default_sample_duration;
-		stream.WriteBE32(33);
+		container_stream.WriteBE32(33);
 
 		// unsigned int(32) default_sample_size;
-		stream.WriteBE32(0);
+		container_stream.WriteBE32(0);
 
 		// unsigned int(32) default_sample_flags;
-		stream.WriteBE32(0);
+		container_stream.WriteBE32(0);
 
-		// tf_flags
-		// 0x000001 base-data-offset-present:
-		// 0x000002 sample-description-index-present:
-		// 0x000008 default-sample-duration-present
-		// 0x000010 default-sample-size-present
-		// 0x000020 default-sample-flags-present
-		// 0x010000 duration-is-empty:
-		// 0x020000 default‐base‐is‐moof: if base‐data‐offset‐present is 1, this flag is ignored. If base-data-offset-present is zero, this indicates that the base-data-offset for this track fragment is the position of the first byte of the enclosing Movie Fragment Box. Support for the default‐base‐is‐moof flag is required under the ‘iso5’ brand, and it shall not be used in brands or compatible brands earlier than iso5.
-		
-		return WriteFullBox(container_stream, "tfhd", *stream.GetData(), 0, 0x2 | 0x8 | 0x10 | 0x20 |0x020000);
+		return true;
 	}
 
 	bool Packager::WriteTfdtBox(ov::ByteStream &container_stream, const std::shared_ptr<const Samples> &samples)
@@ -1584,8 +1635,6 @@ namespace bmff
 		// 	}
 		// }
 
-		ov::ByteStream stream(32);
-
 		// unsigned int(64) baseMediaDecodeTime;
 		// baseMediaDecodeTime is an integer equal to the sum of the decode durations of all earlier samples in the media, 
 		// expressed in the media's timescale. It does not include the samples added in the enclosing track fragment.
@@ -1594,10 +1643,13 @@ namespace bmff
 			return false;
 		}
 
-		auto base_media_decode_time = samples->GetAt(0)->GetDts();
-		stream.WriteBE64(base_media_decode_time);
+		if (WriteFullBoxHeader(container_stream, "tfdt", GetTfdtBoxSize(), 1, 0) == false)
+		{
+			return false;
+		}
 
-		return WriteFullBox(container_stream, "tfdt", *stream.GetData(), 1, 0);
+		auto base_media_decode_time = samples->GetAt(0)->GetDts();
+		return container_stream.WriteBE64(base_media_decode_time);
 	}
 
 	bool Packager::WriteTrunBox(ov::ByteStream &container_stream, const std::shared_ptr<const Samples> &samples)
@@ -1650,50 +1702,57 @@ namespace bmff
 		//		- This is the distance from the start of moof to data.
 		// first_sample_flags provides a set of flags for the first sample only of this run.
 
-		ov::ByteStream stream(1024);
+		uint8_t version = GetMediaTrack()->GetMediaType() == cmn::MediaType::Video ? 1 : 0;
+
+		if (WriteFullBoxHeader(container_stream, "trun", GetTrunBoxSize(samples), version, tr_flags) == false)
+		{
+			return false;
+		}
+
+		bool is_video = GetMediaTrack()->GetMediaType() == cmn::MediaType::Video;
+
+		// The fields and the sample table are written with one capacity check
+		auto cursor = container_stream.ReserveWrite(GetTrunBoxSize(samples) - BMFF_FULL_BOX_HEADER_SIZE);
+		if (cursor.IsValid() == false)
+		{
+			return false;
+		}
 
 		// unsigned int(32) sample_count;
-		stream.WriteBE32(samples->GetTotalCount());
+		cursor.WriteBE32(samples->GetList().size());
 
 		// signed int(32) data_offset;
 		// Note(Getroot): This is not required for BMFF, but required for MS Smooth Streaming. (https://docs.microsoft.com/en-us/openspecs/windows_protocols/ms-sstr/6d796f37-b4f0-475f-becd-13f1c86c2d1f) 
 		// Therefore, it is assumed that some players may not be able to play normally without an offset.
 
 		// sizeof(Moof box) + Mdat box header(8)
-		// It will be updated after writing the whole Moof box.
-		stream.WriteBE32(0); 
+		cursor.WriteBE32(GetMoofBoxSize(samples) + BMFF_BOX_HEADER_SIZE);
 		
 		for (const auto &sample : samples->GetList())
 		{
 			// unsigned int(32) sample_duration;
-			stream.WriteBE32(sample->GetDuration());
+			cursor.WriteBE32(sample->GetDuration());
 
-			if (GetMediaTrack()->GetMediaType() == cmn::MediaType::Video)
+			if (is_video)
 			{
 				// unsigned int(32) sample_size;
-				stream.WriteBE32(sample->GetData()->GetLength());
+				cursor.WriteBE32(sample->GetData()->GetLength());
 
 				// unsigned int(32) sample_flags;
 				uint32_t sample_flags = 0;
 				GetSampleFlags(sample, sample_flags);
-				stream.WriteBE32(sample_flags);
+				cursor.WriteBE32(sample_flags);
 
 				// unsigned int(32) sample_composition_time_offset;
-				stream.WriteBE32(int32_t(sample->GetPts() - sample->GetDts()));
+				cursor.WriteBE32(int32_t(sample->GetPts() - sample->GetDts()));
 			}
 			else
 			{
-				stream.WriteBE32(sample->GetData()->GetLength());
+				cursor.WriteBE32(sample->GetData()->GetLength());
 			}
 		}
 
-		// Store the size of the last trun box in _last_trun_box_size below. Since the trun box is positioned at the end of the moof, 
-		// it is used to find the position of the data_offset of the trun box in reverse.
-		_last_trun_box_size = BMFF_FULL_BOX_HEADER_SIZE + stream.GetOffset();
-
-		uint8_t version = GetMediaTrack()->GetMediaType() == cmn::MediaType::Video ? 1 : 0;
-
-		return WriteFullBox(container_stream, "trun", *stream.GetData(), version, tr_flags);
+		return true;
 	}
 
 	bool Packager::GetSampleFlags(const std::shared_ptr<const MediaPacket> &sample, uint32_t &flags)
@@ -1762,15 +1821,68 @@ namespace bmff
 		// {
 		// 	bit(8) data[];
 		// }
-		auto data = std::make_shared<ov::Data>(samples->GetTotalSize());
+		// The samples are copied into the container directly
+		if (WriteBoxHeader(container_stream, "mdat", GetMdatBoxSize(samples)) == false)
+		{
+			return false;
+		}
+
 		for (const auto &sample : samples->GetList())
 		{
-			data->Append(sample->GetData());
+			auto &data = sample->GetData();
+
+			if (container_stream.Write(data->GetData(), data->GetLength()) == false)
+			{
+				return false;
+			}
 		}
 
-		return WriteBox(container_stream, "mdat", *data);
+		return true;
 	}
 	
+	size_t Packager::GetMoofBoxSize(const std::shared_ptr<const Samples> &samples) const
+	{
+		return BMFF_BOX_HEADER_SIZE + GetMfhdBoxSize() + GetTrafBoxSize(samples);
+	}
+
+	size_t Packager::GetMfhdBoxSize() const
+	{
+		// sequence_number(4)
+		return BMFF_FULL_BOX_HEADER_SIZE + 4;
+	}
+
+	size_t Packager::GetTrafBoxSize(const std::shared_ptr<const Samples> &samples) const
+	{
+		return BMFF_BOX_HEADER_SIZE + GetTfhdBoxSize() + GetTfdtBoxSize() + GetTrunBoxSize(samples);
+	}
+
+	size_t Packager::GetTfhdBoxSize() const
+	{
+		// track_ID(4) + sample_description_index(4) + default_sample_duration(4) + default_sample_size(4) + default_sample_flags(4)
+		return BMFF_FULL_BOX_HEADER_SIZE + 20;
+	}
+
+	size_t Packager::GetTfdtBoxSize() const
+	{
+		// baseMediaDecodeTime(8)
+		return BMFF_FULL_BOX_HEADER_SIZE + 8;
+	}
+
+	size_t Packager::GetTrunBoxSize(const std::shared_ptr<const Samples> &samples) const
+	{
+		// Video: sample_duration(4) + sample_size(4) + sample_flags(4) + sample_composition_time_offset(4)
+		// Audio: sample_duration(4) + sample_size(4)
+		size_t sample_entry_size = (GetMediaTrack()->GetMediaType() == cmn::MediaType::Video) ? 16 : 8;
+
+		// sample_count(4) + data_offset(4) + entries
+		return BMFF_FULL_BOX_HEADER_SIZE + 4 + 4 + (samples->GetList().size() * sample_entry_size);
+	}
+
+	size_t Packager::GetMdatBoxSize(const std::shared_ptr<const Samples> &samples) const
+	{
+		return BMFF_BOX_HEADER_SIZE + samples->GetTotalSize();
+	}
+
 	bool Packager::WriteBaseDescriptor(ov::ByteStream &stream, uint8_t tag, const ov::Data &data)
 	{
 		// ISO/IEC 14496-1 7.2.2.2
@@ -1835,18 +1947,11 @@ namespace bmff
 		// 	}
 		// }
 
-		// box_name must be 4 bytes or less
-		if (box_name.GetLength() != 4)
+		if (WriteBoxHeader(stream, box_name, box_data.GetLength() + BMFF_BOX_HEADER_SIZE) == false)
 		{
-			// Assert
-			OV_ASSERT2(false);
 			return false;
 		}
 
-		auto box_size = box_data.GetLength() + BMFF_BOX_HEADER_SIZE;
-		stream.WriteBE32(box_size);
-		stream.WriteText(box_name);
-
 		// box_data
 		return stream.Write(box_data.GetData(), box_data.GetLength());
 	}
@@ -1861,23 +1966,43 @@ namespace bmff
 		// 	bit(24) flags = f;
 		// }
 
+		if (WriteFullBoxHeader(stream, box_name, box_data.GetLength() + BMFF_FULL_BOX_HEADER_SIZE, version, flags) == false)
+		{
+			return false;
+		}
+
+		// box_data
+		return stream.Write(box_data.GetData(), box_data.GetLength());
+	}
+
+	bool Packager::WriteBoxHeader(ov::ByteStream &stream, const ov::String &box_name, size_t box_size)
+	{
 		// box_name must be 4 bytes or less
-		if (box_name.GetLength() > 4)
+		if (box_name.GetLength() != 4)
 		{
 			// Assert
 			OV_ASSERT2(false);
 			return false;
 		}
 
-		auto box_size = box_data.GetLength() + BMFF_FULL_BOX_HEADER_SIZE;
+		stream.WriteBE32(box_size);
+		return stream.WriteText(box_name);
+	}
+
+	bool Packager::WriteFullBoxHeader(ov::ByteStream &stream, const ov::String &box_name, size_t box_size, uint8_t version, uint32_t flags)
+	{
+		// box_name must be 4 bytes or less
+		if (box_name.GetLength() > 4)
+		{
+			// Assert
+			OV_ASSERT2(false);
+			return false;
+		}
 
 		stream.WriteBE32(box_size);
 		stream.WriteText(box_name);
 		stream.Write8(version);
-		stream.WriteBE24(flags);
-
-		// box_data
-		return stream.Write(box_data.GetData(), box_data.GetLength());
+		return stream.WriteBE24(flags);
 	}
 
 } // namespace bmff
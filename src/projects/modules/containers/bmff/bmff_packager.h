@@ -143,8 +143,11 @@ namespace bmff
 		virtual bool  WriteUrlBox(ov::ByteStream &container_stream);
 		virtual bool WriteStblBox(ov::ByteStream &container_stream);
 		virtual bool WriteStsdBox(ov::ByteStream &container_stream);
+		virtual bool WriteVisualSampleEntry(ov::ByteStream &stream);
 		virtual bool WriteAvc1Box(ov::ByteStream &container_stream);
 		virtual bool WriteAvccBox(ov::ByteStream &container_stream);
+		virtual bool WriteAv01Box(ov::ByteStream &container_stream);
+		virtual bool WriteAv1cBox(ov::ByteStream &container_stream);
 		virtual bool WriteMp4aBox(ov::ByteStream &container_stream);
 		virtual bool WriteEsdsBox(ov::ByteStream &container_stream);
 		
@@ -176,20 +179,30 @@ namespace bmff
 
 		virtual bool WriteMdatBox(ov::ByteStream &container_stream, const std::shared_ptr<const Samples> &samples);
 
+		// The sizes of the moof/mdat boxes are calculated from the metadata of the samples, so the boxes can be written
+		// into the container in one pass (the header first) without building the children in temporary streams.
+		size_t GetMoofBoxSize(const std::shared_ptr<const Samples> &samples) const;
+		size_t GetMfhdBoxSize() const;
+		size_t GetTrafBoxSize(const std::shared_ptr<const Samples> &samples) const;
+		size_t GetTfhdBoxSize() const;
+		size_t GetTfdtBoxSize() const;
+		size_t GetTrunBoxSize(const std::shared_ptr<const Samples> &samples) const;
+		size_t GetMdatBoxSize(const std::shared_ptr<const Samples> &samples) const;
+
 		// Write BaseDescriptor
 		bool WriteBaseDescriptor(ov::ByteStream &stream, uint8_t tag, const ov::Data &data);
 		// Write Box
 		bool WriteBox(ov::ByteStream &stream, const ov::String &box_name, const ov::Data &box_data);
 		// Write Full Box
 		bool WriteFullBox(ov::ByteStream &stream, const ov::String &box_name, const ov::Data &box_data, uint8_t version, uint32_t flags);
+		// Write the header of Box/Full Box (box_size includes the header), and the caller writes the body after it
+		bool WriteBoxHeader(ov::ByteStream &stream, const ov::String &box_name, size_t box_size);
+		bool WriteFullBoxHeader(ov::ByteStream &stream, const ov::String &box_name, size_t box_size, uint8_t version, uint32_t flags);
 		
 	private:
 		std::shared_ptr<const MediaTrack> _media_track = nullptr;
 		std::shared_ptr<const MediaTrack> _data_track = nullptr;
 
 		uint32_t _sequence_number = 1; // For Mfhd Box
-
-		// Trun box size
-		uint32_t _last_trun_box_size = 0;
 	};
 }
\ No newline at end of file
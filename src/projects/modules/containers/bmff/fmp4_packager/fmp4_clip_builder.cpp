@@ -0,0 +1,388 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "fmp4_clip_builder.h"
+
+#include <cmath>
+
+#include "fmp4_private.h"
+
+namespace bmff
+{
+	static uint32_t ReadBE32(const uint8_t *data)
+	{
+		uint32_t value;
+		::memcpy(&value, data, sizeof(value));
+		return ov::BE32ToHost(value);
+	}
+
+	static uint64_t ReadBE64(const uint8_t *data)
+	{
+		uint64_t value;
+		::memcpy(&value, data, sizeof(value));
+		return ov::BE64ToHost(value);
+	}
+
+	static void WriteBE32(uint8_t *data, uint32_t value)
+	{
+		value = ov::HostToBE32(value);
+		::memcpy(data, &value, sizeof(value));
+	}
+
+	static void WriteBE64(uint8_t *data, uint64_t value)
+	{
+		value = ov::HostToBE64(value);
+		::memcpy(data, &value, sizeof(value));
+	}
+
+	static void WriteBox(ov::ByteStream &stream, const char *type, const ov::Data &payload)
+	{
+		stream.WriteBE32(static_cast<uint32_t>(payload.GetLength() + 8));
+		stream.Write(type, 4);
+		stream.Write(payload.GetData(), payload.GetLength());
+	}
+
+	bool FMP4ClipBuilder::ParseBox(const uint8_t *data, size_t offset, size_t end, Box &box)
+	{
+		if ((offset >= end) || ((end - offset) < 8))
+		{
+			return false;
+		}
+
+		box.offset = offset;
+		box.header_size = 8;
+		box.size = ReadBE32(data + offset);
+		::memcpy(box.type, data + offset + 4, 4);
+
+		if (box.size == 1)
+		{
+			// largesize
+			if ((end - offset) < 16)
+			{
+				return false;
+			}
+
+			box.header_size = 16;
+			box.size = ReadBE64(data + offset + 8);
+		}
+		else if (box.size == 0)
+		{
+			// The box extends to the end
+			box.size = end - offset;
+		}
+
+		return (box.size >= box.header_size) && (box.size <= (end - offset));
+	}
+
+	int64_t FMP4ClipBuilder::FindFirstDecodeTime(const ov::Data &data)
+	{
+		auto buffer = data.GetDataAs<uint8_t>();
+		auto length = data.GetLength();
+
+		Box box;
+		for (size_t offset = 0; ParseBox(buffer, offset, length, box); offset += box.size)
+		{
+			if (box.Is("moof") == false)
+			{
+				continue;
+			}
+
+			Box moof_child;
+			auto moof_end = box.offset + box.size;
+			for (size_t child_offset = box.offset + box.header_size; ParseBox(buffer, child_offset, moof_end, moof_child); child_offset += moof_child.size)
+			{
+				if (moof_child.Is("traf") == false)
+				{
+					continue;
+				}
+
+				Box traf_child;
+				auto traf_end = moof_child.offset + moof_child.size;
+				for (size_t traf_offset = moof_child.offset + moof_child.header_size; ParseBox(buffer, traf_offset, traf_end, traf_child); traf_offset += traf_child.size)
+				{
+					if (traf_child.Is("tfdt") && (traf_child.size >= traf_child.header_size + 8))
+					{
+						auto payload = buffer + traf_child.offset + traf_child.header_size;
+						auto version = payload[0];
+
+						if (version == 1)
+						{
+							return (traf_child.size >= traf_child.header_size + 12) ? static_cast<int64_t>(ReadBE64(payload + 4)) : -1;
+						}
+
+						return ReadBE32(payload + 4);
+					}
+				}
+			}
+		}
+
+		return -1;
+	}
+
+	bool FMP4ClipBuilder::AddTrack(int32_t track_id, uint32_t timescale, const std::shared_ptr<const ov::Data> &initialization_section)
+	{
+		if ((timescale == 0) || (initialization_section == nullptr) || (initialization_section->GetLength() == 0))
+		{
+			return false;
+		}
+
+		for (const auto &track : _tracks)
+		{
+			if (track->track_id == track_id)
+			{
+				return false;
+			}
+		}
+
+		auto track = std::make_shared<Track>();
+		track->track_id = track_id;
+		track->timescale = timescale;
+		track->initialization_section = initialization_section;
+
+		_tracks.push_back(track);
+
+		return true;
+	}
+
+	bool FMP4ClipBuilder::AppendSegment(int32_t track_id, const std::shared_ptr<const ov::Data> &segment)
+	{
+		if ((segment == nullptr) || (segment->GetLength() == 0))
+		{
+			return false;
+		}
+
+		for (const auto &track : _tracks)
+		{
+			if (track->track_id != track_id)
+			{
+				continue;
+			}
+
+			if (track->first_decode_time < 0)
+			{
+				track->first_decode_time = FindFirstDecodeTime(*segment);
+			}
+
+			_segments.push_back({track.get(), segment});
+			return true;
+		}
+
+		return false;
+	}
+
+	bool FMP4ClipBuilder::WriteInitializationSection(ov::ByteStream &stream)
+	{
+		// ftyp of the first track, and a moov with mvhd of the first track + trak of all tracks + mvex with trex of all tracks
+		std::shared_ptr<ov::Data> ftyp;
+		std::shared_ptr<ov::Data> mvhd;
+		ov::Data traks;
+		ov::Data trexs;
+		uint32_t max_track_id = 0;
+
+		for (const auto &track : _tracks)
+		{
+			auto buffer = track->initialization_section->GetDataAs<uint8_t>();
+			auto length = track->initialization_section->GetLength();
+
+			Box box;
+			for (size_t offset = 0; ParseBox(buffer, offset, length, box); offset += box.size)
+			{
+				if (box.Is("ftyp"))
+				{
+					if (ftyp == nullptr)
+					{
+						ftyp = std::make_shared<ov::Data>(buffer + box.offset, box.size);
+					}
+					continue;
+				}
+
+				if (box.Is("moov") == false)
+				{
+					continue;
+				}
+
+				Box moov_child;
+				auto moov_end = box.offset + box.size;
+				for (size_t child_offset = box.offset + box.header_size; ParseBox(buffer, child_offset, moov_end, moov_child); child_offset += moov_child.size)
+				{
+					if (moov_child.Is("mvhd"))
+					{
+						if (mvhd == nullptr)
+						{
+							mvhd = std::make_shared<ov::Data>(buffer + moov_child.offset, moov_child.size);
+						}
+					}
+					else if (moov_child.Is("trak"))
+					{
+						traks.Append(buffer + moov_child.offset, moov_child.size);
+
+						// track_ID of tkhd (it follows creation_time/modification_time which are 64-bit in version 1)
+						Box trak_child;
+						auto trak_end = moov_child.offset + moov_child.size;
+						for (size_t trak_offset = moov_child.offset + moov_child.header_size; ParseBox(buffer, trak_offset, trak_end, trak_child); trak_offset += trak_child.size)
+						{
+							if (trak_child.Is("tkhd") && (trak_child.size >= trak_child.header_size + 24))
+							{
+								auto payload = buffer + trak_child.offset + trak_child.header_size;
+								max_track_id = std::max(max_track_id, ReadBE32(payload + ((payload[0] == 1) ? 20 : 12)));
+							}
+						}
+					}
+					else if (moov_child.Is("mvex"))
+					{
+						// mehd (the duration of the fragmented movie) does not apply to the clip
+						Box mvex_child;
+						auto mvex_end = moov_child.offset + moov_child.size;
+						for (size_t mvex_offset = moov_child.offset + moov_child.header_size; ParseBox(buffer, mvex_offset, mvex_end, mvex_child); mvex_offset += mvex_child.size)
+						{
+							if (mvex_child.Is("trex"))
+							{
+								trexs.Append(buffer + mvex_child.offset, mvex_child.size);
+							}
+						}
+					}
+				}
+			}
+		}
+
+		if ((ftyp == nullptr) || (mvhd == nullptr) || (traks.GetLength() == 0))
+		{
+			logte("Could not find ftyp/mvhd/trak in the initialization sections");
+			return false;
+		}
+
+		// next_track_ID is the last field of mvhd
+		WriteBE32(mvhd->GetWritableDataAs<uint8_t>() + mvhd->GetLength() - 4, max_track_id + 1);
+
+		ov::ByteStream moov_stream(mvhd->GetLength() + traks.GetLength() + trexs.GetLength() + 8);
+		moov_stream.Write(mvhd->GetData(), mvhd->GetLength());
+		moov_stream.Write(traks.GetData(), traks.GetLength());
+		WriteBox(moov_stream, "mvex", trexs);
+
+		stream.Write(ftyp->GetData(), ftyp->GetLength());
+		WriteBox(stream, "moov", *moov_stream.GetData());
+
+		return true;
+	}
+
+	bool FMP4ClipBuilder::AppendFragments(ov::Data &output, const Segment &segment, int64_t decode_time_offset)
+	{
+		auto start = output.GetLength();
+		if (output.Append(segment.data) == false)
+		{
+			return false;
+		}
+
+		// The fragments are rewritten in the copy, so the segment in the storage is not changed
+		auto buffer = output.GetWritableDataAs<uint8_t>();
+		auto end = output.GetLength();
+
+		Box box;
+		for (size_t offset = start; ParseBox(buffer, offset, end, box); offset += box.size)
+		{
+			if (box.Is("moof") == false)
+			{
+				continue;
+			}
+
+			Box moof_child;
+			auto moof_end = box.offset + box.size;
+			for (size_t child_offset = box.offset + box.header_size; ParseBox(buffer, child_offset, moof_end, moof_child); child_offset += moof_child.size)
+			{
+				auto payload = buffer + moof_child.offset + moof_child.header_size;
+
+				if (moof_child.Is("mfhd") && (moof_child.size >= moof_child.header_size + 8))
+				{
+					WriteBE32(payload + 4, _sequence_number++);
+					continue;
+				}
+
+				if (moof_child.Is("traf") == false)
+				{
+					continue;
+				}
+
+				Box traf_child;
+				auto traf_end = moof_child.offset + moof_child.size;
+				for (size_t traf_offset = moof_child.offset + moof_child.header_size; ParseBox(buffer, traf_offset, traf_end, traf_child); traf_offset += traf_child.size)
+				{
+					if ((traf_child.Is("tfdt") == false) || (traf_child.size < traf_child.header_size + 8))
+					{
+						continue;
+					}
+
+					auto tfdt = buffer + traf_child.offset + traf_child.header_size;
+
+					if (tfdt[0] == 1)
+					{
+						if (traf_child.size >= traf_child.header_size + 12)
+						{
+							auto decode_time = static_cast<int64_t>(ReadBE64(tfdt + 4));
+							WriteBE64(tfdt + 4, static_cast<uint64_t>(std::max<int64_t>(decode_time - decode_time_offset, 0)));
+						}
+					}
+					else
+					{
+						auto decode_time = static_cast<int64_t>(ReadBE32(tfdt + 4));
+						WriteBE32(tfdt + 4, static_cast<uint32_t>(std::max<int64_t>(decode_time - decode_time_offset, 0)));
+					}
+				}
+			}
+		}
+
+		return true;
+	}
+
+	std::shared_ptr<ov::Data> FMP4ClipBuilder::Build()
+	{
+		if (_tracks.empty() || _segments.empty())
+		{
+			return nullptr;
+		}
+
+		size_t total_size = 0;
+		for (const auto &segment : _segments)
+		{
+			total_size += segment.data->GetLength();
+		}
+
+		ov::ByteStream stream(total_size + 4096);
+		if (WriteInitializationSection(stream) == false)
+		{
+			return nullptr;
+		}
+
+		// All tracks are rebased by the same time, so the tracks stay in sync
+		double start_time = -1.0;
+		for (const auto &track : _tracks)
+		{
+			if (track->first_decode_time >= 0)
+			{
+				auto first_time = static_cast<double>(track->first_decode_time) / track->timescale;
+				start_time = (start_time < 0.0) ? first_time : std::min(start_time, first_time);
+			}
+		}
+
+		start_time = std::max(start_time, 0.0);
+
+		auto output = stream.GetDataPointer();
+		_sequence_number = 1;
+
+		for (const auto &segment : _segments)
+		{
+			auto decode_time_offset = static_cast<int64_t>(std::llround(start_time * segment.track->timescale));
+
+			if (AppendFragments(*output, segment, decode_time_offset) == false)
+			{
+				logte("Could not append the segment of track %d to the clip", segment.track->track_id);
+				return nullptr;
+			}
+		}
+
+		return output;
+	}
+}  // namespace bmff
@@ -0,0 +1,76 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/ovlibrary/ovlibrary.h>
+
+namespace bmff
+{
+	// Builds a fragmented MP4 clip from the initialization sections and the media segments of FMP4Storage without re-muxing.
+	//
+	// - The moov of the clip has the trak/trex boxes of all tracks (the packager writes one track per initialization section)
+	// - The moof/mdat fragments are copied as they are, except that the sequence_number of mfhd is renumbered from 1
+	//   and baseMediaDecodeTime of tfdt is rebased so the clip starts at 0. The sizes of the boxes are not changed,
+	//   so the data offsets of trun (relative to moof) remain valid
+	class FMP4ClipBuilder
+	{
+	public:
+		// <timescale> is the timescale of the track (mdhd), which is used to rebase tfdt
+		bool AddTrack(int32_t track_id, uint32_t timescale, const std::shared_ptr<const ov::Data> &initialization_section);
+
+		// The segments must be appended in the order of the timeline
+		bool AppendSegment(int32_t track_id, const std::shared_ptr<const ov::Data> &segment);
+
+		std::shared_ptr<ov::Data> Build();
+
+	private:
+		struct Box
+		{
+			size_t offset = 0;
+			size_t header_size = 0;
+			size_t size = 0;
+			char type[4]{};
+
+			bool Is(const char *box_type) const
+			{
+				return ::memcmp(type, box_type, 4) == 0;
+			}
+		};
+
+		struct Track
+		{
+			int32_t track_id = 0;
+			uint32_t timescale = 0;
+			std::shared_ptr<const ov::Data> initialization_section;
+
+			// baseMediaDecodeTime of the first fragment
+			int64_t first_decode_time = -1;
+		};
+
+		struct Segment
+		{
+			Track *track = nullptr;
+			std::shared_ptr<const ov::Data> data;
+		};
+
+		// Parses the box at <offset> within [<offset>, <end>)
+		static bool ParseBox(const uint8_t *data, size_t offset, size_t end, Box &box);
+
+		// Returns the baseMediaDecodeTime of the first tfdt in <data>, or -1 if not found
+		static int64_t FindFirstDecodeTime(const ov::Data &data);
+
+		bool WriteInitializationSection(ov::ByteStream &stream);
+		// Appends <segment> with the rewritten mfhd/tfdt to <output>. <decode_time_offset> is subtracted from tfdt
+		bool AppendFragments(ov::Data &output, const Segment &segment, int64_t decode_time_offset);
+
+		std::vector<std::shared_ptr<Track>> _tracks;
+		std::vector<Segment> _segments;
+
+		uint32_t _sequence_number = 1;
+	};
+}  // namespace bmff
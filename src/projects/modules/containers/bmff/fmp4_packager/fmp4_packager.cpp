@@ -10,8 +10,11 @@
 #include "fmp4_packager.h"
 #include "fmp4_private.h"
 
+#include <cmath>
+
 #include <modules/bitstream/h264/h264_converter.h>
 #include <modules/bitstream/aac/aac_converter.h>
+#include <modules/bitstream/av1/av1_parser.h>
 
 #include <modules/id3v2/id3v2.h>
 #include <modules/id3v2/frames/id3v2_text_frame.h>
@@ -43,6 +46,7 @@ namespace bmff
 		}
 
 		if (track->GetCodecId() == cmn::MediaCodecId::H264 || 
+			track->GetCodecId() == cmn::MediaCodecId::Av1 ||
 			track->GetCodecId() == cmn::MediaCodecId::Aac)
 		{
 			// Supported codecs
@@ -153,7 +157,14 @@ namespace bmff
 			return false;
 		}
 
-		if (_samples_buffer != nullptr && _samples_buffer->GetTotalCount() > 0)
+		if (_config.segment_alignment == true)
+		{
+			if (StoreAlignedMediaChunkIfNeeded(next_frame) == false)
+			{
+				return false;
+			}
+		}
+		else if (_samples_buffer != nullptr && _samples_buffer->GetTotalCount() > 0)
 		{
 			// https://datatracker.ietf.org/doc/html/draft-pantos-hls-rfc8216bis#section-4.4.3.8
 			// The duration of a Partial Segment MUST be less than or equal to the Part Target Duration.  
@@ -202,55 +213,11 @@ namespace bmff
 				|| ((expected_duration_ms > _target_chunk_duration_ms) && (total_duration_ms >= _target_chunk_duration_ms * 0.85)) 
 				)
 			{
-				double reserve_buffer_size;
-				
-				if (GetMediaTrack()->GetMediaType() == cmn::MediaType::Video)
-				{
-					// Reserve 10 Mbps.
-					reserve_buffer_size = (_target_chunk_duration_ms / 1000.0) * ((10.0 * 1000.0 * 1000.0) / 8.0);
-				}
-				else
-				{
-					// Reserve 0.5 Mbps.
-					reserve_buffer_size = (_target_chunk_duration_ms / 1000.0) * ((0.5 * 1000.0 * 1000.0) / 8.0);
-				}
-
-				ov::ByteStream chunk_stream(reserve_buffer_size);
-				
-				auto data_samples = GetDataSamples(_samples_buffer->GetStartTimestamp(), _samples_buffer->GetEndTimestamp());
-				if (data_samples != nullptr)
+				if (StoreMediaChunk(last_partial_segment && next_frame_is_idr) == false)
 				{
-					if (WriteEmsgBox(chunk_stream, data_samples) == false)
-					{
-						logtw("FMP4Packager::AppendSample() - Failed to write emsg box");
-					}
-				}
-
-				if (WriteMoofBox(chunk_stream, _samples_buffer) == false)
-				{
-					logte("FMP4Packager::AppendSample() - Failed to write moof box");
 					return false;
 				}
 
-				if (WriteMdatBox(chunk_stream, _samples_buffer) == false)
-				{
-					logte("FMP4Packager::AppendSample() - Failed to write mdat box");
-					return false;
-				}
-
-				auto chunk = chunk_stream.GetDataPointer();
-
-				if (_storage != nullptr && _storage->AppendMediaChunk(chunk, 
-												_samples_buffer->GetStartTimestamp(), 
-												total_duration_ms, 
-												_samples_buffer->IsIndependent(), (last_partial_segment && next_frame_is_idr)) == false)
-				{
-					logte("FMP4Packager::AppendSample() - Failed to store media chunk");
-					return false;
-				}
-
-				_samples_buffer.reset();
-
 				// Set the average chunk duration to config.chunk_duration_ms
 				// _target_chunk_duration_ms -= total_duration_ms;
 				// _target_chunk_duration_ms += _config.chunk_duration_ms;
@@ -271,6 +238,113 @@ namespace bmff
 		return true;
 	}
 
+	int64_t FMP4Packager::GetIntervalIndex(int64_t timestamp, double duration_ms) const
+	{
+		double timestamp_ms = (static_cast<double>(timestamp) / GetMediaTrack()->GetTimeBase().GetTimescale()) * 1000.0;
+
+		return static_cast<int64_t>(std::floor(timestamp_ms / duration_ms));
+	}
+
+	bool FMP4Packager::StoreAlignedMediaChunkIfNeeded(const std::shared_ptr<const MediaPacket> &next_frame)
+	{
+		auto segment_index = GetIntervalIndex(next_frame->GetPts(), _config.segment_duration_ms);
+		auto chunk_index = GetIntervalIndex(next_frame->GetPts(), _config.chunk_duration_ms);
+
+		if ((_samples_buffer == nullptr) || (_samples_buffer->GetTotalCount() == 0))
+		{
+			if (_segment_interval_index == INT64_MIN)
+			{
+				// The first sample of the track
+				_segment_interval_index = segment_index;
+				_chunk_interval_index = chunk_index;
+			}
+
+			return true;
+		}
+
+		bool next_frame_is_idr = (next_frame->GetFlag() == MediaPacketFlag::Key) || (GetMediaTrack()->GetMediaType() == cmn::MediaType::Audio);
+
+		// A segment starts with the first keyframe in a new segment interval. The keyframes of the renditions are at the same timestamps, so are their segments.
+		// The intervals only move forward, so the B-frames before the boundary in presentation order do not cut a chunk.
+		bool last_chunk = next_frame_is_idr && (segment_index > _segment_interval_index);
+		bool chunk_boundary = (chunk_index > _chunk_interval_index);
+
+		if ((last_chunk == false) && (chunk_boundary == false))
+		{
+			return true;
+		}
+
+		// The parts end on the chunk boundaries, so they are not longer than the Part Target Duration.
+		// Only the first part of the stream and the last part of a segment may be shorter than 85% of it, which the spec allows.
+		if (StoreMediaChunk(last_chunk) == false)
+		{
+			return false;
+		}
+
+		if (last_chunk)
+		{
+			_segment_interval_index = segment_index;
+		}
+
+		_chunk_interval_index = std::max(_chunk_interval_index, chunk_index);
+
+		return true;
+	}
+
+	bool FMP4Packager::Flush()
+	{
+		if ((_samples_buffer == nullptr) || (_samples_buffer->GetTotalCount() == 0))
+		{
+			return true;
+		}
+
+		return StoreMediaChunk(true);
+	}
+
+	bool FMP4Packager::StoreMediaChunk(bool last_chunk)
+	{
+		double total_duration_ms = (static_cast<double>(_samples_buffer->GetTotalDuration()) / GetMediaTrack()->GetTimeBase().GetTimescale()) * 1000.0;
+
+		// The sizes of the moof and mdat boxes are known in advance, so they are written without reallocation (emsg boxes are rare and may grow the buffer)
+		ov::ByteStream chunk_stream(GetMoofBoxSize(_samples_buffer) + GetMdatBoxSize(_samples_buffer));
+
+		auto data_samples = GetDataSamples(_samples_buffer->GetStartTimestamp(), _samples_buffer->GetEndTimestamp());
+		if (data_samples != nullptr)
+		{
+			if (WriteEmsgBox(chunk_stream, data_samples) == false)
+			{
+				logtw("FMP4Packager::StoreMediaChunk() - Failed to write emsg box");
+			}
+		}
+
+		if (WriteMoofBox(chunk_stream, _samples_buffer) == false)
+		{
+			logte("FMP4Packager::StoreMediaChunk() - Failed to write moof box");
+			return false;
+		}
+
+		if (WriteMdatBox(chunk_stream, _samples_buffer) == false)
+		{
+			logte("FMP4Packager::StoreMediaChunk() - Failed to write mdat box");
+			return false;
+		}
+
+		auto chunk = chunk_stream.GetDataPointer();
+
+		if (_storage != nullptr && _storage->AppendMediaChunk(chunk,
+															   _samples_buffer->GetStartTimestamp(),
+															   total_duration_ms,
+															   _samples_buffer->IsIndependent(), last_chunk) == false)
+		{
+			logte("FMP4Packager::StoreMediaChunk() - Failed to store media chunk");
+			return false;
+		}
+
+		_samples_buffer.reset();
+
+		return true;
+	}
+
 	// Get config
 	const FMP4Packager::Config &FMP4Packager::GetConfig() const
 	{
@@ -303,7 +377,8 @@ namespace bmff
 		}
 		else if (media_packet->GetBitstreamFormat() == cmn::BitstreamFormat::H264_ANNEXB)
 		{
-			auto converted_data = H264Converter::ConvertAnnexbToAvcc(media_packet->GetData());
+			// The converted data is cached in the packet and shared with the other packagers, so this copy is copy-on-write
+			auto converted_data = H264Converter::ConvertAnnexbToAvcc(media_packet)->Clone();
 			auto new_packet = std::make_shared<MediaPacket>(*media_packet);
 			new_packet->SetData(converted_data);
 			new_packet->SetBitstreamFormat(cmn::BitstreamFormat::H264_AVCC);
@@ -324,6 +399,25 @@ namespace bmff
 		else if (media_packet->GetBitstreamFormat() == cmn::BitstreamFormat::AAC_RAW)
 		{
 
+		}
+		else if (media_packet->GetBitstreamFormat() == cmn::BitstreamFormat::AV1)
+		{
+			// The AV1 sample must not contain the temporal delimiter (AV1 Codec ISO Media File Format Binding 2.4),
+			// it is always the first OBU of the temporal unit, so it is cut off without copying
+			auto data = media_packet->GetData();
+			auto bitstream = data->GetDataAs<uint8_t>();
+
+			if ((data->GetLength() >= 2) && (bitstream[1] == 0x00) &&
+				(static_cast<AV1ObuType>((bitstream[0] & AV1_OBU_TYPE_MASK) >> 3) == AV1ObuType::TemporalDelimiter) &&
+				OV_CHECK_FLAG(bitstream[0], AV1_OBU_HAS_SIZE_FIELD_MASK) && (OV_CHECK_FLAG(bitstream[0], AV1_OBU_EXTENSION_FLAG_MASK) == false))
+			{
+				// obu_header() + obu_size(0)
+				auto new_packet = std::make_shared<MediaPacket>(*media_packet);
+				auto sample_data = new_packet->GetData()->Subdata(AV1_OBU_HEADER_SIZE + 1);
+				new_packet->SetData(sample_data);
+
+				converted_packet = new_packet;
+			}
 		}
 		else
 		{
@@ -23,6 +23,9 @@ namespace bmff
 		{
 			double chunk_duration_ms = 500.0;
 			double segment_duration_ms = 6000.0;
+			// Cut the segments and the chunks on the multiples of the durations on the timeline instead of the durations of this track,
+			// so the tracks with aligned keyframes (e.g. the renditions of the transcoder) have the segments and the chunks at the same timestamps
+			bool segment_alignment = false;
 		};
 
 		FMP4Packager(const std::shared_ptr<FMP4Storage> &storage, const std::shared_ptr<const MediaTrack> &media_track, const std::shared_ptr<const MediaTrack> &data_track, const Config &config);
@@ -39,12 +42,22 @@ namespace bmff
 		// If the data frame is within the time interval of the fragment, it is added.
 		bool ReserveDataPacket(const std::shared_ptr<const MediaPacket> &media_packet);
 
+		// Stores the buffered samples as the last chunk of the segment (e.g. at the end of the stream)
+		bool Flush();
+
 	private:
 		const Config &GetConfig() const;
 
 		std::shared_ptr<bmff::Packager::Samples> GetDataSamples(int64_t start_timestamp, int64_t end_timestamp);
 
 		bool StoreInitializationSection(const std::shared_ptr<ov::Data> &segment);
+		// Writes the buffered samples into a chunk (moof + mdat) and stores it
+		bool StoreMediaChunk(bool last_chunk);
+
+		// Index of the interval of <duration_ms> that <timestamp> of the track is in (floor(timestamp / duration))
+		int64_t GetIntervalIndex(int64_t timestamp, double duration_ms) const;
+		// Stores the buffered samples if <next_frame> crosses a boundary of the chunks or the segments (Config::segment_alignment)
+		bool StoreAlignedMediaChunkIfNeeded(const std::shared_ptr<const MediaPacket> &next_frame);
 
 		std::shared_ptr<const MediaPacket> ConvertBitstreamFormat(const std::shared_ptr<const MediaPacket> &media_packet);
 
@@ -56,6 +69,10 @@ namespace bmff
 
 		double _target_chunk_duration_ms = 0.0;
 
+		// Intervals of the current segment and chunk in the aligned mode (INT64_MIN before the first sample)
+		int64_t _segment_interval_index = INT64_MIN;
+		int64_t _chunk_interval_index = INT64_MIN;
+
 		std::queue<std::shared_ptr<const MediaPacket>> _reserved_data_packets;
 	};
 }
\ No newline at end of file
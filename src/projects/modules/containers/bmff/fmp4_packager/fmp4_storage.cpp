@@ -38,6 +38,11 @@ namespace bmff
 			logti("Successfully deleted directory for LLHLS DVR: %s", dvr_path.CStr());
 		}
 
+		if (_config.memory_metrics != nullptr)
+		{
+			_config.memory_metrics->Add(mon::MemoryComponent::Fmp4Storage, -_memory_bytes.exchange(0));
+		}
+
 		logtd("FMP4 Storage has been terminated successfully");
 	}
 
@@ -131,6 +136,21 @@ namespace bmff
 		return _min_chunk_duration_ms;
 	}
 
+	bool FMP4Storage::SetFirstSegmentNumber(int64_t segment_number)
+	{
+		std::lock_guard<std::shared_mutex> lock(_segments_lock);
+
+		if ((_segments.empty() == false) || (segment_number < 0))
+		{
+			return false;
+		}
+
+		_number_of_deleted_segments = segment_number;
+		_last_segment_number = segment_number - 1;
+
+		return true;
+	}
+
 	bool FMP4Storage::StoreInitializationSection(const std::shared_ptr<ov::Data> &section)
 	{
 		_initialization_section = section;
@@ -227,7 +247,9 @@ namespace bmff
 
 		auto file_path = GetSegmentFilePath(segment_number);
 
-		auto data = ov::LoadFromFile(file_path);
+		// The segment is served from the page cache without copying it to the heap, so the requests of the old segments
+		// share the memory and the memory is reclaimed by the kernel when it is needed
+		auto data = ov::MapFile(file_path);
 		if (data == nullptr)
 		{
 			logte("Could not load segment from file: %s", file_path.CStr());
@@ -263,13 +285,27 @@ namespace bmff
 				_segments.push_back(segment);
 				_last_segment_number = segment->GetNumber();
 
+				auto max_segments = _config.max_segments;
+				if ((_config.memory_metrics != nullptr) && (_config.memory_metrics->GetPressure() != mon::MemoryPressure::Normal))
+				{
+					// The segments out of memory are still served from the files of DVR if it is enabled
+					max_segments = std::min<uint32_t>(max_segments, FMP4_STORAGE_MIN_SEGMENTS_UNDER_MEMORY_PRESSURE);
+				}
+
 				// Delete old segments
-				if (_segments.size() > _config.max_segments)
+				while (_segments.size() > max_segments)
 				{
 					_number_of_deleted_segments++;
 					auto old_segment = _segments.front();
 					_segments.pop_front();
 
+					if (_config.memory_metrics != nullptr)
+					{
+						auto bytes = static_cast<int64_t>(old_segment->GetData()->GetLength()) * 2;
+						_memory_bytes -= bytes;
+						_config.memory_metrics->Add(mon::MemoryComponent::Fmp4Storage, -bytes);
+					}
+
 					// DVR
 					if (_config.dvr_enabled)
 					{
@@ -291,6 +327,14 @@ namespace bmff
 			return false;
 		}
 
+		if (_config.memory_metrics != nullptr)
+		{
+			// The segment keeps the chunk and a copy of it
+			auto bytes = static_cast<int64_t>(chunk->GetLength()) * 2;
+			_memory_bytes += bytes;
+			_config.memory_metrics->Add(mon::MemoryComponent::Fmp4Storage, bytes);
+		}
+
 		// Complete Segment if segment duration is over and new chunk data is independent(new segment should be started with independent chunk)
 		if (last_chunk == true)
 		{
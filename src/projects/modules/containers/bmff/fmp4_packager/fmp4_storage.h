@@ -8,8 +8,13 @@
 //==============================================================================
 #pragma once
 
+#include <monitoring/memory_metrics.h>
+
 #include "fmp4_structure.h"
 
+// Number of the segments kept in memory while the stream uses more memory than the soft limit of StreamMemoryLimit
+#define FMP4_STORAGE_MIN_SEGMENTS_UNDER_MEMORY_PRESSURE 3
+
 namespace bmff
 {
 	class FMp4StorageObserver : public ov::EnableSharedFromThis<FMp4StorageObserver>
@@ -31,6 +36,8 @@ namespace bmff
 			bool dvr_enabled = false;
 			ov::String dvr_storage_path;
 			uint64_t dvr_duration_sec = 0;
+			// The bytes of the segments in memory are reported to it, and fewer segments are kept under the memory pressure
+			std::shared_ptr<mon::MemoryMetrics> memory_metrics;
 		};
 
 		FMP4Storage(const std::shared_ptr<FMp4StorageObserver> &observer, const std::shared_ptr<const MediaTrack> &track, const Config &config, const ov::String &stream_tag);
@@ -45,6 +52,9 @@ namespace bmff
 		std::tuple<int64_t, int64_t> GetLastChunkNumber() const;
 		int64_t GetLastSegmentNumber() const;
 
+		// Numbers the segments from <segment_number> instead of 0 (must be called before the first chunk is appended)
+		bool SetFirstSegmentNumber(int64_t segment_number);
+
 		bool StoreInitializationSection(const std::shared_ptr<ov::Data> &section);
 		bool AppendMediaChunk(const std::shared_ptr<ov::Data> &chunk, int64_t start_timestamp, double duration_ms, bool independent, bool last_chunk);
 
@@ -137,7 +147,7 @@ namespace bmff
 				}
 
 				// Check if the segment number is valid
-				if (_first_segment_number > segment_number)
+				if ((_first_segment_number > segment_number) || (segment_number - _first_segment_number >= _segments.size()))
 				{
 					return {0, 0, 0};
 				}
@@ -171,6 +181,9 @@ namespace bmff
 
 		size_t _number_of_deleted_segments = 0; // For indexing of _segments
 
+		// Bytes of the segments in memory (the chunks and the segment data that is concatenated from them)
+		std::atomic<int64_t> _memory_bytes = 0;
+
 		int64_t _last_segment_number = -1;
 
 		int64_t _start_timestamp_delta = -1;
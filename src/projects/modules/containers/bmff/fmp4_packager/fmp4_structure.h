@@ -22,6 +22,7 @@ namespace bmff
 			_duration_ms = duration_ms;
 			_start_timestamp = start_timestamp;
 			_independent = independent;
+			_created_time_us = ov::Clock::NowUSec();
 		}
 
 		int64_t GetNumber() const
@@ -55,11 +56,18 @@ namespace bmff
 			return _data;
 		}
 
+		// The time when the chunk is completed (microseconds since epoch)
+		uint64_t GetCreatedTime() const
+		{
+			return _created_time_us;
+		}
+
 	private:
 		int64_t _number = -1;
 		int64_t _start_timestamp = 0;
 		double _duration_ms = 0;
 		bool _independent = false;
+		uint64_t _created_time_us = 0;
 		std::shared_ptr<ov::Data> _data;
 	};
 
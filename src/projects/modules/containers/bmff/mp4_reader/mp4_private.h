@@ -0,0 +1,3 @@
+#pragma once
+
+#define OV_LOG_TAG "MP4 Reader"
\ No newline at end of file
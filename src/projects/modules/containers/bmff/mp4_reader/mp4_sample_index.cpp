@@ -0,0 +1,825 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "mp4_sample_index.h"
+
+#include <base/ovlibrary/bit_reader.h>
+#include <sys/stat.h>
+
+#include <algorithm>
+#include <cinttypes>
+#include <map>
+#include <mutex>
+
+#include "mp4_private.h"
+
+// size(4) + type(4)
+#define MP4_BOX_HEADER_SIZE 8
+
+namespace bmff
+{
+	namespace
+	{
+		constexpr uint32_t BoxType(const char (&type)[5])
+		{
+			return (static_cast<uint32_t>(type[0]) << 24) | (static_cast<uint32_t>(type[1]) << 16) | (static_cast<uint32_t>(type[2]) << 8) | static_cast<uint32_t>(type[3]);
+		}
+
+		// Big-endian reader of a box. Reading beyond the end returns 0 and marks the reader as failed.
+		class BoxReader
+		{
+		public:
+			BoxReader() = default;
+
+			BoxReader(const uint8_t *data, size_t length)
+				: _data(data), _length(length)
+			{
+			}
+
+			bool IsRemained(size_t bytes) const
+			{
+				return (_failed == false) && ((_length - _position) >= bytes);
+			}
+
+			size_t Remained() const
+			{
+				return _length - _position;
+			}
+
+			const uint8_t *Current() const
+			{
+				return _data + _position;
+			}
+
+			bool IsFailed() const
+			{
+				return _failed;
+			}
+
+			bool Skip(size_t bytes)
+			{
+				if (IsRemained(bytes) == false)
+				{
+					_failed = true;
+					return false;
+				}
+
+				_position += bytes;
+				return true;
+			}
+
+			uint64_t ReadBE(size_t bytes)
+			{
+				if (IsRemained(bytes) == false)
+				{
+					_failed = true;
+					return 0;
+				}
+
+				uint64_t value = 0;
+
+				for (size_t index = 0; index < bytes; index++)
+				{
+					value = (value << 8) | _data[_position++];
+				}
+
+				return value;
+			}
+
+			uint8_t Read8()
+			{
+				return static_cast<uint8_t>(ReadBE(1));
+			}
+
+			uint16_t ReadBE16()
+			{
+				return static_cast<uint16_t>(ReadBE(2));
+			}
+
+			uint32_t ReadBE32()
+			{
+				return static_cast<uint32_t>(ReadBE(4));
+			}
+
+			uint64_t ReadBE64()
+			{
+				return ReadBE(8);
+			}
+
+		protected:
+			const uint8_t *_data = nullptr;
+			size_t _length = 0;
+			size_t _position = 0;
+			bool _failed = false;
+		};
+
+		// Reads the header of the next box, and returns the payload of the box in <payload>
+		bool ReadBox(BoxReader &reader, uint32_t *type, BoxReader *payload)
+		{
+			if (reader.IsRemained(MP4_BOX_HEADER_SIZE) == false)
+			{
+				return false;
+			}
+
+			uint64_t size = reader.ReadBE32();
+			*type = reader.ReadBE32();
+			uint64_t header_size = MP4_BOX_HEADER_SIZE;
+
+			if (size == 1)
+			{
+				// largesize
+				size = reader.ReadBE64();
+				header_size += 8;
+			}
+			else if (size == 0)
+			{
+				// The box extends to the end of the file
+				size = header_size + reader.Remained();
+			}
+
+			if (reader.IsFailed() || (size < header_size) || ((size - header_size) > reader.Remained()))
+			{
+				return false;
+			}
+
+			*payload = BoxReader(reader.Current(), size - header_size);
+			reader.Skip(size - header_size);
+
+			return true;
+		}
+
+		bool FindBox(BoxReader reader, uint32_t type, BoxReader *payload)
+		{
+			uint32_t box_type;
+
+			while (ReadBox(reader, &box_type, payload))
+			{
+				if (box_type == type)
+				{
+					return true;
+				}
+			}
+
+			return false;
+		}
+
+		// Size of a descriptor of esds (ISO/IEC 14496-1) is encoded in 1~4 bytes of 7 bits
+		bool ReadDescriptor(BoxReader &reader, uint8_t expected_tag, BoxReader *payload)
+		{
+			if (reader.Read8() != expected_tag)
+			{
+				return false;
+			}
+
+			size_t size = 0;
+
+			for (int index = 0; index < 4; index++)
+			{
+				auto value = reader.Read8();
+				size = (size << 7) | (value & 0x7F);
+
+				if ((value & 0x80) == 0)
+				{
+					break;
+				}
+			}
+
+			if (reader.IsRemained(size) == false)
+			{
+				return false;
+			}
+
+			*payload = BoxReader(reader.Current(), size);
+			reader.Skip(size);
+
+			return true;
+		}
+
+		// Returns AudioSpecificConfig in esds
+		std::shared_ptr<ov::Data> ParseEsds(BoxReader esds)
+		{
+			BoxReader es_descriptor;
+			BoxReader decoder_config_descriptor;
+			BoxReader decoder_specific_info;
+
+			// version + flags
+			esds.Skip(4);
+
+			if (ReadDescriptor(esds, 0x03, &es_descriptor) == false)
+			{
+				return nullptr;
+			}
+
+			// ES_ID
+			es_descriptor.Skip(2);
+			auto flags = es_descriptor.Read8();
+
+			if (flags & 0x80)
+			{
+				// dependsOn_ES_ID
+				es_descriptor.Skip(2);
+			}
+
+			if (flags & 0x40)
+			{
+				// URL
+				es_descriptor.Skip(es_descriptor.Read8());
+			}
+
+			if (flags & 0x20)
+			{
+				// OCR_ES_Id
+				es_descriptor.Skip(2);
+			}
+
+			if (ReadDescriptor(es_descriptor, 0x04, &decoder_config_descriptor) == false)
+			{
+				return nullptr;
+			}
+
+			auto object_type = decoder_config_descriptor.Read8();
+
+			// 0x40: MPEG-4 AAC, 0x66 ~ 0x68: MPEG-2 AAC
+			if ((object_type != 0x40) && ((object_type < 0x66) || (object_type > 0x68)))
+			{
+				return nullptr;
+			}
+
+			// streamType + bufferSizeDB + maxBitrate + avgBitrate
+			decoder_config_descriptor.Skip(12);
+
+			if ((ReadDescriptor(decoder_config_descriptor, 0x05, &decoder_specific_info) == false) || (decoder_specific_info.Remained() == 0))
+			{
+				return nullptr;
+			}
+
+			return std::make_shared<ov::Data>(decoder_specific_info.Current(), decoder_specific_info.Remained());
+		}
+
+		// Reads the sample rate and the channel count from AudioSpecificConfig (ISO/IEC 14496-3)
+		void ParseAudioSpecificConfig(const std::shared_ptr<ov::Data> &config, Mp4SampleIndex::Track *track)
+		{
+			static constexpr uint32_t SampleRateList[] = {96000, 88200, 64000, 48000, 44100, 32000, 24000, 22050, 16000, 12000, 11025, 8000, 7350};
+
+			BitReader reader(config->GetDataAs<uint8_t>(), config->GetLength());
+
+			auto object_type = reader.ReadBits<uint8_t>(5);
+			if (object_type == 31)
+			{
+				reader.ReadBits<uint8_t>(6);
+			}
+
+			auto sample_rate_index = reader.ReadBits<uint8_t>(4);
+			uint32_t sample_rate = 0;
+
+			if (sample_rate_index == 0x0F)
+			{
+				sample_rate = reader.ReadBits<uint32_t>(24);
+			}
+			else if (sample_rate_index < OV_COUNTOF(SampleRateList))
+			{
+				sample_rate = SampleRateList[sample_rate_index];
+			}
+
+			auto channel_configuration = reader.ReadBits<uint8_t>(4);
+
+			if (sample_rate > 0)
+			{
+				track->sample_rate = sample_rate;
+			}
+
+			if ((channel_configuration > 0) && (channel_configuration < 7))
+			{
+				track->channel_count = channel_configuration;
+			}
+		}
+
+		bool ParseSampleEntry(BoxReader stsd, Mp4SampleIndex::Track *track)
+		{
+			uint32_t type;
+			BoxReader entry;
+
+			// version + flags + entry_count
+			stsd.Skip(8);
+
+			// Only the first sample description is used
+			if (ReadBox(stsd, &type, &entry) == false)
+			{
+				return false;
+			}
+
+			// reserved(6) + data_reference_index(2)
+			entry.Skip(8);
+
+			if ((type == BoxType("avc1")) || (type == BoxType("avc3")))
+			{
+				BoxReader avcc;
+
+				// pre_defined + reserved + pre_defined[3]
+				entry.Skip(16);
+				track->width = entry.ReadBE16();
+				track->height = entry.ReadBE16();
+				// horizresolution + vertresolution + reserved + frame_count + compressorname + depth + pre_defined
+				entry.Skip(4 + 4 + 4 + 2 + 32 + 2 + 2);
+
+				if ((entry.IsFailed() == false) && FindBox(entry, BoxType("avcC"), &avcc) && (avcc.Remained() > 0))
+				{
+					track->codec_id = cmn::MediaCodecId::H264;
+					track->decoder_config = std::make_shared<ov::Data>(avcc.Current(), avcc.Remained());
+					return true;
+				}
+			}
+			else if (type == BoxType("mp4a"))
+			{
+				BoxReader esds;
+				BoxReader wave;
+
+				auto version = entry.ReadBE16();
+				// revision_level + vendor
+				entry.Skip(6);
+				track->channel_count = entry.ReadBE16();
+				// sample_size + compression_id + packet_size
+				entry.Skip(6);
+				track->sample_rate = entry.ReadBE32() >> 16;
+
+				// QuickTime sound sample description v1/v2 has more fields
+				entry.Skip((version == 1) ? 16 : (version == 2) ? 36 : 0);
+
+				if (entry.IsFailed())
+				{
+					return false;
+				}
+
+				if ((FindBox(entry, BoxType("esds"), &esds) || (FindBox(entry, BoxType("wave"), &wave) && FindBox(wave, BoxType("esds"), &esds))))
+				{
+					track->decoder_config = ParseEsds(esds);
+
+					if (track->decoder_config != nullptr)
+					{
+						track->codec_id = cmn::MediaCodecId::Aac;
+						ParseAudioSpecificConfig(track->decoder_config, track);
+						return true;
+					}
+				}
+			}
+
+			return false;
+		}
+
+		// A full box that has <entry_count> entries of <entry_size> bytes
+		bool ReadTableHeader(BoxReader &reader, size_t entry_size, uint32_t *entry_count, uint8_t *version = nullptr)
+		{
+			auto box_version = reader.Read8();
+			reader.Skip(3);
+			*entry_count = reader.ReadBE32();
+
+			if (version != nullptr)
+			{
+				*version = box_version;
+			}
+
+			// Prevents allocating the memory for a broken count
+			return (reader.IsFailed() == false) && ((reader.Remained() / entry_size) >= *entry_count);
+		}
+
+		// Returns the offset to be added to the decoding times of a track, so the media time mapped by the edit list starts at
+		// the presentation time of the edit (as libavformat does). Only the leading empty edits and the first media edit are used.
+		int64_t ParseEditList(BoxReader edts, uint32_t movie_timescale, uint32_t media_timescale)
+		{
+			BoxReader elst;
+			uint32_t count;
+			uint8_t version;
+
+			if ((FindBox(edts, BoxType("elst"), &elst) == false) || (ReadTableHeader(elst, 12, &count, &version) == false))
+			{
+				return 0;
+			}
+
+			// Avoids dividing by 0 for a broken mvhd
+			movie_timescale = (movie_timescale == 0) ? media_timescale : movie_timescale;
+
+			int64_t empty_duration = 0;
+
+			for (uint32_t entry_index = 0; entry_index < count; entry_index++)
+			{
+				auto segment_duration = static_cast<int64_t>((version == 1) ? elst.ReadBE64() : elst.ReadBE32());
+				auto media_time = (version == 1) ? static_cast<int64_t>(elst.ReadBE64()) : static_cast<int32_t>(elst.ReadBE32());
+				// media_rate
+				elst.Skip(4);
+
+				if (elst.IsFailed())
+				{
+					break;
+				}
+
+				if (media_time == -1)
+				{
+					// An empty edit delays the start of the track
+					empty_duration += segment_duration;
+					continue;
+				}
+
+				return (empty_duration * media_timescale / movie_timescale) - media_time;
+			}
+
+			return empty_duration * media_timescale / movie_timescale;
+		}
+
+		// Builds the samples of a track from the sample table boxes (stbl)
+		bool ParseSampleTable(BoxReader stbl, uint32_t track_index, int64_t time_offset, uint64_t file_length, std::vector<Mp4SampleIndex::Sample> *samples)
+		{
+			BoxReader stsz, stco, stsc, stts, ctts, stss;
+			bool is_co64 = false;
+			uint32_t count;
+
+			if ((FindBox(stbl, BoxType("stsz"), &stsz) == false) ||
+				(FindBox(stbl, BoxType("stsc"), &stsc) == false) ||
+				(FindBox(stbl, BoxType("stts"), &stts) == false))
+			{
+				return false;
+			}
+
+			if (FindBox(stbl, BoxType("stco"), &stco) == false)
+			{
+				if (FindBox(stbl, BoxType("co64"), &stco) == false)
+				{
+					return false;
+				}
+
+				is_co64 = true;
+			}
+
+			// stsz
+			stsz.Skip(4);
+			auto constant_size = stsz.ReadBE32();
+			auto sample_count = stsz.ReadBE32();
+
+			if (stsz.IsFailed() || ((constant_size == 0) && ((stsz.Remained() / 4) < sample_count)) || (sample_count == 0))
+			{
+				return false;
+			}
+
+			std::vector<Mp4SampleIndex::Sample> track_samples(sample_count);
+
+			for (auto &sample : track_samples)
+			{
+				sample.track_index = track_index;
+				sample.size = (constant_size != 0) ? constant_size : stsz.ReadBE32();
+			}
+
+			// stco/co64 + stsc
+			uint32_t chunk_count;
+			uint32_t stsc_count;
+
+			if ((ReadTableHeader(stco, is_co64 ? 8 : 4, &chunk_count) == false) || (ReadTableHeader(stsc, 12, &stsc_count) == false) || (stsc_count == 0))
+			{
+				return false;
+			}
+
+			std::vector<uint64_t> chunk_offsets(chunk_count);
+			for (auto &chunk_offset : chunk_offsets)
+			{
+				chunk_offset = is_co64 ? stco.ReadBE64() : stco.ReadBE32();
+			}
+
+			size_t sample_index = 0;
+			uint32_t first_chunk = stsc.ReadBE32();
+
+			for (uint32_t entry_index = 0; entry_index < stsc_count; entry_index++)
+			{
+				auto samples_per_chunk = stsc.ReadBE32();
+				// sample_description_index
+				stsc.Skip(4);
+				auto next_first_chunk = ((entry_index + 1) < stsc_count) ? stsc.ReadBE32() : (chunk_count + 1);
+
+				if ((first_chunk == 0) || (next_first_chunk < first_chunk) || (next_first_chunk > (chunk_count + 1)))
+				{
+					return false;
+				}
+
+				for (auto chunk = first_chunk; chunk < next_first_chunk; chunk++)
+				{
+					auto offset = chunk_offsets[chunk - 1];
+
+					for (uint32_t index = 0; (index < samples_per_chunk) && (sample_index < sample_count); index++)
+					{
+						auto &sample = track_samples[sample_index++];
+
+						if ((offset + sample.size) > file_length)
+						{
+							return false;
+						}
+
+						sample.offset = offset;
+						offset += sample.size;
+					}
+				}
+
+				first_chunk = next_first_chunk;
+			}
+
+			if (sample_index != sample_count)
+			{
+				return false;
+			}
+
+			// stts
+			if (ReadTableHeader(stts, 8, &count) == false)
+			{
+				return false;
+			}
+
+			sample_index = 0;
+			int64_t dts = time_offset;
+
+			for (uint32_t entry_index = 0; entry_index < count; entry_index++)
+			{
+				auto delta_count = stts.ReadBE32();
+				auto delta = stts.ReadBE32();
+
+				for (uint32_t index = 0; (index < delta_count) && (sample_index < sample_count); index++)
+				{
+					auto &sample = track_samples[sample_index++];
+
+					sample.dts = dts;
+					sample.duration = delta;
+					dts += delta;
+				}
+			}
+
+			// The durations of the rest are not known
+			for (; sample_index < sample_count; sample_index++)
+			{
+				track_samples[sample_index].dts = dts;
+			}
+
+			// ctts (optional)
+			uint8_t ctts_version;
+			if (FindBox(stbl, BoxType("ctts"), &ctts) && ReadTableHeader(ctts, 8, &count, &ctts_version))
+			{
+				sample_index = 0;
+
+				for (uint32_t entry_index = 0; entry_index < count; entry_index++)
+				{
+					auto offset_count = ctts.ReadBE32();
+					// Version 0 is unsigned, but some muxers write negative offsets in it
+					auto offset = static_cast<int32_t>(ctts.ReadBE32());
+
+					for (uint32_t index = 0; (index < offset_count) && (sample_index < sample_count); index++)
+					{
+						track_samples[sample_index++].cts_offset = offset;
+					}
+				}
+			}
+
+			// stss (optional) - if it does not exist, all samples are sync samples
+			if (FindBox(stbl, BoxType("stss"), &stss) && ReadTableHeader(stss, 4, &count))
+			{
+				for (uint32_t entry_index = 0; entry_index < count; entry_index++)
+				{
+					auto number = stss.ReadBE32();
+
+					if ((number >= 1) && (number <= sample_count))
+					{
+						track_samples[number - 1].is_key_frame = true;
+					}
+				}
+			}
+			else
+			{
+				for (auto &sample : track_samples)
+				{
+					sample.is_key_frame = true;
+				}
+			}
+
+			samples->insert(samples->end(), track_samples.begin(), track_samples.end());
+
+			return true;
+		}
+
+		struct CacheItem
+		{
+			off_t file_size;
+			int64_t modified_time_nsec;
+			uint64_t last_used;
+
+			std::shared_ptr<const Mp4SampleIndex> index;
+		};
+
+		std::mutex cache_mutex;
+		std::map<ov::String, CacheItem> cache_map;
+		uint64_t cache_use_count = 0;
+	}  // namespace
+
+	std::shared_ptr<const Mp4SampleIndex> Mp4SampleIndex::Load(const ov::String &path)
+	{
+		struct stat file_stat;
+
+		if (::stat(path.CStr(), &file_stat) != 0)
+		{
+			return nullptr;
+		}
+
+		auto modified_time_nsec = (static_cast<int64_t>(file_stat.st_mtim.tv_sec) * 1000000000LL) + file_stat.st_mtim.tv_nsec;
+
+		{
+			std::lock_guard lock_guard(cache_mutex);
+
+			auto item = cache_map.find(path);
+
+			if ((item != cache_map.end()) && (item->second.file_size == file_stat.st_size) && (item->second.modified_time_nsec == modified_time_nsec))
+			{
+				item->second.last_used = ++cache_use_count;
+				return item->second.index;
+			}
+		}
+
+		// Parsed without the lock, so indexing a large file does not block the other streams
+		ov::StopWatch stop_watch;
+		stop_watch.Start();
+
+		auto file = ov::MapFile(path.CStr());
+		if (file == nullptr)
+		{
+			return nullptr;
+		}
+
+		auto index = std::make_shared<Mp4SampleIndex>();
+		if (index->Parse(file) == false)
+		{
+			logtd("Could not index %s", path.CStr());
+			return nullptr;
+		}
+
+		logti("%s is indexed: %zu tracks, %zu samples (%" PRId64 " ms)", path.CStr(), index->_tracks.size(), index->_samples.size(), stop_watch.Elapsed());
+
+		std::lock_guard lock_guard(cache_mutex);
+
+		cache_map[path] = {file_stat.st_size, modified_time_nsec, ++cache_use_count, index};
+
+		// Evicts the least recently used index that is not used by any stream
+		while (cache_map.size() > MP4_SAMPLE_INDEX_CACHE_SIZE)
+		{
+			auto oldest = cache_map.end();
+
+			for (auto item = cache_map.begin(); item != cache_map.end(); ++item)
+			{
+				if ((item->second.index.use_count() == 1) && ((oldest == cache_map.end()) || (item->second.last_used < oldest->second.last_used)))
+				{
+					oldest = item;
+				}
+			}
+
+			if (oldest == cache_map.end())
+			{
+				break;
+			}
+
+			cache_map.erase(oldest);
+		}
+
+		return index;
+	}
+
+	bool Mp4SampleIndex::Parse(const std::shared_ptr<ov::Data> &file)
+	{
+		BoxReader file_reader(file->GetDataAs<uint8_t>(), file->GetLength());
+		BoxReader moov;
+		BoxReader trak;
+		uint32_t type;
+
+		// moov may be at the end of the file (after mdat)
+		if (FindBox(file_reader, BoxType("moov"), &moov) == false)
+		{
+			return false;
+		}
+
+		BoxReader mvex;
+		BoxReader mvhd;
+
+		if (FindBox(moov, BoxType("mvex"), &mvex))
+		{
+			// The samples of a fragmented MP4 are described in moof boxes
+			return false;
+		}
+
+		uint32_t movie_timescale = 0;
+
+		if (FindBox(moov, BoxType("mvhd"), &mvhd))
+		{
+			// mvhd: creation_time + modification_time + timescale
+			auto mvhd_version = mvhd.Read8();
+			mvhd.Skip(3 + ((mvhd_version == 1) ? 16 : 8));
+			movie_timescale = mvhd.ReadBE32();
+		}
+
+		while (ReadBox(moov, &type, &trak))
+		{
+			if (type != BoxType("trak"))
+			{
+				continue;
+			}
+
+			BoxReader tkhd, edts, mdia, mdhd, hdlr, minf, stbl, stsd;
+
+			if ((FindBox(trak, BoxType("tkhd"), &tkhd) == false) ||
+				(FindBox(trak, BoxType("mdia"), &mdia) == false) ||
+				(FindBox(mdia, BoxType("mdhd"), &mdhd) == false) ||
+				(FindBox(mdia, BoxType("hdlr"), &hdlr) == false) ||
+				(FindBox(mdia, BoxType("minf"), &minf) == false) ||
+				(FindBox(minf, BoxType("stbl"), &stbl) == false) ||
+				(FindBox(stbl, BoxType("stsd"), &stsd) == false))
+			{
+				continue;
+			}
+
+			Track track;
+
+			// tkhd: creation_time + modification_time + track_ID
+			auto tkhd_version = tkhd.Read8();
+			tkhd.Skip(3 + ((tkhd_version == 1) ? 16 : 8));
+			track.track_id = tkhd.ReadBE32();
+
+			// mdhd: creation_time + modification_time + timescale
+			auto mdhd_version = mdhd.Read8();
+			mdhd.Skip(3 + ((mdhd_version == 1) ? 16 : 8));
+			track.timescale = mdhd.ReadBE32();
+
+			// hdlr: version + flags + pre_defined + handler_type
+			hdlr.Skip(8);
+			auto handler_type = hdlr.ReadBE32();
+
+			if (handler_type == BoxType("vide"))
+			{
+				track.media_type = cmn::MediaType::Video;
+			}
+			else if (handler_type == BoxType("soun"))
+			{
+				track.media_type = cmn::MediaType::Audio;
+			}
+			else
+			{
+				continue;
+			}
+
+			if ((track.timescale == 0) || (ParseSampleEntry(stsd, &track) == false))
+			{
+				logtd("Unsupported track is ignored (track id: %u)", track.track_id);
+				_has_unsupported_track = true;
+				continue;
+			}
+
+			auto sample_count_before = _samples.size();
+			auto time_offset = FindBox(trak, BoxType("edts"), &edts) ? ParseEditList(edts, movie_timescale, track.timescale) : 0;
+
+			if (ParseSampleTable(stbl, static_cast<uint32_t>(_tracks.size()), time_offset, file->GetLength(), &_samples) == false)
+			{
+				logtw("Could not parse the sample table of the track %u", track.track_id);
+				_samples.resize(sample_count_before);
+				_has_unsupported_track = true;
+				continue;
+			}
+
+			if (track.media_type == cmn::MediaType::Video)
+			{
+				auto &first_sample = _samples[sample_count_before];
+				auto &last_sample = _samples.back();
+				auto duration = last_sample.dts + last_sample.duration - first_sample.dts;
+
+				if (duration > 0)
+				{
+					track.frame_rate = static_cast<double>(_samples.size() - sample_count_before) * track.timescale / duration;
+				}
+			}
+
+			_tracks.push_back(std::move(track));
+		}
+
+		if (_samples.empty())
+		{
+			return false;
+		}
+
+		// Interleaves the samples of the tracks by the decoding time (and by the position in the file for the same time)
+		std::stable_sort(_samples.begin(), _samples.end(), [this](const Sample &sample1, const Sample &sample2) {
+			auto time1 = static_cast<__int128>(sample1.dts) * _tracks[sample2.track_index].timescale;
+			auto time2 = static_cast<__int128>(sample2.dts) * _tracks[sample1.track_index].timescale;
+
+			return (time1 == time2) ? (sample1.offset < sample2.offset) : (time1 < time2);
+		});
+
+		_file = file;
+
+		return true;
+	}
+
+	std::shared_ptr<ov::Data> Mp4SampleIndex::GetSampleData(const Sample &sample) const
+	{
+		return _file->Subdata(sample.offset, sample.size);
+	}
+}  // namespace bmff
@@ -0,0 +1,94 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/common_types.h>
+#include <base/ovlibrary/ovlibrary.h>
+
+// Maximum number of the indexes kept in the cache after the streams using them are stopped
+#define MP4_SAMPLE_INDEX_CACHE_SIZE 512
+
+namespace bmff
+{
+	// The sample table of an MP4 file, built from the moov box (wherever it is in the file).
+	//
+	// The file is memory-mapped, and the data of a sample is a slice of the mapping, so reading a sample does not copy
+	// the payload. The indexes are cached by the path (and invalidated when the size/mtime of the file changes),
+	// so the streams playing the same file, and the restarts of a stream, do not parse the moov box again.
+	//
+	// Only H.264 and AAC tracks are supported. The other tracks are ignored.
+	class Mp4SampleIndex
+	{
+	public:
+		struct Track
+		{
+			uint32_t track_id = 0;
+			cmn::MediaType media_type = cmn::MediaType::Unknown;
+			cmn::MediaCodecId codec_id = cmn::MediaCodecId::None;
+			uint32_t timescale = 0;
+
+			// Video
+			uint32_t width = 0;
+			uint32_t height = 0;
+			double frame_rate = 0.0;
+
+			// Audio
+			uint32_t sample_rate = 0;
+			uint32_t channel_count = 0;
+
+			// AVCDecoderConfigurationRecord (H.264) or AudioSpecificConfig (AAC)
+			std::shared_ptr<ov::Data> decoder_config;
+		};
+
+		struct Sample
+		{
+			uint64_t offset = 0;
+			uint32_t size = 0;
+			// Index of GetTracks()
+			uint32_t track_index = 0;
+			// In the timescale of the track
+			int64_t dts = 0;
+			int32_t cts_offset = 0;
+			uint32_t duration = 0;
+			bool is_key_frame = false;
+		};
+
+		// Returns the cached index of <path>, or builds it if the file is not indexed or changed
+		static std::shared_ptr<const Mp4SampleIndex> Load(const ov::String &path);
+
+		const std::vector<Track> &GetTracks() const
+		{
+			return _tracks;
+		}
+
+		// The samples of all tracks in the order of the decoding time
+		const std::vector<Sample> &GetSamples() const
+		{
+			return _samples;
+		}
+
+		// Whether the file has an audio/video track that is not indexed (e.g. other codecs)
+		bool HasUnsupportedTrack() const
+		{
+			return _has_unsupported_track;
+		}
+
+		// The payload of <sample> (a slice of the mapped file)
+		std::shared_ptr<ov::Data> GetSampleData(const Sample &sample) const;
+
+	protected:
+		bool Parse(const std::shared_ptr<ov::Data> &file);
+
+		std::shared_ptr<ov::Data> _file;
+
+		std::vector<Track> _tracks;
+		std::vector<Sample> _samples;
+
+		bool _has_unsupported_track = false;
+	};
+}  // namespace bmff
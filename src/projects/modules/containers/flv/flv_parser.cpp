@@ -15,21 +15,87 @@ bool FlvVideoData::Parse(const uint8_t *data, size_t data_length, FlvVideoData &
 
 	BitReader parser(data, data_length);
 
-	video_data._frame_type = static_cast<FlvVideoFrameTypes>(parser.ReadBits<uint8_t>(4));
-	video_data._codec_id = static_cast<FlvVideoCodecId>(parser.ReadBits<uint8_t>(4));
+	video_data._is_ex_header = parser.ReadBoolBit();
 
-	if(video_data._codec_id != FlvVideoCodecId::AVC)
+	if (video_data._is_ex_header)
 	{
-		logte("Unsupported codec : %d", static_cast<uint8_t>(video_data._codec_id));
-		return false;
+		// Enhanced RTMP - ExVideoTagHeader
+		//	IsExHeader(UB[1]) | FrameType(UB[3]) | PacketType(UB[4]) | FourCC(UI32)
+		video_data._frame_type = static_cast<FlvVideoFrameTypes>(parser.ReadBits<uint8_t>(3));
+		video_data._ex_packet_type = static_cast<FlvVideoExPacketType>(parser.ReadBits<uint8_t>(4));
+		video_data._fourcc = static_cast<FlvVideoFourCc>(parser.ReadBytes<uint32_t>());
+		video_data._composition_time = 0;
+
+		switch (video_data._fourcc)
+		{
+			case FlvVideoFourCc::HEVC:
+				video_data._codec_id = FlvVideoCodecId::HEVC;
+				break;
+			case FlvVideoFourCc::AV1:
+				video_data._codec_id = FlvVideoCodecId::AV1;
+				break;
+			default:
+				logte("Unsupported FourCC : %08X", static_cast<uint32_t>(video_data._fourcc));
+				return false;
+		}
+
+		switch (video_data._ex_packet_type)
+		{
+			case FlvVideoExPacketType::SEQUENCE_START:
+				video_data._packet_type = FlvAvcPacketType::AVC_SEQUENCE_HEADER;
+				break;
+
+			case FlvVideoExPacketType::CODED_FRAMES:
+				video_data._packet_type = FlvAvcPacketType::AVC_NALU;
+
+				// Only HEVC carries CompositionTime in CodedFrames
+				if (video_data._fourcc == FlvVideoFourCc::HEVC)
+				{
+					if (parser.BytesRemained() < 3)
+					{
+						logte("The data inputted is too small for parsing CompositionTime");
+						return false;
+					}
+
+					int32_t composition_time = static_cast<int32_t>(parser.ReadBits<uint32_t>(24));
+					video_data._composition_time = OV_CHECK_FLAG(composition_time, 0x800000) ? composition_time |= 0xFF000000 : composition_time;
+				}
+				break;
+
+			case FlvVideoExPacketType::CODED_FRAMES_X:
+				video_data._packet_type = FlvAvcPacketType::AVC_NALU;
+				break;
+
+			case FlvVideoExPacketType::SEQUENCE_END:
+				video_data._packet_type = FlvAvcPacketType::AVC_END_SEQUENCE;
+				break;
+
+			default:
+				// Metadata (HDR colorInfo, ...) and MPEG2TSSequenceStart don't carry frames,
+				// the caller should check ExPacketType() and skip them
+				break;
+		}
 	}
+	else
+	{
+		// FrameType(UB[4]) - the MSB is always 0 and has already been read as IsExHeader
+		video_data._frame_type = static_cast<FlvVideoFrameTypes>(parser.ReadBits<uint8_t>(3));
+		video_data._codec_id = static_cast<FlvVideoCodecId>(parser.ReadBits<uint8_t>(4));
 
-	video_data._packet_type = static_cast<FlvAvcPacketType>(parser.ReadBytes<uint8_t>());
+		if (video_data._codec_id != FlvVideoCodecId::AVC)
+		{
+			logte("Unsupported codec : %d", static_cast<uint8_t>(video_data._codec_id));
+			return false;
+		}
 
-	int32_t composition_time = static_cast<int32_t>(parser.ReadBits<uint32_t>(24));
+		video_data._packet_type = static_cast<FlvAvcPacketType>(parser.ReadBytes<uint8_t>());
+
+		int32_t composition_time = static_cast<int32_t>(parser.ReadBits<uint32_t>(24));
+
+		// Need to convert UI24 to SI24
+		video_data._composition_time = OV_CHECK_FLAG(composition_time, 0x800000) ? composition_time |= 0xFF000000 : composition_time;
+	}
 
-	// Need to convert UI24 to SI24
-	video_data._composition_time = OV_CHECK_FLAG(composition_time, 0x800000) ? composition_time |= 0xFF000000 : composition_time;
 	video_data._payload = parser.CurrentPosition();
 	video_data._payload_length = parser.BytesRemained();
 
@@ -56,6 +122,21 @@ int64_t FlvVideoData::CompositionTime()
 	return _composition_time;
 }
 
+bool FlvVideoData::IsExHeader()
+{
+	return _is_ex_header;
+}
+
+FlvVideoFourCc FlvVideoData::FourCc()
+{
+	return _fourcc;
+}
+
+FlvVideoExPacketType FlvVideoData::ExPacketType()
+{
+	return _ex_packet_type;
+}
+
 const uint8_t* FlvVideoData::Payload()
 {
 	return _payload;
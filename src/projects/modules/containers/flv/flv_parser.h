@@ -4,6 +4,9 @@
 
 #define MIN_FLV_VIDEO_DATA_LENGTH		5
 
+// FourCC as it is stored in the ExVideoTagHeader (big endian)
+#define FLV_FOURCC(a, b, c, d) ((static_cast<uint32_t>(a) << 24) | (static_cast<uint32_t>(b) << 16) | (static_cast<uint32_t>(c) << 8) | static_cast<uint32_t>(d))
+
 enum class FlvVideoFrameTypes : uint8_t
 {
 	KEY_FRAME = 1,	// For AVC
@@ -21,7 +24,30 @@ enum class FlvVideoCodecId : uint8_t
 	ON2_VP6,
 	ON2_VP6_WITH_ALPHA_CHANNEL,
 	SCREEN_VIDEO_VERSION_2,
-	AVC	// OME supports only this codec on RTMP
+	AVC,
+	// Codecs below are signaled with the FourCC of Enhanced RTMP (ExVideoTagHeader)
+	HEVC = 12,
+	AV1 = 13
+};
+
+// Enhanced RTMP: FourCC of ExVideoTagHeader
+enum class FlvVideoFourCc : uint32_t
+{
+	None = 0,
+	HEVC = FLV_FOURCC('h', 'v', 'c', '1'),
+	AV1 = FLV_FOURCC('a', 'v', '0', '1'),
+	VP9 = FLV_FOURCC('v', 'p', '0', '9')
+};
+
+// Enhanced RTMP: PacketType of ExVideoTagHeader
+enum class FlvVideoExPacketType : uint8_t
+{
+	SEQUENCE_START = 0,	 // HEVCDecoderConfigurationRecord, AV1CodecConfigurationRecord, ...
+	CODED_FRAMES = 1,	 // SI24 CompositionTime + Coded frames
+	SEQUENCE_END = 2,
+	CODED_FRAMES_X = 3,	 // Coded frames (CompositionTime is implicitly 0)
+	METADATA = 4,
+	MPEG2TS_SEQUENCE_START = 5
 };
 
 enum class FlvAvcPacketType : uint8_t
@@ -87,19 +113,29 @@ public:
 	FlvAvcPacketType PacketType();
 	int64_t CompositionTime();
 
+	// Enhanced RTMP
+	bool IsExHeader();
+	FlvVideoFourCc FourCc();
+	FlvVideoExPacketType ExPacketType();
+
 	const uint8_t*	Payload();
 	size_t PayloadLength();
 
 private:
-	FlvVideoFrameTypes	_frame_type;		// UB[4]
-	FlvVideoCodecId		_codec_id;			// UB[4], Only support AVC
+	FlvVideoFrameTypes	_frame_type;		// UB[4] (UB[3] if _is_ex_header)
+	FlvVideoCodecId		_codec_id;			// UB[4], AVC or mapped from _fourcc
+
+	// ExVideoTagHeader (Enhanced RTMP)
+	bool					_is_ex_header = false;	// UB[1]
+	FlvVideoExPacketType	_ex_packet_type = FlvVideoExPacketType::SEQUENCE_START;	// UB[4]
+	FlvVideoFourCc			_fourcc = FlvVideoFourCc::None;	// UI32
 
 	// AVCVIDEOPACKET
 	FlvAvcPacketType	_packet_type;		// UI8
 	int32_t				_composition_time;	// SI24
 
 	// if FlvAvcPacketType == 0
-	// 		AVCDecoderConfigurationRecord 
+	// 		AVCDecoderConfigurationRecord (HEVCDecoderConfigurationRecord if HEVC)
 	// else if FlvAvcPacketType == 1
 	//		One or more NALUs
 	// else if FlvAvcPacketType == 2
@@ -0,0 +1,165 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "dtls_handshake_worker_pool.h"
+
+#include "dtls_transport.h"
+
+#define OV_LOG_TAG "DTLS"
+
+DtlsHandshakeWorkerPool::~DtlsHandshakeWorkerPool()
+{
+	Stop();
+}
+
+bool DtlsHandshakeWorkerPool::Start(size_t worker_count, size_t max_pending_count)
+{
+	std::lock_guard lock_guard(_mutex);
+
+	if (_thread_list.empty() == false)
+	{
+		logte("DTLS handshake worker pool is already started");
+		return false;
+	}
+
+	worker_count = std::max<size_t>(worker_count, 1);
+	_max_pending_count = std::max<size_t>(max_pending_count, 1);
+	_stop_thread_flag = false;
+
+	for (size_t index = 0; index < worker_count; index++)
+	{
+		try
+		{
+			_thread_list.emplace_back(&DtlsHandshakeWorkerPool::WorkerThread, this);
+		}
+		catch (const std::system_error &e)
+		{
+			logte("Could not start DTLS handshake worker #%zu: %s", index, e.what());
+
+			// Nothing is scheduled yet, so the workers only wake up to exit
+			StopThreads();
+			return false;
+		}
+
+		auto name = ov::String::FormatString("DtlsHandshake%zu", index);
+		::pthread_setname_np(_thread_list.back().native_handle(), name.CStr());
+	}
+
+	_is_running = true;
+
+	logti("DTLS handshake worker pool is started with %zu workers (max pending: %zu)", worker_count, _max_pending_count);
+
+	return true;
+}
+
+bool DtlsHandshakeWorkerPool::Stop()
+{
+	if (_is_running.exchange(false) == false)
+	{
+		return true;
+	}
+
+	std::vector<std::thread> thread_list;
+
+	{
+		std::lock_guard lock_guard(_mutex);
+
+		_stop_thread_flag = true;
+		thread_list = std::move(_thread_list);
+		_thread_list.clear();
+	}
+
+	for (size_t index = 0; index < thread_list.size(); index++)
+	{
+		_event.Notify();
+	}
+
+	for (auto &thread : thread_list)
+	{
+		thread.join();
+	}
+
+	std::lock_guard lock_guard(_mutex);
+	_transport_queue.clear();
+	_pending_count = 0;
+
+	return true;
+}
+
+void DtlsHandshakeWorkerPool::StopThreads()
+{
+	_stop_thread_flag = true;
+
+	for (size_t index = 0; index < _thread_list.size(); index++)
+	{
+		_event.Notify();
+	}
+
+	for (auto &thread : _thread_list)
+	{
+		thread.join();
+	}
+
+	_thread_list.clear();
+}
+
+bool DtlsHandshakeWorkerPool::Schedule(const std::shared_ptr<DtlsTransport> &transport)
+{
+	if ((_is_running == false) || (transport == nullptr))
+	{
+		return false;
+	}
+
+	{
+		std::lock_guard lock_guard(_mutex);
+
+		if (_transport_queue.size() >= _max_pending_count)
+		{
+			_rejected_count++;
+			return false;
+		}
+
+		_transport_queue.push_back(transport);
+		_pending_count = _transport_queue.size();
+	}
+
+	_event.Notify();
+
+	return true;
+}
+
+void DtlsHandshakeWorkerPool::WorkerThread()
+{
+	ov::ThreadRegistry::Registration registration("DtlsHandshakeWorker");
+
+	while (true)
+	{
+		_event.Wait();
+
+		if (_stop_thread_flag)
+		{
+			break;
+		}
+
+		std::shared_ptr<DtlsTransport> transport;
+
+		{
+			std::lock_guard lock_guard(_mutex);
+
+			if (_transport_queue.empty())
+			{
+				continue;
+			}
+
+			transport = std::move(_transport_queue.front());
+			_transport_queue.pop_front();
+			_pending_count = _transport_queue.size();
+		}
+
+		transport->ProcessHandshakePackets();
+	}
+}
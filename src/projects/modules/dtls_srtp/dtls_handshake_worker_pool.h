@@ -0,0 +1,77 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/ovlibrary/ovlibrary.h>
+
+#include <atomic>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+class DtlsTransport;
+
+// Processes DTLS handshakes (ECDHE and certificate signing) on dedicated threads instead of the thread
+// that receives the packets, so a surge of new sessions does not delay the packets of the existing sessions
+//
+// A transport is queued once for all the handshake packets received while it is waiting, and any worker
+// can process it. If too many transports are waiting (admission control), the new handshake packets are
+// dropped, and the peer retransmits them by the DTLS retransmission timer.
+class DtlsHandshakeWorkerPool
+{
+public:
+	static DtlsHandshakeWorkerPool *GetInstance()
+	{
+		static DtlsHandshakeWorkerPool instance;
+		return &instance;
+	}
+
+	bool Start(size_t worker_count, size_t max_pending_count);
+	bool Stop();
+
+	bool IsRunning() const
+	{
+		return _is_running;
+	}
+
+	// Returns false if the pool is not running or too many transports are waiting
+	bool Schedule(const std::shared_ptr<DtlsTransport> &transport);
+
+	// The number of transports waiting for a worker
+	size_t GetPendingCount() const
+	{
+		return _pending_count;
+	}
+
+	// The number of handshake packets dropped by admission control
+	uint64_t GetRejectedCount() const
+	{
+		return _rejected_count;
+	}
+
+protected:
+	DtlsHandshakeWorkerPool() = default;
+	~DtlsHandshakeWorkerPool();
+
+	// Must be called with _mutex
+	void StopThreads();
+	void WorkerThread();
+
+	std::atomic<bool> _is_running{false};
+	std::atomic<bool> _stop_thread_flag{true};
+	size_t _max_pending_count = 0;
+
+	std::vector<std::thread> _thread_list;
+	ov::Semaphore _event;
+
+	std::mutex _mutex;
+	std::deque<std::shared_ptr<DtlsTransport>> _transport_queue;
+
+	std::atomic<size_t> _pending_count{0};
+	std::atomic<uint64_t> _rejected_count{0};
+};
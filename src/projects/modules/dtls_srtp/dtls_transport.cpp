@@ -3,8 +3,12 @@
 #include <algorithm>
 #include <utility>
 
+#include "dtls_handshake_worker_pool.h"
+
 #define OV_LOG_TAG "DTLS"
 
+std::atomic<size_t> DtlsTransport::_handshaking_count{0};
+
 DtlsTransport::DtlsTransport()
 	: ov::Node(NodeType::Dtls)
 {
@@ -14,6 +18,7 @@ DtlsTransport::DtlsTransport()
 
 DtlsTransport::~DtlsTransport()
 {
+	SetState(SSL_CLOSED);
 }
 
 bool DtlsTransport::Stop()
@@ -21,6 +26,7 @@ bool DtlsTransport::Stop()
 	std::lock_guard<std::mutex> lock(_tls_lock);
 
 	_tls.Uninitialize();
+	SetState(SSL_CLOSED);
 
 	return ov::Node::Stop();
 }
@@ -28,7 +34,40 @@ bool DtlsTransport::Stop()
 // Set Local Certificate
 void DtlsTransport::SetLocalCertificate(const std::shared_ptr<Certificate> &certificate)
 {
-	_local_certificate_pair = CertificatePair::CreateCertificatePair(certificate);
+	_tls_context = GetTlsContext(certificate);
+}
+
+std::shared_ptr<ov::TlsContext> DtlsTransport::GetTlsContext(const std::shared_ptr<Certificate> &certificate)
+{
+	static std::mutex tls_context_map_lock;
+	// certificate : TLS context (the certificate is held weakly so that the key of an expired certificate is not reused)
+	static std::map<const Certificate *, std::pair<std::weak_ptr<Certificate>, std::shared_ptr<ov::TlsContext>>> tls_context_map;
+
+	std::lock_guard<std::mutex> lock(tls_context_map_lock);
+
+	auto item = tls_context_map.find(certificate.get());
+	if ((item != tls_context_map.end()) && (item->second.first.lock() == certificate))
+	{
+		return item->second.second;
+	}
+
+	for (auto it = tls_context_map.begin(); it != tls_context_map.end();)
+	{
+		it = it->second.first.expired() ? tls_context_map.erase(it) : std::next(it);
+	}
+
+	auto tls_context = CreateTlsContext(certificate);
+	if (tls_context != nullptr)
+	{
+		tls_context_map[certificate.get()] = {certificate, tls_context};
+	}
+
+	return tls_context;
+}
+
+std::shared_ptr<ov::TlsContext> DtlsTransport::CreateTlsContext(const std::shared_ptr<Certificate> &certificate)
+{
+	auto certificate_pair = CertificatePair::CreateCertificatePair(certificate);
 
 	ov::TlsContextCallback tls_context_callback = {
 		.create_callback = [](ov::TlsContext *tls_context, SSL_CTX *context) -> bool {
@@ -41,6 +80,19 @@ void DtlsTransport::SetLocalCertificate(const std::shared_ptr<Certificate> &cert
 				return false;
 			}
 
+			// X25519 is cheaper than P-256 for generating the ephemeral key of each handshake
+			if (::SSL_CTX_set1_groups_list(context, "X25519:P-256") != 1)
+			{
+				logtw("Could not set the ECDHE groups, the default groups will be used");
+			}
+
+			// Session resumption (RFC 5077 session tickets, and session IDs as a fallback).
+			// The session ID context is required to resume a session whose peer certificate has been verified.
+			static const unsigned char session_id_context[] = "OvenMediaEngine-DTLS";
+			::SSL_CTX_set_session_id_context(context, session_id_context, sizeof(session_id_context) - 1);
+			::SSL_CTX_set_session_cache_mode(context, SSL_SESS_CACHE_SERVER);
+			::SSL_CTX_clear_options(context, SSL_OP_NO_TICKET);
+
 			return true;
 		},
 
@@ -49,9 +101,9 @@ void DtlsTransport::SetLocalCertificate(const std::shared_ptr<Certificate> &cert
 		}};
 
 	std::shared_ptr<const ov::Error> error;
-	_tls_context = ov::TlsContext::CreateServerContext(
+	auto tls_context = ov::TlsContext::CreateServerContext(
 		ov::TlsMethod::DTls,
-		_local_certificate_pair,
+		certificate_pair,
 		"DEFAULT:!NULL:!aNULL:!SHA256:!SHA384:!aECDH:!AESGCM+AES256:!aPSK",
 		false,
 		&tls_context_callback,
@@ -61,6 +113,8 @@ void DtlsTransport::SetLocalCertificate(const std::shared_ptr<Certificate> &cert
 	{
 		logte("Could not append certificate: %s", error->What());
 	}
+
+	return tls_context;
 }
 
 // Set Peer Fingerprint for verification
@@ -106,11 +160,11 @@ bool DtlsTransport::StartDTLS()
 
 	if (_tls.Initialize(_tls_context, tls_bio_callback, true) == false)
 	{
-		_state = SSL_ERROR;
+		SetState(SSL_ERROR);
 		return false;
 	}
 
-	_state = SSL_CONNECTING;
+	SetState(SSL_CONNECTING);
 
 	ContinueSSL();
 
@@ -124,7 +178,7 @@ bool DtlsTransport::ContinueSSL()
 
 	if (error == SSL_ERROR_NONE)
 	{
-		_state = SSL_CONNECTED;
+		SetState(SSL_CONNECTED);
 
 		_peer_certificate = _tls.GetPeerCertificate();
 
@@ -147,6 +201,25 @@ bool DtlsTransport::ContinueSSL()
 	return false;
 }
 
+void DtlsTransport::SetState(SSLState state)
+{
+	auto old_state = _state.exchange(state);
+
+	if (old_state == state)
+	{
+		return;
+	}
+
+	if (state == SSL_CONNECTING)
+	{
+		_handshaking_count++;
+	}
+	else if (old_state == SSL_CONNECTING)
+	{
+		_handshaking_count--;
+	}
+}
+
 bool DtlsTransport::MakeSrtpKey()
 {
 	if (_peer_certificate_verified == false)
@@ -228,6 +301,17 @@ bool DtlsTransport::OnDataReceivedFromPrevNode(NodeType from_node, const std::sh
 	return false;
 }
 
+bool DtlsTransport::OnDataListReceivedFromPrevNode(NodeType from_node, const std::vector<std::shared_ptr<ov::Data>> &data_list)
+{
+	if ((GetNodeState() == ov::Node::NodeState::Started) && (_state == SSL_CONNECTED) && (from_node == NodeType::Srtp))
+	{
+		// Since SRTP is already encrypted, it is sent directly to ICE.
+		return SendDataListToNextNode(data_list);
+	}
+
+	return ov::Node::OnDataListReceivedFromPrevNode(from_node, data_list);
+}
+
 // IcePort -> Publisher ->[queue] Application {thread}-> Session -> DtlsTransport -> SRTP || SCTP
 bool DtlsTransport::OnDataReceivedFromNextNode(NodeType from_node, const std::shared_ptr<const ov::Data> &data)
 {
@@ -248,33 +332,14 @@ bool DtlsTransport::OnDataReceivedFromNextNode(NodeType from_node, const std::sh
 		case SSL_CONNECTED: {
 			if (IsDtlsPacket(data))
 			{
-				std::lock_guard<std::mutex> lock(_tls_lock);
-				logtd("Receive DTLS packet");
-				// Packet을 Queue에 쌓는다.
-				SaveDtlsPacket(data);
-
-				if (_state == SSL_CONNECTING)
+				// The handshake is offloaded so that this thread keeps delivering the packets of the other sessions
+				if ((_state == SSL_CONNECTING) && DtlsHandshakeWorkerPool::GetInstance()->IsRunning())
 				{
-					ContinueSSL();
+					return QueueHandshakePacket(data);
 				}
-				else
-				{
-					char buffer[MAX_DTLS_PACKET_LEN];
 
-					// SSL -> Read() -> TakeDtlsPacket() -> Decrypt -> buffer
-					[[maybe_unused]] int ssl_error = _tls.Read(buffer, sizeof(buffer), nullptr);
-
-					int pending = _tls.Pending();
-					if (pending >= 0)
-					{
-						logtd("Short DTLS read. Flushing %d bytes", pending);
-						_tls.FlushInput();
-					}
-
-					// TODO: Currently, SCTP is not supported, so there is no need to encrypt,
-					// and it will be developed if it supports data channels in the future.
-					logtd("Unknown dtls packet received (%d)", ssl_error);
-				}
+				std::lock_guard<std::mutex> lock(_tls_lock);
+				ProcessDtlsPacket(data);
 
 				return true;
 			}
@@ -296,6 +361,101 @@ bool DtlsTransport::OnDataReceivedFromNextNode(NodeType from_node, const std::sh
 	return false;
 }
 
+void DtlsTransport::ProcessDtlsPacket(const std::shared_ptr<const ov::Data> &data)
+{
+	logtd("Receive DTLS packet");
+
+	if ((_state != SSL_CONNECTING) && (_state != SSL_CONNECTED))
+	{
+		return;
+	}
+
+	// Packet을 Queue에 쌓는다.
+	SaveDtlsPacket(data);
+
+	if (_state == SSL_CONNECTING)
+	{
+		ContinueSSL();
+	}
+	else
+	{
+		char buffer[MAX_DTLS_PACKET_LEN];
+
+		// SSL -> Read() -> TakeDtlsPacket() -> Decrypt -> buffer
+		[[maybe_unused]] int ssl_error = _tls.Read(buffer, sizeof(buffer), nullptr);
+
+		int pending = _tls.Pending();
+		if (pending >= 0)
+		{
+			logtd("Short DTLS read. Flushing %d bytes", pending);
+			_tls.FlushInput();
+		}
+
+		// TODO: Currently, SCTP is not supported, so there is no need to encrypt,
+		// and it will be developed if it supports data channels in the future.
+		logtd("Unknown dtls packet received (%d)", ssl_error);
+	}
+}
+
+bool DtlsTransport::QueueHandshakePacket(const std::shared_ptr<const ov::Data> &data)
+{
+	std::lock_guard<std::mutex> lock(_handshake_lock);
+
+	if (_handshake_packets.size() >= MAX_QUEUED_HANDSHAKE_PACKETS)
+	{
+		logtd("Too many handshake packets are queued. Dropping...");
+		return false;
+	}
+
+	_handshake_packets.push_back(data);
+
+	if (_handshake_scheduled)
+	{
+		return true;
+	}
+
+	if (DtlsHandshakeWorkerPool::GetInstance()->Schedule(GetSharedPtrAs<DtlsTransport>()) == false)
+	{
+		// The peer will retransmit the flight
+		logtd("Could not schedule the DTLS handshake. Dropping...");
+		_handshake_packets.clear();
+		return false;
+	}
+
+	_handshake_scheduled = true;
+
+	return true;
+}
+
+void DtlsTransport::ProcessHandshakePackets()
+{
+	while (true)
+	{
+		std::shared_ptr<const ov::Data> data;
+
+		{
+			std::lock_guard<std::mutex> lock(_handshake_lock);
+
+			if (_handshake_packets.empty())
+			{
+				_handshake_scheduled = false;
+				return;
+			}
+
+			data = std::move(_handshake_packets.front());
+			_handshake_packets.pop_front();
+		}
+
+		if (GetNodeState() != ov::Node::NodeState::Started)
+		{
+			continue;
+		}
+
+		std::lock_guard<std::mutex> lock(_tls_lock);
+		ProcessDtlsPacket(data);
+	}
+}
+
 ssize_t DtlsTransport::Read(ov::Tls *tls, void *buffer, size_t length)
 {
 	std::shared_ptr<const ov::Data> data = TakeDtlsPacket();
@@ -10,6 +10,8 @@
 #define DTLS_RECORD_HEADER_LEN                  13
 #define MAX_DTLS_PACKET_LEN                     2048
 #define MIN_RTP_PACKET_LEN                      12
+// Handshake packets queued for DtlsHandshakeWorkerPool per session (a flight of the peer fits in this)
+#define MAX_QUEUED_HANDSHAKE_PACKETS            16
 
 class DtlsTransport : public ov::Node
 {
@@ -20,6 +22,8 @@ public:
 	virtual ~DtlsTransport();
 
 	// Set Local Certificate
+	// The TLS context is shared by the transports using the same certificate, so a peer can resume
+	// the DTLS session of its previous connection with a session ticket (abbreviated handshake)
 	void SetLocalCertificate(const std::shared_ptr<Certificate> &certificate);
 
 	// Set Peer Fingerprint for verification
@@ -34,6 +38,7 @@ public:
 	//--------------------------------------------------------------------
 	// Receive data from upper node, and send data to lower node.
 	bool OnDataReceivedFromPrevNode(NodeType from_node, const std::shared_ptr<ov::Data> &data);
+	bool OnDataListReceivedFromPrevNode(NodeType from_node, const std::vector<std::shared_ptr<ov::Data>> &data_list) override;
 	// Receive data from lower node, and send data to upper node.
 	bool OnDataReceivedFromNextNode(NodeType from_node, const std::shared_ptr<const ov::Data> &data);
 
@@ -45,6 +50,15 @@ public:
 	// 그 외에는 모르는 패킷이므로 처리하지 않는다.
 	bool RecvPacket(const std::shared_ptr<ov::Data> &data);
 
+	// Called by DtlsHandshakeWorkerPool to process the queued handshake packets
+	void ProcessHandshakePackets();
+
+	// The number of sessions that have started DTLS but not yet completed the handshake
+	static size_t GetHandshakingCount()
+	{
+		return _handshaking_count;
+	}
+
 protected:
 	// SSL에서 암호화 할 패킷을 읽어갈 때 호출한다. _packet_buffer에 쌓인 패킷을 준다.
 	ssize_t Read(ov::Tls *tls, void *buffer, size_t length);
@@ -55,7 +69,12 @@ protected:
 	bool VerifyPeerCertificate();
 
 private:
+	static std::shared_ptr<ov::TlsContext> GetTlsContext(const std::shared_ptr<Certificate> &certificate);
+	static std::shared_ptr<ov::TlsContext> CreateTlsContext(const std::shared_ptr<Certificate> &certificate);
+
 	bool ContinueSSL();
+	void ProcessDtlsPacket(const std::shared_ptr<const ov::Data> &data);
+	bool QueueHandshakePacket(const std::shared_ptr<const ov::Data> &data);
 	bool IsDtlsPacket(const std::shared_ptr<const ov::Data> data);
 	bool IsRtpPacket(const std::shared_ptr<const ov::Data> data);
 	bool SaveDtlsPacket(const std::shared_ptr<const ov::Data> data);
@@ -73,12 +92,15 @@ private:
 		SSL_CLOSED
 	};
 
-	SSLState _state;
+	// Must be called with _tls_lock
+	void SetState(SSLState state);
+
+	// Read without _tls_lock by the threads that send packets
+	std::atomic<SSLState> _state;
 	bool _peer_certificate_verified;
 	std::shared_ptr<info::Session> _session_info;
 	std::shared_ptr<IcePort> _ice_port;
 	std::shared_ptr<SrtpTransport> _srtp_transport;
-	std::shared_ptr<CertificatePair> _local_certificate_pair;
 	std::shared_ptr<ov::TlsContext> _tls_context;
 	std::shared_ptr<Certificate> _peer_certificate;
 	ov::String _peer_fingerprint_algorithm;
@@ -92,5 +114,12 @@ private:
 
 	std::mutex _tls_lock;
 
+	// Handshake packets waiting for DtlsHandshakeWorkerPool
+	std::mutex _handshake_lock;
+	std::deque<std::shared_ptr<const ov::Data>> _handshake_packets;
+	bool _handshake_scheduled = false;
+
+	static std::atomic<size_t> _handshaking_count;
+
 	ov::Tls _tls;
 };
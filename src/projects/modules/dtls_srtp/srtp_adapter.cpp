@@ -31,6 +31,7 @@ bool SrtpAdapter::Release()
 	if(_session != nullptr)
 	{
 		srtp_dealloc(_session);
+		_session = nullptr;
 	}
 	return true;
 }
@@ -86,6 +87,38 @@ bool SrtpAdapter::SetKey(srtp_ssrc_type_t type, uint64_t crypto_suite, std::shar
 }
 
 bool SrtpAdapter::ProtectRtp(std::shared_ptr<ov::Data> data)
+{
+	std::lock_guard<std::mutex> lock(_session_lock);
+
+	return ProtectRtpInternal(data);
+}
+
+bool SrtpAdapter::ProtectRtp(std::vector<std::shared_ptr<ov::Data>> &data_list)
+{
+	std::lock_guard<std::mutex> lock(_session_lock);
+
+	size_t protected_count = 0;
+
+	for (auto &data : data_list)
+	{
+		if (ProtectRtpInternal(data))
+		{
+			if (&data_list[protected_count] != &data)
+			{
+				data_list[protected_count] = std::move(data);
+			}
+
+			protected_count++;
+		}
+	}
+
+	auto succeeded = (protected_count == data_list.size());
+	data_list.resize(protected_count);
+
+	return succeeded;
+}
+
+bool SrtpAdapter::ProtectRtpInternal(const std::shared_ptr<ov::Data> &data)
 {
 	if(!_session)
 	{
@@ -94,9 +127,10 @@ bool SrtpAdapter::ProtectRtp(std::shared_ptr<ov::Data> data)
 
 	uint32_t need_len = data->GetLength() + _rtp_auth_tag_len;
 
-	if(need_len > data->GetCapacity())
+	// The tag is written into the tailroom of the packet (reallocated only if there is not enough room)
+	if(data->ReserveTailroom(_rtp_auth_tag_len) == false)
 	{
-		logte("Buffer capacity(%d) less than the needed(%d)", data->GetCapacity(), need_len);
+		logte("Could not reserve the tailroom(%d) of the packet(%d)", _rtp_auth_tag_len, data->GetLength());
 		return false;
 	}
 
@@ -110,7 +144,6 @@ bool SrtpAdapter::ProtectRtp(std::shared_ptr<ov::Data> data)
 	uint8_t red_payload_type = byte_buffer[12];
 	uint16_t seq = ByteReader<uint16_t>::ReadBigEndian(&byte_buffer[2]);
 
-	std::lock_guard<std::mutex> lock(_session_lock);
 	int err = srtp_protect(_session, buffer, &out_len);
 	if(err != srtp_err_status_ok)
 	{
@@ -123,6 +156,8 @@ bool SrtpAdapter::ProtectRtp(std::shared_ptr<ov::Data> data)
 
 bool SrtpAdapter::ProtectRtcp(std::shared_ptr<ov::Data> data)
 {
+	std::lock_guard<std::mutex> lock(_session_lock);
+
     if(!_session)
     {
         return false;
@@ -131,9 +166,9 @@ bool SrtpAdapter::ProtectRtcp(std::shared_ptr<ov::Data> data)
     // Protect size check( data + tag + (E, Encryption. 1 bit. + SRTCP index. 31 bits.)
     uint32_t need_len = data->GetLength() + _rtcp_auth_tag_len + 4;
 
-    if(need_len > data->GetCapacity())
+    if(data->ReserveTailroom(_rtcp_auth_tag_len + 4) == false)
     {
-        logte("Buffer capacity(%d) less than the needed(%d)", data->GetCapacity(), need_len);
+        logte("Could not reserve the tailroom(%d) of the packet(%d)", _rtcp_auth_tag_len + 4, data->GetLength());
         return false;
     }
 
@@ -141,7 +176,6 @@ bool SrtpAdapter::ProtectRtcp(std::shared_ptr<ov::Data> data)
     int out_len = static_cast<int>(data->GetLength());
     data->SetLength(need_len);
 
-	std::lock_guard<std::mutex> lock(_session_lock);
     int err = srtp_protect_rtcp(_session, buffer, &out_len);
     if(err != srtp_err_status_ok)
     {
@@ -154,6 +188,8 @@ bool SrtpAdapter::ProtectRtcp(std::shared_ptr<ov::Data> data)
 
 bool SrtpAdapter::UnprotectRtp(const std::shared_ptr<ov::Data> &data)
 {
+	std::lock_guard<std::mutex> lock(_session_lock);
+
 	if (!_session)
     {
         return false;
@@ -162,7 +198,6 @@ bool SrtpAdapter::UnprotectRtp(const std::shared_ptr<ov::Data> &data)
     auto buffer = data->GetWritableData();
     int out_len = static_cast<int>(data->GetLength());
 
-	std::lock_guard<std::mutex> lock(_session_lock);
     int err = srtp_unprotect(_session, buffer, &out_len);
     if (err != srtp_err_status_ok)
     {
@@ -177,6 +212,8 @@ bool SrtpAdapter::UnprotectRtp(const std::shared_ptr<ov::Data> &data)
 
 bool SrtpAdapter::UnprotectRtcp(const std::shared_ptr<ov::Data> &data)
 {
+	std::lock_guard<std::mutex> lock(_session_lock);
+
     if (!_session)
     {
         return false;
@@ -185,7 +222,6 @@ bool SrtpAdapter::UnprotectRtcp(const std::shared_ptr<ov::Data> &data)
     auto buffer = data->GetWritableData();
     int out_len = static_cast<int>(data->GetLength());
 
-	std::lock_guard<std::mutex> lock(_session_lock);
     int err = srtp_unprotect_rtcp(_session, buffer, &out_len);
     if (err != srtp_err_status_ok)
     {
@@ -22,11 +22,17 @@ public:
 	bool	SetKey(srtp_ssrc_type_t type, uint64_t crypto_suite, std::shared_ptr<ov::Data> key);
 
 	bool	ProtectRtp(std::shared_ptr<ov::Data> data);
+	// Protects the packets in order while holding the session lock only once.
+	// The packets that could not be protected are removed from <data_list>.
+	bool	ProtectRtp(std::vector<std::shared_ptr<ov::Data>> &data_list);
     bool	ProtectRtcp(std::shared_ptr<ov::Data> data);
 	bool	UnprotectRtp(const std::shared_ptr<ov::Data> &data);
     bool	UnprotectRtcp(const std::shared_ptr<ov::Data> &data);
 
 private:
+	// Must be called while _session_lock is locked
+	bool	ProtectRtpInternal(const std::shared_ptr<ov::Data> &data);
+
 	std::mutex		_session_lock;
 	srtp_ctx_t_* 	_session;
 	
@@ -0,0 +1,168 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "srtp_crypto_worker_pool.h"
+
+#include "srtp_transport.h"
+
+#define OV_LOG_TAG "SRTP"
+
+bool SrtpCryptoWorkerPool::Worker::Start(size_t index)
+{
+	_stop_thread_flag = false;
+
+	try
+	{
+		_thread = std::thread(&Worker::WorkerThread, this);
+	}
+	catch (const std::system_error &e)
+	{
+		_stop_thread_flag = true;
+		logte("Could not start SRTP crypto worker #%zu: %s", index, e.what());
+		return false;
+	}
+
+	auto name = ov::String::FormatString("SrtpCrypto%zu", index);
+	::pthread_setname_np(_thread.native_handle(), name.CStr());
+
+	return true;
+}
+
+void SrtpCryptoWorkerPool::Worker::Stop()
+{
+	if (_stop_thread_flag.exchange(true))
+	{
+		return;
+	}
+
+	_event.Notify();
+
+	if (_thread.joinable())
+	{
+		_thread.join();
+	}
+
+	std::lock_guard lock_guard(_mutex);
+	_transport_queue.clear();
+}
+
+void SrtpCryptoWorkerPool::Worker::Schedule(const std::shared_ptr<SrtpTransport> &transport)
+{
+	{
+		std::lock_guard lock_guard(_mutex);
+		_transport_queue.push_back(transport);
+	}
+
+	_event.Notify();
+}
+
+void SrtpCryptoWorkerPool::Worker::WorkerThread()
+{
+	ov::ThreadRegistry::Registration registration("SrtpCryptoWorker");
+
+	while (_stop_thread_flag == false)
+	{
+		_event.Wait();
+
+		std::shared_ptr<SrtpTransport> transport;
+
+		{
+			std::lock_guard lock_guard(_mutex);
+
+			if (_transport_queue.empty())
+			{
+				continue;
+			}
+
+			transport = std::move(_transport_queue.front());
+			_transport_queue.pop_front();
+		}
+
+		if (transport->ProtectPendingRtpPackets())
+		{
+			// More packets were queued while protecting, so process them after the other transports
+			Schedule(transport);
+		}
+	}
+}
+
+SrtpCryptoWorkerPool::~SrtpCryptoWorkerPool()
+{
+	Stop();
+}
+
+bool SrtpCryptoWorkerPool::Start(size_t worker_count)
+{
+	std::lock_guard lock_guard(_mutex);
+
+	// The workers are not recreated, so Schedule() can access _worker_list without locking
+	if (_worker_list.empty() == false)
+	{
+		logte("SRTP crypto worker pool is already started");
+		return false;
+	}
+
+	worker_count = std::max<size_t>(worker_count, 1);
+
+	for (size_t index = 0; index < worker_count; index++)
+	{
+		auto worker = std::make_shared<Worker>();
+
+		if (worker->Start(index) == false)
+		{
+			for (auto &started_worker : _worker_list)
+			{
+				started_worker->Stop();
+			}
+
+			_worker_list.clear();
+			return false;
+		}
+
+		_worker_list.push_back(worker);
+	}
+
+	_is_running = true;
+
+	logti("SRTP crypto worker pool is started with %zu workers", worker_count);
+
+	return true;
+}
+
+bool SrtpCryptoWorkerPool::Stop()
+{
+	std::lock_guard lock_guard(_mutex);
+
+	if (_is_running.exchange(false) == false)
+	{
+		return true;
+	}
+
+	for (auto &worker : _worker_list)
+	{
+		worker->Stop();
+	}
+
+	return true;
+}
+
+size_t SrtpCryptoWorkerPool::GetNextWorkerIndex()
+{
+	return _next_worker_index++;
+}
+
+bool SrtpCryptoWorkerPool::Schedule(size_t worker_index, const std::shared_ptr<SrtpTransport> &transport)
+{
+	if ((_is_running == false) || (transport == nullptr))
+	{
+		return false;
+	}
+
+	_worker_list[worker_index % _worker_list.size()]->Schedule(transport);
+
+	return true;
+}
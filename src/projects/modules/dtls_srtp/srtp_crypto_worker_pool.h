@@ -0,0 +1,76 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/ovlibrary/ovlibrary.h>
+
+#include <atomic>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+class SrtpTransport;
+
+// Protects outgoing SRTP packets on dedicated threads instead of the thread that sends them (StreamWorker)
+//
+// A transport is always processed by the same worker, so the packets of a session are protected and
+// sent in the order they were queued. The packets queued while the transport is waiting for its worker
+// are protected together with a single call of SrtpAdapter::ProtectRtp().
+class SrtpCryptoWorkerPool
+{
+public:
+	static SrtpCryptoWorkerPool *GetInstance()
+	{
+		static SrtpCryptoWorkerPool instance;
+		return &instance;
+	}
+
+	bool Start(size_t worker_count);
+	bool Stop();
+
+	bool IsRunning() const
+	{
+		return _is_running;
+	}
+
+	// Returns the index of the worker that will process a new transport (round robin)
+	size_t GetNextWorkerIndex();
+
+	// Returns false if the pool is not running
+	bool Schedule(size_t worker_index, const std::shared_ptr<SrtpTransport> &transport);
+
+protected:
+	class Worker
+	{
+	public:
+		bool Start(size_t index);
+		void Stop();
+
+		void Schedule(const std::shared_ptr<SrtpTransport> &transport);
+
+	protected:
+		void WorkerThread();
+
+		std::atomic<bool> _stop_thread_flag{true};
+		std::thread _thread;
+
+		ov::Semaphore _event;
+
+		std::mutex _mutex;
+		std::deque<std::shared_ptr<SrtpTransport>> _transport_queue;
+	};
+
+	SrtpCryptoWorkerPool() = default;
+	~SrtpCryptoWorkerPool();
+
+	std::atomic<bool> _is_running{false};
+
+	std::mutex _mutex;
+	std::vector<std::shared_ptr<Worker>> _worker_list;
+	std::atomic<size_t> _next_worker_index{0};
+};
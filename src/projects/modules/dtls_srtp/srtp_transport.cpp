@@ -8,13 +8,14 @@
 //==============================================================================
 #include "srtp_transport.h"
 #include "dtls_transport.h"
+#include "srtp_crypto_worker_pool.h"
 
 #define OV_LOG_TAG "SRTP"
 
 SrtpTransport::SrtpTransport()
 	: ov::Node(NodeType::Srtp)
 {
-
+	_crypto_worker_index = SrtpCryptoWorkerPool::GetInstance()->GetNextWorkerIndex();
 }
 
 SrtpTransport::~SrtpTransport()
@@ -51,6 +52,12 @@ bool SrtpTransport::OnDataReceivedFromPrevNode(NodeType from_node, const std::sh
 	
 	if(from_node == NodeType::Rtp)
 	{
+		if(EnqueueRtpPacket(data))
+		{
+			// The packet will be protected and sent by the crypto worker
+			return true;
+		}
+
 		if(!_send_session->ProtectRtp(data))
 		{
 			return false;
@@ -72,6 +79,106 @@ bool SrtpTransport::OnDataReceivedFromPrevNode(NodeType from_node, const std::sh
 	return SendDataToNextNode(data);
 }
 
+bool SrtpTransport::OnDataListReceivedFromPrevNode(NodeType from_node, const std::vector<std::shared_ptr<ov::Data>> &data_list)
+{
+	if(from_node != NodeType::Rtp)
+	{
+		return ov::Node::OnDataListReceivedFromPrevNode(from_node, data_list);
+	}
+
+	if(GetNodeState() != ov::Node::NodeState::Started)
+	{
+		logtd("Node has not started, so the received data has been canceled.");
+		return false;
+	}
+
+	if(!_send_session)
+	{
+		return false;
+	}
+
+	if(EnqueueRtpPacketList(data_list))
+	{
+		// The packets will be protected and sent by the crypto worker
+		return true;
+	}
+
+	auto packet_list = data_list;
+	auto result = _send_session->ProtectRtp(packet_list);
+
+	// To DTLS transport
+	return SendDataListToNextNode(packet_list) && result;
+}
+
+bool SrtpTransport::EnqueueRtpPacket(const std::shared_ptr<ov::Data> &data)
+{
+	return EnqueueRtpPacketList({data});
+}
+
+bool SrtpTransport::EnqueueRtpPacketList(const std::vector<std::shared_ptr<ov::Data>> &data_list)
+{
+	auto pool = SrtpCryptoWorkerPool::GetInstance();
+
+	if(pool->IsRunning() == false)
+	{
+		return false;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(_pending_rtp_packet_mutex);
+
+		_pending_rtp_packet_list.insert(_pending_rtp_packet_list.end(), data_list.begin(), data_list.end());
+
+		if(_is_crypto_scheduled)
+		{
+			// The worker will protect this packet together with the packets queued before
+			return true;
+		}
+
+		_is_crypto_scheduled = true;
+	}
+
+	if(pool->Schedule(_crypto_worker_index, GetSharedPtrAs<SrtpTransport>()) == false)
+	{
+		std::lock_guard<std::mutex> lock(_pending_rtp_packet_mutex);
+
+		_pending_rtp_packet_list.clear();
+		_is_crypto_scheduled = false;
+
+		return false;
+	}
+
+	return true;
+}
+
+bool SrtpTransport::ProtectPendingRtpPackets()
+{
+	std::vector<std::shared_ptr<ov::Data>> packet_list;
+
+	{
+		std::lock_guard<std::mutex> lock(_pending_rtp_packet_mutex);
+		packet_list.swap(_pending_rtp_packet_list);
+	}
+
+	if((packet_list.empty() == false) && (GetNodeState() == ov::Node::NodeState::Started) && (_send_session != nullptr))
+	{
+		_send_session->ProtectRtp(packet_list);
+
+		// To DTLS transport (sent with as few system calls as possible)
+		SendDataListToNextNode(packet_list);
+	}
+
+	std::lock_guard<std::mutex> lock(_pending_rtp_packet_mutex);
+
+	if(_pending_rtp_packet_list.empty())
+	{
+		_is_crypto_scheduled = false;
+		return false;
+	}
+
+	return true;
+}
+
 bool SrtpTransport::OnDataReceivedFromNextNode(NodeType from_node, const std::shared_ptr<const ov::Data> &data)
 {
 	if(GetNodeState() != ov::Node::NodeState::Started)
@@ -24,10 +24,26 @@ public:
 
 	bool OnDataReceivedFromPrevNode(NodeType from_node, const std::shared_ptr<ov::Data> &data) override;
 	bool OnDataReceivedFromNextNode(NodeType from_node, const std::shared_ptr<const ov::Data> &data) override;
+	bool OnDataListReceivedFromPrevNode(NodeType from_node, const std::vector<std::shared_ptr<ov::Data>> &data_list) override;
 
 	bool SetKeyMaterial(uint64_t crypto_suite, std::shared_ptr<ov::Data> server_key, std::shared_ptr<ov::Data> client_key);
 
+	// Called by SrtpCryptoWorkerPool to protect and send the queued RTP packets
+	// Returns true if more packets were queued while protecting
+	bool ProtectPendingRtpPackets();
+
 private:
+	// Queues the RTP packet to be protected by SrtpCryptoWorkerPool
+	// Returns false if the pool is not running
+	bool EnqueueRtpPacket(const std::shared_ptr<ov::Data> &data);
+	bool EnqueueRtpPacketList(const std::vector<std::shared_ptr<ov::Data>> &data_list);
+
 	std::shared_ptr<SrtpAdapter>		_send_session = nullptr;
 	std::shared_ptr<SrtpAdapter>		_recv_session = nullptr;
+
+	size_t _crypto_worker_index = 0;
+	std::mutex _pending_rtp_packet_mutex;
+	std::vector<std::shared_ptr<ov::Data>> _pending_rtp_packet_list;
+	// true while this transport is in the queue of the crypto worker
+	bool _is_crypto_scheduled = false;
 };
@@ -0,0 +1,303 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "ingest_capture.h"
+
+#include <netinet/in.h>
+
+// pcap file format (https://wiki.wireshark.org/Development/LibpcapFileFormat)
+#define PCAP_MAGIC_NUMBER 0xA1B2C3D4
+#define PCAP_VERSION_MAJOR 2
+#define PCAP_VERSION_MINOR 4
+#define PCAP_SNAPLEN 65535
+#define PCAP_LINKTYPE_ETHERNET 1
+
+#define PCAP_ETHERNET_HEADER_SIZE 14
+#define PCAP_IPV4_HEADER_SIZE 20
+#define PCAP_UDP_HEADER_SIZE 8
+#define PCAP_HEADERS_SIZE (PCAP_ETHERNET_HEADER_SIZE + PCAP_IPV4_HEADER_SIZE + PCAP_UDP_HEADER_SIZE)
+
+#define FLV_HEADER_SIZE 9
+#define FLV_TAG_HEADER_SIZE 11
+
+namespace mdl
+{
+	IngestCapture::IngestCapture(Format format, int64_t duration_ms, size_t max_bytes)
+		: _format(format),
+		  _duration_us(duration_ms * 1000),
+		  _max_bytes(max_bytes)
+	{
+	}
+
+	const char *IngestCapture::StringFromFormat(Format format)
+	{
+		switch (format)
+		{
+			case Format::Ts:
+				return "ts";
+			case Format::Flv:
+				return "flv";
+			case Format::Pcap:
+				return "pcap";
+		}
+
+		return "unknown";
+	}
+
+	void IngestCapture::Append(const std::shared_ptr<const ov::Data> &data)
+	{
+		if ((data == nullptr) || (data->GetLength() == 0))
+		{
+			return;
+		}
+
+		Record record;
+		record.data = std::make_shared<const ov::Data>(data->GetData(), data->GetLength());
+
+		AppendRecord(std::move(record));
+	}
+
+	void IngestCapture::AppendFlvTag(FlvTagType type, int64_t timestamp_ms, const std::shared_ptr<const ov::Data> &payload, bool sticky)
+	{
+		if ((payload == nullptr) || (payload->GetLength() == 0))
+		{
+			return;
+		}
+
+		Record record;
+		record.data = std::make_shared<const ov::Data>(payload->GetData(), payload->GetLength());
+		record.type = type;
+		record.timestamp_ms = timestamp_ms;
+		record.sticky = sticky;
+
+		AppendRecord(std::move(record));
+	}
+
+	void IngestCapture::AppendRecord(Record record)
+	{
+		record.captured_time_us = ov::Clock::NowUSec();
+
+		std::lock_guard lock_guard(_mutex);
+
+		_bytes += record.data->GetLength();
+		_records.push_back(std::move(record));
+
+		auto newest_time_us = _records.back().captured_time_us;
+
+		while (_records.empty() == false)
+		{
+			auto &oldest = _records.front();
+
+			if ((_bytes <= _max_bytes) && ((newest_time_us - oldest.captured_time_us) <= _duration_us))
+			{
+				break;
+			}
+
+			_bytes -= oldest.data->GetLength();
+
+			if (oldest.sticky)
+			{
+				// The sequence header/metadata is still needed to decode the records in the ring
+				_sticky_records[oldest.type] = std::move(oldest);
+			}
+
+			_records.pop_front();
+		}
+	}
+
+	IngestCapture::Stats IngestCapture::GetStats() const
+	{
+		std::lock_guard lock_guard(_mutex);
+
+		Stats stats;
+		stats.record_count = _records.size();
+		stats.bytes = _bytes;
+		stats.duration_ms = _records.empty() ? 0 : (_records.back().captured_time_us - _records.front().captured_time_us) / 1000;
+
+		return stats;
+	}
+
+	std::shared_ptr<ov::Data> IngestCapture::Dump(Stats *stats) const
+	{
+		std::lock_guard lock_guard(_mutex);
+
+		if (_records.empty())
+		{
+			return nullptr;
+		}
+
+		// The headers of the records of Flv/Pcap are at most PCAP_HEADERS_SIZE + 16 bytes
+		ov::ByteStream stream(_bytes + (_records.size() + _sticky_records.size()) * (PCAP_HEADERS_SIZE + 16) + 64);
+
+		switch (_format)
+		{
+			case Format::Ts:
+				for (const auto &record : _records)
+				{
+					stream.Write(record.data);
+				}
+				break;
+
+			case Format::Flv:
+				WriteFlv(stream);
+				break;
+
+			case Format::Pcap:
+				WritePcap(stream);
+				break;
+		}
+
+		if (stats != nullptr)
+		{
+			stats->record_count = _records.size();
+			stats->bytes = _bytes;
+			stats->duration_ms = (_records.back().captured_time_us - _records.front().captured_time_us) / 1000;
+		}
+
+		return stream.GetDataPointer();
+	}
+
+	void IngestCapture::WriteFlv(ov::ByteStream &stream) const
+	{
+		bool has_audio = false;
+		bool has_video = false;
+
+		auto check_type = [&](const Record &record) {
+			has_audio |= (record.type == FlvTagType::Audio);
+			has_video |= (record.type == FlvTagType::Video);
+		};
+
+		for (const auto &[type, record] : _sticky_records)
+		{
+			check_type(record);
+		}
+
+		for (const auto &record : _records)
+		{
+			check_type(record);
+		}
+
+		// Signature, version, flags, header size
+		stream.Write("FLV", 3);
+		stream.Write8(0x01);
+		stream.Write8((has_audio ? 0x04 : 0x00) | (has_video ? 0x01 : 0x00));
+		stream.WriteBE32(FLV_HEADER_SIZE);
+		// PreviousTagSize0
+		stream.WriteBE32(0);
+
+		// The timeline starts at 0, and the sticky records are placed at the beginning of it
+		auto base_timestamp_ms = _records.front().timestamp_ms;
+
+		// The map is ordered by the tag type (Audio, Video, ScriptData), so the metadata follows the sequence headers,
+		// which is fine since the demuxers only need the sequence headers before the media
+		for (const auto &[type, record] : _sticky_records)
+		{
+			WriteFlvTag(stream, record, 0);
+		}
+
+		for (const auto &record : _records)
+		{
+			WriteFlvTag(stream, record, std::max<int64_t>(record.timestamp_ms - base_timestamp_ms, 0));
+		}
+	}
+
+	void IngestCapture::WriteFlvTag(ov::ByteStream &stream, const Record &record, int64_t timestamp_ms)
+	{
+		auto data_size = static_cast<uint32_t>(record.data->GetLength());
+		auto timestamp = static_cast<uint32_t>(timestamp_ms);
+
+		stream.Write8(ov::ToUnderlyingType(record.type));
+		// DataSize (24 bits)
+		stream.Write8((data_size >> 16) & 0xFF);
+		stream.Write8((data_size >> 8) & 0xFF);
+		stream.Write8(data_size & 0xFF);
+		// Timestamp (lower 24 bits) + TimestampExtended (upper 8 bits)
+		stream.Write8((timestamp >> 16) & 0xFF);
+		stream.Write8((timestamp >> 8) & 0xFF);
+		stream.Write8(timestamp & 0xFF);
+		stream.Write8((timestamp >> 24) & 0xFF);
+		// StreamID (24 bits)
+		stream.Write8(0);
+		stream.Write8(0);
+		stream.Write8(0);
+
+		stream.Write(record.data);
+
+		stream.WriteBE32(FLV_TAG_HEADER_SIZE + data_size);
+	}
+
+	void IngestCapture::WritePcap(ov::ByteStream &stream) const
+	{
+		// Global header (in host byte order, the readers detect it by the magic number)
+		stream.Write32(PCAP_MAGIC_NUMBER);
+		stream.Write16(PCAP_VERSION_MAJOR);
+		stream.Write16(PCAP_VERSION_MINOR);
+		// thiszone, sigfigs
+		stream.Write32(0);
+		stream.Write32(0);
+		stream.Write32(PCAP_SNAPLEN);
+		stream.Write32(PCAP_LINKTYPE_ETHERNET);
+
+		uint16_t ip_id = 0;
+
+		for (const auto &record : _records)
+		{
+			auto payload_length = std::min<size_t>(record.data->GetLength(), PCAP_SNAPLEN - PCAP_HEADERS_SIZE);
+			auto frame_length = static_cast<uint32_t>(PCAP_HEADERS_SIZE + payload_length);
+
+			// Record header
+			stream.Write32(static_cast<uint32_t>(record.captured_time_us / 1000000));
+			stream.Write32(static_cast<uint32_t>(record.captured_time_us % 1000000));
+			stream.Write32(frame_length);
+			stream.Write32(frame_length);
+
+			uint8_t headers[PCAP_HEADERS_SIZE]{};
+
+			// Ethernet (zero MAC addresses), EtherType: IPv4
+			auto ethernet = headers;
+			ethernet[12] = 0x08;
+			ethernet[13] = 0x00;
+
+			// IPv4 127.0.0.1 -> 127.0.0.1, DF, TTL 64, UDP
+			auto ip = ethernet + PCAP_ETHERNET_HEADER_SIZE;
+			auto ip_length = static_cast<uint16_t>(PCAP_IPV4_HEADER_SIZE + PCAP_UDP_HEADER_SIZE + payload_length);
+			ip[0] = 0x45;
+			ip[2] = ip_length >> 8;
+			ip[3] = ip_length & 0xFF;
+			ip[4] = ip_id >> 8;
+			ip[5] = ip_id & 0xFF;
+			ip[6] = 0x40;
+			ip[8] = 64;
+			ip[9] = IPPROTO_UDP;
+			ip[12] = ip[16] = 127;
+			ip[15] = ip[19] = 1;
+
+			uint32_t checksum = 0;
+			for (int index = 0; index < PCAP_IPV4_HEADER_SIZE; index += 2)
+			{
+				checksum += (ip[index] << 8) | ip[index + 1];
+			}
+			checksum = (checksum & 0xFFFF) + (checksum >> 16);
+			checksum = ~((checksum & 0xFFFF) + (checksum >> 16)) & 0xFFFF;
+			ip[10] = checksum >> 8;
+			ip[11] = checksum & 0xFF;
+
+			// UDP (the checksum is optional in IPv4)
+			auto udp = ip + PCAP_IPV4_HEADER_SIZE;
+			auto udp_length = static_cast<uint16_t>(PCAP_UDP_HEADER_SIZE + payload_length);
+			udp[0] = udp[2] = INGEST_CAPTURE_PCAP_PORT >> 8;
+			udp[1] = udp[3] = INGEST_CAPTURE_PCAP_PORT & 0xFF;
+			udp[4] = udp_length >> 8;
+			udp[5] = udp_length & 0xFF;
+
+			stream.Write(headers, sizeof(headers));
+			stream.Write(record.data->GetData(), payload_length);
+
+			ip_id++;
+		}
+	}
+}  // namespace mdl
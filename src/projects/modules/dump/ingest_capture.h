@@ -0,0 +1,105 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/ovlibrary/ovlibrary.h>
+
+#include <deque>
+#include <map>
+#include <mutex>
+
+// Destination port of the synthetic UDP headers of a pcap capture (5004 is the default RTP port of the dissectors)
+#define INGEST_CAPTURE_PCAP_PORT 5004
+
+namespace mdl
+{
+	// Keeps the last <duration> of the raw ingest of a stream in a ring, and writes it as a file that can be fed back to
+	// OvenMediaEngine (File provider) or to other tools.
+	//
+	// - Ts: the datagrams of MPEG-TS/UDP and SRT, written as they are
+	// - Flv: the audio/video/data messages of RTMP, written as FLV tags. The sequence headers and the metadata are
+	//   kept when they rotate out of the ring (sticky), so the file is still decodable
+	// - Pcap: the RTP packets of WebRTC (after SRTP), wrapped in synthetic Ethernet/IPv4/UDP headers
+	//
+	// The records are copied, because the buffers of the ingest are reused or converted in place (AnnexB, ADTS, ...)
+	class IngestCapture
+	{
+	public:
+		enum class Format
+		{
+			Ts,
+			Flv,
+			Pcap
+		};
+
+		// FLV tag types
+		enum class FlvTagType : uint8_t
+		{
+			Audio = 8,
+			Video = 9,
+			ScriptData = 18
+		};
+
+		struct Stats
+		{
+			size_t record_count = 0;
+			size_t bytes = 0;
+			int64_t duration_ms = 0;
+		};
+
+		IngestCapture(Format format, int64_t duration_ms, size_t max_bytes);
+
+		Format GetFormat() const
+		{
+			return _format;
+		}
+
+		static const char *StringFromFormat(Format format);
+
+		// Ts/Pcap
+		void Append(const std::shared_ptr<const ov::Data> &data);
+		// Flv (<timestamp_ms> is the timestamp of the RTMP message)
+		void AppendFlvTag(FlvTagType type, int64_t timestamp_ms, const std::shared_ptr<const ov::Data> &payload, bool sticky);
+
+		Stats GetStats() const;
+
+		// Returns the content of the file, or nullptr if nothing is captured yet
+		std::shared_ptr<ov::Data> Dump(Stats *stats = nullptr) const;
+
+	private:
+		struct Record
+		{
+			// Wall clock time when the record is captured
+			int64_t captured_time_us = 0;
+			std::shared_ptr<const ov::Data> data;
+
+			// Flv only
+			FlvTagType type = FlvTagType::ScriptData;
+			int64_t timestamp_ms = 0;
+			bool sticky = false;
+		};
+
+		void AppendRecord(Record record);
+
+		void WriteFlv(ov::ByteStream &stream) const;
+		static void WriteFlvTag(ov::ByteStream &stream, const Record &record, int64_t timestamp_ms);
+		void WritePcap(ov::ByteStream &stream) const;
+
+		const Format _format;
+		const int64_t _duration_us;
+		const size_t _max_bytes;
+
+		mutable std::mutex _mutex;
+
+		std::deque<Record> _records;
+		size_t _bytes = 0;
+
+		// The last sticky record of each tag type that has rotated out of <_records>
+		std::map<FlvTagType, Record> _sticky_records;
+	};
+}  // namespace mdl
@@ -54,6 +54,10 @@ namespace ffmpeg
 					return cmn::MediaCodecId::H264;
 				case AV_CODEC_ID_VP8:
 					return cmn::MediaCodecId::Vp8;
+				case AV_CODEC_ID_VP9:
+					return cmn::MediaCodecId::Vp9;
+				case AV_CODEC_ID_AV1:
+					return cmn::MediaCodecId::Av1;
 				case AV_CODEC_ID_FLV1:
 					return cmn::MediaCodecId::Flv;
 				case AV_CODEC_ID_AAC:
@@ -0,0 +1,309 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "async_file_output.h"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "private.h"
+
+// The small writes of the muxer are merged into a chunk up to this size
+#define ASYNC_FILE_OUTPUT_MAX_CHUNK_SIZE (1024 * 1024)
+// Weight of the latest sample in the average write latency (1/N)
+#define ASYNC_FILE_OUTPUT_LATENCY_WEIGHT 16
+
+std::shared_ptr<AsyncFileOutput> AsyncFileOutput::Create(const ov::String &path, size_t max_queue_size, size_t preallocation_size)
+{
+	auto output = std::make_shared<AsyncFileOutput>(path, max_queue_size, preallocation_size);
+
+	if (output->Open() == false)
+	{
+		return nullptr;
+	}
+
+	return output;
+}
+
+AsyncFileOutput::AsyncFileOutput(const ov::String &path, size_t max_queue_size, size_t preallocation_size)
+	: _path(path),
+	  _max_queue_size(max_queue_size),
+	  _preallocation_size(preallocation_size)
+{
+}
+
+AsyncFileOutput::~AsyncFileOutput()
+{
+	Close();
+}
+
+bool AsyncFileOutput::Open()
+{
+	_fd = ::open(_path.CStr(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+
+	if (_fd < 0)
+	{
+		logte("Could not open file: %s (%s)", _path.CStr(), ov::Error::CreateErrorFromErrno()->What());
+		return false;
+	}
+
+	_io_thread = std::thread(&AsyncFileOutput::IoThread, this);
+	::pthread_setname_np(_io_thread.native_handle(), "FileWriterIO");
+
+	return true;
+}
+
+bool AsyncFileOutput::Write(const void *data, size_t length)
+{
+	if (_is_writable == false)
+	{
+		return false;
+	}
+
+	{
+		std::lock_guard lock_guard(_queue_mutex);
+
+		// Appends to the last chunk if it is contiguous and not taken by the I/O thread yet
+		if ((_queue.empty() == false) &&
+			(_queue.back().offset + static_cast<int64_t>(_queue.back().data->GetLength()) == _position) &&
+			(_queue.back().data->GetLength() + length <= ASYNC_FILE_OUTPUT_MAX_CHUNK_SIZE))
+		{
+			_queue.back().data->Append(data, length);
+		}
+		else
+		{
+			auto chunk_data = std::make_shared<ov::Data>(std::max(length, static_cast<size_t>(ASYNC_FILE_OUTPUT_MAX_CHUNK_SIZE)));
+			chunk_data->Append(data, length);
+
+			_queue.push_back({_position, chunk_data});
+		}
+
+		_queued_bytes += length;
+	}
+
+	_queue_condition.notify_one();
+
+	_position += length;
+	_size = std::max(_size, _position);
+
+	return true;
+}
+
+int64_t AsyncFileOutput::Seek(int64_t offset, int whence)
+{
+	int64_t position;
+
+	switch (whence)
+	{
+		case SEEK_SET:
+			position = offset;
+			break;
+
+		case SEEK_CUR:
+			position = _position + offset;
+			break;
+
+		case SEEK_END:
+			position = _size + offset;
+			break;
+
+		default:
+			return -1;
+	}
+
+	if (position < 0)
+	{
+		return -1;
+	}
+
+	_position = position;
+
+	return _position;
+}
+
+int64_t AsyncFileOutput::GetSize() const
+{
+	return _size;
+}
+
+bool AsyncFileOutput::IsQueueFull()
+{
+	std::lock_guard lock_guard(_queue_mutex);
+
+	return _queued_bytes >= _max_queue_size;
+}
+
+bool AsyncFileOutput::WaitForQueue(int64_t timeout_ms)
+{
+	std::unique_lock lock(_queue_mutex);
+
+	return _space_condition.wait_for(lock, std::chrono::milliseconds(timeout_ms), [this]() {
+		return (_queued_bytes < _max_queue_size) || _stop_requested;
+	});
+}
+
+bool AsyncFileOutput::Close()
+{
+	if (_fd < 0)
+	{
+		return true;
+	}
+
+	{
+		std::lock_guard lock_guard(_queue_mutex);
+		_stop_requested = true;
+	}
+
+	_queue_condition.notify_all();
+	_space_condition.notify_all();
+
+	if (_io_thread.joinable())
+	{
+		_io_thread.join();
+	}
+
+	// Releases the blocks allocated beyond the end of the file
+	if ((_preallocated_offset > _size) && (::ftruncate(_fd, _size) != 0))
+	{
+		logtw("Could not truncate file: %s (%s)", _path.CStr(), ov::Error::CreateErrorFromErrno()->What());
+	}
+
+	::close(_fd);
+	_fd = -1;
+
+	logtd("File has been closed: %s (size: %" PRId64 ", write latency avg: %" PRId64 "us, max: %" PRId64 "us)",
+		  _path.CStr(), _size, GetAverageWriteLatencyUs(), GetMaxWriteLatencyUs());
+
+	return _is_writable;
+}
+
+bool AsyncFileOutput::IsWritable() const
+{
+	return _is_writable;
+}
+
+size_t AsyncFileOutput::GetQueuedBytes()
+{
+	std::lock_guard lock_guard(_queue_mutex);
+
+	return _queued_bytes;
+}
+
+int64_t AsyncFileOutput::GetAverageWriteLatencyUs() const
+{
+	return _average_write_latency_us;
+}
+
+int64_t AsyncFileOutput::GetMaxWriteLatencyUs() const
+{
+	return _max_write_latency_us;
+}
+
+void AsyncFileOutput::IoThread()
+{
+	ov::ThreadRegistry::Registration registration("FileWriterIO");
+
+	while (true)
+	{
+		Chunk chunk;
+
+		{
+			std::unique_lock lock(_queue_mutex);
+
+			_queue_condition.wait(lock, [this]() {
+				return (_queue.empty() == false) || _stop_requested;
+			});
+
+			if (_queue.empty())
+			{
+				// Stop is requested and all data is written
+				break;
+			}
+
+			chunk = std::move(_queue.front());
+			_queue.pop_front();
+		}
+
+		if (_is_writable)
+		{
+			if (WriteChunk(chunk) == false)
+			{
+				_is_writable = false;
+			}
+		}
+
+		{
+			std::lock_guard lock_guard(_queue_mutex);
+			_queued_bytes -= chunk.data->GetLength();
+		}
+
+		_space_condition.notify_all();
+	}
+}
+
+void AsyncFileOutput::Preallocate(int64_t end_offset)
+{
+	if ((_preallocation_size == 0) || (end_offset <= _preallocated_offset))
+	{
+		return;
+	}
+
+	auto length = (end_offset - _preallocated_offset) + static_cast<int64_t>(_preallocation_size);
+
+	// The file size is not changed, so the file can be read while recording
+	if (::fallocate(_fd, FALLOC_FL_KEEP_SIZE, _preallocated_offset, length) != 0)
+	{
+		// The file system doesn't support fallocate()
+		logtd("Could not preallocate file: %s (%s)", _path.CStr(), ov::Error::CreateErrorFromErrno()->What());
+		_preallocation_size = 0;
+		return;
+	}
+
+	_preallocated_offset += length;
+}
+
+bool AsyncFileOutput::WriteChunk(const Chunk &chunk)
+{
+	auto data = chunk.data->GetDataAs<uint8_t>();
+	auto remained = chunk.data->GetLength();
+	auto offset = chunk.offset;
+
+	Preallocate(offset + remained);
+
+	ov::StopWatch watch;
+	watch.Start();
+
+	while (remained > 0)
+	{
+		auto written = ::pwrite(_fd, data, remained, offset);
+
+		if (written < 0)
+		{
+			if (errno == EINTR)
+			{
+				continue;
+			}
+
+			logte("Could not write to file: %s (%s)", _path.CStr(), ov::Error::CreateErrorFromErrno()->What());
+			return false;
+		}
+
+		data += written;
+		remained -= written;
+		offset += written;
+	}
+
+	// Starts the write-back now instead of accumulating the dirty pages, which are flushed in a burst later
+	::sync_file_range(_fd, chunk.offset, chunk.data->GetLength(), SYNC_FILE_RANGE_WRITE);
+
+	auto latency_us = watch.Elapsed(true) / 1000;
+
+	_average_write_latency_us = (_average_write_latency_us == 0) ? latency_us : (_average_write_latency_us * (ASYNC_FILE_OUTPUT_LATENCY_WEIGHT - 1) + latency_us) / ASYNC_FILE_OUTPUT_LATENCY_WEIGHT;
+	_max_write_latency_us = std::max(_max_write_latency_us.load(), latency_us);
+
+	return true;
+}
@@ -0,0 +1,82 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/ovlibrary/ovlibrary.h>
+
+#include <condition_variable>
+#include <deque>
+#include <thread>
+
+// Writes a file in a dedicated thread so that the caller (e.g. the muxer running on a publisher worker) is not blocked by the disk.
+// The data is queued with its offset, so the muxers that seek back to update the header (e.g. mp4) work as well.
+class AsyncFileOutput
+{
+public:
+	static std::shared_ptr<AsyncFileOutput> Create(const ov::String &path, size_t max_queue_size, size_t preallocation_size);
+
+	AsyncFileOutput(const ov::String &path, size_t max_queue_size, size_t preallocation_size);
+	~AsyncFileOutput();
+
+	// Copies <data> into the queue at the current position (never blocks)
+	bool Write(const void *data, size_t length);
+	// Moves the current position like lseek(), returns the new position or -1
+	int64_t Seek(int64_t offset, int whence);
+	int64_t GetSize() const;
+
+	bool IsQueueFull();
+	// Waits until the queue has room, returns false if it is still full after <timeout_ms>
+	bool WaitForQueue(int64_t timeout_ms);
+
+	// Waits until all queued data is written and closes the file
+	bool Close();
+
+	// false if a write has failed (the data after the failure is discarded)
+	bool IsWritable() const;
+
+	size_t GetQueuedBytes();
+	int64_t GetAverageWriteLatencyUs() const;
+	int64_t GetMaxWriteLatencyUs() const;
+
+private:
+	struct Chunk
+	{
+		int64_t offset;
+		std::shared_ptr<ov::Data> data;
+	};
+
+	bool Open();
+	void IoThread();
+	void Preallocate(int64_t end_offset);
+	bool WriteChunk(const Chunk &chunk);
+
+	ov::String _path;
+	int _fd = -1;
+
+	size_t _max_queue_size;
+	size_t _preallocation_size;
+	// The end of the range allocated by fallocate()
+	int64_t _preallocated_offset = 0;
+
+	// Only accessed by the caller thread
+	int64_t _position = 0;
+	int64_t _size = 0;
+
+	std::mutex _queue_mutex;
+	std::condition_variable _queue_condition;
+	std::condition_variable _space_condition;
+	std::deque<Chunk> _queue;
+	size_t _queued_bytes = 0;
+	bool _stop_requested = false;
+
+	std::thread _io_thread;
+
+	std::atomic<bool> _is_writable{true};
+	std::atomic<int64_t> _average_write_latency_us{0};
+	std::atomic<int64_t> _max_write_latency_us{0};
+};
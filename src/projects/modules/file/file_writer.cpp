@@ -1,9 +1,13 @@
 #include "file_writer.h"
 
+#include <config/config_manager.h>
 #include <modules/bitstream/h264/h264_converter.h>
 
 #include "private.h"
 
+// Size of the buffer of the muxer when the file is written by AsyncFileOutput
+#define FILE_WRITER_AVIO_BUFFER_SIZE (256 * 1024)
+
 /* 
 	[Test Code]
 
@@ -34,12 +38,7 @@
 
 	while(1)
 	{
-		_writer->PutData(
-			media_packet->GetTrackId(), 
-			media_packet->GetPts(),
-			media_packet->GetDts(), 
-			media_packet->GetFlag(), 
-			media_packet->GetData());
+		_writer->PutData(media_packet);
 	}
 
 	_writer->Stop();
@@ -126,6 +125,11 @@ ov::String FileWriter::GetPath()
 	return _path;
 }
 
+void FileWriter::SetFragmentedMp4(bool fragmented_mp4)
+{
+	_fragmented_mp4 = fragmented_mp4;
+}
+
 bool FileWriter::Start()
 {
 	std::lock_guard<std::shared_mutex> mlock(_lock);
@@ -135,7 +139,36 @@ bool FileWriter::Start()
 	_start_time = -1LL;
 	_need_to_flush = false;
 	_need_to_close = false;
-	if (!(_format_context->oformat->flags & AVFMT_NOFILE))
+	_wait_for_key_frame = false;
+	_dropped_packet_count = 0;
+
+	if (_fragmented_mp4)
+	{
+		auto native_writer = FMP4FileWriter::Create(_path, _timestamp_recalc_mode == TIMESTAMP_STARTZERO_MODE);
+		bool is_supported = true;
+
+		for (auto &[track_id, track] : _tracks)
+		{
+			if ((track->GetMediaTrack() == nullptr) || (native_writer->AddTrack(track->GetMediaTrack()) == false))
+			{
+				is_supported = false;
+				break;
+			}
+		}
+
+		if (is_supported)
+		{
+			_native_writer = native_writer;
+			return StartNativeWriter();
+		}
+
+		// Releases the storages that refer to the writer
+		native_writer->Stop();
+
+		logtw("Some tracks are not supported by the fragmented MP4 writer, the file is written by FFmpeg. path(%s)", _path.CStr());
+	}
+
+	if ((!(_format_context->oformat->flags & AVFMT_NOFILE)) && (OpenAsyncOutput() == false))
 	{
 		int error = avio_open2(&_format_context->pb, _format_context->url, AVIO_FLAG_READ_WRITE, nullptr, &options);
 		if (error < 0)
@@ -178,12 +211,25 @@ bool FileWriter::Stop()
 	if (_format_context != nullptr)
 	{
 		ov::String path = _format_context->url;
-		if (_need_to_flush)
+		if (_native_writer != nullptr)
+		{
+			if (_native_writer->Stop() == false)
+			{
+				logte("Could not write the remaining samples. path(%s)", path.CStr());
+			}
+
+			_native_writer = nullptr;
+		}
+		else if (_need_to_flush)
 		{
 			av_write_trailer(_format_context);
 		}
 
-		if(_need_to_close)
+		if (_async_output != nullptr)
+		{
+			CloseAsyncOutput();
+		}
+		else if(_need_to_close)
 		{
 			avformat_close_input(&_format_context);
 		}
@@ -238,6 +284,7 @@ bool FileWriter::AddTrack(cmn::MediaType media_type, int32_t track_id, std::shar
 
 			_track_to_avstream[track_id] = stream->index;
 			_tracks[track_id] = track;
+			_has_video_track = true;
 		}
 		break;
 
@@ -287,8 +334,15 @@ bool FileWriter::AddTrack(cmn::MediaType media_type, int32_t track_id, std::shar
 //	- H264 : AnnexB bitstream
 // 	- AAC : ASC(Audio Specific Config) bitstream
 
-bool FileWriter::PutData(int32_t track_id, int64_t pts, int64_t dts, MediaPacketFlag flag, cmn::BitstreamFormat format, std::shared_ptr<ov::Data> &data)
+bool FileWriter::PutData(const std::shared_ptr<const MediaPacket> &packet)
 {
+	auto track_id = packet->GetTrackId();
+	auto pts = packet->GetPts();
+	auto dts = packet->GetDts();
+	auto flag = packet->GetFlag();
+	auto format = packet->GetBitstreamFormat();
+	auto data = packet->GetData();
+
 	std::lock_guard<std::shared_mutex> mlock(_lock);
 
 	if (_format_context == nullptr)
@@ -310,6 +364,17 @@ bool FileWriter::PutData(int32_t track_id, int64_t pts, int64_t dts, MediaPacket
 		return false;
 	}
 	
+	if (CheckBackpressure(packet) == false)
+	{
+		// Dropping is not an error of the recording
+		return true;
+	}
+
+	if (_native_writer != nullptr)
+	{
+		return _native_writer->PutData(packet);
+	}
+
 	// Find TrackInfo
 	auto track = _tracks[track_id];
 
@@ -363,7 +428,7 @@ bool FileWriter::PutData(int32_t track_id, int64_t pts, int64_t dts, MediaPacket
 		switch (format)
 		{
 			case cmn::BitstreamFormat::H264_ANNEXB:
-				cdata = H264Converter::ConvertAnnexbToAvcc(data);
+				cdata = H264Converter::ConvertAnnexbToAvcc(packet);
 				av_packet.size = cdata->GetLength();
 				av_packet.data = (uint8_t *)cdata->GetDataAs<uint8_t>();
 				break;
@@ -436,6 +501,185 @@ bool FileWriter::IsWritable()
 	return true;
 }
 
+uint64_t FileWriter::GetDroppedPacketCount() const
+{
+	return _dropped_packet_count;
+}
+
+int64_t FileWriter::GetAverageWriteLatencyUs() const
+{
+	auto async_output = _async_output;
+
+	return (async_output != nullptr) ? async_output->GetAverageWriteLatencyUs() : 0;
+}
+
+int64_t FileWriter::GetMaxWriteLatencyUs() const
+{
+	auto async_output = _async_output;
+
+	return (async_output != nullptr) ? async_output->GetMaxWriteLatencyUs() : 0;
+}
+
+int FileWriter::WriteToAsyncOutput(void *opaque, uint8_t *buf, int buf_size)
+{
+	auto async_output = static_cast<AsyncFileOutput *>(opaque);
+
+	if (async_output->Write(buf, buf_size) == false)
+	{
+		return AVERROR(EIO);
+	}
+
+	return buf_size;
+}
+
+int64_t FileWriter::SeekAsyncOutput(void *opaque, int64_t offset, int whence)
+{
+	auto async_output = static_cast<AsyncFileOutput *>(opaque);
+
+	if (whence & AVSEEK_SIZE)
+	{
+		return async_output->GetSize();
+	}
+
+	auto position = async_output->Seek(offset, whence & ~AVSEEK_FORCE);
+
+	return (position >= 0) ? position : AVERROR(EINVAL);
+}
+
+bool FileWriter::CreateAsyncOutput()
+{
+	auto &config = cfg::ConfigManager::GetInstance()->GetServer()->GetModules().GetAsyncFileWriter();
+
+	if (config.IsEnabled() == false)
+	{
+		return false;
+	}
+
+	auto async_output = AsyncFileOutput::Create(_path, std::max<int64_t>(config.GetMaxQueueSize(), FILE_WRITER_AVIO_BUFFER_SIZE), std::max<int64_t>(config.GetPreallocationSize(), 0));
+	if (async_output == nullptr)
+	{
+		return false;
+	}
+
+	_async_output = async_output;
+	_block_on_backpressure = (config.GetBackpressure().LowerCaseString() == "block");
+	_block_timeout_ms = config.GetBlockTimeout();
+
+	return true;
+}
+
+bool FileWriter::OpenAsyncOutput()
+{
+	if (CreateAsyncOutput() == false)
+	{
+		return false;
+	}
+
+	auto buffer = static_cast<unsigned char *>(::av_malloc(FILE_WRITER_AVIO_BUFFER_SIZE));
+	if (buffer != nullptr)
+	{
+		_format_context->pb = ::avio_alloc_context(buffer, FILE_WRITER_AVIO_BUFFER_SIZE, 1, _async_output.get(), nullptr, WriteToAsyncOutput, SeekAsyncOutput);
+
+		if (_format_context->pb != nullptr)
+		{
+			_format_context->flags |= AVFMT_FLAG_CUSTOM_IO;
+			return true;
+		}
+
+		::av_free(buffer);
+	}
+
+	// The file is opened by FFmpeg instead
+	_async_output->Close();
+	_async_output = nullptr;
+
+	return false;
+}
+
+bool FileWriter::StartNativeWriter()
+{
+	// If AsyncFileWriter is disabled, FMP4FileWriter writes the file by itself
+	CreateAsyncOutput();
+
+	if (_native_writer->Start(_async_output) == false)
+	{
+		logte("Could not start the fragmented MP4 writer. path(%s)", _path.CStr());
+		return false;
+	}
+
+	logtd("The file is written by the fragmented MP4 writer. path(%s)", _path.CStr());
+
+	return true;
+}
+
+void FileWriter::CloseAsyncOutput()
+{
+	auto pb = _format_context->pb;
+
+	if (pb != nullptr)
+	{
+		::avio_flush(pb);
+
+		OV_SAFE_FUNC(pb->buffer, nullptr, ::av_free, );
+		::avio_context_free(&pb);
+
+		_format_context->pb = nullptr;
+	}
+
+	// Waits until all queued data is written
+	if (_async_output->Close() == false)
+	{
+		logte("Some data could not be written to the file. path(%s)", _path.CStr());
+	}
+
+	logti("Recording I/O statistics. path(%s) dropped packets(%" PRIu64 ") write latency(avg: %" PRId64 "us, max: %" PRId64 "us)",
+		  _path.CStr(), _dropped_packet_count.load(), _async_output->GetAverageWriteLatencyUs(), _async_output->GetMaxWriteLatencyUs());
+
+	_async_output = nullptr;
+}
+
+bool FileWriter::CheckBackpressure(const std::shared_ptr<const MediaPacket> &packet)
+{
+	if (_async_output == nullptr)
+	{
+		return true;
+	}
+
+	if (_wait_for_key_frame)
+	{
+		// Resumes at a key frame of the video to keep the file decodable
+		if ((packet->GetMediaType() == cmn::MediaType::Video) && (packet->GetFlag() == MediaPacketFlag::Key) && (_async_output->IsQueueFull() == false))
+		{
+			logti("Recording is resumed. path(%s) dropped packets(%" PRIu64 ")", _path.CStr(), _dropped_packet_count.load());
+			_wait_for_key_frame = false;
+			return true;
+		}
+
+		_dropped_packet_count++;
+		return false;
+	}
+
+	if (_async_output->IsQueueFull() == false)
+	{
+		return true;
+	}
+
+	if (_block_on_backpressure && _async_output->WaitForQueue(_block_timeout_ms))
+	{
+		return true;
+	}
+
+	logtw("The disk could not keep up with the recording, the packets are dropped until the next key frame. path(%s) queued(%zu bytes)",
+		  _path.CStr(), _async_output->GetQueuedBytes());
+
+	_dropped_packet_count++;
+
+	// If there is no video, the next packet can be written as soon as the queue has room
+	_wait_for_key_frame = _has_video_track;
+
+	return false;
+}
+
 ov::String FileWriter::GetFormatByExtension(ov::String extension, ov::String default_format)
 {
 	if (extension == "mp4")
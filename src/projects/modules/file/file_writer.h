@@ -3,6 +3,9 @@
 #include <base/mediarouter/media_buffer.h>
 #include <base/ovlibrary/ovlibrary.h>
 
+#include "async_file_output.h"
+#include "fmp4_file_writer.h"
+
 extern "C"
 {
 #include <libavcodec/avcodec.h>
@@ -98,6 +101,16 @@ public:
 		return _extradata;
 	}
 
+	// Used by FMP4FileWriter, which makes the initialization section from the MediaTrack
+	void SetMediaTrack(const std::shared_ptr<const MediaTrack> &media_track)
+	{
+		_media_track = media_track;
+	}
+	const std::shared_ptr<const MediaTrack> &GetMediaTrack() const
+	{
+		return _media_track;
+	}
+
 private:
 	cmn::MediaCodecId _codec_id;
 	int32_t _bitrate;
@@ -111,6 +124,8 @@ private:
 	cmn::AudioChannel _channel;
 
 	std::shared_ptr<ov::Data> _extradata;
+
+	std::shared_ptr<const MediaTrack> _media_track;
 };
 
 class FileWriter
@@ -134,16 +149,24 @@ public:
 	bool SetPath(const ov::String path, const ov::String format = nullptr);
 	ov::String GetPath();
 
+	// If true, the mp4 file is written as fragmented MP4 by FMP4FileWriter when it supports all the tracks
+	void SetFragmentedMp4(bool fragmented_mp4);
+
 	bool Start();
 
 	bool Stop();
 
 	bool AddTrack(cmn::MediaType media_type, int32_t track_id, std::shared_ptr<FileTrackInfo> trackinfo);
 
-	bool PutData(int32_t track_id, int64_t pts, int64_t dts, MediaPacketFlag flag, cmn::BitstreamFormat format, std::shared_ptr<ov::Data> &data);
+	bool PutData(const std::shared_ptr<const MediaPacket> &packet);
 
 	bool IsWritable();
 
+	// Statistics of the asynchronous I/O (see AsyncFileWriter module)
+	uint64_t GetDroppedPacketCount() const;
+	int64_t GetAverageWriteLatencyUs() const;
+	int64_t GetMaxWriteLatencyUs() const;
+
 	static ov::String GetFormatByExtension(ov::String extension, ov::String default_format = "ts");
 
 	static bool IsSupportCodec(ov::String format, cmn::MediaCodecId codec_id);
@@ -165,4 +188,27 @@ private:
 	std::map<int32_t, int32_t> _track_to_avstream;
 
 	std::shared_mutex _lock;
+
+	static int WriteToAsyncOutput(void *opaque, uint8_t *buf, int buf_size);
+	static int64_t SeekAsyncOutput(void *opaque, int64_t offset, int whence);
+
+	bool CreateAsyncOutput();
+	bool OpenAsyncOutput();
+	void CloseAsyncOutput();
+	bool StartNativeWriter();
+	// Returns false if the packet must be dropped because the I/O thread can't keep up
+	bool CheckBackpressure(const std::shared_ptr<const MediaPacket> &packet);
+
+	// nullptr if the file is written by FFmpeg
+	std::shared_ptr<AsyncFileOutput> _async_output;
+	bool _block_on_backpressure = false;
+	int64_t _block_timeout_ms = 0;
+	// Packets are dropped until the next key frame after the queue was full
+	bool _wait_for_key_frame = false;
+	std::atomic<uint64_t> _dropped_packet_count{0};
+	bool _has_video_track = false;
+
+	bool _fragmented_mp4 = false;
+	// nullptr if the file is muxed by FFmpeg
+	std::shared_ptr<FMP4FileWriter> _native_writer;
 };
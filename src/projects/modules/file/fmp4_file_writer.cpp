@@ -0,0 +1,345 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "fmp4_file_writer.h"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "private.h"
+
+// A chunk (moof + mdat) is written to the file at this interval for each track
+#define FMP4_FILE_WRITER_CHUNK_DURATION_MS 1000.0
+#define FMP4_FILE_WRITER_SEGMENT_DURATION_MS 6000.0
+// The chunks are written to the file as soon as they are created, so the storage only needs to keep the current segment
+#define FMP4_FILE_WRITER_MAX_SEGMENTS 2
+
+// Calls <handler> with the type and the whole box (including the header) of each box in <data>
+static bool ForEachBox(const uint8_t *data, size_t length, const std::function<void(const ov::String &type, const uint8_t *box, size_t box_size)> &handler)
+{
+	size_t offset = 0;
+
+	while (offset + BMFF_BOX_HEADER_SIZE <= length)
+	{
+		auto box_size = static_cast<size_t>(ByteReader<uint32_t>::ReadBigEndian(data + offset));
+
+		// The initialization section written by bmff::Packager doesn't have the large size (1) and the box to the end (0)
+		if ((box_size < BMFF_BOX_HEADER_SIZE) || (offset + box_size > length))
+		{
+			return false;
+		}
+
+		handler(ov::String(reinterpret_cast<const char *>(data + offset + 4), 4), data + offset, box_size);
+
+		offset += box_size;
+	}
+
+	return offset == length;
+}
+
+bool FMP4FileWriter::IsSupportCodec(cmn::MediaCodecId codec_id)
+{
+	// Same as bmff::FMP4Packager::CreateInitializationSegment()
+	return (codec_id == cmn::MediaCodecId::H264) ||
+		   (codec_id == cmn::MediaCodecId::Av1) ||
+		   (codec_id == cmn::MediaCodecId::Aac);
+}
+
+std::shared_ptr<FMP4FileWriter> FMP4FileWriter::Create(const ov::String &path, bool start_at_zero)
+{
+	return std::make_shared<FMP4FileWriter>(path, start_at_zero);
+}
+
+FMP4FileWriter::FMP4FileWriter(const ov::String &path, bool start_at_zero)
+	: _path(path),
+	  _start_at_zero(start_at_zero)
+{
+}
+
+FMP4FileWriter::~FMP4FileWriter()
+{
+	if (_fd >= 0)
+	{
+		::close(_fd);
+	}
+}
+
+bool FMP4FileWriter::AddTrack(const std::shared_ptr<const MediaTrack> &track)
+{
+	if (IsSupportCodec(track->GetCodecId()) == false)
+	{
+		logtw("fMP4 file writer does not support the codec. codec(%s)", StringFromMediaCodecId(track->GetCodecId()).CStr());
+		return false;
+	}
+
+	bmff::FMP4Storage::Config storage_config;
+	storage_config.max_segments = FMP4_FILE_WRITER_MAX_SEGMENTS;
+	storage_config.segment_duration_ms = FMP4_FILE_WRITER_SEGMENT_DURATION_MS;
+
+	bmff::FMP4Packager::Config packager_config;
+	packager_config.chunk_duration_ms = FMP4_FILE_WRITER_CHUNK_DURATION_MS;
+	packager_config.segment_duration_ms = FMP4_FILE_WRITER_SEGMENT_DURATION_MS;
+
+	Track file_track;
+	file_track.media_track = track;
+	file_track.storage = std::make_shared<bmff::FMP4Storage>(GetSharedPtr(), track, storage_config, _path);
+	file_track.packager = std::make_shared<bmff::FMP4Packager>(file_track.storage, track, nullptr, packager_config);
+
+	if (file_track.packager->CreateInitializationSegment() == false)
+	{
+		logte("Could not create the initialization section. track(%d)", track->GetId());
+		return false;
+	}
+
+	_tracks[track->GetId()] = file_track;
+
+	return true;
+}
+
+std::shared_ptr<ov::Data> FMP4FileWriter::MakeInitializationSection()
+{
+	// Each packager makes ftyp + moov(mvhd + trak + mvex(trex)) for a track, and they are merged into a moov
+	std::shared_ptr<const ov::Data> ftyp;
+	std::shared_ptr<ov::Data> mvhd;
+	ov::ByteStream traks(4096);
+	ov::ByteStream trexs(256);
+	uint32_t max_track_id = 0;
+
+	for (auto &[track_id, track] : _tracks)
+	{
+		auto section = track.storage->GetInitializationSection();
+		if (section == nullptr)
+		{
+			return nullptr;
+		}
+
+		bool result = ForEachBox(section->GetDataAs<uint8_t>(), section->GetLength(), [&](const ov::String &type, const uint8_t *box, size_t box_size) {
+			if (type == "ftyp")
+			{
+				if (ftyp == nullptr)
+				{
+					ftyp = std::make_shared<ov::Data>(box, box_size);
+				}
+			}
+			else if (type == "moov")
+			{
+				ForEachBox(box + BMFF_BOX_HEADER_SIZE, box_size - BMFF_BOX_HEADER_SIZE, [&](const ov::String &type, const uint8_t *box, size_t box_size) {
+					if (type == "mvhd")
+					{
+						if (mvhd == nullptr)
+						{
+							mvhd = std::make_shared<ov::Data>(box, box_size);
+						}
+					}
+					else if (type == "trak")
+					{
+						traks.Write(box, box_size);
+					}
+					else if (type == "mvex")
+					{
+						ForEachBox(box + BMFF_BOX_HEADER_SIZE, box_size - BMFF_BOX_HEADER_SIZE, [&](const ov::String &type, const uint8_t *box, size_t box_size) {
+							if (type == "trex")
+							{
+								trexs.Write(box, box_size);
+							}
+						});
+					}
+				});
+			}
+		});
+
+		if (result == false)
+		{
+			logte("Invalid initialization section. track(%d)", track_id);
+			return nullptr;
+		}
+
+		// track_ID of bmff::Packager
+		max_track_id = std::max(max_track_id, static_cast<uint32_t>(track_id + 1));
+	}
+
+	if ((ftyp == nullptr) || (mvhd == nullptr) || (mvhd->GetLength() < BMFF_FULL_BOX_HEADER_SIZE + 4))
+	{
+		logte("Could not find ftyp/mvhd in the initialization section");
+		return nullptr;
+	}
+
+	// next_track_ID is the last field of mvhd
+	auto next_track_id = ov::HostToBE32(max_track_id + 1);
+	::memcpy(mvhd->GetWritableDataAs<uint8_t>() + mvhd->GetLength() - 4, &next_track_id, 4);
+
+	auto mvex_size = BMFF_BOX_HEADER_SIZE + trexs.GetLength();
+	auto moov_size = BMFF_BOX_HEADER_SIZE + mvhd->GetLength() + traks.GetLength() + mvex_size;
+
+	ov::ByteStream stream(ftyp->GetLength() + moov_size);
+
+	stream.Write(ftyp);
+
+	stream.WriteBE32(moov_size);
+	stream.Write("moov", 4);
+	stream.Write(mvhd);
+	stream.Write(traks.GetDataPointer());
+
+	stream.WriteBE32(mvex_size);
+	stream.Write("mvex", 4);
+	stream.Write(trexs.GetDataPointer());
+
+	return stream.GetDataPointer();
+}
+
+bool FMP4FileWriter::Start(const std::shared_ptr<AsyncFileOutput> &async_output)
+{
+	if (_tracks.empty())
+	{
+		logte("There is no track to record. path(%s)", _path.CStr());
+		return false;
+	}
+
+	auto section = MakeInitializationSection();
+	if (section == nullptr)
+	{
+		return false;
+	}
+
+	_async_output = async_output;
+
+	if (_async_output == nullptr)
+	{
+		_fd = ::open(_path.CStr(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+
+		if (_fd < 0)
+		{
+			logte("Could not open file: %s (%s)", _path.CStr(), ov::Error::CreateErrorFromErrno()->What());
+			return false;
+		}
+	}
+
+	return Write(section);
+}
+
+bool FMP4FileWriter::PutData(const std::shared_ptr<const MediaPacket> &packet)
+{
+	auto track_item = _tracks.find(packet->GetTrackId());
+	if (track_item == _tracks.end())
+	{
+		// If track_id is not on the recording target list, drop it without errors.
+		return true;
+	}
+
+	auto &track = track_item->second;
+	auto timescale = track.media_track->GetTimeBase().GetTimescale();
+	auto sample = packet;
+
+	if (_start_at_zero)
+	{
+		if (_start_time_us == -1)
+		{
+			_start_time_us = std::llround(packet->GetDts() * 1000000.0 / timescale);
+		}
+
+		auto start_time = std::llround(_start_time_us * timescale / 1000000.0);
+
+		// The samples before the first packet (e.g. audio slightly earlier than the key frame) can't be in the fragments
+		if (packet->GetDts() < start_time)
+		{
+			return true;
+		}
+
+		auto rebased_packet = packet->ClonePacket(false);
+		rebased_packet->SetPts(packet->GetPts() - start_time);
+		rebased_packet->SetDts(packet->GetDts() - start_time);
+
+		sample = rebased_packet;
+	}
+
+	if (track.packager->AppendSample(sample) == false)
+	{
+		return false;
+	}
+
+	return _is_writable;
+}
+
+bool FMP4FileWriter::Stop()
+{
+	for (auto &[track_id, track] : _tracks)
+	{
+		track.packager->Flush();
+	}
+
+	// The storages refer to this observer
+	_tracks.clear();
+
+	_async_output = nullptr;
+
+	if (_fd >= 0)
+	{
+		::close(_fd);
+		_fd = -1;
+	}
+
+	return _is_writable;
+}
+
+void FMP4FileWriter::OnMediaChunkUpdated(const int32_t &track_id, const uint32_t &segment_number, const uint32_t &chunk_number)
+{
+	auto track_item = _tracks.find(track_id);
+	if (track_item == _tracks.end())
+	{
+		return;
+	}
+
+	auto chunk = track_item->second.storage->GetMediaChunk(segment_number, chunk_number);
+	if (chunk == nullptr)
+	{
+		logte("Could not find the chunk. track(%d) segment(%u) chunk(%u)", track_id, segment_number, chunk_number);
+		_is_writable = false;
+		return;
+	}
+
+	if (Write(chunk->GetData()) == false)
+	{
+		_is_writable = false;
+	}
+}
+
+bool FMP4FileWriter::Write(const std::shared_ptr<const ov::Data> &data)
+{
+	if (_async_output != nullptr)
+	{
+		return _async_output->Write(data->GetData(), data->GetLength());
+	}
+
+	if (_fd < 0)
+	{
+		return false;
+	}
+
+	auto buffer = data->GetDataAs<uint8_t>();
+	auto remained = data->GetLength();
+
+	while (remained > 0)
+	{
+		auto written = ::write(_fd, buffer, remained);
+
+		if (written < 0)
+		{
+			if (errno == EINTR)
+			{
+				continue;
+			}
+
+			logte("Could not write to file: %s (%s)", _path.CStr(), ov::Error::CreateErrorFromErrno()->What());
+			return false;
+		}
+
+		buffer += written;
+		remained -= written;
+	}
+
+	return true;
+}
@@ -0,0 +1,67 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/info/media_track.h>
+#include <base/mediarouter/media_buffer.h>
+#include <modules/containers/bmff/fmp4_packager/fmp4_packager.h>
+
+#include "async_file_output.h"
+
+// Writes a fragmented MP4 file from the MediaPackets with bmff::FMP4Packager, without AVPacket conversion and libavformat.
+//
+// [File layout]
+// ftyp + moov (trak of all tracks, mvex) + (moof + mdat) of each track in the order they are completed
+class FMP4FileWriter : public bmff::FMp4StorageObserver
+{
+public:
+	static bool IsSupportCodec(cmn::MediaCodecId codec_id);
+
+	static std::shared_ptr<FMP4FileWriter> Create(const ov::String &path, bool start_at_zero);
+
+	FMP4FileWriter(const ov::String &path, bool start_at_zero);
+	~FMP4FileWriter() override;
+
+	bool AddTrack(const std::shared_ptr<const MediaTrack> &track);
+
+	// Writes the initialization section of all tracks.
+	// If <async_output> is nullptr, the file is opened and written by the caller thread.
+	bool Start(const std::shared_ptr<AsyncFileOutput> &async_output);
+	bool PutData(const std::shared_ptr<const MediaPacket> &packet);
+	// Writes the samples remaining in the packagers
+	bool Stop();
+
+	// FMp4StorageObserver
+	void OnFMp4StorageInitialized(const int32_t &track_id) override {}
+	void OnMediaSegmentUpdated(const int32_t &track_id, const uint32_t &segment_number) override {}
+	void OnMediaChunkUpdated(const int32_t &track_id, const uint32_t &segment_number, const uint32_t &chunk_number) override;
+	void OnMediaSegmentDeleted(const int32_t &track_id, const uint32_t &segment_number) override {}
+
+private:
+	struct Track
+	{
+		std::shared_ptr<const MediaTrack> media_track;
+		std::shared_ptr<bmff::FMP4Storage> storage;
+		std::shared_ptr<bmff::FMP4Packager> packager;
+	};
+
+	std::shared_ptr<ov::Data> MakeInitializationSection();
+	bool Write(const std::shared_ptr<const ov::Data> &data);
+
+	ov::String _path;
+	bool _start_at_zero;
+	// The timestamp of the first packet (microseconds)
+	int64_t _start_time_us = -1;
+
+	// MediaTrack.id, Track
+	std::map<int32_t, Track> _tracks;
+
+	std::shared_ptr<AsyncFileOutput> _async_output;
+	int _fd = -1;
+	bool _is_writable = true;
+};
@@ -14,11 +14,91 @@
 #define HTTP_CLIENT_MAX_CHUNK_HEADER_LENGTH (32)
 #define HTTP_CLIENT_NEW_LINE "\r\n"
 #define HTTP_CLIENT_NEW_LINE_LENGTH (OV_COUNTOF(HTTP_CLIENT_NEW_LINE) - 1)
+// An idle connection is closed after this time (shorter than the keep-alive timeout of most servers)
+#define HTTP_CLIENT_IDLE_CONNECTION_TIMEOUT_MS (4 * 1000)
+#define HTTP_CLIENT_MAX_IDLE_CONNECTIONS_PER_SERVER 64
+// The resolved addresses are reused for this time
+#define HTTP_CLIENT_RESOLVED_ADDRESS_TTL_MS (60 * 1000)
+#define HTTP_CLIENT_MAX_RESOLVED_ADDRESSES 1024
+#define HTTP_CLIENT_MAX_TLS_SESSIONS 1024
 
 namespace http
 {
 	namespace clnt
 	{
+		struct IdleConnection
+		{
+			std::shared_ptr<ov::Socket> socket;
+			std::shared_ptr<ov::TlsClientData> tls_data;
+			uint64_t idle_since_msec;
+		};
+
+		// connection key : idle connections (the most recently used one is at the back)
+		static std::mutex g_idle_connections_mutex;
+		static std::unordered_map<ov::String, std::deque<IdleConnection>> g_idle_connections;
+
+		struct ResolvedAddress
+		{
+			ov::SocketAddress address;
+			uint64_t expire_msec;
+		};
+
+		// "<host>:<port>" : address
+		static std::mutex g_resolved_addresses_mutex;
+		static std::unordered_map<ov::String, ResolvedAddress> g_resolved_addresses;
+
+		// "<host>:<port>" : the last session to resume
+		static std::mutex g_tls_sessions_mutex;
+		static std::unordered_map<ov::String, std::shared_ptr<SSL_SESSION>> g_tls_sessions;
+
+		static ov::SocketAddress ResolveAddress(const ov::String &host_port_string)
+		{
+			auto now = ov::Clock::NowMSec();
+
+			{
+				std::lock_guard lock_guard(g_resolved_addresses_mutex);
+
+				auto item = g_resolved_addresses.find(host_port_string);
+				if ((item != g_resolved_addresses.end()) && (item->second.expire_msec > now))
+				{
+					return item->second.address;
+				}
+			}
+
+			// Resolve the address without the lock, it may take a while
+			auto address = ov::SocketAddress::CreateAndGetFirst(host_port_string);
+
+			if (address.IsValid())
+			{
+				std::lock_guard lock_guard(g_resolved_addresses_mutex);
+
+				if (g_resolved_addresses.size() >= HTTP_CLIENT_MAX_RESOLVED_ADDRESSES)
+				{
+					g_resolved_addresses.clear();
+				}
+
+				g_resolved_addresses[host_port_string] = {address, now + HTTP_CLIENT_RESOLVED_ADDRESS_TTL_MS};
+			}
+
+			return address;
+		}
+
+		// All HttpClients share a client context
+		static std::shared_ptr<ov::TlsContext> GetClientTlsContext(std::shared_ptr<const ov::Error> *error)
+		{
+			static std::mutex mutex;
+			static std::shared_ptr<ov::TlsContext> context;
+
+			std::lock_guard lock_guard(mutex);
+
+			if (context == nullptr)
+			{
+				context = ov::TlsContext::CreateClientContext(error);
+			}
+
+			return context;
+		}
+
 		HttpClient::HttpClient()
 			: _socket_pool(ov::SocketPool::GetTcpPool())
 		{
@@ -66,6 +146,16 @@ namespace http
 			return _recv_timeout_msec;
 		}
 
+		void HttpClient::SetKeepAlive(bool keep_alive)
+		{
+			_keep_alive = keep_alive;
+		}
+
+		bool HttpClient::IsKeepAlive() const
+		{
+			return _keep_alive;
+		}
+
 		void HttpClient::SetMethod(http::Method method)
 		{
 			_method = method;
@@ -247,7 +337,25 @@ namespace http
 			}
 
 			auto host_port_string = ov::String::FormatString("%s:%d", parsed_url->Host().CStr(), port);
-			auto socket_address = ov::SocketAddress::CreateAndGetFirst(host_port_string);
+
+			_url = url;
+			_parsed_url = parsed_url;
+
+			_request_header["Host"] = host_port_string;
+
+			if (_keep_alive && (_blocking_mode == ov::BlockingMode::Blocking))
+			{
+				_connection_key = ov::String::FormatString("%s://%s", scheme.CStr(), host_port_string.CStr());
+				_request_header["Connection"] = "keep-alive";
+
+				if ((_skip_idle_connections == false) && TakeIdleConnection())
+				{
+					// The address is not needed because the connection is already established
+					return nullptr;
+				}
+			}
+
+			auto socket_address = ResolveAddress(host_port_string);
 
 			if (socket_address.IsValid() == false)
 			{
@@ -269,14 +377,34 @@ namespace http
 			if (is_https)
 			{
 				std::shared_ptr<const ov::Error> error;
-				_tls_data = std::make_shared<ov::TlsClientData>(ov::TlsContext::CreateClientContext(&error), (_blocking_mode == ov::BlockingMode::NonBlocking));
+				auto tls_context = GetClientTlsContext(&error);
 
-				if (_tls_data == nullptr)
+				if (tls_context == nullptr)
 				{
-					return error;
+					return (error != nullptr) ? error : ov::Error::CreateError("HTTP", "Could not create TLS context");
 				}
 
+				_tls_data = std::make_shared<ov::TlsClientData>(tls_context, (_blocking_mode == ov::BlockingMode::NonBlocking));
 				_tls_data->SetIoCallback(GetSharedPtrAs<ov::TlsClientDataIoCallback>());
+
+				// Resume the last session to the server to skip the full handshake
+				_tls_session_key = host_port_string;
+
+				std::shared_ptr<SSL_SESSION> session;
+				{
+					std::lock_guard lock_guard(g_tls_sessions_mutex);
+
+					auto item = g_tls_sessions.find(_tls_session_key);
+					if (item != g_tls_sessions.end())
+					{
+						session = item->second;
+					}
+				}
+
+				if (session != nullptr)
+				{
+					_tls_data->SetSession(session);
+				}
 			}
 
 			if (address != nullptr)
@@ -284,13 +412,125 @@ namespace http
 				*address = socket_address;
 			}
 
-			_url = url;
-			_parsed_url = parsed_url;
+			return nullptr;
+		}
 
-			_request_header["Host"] = ov::String::FormatString(
-				"%s:%d", _parsed_url->Host().CStr(), _parsed_url->Port());
+		bool HttpClient::TakeIdleConnection()
+		{
+			auto now = ov::Clock::NowMSec();
 
-			return nullptr;
+			std::lock_guard lock_guard(g_idle_connections_mutex);
+
+			auto item = g_idle_connections.find(_connection_key);
+			if (item == g_idle_connections.end())
+			{
+				return false;
+			}
+
+			auto &connections = item->second;
+
+			while (connections.empty() == false)
+			{
+				auto connection = std::move(connections.back());
+				connections.pop_back();
+
+				if ((now - connection.idle_since_msec) < HTTP_CLIENT_IDLE_CONNECTION_TIMEOUT_MS)
+				{
+					// If the server closed the connection (or sent something unexpected), there is data to read
+					char buffer;
+					auto result = ::recv(connection.socket->GetNativeHandle(), &buffer, 1, MSG_PEEK | MSG_DONTWAIT);
+
+					if ((result < 0) && ((errno == EAGAIN) || (errno == EWOULDBLOCK)))
+					{
+						_socket = std::move(connection.socket);
+						_tls_data = std::move(connection.tls_data);
+
+						if (_tls_data != nullptr)
+						{
+							_tls_data->SetIoCallback(GetSharedPtrAs<ov::TlsClientDataIoCallback>());
+						}
+
+						_is_reused_connection = true;
+
+						break;
+					}
+				}
+
+				connection.socket->Close();
+			}
+
+			if (connections.empty())
+			{
+				g_idle_connections.erase(item);
+			}
+
+			return _is_reused_connection;
+		}
+
+		bool HttpClient::IsConnectionReusable() const
+		{
+			if ((_connection_key.IsEmpty()) || (_socket == nullptr) || (_socket->GetState() != ov::SocketState::Connected))
+			{
+				return false;
+			}
+
+			// The end of the response must be known without closing the connection
+			if ((_parser.HasContentLength() == false) && (_chunk_parse_status != ChunkParseStatus::Completed))
+			{
+				return false;
+			}
+
+			return (_parser.GetHeader("CONNECTION").LowerCaseString() != "close");
+		}
+
+		void HttpClient::ReleaseConnection()
+		{
+			IdleConnection connection{_socket, _tls_data, ov::Clock::NowMSec()};
+
+			if (_tls_data != nullptr)
+			{
+				_tls_data->SetIoCallback(nullptr);
+			}
+
+			_socket = nullptr;
+			_tls_data = nullptr;
+
+			std::lock_guard lock_guard(g_idle_connections_mutex);
+
+			auto &connections = g_idle_connections[_connection_key];
+
+			if (connections.size() >= HTTP_CLIENT_MAX_IDLE_CONNECTIONS_PER_SERVER)
+			{
+				// Close the oldest one
+				connections.front().socket->Close();
+				connections.pop_front();
+			}
+
+			connections.push_back(std::move(connection));
+		}
+
+		void HttpClient::StoreTlsSession()
+		{
+			if ((_tls_data == nullptr) || _tls_session_key.IsEmpty())
+			{
+				return;
+			}
+
+			auto session = _tls_data->GetSession();
+
+			if (session == nullptr)
+			{
+				return;
+			}
+
+			std::lock_guard lock_guard(g_tls_sessions_mutex);
+
+			if ((g_tls_sessions.size() >= HTTP_CLIENT_MAX_TLS_SESSIONS) && (g_tls_sessions.find(_tls_session_key) == g_tls_sessions.end()))
+			{
+				g_tls_sessions.clear();
+			}
+
+			g_tls_sessions[_tls_session_key] = session;
 		}
 
 		void HttpClient::SendRequestIfNeeded()
@@ -365,6 +605,36 @@ namespace http
 
 			auto error = PrepareForRequest(url, &address);
 
+			if ((error == nullptr) && _is_reused_connection)
+			{
+				logtd("Request an URL: %s (reuse the connection to %s)...", url.CStr(), _connection_key.CStr());
+
+				OnConnected(nullptr);
+
+				if (_is_stale_connection == false)
+				{
+					return;
+				}
+
+				// The server has closed the idle connection before receiving the request, so request again with a new connection
+				logtd("The connection to %s was closed by the server, reconnecting...", _connection_key.CStr());
+
+				OV_SAFE_RESET(
+					_tls_data, nullptr, {
+						_tls_data->SetIoCallback(nullptr);
+						_tls_data = nullptr;
+					},
+					_tls_data);
+				OV_SAFE_RESET(_socket, nullptr, _socket->Close(), _socket);
+
+				_requested = false;
+				_is_reused_connection = false;
+				_is_stale_connection = false;
+				_skip_idle_connections = true;
+
+				error = PrepareForRequest(url, &address);
+			}
+
 			if (error == nullptr)
 			{
 				OV_ASSERT2(_url.IsEmpty() == false);
@@ -492,13 +762,32 @@ namespace http
 				}
 			}
 
+			if (_is_reused_connection && (_is_response_received == false) && ((error != nullptr) || need_to_callback))
+			{
+				// Request() will retry with a new connection
+				_is_stale_connection = true;
+				return;
+			}
+
+			if ((tls_data != nullptr) && (error == nullptr))
+			{
+				// The session ticket of TLS 1.3 is sent after the handshake, so the session is saved after the response
+				StoreTlsSession();
+			}
+
 			auto response_handler = _response_handler;
+			bool is_reusable = (error == nullptr) && (need_to_callback == false) && IsConnectionReusable();
 
 			if (response_handler != nullptr)
 			{
 				response_handler(_parser.GetStatusCode(), _response_body, error);
 			}
 
+			if (is_reusable)
+			{
+				ReleaseConnection();
+			}
+
 			CleanupVariables();
 		}
 
@@ -644,6 +933,12 @@ namespace http
 		std::shared_ptr<const ov::Error> HttpClient::ProcessData(const std::shared_ptr<const ov::Data> &data)
 		{
 			auto remained = data->GetLength();
+
+			if (remained > 0)
+			{
+				_is_response_received = true;
+			}
+
 			auto sub_data = data;
 
 			while (remained > 0)
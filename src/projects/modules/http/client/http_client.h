@@ -47,6 +47,11 @@ namespace http
 
 			void SetTimeout(int timeout_msec);
 
+			// Keeps the connection after the response to reuse it for the next request to the same server.
+			// Only the connections of the blocking mode are reused.
+			void SetKeepAlive(bool keep_alive);
+			bool IsKeepAlive() const;
+
 			void SetMethod(http::Method method);
 			http::Method GetMethod() const;
 
@@ -119,6 +124,15 @@ namespace http
 			void PostProcess();
 			void CleanupVariables();
 
+			// Returns true if the response has been received completely and the server doesn't close the connection
+			bool IsConnectionReusable() const;
+			// Moves the connection to the idle connections of the server
+			void ReleaseConnection();
+			// Takes an idle connection to <_connection_key> if there is one that is still alive
+			bool TakeIdleConnection();
+			// Saves the TLS session of the connection to resume the next connection to the server
+			void StoreTlsSession();
+
 			void HandleError(std::shared_ptr<const ov::Error> error);
 
 		protected:
@@ -131,6 +145,15 @@ namespace http
 			int _recv_timeout_msec = 60 * 1000;
 			http::Method _method = http::Method::Get;
 
+			bool _keep_alive = false;
+			// "<scheme>://<host>:<port>", the key of the idle connections
+			ov::String _connection_key;
+			bool _is_reused_connection = false;
+			// The reused connection turned out to be closed by the server before any response
+			bool _is_stale_connection = false;
+			bool _skip_idle_connections = false;
+			bool _is_response_received = false;
+
 			// Related to chunked transfer
 			bool _is_chunked_transfer = false;
 			ChunkParseStatus _chunk_parse_status = ChunkParseStatus::None;
@@ -139,6 +162,8 @@ namespace http
 			ov::String _chunk_header;
 
 			std::shared_ptr<ov::TlsClientData> _tls_data;
+			// "<host>:<port>", the key of the TLS sessions to resume
+			ov::String _tls_session_key;
 
 			prot::h1::HttpResponseParser _parser;
 
@@ -30,6 +30,16 @@ namespace http
 			std::shared_ptr<ov::Data> encoded_data = std::make_shared<ov::Data>(header_fields.GetSize());
 			ov::ByteStream stream(encoded_data.get());
 
+			if (Encode(stream, header_fields, type) == false)
+			{
+				return nullptr;
+			}
+
+			return encoded_data;
+		}
+
+		bool Encoder::Encode(ov::ByteStream &stream, const HeaderField &header_fields, EncodingType type)
+		{
 			bool result = false;
 
 			if (_need_signal_table_size_update)
@@ -37,7 +47,7 @@ namespace http
 				if (EncodeDynamicTableSizeUpdate(stream, _table_connector.GetDynamicTableSize()) == false)
 				{
 					logte("Failed to encode DynamicTableSizeUpdate (%u) field", _table_connector.GetDynamicTableSize());
-					return nullptr;
+					return false;
 				}
 
 				_need_signal_table_size_update = false;
@@ -64,17 +74,17 @@ namespace http
 						result = EncodeLiteralHeaderFieldNeverIndexed(stream, header_fields, index);
 						break;
 					default:
-						return nullptr;
+						return false;
 				}
 			}
 
 			if (result == false)
 			{
 				logte("Failed to encode header field");
-				return nullptr;
+				return false;
 			}
 
-			return encoded_data;
+			return true;
 		}
 
 		bool Encoder::EncodeIndexedHeaderField(ov::ByteStream &stream, const HeaderField &header_fields, uint32_t index)
@@ -184,7 +194,7 @@ namespace http
 		bool Encoder::WriteInteger(ov::ByteStream &stream, uint8_t mask, uint8_t value_bits, uint64_t value)
 		{
 			uint8_t first_octet = mask;
-			uint8_t max_prefix_value = std::pow(2, value_bits) - 1;
+			uint8_t max_prefix_value = (1 << value_bits) - 1;
 			
 			if (value < max_prefix_value)
 			{
@@ -226,6 +236,12 @@ namespace http
 		{
 			std::shared_ptr<ov::Data> data = nullptr;
 
+			// The Huffman code is not always shorter (e.g. base64 tokens), so the literal is used in that case
+			if ((huffman_encoding == true) && (HuffmanCodec::GetInstance()->GetEncodedLength(value) >= value.GetLength()))
+			{
+				huffman_encoding = false;
+			}
+
 			if (huffman_encoding == true)
 			{
 				data = HuffmanCodec::GetInstance()->Encode(value);
@@ -241,7 +257,7 @@ namespace http
 			}
 
 			// Write the length - 0x80 mask means string is Huffman Encoded
-			WriteInteger(stream, 0x80, 7, data->GetLength());
+			WriteInteger(stream, huffman_encoding ? 0x80 : 0x00, 7, data->GetLength());
 			
 			// Write encoded string
 			stream.Write(data);
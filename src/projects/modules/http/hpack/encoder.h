@@ -30,6 +30,8 @@ namespace http
 			bool UpdateDynamicTableSize(size_t size);
 
 			std::shared_ptr<ov::Data> Encode(const HeaderField &header_fields, EncodingType type);
+			// Appends the encoded header field to <stream> (used to build a header block without a buffer for each field)
+			bool Encode(ov::ByteStream &stream, const HeaderField &header_fields, EncodingType type);
 
 		private:
 			bool EncodeIndexedHeaderField(ov::ByteStream &stream, const HeaderField &header_fields, uint32_t index);
@@ -7,9 +7,10 @@
 //
 //==============================================================================
 
-#include <base/ovlibrary/bit_reader.h>
 #include "huffman_codec.h"
 
+#include <unordered_set>
+
 namespace http
 {
 	namespace hpack
@@ -274,11 +275,30 @@ namespace http
 			Build(0x7fffff0, 27, 254);
 			Build(0x3ffffee, 26, 255);
 			Build(0x3fffffff, 30, 256); //EOS
+
+			BuildDecodeTable();
+		}
+
+		size_t HuffmanCodec::GetEncodedLength(const ov::String &str) const
+		{
+			size_t bit_length = 0;
+			size_t length = str.GetLength();
+
+			for (size_t i = 0; i < length; i++)
+			{
+				bit_length += _map[static_cast<uint8_t>(str[i])].second;
+			}
+
+			return (bit_length + 7) / 8;
 		}
 
 		std::shared_ptr<ov::Data> HuffmanCodec::Encode(const ov::String &str)
 		{
-			uint8_t out_data[str.GetLength() * 2];
+			auto out_data_length = GetEncodedLength(str);
+			auto data = std::make_shared<ov::Data>(out_data_length);
+			data->SetLength(out_data_length);
+
+			auto out_data = data->GetWritableDataAs<uint8_t>();
 			size_t out_data_size = 0;
 
 			uint64_t bit_buffer = 0;
@@ -323,59 +343,120 @@ namespace http
 				out_data_size ++;
 			}
 			
-			return std::make_shared<ov::Data>(&out_data[0], out_data_size);
+			return data;
 		}
 
 		bool HuffmanCodec::Decode(const std::shared_ptr<const ov::Data> &data, ov::String &str)
 		{
-			auto reader = std::make_shared<BitReader>(data->GetDataAs<uint8_t>(), data->GetLength());
-			auto node = _tree;
+			auto input = data->GetDataAs<uint8_t>();
+			auto length = data->GetLength();
+
+			// The encoded string is at least 5 bits per symbol
+			str.SetCapacity(str.GetLength() + (length * 8 / 5) + 1);
+
+			uint8_t state = 0;
+			// An empty input is accepted
+			uint8_t flags = DecodeFlag::Accepted;
 
-			while (reader->BytesRemained() > 0)
+			for (size_t i = 0; i < length; i++)
 			{
-				auto b = reader->ReadBit();
-				if (b == 1)
+				// Upper 4 bits first
+				for (auto nibble : {static_cast<uint8_t>(input[i] >> 4), static_cast<uint8_t>(input[i] & 0x0F)})
 				{
-					node = node->GetRight();
-					if (node == nullptr)
+					const auto &entry = _decode_table[state][nibble];
+					flags = entry.flags;
+
+					if (flags & DecodeFlag::Fail)
 					{
 						return false;
 					}
+
+					if (flags & DecodeFlag::Emit)
+					{
+						str.Append(static_cast<char>(entry.symbol));
+					}
+
+					state = entry.next_state;
 				}
-				else
+			}
+
+			// https://www.rfc-editor.org/rfc/rfc7541.html#section-5.2
+			// A padding strictly longer than 7 bits MUST be treated as a decoding error.
+			// A padding not corresponding to the most significant bits of the code
+			// for the EOS symbol MUST be treated as a decoding error.
+			return (flags & DecodeFlag::Accepted) != 0;
+		}
+
+		void HuffmanCodec::BuildDecodeTable()
+		{
+			// Assign a state to each internal node (the root is 0)
+			std::vector<Node *> state_list;
+			std::unordered_map<Node *, uint8_t> state_map;
+
+			state_list.push_back(_tree);
+			state_map[_tree] = 0;
+
+			for (size_t index = 0; index < state_list.size(); index++)
+			{
+				for (auto child : {state_list[index]->GetLeft(), state_list[index]->GetRight()})
 				{
-					node = node->GetLeft();
-					if (node == nullptr)
+					if ((child != nullptr) && (child->IsLeaf() == false))
 					{
-						return false;
+						state_map[child] = static_cast<uint8_t>(state_list.size());
+						state_list.push_back(child);
 					}
 				}
+			}
+
+			OV_ASSERT2(state_list.size() == _decode_table.size());
+
+			// The states that are reached from the root only by 1 bits (at most 7 bits) can end the input
+			std::unordered_set<Node *> accepted_node_set;
+			auto node = _tree;
+			for (int depth = 0; (depth <= 7) && (node != nullptr) && (node->IsLeaf() == false); depth++)
+			{
+				accepted_node_set.insert(node);
+				node = node->GetRight();
+			}
 
-				if (node->IsLeaf())
+			for (size_t state = 0; state < state_list.size(); state++)
+			{
+				for (uint8_t nibble = 0; nibble < 16; nibble++)
 				{
-					if (node->GetValue() == 256)
+					auto &entry = _decode_table[state][nibble];
+					node = state_list[state];
+
+					for (int bit_index = 3; bit_index >= 0; bit_index--)
 					{
-						// EOS
-						return false;
+						node = ((nibble >> bit_index) & 0x1) ? node->GetRight() : node->GetLeft();
+
+						if ((node == nullptr) || (node->IsLeaf() && (node->GetValue() == 256)))
+						{
+							entry.flags = DecodeFlag::Fail;
+							break;
+						}
+
+						if (node->IsLeaf())
+						{
+							entry.symbol = static_cast<uint8_t>(node->GetValue());
+							entry.flags |= DecodeFlag::Emit;
+							node = _tree;
+						}
 					}
 
-					str.Append(static_cast<uint8_t>(node->GetValue()));
-					node = _tree;
+					if (entry.flags & DecodeFlag::Fail)
+					{
+						continue;
+					}
 
-					// https://www.rfc-editor.org/rfc/rfc7541.html#section-5.2
-					// As the Huffman-encoded data doesn't always end at an octet boundary,
-					// some padding is inserted after it, up to the next octet boundary.  To
-					// prevent this padding from being misinterpreted as part of the string
-					// literal, the most significant bits of the code corresponding to the
-					// EOS (end-of-string) symbol are used.
+					entry.next_state = state_map[node];
 
-					// So, the symbol (1111111) corresponding to EOS may be included in the 
-					// last 7 bits or less. In this case, no processing is done because it will 
-					// terminate without reaching the leaf naturally.
+					if (accepted_node_set.find(node) != accepted_node_set.end())
+					{
+						entry.flags |= DecodeFlag::Accepted;
+					}
 				}
 			}
-
-			return true;
 		}
 
 		void HuffmanCodec::BuildTree(uint32_t code, uint8_t length, uint16_t symbol)
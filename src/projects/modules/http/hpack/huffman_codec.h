@@ -10,6 +10,8 @@
 
 #include <base/ovlibrary/ovlibrary.h>
 
+#include <array>
+
 namespace http
 {
 	// https://www.rfc-editor.org/rfc/rfc7541.html
@@ -20,6 +22,8 @@ namespace http
 		public:
 			HuffmanCodec();
 			std::shared_ptr<ov::Data> Encode(const ov::String &str);
+			// Returns the number of octets of the encoded <str> (used to decide whether to encode it or not)
+			size_t GetEncodedLength(const ov::String &str) const;
 			bool Decode(const std::shared_ptr<const ov::Data> &data, ov::String &str);
 			
 		private:
@@ -29,6 +33,8 @@ namespace http
 			void BuildMap(uint32_t code, uint8_t length, uint16_t symbol);
 			// Build Tree for decoding from code to symbol
 			void BuildTree(uint32_t code, uint8_t length, uint16_t symbol);
+			// Build the state table of the decoder from the tree (must be called after the tree is completed)
+			void BuildDecodeTable();
 
 			class Node
 			{
@@ -76,9 +82,32 @@ namespace http
 				bool _is_leaf = false;
 			};
 
+			// The decoder consumes 4 bits at a time. The state is an internal node of the tree, and as the shortest
+			// code is 5 bits, at most one symbol is decoded by 4 bits.
+			enum DecodeFlag : uint8_t
+			{
+				// <symbol> is decoded
+				Emit = 0x01,
+				// EOS is decoded, or the code is invalid
+				Fail = 0x02,
+				// The input can end in <next_state> (the remaining bits are a valid padding: 7 bits or less of EOS prefix)
+				Accepted = 0x04,
+			};
+
+			struct DecodeEntry
+			{
+				uint8_t next_state = 0;
+				uint8_t symbol = 0;
+				uint8_t flags = 0;
+			};
+
 			// 
 			Node* _tree = new Node();
-			std::unordered_map<uint8_t, std::pair<uint32_t, uint8_t>> _map;
+			// Indexed by symbol: <code, code length>
+			std::array<std::pair<uint32_t, uint8_t>, 257> _map {};
+			// A Huffman tree of 257 symbols has 256 internal nodes (states)
+			// [state][4 bits of input]
+			std::array<std::array<DecodeEntry, 16>, 256> _decode_table {};
 		};
 	}
 }
\ No newline at end of file
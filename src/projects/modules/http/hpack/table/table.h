@@ -75,8 +75,9 @@ namespace http
 			std::tuple<bool, bool, uint32_t> LookupIndex(const HeaderField &header_field)
 			{
 				// If name/value pair is matched in the table, return the index number.
+				// The entries that are inserted before the oldest entry in the table are already evicted
 				auto it = _header_field_sequence_map.find(header_field.GetKey().CStr());
-				if (it != _header_field_sequence_map.end())
+				if ((it != _header_field_sequence_map.end()) && (it->second > _removed_count))
 				{
 					// Found {name, value} in static table
 					auto sequence_number = it->second;
@@ -87,7 +88,7 @@ namespace http
 
 				// Else if only name is matched in the table, return the index number.
 				it = _header_field_name_sequence_map.find(header_field.GetName().CStr());
-				if (it != _header_field_name_sequence_map.end())
+				if ((it != _header_field_name_sequence_map.end()) && (it->second > _removed_count))
 				{
 					// Found {name, value} in table
 					auto sequence_number = it->second;
@@ -43,6 +43,108 @@ namespace http
 		}
 	}
 
+	// Content codings of the responses (RFC 9110 8.4.1)
+	enum class ContentEncoding : uint8_t
+	{
+		Identity = 0,
+		Gzip,
+		Brotli,
+	};
+
+	inline const char *StringFromContentEncoding(ContentEncoding encoding)
+	{
+		switch (encoding)
+		{
+			case ContentEncoding::Gzip:
+				return "gzip";
+			case ContentEncoding::Brotli:
+				return "br";
+			case ContentEncoding::Identity:
+			default:
+				return "identity";
+		}
+	}
+
+	// Chooses the content coding of a response from Accept-Encoding (RFC 9110 12.5.3).
+	// Brotli is preferred to gzip when both are acceptable, and the codings with q=0 are excluded.
+	inline ContentEncoding NegotiateContentEncoding(const ov::String &accept_encoding, bool brotli_enabled)
+	{
+		double gzip_q = -1.0;
+		double brotli_q = -1.0;
+		double any_q = -1.0;
+
+		for (const auto &item : accept_encoding.Split(","))
+		{
+			auto params = item.Split(";");
+			if (params.empty())
+			{
+				continue;
+			}
+
+			auto coding = params[0].Trim().LowerCaseString();
+			double q = 1.0;
+
+			for (size_t index = 1; index < params.size(); index++)
+			{
+				auto param = params[index].Trim();
+				if (param.HasPrefix("q="))
+				{
+					q = ov::Converter::ToDouble(param.Substring(2).CStr());
+				}
+			}
+
+			if (coding == "gzip" || coding == "x-gzip")
+			{
+				gzip_q = q;
+			}
+			else if (coding == "br")
+			{
+				brotli_q = q;
+			}
+			else if (coding == "*")
+			{
+				any_q = q;
+			}
+		}
+
+		// "*" matches the codings that are not listed
+		gzip_q = (gzip_q < 0.0) ? any_q : gzip_q;
+		brotli_q = (brotli_q < 0.0) ? any_q : brotli_q;
+
+		if (brotli_enabled && (brotli_q > 0.0) && (brotli_q >= gzip_q))
+		{
+			return ContentEncoding::Brotli;
+		}
+
+		if (gzip_q > 0.0)
+		{
+			return ContentEncoding::Gzip;
+		}
+
+		return ContentEncoding::Identity;
+	}
+
+	// Whether <etag> is one of the entity tags of If-None-Match (weak comparison, RFC 9110 13.1.2)
+	inline bool IsETagMatched(const ov::String &if_none_match, const ov::String &etag)
+	{
+		if (if_none_match.IsEmpty() || etag.IsEmpty())
+		{
+			return false;
+		}
+
+		for (auto tag : if_none_match.Split(","))
+		{
+			tag = tag.Trim();
+
+			if ((tag == "*") || (tag == etag) || (tag.HasPrefix("W/") && (tag.Substring(2) == etag)))
+			{
+				return true;
+			}
+		}
+
+		return false;
+	}
+
 	// RFC7231 - 4. Request Methods
 	// +---------+-------------------------------------------------+-------+
 	// | Method  | Description                                     | Sec.  |
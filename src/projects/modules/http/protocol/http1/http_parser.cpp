@@ -8,6 +8,8 @@
 //==============================================================================
 #include "http_parser.h"
 
+#include <strings.h>
+
 #include "../../http_private.h"
 
 namespace http
@@ -76,7 +78,7 @@ namespace http
 						// reference: https://en.cppreference.com/w/cpp/string/byte/isprint
 						if (::isprint(character) || ::isspace(character))
 						{
-							character++;
+							data_to_check++;
 							remained--;
 
 							continue;
@@ -94,6 +96,74 @@ namespace http
 				return used_length;
 			}
 
+			namespace
+			{
+				// Lower case names of HttpParser::KnownHeader
+				constexpr std::string_view KNOWN_HEADER_NAMES[] = {
+					"host",
+					"range",
+					"origin",
+					"if-none-match",
+					"content-length",
+					"transfer-encoding"};
+
+				static_assert(OV_COUNTOF(KNOWN_HEADER_NAMES) == static_cast<size_t>(HttpParser::KnownHeader::Count), "KNOWN_HEADER_NAMES must match KnownHeader");
+
+				bool IsEqualIgnoreCase(const std::string_view &name1, const std::string_view &name2)
+				{
+					return (name1.length() == name2.length()) &&
+						   (::strncasecmp(name1.data(), name2.data(), name1.length()) == 0);
+				}
+
+				bool IsOws(char character)
+				{
+					return (character == ' ') || (character == '\t');
+				}
+			}  // namespace
+
+			const std::unordered_map<ov::String, ov::String, ov::CaseInsensitiveHash, ov::CaseInsensitiveEqual> &HttpParser::GetHeaders() const noexcept
+			{
+				if (_is_headers_built == false)
+				{
+					// The latter overwrites the former if the header is duplicated
+					for (size_t index = 0; index < _header_slice_list.size(); index++)
+					{
+						auto name = GetHeaderNameView(index);
+						auto value = GetHeaderValueView(index);
+
+						_headers[ov::String(name.data(), name.length()).LowerCaseString()] = ov::String(value.data(), value.length());
+					}
+
+					_is_headers_built = true;
+				}
+
+				return _headers;
+			}
+
+			ssize_t HttpParser::FindHeader(const ov::String &key) const noexcept
+			{
+				std::string_view key_view(key.CStr(), key.GetLength());
+
+				for (size_t known_header = 0; known_header < OV_COUNTOF(KNOWN_HEADER_NAMES); known_header++)
+				{
+					if (IsEqualIgnoreCase(key_view, KNOWN_HEADER_NAMES[known_header]))
+					{
+						return _known_header_index_list[known_header];
+					}
+				}
+
+				// Since there are a few headers in a request, searching is faster than building a map
+				for (ssize_t index = static_cast<ssize_t>(_header_slice_list.size()) - 1; index >= 0; index--)
+				{
+					if (IsEqualIgnoreCase(key_view, GetHeaderNameView(index)))
+					{
+						return index;
+					}
+				}
+
+				return -1;
+			}
+
 			StatusCode HttpParser::ParseMessage()
 			{
 				// RFC7230 - 3. Message Format
@@ -105,40 +175,46 @@ namespace http
 				// RFC7230 - 3.1. Start Line
 				// start-line     = request-line / status-line
 
-				// Tokenize by "\r\n"
-				std::vector<ov::String> tokens = _header_string.Split("\r\n");
+				// Tokenize by "\r\n" (the lines are not copied, except for the start line)
+				std::string_view header_view(_header_string.CStr(), _header_string.GetLength());
+
+				auto line_end = header_view.find("\r\n");
+				auto first_line_length = (line_end == std::string_view::npos) ? header_view.length() : line_end;
 
 				StatusCode status_code;
 
-				status_code = ParseFirstLine(tokens[0]);
-				tokens.erase(tokens.begin());
+				status_code = ParseFirstLine(ov::String(header_view.data(), first_line_length));
+
+				size_t line_offset = first_line_length + 2;
 
-				if (status_code == StatusCode::OK)
+				while ((status_code == StatusCode::OK) && (line_offset < header_view.length()))
 				{
-					for (const ov::String &token : tokens)
-					{
-						status_code = ParseHeader(token);
+					line_end = header_view.find("\r\n", line_offset);
+					auto line_length = ((line_end == std::string_view::npos) ? header_view.length() : line_end) - line_offset;
 
-						if (status_code != StatusCode::OK)
-						{
-							break;
-						}
-					}
+					status_code = ParseHeader(line_offset, line_length);
+
+					line_offset += line_length + 2;
 				}
 
-				logtd("Headers: %ld:", _headers.size());
+				logtd("Headers: %zu:", _header_slice_list.size());
 
-				std::for_each(_headers.begin(), _headers.end(), [](const auto &pair) -> void {
-					logtd("\t>> %s: %s", pair.first.CStr(), pair.second.CStr());
-				});
+				for (size_t index = 0; index < _header_slice_list.size(); index++)
+				{
+					auto name = GetHeaderNameView(index);
+					auto value = GetHeaderValueView(index);
+
+					logtd("\t>> %.*s: %.*s", static_cast<int>(name.length()), name.data(), static_cast<int>(value.length()), value.data());
+				}
 
-				_has_content_length = IsHeaderExists("CONTENT-LENGTH");
-				_content_length = ov::Converter::ToInt64(GetHeader("CONTENT-LENGTH", "0"));
+				auto content_length = GetHeaderView(KnownHeader::ContentLength);
+				_has_content_length = (_known_header_index_list[static_cast<size_t>(KnownHeader::ContentLength)] >= 0);
+				_content_length = _has_content_length ? ov::Converter::ToInt64(ov::String(content_length.data(), content_length.length())) : 0L;
 
 				return status_code;
 			}
 
-			StatusCode HttpParser::ParseHeader(const ov::String &line)
+			StatusCode HttpParser::ParseHeader(size_t line_offset, size_t line_length)
 			{
 				// RFC7230 - 3.2.  Header Fields
 				// header-field   = field-name ":" OWS field-value OWS
@@ -164,20 +240,61 @@ namespace http
 				// the obs-fold rule) unless the message is intended for packaging
 				// within the message/http media type.
 
-				ssize_t colon_index = line.IndexOf(':');
+				std::string_view line(_header_string.CStr() + line_offset, line_length);
+
+				auto colon_index = line.find(':');
 
-				if (colon_index == -1)
+				if (colon_index == std::string_view::npos)
 				{
-					logtw("Invalid header (could not find colon): %s", line.CStr());
+					logtw("Invalid header (could not find colon): %.*s", static_cast<int>(line.length()), line.data());
 					return StatusCode::BadRequest;
 				}
 
-				// Convert all header names to lower case
-				ov::String field_name = line.Left(static_cast<size_t>(colon_index)).LowerCaseString();
 				// Eliminate OWS(optional white space) to simplify processing
-				ov::String field_value = line.Substring(colon_index + 1).Trim();
+				size_t name_begin = 0;
+				size_t name_end = colon_index;
+				size_t value_begin = colon_index + 1;
+				size_t value_end = line.length();
 
-				_headers[field_name.Trim()] = field_value.Trim();
+				while ((name_begin < name_end) && IsOws(line[name_begin]))
+				{
+					name_begin++;
+				}
+
+				while ((name_end > name_begin) && IsOws(line[name_end - 1]))
+				{
+					name_end--;
+				}
+
+				while ((value_begin < value_end) && IsOws(line[value_begin]))
+				{
+					value_begin++;
+				}
+
+				while ((value_end > value_begin) && IsOws(line[value_end - 1]))
+				{
+					value_end--;
+				}
+
+				HeaderSlice slice;
+				slice.name_offset = line_offset + name_begin;
+				slice.name_length = name_end - name_begin;
+				slice.value_offset = line_offset + value_begin;
+				slice.value_length = value_end - value_begin;
+
+				_header_slice_list.push_back(slice);
+
+				auto name = line.substr(name_begin, slice.name_length);
+
+				for (size_t known_header = 0; known_header < OV_COUNTOF(KNOWN_HEADER_NAMES); known_header++)
+				{
+					if (IsEqualIgnoreCase(name, KNOWN_HEADER_NAMES[known_header]))
+					{
+						// The latter is used if the header is duplicated
+						_known_header_index_list[known_header] = static_cast<ssize_t>(_header_slice_list.size()) - 1;
+						break;
+					}
+				}
 
 				return StatusCode::OK;
 			}
@@ -10,7 +10,9 @@
 
 #include <base/ovlibrary/ovlibrary.h>
 
+#include <array>
 #include <map>
+#include <string_view>
 
 #include "../../http_datastructure.h"
 
@@ -23,6 +25,11 @@ namespace http
 			class HttpParser
 			{
 			public:
+				HttpParser()
+				{
+					_known_header_index_list.fill(-1);
+				}
+
 				/// Process data sent by peers
 				///
 				/// @param data Received data
@@ -40,10 +47,21 @@ namespace http
 					return _parse_status;
 				}
 
-				const std::unordered_map<ov::String, ov::String, ov::CaseInsensitiveHash, ov::CaseInsensitiveEqual> &GetHeaders() const noexcept
+				// The well-known headers that are looked up without searching
+				enum class KnownHeader : uint8_t
 				{
-					return _headers;
-				}
+					Host,
+					Range,
+					Origin,
+					IfNoneMatch,
+					ContentLength,
+					TransferEncoding,
+
+					Count
+				};
+
+				// The map is built at the first call (the headers are kept as slices of the received data until then)
+				const std::unordered_map<ov::String, ov::String, ov::CaseInsensitiveHash, ov::CaseInsensitiveEqual> &GetHeaders() const noexcept;
 
 				Method GetMethod() const noexcept
 				{
@@ -80,19 +98,27 @@ namespace http
 
 				ov::String GetHeader(const ov::String &key, ov::String default_value) const noexcept
 				{
-					auto item = _headers.find(key.LowerCaseString());
+					auto index = FindHeader(key);
 
-					if (item == _headers.cend())
+					if (index < 0)
 					{
 						return default_value;
 					}
 
-					return item->second;
+					auto value = GetHeaderValueView(index);
+					return ov::String(value.data(), value.length());
+				}
+
+				// The view is valid while the parser is alive
+				std::string_view GetHeaderView(KnownHeader header) const noexcept
+				{
+					auto index = _known_header_index_list[static_cast<size_t>(header)];
+					return (index < 0) ? std::string_view() : GetHeaderValueView(index);
 				}
 
 				const bool IsHeaderExists(const ov::String &key) const noexcept
 				{
-					return _headers.find(key.LowerCaseString()) != _headers.cend();
+					return FindHeader(key) >= 0;
 				}
 
 				bool HasContentLength() const
@@ -106,9 +132,33 @@ namespace http
 				}
 
 			protected:
+				// Offsets in _header_string
+				struct HeaderSlice
+				{
+					size_t name_offset = 0;
+					size_t name_length = 0;
+					size_t value_offset = 0;
+					size_t value_length = 0;
+				};
+
 				StatusCode ParseMessage();
 				virtual StatusCode ParseFirstLine(const ov::String &line) = 0;
-				StatusCode ParseHeader(const ov::String &line);
+				StatusCode ParseHeader(size_t line_offset, size_t line_length);
+
+				// Returns the index of _header_slice_list, or -1 if not found
+				ssize_t FindHeader(const ov::String &key) const noexcept;
+
+				std::string_view GetHeaderNameView(ssize_t index) const noexcept
+				{
+					const auto &slice = _header_slice_list[index];
+					return std::string_view(_header_string.CStr() + slice.name_offset, slice.name_length);
+				}
+
+				std::string_view GetHeaderValueView(ssize_t index) const noexcept
+				{
+					const auto &slice = _header_slice_list[index];
+					return std::string_view(_header_string.CStr() + slice.value_offset, slice.value_length);
+				}
 
 				StatusCode _parse_status = StatusCode::PartialContent;
 
@@ -116,9 +166,15 @@ namespace http
 				ov::String _http_version;
 
 				bool _is_header_found = false;
-				// A temporary buffer to extract HTTP header
+				// A temporary buffer to extract HTTP header (the header slices refer to this buffer)
 				ov::String _header_string;
-				std::unordered_map<ov::String, ov::String, ov::CaseInsensitiveHash, ov::CaseInsensitiveEqual> _headers;
+				std::vector<HeaderSlice> _header_slice_list;
+				// Indexed by KnownHeader, the value is the index of _header_slice_list (-1 if not exists)
+				std::array<ssize_t, static_cast<size_t>(KnownHeader::Count)> _known_header_index_list;
+
+				// Built from _header_slice_list by GetHeaders()
+				mutable bool _is_headers_built = false;
+				mutable std::unordered_map<ov::String, ov::String, ov::CaseInsensitiveHash, ov::CaseInsensitiveEqual> _headers;
 
 				// Frequently used headers
 				size_t _content_length = 0L;
@@ -35,6 +35,8 @@ namespace http
 			//                       Figure 1: Frame Layout
 
 #define HTTP2_FRAME_HEADER_SIZE (3+1+1+4)
+// https://httpwg.org/specs/rfc9113.html#ErrorCodes
+#define HTTP2_ERROR_CODE_INTERNAL_ERROR (0x2)
 
 			// For HTTP/2.0
 			class Http2Frame : public ov::EnableSharedFromThis<Http2Frame>
@@ -33,15 +33,12 @@ namespace http
 					return Send("0\r\n\r\n", 5);
 				}
 
-				bool result =
-					// Send the chunk header
-					Send(ov::String::FormatString("%x\r\n", data->GetLength()).ToData(false)) &&
-					// Send the chunk payload
-					Send(data) &&
-					// Send a last data of chunk
-					Send("\r\n", 2);
-
-				return result;
+				static const auto chunk_trailer = std::make_shared<const ov::Data>("\r\n", 2);
+
+				// The chunk header, the chunk payload and the last data of chunk are sent at once
+				return Send({ov::String::FormatString("%x\r\n", data->GetLength()).ToData(false),
+							 data,
+							 chunk_trailer});
 			}
 
 			void Http1Response::SetChunkedTransfer()
@@ -102,39 +99,51 @@ namespace http
 
 			int32_t Http1Response::SendPayload()
 			{
-				bool sent = true;
-
 				logtd("Trying to send datas...");
 
 				uint32_t sent_bytes = 0;
-				for (const auto &data : GetResponseDataList())
+				const auto &data_list = GetResponseDataList();
+
+				if (_chunked_transfer)
 				{
-					if (_chunked_transfer)
+					for (const auto &data : data_list)
 					{
-						sent &= SendChunkedData(data);
-						if (sent == true)
-						{
-							sent_bytes += data->GetLength();
-						}
-						else
+						if (SendChunkedData(data) == false)
 						{
 							logte("Could not send chunked data : %d bytes", data->GetLength());
 							return -1;
 						}
+
+						sent_bytes += data->GetLength();
 					}
-					else
+				}
+				else if (data_list.empty() == false)
+				{
+					// The data is sent without concatenation
+					if (Send(data_list) == false)
 					{
-						sent &= Send(data);
-						if (sent == true)
-						{
-							sent_bytes += data->GetLength();
-						}
-						else
-						{
-							logte("Could not send data : %d bytes", data->GetLength());
-							return -1;
-						}
+						logte("Could not send data : %zu bytes", GetResponseDataSize());
+						return -1;
+					}
+
+					sent_bytes = GetResponseDataSize() - GetResponseFileLength();
+				}
+
+				const auto &file = GetResponseFile();
+				auto file_length = GetResponseFileLength();
+
+				if ((file != nullptr) && (file_length > 0))
+				{
+					// The region of the file is sent as a chunk
+					if ((_chunked_transfer && (Send(ov::String::FormatString("%zx\r\n", file_length).ToData(false)) == false)) ||
+						(SendFile(file, GetResponseFileOffset(), file_length) == false) ||
+						(_chunked_transfer && (Send("\r\n", 2) == false)))
+					{
+						logte("Could not send file : %s (%zu bytes)", file->GetPath().CStr(), file_length);
+						return -1;
 					}
+
+					sent_bytes += file_length;
 				}
 
 				ResetResponseData();
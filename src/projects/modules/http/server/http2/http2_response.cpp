@@ -45,23 +45,53 @@ namespace http
 				return Send(frame);
 			}
 
+			bool Http2Response::ResetStream(uint32_t error_code)
+			{
+				auto frame = std::make_shared<prot::h2::Http2RstStreamFrame>(_stream_id);
+				frame->SetErrorCode(error_code);
+
+				return Send(frame);
+			}
+
+			bool Http2Response::IsVolatileHeader(const ov::String &lower_name)
+			{
+				return (lower_name == "content-length") ||
+					   (lower_name == "date") ||
+					   (lower_name == "age") ||
+					   (lower_name == "last-modified") ||
+					   (lower_name == "etag");
+			}
+
 			int32_t Http2Response::SendHeader()
 			{
 				std::shared_ptr<ov::Data> header_block = std::make_shared<ov::Data>(65535);
 				size_t sent_size = 0;
 
+				ov::ByteStream header_stream(header_block.get());
+
 				// :status header field is must on top
-				auto header_field = _hpack_encoder->Encode({":status", ov::Converter::ToString(static_cast<uint16_t>(GetStatusCode()))}, hpack::Encoder::EncodingType::LiteralWithIndexing);
-				header_block->Append(header_field);
+				if (_hpack_encoder->Encode(header_stream, {":status", ov::Converter::ToString(static_cast<uint16_t>(GetStatusCode()))}, hpack::Encoder::EncodingType::LiteralWithIndexing) == false)
+				{
+					return -1;
+				}
 
 				for (const auto &[name, values] : GetResponseHeaderList())
 				{
+					// https://httpwg.org/http2-spec/draft-ietf-httpbis-http2bis.html#section-8.2
+					// Field names MUST be converted to lowercase when constructing an HTTP/2 message.
+					auto lower_name = name.LowerCaseString();
+
+					// The fields that are the same for every response of the connection (content-type, cache-control,
+					// CORS headers, ...) are kept in the dynamic table, so they are sent as a 1-byte index from the
+					// second response. The fields that change every response are not indexed, so they do not evict them.
+					auto encoding_type = IsVolatileHeader(lower_name) ? hpack::Encoder::EncodingType::LiteralWithoutIndexing : hpack::Encoder::EncodingType::LiteralWithIndexing;
+
 					for (const auto &value : values)
 					{
-						// https://httpwg.org/http2-spec/draft-ietf-httpbis-http2bis.html#section-8.2
-						// Field names MUST be converted to lowercase when constructing an HTTP/2 message.
-						auto header_field = _hpack_encoder->Encode({name.LowerCaseString(), value}, hpack::Encoder::EncodingType::LiteralWithIndexing);
-						header_block->Append(header_field);
+						if (_hpack_encoder->Encode(header_stream, {lower_name, value}, encoding_type) == false)
+						{
+							return -1;
+						}
 					}
 				}
 
@@ -136,6 +166,11 @@ namespace http
 				return sent_size;
 			}
 
+			bool Http2Response::IsSendFileAvailable() const
+			{
+				return false;
+			}
+
 			int32_t Http2Response::SendPayload()
 			{
 				logtd("Trying to send datas...");
@@ -169,7 +204,7 @@ namespace http
 					payload_frame->SetData(data_fragment);
 
 					// End Stream
-					if (_keep_stream == false && (&data == &GetResponseDataList().back()))
+					if (_keep_stream == false && (&data == &GetResponseDataList().back()) && (GetResponseFileLength() == 0))
 					{
 						payload_frame->SetEndStream();
 					}
@@ -184,6 +219,53 @@ namespace http
 					sent_bytes += data->GetLength();
 				}
 
+				const auto &file = GetResponseFile();
+				if ((file != nullptr) && (GetResponseFileLength() > 0))
+				{
+					auto file_offset = GetResponseFileOffset();
+					auto remained = GetResponseFileLength();
+
+					// Read in pieces of multiple DATA frames to reduce the number of syscalls
+					do
+					{
+						auto piece_size = std::min<size_t>(remained, MAX_HTTP2_DATA_SIZE * 16);
+						auto piece = file->Read(file_offset, piece_size);
+
+						if ((piece == nullptr) || (piece->GetLength() != piece_size))
+						{
+							logte("Could not read the file: %s", file->GetPath().CStr());
+							ResetResponseData();
+							return -1;
+						}
+
+						remained -= piece_size;
+						file_offset += piece_size;
+
+						size_t offset = 0;
+						do
+						{
+							auto fragment_size = std::min<size_t>(piece_size - offset, MAX_HTTP2_DATA_SIZE);
+							auto payload_frame = std::make_shared<prot::h2::Http2DataFrame>(_stream_id);
+							payload_frame->SetData(piece->Subdata(offset, fragment_size));
+							offset += fragment_size;
+
+							if ((_keep_stream == false) && (remained == 0) && (offset == piece_size))
+							{
+								payload_frame->SetEndStream();
+							}
+
+							if (Send(payload_frame) == false)
+							{
+								logte("Failed to send payload");
+								ResetResponseData();
+								return -1;
+							}
+						} while (offset < piece_size);
+
+						sent_bytes += piece_size;
+					} while (remained > 0);
+				}
+
 				ResetResponseData();
 
 				logtd("All datas are sent...");
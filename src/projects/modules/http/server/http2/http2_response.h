@@ -34,9 +34,17 @@ namespace http
 				void SetKeepStream(bool keep_stream);
 				bool Send(const std::shared_ptr<prot::h2::Http2DataFrame> &data_frame, bool end_stream);
 
+				// Terminates the stream with RST_STREAM (used when the response cannot be completed after the header is sent)
+				bool ResetStream(uint32_t error_code);
+
 			private:
+				// Returns true if the value of the header field is usually different for each response
+				static bool IsVolatileHeader(const ov::String &lower_name);
+
 				int32_t SendHeader() override;
 				int32_t SendPayload() override;
+				// The file is sent in DATA frames, so it has to be read into the user space
+				bool IsSendFileAvailable() const override;
 
 				uint32_t _stream_id = 0;
 				bool _keep_stream = false;
@@ -16,6 +16,11 @@
 
 #include "../http_private.h"
 
+// The maximum size of the plaintext of a TLS record (RFC 8446 - 5.1)
+#define HTTP_TLS_MAX_RECORD_SIZE (16 * 1024)
+// The size of a piece of a file that is read and sent when sendfile() cannot be used
+#define HTTP_FILE_READ_PIECE_SIZE (256 * 1024)
+
 namespace http
 {
 	namespace svr
@@ -39,6 +44,9 @@ namespace http
 			_is_header_sent = http_response->_is_header_sent;
 			_response_header = http_response->_response_header;
 			_response_data_list = http_response->_response_data_list;
+			_response_file = http_response->_response_file;
+			_response_file_offset = http_response->_response_file_offset;
+			_response_file_length = http_response->_response_file_length;
 			_response_data_size = http_response->_response_data_size;
 			_default_value = http_response->_default_value;
 			_created_time = http_response->_created_time;
@@ -155,6 +163,12 @@ namespace http
 
 			std::lock_guard<decltype(_response_mutex)> lock(_response_mutex);
 
+			if (_response_file != nullptr)
+			{
+				logtw("Cannot append data after the file: %s", _client_socket->ToString().CStr());
+				return false;
+			}
+
 			auto cloned_data = data->Clone();
 
 			_response_data_list.push_back(cloned_data);
@@ -168,10 +182,32 @@ namespace http
 			return AppendData(string.ToData(false));
 		}
 
-		bool HttpResponse::AppendFile(const ov::String &filename)
+		bool HttpResponse::AppendFile(const std::shared_ptr<const ov::OpenedFile> &file, off_t offset, size_t length)
+		{
+			if (file == nullptr)
+			{
+				return false;
+			}
+
+			std::lock_guard<decltype(_response_mutex)> lock(_response_mutex);
+
+			if (_response_file != nullptr)
+			{
+				logtw("Only one file can be appended: %s", _client_socket->ToString().CStr());
+				return false;
+			}
+
+			_response_file = file;
+			_response_file_offset = offset;
+			_response_file_length = length;
+			_response_data_size += length;
+
+			return true;
+		}
+
+		bool HttpResponse::IsSendFileAvailable() const
 		{
-			OV_ASSERT(false, "Not implemented");
-			return false;
+			return (_tls_data == nullptr) || _tls_data->IsKtlsSendEnabled();
 		}
 
 		bool HttpResponse::IsHeaderSent() const
@@ -200,9 +236,27 @@ namespace http
 		void HttpResponse::ResetResponseData()
 		{
 			_response_data_list.clear();
+			_response_file = nullptr;
+			_response_file_offset = 0;
+			_response_file_length = 0;
 			_response_data_size = 0ULL;
 		}
 
+		const std::shared_ptr<const ov::OpenedFile> &HttpResponse::GetResponseFile() const
+		{
+			return _response_file;
+		}
+
+		off_t HttpResponse::GetResponseFileOffset() const
+		{
+			return _response_file_offset;
+		}
+
+		size_t HttpResponse::GetResponseFileLength() const
+		{
+			return _response_file_length;
+		}
+
 		// Get Created Time
 		std::chrono::system_clock::time_point HttpResponse::GetCreatedTime() const
 		{
@@ -226,6 +280,37 @@ namespace http
 			std::lock_guard<decltype(_response_mutex)> lock(_response_mutex);
 			_response_time = std::chrono::system_clock::now();
 
+			_is_corked = true;
+			auto sent_size = SendHeaderAndPayload();
+			_is_corked = false;
+
+			auto corked_data_list = std::move(_corked_data_list);
+			_corked_data_list.clear();
+			auto corked_file = std::move(_corked_file);
+			_corked_file = nullptr;
+
+			if (sent_size < 0)
+			{
+				return -1;
+			}
+
+			if ((corked_data_list.empty() == false) && (Send(corked_data_list) == false))
+			{
+				return -1;
+			}
+
+			if ((corked_file != nullptr) && (SendFile(corked_file, _corked_file_offset, _corked_file_length) == false))
+			{
+				return -1;
+			}
+
+			_sent_size += sent_size;
+
+			return sent_size;
+		}
+
+		int32_t HttpResponse::SendHeaderAndPayload()
+		{
 			uint32_t sent_size = 0;
 
 			if (IsHeaderSent() == false)
@@ -252,10 +337,8 @@ namespace http
 
 			sent_size += sent_data_size;
 
-			_sent_size += sent_size;
-
 			return sent_size;
-		}	
+		}
 
 		int32_t HttpResponse::SendHeader()
 		{
@@ -280,6 +363,12 @@ namespace http
 				return false;
 			}
 
+			if (_is_corked)
+			{
+				_corked_data_list.push_back(data);
+				return true;
+			}
+
 			std::shared_ptr<const ov::Data> send_data;
 
 			if (_tls_data == nullptr)
@@ -304,6 +393,134 @@ namespace http
 			return _client_socket->Send(send_data);
 		}
 
+		bool HttpResponse::Send(const std::vector<std::shared_ptr<const ov::Data>> &data_list)
+		{
+			if (_is_corked)
+			{
+				_corked_data_list.insert(_corked_data_list.end(), data_list.begin(), data_list.end());
+				return true;
+			}
+
+			if (_tls_data == nullptr)
+			{
+				return _client_socket->Send(data_list);
+			}
+
+			std::vector<std::shared_ptr<const ov::Data>> cipher_data_list;
+			std::shared_ptr<ov::Data> pending_data;
+
+			auto encrypt = [&](const std::shared_ptr<const ov::Data> &data) -> bool {
+				std::shared_ptr<const ov::Data> cipher_data;
+
+				if (_tls_data->Encrypt(data, &cipher_data) == false)
+				{
+					logte("Failed to encrypt data: %s", _client_socket->ToString().CStr());
+					return false;
+				}
+
+				if ((cipher_data != nullptr) && (cipher_data->IsEmpty() == false))
+				{
+					cipher_data_list.push_back(cipher_data);
+				}
+
+				return true;
+			};
+
+			// Small buffers are merged up to the maximum TLS record size, so that they are not encrypted into many small records
+			for (const auto &data : data_list)
+			{
+				if ((data == nullptr) || data->IsEmpty())
+				{
+					continue;
+				}
+
+				if ((pending_data != nullptr) && ((pending_data->GetLength() + data->GetLength()) > HTTP_TLS_MAX_RECORD_SIZE))
+				{
+					if (encrypt(pending_data) == false)
+					{
+						return false;
+					}
+
+					pending_data = nullptr;
+				}
+
+				if (data->GetLength() >= HTTP_TLS_MAX_RECORD_SIZE)
+				{
+					if (encrypt(data) == false)
+					{
+						return false;
+					}
+
+					continue;
+				}
+
+				if (pending_data == nullptr)
+				{
+					pending_data = std::make_shared<ov::Data>(HTTP_TLS_MAX_RECORD_SIZE);
+				}
+
+				pending_data->Append(data);
+			}
+
+			if ((pending_data != nullptr) && (encrypt(pending_data) == false))
+			{
+				return false;
+			}
+
+			if (cipher_data_list.empty())
+			{
+				// There is no data to send
+				return true;
+			}
+
+			return _client_socket->Send(cipher_data_list);
+		}
+
+		bool HttpResponse::SendFile(const std::shared_ptr<const ov::OpenedFile> &file, off_t offset, size_t length)
+		{
+			if (file == nullptr)
+			{
+				OV_ASSERT2(file != nullptr);
+				return false;
+			}
+
+			if (_is_corked)
+			{
+				// Sent after the corked data
+				_corked_file = file;
+				_corked_file_offset = offset;
+				_corked_file_length = length;
+				return true;
+			}
+
+			if (IsSendFileAvailable())
+			{
+				return _client_socket->SendFile(file, offset, length);
+			}
+
+			while (length > 0)
+			{
+				auto piece_size = std::min<size_t>(length, HTTP_FILE_READ_PIECE_SIZE);
+				auto piece = file->Read(offset, piece_size);
+
+				if ((piece == nullptr) || (piece->GetLength() != piece_size))
+				{
+					logte("Could not read the file: %s (offset: %jd, %zu bytes), %s", file->GetPath().CStr(), static_cast<intmax_t>(offset), piece_size, _client_socket->ToString().CStr());
+					return false;
+				}
+
+				if (Send(piece) == false)
+				{
+					return false;
+				}
+
+				offset += piece_size;
+				length -= piece_size;
+			}
+
+			return true;
+		}
+
 		bool HttpResponse::Close()
 		{
 			OV_ASSERT2(_client_socket != nullptr);
@@ -50,7 +50,12 @@ namespace http
 			// Can be used for response with content-length
 			bool AppendData(const std::shared_ptr<const ov::Data> &data);
 			bool AppendString(const ov::String &string);
-			bool AppendFile(const ov::String &filename);
+			// Enqueue a region of the file, which is sent after the data appended before (data cannot be appended after it).
+			// The region is sent with sendfile() if IsSendFileAvailable(), otherwise it is read and sent in pieces
+			bool AppendFile(const std::shared_ptr<const ov::OpenedFile> &file, off_t offset, size_t length);
+
+			// Whether a file can be sent without being read into the user space (plain HTTP/1.1 or kTLS)
+			virtual bool IsSendFileAvailable() const;
 
 			int32_t Response();
 
@@ -67,14 +72,18 @@ namespace http
 
 			bool Close();
 
-		protected:
 			bool IsHeaderSent() const;
-			
+
+		protected:
 			// Get Response Data List
 			const std::vector<std::shared_ptr<const ov::Data>> &GetResponseDataList() const;
 			// Get Response Header
 			const std::unordered_map<ov::String, std::vector<ov::String>, ov::CaseInsensitiveHash, ov::CaseInsensitiveEqual> &GetResponseHeaderList() const;
 			void ResetResponseData();
+			// The region appended by AppendFile() (the file is nullptr if there is none)
+			const std::shared_ptr<const ov::OpenedFile> &GetResponseFile() const;
+			off_t GetResponseFileOffset() const;
+			size_t GetResponseFileLength() const;
 
 			// Can be used for response without content-length
 			template <typename T>
@@ -84,10 +93,15 @@ namespace http
 			}
 			virtual bool Send(const void *data, size_t length);
 			virtual bool Send(const std::shared_ptr<const ov::Data> &data);
+			// Sends the buffers without concatenating them (they are written with a single sendmsg() if possible)
+			virtual bool Send(const std::vector<std::shared_ptr<const ov::Data>> &data_list);
+			// Sends a region of the file after the data sent before
+			bool SendFile(const std::shared_ptr<const ov::OpenedFile> &file, off_t offset, size_t length);
 			
 		private:
 			virtual int32_t SendHeader();
 			virtual int32_t SendPayload();
+			int32_t SendHeaderAndPayload();
 
 			std::shared_ptr<ov::ClientSocket> _client_socket;
 			std::shared_ptr<ov::TlsServerData> _tls_data;
@@ -96,6 +110,14 @@ namespace http
 			ov::String _reason = StringFromStatusCode(StatusCode::OK);
 
 			bool _is_header_sent = false;
+
+			// While Response() is in progress, Send() collects the data to send the header and the payload at once
+			// (a small response is encrypted into a TLS record, and written with a send)
+			bool _is_corked = false;
+			std::vector<std::shared_ptr<const ov::Data>> _corked_data_list;
+			std::shared_ptr<const ov::OpenedFile> _corked_file;
+			off_t _corked_file_offset = 0;
+			size_t _corked_file_length = 0;
 			
 			// FIXME(dimiden): It is supposed to be synchronized whenever a packet is sent, but performance needs to be improved
 			std::recursive_mutex _response_mutex;
@@ -114,6 +136,10 @@ namespace http
 			// So _response_header is a map of case insentitive header key and value
 			std::unordered_map<ov::String, std::vector<ov::String>, ov::CaseInsensitiveHash, ov::CaseInsensitiveEqual> _response_header;
 			std::vector<std::shared_ptr<const ov::Data>> _response_data_list;
+			std::shared_ptr<const ov::OpenedFile> _response_file;
+			off_t _response_file_offset = 0;
+			size_t _response_file_length = 0;
+			// Including the length of the file region
 			size_t _response_data_size = 0;
 
 			std::vector<ov::String> _default_value{};
@@ -0,0 +1,143 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/info/certificate.h>
+#include <base/ovlibrary/ovlibrary.h>
+
+namespace http
+{
+	namespace svr
+	{
+		// An immutable index from a host name (SNI) to <Tvalue>, which has the certificate as <Tvalue::certificate>.
+		//
+		// It is built from the certificate map whenever the map is changed, and the TLS handshakes look it up without any lock.
+		// The host names are matched in this order:
+		//   1. The exact host names
+		//   2. The wildcards of the form "*.<domain>" (the one with the longest domain), found in a trie of the labels
+		//   3. The other wildcards (e.g. "ome-*.example.com"), matched with the regex of the certificate
+		template <typename Tvalue>
+		class HttpsCertificateIndex
+		{
+		public:
+			// If a host name is used by multiple certificates, the first one in <certificate_map> is used
+			template <typename Tmap>
+			explicit HttpsCertificateIndex(const Tmap &certificate_map)
+			{
+				for (const auto &[certificate_name, value] : certificate_map)
+				{
+					bool has_other_wildcard = false;
+
+					for (const auto &host_name : value->certificate->GetHostNameList())
+					{
+						if ((host_name.IndexOf('*') < 0) && (host_name.IndexOf('?') < 0))
+						{
+							_exact_map.emplace(host_name, value);
+							continue;
+						}
+
+						auto domain = host_name.HasPrefix("*.") ? host_name.Substring(2) : "";
+
+						if ((domain.IsEmpty() == false) && (domain.IndexOf('*') < 0) && (domain.IndexOf('?') < 0))
+						{
+							auto labels = domain.Split(".");
+							auto node = &_root;
+
+							for (auto label = labels.rbegin(); label != labels.rend(); ++label)
+							{
+								auto &child = node->children[*label];
+
+								if (child == nullptr)
+								{
+									child = std::make_unique<Node>();
+								}
+
+								node = child.get();
+							}
+
+							if (node->wildcard_value == nullptr)
+							{
+								node->wildcard_value = value;
+							}
+
+							continue;
+						}
+
+						has_other_wildcard = true;
+					}
+
+					if (has_other_wildcard)
+					{
+						_other_wildcard_list.push_back(value);
+					}
+				}
+			}
+
+			// Returns nullptr if there is no certificate for <host_name>
+			std::shared_ptr<Tvalue> Find(const ov::String &host_name) const
+			{
+				auto exact_item = _exact_map.find(host_name);
+
+				if (exact_item != _exact_map.end())
+				{
+					return exact_item->second;
+				}
+
+				// Walks the trie from the last label (e.g. "com" of "www.example.com")
+				auto labels = host_name.Split(".");
+				auto node = &_root;
+				std::shared_ptr<Tvalue> matched_value;
+
+				for (auto label = labels.rbegin(); label != labels.rend(); ++label)
+				{
+					auto child = node->children.find(*label);
+
+					if (child == node->children.end())
+					{
+						break;
+					}
+
+					node = child->second.get();
+
+					// "*.<domain>" matches only if the host name has more labels than the domain
+					if ((node->wildcard_value != nullptr) && ((label + 1) != labels.rend()))
+					{
+						matched_value = node->wildcard_value;
+					}
+				}
+
+				if (matched_value != nullptr)
+				{
+					return matched_value;
+				}
+
+				for (const auto &value : _other_wildcard_list)
+				{
+					if (value->certificate->IsCertificateForHost(host_name))
+					{
+						return value;
+					}
+				}
+
+				return nullptr;
+			}
+
+		private:
+			struct Node
+			{
+				std::unordered_map<ov::String, std::unique_ptr<Node>> children;
+				// The value of "*.<the labels from the root to this node>"
+				std::shared_ptr<Tvalue> wildcard_value;
+			};
+
+			std::unordered_map<ov::String, std::shared_ptr<Tvalue>> _exact_map;
+			Node _root;
+			std::vector<std::shared_ptr<Tvalue>> _other_wildcard_list;
+		};
+	}  // namespace svr
+}  // namespace http
@@ -56,6 +56,8 @@ namespace http
 			_https_certificate_map.erase(certificate->GetName());
 			_https_certificate_map.emplace(certificate->GetName(), std::make_shared<HttpsCertificate>(certificate, tls_context));
 
+			RebuildCertificateIndex();
+
 			return nullptr;
 		}
 
@@ -67,9 +69,16 @@ namespace http
 
 			_https_certificate_map.erase(certificate->GetName());
 
+			RebuildCertificateIndex();
+
 			return nullptr;
 		}
 
+		void HttpsServer::RebuildCertificateIndex()
+		{
+			std::atomic_store(&_https_certificate_index, std::make_shared<const HttpsCertificateIndex<HttpsCertificate>>(_https_certificate_map));
+		}
+
 		// Deprecated
 		std::shared_ptr<const ov::Error> HttpsServer::AppendCertificateList(const std::vector<std::shared_ptr<const info::Certificate>> &certificate_list)
 		{
@@ -119,6 +128,18 @@ namespace http
 				return remote->Send(data, length) ? length : -1L;
 			});
 
+			if (_ktls_enabled)
+			{
+				auto remote_ptr = remote.get();
+
+				if (tls_data->EnableKtls(remote->GetNativeHandle(), [remote_ptr]() -> bool {
+						return (remote_ptr->HasCommand() == false);
+					}) == false)
+				{
+					logtd("kTLS is not available: %s", remote->ToString().CStr());
+				}
+			}
+
 			client->SetTlsData(tls_data);
 		}
 
@@ -175,16 +196,11 @@ namespace http
 		{
 			std::shared_ptr<HttpsCertificate> https_certificate;
 
+			auto certificate_index = std::atomic_load(&_https_certificate_index);
+
+			if (certificate_index != nullptr)
 			{
-				std::lock_guard lock_guard(_https_certificate_map_mutex);
-				for (auto &[vhost_name, https_cert] : _https_certificate_map)
-				{
-					if (https_cert->certificate->IsCertificateForHost(server_name))
-					{
-						https_certificate = https_cert;
-						break;
-					}
-				}
+				https_certificate = certificate_index->Find(server_name);
 			}
 
 			if (https_certificate == nullptr)
@@ -10,6 +10,7 @@
 
 #include "base/info/host.h"
 #include "http_server.h"
+#include "https_certificate_index.h"
 #include "orchestrator/orchestrator.h"
 
 namespace http
@@ -30,6 +31,17 @@ namespace http
 			// Deprecated
 			std::shared_ptr<const ov::Error> AppendCertificateList(const std::vector<std::shared_ptr<const info::Certificate>> &certificate_list);
 
+			// If enabled, the encryption of the responses is offloaded to the kernel (kTLS) when possible
+			void SetKtlsEnabled(bool enabled)
+			{
+				_ktls_enabled = enabled;
+			}
+
+			bool IsKtlsEnabled() const
+			{
+				return _ktls_enabled;
+			}
+
 		protected:
 			struct HttpsCertificate
 			{
@@ -54,11 +66,18 @@ namespace http
 		protected:
 			bool HandleSniCallback(ov::TlsContext *tls_context, SSL *ssl, const ov::String &server_name);
 
+			// _https_certificate_map_mutex must be held
+			void RebuildCertificateIndex();
+
 		protected:
 			std::mutex _https_certificate_map_mutex;
 
 			// Certificate Name : HttpsCertificate
 			std::map<ov::String, std::shared_ptr<HttpsCertificate>> _https_certificate_map;
+			// Built from _https_certificate_map, and replaced with atomic_store() when the map is changed
+			std::shared_ptr<const HttpsCertificateIndex<HttpsCertificate>> _https_certificate_index;
+
+			bool _ktls_enabled = false;
 		};
 	}  // namespace svr
 }  // namespace http
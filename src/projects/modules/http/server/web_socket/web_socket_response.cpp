@@ -29,7 +29,7 @@ namespace http
 			{
 			}
 
-			ssize_t WebSocketResponse::Send(const std::shared_ptr<const ov::Data> &data, prot::ws::FrameOpcode opcode)
+			std::shared_ptr<const ov::Data> WebSocketResponse::MakeFrameHeader(prot::ws::FrameOpcode opcode, size_t payload_length)
 			{
 				// RFC6455 - 5.2.  Base Framing Protocol
 				//
@@ -41,18 +41,16 @@ namespace http
 					.payload_length = 0,
 					.mask = false};
 
-				size_t length = (data == nullptr) ? 0LL : data->GetLength();
-
-				if (length < 0x7D)
+				if (payload_length <= 0x7D)
 				{
 					// frame-payload-length    = ( %x00-7D )
 					//                         / ( %x7E frame-payload-length-16 )
 					//                         / ( %x7F frame-payload-length-63 )
 					//                         ; 7, 7+16, or 7+64 bits in length,
 					//                         ; respectively
-					header.payload_length = static_cast<uint8_t>(length);
+					header.payload_length = static_cast<uint8_t>(payload_length);
 				}
-				else if (length < 0xFFFF)
+				else if (payload_length <= 0xFFFF)
 				{
 					// frame-payload-length-16 = %x0000-FFFF ; 16 bits in length
 					header.payload_length = 126;
@@ -64,28 +62,60 @@ namespace http
 					header.payload_length = 127;
 				}
 
-				auto response_data = std::make_shared<ov::Data>(65535);
+				// Header (2) + extended payload length (up to 8)
+				auto header_data = std::make_shared<ov::Data>(sizeof(header) + sizeof(uint64_t));
 
-				response_data->Append(&header, sizeof(header));
+				header_data->Append(&header, sizeof(header));
 
 				if (header.payload_length == 126)
 				{
-					auto payload_length = ov::HostToNetwork16(static_cast<uint16_t>(length));
-					response_data->Append(&payload_length, sizeof(payload_length));
+					auto extended_length = ov::HostToNetwork16(static_cast<uint16_t>(payload_length));
+					header_data->Append(&extended_length, sizeof(extended_length));
 				}
 				else if (header.payload_length == 127)
 				{
-					auto payload_length = ov::HostToNetwork64(static_cast<uint64_t>(length));
-					response_data->Append(&payload_length, sizeof(payload_length));
+					auto extended_length = ov::HostToNetwork64(static_cast<uint64_t>(payload_length));
+					header_data->Append(&extended_length, sizeof(extended_length));
+				}
+
+				return header_data;
+			}
+
+			size_t WebSocketResponse::Broadcast(const std::vector<std::shared_ptr<WebSocketResponse>> &responses,
+												const std::shared_ptr<const ov::Data> &data, prot::ws::FrameOpcode opcode)
+			{
+				auto frame_header = MakeFrameHeader(opcode, (data == nullptr) ? 0 : data->GetLength());
+				size_t sent_count = 0;
+
+				for (const auto &response : responses)
+				{
+					if ((response != nullptr) && (response->SendFrame(frame_header, data) >= 0))
+					{
+						sent_count++;
+					}
 				}
 
-				if (length > 0LL)
+				return sent_count;
+			}
+
+			ssize_t WebSocketResponse::Send(const std::shared_ptr<const ov::Data> &data, prot::ws::FrameOpcode opcode)
+			{
+				return SendFrame(MakeFrameHeader(opcode, (data == nullptr) ? 0 : data->GetLength()), data);
+			}
+
+			ssize_t WebSocketResponse::SendFrame(const std::shared_ptr<const ov::Data> &frame_header, const std::shared_ptr<const ov::Data> &data)
+			{
+				size_t length = (data == nullptr) ? 0LL : data->GetLength();
+
+				if (length == 0LL)
 				{
-					logtd("Trying to send data\n%s", data->Dump(32).CStr());
-					response_data->Append(data);
+					return HttpResponse::Send(frame_header) ? 0LL : -1LL;
 				}
 
-				return HttpResponse::Send(response_data) ? length : -1LL;
+				logtd("Trying to send data\n%s", data->Dump(32).CStr());
+
+				// The payload is not copied into the frame
+				return HttpResponse::Send({frame_header, data}) ? length : -1LL;
 			}
 
 			ssize_t WebSocketResponse::Send(const ov::String &string)
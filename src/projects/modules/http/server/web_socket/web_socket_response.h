@@ -31,9 +31,23 @@ namespace http
 				WebSocketResponse(const std::shared_ptr<HttpResponse> &http_respose);
 				virtual ~WebSocketResponse();
 
+				// Makes the header of a server frame (FIN, not masked) that carries <payload_length> bytes
+				static std::shared_ptr<const ov::Data> MakeFrameHeader(prot::ws::FrameOpcode opcode, size_t payload_length);
+
+				// Sends the same frame to all <responses>.
+				// The frame header is made once, and the header and <data> are sent without being concatenated.
+				//
+				// @return Returns the number of responses to which the frame was sent
+				static size_t Broadcast(const std::vector<std::shared_ptr<WebSocketResponse>> &responses,
+										const std::shared_ptr<const ov::Data> &data, prot::ws::FrameOpcode opcode);
+
 				ssize_t Send(const std::shared_ptr<const ov::Data> &data, prot::ws::FrameOpcode opcode);
 				ssize_t Send(const ov::String &string);
 				ssize_t Send(const Json::Value &value);
+
+			protected:
+				// <frame_header> must be made by MakeFrameHeader() for <data>
+				ssize_t SendFrame(const std::shared_ptr<const ov::Data> &frame_header, const std::shared_ptr<const ov::Data> &data);
 			};
 		}  // namespace ws
 	} // namespace svr
@@ -0,0 +1,139 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/ovlibrary/ovlibrary.h>
+#include <base/ovsocket/socket_address.h>
+
+// An immutable open-addressing hash table from a peer address (ip, port) to <Tvalue>.
+//
+// It is built from the writer's map whenever the map is changed, and the readers look it up
+// without any lock (see IcePort::PublishAddressTable() for the reclamation of the old tables).
+template <typename Tvalue>
+class IceAddressTable
+{
+public:
+	template <typename Tmap>
+	explicit IceAddressTable(const Tmap &items)
+	{
+		// Keeps the load factor at or below 0.5 so that a lookup ends in a probe or two
+		size_t capacity = 16;
+		while (capacity < items.size() * 2)
+		{
+			capacity <<= 1;
+		}
+
+		_slots.resize(capacity);
+		_mask = capacity - 1;
+
+		for (const auto &[address, value] : items)
+		{
+			Key key;
+			if (MakeKey(address, &key) == false)
+			{
+				continue;
+			}
+
+			for (size_t index = key.hash & _mask;; index = (index + 1) & _mask)
+			{
+				auto &slot = _slots[index];
+
+				if (slot.used == false)
+				{
+					slot.used = true;
+					slot.key = key;
+					slot.value = value;
+					break;
+				}
+			}
+		}
+	}
+
+	// Returns a default-constructed Tvalue if <address> is not in the table
+	Tvalue Find(const ov::SocketAddress &address) const
+	{
+		Key key;
+		if (MakeKey(address, &key) == false)
+		{
+			return {};
+		}
+
+		for (size_t index = key.hash & _mask;; index = (index + 1) & _mask)
+		{
+			auto &slot = _slots[index];
+
+			if (slot.used == false)
+			{
+				return {};
+			}
+
+			if (slot.key == key)
+			{
+				return slot.value;
+			}
+		}
+	}
+
+private:
+	struct Key
+	{
+		// IPv4 addresses are stored as IPv4-mapped IPv6 addresses
+		uint8_t ip[16];
+		uint16_t port;
+		uint32_t hash;
+
+		bool operator==(const Key &other) const
+		{
+			return (port == other.port) && (::memcmp(ip, other.ip, sizeof(ip)) == 0);
+		}
+	};
+
+	struct Slot
+	{
+		bool used = false;
+		Key key;
+		Tvalue value;
+	};
+
+	static bool MakeKey(const ov::SocketAddress &address, Key *key)
+	{
+		if (address.IsIPv4())
+		{
+			::memset(key->ip, 0, 10);
+			key->ip[10] = 0xFF;
+			key->ip[11] = 0xFF;
+			::memcpy(key->ip + 12, &(address.ToIn4Addr()->s_addr), 4);
+		}
+		else if (address.IsIPv6())
+		{
+			::memcpy(key->ip, address.ToIn6Addr()->s6_addr, 16);
+		}
+		else
+		{
+			return false;
+		}
+
+		key->port = address.Port();
+
+		// FNV-1a
+		uint32_t hash = 2166136261u;
+		for (auto byte : key->ip)
+		{
+			hash = (hash ^ byte) * 16777619u;
+		}
+		hash = (hash ^ (key->port & 0xFF)) * 16777619u;
+		hash = (hash ^ (key->port >> 8)) * 16777619u;
+
+		key->hash = hash;
+
+		return true;
+	}
+
+	std::vector<Slot> _slots;
+	size_t _mask = 0;
+};
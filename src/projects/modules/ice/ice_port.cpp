@@ -23,7 +23,12 @@
 #include "modules/ice/stun/channel_data_message.h"
 #include "modules/ice/stun/stun_message.h"
 
+// A snapshot of the address table replaced by a writer is deleted after this period.
+// Readers only use a snapshot during the lookup of a packet, which is far shorter than this.
+#define ICE_ADDRESS_TABLE_GRACE_PERIOD_MS 5000
+
 IcePort::IcePort()
+	: _address_table(new AddressTable(_address_port_table))
 {
 	_timer.Push(
 		[this](void *paramter) -> ov::DelayQueueAction {
@@ -39,6 +44,9 @@ IcePort::~IcePort()
 	_timer.Stop();
 
 	Close();
+
+	DeleteRetiredAddressTables(true);
+	delete _address_table.exchange(nullptr);
 }
 
 bool IcePort::CreateIceCandidates(const char *server_name, const cfg::Server &server_config, const RtcIceCandidateList &ice_candidate_list, int ice_worker_count)
@@ -281,6 +289,35 @@ std::shared_ptr<IcePort::IcePortInfo> IcePort::FindIcePortInfo(uint32_t session_
 	return nullptr;
 }
 
+std::shared_ptr<IcePort::IcePortInfo> IcePort::FindIcePortInfo(const ov::SocketAddress &address) const
+{
+	// The snapshot is not deleted during the grace period even if a writer replaces it
+	return _address_table.load(std::memory_order_acquire)->Find(address);
+}
+
+void IcePort::PublishAddressTable()
+{
+	auto table = new AddressTable(_address_port_table);
+	auto old_table = _address_table.exchange(table, std::memory_order_acq_rel);
+
+	_retired_address_tables.emplace_back(std::chrono::steady_clock::now(), old_table);
+}
+
+void IcePort::DeleteRetiredAddressTables(bool delete_all)
+{
+	auto now = std::chrono::steady_clock::now();
+	auto grace_period = std::chrono::milliseconds(ICE_ADDRESS_TABLE_GRACE_PERIOD_MS);
+
+	// The tables are retired in order, so the expired ones are at the front
+	auto item = _retired_address_tables.begin();
+	while ((item != _retired_address_tables.end()) && (delete_all || ((now - item->first) >= grace_period)))
+	{
+		++item;
+	}
+
+	_retired_address_tables.erase(_retired_address_tables.begin(), item);
+}
+
 void IcePort::AddSession(const std::shared_ptr<IcePortObserver> &observer, uint32_t session_id,
 						 std::shared_ptr<const SessionDescription> local_sdp, std::shared_ptr<const SessionDescription> peer_sdp,
 						 int expired_ms, uint64_t life_time_epoch_ms, std::any user_data)
@@ -306,6 +343,9 @@ void IcePort::AddSession(const std::shared_ptr<IcePortObserver> &observer, uint3
 		info->session_id = session_id;
 		info->local_sdp = local_sdp;
 		info->peer_sdp = peer_sdp;
+		info->local_ufrag = local_ufrag;
+		// TODO: apply SASLprep(password)
+		info->local_integrity_key = ov::HmacKey::Create(ov::CryptoAlgorithm::Sha1, local_sdp->GetIcePwd().ToData(false));
 		info->remote = nullptr;
 		info->address = ov::SocketAddress();
 		info->state = IcePortConnectionState::Closed;
@@ -398,6 +438,7 @@ bool IcePort::RemoveSession(uint32_t session_id)
 		{
 			_address_port_table.erase(item.first);
 		}
+		PublishAddressTable();
 
 		// Close only TCP (TURN)
 		auto remote = ice_port_info->remote;
@@ -467,6 +508,13 @@ void IcePort::CheckTimedoutItem()
 				_address_port_table.erase(item.first);
 			}
 		}
+
+		if (delete_list.empty() == false)
+		{
+			PublishAddressTable();
+		}
+
+		DeleteRetiredAddressTables(false);
 	}
 
 	// Notify to observer
@@ -506,6 +554,56 @@ bool IcePort::Send(uint32_t session_id, std::shared_ptr<RtcpPacket> packet)
 	return Send(session_id, packet->GetData());
 }
 
+bool IcePort::Send(uint32_t session_id, const std::vector<std::shared_ptr<const ov::Data>> &data_list)
+{
+	std::shared_ptr<IcePortInfo> ice_port_info;
+	{
+		std::lock_guard<std::mutex> lock_guard(_port_table_lock);
+
+		auto item = _session_port_table.find(session_id);
+		if (item == _session_port_table.end())
+		{
+			logtd("ClientSocket not found for session #%d", session_id);
+			return false;
+		}
+
+		ice_port_info = item->second;
+	}
+
+	if (ice_port_info->is_turn_client == true)
+	{
+		if (ice_port_info->is_data_channel_enabled == true)
+		{
+			auto remote = ice_port_info->remote;
+
+			if ((remote != nullptr) && (remote->GetType() == ov::SocketType::Tcp))
+			{
+				return SendChannelDataOverTcp(remote, ice_port_info->data_channle_number, data_list);
+			}
+		}
+
+		// TURN messages are wrapped per packet, so they are sent one by one
+		for (auto &data : data_list)
+		{
+			if (Send(session_id, data) == false)
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	auto remote = ice_port_info->remote;
+
+	if (remote == nullptr)
+	{
+		return false;
+	}
+
+	return remote->SendTo(ice_port_info->address, data_list);
+}
+
 bool IcePort::Send(uint32_t session_id, const std::shared_ptr<const ov::Data> &data)
 {
 	std::shared_ptr<IcePortInfo> ice_port_info;
@@ -527,6 +625,13 @@ bool IcePort::Send(uint32_t session_id, const std::shared_ptr<const ov::Data> &d
 	// Send throutgh TURN data channel
 	if (ice_port_info->is_turn_client == true && ice_port_info->is_data_channel_enabled == true)
 	{
+		auto remote = ice_port_info->remote;
+
+		if ((remote != nullptr) && (remote->GetType() == ov::SocketType::Tcp))
+		{
+			return SendChannelDataOverTcp(remote, ice_port_info->data_channle_number, {data});
+		}
+
 		send_data = CreateChannelDataMessage(ice_port_info->data_channle_number, data);
 	}
 	// Send thourgh DATA indication
@@ -605,8 +710,8 @@ void IcePort::OnDataReceived(const std::shared_ptr<ov::Socket> &remote, const ov
 			auto packet = demultiplexer->PopPacket();
 
 			GateInfo gate_info;
-			gate_info.packet_type = packet->GetPacketType();
-			OnPacketReceived(remote, address, gate_info, packet->GetData());
+			gate_info.packet_type = packet.GetPacketType();
+			OnPacketReceived(remote, address, gate_info, packet.GetData());
 		}
 	}
 	else if (remote->GetType() == ov::SocketType::Udp)
@@ -643,22 +748,7 @@ void IcePort::OnPacketReceived(const std::shared_ptr<ov::Socket> &remote, const
 void IcePort::OnApplicationPacketReceived(const std::shared_ptr<ov::Socket> &remote, const ov::SocketAddress &address,
 										  GateInfo &gate_info, const std::shared_ptr<const ov::Data> &data)
 {
-	std::shared_ptr<IcePortInfo> ice_port_info;
-	{
-		std::lock_guard<std::mutex> lock_guard(_port_table_lock);
-		auto item = _address_port_table.find(address);
-		if (item != _address_port_table.end())
-		{
-			ice_port_info = item->second;
-			// When the candidate pair is determined, the peer starts sending DTLS messages. This can be seen as a true connected.
-			if (ice_port_info->state != IcePortConnectionState::Connected)
-			{
-				SetIceState(ice_port_info, IcePortConnectionState::Connected);
-				// It communicates with the candidate address that sends application data first.
-				ice_port_info->address = address;
-			}
-		}
-	}
+	auto ice_port_info = FindIcePortInfo(address);
 
 	if (ice_port_info == nullptr)
 	{
@@ -666,6 +756,19 @@ void IcePort::OnApplicationPacketReceived(const std::shared_ptr<ov::Socket> &rem
 		return;
 	}
 
+	// When the candidate pair is determined, the peer starts sending DTLS messages. This can be seen as a true connected.
+	if (ice_port_info->state != IcePortConnectionState::Connected)
+	{
+		std::lock_guard<std::mutex> lock_guard(_port_table_lock);
+
+		if (ice_port_info->state != IcePortConnectionState::Connected)
+		{
+			SetIceState(ice_port_info, IcePortConnectionState::Connected);
+			// It communicates with the candidate address that sends application data first.
+			ice_port_info->address = address;
+		}
+	}
+
 	if (ice_port_info->observer != nullptr)
 	{
 		// Some webrtc peer does not send STUN Binding Request repeatedly. So, I determine the peer is alive by receiving application data.
@@ -710,6 +813,11 @@ void IcePort::OnChannelDataPacketReceived(const std::shared_ptr<ov::Socket> &rem
 
 void IcePort::OnStunPacketReceived(const std::shared_ptr<ov::Socket> &remote, const ov::SocketAddress &address, GateInfo &gate_info, const std::shared_ptr<const ov::Data> &data)
 {
+	if ((gate_info.input_method == GateInfo::GateType::DIRECT) && ProcessStunBindingRequestFast(remote, address, gate_info, data))
+	{
+		return;
+	}
+
 	ov::ByteStream stream(data.get());
 	StunMessage message;
 
@@ -853,6 +961,7 @@ bool IcePort::ProcessStunBindingRequest(const std::shared_ptr<ov::Socket> &remot
 				_address_port_table.erase(item.first);
 			}
 			_session_port_table.erase(ice_port_info->session_id);
+			PublishAddressTable();
 		}
 
 		return false;
@@ -878,6 +987,7 @@ bool IcePort::ProcessStunBindingRequest(const std::shared_ptr<ov::Socket> &remot
 
 		_address_port_table[address] = ice_port_info;
 		_session_port_table[ice_port_info->session_id] = ice_port_info;
+		PublishAddressTable();
 
 		SetIceState(ice_port_info, IcePortConnectionState::Checking);
 	}
@@ -916,6 +1026,57 @@ bool IcePort::ProcessStunBindingRequest(const std::shared_ptr<ov::Socket> &remot
 	return true;
 }
 
+bool IcePort::ProcessStunBindingRequestFast(const std::shared_ptr<ov::Socket> &remote, const ov::SocketAddress &address, GateInfo &gate_info, const std::shared_ptr<const ov::Data> &data)
+{
+	StunBindingMessage::Request request;
+
+	if (StunBindingMessage::ParseRequest(data->GetData(), data->GetLength(), &request) == false)
+	{
+		return false;
+	}
+
+	auto ice_port_info = FindIcePortInfo(address);
+	if (ice_port_info == nullptr)
+	{
+		return false;
+	}
+
+	// Same conditions as ProcessStunBindingRequest() updating the client
+	if ((ice_port_info->state == IcePortConnectionState::New) ||
+		((ice_port_info->state == IcePortConnectionState::Checking) && (ice_port_info->address != address)))
+	{
+		return false;
+	}
+
+	if ((ice_port_info->local_integrity_key == nullptr) ||
+		(ice_port_info->local_ufrag.GetLength() != request.local_ufrag_length) ||
+		(::memcmp(ice_port_info->local_ufrag.CStr(), request.local_ufrag, request.local_ufrag_length) != 0))
+	{
+		return false;
+	}
+
+	ice_port_info->UpdateBindingTime();
+
+	// If the class is Indication it doesn't need to send response
+	if (request.is_indication == false)
+	{
+		uint8_t response[StunBindingMessage::MaxResponseLength];
+		auto response_length = StunBindingMessage::MakeSuccessResponse(request.transaction_id, address, *(ice_port_info->local_integrity_key), response, sizeof(response));
+
+		if (response_length == 0)
+		{
+			return false;
+		}
+
+		remote->SendTo(address, response, response_length);
+
+		// Immediately, the server also sends a bind request.
+		SendStunBindingRequest(remote, address, gate_info, ice_port_info);
+	}
+
+	return true;
+}
+
 bool IcePort::SendStunBindingRequest(const std::shared_ptr<ov::Socket> &remote, const ov::SocketAddress &address, GateInfo &gate_info, const std::shared_ptr<IcePortInfo> &info)
 {
 	StunMessage message;
@@ -1084,6 +1245,16 @@ const std::shared_ptr<const ov::Data> IcePort::CreateDataIndication(ov::SocketAd
 	return send_data;
 }
 
+bool IcePort::SendChannelDataOverTcp(const std::shared_ptr<ov::Socket> &remote, uint16_t channel_number, const std::vector<std::shared_ptr<const ov::Data>> &data_list)
+{
+	// The payloads are not copied into the messages. The headers, payloads and paddings are written at once with sendmsg().
+	std::vector<std::shared_ptr<const ov::Data>> framed_data_list;
+
+	ChannelDataMessage::FrameDataList(channel_number, data_list, framed_data_list);
+
+	return remote->Send(framed_data_list);
+}
+
 const std::shared_ptr<const ov::Data> IcePort::CreateChannelDataMessage(uint16_t channel_number, const std::shared_ptr<const ov::Data> &data)
 {
 	ChannelDataMessage channel_data_message(channel_number, data);
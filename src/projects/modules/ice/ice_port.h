@@ -8,8 +8,10 @@
 //==============================================================================
 #pragma once
 
+#include "ice_address_table.h"
 #include "ice_port_observer.h"
 #include "ice_tcp_demultiplexer.h"
+#include "modules/ice/stun/stun_binding_message.h"
 #include "modules/ice/stun/stun_message.h"
 
 #include <vector>
@@ -87,6 +89,10 @@ protected:
 		std::shared_ptr<const SessionDescription> local_sdp;
 		std::shared_ptr<const SessionDescription> peer_sdp;
 
+		// Cached for the binding requests of the connected client
+		ov::String local_ufrag;
+		std::shared_ptr<ov::HmacKey> local_integrity_key;
+
 		std::shared_ptr<ov::Socket> remote;
 		ov::SocketAddress address;
 		std::map<ov::SocketAddress, bool> address_map;
@@ -196,6 +202,8 @@ public:
 	bool Send(uint32_t session_id, std::shared_ptr<RtpPacket> packet);
 	bool Send(uint32_t session_id, std::shared_ptr<RtcpPacket> packet);
 	bool Send(uint32_t session_id, const std::shared_ptr<const ov::Data> &data);
+	// Sends a burst of packets to the same session with as few system calls as possible
+	bool Send(uint32_t session_id, const std::vector<std::shared_ptr<const ov::Data>> &data_list);
 
 	ov::String ToString() const;
 
@@ -217,6 +225,12 @@ protected:
 private:
 	// Get IcePortInfo
 	std::shared_ptr<IcePortInfo> FindIcePortInfo(uint32_t session_id);
+	// Finds IcePortInfo with peer's ip:port without lock (for the packet path)
+	std::shared_ptr<IcePortInfo> FindIcePortInfo(const ov::SocketAddress &address) const;
+
+	// Must be called with _port_table_lock whenever _address_port_table is changed
+	void PublishAddressTable();
+	void DeleteRetiredAddressTables(bool delete_all);
 
 	void CheckTimedoutItem();
 
@@ -237,6 +251,8 @@ private:
 
 	const std::shared_ptr<const ov::Data> CreateDataIndication(ov::SocketAddress peer_address, const std::shared_ptr<const ov::Data> &data);
 	const std::shared_ptr<const ov::Data> CreateChannelDataMessage(uint16_t channel_number, const std::shared_ptr<const ov::Data> &data);
+	// Sends the ChannelData messages of <data_list> through a TURN/TCP connection without copying the payloads
+	bool SendChannelDataOverTcp(const std::shared_ptr<ov::Socket> &remote, uint16_t channel_number, const std::vector<std::shared_ptr<const ov::Data>> &data_list);
 
 	// STUN negotiation order:
 	// (State: New)
@@ -247,6 +263,9 @@ private:
 	// [Server] <-- 4. Binding Success Response --- [Player]
 	// (State: Connected)
 	bool ProcessStunBindingRequest(const std::shared_ptr<ov::Socket> &remote, const ov::SocketAddress &address, GateInfo &packet_info, const StunMessage &message);
+	// Handles the binding requests (consent freshness) of a checked client without parsing StunMessage.
+	// Returns false if the request needs ProcessStunBindingRequest() (e.g. a new client or address).
+	bool ProcessStunBindingRequestFast(const std::shared_ptr<ov::Socket> &remote, const ov::SocketAddress &address, GateInfo &packet_info, const std::shared_ptr<const ov::Data> &data);
 	bool ProcessStunBindingResponse(const std::shared_ptr<ov::Socket> &remote, const ov::SocketAddress &address, GateInfo &packet_info, const StunMessage &message);
 	bool ProcessTurnAllocateRequest(const std::shared_ptr<ov::Socket> &remote, const ov::SocketAddress &address, GateInfo &packet_info, const StunMessage &message);
 	bool ProcessTurnRefreshRequest(const std::shared_ptr<ov::Socket> &remote, const ov::SocketAddress &address, GateInfo &packet_info, const StunMessage &message);
@@ -278,6 +297,11 @@ private:
 	// key: SocketAddress value: IcePortInfo
 	std::mutex _port_table_lock;
 	std::map<ov::SocketAddress, std::shared_ptr<IcePortInfo>> _address_port_table;
+	// Snapshot of _address_port_table that is read without lock
+	using AddressTable = IceAddressTable<std::shared_ptr<IcePortInfo>>;
+	std::atomic<const AddressTable *> _address_table;
+	// The replaced snapshots are deleted after a grace period, because a reader may still be using them
+	std::vector<std::pair<std::chrono::steady_clock::time_point, std::unique_ptr<const AddressTable>>> _retired_address_tables;
 	// Find IcePortInfo with peer's session id
 	std::map<session_id_t, std::shared_ptr<IcePortInfo>> _session_port_table;
 
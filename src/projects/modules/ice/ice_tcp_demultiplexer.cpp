@@ -4,15 +4,14 @@
 #include "stun/channel_data_message.h"
 
 bool IceTcpDemultiplexer::AppendData(const void *data, size_t length)
-{	
-	_buffer->Append(data, length);
-	return ParseData();
+{
+	// <data> may not be alive after this call, so the frames cannot reference it
+	return ParseData(std::make_shared<ov::Data>(data, length));
 }
 
 bool IceTcpDemultiplexer::AppendData(const std::shared_ptr<const ov::Data> &data)
 {
-	_buffer->Append(data);
-	return ParseData();
+	return ParseData(data);
 }
 
 bool IceTcpDemultiplexer::IsAvailablePacket()
@@ -20,115 +19,154 @@ bool IceTcpDemultiplexer::IsAvailablePacket()
 	return !_packets.empty();
 }
 
-std::shared_ptr<IceTcpDemultiplexer::Packet> IceTcpDemultiplexer::PopPacket()
+IceTcpDemultiplexer::Packet IceTcpDemultiplexer::PopPacket()
+{
+	auto packet = std::move(_packets.front());
+	_packets.pop();
+
+	return packet;
+}
+
+size_t IceTcpDemultiplexer::GetFrameHeaderSize(uint8_t first_byte)
 {
-	if(IsAvailablePacket() == false)
+	// Only STUN and TURN Channel should be input packet types to IceTcpDemultiplexer.
+	// (See IcePacketIdentifier::FindPacketType() for the ranges)
+	if (first_byte <= 3)
 	{
-		return nullptr;
+		return STUN_FRAME_HEADER_SIZE;
 	}
 
-	auto packet = _packets.front();
-	_packets.pop();
+	if ((first_byte >= 64) && (first_byte <= 79))
+	{
+		return FIXED_TURN_CHANNEL_HEADER_SIZE;
+	}
 
-	return packet;
+	return 0;
 }
 
-bool IceTcpDemultiplexer::ParseData()
+ssize_t IceTcpDemultiplexer::GetFrameSize(const uint8_t *data, size_t length, IcePacketIdentifier::PacketType *type)
 {
-	while(_buffer->GetLength() > MINIMUM_PACKET_HEADER_SIZE)
+	if (length == 0)
+	{
+		return 0;
+	}
+
+	auto header_size = GetFrameHeaderSize(data[0]);
+
+	if (header_size == 0)
 	{
-		// Only STUN and TURN Channel should be input packet types to IceTcpDemultiplexer. 
 		// If another packet is input, it means a problem has occurred.
+		return -1;
+	}
 
-		auto type = IcePacketIdentifier::FindPacketType(_buffer);
-		IceTcpDemultiplexer::ExtractResult result;
+	if (length < header_size)
+	{
+		return 0;
+	}
 
-		if(type == IcePacketIdentifier::PacketType::STUN)
-		{
-			result = ExtractStunMessage();
-		}
-		else if(type == IcePacketIdentifier::PacketType::TURN_CHANNEL_DATA)
-		{
-			result = ExtractChannelMessage();
-		}
-		else
-		{
-			// Critical error
-			return false;
-		}
+	auto message_length = ByteReader<uint16_t>::ReadBigEndian(&data[2]);
 
-		// success
-		if(result == ExtractResult::SUCCESS)
-		{
-			continue;
-		}
-		// retry later
-		else if(result == ExtractResult::NOT_ENOUGH_BUFFER)
-		{
-			return true;
-		}
-		// error
-		else if(result == ExtractResult::FAILED)
+	if (header_size == STUN_FRAME_HEADER_SIZE)
+	{
+		if (ByteReader<uint32_t>::ReadBigEndian(&data[4]) != OV_STUN_MAGIC_COOKIE)
 		{
-			return false;
+			return -1;
 		}
+
+		*type = IcePacketIdentifier::PacketType::STUN;
+		return StunMessage::DefaultHeaderLength() + message_length;
 	}
 
-	return true;
+	// https://www.rfc-editor.org/rfc/rfc8656.html#section-12.5
+	// Over TCP, the ChannelData message is padded to a multiple of 4 bytes
+	*type = IcePacketIdentifier::PacketType::TURN_CHANNEL_DATA;
+	return FIXED_TURN_CHANNEL_HEADER_SIZE + message_length + ((4 - (message_length % 4)) % 4);
 }
 
-IceTcpDemultiplexer::ExtractResult IceTcpDemultiplexer::ExtractStunMessage()
+ssize_t IceTcpDemultiplexer::CompletePartialFrame(const uint8_t *data, size_t length)
 {
-	ov::ByteStream stream(_buffer);
-	StunMessage message;
+	size_t consumed = 0;
+	IcePacketIdentifier::PacketType type = IcePacketIdentifier::PacketType::UNKNOWN;
+
+	auto frame_size = GetFrameSize(_partial_frame->GetDataAs<uint8_t>(), _partial_frame->GetLength(), &type);
 
-	if(message.ParseHeader(stream) == false)
+	if (frame_size == 0)
 	{
-		if(message.GetLastErrorCode() == StunMessage::LastErrorCode::NOT_ENOUGH_DATA)
+		// Take the bytes of the header only, since the frame may be shorter than the bytes received
+		auto header_size = GetFrameHeaderSize(_partial_frame->GetDataAs<uint8_t>()[0]);
+		auto to_copy = std::min(header_size - _partial_frame->GetLength(), length);
+
+		_partial_frame->Append(data, to_copy);
+		consumed += to_copy;
+
+		frame_size = GetFrameSize(_partial_frame->GetDataAs<uint8_t>(), _partial_frame->GetLength(), &type);
+
+		if (frame_size == 0)
 		{
-			// Not enough data, retry later
-			return ExtractResult::NOT_ENOUGH_BUFFER;
-		}
-		else
-		{	
-			// Invaild data
-			return ExtractResult::FAILED;
+			// All bytes are consumed
+			return consumed;
 		}
 	}
 
-	uint32_t packet_size = StunMessage::DefaultHeaderLength() + message.GetMessageLength();
-	auto data = _buffer->Subdata(0, packet_size);
-	auto packet = std::make_shared<IceTcpDemultiplexer::Packet>(IcePacketIdentifier::PacketType::STUN, data);
+	if (frame_size < 0)
+	{
+		return -1;
+	}
 
-	_packets.push(packet);
+	auto to_copy = std::min(static_cast<size_t>(frame_size) - _partial_frame->GetLength(), length - consumed);
 
-	_buffer = _buffer->Subdata(packet_size);
+	_partial_frame->Append(data + consumed, to_copy);
+	consumed += to_copy;
+
+	if (_partial_frame->GetLength() == static_cast<size_t>(frame_size))
+	{
+		// The buffer becomes the data of the frame
+		_packets.emplace(type, std::move(_partial_frame));
+		_partial_frame = std::make_shared<ov::Data>();
+	}
 
-	return ExtractResult::SUCCESS;
+	return consumed;
 }
 
-IceTcpDemultiplexer::ExtractResult IceTcpDemultiplexer::ExtractChannelMessage()
+bool IceTcpDemultiplexer::ParseData(const std::shared_ptr<const ov::Data> &data)
 {
-	ChannelDataMessage message;
+	auto buffer = data->GetDataAs<uint8_t>();
+	size_t length = data->GetLength();
+	size_t offset = 0;
 
-	if(message.LoadHeader(*_buffer) == false)
+	if (_partial_frame->IsEmpty() == false)
 	{
-		if(message.GetLastErrorCode() == ChannelDataMessage::LastErrorCode::NOT_ENOUGH_DATA)
+		auto consumed = CompletePartialFrame(buffer, length);
+
+		if (consumed < 0)
 		{
-			return ExtractResult::NOT_ENOUGH_BUFFER;
+			return false;
 		}
-		else
+
+		offset += consumed;
+	}
+
+	while (offset < length)
+	{
+		IcePacketIdentifier::PacketType type = IcePacketIdentifier::PacketType::UNKNOWN;
+		auto frame_size = GetFrameSize(buffer + offset, length - offset, &type);
+
+		if (frame_size < 0)
 		{
-			return ExtractResult::FAILED;
+			// Critical error
+			return false;
 		}
-	}
 
-	uint32_t packet_size = message.GetPacketLength();
-	auto data = _buffer->Subdata(0, packet_size);
-	auto packet = std::make_shared<IceTcpDemultiplexer::Packet>(IcePacketIdentifier::PacketType::TURN_CHANNEL_DATA, data);
+		if ((frame_size == 0) || ((offset + frame_size) > length))
+		{
+			// The rest of the frame will be received later
+			_partial_frame->Append(buffer + offset, length - offset);
+			break;
+		}
 
-	_packets.push(packet);
-	_buffer = _buffer->Subdata(packet_size);
+		_packets.emplace(type, data->Subdata(offset, frame_size));
+		offset += frame_size;
+	}
 
-	return ExtractResult::SUCCESS;
+	return true;
 }
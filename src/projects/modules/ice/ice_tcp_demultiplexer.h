@@ -9,66 +9,68 @@
 //#define FIXED_STUN_HEADER_SIZE	20
 //#define FIXED_TURN_CHANNEL_HEADER_SIZE	4
 #define MINIMUM_PACKET_HEADER_SIZE	4
+// Bytes needed to know the size of a STUN message (type, length and magic cookie)
+#define STUN_FRAME_HEADER_SIZE		8
 
 // It only demultiplexes the stream input to ICE/TCP. 
 // Use identifier for packets that are input to UDP.
-
+//
+// The frames are parsed in place from the received data, and emitted as the subdata of it (without copying).
+// Only the bytes of a frame that is split across reads are copied, into a buffer that becomes the data of that frame.
 class IceTcpDemultiplexer
 {
 public:
 
 	IceTcpDemultiplexer()
 	{
-		_buffer = std::make_shared<ov::Data>(65535);
+		_partial_frame = std::make_shared<ov::Data>();
 	}
 
 	// In the case of a turn channel data message, it parses the header and stores the application data.
 	class Packet
 	{
 	public:
-		Packet(IcePacketIdentifier::PacketType type, const std::shared_ptr<ov::Data> &data)
+		Packet(IcePacketIdentifier::PacketType type, const std::shared_ptr<const ov::Data> &data)
 		{
 			_type = type;
 			_data = data;
 		}
 
-		IcePacketIdentifier::PacketType GetPacketType()
+		IcePacketIdentifier::PacketType GetPacketType() const
 		{
 			return _type;
 		}
 
-		std::shared_ptr<ov::Data> GetData()
+		const std::shared_ptr<const ov::Data> &GetData() const
 		{
 			return _data;
 		}
 
 	private:
 		IcePacketIdentifier::PacketType _type = IcePacketIdentifier::PacketType::UNKNOWN;
-		uint16_t _channel_number = 0;	// Only use if packet is from channel data message
-		std::shared_ptr<ov::Data>	_data = nullptr;
+		std::shared_ptr<const ov::Data>	_data = nullptr;
 	};
 
 	bool AppendData(const void *data, size_t length);
 	bool AppendData(const std::shared_ptr<const ov::Data> &data);
 
 	bool IsAvailablePacket();
-	std::shared_ptr<IceTcpDemultiplexer::Packet> PopPacket();
+	// Must be called only if IsAvailablePacket() is true
+	Packet PopPacket();
 
 private:
-	bool ParseData();
+	// Returns the number of bytes needed to know the size of the frame that starts with <first_byte> (0 if it is not STUN/TURN Channel)
+	static size_t GetFrameHeaderSize(uint8_t first_byte);
+	// Returns the size of the frame at <data>, 0 if more bytes are needed to know it, or -1 if it is not a valid frame
+	static ssize_t GetFrameSize(const uint8_t *data, size_t length, IcePacketIdentifier::PacketType *type);
 
-	enum class ExtractResult : int8_t
-	{
-		SUCCESS = 1,
-		NOT_ENOUGH_BUFFER = 0,
-		FAILED = -1
-	};
-	// 1 : success
-	// 0 : not enough memory
-	// -1 : error
-	ExtractResult ExtractStunMessage();
-	ExtractResult ExtractChannelMessage();
+	bool ParseData(const std::shared_ptr<const ov::Data> &data);
+	// Appends the bytes of <data> to the partial frame until the frame is completed
+	//
+	// @return The number of bytes consumed, or -1 if the frame is invalid
+	ssize_t CompletePartialFrame(const uint8_t *data, size_t length);
 
-	std::shared_ptr<ov::Data> _buffer;
-	std::queue<std::shared_ptr<IceTcpDemultiplexer::Packet>> _packets;
-};
\ No newline at end of file
+	// The bytes of the frame that is split across reads (empty if there is no such frame)
+	std::shared_ptr<ov::Data> _partial_frame;
+	std::queue<Packet> _packets;
+};
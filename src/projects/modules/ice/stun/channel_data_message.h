@@ -60,6 +60,56 @@ public:
 		return true;
 	}
 
+	// Frames each item of <data_list> as a ChannelData message without copying it, and appends
+	// [header][data][padding] of each message to <framed_data_list>. The headers of all messages share one buffer.
+	//
+	// This is for the gathering write of TCP (ov::Socket::Send(data_list)). For UDP, use SetPacket() instead,
+	// since each item would be sent as a datagram.
+	static void FrameDataList(uint16_t channel_number, const std::vector<std::shared_ptr<const ov::Data>> &data_list, std::vector<std::shared_ptr<const ov::Data>> &framed_data_list)
+	{
+		// Shared by all messages, and never modified
+		static const std::shared_ptr<const ov::Data> padding_list[] = {
+			nullptr,
+			std::make_shared<ov::Data>("\0\0\0", 1),
+			std::make_shared<ov::Data>("\0\0\0", 2),
+			std::make_shared<ov::Data>("\0\0\0", 3)};
+
+		auto header_buffer = std::make_shared<ov::Data>(FIXED_TURN_CHANNEL_HEADER_SIZE * data_list.size());
+		header_buffer->SetLength(FIXED_TURN_CHANNEL_HEADER_SIZE * data_list.size());
+
+		auto header = header_buffer->GetWritableDataAs<uint8_t>();
+
+		for (auto &data : data_list)
+		{
+			auto data_length = static_cast<uint16_t>(data->GetLength());
+
+			ByteWriter<uint16_t>::WriteBigEndian(&header[0], channel_number);
+			ByteWriter<uint16_t>::WriteBigEndian(&header[2], data_length);
+			header += FIXED_TURN_CHANNEL_HEADER_SIZE;
+		}
+
+		// Subdata() must be called after all headers are written, so that the buffer is not detached
+		std::shared_ptr<const ov::Data> const_header_buffer = header_buffer;
+		off_t header_offset = 0;
+
+		framed_data_list.reserve(framed_data_list.size() + (data_list.size() * 3));
+
+		for (auto &data : data_list)
+		{
+			framed_data_list.push_back(const_header_buffer->Subdata(header_offset, FIXED_TURN_CHANNEL_HEADER_SIZE));
+			framed_data_list.push_back(data);
+
+			// Over TCP, the padding is required (RFC 8656, Section 12.5)
+			auto padding_length = (4 - (data->GetLength() % 4)) % 4;
+			if (padding_length > 0)
+			{
+				framed_data_list.push_back(padding_list[padding_length]);
+			}
+
+			header_offset += FIXED_TURN_CHANNEL_HEADER_SIZE;
+		}
+	}
+
 	bool LoadHeader(const ov::Data &packet)
 	{
 		if(packet.GetLength() < FIXED_TURN_CHANNEL_HEADER_SIZE)
@@ -0,0 +1,178 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "stun_binding_message.h"
+
+#include "stun_private.h"
+
+#define STUN_HEADER_LENGTH 20
+#define STUN_ATTRIBUTE_HEADER_LENGTH 4
+
+// Message types (method: Binding)
+#define STUN_BINDING_REQUEST 0x0001
+#define STUN_BINDING_INDICATION 0x0011
+#define STUN_BINDING_SUCCESS_RESPONSE 0x0101
+
+// Address families of XOR-MAPPED-ADDRESS
+#define STUN_ADDRESS_FAMILY_IPV4 0x01
+#define STUN_ADDRESS_FAMILY_IPV6 0x02
+
+static inline uint16_t ReadBE16(const uint8_t *buffer)
+{
+	return static_cast<uint16_t>((buffer[0] << 8) | buffer[1]);
+}
+
+static inline uint8_t *WriteBE16(uint8_t *buffer, uint16_t value)
+{
+	buffer[0] = static_cast<uint8_t>(value >> 8);
+	buffer[1] = static_cast<uint8_t>(value);
+
+	return buffer + 2;
+}
+
+static inline uint8_t *WriteBE32(uint8_t *buffer, uint32_t value)
+{
+	buffer[0] = static_cast<uint8_t>(value >> 24);
+	buffer[1] = static_cast<uint8_t>(value >> 16);
+	buffer[2] = static_cast<uint8_t>(value >> 8);
+	buffer[3] = static_cast<uint8_t>(value);
+
+	return buffer + 4;
+}
+
+bool StunBindingMessage::ParseRequest(const void *data, size_t length, Request *request)
+{
+	auto buffer = static_cast<const uint8_t *>(data);
+
+	if ((length < STUN_HEADER_LENGTH) || ((length & 0b11) != 0))
+	{
+		return false;
+	}
+
+	auto type = ReadBE16(buffer);
+
+	if ((type != STUN_BINDING_REQUEST) && (type != STUN_BINDING_INDICATION))
+	{
+		return false;
+	}
+
+	// A datagram contains exactly one message
+	if ((static_cast<size_t>(ReadBE16(buffer + 2)) + STUN_HEADER_LENGTH != length) ||
+		(ov::NetworkToHost32(*reinterpret_cast<const uint32_t *>(buffer + 4)) != OV_STUN_MAGIC_COOKIE))
+	{
+		return false;
+	}
+
+	const uint8_t *user_name = nullptr;
+	size_t user_name_length = 0;
+
+	// Scans the attributes in place
+	size_t offset = STUN_HEADER_LENGTH;
+
+	while (offset + STUN_ATTRIBUTE_HEADER_LENGTH <= length)
+	{
+		auto attribute_type = static_cast<StunAttributeType>(ReadBE16(buffer + offset));
+		size_t attribute_length = ReadBE16(buffer + offset + 2);
+		size_t padded_length = (attribute_length + 3) & ~static_cast<size_t>(0b11);
+
+		if (offset + STUN_ATTRIBUTE_HEADER_LENGTH + padded_length > length)
+		{
+			return false;
+		}
+
+		if (attribute_type == StunAttributeType::UserName)
+		{
+			user_name = buffer + offset + STUN_ATTRIBUTE_HEADER_LENGTH;
+			user_name_length = attribute_length;
+		}
+		else if (attribute_type == StunAttributeType::MessageIntegrity)
+		{
+			// Attributes after MESSAGE-INTEGRITY (except FINGERPRINT) are ignored (RFC 5389, 15.4)
+			break;
+		}
+
+		offset += STUN_ATTRIBUTE_HEADER_LENGTH + padded_length;
+	}
+
+	if (user_name == nullptr)
+	{
+		return false;
+	}
+
+	auto separator = static_cast<const uint8_t *>(::memchr(user_name, ':', user_name_length));
+
+	if (separator == nullptr)
+	{
+		return false;
+	}
+
+	request->is_indication = (type == STUN_BINDING_INDICATION);
+	request->transaction_id = buffer + 8;
+	request->local_ufrag = reinterpret_cast<const char *>(user_name);
+	request->local_ufrag_length = separator - user_name;
+
+	return true;
+}
+
+size_t StunBindingMessage::MakeSuccessResponse(const uint8_t *transaction_id, const ov::SocketAddress &mapped_address, const ov::HmacKey &integrity_key,
+											   uint8_t *buffer, size_t capacity)
+{
+	if ((capacity < MaxResponseLength) || (mapped_address.IsValid() == false))
+	{
+		return 0;
+	}
+
+	// Header (the length is patched below)
+	auto current = WriteBE16(buffer, STUN_BINDING_SUCCESS_RESPONSE);
+	current = WriteBE16(current, 0);
+	current = WriteBE32(current, OV_STUN_MAGIC_COOKIE);
+	::memcpy(current, transaction_id, OV_STUN_TRANSACTION_ID_LENGTH);
+	current += OV_STUN_TRANSACTION_ID_LENGTH;
+
+	// XOR-MAPPED-ADDRESS: the address is XORed with the magic cookie (and the transaction ID for IPv6)
+	auto is_ipv6 = mapped_address.IsIPv6();
+	size_t address_length = is_ipv6 ? 16 : 4;
+
+	current = WriteBE16(current, static_cast<uint16_t>(StunAttributeType::XorMappedAddress));
+	current = WriteBE16(current, static_cast<uint16_t>(4 + address_length));
+	*current++ = 0x00;
+	*current++ = is_ipv6 ? STUN_ADDRESS_FAMILY_IPV6 : STUN_ADDRESS_FAMILY_IPV4;
+	current = WriteBE16(current, static_cast<uint16_t>(mapped_address.Port() ^ (OV_STUN_MAGIC_COOKIE >> 16)));
+
+	// Magic cookie + transaction ID, in network byte order
+	const uint8_t *xor_key = buffer + 4;
+	auto address = is_ipv6 ? mapped_address.ToIn6Addr()->s6_addr : reinterpret_cast<const uint8_t *>(&(mapped_address.ToIn4Addr()->s_addr));
+
+	for (size_t index = 0; index < address_length; index++)
+	{
+		*current++ = address[index] ^ xor_key[index];
+	}
+
+	// MESSAGE-INTEGRITY: the length in the header includes this attribute when computing HMAC
+	auto integrity_offset = current - buffer;
+	WriteBE16(buffer + 2, static_cast<uint16_t>(integrity_offset + STUN_ATTRIBUTE_HEADER_LENGTH + OV_STUN_HASH_LENGTH - STUN_HEADER_LENGTH));
+
+	current = WriteBE16(current, static_cast<uint16_t>(StunAttributeType::MessageIntegrity));
+	current = WriteBE16(current, OV_STUN_HASH_LENGTH);
+
+	if (integrity_key.Compute({{buffer, static_cast<size_t>(integrity_offset)}}, current, OV_STUN_HASH_LENGTH) == false)
+	{
+		return 0;
+	}
+
+	current += OV_STUN_HASH_LENGTH;
+
+	// FINGERPRINT: the length in the header includes this attribute when computing CRC
+	auto fingerprint_offset = current - buffer;
+	WriteBE16(buffer + 2, static_cast<uint16_t>(fingerprint_offset + STUN_ATTRIBUTE_HEADER_LENGTH + 4 - STUN_HEADER_LENGTH));
+
+	current = WriteBE16(current, static_cast<uint16_t>(StunAttributeType::Fingerprint));
+	current = WriteBE16(current, 4);
+	current = WriteBE32(current, ov::Crc32::Calculate(buffer, fingerprint_offset) ^ OV_STUN_FINGERPRINT_XOR_VALUE);
+
+	return current - buffer;
+}
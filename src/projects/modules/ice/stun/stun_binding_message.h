@@ -0,0 +1,44 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/ovcrypto/ovcrypto.h>
+#include <base/ovlibrary/ovlibrary.h>
+#include <base/ovsocket/socket_address.h>
+
+#include "stun_datastructure.h"
+
+// Reads a Binding Request/Indication and writes a Binding Success Response in place,
+// without StunMessage, StunAttribute objects and ByteStream.
+//
+// It is for the connectivity checks and consent freshness of the connected sessions, which are the most frequent STUN messages.
+// The messages that are not handled here must be processed with StunMessage.
+class StunBindingMessage
+{
+public:
+	struct Request
+	{
+		bool is_indication = false;
+		// Points to the data passed to ParseRequest()
+		const uint8_t *transaction_id = nullptr;
+		// The first part of USERNAME ("<ufrag of the receiver>:<ufrag of the sender>")
+		const char *local_ufrag = nullptr;
+		size_t local_ufrag_length = 0;
+	};
+
+	// Header + XOR-MAPPED-ADDRESS (IPv6) + MESSAGE-INTEGRITY + FINGERPRINT
+	static constexpr size_t MaxResponseLength = 20 + (4 + 20) + (4 + OV_STUN_HASH_LENGTH) + (4 + 4);
+
+	// Returns false if <data> is not a Binding Request/Indication with USERNAME
+	static bool ParseRequest(const void *data, size_t length, Request *request);
+
+	// Writes a Binding Success Response with XOR-MAPPED-ADDRESS, MESSAGE-INTEGRITY and FINGERPRINT to <buffer>,
+	// and returns the length of the message (0 if failed)
+	static size_t MakeSuccessResponse(const uint8_t *transaction_id, const ov::SocketAddress &mapped_address, const ov::HmacKey &integrity_key,
+									  uint8_t *buffer, size_t capacity);
+};
@@ -8,59 +8,276 @@
 //==============================================================================
 #include "application.h"
 #include "common.h"
+#include "metrics.h"
+
 namespace serdes
 {
-	Json::Value JsonFromMetrics(const std::shared_ptr<const mon::CommonMetrics> &metrics)
+	static void WriteTimestamp(ov::JsonWriter &writer, const char *key, const std::chrono::system_clock::time_point &time_point)
+	{
+		writer.Write(key, ov::Converter::ToISO8601String(time_point));
+	}
+
+	static void WriteCommonMetricsFields(ov::JsonWriter &writer, const std::shared_ptr<const mon::CommonMetrics> &metrics)
+	{
+		// The names of the publishers are made once
+		static const std::vector<std::pair<PublisherType, ov::String>> connection_types = []() {
+			std::vector<std::pair<PublisherType, ov::String>> types;
+
+			for (auto type : {PublisherType::Webrtc, PublisherType::LLDash, PublisherType::Hls, PublisherType::LLHls, PublisherType::Dash,
+							  PublisherType::Ovt, PublisherType::File, PublisherType::RtmpPush, PublisherType::MpegtsPush, PublisherType::Thumbnail,
+							  PublisherType::Srt})
+			{
+				types.emplace_back(type, StringFromPublisherType(type).LowerCaseString());
+			}
+
+			return types;
+		}();
+
+		WriteTimestamp(writer, "createdTime", metrics->GetCreatedTime());
+		WriteTimestamp(writer, "lastUpdatedTime", metrics->GetLastUpdatedTime());
+		writer.Write("totalBytesIn", metrics->GetTotalBytesIn());
+		writer.Write("totalBytesOut", metrics->GetTotalBytesOut());
+		writer.Write("avgThroughputIn", metrics->GetAvgThroughputIn());
+		writer.Write("avgThroughputOut", metrics->GetAvgThroughputOut());
+		writer.Write("maxThroughputIn", metrics->GetMaxThroughputIn());
+		writer.Write("maxThroughputOut", metrics->GetMaxThroughputOut());
+		WriteTimestamp(writer, "lastRecvTime", metrics->GetLastRecvTime());
+		WriteTimestamp(writer, "lastSentTime", metrics->GetLastSentTime());
+		writer.Write("totalConnections", metrics->GetTotalConnections());
+		writer.Write("maxTotalConnections", metrics->GetMaxTotalConnections());
+		WriteTimestamp(writer, "maxTotalConnectionTime", metrics->GetMaxTotalConnectionsTime());
+
+		writer.BeginObject("connections");
+		for (const auto &[type, name] : connection_types)
+		{
+			writer.Write(name.CStr(), metrics->GetConnections(type));
+		}
+		writer.EndObject();
+	}
+
+	void WriteMetrics(ov::JsonWriter &writer, const std::shared_ptr<const mon::CommonMetrics> &metrics)
 	{
 		if (metrics == nullptr)
 		{
-			return Json::nullValue;
+			writer.Null();
+			return;
 		}
 
-		Json::Value value;
+		writer.BeginObject();
+		WriteCommonMetricsFields(writer, metrics);
+		writer.EndObject();
+	}
 
-		SetTimestamp(value, "createdTime", metrics->GetCreatedTime());
-		SetTimestamp(value, "lastUpdatedTime", metrics->GetLastUpdatedTime());
-		SetInt64(value, "totalBytesIn", metrics->GetTotalBytesIn());
-		SetInt64(value, "totalBytesOut", metrics->GetTotalBytesOut());
-		SetInt64(value, "avgThroughputIn", metrics->GetAvgThroughputIn());
-		SetInt64(value, "avgThroughputOut", metrics->GetAvgThroughputOut());		
-		SetInt64(value, "maxThroughputIn", metrics->GetMaxThroughputIn());
-		SetInt64(value, "maxThroughputOut", metrics->GetMaxThroughputOut());
-		SetTimestamp(value, "lastRecvTime", metrics->GetLastRecvTime());
-		SetTimestamp(value, "lastSentTime", metrics->GetLastSentTime());
-		SetInt(value, "totalConnections", metrics->GetTotalConnections());
-		SetInt(value, "maxTotalConnections", metrics->GetMaxTotalConnections());
-		SetTimestamp(value, "maxTotalConnectionTime", metrics->GetMaxTotalConnectionsTime());
-
-		Json::Value &connections = value["connections"];
-		SetInt(connections, ov::String::FormatString("%s", StringFromPublisherType(PublisherType::Webrtc).LowerCaseString().CStr()).CStr(), metrics->GetConnections(PublisherType::Webrtc));
-		SetInt(connections, ov::String::FormatString("%s", StringFromPublisherType(PublisherType::LLDash).LowerCaseString().CStr()).CStr(), metrics->GetConnections(PublisherType::LLDash));
-		SetInt(connections, ov::String::FormatString("%s", StringFromPublisherType(PublisherType::Hls).LowerCaseString().CStr()).CStr(), metrics->GetConnections(PublisherType::Hls));
-		SetInt(connections, ov::String::FormatString("%s", StringFromPublisherType(PublisherType::LLHls).LowerCaseString().CStr()).CStr(), metrics->GetConnections(PublisherType::LLHls));
-		SetInt(connections, ov::String::FormatString("%s", StringFromPublisherType(PublisherType::Dash).LowerCaseString().CStr()).CStr(), metrics->GetConnections(PublisherType::Dash));
-		SetInt(connections, ov::String::FormatString("%s", StringFromPublisherType(PublisherType::Ovt).LowerCaseString().CStr()).CStr(), metrics->GetConnections(PublisherType::Ovt));
-		SetInt(connections, ov::String::FormatString("%s", StringFromPublisherType(PublisherType::File).LowerCaseString().CStr()).CStr(), metrics->GetConnections(PublisherType::File));
-		SetInt(connections, ov::String::FormatString("%s", StringFromPublisherType(PublisherType::RtmpPush).LowerCaseString().CStr()).CStr(), metrics->GetConnections(PublisherType::RtmpPush));
-		SetInt(connections, ov::String::FormatString("%s", StringFromPublisherType(PublisherType::MpegtsPush).LowerCaseString().CStr()).CStr(), metrics->GetConnections(PublisherType::MpegtsPush));
-		SetInt(connections, ov::String::FormatString("%s", StringFromPublisherType(PublisherType::Thumbnail).LowerCaseString().CStr()).CStr(), metrics->GetConnections(PublisherType::Thumbnail));
+	void WriteDecoderMetrics(ov::JsonWriter &writer, const std::shared_ptr<const mon::DecoderMetrics> &metrics)
+	{
+		if (metrics == nullptr)
+		{
+			writer.Null();
+			return;
+		}
 
-		return value;
+		writer.BeginObject();
+
+		writer.Write("trackId", metrics->GetTrackId());
+		if (metrics->GetCodecName().IsEmpty() == false)
+		{
+			writer.Write("codec", metrics->GetCodecName());
+		}
+		writer.Write("threadCount", metrics->GetThreadCount());
+		if (metrics->GetThreadType().IsEmpty() == false)
+		{
+			writer.Write("threadType", metrics->GetThreadType());
+		}
+		writer.Write("decodedFrames", metrics->GetDecodedFrameCount());
+		writer.Write("avgLatencyUs", metrics->GetDecodingLatencyInUs());
+		writer.Write("maxLatencyUs", metrics->GetMaxDecodingLatencyInUs());
+
+		writer.EndObject();
 	}
 
-	Json::Value JsonFromStreamMetrics(const std::shared_ptr<const mon::StreamMetrics> &metrics)
+	void WriteSrtMetrics(ov::JsonWriter &writer, const std::shared_ptr<const mon::SrtMetrics> &metrics)
 	{
-		Json::Value value = JsonFromMetrics(metrics);
+		if (metrics == nullptr)
+		{
+			writer.Null();
+			return;
+		}
+
+		writer.BeginObject();
+
+		writer.Write("rttMs", static_cast<float>(metrics->GetRttInMs()));
+		writer.Write("bandwidthMbps", static_cast<float>(metrics->GetBandwidthInMbps()));
+		writer.Write("receivedPackets", metrics->GetReceivedPacketCount());
+		writer.Write("lostPackets", metrics->GetLostPacketCount());
+		writer.Write("retransmittedPackets", metrics->GetRetransmittedPacketCount());
+		writer.Write("droppedPackets", metrics->GetDroppedPacketCount());
+		writer.Write("bufferedMs", metrics->GetBufferedTimeInMs());
+		writer.Write("latencyMs", metrics->GetLatencyInMs());
 
-		if (value.isNull())
+		writer.EndObject();
+	}
+
+	static void WriteLatencyPercentiles(ov::JsonWriter &writer, const std::function<int64_t(double percentile)> &get_latency)
+	{
+		writer.Write("p50Us", get_latency(50.0));
+		writer.Write("p90Us", get_latency(90.0));
+		writer.Write("p99Us", get_latency(99.0));
+	}
+
+	void WriteLatencyMetricsFields(ov::JsonWriter &writer, const std::shared_ptr<const mon::LatencyMetrics> &metrics)
+	{
+		writer.Write("samples", metrics->GetSampleCount());
+
+		writer.BeginObject("total");
+		WriteLatencyPercentiles(writer, [&](double percentile) { return metrics->GetTotalLatencyInUs(percentile); });
+		writer.EndObject();
+
+		writer.BeginObject("stages");
+
+		for (size_t index = static_cast<size_t>(PacketTraceStage::ProviderReceived) + 1; index < static_cast<size_t>(PacketTraceStage::NumberOfStages); index++)
 		{
-			return value;
+			auto stage = static_cast<PacketTraceStage>(index);
+			auto sample_count = metrics->GetSampleCount(stage);
+
+			if (sample_count == 0)
+			{
+				continue;
+			}
+
+			writer.BeginObject(StringFromPacketTraceStage(stage));
+			WriteLatencyPercentiles(writer, [&](double percentile) { return metrics->GetLatencyInUs(stage, percentile); });
+			writer.Write("samples", sample_count);
+			writer.EndObject();
 		}
 
-		SetTimeInterval(value, "requestTimeToOrigin", metrics->GetOriginConnectionTimeMSec());
-		SetTimeInterval(value, "responseTimeFromOrigin", metrics->GetOriginSubscribeTimeMSec());
+		writer.EndObject();
 
-		return value;
+		writer.BeginObject("buffering");
+
+		for (size_t index = 0; index < static_cast<size_t>(mon::BufferingStage::NumberOfStages); index++)
+		{
+			auto stage = static_cast<mon::BufferingStage>(index);
+			auto sample_count = metrics->GetBufferingSampleCount(stage);
+
+			if (sample_count == 0)
+			{
+				continue;
+			}
+
+			writer.BeginObject(mon::StringFromBufferingStage(stage));
+			WriteLatencyPercentiles(writer, [&](double percentile) { return metrics->GetBufferingDelayInUs(stage, percentile); });
+			writer.Write("samples", sample_count);
+			writer.EndObject();
+		}
+
+		writer.EndObject();
+	}
+
+	void WriteLatencyMetrics(ov::JsonWriter &writer, const std::shared_ptr<const mon::LatencyMetrics> &metrics)
+	{
+		if (metrics == nullptr)
+		{
+			writer.Null();
+			return;
+		}
+
+		writer.BeginObject();
+		WriteLatencyMetricsFields(writer, metrics);
+		writer.EndObject();
+	}
+
+	void WriteStreamMetrics(ov::JsonWriter &writer, const std::shared_ptr<const mon::StreamMetrics> &metrics)
+	{
+		if (metrics == nullptr)
+		{
+			writer.Null();
+			return;
+		}
+
+		writer.BeginObject();
+
+		WriteCommonMetricsFields(writer, metrics);
+
+		writer.Write("requestTimeToOrigin", metrics->GetOriginConnectionTimeMSec());
+		writer.Write("responseTimeFromOrigin", metrics->GetOriginSubscribeTimeMSec());
+		writer.Write("firstFrameTimeFromOrigin", metrics->GetOriginFirstFrameTimeMSec());
+
+		if (metrics->GetGopCachePacketCount() > 0)
+		{
+			writer.BeginObject("gopCache");
+			writer.Write("bytes", metrics->GetGopCacheBytes());
+			writer.Write("durationMs", metrics->GetGopCacheDurationMSec());
+			writer.Write("packets", metrics->GetGopCachePacketCount());
+			writer.EndObject();
+		}
+
+		auto memory_metrics = metrics->FindMemoryMetrics();
+		if (memory_metrics != nullptr)
+		{
+			writer.BeginObject("memory");
+			writer.Write("totalBytes", memory_metrics->GetTotalBytes());
+			writer.Write("peakBytes", memory_metrics->GetPeakBytes());
+			writer.Write("pressure", mon::StringFromMemoryPressure(memory_metrics->GetPressure()));
+			for (size_t index = 0; index < static_cast<size_t>(mon::MemoryComponent::NumberOfComponents); index++)
+			{
+				auto component = static_cast<mon::MemoryComponent>(index);
+				writer.Write(mon::StringFromMemoryComponent(component), memory_metrics->GetBytes(component));
+			}
+			writer.EndObject();
+		}
+
+		if (metrics->GetGpuId() >= 0)
+		{
+			writer.Write("gpuId", metrics->GetGpuId());
+		}
+
+		auto decoder_metrics_list = metrics->GetDecoderMetricsList();
+		if (decoder_metrics_list.empty() == false)
+		{
+			writer.BeginArray("decoders");
+
+			for (const auto &[track_id, decoder_metrics] : decoder_metrics_list)
+			{
+				WriteDecoderMetrics(writer, decoder_metrics);
+			}
+
+			writer.EndArray();
+		}
+
+		auto lip_sync_metrics_list = metrics->GetLipSyncMetricsList();
+		if (lip_sync_metrics_list.empty() == false)
+		{
+			writer.BeginArray("lipSync");
+
+			for (const auto &[track_id, lip_sync_metrics] : lip_sync_metrics_list)
+			{
+				writer.BeginObject();
+				writer.Write("trackId", track_id);
+				writer.Write("senderReports", lip_sync_metrics->GetSenderReportCount());
+				writer.Write("driftPpm", static_cast<float>(lip_sync_metrics->GetDriftPpm()));
+				writer.Write("alignmentErrorUs", lip_sync_metrics->GetAlignmentErrorInUs());
+				writer.Write("correctionUs", lip_sync_metrics->GetCorrectionInUs());
+				writer.EndObject();
+			}
+
+			writer.EndArray();
+		}
+
+		auto srt_metrics = metrics->FindSrtMetrics();
+		if (srt_metrics != nullptr)
+		{
+			writer.Key("srt");
+			WriteSrtMetrics(writer, srt_metrics);
+		}
+
+		auto latency_metrics = metrics->FindLatencyMetrics();
+		if (latency_metrics != nullptr)
+		{
+			writer.Key("latency");
+			WriteLatencyMetrics(writer, latency_metrics);
+		}
+
+		writer.EndObject();
 	}
 
 	Json::Value JsonFromQueueMetrics(const std::shared_ptr<const mon::QueueMetrics> &metrics)
@@ -85,4 +302,160 @@ namespace serdes
 
 		return value;
 	}
-}  // namespace serdes
\ No newline at end of file
+
+	Json::Value JsonFromDataPoolStats(const ov::DataPool::Stats &stats)
+	{
+		Json::Value value;
+
+		SetInt64(value, "blockSize", stats.block_size);
+		SetInt64(value, "inUse", stats.in_use_count);
+		SetInt64(value, "pooled", stats.pooled_count);
+		SetInt64(value, "hit", stats.hit_count);
+		SetInt64(value, "miss", stats.miss_count);
+
+		return value;
+	}
+
+	Json::Value JsonFromKtlsStats(const ov::TlsServerData::KtlsStats &stats)
+	{
+		Json::Value value;
+
+		SetInt64(value, "requested", stats.requested_count);
+		SetInt64(value, "offloaded", stats.offloaded_count);
+		SetInt64(value, "fallback", stats.fallback_count);
+		SetInt64(value, "currentOffloaded", stats.current_offloaded_count);
+
+		return value;
+	}
+
+	Json::Value JsonFromSegmentWorkerManagerStats(const SegmentWorkerManagerStats &stats)
+	{
+		Json::Value value;
+		Json::Value worker_list(Json::ValueType::arrayValue);
+
+		const int64_t latency_bucket_list[] = SEGMENT_WORKER_LATENCY_BUCKETS;
+
+		SetString(value, "name", stats.name, Optional::False);
+
+		for (const auto &worker_stats : stats.worker_list)
+		{
+			Json::Value worker;
+			Json::Value histogram(Json::ValueType::arrayValue);
+
+			SetInt64(worker, "queueDepth", worker_stats.queue_depth);
+			SetInt64(worker, "processed", worker_stats.processed_count);
+
+			for (size_t index = 0; index < worker_stats.latency_histogram.size(); index++)
+			{
+				Json::Value bucket;
+
+				// The last bucket has no upper bound
+				if (index < OV_COUNTOF(latency_bucket_list))
+				{
+					SetInt64(bucket, "maxLatencyUs", latency_bucket_list[index]);
+				}
+
+				SetInt64(bucket, "count", worker_stats.latency_histogram[index]);
+
+				histogram.append(bucket);
+			}
+
+			worker["latencyHistogram"] = histogram;
+
+			worker_list.append(worker);
+		}
+
+		value["workers"] = worker_list;
+
+		return value;
+	}
+
+	Json::Value JsonFromThreadInfo(const ov::ThreadRegistry::ThreadInfo &info)
+	{
+		Json::Value value;
+
+		SetInt64(value, "id", info.thread_id);
+		SetString(value, "name", info.name, Optional::False);
+		SetString(value, "role", info.role, Optional::True);
+		SetString(value, "app", info.app_name, Optional::True);
+		SetString(value, "stream", info.stream_name, Optional::True);
+		SetInt64(value, "cpuTimeMs", info.cpu_time_ms);
+		SetFloat(value, "cpuUsage", info.cpu_usage);
+
+		return value;
+	}
+
+	Json::Value JsonFromDataCopyAuditStats(const ov::DataCopyAudit::Stats &stats)
+	{
+		Json::Value value;
+		Json::Value reasons;
+		Json::Value call_stack_list(Json::ValueType::arrayValue);
+
+		SetBool(value, "enabled", stats.enabled);
+
+		for (int index = 0; index < static_cast<int>(ov::DataCopyAudit::Reason::Count); index++)
+		{
+			Json::Value reason;
+
+			SetInt64(reason, "count", stats.count[index]);
+			SetInt64(reason, "bytes", stats.bytes[index]);
+
+			reasons[ov::DataCopyAudit::StringFromReason(static_cast<ov::DataCopyAudit::Reason>(index))] = reason;
+		}
+
+		value["reasons"] = reasons;
+
+		for (const auto &call_stack : stats.call_stacks)
+		{
+			Json::Value item;
+			Json::Value frames(Json::ValueType::arrayValue);
+
+			SetInt64(item, "count", call_stack.count);
+			SetInt64(item, "bytes", call_stack.bytes);
+
+			for (const auto &frame : call_stack.frames)
+			{
+				frames.append(frame.CStr());
+			}
+
+			item["frames"] = frames;
+
+			call_stack_list.append(item);
+		}
+
+		value["callStacks"] = call_stack_list;
+		SetInt64(value, "droppedSamples", stats.dropped_sample_count);
+
+		return value;
+	}
+
+	Json::Value JsonFromLockStatsList(const std::vector<ov::LockProfiler::Stats> &stats_list)
+	{
+		Json::Value value;
+		Json::Value lock_list(Json::ValueType::arrayValue);
+
+		SetBool(value, "enabled", ov::LockProfiler::IsAvailable());
+
+		for (const auto &stats : stats_list)
+		{
+			Json::Value item;
+
+			SetString(item, "name", stats.name, Optional::False);
+			SetInt64(item, "lockCount", stats.lock_count);
+			SetInt64(item, "contendedCount", stats.contended_count);
+			SetInt64(item, "totalWaitNs", stats.total_wait_ns);
+			SetInt64(item, "waitP50Ns", stats.wait_p50_ns);
+			SetInt64(item, "waitP99Ns", stats.wait_p99_ns);
+			SetInt64(item, "waitMaxNs", stats.wait_max_ns);
+			SetInt64(item, "totalHoldNs", stats.total_hold_ns);
+			SetInt64(item, "holdP50Ns", stats.hold_p50_ns);
+			SetInt64(item, "holdP99Ns", stats.hold_p99_ns);
+
+			lock_list.append(item);
+		}
+
+		value["locks"] = lock_list;
+
+		return value;
+	}
+}  // namespace serdes
@@ -9,10 +9,23 @@
 #pragma once
 
 #include <monitoring/monitoring.h>
+#include <publishers/segment/segment_stream/segment_worker_manager.h>
 
 namespace serdes
 {
-	Json::Value JsonFromMetrics(const std::shared_ptr<const mon::CommonMetrics> &metrics);
-	Json::Value JsonFromStreamMetrics(const std::shared_ptr<const mon::StreamMetrics> &metrics);
+	// The metrics are written to <writer> directly (instead of Json::Value) since they are requested for all streams
+	void WriteMetrics(ov::JsonWriter &writer, const std::shared_ptr<const mon::CommonMetrics> &metrics);
+	void WriteStreamMetrics(ov::JsonWriter &writer, const std::shared_ptr<const mon::StreamMetrics> &metrics);
+	void WriteDecoderMetrics(ov::JsonWriter &writer, const std::shared_ptr<const mon::DecoderMetrics> &metrics);
+	void WriteSrtMetrics(ov::JsonWriter &writer, const std::shared_ptr<const mon::SrtMetrics> &metrics);
+	void WriteLatencyMetrics(ov::JsonWriter &writer, const std::shared_ptr<const mon::LatencyMetrics> &metrics);
+	// Writes the fields of the latency metrics to the current object of <writer> (to add more fields to the object)
+	void WriteLatencyMetricsFields(ov::JsonWriter &writer, const std::shared_ptr<const mon::LatencyMetrics> &metrics);
 	Json::Value JsonFromQueueMetrics(const std::shared_ptr<const mon::QueueMetrics> &metrics);
+	Json::Value JsonFromDataPoolStats(const ov::DataPool::Stats &stats);
+	Json::Value JsonFromKtlsStats(const ov::TlsServerData::KtlsStats &stats);
+	Json::Value JsonFromSegmentWorkerManagerStats(const SegmentWorkerManagerStats &stats);
+	Json::Value JsonFromThreadInfo(const ov::ThreadRegistry::ThreadInfo &info);
+	Json::Value JsonFromDataCopyAuditStats(const ov::DataCopyAudit::Stats &stats);
+	Json::Value JsonFromLockStatsList(const std::vector<ov::LockProfiler::Stats> &stats_list);
 }  // namespace serdes
\ No newline at end of file
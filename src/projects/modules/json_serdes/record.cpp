@@ -255,6 +255,15 @@ namespace serdes
 			if (record->GetSequence() > 0)
 				SetInt(response, "sequence", record->GetSequence());
 
+			if (record->GetDroppedPackets() > 0)
+				SetInt64(response, "droppedPackets", record->GetDroppedPackets());
+
+			if (record->GetMaxWriteLatency() > 0)
+			{
+				SetInt64(response, "averageWriteLatency", record->GetAverageWriteLatency());
+				SetInt64(response, "maxWriteLatency", record->GetMaxWriteLatency());
+			}
+
 			if (record->GetRecordStartTime() != std::chrono::system_clock::from_time_t(0))
 			{
 				SetTimestamp(response, "startTime", record->GetRecordStartTime());
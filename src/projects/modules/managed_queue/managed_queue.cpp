@@ -12,5 +12,14 @@
 
 namespace ov
 {
+	// From 16us to 16s
+	static Histogram managed_queue_waiting_time_histogram(
+		"ome_managed_queue_waiting_seconds",
+		"Waiting time of the items in the managed queues",
+		0.000001, 16, 16 * 1000 * 1000);
 
+	Histogram &GetManagedQueueWaitingTimeHistogram()
+	{
+		return managed_queue_waiting_time_histogram;
+	}
 }  // namespace ov
\ No newline at end of file
@@ -18,18 +18,60 @@
 
 #include "base/info/managed_queue.h"
 #include "base/ovlibrary/ovlibrary.h"
+#include "managed_queue_ring_buffer.h"
 
 #define MANAGED_QUEUE_METRICS_UPDATE_INTERVAL_IN_MSEC		1000
 #define MANAGED_QUEUE_LOG_INTERVAL_IN_MSEC					5000
+// In ring buffer mode, the waiting time is measured once every N items
+#define MANAGED_QUEUE_WAITING_TIME_SAMPLING_INTERVAL		64
+// In ring buffer mode, the consumer checks the buffer this number of times before sleeping,
+// so the producers rarely have to wake it up while the items are flowing
+#define MANAGED_QUEUE_SPIN_COUNT							128
 
 namespace ov
 {
-	template <typename T>
+	// Waiting time of the items in all managed queues (microseconds, sampled in ring buffer mode)
+	Histogram &GetManagedQueueWaitingTimeHistogram();
+
+	// Tpolicy: ManagedQueueLinkedList or ManagedQueueRingBuffer<Capacity>
+	template <typename T, typename Tpolicy = ManagedQueueLinkedList>
 	class ManagedQueue : public info::ManagedQueue
 	{
 	private:
 		const char* LOG_TAG = "ManagedQueue";
 
+		static constexpr bool IsRingBuffer = ManagedQueuePolicyTraits<Tpolicy>::IsRingBuffer;
+
+		struct RingBufferStorage
+		{
+			LockFreeRingBuffer<T, ManagedQueuePolicyTraits<Tpolicy>::Capacity> buffer;
+
+			// Items that could not be pushed because the ring buffer was full
+			std::mutex spilled_mutex;
+			std::deque<T> spilled_items;
+			std::atomic<size_t> spilled_count{0};
+
+			// Number of consumers waiting in _condition
+			std::atomic<int> waiting_count{0};
+
+			std::atomic<size_t> input_count{0};
+			std::atomic<size_t> output_count{0};
+			size_t last_input_count = 0;
+			size_t last_output_count = 0;
+
+			// 0: idle, 1: being written, 2: ready
+			std::atomic<int> sample_state{0};
+			size_t sample_index = 0;
+			std::chrono::high_resolution_clock::time_point sample_time;
+
+			// Metrics are updated by one of the producers at a time
+			std::mutex metrics_mutex;
+		};
+
+		struct EmptyStorage
+		{
+		};
+
 		struct ManagedQueueNode
 		{
 			T data;
@@ -84,16 +126,31 @@ namespace ov
 
 		void Enqueue(const T& item)
 		{
-			auto lock_guard = std::lock_guard(_mutex);
+			if constexpr (IsRingBuffer)
+			{
+				T copied_item = item;
+				EnqueueToRingBuffer(std::move(copied_item));
+			}
+			else
+			{
+				auto lock_guard = std::lock_guard(_mutex);
 
-			EnqueueInternal(new ManagedQueueNode(item));
+				EnqueueInternal(new ManagedQueueNode(item));
+			}
 		}
 
 		void Enqueue(T&& item)
 		{
-			auto lock_guard = std::lock_guard(_mutex);
+			if constexpr (IsRingBuffer)
+			{
+				EnqueueToRingBuffer(std::move(item));
+			}
+			else
+			{
+				auto lock_guard = std::lock_guard(_mutex);
 
-			EnqueueInternal(new ManagedQueueNode(std::move(item)));
+				EnqueueInternal(new ManagedQueueNode(std::move(item)));
+			}
 		}
 
 		void EnqueueInternal(ManagedQueueNode* node)
@@ -127,6 +184,41 @@ namespace ov
 
 		std::optional<T> Front(int timeout = Infinite)
 		{
+			if constexpr (IsRingBuffer)
+			{
+				auto expire = GetExpireTime(timeout);
+
+				while (true)
+				{
+					if (_stop)
+					{
+						return {};	// Stop is requested
+					}
+
+					auto value = _ring_buffer.buffer.Peek();
+
+					if (value.has_value())
+					{
+						return value;
+					}
+
+					if (_ring_buffer.spilled_count > 0)
+					{
+						auto lock_guard = std::lock_guard(_ring_buffer.spilled_mutex);
+
+						if (_ring_buffer.spilled_items.empty() == false)
+						{
+							return _ring_buffer.spilled_items.front();
+						}
+					}
+
+					if (WaitForRingBuffer(timeout, expire) == false)
+					{
+						return {};	// timed out / Stop is requested
+					}
+				}
+			}
+
 			auto unique_lock = std::unique_lock(_mutex);
 
 			if (_stop)
@@ -150,6 +242,8 @@ namespace ov
 
 		std::optional<T> Back(int timeout = Infinite)
 		{
+			static_assert(IsRingBuffer == false, "Back() is not supported in ring buffer mode");
+
 			auto unique_lock = std::unique_lock(_mutex);
 
 			if (_stop)
@@ -173,6 +267,31 @@ namespace ov
 
 		std::optional<T> Dequeue(int timeout = Infinite)
 		{
+			if constexpr (IsRingBuffer)
+			{
+				auto expire = GetExpireTime(timeout);
+
+				while (true)
+				{
+					if (_stop)
+					{
+						return {};	// Stop is requested
+					}
+
+					auto value = TryDequeueFromRingBuffer();
+
+					if (value.has_value())
+					{
+						return value;
+					}
+
+					if (WaitForRingBuffer(timeout, expire) == false)
+					{
+						return {};	// timed out / Stop is requested
+					}
+				}
+			}
+
 			auto unique_lock = std::unique_lock(_mutex);
 
 			if (_stop)
@@ -209,7 +328,10 @@ namespace ov
 			if (node->_start != std::chrono::system_clock::time_point::max())
 			{
 				auto current = std::chrono::high_resolution_clock::now();
-				_waiting_time_in_us = _waiting_time_in_us * 0.9 + std::chrono::duration_cast<std::chrono::microseconds>(current - node->_start).count() * 0.1;
+				auto waiting_time_in_us = std::chrono::duration_cast<std::chrono::microseconds>(current - node->_start).count();
+				_waiting_time_in_us = _waiting_time_in_us * 0.9 + waiting_time_in_us * 0.1;
+
+				GetManagedQueueWaitingTimeHistogram().Record(waiting_time_in_us);
 			}
 
 			delete node;
@@ -219,6 +341,11 @@ namespace ov
 
 		bool IsEmpty() const
 		{
+			if constexpr (IsRingBuffer)
+			{
+				return IsRingBufferEmpty();
+			}
+
 			auto lock_guard = std::lock_guard(_mutex);
 
 			return (_size == 0);
@@ -227,6 +354,21 @@ namespace ov
 		// Cleared all items in the queue
 		void Clear()
 		{
+			if constexpr (IsRingBuffer)
+			{
+				while (_ring_buffer.buffer.TryPop().has_value())
+				{
+				}
+
+				auto lock_guard = std::lock_guard(_ring_buffer.spilled_mutex);
+				_ring_buffer.spilled_items.clear();
+				_ring_buffer.spilled_count = 0;
+
+				_size = 0;
+
+				return;
+			}
+
 			auto lock_guard = std::lock_guard(_mutex);
 
 			while (_front_node != nullptr)
@@ -245,11 +387,24 @@ namespace ov
 
 		size_t Size() const
 		{
+			if constexpr (IsRingBuffer)
+			{
+				return GetRingBufferSize();
+			}
+
 			auto lock_guard = std::lock_guard(_mutex);
 
 			return _size;
 		}
 
+		// Counts the items the consumer discarded without processing them
+		void IncreaseDropCount(uint64_t count = 1)
+		{
+			auto lock_guard = std::lock_guard(_mutex);
+
+			_dc += count;
+		}
+
 		void Stop()
 		{
 			auto lock_guard = std::lock_guard(_mutex);
@@ -265,6 +420,136 @@ namespace ov
 		}
 
 	protected:
+		static std::chrono::system_clock::time_point GetExpireTime(int timeout)
+		{
+			return (timeout == Infinite) ? std::chrono::system_clock::time_point::max() : std::chrono::system_clock::now() + std::chrono::milliseconds(timeout);
+		}
+
+		bool IsRingBufferEmpty() const
+		{
+			return _ring_buffer.buffer.IsEmpty() && (_ring_buffer.spilled_count == 0);
+		}
+
+		size_t GetRingBufferSize() const
+		{
+			return _ring_buffer.buffer.Size() + _ring_buffer.spilled_count;
+		}
+
+		void EnqueueToRingBuffer(T&& item)
+		{
+			auto &storage = _ring_buffer;
+
+			// Once an item is spilled, the following items are also spilled to keep the order
+			if ((storage.spilled_count > 0) || (storage.buffer.TryPush(std::move(item)) == false))
+			{
+				auto lock_guard = std::lock_guard(storage.spilled_mutex);
+
+				storage.spilled_items.push_back(std::move(item));
+				storage.spilled_count++;
+			}
+
+			auto index = storage.input_count.fetch_add(1, std::memory_order_relaxed);
+
+			if ((index % MANAGED_QUEUE_WAITING_TIME_SAMPLING_INTERVAL) == 0)
+			{
+				int expected = 0;
+
+				if (storage.sample_state.compare_exchange_strong(expected, 1, std::memory_order_acquire))
+				{
+					storage.sample_index = index;
+					storage.sample_time = std::chrono::high_resolution_clock::now();
+					storage.sample_state.store(2, std::memory_order_release);
+				}
+			}
+
+			{
+				auto metrics_lock = std::unique_lock(storage.metrics_mutex, std::try_to_lock);
+
+				if (metrics_lock.owns_lock())
+				{
+					UpdateMetrics();
+				}
+			}
+
+			// Wake up the consumers only if they are waiting
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+
+			if (storage.waiting_count.load(std::memory_order_relaxed) > 0)
+			{
+				auto lock_guard = std::lock_guard(_mutex);
+				_condition.notify_all();
+			}
+		}
+
+		std::optional<T> TryDequeueFromRingBuffer()
+		{
+			auto &storage = _ring_buffer;
+			auto value = storage.buffer.TryPop();
+
+			if ((value.has_value() == false) && (storage.spilled_count > 0))
+			{
+				auto lock_guard = std::lock_guard(storage.spilled_mutex);
+
+				if (storage.spilled_items.empty() == false)
+				{
+					value = std::move(storage.spilled_items.front());
+					storage.spilled_items.pop_front();
+					storage.spilled_count--;
+				}
+			}
+
+			if (value.has_value())
+			{
+				auto index = storage.output_count.fetch_add(1, std::memory_order_relaxed);
+
+				// Update statistics of waiting time (microseconds)
+				if ((storage.sample_state.load(std::memory_order_acquire) == 2) && (index >= storage.sample_index))
+				{
+					auto current = std::chrono::high_resolution_clock::now();
+					auto waiting_time_in_us = std::chrono::duration_cast<std::chrono::microseconds>(current - storage.sample_time).count();
+					_waiting_time_in_us = _waiting_time_in_us * 0.9 + waiting_time_in_us * 0.1;
+
+					GetManagedQueueWaitingTimeHistogram().Record(waiting_time_in_us);
+
+					storage.sample_state.store(0, std::memory_order_release);
+				}
+			}
+
+			return value;
+		}
+
+		// Returns false if timed out or stop is requested
+		bool WaitForRingBuffer(int timeout, const std::chrono::system_clock::time_point &expire)
+		{
+			if (timeout == 0)
+			{
+				return false;
+			}
+
+			for (int spin = 0; spin < MANAGED_QUEUE_SPIN_COUNT; spin++)
+			{
+				if ((IsRingBufferEmpty() == false) || _stop)
+				{
+					return (_stop == false);
+				}
+
+				CpuRelax();
+			}
+
+			auto unique_lock = std::unique_lock(_mutex);
+
+			_ring_buffer.waiting_count.fetch_add(1);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+
+			auto result = _condition.wait_until(unique_lock, expire, [this]() -> bool {
+				return (IsRingBufferEmpty() == false) || _stop;
+			});
+
+			_ring_buffer.waiting_count.fetch_sub(1);
+
+			return result && (_stop == false);
+		}
+
 		// Update the metadata to the monitor
 		void UpdateMetadataToMonitor()
 		{
@@ -280,6 +565,15 @@ namespace ov
 		// Update statistical metrics and send data to monitoring module.
 		void UpdateMetrics()
 		{
+			if constexpr (IsRingBuffer)
+			{
+				_size = GetRingBufferSize();
+
+				// Update statistics of input/output message count
+				_imc = _ring_buffer.input_count.load(std::memory_order_relaxed) - _ring_buffer.last_input_count;
+				_omc = _ring_buffer.output_count.load(std::memory_order_relaxed) - _ring_buffer.last_output_count;
+			}
+
 			// Update the peak statistics
 			if (_peak < _size)
 			{
@@ -293,6 +587,12 @@ namespace ov
 				_omps = _omc;
 				_omc = _imc = 0;
 
+				if constexpr (IsRingBuffer)
+				{
+					_ring_buffer.last_input_count = _ring_buffer.input_count.load(std::memory_order_relaxed);
+					_ring_buffer.last_output_count = _ring_buffer.output_count.load(std::memory_order_relaxed);
+				}
+
 				if ((_threshold > 0) && (_size >= _threshold))
 				{
 					_threshold_exceeded_time_in_us += _stats_metric_interval;
@@ -332,7 +632,10 @@ namespace ov
 		std::condition_variable _condition;
 
 		// Stop flag
-		bool _stop;
+		std::atomic<bool> _stop;
+
+		// Used only in ring buffer mode
+		std::conditional_t<IsRingBuffer, RingBufferStorage, EmptyStorage> _ring_buffer;
 	};
 
 }  // namespace ov
\ No newline at end of file
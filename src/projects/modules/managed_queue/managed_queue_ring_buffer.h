@@ -0,0 +1,188 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+namespace ov
+{
+	// Storage policies of ov::ManagedQueue
+
+	// Unbounded linked list protected by a mutex (allocates a node per item)
+	struct ManagedQueueLinkedList
+	{
+	};
+
+	// Bounded lock-free ring buffer (no allocation per item)
+	//
+	// Producers and consumers don't take a lock unless the consumer is waiting for an item.
+	// If the ring is full, the items are spilled into a mutex-protected list until the ring is drained,
+	// so it doesn't drop items and keeps FIFO order per producer.
+	template <size_t Tcapacity>
+	struct ManagedQueueRingBuffer
+	{
+		static_assert((Tcapacity >= 2) && ((Tcapacity & (Tcapacity - 1)) == 0), "Capacity must be a power of 2");
+
+		static constexpr size_t Capacity = Tcapacity;
+	};
+
+	template <typename Tpolicy>
+	struct ManagedQueuePolicyTraits
+	{
+		static constexpr bool IsRingBuffer = false;
+		// Not used
+		static constexpr size_t Capacity = 2;
+	};
+
+	template <size_t Tcapacity>
+	struct ManagedQueuePolicyTraits<ManagedQueueRingBuffer<Tcapacity>>
+	{
+		static constexpr bool IsRingBuffer = true;
+		static constexpr size_t Capacity = Tcapacity;
+	};
+
+	// Bounded MPMC queue using a sequence number per cell
+	// (Dmitry Vyukov's bounded MPMC queue)
+	template <typename T, size_t Tcapacity>
+	class LockFreeRingBuffer
+	{
+	public:
+		static_assert((Tcapacity >= 2) && ((Tcapacity & (Tcapacity - 1)) == 0), "Capacity must be a power of 2");
+
+		LockFreeRingBuffer()
+		{
+			for (size_t index = 0; index < Tcapacity; index++)
+			{
+				_cells[index].sequence.store(index, std::memory_order_relaxed);
+			}
+		}
+
+		// Returns false if the ring buffer is full (item is not moved in this case)
+		bool TryPush(T &&item)
+		{
+			size_t position = _enqueue_position.load(std::memory_order_relaxed);
+			Cell *cell = nullptr;
+
+			while (true)
+			{
+				cell = &(_cells[position & Mask]);
+				size_t sequence = cell->sequence.load(std::memory_order_acquire);
+				auto diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+
+				if (diff == 0)
+				{
+					if (_enqueue_position.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+					{
+						break;
+					}
+				}
+				else if (diff < 0)
+				{
+					// Full
+					return false;
+				}
+				else
+				{
+					position = _enqueue_position.load(std::memory_order_relaxed);
+				}
+			}
+
+			cell->data = std::move(item);
+			cell->sequence.store(position + 1, std::memory_order_release);
+
+			return true;
+		}
+
+		std::optional<T> TryPop()
+		{
+			size_t position = _dequeue_position.load(std::memory_order_relaxed);
+			Cell *cell = nullptr;
+
+			while (true)
+			{
+				cell = &(_cells[position & Mask]);
+				size_t sequence = cell->sequence.load(std::memory_order_acquire);
+				auto diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position + 1);
+
+				if (diff == 0)
+				{
+					if (_dequeue_position.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+					{
+						break;
+					}
+				}
+				else if (diff < 0)
+				{
+					// Empty
+					return {};
+				}
+				else
+				{
+					position = _dequeue_position.load(std::memory_order_relaxed);
+				}
+			}
+
+			std::optional<T> value = std::move(cell->data);
+			cell->data.reset();
+			cell->sequence.store(position + Tcapacity, std::memory_order_release);
+
+			return value;
+		}
+
+		// Returns a copy of the oldest item
+		// NOTE: This is safe only when there is a single consumer
+		std::optional<T> Peek() const
+		{
+			size_t position = _dequeue_position.load(std::memory_order_relaxed);
+			const Cell &cell = _cells[position & Mask];
+
+			if (cell.sequence.load(std::memory_order_acquire) != (position + 1))
+			{
+				return {};
+			}
+
+			return cell.data;
+		}
+
+		bool IsEmpty() const
+		{
+			size_t position = _dequeue_position.load(std::memory_order_relaxed);
+
+			return _cells[position & Mask].sequence.load(std::memory_order_acquire) != (position + 1);
+		}
+
+		// Approximate number of items (includes the items being pushed)
+		size_t Size() const
+		{
+			size_t dequeue_position = _dequeue_position.load(std::memory_order_relaxed);
+			size_t enqueue_position = _enqueue_position.load(std::memory_order_relaxed);
+
+			return (enqueue_position > dequeue_position) ? (enqueue_position - dequeue_position) : 0;
+		}
+
+	private:
+		static constexpr size_t Mask = Tcapacity - 1;
+		// To avoid false sharing between producers and consumers
+		static constexpr size_t CacheLineSize = 64;
+
+		struct Cell
+		{
+			std::atomic<size_t> sequence;
+			std::optional<T> data;
+		};
+
+		Cell _cells[Tcapacity];
+
+		alignas(CacheLineSize) std::atomic<size_t> _enqueue_position{0};
+		alignas(CacheLineSize) std::atomic<size_t> _dequeue_position{0};
+	};
+}  // namespace ov
@@ -17,7 +17,16 @@ namespace mpegts
 
 	MpegTsDepacketizer::MpegTsDepacketizer()
 	{
+		_last_continuity_counter_table.fill(MPEGTS_NO_CONTINUITY_COUNTER);
 
+		_packet_type_table.fill(PacketType::UNKNOWN);
+
+		// Well known PIDs
+		_packet_type_table[static_cast<uint16_t>(WellKnownPacketId::PAT)] = PacketType::SUPPORTED_SECTION;
+		_packet_type_table[static_cast<uint16_t>(WellKnownPacketId::CAT)] = PacketType::UNSUPPORTED_SECTION;
+		_packet_type_table[static_cast<uint16_t>(WellKnownPacketId::TSDT)] = PacketType::UNSUPPORTED_SECTION;
+		_packet_type_table[static_cast<uint16_t>(WellKnownPacketId::NIT)] = PacketType::UNSUPPORTED_SECTION;
+		_packet_type_table[static_cast<uint16_t>(WellKnownPacketId::SDT)] = PacketType::UNSUPPORTED_SECTION;
 	}
 
 	MpegTsDepacketizer::~MpegTsDepacketizer()
@@ -27,83 +36,166 @@ namespace mpegts
 
 	bool MpegTsDepacketizer::AddPacket(const std::shared_ptr<const ov::Data> &packet)
 	{
+		bool result = true;
+
+		// Most of datagrams (SRT, UDP) consist of whole packets, so they are parsed without copying
+		if (_buffer->IsEmpty())
+		{
+			auto data = packet->GetDataAs<uint8_t>();
+			auto length = packet->GetLength();
+			auto consumed_length = ParsePackets(data, length, &result);
+
+			if (consumed_length < length)
+			{
+				_buffer->Append(data + consumed_length, length - consumed_length);
+			}
+
+			return result;
+		}
+
 		_buffer->Append(packet);
 
-		while(_buffer->GetLength() >= MPEGTS_MIN_PACKET_SIZE)
+		auto consumed_length = ParsePackets(_buffer->GetDataAs<uint8_t>(), _buffer->GetLength(), &result);
+		_buffer->Erase(0, consumed_length);
+
+		return result;
+	}
+
+	size_t MpegTsDepacketizer::ParsePackets(const uint8_t *data, size_t length, bool *result)
+	{
+		size_t offset = 0;
+
+		while ((length - offset) >= MPEGTS_MIN_PACKET_SIZE)
 		{
-			auto packet = std::make_shared<MpegTsPacket>(_buffer);
-			
-			uint32_t parsed_length = packet->Parse();
-			if(parsed_length == 0)
+			// Validate sync bytes of all whole packets at once, so the common case runs without branches per field
+			size_t packet_count = (length - offset) / MPEGTS_MIN_PACKET_SIZE;
+			size_t synced_count = 0;
+
+			for (auto position = data + offset; synced_count < packet_count; synced_count++, position += MPEGTS_MIN_PACKET_SIZE)
 			{
-				_buffer = _buffer->Subdata(MPEGTS_MIN_PACKET_SIZE);
-				return false;
+				if (*position != MPEGTS_SYNC_BYTE)
+				{
+					break;
+				}
 			}
 
-			_buffer = _buffer->Subdata(parsed_length);
+			for (size_t index = 0; index < synced_count; index++)
+			{
+				if (ParsePacket(data + offset) == false)
+				{
+					*result = false;
+				}
+
+				offset += MPEGTS_MIN_PACKET_SIZE;
+			}
+
+			if (synced_count < packet_count)
+			{
+				// Lost sync, find the next sync byte
+				auto next = static_cast<const uint8_t *>(::memchr(data + offset + 1, MPEGTS_SYNC_BYTE, length - offset - 1));
+				auto skipped_length = (next != nullptr) ? static_cast<size_t>(next - (data + offset)) : (length - offset);
+
+				logtw("Sync byte not found, %zu bytes are skipped", skipped_length);
+
+				offset += skipped_length;
+				*result = false;
+			}
+		}
+
+		return offset;
+	}
+
+	bool MpegTsDepacketizer::ParsePacket(const uint8_t *packet)
+	{
+		//  76543210  76543210  76543210  76543210
+		// [ssssssss][tpTPPPPP][PPPPPPPP][SSaacccc]...
+		bool transport_error_indicator = OV_GET_BIT(packet[1], 7);
+		if (transport_error_indicator)
+		{
+			return false;
+		}
+
+		bool payload_unit_start_indicator = OV_GET_BIT(packet[1], 6);
+		uint16_t pid = ((packet[1] & 0x1F) << 8) | packet[2];
+		uint8_t adaptation_field_control = (packet[3] >> 4) & 0x03;
+		uint8_t continuity_counter = packet[3] & 0x0F;
+
+		// 01: No adaptation_field, payload only
+		// 10: Adaptation_field only, no payload
+		// 11: Adaptation_field followed by payload
+		if (OV_GET_BIT(adaptation_field_control, 0) == false)
+		{
+			return true;
+		}
+
+		CheckContinuityCounter(pid, continuity_counter);
 
-			if(AddPacket(packet) == false)
+		size_t payload_offset = 4;
+		if (OV_GET_BIT(adaptation_field_control, 1))
+		{
+			// adaptation_field_length + adaptation field
+			payload_offset += 1 + packet[4];
+			if (payload_offset > MPEGTS_MIN_PACKET_SIZE)
 			{
+				logte("Invalid adaptation field length: %d (PID: %d)", packet[4], pid);
 				return false;
 			}
 		}
 
-		return true;
+		return DispatchPacket(pid, payload_unit_start_indicator, packet + payload_offset, MPEGTS_MIN_PACKET_SIZE - payload_offset);
 	}
 
 	bool MpegTsDepacketizer::AddPacket(const std::shared_ptr<MpegTsPacket> &packet)
 	{
-		auto packet_type = GetPacketType(packet);
+		if (packet->HasPayload() == false)
+		{
+			return true;
+		}
+
+		CheckContinuityCounter(packet->PacketIdentifier(), packet->ContinuityCounter());
 
-		// Check continuity counter
+		return DispatchPacket(packet->PacketIdentifier(), packet->PayloadUnitStartIndicator(), packet->Payload(), packet->PayloadLength());
+	}
+
+	void MpegTsDepacketizer::CheckContinuityCounter(uint16_t pid, uint8_t continuity_counter)
+	{
 		// TODO(Getroot): Later, it can be used for jitter buffer to correct the UDP packet order
-		if(packet->HasPayload())
-		{	
-			auto it = _last_continuity_counter_map.find(packet->PacketIdentifier());
-			if(it == _last_continuity_counter_map.end())
+		auto &last_counter = _last_continuity_counter_table[pid];
+
+		if (last_counter != MPEGTS_NO_CONTINUITY_COUNTER)
+		{
+			uint8_t expected_counter = (last_counter + 1) & 0x0F;
+
+			if (continuity_counter != expected_counter)
 			{
-				_last_continuity_counter_map.emplace(packet->PacketIdentifier(), packet->ContinuityCounter());
+				logtw("An out-of-order packet was received.(PID : %d Expected : %d, Received : %d",
+					pid, expected_counter, continuity_counter);
 			}
-			else
-			{
-				auto prev_counter = it->second;
-				uint8_t expected_counter;
-
-				if(prev_counter < 0x0f)
-				{
-					expected_counter = prev_counter + 1;
-				}
-				else
-				{
-					expected_counter = 0;
-				}
+		}
 
-				if(packet->ContinuityCounter() != expected_counter)
-				{
-					logtw("An out-of-order packet was received.(PID : %d Expected : %d, Received : %d",
-						packet->PacketIdentifier(), expected_counter, packet->ContinuityCounter());
-				}
+		last_counter = continuity_counter;
+	}
 
-				_last_continuity_counter_map[packet->PacketIdentifier()] = packet->ContinuityCounter();
-			}	
-		}
+	bool MpegTsDepacketizer::DispatchPacket(uint16_t pid, bool payload_unit_start_indicator, const uint8_t *payload, size_t payload_length)
+	{
+		auto packet_type = GetPacketType(pid);
 
 		// If PAT and PMT are completed, it doesn't need to parse anymore
 		if(packet_type == PacketType::SUPPORTED_SECTION)
 		{
 			if(IsTrackInfoAvailable() == false)
 			{
-				return ParseSection(packet);
+				return ParseSection(pid, payload_unit_start_indicator, payload, payload_length);
 			}
 		}
 		else if(packet_type == PacketType::PES)
 		{
-			return ParsePes(packet);
+			return ParsePes(pid, payload_unit_start_indicator, payload, payload_length);
 		}
 		else if(packet_type == PacketType::UNSUPPORTED_SECTION)
 		{
 			// FFMPEG ususally sends PID 17 (DVB - SDT), but we don't use this table now
-			logtd("Ignored unsupported or unknown MPEG-TS packets.(PID: %d)", packet->PacketIdentifier());
+			logtd("Ignored unsupported or unknown MPEG-TS packets.(PID: %d)", pid);
 			return false;
 		}
 		
@@ -181,46 +273,25 @@ namespace mpegts
 		return es;
 	}
 
-	PacketType MpegTsDepacketizer::GetPacketType(const std::shared_ptr<MpegTsPacket> &packet)
+	PacketType MpegTsDepacketizer::GetPacketType(uint16_t pid)
 	{
-		switch(packet->PacketIdentifier())
-		{
-			// Well known PIDs
-			case static_cast<uint16_t>(WellKnownPacketId::PAT):
-				return PacketType::SUPPORTED_SECTION;
-
-			case static_cast<uint16_t>(WellKnownPacketId::CAT):
-			case static_cast<uint16_t>(WellKnownPacketId::TSDT):
-			case static_cast<uint16_t>(WellKnownPacketId::NIT):
-			case static_cast<uint16_t>(WellKnownPacketId::SDT):
-				return PacketType::UNSUPPORTED_SECTION;
-		}
-
 		// PMT's PID are in PAT, PES's PID are in PMT
 		// For quickly search they are stored in packet_type_table
-		auto it = _packet_type_table.find(packet->PacketIdentifier());
-		if(it == _packet_type_table.end())
-		{
-			return PacketType::UNKNOWN;
-		}
-
-		auto packet_type = it->second;
-
-		return packet_type;
+		return _packet_type_table[pid & (MPEGTS_PID_COUNT - 1)];
 	}
 
-	bool MpegTsDepacketizer::ParseSection(const std::shared_ptr<MpegTsPacket> &packet)
+	bool MpegTsDepacketizer::ParseSection(uint16_t pid, bool payload_unit_start_indicator, const uint8_t *payload, size_t payload_length)
 	{
-		BitReader bit_reader(packet->Payload(), packet->PayloadLength());
+		BitReader bit_reader(payload, payload_length);
 
 		// First packet of section, it means need to create new section draft and completed previous section
-		if(packet->PayloadUnitStartIndicator())
+		if(payload_unit_start_indicator)
 		{
 			// read pointer field - 8 bits
 			auto pointer_field = bit_reader.ReadBytes<uint8_t>();
 
 			// Check if there was an incomplete section
-			auto prev_section = GetSectionDraft(packet->PacketIdentifier());
+			auto prev_section = GetSectionDraft(pid);
 			if(prev_section != nullptr)
 			{
 				// Extract remaining data of previous section
@@ -232,14 +303,14 @@ namespace mpegts
 					// Previous section completed
 					if(CompleteSection(prev_section) == false)
 					{
-						logte("Could not complete section(PID: %d)", packet->PacketIdentifier());
+						logte("Could not complete section(PID: %d)", pid);
 						return false;
 					}
 				}
 				else
 				{
 					// Somethind wrong
-					logte("Could not complete section(PID: %d)", packet->PacketIdentifier());
+					logte("Could not complete section(PID: %d)", pid);
 				}
 			}
 
@@ -249,13 +320,13 @@ namespace mpegts
 			// Parsing new section
 			while(bit_reader.BytesRemained() > 0)
 			{
-				auto new_section = std::make_shared<Section>(packet->PacketIdentifier());
+				auto new_section = std::make_shared<Section>(pid);
 				// There can be more than 2 sections
 				auto consumed_bytes = new_section->AppendData(bit_reader.CurrentPosition(), bit_reader.BytesRemained());
 				if(consumed_bytes == 0)
 				{
 					// Something wrong
-					logte("Could not parse section(PID: %d)", packet->PacketIdentifier());
+					logte("Could not parse section(PID: %d)", pid);
 					return false;
 				}
 
@@ -265,7 +336,7 @@ namespace mpegts
 				{
 					if(CompleteSection(new_section) == false)
 					{
-						logte("Could not complete section(PID: %d)", packet->PacketIdentifier());
+						logte("Could not complete section(PID: %d)", pid);
 						return false;
 					}
 				}
@@ -279,17 +350,17 @@ namespace mpegts
 		// There is only continuation of section data
 		else
 		{
-			auto section = GetSectionDraft(packet->PacketIdentifier());
+			auto section = GetSectionDraft(pid);
 			if(section == nullptr)
 			{
 				// Something wrong
-				logte("Could not find section(PID: %d) for depacketizing", packet->PacketIdentifier());
+				logte("Could not find section(PID: %d) for depacketizing", pid);
 				return false;
 			}
 
 			// There is no new section in this packet, so all remained data has to be consumed
-			auto consumed_length = section->AppendData(packet->Payload(), packet->PayloadLength());
-			if(consumed_length != packet->PayloadLength())
+			auto consumed_length = section->AppendData(payload, payload_length);
+			if(consumed_length != payload_length)
 			{
 				return false;
 			}
@@ -303,21 +374,21 @@ namespace mpegts
 		return true;
 	}
 
-	bool MpegTsDepacketizer::ParsePes(const std::shared_ptr<MpegTsPacket> &packet)
+	bool MpegTsDepacketizer::ParsePes(uint16_t pid, bool payload_unit_start_indicator, const uint8_t *payload, size_t payload_length)
 	{
 		// First packet of pes, it has pes header
-		if(packet->PayloadUnitStartIndicator())
+		if(payload_unit_start_indicator)
 		{
 			// If there is previous PES, that is completed
-			auto prev_pes = GetPesDraft(packet->PacketIdentifier());
+			auto prev_pes = GetPesDraft(pid);
 			if(prev_pes != nullptr)
 			{
 				CompletePes(prev_pes);
 			}
 
-			auto pes = std::make_shared<Pes>(packet->PacketIdentifier());
-			auto consumed_length = pes->AppendData(packet->Payload(), packet->PayloadLength());
-			if(consumed_length != packet->PayloadLength())
+			auto pes = std::make_shared<Pes>(pid);
+			auto consumed_length = pes->AppendData(payload, payload_length);
+			if(consumed_length != payload_length)
 			{
 				logte("Something wrong with parsing PES");
 				return false;
@@ -338,17 +409,17 @@ namespace mpegts
 		}
 		else
 		{
-			auto pes = GetPesDraft(packet->PacketIdentifier());
+			auto pes = GetPesDraft(pid);
 			if(pes == nullptr)
 			{
 				// This can be called if the encoder sends faster than the server starts. 
 				// These packets can be ignored. 
-				logtd("Could not find the pes draft (PID: %d)", packet->PacketIdentifier());
+				logtd("Could not find the pes draft (PID: %d)", pid);
 				return false;
 			}
 
-			auto consumed_length = pes->AppendData(packet->Payload(), packet->PayloadLength());
-			if(consumed_length != packet->PayloadLength())
+			auto consumed_length = pes->AppendData(payload, payload_length);
+			if(consumed_length != payload_length)
 			{
 				logte("Something wrong with parsing PES");
 				return false;
@@ -412,7 +483,7 @@ namespace mpegts
 			// PAT
 			_pat_map.emplace(pat->_program_num, section);
 			// Reserve PMT's PID
-			_packet_type_table.emplace(pat->_program_map_pid, PacketType::SUPPORTED_SECTION);
+			_packet_type_table[pat->_program_map_pid & (MPEGTS_PID_COUNT - 1)] = PacketType::SUPPORTED_SECTION;
 
 			// The last section for PAT
 			// section number starts from 0
@@ -426,7 +497,7 @@ namespace mpegts
 			auto pmt = section->GetPMT();
 			for(const auto &es_info : pmt->_es_info_list)
 			{
-				_packet_type_table.emplace(es_info->_elementary_pid, PacketType::PES);
+				_packet_type_table[es_info->_elementary_pid & (MPEGTS_PID_COUNT - 1)] = PacketType::PES;
 			}
 
 			// PMT
@@ -8,6 +8,8 @@
 //==============================================================================
 #pragma once
 
+#include <array>
+
 #include <base/ovlibrary/ovlibrary.h>
 #include <base/mediarouter/media_type.h>
 #include <base/info/media_track.h>
@@ -27,6 +29,10 @@
 	(Create New ES 1)
 */
 
+// PID is 13 bits
+#define MPEGTS_PID_COUNT			0x2000
+#define MPEGTS_NO_CONTINUITY_COUNTER	0xFF
+
 namespace mpegts
 {
 	enum class PacketType : uint8_t
@@ -43,6 +49,7 @@ namespace mpegts
 		MpegTsDepacketizer();
 		~MpegTsDepacketizer();
 
+		// Parses all 188-byte packets in the data (e.g. 7 x 188 bytes of a datagram) in place
 		bool AddPacket(const std::shared_ptr<const ov::Data> &packet);
 		bool AddPacket(const std::shared_ptr<MpegTsPacket> &packet);
 
@@ -57,10 +64,16 @@ namespace mpegts
 		const std::shared_ptr<Pes> PopES();
 
 	private:
-		PacketType GetPacketType(const std::shared_ptr<MpegTsPacket> &packet);
+		// Returns the number of bytes consumed, the remaining bytes (less than a packet) have to be kept
+		size_t ParsePackets(const uint8_t *data, size_t length, bool *result);
+		bool ParsePacket(const uint8_t *packet);
+		bool DispatchPacket(uint16_t pid, bool payload_unit_start_indicator, const uint8_t *payload, size_t payload_length);
+		void CheckContinuityCounter(uint16_t pid, uint8_t continuity_counter);
+
+		PacketType GetPacketType(uint16_t pid);
 
-		bool ParseSection(const std::shared_ptr<MpegTsPacket> &packet);
-		bool ParsePes(const std::shared_ptr<MpegTsPacket> &packet);
+		bool ParseSection(uint16_t pid, bool payload_unit_start_indicator, const uint8_t *payload, size_t payload_length);
+		bool ParsePes(uint16_t pid, bool payload_unit_start_indicator, const uint8_t *payload, size_t payload_length);
 		
 		const std::shared_ptr<Section> GetSectionDraft(uint16_t pid);	
 		// incompleted section will be inserted
@@ -86,8 +99,8 @@ namespace mpegts
 		std::shared_mutex _pes_draft_map_lock;
 		std::map<uint16_t, std::shared_ptr<Pes>> _pes_draft_map;
 
-		// PID : Last continuity counter
-		std::map<uint16_t, uint8_t> _last_continuity_counter_map;
+		// PID : Last continuity counter (MPEGTS_NO_CONTINUITY_COUNTER if no packet has been received)
+		std::array<uint8_t, MPEGTS_PID_COUNT> _last_continuity_counter_table;
 
 		// PAT
 		bool _pat_list_completed = false;
@@ -114,9 +127,10 @@ namespace mpegts
 		
 		// PMT, PES quickly search PMT, PES
 		// PID : PacketType 
+		// Well known PIDs are set in the constructor
 		// PMT's PID comes from PAT
 		// PES's PID comes from PMT/ES_INFO
-		std::map<uint16_t, PacketType>	_packet_type_table;
+		std::array<PacketType, MPEGTS_PID_COUNT> _packet_type_table;
 
 		std::shared_ptr<ov::Data> _buffer = std::make_shared<ov::Data>();
 	};
@@ -36,12 +36,7 @@
 
 	while(1)
 	{
-		_writer->PutData(
-			media_packet->GetTrackId(),
-			media_packet->GetPts(),
-			media_packet->GetDts(),
-			media_packet->GetFlag(),
-			media_packet->GetData());
+		_writer->PutData(media_packet);
 	}
 
 	_writer->Stop();
@@ -119,16 +114,66 @@ ov::String MpegtsWriter::GetPath()
 	return _path;
 }
 
+void MpegtsWriter::SetTsPacketCallback(TsPacketCallback callback)
+{
+	std::unique_lock<std::mutex> mlock(_lock);
+
+	_ts_packet_callback = std::move(callback);
+}
+
 bool MpegtsWriter::Start()
 {
 	std::unique_lock<std::mutex> mlock(_lock);
 
 	AVDictionary *options = nullptr;
 
-	av_dict_set(&options, "fflags", "flush_packets", 0);
+	bool use_arena = (strcmp(_format_context->oformat->name, "mpegts") == 0);
+
+	if ((use_arena == false) && (_ts_packet_callback != nullptr))
+	{
+		logte("TS packet callback is only available for mpegts format. format(%s)", _format_context->oformat->name);
+		return false;
+	}
+
+	if (use_arena)
+	{
+		if (_ts_packet_callback == nullptr)
+		{
+			// udp:// sends every MPEGTS_WRITER_DATAGRAM_SIZE bytes as a datagram
+			av_dict_set_int(&options, "pkt_size", MPEGTS_WRITER_DATAGRAM_SIZE, 0);
+
+			int error = avio_open2(&_output_context, _format_context->url, AVIO_FLAG_WRITE, nullptr, &options);
+			av_dict_free(&options);
+
+			if (error < 0)
+			{
+				char errbuf[256];
+				av_strerror(error, errbuf, sizeof(errbuf));
+
+				logte("Error opening file. error(%d:%s), filename(%s)", error, errbuf, _format_context->url);
+
+				return false;
+			}
+		}
+
+		auto buffer = static_cast<unsigned char *>(::av_malloc(MPEGTS_WRITER_IO_BUFFER_SIZE));
+		_avio_context = ::avio_alloc_context(buffer, MPEGTS_WRITER_IO_BUFFER_SIZE, 1, this, nullptr, OnWrite, nullptr);
+		if (_avio_context == nullptr)
+		{
+			::av_free(buffer);
+			logte("Could not create avio context");
+			return false;
+		}
+
+		_ts_packet_arena = std::make_shared<ov::Data>(MPEGTS_WRITER_IO_BUFFER_SIZE);
 
-	if (!(_format_context->oformat->flags & AVFMT_NOFILE))
+		_format_context->pb = _avio_context;
+		_format_context->flags |= AVFMT_FLAG_CUSTOM_IO | AVFMT_FLAG_FLUSH_PACKETS;
+	}
+	else if (!(_format_context->oformat->flags & AVFMT_NOFILE))
 	{
+		av_dict_set(&options, "fflags", "flush_packets", 0);
+
 		int error = avio_open2(&_format_context->pb, _format_context->url, AVIO_FLAG_WRITE, nullptr, &options);
 		if (error < 0)
 		{
@@ -168,7 +213,16 @@ bool MpegtsWriter::Stop()
 
 	if (_format_context != nullptr)
 	{
-		if (_format_context->pb != nullptr)
+		if (_avio_context != nullptr)
+		{
+			// Send TS packets left in the arena
+			avio_flush(_avio_context);
+			SendTsPackets(true);
+
+			// Custom IO is released below
+			_format_context->pb = nullptr;
+		}
+		else if (_format_context->pb != nullptr)
 		{
 			avformat_close_input(&_format_context);
 		}
@@ -178,9 +232,69 @@ bool MpegtsWriter::Stop()
 		_format_context = nullptr;
 	}
 
+	if (_avio_context != nullptr)
+	{
+		OV_SAFE_FUNC(_avio_context->buffer, nullptr, ::av_free, );
+		::avio_context_free(&_avio_context);
+	}
+
+	if (_output_context != nullptr)
+	{
+		avio_closep(&_output_context);
+	}
+
+	_ts_packet_arena = nullptr;
+
 	return true;
 }
 
+int MpegtsWriter::OnWrite(const uint8_t *buf, int buf_size)
+{
+	if (buf_size < 0)
+	{
+		logte("Invalid buffer size: %d", buf_size);
+		return -1;
+	}
+
+	// The capacity of the arena is kept, so it isn't reallocated after the largest frame
+	_ts_packet_arena->Append(buf, buf_size);
+
+	return buf_size;
+}
+
+bool MpegtsWriter::SendTsPackets(bool flush_all)
+{
+	if (((_output_context == nullptr) && (_ts_packet_callback == nullptr)) || (_ts_packet_arena == nullptr))
+	{
+		return false;
+	}
+
+	auto length = _ts_packet_arena->GetLength();
+	auto send_length = flush_all ? length : (length - (length % MPEGTS_WRITER_DATAGRAM_SIZE));
+
+	if (send_length == 0)
+	{
+		return true;
+	}
+
+	if (_ts_packet_callback != nullptr)
+	{
+		// Copied once here, then shared by all receivers of the callback
+		_ts_packet_callback(_ts_packet_arena->Subdata(0, send_length)->Clone());
+		_ts_packet_arena->Erase(0, send_length);
+
+		return true;
+	}
+
+	avio_write(_output_context, _ts_packet_arena->GetDataAs<uint8_t>(), send_length);
+	avio_flush(_output_context);
+
+	// Less than a datagram remains, it is sent with the next frame
+	_ts_packet_arena->Erase(0, send_length);
+
+	return (_output_context->error == 0);
+}
+
 bool MpegtsWriter::AddTrack(cmn::MediaType media_type, int32_t track_id, std::shared_ptr<MpegtsTrackInfo> track_info)
 {
 	std::unique_lock<std::mutex> mlock(_lock);
@@ -276,8 +390,15 @@ bool MpegtsWriter::AddTrack(cmn::MediaType media_type, int32_t track_id, std::sh
 //	- H264 : AnnexB bitstream
 // 	- AAC : ASC(Audio Specific Config) bitstream
 
-bool MpegtsWriter::PutData(int32_t track_id, int64_t pts, int64_t dts, MediaPacketFlag flag, cmn::BitstreamFormat format, std::shared_ptr<ov::Data> &data)
+bool MpegtsWriter::PutData(const std::shared_ptr<const MediaPacket> &packet)
 {
+	auto track_id = packet->GetTrackId();
+	auto pts = packet->GetPts();
+	auto dts = packet->GetDts();
+	auto flag = packet->GetFlag();
+	auto format = packet->GetBitstreamFormat();
+	auto data = packet->GetData();
+
 	std::unique_lock<std::mutex> mlock(_lock);
 
 	if (_format_context == nullptr)
@@ -325,7 +446,7 @@ bool MpegtsWriter::PutData(int32_t track_id, int64_t pts, int64_t dts, MediaPack
 			break;
 
 		case cmn::BitstreamFormat::H264_ANNEXB:
-			cdata = H264Converter::ConvertAnnexbToAvcc(cdata);
+			cdata = H264Converter::ConvertAnnexbToAvcc(packet);
 			av_packet.size = cdata->GetLength();
 			av_packet.data = (uint8_t *)cdata->GetDataAs<uint8_t>();
 			break;
@@ -389,6 +510,18 @@ bool MpegtsWriter::PutData(int32_t track_id, int64_t pts, int64_t dts, MediaPack
 		return false;
 	}
 
+	if (_avio_context != nullptr)
+	{
+		// The frame has been muxed into the arena, send it as one burst of datagrams
+		avio_flush(_avio_context);
+
+		if (SendTsPackets(false) == false)
+		{
+			logte("Could not send TS packets to %s", _path.CStr());
+			return false;
+		}
+	}
+
 	return true;
 }
 
@@ -3,6 +3,8 @@
 #include <base/mediarouter/media_buffer.h>
 #include <base/ovlibrary/ovlibrary.h>
 
+#include <functional>
+
 extern "C"
 {
 #include <libavcodec/avcodec.h>
@@ -11,6 +13,10 @@ extern "C"
 #include <libavutil/channel_layout.h>
 };
 
+// 7 TS packets, the payload of a datagram (UDP/SRT)
+#define MPEGTS_WRITER_DATAGRAM_SIZE (188 * 7)
+#define MPEGTS_WRITER_IO_BUFFER_SIZE (MPEGTS_WRITER_DATAGRAM_SIZE * 32)
+
 class MpegtsTrackInfo
 {
 public:
@@ -111,6 +117,9 @@ private:
 class MpegtsWriter
 {
 public:
+	// Receives the TS packets muxed from a frame (in multiples of MPEGTS_WRITER_DATAGRAM_SIZE except the last call)
+	using TsPacketCallback = std::function<void(const std::shared_ptr<const ov::Data> &ts_packets)>;
+
 	static std::shared_ptr<MpegtsWriter> Create();
 
 	MpegtsWriter();
@@ -122,22 +131,44 @@ public:
 	bool SetPath(const ov::String path, const ov::String format = nullptr);
 	ov::String GetPath();
 
+	// If it is set before Start(), the TS packets are passed to the callback instead of being written to the path
+	// (the path is only used as a name, and the format must be mpegts)
+	void SetTsPacketCallback(TsPacketCallback callback);
+
 	bool Start();
 
 	bool Stop();
 
 	bool AddTrack(cmn::MediaType media_type, int32_t track_id, std::shared_ptr<MpegtsTrackInfo> trackinfo);
 
-	bool PutData(int32_t track_id, int64_t pts, int64_t dts, MediaPacketFlag flag, cmn::BitstreamFormat format, std::shared_ptr<ov::Data>& data);
+	bool PutData(const std::shared_ptr<const MediaPacket> &packet);
 
 	static void FFmpegLog(void* ptr, int level, const char* fmt, va_list vl);
 
 private:
+	int OnWrite(const uint8_t *buf, int buf_size);
+	static int OnWrite(void *opaque, uint8_t *buf, int buf_size)
+	{
+		return (static_cast<MpegtsWriter *>(opaque))->OnWrite(buf, buf_size);
+	}
+
+	// Sends the TS packets of the arena in multiples of MPEGTS_WRITER_DATAGRAM_SIZE
+	// If flush_all is true, the remainder (less than a datagram) is also sent
+	bool SendTsPackets(bool flush_all);
+
 	ov::String _path;
 	ov::String _format;
 
 	AVFormatContext* _format_context;
 
+	// For mpegts, the muxer writes TS packets into _ts_packet_arena through _avio_context,
+	// and they are sent to _output_context (udp://, srt://, file) as 1316-byte aligned bursts
+	AVIOContext* _avio_context = nullptr;
+	AVIOContext* _output_context = nullptr;
+	// Reused for every frame, it only grows up to the largest frame
+	std::shared_ptr<ov::Data> _ts_packet_arena;
+	TsPacketCallback _ts_packet_callback = nullptr;
+
 	// <MediaTrack.id, std::hsared_ptr<MpegtsTrackInfo>>
 	std::map<int32_t, std::shared_ptr<MpegtsTrackInfo>> _trackinfo_map;
 
@@ -9,11 +9,13 @@
 
 #include "origin_map_client.h"
 
+#include <sys/socket.h>
+
 #define OV_LOG_TAG "OriginMapClient"
 
 OriginMapClient::OriginMapClient(const ov::String &redis_host, const ov::String &redis_password)
 {
-	// Parse ip:port 
+	// Parse ip:port
 	auto ip_port = redis_host.Split(":");
 	if (ip_port.size() != 2)
 	{
@@ -31,36 +33,112 @@ OriginMapClient::OriginMapClient(const ov::String &redis_host, const ov::String
 		},
 		2500);
 	_update_timer.Start();
+
+	_subscribe_thread = std::thread(&OriginMapClient::SubscribeThread, this);
+	::pthread_setname_np(_subscribe_thread.native_handle(), "OriginMapSub");
+}
+
+OriginMapClient::~OriginMapClient()
+{
+	_update_timer.Stop();
+
+	{
+		std::lock_guard<std::mutex> lock(_subscribe_context_mutex);
+		_stop_subscribe = true;
+
+		// Wake up the subscriber thread blocked in redisGetReply()
+		if (_subscribe_context != nullptr)
+		{
+			::shutdown(_subscribe_context->fd, SHUT_RDWR);
+		}
+	}
+	_subscribe_stop_cv.notify_all();
+
+	if (_subscribe_thread.joinable())
+	{
+		_subscribe_thread.join();
+	}
+
+	std::lock_guard<std::mutex> lock(_redis_context_mutex);
+	if (_redis_context != nullptr)
+	{
+		redisFree(_redis_context);
+		_redis_context = nullptr;
+	}
 }
 
 bool OriginMapClient::NofifyStreamsAlive()
 {
-	std::lock_guard<std::mutex> lock(_origin_map_mutex);
-	for (auto &[key, value] : _origin_map)
+	std::vector<ov::String> app_stream_names;
+	std::vector<RedisCommand> commands;
+
+	if (_withdrawn == false)
 	{
-		Update(key, value);
+		std::lock_guard<std::mutex> lock(_origin_map_mutex);
+		for (auto &[key, value] : _origin_map)
+		{
+			// XX option or EXPIRE cmd are not used because if redis server is restarted, update() can restore the origin stream info.
+			app_stream_names.push_back(key);
+			commands.push_back({"SET", key, value, "EX", "10"});
+
+			auto viewer_count = _viewer_count_map.find(key);
+			app_stream_names.push_back(key);
+			commands.push_back({"ZADD", ORIGIN_MAP_POPULAR_STREAMS_KEY, ov::Converter::ToString((viewer_count != _viewer_count_map.end()) ? viewer_count->second : 0), key});
+		}
 	}
 
-	return true;
+	{
+		// Remove the expired items of the cache
+		auto now = static_cast<int64_t>(ov::Clock::NowMSec());
+
+		std::lock_guard<std::mutex> lock(_cache_mutex);
+		for (auto it = _cache.begin(); it != _cache.end();)
+		{
+			it = (it->second.expire_time_msec <= now) ? _cache.erase(it) : std::next(it);
+		}
+	}
+
+	if (commands.empty())
+	{
+		return true;
+	}
+
+	// All streams are updated in a round trip
+	auto replies = Execute(std::move(commands));
+
+	bool result = true;
+	for (size_t index = 0; index < replies.size(); index++)
+	{
+		auto &reply = replies[index];
+
+		if (reply == nullptr || reply->type == REDIS_REPLY_ERROR)
+		{
+			logte("Failed to update origin host of <%s> to redis : %s:%d (err:%s)", app_stream_names[index].CStr(), _redis_ip.CStr(), _redis_port, reply != nullptr ? reply->str : "nil");
+			result = false;
+		}
+	}
+
+	return result;
 }
 
 bool OriginMapClient::Register(const ov::String &app_stream_name, const ov::String &origin_host)
 {
-	if (ConnectRedis() == false)
+	if (_withdrawn)
 	{
-		logte("Failed to connect redis server : %s:%d (err:%s)", _redis_ip.CStr(), _redis_port, _redis_context!=nullptr?_redis_context->errstr:"nil");
-		return false;
-	}
+		// It will be registered when the client is restored
+		std::lock_guard<std::mutex> origin_map_lock(_origin_map_mutex);
+		_origin_map[app_stream_name] = origin_host;
 
-	std::lock_guard<std::mutex> lock(_redis_context_mutex);
+		return true;
+	}
 
 	// Set origin host to redis
 	// The EXPIRE option is to prevent locking the app/stream when OvenMediaEngine unexpectedly stops.
 	// So _update_timer updates the expire time once every 2.5 seconds.
-	redisReply *reply = (redisReply *)redisCommand(_redis_context, "SET %s %s EX 10 NX", app_stream_name.CStr(), origin_host.CStr());
+	auto reply = Execute({"SET", app_stream_name, origin_host, "EX", "10", "NX"});
 	if (reply == nullptr || reply->type == REDIS_REPLY_ERROR)
 	{
-		logte("Failed to set origin host to redis : %s:%d (err:%s)", _redis_ip.CStr(), _redis_port, reply!=nullptr?reply->str:"nil");
+		logte("Failed to set origin host to redis : %s:%d (err:%s)", _redis_ip.CStr(), _redis_port, reply != nullptr ? reply->str : "nil");
 		return false;
 	}
 	else if (reply->type == REDIS_REPLY_NIL)
@@ -69,30 +147,29 @@ bool OriginMapClient::Register(const ov::String &app_stream_name, const ov::Stri
 		return false;
 	}
 
-	freeReplyObject(reply);
+	{
+		std::lock_guard<std::mutex> origin_map_lock(_origin_map_mutex);
+		_origin_map[app_stream_name] = origin_host;
+	}
 
-	std::lock_guard<std::mutex> origin_map_lock(_origin_map_mutex);
-	_origin_map[app_stream_name] = origin_host;
+	SetCache(app_stream_name, origin_host, ORIGIN_MAP_CACHE_TTL_MSEC);
 
 	return true;
 }
 
 bool OriginMapClient::Update(const ov::String &app_stream_name, const ov::String &origin_host)
 {
-	if (ConnectRedis() == false)
+	if (_withdrawn)
 	{
-		logte("Failed to connect redis server : %s:%d (err:%s)", _redis_ip.CStr(), _redis_port, _redis_context!=nullptr?_redis_context->errstr:"nil");
-		return false;
+		return true;
 	}
 
-	std::lock_guard<std::mutex> lock(_redis_context_mutex);
-
 	// Set origin host to redis
 	// XX option or EXPIRE cmd are not used because if redis server is restarted, update() can restore the origin stream info.
-	redisReply *reply = (redisReply *)redisCommand(_redis_context, "SET %s %s EX 10", app_stream_name.CStr(), origin_host.CStr());
+	auto reply = Execute({"SET", app_stream_name, origin_host, "EX", "10"});
 	if (reply == nullptr || reply->type == REDIS_REPLY_ERROR)
 	{
-		logte("Failed to set origin host to redis : %s:%d (err:%s)", _redis_ip.CStr(), _redis_port, reply!=nullptr?reply->str:"nil");
+		logte("Failed to set origin host to redis : %s:%d (err:%s)", _redis_ip.CStr(), _redis_port, reply != nullptr ? reply->str : "nil");
 		return false;
 	}
 	else if (reply->type == REDIS_REPLY_NIL)
@@ -101,113 +178,460 @@ bool OriginMapClient::Update(const ov::String &app_stream_name, const ov::String
 		return false;
 	}
 
-	freeReplyObject(reply);
-
 	return true;
 }
 
 bool OriginMapClient::Unregister(const ov::String &app_stream_name)
 {
-	if (ConnectRedis() == false)
 	{
-		logte("Failed to connect redis server : %s:%d (err:%s)", _redis_ip.CStr(), _redis_port, _redis_context!=nullptr?_redis_context->errstr:"nil");
-		return false;
+		std::lock_guard<std::mutex> origin_map_lock(_origin_map_mutex);
+		_origin_map.erase(app_stream_name);
+		_viewer_count_map.erase(app_stream_name);
 	}
 
-	std::lock_guard<std::mutex> lock(_redis_context_mutex);
+	InvalidateCache(app_stream_name);
+
+	auto replies = Execute(std::vector<RedisCommand>{
+		{"DEL", app_stream_name},
+		{"ZREM", ORIGIN_MAP_POPULAR_STREAMS_KEY, app_stream_name}});
+
+	for (auto &reply : replies)
+	{
+		if (reply == nullptr || reply->type == REDIS_REPLY_ERROR)
+		{
+			logte("Failed to delete origin host from redis : %s:%d (err:%s)", _redis_ip.CStr(), _redis_port, reply != nullptr ? reply->str : "nil");
+			return false;
+		}
+	}
+
+	return true;
+}
 
-	redisReply *reply = (redisReply *)redisCommand(_redis_context, "DEL %s", app_stream_name.CStr());
-	freeReplyObject(reply);
+bool OriginMapClient::ReportLoad(const ov::String &host_name, double score, const ov::String &report)
+{
+	auto replies = Execute(std::vector<RedisCommand>{
+		{"SET", ov::String::FormatString("%s%s", ORIGIN_MAP_LOAD_KEY_PREFIX, host_name.CStr()), report, "EX", ov::Converter::ToString(ORIGIN_MAP_LOAD_TTL_SEC)},
+		{"ZADD", ORIGIN_MAP_LOAD_SCORES_KEY, ov::String::FormatString("%.2f", score), host_name}});
 
-	std::lock_guard<std::mutex> origin_map_lock(_origin_map_mutex);
-	_origin_map.erase(app_stream_name);
+	for (auto &reply : replies)
+	{
+		if (reply == nullptr || reply->type == REDIS_REPLY_ERROR)
+		{
+			logte("Failed to report the load to redis : %s:%d (err:%s)", _redis_ip.CStr(), _redis_port, reply != nullptr ? reply->str : "nil");
+			return false;
+		}
+	}
 
 	return true;
 }
 
-CommonErrorCode OriginMapClient::GetOrigin(const ov::String &app_stream_name, ov::String &origin_host)
+void OriginMapClient::SetWithdrawn(bool withdrawn)
 {
-	if (ConnectRedis() == false)
+	if (_withdrawn.exchange(withdrawn) == withdrawn)
 	{
-		logte("Failed to connect redis server : %s:%d (err:%s)", _redis_ip.CStr(), _redis_port, _redis_context!=nullptr?_redis_context->errstr:"nil");
-		return CommonErrorCode::ERROR;
+		return;
 	}
 
-	std::lock_guard<std::mutex> lock(_redis_context_mutex);
+	if (withdrawn == false)
+	{
+		// The streams are registered again (and the popular streams are scored) at once
+		NofifyStreamsAlive();
+		return;
+	}
+
+	std::vector<ov::String> app_stream_names;
+	std::vector<RedisCommand> commands;
+
+	{
+		std::lock_guard<std::mutex> lock(_origin_map_mutex);
+		for (auto &[key, value] : _origin_map)
+		{
+			app_stream_names.push_back(key);
+			commands.push_back({"DEL", key});
+
+			app_stream_names.push_back(key);
+			commands.push_back({"ZREM", ORIGIN_MAP_POPULAR_STREAMS_KEY, key});
+		}
+	}
+
+	for (auto &app_stream_name : app_stream_names)
+	{
+		InvalidateCache(app_stream_name);
+	}
+
+	if (commands.empty())
+	{
+		return;
+	}
+
+	// If a refresh was in flight, the keys may be set again once, but they expire in 10 seconds without the refresh
+	auto replies = Execute(std::move(commands));
+
+	for (size_t index = 0; index < replies.size(); index++)
+	{
+		auto &reply = replies[index];
+
+		if (reply == nullptr || reply->type == REDIS_REPLY_ERROR)
+		{
+			logte("Failed to withdraw origin host of <%s> from redis : %s:%d (err:%s)", app_stream_names[index].CStr(), _redis_ip.CStr(), _redis_port, reply != nullptr ? reply->str : "nil");
+		}
+	}
+
+	logti("%zu streams are withdrawn from redis : %s:%d", app_stream_names.size() / 2, _redis_ip.CStr(), _redis_port);
+}
 
-	redisReply *reply = (redisReply *)redisCommand(_redis_context, "GET %s", app_stream_name.CStr());
+void OriginMapClient::UpdateViewerCount(const ov::String &app_stream_name, uint32_t viewer_count)
+{
+	std::lock_guard<std::mutex> lock(_origin_map_mutex);
+
+	if (_origin_map.find(app_stream_name) != _origin_map.end())
+	{
+		_viewer_count_map[app_stream_name] = viewer_count;
+	}
+}
+
+std::vector<std::pair<ov::String, uint32_t>> OriginMapClient::GetPopularStreams(size_t count)
+{
+	std::vector<std::pair<ov::String, uint32_t>> streams;
+
+	if (count == 0)
+	{
+		return streams;
+	}
+
+	// The streams without viewers are excluded
+	auto reply = Execute({"ZREVRANGEBYSCORE", ORIGIN_MAP_POPULAR_STREAMS_KEY, "+inf", "1", "WITHSCORES", "LIMIT", "0", ov::Converter::ToString(count)});
+	if (reply == nullptr || reply->type != REDIS_REPLY_ARRAY)
+	{
+		logte("Failed to get popular streams from redis : %s:%d (err:%s)", _redis_ip.CStr(), _redis_port, (reply != nullptr && reply->type == REDIS_REPLY_ERROR) ? reply->str : "nil");
+		return streams;
+	}
+
+	// [member, score, member, score, ...]
+	for (size_t index = 0; index + 1 < reply->elements; index += 2)
+	{
+		auto member = reply->element[index];
+		auto score = reply->element[index + 1];
+
+		if (member->type != REDIS_REPLY_STRING || score->type != REDIS_REPLY_STRING)
+		{
+			continue;
+		}
+
+		streams.emplace_back(ov::String(member->str, member->len), ov::Converter::ToUInt32(score->str));
+	}
+
+	return streams;
+}
+
+bool OriginMapClient::RemovePopularStream(const ov::String &app_stream_name)
+{
+	auto reply = Execute({"ZREM", ORIGIN_MAP_POPULAR_STREAMS_KEY, app_stream_name});
+
+	return (reply != nullptr) && (reply->type != REDIS_REPLY_ERROR);
+}
+
+CommonErrorCode OriginMapClient::GetOrigin(const ov::String &app_stream_name, ov::String &origin_host)
+{
+	CommonErrorCode result;
+	if (GetCache(app_stream_name, result, origin_host))
+	{
+		return result;
+	}
+
+	auto reply = Execute({"GET", app_stream_name});
 	if (reply == nullptr || reply->type == REDIS_REPLY_ERROR)
 	{
-		logte("Failed to get origin host from redis : %s:%d (err:%s)", _redis_ip.CStr(), _redis_port, reply!=nullptr?reply->str:"nil");
+		logte("Failed to get origin host from redis : %s:%d (err:%s)", _redis_ip.CStr(), _redis_port, reply != nullptr ? reply->str : "nil");
 		return CommonErrorCode::ERROR;
 	}
 	else if (reply->type == REDIS_REPLY_NIL)
 	{
+		SetCache(app_stream_name, "", ORIGIN_MAP_NEGATIVE_CACHE_TTL_MSEC);
 		return CommonErrorCode::NOT_FOUND;
 	}
 
 	origin_host = reply->str;
-	freeReplyObject(reply);
+	SetCache(app_stream_name, origin_host, ORIGIN_MAP_CACHE_TTL_MSEC);
 
 	return CommonErrorCode::SUCCESS;
 }
 
-bool OriginMapClient::ConnectRedis()
+OriginMapClient::RedisReply OriginMapClient::Execute(RedisCommand command)
 {
+	auto replies = Execute(std::vector<RedisCommand>{std::move(command)});
+
+	return replies.empty() ? nullptr : replies[0];
+}
+
+std::vector<OriginMapClient::RedisReply> OriginMapClient::Execute(std::vector<RedisCommand> commands)
+{
+	auto request = std::make_shared<Request>();
+	request->commands = std::move(commands);
+
+	{
+		std::lock_guard<std::mutex> lock(_pending_requests_mutex);
+		_pending_requests.push_back(request);
+	}
+
+	// While a caller is waiting for the replies, the requests of the other callers are queued,
+	// and the next caller sends all of them at once
 	std::lock_guard<std::mutex> lock(_redis_context_mutex);
+	if (request->completed == false)
+	{
+		FlushRequests();
+	}
+
+	return std::move(request->replies);
+}
+
+void OriginMapClient::FlushRequests()
+{
+	std::vector<std::shared_ptr<Request>> requests;
 
-	if (CheckConnection() == true)
 	{
-		return true;
+		std::lock_guard<std::mutex> lock(_pending_requests_mutex);
+		requests.swap(_pending_requests);
 	}
 
-	// connect to redis server
-	_redis_context = redisConnect(_redis_ip.CStr(), _redis_port);
-	if (_redis_context == nullptr || _redis_context->err)
+	if (requests.empty())
+	{
+		return;
+	}
+
+	bool is_connected = (_redis_context != nullptr);
+	if ((SendCommands(requests) == false) && is_connected)
+	{
+		// The connection may have been closed by the server while it is idle, so retry once with a new connection
+		SendCommands(requests);
+	}
+
+	for (auto &request : requests)
+	{
+		// The replies of the failed commands are nullptr
+		request->replies.resize(request->commands.size());
+		request->completed = true;
+	}
+}
+
+bool OriginMapClient::SendCommands(const std::vector<std::shared_ptr<Request>> &requests)
+{
+	if (_redis_context == nullptr)
 	{
+		_redis_context = Connect("command");
 		if (_redis_context == nullptr)
 		{
-			redisFree(_redis_context);
-			_redis_context = nullptr;
+			return false;
 		}
+	}
 
-		logte("Failed to connect to redis server. ip: %s, port: %d, err: %s", _redis_ip.CStr(), _redis_port, _redis_context->errstr);
-		return false;
+	size_t command_count = 0;
+
+	for (auto &request : requests)
+	{
+		request->replies.clear();
+
+		for (auto &command : request->commands)
+		{
+			std::vector<const char *> argv;
+			std::vector<size_t> argv_len;
+
+			for (auto &arg : command)
+			{
+				argv.push_back(arg.CStr());
+				argv_len.push_back(arg.GetLength());
+			}
+
+			// The commands are buffered, and written at once when the first reply is read
+			if (redisAppendCommandArgv(_redis_context, static_cast<int>(argv.size()), argv.data(), argv_len.data()) != REDIS_OK)
+			{
+				logte("Failed to send commands to redis server : %s:%d (err:%s)", _redis_ip.CStr(), _redis_port, _redis_context->errstr);
+				redisFree(_redis_context);
+				_redis_context = nullptr;
+				return false;
+			}
+
+			command_count++;
+		}
+	}
+
+	for (auto &request : requests)
+	{
+		for (size_t index = 0; index < request->commands.size(); index++)
+		{
+			void *reply = nullptr;
+
+			if (redisGetReply(_redis_context, &reply) != REDIS_OK)
+			{
+				logte("Failed to receive replies from redis server : %s:%d (err:%s)", _redis_ip.CStr(), _redis_port, _redis_context->errstr);
+				redisFree(_redis_context);
+				_redis_context = nullptr;
+				return false;
+			}
+
+			request->replies.emplace_back(static_cast<redisReply *>(reply), freeReplyObject);
+		}
+	}
+
+	logtd("%zu commands of %zu requests are sent to redis", command_count, requests.size());
+
+	return true;
+}
+
+redisContext *OriginMapClient::Connect(const char *name)
+{
+	// connect to redis server
+	auto context = redisConnect(_redis_ip.CStr(), _redis_port);
+	if (context == nullptr || context->err)
+	{
+		logte("Failed to connect to redis server (%s). ip: %s, port: %d, err: %s", name, _redis_ip.CStr(), _redis_port, context != nullptr ? context->errstr : "nil");
+
+		if (context != nullptr)
+		{
+			redisFree(context);
+		}
+
+		return nullptr;
 	}
 
 	// Auth
 	if (_redis_password.IsEmpty() == false)
 	{
-		redisReply *reply = (redisReply *)redisCommand(_redis_context, "AUTH %s", _redis_password.CStr());
+		redisReply *reply = (redisReply *)redisCommand(context, "AUTH %s", _redis_password.CStr());
 		if (reply == nullptr || reply->type == REDIS_REPLY_ERROR)
 		{
-			logte("Failed to auth to redis server. ip: %s, port: %d, err: %s", _redis_ip.CStr(), _redis_port, reply!=nullptr?reply->str:"nil");
+			logte("Failed to auth to redis server (%s). ip: %s, port: %d, err: %s", name, _redis_ip.CStr(), _redis_port, reply != nullptr ? reply->str : "nil");
 
 			if (reply != nullptr)
 			{
 				freeReplyObject(reply);
 			}
-			
-			return false;
+
+			redisFree(context);
+			return nullptr;
 		}
+
+		freeReplyObject(reply);
 	}
 
-	return true;
+	return context;
 }
 
-bool OriginMapClient::CheckConnection()
+bool OriginMapClient::GetCache(const ov::String &app_stream_name, CommonErrorCode &result, ov::String &origin_host)
 {
-	if (_redis_context == nullptr)
+	std::lock_guard<std::mutex> lock(_cache_mutex);
+
+	auto it = _cache.find(app_stream_name);
+	if (it == _cache.end() || it->second.expire_time_msec <= static_cast<int64_t>(ov::Clock::NowMSec()))
 	{
 		return false;
 	}
 
-	// Test with PING command
-	redisReply *reply = (redisReply *)redisCommand(_redis_context, "PING");
-	if (reply == nullptr)
+	if (it->second.origin_host.IsEmpty())
 	{
-		return false;
+		result = CommonErrorCode::NOT_FOUND;
+		return true;
 	}
 
+	origin_host = it->second.origin_host;
+	result = CommonErrorCode::SUCCESS;
+
 	return true;
 }
+
+void OriginMapClient::SetCache(const ov::String &app_stream_name, const ov::String &origin_host, int64_t ttl_msec)
+{
+	std::lock_guard<std::mutex> lock(_cache_mutex);
+
+	auto &item = _cache[app_stream_name];
+	item.origin_host = origin_host;
+	item.expire_time_msec = static_cast<int64_t>(ov::Clock::NowMSec()) + ttl_msec;
+}
+
+void OriginMapClient::InvalidateCache(const ov::String &app_stream_name)
+{
+	std::lock_guard<std::mutex> lock(_cache_mutex);
+	_cache.erase(app_stream_name);
+}
+
+void OriginMapClient::SubscribeThread()
+{
+	while (_stop_subscribe == false)
+	{
+		auto context = Connect("subscriber");
+
+		if (context != nullptr)
+		{
+			// The first reply of SUBSCRIBE is received here, and the others are ignored in the loop below
+			redisReply *reply = (redisReply *)redisCommand(context, "SUBSCRIBE __keyevent@0__:set __keyevent@0__:del __keyevent@0__:expired");
+			bool subscribed = (reply != nullptr) && (reply->type != REDIS_REPLY_ERROR);
+
+			if (subscribed == false)
+			{
+				logte("Failed to subscribe keyspace notifications : %s:%d (err:%s)", _redis_ip.CStr(), _redis_port, reply != nullptr ? reply->str : context->errstr);
+			}
+
+			if (reply != nullptr)
+			{
+				freeReplyObject(reply);
+			}
+
+			{
+				std::lock_guard<std::mutex> lock(_subscribe_context_mutex);
+				if (_stop_subscribe)
+				{
+					subscribed = false;
+				}
+				else
+				{
+					_subscribe_context = context;
+				}
+			}
+
+			if (subscribed)
+			{
+				// The notifications may have been missed while it was not subscribed
+				{
+					std::lock_guard<std::mutex> lock(_cache_mutex);
+					_cache.clear();
+				}
+
+				while (_stop_subscribe == false)
+				{
+					void *message = nullptr;
+					if (redisGetReply(context, &message) != REDIS_OK)
+					{
+						if (_stop_subscribe == false)
+						{
+							logtw("Subscriber connection is closed : %s:%d (err:%s)", _redis_ip.CStr(), _redis_port, context->errstr);
+						}
+						break;
+					}
+
+					// ["message", "__keyevent@0__:<event>", "<key>"]
+					auto notification = static_cast<redisReply *>(message);
+					if ((notification->type == REDIS_REPLY_ARRAY) && (notification->elements == 3) &&
+						(notification->element[0]->type == REDIS_REPLY_STRING) && (::strcmp(notification->element[0]->str, "message") == 0) &&
+						(notification->element[2]->type == REDIS_REPLY_STRING))
+					{
+						InvalidateCache(ov::String(notification->element[2]->str, notification->element[2]->len));
+					}
+
+					freeReplyObject(message);
+				}
+			}
+
+			{
+				std::lock_guard<std::mutex> lock(_subscribe_context_mutex);
+				_subscribe_context = nullptr;
+			}
+
+			redisFree(context);
+		}
+
+		std::unique_lock<std::mutex> lock(_subscribe_context_mutex);
+		_subscribe_stop_cv.wait_for(lock, std::chrono::milliseconds(ORIGIN_MAP_SUBSCRIBE_RETRY_INTERVAL_MSEC), [this]() -> bool {
+			return _stop_subscribe;
+		});
+	}
+}
@@ -13,13 +13,33 @@
 #include <base/ovlibrary/delay_queue.h>
 #include <hiredis/hiredis.h>
 
+// The result of GetOrigin() is cached for this time
+#define ORIGIN_MAP_CACHE_TTL_MSEC				3000
+// NOT_FOUND is also cached (for a shorter time) to avoid the lookups of a stream which is not published yet
+#define ORIGIN_MAP_NEGATIVE_CACHE_TTL_MSEC		1000
+// If the subscriber connection for the keyspace notifications is lost, it is retried after this time
+#define ORIGIN_MAP_SUBSCRIBE_RETRY_INTERVAL_MSEC	1000
+// Sorted set of the registered streams scored by the viewer count of the origin (used by the prefetch of edges)
+#define ORIGIN_MAP_POPULAR_STREAMS_KEY				"ome:popular_streams"
+// The load report of a server is stored in <prefix><host name>, and it expires if the server stops reporting
+#define ORIGIN_MAP_LOAD_KEY_PREFIX					"ome:load:"
+#define ORIGIN_MAP_LOAD_TTL_SEC						10
+// Sorted set of the servers scored by their load (a server whose load report is expired must be ignored)
+#define ORIGIN_MAP_LOAD_SCORES_KEY					"ome:load_scores"
+
 // If Origins-Edges cluster uses OriginMapStore, app/stream must be unique in the cluster.
+//
+// The commands requested at the same time (e.g. a lot of streams are created after a network failure) are
+// sent to redis at once with pipelining, so they don't wait for the round trips of each other.
+// GetOrigin() is cached, and the cache is invalidated by the keyspace notifications of redis
+// (notify-keyspace-events must include "E$gx" on the redis server, otherwise the cache is kept for the TTL).
 class OriginMapClient
 {
 public:
 	// redis_host: redis server host (ex: 192.168.0.160:6379)
 	// redis_password: redis server password (ex: password!@#)
 	OriginMapClient(const ov::String &redis_host, const ov::String &redis_password);
+	~OriginMapClient();
 
 	// if return false, it means that the app_stream_name is already registered from other origin server
 	// app_stream_name : app/stream name (ex: app/stream)
@@ -30,12 +50,63 @@ public:
 
 	CommonErrorCode GetOrigin(const ov::String &app_stream_name, ov::String &origin_host);
 
+	// Origin: The viewer count of the registered stream is reported with the update timer
+	void UpdateViewerCount(const ov::String &app_stream_name, uint32_t viewer_count);
+	// Edge: Returns up to <count> streams watched the most in the cluster (app/stream : viewer count)
+	std::vector<std::pair<ov::String, uint32_t>> GetPopularStreams(size_t count);
+	// Edge: Removes the stream that is not registered anymore (e.g. the origin has been terminated unexpectedly)
+	bool RemovePopularStream(const ov::String &app_stream_name);
+
+	// Reports the load of this server (see ocst::LoadReporter), it expires if it is not reported again
+	bool ReportLoad(const ov::String &host_name, double score, const ov::String &report);
+
+	// Origin: While withdrawn (e.g. the server is draining), the registered streams are removed from redis and are not refreshed,
+	// so the edges look for them in another origin. The streams registered in the meantime are only kept locally,
+	// and all of them are registered again when it is restored
+	void SetWithdrawn(bool withdrawn);
+	bool IsWithdrawn() const
+	{
+		return _withdrawn;
+	}
+
 private:
-	bool CheckConnection();
-	bool ConnectRedis();
+	using RedisReply = std::shared_ptr<redisReply>;
+	using RedisCommand = std::vector<ov::String>;
+
+	// The commands of a caller, they are sent with the commands of the other callers
+	struct Request
+	{
+		std::vector<RedisCommand> commands;
+		// nullptr if the command is failed (e.g. connection error)
+		std::vector<RedisReply> replies;
+		bool completed = false;
+	};
+
+	struct CacheItem
+	{
+		// Empty if the stream is not found
+		ov::String origin_host;
+		int64_t expire_time_msec = 0;
+	};
+
+	redisContext *Connect(const char *name);
+
+	// Returns the replies in the order of the commands
+	std::vector<RedisReply> Execute(std::vector<RedisCommand> commands);
+	RedisReply Execute(RedisCommand command);
+	// Sends all pending requests with pipelining (_redis_context_mutex must be locked)
+	void FlushRequests();
+	bool SendCommands(const std::vector<std::shared_ptr<Request>> &requests);
 
 	bool NofifyStreamsAlive();
 
+	bool GetCache(const ov::String &app_stream_name, CommonErrorCode &result, ov::String &origin_host);
+	void SetCache(const ov::String &app_stream_name, const ov::String &origin_host, int64_t ttl_msec);
+	void InvalidateCache(const ov::String &app_stream_name);
+
+	// Receives the keyspace notifications to invalidate the cache
+	void SubscribeThread();
+
 	ov::String _redis_ip;
 	uint16_t _redis_port;
 	ov::String _redis_password;
@@ -43,8 +114,23 @@ private:
 	ov::DelayQueue _update_timer{"OriginMapClient"};
 
 	std::map<ov::String, ov::String> _origin_map;
+	// app/stream : viewer count
+	std::map<ov::String, uint32_t> _viewer_count_map;
 	std::mutex _origin_map_mutex;
+	std::atomic<bool> _withdrawn{false};
 
 	redisContext *_redis_context = nullptr;
 	std::mutex _redis_context_mutex;
-};
\ No newline at end of file
+
+	std::mutex _pending_requests_mutex;
+	std::vector<std::shared_ptr<Request>> _pending_requests;
+
+	std::map<ov::String, CacheItem> _cache;
+	std::mutex _cache_mutex;
+
+	std::atomic<bool> _stop_subscribe{false};
+	std::thread _subscribe_thread;
+	redisContext *_subscribe_context = nullptr;
+	std::mutex _subscribe_context_mutex;
+	std::condition_variable _subscribe_stop_cv;
+};
@@ -61,26 +61,30 @@ bool OvtDepacketizer::ParsePacket()
 			_packet_buffer = _packet_buffer->Subdata(packet_mold->PacketLength());
 		}
 
-		if(packet_mold->PayloadType() == OVT_PAYLOAD_TYPE_MESSAGE_REQUEST || 
-			packet_mold->PayloadType() == OVT_PAYLOAD_TYPE_MESSAGE_RESPONSE)
+		if(AppendPacket(packet_mold) == false)
 		{
-			if(AppendMessagePacket(packet_mold) == false)
-			{
-				return false;
-			}
-		}
-		else if(packet_mold->PayloadType() == OVT_PAYLOAD_TYPE_MEDIA_PACKET)
-		{
-			if(AppendMediaPacket(packet_mold) == false)
-			{
-				return false;
-			}
+			return false;
 		}
 	}
 
 	return true;
 }
 
+bool OvtDepacketizer::AppendPacket(const std::shared_ptr<OvtPacket> &packet)
+{
+	if(packet->PayloadType() == OVT_PAYLOAD_TYPE_MESSAGE_REQUEST || 
+		packet->PayloadType() == OVT_PAYLOAD_TYPE_MESSAGE_RESPONSE)
+	{
+		return AppendMessagePacket(packet);
+	}
+	else if(packet->PayloadType() == OVT_PAYLOAD_TYPE_MEDIA_PACKET)
+	{
+		return AppendMediaPacket(packet);
+	}
+
+	return true;
+}
+
 bool OvtDepacketizer::IsAvailableMessage()
 {
 	return !_messages.empty();
@@ -18,6 +18,8 @@ public:
 
 	bool AppendPacket(const void *data, size_t length);
 	bool AppendPacket(const std::shared_ptr<const ov::Data> &packet);
+	// Appends a packet already parsed (e.g. routed by the session id from a multiplexed connection)
+	bool AppendPacket(const std::shared_ptr<OvtPacket> &packet);
 
 	bool IsAvailableMessage();
 	bool IsAvailableMediaPacket();
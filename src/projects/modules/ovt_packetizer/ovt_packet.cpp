@@ -11,8 +11,8 @@ OvtPacket::OvtPacket()
 	_session_id = 0;
 	_payload_length = 0;
 
+	// The buffer grows when the payload is copied, so the packets referring to the payload do not allocate it
 	_data = std::make_shared<ov::Data>();
-	_data->Reserve(OVT_DEFAULT_MAX_PACKET_SIZE);
 	_data->SetLength(OVT_FIXED_HEADER_SIZE);
 	_buffer = _data->GetWritableDataAs<uint8_t>();
 
@@ -34,10 +34,13 @@ OvtPacket::OvtPacket(OvtPacket &src)
 	_session_id = src._session_id;
 	_payload_length = src._payload_length;
 	_is_packet_available = src._is_packet_available;
+	_keyframe = src._keyframe;
 	
 	_data = src._data->Clone();
 	_data->SetLength(src._data->GetLength());
 	_buffer = _data->GetWritableDataAs<uint8_t>();
+
+	_payload_list = src._payload_list;
 }
 
 OvtPacket::~OvtPacket()
@@ -63,6 +66,7 @@ bool OvtPacket::LoadHeader(const ov::Data &data)
 	}
 
 	_data.reset();
+	_payload_list.clear();
 
 	_data = std::make_shared<ov::Data>();
 	_data->Reserve(OVT_DEFAULT_MAX_PACKET_SIZE);
@@ -165,6 +169,11 @@ uint16_t OvtPacket::PayloadLength() const
 	return _payload_length;
 }
 
+bool OvtPacket::IsKeyframe() const
+{
+	return _keyframe;
+}
+
 const uint8_t* OvtPacket::Payload() const
 {
 	return &_buffer[OVT_FIXED_HEADER_SIZE];
@@ -175,9 +184,32 @@ const uint8_t* OvtPacket::GetBuffer() const
 	return &_buffer[0];
 }
 
-const std::shared_ptr<ov::Data>& OvtPacket::GetData() const
+std::shared_ptr<ov::Data> OvtPacket::GetData() const
 {
-	return _data;
+	if (_payload_list.empty())
+	{
+		return _data;
+	}
+
+	auto data = std::make_shared<ov::Data>(PacketLength());
+	data->Append(_data.get());
+	for (const auto &payload : _payload_list)
+	{
+		data->Append(payload.get());
+	}
+
+	return data;
+}
+
+std::vector<std::shared_ptr<const ov::Data>> OvtPacket::GetDataList() const
+{
+	std::vector<std::shared_ptr<const ov::Data>> data_list;
+
+	data_list.reserve(1 + _payload_list.size());
+	data_list.push_back(_data);
+	data_list.insert(data_list.end(), _payload_list.begin(), _payload_list.end());
+
+	return data_list;
 }
 
 void OvtPacket::SetMarker(bool marker_bit)
@@ -194,6 +226,11 @@ void OvtPacket::SetMarker(bool marker_bit)
 	}
 }
 
+void OvtPacket::SetKeyframe(bool keyframe)
+{
+	_keyframe = keyframe;
+}
+
 void OvtPacket::SetPayloadType(uint8_t payload_type)
 {
 	_payload_type = payload_type;
@@ -229,19 +266,27 @@ void OvtPacket::SetPayloadLength(size_t payload_length)
 {
 	_payload_length = payload_length;
 	ByteWriter<uint16_t>::WriteBigEndian(&_buffer[16], _payload_length);
+}
 
-	_data->SetLength(OVT_FIXED_HEADER_SIZE + payload_length);
+void OvtPacket::UpdateBuffer()
+{
+	// The buffer may be reallocated by SetLength()
+	_buffer = _data->GetWritableDataAs<uint8_t>();
 }
 
 bool OvtPacket::SetPayload(const uint8_t *payload, size_t payload_length)
 {
-	if(OVT_FIXED_HEADER_SIZE + payload_length > _data->GetCapacity())
+	if(OVT_FIXED_HEADER_SIZE + payload_length > OVT_DEFAULT_MAX_PACKET_SIZE)
 	{
-		OV_ASSERT(false, "Data capacity must be greater than %ld (packet : %ld)",
-				_data->GetCapacity(), OVT_FIXED_HEADER_SIZE + payload_length);
+		OV_ASSERT(false, "Packet size must be less than %d (packet : %zu)",
+				OVT_DEFAULT_MAX_PACKET_SIZE, OVT_FIXED_HEADER_SIZE + payload_length);
 		return false;
 	}
 
+	_payload_list.clear();
+	_data->SetLength(OVT_FIXED_HEADER_SIZE + payload_length);
+	UpdateBuffer();
+
 	SetPayloadLength(payload_length);
 
 	// OVT_DEFAULT_MAX_PACKET_SIZE
@@ -252,3 +297,29 @@ bool OvtPacket::SetPayload(const uint8_t *payload, size_t payload_length)
 
 	return true;
 }
+
+bool OvtPacket::SetPayloadList(std::vector<std::shared_ptr<const ov::Data>> payload_list)
+{
+	size_t payload_length = 0;
+	for (const auto &payload : payload_list)
+	{
+		payload_length += payload->GetLength();
+	}
+
+	if(OVT_FIXED_HEADER_SIZE + payload_length > OVT_DEFAULT_MAX_PACKET_SIZE)
+	{
+		OV_ASSERT(false, "Packet size must be less than %d (packet : %zu)",
+				OVT_DEFAULT_MAX_PACKET_SIZE, OVT_FIXED_HEADER_SIZE + payload_length);
+		return false;
+	}
+
+	_data->SetLength(OVT_FIXED_HEADER_SIZE);
+	UpdateBuffer();
+
+	SetPayloadLength(payload_length);
+	_payload_list = std::move(payload_list);
+
+	_is_packet_available = true;
+
+	return true;
+}
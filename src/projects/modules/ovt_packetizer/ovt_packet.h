@@ -26,8 +26,9 @@
 // |           Payload Length      |
 // +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
 
-// [SessionID] - Reserved
-// Designed for the purpose of classifying each session when two or more sessions are connected with the same 5tuple in the future. Currently not used because the client connects to the server using a different port.
+// [SessionID]
+// Classifies the sessions (streams) multiplexed over one connection. It is 0 for the messages that do not belong to a session.
+// A client that does not multiplex (or a server that does not support HELLO) uses a connection per session, and it can be ignored.
 
 /***********************************************
  * Protocol Specification
@@ -37,6 +38,30 @@
  Therefore, the connection must be maintained.
  If the Session is disconnected, OVT determines in the same manner as the STOP command.
 
+ [0] HELLO (Optional)
+ The client asks whether the server can carry several sessions over this connection.
+ If the server responds with an error (e.g. 404 Unknown application), the connection must be used for only one session.
+ <C->S>
+ 	PT : MESSAGE REQUEST(10)
+ 	SI : 0
+ 	Payload :
+ 		{
+ 			"id": 3921930,
+			"application" : "hello",
+ 			"target": "ovt://host:port/app/stream"
+ 		}
+ <S->C>
+ 	PT : MESSAGE RESPONSE(20)
+ 	SI : 0
+ 	Payload :
+ 		{
+ 			"id": 3921930,
+			"application" : "hello",
+			"code" : 200,
+			"message" : "ok",
+			"contents" : { "multiplex" : true }
+ 		}
+
  [1] DESCRIBE
  <C->S>
  	M  : 0 or 1(Last packet)
@@ -108,7 +133,8 @@
  		{
  			"id": 3921932,
 			"application" : "play", "stop",
- 			"target": "ovt://host:port/app/stream"
+ 			"target": "ovt://host:port/app/stream",
+ 			"sessionId": 11992 // stop only, the session of the target to stop on a multiplexed connection
  		}
 
  		<! Later version can be extended to specify tracks or add other options. >
@@ -125,6 +151,7 @@
 			"application" : "play" | "stop",
 			"code" : 200 | 404 | 500,
 			"message" : "ok" | "app/stream not found" | "Internal Server Error",
+			"contents" : { "sessionId" : 11992 } // play only
 		}
 
 		while(STOP or DISCONNECTED)
@@ -138,6 +165,18 @@
 			[Binary - Serialized MediaPacket]
 		}
 
+ [2] STOP (S->C, multiplexed connection only)
+ When the stream of the session is stopped on the server, the server notifies the client instead of closing the connection.
+ 	PT : MESSAGE RESPONSE(20)
+ 	SI : 11992
+ 	Payload :
+		{
+			"id": 0,
+			"application" : "stop",
+			"code" : 200,
+			"message" : "Stream has been stopped"
+		}
+
  **********************************************/
 
 
@@ -175,6 +214,9 @@ public:
 	uint32_t 	SessionId() const;
 	uint32_t	PacketLength() const;
 	uint16_t 	PayloadLength() const;
+	// Whether this packet is the first packet of a video keyframe (not serialized, only set by OvtPacketizer)
+	bool		IsKeyframe() const;
+	// Only available if the payload is not set with SetPayloadList()
 	const uint8_t*	Payload() const;
 
 	void 		SetMarker(bool marker_bit);
@@ -183,14 +225,21 @@ public:
 	void 		SetTimestampNow();
 	void 		SetTimestamp(uint64_t timestamp);
 	void 		SetSessionId(uint32_t session_id);
+	void		SetKeyframe(bool keyframe);
 
 	bool 		SetPayload(const uint8_t *payload, size_t payload_size);
+	// The payload refers to the buffers without copying (e.g. Subdata of MediaPacket)
+	bool 		SetPayloadList(std::vector<std::shared_ptr<const ov::Data>> payload_list);
 
 	const uint8_t* GetBuffer() const;
-	const std::shared_ptr<ov::Data>& GetData() const;
+	// If the payload is set with SetPayloadList(), the packet is copied into a new buffer
+	std::shared_ptr<ov::Data> GetData() const;
+	// Header + Payload buffers to send without copying (e.g. Socket::Send(data_list))
+	std::vector<std::shared_ptr<const ov::Data>> GetDataList() const;
 
 private:
 	void 		SetPayloadLength(size_t payload_length);
+	void		UpdateBuffer();
 
 	bool 		_is_packet_available = false;
 
@@ -201,7 +250,11 @@ private:
 	uint64_t 	_timestamp;
 	uint32_t 	_session_id;
 	uint16_t 	_payload_length;
+	bool		_keyframe = false;
 
 	uint8_t *					_buffer;
+	// Header (+ Payload if it is copied)
 	std::shared_ptr<ov::Data>	_data;
+	// Payload set with SetPayloadList()
+	std::vector<std::shared_ptr<const ov::Data>>	_payload_list;
 };
@@ -99,12 +99,13 @@ bool OvtPacketizer::PacketizeMediaPacket(uint64_t timestamp, const std::shared_p
 
 	 *********************************************************************/
 
-	ov::Data payload;
+	// Only the header is serialized, and the packets refer to the data of the MediaPacket without copying,
+	// so the payload is shared by all sessions of the stream and the socket buffers
+	auto header = std::make_shared<ov::Data>(MEDIA_PACKET_HEADER_SIZE);
+	header->SetLength(MEDIA_PACKET_HEADER_SIZE);
 
-	// Header + Data
-	payload.SetLength(MEDIA_PACKET_HEADER_SIZE + media_packet->GetData()->GetLength());
-
-	auto buffer = payload.GetWritableDataAs<uint8_t>();
+	auto buffer = header->GetWritableDataAs<uint8_t>();
+	std::shared_ptr<const ov::Data> data = media_packet->GetData();
 
 	ByteWriter<uint32_t>::WriteBigEndian(&buffer[0], media_packet->GetTrackId());
 	ByteWriter<uint64_t>::WriteBigEndian(&buffer[4], media_packet->GetPts());
@@ -114,13 +115,13 @@ bool OvtPacketizer::PacketizeMediaPacket(uint64_t timestamp, const std::shared_p
 	ByteWriter<uint8_t>::WriteBigEndian(&buffer[29], static_cast<int8_t>(media_packet->GetFlag()));
 	ByteWriter<uint8_t>::WriteBigEndian(&buffer[30], static_cast<int8_t>(media_packet->GetBitstreamFormat()));
 	ByteWriter<uint8_t>::WriteBigEndian(&buffer[31], static_cast<int8_t>(media_packet->GetPacketType()));
-	ByteWriter<uint32_t>::WriteBigEndian(&buffer[32], media_packet->GetData()->GetLength());
-
-	memcpy(&buffer[36], media_packet->GetData()->GetData(), media_packet->GetData()->GetLength());
+	ByteWriter<uint32_t>::WriteBigEndian(&buffer[32], data->GetLength());
 
 	size_t max_payload_size = OVT_DEFAULT_MAX_PACKET_SIZE - OVT_FIXED_HEADER_SIZE;
-	size_t remain_payload_len = payload.GetLength();
-	size_t offset = 0;
+	size_t remain_payload_len = MEDIA_PACKET_HEADER_SIZE + data->GetLength();
+	// Offset of the data of the MediaPacket
+	size_t data_offset = 0;
+	bool header_written = false;
 
 	while(remain_payload_len != 0)
 	{
@@ -132,20 +133,35 @@ bool OvtPacketizer::PacketizeMediaPacket(uint64_t timestamp, const std::shared_p
 		packet->SetMarker(false);
 		packet->SetTimestamp(timestamp);
 
-		if(remain_payload_len > max_payload_size)
+		std::vector<std::shared_ptr<const ov::Data>> payload_list;
+		size_t payload_size = std::min(remain_payload_len, max_payload_size);
+		size_t data_size = payload_size;
+
+		// The header is always in the first packet (it is smaller than the max payload size)
+		if(header_written == false)
 		{
-			packet->SetPayload(&buffer[offset], max_payload_size);
-			offset += max_payload_size;
-			remain_payload_len -= max_payload_size;
+			payload_list.push_back(header);
+			data_size -= MEDIA_PACKET_HEADER_SIZE;
+			header_written = true;
+
+			// The sessions which dropped packets resume from here
+			packet->SetKeyframe((media_packet->GetMediaType() == cmn::MediaType::Video) && (media_packet->GetFlag() == MediaPacketFlag::Key));
 		}
-		else
+
+		if(data_size > 0)
+		{
+			payload_list.push_back(data->Subdata(data_offset, data_size));
+			data_offset += data_size;
+		}
+
+		remain_payload_len -= payload_size;
+		if(remain_payload_len == 0)
 		{
 			// The last packet of group has marker bit.
 			packet->SetMarker(true);
-			packet->SetPayload(&buffer[offset], remain_payload_len);
-			remain_payload_len = 0;
 		}
 
+		packet->SetPayloadList(std::move(payload_list));
 		packet->SetSequenceNumber(_sequence_number++);
 
 		if(_stream != nullptr)
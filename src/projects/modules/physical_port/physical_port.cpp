@@ -127,12 +127,27 @@ bool PhysicalPort::CreateServerSocket(
 	{
 		if (_socket_pool->Initialize(worker_count))
 		{
-			auto socket = _socket_pool->AllocSocket<ov::ServerSocket>(address.GetFamily(), _socket_pool);
+			// When SO_REUSEPORT is enabled, each worker has its own listening socket
+			bool reuse_port = _reuse_port && (type == ov::SocketType::Tcp) && (worker_count > 1);
+			int listener_count = reuse_port ? worker_count : 1;
+			bool succeeded = true;
 
-			if (socket != nullptr)
+			for (int index = 0; index < listener_count; index++)
 			{
+				auto socket = reuse_port
+								  ? _socket_pool->AllocSocketOnWorker<ov::ServerSocket>(index, address.GetFamily(), _socket_pool)
+								  : _socket_pool->AllocSocket<ov::ServerSocket>(address.GetFamily(), _socket_pool);
+
+				if (socket == nullptr)
+				{
+					succeeded = false;
+					break;
+				}
+
 				const std::shared_ptr<ov::Error> error = (on_socket_created != nullptr) ? on_socket_created(socket) : nullptr;
 
+				socket->SetReusePort(reuse_port);
+
 				if (error != nullptr)
 				{
 					logte("An error occurred while initializing socket: %s", error->What());
@@ -145,15 +160,49 @@ bool PhysicalPort::CreateServerSocket(
 									   std::placeholders::_1, std::placeholders::_2),
 							 send_buffer_size, recv_buffer_size, 4096))
 				{
-					_type = type;
-					_server_socket = socket;
-					_address = address;
+					_server_socket_list.push_back(socket);
+					continue;
+				}
 
-					return true;
+				_socket_pool->ReleaseSocket(socket);
+				succeeded = false;
+				break;
+			}
+
+			if (succeeded && reuse_port && _reuse_port_cpu_steering)
+			{
+				if (_server_socket_list.front()->AttachReusePortCpuSteering(listener_count) == false)
+				{
+					logtw("Could not attach CPU steering program to %s, connections will be distributed by the kernel", address.ToString().CStr());
 				}
+				// A connection is steered to the listener of the CPU that received it, so the worker of the listener
+				// must run on that CPU to process the connection on it
+				else if (_socket_pool->PinWorkersToSteeredCpus() == false)
+				{
+					logtw("Could not pin the workers of %s to the steered CPUs, connections may be processed on other CPUs", address.ToString().CStr());
+				}
+			}
+
+			if (succeeded)
+			{
+				_type = type;
+				_server_socket = _server_socket_list.front();
+				_address = address;
+
+				if (reuse_port)
+				{
+					logti("%d SO_REUSEPORT listeners are created for %s/%s", listener_count, address.ToString().CStr(), ov::StringFromSocketType(type));
+				}
+
+				return true;
+			}
 
+			// Rollback
+			for (auto &socket : _server_socket_list)
+			{
 				_socket_pool->ReleaseSocket(socket);
 			}
+			_server_socket_list.clear();
 
 			OV_SAFE_RESET(_socket_pool, nullptr, _socket_pool->Uninitialize(), _socket_pool);
 		}
@@ -191,8 +240,8 @@ bool PhysicalPort::CreateDatagramSocket(
 				}
 				else if (socket->Prepare(
 							 address,
-							 std::bind(&PhysicalPort::OnDatagram, this,
-									   std::placeholders::_1, std::placeholders::_2, std::placeholders::_3)))
+							 ov::DatagramBatchCallback(std::bind(&PhysicalPort::OnDatagrams, this,
+																 std::placeholders::_1, std::placeholders::_2))))
 				{
 					_type = type;
 					_datagram_socket = socket;
@@ -283,12 +332,12 @@ void PhysicalPort::OnClientData(const std::shared_ptr<ov::ClientSocket> &client,
 	}
 }
 
-void PhysicalPort::OnDatagram(const std::shared_ptr<ov::DatagramSocket> &client, const ov::SocketAddress &remote_address, const std::shared_ptr<ov::Data> &data)
+void PhysicalPort::OnDatagrams(const std::shared_ptr<ov::DatagramSocket> &client, const std::vector<ov::Datagram> &datagrams)
 {
 	// Notify observers
 	for (auto &observer : _observer_list)
 	{
-		observer->OnDataReceived(client, remote_address, data);
+		observer->OnDatagramsReceived(client, datagrams);
 	}
 }
 
@@ -298,6 +347,13 @@ bool PhysicalPort::Close()
 
 	if (socket != nullptr)
 	{
+		// The first listener is released below with GetSocket()
+		for (size_t index = 1; index < _server_socket_list.size(); index++)
+		{
+			_socket_pool->ReleaseSocket(_server_socket_list[index]);
+		}
+		_server_socket_list.clear();
+
 		_socket_pool->ReleaseSocket(socket);
 
 		_server_socket = nullptr;
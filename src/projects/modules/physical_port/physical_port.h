@@ -81,6 +81,14 @@ public:
 		return _socket_pool->GetWorkerCount();
 	}
 
+	// Must be called before Create()
+	// Only available for TCP ports with two or more workers
+	void SetReusePort(bool reuse_port, bool cpu_steering)
+	{
+		_reuse_port = reuse_port;
+		_reuse_port_cpu_steering = cpu_steering;
+	}
+
 	bool AddObserver(PhysicalPortObserver *observer);
 
 	bool RemoveObserver(PhysicalPortObserver *observer);
@@ -107,7 +115,7 @@ protected:
 	void OnClientData(const std::shared_ptr<ov::ClientSocket> &client, const std::shared_ptr<const ov::Data> &data);
 
 	// For UDP physical port
-	void OnDatagram(const std::shared_ptr<ov::DatagramSocket> &client, const ov::SocketAddress &remote_address, const std::shared_ptr<ov::Data> &data);
+	void OnDatagrams(const std::shared_ptr<ov::DatagramSocket> &client, const std::vector<ov::Datagram> &datagrams);
 
 	ov::String _name;
 	std::shared_ptr<ov::SocketPool> _socket_pool;
@@ -116,6 +124,10 @@ protected:
 	ov::SocketAddress _address;
 
 	std::shared_ptr<ov::ServerSocket> _server_socket;
+	// All listeners of this port when SO_REUSEPORT is used (_server_socket is the first item)
+	std::vector<std::shared_ptr<ov::ServerSocket>> _server_socket_list;
+	bool _reuse_port = false;
+	bool _reuse_port_cpu_steering = false;
 	std::shared_ptr<ov::DatagramSocket> _datagram_socket;
 
 	std::atomic<int> _ref_count{0};
@@ -40,6 +40,7 @@ std::shared_ptr<PhysicalPort> PhysicalPortManager::CreatePort(const char *name,
 	if (item == _port_list.end())
 	{
 		port = std::make_shared<PhysicalPort>(PhysicalPort::PrivateToken{nullptr});
+		port->SetReusePort(_reuse_port, _reuse_port_cpu_steering);
 
 		if (port->Create(name, type, address, worker_count, send_buffer_size, recv_buffer_size, on_socket_created))
 		{
@@ -34,6 +34,13 @@ public:
 
 	bool DeletePort(std::shared_ptr<PhysicalPort> &port);
 
+	// Applied to TCP ports created after this call
+	void SetReusePort(bool reuse_port, bool cpu_steering)
+	{
+		_reuse_port = reuse_port;
+		_reuse_port_cpu_steering = cpu_steering;
+	}
+
 protected:
 	PhysicalPortManager();
 
@@ -43,4 +50,7 @@ protected:
 	std::map<std::pair<ov::SocketType, ov::SocketAddress>, std::shared_ptr<ov::SocketPool>> _socket_pool_list;
 
 	std::mutex _port_list_mutex;
+
+	bool _reuse_port = false;
+	bool _reuse_port_cpu_steering = false;
 };
@@ -12,6 +12,7 @@
 #include <base/ovsocket/ovsocket.h>
 
 #include <memory>
+#include <vector>
 
 class PhysicalPort;
 
@@ -48,6 +49,16 @@ public:
 	// Called when the packet is received
 	virtual void OnDataReceived(const std::shared_ptr<ov::Socket> &remote, const ov::SocketAddress &address, const std::shared_ptr<const ov::Data> &data) = 0;
 
+	// Called when multiple datagrams are received at once (UDP only)
+	// Observers that can process a batch more efficiently should override this
+	virtual void OnDatagramsReceived(const std::shared_ptr<ov::Socket> &remote, const std::vector<ov::Datagram> &datagrams)
+	{
+		for (auto &datagram : datagrams)
+		{
+			OnDataReceived(remote, datagram.remote_address, datagram.data);
+		}
+	}
+
 	// Called when the client is disconnected
 	virtual void OnDisconnected(const std::shared_ptr<ov::Socket> &remote, PhysicalPortDisconnectReason reason, const std::shared_ptr<const ov::Error> &error)
 	{
@@ -406,6 +406,10 @@ bool RtcSignallingServer::SetupWebSocketHandler(std::shared_ptr<http::svr::ws::I
 				{
 					logte("Cannot find stream [%s/%s]", info->vhost_app_name.CStr(), info->stream_name.CStr());
 				}
+				else if (error->GetCode() == static_cast<int>(http::StatusCode::ServiceUnavailable))
+				{
+					logti("The server is draining, rejecting %s for stream [%s/%s]", ws_session->ToString().CStr(), info->vhost_app_name.CStr(), info->stream_name.CStr());
+				}
 				else
 				{
 					logte("An error occurred while dispatch command %s for stream [%s/%s]: %s, disconnecting...", command.CStr(), info->vhost_app_name.CStr(), info->stream_name.CStr(), error->What());
@@ -417,6 +421,13 @@ bool RtcSignallingServer::SetupWebSocketHandler(std::shared_ptr<http::svr::ws::I
 				value["code"] = error->GetCode();
 				value["error"] = error->GetMessage().CStr();
 
+				// The player can connect to another server instead of retrying this server while it is draining
+				auto [redirect_exist, redirect] = ws_session->GetUserData("drain_redirect");
+				if ((redirect_exist == true) && std::holds_alternative<ov::String>(redirect) && (std::get<ov::String>(redirect).IsEmpty() == false))
+				{
+					value["redirect"] = std::get<ov::String>(redirect).CStr();
+				}
+
 				ws_session->GetWebSocketResponse()->Send(response_json.ToString());
 
 				return false;
@@ -794,6 +805,10 @@ std::shared_ptr<const ov::Error> RtcSignallingServer::DispatchRequestOffer(const
 
 				ws_session->GetWebSocketResponse()->Send(response_json.ToString());
 			}
+			else if (std::get<0>(ws_session->GetUserData("drain_redirect")) == true)
+			{
+				error = std::make_shared<http::HttpError>(http::StatusCode::ServiceUnavailable, "The server is draining");
+			}
 			else
 			{
 				logtw("Could not create SDP for stream %s", info->stream_name.CStr());
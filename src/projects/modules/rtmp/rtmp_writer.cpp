@@ -35,12 +35,7 @@
 
 	while(1)
 	{
-		_writer->PutData(
-			media_packet->GetTrackId(), 
-			media_packet->GetPts(),
-			media_packet->GetDts(), 
-			media_packet->GetFlag(), 
-			media_packet->GetData());
+		_writer->PutData(media_packet);
 	}
 
 	_writer->Stop();
@@ -283,8 +278,15 @@ bool RtmpWriter::AddTrack(cmn::MediaType media_type, int32_t track_id, std::shar
 //	- H264 : AnnexB bitstream
 // 	- AAC : ASC(Audio Specific Config) bitstream
 
-bool RtmpWriter::PutData(int32_t track_id, int64_t pts, int64_t dts, MediaPacketFlag flag, cmn::BitstreamFormat format, std::shared_ptr<ov::Data> &data)
+bool RtmpWriter::PutData(const std::shared_ptr<const MediaPacket> &packet)
 {
+	auto track_id = packet->GetTrackId();
+	auto pts = packet->GetPts();
+	auto dts = packet->GetDts();
+	auto flag = packet->GetFlag();
+	auto format = packet->GetBitstreamFormat();
+	auto data = packet->GetData();
+
 	std::unique_lock<std::mutex> mlock(_lock);
 
 	if (_format_context == nullptr)
@@ -319,8 +321,8 @@ bool RtmpWriter::PutData(int32_t track_id, int64_t pts, int64_t dts, MediaPacket
 	av_packet.pts = av_rescale_q(pts, AVRational{track_info->GetTimeBase().GetNum(), track_info->GetTimeBase().GetDen()}, stream->time_base);
 	av_packet.dts = av_rescale_q(dts, AVRational{track_info->GetTimeBase().GetNum(), track_info->GetTimeBase().GetDen()}, stream->time_base);
 
+	// The converted bitstream is cached in the packet, which is shared by all push sessions of the stream
 	std::shared_ptr<const ov::Data> cdata = data;
-	std::vector<size_t> length_list;
 
 	if (strcmp(_format_context->oformat->name, "flv") == 0)
 	{
@@ -332,7 +334,7 @@ bool RtmpWriter::PutData(int32_t track_id, int64_t pts, int64_t dts, MediaPacket
 				break;
 
 			case cmn::BitstreamFormat::H264_ANNEXB:
-				cdata = H264Converter::ConvertAnnexbToAvcc(cdata);
+				cdata = H264Converter::ConvertAnnexbToAvcc(packet);
 				av_packet.size = cdata->GetLength();
 				av_packet.data = (uint8_t *)cdata->GetDataAs<uint8_t>();
 				break;
@@ -343,7 +345,7 @@ bool RtmpWriter::PutData(int32_t track_id, int64_t pts, int64_t dts, MediaPacket
 				break;
 
 			case cmn::BitstreamFormat::AAC_ADTS:
-				cdata = AacConverter::ConvertAdtsToRaw(cdata, &length_list);
+				cdata = AacConverter::ConvertAdtsToRaw(packet);
 				av_packet.size = cdata->GetLength();
 				av_packet.data = (uint8_t *)cdata->GetDataAs<uint8_t>();
 				break;
@@ -363,7 +365,7 @@ bool RtmpWriter::PutData(int32_t track_id, int64_t pts, int64_t dts, MediaPacket
 				break;
 
 			case cmn::BitstreamFormat::AAC_ADTS:
-				cdata = AacConverter::ConvertAdtsToRaw(cdata, &length_list);
+				cdata = AacConverter::ConvertAdtsToRaw(packet);
 				av_packet.size = cdata->GetLength();
 				av_packet.data = (uint8_t *)cdata->GetDataAs<uint8_t>();
 				break;
@@ -20,27 +20,35 @@ std::shared_ptr<LipSyncClock::Clock> LipSyncClock::GetClock(uint32_t id)
 	return _clock_map[id];
 }
 
+void LipSyncClock::SetPredictive(bool predictive)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	_predictive = predictive;
+}
+
 std::optional<uint64_t> LipSyncClock::CalcPTS(uint32_t id, uint32_t rtp_timestamp)
 {
+	std::lock_guard<std::mutex> lock(_mutex);
+
 	auto clock = GetClock(id);
 	if(clock == nullptr)
 	{
 		return {};
 	}
 
+	if (clock->_updated == false && _predictive == true)
+	{
+		// The packet arrived now (the network delay is not known, but it is similar for the tracks)
+		clock->_updated = true;
+		clock->_rtcp_timestamp = rtp_timestamp;
+		clock->_pts = static_cast<int64_t>((static_cast<double>(ov::Clock::NowUSec()) + _ntp_offset_us) / 1000000.0 / clock->_timebase);
+	}
+
 	if(clock->_updated == false)
 	{
+		// Wait for the RTCP SR. Mapping the RTP timestamp to the wall clock and replacing it with the SR later
+		// sometimes makes a smaller PTS, so the predictive mode slews the difference instead (See SetPredictive())
 		return {};
-		// @Deprecated
-		// TODO(Getroot) : This method sometimes causes a smaller PTS to come out after the RTCP SR arrives. 
-		// Since this is not allowed in OME, we have to think more about how to handle it.
-		// Since most servers send RTP and RTCP SR, 
-		// it is the simplest and most powerful to wait for the RTCP SR and then calculate the PTS.
-
-		// Update using wall clock until rtcp sr is arrived
-		// uint32_t msw, lsw;
-		// ov::Clock::GetNtpTime(msw, lsw);
-		// UpdateSenderReportTime(id, msw, lsw, rtp_timestamp);
 	}
 
 	uint32_t delta = 0;
@@ -75,9 +83,14 @@ std::optional<uint64_t> LipSyncClock::CalcPTS(uint32_t id, uint32_t rtp_timestam
 
 	clock->_last_rtp_timestamp = rtp_timestamp;
 
-	std::shared_lock<std::shared_mutex> lock(clock->_clock_lock);
+	if (clock->_correction != 0)
+	{
+		int64_t max_slew = static_cast<int64_t>(delta) * LIP_SYNC_CLOCK_MAX_SLEW_PERCENT / 100;
+		clock->_correction -= std::clamp<int64_t>(clock->_correction, -max_slew, max_slew);
+	}
+
 	// The timestamp difference can be negative.
-	auto pts = clock->_pts + ((int64_t)clock->_extended_rtp_timestamp - (int64_t)clock->_rtcp_timestamp);
+	auto pts = clock->_pts + ((int64_t)clock->_extended_rtp_timestamp - (int64_t)clock->_rtcp_timestamp) + clock->_correction;
 
 	// This is to make pts start at zero.
 	if (_first_pts == true)
@@ -96,6 +109,8 @@ std::optional<uint64_t> LipSyncClock::CalcPTS(uint32_t id, uint32_t rtp_timestam
 
 bool LipSyncClock::UpdateSenderReportTime(uint32_t id, uint32_t ntp_msw, uint32_t ntp_lsw, uint32_t rtcp_timestamp)
 {
+	std::lock_guard<std::mutex> lock(_mutex);
+
 	auto clock = GetClock(id);
 	if(clock == nullptr)
 	{
@@ -110,12 +125,87 @@ bool LipSyncClock::UpdateSenderReportTime(uint32_t id, uint32_t ntp_msw, uint32_
 
 	_enabled = true;
 
-	std::lock_guard<std::shared_mutex> lock(clock->_clock_lock);
+	auto ntp_seconds = ov::Converter::NtpTsToSeconds(ntp_msw, ntp_lsw);
+	int64_t sr_pts = ntp_seconds / clock->_timebase;
+
+	if (_predictive == true && _ntp_offset_found == false)
+	{
+		// The first SR of the stream: all the clocks (and the base of the PTS) are moved to the NTP time of the sender,
+		// so the PTS that has been calculated from the local time is not changed
+		int64_t expected_us = ov::Clock::NowUSec();
+		if (clock->_updated == true)
+		{
+			expected_us = static_cast<int64_t>((clock->_pts + static_cast<int32_t>(rtcp_timestamp - clock->_rtcp_timestamp)) * clock->_timebase * 1000000.0);
+		}
+
+		_ntp_offset_us = static_cast<int64_t>(ntp_seconds * 1000000.0) - expected_us;
+		_ntp_offset_found = true;
+
+		for (auto &[clock_id, other_clock] : _clock_map)
+		{
+			if (other_clock->_updated == true)
+			{
+				other_clock->_pts += static_cast<int64_t>(_ntp_offset_us / 1000000.0 / other_clock->_timebase);
+			}
+		}
+
+		if (_first_pts == false)
+		{
+			_adjust_pts_us += static_cast<int64_t>(_ntp_offset_us / 10.0);
+		}
+	}
+
+	if (clock->_updated == true)
+	{
+		// Difference of the PTS between the current mapping and the SR (the same for any RTP timestamp)
+		int64_t difference = (clock->_pts - static_cast<int64_t>(clock->_rtcp_timestamp)) - (sr_pts - static_cast<int64_t>(rtcp_timestamp));
+		clock->_alignment_error_us = static_cast<int64_t>(-difference * clock->_timebase * 1000000.0);
+
+		if (clock->_sender_report_received == true)
+		{
+			// The RTP time and the NTP time elapsed from the previous SR
+			int64_t rtp_elapsed = static_cast<int32_t>(rtcp_timestamp - clock->_rtcp_timestamp);
+			int64_t ntp_elapsed = sr_pts - clock->_pts;
+			if (ntp_elapsed > 0)
+			{
+				clock->_drift_ppm = static_cast<double>(ntp_elapsed - rtp_elapsed) * 1000000.0 / ntp_elapsed;
+			}
+		}
+
+		if (_predictive == true && clock->_last_rtp_timestamp != 0)
+		{
+			// The PTS continues from the current mapping, and converges to the SR in CalcPTS()
+			clock->_correction += difference;
+		}
+	}
+
 	clock->_updated = true;
+	clock->_sender_report_received = true;
+	clock->_sender_report_count++;
 	clock->_rtcp_timestamp = rtcp_timestamp;
-	clock->_pts = ov::Converter::NtpTsToSeconds(ntp_msw, ntp_lsw) / clock->_timebase;
+	clock->_pts = sr_pts;
 
 	logtd("Update SR : id(%u) NTP(%u/%u) pts(%lld) timestamp(%u)", id, ntp_msw, ntp_lsw, clock->_pts, clock->_rtcp_timestamp);
 
 	return true;
-}
\ No newline at end of file
+}
+
+std::optional<LipSyncClock::Stats> LipSyncClock::GetStats(uint32_t id)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	auto clock = GetClock(id);
+	if (clock == nullptr)
+	{
+		return {};
+	}
+
+	Stats stats;
+	stats.sender_report_received = clock->_sender_report_received;
+	stats.sender_report_count = clock->_sender_report_count;
+	stats.drift_ppm = clock->_drift_ppm;
+	stats.alignment_error_us = clock->_alignment_error_us;
+	stats.correction_us = static_cast<int64_t>(clock->_correction * clock->_timebase * 1000000.0);
+
+	return stats;
+}
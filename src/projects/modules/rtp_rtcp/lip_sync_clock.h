@@ -2,37 +2,71 @@
 
 #include "base/ovlibrary/ovlibrary.h"
 
+// In the predictive mode, the difference found by an RTCP SR is not applied at once to keep the PTS monotonic,
+// but slewed by up to this percentage of the elapsed RTP time
+#define LIP_SYNC_CLOCK_MAX_SLEW_PERCENT 5
+
 class LipSyncClock
 {
 public:
+	struct Stats
+	{
+		bool sender_report_received = false;
+		uint64_t sender_report_count = 0;
+		// Drift of the RTP clock against the NTP clock of the sender, measured between the last two SRs
+		double drift_ppm = 0.0;
+		// Difference between the PTS expected before the last SR and the PTS of the SR
+		int64_t alignment_error_us = 0;
+		// Remaining correction that is being slewed
+		int64_t correction_us = 0;
+	};
+
 	LipSyncClock() = default;
 
 	bool RegisterClock(uint32_t id, double timebase);
 
+	// If enabled, the PTS is calculated from the arrival time until the first RTCP SR arrives (so the packets are not held),
+	// and it converges to the time of the SR smoothly
+	void SetPredictive(bool predictive);
+
 	std::optional<uint64_t> CalcPTS(uint32_t id, uint32_t rtp_timestamp);
 	bool UpdateSenderReportTime(uint32_t id, uint32_t ntp_msw, uint32_t ntp_lsw, uint32_t rtcp_timestamp);
 
+	std::optional<Stats> GetStats(uint32_t id);
+
 	bool IsEnabled() {return _enabled;}
 
 private:
 	struct Clock
 	{
-		std::shared_mutex _clock_lock;
 		bool		_updated = false;
+		bool		_sender_report_received = false;
+		uint64_t	_sender_report_count = 0;
 		double		_timebase = 0;
 		uint32_t	_rtcp_timestamp = 0;
 		uint32_t 	_last_rtp_timestamp = 0;
 		uint64_t	_extended_rtp_timestamp = 0;
-		uint64_t	_pts = 0;	// converted NTP timestamp to timebase timestamp
+		int64_t		_pts = 0;	// converted NTP timestamp to timebase timestamp
+		// Added to the PTS (in timebase), it is slewed to 0
+		int64_t		_correction = 0;
+		double		_drift_ppm = 0.0;
+		int64_t		_alignment_error_us = 0;
 	};
 
 	// Id, Clock
 	std::map<uint32_t, std::shared_ptr<Clock>> _clock_map;
+	std::mutex _mutex;
 
 	bool _enabled = false;
+	bool _predictive = false;
+
+	// Until the first SR, the clocks of the predictive mode are based on the local time,
+	// and the first SR moves them to the NTP time of the sender by this offset
+	bool _ntp_offset_found = false;
+	int64_t _ntp_offset_us = 0;
 
 	std::shared_ptr<Clock> GetClock(uint32_t id);
 
 	bool _first_pts = true;
-	uint64_t _adjust_pts_us = 0;
-};
\ No newline at end of file
+	int64_t _adjust_pts_us = 0;
+};
@@ -10,16 +10,12 @@ RedRtpPacket::RedRtpPacket(uint8_t red_payload_type, RtpPacket &src)
 	_block_pt = PayloadType();
 	SetPayloadType(red_payload_type);
 
-	_payload_offset = _payload_offset + RED_HEADER_SIZE;
-	if(_data->GetLength() < _payload_offset)
+	// Insert the RED header without copying the payload again
+	auto red_header = InsertAfterHeader(RED_HEADER_SIZE);
+	if (red_header != nullptr)
 	{
-		_data->SetLength(_payload_offset);
-		_buffer = _data->GetWritableDataAs<uint8_t>();
+		red_header[0] = _block_pt;
 	}
-
-	_buffer[_payload_offset - RED_HEADER_SIZE] = _block_pt;
-
-	SetPayload(src.Payload(), src.PayloadSize());
 }
 
 RedRtpPacket::RedRtpPacket(RedRtpPacket &src)
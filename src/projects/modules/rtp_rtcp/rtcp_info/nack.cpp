@@ -44,7 +44,45 @@ bool NACK::Parse(const RtcpPacket &packet)
 // RtcpInfo must provide raw data
 std::shared_ptr<ov::Data> NACK::GetData() const 
 {
-	return nullptr;
+	if(_lost_ids.empty())
+	{
+		return nullptr;
+	}
+
+	// A PID and the following 16 ids are packed into a FCI
+	std::vector<std::pair<uint16_t, uint16_t>> fci_list;
+	for(auto id : _lost_ids)
+	{
+		if(fci_list.empty() == false)
+		{
+			auto &fci = fci_list.back();
+			uint16_t diff = id - fci.first;
+
+			if(diff >= 1 && diff <= 16)
+			{
+				fci.second |= (1 << (diff - 1));
+				continue;
+			}
+		}
+
+		fci_list.emplace_back(id, 0);
+	}
+
+	std::shared_ptr<ov::Data> nack_message = std::make_shared<ov::Data>();
+	nack_message->SetLength(8 + (fci_list.size() * 4));
+	ov::ByteStream stream(nack_message.get());
+
+	// Feedback
+	stream.WriteBE32(_src_ssrc);
+	stream.WriteBE32(_media_ssrc);
+
+	for(const auto &fci : fci_list)
+	{
+		stream.WriteBE16(fci.first);
+		stream.WriteBE16(fci.second);
+	}
+
+	return nack_message;
 }
 
 void NACK::DebugPrint()
@@ -72,6 +72,8 @@ public:
 
 		return _lost_ids[index];
 	}
+	// The ids are packed into PID/BLP pairs in the order they are added
+	void AddLostId(uint16_t id){_lost_ids.push_back(id);}
 
 private:
 	uint32_t	_src_ssrc = 0;
@@ -26,7 +26,7 @@ public:
 
 	// Extra Information
 	void SetRtpSsrc(uint32_t ssrc){_rtp_ssrc = ssrc;}
-	uint8_t GetRtpSsrc() const {return _rtp_ssrc;}
+	uint32_t GetRtpSsrc() const {return _rtp_ssrc;}
 	void SetRtspChannel(uint32_t rtsp_channel) {_rtsp_channel = rtsp_channel;}
 	uint32_t GetRtspChannel() const {return _rtsp_channel;}
 
@@ -1,7 +1,7 @@
 #include <base/ovlibrary/byte_io.h>
 #include "rtp_depacketizer_generic_audio.h"
 
-std::shared_ptr<ov::Data> RtpDepacketizerGenericAudio::ParseAndAssembleFrame(std::vector<std::shared_ptr<ov::Data>> payload_list)
+std::shared_ptr<ov::Data> RtpDepacketizerGenericAudio::ParseAndAssembleFrame(const std::vector<std::shared_ptr<ov::Data>> &payload_list)
 {
 	if(payload_list.size() <= 0)
 	{
@@ -5,5 +5,5 @@
 class RtpDepacketizerGenericAudio : public RtpDepacketizingManager
 {
 public:
-	std::shared_ptr<ov::Data> ParseAndAssembleFrame(std::vector<std::shared_ptr<ov::Data>> payload_list) override;
+	std::shared_ptr<ov::Data> ParseAndAssembleFrame(const std::vector<std::shared_ptr<ov::Data>> &payload_list) override;
 };
\ No newline at end of file
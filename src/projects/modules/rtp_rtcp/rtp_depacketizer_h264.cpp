@@ -1,15 +1,19 @@
 #include <base/ovlibrary/byte_io.h>
 #include "rtp_depacketizer_h264.h"
 
-std::shared_ptr<ov::Data> RtpDepacketizerH264::ParseAndAssembleFrame(std::vector<std::shared_ptr<ov::Data>> payload_list)
+std::shared_ptr<ov::Data> RtpDepacketizerH264::ParseAndAssembleFrame(const std::vector<std::shared_ptr<ov::Data>> &payload_list)
 {
+	_is_keyframe = false;
+
 	if(payload_list.size() <= 0)
 	{
 		return nullptr;
 	}
 
-	auto reserve_size = 0;
-	for(auto &payload : payload_list)
+	// Every payload is appended directly into a single frame buffer, so the buffer is sized once up front
+	// (FU-A gains at most a start prefix, STAP-A gains a start prefix per aggregated NALU in place of the length field)
+	size_t reserve_size = 0;
+	for(const auto &payload : payload_list)
 	{
 		reserve_size += payload->GetLength();
 		reserve_size += 16; // spare
@@ -19,39 +23,31 @@ std::shared_ptr<ov::Data> RtpDepacketizerH264::ParseAndAssembleFrame(std::vector
 	bool start_payload = true;
 	for(const auto &payload : payload_list)
 	{
+		if(payload->GetLength() < NAL_HEADER_SIZE)
+		{
+			return nullptr;
+		}
+
 		uint8_t nal_type = (payload->GetDataAs<uint8_t>()[0]) & NAL_TYPE_MASK;
-		std::shared_ptr<ov::Data> result;
+		bool result;
 
 		// Fragmented NAL units
 		if(nal_type == NaluType::kFuA)
 		{
-			result = ParseFuaAndConvertAnnexB(payload, start_payload);
-			if(result == nullptr)
-			{
-				return nullptr;
-			}
-
-			bitstream->Append(result);
+			result = AppendFuaAsAnnexB(payload, *bitstream, start_payload);
 		}
 		else if(nal_type == NaluType::kStapA)
 		{
-			result = ParseStapAAndConvertToAnnexB(payload);
-			if(result == nullptr)
-			{
-				return nullptr;
-			}
-
-			bitstream->Append(result);
+			result = AppendStapAAsAnnexB(payload, *bitstream);
 		}
 		else
 		{
-			result = ConvertSingleNaluToAnnexB(payload);
-			if(result == nullptr)
-			{
-				return nullptr;
-			}
+			result = AppendSingleNaluAsAnnexB(payload, *bitstream);
+		}
 
-			bitstream->Append(result);
+		if(result == false)
+		{
+			return nullptr;
 		}
 
 		start_payload = false;
@@ -60,14 +56,17 @@ std::shared_ptr<ov::Data> RtpDepacketizerH264::ParseAndAssembleFrame(std::vector
 	return bitstream;
 }
 
-std::shared_ptr<ov::Data> RtpDepacketizerH264::ParseFuaAndConvertAnnexB(const std::shared_ptr<ov::Data> &payload, bool start)
+bool RtpDepacketizerH264::IsKeyframe() const
 {
-	auto bitstream = std::make_shared<ov::Data>(payload->GetLength() + 16);
+	return _is_keyframe;
+}
 
+bool RtpDepacketizerH264::AppendFuaAsAnnexB(const std::shared_ptr<ov::Data> &payload, ov::Data &bitstream, bool start)
+{
 	if(payload->GetLength() < FUA_HEADER_SIZE)
 	{
 		// Invalid Data
-		return nullptr;
+		return false;
 	}
 
 	auto buffer = payload->GetDataAs<uint8_t>();
@@ -86,15 +85,20 @@ std::shared_ptr<ov::Data> RtpDepacketizerH264::ParseFuaAndConvertAnnexB(const st
 		start_prefix_and_nal_header[3] = 1;
 		start_prefix_and_nal_header[4] = original_nal_header;
 
-		bitstream->Append(start_prefix_and_nal_header, ANNEXB_START_PREFIX_LENGTH + NAL_HEADER_SIZE);
+		bitstream.Append(start_prefix_and_nal_header, ANNEXB_START_PREFIX_LENGTH + NAL_HEADER_SIZE);
+
+		if(original_nal_type == NaluType::kIdr)
+		{
+			_is_keyframe = true;
+		}
 	}
-	
-	bitstream->Append(payload->Subdata(FUA_HEADER_SIZE));
 
-	return bitstream;
+	bitstream.Append(buffer + FUA_HEADER_SIZE, payload->GetLength() - FUA_HEADER_SIZE);
+
+	return true;
 }
 
-std::shared_ptr<ov::Data> RtpDepacketizerH264::ParseStapAAndConvertToAnnexB(const std::shared_ptr<ov::Data> &payload)
+bool RtpDepacketizerH264::AppendStapAAsAnnexB(const std::shared_ptr<ov::Data> &payload, ov::Data &bitstream)
 {
 	/*
 	https://tools.ietf.org/html/rfc6184#section-5.7.1
@@ -118,12 +122,11 @@ std::shared_ptr<ov::Data> RtpDepacketizerH264::ParseStapAAndConvertToAnnexB(cons
     +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
 	*/
 
-	auto bitstream = std::make_shared<ov::Data>(payload->GetLength() + 1024);
 	uint8_t start_prefix[ANNEXB_START_PREFIX_LENGTH] = {0, 0, 0, 1};
 
 	if(payload->GetLength() < NAL_HEADER_SIZE + LENGTH_FIELD_SIZE)
 	{
-		return nullptr;
+		return false;
 	}
 
 	auto payload_buffer = payload->GetDataAs<uint8_t>();
@@ -132,7 +135,7 @@ std::shared_ptr<ov::Data> RtpDepacketizerH264::ParseStapAAndConvertToAnnexB(cons
 
 	offset += NAL_HEADER_SIZE;	// STAP-A NAL HDR
 
-	while(offset < payload_length)
+	while(offset + LENGTH_FIELD_SIZE <= payload_length)
 	{
 		// Get NAL Length
 		uint16_t nalu_size = ByteReader<uint16_t>::ReadBigEndian(&payload_buffer[offset]);
@@ -140,35 +143,43 @@ std::shared_ptr<ov::Data> RtpDepacketizerH264::ParseStapAAndConvertToAnnexB(cons
 
 		if(offset + nalu_size > payload_length)
 		{
-			return nullptr;
+			return false;
 		}
 
 		// Start Prefix
-		bitstream->Append(start_prefix, ANNEXB_START_PREFIX_LENGTH);
+		bitstream.Append(start_prefix, ANNEXB_START_PREFIX_LENGTH);
 
 		// Append NALU
-		bitstream->Append(&payload_buffer[offset], nalu_size);
+		bitstream.Append(&payload_buffer[offset], nalu_size);
 
-		[[maybe_unused]] uint8_t nal_type = payload_buffer[offset] & NAL_TYPE_MASK;
+		uint8_t nal_type = payload_buffer[offset] & NAL_TYPE_MASK;
+		if(nal_type == NaluType::kIdr)
+		{
+			_is_keyframe = true;
+		}
 
 		logd("DEBUG", "STAP-A Nal Type : %d", nal_type);
 
 		offset += nalu_size;
 	}
 
-	return bitstream;
+	return true;
 }
 
-std::shared_ptr<ov::Data> RtpDepacketizerH264::ConvertSingleNaluToAnnexB(const std::shared_ptr<ov::Data> &payload)
+bool RtpDepacketizerH264::AppendSingleNaluAsAnnexB(const std::shared_ptr<ov::Data> &payload, ov::Data &bitstream)
 {
-	auto bitstream = std::make_shared<ov::Data>(payload->GetLength() + ANNEXB_START_PREFIX_LENGTH);
 	uint8_t start_prefix[ANNEXB_START_PREFIX_LENGTH] = {0, 0, 0, 1};
 
-	bitstream->Append(start_prefix, ANNEXB_START_PREFIX_LENGTH);
-	bitstream->Append(payload);
+	bitstream.Append(start_prefix, ANNEXB_START_PREFIX_LENGTH);
+	bitstream.Append(payload->GetData(), payload->GetLength());
+
+	uint8_t nal_type = payload->GetDataAs<uint8_t>()[0] & NAL_TYPE_MASK;
+	if(nal_type == NaluType::kIdr)
+	{
+		_is_keyframe = true;
+	}
 
-	[[maybe_unused]] uint8_t nal_type = payload->GetDataAs<uint8_t>()[0] & NAL_TYPE_MASK;
 	logd("DEBUG", "Single Nal Type : %d", nal_type);
 
-	return bitstream;
-}
\ No newline at end of file
+	return true;
+}
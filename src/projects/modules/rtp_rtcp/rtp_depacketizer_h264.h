@@ -20,10 +20,16 @@
 class RtpDepacketizerH264 : public RtpDepacketizingManager
 {
 public:
-	std::shared_ptr<ov::Data> ParseAndAssembleFrame(std::vector<std::shared_ptr<ov::Data>> payload_list) override;
+	std::shared_ptr<ov::Data> ParseAndAssembleFrame(const std::vector<std::shared_ptr<ov::Data>> &payload_list) override;
+
+	// Whether the frame assembled by the last ParseAndAssembleFrame() contains an IDR NAL unit
+	bool IsKeyframe() const;
 
 private:
-	std::shared_ptr<ov::Data> ParseFuaAndConvertAnnexB(const std::shared_ptr<ov::Data> &payload, bool start=false);
-	std::shared_ptr<ov::Data> ParseStapAAndConvertToAnnexB(const std::shared_ptr<ov::Data> &payload);
-	std::shared_ptr<ov::Data> ConvertSingleNaluToAnnexB(const std::shared_ptr<ov::Data> &payload);
+	// Each of these appends the NAL unit(s) of the payload to the frame being assembled in Annex B form
+	bool AppendFuaAsAnnexB(const std::shared_ptr<ov::Data> &payload, ov::Data &bitstream, bool start=false);
+	bool AppendStapAAsAnnexB(const std::shared_ptr<ov::Data> &payload, ov::Data &bitstream);
+	bool AppendSingleNaluAsAnnexB(const std::shared_ptr<ov::Data> &payload, ov::Data &bitstream);
+
+	bool _is_keyframe = false;
 };
\ No newline at end of file
@@ -0,0 +1,212 @@
+#include <base/ovlibrary/byte_io.h>
+#include "rtp_depacketizer_h265.h"
+#include "rtp_packetizer_h265.h"
+
+std::shared_ptr<ov::Data> RtpDepacketizerH265::ParseAndAssembleFrame(const std::vector<std::shared_ptr<ov::Data>> &payload_list)
+{
+	_is_keyframe = false;
+
+	if(payload_list.size() <= 0)
+	{
+		return nullptr;
+	}
+
+	// Same as H.264, the buffer is sized once up front
+	// (FU gains a start prefix and the NAL header, AP gains a start prefix per aggregated NALU in place of the length field)
+	size_t reserve_size = 0;
+	for(const auto &payload : payload_list)
+	{
+		reserve_size += payload->GetLength();
+		reserve_size += 16; // spare
+	}
+
+	auto bitstream = std::make_shared<ov::Data>(reserve_size);
+	bool start_payload = true;
+	for(const auto &payload : payload_list)
+	{
+		if(payload->GetLength() < H265_DEPACKETIZER_NAL_HEADER_SIZE)
+		{
+			return nullptr;
+		}
+
+		uint8_t nal_type = (payload->GetDataAs<uint8_t>()[0] & kHevcTypeMask) >> 1;
+		bool result;
+
+		if(nal_type == HevcRTPNaluType::kHevcFu)
+		{
+			result = AppendFuAsAnnexB(payload, *bitstream, start_payload);
+		}
+		else if(nal_type == HevcRTPNaluType::kHevcAp)
+		{
+			result = AppendApAsAnnexB(payload, *bitstream);
+		}
+		else if(nal_type > HevcRTPNaluType::kHevcFu)
+		{
+			// PACI and the reserved types
+			logd("DEBUG", "Unsupported H265 payload type : %d", nal_type);
+			result = true;
+		}
+		else
+		{
+			result = AppendSingleNaluAsAnnexB(payload, *bitstream);
+		}
+
+		if(result == false)
+		{
+			return nullptr;
+		}
+
+		start_payload = false;
+	}
+
+	return bitstream;
+}
+
+bool RtpDepacketizerH265::IsKeyframe() const
+{
+	return _is_keyframe;
+}
+
+void RtpDepacketizerH265::CheckKeyframe(uint8_t nal_type)
+{
+	// IRAP pictures (BLA_W_LP ~ CRA_NUT)
+	if(nal_type >= 16 && nal_type <= 21)
+	{
+		_is_keyframe = true;
+	}
+}
+
+bool RtpDepacketizerH265::AppendFuAsAnnexB(const std::shared_ptr<ov::Data> &payload, ov::Data &bitstream, bool start)
+{
+	/*
+	https://tools.ietf.org/html/rfc7798#section-4.4.3
+
+	 0                   1                   2                   3
+	 0 1 2 3 4 5 6 7 8 9 0 1 2 3 4 5 6 7 8 9 0 1 2 3 4 5 6 7 8 9 0 1
+	+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+	|    PayloadHdr (Type=49)       |   FU header   | DONL (cond)   |
+	+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-|
+	| DONL (cond)   |                                               |
+	|-+-+-+-+-+-+-+-+                                               |
+	|                         FU payload                            |
+	|                                                               |
+	|                               +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+	|                               :...OPTIONAL RTP padding        |
+	+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+	*/
+
+	if(payload->GetLength() < H265_DEPACKETIZER_NAL_HEADER_SIZE + H265_DEPACKETIZER_FU_HEADER_SIZE)
+	{
+		// Invalid Data
+		return false;
+	}
+
+	auto buffer = payload->GetDataAs<uint8_t>();
+	uint8_t fu_header = buffer[H265_DEPACKETIZER_NAL_HEADER_SIZE];
+	uint8_t original_nal_type = fu_header & kHevcFuTypeBit;
+	bool first_fragment = (fu_header & kHevcSBit) > 0;
+
+	if(first_fragment == true || start == true)
+	{
+		uint8_t start_prefix_and_nal_header[H265_DEPACKETIZER_START_PREFIX_LENGTH + H265_DEPACKETIZER_NAL_HEADER_SIZE];
+
+		start_prefix_and_nal_header[0] = 0;
+		start_prefix_and_nal_header[1] = 0;
+		start_prefix_and_nal_header[2] = 0;
+		start_prefix_and_nal_header[3] = 1;
+		// F and LayerId (high bit) of PayloadHdr, and the type of FU header
+		start_prefix_and_nal_header[4] = (buffer[0] & kHevcTypeMaskN) | (original_nal_type << 1);
+		// LayerId (low bits) and TID
+		start_prefix_and_nal_header[5] = buffer[1];
+
+		bitstream.Append(start_prefix_and_nal_header, sizeof(start_prefix_and_nal_header));
+
+		CheckKeyframe(original_nal_type);
+	}
+
+	bitstream.Append(buffer + H265_DEPACKETIZER_NAL_HEADER_SIZE + H265_DEPACKETIZER_FU_HEADER_SIZE,
+					 payload->GetLength() - H265_DEPACKETIZER_NAL_HEADER_SIZE - H265_DEPACKETIZER_FU_HEADER_SIZE);
+
+	return true;
+}
+
+bool RtpDepacketizerH265::AppendApAsAnnexB(const std::shared_ptr<ov::Data> &payload, ov::Data &bitstream)
+{
+	/*
+	https://tools.ietf.org/html/rfc7798#section-4.4.2
+
+	 0                   1                   2                   3
+	 0 1 2 3 4 5 6 7 8 9 0 1 2 3 4 5 6 7 8 9 0 1 2 3 4 5 6 7 8 9 0 1
+	+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+	|                          RTP Header                           |
+	+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+	|   PayloadHdr (Type=48)        |         NALU 1 Size           |
+	+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+	|          NALU 1 HDR           |                               |
+	+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+         NALU 1 Data           |
+	|                   . . .                                       |
+	|                                                               |
+	+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+	|  . . .        | NALU 2 Size                   | NALU 2 HDR    |
+	+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+	| NALU 2 HDR    |                                               |
+	+-+-+-+-+-+-+-+-+                NALU 2 Data                    |
+	|                   . . .                                       |
+	|                               +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+	|                               :...OPTIONAL RTP padding        |
+	+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+	*/
+
+	uint8_t start_prefix[H265_DEPACKETIZER_START_PREFIX_LENGTH] = {0, 0, 0, 1};
+
+	if(payload->GetLength() < H265_DEPACKETIZER_NAL_HEADER_SIZE + H265_DEPACKETIZER_LENGTH_FIELD_SIZE)
+	{
+		return false;
+	}
+
+	auto payload_buffer = payload->GetDataAs<uint8_t>();
+	size_t payload_length = payload->GetLength();
+	size_t offset = H265_DEPACKETIZER_NAL_HEADER_SIZE;	// PayloadHdr
+
+	while(offset + H265_DEPACKETIZER_LENGTH_FIELD_SIZE <= payload_length)
+	{
+		// Get NAL Length
+		uint16_t nalu_size = ByteReader<uint16_t>::ReadBigEndian(&payload_buffer[offset]);
+		offset += H265_DEPACKETIZER_LENGTH_FIELD_SIZE;
+
+		if(nalu_size < H265_DEPACKETIZER_NAL_HEADER_SIZE || offset + nalu_size > payload_length)
+		{
+			return false;
+		}
+
+		// Start Prefix
+		bitstream.Append(start_prefix, H265_DEPACKETIZER_START_PREFIX_LENGTH);
+
+		// Append NALU
+		bitstream.Append(&payload_buffer[offset], nalu_size);
+
+		uint8_t nal_type = (payload_buffer[offset] & kHevcTypeMask) >> 1;
+		CheckKeyframe(nal_type);
+
+		logd("DEBUG", "AP Nal Type : %d", nal_type);
+
+		offset += nalu_size;
+	}
+
+	return true;
+}
+
+bool RtpDepacketizerH265::AppendSingleNaluAsAnnexB(const std::shared_ptr<ov::Data> &payload, ov::Data &bitstream)
+{
+	uint8_t start_prefix[H265_DEPACKETIZER_START_PREFIX_LENGTH] = {0, 0, 0, 1};
+
+	bitstream.Append(start_prefix, H265_DEPACKETIZER_START_PREFIX_LENGTH);
+	bitstream.Append(payload->GetData(), payload->GetLength());
+
+	uint8_t nal_type = (payload->GetDataAs<uint8_t>()[0] & kHevcTypeMask) >> 1;
+	CheckKeyframe(nal_type);
+
+	logd("DEBUG", "Single Nal Type : %d", nal_type);
+
+	return true;
+}
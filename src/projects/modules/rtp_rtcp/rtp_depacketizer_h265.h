@@ -0,0 +1,32 @@
+#pragma once
+
+#include "rtp_depacketizing_manager.h"
+#include "rtp_rtcp_defines.h"
+
+#define H265_DEPACKETIZER_NAL_HEADER_SIZE		2
+#define H265_DEPACKETIZER_FU_HEADER_SIZE		1
+#define H265_DEPACKETIZER_LENGTH_FIELD_SIZE		2
+#define H265_DEPACKETIZER_START_PREFIX_LENGTH	4
+
+// Depacketizer of RFC 7798 (H.265 over RTP) for the HEVC publishers (e.g. WHIP)
+//
+// Single NAL unit packets, Aggregation Packets (AP) and Fragmentation Units (FU) are assembled into an Annex B frame.
+// DONL/DOND fields (sprop-max-don-diff > 0) and PACI packets are not supported, as the browsers do not send them.
+class RtpDepacketizerH265 : public RtpDepacketizingManager
+{
+public:
+	std::shared_ptr<ov::Data> ParseAndAssembleFrame(const std::vector<std::shared_ptr<ov::Data>> &payload_list) override;
+
+	// Whether the frame assembled by the last ParseAndAssembleFrame() contains an IRAP NAL unit
+	bool IsKeyframe() const;
+
+private:
+	// Each of these appends the NAL unit(s) of the payload to the frame being assembled in Annex B form
+	bool AppendFuAsAnnexB(const std::shared_ptr<ov::Data> &payload, ov::Data &bitstream, bool start=false);
+	bool AppendApAsAnnexB(const std::shared_ptr<ov::Data> &payload, ov::Data &bitstream);
+	bool AppendSingleNaluAsAnnexB(const std::shared_ptr<ov::Data> &payload, ov::Data &bitstream);
+
+	void CheckKeyframe(uint8_t nal_type);
+
+	bool _is_keyframe = false;
+};
@@ -1,9 +1,10 @@
 #include <base/ovlibrary/bit_reader.h>
+#include <modules/bitstream/aac/aac_adts.h>
 #include "rtp_depacketizer_mpeg4_generic_audio.h"
 
 #define OV_LOG_TAG "RtpDepacketizerMpeg4GenericAudio"
 
-std::shared_ptr<ov::Data> RtpDepacketizerMpeg4GenericAudio::ParseAndAssembleFrame(std::vector<std::shared_ptr<ov::Data>> payload_list)
+std::shared_ptr<ov::Data> RtpDepacketizerMpeg4GenericAudio::ParseAndAssembleFrame(const std::vector<std::shared_ptr<ov::Data>> &payload_list)
 {
 	if(_is_valid == false)
 	{
@@ -57,7 +58,9 @@ std::shared_ptr<ov::Data> RtpDepacketizerMpeg4GenericAudio::ParseAndAssembleFram
 				uint8_t aac_sample_rate = static_cast<uint8_t>(_aac_config.SamplingFrequency());
 				uint8_t aac_channels = static_cast<uint8_t>(_aac_config.Channel());
 
-				bitstream->Append(AacConverter::MakeAdtsHeader(aac_profile, aac_sample_rate, aac_channels, raw_aac_data_length));
+				uint8_t adts_header[ADTS_MIN_SIZE];
+				AacConverter::WriteAdtsHeader(adts_header, aac_profile, aac_sample_rate, aac_channels, raw_aac_data_length);
+				bitstream->Append(adts_header, sizeof(adts_header));
 
 				first = false;
 			}
@@ -15,7 +15,7 @@ public:
 		AAC_hbr
 	};
 
-	std::shared_ptr<ov::Data> ParseAndAssembleFrame(std::vector<std::shared_ptr<ov::Data>> payload_list) override;
+	std::shared_ptr<ov::Data> ParseAndAssembleFrame(const std::vector<std::shared_ptr<ov::Data>> &payload_list) override;
 
 	// OME does not support interleaving as it is an ultra-low latency streaming server.
 	bool SetConfigParams(Mode mode, uint32_t size_length, uint32_t index_length, uint32_t index_delta_length, const std::shared_ptr<ov::Data> &config);
@@ -1,7 +1,7 @@
 #include <base/ovlibrary/bit_reader.h>
 #include "rtp_depacketizer_vp8.h"
 
-std::shared_ptr<ov::Data> RtpDepacketizerVP8::ParseAndAssembleFrame(std::vector<std::shared_ptr<ov::Data>> payload_list)
+std::shared_ptr<ov::Data> RtpDepacketizerVP8::ParseAndAssembleFrame(const std::vector<std::shared_ptr<ov::Data>> &payload_list)
 {
 	if(payload_list.size() <= 0)
 	{
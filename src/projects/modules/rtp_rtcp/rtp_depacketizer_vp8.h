@@ -89,7 +89,7 @@
 class RtpDepacketizerVP8 : public RtpDepacketizingManager
 {
 public:
-	std::shared_ptr<ov::Data> ParseAndAssembleFrame(std::vector<std::shared_ptr<ov::Data>> payload_list) override;
+	std::shared_ptr<ov::Data> ParseAndAssembleFrame(const std::vector<std::shared_ptr<ov::Data>> &payload_list) override;
 
 private:
 	// Parse VP8 payload descriptor and return payload
@@ -3,6 +3,7 @@
 #include "rtp_depacketizer_generic_audio.h"
 #include "rtp_depacketizer_mpeg4_generic_audio.h"
 #include "rtp_depacketizer_h264.h"
+#include "rtp_depacketizer_h265.h"
 #include "rtp_depacketizer_vp8.h"
 
 std::shared_ptr<RtpDepacketizingManager> RtpDepacketizingManager::Create(SupportedDepacketizerType type)
@@ -11,6 +12,8 @@ std::shared_ptr<RtpDepacketizingManager> RtpDepacketizingManager::Create(Support
 	{
 		case RtpDepacketizingManager::SupportedDepacketizerType::H264:
 			return std::make_shared<RtpDepacketizerH264>();
+		case RtpDepacketizingManager::SupportedDepacketizerType::H265:
+			return std::make_shared<RtpDepacketizerH265>();
 		case RtpDepacketizingManager::SupportedDepacketizerType::VP8:
 			return std::make_shared<RtpDepacketizerVP8>();
 		case RtpDepacketizingManager::SupportedDepacketizerType::MPEG4_GENERIC_AUDIO:
@@ -9,11 +9,12 @@ public:
 	enum class SupportedDepacketizerType
 	{
 		H264,
+		H265,
 		VP8,
 		OPUS,
 		MPEG4_GENERIC_AUDIO
 	};
 
 	static std::shared_ptr<RtpDepacketizingManager> Create(SupportedDepacketizerType type);
-	virtual std::shared_ptr<ov::Data> ParseAndAssembleFrame(std::vector<std::shared_ptr<ov::Data>> payload_list) = 0;
+	virtual std::shared_ptr<ov::Data> ParseAndAssembleFrame(const std::vector<std::shared_ptr<ov::Data>> &payload_list) = 0;
 };
@@ -2,258 +2,351 @@
 
 #define OV_LOG_TAG "RtpVideoJitterBuffer"
 
+static_assert((RTP_FRAME_JITTER_BUFFER_SLOT_COUNT & (RTP_FRAME_JITTER_BUFFER_SLOT_COUNT - 1)) == 0, "The slot count must be a power of 2");
+static_assert((RTP_FRAME_JITTER_BUFFER_SLOT_COUNT % 64) == 0, "The slot count must be a multiple of 64 for the bitmap");
+
+#define SLOT_INDEX(sequence_number) (static_cast<size_t>(sequence_number) & (RTP_FRAME_JITTER_BUFFER_SLOT_COUNT - 1))
+
 /************************************************************************
  * 								RTPFrame
  ***********************************************************************/
 
-RtpFrame::RtpFrame()
+RtpFrame::RtpFrame(uint32_t timestamp, std::vector<std::shared_ptr<RtpPacket>> packets)
+	: _timestamp(timestamp),
+	  _packets(std::move(packets))
 {
-	_stop_watch.Start();
 }
 
 std::shared_ptr<RtpPacket> RtpFrame::GetFirstRtpPacket()
 {
-	if (IsCompleted() == false)
-	{
-		return nullptr;
-	}
-
-	_curr_sequence_number = _first_sequence_number;
+	_curr_index = 0;
 
-	auto it = _packets.find(_curr_sequence_number);
-	if (it == _packets.end())
+	if (_packets.empty())
 	{
 		return nullptr;
 	}
 
-	return it->second;
+	return _packets[_curr_index];
 }
 
 std::shared_ptr<RtpPacket> RtpFrame::GetNextRtpPacket()
 {
-	if (IsCompleted() == false)
+	if (_curr_index + 1 >= _packets.size())
 	{
 		return nullptr;
 	}
 
-	_curr_sequence_number++;
+	_curr_index++;
 
-	auto it = _packets.find(_curr_sequence_number);
-	if (it == _packets.end())
-	{
-		return nullptr;
-	}
-
-	return it->second;
+	return _packets[_curr_index];
 }
 
-uint32_t RtpFrame::GetExtendedSequenceNumber(uint16_t sequence_number)
+const std::vector<std::shared_ptr<RtpPacket>> &RtpFrame::GetPackets() const
 {
-	// If the timestamp is less than the previous timestamp, it is assumed that the timestamp has been rolled over.
-	if (sequence_number < _last_sequence_number && _last_sequence_number - sequence_number > 0x8000)
-	{
-		_timestamp_cycle++;
-	}
+	return _packets;
+}
 
-	_last_sequence_number = sequence_number;
+/************************************************************************
+ * 							Jitter Buffer
+ ***********************************************************************/
 
-	// Extended sequence number
-	// [16bit timestamp cycle][16bit sequence number]
-	return (static_cast<uint32_t>(_timestamp_cycle) << 16) | sequence_number;
+RtpFrameJitterBuffer::RtpFrameJitterBuffer()
+	: _slots(RTP_FRAME_JITTER_BUFFER_SLOT_COUNT),
+	  _received_bitmap(RTP_FRAME_JITTER_BUFFER_SLOT_COUNT / 64, 0)
+{
 }
 
-bool RtpFrame::InsertPacket(const std::shared_ptr<RtpPacket> &packet)
+void RtpFrameJitterBuffer::EnableNack(bool enabled)
 {
-	logtd("Insert packet : %s", packet->Dump().CStr());
-
-	auto sequence_number = GetExtendedSequenceNumber(packet->SequenceNumber());
+	_nack_enabled = enabled;
+	_max_buffering_time_ms = enabled ? RTP_FRAME_JITTER_BUFFER_NACK_MAX_BUFFERING_TIME_MS : DEFAULT_VIDEO_MAX_BUFFERING_TIME_MS;
+}
 
-	auto inserted = _packets.emplace(sequence_number, packet);
-	if (inserted.second == false)
+int64_t RtpFrameJitterBuffer::GetExtendedSequenceNumber(uint16_t sequence_number)
+{
+	if (_initialized == false)
 	{
-		// duplicated packet
-		logte("Duplicated packet: %u", sequence_number);
-		return false;
-	}
+		// It starts from the second cycle, so the packets reordered before the first packet are not negative
+		_initialized = true;
+		_highest_sequence_number = (1 << 16) | sequence_number;
+		_next_sequence_number = _highest_sequence_number;
+		_contiguous_sequence_number = _highest_sequence_number;
 
-	// First packet
-	if (_timestamp == 0 || sequence_number < _first_sequence_number)
-	{
-		_timestamp = packet->Timestamp();
-		_first_sequence_number = sequence_number;
+		return _highest_sequence_number;
 	}
 
-	if (packet->Marker())
-	{
-		_marked = true;
-		_marker_sequence_number = sequence_number;
-	}
+	// The nearest one to the highest sequence number (considering the roll over)
+	auto delta = static_cast<int16_t>(sequence_number - static_cast<uint16_t>(_highest_sequence_number));
 
-	// Check if frame is completed
-	if (_marked == true)
-	{
-		CheckCompleted();
-	}
+	return _highest_sequence_number + delta;
+}
 
-	return true;
+RtpFrameJitterBuffer::Slot &RtpFrameJitterBuffer::GetSlot(int64_t sequence_number)
+{
+	return _slots[SLOT_INDEX(sequence_number)];
 }
 
-bool RtpFrame::IsMarked()
+bool RtpFrameJitterBuffer::IsReceived(int64_t sequence_number) const
 {
-	return _marked;
+	auto index = SLOT_INDEX(sequence_number);
+
+	return ((_received_bitmap[index >> 6] >> (index & 63)) & 1) != 0;
 }
 
-bool RtpFrame::IsCompleted()
+void RtpFrameJitterBuffer::SetReceived(int64_t sequence_number, bool received)
 {
-	if (_completed == true)
+	auto index = SLOT_INDEX(sequence_number);
+
+	if (received)
 	{
-		return true;
+		_received_bitmap[index >> 6] |= (1ULL << (index & 63));
 	}
-
-	if (_marked == true)
+	else
 	{
-		return CheckCompleted();
+		_received_bitmap[index >> 6] &= ~(1ULL << (index & 63));
 	}
-
-	return false;
 }
 
-bool RtpFrame::CheckCompleted()
+bool RtpFrameJitterBuffer::InsertPacket(const std::shared_ptr<RtpPacket> &packet)
 {
-	// Already completed
-	if (_completed == true)
-	{
-		return true;
-	}
+	auto sequence_number = GetExtendedSequenceNumber(packet->SequenceNumber());
 
-	if (_marked == false)
+	if (sequence_number < _next_sequence_number)
 	{
+		// The frame of this packet has already been popped or given up
+		logtd("Late packet is discarded - seq(%u)", packet->SequenceNumber());
 		return false;
 	}
 
-	// Check number of packets
-	uint16_t need_number_of_packets = _marker_sequence_number - _first_sequence_number + 1;
-
-	// Check if frame is valid
-	if (need_number_of_packets == _packets.size())
+	if (IsReceived(sequence_number) && GetSlot(sequence_number)._sequence_number == sequence_number)
 	{
-		_completed = true;
-		logtd("Frame completed: timestamp(%u) packets(%u) need packets(%u)", _timestamp, _packets.size(), need_number_of_packets);
+		logtd("Duplicated packet: %u", packet->SequenceNumber());
+		return false;
 	}
-	else
+
+	if (sequence_number - _next_sequence_number >= RTP_FRAME_JITTER_BUFFER_SLOT_COUNT)
 	{
-		logte("Invalid frame: timestamp(%u) %u/%u", _timestamp, _packets.size(), need_number_of_packets);
-	}
+		// The buffer is full, so the oldest frames are given up to make room for the packet
+		logtw("Jitter buffer is full, incomplete frames are discarded - seq(%u)", packet->SequenceNumber());
 
-	return _completed;
-}
+		while (sequence_number - _next_sequence_number >= RTP_FRAME_JITTER_BUFFER_SLOT_COUNT)
+		{
+			if (_next_sequence_number > _highest_sequence_number)
+			{
+				// There is no packet to give up anymore
+				DiscardPackets(sequence_number);
+				break;
+			}
+
+			SkipIncompleteFrame();
+		}
 
-uint64_t RtpFrame::GetElapsed()
-{
-	return _stop_watch.Elapsed();
-}
+		_keyframe_request_needed = true;
+	}
 
-/************************************************************************
- * 							Jitter Buffer
- ***********************************************************************/
+	_highest_sequence_number = std::max(_highest_sequence_number, sequence_number);
 
-uint64_t RtpFrameJitterBuffer::GetExtentedTimestamp(uint32_t timestamp)
-{
-	// If the timestamp is less than the previous timestamp, it is assumed that the timestamp has been rolled over.
-	if (timestamp < _last_timestamp && _last_timestamp - timestamp > 0x80000000)
+	auto &slot = GetSlot(sequence_number);
+	if (slot._sequence_number != sequence_number)
 	{
-		_timestamp_cycle++;
+		slot._sequence_number = sequence_number;
+		slot._nack_time_ms = 0;
+		slot._nack_count = 0;
 	}
+	slot._packet = packet;
+	SetReceived(sequence_number, true);
 
-	_last_timestamp = timestamp;
+	AssembleFrames();
 
-	return (static_cast<uint64_t>(_timestamp_cycle) << 32) | timestamp;
+	return true;
 }
 
-bool RtpFrameJitterBuffer::InsertPacket(const std::shared_ptr<RtpPacket> &packet)
+void RtpFrameJitterBuffer::AssembleFrames()
 {
-	auto timestamp = GetExtentedTimestamp(packet->Timestamp());
+	while (true)
+	{
+		bool advanced = false;
 
-	auto it = _rtp_frames.find(timestamp);
-	std::shared_ptr<RtpFrame> frame;
+		// Only the packets after the last contiguous one need to be checked
+		while (_contiguous_sequence_number <= _highest_sequence_number && IsReceived(_contiguous_sequence_number))
+		{
+			auto marker_packet = GetSlot(_contiguous_sequence_number)._packet;
+			_contiguous_sequence_number++;
+			advanced = true;
+
+			if (marker_packet->Marker() == false)
+			{
+				continue;
+			}
+
+			// All packets from the first to the marked packet are received
+			std::vector<std::shared_ptr<RtpPacket>> packets;
+			packets.reserve(_contiguous_sequence_number - _next_sequence_number);
+
+			for (auto sequence_number = _next_sequence_number; sequence_number < _contiguous_sequence_number; sequence_number++)
+			{
+				auto &slot = GetSlot(sequence_number);
+
+				// The packets of the other timestamp are the remnant of a lost frame or the padding for BWE
+				if (slot._packet->Timestamp() == marker_packet->Timestamp())
+				{
+					packets.push_back(std::move(slot._packet));
+				}
+				else
+				{
+					logtd("Packet discarded (It may be PADDING for BWE) - seq(%u) timestamp(%u)", slot._packet->SequenceNumber(), slot._packet->Timestamp());
+					slot._packet = nullptr;
+				}
+
+				SetReceived(sequence_number, false);
+			}
+
+			logtd("Frame completed: timestamp(%u) packets(%zu)", marker_packet->Timestamp(), packets.size());
+
+			_completed_frames.push_back(std::make_shared<RtpFrame>(marker_packet->Timestamp(), std::move(packets)));
+			_next_sequence_number = _contiguous_sequence_number;
+		}
 
-	if (it == _rtp_frames.end())
-	{
-		logtd("Create frame buffer for timestamp %llu", timestamp);
-		// First packet of frame
-		frame = std::make_shared<RtpFrame>();
-		_rtp_frames[timestamp] = frame;
-	}
-	else
-	{
-		frame = it->second;
-	}
+		if (_contiguous_sequence_number > _highest_sequence_number)
+		{
+			// No packet is lost
+			_stalled_time_ms = 0;
+			return;
+		}
 
-	frame->InsertPacket(packet);
+		// A packet is lost, the stall time is measured from when the assembling stopped
+		auto now_ms = ov::Clock::NowMSec();
+		if (advanced || _stalled_time_ms == 0)
+		{
+			_stalled_time_ms = now_ms;
+			return;
+		}
 
-	return true;
+		if (now_ms - _stalled_time_ms <= _max_buffering_time_ms)
+		{
+			// Wait for the lost packet (reordered or retransmitted)
+			return;
+		}
+
+		logtd("Frame assembling is stalled for %" PRIu64 " ms, the frame is given up - seq(%u)", now_ms - _stalled_time_ms, static_cast<uint16_t>(_contiguous_sequence_number));
+
+		SkipIncompleteFrame();
+		_stalled_time_ms = 0;
+		// The next frames cannot be decoded without the frame
+		_keyframe_request_needed = true;
+	}
 }
 
-void RtpFrameJitterBuffer::BurnOutExpiredFrames()
+void RtpFrameJitterBuffer::DiscardPackets(int64_t sequence_number)
 {
-	// If there are completed frames among the frames, all previous frames are deleted.
+	auto last_sequence_number = std::min(sequence_number, _highest_sequence_number + 1);
 
-	// Find first completed frame
-	auto completed_frame_it = _rtp_frames.begin();
-	while (completed_frame_it != _rtp_frames.end())
+	for (auto discard_sequence_number = _next_sequence_number; discard_sequence_number < last_sequence_number; discard_sequence_number++)
 	{
-		auto frame = completed_frame_it->second;
-		if (frame->IsCompleted())
+		if (IsReceived(discard_sequence_number))
 		{
-			break;
+			GetSlot(discard_sequence_number)._packet = nullptr;
+			SetReceived(discard_sequence_number, false);
 		}
-		++completed_frame_it;
 	}
 
-	if (completed_frame_it == _rtp_frames.begin() || completed_frame_it == _rtp_frames.end())
-	{
-		// No burn outted frame and completed frame
-		return;
-	}
+	_next_sequence_number = std::max(_next_sequence_number, sequence_number);
+	_contiguous_sequence_number = std::max(_contiguous_sequence_number, _next_sequence_number);
+	_highest_sequence_number = std::max(_highest_sequence_number, _next_sequence_number - 1);
+}
 
-	// Delete from begin to completed frame (not included)
-	auto it = _rtp_frames.begin();
-	while (it != completed_frame_it)
+void RtpFrameJitterBuffer::SkipIncompleteFrame()
+{
+	// The next frame starts after the first marked packet
+	for (auto sequence_number = _contiguous_sequence_number; sequence_number <= _highest_sequence_number; sequence_number++)
 	{
-		auto frame = it->second;
-		logtd("Frame discarded (It may be PADDING frame for BWE) - timestamp(%u) packets(%d) marked(%s)", frame->Timestamp(), frame->PacketCount(), frame->IsMarked() ? "true" : "false");
-		it = _rtp_frames.erase(it);
+		if (IsReceived(sequence_number) && GetSlot(sequence_number)._packet->Marker())
+		{
+			DiscardPackets(sequence_number + 1);
+			return;
+		}
 	}
+
+	// The end of the frame is not received yet, so all packets are given up
+	DiscardPackets(_highest_sequence_number + 1);
 }
 
 bool RtpFrameJitterBuffer::HasAvailableFrame()
 {
-	BurnOutExpiredFrames();
+	return _completed_frames.empty() == false;
+}
 
-	auto it = _rtp_frames.begin();
-	if (it == _rtp_frames.end())
+std::shared_ptr<RtpFrame> RtpFrameJitterBuffer::PopAvailableFrame()
+{
+	if (HasAvailableFrame() == false)
 	{
-		return false;
+		return nullptr;
 	}
 
-	auto first_frame = it->second;
-	return first_frame->IsCompleted();
+	auto frame = _completed_frames.front();
+	_completed_frames.pop_front();
+
+	logtd("Pop frame - timestamp(%u) packets(%zu) frames(%zu)", frame->Timestamp(), frame->PacketCount(), _completed_frames.size());
+
+	return frame;
 }
 
-std::shared_ptr<RtpFrame> RtpFrameJitterBuffer::PopAvailableFrame()
+std::vector<uint16_t> RtpFrameJitterBuffer::GetNackList()
 {
-	if (HasAvailableFrame() == false)
+	std::vector<uint16_t> nack_list;
+
+	if (_nack_enabled == false || _contiguous_sequence_number > _highest_sequence_number)
 	{
-		return nullptr;
+		return nack_list;
 	}
 
-	auto it = _rtp_frames.begin();
-	auto frame = it->second;
+	auto now_ms = ov::Clock::NowMSec();
+	size_t lost_count = 0;
 
-	logtd("Pop frame - extended(%llu) timestamp(%u) packets(%d) frames(%u)", it->first, frame->Timestamp(), frame->PacketCount(), _rtp_frames.size());
+	// The highest one is always received
+	for (auto sequence_number = _contiguous_sequence_number; sequence_number < _highest_sequence_number; sequence_number++)
+	{
+		if (IsReceived(sequence_number))
+		{
+			continue;
+		}
 
-	// remove front frame
-	_rtp_frames.erase(it);
+		if (++lost_count > RTP_FRAME_JITTER_BUFFER_MAX_NACK_PACKETS)
+		{
+			// Retransmitting so many packets takes longer than a key frame
+			_keyframe_request_needed = true;
+			nack_list.clear();
+			break;
+		}
 
-	return frame;
-}
\ No newline at end of file
+		auto &slot = GetSlot(sequence_number);
+		if (slot._sequence_number != sequence_number)
+		{
+			slot._sequence_number = sequence_number;
+			slot._packet = nullptr;
+			slot._nack_time_ms = 0;
+			slot._nack_count = 0;
+		}
+
+		if (slot._nack_count >= RTP_FRAME_JITTER_BUFFER_MAX_NACK_COUNT ||
+			(slot._nack_count > 0 && now_ms - slot._nack_time_ms < RTP_FRAME_JITTER_BUFFER_NACK_INTERVAL_MS))
+		{
+			continue;
+		}
+
+		slot._nack_count++;
+		slot._nack_time_ms = now_ms;
+
+		nack_list.push_back(static_cast<uint16_t>(sequence_number));
+	}
+
+	return nack_list;
+}
+
+bool RtpFrameJitterBuffer::IsKeyframeRequestNeeded()
+{
+	auto needed = _keyframe_request_needed;
+	_keyframe_request_needed = false;
+
+	return needed;
+}
@@ -2,65 +2,105 @@
 
 #include "base/ovlibrary/ovlibrary.h"
 #include "rtp_packet.h"
-#include <unordered_map>
 
-#define DEFAULT_VIDEO_MAX_BUFFERING_TIME_MS	100	 // 500ms
+// The number of packets the buffer can hold (must be a power of 2).
+// It should be larger than the largest frame (e.g. a key frame of screen sharing) plus the reordering.
+#define RTP_FRAME_JITTER_BUFFER_SLOT_COUNT	4096
+// If the oldest frame cannot be completed within this time after a packet is lost, it is given up
+#define DEFAULT_VIDEO_MAX_BUFFERING_TIME_MS	100
+// With NACK, the lost packet is waited longer for the retransmission
+#define RTP_FRAME_JITTER_BUFFER_NACK_MAX_BUFFERING_TIME_MS	500
+// A lost packet is requested again with NACK after this time, up to RTP_FRAME_JITTER_BUFFER_MAX_NACK_COUNT times
+#define RTP_FRAME_JITTER_BUFFER_NACK_INTERVAL_MS	100
+#define RTP_FRAME_JITTER_BUFFER_MAX_NACK_COUNT	5
+// If more packets than this are lost, a key frame is requested instead of NACK
+#define RTP_FRAME_JITTER_BUFFER_MAX_NACK_PACKETS	256
 
-// RTP Packet Group by Frame
+// RTP Packet Group by Frame (the packets are in the order of the sequence number)
 class RtpFrame
 {
 public:
-	RtpFrame();
-	bool InsertPacket(const std::shared_ptr<RtpPacket> &packet);
-	bool IsCompleted();
-	bool IsMarked();
-	uint64_t GetElapsed();
+	RtpFrame(uint32_t timestamp, std::vector<std::shared_ptr<RtpPacket>> packets);
 
 	std::shared_ptr<RtpPacket> GetFirstRtpPacket();
 	std::shared_ptr<RtpPacket> GetNextRtpPacket();
+	const std::vector<std::shared_ptr<RtpPacket>> &GetPackets() const;
 
 	uint32_t Timestamp(){return _timestamp;}
 	size_t PacketCount(){return _packets.size();}
 
 private:
-	bool CheckCompleted();
-	uint32_t GetExtendedSequenceNumber(uint16_t sequence_number);
-
-	ov::StopWatch _stop_watch;
-
 	uint32_t	_timestamp = 0;
-	
-	uint32_t	_curr_sequence_number = 0;
-	uint32_t	_first_sequence_number = 0;
-	uint32_t	_marker_sequence_number = 0;
-	bool		_marked = false;
-	bool		_completed = false;
-
-	uint16_t 	_last_sequence_number = 0;
-	uint32_t	_timestamp_cycle = 0;
-
-	// sequence number : RtpPacket
-	std::unordered_map<uint32_t, std::shared_ptr<RtpPacket>> _packets;
+	size_t		_curr_index = 0;
+
+	std::vector<std::shared_ptr<RtpPacket>> _packets;
 };
 
 // A jitter buffer for a media stream in the form that the frame is fragmented
 // and the rtp marker bit indicates that it is the last fragment.
+//
+// The packets are stored in a ring indexed by the sequence number, and a bitmap of the received packets is kept with it.
+// A frame is completed when all packets from the next expected sequence number to the marked packet are received,
+// so inserting a packet is O(1) regardless of the frame size. The gaps of the bitmap are the lost packets to request with NACK.
 class RtpFrameJitterBuffer
 {
 public:
+	RtpFrameJitterBuffer();
+
+	// The lost packets are tracked for NACK, and they are waited longer
+	void EnableNack(bool enabled);
+
 	bool InsertPacket(const std::shared_ptr<RtpPacket> &packet);
 	bool HasAvailableFrame();
 	std::shared_ptr<RtpFrame> PopAvailableFrame();
-	
-private:	
-	void BurnOutExpiredFrames();
 
-	uint64_t GetExtentedTimestamp(uint32_t timestamp);
+	// Returns the sequence numbers of the lost packets that should be requested with NACK now
+	std::vector<uint16_t> GetNackList();
+	// Returns true once if a frame was given up (or too many packets were lost) after the last call,
+	// so the decoder needs a key frame
+	bool IsKeyframeRequestNeeded();
+
+private:
+	struct Slot
+	{
+		// The extended sequence number which the slot is used for
+		int64_t _sequence_number = -1;
+		std::shared_ptr<RtpPacket> _packet = nullptr;
+
+		// For NACK of the lost packet
+		uint64_t _nack_time_ms = 0;
+		uint8_t _nack_count = 0;
+	};
+
+	int64_t GetExtendedSequenceNumber(uint16_t sequence_number);
+
+	Slot &GetSlot(int64_t sequence_number);
+	bool IsReceived(int64_t sequence_number) const;
+	void SetReceived(int64_t sequence_number, bool received);
+
+	// Completes the frames from the contiguous packets
+	void AssembleFrames();
+	// Gives up the packets before <sequence_number>
+	void DiscardPackets(int64_t sequence_number);
+	// Gives up the incomplete oldest frame and moves to the next frame
+	void SkipIncompleteFrame();
 
-	uint32_t _last_timestamp = 0;
-	uint32_t _timestamp_cycle = 0;
+	bool _nack_enabled = false;
+	uint64_t _max_buffering_time_ms = DEFAULT_VIDEO_MAX_BUFFERING_TIME_MS;
 
-	// timestamp : RtpFrameInfo
-	// it should be ordered, so use std::map
-	std::map<uint64_t, std::shared_ptr<RtpFrame>> _rtp_frames;
-};
\ No newline at end of file
+	std::vector<Slot> _slots;
+	std::vector<uint64_t> _received_bitmap;
+
+	bool _initialized = false;
+	int64_t _highest_sequence_number = 0;
+	// The first packet of the next frame to pop
+	int64_t _next_sequence_number = 0;
+	// The first packet not received since _next_sequence_number
+	int64_t _contiguous_sequence_number = 0;
+
+	// The time since the assembling is stalled by a lost packet (0: not stalled)
+	uint64_t _stalled_time_ms = 0;
+	bool _keyframe_request_needed = false;
+
+	std::deque<std::shared_ptr<RtpFrame>> _completed_frames;
+};
@@ -0,0 +1,16 @@
+#pragma once
+
+// urn:ietf:params:rtp-hdrext:sdes:mid (RFC 8843)
+// urn:ietf:params:rtp-hdrext:sdes:rtp-stream-id (RFC 8852)
+
+//    0                   1                   2                   3
+//    0 1 2 3 4 5 6 7 8 9 0 1 2 3 4 5 6 7 8 9 0 1 2 3 4 5 6 7 8 9 0 1
+//   +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+//   |  ID   |  len  | SDES item text value ...                      |
+//   +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+
+// These are only received (from the WebRTC publishers), and their ids are negotiated by the offer of the peer,
+// so the value is read from the packet directly (See RtpPacket::GetExtensionView())
+
+#define RTP_HEADER_EXTENSION_MID_ATTRIBUTE "urn:ietf:params:rtp-hdrext:sdes:mid"
+#define RTP_HEADER_EXTENSION_RID_ATTRIBUTE "urn:ietf:params:rtp-hdrext:sdes:rtp-stream-id"
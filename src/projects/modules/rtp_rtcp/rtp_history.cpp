@@ -5,63 +5,74 @@ RtpHistory::RtpHistory(uint8_t origin_payload_type, uint8_t rtx_payload_type, ui
 	_origin_paylod_type = origin_payload_type;
 	_rtx_paylod_type = rtx_payload_type;
 	_rtx_ssrc = rtx_ssrc;
-	_max_history_size = max_history_size;
 
-	_history.reserve(_max_history_size);
+	// The sequence number is 16 bits, so the ring doesn't need to be larger than 65536
+	uint32_t ring_size = 1;
+	while (ring_size < max_history_size && ring_size < 0x10000)
+	{
+		ring_size <<= 1;
+	}
+
+	_history.resize(ring_size);
+	_index_mask = static_cast<uint16_t>(ring_size - 1);
 }
 
-// Converting to RtxRtpPacket
-bool RtpHistory::StoreRtpPacket(const std::shared_ptr<RtpPacket> &packet)
+RtpHistory::~RtpHistory()
 {
-	std::lock_guard<std::shared_mutex> guard(_history_lock);
-
-	_history[GetIndex(packet->SequenceNumber())] = packet;
+	if (_memory_metrics != nullptr)
+	{
+		_memory_metrics->Add(mon::MemoryComponent::RtpHistory, -_stored_bytes.exchange(0));
+	}
+}
 
-	return true;
+void RtpHistory::SetMemoryMetrics(const std::shared_ptr<mon::MemoryMetrics> &memory_metrics)
+{
+	_memory_metrics = memory_metrics;
 }
 
-std::shared_ptr<RtxRtpPacket> RtpHistory::GetRtxRtpPacket(uint16_t seq_no)
+bool RtpHistory::StoreRtpPacket(const std::shared_ptr<RtpPacket> &packet)
 {
-	auto index = GetIndex(seq_no);
-	// First, look in the cache
-	std::shared_lock<std::shared_mutex> cache_read_guard(_history_cache_lock);
-	auto cache_item = _history_cache.find(index);
-	if(cache_item != _history_cache.end())
+	auto old_packet = std::atomic_exchange(&_history[GetIndex(packet->SequenceNumber())], packet);
+
+	if (_memory_metrics != nullptr)
 	{
-		// Found!
-		auto rtx_packet = cache_item->second;
-		
-		if(rtx_packet->GetOriginalSequenceNumber() == seq_no)// && ov::Clock::GetElapsedMiliSecondsFromNow(rtx_packet->GetCreatedTime()) < VALID_TIME_MS_STORED_RTP_PACKET)
+		int64_t delta = static_cast<int64_t>(packet->GetData()->GetLength());
+		if (old_packet != nullptr)
 		{
-			return rtx_packet;
+			delta -= static_cast<int64_t>(old_packet->GetData()->GetLength());
 		}
+
+		_stored_bytes += delta;
+		_memory_metrics->Add(mon::MemoryComponent::RtpHistory, delta);
 	}
-	cache_read_guard.unlock();
 
-	// find in rtp history
-	std::shared_lock<std::shared_mutex> history_guard(_history_lock);
-	auto rtp_item = _history.find(index);
-	if(rtp_item != _history.end())
+	return true;
+}
+
+std::shared_ptr<const RtpPacket> RtpHistory::GetRtpPacket(uint16_t seq_no)
+{
+	auto rtp_packet = std::atomic_load(&_history[GetIndex(seq_no)]);
+
+	// now, I consider all requests are valid because webrtc player doesn't ask for too old packet anyway
+	//auto elapsed_ms = ov::Clock::GetElapsedMiliSecondsFromNow(rtp_packet->GetCreatedTime());
+	//if(elapsed_ms < VALID_TIME_MS_STORED_RTP_PACKET)
+	if (rtp_packet == nullptr || rtp_packet->SequenceNumber() != seq_no)
 	{
-		auto rtp_packet = rtp_item->second;
-		history_guard.unlock();
+		return nullptr;
+	}
 
-		// now, I consider all requests are valid because webrtc player doesn't ask for too old packet anyway 
-		//auto elapsed_ms = ov::Clock::GetElapsedMiliSecondsFromNow(rtp_packet->GetCreatedTime());
-		//if(elapsed_ms < VALID_TIME_MS_STORED_RTP_PACKET)
-		if(rtp_packet->SequenceNumber() == seq_no)
-		{
-			// Create Rtx Packet and store it
-			auto rtx_packet = std::make_shared<RtxRtpPacket>(GetRtxSsrc(), GetRtxPayloadType(), *rtp_packet);
+	return rtp_packet;
+}
 
-			std::lock_guard<std::shared_mutex> cache_write_guard(_history_cache_lock);
-			_history_cache[index] = rtx_packet;
-			
-			return rtx_packet;
-		}
+std::shared_ptr<RtxRtpPacket> RtpHistory::GetRtxRtpPacket(uint16_t seq_no)
+{
+	auto rtp_packet = GetRtpPacket(seq_no);
+	if (rtp_packet == nullptr)
+	{
+		return nullptr;
 	}
 
-	return nullptr;
+	return std::make_shared<RtxRtpPacket>(GetRtxSsrc(), GetRtxPayloadType(), *rtp_packet);
 }
 
 uint8_t	RtpHistory::GetOriginPayloadType()
@@ -81,5 +92,5 @@ uint8_t RtpHistory::GetRtxPayloadType()
 
 uint16_t RtpHistory::GetIndex(uint16_t seq_no)
 {
-	return seq_no % _max_history_size;
-}
\ No newline at end of file
+	return seq_no & _index_mask;
+}
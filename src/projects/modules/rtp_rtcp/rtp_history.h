@@ -1,6 +1,8 @@
 #pragma once
 
 #include <base/ovlibrary/ovlibrary.h>
+#include <monitoring/memory_metrics.h>
+
 #include "rtx_rtp_packet.h"
 
 // WebRTC-Native-Code uses 9600 value
@@ -11,10 +13,17 @@
 class RtpHistory
 {
 public:
+	// max_history_size is rounded up to the power of two
 	RtpHistory(uint8_t origin_payload_type, uint8_t rtx_payload_type, uint32_t rtx_ssrc, uint32_t max_history_size = DEFAULT_MAX_HISTORY_CAPACITY);
+	~RtpHistory();
+
+	// The bytes of the stored packets are reported to <memory_metrics> (must be called before the packets are stored)
+	void SetMemoryMetrics(const std::shared_ptr<mon::MemoryMetrics> &memory_metrics);
 
-	// Converting to RtxRtpPacket
 	bool StoreRtpPacket(const std::shared_ptr<RtpPacket> &packet);
+	std::shared_ptr<const RtpPacket> GetRtpPacket(uint16_t seq_no);
+	// Converting to RtxRtpPacket
+	// A new packet is created for each call, so the caller can modify it (e.g. sequence number of the session)
 	std::shared_ptr<RtxRtpPacket> GetRtxRtpPacket(uint16_t seq_no);
 
 	uint8_t	GetOriginPayloadType();
@@ -23,30 +32,27 @@ public:
 
 private:
 	uint16_t GetIndex(uint16_t seq_no);
-	
-	// This map maps a hash(made with "origin sequence number" % max_history_size) and an RtpPacket.
-	// And this map never erases items for performance reason. 
-
-	// Yes, this map will have a collision once per max_history_size. 
-	// However, the default value of 9600 is a very large value, and collision packets 
-	// with 9600 sequence number differences are very old packets. 
-	// Since RTP packets have a creation time, old packets may not be used. 
-	// This can avoid collision. Therefore, set max_history_size to a large value as possible.
-	std::shared_mutex	_history_lock;
-	std::unordered_map<uint16_t, std::shared_ptr<RtpPacket>> _history;
+
+	// This ring is indexed with "origin sequence number" & (size - 1) and never erases items for performance reason.
+	// The slots are preallocated and published with the atomic operations, so storing a packet doesn't take a lock
+	// or hash the sequence number, and it never blocks the readers (NACK).
+
+	// Yes, a slot is overwritten once per ring size.
+	// However, collision packets with the sequence number differences of the ring size are very old packets,
+	// and the sequence number of the stored packet is compared when it is read.
+	// Therefore, set max_history_size to a large value as possible.
+	std::vector<std::shared_ptr<RtpPacket>> _history;
+	uint16_t	_index_mask;
+
+	std::shared_ptr<mon::MemoryMetrics> _memory_metrics;
+	// Bytes of the packets in the ring
+	std::atomic<int64_t> _stored_bytes = 0;
 
 	// Creating RtxRtpPacket requires computing resources, but not all of them are used
-	// (only for packets requested by the session with NACK). 
-	// Therefore, it is unnecessary to create all packets with RtxRtpPacket in advance. 
-	// It is also wasteful to create another RtxRtpPacket once created. 
-	// When GetRtxRtpPacket() is called, it first looks for a packet in the cache and 
-	// checks if it is valid (by creation time). 
-	// If it is not valid, a new RtxRtpPacket is created, cached, and returned.
-	std::shared_mutex	_history_cache_lock;
-	std::unordered_map<uint16_t, std::shared_ptr<RtxRtpPacket>> _history_cache;
+	// (only for packets requested by the session with NACK).
+	// Therefore, RtxRtpPacket is created on demand, and the session sends it after setting its own sequence number.
 
 	uint8_t		_origin_paylod_type;
 	uint32_t	_rtx_ssrc;
 	uint8_t		_rtx_paylod_type;
-	uint32_t	_max_history_size;
-};
\ No newline at end of file
+};
@@ -2,80 +2,127 @@
 
 #define OV_LOG_TAG "RtpVideoJitterBuffer"
 
+static_assert((RTP_MINIMAL_JITTER_BUFFER_SLOT_COUNT & (RTP_MINIMAL_JITTER_BUFFER_SLOT_COUNT - 1)) == 0, "The slot count must be a power of 2");
+
+#define SLOT_INDEX(sequence_number) (static_cast<size_t>(sequence_number) & (RTP_MINIMAL_JITTER_BUFFER_SLOT_COUNT - 1))
+
+RtpMinimalJitterBuffer::RtpMinimalJitterBuffer()
+	: _rtp_packets(RTP_MINIMAL_JITTER_BUFFER_SLOT_COUNT)
+{
+}
+
+int64_t RtpMinimalJitterBuffer::GetExtendedSequenceNumber(uint16_t sequence_number)
+{
+	if (_initialized == false)
+	{
+		// It starts from the second cycle, so the packets reordered before the first packet are not negative
+		_initialized = true;
+		_highest_sequence_number = (1 << 16) | sequence_number;
+		_next_sequence_number = _highest_sequence_number;
+
+		return _highest_sequence_number;
+	}
+
+	// The nearest one to the highest sequence number (considering the roll over)
+	auto delta = static_cast<int16_t>(sequence_number - static_cast<uint16_t>(_highest_sequence_number));
+
+	return _highest_sequence_number + delta;
+}
+
 bool RtpMinimalJitterBuffer::InsertPacket(const std::shared_ptr<RtpPacket> &packet)
 {
+	auto sequence_number = GetExtendedSequenceNumber(packet->SequenceNumber());
+
 	// Already it determined this packet was lost
-	if(packet->SequenceNumber() < _next_sequence_number)
+	if(sequence_number < _next_sequence_number)
 	{
 		return false;
 	}
 
-	_rtp_packets.emplace(packet->SequenceNumber(), std::make_shared<RtpPacketBox>(ov::Clock::NowMSec(), packet));
-	return true;
-}
+	if(sequence_number - _next_sequence_number >= RTP_MINIMAL_JITTER_BUFFER_SLOT_COUNT)
+	{
+		// The buffer is full, so the oldest packets are given up
+		DiscardPackets(sequence_number - RTP_MINIMAL_JITTER_BUFFER_SLOT_COUNT + 1);
+	}
 
-bool RtpMinimalJitterBuffer::HasAvailablePacket()
-{
-	if(_rtp_packets.size() <= 0)
+	auto &box = _rtp_packets[SLOT_INDEX(sequence_number)];
+	if(box._packet != nullptr)
 	{
+		// Duplicated packet
 		return false;
 	}
 
+	box._sequence_number = sequence_number;
+	box._packaging_time_ms = ov::Clock::NowMSec();
+	box._packet = packet;
+	_packet_count++;
+
+	_highest_sequence_number = std::max(_highest_sequence_number, sequence_number);
+
 	return true;
 }
 
-std::shared_ptr<RtpPacket> RtpMinimalJitterBuffer::PopAvailablePacket()
+void RtpMinimalJitterBuffer::DiscardPackets(int64_t sequence_number)
 {
-	std::shared_ptr<RtpPacketBox> packet_box = nullptr;
+	auto last_sequence_number = std::min(sequence_number, _highest_sequence_number + 1);
 
-	// First packet
-	if(_next_sequence_number == 0)
+	for(auto discard_sequence_number = _next_sequence_number; discard_sequence_number < last_sequence_number; discard_sequence_number++)
 	{
-		auto it = _rtp_packets.begin();
-		if(it == _rtp_packets.end())
+		auto &box = _rtp_packets[SLOT_INDEX(discard_sequence_number)];
+		if(box._packet != nullptr)
 		{
-			return nullptr;
+			box._packet = nullptr;
+			_packet_count--;
 		}
-		packet_box = it->second;
-		_rtp_packets.erase(it);
 	}
-	else
+
+	_next_sequence_number = std::max(_next_sequence_number, sequence_number);
+	_highest_sequence_number = std::max(_highest_sequence_number, _next_sequence_number - 1);
+}
+
+bool RtpMinimalJitterBuffer::HasAvailablePacket()
+{
+	return _packet_count > 0;
+}
+
+std::shared_ptr<RtpPacket> RtpMinimalJitterBuffer::PopAvailablePacket()
+{
+	if(_packet_count == 0)
+	{
+		return nullptr;
+	}
+
+	auto box = &_rtp_packets[SLOT_INDEX(_next_sequence_number)];
+
+	// There is no next packet
+	if(box->_packet == nullptr)
 	{
-		auto it = _rtp_packets.find(_next_sequence_number);
-		// There is no next packet
-		if(it == _rtp_packets.end())
+		// Find the first packet in the buffer
+		auto sequence_number = _next_sequence_number + 1;
+		while(_rtp_packets[SLOT_INDEX(sequence_number)]._packet == nullptr)
 		{
-			// Check the first packet in the buffer
-			auto front_it = _rtp_packets.begin();
-			if(front_it == _rtp_packets.end())
-			{
-				return nullptr;
-			}
-
-			// Check the time spent in the buffer
-			packet_box = front_it->second;
-			
-			// If next of next packet is Available and wait for 1/2 buffering time in buffer
-			if(ov::Clock::NowMSec() - packet_box->_packaging_time_ms > _max_buffering_time_ms / 2)
-			{
-				// It is determined that the next packet is lost.
-				_rtp_packets.erase(front_it);
-			}
-			// Wait a little more 
-			else
-			{
-				return nullptr;
-			}
+			sequence_number++;
 		}
+
+		box = &_rtp_packets[SLOT_INDEX(sequence_number)];
+
+		// If next of next packet is Available and wait for 1/2 buffering time in buffer
+		if(ov::Clock::NowMSec() - box->_packaging_time_ms > _max_buffering_time_ms / 2)
+		{
+			// It is determined that the next packet is lost.
+			_next_sequence_number = sequence_number;
+		}
+		// Wait a little more 
 		else
 		{
-			// There is a next packet
-			packet_box = it->second;
-			_rtp_packets.erase(it);
+			return nullptr;
 		}
 	}
 
-	auto packet = packet_box->_packet;
-	_next_sequence_number = packet->SequenceNumber() + 1;
+	auto packet = std::move(box->_packet);
+	box->_packet = nullptr;
+	_packet_count--;
+	_next_sequence_number++;
+
 	return packet;
-}
\ No newline at end of file
+}
@@ -2,35 +2,41 @@
 
 #include "base/ovlibrary/ovlibrary.h"
 #include "rtp_packet.h"
-#include <unordered_map>
 
 #define DEFAULT_AUDIO_MAX_BUFFERING_TIME_MS	200
+// The number of packets the buffer can hold (must be a power of 2)
+#define RTP_MINIMAL_JITTER_BUFFER_SLOT_COUNT	256
 
 // It only corrects unordered packet for rfc3551
+// The packets are stored in a ring indexed by the sequence number.
 class RtpMinimalJitterBuffer
 {
 public:
+	RtpMinimalJitterBuffer();
+
 	bool InsertPacket(const std::shared_ptr<RtpPacket> &packet);
 	bool HasAvailablePacket();
 	std::shared_ptr<RtpPacket> PopAvailablePacket();
 	
 private:
-	uint16_t _next_sequence_number = 0;
+	int64_t GetExtendedSequenceNumber(uint16_t sequence_number);
+	// Gives up the packets before <sequence_number>
+	void DiscardPackets(int64_t sequence_number);
+
 	uint32_t _max_buffering_time_ms = DEFAULT_AUDIO_MAX_BUFFERING_TIME_MS;
 
 	struct RtpPacketBox
 	{
-		RtpPacketBox(uint64_t packaging_time_ms, std::shared_ptr<RtpPacket> packet)
-		{
-			_packaging_time_ms = packaging_time_ms;
-			_packet = packet;
-		}
-
+		// The extended sequence number of the packet
+		int64_t _sequence_number = -1;
 		uint64_t _packaging_time_ms = 0;
 		std::shared_ptr<RtpPacket> _packet = nullptr;
 	};
 
-	// sequence number : RtpFrameInfo
-	// it should be ordered, so use std::map
-	std::map<uint16_t, std::shared_ptr<RtpPacketBox>> _rtp_packets;
-};
\ No newline at end of file
+	std::vector<RtpPacketBox> _rtp_packets;
+	size_t _packet_count = 0;
+
+	bool _initialized = false;
+	int64_t _highest_sequence_number = 0;
+	int64_t _next_sequence_number = 0;
+};
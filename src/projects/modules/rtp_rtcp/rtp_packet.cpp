@@ -16,6 +16,7 @@ RtpPacket::RtpPacket()
 	_extension_size = 0;
 
 	_data = std::make_shared<ov::Data>(RTP_DEFAULT_MAX_PACKET_SIZE);
+	_data->ReserveHeadroom(RTP_PACKET_HEADROOM);
 	_data->SetLength(FIXED_HEADER_SIZE);
 	_buffer = _data->GetWritableDataAs<uint8_t>();
 
@@ -45,8 +46,9 @@ RtpPacket::RtpPacket(const RtpPacket &src)
 	_sequence_number = src._sequence_number;
 	_timestamp = src._timestamp;
 	_extension_size = src._extension_size;
-	_extensions = src._extensions;
-	_extension_buffer_offset = src._extension_buffer_offset;
+	_extension_elements = src._extension_elements;
+	_extension_count = src._extension_count;
+	_extension_id_table = src._extension_id_table;
 	_extension_type = src._extension_type;
 	_data = src._data->Clone();
 	_buffer = _data->GetWritableDataAs<uint8_t>();
@@ -56,6 +58,7 @@ RtpPacket::RtpPacket(const RtpPacket &src)
 	_ntp_timestamp = src._ntp_timestamp;
 	_is_keyframe = src._is_keyframe;
 	_is_first_packet_of_frame = src._is_first_packet_of_frame;
+	_temporal_layer_id = src._temporal_layer_id;
 	_is_video_packet = src._is_video_packet;
 	_rtsp_channel = src._rtsp_channel;
 	_created_time = std::chrono::system_clock::now();
@@ -131,6 +134,7 @@ bool RtpPacket::Parse(const std::shared_ptr<const ov::Data> &data)
 	}
 
 	_extension_size = 0;
+	ClearExtensionElements();
 	if(_has_extension)
 	{
 		/*
@@ -161,6 +165,7 @@ bool RtpPacket::Parse(const std::shared_ptr<const ov::Data> &data)
 		}
 
 		_payload_offset = extension_offset + _extension_size;
+		_extension_type = (extension_profile == ONE_BYTE_EXTENSION_ID) ? RtpHeaderExtension::HeaderType::ONE_BYTE_HEADER : RtpHeaderExtension::HeaderType::TWO_BYTE_HEADER;
 
 		while(extension_offset < _payload_offset)
 		{
@@ -188,11 +193,22 @@ bool RtpPacket::Parse(const std::shared_ptr<const ov::Data> &data)
 			// Two Byte Header
 			else
 			{
+				if(extension_offset + 2 > _payload_offset)
+				{
+					return false;
+				}
+
 				id = buffer[extension_offset++];
 				len = buffer[extension_offset++];
 			}
 
-			_extensions.emplace(id, ov::Data(&buffer[extension_offset], len, true));
+			if(extension_offset + len > _payload_offset)
+			{
+				return false;
+			}
+
+			// Only the position is kept, the data is read from the buffer of the packet
+			AddExtensionElement(id, len, extension_offset);
 			extension_offset += len;
 		}
 	}
@@ -251,6 +267,21 @@ uint32_t RtpPacket::Ssrc() const
 {
 	return _ssrc;
 }
+uint8_t RtpPacket::CsrcCount() const
+{
+	return _buffer[0] & 0x0F;
+}
+
+uint32_t RtpPacket::Csrc(size_t index) const
+{
+	if (index >= CsrcCount())
+	{
+		return 0;
+	}
+
+	return ByteReader<uint32_t>::ReadBigEndian(&_buffer[FIXED_HEADER_SIZE + index * 4]);
+}
+
 std::vector<uint32_t> RtpPacket::Csrcs() const
 {
 	// Extract the value in the lower 4 bits of the first byte
@@ -265,20 +296,99 @@ std::vector<uint32_t> RtpPacket::Csrcs() const
 	return csrcs;
 }
 
+size_t RtpPacket::GetExtensionCount() const
+{
+	return _extension_count;
+}
+
+RtpHeaderExtensionView RtpPacket::GetExtensionViewAt(size_t index) const
+{
+	if (index >= _extension_count)
+	{
+		return {};
+	}
+
+	const auto &element = _extension_elements[index];
+
+	return {element.id, &_buffer[element.offset], element.length};
+}
+
+RtpHeaderExtensionView RtpPacket::GetExtensionView(uint8_t id) const
+{
+	auto element = FindExtensionElement(id);
+	if (element == nullptr)
+	{
+		return {};
+	}
+
+	return {element->id, &_buffer[element->offset], element->length};
+}
+
 std::map<uint8_t, ov::Data> RtpPacket::Extensions() const
 {
-	return _extensions;
+	std::map<uint8_t, ov::Data> extensions;
+
+	for (size_t index = 0; index < _extension_count; index++)
+	{
+		auto view = GetExtensionViewAt(index);
+		extensions.emplace(view.id, ov::Data(view.data, view.length));
+	}
+
+	return extensions;
 }
 
 std::optional<ov::Data>	RtpPacket::GetExtension(uint8_t id) const
 {
-	auto it = _extensions.find(id);
-	if(it == _extensions.end())
+	auto view = GetExtensionView(id);
+	if (view.IsValid() == false)
 	{
 		return {};
 	}
-	
-	return it->second;
+
+	return ov::Data(view.data, view.length);
+}
+
+void RtpPacket::ClearExtensionElements()
+{
+	_extension_count = 0;
+	_extension_id_table.fill(0);
+}
+
+void RtpPacket::AddExtensionElement(uint8_t id, uint8_t length, size_t offset)
+{
+	if (_extension_count >= RTP_MAX_EXTENSION_ELEMENTS)
+	{
+		return;
+	}
+
+	auto &element = _extension_elements[_extension_count++];
+	element.id = id;
+	element.length = length;
+	element.offset = static_cast<uint16_t>(offset);
+
+	if (id < RTP_EXTENSION_ID_TABLE_SIZE)
+	{
+		_extension_id_table[id] = _extension_count;
+	}
+}
+
+const RtpPacket::ExtensionElement *RtpPacket::FindExtensionElement(uint8_t id) const
+{
+	if (id < RTP_EXTENSION_ID_TABLE_SIZE)
+	{
+		auto index = _extension_id_table[id];
+		return (index == 0) ? nullptr : &_extension_elements[index - 1];
+	}
+
+	for (size_t index = 0; index < _extension_count; index++)
+	{
+		if (_extension_elements[index].id == id)
+		{
+			return &_extension_elements[index];
+		}
+	}
+
+	return nullptr;
 }
 
 uint8_t* RtpPacket::Buffer() const
@@ -362,8 +472,6 @@ void RtpPacket::SetCsrcs(const std::vector<uint32_t>& csrcs)
 
 void RtpPacket::SetExtensions(const RtpHeaderExtensions& extensions)
 {
-	// TODO(Getroot) : Add item to _extensions
-
 	auto extension_length = extensions.GetTotalDataLength();
 	auto pad_length = (4 - (extension_length % 4)) % 4;
 
@@ -400,13 +508,15 @@ void RtpPacket::SetExtensions(const RtpHeaderExtensions& extensions)
 	offset += 2;
 
 	// Write Extensions
-	auto extensions_map = extensions.GetMap();
-	for(const auto [id, extension] : extensions_map)
-	{
-		_extension_buffer_offset[id] = offset;
+	auto header_length = (_extension_type == RtpHeaderExtension::HeaderType::ONE_BYTE_HEADER) ? 1 : 2;
 
+	ClearExtensionElements();
+	for(const auto &[id, extension] : extensions.GetMap())
+	{
 		auto extension_data = extension->Marshal(extensions.GetHeaderType());
 		memcpy(&_buffer[offset], extension_data->GetData(), extension_data->GetLength());
+
+		AddExtensionElement(id, extension_data->GetLength() - header_length, offset + header_length);
 		offset += extension_data->GetLength();
 	}
 
@@ -469,6 +579,35 @@ uint8_t* RtpPacket::AllocatePayload(size_t size_bytes)
 	return SetPayloadSize(size_bytes);
 }
 
+uint8_t* RtpPacket::InsertAfterHeader(size_t length)
+{
+	auto header_size = _payload_offset;
+
+	if (_data->GetHeadroom() >= length)
+	{
+		// Move the header to the front (the offsets of the extensions are not changed)
+		auto buffer = static_cast<uint8_t *>(_data->PrependSpace(length));
+		::memmove(buffer, buffer + length, header_size);
+	}
+	else
+	{
+		auto old_length = _data->GetLength();
+
+		if (_data->SetLength(old_length + length) == false)
+		{
+			return nullptr;
+		}
+
+		auto buffer = _data->GetWritableDataAs<uint8_t>();
+		::memmove(buffer + header_size + length, buffer + header_size, old_length - header_size);
+	}
+
+	_buffer = _data->GetWritableDataAs<uint8_t>();
+	_payload_offset += length;
+
+	return &_buffer[header_size];
+}
+
 uint8_t* RtpPacket::Header() const
 {
 	return &_buffer[0];
@@ -481,15 +620,16 @@ uint8_t* RtpPacket::Payload() const
 
 uint8_t* RtpPacket::Extension(uint8_t id) const
 { 
-	auto it = _extension_buffer_offset.find(id);
-	if (it == _extension_buffer_offset.end())
+	auto element = FindExtensionElement(id);
+	if (element == nullptr)
 	{
 		return nullptr;
 	}
 
-	auto offset = it->second;
+	// Points to the id/length header of the element
+	auto header_length = (_extension_type == RtpHeaderExtension::HeaderType::ONE_BYTE_HEADER) ? 1 : 2;
 
-	return &_buffer[offset];
+	return &_buffer[element->offset - header_length];
 }
 
 std::chrono::system_clock::time_point RtpPacket::GetCreatedTime()
@@ -1,8 +1,14 @@
 #pragma once
 
+#include <array>
 #include <vector>
 #include <memory>
 #include <base/ovlibrary/ovlibrary.h>
+#include "rtp_header_extension/rtp_header_extension_abs_send_time.h"
+#include "rtp_header_extension/rtp_header_extension_framemarking.h"
+#include "rtp_header_extension/rtp_header_extension_playout_delay.h"
+#include "rtp_header_extension/rtp_header_extension_sdes.h"
+#include "rtp_header_extension/rtp_header_extension_transport_cc.h"
 #include "rtp_header_extension/rtp_header_extensions.h"
 
 #define RTP_VERSION					2
@@ -11,6 +17,18 @@
 #define EXTENSION_HEADER_SIZE		4
 #define ONE_BYTE_EXTENSION_ID		0xBEDE
 #define RTP_DEFAULT_MAX_PACKET_SIZE	1472
+// Room in front of the header of a new packet, to add RED/RTX headers without moving the payload
+#define RTP_PACKET_HEADROOM			16
+// The number of the header extension elements that a packet can have (more elements are ignored)
+#define RTP_MAX_EXTENSION_ELEMENTS	16
+// The ids below this value are looked up directly in the table without searching
+#define RTP_EXTENSION_ID_TABLE_SIZE	15
+
+// The ids of the header extensions that OME uses are registered in the table at compile time
+static_assert(RTP_HEADER_EXTENSION_FRAMEMARKING_ID < RTP_EXTENSION_ID_TABLE_SIZE, "The framemarking extension id must be in the id table");
+static_assert(RTP_HEADER_EXTENSION_PLAYOUT_DELAY_ID < RTP_EXTENSION_ID_TABLE_SIZE, "The playout-delay extension id must be in the id table");
+static_assert(RTP_HEADER_EXTENSION_TRANSPORT_CC_ID < RTP_EXTENSION_ID_TABLE_SIZE, "The transport-cc extension id must be in the id table");
+static_assert(RTP_HEADER_EXTENSION_ABS_SEND_TIME_ID < RTP_EXTENSION_ID_TABLE_SIZE, "The abs-send-time extension id must be in the id table");
 
 //  0                   1                   2                   3
 //  0 1 2 3 4 5 6 7 8 9 0 1 2 3 4 5 6 7 8 9 0 1 2 3 4 5 6 7 8 9 0 1
@@ -35,6 +53,19 @@
 // |               padding         | Padding size  |
 // +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
 
+// A header extension element in the buffer of the packet, it is valid while the packet is alive
+struct RtpHeaderExtensionView
+{
+	uint8_t id = 0;
+	const uint8_t *data = nullptr;
+	size_t length = 0;
+
+	bool IsValid() const
+	{
+		return data != nullptr;
+	}
+};
+
 class RtpPacket
 {
 public:
@@ -55,6 +86,13 @@ public:
 	uint16_t	SequenceNumber() const;
 	uint32_t	Timestamp() const;
 	uint32_t	Ssrc() const;
+	uint8_t		CsrcCount() const;
+	uint32_t	Csrc(size_t index) const;
+	// Header extensions without allocation
+	size_t		GetExtensionCount() const;
+	RtpHeaderExtensionView GetExtensionViewAt(size_t index) const;
+	RtpHeaderExtensionView GetExtensionView(uint8_t id) const;
+	// These allocate, use the functions above in the packet path
 	std::vector<uint32_t> Csrcs() const;
 	std::map<uint8_t, ov::Data> Extensions() const;
 	std::optional<ov::Data>	GetExtension(uint8_t id) const;
@@ -111,6 +149,10 @@ public:
 	void		SetFirstPacketOfFrame(bool flag) {_is_first_packet_of_frame = flag;}
 	bool		IsFirstPacketOfFrame() const {return _is_first_packet_of_frame;}
 
+	// Temporal layer of the frame (0 if the frame is not scalable)
+	void		SetTemporalLayerId(uint8_t id) {_temporal_layer_id = id;}
+	uint8_t		GetTemporalLayerId() const {return _temporal_layer_id;}
+
 	void		SetRtspChannel(uint32_t rtsp_channel) {_rtsp_channel = rtsp_channel;}
 	uint32_t	GetRtspChannel() const {return _rtsp_channel;}
 
@@ -118,6 +160,22 @@ public:
 	RtpHeaderExtension::HeaderType GetExtensionType() const { return _extension_type; }
 
 protected:
+	struct ExtensionElement
+	{
+		uint8_t id = 0;
+		uint8_t length = 0;
+		// Offset of the data (after the id/length header) in the buffer
+		uint16_t offset = 0;
+	};
+
+	// Inserts <length> bytes between the header and the payload, and returns the pointer of the inserted bytes.
+	// The header is moved into the headroom if there is enough room, so the payload is not moved.
+	uint8_t*	InsertAfterHeader(size_t length);
+
+	void		ClearExtensionElements();
+	void		AddExtensionElement(uint8_t id, uint8_t length, size_t offset);
+	const ExtensionElement *FindExtensionElement(uint8_t id) const;
+
 	size_t		_payload_offset = 0;	// Payload Start Point (Header size)
 	bool		_has_padding = false;
 	bool		_has_extension = false;
@@ -132,11 +190,13 @@ protected:
 	uint32_t	_ssrc = 0;
 	size_t		_payload_size = 0;		// Payload Size
 	size_t		_extension_size;
-	std::map<uint8_t, ov::Data> _extensions;
 
-	// extension ID : data offset
-	RtpHeaderExtension::HeaderType _extension_type;
-	std::map<uint8_t, off_t> _extension_buffer_offset;
+	// Header extension elements in order of the buffer
+	RtpHeaderExtension::HeaderType _extension_type = RtpHeaderExtension::HeaderType::ONE_BYTE_HEADER;
+	std::array<ExtensionElement, RTP_MAX_EXTENSION_ELEMENTS> _extension_elements;
+	uint8_t		_extension_count = 0;
+	// extension ID : index of _extension_elements + 1 (0 means there is no element)
+	std::array<uint8_t, RTP_EXTENSION_ID_TABLE_SIZE> _extension_id_table = {};
 
 	bool		_is_available = false;
 
@@ -153,6 +213,7 @@ protected:
 	bool		_is_video_packet = false;
 	bool		_is_keyframe = false;
 	bool		_is_first_packet_of_frame = false;
+	uint8_t		_temporal_layer_id = 0;
 
 	uint32_t	_rtsp_channel = 0; // If it is from RTSP, _rtsp_channel is valid
 };
@@ -34,9 +34,15 @@ bool RtpPacketizer::SetCodec(cmn::MediaCodecId codec_type)
 		case cmn::MediaCodecId::Vp8:
 			SetVideoCodec(cmn::MediaCodecId::Vp8);
 			break;
+		case cmn::MediaCodecId::Vp9:
+			SetVideoCodec(cmn::MediaCodecId::Vp9);
+			break;
 		case cmn::MediaCodecId::H265:
 			SetVideoCodec(cmn::MediaCodecId::H265);
 			break;
+		case cmn::MediaCodecId::Av1:
+			SetVideoCodec(cmn::MediaCodecId::Av1);
+			break;
 		case cmn::MediaCodecId::Opus:
 			SetAudioCodec(cmn::MediaCodecId::Opus);
 			break;
@@ -207,6 +213,12 @@ bool RtpPacketizer::PacketizeVideo(cmn::MediaCodecId video_type,
 			_framemarking_extension->SetIndependentFrame();
 		}
 
+		if(video_header != nullptr && video_header->temporal_idx > 0)
+		{
+			packet->SetTemporalLayerId(video_header->temporal_idx);
+			_framemarking_extension->SetTemporalId(video_header->temporal_idx);
+		}
+
 		packet->SetNTPTimestamp(ntp_timestamp);
 		packet->SetTrackId(_track_id);
 		packet->SetExtensions(_rtp_extensions);
@@ -230,6 +242,84 @@ bool RtpPacketizer::PacketizeVideo(cmn::MediaCodecId video_type,
 	return true;
 }
 
+bool RtpPacketizer::Relay(FrameType frame_type,
+						  uint32_t rtp_timestamp,
+						  uint64_t ntp_timestamp,
+						  const std::vector<std::shared_ptr<const RtpPacket>> &origin_packets,
+						  uint8_t temporal_idx)
+{
+	if(_audio_configured || origin_packets.empty())
+	{
+		return false;
+	}
+
+	_frame_count ++;
+
+	for(size_t i = 0; i < origin_packets.size(); ++i)
+	{
+		auto &origin_packet = origin_packets[i];
+		bool last = (i + 1) == origin_packets.size();
+
+		auto packet = AllocatePacket();
+		packet->SetTimestamp(rtp_timestamp);
+
+		if(!AssignSequenceNumber(packet.get()))
+		{
+			return false;
+		}
+
+		packet->SetVideoPacket(true);
+
+		_framemarking_extension->Reset();
+
+		if(i == 0)
+		{
+			packet->SetFirstPacketOfFrame(true);
+			_framemarking_extension->SetStartOfFrame();
+		}
+		else if(last == true)
+		{
+			_framemarking_extension->SetEndOfFrame();
+		}
+
+		if(frame_type == FrameType::VideoFrameKey)
+		{
+			packet->SetKeyframe(true);
+			_framemarking_extension->SetIndependentFrame();
+		}
+
+		if(temporal_idx > 0)
+		{
+			packet->SetTemporalLayerId(temporal_idx);
+			_framemarking_extension->SetTemporalId(temporal_idx);
+		}
+
+		packet->SetNTPTimestamp(ntp_timestamp);
+		packet->SetTrackId(_track_id);
+		packet->SetExtensions(_rtp_extensions);
+
+		// The payload is copied as it is, so the packetization of the publisher is kept (e.g. FU-A, STAP-A, VP8 descriptor)
+		uint8_t *payload = packet->AllocatePayload(origin_packet->PayloadSize());
+		if(payload == nullptr)
+		{
+			return false;
+		}
+
+		::memcpy(payload, origin_packet->Payload(), origin_packet->PayloadSize());
+		packet->SetMarker(last);
+
+		_rtp_packet_count ++;
+		_stream->OnRtpPacketized(packet);
+
+		if(_ulpfec_enabled)
+		{
+			GenerateRedAndFecPackets(packet);
+		}
+	}
+
+	return true;
+}
+
 bool RtpPacketizer::GenerateRedAndFecPackets(std::shared_ptr<RtpPacket> packet)
 {
 	// Send RED
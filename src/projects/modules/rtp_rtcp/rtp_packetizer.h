@@ -39,6 +39,14 @@ public:
 	               const FragmentationHeader *fragmentation,
 	               const RTPVideoHeader *rtp_header);
 
+	// Sends the payloads of <origin_packets> (the RTP packets of a video frame received from a WebRTC publisher) as they are,
+	// with the SSRC, sequence number, timestamp and header extensions of this packetizer
+	bool Relay(FrameType frame_type,
+			   uint32_t rtp_timestamp,
+			   uint64_t ntp_timestamp,
+			   const std::vector<std::shared_ptr<const RtpPacket>> &origin_packets,
+			   uint8_t temporal_idx);
+
 private:
 	void SetVideoCodec(cmn::MediaCodecId codec_type);
 	void SetAudioCodec(cmn::MediaCodecId codec_type);
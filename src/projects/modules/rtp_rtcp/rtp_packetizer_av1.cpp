@@ -0,0 +1,204 @@
+#include "rtp_packetizer_av1.h"
+
+#define OV_LOG_TAG "RtpPacketizerAv1"
+
+RtpPacketizerAv1::RtpPacketizerAv1()
+{
+}
+
+RtpPacketizerAv1::~RtpPacketizerAv1()
+{
+}
+
+size_t RtpPacketizerAv1::SetPayloadData(size_t max_payload_len, size_t last_packet_reduction_len, const RTPVideoTypeHeader *rtp_type_header, FrameType frame_type,
+										const uint8_t *payload_data, size_t payload_size, const FragmentationHeader *fragmentation)
+{
+	_max_payload_len = max_payload_len;
+	_last_packet_reduction_len = last_packet_reduction_len;
+
+	_obu_list.clear();
+	_elements.clear();
+	_packets.clear();
+	_next_packet_index = 0;
+
+	if (AV1Parser::ParseObuList(payload_data, payload_size, _obu_list) == false)
+	{
+		logte("Could not parse the OBUs of the temporal unit");
+		return 0;
+	}
+
+	bool has_sequence_header = false;
+
+	for (const auto &obu : _obu_list)
+	{
+		switch (obu.type)
+		{
+			// The temporal delimiter, tile list and padding OBUs should be removed when transmitted (RTP Payload Format For AV1, 5)
+			case AV1ObuType::TemporalDelimiter:
+			case AV1ObuType::TileList:
+			case AV1ObuType::Padding:
+				continue;
+
+			case AV1ObuType::SequenceHeader:
+				has_sequence_header = true;
+				break;
+
+			default:
+				break;
+		}
+
+		ObuElement element;
+
+		::memcpy(element.header, obu.header, obu.header_length);
+		element.header[0] &= ~AV1_OBU_HAS_SIZE_FIELD_MASK;
+		element.header_length = obu.header_length;
+		element.payload = obu.payload;
+		element.payload_length = obu.payload_length;
+
+		_elements.push_back(element);
+	}
+
+	if (GeneratePackets() == false)
+	{
+		_packets.clear();
+		return 0;
+	}
+
+	_packets.front().new_sequence = (frame_type == FrameType::VideoFrameKey) && has_sequence_header;
+
+	return _packets.size();
+}
+
+bool RtpPacketizerAv1::GeneratePackets()
+{
+	if (_elements.empty())
+	{
+		return false;
+	}
+
+	size_t element_index = 0;
+	size_t offset = 0;
+
+	while (element_index < _elements.size())
+	{
+		Packet packet;
+		packet.first_continues = (offset > 0);
+
+		// Fill the packet with OBU elements as many as possible, and split the element that doesn't fit
+		while (element_index < _elements.size())
+		{
+			const auto &element = _elements[element_index];
+			bool is_last_element = (element_index + 1) == _elements.size();
+
+			size_t capacity = (_max_payload_len > packet.length) ? (_max_payload_len - packet.length) : 0;
+			size_t left = element.GetLength() - offset;
+			size_t required = AV1Parser::GetLeb128Size(left) + left;
+
+			if ((required + (is_last_element ? _last_packet_reduction_len : 0)) <= capacity)
+			{
+				packet.fragments.push_back({element_index, offset, left});
+				packet.length += required;
+
+				element_index++;
+				offset = 0;
+				continue;
+			}
+
+			if (capacity <= 1)
+			{
+				break;
+			}
+
+			size_t length = capacity - AV1Parser::GetLeb128Size(capacity);
+			if (length >= left)
+			{
+				// Only the last packet is reduced, so leave the rest of the element to the next packet
+				length = left - 1;
+			}
+
+			if (length == 0)
+			{
+				break;
+			}
+
+			packet.fragments.push_back({element_index, offset, length});
+			packet.length += AV1Parser::GetLeb128Size(length) + length;
+			packet.last_continues = true;
+
+			offset += length;
+			break;
+		}
+
+		if (packet.fragments.empty())
+		{
+			logte("The payload size is too small to packetize (max: %zu, reduction: %zu)", _max_payload_len, _last_packet_reduction_len);
+			return false;
+		}
+
+		_packets.push_back(std::move(packet));
+	}
+
+	return true;
+}
+
+void RtpPacketizerAv1::WriteFragment(const Fragment &fragment, uint8_t *buffer) const
+{
+	const auto &element = _elements[fragment.element_index];
+	size_t offset = fragment.offset;
+	size_t length = fragment.length;
+
+	if (offset < element.header_length)
+	{
+		size_t header_length = std::min(element.header_length - offset, length);
+
+		::memcpy(buffer, element.header + offset, header_length);
+		buffer += header_length;
+		length -= header_length;
+		offset = 0;
+	}
+	else
+	{
+		offset -= element.header_length;
+	}
+
+	if (length > 0)
+	{
+		::memcpy(buffer, element.payload + offset, length);
+	}
+}
+
+bool RtpPacketizerAv1::NextPacket(RtpPacket *rtp_packet)
+{
+	if (_next_packet_index >= _packets.size())
+	{
+		return false;
+	}
+
+	const auto &packet = _packets[_next_packet_index++];
+
+	uint8_t *buffer = rtp_packet->AllocatePayload(packet.length);
+	if (buffer == nullptr)
+	{
+		return false;
+	}
+
+	uint8_t aggregation_header = 0x00;
+	aggregation_header |= packet.first_continues ? AV1_AGGREGATION_HEADER_Z_BIT : 0x00;
+	aggregation_header |= packet.last_continues ? AV1_AGGREGATION_HEADER_Y_BIT : 0x00;
+	aggregation_header |= packet.new_sequence ? AV1_AGGREGATION_HEADER_N_BIT : 0x00;
+
+	size_t position = 0;
+	buffer[position++] = aggregation_header;
+
+	for (const auto &fragment : packet.fragments)
+	{
+		position += AV1Parser::WriteLeb128(fragment.length, buffer + position);
+		WriteFragment(fragment, buffer + position);
+		position += fragment.length;
+	}
+
+	// The marker bit is set for the last packet of the temporal unit
+	rtp_packet->SetMarker(_next_packet_index == _packets.size());
+
+	return true;
+}
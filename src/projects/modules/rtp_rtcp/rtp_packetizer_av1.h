@@ -0,0 +1,84 @@
+#pragma once
+
+#include "rtp_packet.h"
+#include "rtp_packetizing_manager.h"
+
+#include <modules/bitstream/av1/av1_parser.h>
+
+#include <vector>
+
+// RTP Payload Format For AV1 (v1.0), 4.4
+//
+//	 0 1 2 3 4 5 6 7
+//	+-+-+-+-+-+-+-+-+
+//	|Z|Y| W |N|-|-|-|
+//	+-+-+-+-+-+-+-+-+
+#define AV1_AGGREGATION_HEADER_SIZE		1
+
+#define AV1_AGGREGATION_HEADER_Z_BIT	0x80
+#define AV1_AGGREGATION_HEADER_Y_BIT	0x40
+#define AV1_AGGREGATION_HEADER_N_BIT	0x08
+
+// Packetizer for AV1.
+// The payload must be a temporal unit of the Low Overhead Bitstream Format (cmn::BitstreamFormat::AV1).
+// Every OBU element is written with the length field (W = 0), so the packets are filled up to the capacity.
+class RtpPacketizerAv1 : public RtpPacketizingManager
+{
+public:
+	RtpPacketizerAv1();
+	~RtpPacketizerAv1() override;
+
+	size_t SetPayloadData(size_t max_payload_len, size_t last_packet_reduction_len, const RTPVideoTypeHeader *rtp_type_header, FrameType frame_type,
+						  const uint8_t *payload_data, size_t payload_size, const FragmentationHeader *fragmentation) override;
+
+	bool NextPacket(RtpPacket *rtp_packet) override;
+
+private:
+	// An OBU element: obu_header() (obu_has_size_field is cleared) + the payload without obu_size
+	struct ObuElement
+	{
+		uint8_t header[AV1_OBU_HEADER_SIZE + AV1_OBU_EXTENSION_HEADER_SIZE];
+		size_t header_length = 0;
+
+		const uint8_t *payload = nullptr;
+		size_t payload_length = 0;
+
+		size_t GetLength() const
+		{
+			return header_length + payload_length;
+		}
+	};
+
+	// A part of an OBU element
+	struct Fragment
+	{
+		size_t element_index = 0;
+		size_t offset = 0;
+		size_t length = 0;
+	};
+
+	struct Packet
+	{
+		std::vector<Fragment> fragments;
+		// The length of the payload including the aggregation header
+		size_t length = AV1_AGGREGATION_HEADER_SIZE;
+
+		// Z: The first element is a continuation of an OBU fragment of the previous packet
+		bool first_continues = false;
+		// Y: The last element will continue in the next packet
+		bool last_continues = false;
+		// N: The first packet of a coded video sequence
+		bool new_sequence = false;
+	};
+
+	bool GeneratePackets();
+	void WriteFragment(const Fragment &fragment, uint8_t *buffer) const;
+
+	size_t _max_payload_len = 0;
+	size_t _last_packet_reduction_len = 0;
+
+	std::vector<AV1Obu> _obu_list;
+	std::vector<ObuElement> _elements;
+	std::vector<Packet> _packets;
+	size_t _next_packet_index = 0;
+};
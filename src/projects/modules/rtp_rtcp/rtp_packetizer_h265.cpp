@@ -5,6 +5,8 @@
 #include "rtp_packetizer_h265.h"
 #include "base/ovlibrary/byte_io.h"
 
+#include <algorithm>
+
 RtpPacketizerH265::RtpPacketizerH265()
 	: _num_packets_left(0)
 {
@@ -59,9 +61,14 @@ bool RtpPacketizerH265::GeneratePackets()
 
 				if (fragment_len > _max_payload_len) 
 				{
-					PacketizeFuA(i);
+					PacketizeFu(i);
 					++i;
 				} 
+				else if (CanAggregate(i))
+				{
+					// Small NAL units (VPS/SPS/PPS/SEI in front of the slices) share a packet
+					i = PacketizeAp(i);
+				}
 				else 
 				{
 					PacketizeSingleNalu(i);
@@ -73,8 +80,27 @@ bool RtpPacketizerH265::GeneratePackets()
 	return true;
 }
 
+bool RtpPacketizerH265::CanAggregate(size_t fragment_index) const
+{
+	// An AP is used only if at least two NAL units fit in it
+	if (fragment_index + 1 >= _input_fragments.size())
+	{
+		return false;
+	}
+
+	size_t payload_len = H265_NAL_HEADER_SIZE +
+						 H265_LENGTH_FIELD_SIZE + _input_fragments[fragment_index].length +
+						 H265_LENGTH_FIELD_SIZE + _input_fragments[fragment_index + 1].length;
 
-void RtpPacketizerH265::PacketizeFuA(size_t fragment_index) 
+	if (fragment_index + 2 == _input_fragments.size())
+	{
+		payload_len += _last_packet_reduction_len;
+	}
+
+	return payload_len <= _max_payload_len;
+}
+
+void RtpPacketizerH265::PacketizeFu(size_t fragment_index) 
 {
 	const Fragment& fragment = _input_fragments[fragment_index];
 	bool is_last_fragment = fragment_index + 1 == _input_fragments.size();
@@ -88,6 +114,9 @@ void RtpPacketizerH265::PacketizeFuA(size_t fragment_index)
 	size_t payload_per_packet = (payload_left + extra_len) / num_packets;
 	size_t num_larger_packets = (payload_left + extra_len) % num_packets;
 
+	// NAL Header (the same for all FUs of the NAL unit)
+	uint16_t header = (fragment.buffer[0] << 8) | fragment.buffer[1];
+
 	_num_packets_left += num_packets;
 	while (payload_left > 0) 
 	{
@@ -105,8 +134,6 @@ void RtpPacketizerH265::PacketizeFuA(size_t fragment_index)
 			}
 		}
 
-		// NAL Header
-		uint16_t header = (fragment.buffer[0] << 8) | fragment.buffer[1];
 		_packets.push(PacketUnit(Fragment(fragment.buffer + offset, packet_length),
 		                         offset - H265_NAL_HEADER_SIZE == 0,
 		                         payload_left == packet_length, 
@@ -117,39 +144,32 @@ void RtpPacketizerH265::PacketizeFuA(size_t fragment_index)
 	}
 }
 
-size_t RtpPacketizerH265::PacketizeStapA(size_t fragment_index) 
+size_t RtpPacketizerH265::PacketizeAp(size_t fragment_index) 
 {
-	// Aggregate fragments into one packet (STAP-A).
-	size_t payload_size_left = _max_payload_len;
+	// Aggregate fragments into one packet (AP).
+	size_t payload_size_left = _max_payload_len - H265_NAL_HEADER_SIZE;
 	int aggregated_fragments = 0;
-	size_t fragment_headers_length = 0;
-	const Fragment* fragment = &_input_fragments[fragment_index];
 	++_num_packets_left;
 
-	while (payload_size_left >= fragment->length + fragment_headers_length &&
-	       (fragment_index + 1 < _input_fragments.size() ||
-	        payload_size_left >= fragment->length + fragment_headers_length + _last_packet_reduction_len)) 
+	while (fragment_index < _input_fragments.size())
 	{
-		_packets.push(PacketUnit(*fragment, aggregated_fragments == 0, false, true, fragment->buffer[0]));
-		payload_size_left -= fragment->length;
-		payload_size_left -= fragment_headers_length;
+		const Fragment& fragment = _input_fragments[fragment_index];
+		size_t unit_len = H265_LENGTH_FIELD_SIZE + fragment.length;
+		size_t reduction_len = (fragment_index + 1 == _input_fragments.size()) ? _last_packet_reduction_len : 0;
 
-		fragment_headers_length = H265_LENGTH_FIELD_SIZE;
-
-		if (aggregated_fragments == 0)
-		{	
-			fragment_headers_length += H265_NAL_HEADER_SIZE + H265_LENGTH_FIELD_SIZE;
-		}
-		++aggregated_fragments;
-
-		// Next fragment.
-		++fragment_index;
-		if (fragment_index == _input_fragments.size())
+		if (unit_len + reduction_len > payload_size_left)
 		{
 			break;
 		}
-		fragment = &_input_fragments[fragment_index];
+
+		uint16_t header = (fragment.buffer[0] << 8) | fragment.buffer[1];
+		_packets.push(PacketUnit(fragment, aggregated_fragments == 0, false, true, header));
+		payload_size_left -= unit_len;
+
+		++aggregated_fragments;
+		++fragment_index;
 	}
+
 	_packets.back().last_fragment = true;
 	return fragment_index;
 }
@@ -213,14 +233,11 @@ void RtpPacketizerH265::NextAggregatePacket(RtpPacket* rtp_packet, bool last)
 	uint8_t* buffer = rtp_packet->AllocatePayload(last ? _max_payload_len - _last_packet_reduction_len : _max_payload_len);
 	PacketUnit* packet = &_packets.front();
 
-	uint8_t payload_hdr_h = packet->header >> 8;
-	uint8_t payload_hdr_l = packet->header & 0xFF;
-	uint8_t layer_id_h = payload_hdr_h & kHevcLayerIDHMask;
-
-	payload_hdr_h = (payload_hdr_h & kHevcTypeMaskN) | (kHevcAp << 1) | layer_id_h;
-
-	buffer[0] = payload_hdr_h;
-	buffer[1] = payload_hdr_l;
+	// PayloadHdr of AP (RFC 7798 4.4.2): F is set if any of the aggregated NAL units has F set,
+	// and LayerId/TID are the lowest ones of the aggregated NAL units
+	uint8_t f_bit = 0;
+	uint8_t layer_id = 0xFF;
+	uint8_t tid = 0xFF;
 
 	size_t index = H265_NAL_HEADER_SIZE;
 	bool is_last_fragment = packet->last_fragment;
@@ -228,6 +245,13 @@ void RtpPacketizerH265::NextAggregatePacket(RtpPacket* rtp_packet, bool last)
 	while (packet->aggregated) 
 	{
 		const Fragment& fragment = packet->source_fragment;
+		uint8_t nal_hdr_h = packet->header >> 8;
+		uint8_t nal_hdr_l = packet->header & 0xFF;
+
+		f_bit |= (nal_hdr_h & kHevcFBit);
+		layer_id = std::min<uint8_t>(layer_id, ((nal_hdr_h & kHevcLayerIDHMask) << 5) | ((nal_hdr_l & kHevcLayerIDLMask) >> 3));
+		tid = std::min<uint8_t>(tid, nal_hdr_l & kHevcTIDMask);
+
 		// Add NAL unit length field.
 		ByteWriter<uint16_t>::WriteBigEndian(&buffer[index], fragment.length);
 		index += H265_LENGTH_FIELD_SIZE;
@@ -246,6 +270,10 @@ void RtpPacketizerH265::NextAggregatePacket(RtpPacket* rtp_packet, bool last)
 		packet = &_packets.front();
 		is_last_fragment = packet->last_fragment;
 	}
+
+	buffer[0] = f_bit | (kHevcAp << 1) | (layer_id >> 5);
+	buffer[1] = ((layer_id << 3) & kHevcLayerIDLMask) | tid;
+
 	rtp_packet->SetPayloadSize(index);
 }
 
@@ -257,20 +285,18 @@ void RtpPacketizerH265::NextFragmentPacket(RtpPacket* rtp_packet)
 	// PayloadHdr of the first packet.
 	uint8_t payload_hdr_h = packet->header >> 8;  // 1-bit F, 6-bit type, 1-bit layerID highest-bit
 	uint8_t payload_hdr_l = packet->header & 0xFF;
-	uint8_t layer_id_h = payload_hdr_h & kHevcLayerIDHMask;
-	uint8_t fu_header = 0;
 	// S | E |6 bit type.
+	uint8_t fu_header = (payload_hdr_h & kHevcTypeMask) >> 1;
 	fu_header |= (packet->first_fragment ? kHevcSBit : 0);
 	fu_header |= (packet->last_fragment ? kHevcEBit : 0);
-	uint8_t type = (payload_hdr_h & kHevcTypeMask) >> 1;
-	fu_header |= type;
-	// Now update payload_hdr_h with FU type.
-	payload_hdr_h = (payload_hdr_h & kHevcTypeMaskN) | (kHevcFu << 1) | layer_id_h;
 
 	const Fragment& fragment = packet->source_fragment;
 
+	// The headers are written in front of the fragment in the payload buffer of the packet, so the fragment is
+	// copied only once from the frame
 	uint8_t* buffer = rtp_packet->AllocatePayload(H265_FU_HEADER_SIZE + H265_NAL_HEADER_SIZE + fragment.length);
-	buffer[0] = payload_hdr_h;
+	// Now update payload_hdr_h with FU type (F and the highest bit of LayerId are kept)
+	buffer[0] = (payload_hdr_h & kHevcTypeMaskN) | (kHevcFu << 1);
 	buffer[1] = payload_hdr_l;
 	buffer[2] = fu_header;
 
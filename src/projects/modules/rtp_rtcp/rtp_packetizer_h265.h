@@ -89,8 +89,10 @@ private:
 	};
 
 	bool GeneratePackets();
-	void PacketizeFuA(size_t fragment_index);
-	size_t PacketizeStapA(size_t fragment_index);
+	bool CanAggregate(size_t fragment_index) const;
+	void PacketizeFu(size_t fragment_index);
+	// Returns the index of the next fragment that is not aggregated
+	size_t PacketizeAp(size_t fragment_index);
 	bool PacketizeSingleNalu(size_t fragment_index);
 	void NextAggregatePacket(RtpPacket* rtp_packet, bool last);
 	void NextFragmentPacket(RtpPacket* rtp_packet);
@@ -0,0 +1,259 @@
+#include "rtp_packetizer_vp9.h"
+
+#define OV_LOG_TAG "RtpPacketizerVp9"
+
+namespace
+{
+	// A frame of the group of pictures in the scalability structure
+	struct GofFrame
+	{
+		uint8_t temporal_idx;
+		bool temporal_up_switch;
+		uint8_t p_diff;
+	};
+
+	// The patterns of the temporal layers that the encoder produces (0-1-0-1..., 0-2-1-2...)
+	const std::vector<GofFrame> kGofTwoLayers = {{0, false, 2}, {1, true, 1}};
+	const std::vector<GofFrame> kGofThreeLayers = {{0, false, 4}, {2, true, 1}, {1, true, 2}, {2, true, 1}};
+
+	const std::vector<GofFrame> &GetGof(uint8_t num_temporal_layers)
+	{
+		return (num_temporal_layers == 2) ? kGofTwoLayers : kGofThreeLayers;
+	}
+}  // namespace
+
+RtpPacketizerVp9::RtpPacketizerVp9()
+{
+	_header.InitRTPVideoHeaderVP9();
+}
+
+RtpPacketizerVp9::~RtpPacketizerVp9()
+{
+}
+
+size_t RtpPacketizerVp9::SetPayloadData(size_t max_payload_len, size_t last_packet_reduction_len, const RTPVideoTypeHeader *rtp_type_header, FrameType frame_type,
+										const uint8_t *payload_data, size_t payload_size, const FragmentationHeader *fragmentation)
+{
+	if (rtp_type_header == nullptr)
+	{
+		_header.InitRTPVideoHeaderVP9();
+	}
+	else
+	{
+		_header = rtp_type_header->vp9;
+	}
+
+	_is_key_frame = (frame_type == FrameType::VideoFrameKey);
+	_payload_data = payload_data;
+	_payload_size = payload_size;
+	_max_payload_len = max_payload_len;
+	_last_packet_reduction_len = last_packet_reduction_len;
+
+	_packets.clear();
+	_next_packet_index = 0;
+
+	if (GeneratePackets() == false)
+	{
+		_packets.clear();
+		return 0;
+	}
+
+	return _packets.size();
+}
+
+bool RtpPacketizerVp9::IsLayered() const
+{
+	return (_header.temporal_idx != kNoTemporalIdx) && (_header.num_temporal_layers > 1);
+}
+
+size_t RtpPacketizerVp9::GetDescriptorLength(bool first) const
+{
+	size_t length = 1;
+
+	if (_header.picture_id != kNoPictureId)
+	{
+		// 15 bits picture id
+		length += 2;
+	}
+
+	if (IsLayered())
+	{
+		// TID/U/SID/D + TL0PICIDX
+		length += 2;
+	}
+
+	if (first && _is_key_frame)
+	{
+		length += GetScalabilityStructureLength();
+	}
+
+	return length;
+}
+
+size_t RtpPacketizerVp9::GetScalabilityStructureLength() const
+{
+	// N_S/Y/G + WIDTH(16) + HEIGHT(16) of the single spatial layer
+	size_t length = 1 + 4;
+
+	if (IsLayered())
+	{
+		// N_G + (TID/U/R + P_DIFF) * N_G
+		length += 1 + GetGof(_header.num_temporal_layers).size() * 2;
+	}
+
+	return length;
+}
+
+bool RtpPacketizerVp9::GeneratePackets()
+{
+	if ((_payload_data == nullptr) || (_payload_size == 0))
+	{
+		return false;
+	}
+
+	size_t first_descriptor_length = GetDescriptorLength(true);
+	size_t descriptor_length = GetDescriptorLength(false);
+
+	if (_max_payload_len <= (first_descriptor_length + _last_packet_reduction_len))
+	{
+		logte("The payload size is too small to packetize (max: %zu, reduction: %zu)", _max_payload_len, _last_packet_reduction_len);
+		return false;
+	}
+
+	// Split the frame into the packets of similar size
+	size_t capacity = _max_payload_len - descriptor_length;
+	size_t num_packets = (_payload_size + (first_descriptor_length - descriptor_length) + _last_packet_reduction_len + capacity - 1) / capacity;
+
+	while (true)
+	{
+		size_t offset = 0;
+
+		_packets.clear();
+
+		for (size_t index = 0; index < num_packets; index++)
+		{
+			Packet packet;
+			packet.first = (index == 0);
+			packet.last = ((index + 1) == num_packets);
+
+			size_t available = _max_payload_len - (packet.first ? first_descriptor_length : descriptor_length) - (packet.last ? _last_packet_reduction_len : 0);
+			size_t remaining = _payload_size - offset;
+			size_t packets_left = num_packets - index;
+
+			packet.offset = offset;
+			packet.length = std::min(available, (remaining + packets_left - 1) / packets_left);
+
+			if (packet.length == 0)
+			{
+				break;
+			}
+
+			offset += packet.length;
+			_packets.push_back(packet);
+		}
+
+		if ((offset == _payload_size) && (_packets.size() == num_packets))
+		{
+			break;
+		}
+
+		// The first or the last packet is smaller than the others, so one more packet is needed
+		num_packets++;
+	}
+
+	return true;
+}
+
+size_t RtpPacketizerVp9::WriteDescriptor(const Packet &packet, uint8_t *buffer) const
+{
+	bool write_ss = packet.first && _is_key_frame;
+	size_t position = 1;
+
+	// F = 0 (non-flexible mode), Z = 0 (a single spatial layer)
+	uint8_t flags = 0x00;
+	flags |= _header.inter_pic_predicted ? VP9_PAYLOAD_DESCRIPTOR_P_BIT : 0x00;
+	flags |= packet.first ? VP9_PAYLOAD_DESCRIPTOR_B_BIT : 0x00;
+	flags |= packet.last ? VP9_PAYLOAD_DESCRIPTOR_E_BIT : 0x00;
+	flags |= write_ss ? VP9_PAYLOAD_DESCRIPTOR_V_BIT : 0x00;
+
+	if (_header.picture_id != kNoPictureId)
+	{
+		flags |= VP9_PAYLOAD_DESCRIPTOR_I_BIT;
+
+		// M = 1 (15 bits)
+		buffer[position++] = 0x80 | ((_header.picture_id >> 8) & 0x7F);
+		buffer[position++] = _header.picture_id & 0xFF;
+	}
+
+	if (IsLayered())
+	{
+		flags |= VP9_PAYLOAD_DESCRIPTOR_L_BIT;
+
+		// TID(3) + U(1) + SID(3) = 0 + D(1) = 0
+		buffer[position++] = ((_header.temporal_idx & 0x07) << 5) | (_header.temporal_up_switch ? 0x10 : 0x00);
+		buffer[position++] = static_cast<uint8_t>(_header.tl0_pic_idx);
+	}
+
+	buffer[0] = flags;
+
+	if (write_ss)
+	{
+		position += WriteScalabilityStructure(buffer + position);
+	}
+
+	return position;
+}
+
+size_t RtpPacketizerVp9::WriteScalabilityStructure(uint8_t *buffer) const
+{
+	size_t position = 0;
+	bool layered = IsLayered();
+
+	// N_S = 0 (a single spatial layer), Y = 1
+	buffer[position++] = VP9_SS_Y_BIT | (layered ? VP9_SS_G_BIT : 0x00);
+
+	ByteWriter<uint16_t>::WriteBigEndian(buffer + position, _header.width);
+	position += 2;
+	ByteWriter<uint16_t>::WriteBigEndian(buffer + position, _header.height);
+	position += 2;
+
+	if (layered)
+	{
+		const auto &gof = GetGof(_header.num_temporal_layers);
+
+		buffer[position++] = static_cast<uint8_t>(gof.size());
+
+		for (const auto &frame : gof)
+		{
+			// TID(3) + U(1) + R(2) = 1
+			buffer[position++] = ((frame.temporal_idx & 0x07) << 5) | (frame.temporal_up_switch ? 0x10 : 0x00) | (1 << 2);
+			buffer[position++] = frame.p_diff;
+		}
+	}
+
+	return position;
+}
+
+bool RtpPacketizerVp9::NextPacket(RtpPacket *rtp_packet)
+{
+	if (_next_packet_index >= _packets.size())
+	{
+		return false;
+	}
+
+	const auto &packet = _packets[_next_packet_index++];
+
+	uint8_t *buffer = rtp_packet->AllocatePayload(GetDescriptorLength(packet.first) + packet.length);
+	if (buffer == nullptr)
+	{
+		return false;
+	}
+
+	auto position = WriteDescriptor(packet, buffer);
+	::memcpy(buffer + position, _payload_data + packet.offset, packet.length);
+
+	// The marker bit is set for the last packet of the picture
+	rtp_packet->SetMarker(packet.last);
+
+	return true;
+}
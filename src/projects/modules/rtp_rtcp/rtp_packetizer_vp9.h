@@ -0,0 +1,84 @@
+#pragma once
+
+#include "rtp_packet.h"
+#include "rtp_packetizing_manager.h"
+
+#include <vector>
+
+// RTP Payload Format for VP9 (RFC 9628), 4.2 - Non-flexible mode
+//
+//	 0 1 2 3 4 5 6 7
+//	+-+-+-+-+-+-+-+-+
+//	|I|P|L|F|B|E|V|Z| (REQUIRED)
+//	+-+-+-+-+-+-+-+-+
+//	|M| PICTURE ID  | (REQUIRED if I = 1)
+//	+-+-+-+-+-+-+-+-+
+//	|   EXTENDED    | (REQUIRED if M = 1)
+//	+-+-+-+-+-+-+-+-+
+//	|  TID |U| SID |D| (REQUIRED if L = 1)
+//	+-+-+-+-+-+-+-+-+
+//	|   TL0PICIDX   | (REQUIRED if L = 1)
+//	+-+-+-+-+-+-+-+-+
+//	|      SS       | (REQUIRED if V = 1)
+//	+-+-+-+-+-+-+-+-+
+#define VP9_PAYLOAD_DESCRIPTOR_I_BIT	0x80
+#define VP9_PAYLOAD_DESCRIPTOR_P_BIT	0x40
+#define VP9_PAYLOAD_DESCRIPTOR_L_BIT	0x20
+#define VP9_PAYLOAD_DESCRIPTOR_F_BIT	0x10
+#define VP9_PAYLOAD_DESCRIPTOR_B_BIT	0x08
+#define VP9_PAYLOAD_DESCRIPTOR_E_BIT	0x04
+#define VP9_PAYLOAD_DESCRIPTOR_V_BIT	0x02
+
+// Scalability structure (SS)
+//
+//	+-+-+-+-+-+-+-+-+
+//	| N_S |Y|G|-|-|-|
+//	+-+-+-+-+-+-+-+-+
+#define VP9_SS_Y_BIT	0x10
+#define VP9_SS_G_BIT	0x08
+
+// Packetizer for VP9.
+// The payload must be a frame or a superframe (cmn::BitstreamFormat::VP9) of a single spatial layer.
+// The scalability structure is sent with the first packet of the key frame,
+// so the receiver can infer the references of the temporal layers from the picture id and TL0PICIDX.
+class RtpPacketizerVp9 : public RtpPacketizingManager
+{
+public:
+	RtpPacketizerVp9();
+	~RtpPacketizerVp9() override;
+
+	size_t SetPayloadData(size_t max_payload_len, size_t last_packet_reduction_len, const RTPVideoTypeHeader *rtp_type_header, FrameType frame_type,
+						  const uint8_t *payload_data, size_t payload_size, const FragmentationHeader *fragmentation) override;
+
+	bool NextPacket(RtpPacket *rtp_packet) override;
+
+private:
+	struct Packet
+	{
+		size_t offset = 0;
+		size_t length = 0;
+		bool first = false;
+		bool last = false;
+	};
+
+	bool GeneratePackets();
+
+	bool IsLayered() const;
+	size_t GetDescriptorLength(bool first) const;
+	size_t GetScalabilityStructureLength() const;
+
+	size_t WriteDescriptor(const Packet &packet, uint8_t *buffer) const;
+	size_t WriteScalabilityStructure(uint8_t *buffer) const;
+
+	RTPVideoHeaderVP9 _header;
+	bool _is_key_frame = false;
+
+	const uint8_t *_payload_data = nullptr;
+	size_t _payload_size = 0;
+
+	size_t _max_payload_len = 0;
+	size_t _last_packet_reduction_len = 0;
+
+	std::vector<Packet> _packets;
+	size_t _next_packet_index = 0;
+};
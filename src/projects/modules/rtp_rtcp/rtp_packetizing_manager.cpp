@@ -1,7 +1,9 @@
 #include "rtp_packetizing_manager.h"
 #include "rtp_packetizer_vp8.h"
+#include "rtp_packetizer_vp9.h"
 #include "rtp_packetizer_h264.h"
 #include "rtp_packetizer_h265.h"
+#include "rtp_packetizer_av1.h"
 
 #include <base/ovlibrary/converter.h>
 
@@ -12,12 +14,18 @@ std::shared_ptr<RtpPacketizingManager> RtpPacketizingManager::Create(cmn::MediaC
 		case cmn::MediaCodecId::Vp8:
 			return std::make_shared<RtpPacketizerVp8>();
 
+		case cmn::MediaCodecId::Vp9:
+			return std::make_shared<RtpPacketizerVp9>();
+
 		case cmn::MediaCodecId::H264:
 			return std::make_shared<RtpPacketizerH264>();
 
 		case cmn::MediaCodecId::H265:
 			return std::make_shared<RtpPacketizerH265>();
 
+		case cmn::MediaCodecId::Av1:
+			return std::make_shared<RtpPacketizerAv1>();
+
 		default:
 			// Not supported
 			break;
@@ -6,6 +6,7 @@
 #include "rtcp_receiver.h"
 #include "rtcp_info/fir.h"
 #include "rtcp_info/pli.h"
+#include "rtcp_info/nack.h"
 
 #include "modules/rtsp/rtsp_data.h"
 
@@ -60,9 +61,11 @@ bool RtpRtcp::AddRtpReceiver(uint32_t track_id, const std::shared_ptr<MediaTrack
 	switch(track->GetOriginBitstream())
 	{
 		case cmn::BitstreamFormat::H264_RTP_RFC_6184:
+		case cmn::BitstreamFormat::H265_RTP_RFC_7798:
 		case cmn::BitstreamFormat::VP8_RTP_RFC_7741:
 		case cmn::BitstreamFormat::AAC_MPEG4_GENERIC:
 			_rtp_frame_jitter_buffers[track_id] = std::make_shared<RtpFrameJitterBuffer>();
+			_rtp_frame_jitter_buffers[track_id]->EnableNack(_nack_feedback_enabled && (track->GetMediaType() == cmn::MediaType::Video));
 			break;
 		case cmn::BitstreamFormat::OPUS_RTP_RFC_7587:
 			_rtp_minimal_jitter_buffers[track_id] = std::make_shared<RtpMinimalJitterBuffer>();
@@ -84,6 +87,93 @@ bool RtpRtcp::AddRtpReceiver(uint32_t track_id, const std::shared_ptr<MediaTrack
 	return true;
 }
 
+bool RtpRtcp::AddRtpReceiverByRid(const ov::String &rid, uint32_t track_id, const std::shared_ptr<MediaTrack> &track)
+{
+	if (AddRtpReceiver(track_id, track) == false)
+	{
+		return false;
+	}
+
+	_rid_track_ids[rid] = track_id;
+
+	return true;
+}
+
+bool RtpRtcp::AddRtpReceiverByMid(const ov::String &mid, uint32_t track_id, const std::shared_ptr<MediaTrack> &track)
+{
+	if (AddRtpReceiver(track_id, track) == false)
+	{
+		return false;
+	}
+
+	_mid_track_ids[mid] = track_id;
+
+	return true;
+}
+
+void RtpRtcp::SetRidExtensionId(uint8_t extension_id)
+{
+	_rid_extension_id = extension_id;
+}
+
+void RtpRtcp::SetMidExtensionId(uint8_t extension_id)
+{
+	_mid_extension_id = extension_id;
+}
+
+std::optional<uint32_t> RtpRtcp::GetTrackIdOfPacket(const std::shared_ptr<const RtpPacket> &packet)
+{
+	auto ssrc = packet->Ssrc();
+
+	if (_tracks.find(ssrc) != _tracks.end())
+	{
+		return ssrc;
+	}
+
+	auto ssrc_it = _ssrc_track_ids.find(ssrc);
+	if (ssrc_it != _ssrc_track_ids.end())
+	{
+		return ssrc_it->second;
+	}
+
+	// The sender keeps the RID/MID in the packets until it receives the RTCP of the SSRC, so the first packets have them
+	std::optional<uint32_t> track_id;
+
+	if (_rid_extension_id != 0)
+	{
+		auto rid = packet->GetExtensionView(_rid_extension_id);
+		if (rid.IsValid())
+		{
+			auto rid_it = _rid_track_ids.find(ov::String(reinterpret_cast<const char *>(rid.data), rid.length));
+			if (rid_it != _rid_track_ids.end())
+			{
+				track_id = rid_it->second;
+			}
+		}
+	}
+
+	if ((track_id.has_value() == false) && (_mid_extension_id != 0))
+	{
+		auto mid = packet->GetExtensionView(_mid_extension_id);
+		if (mid.IsValid())
+		{
+			auto mid_it = _mid_track_ids.find(ov::String(reinterpret_cast<const char *>(mid.data), mid.length));
+			if (mid_it != _mid_track_ids.end())
+			{
+				track_id = mid_it->second;
+			}
+		}
+	}
+
+	if (track_id.has_value())
+	{
+		logtd("SSRC(%u) is mapped to track(%u)", ssrc, track_id.value());
+		_ssrc_track_ids.emplace(ssrc, track_id.value());
+	}
+
+	return track_id;
+}
+
 bool RtpRtcp::Stop()
 {
 	// Cross reference
@@ -95,6 +185,33 @@ bool RtpRtcp::Stop()
 
 bool RtpRtcp::SendRtpPacket(const std::shared_ptr<RtpPacket> &rtp_packet)
 {
+	return SendRtpPacket(rtp_packet, rtp_packet->GetData());
+}
+
+bool RtpRtcp::SendRtpPacket(const std::shared_ptr<const RtpPacket> &rtp_packet, const std::shared_ptr<ov::Data> &data)
+{
+	std::shared_lock<std::shared_mutex> lock(_state_lock);
+	// nothing to do before node start
+	if(GetNodeState() != ov::Node::NodeState::Started)
+	{
+		logtd("Node has not started, so the received data has been canceled.");
+		return false;
+	}
+
+	SendSenderReportIfNeeded(rtp_packet);
+
+	// Send RTP
+	_last_sent_rtp_packet = rtp_packet;
+	return SendDataToNextNode(NodeType::Rtp, data);
+}
+
+bool RtpRtcp::SendRtpPackets(const std::vector<std::shared_ptr<RtpPacket>> &packets)
+{
+	if(packets.empty())
+	{
+		return true;
+	}
+
 	std::shared_lock<std::shared_mutex> lock(_state_lock);
 	// nothing to do before node start
 	if(GetNodeState() != ov::Node::NodeState::Started)
@@ -103,6 +220,22 @@ bool RtpRtcp::SendRtpPacket(const std::shared_ptr<RtpPacket> &rtp_packet)
 		return false;
 	}
 
+	std::vector<std::shared_ptr<ov::Data>> data_list;
+	data_list.reserve(packets.size());
+
+	for(const auto &rtp_packet : packets)
+	{
+		SendSenderReportIfNeeded(rtp_packet);
+		data_list.push_back(rtp_packet->GetData());
+	}
+
+	// Send RTP
+	_last_sent_rtp_packet = packets.back();
+	return SendDataListToNextNode(NodeType::Rtp, data_list);
+}
+
+void RtpRtcp::SendSenderReportIfNeeded(const std::shared_ptr<const RtpPacket> &rtp_packet)
+{
 	// RTCP(SR + SR + SDES + SDES)
 	auto it = _rtcp_sr_generators.find(rtp_packet->Ssrc());
     if(it != _rtcp_sr_generators.end())
@@ -146,10 +279,6 @@ bool RtpRtcp::SendRtpPacket(const std::shared_ptr<RtpPacket> &rtp_packet)
 			logd("RTCP", "Send RTCP succeed : pt(%d) ssrc(%u) length(%d)", rtp_packet->PayloadType(), rtp_packet->Ssrc(), compound_rtcp_data->GetLength());
 		}
 	}
-
-	// Send RTP
-	_last_sent_rtp_packet = rtp_packet;
-	return SendDataToNextNode(NodeType::Rtp, rtp_packet->GetData());
 }
 
 bool RtpRtcp::SendPLI(uint32_t media_ssrc)
@@ -220,6 +349,82 @@ void RtpRtcp::DisableTransportCcFeedback()
 	_transport_cc_feedback_enabled = false;
 }
 
+bool RtpRtcp::IsNackFeedbackEnabled() const
+{
+	return _nack_feedback_enabled;
+}
+
+void RtpRtcp::EnableNackFeedback()
+{
+	_nack_feedback_enabled = true;
+
+	for (auto &item : _rtp_frame_jitter_buffers)
+	{
+		auto track_it = _tracks.find(item.first);
+		if (track_it != _tracks.end() && track_it->second->GetMediaType() == cmn::MediaType::Video)
+		{
+			item.second->EnableNack(true);
+		}
+	}
+}
+
+void RtpRtcp::EnableKeyframeRequest()
+{
+	_keyframe_request_enabled = true;
+}
+
+void RtpRtcp::SendFeedbackOfJitterBuffer(uint32_t media_ssrc, const std::shared_ptr<RtpFrameJitterBuffer> &jitter_buffer)
+{
+	if (_nack_feedback_enabled == true)
+	{
+		auto nack_list = jitter_buffer->GetNackList();
+		if (nack_list.empty() == false)
+		{
+			SendNACK(media_ssrc, nack_list);
+		}
+	}
+
+	if (_keyframe_request_enabled == true &&
+		(_keyframe_request_stop_watch.IsStart() == false || _keyframe_request_stop_watch.IsElapsed(KEYFRAME_REQUEST_MIN_INTERVAL_MS)) &&
+		jitter_buffer->IsKeyframeRequestNeeded() == true)
+	{
+		logtd("Request key frame - ssrc(%u)", media_ssrc);
+
+		_keyframe_request_stop_watch.Start();
+		SendPLI(media_ssrc);
+	}
+}
+
+bool RtpRtcp::SendNACK(uint32_t media_ssrc, const std::vector<uint16_t> &lost_ids)
+{
+	auto stat_it = _receive_statistics.find(media_ssrc);
+	if(stat_it == _receive_statistics.end())
+	{
+		// Never received such SSRC packet
+		return false;
+	}
+
+	auto nack = std::make_shared<NACK>();
+
+	nack->SetSrcSsrc(stat_it->second->GetReceiverSSRC());
+	nack->SetMediaSsrc(media_ssrc);
+
+	for (auto id : lost_ids)
+	{
+		nack->AddLostId(id);
+	}
+
+	auto rtcp_packet = std::make_shared<RtcpPacket>();
+	if (rtcp_packet->Build(nack) == false)
+	{
+		return false;
+	}
+
+	_last_sent_rtcp_packet = rtcp_packet;
+
+	return SendDataToNextNode(NodeType::Rtcp, rtcp_packet->GetData());
+}
+
 // In general, since RTP_RTCP is the first node, there is no previous node. So it will not be called
 bool RtpRtcp::OnDataReceivedFromPrevNode(NodeType from_node, const std::shared_ptr<ov::Data> &data)
 {
@@ -325,9 +530,18 @@ bool RtpRtcp::OnRtpReceived(NodeType from_node, const std::shared_ptr<const ov::
 	}
 	else
 	{
-		track_id = packet->Ssrc();
+		auto packet_track_id = GetTrackIdOfPacket(packet);
+		if (packet_track_id.has_value() == false)
+		{
+			logtd("Could not find track info for SSRC %u", packet->Ssrc());
+			return false;
+		}
+
+		track_id = packet_track_id.value();
 	}
 
+	packet->SetTrackId(track_id);
+
 	auto track_it = _tracks.find(track_id);
 	if(track_it == _tracks.end())
 	{
@@ -358,6 +572,8 @@ bool RtpRtcp::OnRtpReceived(NodeType from_node, const std::shared_ptr<const ov::
 	{
 		auto report = std::make_shared<ReceiverReport>();
 		report->SetRtpSsrc(packet->Ssrc());
+		// The RTSP node sends it through the RTCP channel of the RTP channel
+		report->SetRtspChannel(packet->GetRtspChannel());
 		report->SetSenderSsrc(stat->GetReceiverSSRC());
 		report->AddReportBlock(stat->GenerateReportBlock());
 
@@ -401,6 +617,7 @@ bool RtpRtcp::OnRtpReceived(NodeType from_node, const std::shared_ptr<const ov::
 	switch(track->GetOriginBitstream())
 	{
 		case cmn::BitstreamFormat::H264_RTP_RFC_6184:
+		case cmn::BitstreamFormat::H265_RTP_RFC_7798:
 		case cmn::BitstreamFormat::VP8_RTP_RFC_7741:
 		case cmn::BitstreamFormat::AAC_MPEG4_GENERIC:
 			jitter_buffer_type = 1;
@@ -426,33 +643,31 @@ bool RtpRtcp::OnRtpReceived(NodeType from_node, const std::shared_ptr<const ov::
 
 		jitter_buffer->InsertPacket(packet);
 
-		auto frame = jitter_buffer->PopAvailableFrame();
-		if(frame != nullptr && _observer != nullptr)
+		// A lost packet may complete several frames at once
+		while (true)
 		{
-			std::vector<std::shared_ptr<RtpPacket>> rtp_packets;
+			auto frame = jitter_buffer->PopAvailableFrame();
+			if (frame == nullptr)
+			{
+				break;
+			}
 
-			auto packet = frame->GetFirstRtpPacket();
-			if(packet == nullptr)
+			if (frame->PacketCount() == 0)
 			{
 				// can not happen
 				logtw("Could not get first rtp packet from jitter buffer - track(%u)", track_id);
-				return false;
+				continue;
 			}
 
-			rtp_packets.push_back(packet);
-
-			while(true)
+			if (_observer != nullptr)
 			{
-				packet = frame->GetNextRtpPacket();
-				if(packet == nullptr)
-				{
-					break;
-				}
-
-				rtp_packets.push_back(packet);
+				_observer->OnRtpFrameReceived(frame->GetPackets());
 			}
+		}
 
-			_observer->OnRtpFrameReceived(rtp_packets);
+		if (track->GetMediaType() == cmn::MediaType::Video)
+		{
+			SendFeedbackOfJitterBuffer(packet->Ssrc(), jitter_buffer);
 		}
 	}
 	else if(jitter_buffer_type == 2)
@@ -469,9 +684,14 @@ bool RtpRtcp::OnRtpReceived(NodeType from_node, const std::shared_ptr<const ov::
 
 		jitter_buffer->InsertPacket(packet);
 
-		auto pop_packet = jitter_buffer->PopAvailablePacket();
-		if(pop_packet != nullptr)
+		while(true)
 		{
+			auto pop_packet = jitter_buffer->PopAvailablePacket();
+			if(pop_packet == nullptr)
+			{
+				break;
+			}
+
 			std::vector<std::shared_ptr<RtpPacket>> rtp_packets;
 			rtp_packets.push_back(pop_packet);
 			_observer->OnRtpFrameReceived(rtp_packets);
@@ -530,11 +750,16 @@ bool RtpRtcp::OnRtcpReceived(NodeType from_node, const std::shared_ptr<const ov:
 			_observer->OnRtcpReceived(info);
 		}
 	}
+
+	if(_observer != nullptr)
+	{
+		_observer->OnRtcpCompoundReceived();
+	}
 	
 	return true;
 }
 
-std::shared_ptr<RtpPacket> RtpRtcp::GetLastSentRtpPacket()
+std::shared_ptr<const RtpPacket> RtpRtcp::GetLastSentRtpPacket()
 {
 	return _last_sent_rtp_packet;
 }
@@ -16,12 +16,16 @@
 #define RECEIVER_REPORT_CYCLE_MS	500
 #define TRANSPORT_CC_CYCLE_MS		50
 #define SDES_CYCLE_MS 500
+// Key frames are not requested more often than this
+#define KEYFRAME_REQUEST_MIN_INTERVAL_MS	500
 
 class RtpRtcpInterface : public ov::EnableSharedFromThis<RtpRtcpInterface>
 {
 public:
 	virtual void OnRtpFrameReceived(const std::vector<std::shared_ptr<RtpPacket>> &rtp_packets) = 0;
 	virtual void OnRtcpReceived(const std::shared_ptr<RtcpInfo> &rtcp_info) = 0;
+	// Called after all RTCP packets of a compound packet are passed to OnRtcpReceived()
+	virtual void OnRtcpCompoundReceived() {}
 };
 
 class RtpRtcp : public ov::Node
@@ -32,9 +36,20 @@ public:
 
 	bool AddRtpSender(uint8_t payload_type, uint32_t ssrc, uint32_t codec_rate, ov::String cname);
 	bool AddRtpReceiver(uint32_t track_id, const std::shared_ptr<MediaTrack> &track);
+	// The packets whose SSRCs are not signalled in the SDP (e.g. the layers of simulcast) are mapped to the receivers
+	// by the RID (RFC 8852) or the MID (RFC 8843) header extension of the first packets of the SSRC
+	bool AddRtpReceiverByRid(const ov::String &rid, uint32_t track_id, const std::shared_ptr<MediaTrack> &track);
+	bool AddRtpReceiverByMid(const ov::String &mid, uint32_t track_id, const std::shared_ptr<MediaTrack> &track);
+	void SetRidExtensionId(uint8_t extension_id);
+	void SetMidExtensionId(uint8_t extension_id);
 	bool Stop() override;
 
 	bool SendRtpPacket(const std::shared_ptr<RtpPacket> &packet);
+	// Sends <data> instead of packet->GetData(). <data> is a copy of the packet whose header is modified for the session.
+	// (To avoid cloning the RtpPacket shared by many sessions)
+	bool SendRtpPacket(const std::shared_ptr<const RtpPacket> &packet, const std::shared_ptr<ov::Data> &data);
+	// Sends the packets together, so the lower nodes can protect and send them with fewer calls
+	bool SendRtpPackets(const std::vector<std::shared_ptr<RtpPacket>> &packets);
 	bool SendPLI(uint32_t media_ssrc);
 	bool SendFIR(uint32_t media_ssrc);
 
@@ -42,9 +57,15 @@ public:
 	bool EnableTransportCcFeedback(uint8_t extension_id);
 	void DisableTransportCcFeedback();
 
+	// Requests the lost packets of the video tracks with NACK
+	bool IsNackFeedbackEnabled() const;
+	void EnableNackFeedback();
+	// Requests a key frame with PLI when a video frame cannot be assembled (e.g. the lost packets are not recovered in time)
+	void EnableKeyframeRequest();
+
 	// These functions help the next node to not have to parse the packet again.
 	// Because next node receives raw data format.
-	std::shared_ptr<RtpPacket> GetLastSentRtpPacket();
+	std::shared_ptr<const RtpPacket> GetLastSentRtpPacket();
 	std::shared_ptr<RtcpPacket> GetLastSentRtcpPacket();
 
 	// Implement Node Interface
@@ -57,6 +78,17 @@ private:
 
 	std::shared_ptr<RtpFrameJitterBuffer> GetJitterBuffer(uint8_t payload_type);
 
+	// Returns the track id of the packet received from the WebRTC peer, or std::nullopt if the packet cannot be mapped
+	std::optional<uint32_t> GetTrackIdOfPacket(const std::shared_ptr<const RtpPacket> &packet);
+
+	// Sends the NACK and the key frame request of the jitter buffer if needed
+	void SendFeedbackOfJitterBuffer(uint32_t media_ssrc, const std::shared_ptr<RtpFrameJitterBuffer> &jitter_buffer);
+	bool SendNACK(uint32_t media_ssrc, const std::vector<uint16_t> &lost_ids);
+
+	// Updates the sender report with the packet, and sends SR + SDES periodically
+	// _state_lock must be held
+	void SendSenderReportIfNeeded(const std::shared_ptr<const RtpPacket> &rtp_packet);
+
 	std::shared_ptr<RtcpPacket> GenerateTransportCcFeedbackIfNeeded();
 
     time_t _first_receiver_report_time = 0; // 0 - not received RR packet
@@ -73,6 +105,10 @@ private:
 
 	bool _transport_cc_feedback_enabled = false;
 	uint8_t _transport_cc_feedback_extension_id = 0;
+
+	bool _nack_feedback_enabled = false;
+	bool _keyframe_request_enabled = false;
+	ov::StopWatch _keyframe_request_stop_watch;
 	
 	// Receiver SSRC (For RTCP RR, FIR... etc)
 	std::unordered_map<uint32_t, std::shared_ptr<RtpReceiveStatistics>> _receive_statistics;
@@ -81,16 +117,24 @@ private:
 	std::shared_ptr<RtcpTransportCcFeedbackGenerator> _transport_cc_generator = nullptr;
 
 	// Jitter buffer
-	// payload type : Jitter buffer
-	std::unordered_map<uint8_t, std::shared_ptr<RtpFrameJitterBuffer>> _rtp_frame_jitter_buffers;
-	std::unordered_map<uint8_t, std::shared_ptr<RtpMinimalJitterBuffer>> _rtp_minimal_jitter_buffers;
-
-	// payload type : MediaTrack Info
-	std::unordered_map<uint8_t, std::shared_ptr<MediaTrack>> _tracks;
+	// track id : Jitter buffer
+	std::unordered_map<uint32_t, std::shared_ptr<RtpFrameJitterBuffer>> _rtp_frame_jitter_buffers;
+	std::unordered_map<uint32_t, std::shared_ptr<RtpMinimalJitterBuffer>> _rtp_minimal_jitter_buffers;
+
+	// track id : MediaTrack Info
+	std::unordered_map<uint32_t, std::shared_ptr<MediaTrack>> _tracks;
+
+	// RID/MID : track id
+	std::unordered_map<ov::String, uint32_t> _rid_track_ids;
+	std::unordered_map<ov::String, uint32_t> _mid_track_ids;
+	uint8_t _rid_extension_id = 0;
+	uint8_t _mid_extension_id = 0;
+	// SSRC : track id, learned from the RID/MID of the first packets
+	std::unordered_map<uint32_t, uint32_t> _ssrc_track_ids;
 	bool _video_receiver_enabled = false;
 	bool _audio_receiver_enabled = false;
 
 	// Latest packet
-	std::shared_ptr<RtpPacket>		_last_sent_rtp_packet = nullptr;
+	std::shared_ptr<const RtpPacket>	_last_sent_rtp_packet = nullptr;
 	std::shared_ptr<RtcpPacket>		_last_sent_rtcp_packet = nullptr;
 };
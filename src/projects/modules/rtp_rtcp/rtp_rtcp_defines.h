@@ -77,12 +77,38 @@ struct RTPVideoHeaderVP8
 	// in a VP8 partition. Otherwise false
 };
 
+struct RTPVideoHeaderVP9
+{
+	void InitRTPVideoHeaderVP9()
+	{
+		inter_pic_predicted = false;
+		picture_id = kNoPictureId;
+		tl0_pic_idx = kNoTl0PicIdx;
+		temporal_idx = kNoTemporalIdx;
+		temporal_up_switch = false;
+		num_temporal_layers = 1;
+		width = 0;
+		height = 0;
+	}
+
+	bool inter_pic_predicted;	// P: This frame references other frames (false for a key frame)
+	int16_t picture_id;			// Picture ID index, 15 bits;
+	// kNoPictureId if PictureID does not exist.
+	int16_t tl0_pic_idx;		// TL0PICIDX, 8 bits;
+	// kNoTl0PicIdx means no value provided.
+	uint8_t temporal_idx;		// Temporal layer index, or kNoTemporalIdx.
+	bool temporal_up_switch;	// U: Switching up to a higher temporal layer is possible from this frame
+	uint8_t num_temporal_layers;	// The pattern of the temporal layers (GOF) is written in the scalability structure
+	// The resolution is written in the scalability structure of the key frame
+	uint16_t width;
+	uint16_t height;
+};
+
 union RTPVideoTypeHeader
 {
 	RTPVideoHeaderVP8 vp8;
 	RTPVideoHeaderH26X h26X;
-	// In the future
-	// RTPVideoHeaderVP9 VP9;
+	RTPVideoHeaderVP9 vp9;
 };
 
 struct RTPVideoHeader
@@ -92,6 +118,8 @@ struct RTPVideoHeader
 
 	uint8_t simulcast_idx; // Extension, 0이면 사용하지 않음
 	bool is_first_packet_in_frame;
+	// Temporal layer of the frame (0 if the frame is not scalable)
+	uint8_t temporal_idx;
 
 	cmn::MediaCodecId codec;
 	RTPVideoTypeHeader codec_header;
@@ -25,18 +25,13 @@ bool RtxRtpPacket::PackageAsRtx(uint32_t rtx_ssrc, uint8_t rtx_payload_type, con
 	// Put OSN
 	_origin_seq_no = src.SequenceNumber();
 
-	_payload_offset = _payload_offset + RTX_HEADER_SIZE;
-
-	if (_data->GetLength() < _payload_offset)
+	// Insert the OSN without copying the payload again
+	if (InsertAfterHeader(RTX_HEADER_SIZE) == nullptr)
 	{
-		_data->SetLength(_payload_offset);
-		_buffer = _data->GetWritableDataAs<uint8_t>();
+		return false;
 	}
 
 	SetOriginalSequenceNumber(_origin_seq_no);
-	
-	// Rewrite payload
-	SetPayload(src.Payload(), src.PayloadSize());
 
 	return true;
 }
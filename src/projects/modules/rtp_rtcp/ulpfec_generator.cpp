@@ -1,8 +1,18 @@
 #include "ulpfec_generator.h"
 #include "base/ovlibrary/byte_io.h"
+#include "base/ovlibrary/cpu_features.h"
 
 #include <string.h>
 
+#if defined(__SSE2__)
+#	include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#	include <arm_neon.h>
+#endif
+#if OV_CPU_DISPATCH_X86
+#	include <immintrin.h>
+#endif
+
 constexpr size_t 	kFecHeaderSize					= 10;
 constexpr size_t 	kMaskSizeLbitClear				= 2;
 constexpr size_t	kMaskSizeLbitSet				= 6;
@@ -12,6 +22,62 @@ constexpr size_t 	kUlpfecMaxMediaPacketsLbitClear	= 16;
 constexpr size_t 	kUlpfecMaxMediaPacketsLbitSet	= 48;
 
 constexpr size_t    kMediaPacketNumMakeFec          = 7; 
+// With high rate protection, a FEC packet protects fewer media packets
+constexpr size_t    kMediaPacketNumMakeFecHighLevel = 3;
+
+using XorBlockFunction = void (*)(uint8_t *dst, const uint8_t *src, size_t length);
+
+// dst ^= src, 16 bytes at a time where SIMD is available
+static void XorBlockBaseline(uint8_t *dst, const uint8_t *src, size_t length)
+{
+	size_t i = 0;
+
+#if defined(__SSE2__)
+	for (; i + 16 <= length; i += 16)
+	{
+		auto a = _mm_loadu_si128(reinterpret_cast<const __m128i *>(dst + i));
+		auto b = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i), _mm_xor_si128(a, b));
+	}
+#elif defined(__ARM_NEON)
+	for (; i + 16 <= length; i += 16)
+	{
+		vst1q_u8(dst + i, veorq_u8(vld1q_u8(dst + i), vld1q_u8(src + i)));
+	}
+#endif
+
+	for (; i < length; i++)
+	{
+		dst[i] ^= src[i];
+	}
+}
+
+#if OV_CPU_DISPATCH_X86
+// dst ^= src, 32 bytes at a time
+OV_TARGET_AVX2 static void XorBlockAvx2(uint8_t *dst, const uint8_t *src, size_t length)
+{
+	size_t i = 0;
+
+	for (; i + 32 <= length; i += 32)
+	{
+		auto a = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(dst + i));
+		auto b = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + i));
+		_mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + i), _mm256_xor_si256(a, b));
+	}
+
+	for (; i < length; i++)
+	{
+		dst[i] ^= src[i];
+	}
+}
+#endif
+
+static const XorBlockFunction XorBlock = ov::CpuFeatures::Select<XorBlockFunction>("fec.xor", {
+#if OV_CPU_DISPATCH_X86
+	{ov::CpuFeature::Avx2, "avx2", XorBlockAvx2},
+#endif
+	{ov::CpuFeature::None, OV_CPU_BASELINE_NAME, XorBlockBaseline},
+});
 
 UlpfecGenerator::UlpfecGenerator()
 {
@@ -61,8 +127,8 @@ bool UlpfecGenerator::NextPacket(RtpPacket *packet)
 bool UlpfecGenerator::Encode()
 {
 	size_t media_size = _media_packets.size();
-	//uint32_t rate = static_cast<uint32_t>(kMediaPacketNumMakeFec / (_high_level?2:1));
-	uint32_t fec_packet_count = static_cast<uint32_t>(std::ceil((float)media_size / (float)kMediaPacketNumMakeFec));
+	size_t media_packet_num_make_fec = _high_level ? kMediaPacketNumMakeFecHighLevel : kMediaPacketNumMakeFec;
+	uint32_t fec_packet_count = static_cast<uint32_t>((media_size + media_packet_num_make_fec - 1) / media_packet_num_make_fec);
 	uint32_t media_packet_idx = 0;
 	size_t mask_len = 0;
 
@@ -195,10 +261,7 @@ void UlpfecGenerator::XorFecPacket(uint8_t *fec_packet, size_t fec_header_len, R
 	fec_packet[9] ^= rtp_payload_length_network_order[1];
 
 	// XOR Payload
-	for(size_t i = 0; i < rtp_payload_len; i++)
-	{
-		fec_packet[fec_header_len + i] ^= rtp_payload[i];
-	}
+	XorBlock(&fec_packet[fec_header_len], rtp_payload, rtp_payload_len);
 }
 
 void UlpfecGenerator::FinalizeFecHeader(uint8_t *fec_packet, const size_t fec_payload_len, const uint8_t *mask, const size_t mask_len)
@@ -3,25 +3,6 @@
 
 std::tuple<std::shared_ptr<RtspData>, int> RtspData::Parse(const std::shared_ptr<const ov::Data> &data)
 {
-	if(data->GetLength() < 4)
-	{
-		// not enough data
-		return {nullptr, 0};
-	}
-
-	if(data->GetDataAs<uint8_t>()[0] != '$')
-	{
-		return {nullptr, -1};
-	}
-
-	auto rtsp_data = std::make_shared<RtspData>();
-	auto parsed_length = rtsp_data->ParseInternal(data);
-
-	return {parsed_length > 0? rtsp_data : nullptr, parsed_length};
-}
-
-int RtspData::ParseInternal(const std::shared_ptr<const ov::Data> &data)
-{	
 	// ${1 bytes Channel ID}{2 bytes Length}{Length bytes data}
 	// S->C: $\000{2 byte length}{"length" bytes data, w/RTP header}
 	// S->C: $\000{2 byte length}{"length" bytes data, w/RTP header}
@@ -30,7 +11,7 @@ int RtspData::ParseInternal(const std::shared_ptr<const ov::Data> &data)
 	if(data->GetLength() < RTSP_INTERLEAVED_DATA_HEADER_LEN)
 	{
 		// not enough data
-		return 0;
+		return {nullptr, 0};
 	}
 
 	auto ptr = data->GetDataAs<uint8_t>();
@@ -38,22 +19,22 @@ int RtspData::ParseInternal(const std::shared_ptr<const ov::Data> &data)
 	if(ptr[0] != '$')
 	{
 		// error
-		return -1;
+		return {nullptr, -1};
 	}
 
-	_channel_id = ByteReader<uint8_t>::ReadBigEndian(&ptr[1]);
+	auto channel_id = ByteReader<uint8_t>::ReadBigEndian(&ptr[1]);
 	auto data_length = ByteReader<uint16_t>::ReadBigEndian(&ptr[2]);
 
 	if(static_cast<size_t>(RTSP_INTERLEAVED_DATA_HEADER_LEN + data_length) > data->GetLength())
 	{
 		// not enough data
-		return 0;
+		return {nullptr, 0};
 	}
 
-	Clear();
-	Append(&ptr[4], data_length);
+	// The payload is parsed in place, it refers to the received data
+	auto rtsp_data = std::make_shared<RtspData>(channel_id, &ptr[RTSP_INTERLEAVED_DATA_HEADER_LEN], data_length, data);
 
-	return RTSP_INTERLEAVED_DATA_HEADER_LEN + data_length;;
+	return {rtsp_data, RTSP_INTERLEAVED_DATA_HEADER_LEN + data_length};
 }
 
 RtspData::RtspData(uint8_t channel_id, const std::shared_ptr<ov::Data> &data)
@@ -62,6 +43,12 @@ RtspData::RtspData(uint8_t channel_id, const std::shared_ptr<ov::Data> &data)
 	_channel_id = channel_id;
 }
 
+RtspData::RtspData(uint8_t channel_id, const void *payload, size_t length, const std::shared_ptr<const ov::Data> &owner)
+	: ov::Data(payload, length, owner)
+{
+	_channel_id = channel_id;
+}
+
 uint8_t RtspData::GetChannelId() const
 {
 	return _channel_id;
@@ -26,11 +26,11 @@ public:
 	// Only use in Parse()
 	RtspData(){}
 	RtspData(uint8_t channel_id, const std::shared_ptr<ov::Data> &data);
+	// References <length> bytes at <payload> without copying, <owner> keeps the payload alive
+	RtspData(uint8_t channel_id, const void *payload, size_t length, const std::shared_ptr<const ov::Data> &owner);
 
 	uint8_t GetChannelId() const;
 
 private:
-	int ParseInternal(const std::shared_ptr<const ov::Data> &data);
-
-	uint8_t _channel_id;
+	uint8_t _channel_id = 0;
 };
\ No newline at end of file
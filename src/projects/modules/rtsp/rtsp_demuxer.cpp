@@ -5,26 +5,33 @@ RtspDemuxer::RtspDemuxer()
 	_buffer = std::make_shared<ov::Data>();
 }
 
-bool RtspDemuxer::AppendPacket(const std::shared_ptr<ov::Data> &packet)
+bool RtspDemuxer::AppendPacket(const std::shared_ptr<const ov::Data> &packet)
 {
-	return AppendPacket(packet->GetDataAs<uint8_t>(), packet->GetLength());
-}
+	std::shared_ptr<const ov::Data> data;
 
-bool RtspDemuxer::AppendPacket(const uint8_t *data, size_t data_length)
-{
-	_buffer->Append(data, data_length);
+	if(_buffer->IsEmpty())
+	{
+		data = packet;
+	}
+	else
+	{
+		// The parsed items refer to the buffer, so a new buffer is used for the next remainder
+		_buffer->Append(packet);
+		data = std::move(_buffer);
+		_buffer = std::make_shared<ov::Data>();
+	}
 
-	while(_buffer->GetLength() > 0)
+	while(data->GetLength() > 0)
 	{
 		// Interleaved Binary data
-		if(_buffer->At(0) == '$')
+		if(data->GetDataAs<uint8_t>()[0] == '$')
 		{
-			auto [rtsp_data, result] = RtspData::Parse(_buffer);
+			auto [rtsp_data, result] = RtspData::Parse(data);
 			// Success
 			if(result > 0)
 			{
 				_datas.push(rtsp_data);
-				_buffer = _buffer->Subdata(result);
+				data = data->Subdata(result);
 				continue;
 			}
 			// Not enough buffer
@@ -41,12 +48,12 @@ bool RtspDemuxer::AppendPacket(const uint8_t *data, size_t data_length)
 		// Message
 		else
 		{
-			auto [rtsp_message, result] = RtspMessage::Parse(_buffer);
+			auto [rtsp_message, result] = RtspMessage::Parse(data);
 			// Success
 			if(result > 0)
 			{
 				_messages.push(rtsp_message);
-				_buffer = _buffer->Subdata(result);
+				data = data->Subdata(result);
 				continue;
 			}
 			// Not enough buffer
@@ -60,12 +67,24 @@ bool RtspDemuxer::AppendPacket(const uint8_t *data, size_t data_length)
 				return false;
 			}
 		}
-		
 	}
 
+	if(data->GetLength() > RTSP_DEMUXER_MAX_BUFFER_SIZE)
+	{
+		return false;
+	}
+
+	// Keep the remainder
+	_buffer->Append(data);
+
 	return true;
 }
 
+bool RtspDemuxer::AppendPacket(const uint8_t *data, size_t data_length)
+{
+	return AppendPacket(std::make_shared<const ov::Data>(data, data_length));
+}
+
 bool RtspDemuxer::IsAvailableMessage()
 {
 	return _messages.size() > 0;
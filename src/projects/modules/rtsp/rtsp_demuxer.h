@@ -12,11 +12,17 @@
 #include "rtsp_message.h"
 #include "rtsp_data.h"
 
+// A message or an interleaved data larger than this is regarded as an error
+#define RTSP_DEMUXER_MAX_BUFFER_SIZE	(1024 * 1024)
+
+// The messages and the interleaved data are parsed in place, so they refer to <packet> of AppendPacket() instead of copying it.
+// Only the incomplete remainder at the end of a packet is copied, to be completed by the next packet.
 class RtspDemuxer
 {
 public:
 	RtspDemuxer();
-	bool AppendPacket(const std::shared_ptr<ov::Data> &packet);
+	// <packet> must not be changed after it is appended
+	bool AppendPacket(const std::shared_ptr<const ov::Data> &packet);
 	bool AppendPacket(const uint8_t *data, size_t data_length);
 
 	bool IsAvailableMessage();
@@ -286,7 +286,7 @@ bool RtspMessage::SerializeHeader()
 	else if(_type == RtspMessageType::RESPONSE)
 	{
 		// RTSP/1.0 <Status code> <Reason phrase>\r\n
-		header.Format("RTSP/%s %d %s", _rtsp_version.CStr(), _status_code, _reason_phrase.CStr());
+		header.Format("RTSP/%s %d %s\r\n", _rtsp_version.CStr(), _status_code, _reason_phrase.CStr());
 	}
 	else
 	{
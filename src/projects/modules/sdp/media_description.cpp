@@ -134,6 +134,17 @@ bool MediaDescription::UpdateData(ov::String &sdp)
 		}
 	}
 
+	// Simulcast
+	if (IsSimulcast())
+	{
+		for (const auto &rid : _rid_list)
+		{
+			sdp.AppendFormat("a=rid:%s %s\r\n", rid.CStr(), _simulcast_direction.CStr());
+		}
+
+		sdp.AppendFormat("a=simulcast:%s %s\r\n", _simulcast_direction.CStr(), ov::String::Join(_simulcast_rid_list, ";").CStr());
+	}
+
 	// SSRCs
 	if (_cname.IsEmpty() == false)
 	{
@@ -182,16 +193,30 @@ bool MediaDescription::SetMediaType(const ov::String &type)
 
 bool MediaDescription::FromString(const ov::String &desc)
 {
-	std::stringstream sdpstream(desc.CStr());
-	std::string line;
+	const char *current = desc.CStr();
+	const char *end = current + desc.GetLength();
 
-	while (std::getline(sdpstream, line, '\n'))
+	while (current < end)
 	{
+		auto line_end = static_cast<const char *>(::memchr(current, '\n', end - current));
+		if (line_end == nullptr)
+		{
+			line_end = end;
+		}
+
+		std::string line(current, line_end - current);
+		current = line_end + 1;
+
 		if (line.size() && line[line.length() - 1] == '\r')
 		{
 			line.pop_back();
 		}
 
+		if (line.size() < 2)
+		{
+			continue;
+		}
+
 		char type = line[0];
 		std::string content = line.substr(2);
 
@@ -618,6 +643,52 @@ bool MediaDescription::ParsingMediaLine(char type, std::string content)
 
 				SetFramerate(ov::Converter::ToFloat(match.GetGroupAt(1).GetValue().CStr()));
 			}
+			else if (content.compare(0, OV_COUNTOF("rid:") - 1, "rid:") == 0)
+			{
+				// a=rid:h send
+				auto match = SDPRegexPattern::GetInstance()->MatchRid(content.c_str());
+				if (match.GetGroupCount() < 2 + 1)
+				{
+					parsing_error = true;
+					break;
+				}
+
+				AddRid(match.GetGroupAt(1).GetValue());
+			}
+			else if (content.compare(0, OV_COUNTOF("simulcast:") - 1, "simulcast:") == 0)
+			{
+				// a=simulcast:send h;m;l
+				// a=simulcast:send h,~h2;m;~l (alternatives are separated by ",", and "~" means that the stream is paused)
+				auto match = SDPRegexPattern::GetInstance()->MatchSimulcast(content.c_str());
+				if (match.GetGroupCount() != 2 + 1)
+				{
+					parsing_error = true;
+					break;
+				}
+
+				std::vector<ov::String> rid_list;
+				for (const auto &stream : match.GetGroupAt(2).GetValue().Split(";"))
+				{
+					auto alternatives = stream.Split(",");
+					if (alternatives.empty())
+					{
+						continue;
+					}
+
+					auto rid = alternatives.front();
+					if (rid.HasPrefix('~'))
+					{
+						rid = rid.Substring(1);
+					}
+
+					if (rid.IsEmpty() == false)
+					{
+						rid_list.push_back(rid);
+					}
+				}
+
+				SetSimulcast(match.GetGroupAt(1).GetValue(), rid_list);
+			}
 			// a=sendonly
 			else if (content.compare(0, OV_COUNTOF("se") - 1, "se") == 0 ||
 					 content.compare(0, OV_COUNTOF("re") - 1, "re") == 0 ||
@@ -1050,6 +1121,37 @@ bool MediaDescription::FindExtmapItem(const ov::String &keyword, uint8_t &id, ov
 	return false;
 }
 
+void MediaDescription::AddRid(const ov::String &rid)
+{
+	_rid_list.push_back(rid);
+}
+
+const std::vector<ov::String> &MediaDescription::GetRidList() const
+{
+	return _rid_list;
+}
+
+void MediaDescription::SetSimulcast(const ov::String &direction, const std::vector<ov::String> &rid_list)
+{
+	_simulcast_direction = direction;
+	_simulcast_rid_list = rid_list;
+}
+
+bool MediaDescription::IsSimulcast() const
+{
+	return _simulcast_rid_list.empty() == false;
+}
+
+const ov::String &MediaDescription::GetSimulcastDirection() const
+{
+	return _simulcast_direction;
+}
+
+const std::vector<ov::String> &MediaDescription::GetSimulcastRidList() const
+{
+	return _simulcast_rid_list;
+}
+
 // a=rtpmap:96 VP8/50000
 bool MediaDescription::AddRtpmap(uint8_t payload_type, const ov::String &codec,
 								 uint32_t rate, const ov::String &parameters)
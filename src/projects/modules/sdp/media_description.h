@@ -128,6 +128,18 @@ public:
 	ov::String GetExtmapItem(uint8_t id) const;
 	bool FindExtmapItem(const ov::String &keyword, uint8_t &id, ov::String &uri) const;
 
+	// a=rid:h send (RFC 8851)
+	// The direction of the RIDs is the direction of the simulcast
+	void AddRid(const ov::String &rid);
+	const std::vector<ov::String> &GetRidList() const;
+
+	// a=simulcast:send h;m;l (RFC 8853)
+	// The RIDs are kept in the order of the simulcast attribute (the alternatives are not supported, only the first one is used)
+	void SetSimulcast(const ov::String &direction, const std::vector<ov::String> &rid_list);
+	bool IsSimulcast() const;
+	const ov::String &GetSimulcastDirection() const;
+	const std::vector<ov::String> &GetSimulcastRidList() const;
+
 private:
 	bool UpdateData(ov::String &sdp) override;
 	bool ParsingMediaLine(char type, std::string content);
@@ -164,5 +176,9 @@ private:
 
 	std::map<uint8_t, ov::String> _extmap;
 
+	std::vector<ov::String> _rid_list;
+	ov::String _simulcast_direction;
+	std::vector<ov::String> _simulcast_rid_list;
+
 	std::vector<std::shared_ptr<PayloadAttr>> _payload_list;
 };
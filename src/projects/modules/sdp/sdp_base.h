@@ -29,6 +29,11 @@ public:
 protected:
 	virtual bool UpdateData(ov::String &sdp) = 0;
 
+	void SetSdpText(const ov::String &sdp)
+	{
+		_sdp_text = sdp;
+	}
+
 private:
 	ov::String _sdp_text;
 };
@@ -74,6 +74,9 @@ public:
 		RegisterPattern(_fmtp_pattern, R"(fmtp:(\*|\d*) (.*))");
 		RegisterPattern(_extmap_pattern, R"(^extmap:([\w_/]*) (\S*)(?: (\S*))?)");
 
+		RegisterPattern(_rid_pattern, R"(^rid:(\S+) (send|recv)(?: (\S*))?)");
+		RegisterPattern(_simulcast_pattern, R"(^simulcast:(send|recv) (\S+))");
+
 		_built = true;
 
 		return true;
@@ -114,6 +117,9 @@ public:
 	RegisterMatchFunction(_fmtp_pattern, MatchFmtp)
 	RegisterMatchFunction(_extmap_pattern, MatchExtmap)
 
+	RegisterMatchFunction(_rid_pattern, MatchRid)
+	RegisterMatchFunction(_simulcast_pattern, MatchSimulcast)
+
 private:
 	bool _built = false;
 
@@ -151,4 +157,7 @@ private:
 
 	ov::Regex _fmtp_pattern; // a=fmtp:96 packetization-mode=xx ~~
 	ov::Regex _extmap_pattern; // a=extmap:1 urn:ietf:params:~
+
+	ov::Regex _rid_pattern; // a=rid:h send
+	ov::Regex _simulcast_pattern; // a=simulcast:send h;m;l
 };
\ No newline at end of file
@@ -26,6 +26,71 @@ void SessionDescription::Release()
 }
 
 bool SessionDescription::UpdateData(ov::String &sdp)
+{
+	if (SerializeSessionLevel(sdp) == false)
+	{
+		return false;
+	}
+
+	// Media
+	_media_text.Clear();
+	_first_media_text_length = 0;
+
+	for(auto &media_description : _media_list)
+	{
+		_media_text += media_description->ToString();
+
+		if (_first_media_text_length == 0)
+		{
+			_first_media_text_length = _media_text.GetLength();
+		}
+	}
+
+	AppendMediaSections(sdp);
+
+	return true;
+}
+
+void SessionDescription::AppendMediaSections(ov::String &sdp) const
+{
+	if (_bundle_ice_candidates.empty())
+	{
+		sdp += _media_text;
+		return;
+	}
+
+	sdp += _media_text.Substring(0, _first_media_text_length);
+
+	for (auto &candidate : _bundle_ice_candidates)
+	{
+		sdp.AppendFormat("a=%s\r\n", candidate->ToString().CStr());
+	}
+
+	sdp += "a=end-of-candidates\r\n";
+	sdp += _media_text.Substring(_first_media_text_length);
+}
+
+bool SessionDescription::UpdateSessionLevel()
+{
+	if (_media_text.IsEmpty() && (_media_list.empty() == false))
+	{
+		return Update();
+	}
+
+	ov::String sdp;
+
+	if (SerializeSessionLevel(sdp) == false)
+	{
+		return false;
+	}
+
+	AppendMediaSections(sdp);
+	SetSdpText(sdp);
+
+	return true;
+}
+
+bool SessionDescription::SerializeSessionLevel(ov::String &sdp)
 {
 	// Session
 	sdp.Format(
@@ -77,75 +142,69 @@ bool SessionDescription::UpdateData(ov::String &sdp)
 
 	sdp += common_attr_text;
 
-	// Media
-	for(auto &media_description : _media_list)
-	{
-		sdp += media_description->ToString();
-	}
-
 	return true;
 }
 
 bool SessionDescription::FromString(const ov::String &sdp)
 {
-	static const std::regex ValidLineRegex("^([a-z])=(.*)");
-	std::stringstream sdpstream(sdp.CStr());
-	std::string line;
-
 	ov::String media_desc_sdp;
 	bool media_level = false;
 
-	while(std::getline(sdpstream, line, '\n'))
+	// Scans the lines in place (an answer is parsed for every session)
+	const char *current = sdp.CStr();
+	const char *end = current + sdp.GetLength();
+
+	while(current < end)
 	{
-		if(line.size() && line[line.length() - 1] == '\r')
+		auto line_end = static_cast<const char *>(::memchr(current, '\n', end - current));
+		if(line_end == nullptr)
+		{
+			line_end = end;
+		}
+
+		std::string_view line(current, line_end - current);
+		current = line_end + 1;
+
+		if(line.size() && line.back() == '\r')
 		{
-			line.pop_back();
+			line.remove_suffix(1);
 		}
 
-		if(!std::regex_search(line, ValidLineRegex))
+		// ^([a-z])=(.*)
+		if((line.size() < 2) || (line[0] < 'a') || (line[0] > 'z') || (line[1] != '='))
 		{
 			continue;
 		}
+
 		char type = line[0];
-		std::string content = line.substr(2);
 
 		if(type == 'm')
 		{
-			if(media_level == true)
+			if((media_level == true) && (ParseMedia(media_desc_sdp) == false))
 			{
-				auto media_desc = std::make_shared<MediaDescription>();
-				if(media_desc->FromString(media_desc_sdp) == false)
-				{
-					return false;
-				}
-				AddMedia(media_desc);
+				return false;
 			}
 
 			media_desc_sdp.Clear();
-			media_desc_sdp.AppendFormat("%s\n", line.c_str());
 			media_level = true;
 		}
-		else if(media_level == true)
+		else if(media_level == false)
 		{
-			media_desc_sdp.AppendFormat("%s\n", line.c_str());
-
-			if(sdpstream.rdbuf()->in_avail() == 0)
-			{
-				auto media_desc = std::make_shared<MediaDescription>();
-				if(media_desc->FromString(media_desc_sdp) == false)
-				{
-					return false;
-				}
-				AddMedia(media_desc);
-			}
-		}
-		else
-		{
-			if(ParsingSessionLine(type, content) == false)
+			if(ParsingSessionLine(type, std::string(line.substr(2))) == false)
 			{
 				return false;
 			}
+
+			continue;
 		}
+
+		media_desc_sdp.Append(line.data(), line.size());
+		media_desc_sdp.Append('\n');
+	}
+
+	if((media_level == true) && (ParseMedia(media_desc_sdp) == false))
+	{
+		return false;
 	}
 
 	Update();
@@ -153,6 +212,19 @@ bool SessionDescription::FromString(const ov::String &sdp)
 	return true;
 }
 
+bool SessionDescription::ParseMedia(const ov::String &media_desc_sdp)
+{
+	auto media_desc = std::make_shared<MediaDescription>();
+	if(media_desc->FromString(media_desc_sdp) == false)
+	{
+		return false;
+	}
+
+	AddMedia(media_desc);
+
+	return true;
+}
+
 bool SessionDescription::ParsingSessionLine(char type, std::string content)
 {
 	bool parsing_error = false;
@@ -546,6 +618,11 @@ const std::vector<std::shared_ptr<const MediaDescription>> &SessionDescription::
 	return _media_list;
 }
 
+void SessionDescription::AddBundleIceCandidate(const std::shared_ptr<IceCandidate> &ice_candidate)
+{
+	_bundle_ice_candidates.push_back(ice_candidate);
+}
+
 
 const std::shared_ptr<const MediaDescription> SessionDescription::GetFirstMedia() const
 {
@@ -52,6 +52,10 @@ public:
 
 	bool FromString(const ov::String &sdp) override;
 
+	// Serializes the session-level lines only, and reuses the media sections serialized by the last Update().
+	// It is for the copies of a prepared offer, which only differ in the session-level lines (o=, ice-ufrag, ...)
+	bool UpdateSessionLevel();
+
 	// v=0
 	void SetVersion(uint8_t version);
 	uint8_t GetVersion() const;
@@ -93,6 +97,10 @@ public:
 	const std::shared_ptr<const MediaDescription> GetMediaByMid(const ov::String &mid) const;
 	const std::vector<std::shared_ptr<const MediaDescription>> &GetMediaList() const;
 
+	// The candidates of the BUNDLE transport, which are written in the first media section.
+	// The media descriptions are shared by the copies of an offer, so the candidates of each copy are kept here.
+	void AddBundleIceCandidate(const std::shared_ptr<IceCandidate> &ice_candidate);
+
 	// Common attr
 	ov::String GetFingerprintAlgorithm() const override;
 	ov::String GetFingerprintValue() const override;
@@ -107,6 +115,9 @@ public:
 
 private:
 	bool UpdateData(ov::String &sdp) override;
+	bool SerializeSessionLevel(ov::String &sdp);
+	void AppendMediaSections(ov::String &sdp) const;
+	bool ParseMedia(const ov::String &media_desc_sdp);
 	bool ParsingSessionLine(char type, std::string content);
 
 	// version
@@ -142,4 +153,9 @@ private:
 
 	// Media
 	std::vector<std::shared_ptr<const MediaDescription>> _media_list;
+	// Serialized _media_list by the last Update()
+	ov::String _media_text;
+	size_t _first_media_text_length = 0;
+
+	std::vector<std::shared_ptr<IceCandidate>> _bundle_ice_candidates;
 };
\ No newline at end of file
@@ -765,8 +765,7 @@ bool Writer::WritePacket(const std::shared_ptr<const MediaPacket> &packet)
 			break;
 
 		case cmn::BitstreamFormat::H264_ANNEXB:
-			data = packet->GetData();
-			data = H264Converter::ConvertAnnexbToAvcc(data);
+			data = H264Converter::ConvertAnnexbToAvcc(packet);
 			length_list.push_back(data->GetLength());
 			break;
 
@@ -803,6 +802,8 @@ bool Writer::WritePacket(const std::shared_ptr<const MediaPacket> &packet)
 			[[fallthrough]];
 		case cmn::BitstreamFormat::H264_RTP_RFC_6184:
 			[[fallthrough]];
+		case cmn::BitstreamFormat::H265_RTP_RFC_7798:
+			[[fallthrough]];
 		case cmn::BitstreamFormat::VP8_RTP_RFC_7741:
 			[[fallthrough]];
 		case cmn::BitstreamFormat::AAC_MPEG4_GENERIC:
@@ -13,6 +13,13 @@
 
 class WhipInterceptor : public http::svr::DefaultInterceptor
 {
+public:
+	// <direction> is the value of the "direction" query ("whip" or "whep")
+	WhipInterceptor(const ov::String &direction = "whip")
+		: _direction(direction)
+	{
+	}
+
 protected:
 	bool IsInterceptorForRequest(const std::shared_ptr<const http::svr::HttpExchange> &exchange) override
 	{
@@ -29,7 +36,7 @@ protected:
 			request->GetMethod() == http::Method::Options)
 		{
 			auto direction = uri->GetQueryValue("direction");
-			if (direction == "whip")
+			if (direction == _direction)
 			{
 				return true;
 			}
@@ -37,4 +44,7 @@ protected:
 
 		return false;
 	}
+
+private:
+	ov::String _direction;
 };
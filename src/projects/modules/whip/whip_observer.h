@@ -59,9 +59,15 @@ public:
 		ov::String _error_message;
 	};
 
+	// <offer_sdp> is nullptr if the request has no body (WHEP in which the server makes the offer)
 	virtual Answer OnSdpOffer(const std::shared_ptr<const http::svr::HttpRequest> &request,
 								const std::shared_ptr<const SessionDescription> &offer_sdp) = 0;
 
+	// Called when the client PATCHes its answer (application/sdp) to the offer that was returned for POST
+	virtual Answer OnSdpAnswer(const std::shared_ptr<const http::svr::HttpRequest> &request,
+							   const ov::String &session_key,
+							   const std::shared_ptr<const SessionDescription> &answer_sdp) { return {http::StatusCode::UnsupportedMediaType, "SDP answer is not supported"}; }
+
 	virtual Answer OnTrickleCandidate(const std::shared_ptr<const http::svr::HttpRequest> &request,
 									const ov::String &session_id,
 									const ov::String &if_match,
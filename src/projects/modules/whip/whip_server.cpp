@@ -13,8 +13,9 @@
 #include "whip_interceptor.h"
 #include "whip_private.h"
 
-WhipServer::WhipServer(const cfg::bind::cmm::Webrtc &webrtc_bind_cfg)
-	: _webrtc_bind_cfg(webrtc_bind_cfg)
+WhipServer::WhipServer(const cfg::bind::cmm::Webrtc &webrtc_bind_cfg, const ov::String &direction)
+	: _webrtc_bind_cfg(webrtc_bind_cfg),
+	  _direction(direction)
 {
 }
 
@@ -279,7 +280,7 @@ ov::String WhipServer::GetIceServerLinkValue(const ov::String &URL, const ov::St
 
 std::shared_ptr<WhipInterceptor> WhipServer::CreateInterceptor()
 {
-	auto interceptor = std::make_shared<WhipInterceptor>();
+	auto interceptor = std::make_shared<WhipInterceptor>(_direction);
 
 	// OPTION
 	interceptor->Register(http::Method::Options, R"([\s\S]*)", [this](const std::shared_ptr<http::svr::HttpExchange> &exchange) -> http::svr::NextHandler {
@@ -329,13 +330,6 @@ std::shared_ptr<WhipInterceptor> WhipServer::CreateInterceptor()
 			return http::svr::NextHandler::DoNotCall;
 		}
 
-		// Check if Content-Type is application/sdp
-		auto content_type = request->GetHeader("Content-Type");
-		if (content_type.IsEmpty() || content_type != "application/sdp")
-		{
-			logtw("Content-Type is not application/sdp: %s", content_type.CStr());
-		}
-
 		auto requested_url = request->GetParsedUri();
 		if (requested_url == nullptr)
 		{
@@ -344,22 +338,53 @@ std::shared_ptr<WhipInterceptor> WhipServer::CreateInterceptor()
 			return http::svr::NextHandler::DoNotCall;
 		}
 
-		auto data = request->GetRequestBody();
-		if (data == nullptr)
+		// While the server is draining, new viewers are redirected to another server (or asked to retry later)
+		auto orchestrator = ocst::Orchestrator::GetInstance();
+		if ((_direction == "whep") && orchestrator->IsDraining())
 		{
-			logte("Could not get request body");
-			response->SetStatusCode(http::StatusCode::BadRequest);
+			auto vhost_app_name = orchestrator->ResolveApplicationNameFromDomain(requested_url->Host(), requested_url->App());
+			if (vhost_app_name.IsValid())
+			{
+				_cors_manager.SetupHttpCorsHeader(vhost_app_name, request, response);
+			}
+
+			auto redirect_url = orchestrator->GetDrainRedirectUrl(requested_url);
+			if (redirect_url != nullptr)
+			{
+				response->SetStatusCode(http::StatusCode::TemporaryRedirect);
+				response->SetHeader("Location", redirect_url->ToUrlString(true));
+			}
+			else
+			{
+				response->SetStatusCode(http::StatusCode::ServiceUnavailable);
+				response->SetHeader("Retry-After", ov::Converter::ToString(OCST_DRAIN_RETRY_AFTER_SEC));
+			}
+
 			return http::svr::NextHandler::DoNotCall;
 		}
 
-		logtd("WHIP SDP Offer: %s", data->ToString().CStr());
+		std::shared_ptr<SessionDescription> offer_sdp;
 
-		auto offer_sdp = std::make_shared<SessionDescription>();
-		if (offer_sdp->FromString(data->ToString()) == false)
+		// The request has no body if the client wants the server to make the offer (WHEP)
+		auto data = request->GetRequestBody();
+		if ((data != nullptr) && (data->GetLength() > 0))
 		{
-			logte("Could not parse SDP: %s", data->ToString().CStr());
-			response->SetStatusCode(http::StatusCode::BadRequest);
-			return http::svr::NextHandler::DoNotCall;
+			// Check if Content-Type is application/sdp
+			auto content_type = request->GetHeader("Content-Type");
+			if (content_type.IsEmpty() || content_type != "application/sdp")
+			{
+				logtw("Content-Type is not application/sdp: %s", content_type.CStr());
+			}
+
+			logtd("WHIP SDP Offer: %s", data->ToString().CStr());
+
+			offer_sdp = std::make_shared<SessionDescription>();
+			if (offer_sdp->FromString(data->ToString()) == false)
+			{
+				logte("Could not parse SDP: %s", data->ToString().CStr());
+				response->SetStatusCode(http::StatusCode::BadRequest);
+				return http::svr::NextHandler::DoNotCall;
+			}
 		}
 
 		auto answer = _observer->OnSdpOffer(request, offer_sdp);
@@ -381,7 +406,8 @@ std::shared_ptr<WhipInterceptor> WhipServer::CreateInterceptor()
 			// Set SDP
 			response->SetHeader("Content-Type", "application/sdp");
 			response->SetHeader("ETag", answer._entity_tag);
-			response->SetHeader("Location", ov::String::FormatString("/%s/%s/%s", requested_url->App().CStr(), requested_url->Stream().CStr(), answer._session_id.CStr()));
+			// The direction query is kept so that PATCH/DELETE to the location are handled by this server
+			response->SetHeader("Location", ov::String::FormatString("/%s/%s/%s?direction=%s", requested_url->App().CStr(), requested_url->Stream().CStr(), answer._session_id.CStr(), _direction.CStr()));
 
 			// IF TcpForce == true or ?transport=tcp
 			if (_tcp_force == true || requested_url->GetQueryValue("transport").UpperCaseString() == "TCP")
@@ -479,12 +505,7 @@ std::shared_ptr<WhipInterceptor> WhipServer::CreateInterceptor()
 			return http::svr::NextHandler::DoNotCall;
 		}
 
-		// Check if Content-Type is application/trickle-ice-sdpfrag
 		auto content_type = request->GetHeader("Content-Type");
-		if (content_type.IsEmpty() || content_type != "application/trickle-ice-sdpfrag")
-		{
-			logte("Content-Type is not application/trickle-ice-sdpfrag");
-		}
 
 		auto request_url = request->GetParsedUri();
 		if (request_url == nullptr)
@@ -507,6 +528,44 @@ std::shared_ptr<WhipInterceptor> WhipServer::CreateInterceptor()
 		// Set CORS header in response
 		_cors_manager.SetupHttpCorsHeader(vhost_app_name, request, response);
 
+		// The answer to the offer that was returned for POST (WHEP)
+		if (content_type == "application/sdp")
+		{
+			auto session_key = request_url->File();
+			auto data = request->GetRequestBody();
+			if (session_key.IsEmpty() || (data == nullptr))
+			{
+				logte("Could not get session key or SDP answer: %s", request_url->ToUrlString(true).CStr());
+				response->SetStatusCode(http::StatusCode::BadRequest);
+				return http::svr::NextHandler::DoNotCall;
+			}
+
+			auto answer_sdp = std::make_shared<SessionDescription>();
+			if (answer_sdp->FromString(data->ToString()) == false)
+			{
+				logte("Could not parse SDP: %s", data->ToString().CStr());
+				response->SetStatusCode(http::StatusCode::BadRequest);
+				return http::svr::NextHandler::DoNotCall;
+			}
+
+			auto answer = _observer->OnSdpAnswer(request, session_key, answer_sdp);
+			response->SetStatusCode(answer._status_code);
+
+			if (answer._error_message.IsEmpty() == false)
+			{
+				response->SetHeader("Content-Type", "text/plain");
+				response->AppendString(answer._error_message);
+			}
+
+			return http::svr::NextHandler::DoNotCall;
+		}
+
+		// Check if Content-Type is application/trickle-ice-sdpfrag
+		if (content_type.IsEmpty() || content_type != "application/trickle-ice-sdpfrag")
+		{
+			logte("Content-Type is not application/trickle-ice-sdpfrag");
+		}
+
 		auto session_id = request_url->GetQueryValue("session");
 		if (session_id.IsEmpty())
 		{
@@ -16,7 +16,8 @@
 class WhipServer : public ov::EnableSharedFromThis<WhipServer>
 {
 public:
-	WhipServer(const cfg::bind::cmm::Webrtc &webrtc_bind_cfg);
+	// <direction> is the value of the "direction" query that this server handles ("whip" or "whep")
+	WhipServer(const cfg::bind::cmm::Webrtc &webrtc_bind_cfg, const ov::String &direction = "whip");
 
 	bool Start(
 		const std::shared_ptr<WhipObserver> &observer,
@@ -73,6 +74,7 @@ private:
 	ov::String GetIceServerLinkValue(const ov::String &URL, const ov::String &username, const ov::String &credential);
 
 	const cfg::bind::cmm::Webrtc _webrtc_bind_cfg;
+	const ov::String _direction;
 
 	std::shared_ptr<WhipObserver> _observer;
 
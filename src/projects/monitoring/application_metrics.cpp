@@ -53,6 +53,7 @@ namespace mon
         }
 
         _streams[stream.GetId()] = stream_metrics;
+        _streams_generation = NextGeneration();
 
         logti("Create StreamMetrics(%s/%s) for monitoring", stream.GetName().CStr(), stream.GetUUID().CStr());
         return true;
@@ -74,6 +75,7 @@ namespace mon
         std::unique_lock<std::shared_mutex> lock(_streams_guard);
         {
             _streams.erase(stream.GetId());
+            _streams_generation = NextGeneration();
         }
 
         return true;
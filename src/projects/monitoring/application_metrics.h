@@ -50,6 +50,11 @@ namespace mon
 		bool OnStreamDeleted(const info::Stream &stream);
 		std::map<uint32_t, std::shared_ptr<StreamMetrics>> GetStreamMetricsMap();
 		std::shared_ptr<StreamMetrics> GetStreamMetrics(const info::Stream &stream);
+		// Changed whenever a stream is created or deleted
+		uint64_t GetStreamsGeneration() const
+		{
+			return _streams_generation;
+		}
 
 		bool OnStreamReserved(ProviderType who, const ov::Url &stream_uri, const ov::String &stream_name);
 		bool OnStreamCanceled(const ov::Url &stream_uri); // Reservation Canceled
@@ -62,6 +67,7 @@ namespace mon
 		std::shared_ptr<HostMetrics> _host_metrics;
 		std::shared_mutex _streams_guard;
 		std::map<uint32_t, std::shared_ptr<StreamMetrics>> _streams;
+		std::atomic<uint64_t> _streams_generation{NextGeneration()};
 
 		mutable std::shared_mutex _reserved_streams_guard;
 		std::map<uint32_t, std::shared_ptr<ReservedStreamMetrics>> _reserved_streams;
@@ -8,16 +8,32 @@ namespace mon
 {
 	#define THROUGHPUT_MEASURE_INTERVAL 1
 
+	static int64_t ToNanoseconds(const std::chrono::system_clock::time_point &time)
+	{
+		return std::chrono::duration_cast<std::chrono::nanoseconds>(time.time_since_epoch()).count();
+	}
+
+	uint64_t CommonMetrics::NextGeneration()
+	{
+		static std::atomic<uint64_t> last_generation{0};
+
+		return ++last_generation;
+	}
+
     CommonMetrics::CommonMetrics()
     {
-        _total_bytes_in = 0;
-        _total_bytes_out = 0;
+		auto now = ToNanoseconds(std::chrono::system_clock::now());
+
+		_counter_shards = std::make_unique<CounterShard[]>(METRICS_COUNTER_SHARD_COUNT);
+		_counter_shards[0]._last_recv_time = now;
+		_counter_shards[0]._last_sent_time = now;
+
         _total_connections = 0;
 		_max_total_connections = 0;
 
 		_avg_throughtput_in = 0;
 		_max_throughtput_in = 0;		
-		_last_total_bytes_out = 0;
+		_last_total_bytes_in = 0;
 
 		_avg_throughtput_out = 0;
 		_max_throughtput_out = 0;
@@ -26,12 +42,9 @@ namespace mon
 		_last_throughput_measure_time = std::chrono::system_clock::now();
 
         _max_total_connection_time = std::chrono::system_clock::now();
-		_last_recv_time = std::chrono::system_clock::now();
-        _last_sent_time = std::chrono::system_clock::now();
 
         for(int i=0; i<static_cast<int8_t>(PublisherType::NumberOfPublishers); i++)
         {
-            _publisher_metrics[i]._bytes_out = 0;
             _publisher_metrics[i]._connections = 0;
         }
         _created_time = std::chrono::system_clock::now();
@@ -78,18 +91,49 @@ namespace mon
 		return _created_time;
 	}
 
-    const std::chrono::system_clock::time_point& CommonMetrics::GetLastUpdatedTime() const
+    std::chrono::system_clock::time_point CommonMetrics::GetLastUpdatedTime() const
     {
-        return _last_updated_time;
+		// The traffic doesn't renew _last_updated_time, it is taken from the shards
+		return std::max({_last_updated_time, GetLastRecvTime(), GetLastSentTime()});
     }
 
+	CommonMetrics::CounterShard &CommonMetrics::GetCounterShard()
+	{
+		// Threads are assigned to the shards in turn, so the sessions of the worker threads rarely share a shard
+		static std::atomic<uint32_t> next_shard_index{0};
+		static thread_local uint32_t shard_index = next_shard_index++ % METRICS_COUNTER_SHARD_COUNT;
+
+		return _counter_shards[shard_index];
+	}
+
+	std::chrono::system_clock::time_point CommonMetrics::GetLastTime(std::atomic<int64_t> CounterShard::*time) const
+	{
+		int64_t last_time = 0;
+		for (int i = 0; i < METRICS_COUNTER_SHARD_COUNT; i++)
+		{
+			last_time = std::max(last_time, (_counter_shards[i].*time).load(std::memory_order_relaxed));
+		}
+
+		return std::chrono::system_clock::time_point(std::chrono::duration_cast<std::chrono::system_clock::duration>(std::chrono::nanoseconds(last_time)));
+	}
+
     uint64_t CommonMetrics::GetTotalBytesIn() const
 	{
-		return _total_bytes_in;
+		uint64_t total = 0;
+		for (int i = 0; i < METRICS_COUNTER_SHARD_COUNT; i++)
+		{
+			total += _counter_shards[i]._bytes_in.load(std::memory_order_relaxed);
+		}
+		return total;
 	}
 	uint64_t CommonMetrics::GetTotalBytesOut() const
 	{
-		return _total_bytes_out;
+		uint64_t total = 0;
+		for (int i = 0; i < METRICS_COUNTER_SHARD_COUNT; i++)
+		{
+			total += _counter_shards[i]._bytes_out.load(std::memory_order_relaxed);
+		}
+		return total;
 	}
 
     uint64_t CommonMetrics::GetAvgThroughputIn() const
@@ -128,17 +172,22 @@ namespace mon
 
 	std::chrono::system_clock::time_point CommonMetrics::GetLastRecvTime() const
 	{
-		return _last_recv_time;
+		return GetLastTime(&CounterShard::_last_recv_time);
 	}
 
 	std::chrono::system_clock::time_point CommonMetrics::GetLastSentTime() const
 	{
-		return _last_sent_time;
+		return GetLastTime(&CounterShard::_last_sent_time);
 	}
 
 	uint64_t CommonMetrics::GetBytesOut(PublisherType type) const
 	{
-		return _publisher_metrics[static_cast<int8_t>(type)]._bytes_out;
+		uint64_t total = 0;
+		for (int i = 0; i < METRICS_COUNTER_SHARD_COUNT; i++)
+		{
+			total += _counter_shards[i]._publisher_bytes_out[static_cast<int8_t>(type)].load(std::memory_order_relaxed);
+		}
+		return total;
 	}
 	uint64_t CommonMetrics::GetConnections(PublisherType type) const
 	{
@@ -147,14 +196,13 @@ namespace mon
 
     void CommonMetrics::IncreaseBytesIn(uint64_t value)
 	{
-		_total_bytes_in += value;
-		_last_recv_time = std::chrono::system_clock::now();
+		auto &shard = GetCounterShard();
+		shard._bytes_in.fetch_add(value, std::memory_order_relaxed);
+		shard._last_recv_time.store(ToNanoseconds(std::chrono::system_clock::now()), std::memory_order_relaxed);
 
 		// If there are no clients of the publisher, output throughput is not calculated.
 		// So, In/Oout throughput calculations are handled here.
 		UpdateThroughput();
-
-		UpdateDate();
 	}
 
 	void CommonMetrics::IncreaseBytesOut(PublisherType type, uint64_t value)
@@ -164,11 +212,10 @@ namespace mon
 			return;
 		}
 		
-		_publisher_metrics[static_cast<int8_t>(type)]._bytes_out += value;
-		_total_bytes_out += value;
-		_last_sent_time = std::chrono::system_clock::now();
-
-		UpdateDate();
+		auto &shard = GetCounterShard();
+		shard._publisher_bytes_out[static_cast<int8_t>(type)].fetch_add(value, std::memory_order_relaxed);
+		shard._bytes_out.fetch_add(value, std::memory_order_relaxed);
+		shard._last_sent_time.store(ToNanoseconds(std::chrono::system_clock::now()), std::memory_order_relaxed);
 	}
 
 	void CommonMetrics::OnSessionConnected(PublisherType type)
@@ -214,20 +261,22 @@ namespace mon
 			_last_throughput_measure_time = throughput_measure_time;
 
 			// Calculate average throughput of provider
-			_avg_throughtput_in = (_total_bytes_in.load() - _last_total_bytes_in.load()) * 8 / THROUGHPUT_MEASURE_INTERVAL;
+			auto total_bytes_in = GetTotalBytesIn();
+			_avg_throughtput_in = (total_bytes_in - _last_total_bytes_in.load()) * 8 / THROUGHPUT_MEASURE_INTERVAL;
 			if (_avg_throughtput_in.load() > _max_throughtput_in.load())
 			{
 				_max_throughtput_in.store(_avg_throughtput_in);
 			}
-			_last_total_bytes_in.store(_total_bytes_in);
+			_last_total_bytes_in.store(total_bytes_in);
 
 			// Calculate average throughput of publisher
-			_avg_throughtput_out =  (_total_bytes_out.load() - _last_total_bytes_out.load()) * 8 / THROUGHPUT_MEASURE_INTERVAL;
+			auto total_bytes_out = GetTotalBytesOut();
+			_avg_throughtput_out =  (total_bytes_out - _last_total_bytes_out.load()) * 8 / THROUGHPUT_MEASURE_INTERVAL;
 			if(_avg_throughtput_out.load() > _max_throughtput_out.load())
 			{
 				_max_throughtput_out.store(_avg_throughtput_out);
 			}
-			_last_total_bytes_out.store(_total_bytes_out);
+			_last_total_bytes_out.store(total_bytes_out);
 		}
 	}	
 }
\ No newline at end of file
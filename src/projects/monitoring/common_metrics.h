@@ -8,6 +8,9 @@
 #include "base/info/info.h"
 #include "base/info/stream.h"
 
+// The byte counters are split into this number of shards, and the sessions of different threads update different shards
+#define METRICS_COUNTER_SHARD_COUNT		16
+
 namespace mon
 {
 	class CommonMetrics
@@ -18,7 +21,7 @@ namespace mon
 
 		uint32_t GetUnusedTimeSec() const;
 		const std::chrono::system_clock::time_point& GetCreatedTime() const;
-		const std::chrono::system_clock::time_point& GetLastUpdatedTime() const;
+		std::chrono::system_clock::time_point GetLastUpdatedTime() const;
 		
 		virtual uint64_t GetTotalBytesIn() const;
 		virtual uint64_t GetTotalBytesOut() const;
@@ -40,6 +43,10 @@ namespace mon
 		virtual void OnSessionDisconnected(PublisherType type);
 		virtual void OnSessionsDisconnected(PublisherType type, uint64_t number_of_sessions);
 
+		// Returns a new generation for the registries of the metrics (the hosts, applications and streams).
+		// The generations are unique across all registries, so a registry that is recreated never repeats the generation of the old one.
+		static uint64_t NextGeneration();
+
 	protected:
 		CommonMetrics();
 		~CommonMetrics() = default;
@@ -51,19 +58,32 @@ namespace mon
 		std::chrono::system_clock::time_point _created_time;
 		std::chrono::system_clock::time_point _last_updated_time;
 
-		// From Provider
-		std::atomic<uint64_t> _total_bytes_in;
+		// IncreaseBytesIn/Out() are called for every packet of every session, and a counter shared by all threads
+		// makes them contend for the same cache line (StreamMetrics also forwards to Application/Host/Server).
+		// So each thread updates its own shard, and the shards are summed when the counters are read.
+		struct alignas(64) CounterShard
+		{
+			// From Provider
+			std::atomic<uint64_t> _bytes_in{0};
+			// From Publishers
+			std::atomic<uint64_t> _bytes_out{0};
+			std::atomic<uint64_t> _publisher_bytes_out[static_cast<int8_t>(PublisherType::NumberOfPublishers)]{};
+
+			// Nanoseconds since epoch
+			std::atomic<int64_t> _last_recv_time{0};
+			std::atomic<int64_t> _last_sent_time{0};
+		};
+
+		CounterShard &GetCounterShard();
+		std::chrono::system_clock::time_point GetLastTime(std::atomic<int64_t> CounterShard::*time) const;
 
-		// From Publishers
-		std::atomic<uint64_t> _total_bytes_out;
+		std::unique_ptr<CounterShard[]> _counter_shards;
 
 		std::atomic<uint32_t> _total_connections;
 		std::atomic<uint32_t> _max_total_connections;
 		// Time to reach maximum number of connections. 
 		// TODO(Getroot): Does it need mutex? Check!
 		std::chrono::system_clock::time_point	_max_total_connection_time;
-		std::chrono::system_clock::time_point	_last_recv_time;
-		std::chrono::system_clock::time_point	_last_sent_time;
 
 		// Throughput from Provider
 		std::atomic<uint64_t> _avg_throughtput_in;
@@ -82,7 +102,6 @@ namespace mon
 		class PublisherMetrics
 		{
 		public:
-			std::atomic<uint64_t> _bytes_out;
 			std::atomic<uint32_t> _connections;
 		};
 
@@ -0,0 +1,98 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/ovlibrary/ovlibrary.h>
+
+#include <atomic>
+#include <mutex>
+
+namespace mon
+{
+	// Metrics of a decoder of the transcoder (a decoder per input track)
+	class DecoderMetrics
+	{
+	public:
+		DecoderMetrics(int32_t track_id)
+			: _track_id(track_id)
+		{
+		}
+
+		int32_t GetTrackId() const
+		{
+			return _track_id;
+		}
+
+		ov::String GetCodecName() const
+		{
+			std::lock_guard<std::mutex> lock_guard(_mutex);
+			return _codec_name;
+		}
+
+		// 0: Decided by the decoder
+		int32_t GetThreadCount() const
+		{
+			return _thread_count;
+		}
+
+		ov::String GetThreadType() const
+		{
+			std::lock_guard<std::mutex> lock_guard(_mutex);
+			return _thread_type;
+		}
+
+		void SetCodec(const ov::String &codec_name, int32_t thread_count, const ov::String &thread_type)
+		{
+			std::lock_guard<std::mutex> lock_guard(_mutex);
+
+			_codec_name = codec_name;
+			_thread_count = thread_count;
+			_thread_type = thread_type;
+		}
+
+		uint64_t GetDecodedFrameCount() const
+		{
+			return _decoded_frame_count;
+		}
+
+		// Moving average of the time from sending a packet to receiving the frame of it
+		int64_t GetDecodingLatencyInUs() const
+		{
+			return _decoding_latency_in_us;
+		}
+
+		int64_t GetMaxDecodingLatencyInUs() const
+		{
+			return _max_decoding_latency_in_us;
+		}
+
+		// Called on the decoder thread
+		void OnFrameDecoded(int64_t latency_in_us)
+		{
+			_decoded_frame_count++;
+			_decoding_latency_in_us = (_decoded_frame_count == 1) ? latency_in_us : static_cast<int64_t>(_decoding_latency_in_us * 0.9 + latency_in_us * 0.1);
+
+			if (latency_in_us > _max_decoding_latency_in_us)
+			{
+				_max_decoding_latency_in_us = latency_in_us;
+			}
+		}
+
+	private:
+		int32_t _track_id;
+
+		mutable std::mutex _mutex;
+		ov::String _codec_name;
+		std::atomic<int32_t> _thread_count{0};
+		ov::String _thread_type;
+
+		std::atomic<uint64_t> _decoded_frame_count{0};
+		std::atomic<int64_t> _decoding_latency_in_us{0};
+		std::atomic<int64_t> _max_decoding_latency_in_us{0};
+	};
+}  // namespace mon
@@ -146,60 +146,65 @@ namespace mon
 
 	ov::String Event::SerializeToJson() const
 	{
-		Json::Value json_root;
+		// The statistics of all streams are written directly without Json::Value
+		ov::JsonWriter writer;
+
+		writer.BeginObject();
 
 		// Fill common values
-		json_root["eventVersion"] = EVENT_VERSION;
-		json_root["timestampMillis"] = _creation_time_msec;
-		json_root["userKey"] = _server_metric->GetConfig()->GetAnalytics().GetUserKey().CStr();
-		json_root["serverID"] = _server_metric->GetConfig()->GetID().CStr();
-		
+		writer.Write("eventVersion", EVENT_VERSION);
+		writer.Write("timestampMillis", _creation_time_msec);
+		writer.Write("userKey", _server_metric->GetConfig()->GetAnalytics().GetUserKey());
+		writer.Write("serverID", _server_metric->GetConfig()->GetID());
+
 		// Fill root["event"]
-		Json::Value &json_event = json_root["event"];
-		json_event["type"] = GetTypeString().CStr();
+		writer.BeginObject("event");
+		writer.Write("type", GetTypeString());
 		if(_message.IsEmpty() == false)
 		{
-			json_event["message"] = _message.CStr();
+			writer.Write("message", _message);
 		}
-		
-		Json::Value &json_producer = json_event["producer"];
+
+		Json::Value json_producer;
 		FillProducer(json_producer);
+		writer.Write("producer", json_producer);
+		writer.EndObject();
 
 		// Fill root["data"]
-		Json::Value &json_data = json_root["data"];
+		writer.Key("data");
 
 		if(_category == EventCategory::StreamEventType)
 		{
+			writer.BeginObject();
+
 			//TODO(Getroot): Implement this
-			json_data["dataType"] = "Not Implemented";
+			writer.Write("dataType", "Not Implemented");
 
-			Json::Value &json_server_info = json_data["serverInfo"];
+			Json::Value json_server_info;
 			FillServerInfo(json_server_info);
+			writer.Write("serverInfo", json_server_info);
+
+			writer.EndObject();
 		}
 		else if(_category == EventCategory::StatisticsEventType)
 		{
-			Json::Value &json_server_stat = json_data["serverStat"];
-			FillServerStatistics(json_server_stat);
-		}
+			writer.BeginObject();
+
+			writer.Key("serverStat");
+			WriteServerStatistics(writer);
 
-		Json::StreamWriterBuilder builder;
-		/* 
-			Default StreamWriterBuilder settings
+			writer.EndObject();
+		}
+		else
+		{
+			writer.Null();
+		}
 
-		  	(*settings)["commentStyle"] = "All";
-			(*settings)["indentation"] = "\t";
-			(*settings)["enableYAMLCompatibility"] = false;
-			(*settings)["dropNullPlaceholders"] = false;
-			(*settings)["useSpecialFloats"] = false;
-			(*settings)["emitUTF8"] = false;
-			(*settings)["precision"] = 17;
-			(*settings)["precisionType"] = "significant";
-		*/
+		writer.EndObject();
 
-		logtd("%s", json_root.toStyledString().c_str());
+		logtd("%s", writer.GetString().CStr());
 
-		builder["indentation"] = "";
-		return Json::writeString(builder, json_root).c_str();
+		return writer.GetString();
 	}
 
 	bool Event::FillProducer(Json::Value &json_producer) const
@@ -353,64 +358,85 @@ namespace mon
 		return true;
 	}
 
-	bool Event::FillServerStatistics(Json::Value &json_server_stat) const
+	bool Event::WriteServerStatistics(ov::JsonWriter &writer) const
 	{
-		json_server_stat["serverID"] = _server_metric->GetConfig()->GetID().CStr();
-		json_server_stat["serverName"] = _server_metric->GetConfig()->GetName().CStr();
-		json_server_stat["stat"] = serdes::JsonFromMetrics(_server_metric);
-		Json::Value &json_hosts = json_server_stat["hosts"];
+		writer.BeginObject();
+
+		writer.Write("serverID", _server_metric->GetConfig()->GetID());
+		writer.Write("serverName", _server_metric->GetConfig()->GetName());
+		writer.Key("stat");
+		serdes::WriteMetrics(writer, _server_metric);
+
+		writer.BeginArray("hosts");
 
 		for(const auto& [host_key, host_metric] : _server_metric->GetHostMetricsList())
 		{
-			Json::Value json_host;
+			writer.BeginObject();
 
-			json_host["hostID"] = host_metric->GetUUID().CStr();
-			json_host["hostName"] = host_metric->GetName().CStr();
-			json_host["distribution"] = host_metric->GetDistribution().CStr();
-			json_host["stat"] = serdes::JsonFromMetrics(host_metric);
+			writer.Write("hostID", host_metric->GetUUID());
+			writer.Write("hostName", host_metric->GetName());
+			writer.Write("distribution", host_metric->GetDistribution());
+			writer.Key("stat");
+			serdes::WriteMetrics(writer, host_metric);
 
-			Json::Value &json_apps = json_host["apps"];
+			writer.BeginArray("apps");
 
 			for(const auto& [app_key, app_metric] : host_metric->GetApplicationMetricsList())
 			{
-				Json::Value json_app;
+				writer.BeginObject();
 
-				json_app["appID"] = app_metric->GetUUID().CStr();
-				json_app["appName"] = app_metric->GetName().CStr();
-				json_app["stat"] = serdes::JsonFromMetrics(app_metric);
+				writer.Write("appID", app_metric->GetUUID());
+				writer.Write("appName", app_metric->GetName().CStr());
+				writer.Key("stat");
+				serdes::WriteMetrics(writer, app_metric);
+
+				writer.BeginArray("streams");
 
-				Json::Value &json_streams = json_app["streams"];
 				for(const auto& [stream_key, stream_metric] : app_metric->GetStreamMetricsMap())
 				{
 					if(stream_metric->IsInputStream())
 					{
-						Json::Value json_stream;
-						json_stream["streamID"] = stream_metric->GetUUID().CStr();
-						json_stream["streamName"] = stream_metric->GetName().CStr();
-						json_stream["stat"] = serdes::JsonFromMetrics(stream_metric);
+						writer.BeginObject();
+
+						writer.Write("streamID", stream_metric->GetUUID());
+						writer.Write("streamName", stream_metric->GetName());
+						writer.Key("stat");
+						serdes::WriteMetrics(writer, stream_metric);
+
+						writer.BeginArray("outputs");
 
-						Json::Value &json_output_streams = json_stream["outputs"];
 						for(const auto& output_stream_metric : stream_metric->GetLinkedOutputStreamMetrics())
 						{
-							Json::Value json_output_stream;
+							writer.BeginObject();
 
-							json_output_stream["streamID"] = output_stream_metric->GetUUID().CStr();
-							json_output_stream["streamName"] = output_stream_metric->GetName().CStr();
-							json_output_stream["stat"] = serdes::JsonFromMetrics(output_stream_metric);
+							writer.Write("streamID", output_stream_metric->GetUUID());
+							writer.Write("streamName", output_stream_metric->GetName());
+							writer.Key("stat");
+							serdes::WriteMetrics(writer, output_stream_metric);
 
-							json_output_streams.append(json_output_stream);
+							writer.EndObject();
 						}
-						
-						json_streams.append(json_stream);
+
+						writer.EndArray();
+
+						writer.EndObject();
 					}
 				}
 
-				json_apps.append(json_app);
+				writer.EndArray();
+
+				writer.EndObject();
 			}
 
-			json_hosts.append(json_host);
+			writer.EndArray();
+
+			writer.EndObject();
 		}
 
+		writer.EndArray();
+
+		writer.EndObject();
+
 		return true;
 	}
 }
\ No newline at end of file
@@ -60,7 +60,7 @@ namespace mon
 		bool FillHostAppInfo(Json::Value &json_host, const std::shared_ptr<ApplicationMetrics> &app_metric) const;
 		bool FillHostAppStreamInfo(Json::Value &json_host, const std::shared_ptr<StreamMetrics> &stream_metric) const;
 
-		bool FillServerStatistics(Json::Value &json_stat) const;
+		bool WriteServerStatistics(ov::JsonWriter &writer) const;
 
 		enum class EventCategory
 		{
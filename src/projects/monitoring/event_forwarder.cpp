@@ -4,6 +4,7 @@
 
 #include <base/ovlibrary/path_manager.h>
 #include <base/ovlibrary/file.h>
+#include <base/ovlibrary/zip.h>
 #include <modules/http/client/http_client.h>
 
 namespace mon
@@ -252,21 +253,23 @@ namespace mon
 		_log_path = log_path;
 	}
 
-	bool EventForwarder::Start(const std::shared_ptr<const cfg::Server> &server_config)
+	bool EventForwarder::Start(const std::shared_ptr<const cfg::Server> &server_config, EventLogger *logger)
 	{
-		if(server_config == nullptr)
+		if(server_config == nullptr || logger == nullptr)
 		{
 			return false;
 		}
 
 		_server_config = server_config;	
 		_user_key = _server_config->GetAnalytics().GetUserKey();
+		_logger = logger;
 
 		bool is_collector_parsed = false;
 		if(_server_config->GetAnalytics().GetForwarding().IsParsed())
 		{
 			_enabled = _server_config->GetAnalytics().GetForwarding().IsEnabled();
 			_collector = _server_config->GetAnalytics().GetForwarding().GetCollector(&is_collector_parsed);
+			_gzip = (_server_config->GetAnalytics().GetForwarding().GetCompression().LowerCaseString() == "gzip");
 		}
 		
 		if(_enabled == false)
@@ -308,7 +311,12 @@ namespace mon
 
 	bool EventForwarder::Stop()
 	{
-		_run_thread = false;
+		{
+			std::lock_guard<std::mutex> lock(_batch_queue_mutex);
+			_run_thread = false;
+		}
+
+		_batch_queue_condition.notify_all();
 		
 		if(_shipper_thread.joinable())
 		{
@@ -360,6 +368,8 @@ namespace mon
 		{
 			// Resume shipping 
 			event_stream.ResetStartOffset(last_file_time, last_file_offset);
+			_last_forwarded_file_time = last_file_time;
+			_last_forwarded_file_offset = last_file_offset;
 		}
 		else
 		{
@@ -370,83 +380,226 @@ namespace mon
 		std::streampos pos = 0;
 		while(_run_thread)
 		{
-			if( ifs.is_open() == false || (event_stream.IsNextAvailable() && ifs.eof()) )
+			if(_is_attached == false)
 			{
-				if(event_stream.OpenNextEventLog(ifs) == true)
-				{
-					pos = ifs.tellg();
-				}
-				else 
-				{
-					// There is no events.log.xxxxxx
-					sleep(1);
-					continue;
-				}
+				ForwardLogFile(event_stream, ifs, pos);
+				continue;
 			}
-			// Current file is moved or something failed
-			else if(event_stream.IsCurrAvailable() == false)
+
+			if(ForwardQueuedBatches() == false)
 			{
-				event_stream.ResetStartOffset(event_stream.GetOpenLogTime(), pos);
-				if(event_stream.OpenNextEventLog(ifs) == true)
+				logtw("Event Forwarder could not keep up with the events, the events are read from the log files again");
+
+				_logger->ResetBatchListener();
+				_is_attached = false;
+
 				{
-					pos = ifs.tellg();
+					std::lock_guard<std::mutex> lock(_batch_queue_mutex);
+					_batch_queue.clear();
+					_is_batch_queue_overflowed = false;
 				}
-				else
+
+				// Read from the end of the last forwarded batch
+				event_stream.ResetStartOffset(_last_forwarded_file_time, _last_forwarded_file_offset);
+				ifs.close();
+			}
+		}
+
+		if(_is_attached == true)
+		{
+			_logger->ResetBatchListener();
+			_is_attached = false;
+		}
+	}
+
+	void EventForwarder::ForwardLogFile(EventLogFileFinder &event_stream, std::ifstream &ifs, std::streampos &pos)
+	{
+		if( ifs.is_open() == false || (event_stream.IsNextAvailable() && ifs.eof()) )
+		{
+			if(event_stream.OpenNextEventLog(ifs) == true)
+			{
+				pos = ifs.tellg();
+			}
+			else 
+			{
+				// There is no events.log.xxxxxx, the events will be received from the logger if it has not written anything yet
+				if(ifs.is_open() == false && AttachToLogger(0, 0) == true)
 				{
-					// There is no current event log ? maybe it was removed, wait for new log file
-					sleep(1);
-					continue;
+					return;
 				}
+
+				sleep(1);
+				return;
+			}
+		}
+		// Current file is moved or something failed
+		else if(event_stream.IsCurrAvailable() == false)
+		{
+			event_stream.ResetStartOffset(event_stream.GetOpenLogTime(), pos);
+			if(event_stream.OpenNextEventLog(ifs) == true)
+			{
+				pos = ifs.tellg();
 			}
 			else
-			{		
-				// Wait for new message in current log file
+			{
+				// There is no current event log ? maybe it was removed, wait for new log file
 				sleep(1);
-
-				// Clear error bits to read a growing log file
-				ifs.clear();
+				return;
 			}
+		}
+		else
+		{		
+			// Wait for new message in current log file
+			sleep(1);
+
+			// Clear error bits to read a growing log file
+			ifs.clear();
+		}
 
-			std::string line;
-			while(std::getline(ifs, line) && _run_thread)
+		auto data = std::make_shared<ov::Data>(EVENT_FORWARDER_MAX_BATCH_SIZE);
+		std::string line;
+		while(_run_thread && std::getline(ifs, line))
+		{
+			if(ifs.eof() == true)
 			{
-				// Collector will use '\n' for delimiter
-				line.append("\n");
-				
-				// end of file
-				if(ifs.eof() == true || ifs.tellg() == -1)
-				{
-					pos += line.size();
-				}
-				else
+				if(event_stream.IsNextAvailable() == false)
 				{
-					pos = ifs.tellg();
+					// The line is being written, so it is read again later
+					ifs.clear();
+					ifs.seekg(pos);
+					break;
 				}
 
-				// Ship the line
-				while(_run_thread)
-				{	
-					if(Forwarding(line.c_str()))
-					{
-						// Store last shipped info
-						StoreLastForwardedInfo(event_stream.GetOpenLogTime(), pos);
-						break;
-					}
-					else
-					{
-						// Keep trying until the transfer is successful.
-						sleep(1);
-					}
-				}
+				// The last line of the previous day without the delimiter
+			}
+
+			// Collector will use '\n' for delimiter
+			line.append("\n");
+
+			// end of file
+			if(ifs.eof() == true || ifs.tellg() == -1)
+			{
+				pos += line.size();
+			}
+			else
+			{
+				pos = ifs.tellg();
+			}
+
+			data->Append(line.c_str(), line.size());
+
+			if(data->GetLength() >= EVENT_FORWARDER_MAX_BATCH_SIZE)
+			{
+				ForwardUntilSent(data, event_stream.GetOpenLogTime(), pos);
+				data = std::make_shared<ov::Data>(EVENT_FORWARDER_MAX_BATCH_SIZE);
+			}
+		}
+
+		if(data->GetLength() > 0)
+		{
+			ForwardUntilSent(data, event_stream.GetOpenLogTime(), pos);
+		}
+
+		// All the files have been read, so the next events are received from the logger
+		if(_run_thread && ifs.eof() && event_stream.IsNextAvailable() == false)
+		{
+			AttachToLogger(event_stream.GetOpenLogTime(), pos);
+		}
+	}
+
+	bool EventForwarder::AttachToLogger(std::time_t file_time, uint64_t file_offset)
+	{
+		_is_attached = _logger->SetBatchListenerIfCaughtUp(file_time, file_offset, [this](const EventLogger::Batch &batch) {
+			OnBatchWritten(batch);
+		});
+
+		if(_is_attached == true)
+		{
+			logti("Event Forwarder has caught up with the event log, the events are forwarded without reading the log files");
+		}
+
+		return _is_attached;
+	}
+
+	void EventForwarder::OnBatchWritten(const EventLogger::Batch &batch)
+	{
+		{
+			std::lock_guard<std::mutex> lock(_batch_queue_mutex);
+
+			if(_is_batch_queue_overflowed == true)
+			{
+				return;
+			}
+
+			if(_batch_queue.size() >= EVENT_FORWARDER_QUEUE_SIZE)
+			{
+				_is_batch_queue_overflowed = true;
+			}
+			else
+			{
+				_batch_queue.push_back(batch);
 			}
 		}
+
+		_batch_queue_condition.notify_one();
 	}
 
-	bool EventForwarder::Forwarding(const ov::String &line)
+	bool EventForwarder::ForwardQueuedBatches()
+	{
+		EventLogger::Batch batch;
+
+		{
+			std::unique_lock<std::mutex> lock(_batch_queue_mutex);
+
+			_batch_queue_condition.wait_for(lock, std::chrono::seconds(1), [this]() {
+				return (_batch_queue.empty() == false) || _is_batch_queue_overflowed || (_run_thread == false);
+			});
+
+			if(_is_batch_queue_overflowed == true)
+			{
+				return false;
+			}
+
+			if(_batch_queue.empty() == true)
+			{
+				return true;
+			}
+
+			batch = _batch_queue.front();
+			_batch_queue.pop_front();
+		}
+
+		ForwardUntilSent(batch.data, batch.file_time, batch.file_offset);
+
+		return true;
+	}
+
+	bool EventForwarder::ForwardUntilSent(const std::shared_ptr<ov::Data> &data, std::time_t file_time, uint64_t file_offset)
+	{
+		// Each batch is a gzip member, so the collector can decode the stream as a concatenated gzip
+		auto payload = (_gzip == true) ? ov::Zip::CompressGzip(data) : data;
+
+		while(_run_thread)
+		{
+			if(Forwarding(payload))
+			{
+				// Store last shipped info
+				StoreLastForwardedInfo(file_time, file_offset);
+				return true;
+			}
+
+			// Keep trying until the transfer is successful.
+			sleep(1);
+		}
+
+		return false;
+	}
+
+	bool EventForwarder::Forwarding(const std::shared_ptr<const ov::Data> &data)
 	{
 		if(ConnectIfNeeded() == true)
 		{
-			return _socket->Send(line.ToData(false));
+			return _socket->Send(data);
 		}
 		else
 		{
@@ -525,6 +678,9 @@ namespace mon
 
 	bool EventForwarder::StoreLastForwardedInfo(std::time_t file_time, uint64_t file_offset)
 	{
+		_last_forwarded_file_time = file_time;
+		_last_forwarded_file_offset = file_offset;
+
 		auto db_file = GetShipperInfoDBFilePath();
 
 		std::ofstream fs(db_file);
@@ -2,24 +2,44 @@
 
 #include "base/ovlibrary/ovlibrary.h"
 #include "config/config.h"
+#include "event_logger.h"
 
 #define SHIPPER_INFO_DB_FILE "forwarder.db"
 #define OVEN_CONSOLE_AUTH_URL "https://ovenconsole.com/auth"
+// Maximum number of the batches received from the logger and waiting to be sent. If the collector is slower than that,
+// the batches are discarded and the events are read from the log files again.
+#define EVENT_FORWARDER_QUEUE_SIZE 256
+// The lines read from the log files are sent in a batch of this size at most
+#define EVENT_FORWARDER_MAX_BATCH_SIZE (64 * 1024)
 
 namespace mon
 {
+	// The forwarder reads the log files from the last forwarded position (stored in SHIPPER_INFO_DB_FILE) until it catches up
+	// with the logger. Then the batches written by the logger are forwarded directly without reading the files.
 	class EventForwarder
 	{
 	public:
 		void SetLogPath(const ov::String &log_path);
-		bool Start(const std::shared_ptr<const cfg::Server> &server_config);
+		bool Start(const std::shared_ptr<const cfg::Server> &server_config, EventLogger *logger);
 		bool Stop();
 
 	private:
+		class EventLogFileFinder;
+
 		bool AuthOvenConsole();
 		void ForwarderThread();
 
-		bool Forwarding(const ov::String &line);
+		// Reads and forwards the lines of the log files
+		void ForwardLogFile(EventLogFileFinder &event_stream, std::ifstream &ifs, std::streampos &pos);
+		// Returns false if the batches have been discarded because the queue is full
+		bool ForwardQueuedBatches();
+		bool AttachToLogger(std::time_t file_time, uint64_t file_offset);
+		// Called by the logger thread
+		void OnBatchWritten(const EventLogger::Batch &batch);
+
+		// Keeps trying until <data> is sent (or the thread is stopped), and stores the position of the end of <data>
+		bool ForwardUntilSent(const std::shared_ptr<ov::Data> &data, std::time_t file_time, uint64_t file_offset);
+		bool Forwarding(const std::shared_ptr<const ov::Data> &data);
 
 		ov::String GetShipperInfoDBFilePath();
 		// [result | file name | file offset]
@@ -68,6 +88,19 @@ namespace mon
 		std::thread _shipper_thread;
 		bool _run_thread = false;
 
+		EventLogger *_logger = nullptr;
+		bool _gzip = false;
+
+		// Only accessed by the forwarder thread
+		bool _is_attached = false;
+		std::time_t _last_forwarded_file_time = 0;
+		uint64_t _last_forwarded_file_offset = 0;
+
+		std::mutex _batch_queue_mutex;
+		std::condition_variable _batch_queue_condition;
+		std::deque<EventLogger::Batch> _batch_queue;
+		bool _is_batch_queue_overflowed = false;
+
 		std::shared_ptr<ov::Socket> _socket;
 	};
 }
\ No newline at end of file
@@ -1,4 +1,5 @@
 #include "event_logger.h"
+#include "monitoring_private.h"
 
 namespace mon
 {
@@ -7,13 +8,204 @@ namespace mon
 	{
 	}
 
+	EventLogger::~EventLogger()
+	{
+		Stop();
+	}
+
 	void EventLogger::SetLogPath(const ov::String &log_path)
 	{
 		_log_writer.SetLogPath(log_path.CStr());
 	}
 
+	bool EventLogger::Start()
+	{
+		if (_run_thread == true)
+		{
+			return true;
+		}
+
+		_queue.reserve(EVENT_LOGGER_BATCH_SIZE);
+
+		_run_thread = true;
+		_logger_thread = std::thread(&EventLogger::LoggerThread, this);
+		pthread_setname_np(_logger_thread.native_handle(), "EventLogger");
+
+		return true;
+	}
+
+	bool EventLogger::Stop()
+	{
+		{
+			std::lock_guard<std::mutex> lock(_queue_mutex);
+			_run_thread = false;
+		}
+
+		_queue_condition.notify_all();
+
+		if (_logger_thread.joinable())
+		{
+			_logger_thread.join();
+		}
+
+		return true;
+	}
+
 	void EventLogger::Write(const Event &event)
 	{
-		_log_writer.Write(event.SerializeToJson().CStr(), event.GetCreationTimeMSec()/1000);
+		std::unique_lock<std::mutex> lock(_queue_mutex);
+
+		if (_run_thread == false)
+		{
+			lock.unlock();
+
+			WriteEvents({event});
+			return;
+		}
+
+		if (_queue.size() >= EVENT_LOGGER_QUEUE_SIZE)
+		{
+			if (_is_queue_full == false)
+			{
+				logtw("The event queue is full (%d events), the events are dropped until the queue is drained", EVENT_LOGGER_QUEUE_SIZE);
+				_is_queue_full = true;
+			}
+
+			_dropped_count++;
+			return;
+		}
+
+		_queue.push_back(event);
+
+		if (_queue.size() == EVENT_LOGGER_BATCH_SIZE)
+		{
+			lock.unlock();
+			_queue_condition.notify_one();
+		}
+	}
+
+	void EventLogger::LoggerThread()
+	{
+		std::vector<Event> events;
+		events.reserve(EVENT_LOGGER_BATCH_SIZE);
+
+		while (true)
+		{
+			bool run_thread;
+
+			{
+				std::unique_lock<std::mutex> lock(_queue_mutex);
+
+				_queue_condition.wait_for(lock, std::chrono::milliseconds(EVENT_LOGGER_FLUSH_INTERVAL_MS), [this]() {
+					return (_run_thread == false) || (_queue.size() >= EVENT_LOGGER_BATCH_SIZE);
+				});
+
+				events.swap(_queue);
+				run_thread = _run_thread;
+
+				if (_is_queue_full == true)
+				{
+					logtw("%" PRIu64 " events have been dropped because the event queue was full", _dropped_count);
+					_is_queue_full = false;
+					_dropped_count = 0;
+				}
+			}
+
+			if (events.empty() == false)
+			{
+				WriteEvents(events);
+				events.clear();
+			}
+
+			if (run_thread == false)
+			{
+				// The events queued before Stop() are written above
+				break;
+			}
+		}
+	}
+
+	void EventLogger::WriteEvents(const std::vector<Event> &events)
+	{
+		std::shared_ptr<ov::Data> data;
+		std::time_t data_time = 0;
+		int data_day = -1;
+
+		for (const auto &event : events)
+		{
+			std::time_t time = event.GetCreationTimeMSec() / 1000;
+			std::tm local_time{};
+			::localtime_r(&time, &local_time);
+
+			// The events of a batch are written to the file of their day
+			if ((data != nullptr) && (local_time.tm_mday != data_day))
+			{
+				WriteBatch(data_time, data);
+				data = nullptr;
+			}
+
+			if (data == nullptr)
+			{
+				data = std::make_shared<ov::Data>(events.size() * 1024);
+				data_time = time;
+				data_day = local_time.tm_mday;
+			}
+
+			auto line = event.SerializeToJson();
+			data->Append(line.CStr(), line.GetLength());
+			data->Append("\n", 1);
+		}
+
+		if (data != nullptr)
+		{
+			WriteBatch(data_time, data);
+		}
+	}
+
+	void EventLogger::WriteBatch(std::time_t time, const std::shared_ptr<ov::Data> &data)
+	{
+		std::lock_guard<std::mutex> lock(_write_mutex);
+
+		_log_writer.Write(data->GetDataAs<char>(), data->GetLength(), time);
+
+		auto offset = _log_writer.GetOffset();
+		if (offset < 0)
+		{
+			return;
+		}
+
+		std::tm local_time{};
+		::localtime_r(&time, &local_time);
+
+		_last_file_time = ov::Converter::ToTime(local_time.tm_year + 1900, local_time.tm_mon + 1, local_time.tm_mday, 0, 0, false);
+		_last_file_offset = static_cast<uint64_t>(offset);
+
+		if (_batch_listener != nullptr)
+		{
+			_batch_listener(Batch{_last_file_time, _last_file_offset, data});
+		}
+	}
+
+	bool EventLogger::SetBatchListenerIfCaughtUp(std::time_t file_time, uint64_t file_offset, BatchListener listener)
+	{
+		std::lock_guard<std::mutex> lock(_write_mutex);
+
+		// Nothing has been written by this logger, so the next batch follows what is in the files now
+		if ((_last_file_time != 0) &&
+			((_last_file_time != file_time) || (_last_file_offset != file_offset)))
+		{
+			return false;
+		}
+
+		_batch_listener = std::move(listener);
+
+		return true;
+	}
+
+	void EventLogger::ResetBatchListener()
+	{
+		std::lock_guard<std::mutex> lock(_write_mutex);
+
+		_batch_listener = nullptr;
 	}
-}
\ No newline at end of file
+}
@@ -4,20 +4,80 @@
 #include "base/ovlibrary/log_write.h"
 #include "event.h"
 
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <thread>
+
 #define DEFAULT_EVENT_LOG_FILE_NAME	"events.log"
+// Maximum number of the events waiting to be written. The new events are dropped while it is full.
+#define EVENT_LOGGER_QUEUE_SIZE	65536
+// The queued events are written at this interval, or as soon as EVENT_LOGGER_BATCH_SIZE events are queued
+#define EVENT_LOGGER_FLUSH_INTERVAL_MS	100
+#define EVENT_LOGGER_BATCH_SIZE	1024
 
 namespace mon
 {
+	// The events are queued by the threads that raise them (e.g. the publishers on the connection of a session),
+	// and serialized to JSON and written in batches by the logger thread.
+	// The lines in the file are the same as the ones written synchronously.
 	class EventLogger
 	{
 	public:
+		// The lines written to a log file at once
+		struct Batch
+		{
+			// Time of the day of the log file (events.log.yyyymmdd)
+			std::time_t file_time = 0;
+			// Offset of the end of the batch in the log file
+			uint64_t file_offset = 0;
+			// JSON lines (each line ends with '\n')
+			std::shared_ptr<ov::Data> data;
+		};
+
+		// Called by the logger thread after a batch is written
+		using BatchListener = std::function<void(const Batch &batch)>;
+
 		EventLogger();
+		~EventLogger();
+
 		void SetLogPath(const ov::String &log_path);
 
-		//TODO(Getroot): Later, it may need to queue events
+		bool Start();
+		// Writes the queued events and stops the logger thread
+		bool Stop();
+
+		// Queues <event> (it is written immediately if the logger thread is not running)
 		void Write(const Event &event);
 
+		// Sets <listener> only if everything before <file_time>/<file_offset> of the log file has been written,
+		// so the listener receives the lines after the position without a gap or a duplicate.
+		// Returns false if the logger has written after the position (the caller has to read the file more).
+		bool SetBatchListenerIfCaughtUp(std::time_t file_time, uint64_t file_offset, BatchListener listener);
+		void ResetBatchListener();
+
 	private:
+		void LoggerThread();
+		// Serializes <events> and writes them to the log files of their days
+		void WriteEvents(const std::vector<Event> &events);
+		void WriteBatch(std::time_t time, const std::shared_ptr<ov::Data> &data);
+
 		ov::LogWrite _log_writer;
+
+		std::mutex _queue_mutex;
+		std::condition_variable _queue_condition;
+		std::vector<Event> _queue;
+		bool _is_queue_full = false;
+		uint64_t _dropped_count = 0;
+
+		std::thread _logger_thread;
+		bool _run_thread = false;
+
+		// Serializes the writes to the file and the listener
+		std::mutex _write_mutex;
+		// The position of the last batch (file_time is 0 before the first batch)
+		std::time_t _last_file_time = 0;
+		uint64_t _last_file_offset = 0;
+		BatchListener _batch_listener;
 	};
-}
\ No newline at end of file
+}
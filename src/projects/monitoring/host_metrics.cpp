@@ -53,6 +53,7 @@ namespace mon
 		}
 
 		_applications[app_info.GetId()] = app_metrics;
+		_applications_generation = NextGeneration();
 
 		logti("Create ApplicationMetrics(%s/%s) for monitoring", app_info.GetName().CStr(), app_info.GetUUID().CStr());
 		return true;
@@ -65,6 +66,7 @@ namespace mon
 			return false;
 		}
 		_applications.erase(app_info.GetId());
+		_applications_generation = NextGeneration();
 
 		logti("Delete ApplicationMetrics(%s/%s) for monitoring", app_info.GetName().CStr(), app_info.GetUUID().CStr());
 		return true;
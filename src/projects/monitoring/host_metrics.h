@@ -48,9 +48,15 @@ namespace mon
 		std::map<uint32_t, std::shared_ptr<ApplicationMetrics>> GetApplicationMetricsList();
 
 		std::shared_ptr<ApplicationMetrics> GetApplicationMetrics(const info::Application &app_info);
+		// Changed whenever an application is created or deleted
+		uint64_t GetApplicationsGeneration() const
+		{
+			return _applications_generation;
+		}
 
 	private:
 		std::shared_mutex _map_guard;
 		std::map<uint32_t, std::shared_ptr<ApplicationMetrics>> _applications;
+		std::atomic<uint64_t> _applications_generation{NextGeneration()};
 	};
 }  // namespace mon
\ No newline at end of file
@@ -0,0 +1,123 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/mediarouter/media_packet_trace.h>
+#include <base/ovlibrary/ovlibrary.h>
+
+namespace mon
+{
+	// The buffers that hold a packet on purpose (in addition to the time of processing/queueing measured by the stages)
+	enum class BufferingStage : int32_t
+	{
+		// MediaRouter holds a packet of the outbound stream until the next packet of the track arrives to calculate its duration
+		MediaRouterStash,
+		// The jitter buffer of the WebRTC publisher (JitterBuffer)
+		JitterBuffer,
+		// The pacer of the WebRTC session (Pacing)
+		Pacer,
+
+		NumberOfStages
+	};
+
+	inline const char *StringFromBufferingStage(BufferingStage stage)
+	{
+		switch (stage)
+		{
+			case BufferingStage::MediaRouterStash:
+				return "mediaRouterStash";
+			case BufferingStage::JitterBuffer:
+				return "jitterBuffer";
+			case BufferingStage::Pacer:
+				return "pacer";
+			case BufferingStage::NumberOfStages:
+				break;
+		}
+
+		return "unknown";
+	}
+
+	// Latency of the stages of the sampled packets (see MediaPacketTrace) delivered to the publishers of a stream.
+	// The latency of a stage is the time from the previous stage that the packet has passed
+	// (e.g. the stages of the transcoder are skipped for the bypassed tracks)
+	class LatencyMetrics
+	{
+	public:
+		void Record(const MediaPacketTrace &trace)
+		{
+			auto received_time = trace.GetTime(PacketTraceStage::ProviderReceived);
+			if (received_time == 0)
+			{
+				return;
+			}
+
+			auto last_time = received_time;
+
+			for (size_t index = static_cast<size_t>(PacketTraceStage::ProviderReceived) + 1; index < static_cast<size_t>(PacketTraceStage::NumberOfStages); index++)
+			{
+				auto time = trace.GetTime(static_cast<PacketTraceStage>(index));
+				if (time == 0)
+				{
+					continue;
+				}
+
+				_stage_histograms[index].Record(std::max<int64_t>(time - last_time, 0));
+				last_time = time;
+			}
+
+			_total_histogram.Record(std::max<int64_t>(last_time - received_time, 0));
+		}
+
+		// Number of the recorded traces
+		uint64_t GetSampleCount() const
+		{
+			return _total_histogram.GetCount();
+		}
+
+		// Number of the traces that have passed the stage
+		uint64_t GetSampleCount(PacketTraceStage stage) const
+		{
+			return _stage_histograms[static_cast<size_t>(stage)].GetCount();
+		}
+
+		// percentile: 0.0 ~ 100.0
+		int64_t GetLatencyInUs(PacketTraceStage stage, double percentile) const
+		{
+			return _stage_histograms[static_cast<size_t>(stage)].GetPercentile(percentile);
+		}
+
+		// From ProviderReceived to the last stage
+		int64_t GetTotalLatencyInUs(double percentile) const
+		{
+			return _total_histogram.GetPercentile(percentile);
+		}
+
+		// Delay added by the buffer to the sampled packets (the owners of the buffers sample the packets by themselves)
+		void RecordBufferingDelay(BufferingStage stage, int64_t delay_us)
+		{
+			_buffering_histograms[static_cast<size_t>(stage)].Record(std::max<int64_t>(delay_us, 0));
+		}
+
+		uint64_t GetBufferingSampleCount(BufferingStage stage) const
+		{
+			return _buffering_histograms[static_cast<size_t>(stage)].GetCount();
+		}
+
+		// percentile: 0.0 ~ 100.0
+		int64_t GetBufferingDelayInUs(BufferingStage stage, double percentile) const
+		{
+			return _buffering_histograms[static_cast<size_t>(stage)].GetPercentile(percentile);
+		}
+
+	private:
+		// The histogram of ProviderReceived is not used
+		ov::Histogram _stage_histograms[static_cast<size_t>(PacketTraceStage::NumberOfStages)];
+		ov::Histogram _total_histogram;
+		ov::Histogram _buffering_histograms[static_cast<size_t>(BufferingStage::NumberOfStages)];
+	};
+}  // namespace mon
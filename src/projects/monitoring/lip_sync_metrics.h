@@ -0,0 +1,69 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/ovlibrary/ovlibrary.h>
+
+#include <atomic>
+
+namespace mon
+{
+	// Metrics of the A/V alignment of an input track by RTCP SR (WebRTC/RTSP), updated when an SR is received
+	class LipSyncMetrics
+	{
+	public:
+		LipSyncMetrics(int32_t track_id)
+			: _track_id(track_id)
+		{
+		}
+
+		int32_t GetTrackId() const
+		{
+			return _track_id;
+		}
+
+		uint64_t GetSenderReportCount() const
+		{
+			return _sender_report_count;
+		}
+
+		// Drift of the RTP clock against the NTP clock of the sender, measured between the last two SRs
+		double GetDriftPpm() const
+		{
+			return _drift_ppm;
+		}
+
+		// Difference between the PTS expected before the last SR and the PTS of the SR
+		int64_t GetAlignmentErrorInUs() const
+		{
+			return _alignment_error_us;
+		}
+
+		// Correction that is not yet applied to the PTS (slewed in the predictive mode)
+		int64_t GetCorrectionInUs() const
+		{
+			return _correction_us;
+		}
+
+		void Update(uint64_t sender_report_count, double drift_ppm, int64_t alignment_error_us, int64_t correction_us)
+		{
+			_sender_report_count = sender_report_count;
+			_drift_ppm = drift_ppm;
+			_alignment_error_us = alignment_error_us;
+			_correction_us = correction_us;
+		}
+
+	private:
+		const int32_t _track_id;
+
+		std::atomic<uint64_t> _sender_report_count = 0;
+		std::atomic<double> _drift_ppm = 0.0;
+		std::atomic<int64_t> _alignment_error_us = 0;
+		std::atomic<int64_t> _correction_us = 0;
+	};
+}  // namespace mon
@@ -0,0 +1,205 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/ovlibrary/ovlibrary.h>
+
+#include <atomic>
+
+namespace mon
+{
+	// The buffers that hold the media data of a stream
+	enum class MemoryComponent : int32_t
+	{
+		// Packets waiting to be processed by MediaRouter
+		MediaRouterQueue,
+		// GOP cache of MediaRouter
+		GopCache,
+		// Packets waiting to be decoded by the transcoder
+		TranscoderInput,
+		// Segments of LLHLS in memory
+		Fmp4Storage,
+		// RTP packets kept for the retransmission of WebRTC
+		RtpHistory,
+
+		NumberOfComponents
+	};
+
+	// How much the memory used by the stream exceeds the limit (See cfg::modules::StreamMemoryLimit)
+	enum class MemoryPressure : int32_t
+	{
+		Normal,
+		// Exceeds the soft limit - the buffers that can be rebuilt (e.g. GOP cache, the segments of LLHLS) are reduced
+		Soft,
+		// Exceeds the hard limit - the stream is terminated
+		Hard
+	};
+
+	inline const char *StringFromMemoryComponent(MemoryComponent component)
+	{
+		switch (component)
+		{
+			case MemoryComponent::MediaRouterQueue:
+				return "mediaRouterQueue";
+			case MemoryComponent::GopCache:
+				return "gopCache";
+			case MemoryComponent::TranscoderInput:
+				return "transcoderInput";
+			case MemoryComponent::Fmp4Storage:
+				return "fmp4Storage";
+			case MemoryComponent::RtpHistory:
+				return "rtpHistory";
+			case MemoryComponent::NumberOfComponents:
+				break;
+		}
+
+		return "unknown";
+	}
+
+	inline const char *StringFromMemoryPressure(MemoryPressure pressure)
+	{
+		switch (pressure)
+		{
+			case MemoryPressure::Normal:
+				return "normal";
+			case MemoryPressure::Soft:
+				return "soft";
+			case MemoryPressure::Hard:
+				return "hard";
+		}
+
+		return "unknown";
+	}
+
+	// Bytes of the media data held by the buffers of a stream.
+	//
+	// The buffers report the changes of their sizes, and the bytes of an output stream are also added to its input stream
+	// (the parent), so the input stream accounts for all the memory used by the stream and its outputs.
+	class MemoryMetrics
+	{
+	public:
+		~MemoryMetrics()
+		{
+			// The buffers may be released after the output stream is deleted
+			auto parent = std::atomic_load(&_parent);
+			if (parent != nullptr)
+			{
+				for (size_t index = 0; index < static_cast<size_t>(MemoryComponent::NumberOfComponents); index++)
+				{
+					parent->Add(static_cast<MemoryComponent>(index), -_bytes[index].load());
+				}
+			}
+		}
+
+		// Called once when the output stream is linked to the input stream
+		void SetParent(const std::shared_ptr<MemoryMetrics> &parent)
+		{
+			if ((parent == nullptr) || (parent.get() == this))
+			{
+				return;
+			}
+
+			if (std::atomic_exchange(&_parent, parent) != nullptr)
+			{
+				return;
+			}
+
+			// Moves the bytes accounted before the link
+			for (size_t index = 0; index < static_cast<size_t>(MemoryComponent::NumberOfComponents); index++)
+			{
+				parent->Add(static_cast<MemoryComponent>(index), _bytes[index].load());
+			}
+		}
+
+		// Used by the buffers shared by several owners (e.g. a buffer per track)
+		void Add(MemoryComponent component, int64_t delta)
+		{
+			if (delta == 0)
+			{
+				return;
+			}
+
+			_bytes[static_cast<size_t>(component)] += delta;
+			AddToTotal(component, delta);
+		}
+
+		// Used by the buffer that is the only owner of the component in the stream
+		void Set(MemoryComponent component, int64_t bytes)
+		{
+			auto delta = bytes - _bytes[static_cast<size_t>(component)].exchange(bytes);
+			if (delta == 0)
+			{
+				return;
+			}
+
+			AddToTotal(component, delta);
+		}
+
+		int64_t GetBytes(MemoryComponent component) const
+		{
+			return _bytes[static_cast<size_t>(component)];
+		}
+
+		// Including the bytes of the output streams if this is an input stream
+		int64_t GetTotalBytes() const
+		{
+			return _total_bytes;
+		}
+
+		int64_t GetPeakBytes() const
+		{
+			return _peak_bytes;
+		}
+
+		// The pressure is decided for the input stream, and the output streams follow it
+		MemoryPressure GetPressure() const
+		{
+			auto parent = std::atomic_load(&_parent);
+			if (parent != nullptr)
+			{
+				return parent->GetPressure();
+			}
+
+			return _pressure;
+		}
+
+		void SetPressure(MemoryPressure pressure)
+		{
+			_pressure = pressure;
+		}
+
+	private:
+		void AddToTotal(MemoryComponent component, int64_t delta)
+		{
+			UpdatePeak(_total_bytes += delta);
+
+			auto parent = std::atomic_load(&_parent);
+			if (parent != nullptr)
+			{
+				parent->Add(component, delta);
+			}
+		}
+
+		void UpdatePeak(int64_t total_bytes)
+		{
+			auto peak_bytes = _peak_bytes.load();
+
+			while ((total_bytes > peak_bytes) && (_peak_bytes.compare_exchange_weak(peak_bytes, total_bytes) == false))
+			{
+			}
+		}
+
+		std::atomic<int64_t> _bytes[static_cast<size_t>(MemoryComponent::NumberOfComponents)] = {};
+		std::atomic<int64_t> _total_bytes = 0;
+		std::atomic<int64_t> _peak_bytes = 0;
+
+		std::atomic<MemoryPressure> _pressure = MemoryPressure::Normal;
+
+		std::shared_ptr<MemoryMetrics> _parent;
+	};
+}  // namespace mon
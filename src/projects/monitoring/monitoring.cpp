@@ -5,12 +5,17 @@
 #include "monitoring.h"
 #include "monitoring_private.h"
 
+#include <malloc.h>
+#include <orchestrator/orchestrator.h>
+
 
 namespace mon
 {
 	void Monitoring::Release()
 	{
 		OV_SAFE_RESET(_server_metric, nullptr, _server_metric->Release(), _server_metric);
+		// Write the queued events before the forwarder is stopped
+		_logger.Stop();
 		_forwarder.Stop();
 	}
 
@@ -75,6 +80,8 @@ namespace mon
 
 		if(IsAnalyticsOn())
 		{
+			_logger.Start();
+
 			auto event = Event(EventType::ServerStarted, _server_metric);
 			_logger.Write(event);
 
@@ -87,9 +94,94 @@ namespace mon
 				},
 				5000);
 
+			_forwarder.Start(server_config, &_logger);
+		}
+
+		auto &memory_limit_config = server_config->GetModules().GetStreamMemoryLimit();
+		if (memory_limit_config.IsEnabled())
+		{
+			auto soft_limit = memory_limit_config.GetSoftLimit();
+			auto hard_limit = memory_limit_config.GetHardLimit();
+
+			logti("The memory of each stream is limited to %" PRId64 " bytes (soft) / %" PRId64 " bytes (hard)", soft_limit, hard_limit);
+
+			_timer.Push(
+				[this, soft_limit, hard_limit](void *parameter) -> ov::DelayQueueAction {
+					CheckStreamMemoryLimit(soft_limit, hard_limit);
+					return ov::DelayQueueAction::Repeat;
+				},
+				MONITORING_STREAM_MEMORY_CHECK_INTERVAL_MS);
+		}
+
+		if (IsAnalyticsOn() || memory_limit_config.IsEnabled())
+		{
 			_timer.Start();
+		}
+	}
 
-			_forwarder.Start(server_config);
+	void Monitoring::CheckStreamMemoryLimit(int64_t soft_limit, int64_t hard_limit)
+	{
+		for (const auto &[host_id, host_metrics] : GetHostMetricsList())
+		{
+			for (const auto &[app_id, app_metrics] : host_metrics->GetApplicationMetricsList())
+			{
+				for (const auto &[stream_id, stream_metrics] : app_metrics->GetStreamMetricsMap())
+				{
+					// The bytes of the output streams are added to the input stream
+					if (stream_metrics->IsInputStream() == false)
+					{
+						continue;
+					}
+
+					auto memory_metrics = stream_metrics->GetMemoryMetrics();
+					auto total_bytes = memory_metrics->GetTotalBytes();
+					auto last_pressure = memory_metrics->GetPressure();
+					auto pressure = last_pressure;
+
+					if (total_bytes > hard_limit)
+					{
+						pressure = MemoryPressure::Hard;
+					}
+					else if (total_bytes > soft_limit)
+					{
+						pressure = MemoryPressure::Soft;
+					}
+					else if (total_bytes < (soft_limit * MONITORING_STREAM_MEMORY_RELEASE_PERCENT / 100))
+					{
+						pressure = MemoryPressure::Normal;
+					}
+
+					if (pressure == last_pressure)
+					{
+						continue;
+					}
+
+					memory_metrics->SetPressure(pressure);
+
+					switch (pressure)
+					{
+						case MemoryPressure::Normal:
+							logti("[%s/%s] The memory pressure of the stream is released: %" PRId64 " bytes",
+								  app_metrics->GetName().CStr(), stream_metrics->GetName().CStr(), total_bytes);
+							break;
+
+						case MemoryPressure::Soft:
+							logtw("[%s/%s] The stream uses more memory than the soft limit (%" PRId64 " > %" PRId64 " bytes), so the buffers are reduced",
+								  app_metrics->GetName().CStr(), stream_metrics->GetName().CStr(), total_bytes, soft_limit);
+							break;
+
+						case MemoryPressure::Hard:
+							logtc("[%s/%s] The stream uses more memory than the hard limit (%" PRId64 " > %" PRId64 " bytes), so the stream will be forcibly deleted",
+								  app_metrics->GetName().CStr(), stream_metrics->GetName().CStr(), total_bytes, hard_limit);
+
+							ocst::Orchestrator::GetInstance()->TerminateStream(app_metrics->GetName(), stream_metrics->GetName());
+
+							// Clear memory fragmentation
+							malloc_trim(0);
+							break;
+					}
+				}
+			}
 		}
 	}
 
@@ -17,6 +17,11 @@
 
 namespace mon
 {
+	// Interval to compare the memory used by the streams with the limits of StreamMemoryLimit
+#define MONITORING_STREAM_MEMORY_CHECK_INTERVAL_MS 1000
+	// The memory pressure of a stream is released when it uses less than this percentage of the soft limit
+#define MONITORING_STREAM_MEMORY_RELEASE_PERCENT 80
+
 	class Monitoring
 	{
 	public:
@@ -58,6 +63,9 @@ namespace mon
 		void OnSessionsDisconnected(const info::Stream &stream_info, PublisherType type, uint64_t number_of_sessions);
 
 	private:
+		// Updates the memory pressure of the input streams, and terminates the streams that exceed <hard_limit>
+		void CheckStreamMemoryLimit(int64_t soft_limit, int64_t hard_limit);
+
 		ov::DelayQueue _timer{"MonLogTimer"};
 		std::shared_ptr<ServerMetrics> _server_metric = nullptr;
 		EventLogger	_logger;
@@ -54,6 +54,7 @@ namespace mon
 		}
 
 		_hosts[host_info.GetId()] = host_metrics;
+		_hosts_generation = NextGeneration();
 
 		logti("Create HostMetrics(%s/%s) for monitoring", host_info.GetName().CStr(), host_info.GetUUID().CStr());
 
@@ -72,6 +73,7 @@ namespace mon
 
 		auto host = it->second;
 		_hosts.erase(it);
+		_hosts_generation = NextGeneration();
 		host->Release();
 
 		logti("Delete HostMetrics(%s/%s) for monitoring", host_info.GetName().CStr(), host_info.GetUUID().CStr());
@@ -193,4 +195,14 @@ namespace mon
 
 		return _queues;
 	}
+
+	std::vector<ov::DataPool::Stats> ServerMetrics::GetDataPoolStats()
+	{
+		return ov::DataPool::GetStats();
+	}
+
+	ov::TlsServerData::KtlsStats ServerMetrics::GetKtlsStats()
+	{
+		return ov::TlsServerData::GetKtlsStats();
+	}
 }  // namespace mon
\ No newline at end of file
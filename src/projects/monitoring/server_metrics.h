@@ -26,12 +26,18 @@ namespace mon
 		std::chrono::system_clock::time_point GetServerStartedTime();
 		std::map<uint32_t, std::shared_ptr<HostMetrics>> GetHostMetricsList();
         std::shared_ptr<HostMetrics> GetHostMetrics(const info::Host &host_info);
+		// Changed whenever a host is created or deleted
+		uint64_t GetHostsGeneration() const
+		{
+			return _hosts_generation;
+		}
 
 	protected:
 		std::shared_ptr<const cfg::Server> _server_config = nullptr;
 		std::chrono::system_clock::time_point _server_started_time;
 		std::shared_mutex _map_guard;
 		std::map<uint32_t, std::shared_ptr<HostMetrics>> _hosts;
+		std::atomic<uint64_t> _hosts_generation{NextGeneration()};
 
 	// Queue metrics
 	public:
@@ -42,5 +48,13 @@ namespace mon
 
 	protected:
 		std::map<uint32_t, std::shared_ptr<QueueMetrics>> _queues;
+
+	// Buffer pool metrics of ov::Data
+	public:
+		std::vector<ov::DataPool::Stats> GetDataPoolStats();
+
+	// kTLS metrics of HTTPS connections
+	public:
+		ov::TlsServerData::KtlsStats GetKtlsStats();
 	};
 }
\ No newline at end of file
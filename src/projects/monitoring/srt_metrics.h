@@ -0,0 +1,92 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/ovlibrary/ovlibrary.h>
+
+#include <atomic>
+
+namespace mon
+{
+	// Metrics of the SRT connection of an input stream (updated from srt_bstats() periodically)
+	class SrtMetrics
+	{
+	public:
+		double GetRttInMs() const
+		{
+			return _rtt_in_ms;
+		}
+
+		// Bandwidth of the link estimated by libsrt
+		double GetBandwidthInMbps() const
+		{
+			return _bandwidth_in_mbps;
+		}
+
+		int64_t GetReceivedPacketCount() const
+		{
+			return _received_packet_count;
+		}
+
+		// Packets reported as lost (NAK is sent for them)
+		int64_t GetLostPacketCount() const
+		{
+			return _lost_packet_count;
+		}
+
+		// Packets that were received again after retransmission
+		int64_t GetRetransmittedPacketCount() const
+		{
+			return _retransmitted_packet_count;
+		}
+
+		// Packets that were not recovered in time and dropped by TSBPD
+		int64_t GetDroppedPacketCount() const
+		{
+			return _dropped_packet_count;
+		}
+
+		// Timespan of the packets in the receive buffer
+		int32_t GetBufferedTimeInMs() const
+		{
+			return _buffered_time_in_ms;
+		}
+
+		// Configured TSBPD latency
+		int32_t GetLatencyInMs() const
+		{
+			return _latency_in_ms;
+		}
+
+		void Update(double rtt_in_ms, double bandwidth_in_mbps,
+					int64_t received_packet_count, int64_t lost_packet_count, int64_t retransmitted_packet_count, int64_t dropped_packet_count,
+					int32_t buffered_time_in_ms, int32_t latency_in_ms)
+		{
+			_rtt_in_ms = rtt_in_ms;
+			_bandwidth_in_mbps = bandwidth_in_mbps;
+			_received_packet_count = received_packet_count;
+			_lost_packet_count = lost_packet_count;
+			_retransmitted_packet_count = retransmitted_packet_count;
+			_dropped_packet_count = dropped_packet_count;
+			_buffered_time_in_ms = buffered_time_in_ms;
+			_latency_in_ms = latency_in_ms;
+		}
+
+	private:
+		std::atomic<double> _rtt_in_ms{0.0};
+		std::atomic<double> _bandwidth_in_mbps{0.0};
+
+		std::atomic<int64_t> _received_packet_count{0};
+		std::atomic<int64_t> _lost_packet_count{0};
+		std::atomic<int64_t> _retransmitted_packet_count{0};
+		std::atomic<int64_t> _dropped_packet_count{0};
+
+		std::atomic<int32_t> _buffered_time_in_ms{0};
+		std::atomic<int32_t> _latency_in_ms{0};
+	};
+}  // namespace mon
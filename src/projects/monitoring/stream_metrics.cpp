@@ -17,8 +17,48 @@ namespace mon
 		if(GetSourceType() == StreamSourceType::Ovt || GetSourceType() == StreamSourceType::RtspPull)
 		{
 			out_str.AppendFormat("\n\tElapsed time to connect to origin server : %llu ms\n"
-									"\tElapsed time to subscribe to origin server : %llu ms\n",
-									GetOriginConnectionTimeMSec(), GetOriginSubscribeTimeMSec());
+									"\tElapsed time to subscribe to origin server : %llu ms\n"
+									"\tElapsed time to receive the first frame from origin server : %llu ms\n",
+									GetOriginConnectionTimeMSec(), GetOriginSubscribeTimeMSec(), GetOriginFirstFrameTimeMSec());
+		}
+		if(GetGopCachePacketCount() > 0)
+		{
+			out_str.AppendFormat("\n\tGOP cache : %" PRId64 " bytes, %" PRId64 " ms, %d packets\n", GetGopCacheBytes(), GetGopCacheDurationMSec(), GetGopCachePacketCount());
+		}
+		if(GetGpuId() >= 0)
+		{
+			out_str.AppendFormat("\n\tGPU : %d\n", GetGpuId());
+		}
+		for (const auto &[track_id, decoder_metrics] : GetDecoderMetricsList())
+		{
+			out_str.AppendFormat("\n\tDecoder #%d : %s, Threads(%d, %s), Frames(%" PRIu64 "), Latency(avg %" PRId64 "us, max %" PRId64 "us)\n",
+								 track_id, decoder_metrics->GetCodecName().CStr(),
+								 decoder_metrics->GetThreadCount(), decoder_metrics->GetThreadType().CStr(),
+								 decoder_metrics->GetDecodedFrameCount(),
+								 decoder_metrics->GetDecodingLatencyInUs(), decoder_metrics->GetMaxDecodingLatencyInUs());
+		}
+		auto srt_metrics = FindSrtMetrics();
+		if (srt_metrics != nullptr)
+		{
+			out_str.AppendFormat("\n\tSRT : RTT(%.3fms), Bandwidth(%.3fMbps), Packets(recv %" PRId64 ", lost %" PRId64 ", retrans %" PRId64 ", drop %" PRId64 "), Buffer(%dms / latency %dms)\n",
+								 srt_metrics->GetRttInMs(), srt_metrics->GetBandwidthInMbps(),
+								 srt_metrics->GetReceivedPacketCount(), srt_metrics->GetLostPacketCount(),
+								 srt_metrics->GetRetransmittedPacketCount(), srt_metrics->GetDroppedPacketCount(),
+								 srt_metrics->GetBufferedTimeInMs(), srt_metrics->GetLatencyInMs());
+		}
+		auto latency_metrics = FindLatencyMetrics();
+		if (latency_metrics != nullptr)
+		{
+			out_str.AppendFormat("\n\tLatency : Samples(%" PRIu64 "), p50(%" PRId64 "us), p99(%" PRId64 "us)\n",
+								 latency_metrics->GetSampleCount(),
+								 latency_metrics->GetTotalLatencyInUs(50.0), latency_metrics->GetTotalLatencyInUs(99.0));
+		}
+		auto memory_metrics = FindMemoryMetrics();
+		if (memory_metrics != nullptr)
+		{
+			out_str.AppendFormat("\n\tMemory : %" PRId64 " bytes (peak %" PRId64 " bytes, %s)\n",
+								 memory_metrics->GetTotalBytes(), memory_metrics->GetPeakBytes(),
+								 StringFromMemoryPressure(memory_metrics->GetPressure()));
 		}
 		out_str.Append("\n");
 		out_str.Append(CommonMetrics::GetInfoString());
@@ -33,7 +73,14 @@ namespace mon
 
 	void StreamMetrics::LinkOutputStreamMetrics(const std::shared_ptr<StreamMetrics> &stream)
 	{
+		if (stream == nullptr)
+		{
+			return;
+		}
+
 		_output_stream_metrics.push_back(stream);
+
+		stream->GetMemoryMetrics()->SetParent(GetMemoryMetrics());
 	}
 	
 	std::vector<std::shared_ptr<StreamMetrics>> StreamMetrics::GetLinkedOutputStreamMetrics() const
@@ -50,6 +97,32 @@ namespace mon
 	{
 		return _subscribe_time_from_origin_msec.load();
 	}
+	int64_t StreamMetrics::GetOriginFirstFrameTimeMSec() const
+	{
+		return _first_frame_time_from_origin_msec.load();
+	}
+	int64_t StreamMetrics::GetGopCacheBytes() const
+	{
+		return _gop_cache_bytes.load();
+	}
+	int64_t StreamMetrics::GetGopCacheDurationMSec() const
+	{
+		return _gop_cache_duration_msec.load();
+	}
+	int32_t StreamMetrics::GetGopCachePacketCount() const
+	{
+		return _gop_cache_packet_count.load();
+	}
+	void StreamMetrics::UpdateGopCache(int64_t bytes, int64_t duration_msec, int32_t packet_count)
+	{
+		_gop_cache_bytes = bytes;
+		_gop_cache_duration_msec = duration_msec;
+		_gop_cache_packet_count = packet_count;
+	}
+	int32_t StreamMetrics::GetGpuId() const
+	{
+		return _gpu_id.load();
+	}
 
 	// Setter
 	void StreamMetrics::SetOriginConnectionTimeMSec(int64_t value)
@@ -62,6 +135,108 @@ namespace mon
 		_subscribe_time_from_origin_msec = value;
 		UpdateDate();
 	}
+	void StreamMetrics::SetOriginFirstFrameTimeMSec(int64_t value)
+	{
+		_first_frame_time_from_origin_msec = value;
+		UpdateDate();
+	}
+	void StreamMetrics::SetGpuId(int32_t gpu_id)
+	{
+		_gpu_id = gpu_id;
+		UpdateDate();
+	}
+
+	std::shared_ptr<DecoderMetrics> StreamMetrics::GetDecoderMetrics(int32_t track_id)
+	{
+		std::lock_guard<std::mutex> lock_guard(_decoder_metrics_mutex);
+
+		auto &metrics = _decoder_metrics_map[track_id];
+		if (metrics == nullptr)
+		{
+			metrics = std::make_shared<DecoderMetrics>(track_id);
+		}
+
+		return metrics;
+	}
+
+	std::map<int32_t, std::shared_ptr<DecoderMetrics>> StreamMetrics::GetDecoderMetricsList() const
+	{
+		std::lock_guard<std::mutex> lock_guard(_decoder_metrics_mutex);
+		return _decoder_metrics_map;
+	}
+
+	std::shared_ptr<LipSyncMetrics> StreamMetrics::GetLipSyncMetrics(int32_t track_id)
+	{
+		std::lock_guard<std::mutex> lock_guard(_lip_sync_metrics_mutex);
+
+		auto &metrics = _lip_sync_metrics_map[track_id];
+		if (metrics == nullptr)
+		{
+			metrics = std::make_shared<LipSyncMetrics>(track_id);
+		}
+
+		return metrics;
+	}
+
+	std::map<int32_t, std::shared_ptr<LipSyncMetrics>> StreamMetrics::GetLipSyncMetricsList() const
+	{
+		std::lock_guard<std::mutex> lock_guard(_lip_sync_metrics_mutex);
+		return _lip_sync_metrics_map;
+	}
+
+	std::shared_ptr<SrtMetrics> StreamMetrics::GetSrtMetrics()
+	{
+		std::lock_guard<std::mutex> lock_guard(_srt_metrics_mutex);
+
+		if (_srt_metrics == nullptr)
+		{
+			_srt_metrics = std::make_shared<SrtMetrics>();
+		}
+
+		return _srt_metrics;
+	}
+
+	std::shared_ptr<const SrtMetrics> StreamMetrics::FindSrtMetrics() const
+	{
+		std::lock_guard<std::mutex> lock_guard(_srt_metrics_mutex);
+		return _srt_metrics;
+	}
+
+	std::shared_ptr<LatencyMetrics> StreamMetrics::GetLatencyMetrics()
+	{
+		std::lock_guard<std::mutex> lock_guard(_latency_metrics_mutex);
+
+		if (_latency_metrics == nullptr)
+		{
+			_latency_metrics = std::make_shared<LatencyMetrics>();
+		}
+
+		return _latency_metrics;
+	}
+
+	std::shared_ptr<const LatencyMetrics> StreamMetrics::FindLatencyMetrics() const
+	{
+		std::lock_guard<std::mutex> lock_guard(_latency_metrics_mutex);
+		return _latency_metrics;
+	}
+
+	std::shared_ptr<MemoryMetrics> StreamMetrics::GetMemoryMetrics()
+	{
+		std::lock_guard<std::mutex> lock_guard(_memory_metrics_mutex);
+
+		if (_memory_metrics == nullptr)
+		{
+			_memory_metrics = std::make_shared<MemoryMetrics>();
+		}
+
+		return _memory_metrics;
+	}
+
+	std::shared_ptr<const MemoryMetrics> StreamMetrics::FindMemoryMetrics() const
+	{
+		std::lock_guard<std::mutex> lock_guard(_memory_metrics_mutex);
+		return _memory_metrics;
+	}
 
 	void StreamMetrics::IncreaseBytesIn(uint64_t value)
 	{
@@ -9,6 +9,11 @@
 #include "base/info/info.h"
 #include "base/info/stream.h"
 #include "common_metrics.h"
+#include "decoder_metrics.h"
+#include "latency_metrics.h"
+#include "lip_sync_metrics.h"
+#include "memory_metrics.h"
+#include "srt_metrics.h"
 
 namespace mon
 {
@@ -22,6 +27,7 @@ namespace mon
 		{
 			_connection_time_to_origin_msec = 0;
 			_subscribe_time_from_origin_msec = 0;
+			_first_frame_time_from_origin_msec = 0;
 			logd("DEBUG", "StreamMetric (%s / %s) Created", GetName().CStr(), GetUUID().CStr());
 		}
 
@@ -46,6 +52,42 @@ namespace mon
 		int64_t GetOriginSubscribeTimeMSec() const;
 		void SetOriginConnectionTimeMSec(int64_t value);
 		void SetOriginSubscribeTimeMSec(int64_t value);
+		// Elapsed time from connecting to the origin until the first frame is received
+		int64_t GetOriginFirstFrameTimeMSec() const;
+		void SetOriginFirstFrameTimeMSec(int64_t value);
+
+		// Packets held by the GOP cache of MediaRouter for this stream
+		int64_t GetGopCacheBytes() const;
+		int64_t GetGopCacheDurationMSec() const;
+		int32_t GetGopCachePacketCount() const;
+		void UpdateGopCache(int64_t bytes, int64_t duration_msec, int32_t packet_count);
+
+		// GPU used by the transcoder for this stream (-1: not used)
+		int32_t GetGpuId() const;
+		void SetGpuId(int32_t gpu_id);
+
+		// Metrics of the decoder of <track_id> in the transcoder. It is created if it does not exist.
+		std::shared_ptr<DecoderMetrics> GetDecoderMetrics(int32_t track_id);
+		std::map<int32_t, std::shared_ptr<DecoderMetrics>> GetDecoderMetricsList() const;
+
+		// Metrics of the A/V alignment of <track_id> by RTCP SR. It is created if it does not exist.
+		std::shared_ptr<LipSyncMetrics> GetLipSyncMetrics(int32_t track_id);
+		std::map<int32_t, std::shared_ptr<LipSyncMetrics>> GetLipSyncMetricsList() const;
+
+		// Metrics of the SRT connection if this stream is received over SRT. It is created if it does not exist.
+		std::shared_ptr<SrtMetrics> GetSrtMetrics();
+		// nullptr if this stream is not received over SRT
+		std::shared_ptr<const SrtMetrics> FindSrtMetrics() const;
+
+		// Latency of the stages of the sampled packets delivered to the publishers. It is created if it does not exist.
+		std::shared_ptr<LatencyMetrics> GetLatencyMetrics();
+		// nullptr if no sampled packet has been delivered to the publishers of this stream
+		std::shared_ptr<const LatencyMetrics> FindLatencyMetrics() const;
+
+		// Memory used by the buffers of this stream (and the output streams if this is an input stream). It is created if it does not exist.
+		std::shared_ptr<MemoryMetrics> GetMemoryMetrics();
+		// nullptr if no buffer of this stream has reported its size
+		std::shared_ptr<const MemoryMetrics> FindMemoryMetrics() const;
 
 		// Overriding from CommonMetrics 
 		void IncreaseBytesIn(uint64_t value) override;
@@ -57,6 +99,30 @@ namespace mon
 		// Related to origin, From Provider
 		std::atomic<int64_t> _connection_time_to_origin_msec = 0;
 		std::atomic<int64_t> _subscribe_time_from_origin_msec = 0;
+		std::atomic<int64_t> _first_frame_time_from_origin_msec = 0;
+
+		std::atomic<int64_t> _gop_cache_bytes = 0;
+		std::atomic<int64_t> _gop_cache_duration_msec = 0;
+		std::atomic<int32_t> _gop_cache_packet_count = 0;
+
+		std::atomic<int32_t> _gpu_id = -1;
+
+		mutable std::mutex _decoder_metrics_mutex;
+		// key: track id
+		std::map<int32_t, std::shared_ptr<DecoderMetrics>> _decoder_metrics_map;
+
+		mutable std::mutex _lip_sync_metrics_mutex;
+		// key: track id
+		std::map<int32_t, std::shared_ptr<LipSyncMetrics>> _lip_sync_metrics_map;
+
+		mutable std::mutex _srt_metrics_mutex;
+		std::shared_ptr<SrtMetrics> _srt_metrics;
+
+		mutable std::mutex _latency_metrics_mutex;
+		std::shared_ptr<LatencyMetrics> _latency_metrics;
+
+		mutable std::mutex _memory_metrics_mutex;
+		std::shared_ptr<MemoryMetrics> _memory_metrics;
 
 		// If this stream is from Provider(input stream) it has multiple output streams
 		std::vector<std::shared_ptr<StreamMetrics>> _output_stream_metrics;
@@ -8,6 +8,7 @@
 //==============================================================================
 #pragma once
 
+#include "domain_routing_table.h"
 #include "enums.h"
 #include "interfaces.h"
 #include "structures.h"
@@ -0,0 +1,127 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "domain_routing_table.h"
+
+#include "../orchestrator_private.h"
+
+namespace ocst
+{
+	DomainRoutingTable::DomainRoutingTable(const std::vector<std::shared_ptr<VirtualHost>> &vhost_list)
+	{
+		ov::String other_pattern;
+
+		for (const auto &vhost : vhost_list)
+		{
+			auto priority = static_cast<Priority>(_vhost_name_list.size());
+			_vhost_name_list.push_back(vhost->name);
+
+			for (const auto &host : vhost->host_list)
+			{
+				const auto &name = host.name;
+
+				if ((name.IndexOf('*') < 0) && (name.IndexOf('?') < 0))
+				{
+					// The first VirtualHost is used if the same name is used by multiple VirtualHosts
+					_exact_map.emplace(name, priority);
+					continue;
+				}
+
+				auto domain = name.HasPrefix("*.") ? name.Substring(2) : "";
+
+				if ((domain.IsEmpty() == false) && (domain.IndexOf('*') < 0) && (domain.IndexOf('?') < 0))
+				{
+					auto labels = domain.Split(".");
+					auto node = &_root;
+
+					for (auto label = labels.rbegin(); label != labels.rend(); ++label)
+					{
+						auto &child = node->children[*label];
+
+						if (child == nullptr)
+						{
+							child = std::make_unique<Node>();
+						}
+
+						node = child.get();
+					}
+
+					node->wildcard_priority = std::min(node->wildcard_priority, priority);
+					continue;
+				}
+
+				other_pattern.AppendFormat("%s(%s)", other_pattern.IsEmpty() ? "" : "|", ov::Regex::WildCardRegex(name, false).CStr());
+				_other_priority_list.push_back(priority);
+			}
+		}
+
+		if (other_pattern.IsEmpty() == false)
+		{
+			_other_regex = ov::Regex(ov::String::FormatString("^(?:%s)$", other_pattern.CStr()).CStr());
+
+			auto error = _other_regex.Compile();
+
+			if (error != nullptr)
+			{
+				logte("Could not compile the regex for the domains: %s (%s)", _other_regex.GetPattern().CStr(), error->What());
+			}
+		}
+	}
+
+	ov::String DomainRoutingTable::Find(const ov::String &domain_name) const
+	{
+		auto priority = InvalidPriority;
+
+		auto exact_item = _exact_map.find(domain_name);
+
+		if (exact_item != _exact_map.end())
+		{
+			priority = exact_item->second;
+		}
+
+		// Walks the trie from the last label (e.g. "com" of "www.airensoft.com")
+		auto labels = domain_name.Split(".");
+		auto node = &_root;
+
+		for (auto label = labels.rbegin(); label != labels.rend(); ++label)
+		{
+			auto child = node->children.find(*label);
+
+			if (child == node->children.end())
+			{
+				break;
+			}
+
+			node = child->second.get();
+
+			// "*.<domain>" matches only if the domain name has more labels than the domain
+			if ((label + 1) != labels.rend())
+			{
+				priority = std::min(priority, node->wildcard_priority);
+			}
+		}
+
+		// The regex is tested only if it can find a VirtualHost with higher priority
+		if (_other_regex.IsCompiled() && (_other_priority_list.front() < priority))
+		{
+			auto match_result = _other_regex.Matches(domain_name.CStr());
+
+			if (match_result.IsMatched())
+			{
+				// Only the group of the matched alternative is set, and it is the last group
+				auto group_index = match_result.GetGroupCount() - 1;
+
+				if ((group_index > 0) && (group_index <= _other_priority_list.size()))
+				{
+					priority = std::min(priority, _other_priority_list[group_index - 1]);
+				}
+			}
+		}
+
+		return (priority != InvalidPriority) ? _vhost_name_list[priority] : "";
+	}
+}  // namespace ocst
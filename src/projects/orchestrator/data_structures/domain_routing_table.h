@@ -0,0 +1,56 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/ovlibrary/ovlibrary.h>
+
+#include "structures.h"
+
+namespace ocst
+{
+	// An immutable table to find the VirtualHost for a domain, built from the ordered VirtualHost list.
+	//
+	// The first VirtualHost (in the order of the list) that has a matching <Host><Names><Name> is returned, like the linear search.
+	// The names are classified to find the candidates without testing each of them:
+	//   - The exact names (without wildcard) are in a hash map
+	//   - "*.<domain>" are in a trie of the labels (walked from the last label of the domain)
+	//   - The other wildcards are compiled into one regex of the alternatives
+	class DomainRoutingTable
+	{
+	public:
+		explicit DomainRoutingTable(const std::vector<std::shared_ptr<VirtualHost>> &vhost_list);
+
+		// Returns an empty string if there is no VirtualHost for <domain_name>
+		ov::String Find(const ov::String &domain_name) const;
+
+	private:
+		using Priority = uint32_t;
+		static constexpr Priority InvalidPriority = UINT32_MAX;
+
+		struct Node
+		{
+			std::unordered_map<ov::String, std::unique_ptr<Node>> children;
+			// The priority of "*.<the labels from the root to this node>"
+			Priority wildcard_priority = InvalidPriority;
+		};
+
+		void AddName(const ov::String &name, Priority priority);
+
+		// Index: priority
+		std::vector<ov::String> _vhost_name_list;
+
+		std::unordered_map<ov::String, Priority> _exact_map;
+		Node _root;
+
+		// ^(?:(<alternative 1>)|(<alternative 2>)|...)$ - PCRE tries the alternatives in order,
+		// so the first group that matches has the highest priority
+		ov::Regex _other_regex;
+		// Index: the number of the group - 1
+		std::vector<Priority> _other_priority_list;
+	};
+}  // namespace ocst
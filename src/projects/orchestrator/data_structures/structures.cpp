@@ -81,27 +81,9 @@ namespace ocst
 
 	bool Host::UpdateRegex()
 	{
-		// Escape special characters: '[', '\', '.', '/', '+', '{', '}', '$', '^', '|' to \<char>
-		auto special_characters = std::regex(R"([[\\.\/+{}$^|])");
-		ov::String escaped = std::regex_replace(name.CStr(), special_characters, R"(\$&)").c_str();
-		// Change '*'/'?' to .<char>
-		escaped = escaped.Replace(R"(*)", R"(.*)");
-		escaped = escaped.Replace(R"(?)", R"(.?)");
-		escaped.Prepend("^");
-		escaped.Append("$");
-
-		std::regex expression;
-
-		try
-		{
-			regex_for_domain = std::regex(escaped);
-		}
-		catch (std::exception &e)
-		{
-			return false;
-		}
+		regex_for_domain = ov::Regex(ov::Regex::WildCardRegex(name).CStr());
 
-		return true;
+		return (regex_for_domain.Compile() == nullptr);
 	}
 
 	//--------------------------------------------------------------------
@@ -13,7 +13,6 @@
 #include <base/publisher/stream.h>
 #include <base/mediarouter/mediarouter_application_observer.h>
 #include <modules/origin_map_client/origin_map_client.h>
-#include <regex>
 
 #include "interfaces.h"
 
@@ -27,6 +26,25 @@ namespace ocst
 		std::shared_ptr<ModuleInterface> module = nullptr;
 	};
 
+	// Time taken by a module to create the applications of the configuration when the server starts
+	struct ModuleStartupTime
+	{
+		ov::String module_name;
+		size_t application_count = 0;
+		int64_t elapsed_ms = 0;
+	};
+
+	// A server that the new viewers are redirected to while this server is draining
+	struct DrainAlternative
+	{
+		// <host>[:<port>] (the port of the request is used if it is omitted)
+		ov::String host;
+		// Relative share of the redirected viewers (e.g. the free capacity of the server reported by the fleet tooling)
+		uint32_t weight = 1;
+		// State of the smooth weighted round-robin
+		int64_t current_weight = 0;
+	};
+
 	struct Stream
 	{
 		Stream(const info::Application &app_info, const std::shared_ptr<PullProviderModuleInterface> &provider, const std::shared_ptr<pvd::Stream> &provider_stream, const ov::String &full_name);
@@ -87,7 +105,7 @@ namespace ocst
 
 		// The name of Host in the configuration (eg: *, *.airensoft.com)
 		ov::String name;
-		std::regex regex_for_domain;
+		ov::Regex regex_for_domain;
 
 		typedef std::map<info::stream_id_t, std::shared_ptr<Stream>> stream_map_t;
 
@@ -162,6 +180,11 @@ namespace ocst
 		bool is_origin_map_store_enabled = false;
 		ov::String origin_base_url;
 		std::shared_ptr<OriginMapClient> origin_map_client = nullptr;
+		// Edge prefetches the popular streams of OriginMapStore (OriginMapStore.Prefetch)
+		int32_t prefetch_stream_count = 0;
+		int64_t prefetch_max_bitrate = 0;
+		// app/stream : properties of the prefetched stream
+		std::map<ov::String, std::shared_ptr<pvd::PullStreamProperties>> prefetched_streams;
 
 		// Template of dynamic application configuration
 		cfg::vhost::app::Application app_cfg_template;
@@ -169,6 +192,9 @@ namespace ocst
 		// Application list
 		std::map<info::application_id_t, std::shared_ptr<Application>> app_map;
 
+		// app name : reloaded configuration waiting for the application to have no streams (nullptr: delete the application)
+		std::map<ov::String, std::shared_ptr<const cfg::vhost::app::Application>> pending_app_cfg_map;
+
 		// A flag used to determine if an item has changed
 		ItemState state = ItemState::Unknown;
 	};
@@ -0,0 +1,169 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "load_reporter.h"
+
+#include <monitoring/monitoring.h>
+#include <transcoder/transcoder_load_controller.h>
+
+#include "orchestrator.h"
+#include "orchestrator_private.h"
+
+namespace ocst
+{
+	bool LoadReporter::Start(const cfg::modules::LoadReport &config)
+	{
+		_enabled = config.IsEnabled();
+
+		if (_enabled == false)
+		{
+			return true;
+		}
+
+		_max_egress = std::max(config.GetMaxEgress(), static_cast<int64_t>(0));
+		_max_sessions = std::max(config.GetMaxSessions(), 0);
+		_host_name = config.GetHostName();
+
+		_last_bytes_out = MonitorInstance->GetServerMetrics()->GetTotalBytesOut();
+		_last_update_time_msec = ov::Clock::NowMSec();
+
+		Update();
+
+		_timer.Push(
+			[this](void *parameter) -> ov::DelayQueueAction {
+				Update();
+				return ov::DelayQueueAction::Repeat;
+			},
+			std::max(config.GetInterval(), 100));
+
+		logti("Load report is enabled (Interval: %dms, MaxEgress: %" PRId64 "bps, MaxSessions: %" PRId64 ", HostName: %s)",
+			  config.GetInterval(), _max_egress, _max_sessions, _host_name.IsEmpty() ? "(not reported)" : _host_name.CStr());
+
+		return _timer.Start();
+	}
+
+	void LoadReporter::Stop()
+	{
+		if (_enabled)
+		{
+			_timer.Stop();
+		}
+	}
+
+	std::shared_ptr<const LoadReport> LoadReporter::GetReport() const
+	{
+		std::lock_guard<std::mutex> lock(_report_mutex);
+		return _report;
+	}
+
+	void LoadReporter::Update()
+	{
+		auto server_metrics = MonitorInstance->GetServerMetrics();
+		auto now = ov::Clock::NowMSec();
+
+		auto report = std::make_shared<LoadReport>();
+		report->created_time_msec = now;
+
+		auto &json = report->json;
+		double usage = 0.0;
+
+		// CPU
+		auto cpu_usage = TranscodeLoadController::GetInstance()->GetCpuUsage();
+		json["cpu"] = cpu_usage;
+		usage = std::max(usage, cpu_usage / 100.0);
+
+		// Egress
+		auto bytes_out = server_metrics->GetTotalBytesOut();
+		auto elapsed_msec = now - _last_update_time_msec;
+		uint64_t egress_bps = 0;
+
+		if ((elapsed_msec > 0) && (bytes_out >= _last_bytes_out))
+		{
+			egress_bps = (bytes_out - _last_bytes_out) * 8 * 1000 / elapsed_msec;
+		}
+
+		_last_bytes_out = bytes_out;
+		_last_update_time_msec = now;
+
+		Json::Value &egress = json["egress"];
+		egress["bps"] = static_cast<Json::UInt64>(egress_bps);
+		if (_max_egress > 0)
+		{
+			auto egress_usage = static_cast<double>(egress_bps) / _max_egress;
+			egress["usage"] = egress_usage;
+			usage = std::max(usage, egress_usage);
+		}
+
+		// Sessions
+		Json::Value &sessions = json["sessions"];
+		auto total_connections = server_metrics->GetTotalConnections();
+		sessions["total"] = total_connections;
+		if (_max_sessions > 0)
+		{
+			auto session_usage = static_cast<double>(total_connections) / _max_sessions;
+			sessions["usage"] = session_usage;
+			usage = std::max(usage, session_usage);
+		}
+
+		Json::Value &publishers = sessions["publishers"];
+		publishers = Json::Value(Json::ValueType::objectValue);
+		for (int type = static_cast<int>(PublisherType::Unknown) + 1; type < static_cast<int>(PublisherType::NumberOfPublishers); type++)
+		{
+			auto connections = server_metrics->GetConnections(static_cast<PublisherType>(type));
+			if (connections > 0)
+			{
+				publishers[StringFromPublisherType(static_cast<PublisherType>(type)).CStr()] = static_cast<Json::UInt64>(connections);
+			}
+		}
+
+		Json::Value &vhosts = sessions["vhosts"];
+		vhosts = Json::Value(Json::ValueType::objectValue);
+		for (const auto &[host_id, host_metrics] : server_metrics->GetHostMetricsList())
+		{
+			vhosts[host_metrics->GetName().CStr()] = host_metrics->GetTotalConnections();
+		}
+
+		// Encoders
+		auto load_controller = TranscodeLoadController::GetInstance();
+		if (load_controller->IsAdmissionEnabled())
+		{
+			auto encoder_usage = load_controller->GetReservedRatio();
+			json["encoder"] = encoder_usage;
+			usage = std::max(usage, encoder_usage);
+		}
+
+		// Queues
+		double queue_pressure = 0.0;
+		for (const auto &[queue_id, queue_metrics] : server_metrics->GetQueueMetricsList())
+		{
+			auto threshold = queue_metrics->GetThreshold();
+			if (threshold > 0)
+			{
+				queue_pressure = std::max(queue_pressure, static_cast<double>(queue_metrics->GetSize()) / threshold);
+			}
+		}
+		queue_pressure = std::min(queue_pressure, 1.0);
+		json["queue"] = queue_pressure;
+		usage = std::max(usage, queue_pressure);
+
+		bool is_draining = Orchestrator::GetInstance()->IsDraining();
+		json["draining"] = is_draining;
+
+		report->score = is_draining ? 100.0 : std::min(usage, 1.0) * 100.0;
+		json["score"] = report->score;
+		json["timestamp"] = static_cast<Json::Int64>(now);
+		if (_host_name.IsEmpty() == false)
+		{
+			json["host"] = _host_name.CStr();
+		}
+
+		report->json_string = ov::Json::Stringify(json);
+
+		std::lock_guard<std::mutex> lock(_report_mutex);
+		_report = std::move(report);
+	}
+}  // namespace ocst
@@ -0,0 +1,70 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/ovlibrary/delay_queue.h>
+#include <base/ovlibrary/ovlibrary.h>
+#include <config/config.h>
+
+namespace ocst
+{
+	struct LoadReport
+	{
+		// 0~100: the highest usage of the resources below (100 while the server is draining)
+		double score = 0.0;
+		int64_t created_time_msec = 0;
+
+		// Serialized once when the report is made, so that the requests of the load balancers only copy it
+		Json::Value json;
+		ov::String json_string;
+	};
+
+	// Computes the load of the server every <Interval> from the metrics that are already collected:
+	//
+	// - CPU usage of the host
+	// - Egress bitrate (to <MaxEgress>)
+	// - Number of sessions (to <MaxSessions>), per publisher and VirtualHost
+	// - Reserved encoding capacity (if TranscodeAdmission is enabled)
+	// - Queue pressure: the fullest ManagedQueue relative to its threshold
+	class LoadReporter
+	{
+	public:
+		bool Start(const cfg::modules::LoadReport &config);
+		void Stop();
+
+		bool IsEnabled() const
+		{
+			return _enabled;
+		}
+
+		// The name of the server in the OriginMapStores (empty if the load is not reported)
+		const ov::String &GetHostName() const
+		{
+			return _host_name;
+		}
+
+		// nullptr until the first report is made
+		std::shared_ptr<const LoadReport> GetReport() const;
+
+	private:
+		void Update();
+
+		bool _enabled = false;
+		int64_t _max_egress = 0;
+		int64_t _max_sessions = 0;
+		ov::String _host_name;
+
+		ov::DelayQueue _timer{"LoadReporter"};
+
+		uint64_t _last_bytes_out = 0;
+		int64_t _last_update_time_msec = 0;
+
+		mutable std::mutex _report_mutex;
+		std::shared_ptr<const LoadReport> _report;
+	};
+}  // namespace ocst
@@ -44,6 +44,8 @@ namespace ocst
 		3000);
 		_timer.Start();
 
+		_load_reporter.Start(_server_config->GetModules().GetLoadReport());
+
 		return true;
 	}
 
@@ -75,6 +77,252 @@ namespace ocst
 				}
 			}
 		}
+
+		// [Job] Apply the reloaded configuration to the applications that had streams at that time
+		{
+			auto scoped_lock = std::scoped_lock(_module_list_mutex, _virtual_host_map_mutex);
+
+			for (auto &vhost_item : _virtual_host_list)
+			{
+				if (vhost_item->pending_app_cfg_map.empty() == false)
+				{
+					ApplyPendingApplicationConfigs(vhost_item);
+				}
+			}
+		}
+
+		// [Job] Share the popular streams of the cluster through OriginMapStore
+		ReportStreamPopularity();
+		PrefetchPopularStreams();
+		ReportLoad();
+	}
+
+	std::map<ov::String, std::shared_ptr<mon::StreamMetrics>> Orchestrator::GetInputStreamMetricsMap() const
+	{
+		std::map<ov::String, std::shared_ptr<mon::StreamMetrics>> stream_metrics_map;
+
+		for (auto &[host_id, host_metrics] : MonitorInstance->GetHostMetricsList())
+		{
+			for (auto &[app_id, app_metrics] : host_metrics->GetApplicationMetricsList())
+			{
+				for (auto &[stream_id, stream_metrics] : app_metrics->GetStreamMetricsMap())
+				{
+					if (stream_metrics->IsInputStream())
+					{
+						auto key = ov::String::FormatString("%s/%s", stream_metrics->GetApplicationInfo().GetName().CStr(), stream_metrics->GetName().CStr());
+						stream_metrics_map[key] = stream_metrics;
+					}
+				}
+			}
+		}
+
+		return stream_metrics_map;
+	}
+
+	void Orchestrator::ReportStreamPopularity()
+	{
+		for (auto &[key, stream_metrics] : GetInputStreamMetricsMap())
+		{
+			if (stream_metrics->IsFromOriginMapStore())
+			{
+				// The stream is registered by the other origin
+				continue;
+			}
+
+			auto &vhost_app_name = stream_metrics->GetApplicationInfo().GetName();
+
+			CommonErrorCode error;
+			ov::String origin_base_url;
+			auto client = GetOriginMapClient(vhost_app_name, error, &origin_base_url);
+			if ((client == nullptr) || origin_base_url.IsEmpty())
+			{
+				// Only the origin registers the streams
+				continue;
+			}
+
+			// The sessions of the output streams are also counted in the input stream
+			auto app_stream_name = ov::String::FormatString("%s/%s", vhost_app_name.GetAppName().CStr(), stream_metrics->GetName().CStr());
+			client->UpdateViewerCount(app_stream_name, stream_metrics->GetTotalConnections());
+		}
+	}
+
+	void Orchestrator::ReportLoad()
+	{
+		auto &host_name = _load_reporter.GetHostName();
+		auto report = _load_reporter.GetReport();
+
+		if (host_name.IsEmpty() || (report == nullptr))
+		{
+			return;
+		}
+
+		std::vector<std::shared_ptr<OriginMapClient>> clients;
+
+		{
+			auto scoped_lock = std::scoped_lock(_virtual_host_map_mutex);
+
+			for (auto &vhost : _virtual_host_list)
+			{
+				if ((vhost->is_origin_map_store_enabled) && (vhost->origin_map_client != nullptr) &&
+					(std::find(clients.begin(), clients.end(), vhost->origin_map_client) == clients.end()))
+				{
+					clients.push_back(vhost->origin_map_client);
+				}
+			}
+		}
+
+		for (auto &client : clients)
+		{
+			client->ReportLoad(host_name, report->score, report->json_string);
+		}
+	}
+
+	static int64_t GetStreamBitrate(const std::shared_ptr<info::Stream> &stream)
+	{
+		int64_t bitrate = 0;
+
+		for (auto &[track_id, track] : stream->GetTracks())
+		{
+			bitrate += std::max(track->GetBitrate(), 0);
+		}
+
+		return bitrate;
+	}
+
+	void Orchestrator::PrefetchPopularStreams()
+	{
+		std::vector<std::shared_ptr<VirtualHost>> vhost_list;
+
+		{
+			auto scoped_lock = std::scoped_lock(_virtual_host_map_mutex);
+
+			for (auto &vhost : _virtual_host_list)
+			{
+				if ((vhost->origin_map_client != nullptr) && (vhost->prefetch_stream_count > 0))
+				{
+					vhost_list.push_back(vhost);
+				}
+			}
+		}
+
+		// Redis and the origins are requested without the lock
+		for (auto &vhost : vhost_list)
+		{
+			PrefetchPopularStreams(vhost);
+		}
+	}
+
+	void Orchestrator::PrefetchPopularStreams(const std::shared_ptr<VirtualHost> &vhost)
+	{
+		// vhost->prefetched_streams is used only in the timer thread
+		auto &prefetched_streams = vhost->prefetched_streams;
+		auto client = vhost->origin_map_client;
+
+		auto popular_streams = client->GetPopularStreams(vhost->prefetch_stream_count);
+		std::set<ov::String> popular_stream_names;
+		for (auto &[app_stream_name, viewer_count] : popular_streams)
+		{
+			popular_stream_names.insert(app_stream_name);
+		}
+
+		auto stream_metrics_map = GetInputStreamMetricsMap();
+		auto get_stream_metrics = [&](const ov::String &app_stream_name) -> std::shared_ptr<mon::StreamMetrics> {
+			auto item = stream_metrics_map.find(ov::String::FormatString("%s/%s", info::VHostAppName(vhost->name, "").CStr(), app_stream_name.CStr()));
+			return (item != stream_metrics_map.end()) ? item->second : nullptr;
+		};
+
+		// The bitrate of the prefetched streams which have no viewers yet
+		int64_t prefetch_bitrate = 0;
+
+		for (auto it = prefetched_streams.begin(); it != prefetched_streams.end();)
+		{
+			auto &[app_stream_name, properties] = *it;
+			auto stream_metrics = get_stream_metrics(app_stream_name);
+
+			if ((stream_metrics == nullptr) || (popular_stream_names.find(app_stream_name) == popular_stream_names.end()))
+			{
+				// The stream is deleted, or it is not popular anymore, so it can be deleted when it is not used
+				logti("%s stream is no longer prefetched", app_stream_name.CStr());
+				properties->EnablePrefetched(false);
+				it = prefetched_streams.erase(it);
+				continue;
+			}
+
+			if (stream_metrics->GetTotalConnections() == 0)
+			{
+				prefetch_bitrate += GetStreamBitrate(stream_metrics);
+			}
+
+			++it;
+		}
+
+		for (auto &[app_stream_name, viewer_count] : popular_streams)
+		{
+			if ((vhost->prefetch_max_bitrate > 0) && (prefetch_bitrate >= vhost->prefetch_max_bitrate))
+			{
+				logtd("Prefetch bitrate budget is exhausted: %" PRId64 " / %" PRId64 " bps", prefetch_bitrate, vhost->prefetch_max_bitrate);
+				break;
+			}
+
+			if ((prefetched_streams.find(app_stream_name) != prefetched_streams.end()) || (get_stream_metrics(app_stream_name) != nullptr))
+			{
+				// Already prefetched, or pulled by a viewer
+				continue;
+			}
+
+			auto slash_index = app_stream_name.IndexOf('/');
+			if (slash_index <= 0)
+			{
+				continue;
+			}
+
+			ov::String origin_url;
+			auto result = client->GetOrigin(app_stream_name, origin_url);
+			if (result == CommonErrorCode::NOT_FOUND)
+			{
+				// The origin of the stream has been terminated without unregistering it
+				client->RemovePopularStream(app_stream_name);
+				continue;
+			}
+			else if (result != CommonErrorCode::SUCCESS)
+			{
+				continue;
+			}
+
+			auto parsed_url = ov::Url::Parse(origin_url);
+			if (parsed_url == nullptr)
+			{
+				continue;
+			}
+
+			auto vhost_app_name = info::VHostAppName(vhost->name, app_stream_name.Left(slash_index));
+			auto stream_name = app_stream_name.Substring(slash_index + 1);
+
+			auto properties = std::make_shared<pvd::PullStreamProperties>();
+			properties->EnableFromOriginMapStore(true);
+			properties->EnablePrefetched(true);
+			if (parsed_url->Scheme().UpperCaseString() == "OVT")
+			{
+				properties->EnableRelay(true);
+			}
+
+			logti("Prefetch %s stream which has %u viewers in the cluster", app_stream_name.CStr(), viewer_count);
+
+			if (RequestPullStreamWithUrls(nullptr, vhost_app_name, stream_name, {origin_url}, 0, properties) == false)
+			{
+				continue;
+			}
+
+			prefetched_streams[app_stream_name] = properties;
+
+			// The tracks are described when the stream is pulled
+			stream_metrics_map = GetInputStreamMetricsMap();
+			auto stream_metrics = get_stream_metrics(app_stream_name);
+			if (stream_metrics != nullptr)
+			{
+				prefetch_bitrate += GetStreamBitrate(stream_metrics);
+			}
+		}
 	}
 
 	ocst::Result Orchestrator::Release()
@@ -105,6 +353,8 @@ namespace ocst
 		_virtual_host_list.clear();
 		_virtual_host_map.clear();
 
+		_load_reporter.Stop();
+
 		mon::Monitoring::GetInstance()->Release();
 
 		return Result::Succeeded;
@@ -112,6 +362,13 @@ namespace ocst
 
 	bool Orchestrator::CreateVirtualHosts(const std::vector<cfg::vhost::VirtualHost> &vhost_conf_list)
 	{
+		auto &parallel_startup_config = _server_config->GetModules().GetParallelStartup();
+
+		if (parallel_startup_config.IsEnabled())
+		{
+			return CreateVirtualHostsInParallel(vhost_conf_list, std::max(parallel_startup_config.GetWorkerCount(), 1));
+		}
+
 		for (const auto &vhost_conf : vhost_conf_list)
 		{
 			// Create VirtualHost in Orchestrator
@@ -125,6 +382,68 @@ namespace ocst
 		return true;
 	}
 
+	bool Orchestrator::CreateVirtualHostsInParallel(const std::vector<cfg::vhost::VirtualHost> &vhost_conf_list, int worker_count)
+	{
+		auto scoped_lock = std::scoped_lock(_module_list_mutex, _virtual_host_map_mutex);
+
+		std::vector<info::Application> app_info_list;
+
+		for (const auto &vhost_conf : vhost_conf_list)
+		{
+			info::Host vhost_info(_server_config->GetName(), _server_config->GetID(), vhost_conf);
+
+			if (OrchestratorInternal::CreateVirtualHost(vhost_info) != Result::Succeeded)
+			{
+				logte("Could not create VirtualHost(%s)", vhost_conf.GetName().CStr());
+				return false;
+			}
+
+			auto &vhost_name = vhost_info.GetName();
+
+			for (const auto &app_cfg : vhost_info.GetApplicationList())
+			{
+				if (app_cfg.GetName() == "*")
+				{
+					// wildcard application is template for dynamic applications
+					if (CreateApplicationTemplate(vhost_info, app_cfg) != Result::Succeeded)
+					{
+						return false;
+					}
+				}
+				else
+				{
+					app_info_list.push_back(info::Application(vhost_info, GetNextAppId(), ResolveApplicationName(vhost_name, app_cfg.GetName()), app_cfg, false));
+				}
+			}
+		}
+
+		ov::StopWatch stop_watch;
+		stop_watch.Start();
+
+		std::vector<ModuleStartupTime> timeline;
+		auto result = OrchestratorInternal::CreateApplications(app_info_list, worker_count, nullptr, &timeline);
+
+		{
+			std::lock_guard<std::mutex> lock(_startup_timeline_mutex);
+			_startup_timeline = std::move(timeline);
+			_startup_elapsed_ms = stop_watch.Elapsed();
+		}
+
+		return result == Result::Succeeded;
+	}
+
+	std::vector<ModuleStartupTime> Orchestrator::GetStartupTimeline(int64_t *elapsed_ms) const
+	{
+		std::lock_guard<std::mutex> lock(_startup_timeline_mutex);
+
+		if (elapsed_ms != nullptr)
+		{
+			*elapsed_ms = _startup_elapsed_ms;
+		}
+
+		return _startup_timeline;
+	}
+
 
 	Result Orchestrator::CreateVirtualHost(const cfg::vhost::VirtualHost &vhost_cfg)
 	{
@@ -321,6 +640,41 @@ namespace ocst
 		return result;
 	}
 
+	std::vector<ocst::Result> Orchestrator::CreateApplications(const info::Host &host_info, const std::vector<cfg::vhost::app::Application> &app_config_list)
+	{
+		auto &parallel_startup_config = _server_config->GetModules().GetParallelStartup();
+		size_t worker_count = parallel_startup_config.IsEnabled() ? std::max(parallel_startup_config.GetWorkerCount(), 1) : 1;
+
+		auto scoped_lock = std::scoped_lock(_module_list_mutex, _virtual_host_map_mutex);
+
+		auto &vhost_name = host_info.GetName();
+
+		std::vector<info::Application> app_info_list;
+		app_info_list.reserve(app_config_list.size());
+
+		for (const auto &app_config : app_config_list)
+		{
+			app_info_list.push_back(info::Application(host_info, GetNextAppId(), ResolveApplicationName(vhost_name, app_config.GetName()), app_config, false));
+		}
+
+		std::vector<Result> result_list;
+		OrchestratorInternal::CreateApplications(app_info_list, worker_count, &result_list, nullptr);
+
+		for (size_t index = 0; index < result_list.size(); index++)
+		{
+			if (result_list[index] == Result::Exists)
+			{
+				logtc("Duplicate application [%s/%s] found. Please check the settings.", vhost_name.CStr(), app_config_list[index].GetName().CStr());
+			}
+			else if (result_list[index] != Result::Succeeded)
+			{
+				logtc("Failed to create an application: %s/%s", vhost_name.CStr(), app_config_list[index].GetName().CStr());
+			}
+		}
+
+		return result_list;
+	}
+
 	ocst::Result Orchestrator::DeleteApplication(const info::Application &app_info)
 	{
 		auto scoped_lock = std::scoped_lock(_module_list_mutex, _virtual_host_map_mutex);
@@ -367,7 +721,7 @@ namespace ocst
 	bool Orchestrator::UpdateVirtualHosts(const std::vector<info::Host> &host_list)
 	{
 		bool result = true;
-		auto scoped_lock = std::scoped_lock(_virtual_host_map_mutex);
+		auto scoped_lock = std::scoped_lock(_module_list_mutex, _virtual_host_map_mutex);
 
 		// Mark all items as NeedToCheck
 		for (auto &vhost_item : _virtual_host_map)
@@ -390,7 +744,19 @@ namespace ocst
 			// New VHost
 			if (previous_vhost_item == _virtual_host_map.end())
 			{
-				CreateVirtualHost(host_info);
+				if (OrchestratorInternal::CreateVirtualHost(host_info) != Result::Succeeded)
+				{
+					logte("Could not create VirtualHost: %s", host_info.GetName().CStr());
+					result = false;
+					continue;
+				}
+
+				// Creates all the applications of the new VirtualHost
+				if (UpdateApplications(GetVirtualHost(host_info.GetName()), host_info, false) == false)
+				{
+					result = false;
+				}
+
 				continue;
 			}
 
@@ -410,6 +776,12 @@ namespace ocst
 			{
 				vhost->state = ItemState::Changed;
 			}
+
+			logtd("    - Processing for applications");
+			if (UpdateApplications(vhost, host_info, new_state_for_host != ItemState::NotChanged) == false)
+			{
+				result = false;
+			}
 		}
 
 		// Dump all items
@@ -468,11 +840,145 @@ namespace ocst
 			}
 		}
 
+		// The host lists may be changed
+		RebuildDomainRoutingTable();
+
 		logtd("All items are applied");
 
 		return result;
 	}
 
+	bool Orchestrator::UpdateApplications(const std::shared_ptr<VirtualHost> &vhost, const info::Host &host_info, bool is_host_changed)
+	{
+		if (vhost == nullptr)
+		{
+			return false;
+		}
+
+		bool result = true;
+		auto &running_host_info = vhost->host_info;
+		auto is_tls_changed = (running_host_info.GetHost().GetTls().ToJson(true) != host_info.GetHost().GetTls().ToJson(true));
+
+		// Only the configuration part is replaced, so the ID of the host is kept.
+		// The access controls (SignedPolicy, AdmissionWebhooks, ...) read it for every request, so they are applied immediately.
+		static_cast<cfg::vhost::VirtualHost &>(running_host_info) = host_info;
+
+		if (is_tls_changed || is_host_changed)
+		{
+			if (OrchestratorInternal::ReloadCertificate(vhost) != Result::Succeeded)
+			{
+				logtw("Could not reload the certificate of VirtualHost: %s", vhost->name.CStr());
+			}
+		}
+
+		// The latest configuration replaces the changes that are still pending
+		vhost->pending_app_cfg_map.clear();
+		vhost->app_cfg_template = cfg::vhost::app::Application();
+
+		std::map<ov::String, const cfg::vhost::app::Application *> app_cfg_map;
+
+		for (const auto &app_cfg : host_info.GetApplicationList())
+		{
+			if (app_cfg.GetName() == "*")
+			{
+				// Dynamic applications that will be created from now on use the new template
+				if (CreateApplicationTemplate(host_info, app_cfg) != Result::Succeeded)
+				{
+					result = false;
+				}
+
+				continue;
+			}
+
+			app_cfg_map[app_cfg.GetName()] = &app_cfg;
+		}
+
+		for (const auto &[app_id, app] : vhost->app_map)
+		{
+			auto &app_info = app->app_info;
+
+			if (app_info.IsDynamicApp())
+			{
+				continue;
+			}
+
+			auto &app_name = app_info.GetName().GetAppName();
+			auto app_cfg_item = app_cfg_map.find(app_name);
+
+			if (app_cfg_item == app_cfg_map.end())
+			{
+				logti("Application is removed from the configuration: %s", app_info.GetName().CStr());
+				vhost->pending_app_cfg_map[app_name] = nullptr;
+			}
+			else
+			{
+				if (app_info.GetConfig().ToJson(true) != app_cfg_item->second->ToJson(true))
+				{
+					logti("Configuration of the application is changed: %s", app_info.GetName().CStr());
+					vhost->pending_app_cfg_map[app_name] = std::make_shared<const cfg::vhost::app::Application>(*(app_cfg_item->second));
+				}
+
+				app_cfg_map.erase(app_cfg_item);
+			}
+		}
+
+		// New applications (a dynamic application with the same name is replaced when it has no streams)
+		for (const auto &[app_name, app_cfg] : app_cfg_map)
+		{
+			vhost->pending_app_cfg_map[app_name] = std::make_shared<const cfg::vhost::app::Application>(*app_cfg);
+		}
+
+		return ApplyPendingApplicationConfigs(vhost) && result;
+	}
+
+	bool Orchestrator::ApplyPendingApplicationConfigs(const std::shared_ptr<VirtualHost> &vhost)
+	{
+		bool result = true;
+		auto &pending_app_cfg_map = vhost->pending_app_cfg_map;
+
+		for (auto pending_item = pending_app_cfg_map.begin(); pending_item != pending_app_cfg_map.end();)
+		{
+			auto &[app_name, app_cfg] = *pending_item;
+			std::shared_ptr<Application> running_app;
+
+			for (const auto &[app_id, app] : vhost->app_map)
+			{
+				if (app->app_info.GetName().GetAppName() == app_name)
+				{
+					running_app = app;
+					break;
+				}
+			}
+
+			if (running_app != nullptr)
+			{
+				if ((running_app->GetProviderStreamCount() > 0) || (running_app->GetPublisherStreamCount() > 0))
+				{
+					// The live streams are not interrupted
+					logtd("Application [%s] has streams, so the new configuration will be applied later", running_app->app_info.GetName().CStr());
+					++pending_item;
+					continue;
+				}
+
+				if (OrchestratorInternal::DeleteApplication(running_app->app_info) != Result::Succeeded)
+				{
+					logte("Could not delete application: %s", running_app->app_info.GetName().CStr());
+					result = false;
+				}
+			}
+
+			if ((app_cfg != nullptr) && (CreateApplication(vhost->host_info, *app_cfg) != Result::Succeeded))
+			{
+				logte("Could not create application [%s] in VirtualHost [%s]", app_name.CStr(), vhost->name.CStr());
+				result = false;
+			}
+
+			pending_item = pending_app_cfg_map.erase(pending_item);
+		}
+
+		return result;
+	}
+
 	std::vector<std::shared_ptr<ocst::VirtualHost>> Orchestrator::GetVirtualHostList()
 	{
 		auto scoped_lock = std::scoped_lock(_virtual_host_map_mutex);
@@ -553,24 +1059,14 @@ namespace ocst
 
 	ov::String Orchestrator::GetVhostNameFromDomain(const ov::String &domain_name) const
 	{
-		// TODO(dimiden): I think it would be nice to create a VHost cache for performance
-
 		if (domain_name.IsEmpty() == false)
 		{
-			auto scoped_lock = std::scoped_lock(_virtual_host_map_mutex);
-
-			// Search for the domain corresponding to domain_name
+			// The table keeps the order of _virtual_host_list
+			auto domain_routing_table = std::atomic_load(&_domain_routing_table);
 
-			// CAUTION: This code is important to order, so don't use _virtual_host_map
-			for (auto &vhost_item : _virtual_host_list)
+			if (domain_routing_table != nullptr)
 			{
-				for (auto &host_item : vhost_item->host_list)
-				{
-					if (std::regex_match(domain_name.CStr(), host_item.regex_for_domain))
-					{
-						return vhost_item->name;
-					}
-				}
+				return domain_routing_table->Find(domain_name);
 			}
 		}
 
@@ -984,7 +1480,7 @@ namespace ocst
 		return nullptr;
 	}
 
-	CommonErrorCode Orchestrator::IsExistStreamInOriginMapStore(const info::VHostAppName &vhost_app_name, const ov::String &stream_name) const
+	std::shared_ptr<OriginMapClient> Orchestrator::GetOriginMapClient(const info::VHostAppName &vhost_app_name, CommonErrorCode &error, ov::String *origin_base_url) const
 	{
 		//lock 
 		auto scoped_lock = std::scoped_lock(_virtual_host_map_mutex);
@@ -993,20 +1489,42 @@ namespace ocst
 		if (vhost == nullptr)
 		{
 			// Error
-			return CommonErrorCode::ERROR;
+			error = CommonErrorCode::ERROR;
+			return nullptr;
 		}
 
 		if (vhost->is_origin_map_store_enabled == false)
 		{
 			// disabled by user
-			return CommonErrorCode::DISABLED;
+			error = CommonErrorCode::DISABLED;
+			return nullptr;
 		}
 		
 		auto client = vhost->origin_map_client;
 		if (client == nullptr)
 		{
 			// Error
-			return CommonErrorCode::ERROR;
+			error = CommonErrorCode::ERROR;
+			return nullptr;
+		}
+
+		if (origin_base_url != nullptr)
+		{
+			*origin_base_url = vhost->origin_base_url;
+		}
+
+		error = CommonErrorCode::SUCCESS;
+		return client;
+	}
+
+	CommonErrorCode Orchestrator::IsExistStreamInOriginMapStore(const info::VHostAppName &vhost_app_name, const ov::String &stream_name) const
+	{
+		// The lock of virtual hosts is not held while waiting for redis
+		CommonErrorCode error;
+		auto client = GetOriginMapClient(vhost_app_name, error);
+		if (client == nullptr)
+		{
+			return error;
 		}
 
 		auto app_stream_name = ov::String::FormatString("%s/%s", vhost_app_name.GetAppName().CStr(), stream_name.CStr());
@@ -1017,26 +1535,10 @@ namespace ocst
 
 	std::shared_ptr<ov::Url> Orchestrator::GetOriginUrlFromOriginMapStore(const info::VHostAppName &vhost_app_name, const ov::String &stream_name) const
 	{
-		//lock 
-		auto scoped_lock = std::scoped_lock(_virtual_host_map_mutex);
-
-		auto vhost = GetVirtualHost(vhost_app_name);
-		if (vhost == nullptr)
-		{
-			// Error
-			return nullptr;
-		}
-
-		if (vhost->is_origin_map_store_enabled == false)
-		{
-			// disabled by user
-			return nullptr;
-		}
-		
-		auto client = vhost->origin_map_client;
+		CommonErrorCode error;
+		auto client = GetOriginMapClient(vhost_app_name, error);
 		if (client == nullptr)
 		{
-			// Error
 			return nullptr;
 		}
 
@@ -1053,32 +1555,36 @@ namespace ocst
 
 	CommonErrorCode Orchestrator::RegisterStreamToOriginMapStore(const info::VHostAppName &vhost_app_name, const ov::String &stream_name)
 	{
-		//lock 
-		auto scoped_lock = std::scoped_lock(_virtual_host_map_mutex);
-
-		auto vhost = GetVirtualHost(vhost_app_name);
-		if (vhost == nullptr)
+		CommonErrorCode error;
+		ov::String origin_base_url;
+		auto client = GetOriginMapClient(vhost_app_name, error, &origin_base_url);
+		if (client == nullptr)
 		{
-			// Error
-			return CommonErrorCode::ERROR;
+			return error;
 		}
 
-		if (vhost->is_origin_map_store_enabled == false)
+		auto app_stream_name = ov::String::FormatString("%s/%s", vhost_app_name.GetAppName().CStr(), stream_name.CStr());
+		auto ovt_url = ov::String::FormatString("%s/%s", origin_base_url.CStr(), app_stream_name.CStr());
+		if (client->Register(app_stream_name, ovt_url) == true)
 		{
-			// disabled by user
-			return CommonErrorCode::DISABLED;
+			return CommonErrorCode::SUCCESS;
 		}
-		
-		auto client = vhost->origin_map_client;
+
+		return CommonErrorCode::ERROR;
+	}
+
+	CommonErrorCode Orchestrator::UnregisterStreamFromOriginMapStore(const info::VHostAppName &vhost_app_name, const ov::String &stream_name)
+	{
+		CommonErrorCode error;
+		auto client = GetOriginMapClient(vhost_app_name, error);
 		if (client == nullptr)
 		{
-			// Error
-			return CommonErrorCode::ERROR;
+			return error;
 		}
 
 		auto app_stream_name = ov::String::FormatString("%s/%s", vhost_app_name.GetAppName().CStr(), stream_name.CStr());
-		auto ovt_url = ov::String::FormatString("%s/%s", vhost->origin_base_url.CStr(), app_stream_name.CStr());
-		if (client->Register(app_stream_name, ovt_url) == true)
+
+		if (client->Unregister(app_stream_name) == true)
 		{
 			return CommonErrorCode::SUCCESS;
 		}
@@ -1086,39 +1592,141 @@ namespace ocst
 		return CommonErrorCode::ERROR;
 	}
 
-	CommonErrorCode Orchestrator::UnregisterStreamFromOriginMapStore(const info::VHostAppName &vhost_app_name, const ov::String &stream_name)
+	void Orchestrator::StartDrain(const std::vector<DrainAlternative> &alternatives)
 	{
-		//lock 
-		auto scoped_lock = std::scoped_lock(_virtual_host_map_mutex);
+		size_t alternative_count = 0;
 
-		auto vhost = GetVirtualHost(vhost_app_name);
-		if (vhost == nullptr)
 		{
-			// Error
-			return CommonErrorCode::ERROR;
+			std::lock_guard<std::mutex> lock(_drain_mutex);
+
+			_drain_alternatives.clear();
+			for (auto alternative : alternatives)
+			{
+				// A server without free capacity is not selected
+				if ((alternative.host.IsEmpty() == false) && (alternative.weight > 0))
+				{
+					alternative.current_weight = 0;
+					_drain_alternatives.push_back(alternative);
+				}
+			}
+
+			if (_is_draining == false)
+			{
+				_drain_start_time_msec = ov::Clock::NowMSec();
+			}
+
+			_is_draining = true;
+			alternative_count = _drain_alternatives.size();
 		}
 
-		if (vhost->is_origin_map_store_enabled == false)
+		logti("Draining the server: new viewers are %s", (alternative_count == 0) ? "rejected" : ov::String::FormatString("redirected to %zu alternatives", alternative_count).CStr());
+
+		SetOriginMapWithdrawn(true);
+	}
+
+	void Orchestrator::StopDrain()
+	{
 		{
-			// disabled by user
-			return CommonErrorCode::DISABLED;
+			std::lock_guard<std::mutex> lock(_drain_mutex);
+
+			if (_is_draining == false)
+			{
+				return;
+			}
+
+			_is_draining = false;
+			_drain_start_time_msec = 0;
+			_drain_alternatives.clear();
 		}
-		
-		auto client = vhost->origin_map_client;
-		if (client == nullptr)
+
+		logti("Draining is stopped: new viewers are accepted");
+
+		SetOriginMapWithdrawn(false);
+	}
+
+	int64_t Orchestrator::GetDrainStartTimeMSec() const
+	{
+		std::lock_guard<std::mutex> lock(_drain_mutex);
+		return _drain_start_time_msec;
+	}
+
+	std::vector<DrainAlternative> Orchestrator::GetDrainAlternatives() const
+	{
+		std::lock_guard<std::mutex> lock(_drain_mutex);
+		return _drain_alternatives;
+	}
+
+	std::shared_ptr<ov::Url> Orchestrator::GetDrainRedirectUrl(const std::shared_ptr<const ov::Url> &requested_url)
+	{
+		if (requested_url == nullptr)
 		{
-			// Error
-			return CommonErrorCode::ERROR;
+			return nullptr;
 		}
 
-		auto app_stream_name = ov::String::FormatString("%s/%s", vhost_app_name.GetAppName().CStr(), stream_name.CStr());
+		ov::String host;
 
-		if (client->Unregister(app_stream_name) == true)
 		{
-			return CommonErrorCode::SUCCESS;
+			std::lock_guard<std::mutex> lock(_drain_mutex);
+
+			// Smooth weighted round-robin: the viewers are spread in proportion to the weights,
+			// and consecutive viewers are not sent to the same server in a burst
+			DrainAlternative *selected = nullptr;
+			int64_t total_weight = 0;
+
+			for (auto &alternative : _drain_alternatives)
+			{
+				alternative.current_weight += alternative.weight;
+				total_weight += alternative.weight;
+
+				if ((selected == nullptr) || (alternative.current_weight > selected->current_weight))
+				{
+					selected = &alternative;
+				}
+			}
+
+			if (selected == nullptr)
+			{
+				return nullptr;
+			}
+
+			selected->current_weight -= total_weight;
+			host = selected->host;
 		}
 
-		return CommonErrorCode::ERROR;
+		if ((host.IndexOf(':') < 0) && (requested_url->Port() > 0))
+		{
+			host.AppendFormat(":%u", requested_url->Port());
+		}
+
+		auto query = requested_url->Query();
+
+		return ov::Url::Parse(ov::String::FormatString(
+			"%s://%s%s%s%s",
+			requested_url->Scheme().CStr(), host.CStr(), requested_url->Path().CStr(),
+			query.IsEmpty() ? "" : "?", query.CStr()));
+	}
+
+	void Orchestrator::SetOriginMapWithdrawn(bool withdrawn)
+	{
+		std::vector<std::shared_ptr<OriginMapClient>> clients;
+
+		{
+			auto scoped_lock = std::scoped_lock(_virtual_host_map_mutex);
+
+			for (auto &vhost : _virtual_host_list)
+			{
+				if ((vhost->is_origin_map_store_enabled) && (vhost->origin_map_client != nullptr))
+				{
+					clients.push_back(vhost->origin_map_client);
+				}
+			}
+		}
+
+		// The lock of virtual hosts is not held while waiting for redis
+		for (auto &client : clients)
+		{
+			client->SetWithdrawn(withdrawn);
+		}
 	}
 
 	// This feature is set in Application.PersistentStream. Creates a persistent and non-terminating stream based on the input stream. 
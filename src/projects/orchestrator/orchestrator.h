@@ -8,8 +8,12 @@
 //==============================================================================
 #pragma once
 
+#include "load_reporter.h"
 #include "orchestrator_internal.h"
 
+// Retry-After (in seconds) of the 503 responses to new viewers while the server is draining without alternatives
+#define OCST_DRAIN_RETRY_AFTER_SEC 5
+
 namespace ocst
 {
 	//
@@ -57,6 +61,8 @@ namespace ocst
 		std::optional<info::Host> GetHostInfo(ov::String vhost_name);
 
 		bool CreateVirtualHosts(const std::vector<cfg::vhost::VirtualHost> &vhost_conf_list);
+		// Time taken by each module to create the applications when the server started (empty if ParallelStartup is disabled)
+		std::vector<ModuleStartupTime> GetStartupTimeline(int64_t *elapsed_ms) const;
 		bool UpdateVirtualHosts(const std::vector<info::Host> &host_list);
 		std::vector<std::shared_ptr<ocst::VirtualHost>> GetVirtualHostList();
 
@@ -69,6 +75,16 @@ namespace ocst
 		///
 		/// @note Automatically DeleteApplication() when application creation fails
 		Result CreateApplication(const info::Host &vhost_info, const cfg::vhost::app::Application &app_config, bool is_dynamic = false);
+		/// Create the applications under a single lock of the Orchestrator, notifying the modules in stages
+		/// (in parallel if ParallelStartup is enabled - see OrchestratorInternal::CreateApplications())
+		///
+		/// @param vhost_info VirtualHost to create the applications
+		/// @param app_config_list Application configurations to create
+		///
+		/// @return The creation result of each application of <app_config_list>
+		///
+		/// @note Only the applications that fail are deleted
+		std::vector<Result> CreateApplications(const info::Host &vhost_info, const std::vector<cfg::vhost::app::Application> &app_config_list);
 		/// Delete the application and notify the modules
 		///
 		/// @param app_info Application information to delete
@@ -79,6 +95,11 @@ namespace ocst
 		Result DeleteApplication(const info::Application &app_info);
 
 		ov::String GetVhostNameFromDomain(const ov::String &domain_name) const;
+		// Changes whenever the domains of VirtualHosts are changed
+		uint64_t GetDomainRoutingVersion() const
+		{
+			return _domain_routing_version;
+		}
 
 		/// Generate an application name for vhost/app
 		///
@@ -178,6 +199,30 @@ namespace ocst
 		CommonErrorCode RegisterStreamToOriginMapStore(const info::VHostAppName &vhost_app_name, const ov::String &stream_name);
 		CommonErrorCode UnregisterStreamFromOriginMapStore(const info::VHostAppName &vhost_app_name, const ov::String &stream_name);
 
+		// Drain mode (rolling deploys)
+		//
+		// While draining, the publishers don't accept the sessions of new viewers (the existing sessions are kept until they end),
+		// and the streams of this server are withdrawn from OriginMapStore so that the edges pull them from another origin.
+		// The new viewers are redirected to one of <alternatives> if they are given, otherwise 503 is responded.
+		void StartDrain(const std::vector<DrainAlternative> &alternatives);
+		void StopDrain();
+		bool IsDraining() const
+		{
+			return _is_draining;
+		}
+		// 0 if it is not draining
+		int64_t GetDrainStartTimeMSec() const;
+		std::vector<DrainAlternative> GetDrainAlternatives() const;
+		// Returns <requested_url> whose host is replaced with the next alternative (weighted round-robin),
+		// or nullptr if there is no alternative
+		std::shared_ptr<ov::Url> GetDrainRedirectUrl(const std::shared_ptr<const ov::Url> &requested_url);
+
+		// The latest load of the server (nullptr if LoadReport is disabled)
+		std::shared_ptr<const LoadReport> GetLoadReport() const
+		{
+			return _load_reporter.GetReport();
+		}
+
 		// Persistent Stream
 		CommonErrorCode CreatePersistentStreamIfNeed(const info::Application &app_info, const std::shared_ptr<info::Stream> &stream_info);
 		
@@ -190,10 +235,44 @@ namespace ocst
 		bool OnStreamUpdated(const info::Application &app_info, const std::shared_ptr<info::Stream> &info) override;
 
 	protected:
-		std::recursive_mutex _module_list_mutex;
-		mutable std::recursive_mutex _virtual_host_map_mutex;
+		ov::ProfiledRecursiveMutex _module_list_mutex{"ocst::Orchestrator::_module_list_mutex"};
+		mutable ov::ProfiledRecursiveMutex _virtual_host_map_mutex{"ocst::Orchestrator::_virtual_host_map_mutex"};
 
 	private:
 		void OnTimer();
+
+		// Creates all VirtualHosts first, and then their applications with OrchestratorInternal::CreateApplications()
+		bool CreateVirtualHostsInParallel(const std::vector<cfg::vhost::VirtualHost> &vhost_conf_list, int worker_count);
+
+		/// Applies the reloaded configuration of the VirtualHost to the running one.
+		/// The applications that are added/removed/changed are created/deleted/recreated,
+		/// but those that have streams are kept until all their streams are gone (see ApplyPendingApplicationConfigs()).
+		///
+		/// @param vhost The running VirtualHost
+		/// @param host_info The reloaded configuration of the VirtualHost
+		/// @param is_host_changed Whether the domains of the VirtualHost are changed (the certificate is reloaded)
+		bool UpdateApplications(const std::shared_ptr<VirtualHost> &vhost, const info::Host &host_info, bool is_host_changed);
+		bool ApplyPendingApplicationConfigs(const std::shared_ptr<VirtualHost> &vhost);
+
+		// Returns nullptr with <error> if OriginMapStore is not available for the vhost
+		std::shared_ptr<OriginMapClient> GetOriginMapClient(const info::VHostAppName &vhost_app_name, CommonErrorCode &error, ov::String *origin_base_url = nullptr) const;
+		void SetOriginMapWithdrawn(bool withdrawn);
+
+		// "#vhost#app/stream" : metrics of the input stream
+		std::map<ov::String, std::shared_ptr<mon::StreamMetrics>> GetInputStreamMetricsMap() const;
+		// Origin: reports the viewer count of the registered streams to OriginMapStore
+		void ReportStreamPopularity();
+		// Edge: pulls the popular streams in OriginMapStore before their first viewer comes (OriginMapStore.Prefetch)
+		void PrefetchPopularStreams();
+		void PrefetchPopularStreams(const std::shared_ptr<VirtualHost> &vhost);
+		// Reports the load of the server to OriginMapStore (LoadReport.HostName)
+		void ReportLoad();
+
+		std::atomic<bool> _is_draining{false};
+		mutable std::mutex _drain_mutex;
+		int64_t _drain_start_time_msec = 0;
+		std::vector<DrainAlternative> _drain_alternatives;
+
+		LoadReporter _load_reporter;
 	};
 }  // namespace ocst
@@ -451,6 +451,8 @@ namespace ocst
 			auto ovt_port = cfg::ConfigManager::GetInstance()->GetServer()->GetBind().GetPublishers().GetOvt().GetPort();
 			vhost->origin_map_client = std::make_shared<OriginMapClient>(store.GetRedisServer().GetHost(), store.GetRedisServer().GetAuth());
 			vhost->is_origin_map_store_enabled = true;
+			vhost->prefetch_stream_count = std::max(store.GetPrefetch().GetStreamCount(), 0);
+			vhost->prefetch_max_bitrate = std::max(store.GetPrefetch().GetMaxBitrate(), static_cast<int64_t>(0));
 
 			if (store.GetOriginHostName().IsEmpty() == false)
 			{
@@ -465,6 +467,8 @@ namespace ocst
 		_virtual_host_map[vhost_info.GetName()] = vhost;
 		_virtual_host_list.push_back(vhost);
 
+		RebuildDomainRoutingTable();
+
 		// Notification 
 		for (auto &module : _module_list)
 		{
@@ -488,6 +492,12 @@ namespace ocst
 		return Result::Succeeded;
 	}
 
+	void OrchestratorInternal::RebuildDomainRoutingTable()
+	{
+		std::atomic_store(&_domain_routing_table, std::make_shared<const DomainRoutingTable>(_virtual_host_list));
+		_domain_routing_version++;
+	}
+
 	Result OrchestratorInternal::DeleteVirtualHost(const info::Host &vhost_info)
 	{
 		auto i = _virtual_host_list.begin();
@@ -499,6 +509,7 @@ namespace ocst
 				_virtual_host_list.erase(i);
 				_virtual_host_map.erase(vhost_item->name);
 
+				RebuildDomainRoutingTable();
 
 				// Notification
 				for (auto &module : _module_list)
@@ -658,7 +669,7 @@ namespace ocst
 		{
 			logtd("Trying to find the item from host_list that match host_name: %s", host_name.CStr());
 
-			if (std::regex_match(host_name.CStr(), host.regex_for_domain))
+			if (host.regex_for_domain.Matches(host_name.CStr()).IsMatched())
 			{
 				found_matched_host = &host;
 				break;
@@ -786,7 +797,7 @@ namespace ocst
 		return Result::Succeeded;
 	}
 
-	ocst::Result OrchestratorInternal::CreateApplication(const ov::String &vhost_name, const info::Application &app_info)
+	ocst::Result OrchestratorInternal::AddApplication(const ov::String &vhost_name, const info::Application &app_info, std::shared_ptr<Application> *new_app)
 	{
 		auto vhost = GetVirtualHost(vhost_name);
 		if (vhost == nullptr)
@@ -812,12 +823,27 @@ namespace ocst
 
 		mon::Monitoring::GetInstance()->OnApplicationCreated(app_info);
 
+		*new_app = std::make_shared<Application>(this, app_info);
+		app_map.emplace(app_info.GetId(), *new_app);
+
+		return Result::Succeeded;
+	}
+
+	ocst::Result OrchestratorInternal::CreateApplication(const ov::String &vhost_name, const info::Application &app_info)
+	{
+		std::shared_ptr<Application> new_app;
+		auto result = AddApplication(vhost_name, app_info, &new_app);
+
+		if (result != Result::Succeeded)
+		{
+			return result;
+		}
+
+		auto &app_name = app_info.GetName();
+
 		// Notify modules of creation events
 		bool succeeded = true;
 
-		auto new_app = std::make_shared<Application>(this, app_info);
-		app_map.emplace(app_info.GetId(), new_app);
-
 		for (auto &module : _module_list)
 		{
 			auto &module_interface = module.module;
@@ -858,6 +884,201 @@ namespace ocst
 		return DeleteApplication(app_info);
 	}
 
+	static ov::String GetModuleName(const Module &module)
+	{
+		auto publisher = std::dynamic_pointer_cast<pub::Publisher>(module.module);
+		if (publisher != nullptr)
+		{
+			return publisher->GetPublisherName();
+		}
+
+		auto provider = std::dynamic_pointer_cast<pvd::Provider>(module.module);
+		if (provider != nullptr)
+		{
+			return provider->GetProviderName();
+		}
+
+		return GetModuleTypeName(module.type);
+	}
+
+	// Providers can be both PushProvider and PullProvider, so they are put in the same stage
+	static bool IsSameStage(ModuleType type1, ModuleType type2)
+	{
+		auto provider_type = ModuleType::PushProvider | ModuleType::PullProvider;
+
+		if ((ov::ToUnderlyingType(type1 & provider_type) != 0) && (ov::ToUnderlyingType(type2 & provider_type) != 0))
+		{
+			return true;
+		}
+
+		return type1 == type2;
+	}
+
+	ocst::Result OrchestratorInternal::CreateApplications(const std::vector<info::Application> &app_info_list, size_t worker_count,
+														  std::vector<Result> *result_list, std::vector<ModuleStartupTime> *timeline)
+	{
+		ov::StopWatch total_stop_watch;
+		total_stop_watch.Start();
+
+		auto app_count = app_info_list.size();
+		std::vector<Result> results(app_count, Result::Succeeded);
+		std::vector<std::shared_ptr<Application>> added_app_list(app_count);
+		// Set by the modules of a stage concurrently, so an application fails in the modules after the failed one
+		std::unique_ptr<std::atomic<bool>[]> failed_list(new std::atomic<bool>[app_count]);
+		size_t added_app_count = 0;
+
+		for (size_t index = 0; index < app_count; index++)
+		{
+			auto &app_info = app_info_list[index];
+
+			results[index] = AddApplication(app_info.GetName().GetVHostName(), app_info, &(added_app_list[index]));
+			failed_list[index] = (results[index] != Result::Succeeded);
+
+			if (results[index] == Result::Succeeded)
+			{
+				added_app_count++;
+			}
+			else
+			{
+				logtc("Could not add an application: %s", app_info.GetName().CStr());
+			}
+		}
+
+		// The modules registered in a row with the same type make a stage, and a stage starts after the previous one is done,
+		// so an application is created in the modules in the same order as CreateApplication().
+		std::vector<std::vector<const Module *>> stage_list;
+
+		for (const auto &module : _module_list)
+		{
+			if (stage_list.empty() || (IsSameStage(stage_list.back().back()->type, module.type) == false))
+			{
+				stage_list.emplace_back();
+			}
+
+			stage_list.back().push_back(&module);
+		}
+
+		// The stages keep the order of _module_list
+		std::vector<ModuleStartupTime> module_time_list(_module_list.size());
+		for (size_t index = 0; index < _module_list.size(); index++)
+		{
+			module_time_list[index].module_name = GetModuleName(_module_list[index]);
+		}
+
+		size_t timeline_index = 0;
+
+		for (const auto &stage : stage_list)
+		{
+			if (added_app_count == 0)
+			{
+				break;
+			}
+
+			std::atomic<size_t> next_index{0};
+			auto stage_timeline = module_time_list.data() + timeline_index;
+
+			auto worker = [&]() {
+				for (size_t index = next_index++; index < stage.size(); index = next_index++)
+				{
+					auto &module = *(stage[index]);
+					auto &module_time = stage_timeline[index];
+					ov::StopWatch stop_watch;
+					stop_watch.Start();
+
+					for (size_t app_index = 0; app_index < app_count; app_index++)
+					{
+						if (failed_list[app_index])
+						{
+							continue;
+						}
+
+						auto &app_info = app_info_list[app_index];
+
+						if (module.module->OnCreateApplication(app_info) == false)
+						{
+							logte("The module %p (%s) returns error while creating the application [%s]",
+								  module.module.get(), module_time.module_name.CStr(), app_info.GetName().CStr());
+							failed_list[app_index] = true;
+							continue;
+						}
+
+						module_time.application_count++;
+					}
+
+					module_time.elapsed_ms = stop_watch.Elapsed();
+				}
+			};
+
+			auto thread_count = std::min(std::max(worker_count, static_cast<size_t>(1)), stage.size());
+			std::vector<std::thread> thread_list;
+
+			for (size_t index = 1; index < thread_count; index++)
+			{
+				thread_list.emplace_back(worker);
+			}
+
+			worker();
+
+			for (auto &thread : thread_list)
+			{
+				thread.join();
+			}
+
+			timeline_index += stage.size();
+		}
+
+		bool succeeded = true;
+		size_t created_app_count = 0;
+
+		for (size_t index = 0; index < app_count; index++)
+		{
+			if (results[index] != Result::Succeeded)
+			{
+				succeeded = false;
+				continue;
+			}
+
+			auto &app_info = app_info_list[index];
+
+			if (failed_list[index])
+			{
+				logte("Trying to rollback for the application [%s]", app_info.GetName().CStr());
+				DeleteApplication(app_info);
+
+				results[index] = Result::Failed;
+				succeeded = false;
+				continue;
+			}
+
+			// Orchestrator has to receive the events of MediaRouter last (see CreateApplication())
+			if (_media_router != nullptr)
+			{
+				_media_router->RegisterObserverApp(app_info, added_app_list[index]->GetSharedPtrAs<MediaRouteApplicationObserver>());
+			}
+
+			created_app_count++;
+		}
+
+		ov::String timeline_string;
+		for (const auto &module_time : module_time_list)
+		{
+			timeline_string.AppendFormat("\n\t%s: %zu applications in %" PRId64 " ms", module_time.module_name.CStr(), module_time.application_count, module_time.elapsed_ms);
+		}
+		logti("%zu/%zu applications are created in %" PRId64 " ms with %zu workers%s", created_app_count, app_count, total_stop_watch.Elapsed(), worker_count, timeline_string.CStr());
+
+		if (result_list != nullptr)
+		{
+			*result_list = std::move(results);
+		}
+
+		if (timeline != nullptr)
+		{
+			*timeline = std::move(module_time_list);
+		}
+
+		return succeeded ? Result::Succeeded : Result::Failed;
+	}
+
 	ocst::Result OrchestratorInternal::NotifyModulesForDeleteEvent(const std::vector<Module> &modules, const info::Application &app_info)
 	{
 		Result result = Result::Succeeded;
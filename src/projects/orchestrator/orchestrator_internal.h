@@ -64,12 +64,25 @@ namespace ocst
 
 		Result CreateVirtualHost(const info::Host &vhost_info);
 		Result DeleteVirtualHost(const info::Host &vhost_info);
+		void RebuildDomainRoutingTable();
 
 		Result ReloadAllCertificates();
 		Result ReloadCertificate(const std::shared_ptr<VirtualHost> &vhost);
 		Result ReloadCertificate(const ov::String &vhost_name);
 
+		// Adds <app_info> to the VirtualHost without notifying the modules
+		Result AddApplication(const ov::String &vhost_name, const info::Application &app_info, std::shared_ptr<Application> *new_app);
 		Result CreateApplication(const ov::String &vhost_name, const info::Application &app_info);
+		/// Creates the applications in stages of the modules (MediaRouter -> Publishers -> Transcoder -> Providers).
+		/// The modules of a stage are notified concurrently by up to <worker_count> threads,
+		/// and each module creates the applications one by one in the order of <app_info_list>.
+		///
+		/// @param result_list The result of each application of <app_info_list> (can be nullptr)
+		/// @param timeline Time taken by each module (can be nullptr)
+		///
+		/// @return Failed if any application is not created (only the applications that fail are deleted)
+		Result CreateApplications(const std::vector<info::Application> &app_info_list, size_t worker_count,
+								  std::vector<Result> *result_list, std::vector<ModuleStartupTime> *timeline);
 		Result CreateApplicationTemplate(const info::Host &host_info, const cfg::vhost::app::Application &app_config);
 
 		Result NotifyModulesForDeleteEvent(const std::vector<Module> &modules, const info::Application &app_info);
@@ -95,6 +108,16 @@ namespace ocst
 		std::map<ov::String, std::shared_ptr<VirtualHost>> _virtual_host_map;
 		// ordered vhost list
 		std::vector<std::shared_ptr<VirtualHost>> _virtual_host_list;
+		// Built from _virtual_host_list whenever it is changed, and replaced with atomic_store(),
+		// so the domains are resolved without _virtual_host_map_mutex
+		std::shared_ptr<const DomainRoutingTable> _domain_routing_table;
+		// Increased whenever _domain_routing_table is replaced, so the modules can tell their cached resolutions are stale
+		std::atomic<uint64_t> _domain_routing_version{0};
+
+		// Filled by Orchestrator::CreateVirtualHostsInParallel()
+		mutable std::mutex _startup_timeline_mutex;
+		std::vector<ModuleStartupTime> _startup_timeline;
+		int64_t _startup_elapsed_ms = 0;
 
 		std::shared_ptr<pvd::Stream> GetProviderStream(const info::VHostAppName &vhost_app_name, const ov::String &stream_name);
 
@@ -13,6 +13,7 @@
 #include <base/ovlibrary/byte_io.h>
 #include <modules/ffmpeg/conv.h>
 #include <modules/rtp_rtcp/rtp_depacketizer_mpeg4_generic_audio.h>
+#include <transcoder/transcoder_benchmark.h>
 
 #include "file_private.h"
 #include "file_provider.h"
@@ -77,6 +78,7 @@ namespace pvd
 		}
 
 		_url = url;
+		LoadSchedule();
 
 		ov::StopWatch stop_watch;
 
@@ -145,16 +147,72 @@ namespace pvd
 			return false;
 		}
 
-		int err = 0;
+		if (OpenFile(GetFilePath(_schedule[_schedule_index])) == false)
+		{
+			SetState(State::ERROR);
+			return false;
+		}
+
+		SetState(State::CONNECTED);
+
+		return true;
+	}
+
+	void FileStream::LoadSchedule()
+	{
+		_schedule.clear();
+		_schedule_index = 0;
+
+		_schedule.push_back(_url->Path());
+
+		// The files of <Schedule> are played after <Path> in order
+		auto &stream_list = GetApplicationInfo().GetConfig().GetProviders().GetFileProvider().GetStreamMap().GetStreamList();
+		for (auto &stream : stream_list)
+		{
+			if (stream.GetName() != GetName())
+			{
+				continue;
+			}
+
+			for (auto &path : stream.GetSchedule().GetPathList())
+			{
+				_schedule.push_back(ov::String::FormatString("/%s", path.CStr()));
+			}
+
+			break;
+		}
+	}
+
+	ov::String FileStream::GetFilePath(const ov::String &path)
+	{
+		return ov::String::FormatString("%s%s", GetApplicationInfo().GetConfig().GetProviders().GetFileProvider().GetRootPath().CStr(), path.CStr());
+	}
+
+	bool FileStream::OpenFile(const ov::String &url)
+	{
+		if (GetApplicationInfo().GetConfig().GetProviders().GetFileProvider().IsNativeMp4ReaderEnabled())
+		{
+			_sample_index = bmff::Mp4SampleIndex::Load(url);
+
+			if ((_sample_index != nullptr) && _sample_index->HasUnsupportedTrack())
+			{
+				logtd("%s/%s(%u) The file has the tracks that are not supported by the native MP4 reader. path(%s)", GetApplicationInfo().GetName().CStr(), GetName().CStr(), GetId(), url.CStr());
+				_sample_index = nullptr;
+			}
 
-		auto url = ov::String::FormatString("%s%s", GetApplicationInfo().GetConfig().GetProviders().GetFileProvider().GetRootPath().CStr(), _url->Path().CStr());
+			if (_sample_index != nullptr)
+			{
+				_sample_position = 0;
+				return true;
+			}
+		}
 
 		_format_context = nullptr;
 		logtd("%s/%s(%u) Trying to open file. path(%s)", GetApplicationInfo().GetName().CStr(), GetName().CStr(), GetId(), url.CStr());
+
+		int err = 0;
 		if ((err = ::avformat_open_input(&_format_context, url.CStr(), nullptr, nullptr)) < 0)
 		{
-			SetState(State::ERROR);
-
 			char errbuf[256];
 			av_strerror(err, errbuf, sizeof(errbuf));
 
@@ -163,11 +221,21 @@ namespace pvd
 			return false;
 		}
 
-		SetState(State::CONNECTED);
-
 		return true;
 	}
 
+	void FileStream::CloseFile()
+	{
+		if (_format_context != nullptr)
+		{
+			avformat_close_input(&_format_context);
+			_format_context = nullptr;
+		}
+
+		_sample_index = nullptr;
+		_file_tracks.clear();
+	}
+
 	bool FileStream::RequestDescribe()
 	{
 		if (GetState() != State::CONNECTED)
@@ -175,45 +243,27 @@ namespace pvd
 			return false;
 		}
 
-		if (::avformat_find_stream_info(_format_context, NULL) < 0)
+		if (LoadFileTracks() == false)
 		{
 			SetState(State::ERROR);
-			logte("Could not find stream information");
-
 			return false;
 		}
 
-		for (uint32_t track_id = 0; track_id < _format_context->nb_streams; track_id++)
-		{
-			auto stream = _format_context->streams[track_id];
-			if (!stream)
-			{
-				continue;
-			}
+		_file_track_ids.assign(_file_tracks.size(), -1);
 
-			auto media_track = std::make_shared<MediaTrack>();
-			if (!media_track)
+		for (size_t index = 0; index < _file_tracks.size(); index++)
+		{
+			if (_file_tracks[index] == nullptr)
 			{
 				continue;
 			}
 
-			if (ffmpeg::Conv::ToMediaTrack(stream, media_track) == false)
-			{
-				continue;
-			}
+			auto media_track = _file_tracks[index]->Clone();
 
-#if FILE_FIXED_TRACK_ID 
-			if(GetFirstTrackByType(media_track->GetMediaType()) == nullptr)
+			if (AddFileTrack(media_track))
 			{
-				media_track->SetId(GetFixedTrackIdOfMediaType(media_track->GetMediaType()));
-				AddTrack(media_track);
-			}
-			else{
-				logtd("Duplicate media types are not used and ignored. %s", media_track->GetInfoString().CStr());
+				_file_track_ids[index] = media_track->GetId();
 			}
-#else
-			AddTrack(media_track);
-#endif
 		}
 
 		// If there is no data track, add a dummy data track
@@ -235,6 +285,208 @@ namespace pvd
 		return true;
 	}
 
+	bool FileStream::LoadFileTracks()
+	{
+		_file_tracks.clear();
+
+		if (_sample_index != nullptr)
+		{
+			for (auto &track : _sample_index->GetTracks())
+			{
+				auto media_track = std::make_shared<MediaTrack>();
+
+				media_track->SetMediaType(track.media_type);
+				media_track->SetCodecId(track.codec_id);
+				media_track->SetTimeBase(1, track.timescale);
+				media_track->SetStartFrameTime(0);
+				media_track->SetLastFrameTime(0);
+
+				switch (track.media_type)
+				{
+					case cmn::MediaType::Video:
+						media_track->SetFrameRateByConfig(track.frame_rate);
+						media_track->SetWidth(track.width);
+						media_track->SetHeight(track.height);
+						break;
+					case cmn::MediaType::Audio:
+						// Same as the format reported by libavformat for AAC
+						media_track->SetSampleRate(track.sample_rate);
+						media_track->GetSample().SetFormat(ffmpeg::Conv::ToAudioSampleFormat(AV_SAMPLE_FMT_FLTP));
+						media_track->GetChannel().SetLayout(ffmpeg::Conv::ToAudioChannelLayout(track.channel_count));
+						break;
+					default:
+						break;
+				}
+
+				_file_tracks.push_back(media_track);
+			}
+
+			return true;
+		}
+
+		if (::avformat_find_stream_info(_format_context, NULL) < 0)
+		{
+			logte("Could not find stream information");
+
+			return false;
+		}
+
+		for (uint32_t track_id = 0; track_id < _format_context->nb_streams; track_id++)
+		{
+			auto stream = _format_context->streams[track_id];
+			auto media_track = std::make_shared<MediaTrack>();
+
+			if ((stream == nullptr) || (ffmpeg::Conv::ToMediaTrack(stream, media_track) == false))
+			{
+				media_track = nullptr;
+			}
+
+			_file_tracks.push_back(media_track);
+		}
+
+		return true;
+	}
+
+	bool FileStream::AddFileTrack(const std::shared_ptr<MediaTrack> &media_track)
+	{
+#if FILE_FIXED_TRACK_ID 
+		if(GetFirstTrackByType(media_track->GetMediaType()) != nullptr)
+		{
+			logtd("Duplicate media types are not used and ignored. %s", media_track->GetInfoString().CStr());
+			return false;
+		}
+
+		media_track->SetId(GetFixedTrackIdOfMediaType(media_track->GetMediaType()));
+#endif
+		AddTrack(media_track);
+
+		return true;
+	}
+
+	bool FileStream::IsSpliceable(const std::shared_ptr<MediaTrack> &track, const std::shared_ptr<MediaTrack> &file_track)
+	{
+		if ((track->GetMediaType() != file_track->GetMediaType()) || (track->GetCodecId() != file_track->GetCodecId()))
+		{
+			return false;
+		}
+
+		switch (track->GetMediaType())
+		{
+			case cmn::MediaType::Video:
+				return (track->GetWidth() == file_track->GetWidth()) && (track->GetHeight() == file_track->GetHeight());
+
+			case cmn::MediaType::Audio:
+				return (track->GetSampleRate() == file_track->GetSampleRate()) && (track->GetChannel().GetCounts() == file_track->GetChannel().GetCounts());
+
+			default:
+				return true;
+		}
+	}
+
+	bool FileStream::MapFileTracks()
+	{
+		std::vector<int32_t> file_track_ids(_file_tracks.size(), -1);
+
+		for (const auto &[track_id, track] : GetTracks())
+		{
+			if (track->GetMediaType() == cmn::MediaType::Data)
+			{
+				// The dummy data track
+				continue;
+			}
+
+			bool is_mapped = false;
+
+			for (size_t index = 0; index < _file_tracks.size(); index++)
+			{
+				if ((file_track_ids[index] < 0) && (_file_tracks[index] != nullptr) && IsSpliceable(track, _file_tracks[index]))
+				{
+					file_track_ids[index] = track_id;
+					is_mapped = true;
+					break;
+				}
+			}
+
+			if (is_mapped == false)
+			{
+				logtd("%s/%s(%u) The file has no track that matches the track. %s", GetApplicationInfo().GetName().CStr(), GetName().CStr(), GetId(), track->GetInfoString().CStr());
+				return false;
+			}
+		}
+
+		_file_track_ids = std::move(file_track_ids);
+
+		return true;
+	}
+
+	bool FileStream::SpliceNextFile()
+	{
+		if (_schedule.size() < 2)
+		{
+			return false;
+		}
+
+		auto format_context = _format_context;
+		auto sample_index = _sample_index;
+		auto file_tracks = _file_tracks;
+
+		for (size_t count = 1; count < _schedule.size(); count++)
+		{
+			auto schedule_index = (_schedule_index + count) % _schedule.size();
+			auto url = GetFilePath(_schedule[schedule_index]);
+
+			_format_context = nullptr;
+			_sample_index = nullptr;
+
+			if (OpenFile(url) && LoadFileTracks() && MapFileTracks())
+			{
+				if (format_context != nullptr)
+				{
+					avformat_close_input(&format_context);
+				}
+
+				_schedule_index = schedule_index;
+				_sample_position = 0;
+
+				// The decoder configuration of the next file may be different (e.g. SPS/PPS)
+				_sent_sequence_header = false;
+
+				logti("%s/%s(%u) Spliced to the next file without updating the stream. path(%s)", GetApplicationInfo().GetName().CStr(), GetName().CStr(), GetId(), url.CStr());
+				return true;
+			}
+
+			logtw("%s/%s(%u) The file cannot be spliced because the codec parameters are different from the stream, and is skipped. path(%s)", GetApplicationInfo().GetName().CStr(), GetName().CStr(), GetId(), url.CStr());
+
+			CloseFile();
+		}
+
+		// Keeps playing the current file
+		_format_context = format_context;
+		_sample_index = sample_index;
+		_file_tracks = std::move(file_tracks);
+
+		return false;
+	}
+
+	void FileStream::RescaleTimestamp(const std::shared_ptr<MediaPacket> &packet, const cmn::Timebase &from, const cmn::Timebase &to)
+	{
+		if ((from.GetNum() == to.GetNum()) && (from.GetDen() == to.GetDen()))
+		{
+			return;
+		}
+
+		AVRational from_rational{from.GetNum(), from.GetDen()};
+		AVRational to_rational{to.GetNum(), to.GetDen()};
+
+		packet->SetPts(::av_rescale_q(packet->GetPts(), from_rational, to_rational));
+		packet->SetDts(::av_rescale_q(packet->GetDts(), from_rational, to_rational));
+
+		if (packet->GetDuration() > 0)
+		{
+			packet->SetDuration(::av_rescale_q(packet->GetDuration(), from_rational, to_rational));
+		}
+	}
+
 	bool FileStream::RequestPlay()
 	{
 		if (GetState() != State::DESCRIBED)
@@ -254,32 +506,38 @@ namespace pvd
 		if (_sent_sequence_header == true)
 			return;
 
-		for (uint32_t track_id = 0; track_id < _format_context->nb_streams; ++track_id)
+		for (size_t index = 0; index < _file_track_ids.size(); index++)
 		{
-			AVStream *stream = _format_context->streams[track_id];
-
-#if FILE_FIXED_TRACK_ID
-			auto fix_track_id = GetFixedTrackIdOfMediaType(ffmpeg::Conv::ToMediaType(stream->codecpar->codec_type));
-			auto track = GetTrack(fix_track_id);
-#else
-			auto track = GetTrack(track_id);
-#endif
+			auto track = (_file_track_ids[index] >= 0) ? GetTrack(_file_track_ids[index]) : nullptr;
 			if (track == nullptr)
 			{
 				continue;
 			}
 
+			std::shared_ptr<ov::Data> decoder_config;
+
+			if (_sample_index != nullptr)
+			{
+				// @decoder_config == AVCDecoderConfigurationRecord or AACSpecificConfig
+				decoder_config = _sample_index->GetTracks()[index].decoder_config->Clone();
+			}
+			else
+			{
+				// @extradata == AVCDecoderConfigurationRecord or AACSpecificConfig
+				AVStream *stream = _format_context->streams[index];
+				decoder_config = std::make_shared<ov::Data>(stream->codecpar->extradata, stream->codecpar->extradata_size);
+			}
+
 			auto media_type = track->GetMediaType();
 			auto codec_id = track->GetCodecId();
 
 			if (codec_id == cmn::MediaCodecId::H264)
 			{
-				// @extradata == AVCDecoderConfigurationRecord
 				auto media_packet = std::make_shared<MediaPacket>(
 					GetMsid(),
 					media_type,
 					track->GetId(),
-					std::make_shared<ov::Data>(stream->codecpar->extradata, stream->codecpar->extradata_size),
+					decoder_config,
 					0,
 					0,
 					cmn::BitstreamFormat::H264_AVCC,
@@ -289,12 +547,11 @@ namespace pvd
 			}
 			else if (codec_id == cmn::MediaCodecId::Aac)
 			{
-				// @extradata == AACSpecificConfig
 				auto media_packet = std::make_shared<MediaPacket>(
 					GetMsid(),
 					media_type,
 					track->GetId(),
-					std::make_shared<ov::Data>(stream->codecpar->extradata, stream->codecpar->extradata_size),
+					decoder_config,
 					0,
 					0,
 					cmn::BitstreamFormat::AAC_RAW,
@@ -314,8 +571,7 @@ namespace pvd
 			return false;
 		}
 
-		avformat_close_input(&_format_context);
-		_format_context = nullptr;
+		CloseFile();
 
 		return true;
 	}
@@ -327,6 +583,13 @@ namespace pvd
 			return false;
 		}
 
+		if (_sample_index != nullptr)
+		{
+			// The samples are already indexed, so it does not need to seek the file
+			_sample_position = 0;
+			return true;
+		}
+
 		if (::av_seek_frame(_format_context, -1, 0, 0) < 0)
 		{
 			return false;
@@ -337,6 +600,11 @@ namespace pvd
 
 	PullStream::ProcessMediaResult FileStream::ProcessMediaPacket()
 	{
+		if (_sample_index != nullptr)
+		{
+			return ProcessSamples();
+		}
+
 		if (_format_context == nullptr)
 		{
 			return ProcessMediaResult::PROCESS_MEDIA_FAILURE;
@@ -348,6 +616,8 @@ namespace pvd
 
 		SendSequenceHeader();
 
+		int sent_count = 0;
+
 		while (true)
 		{
 			int32_t ret = ::av_read_frame(_format_context, &packet);
@@ -359,6 +629,13 @@ namespace pvd
 				}
 				else if ((ret == AVERROR_EOF || ::avio_feof(_format_context->pb)))
 				{
+					if (SpliceNextFile())
+					{
+						// The next file may be read by the other reader
+						UpdatePrivBaseTimestamp();
+						return ProcessMediaResult::PROCESS_MEDIA_SUCCESS;
+					}
+
 					RequestRewind();
 
 					UpdatePrivBaseTimestamp();
@@ -377,12 +654,8 @@ namespace pvd
 				return ProcessMediaResult::PROCESS_MEDIA_FAILURE;
 			}
 
-#if FILE_FIXED_TRACK_ID
-			auto fix_track_id = GetFixedTrackIdOfMediaType(ffmpeg::Conv::ToMediaType(_format_context->streams[packet.stream_index]->codecpar->codec_type));
-			auto track = GetTrack(fix_track_id);
-#else			
-			auto track = GetTrack(packet.stream_index);
-#endif			
+			auto file_track_index = static_cast<size_t>(packet.stream_index);
+			auto track = ((file_track_index < _file_track_ids.size()) && (_file_track_ids[file_track_index] >= 0)) ? GetTrack(_file_track_ids[file_track_index]) : nullptr;
 			if (track == nullptr)
 			{
 				::av_packet_unref(&packet);
@@ -414,6 +687,9 @@ namespace pvd
 			auto media_packet = ffmpeg::Conv::ToMediaPacket(GetMsid(), track->GetId(), &packet, track->GetMediaType(), bitstream_format, packet_type);
 			::av_packet_unref(&packet);
 
+			// The timebase of the spliced file may be different from the track
+			RescaleTimestamp(media_packet, _file_tracks[file_track_index]->GetTimeBase(), track->GetTimeBase());
+
 			// Calculate PTS/DTS + Base Timestamp
 			UpdateTimestamp(media_packet);
 
@@ -423,6 +699,20 @@ namespace pvd
 			// Send to MediaRouter
 			SendFrame(std::move(media_packet));
 
+			// Benchmark of the transcoder - It sends the packets as fast as the transcoder can process them instead of the real-time.
+			auto benchmark = TranscodeBenchmark::GetInstance();
+			if (benchmark->IsEnabled())
+			{
+				benchmark->WaitForCapacity();
+
+				if (++sent_count < FILE_BENCHMARK_PACKET_COUNT_PER_PROCESS)
+				{
+					continue;
+				}
+
+				break;
+			}
+
 			// Real-time processing - It treats the packet the same as the real time.
 			if (_play_request_time.Elapsed() < (static_cast<int64_t>(static_cast<double>(media_packet->GetPts()) * track->GetTimeBase().GetExpr() * 1000)))
 			{
@@ -433,6 +723,87 @@ namespace pvd
 		return ProcessMediaResult::PROCESS_MEDIA_SUCCESS;
 	}
 
+	PullStream::ProcessMediaResult FileStream::ProcessSamples()
+	{
+		int sent_count = 0;
+
+		SendSequenceHeader();
+
+		while (true)
+		{
+			if (_sample_position >= _sample_index->GetSamples().size())
+			{
+				if (SpliceNextFile())
+				{
+					// The next file may be read by the other reader
+					UpdatePrivBaseTimestamp();
+					return ProcessMediaResult::PROCESS_MEDIA_SUCCESS;
+				}
+
+				_sample_position = 0;
+
+				UpdatePrivBaseTimestamp();
+				logtd("%s/%s(%u) Reached the end of the file. rewind to the first frame.", GetApplicationInfo().GetName().CStr(), GetName().CStr(), GetId());
+			}
+
+			auto &sample = _sample_index->GetSamples()[_sample_position++];
+			auto track_id = _file_track_ids[sample.track_index];
+			auto track = (track_id >= 0) ? GetTrack(track_id) : nullptr;
+
+			if (track == nullptr)
+			{
+				continue;
+			}
+
+			auto media_packet = std::make_shared<MediaPacket>(
+				GetMsid(),
+				track->GetMediaType(),
+				track->GetId(),
+				// A slice of the mapped file (no copy)
+				_sample_index->GetSampleData(sample),
+				sample.dts + sample.cts_offset,
+				sample.dts,
+				sample.duration,
+				sample.is_key_frame ? MediaPacketFlag::Key : MediaPacketFlag::NoFlag,
+				(track->GetCodecId() == cmn::MediaCodecId::H264) ? cmn::BitstreamFormat::H264_AVCC : cmn::BitstreamFormat::AAC_RAW,
+				(track->GetCodecId() == cmn::MediaCodecId::H264) ? cmn::PacketType::NALU : cmn::PacketType::RAW);
+
+			// The timebase of the spliced file may be different from the track
+			RescaleTimestamp(media_packet, _file_tracks[sample.track_index]->GetTimeBase(), track->GetTimeBase());
+
+			// Calculate PTS/DTS + Base Timestamp
+			UpdateTimestamp(media_packet);
+
+			// The purpose of updating the global Timestamp value when the URL is changed due to PullStream's failover.
+			AdjustTimestampByBase(media_packet->GetTrackId(), media_packet->GetPts(), media_packet->GetDts(), std::numeric_limits<int64_t>::max());
+
+			// Send to MediaRouter
+			SendFrame(media_packet);
+
+			// Benchmark of the transcoder
+			auto benchmark = TranscodeBenchmark::GetInstance();
+			if (benchmark->IsEnabled())
+			{
+				benchmark->WaitForCapacity();
+
+				if (++sent_count < FILE_BENCHMARK_PACKET_COUNT_PER_PROCESS)
+				{
+					continue;
+				}
+
+				break;
+			}
+
+			// Real-time processing
+			if (_play_request_time.Elapsed() < (static_cast<int64_t>(static_cast<double>(media_packet->GetPts()) * track->GetTimeBase().GetExpr() * 1000)))
+			{
+				break;
+			}
+		}
+
+		return ProcessMediaResult::PROCESS_MEDIA_SUCCESS;
+	}
+
 	void FileStream::UpdateTimestamp(std::shared_ptr<MediaPacket> &packet)
 	{
 		int64_t base_timestamp = 0;
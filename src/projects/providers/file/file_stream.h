@@ -13,6 +13,7 @@
 #include <base/ovlibrary/url.h>
 #include <base/provider/pull_provider/application.h>
 #include <base/provider/pull_provider/stream.h>
+#include <modules/containers/bmff/mp4_reader/mp4_sample_index.h>
 #include <modules/rtp_rtcp/lip_sync_clock.h>
 #include <modules/rtp_rtcp/rtp_depacketizing_manager.h>
 #include <modules/rtp_rtcp/rtp_rtcp.h>
@@ -39,6 +40,9 @@ namespace pvd
 
 	#define FILE_FIXED_TRACK_ID		true
 
+	// In the benchmark of the transcoder, the stream returns to StreamMotor after sending this number of packets
+	#define FILE_BENCHMARK_PACKET_COUNT_PER_PROCESS	100
+
 	class FileProvider;
 
 	class FileStream : public pvd::PullStream
@@ -78,11 +82,43 @@ namespace pvd
 		bool RequestStop();
 		bool RequestRewind();
 		void Release();
-		
+
+		void LoadSchedule();
+		ov::String GetFilePath(const ov::String &path);
+		// Opens <url> with the native MP4 reader or libavformat
+		bool OpenFile(const ov::String &url);
+		void CloseFile();
+
+		bool LoadFileTracks();
+		bool AddFileTrack(const std::shared_ptr<MediaTrack> &media_track);
+
+		// Whether the track of the next file can be sent to <track> without updating the stream
+		bool IsSpliceable(const std::shared_ptr<MediaTrack> &track, const std::shared_ptr<MediaTrack> &file_track);
+		bool MapFileTracks();
+		// Switches to the next file of the schedule at the end of the file.
+		// The tracks, the transcoder and the packagers of the stream are kept, so the timeline continues.
+		bool SpliceNextFile();
+		void RescaleTimestamp(const std::shared_ptr<MediaPacket> &packet, const cmn::Timebase &from, const cmn::Timebase &to);
+
 		void SendSequenceHeader();
+		PullStream::ProcessMediaResult ProcessSamples();
 
 		std::shared_ptr<const ov::Url> _url;
-		AVFormatContext *_format_context;
+		AVFormatContext *_format_context = nullptr;
+
+		// Used instead of _format_context if the file is read by the native MP4 reader
+		std::shared_ptr<const bmff::Mp4SampleIndex> _sample_index;
+		// Index of the next sample of _sample_index
+		size_t _sample_position = 0;
+
+		// The tracks of the file being played (nullptr if the track is not supported)
+		std::vector<std::shared_ptr<MediaTrack>> _file_tracks;
+		// Index of _file_tracks -> ID of the track of the stream (-1 if the track is not used)
+		std::vector<int32_t> _file_track_ids;
+
+		// Paths of the files played in order (<Path>, and then <Schedule>)
+		std::vector<ov::String> _schedule;
+		size_t _schedule_index = 0;
 
 		ov::StopWatch _play_request_time;
 
@@ -44,6 +44,8 @@ namespace pvd
 		_remote = client_socket;
 		SetMediaSource(ov::String::FormatString("%s://%s", ov::StringFromSocketType(client_socket->GetType()), remote_address.ToString(false).CStr()));
 		_lifetime_epoch_msec = lifetime_epoch_msec;
+
+		CreateIngestCapture(mdl::IngestCapture::Format::Ts);
 	}
 
 	MpegTsStream::~MpegTsStream()
@@ -93,6 +95,12 @@ namespace pvd
 			return false;
 		}
 
+		auto &ingest_capture = GetIngestCapture();
+		if (ingest_capture != nullptr)
+		{
+			ingest_capture->Append(data);
+		}
+
 		std::lock_guard<std::shared_mutex> lock(_depacketizer_lock);
 		_depacketizer.AddPacket(data);
 
@@ -107,6 +115,8 @@ namespace pvd
 
 		if (IsPublished() == true)
 		{
+			UpdateSrtMetrics();
+
 			while (_depacketizer.IsESAvailable())
 			{
 				auto es = _depacketizer.PopES();
@@ -162,14 +172,15 @@ namespace pvd
 
 									if (header.GetNalUnitType() == H265NALUnitType::SPS)
 									{
-										H265SPS sps;
-										if (H265Parser::ParseSPS(nalu->GetDataAs<uint8_t>(), nalu->GetLength(), sps) == false)
+										// The SPS is repeated on every key frame, but parsed only when it is changed
+										auto sps = _h265_sps_cache.Get(nalu->GetDataAs<uint8_t>(), nalu->GetLength(), H265Parser::ParseSPS);
+										if (sps == nullptr)
 										{
 											logte("Could not parse sps");
 										}
 										else
 										{
-											logtd("SPS Parsed : %s", sps.GetInfoString().CStr());
+											logtd("SPS Parsed : %s", sps->GetInfoString().CStr());
 										}
 									}
 								}
@@ -268,6 +279,44 @@ namespace pvd
 			return false;
 		}
 
+		if (_remote->GetType() == ov::SocketType::Srt)
+		{
+			auto stream_metrics = StreamMetrics(*std::static_pointer_cast<info::Stream>(pvd::Stream::GetSharedPtr()));
+			if (stream_metrics != nullptr)
+			{
+				_srt_metrics = stream_metrics->GetSrtMetrics();
+			}
+		}
+
 		return true;
 	}
+
+	void MpegTsStream::UpdateSrtMetrics()
+	{
+		if (_srt_metrics == nullptr)
+		{
+			return;
+		}
+
+		// srt_bstats() takes the lock of the socket in libsrt, so it is called at most once per second
+		auto now_msec = ov::Clock::NowMSec();
+		if ((now_msec - _srt_metrics_updated_msec) < 1000)
+		{
+			return;
+		}
+		_srt_metrics_updated_msec = now_msec;
+
+		// Interval values are cleared on every call (libsrt does not provide the total of received retransmissions)
+		SRT_TRACEBSTATS stats{};
+		if (_remote->GetSrtStats(&stats, true) == false)
+		{
+			return;
+		}
+
+		_srt_retransmitted_packet_count += stats.pktRcvRetrans;
+
+		_srt_metrics->Update(stats.msRTT, stats.mbpsBandwidth,
+							 stats.pktRecvTotal, stats.pktRcvLossTotal, _srt_retransmitted_packet_count, stats.pktRcvDropTotal,
+							 stats.msRcvBuf, stats.msRcvTsbPdDelay);
+	}
 }  // namespace pvd
\ No newline at end of file
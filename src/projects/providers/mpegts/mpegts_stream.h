@@ -10,7 +10,10 @@
 
 #include "base/common_types.h"
 #include "base/provider/push_provider/stream.h"
+#include "modules/bitstream/h265/h265_parser.h"
+#include "modules/bitstream/nalu/nal_unit_parameter_set_cache.h"
 #include "modules/mpegts/mpegts_depacketizer.h"
+#include "monitoring/monitoring.h"
 
 namespace pvd
 {
@@ -40,6 +43,8 @@ namespace pvd
 		bool Publish();
 
 		void AdjustTimestamp(int64_t &pts, int64_t &dts);
+		// Only available if the client socket is SRT
+		void UpdateSrtMetrics();
 
 		// Client socket
 		std::shared_ptr<ov::Socket> _remote = nullptr;
@@ -47,6 +52,8 @@ namespace pvd
 		std::shared_mutex _depacketizer_lock;
 		mpegts::MpegTsDepacketizer	_depacketizer;
 
+		NalUnitParameterSetCache<H265SPS> _h265_sps_cache;
+
 		info::VHostAppName _vhost_app_name;
 
 		uint64_t _lifetime_epoch_msec;
@@ -55,5 +62,9 @@ namespace pvd
 		bool _first_frame = true;
 		int64_t _pts_offset = 0;
 		int64_t _dts_offset = 0;
+
+		std::shared_ptr<mon::SrtMetrics> _srt_metrics;
+		int64_t _srt_metrics_updated_msec = 0;
+		int64_t _srt_retransmitted_packet_count = 0;
 	};
 }
\ No newline at end of file
@@ -0,0 +1,482 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "ovt_connection.h"
+
+#include <modules/ovt_packetizer/ovt_packetizer.h>
+
+#include "ovt_stream.h"
+
+#define OV_LOG_TAG "OvtConnection"
+
+namespace pvd
+{
+	std::shared_ptr<OvtConnection> OvtConnection::Create(const std::shared_ptr<ov::SocketPool> &pool, const std::shared_ptr<const ov::Url> &url)
+	{
+		auto socket_address = ov::SocketAddress::CreateAndGetFirst(url->Host(), url->Port());
+
+		auto socket = pool->AllocSocket(socket_address.GetFamily());
+		if (socket == nullptr)
+		{
+			logte("To create client socket is failed.");
+			return nullptr;
+		}
+
+		socket->MakeBlocking();
+
+		if (socket->GetType() == ov::SocketType::Srt)
+		{
+			auto latency = OVT_SRT_DEFAULT_LATENCY_MSEC;
+			if (url->HasQueryKey(OVT_SRT_LATENCY_QUERY_KEY))
+			{
+				latency = ov::Converter::ToInt32(url->GetQueryValue(OVT_SRT_LATENCY_QUERY_KEY));
+			}
+
+			// OVT is a byte stream, so a packet must not be skipped even if it is too late
+			socket->SetSockOpt<bool>(SRTO_TLPKTDROP, false);
+			socket->SetSockOpt<int32_t>(SRTO_RCVLATENCY, latency);
+			socket->SetSockOpt<int32_t>(SRTO_PEERLATENCY, latency);
+		}
+		else
+		{
+			socket->SetSockOpt<int>(IPPROTO_TCP, TCP_NODELAY, 1);
+			socket->SetSockOpt<int>(IPPROTO_TCP, TCP_QUICKACK, 1);
+		}
+
+		// The receive thread checks whether the connection is closed at this interval
+		struct timeval tv = {1, 500000};  // 1.5 sec
+		socket->SetRecvTimeout(tv);
+
+		auto error = socket->Connect(socket_address, 1500);
+		if (error != nullptr)
+		{
+			logte("Cannot connect to origin server (%s) : %s:%d", error->GetMessage().CStr(), url->Host().CStr(), url->Port());
+			socket->Close();
+			return nullptr;
+		}
+
+		auto connection = std::make_shared<OvtConnection>(socket, url);
+
+		// The thread does not keep the connection alive, so it is released when the last stream releases it
+		std::weak_ptr<OvtConnection> weak_connection = connection;
+		connection->_receive_thread = std::thread([weak_connection]() {
+			while (true)
+			{
+				auto connection = weak_connection.lock();
+				if ((connection == nullptr) || (connection->ReceivePackets() == false))
+				{
+					break;
+				}
+			}
+		});
+		::pthread_setname_np(connection->_receive_thread.native_handle(), "OvtConnection");
+
+		if (socket->GetType() == ov::SocketType::Srt)
+		{
+			// Each stream has its own SRT connection, so a lost packet of a stream does not delay the others
+			return connection;
+		}
+
+		if (connection->RequestHello() == false)
+		{
+			if (connection->IsClosed())
+			{
+				return nullptr;
+			}
+
+			logti("%s does not support multiplexing, the connection is used for only one stream", GetKey(url).CStr());
+		}
+
+		return connection;
+	}
+
+	OvtConnection::OvtConnection(const std::shared_ptr<ov::Socket> &socket, const std::shared_ptr<const ov::Url> &url)
+		: _socket(socket),
+		  _url(url)
+	{
+		_receive_buffer.Reserve(INIT_PACKET_BUFFER_SIZE);
+	}
+
+	OvtConnection::~OvtConnection()
+	{
+		Close();
+
+		if (_receive_thread.joinable())
+		{
+			if (_receive_thread.get_id() == std::this_thread::get_id())
+			{
+				// The last reference is released by an observer in the receive thread
+				_receive_thread.detach();
+			}
+			else
+			{
+				_receive_thread.join();
+			}
+		}
+
+		logtd("OvtConnection to %s has been terminated", GetKey(_url).CStr());
+	}
+
+	ov::String OvtConnection::GetKey(const std::shared_ptr<const ov::Url> &url)
+	{
+		return ov::String::FormatString("%s:%d", url->Host().CStr(), url->Port());
+	}
+
+	ov::SocketType OvtConnection::GetSocketType(const std::shared_ptr<const ov::Url> &url)
+	{
+		if (url->HasQueryKey(OVT_TRANSPORT_QUERY_KEY) && (url->GetQueryValue(OVT_TRANSPORT_QUERY_KEY).LowerCaseString() == "srt"))
+		{
+			return ov::SocketType::Srt;
+		}
+
+		return ov::SocketType::Tcp;
+	}
+
+	bool OvtConnection::IsMultiplexed() const
+	{
+		return _multiplexed;
+	}
+
+	bool OvtConnection::IsClosed() const
+	{
+		return _closed;
+	}
+
+	uint32_t OvtConnection::IssueRequestId()
+	{
+		return ++_last_request_id;
+	}
+
+	bool OvtConnection::RequestHello()
+	{
+		Json::Value root;
+
+		auto request_id = IssueRequestId();
+		root["id"] = request_id;
+		root["application"] = "hello";
+		root["target"] = _url->Source().CStr();
+
+		if (SendRequest(request_id, ov::Json::Stringify(root).ToData(false)) == false)
+		{
+			return false;
+		}
+
+		auto message = WaitForResponse(request_id, OVT_TIMEOUT_MSEC);
+		if (message == nullptr)
+		{
+			return false;
+		}
+
+		ov::String payload(message->GetDataAs<char>(), message->GetLength());
+		ov::JsonObject object = ov::Json::Parse(payload);
+		if (object.IsNull())
+		{
+			return false;
+		}
+
+		// A legacy origin responds 404 (Unknown application)
+		Json::Value &json_code = object.GetJsonValue()["code"];
+		Json::Value &json_multiplex = object.GetJsonValue()["contents"]["multiplex"];
+		if (json_code.isUInt() == false || json_code.asUInt() != 200 || json_multiplex.isBool() == false)
+		{
+			return false;
+		}
+
+		_multiplexed = json_multiplex.asBool();
+
+		return _multiplexed;
+	}
+
+	bool OvtConnection::SendRequest(uint32_t request_id, const std::shared_ptr<ov::Data> &message, const std::shared_ptr<OvtConnectionObserver> &observer)
+	{
+		{
+			std::lock_guard<std::mutex> lock(_pending_requests_lock);
+			_pending_requests[request_id].observer = observer;
+		}
+
+		if (SendMessage(0, message) == false)
+		{
+			std::lock_guard<std::mutex> lock(_pending_requests_lock);
+			_pending_requests.erase(request_id);
+			return false;
+		}
+
+		return true;
+	}
+
+	bool OvtConnection::SendMessage(uint32_t session_id, const std::shared_ptr<ov::Data> &message)
+	{
+		if (_closed)
+		{
+			return false;
+		}
+
+		OvtPacketizer packetizer;
+		if (packetizer.PacketizeMessage(OVT_PAYLOAD_TYPE_MESSAGE_REQUEST, ov::Clock::NowMSec(), message) == false)
+		{
+			return false;
+		}
+
+		// The packets of a message are sent at once, so they are not interleaved with the other messages
+		std::vector<std::shared_ptr<const ov::Data>> data_list;
+		while (packetizer.IsAvailablePackets())
+		{
+			auto packet = packetizer.PopPacket();
+			packet->SetSessionId(session_id);
+
+			data_list.push_back(packet->GetData());
+		}
+
+		if (_socket->Send(data_list) == false)
+		{
+			logte("Could not send message to %s", GetKey(_url).CStr());
+			return false;
+		}
+
+		return true;
+	}
+
+	std::shared_ptr<ov::Data> OvtConnection::WaitForResponse(uint32_t request_id, int timeout_msec)
+	{
+		std::unique_lock<std::mutex> lock(_pending_requests_lock);
+
+		auto item = _pending_requests.find(request_id);
+		if (item == _pending_requests.end())
+		{
+			return nullptr;
+		}
+
+		_pending_requests_cv.wait_for(lock, std::chrono::milliseconds(timeout_msec), [this, &item]() -> bool {
+			return (item->second.response != nullptr) || _closed;
+		});
+
+		auto response = item->second.response;
+		_pending_requests.erase(item);
+
+		return response;
+	}
+
+	void OvtConnection::DetachObserver(uint32_t session_id)
+	{
+		std::lock_guard lock(_observers_lock);
+		_observers.erase(session_id);
+	}
+
+	void OvtConnection::Close()
+	{
+		if (_closed.exchange(true))
+		{
+			return;
+		}
+
+		_socket->Close();
+
+		// Wake up the waiters
+		std::lock_guard<std::mutex> lock(_pending_requests_lock);
+		_pending_requests_cv.notify_all();
+	}
+
+	std::shared_ptr<OvtConnectionObserver> OvtConnection::GetObserver(uint32_t session_id)
+	{
+		std::shared_lock lock(_observers_lock);
+
+		if (_multiplexed == false)
+		{
+			// The connection has only one stream
+			session_id = 0;
+		}
+
+		auto item = _observers.find(session_id);
+		if (item == _observers.end())
+		{
+			return nullptr;
+		}
+
+		return item->second.lock();
+	}
+
+	bool OvtConnection::ReceivePackets()
+	{
+		uint8_t buffer[65535];
+		size_t read_bytes = 0ULL;
+
+		auto error = _socket->Recv(buffer, sizeof(buffer), &read_bytes, false);
+		if (read_bytes == 0)
+		{
+			if (error == nullptr)
+			{
+				// Timed out
+				return (_closed == false) || OnClosed();
+			}
+
+			if (_closed == false)
+			{
+				logte("An error occurred while receiving packet from %s: %s", GetKey(_url).CStr(), error->What());
+			}
+
+			return OnClosed();
+		}
+
+		_receive_buffer.Append(buffer, read_bytes);
+
+		// Parse the packets once here, and route them to the sessions
+		auto data = _receive_buffer.GetDataAs<uint8_t>();
+		size_t offset = 0;
+
+		while (_receive_buffer.GetLength() - offset >= OVT_FIXED_HEADER_SIZE)
+		{
+			ov::Data remained(data + offset, _receive_buffer.GetLength() - offset, true);
+			auto packet = std::make_shared<OvtPacket>();
+
+			if (packet->Load(remained) == false)
+			{
+				if (packet->IsHeaderAvailable() == false)
+				{
+					logte("Packet is invalid : buffer size (%zu)", remained.GetLength());
+					return OnClosed();
+				}
+
+				// Not enough data to parse yet
+				break;
+			}
+
+			offset += packet->PacketLength();
+
+			if (ProcessPacket(packet) == false)
+			{
+				return OnClosed();
+			}
+		}
+
+		if (offset > 0)
+		{
+			_receive_buffer.Erase(0, offset);
+		}
+
+		return true;
+	}
+
+	bool OvtConnection::OnClosed()
+	{
+		Close();
+
+		// Notify all observers that the connection is closed, so the streams will be restarted
+		std::vector<std::shared_ptr<OvtConnectionObserver>> observers;
+		{
+			std::lock_guard lock(_observers_lock);
+
+			for (auto &item : _observers)
+			{
+				auto observer = item.second.lock();
+				if (observer != nullptr)
+				{
+					observers.push_back(observer);
+				}
+			}
+
+			_observers.clear();
+		}
+
+		for (auto &observer : observers)
+		{
+			observer->OnOvtConnectionClosed();
+		}
+
+		return false;
+	}
+
+	bool OvtConnection::ProcessPacket(const std::shared_ptr<OvtPacket> &packet)
+	{
+		auto session_id = packet->SessionId();
+
+		if (packet->PayloadType() == OVT_PAYLOAD_TYPE_MEDIA_PACKET || session_id != 0)
+		{
+			auto observer = GetObserver(session_id);
+			if (observer != nullptr)
+			{
+				observer->OnOvtPacketReceived(packet);
+				return true;
+			}
+
+			if (packet->PayloadType() == OVT_PAYLOAD_TYPE_MEDIA_PACKET)
+			{
+				// The session may have been stopped
+				logtd("Media packet of unknown session(%u) is discarded", session_id);
+				return true;
+			}
+		}
+
+		// The responses of the requests
+		if (_depacketizer.AppendPacket(packet) == false)
+		{
+			return false;
+		}
+
+		while (_depacketizer.IsAvailableMessage())
+		{
+			ProcessResponse(_depacketizer.PopMessage());
+		}
+
+		return true;
+	}
+
+	void OvtConnection::ProcessResponse(const std::shared_ptr<ov::Data> &message)
+	{
+		ov::String payload(message->GetDataAs<char>(), message->GetLength());
+		ov::JsonObject object = ov::Json::Parse(payload);
+
+		if (object.IsNull())
+		{
+			logtw("An invalid response : Json format");
+			return;
+		}
+
+		Json::Value &json_id = object.GetJsonValue()["id"];
+		if (json_id.isUInt() == false)
+		{
+			logtw("An invalid response : There is no id");
+			return;
+		}
+
+		std::lock_guard<std::mutex> lock(_pending_requests_lock);
+
+		auto item = _pending_requests.find(json_id.asUInt());
+		if (item == _pending_requests.end())
+		{
+			// e.g. The response of STOP, or the request has been timed out
+			logtd("The response of unknown request(%u) is discarded", json_id.asUInt());
+			return;
+		}
+
+		auto &request = item->second;
+
+		Json::Value &json_code = object.GetJsonValue()["code"];
+		if ((request.observer != nullptr) && json_code.isUInt() && (json_code.asUInt() == 200))
+		{
+			// Attach the observer before the media packets of the session are received
+			uint32_t session_id = 0;
+
+			if (_multiplexed)
+			{
+				Json::Value &json_session_id = object.GetJsonValue()["contents"]["sessionId"];
+				if (json_session_id.isUInt())
+				{
+					session_id = json_session_id.asUInt();
+				}
+			}
+
+			if ((_multiplexed == false) || (session_id != 0))
+			{
+				std::lock_guard observers_lock(_observers_lock);
+				_observers[session_id] = request.observer;
+			}
+		}
+
+		request.response = message;
+		_pending_requests_cv.notify_all();
+	}
+}  // namespace pvd
@@ -0,0 +1,105 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/ovlibrary/ovlibrary.h>
+#include <base/ovlibrary/url.h>
+#include <base/ovsocket/ovsocket.h>
+#include <modules/ovt_packetizer/ovt_depacketizer.h>
+#include <modules/ovt_packetizer/ovt_packet.h>
+
+// The transport is selected with the query of the origin url (e.g. ovt://host:port/app/stream?transport=srt&latency=500)
+// SRT retransmits the lost packets within the latency, so a lost packet on a lossy link does not stall the stream
+// like TCP (the connection is not multiplexed to keep each stream independent)
+#define OVT_TRANSPORT_QUERY_KEY			"transport"
+#define OVT_SRT_LATENCY_QUERY_KEY		"latency"
+#define OVT_SRT_DEFAULT_LATENCY_MSEC	500
+
+namespace pvd
+{
+	// Receives the packets of a session from OvtConnection
+	// Called in the receive thread of the connection, so it must not block.
+	class OvtConnectionObserver
+	{
+	public:
+		virtual void OnOvtPacketReceived(const std::shared_ptr<OvtPacket> &packet) = 0;
+		virtual void OnOvtConnectionClosed() = 0;
+	};
+
+	// A connection to an origin (OvtPublisher)
+	//
+	// If the origin supports HELLO, the sessions of several streams are multiplexed over the connection,
+	// and the packets are routed to the observers by the session id of OVT header.
+	// Otherwise the connection is used for only one stream like before.
+	class OvtConnection
+	{
+	public:
+		static std::shared_ptr<OvtConnection> Create(const std::shared_ptr<ov::SocketPool> &pool, const std::shared_ptr<const ov::Url> &url);
+
+		OvtConnection(const std::shared_ptr<ov::Socket> &socket, const std::shared_ptr<const ov::Url> &url);
+		~OvtConnection();
+
+		// "host:port"
+		static ov::String GetKey(const std::shared_ptr<const ov::Url> &url);
+		// TCP, or SRT if "transport=srt" is in the query
+		static ov::SocketType GetSocketType(const std::shared_ptr<const ov::Url> &url);
+
+		bool IsMultiplexed() const;
+		bool IsClosed() const;
+
+		// Request ID must be unique in a connection, because the responses of several streams are received
+		uint32_t IssueRequestId();
+
+		// If <observer> is not nullptr, it is attached to the session of the successful response (PLAY) before the next packet is received
+		bool SendRequest(uint32_t request_id, const std::shared_ptr<ov::Data> &message, const std::shared_ptr<OvtConnectionObserver> &observer = nullptr);
+		bool SendMessage(uint32_t session_id, const std::shared_ptr<ov::Data> &message);
+		// Returns nullptr if the response is not received within <timeout_msec>, or the connection is closed
+		std::shared_ptr<ov::Data> WaitForResponse(uint32_t request_id, int timeout_msec);
+
+		void DetachObserver(uint32_t session_id);
+
+		void Close();
+
+	private:
+		struct PendingRequest
+		{
+			std::shared_ptr<OvtConnectionObserver> observer = nullptr;
+			std::shared_ptr<ov::Data> response = nullptr;
+		};
+
+		bool RequestHello();
+
+		// Receives the packets and routes them, returns false if the connection is closed
+		bool ReceivePackets();
+		// Returns false always
+		bool OnClosed();
+		bool ProcessPacket(const std::shared_ptr<OvtPacket> &packet);
+		void ProcessResponse(const std::shared_ptr<ov::Data> &message);
+		std::shared_ptr<OvtConnectionObserver> GetObserver(uint32_t session_id);
+
+		std::shared_ptr<ov::Socket> _socket;
+		std::shared_ptr<const ov::Url> _url;
+
+		std::atomic<bool> _multiplexed{false};
+		std::atomic<bool> _closed{false};
+		std::atomic<uint32_t> _last_request_id{0};
+
+		std::thread _receive_thread;
+		ov::Data _receive_buffer;
+		// The messages not belonging to an attached session (e.g. responses)
+		OvtDepacketizer _depacketizer;
+
+		std::mutex _pending_requests_lock;
+		std::condition_variable _pending_requests_cv;
+		std::map<uint32_t, PendingRequest> _pending_requests;
+
+		// session id : observer (0 if the connection is not multiplexed)
+		ov::ProfiledSharedMutex _observers_lock{"pvd::OvtConnection::_observers_lock"};
+		std::map<uint32_t, std::weak_ptr<OvtConnectionObserver>> _observers;
+	};
+}  // namespace pvd
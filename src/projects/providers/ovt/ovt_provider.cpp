@@ -45,11 +45,27 @@ namespace pvd
 			_client_socket_pool->Uninitialize();
 		}
 
+		if (_srt_client_socket_pool != nullptr)
+		{
+			_srt_client_socket_pool->Uninitialize();
+		}
+
 		logtd("Terminated OvtProvider modules.");
 	}
 
-	std::shared_ptr<ov::SocketPool> OvtProvider::GetClientSocketPool()
+	std::shared_ptr<ov::SocketPool> OvtProvider::GetClientSocketPool(ov::SocketType type)
 	{
+		if (type == ov::SocketType::Srt)
+		{
+			if (_srt_client_socket_pool == nullptr)
+			{
+				_srt_client_socket_pool = ov::SocketPool::Create("OvtProviderSrt", ov::SocketType::Srt);
+				_srt_client_socket_pool->Initialize(_worker_count);
+			}
+
+			return _srt_client_socket_pool;
+		}
+
 		if(_client_socket_pool == nullptr)
 		{
 			_client_socket_pool = ov::SocketPool::Create("OvtProvider", ov::SocketType::Tcp);
@@ -59,6 +75,57 @@ namespace pvd
 		return _client_socket_pool;
 	}
 
+	std::shared_ptr<OvtConnection> OvtProvider::GetConnection(const std::shared_ptr<const ov::Url> &url)
+	{
+		auto socket_type = OvtConnection::GetSocketType(url);
+
+		auto pool = GetClientSocketPool(socket_type);
+		if (pool == nullptr)
+		{
+			// Provider is not initialized
+			return nullptr;
+		}
+
+		if (socket_type == ov::SocketType::Srt)
+		{
+			// SRT connections are not shared
+			return OvtConnection::Create(pool, url);
+		}
+
+		std::shared_ptr<OriginConnection> origin_connection;
+		{
+			std::lock_guard<std::mutex> lock(_connections_lock);
+
+			auto &item = _connections[OvtConnection::GetKey(url)];
+			if (item == nullptr)
+			{
+				item = std::make_shared<OriginConnection>();
+			}
+
+			origin_connection = item;
+		}
+
+		// Connecting takes time, so only the streams from the same origin wait for it
+		std::lock_guard<std::mutex> lock(origin_connection->lock);
+
+		auto connection = origin_connection->connection.lock();
+		if ((connection != nullptr) && (connection->IsClosed() == false))
+		{
+			return connection;
+		}
+
+		connection = OvtConnection::Create(pool, url);
+		if (connection == nullptr)
+		{
+			return nullptr;
+		}
+
+		// A legacy origin needs a connection for each stream
+		origin_connection->connection = connection->IsMultiplexed() ? connection : nullptr;
+
+		return connection;
+	}
+
 	bool OvtProvider::OnCreateHost(const info::Host &host_info)
 	{
 		return true;
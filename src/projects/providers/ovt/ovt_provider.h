@@ -10,6 +10,8 @@
 #include <base/provider/pull_provider/provider.h>
 #include <orchestrator/orchestrator.h>
 
+#include "ovt_connection.h"
+
 /*
  * OvtProvider
  * 		: Create PhysicalPort, OvtApplication
@@ -19,10 +21,12 @@
  *
  * OvtStream
  * 		: Create by interface (PullStream)
- * 		: Create Thread, the Thread has a Queue
- * 				: Communicate with OvtPublisher of Origin Server
- * 				: Send packets by OvtProvider::PhysicalPort
- * 				: Receive packets from OvtProvider -> OvtApplication -> OvtStream -> Queue
+ * 		: Communicate with OvtPublisher of Origin Server through OvtConnection
+ * 		: Receive packets from OvtConnection -> OvtStream (Queue) -> StreamMotor
+ *
+ * OvtConnection
+ * 		: Created by OvtProvider for each origin (host:port), and shared by the OvtStreams from the origin
+ * 		: Route the packets to the OvtStreams by OVT Session ID
  *
  */
 
@@ -51,7 +55,9 @@ namespace pvd
 			return "OVTProvider";
 		}
 
-		std::shared_ptr<ov::SocketPool> GetClientSocketPool();
+		std::shared_ptr<ov::SocketPool> GetClientSocketPool(ov::SocketType type = ov::SocketType::Tcp);
+		// Returns the multiplexed connection to the origin of <url> if exists, otherwise connects to it
+		std::shared_ptr<OvtConnection> GetConnection(const std::shared_ptr<const ov::Url> &url);
 
 	protected:
 		bool OnCreateHost(const info::Host &host_info) override;
@@ -60,6 +66,18 @@ namespace pvd
 		bool OnDeleteProviderApplication(const std::shared_ptr<pvd::Application> &application) override;
 
 		std::shared_ptr<ov::SocketPool> _client_socket_pool = nullptr;
+		std::shared_ptr<ov::SocketPool> _srt_client_socket_pool = nullptr;
 		int _worker_count = 1;
+
+		struct OriginConnection
+		{
+			// The streams from the same origin wait for one connection instead of connecting at the same time
+			std::mutex lock;
+			std::weak_ptr<OvtConnection> connection;
+		};
+
+		// "host:port" : connection shared by the streams from the origin
+		std::mutex _connections_lock;
+		std::map<ov::String, std::shared_ptr<OriginConnection>> _connections;
 	};
 }  // namespace pvd
\ No newline at end of file
@@ -4,6 +4,7 @@
 
 #include "ovt_stream.h"
 #include <modules/ovt_packetizer/ovt_signaling.h>
+#include <sys/eventfd.h>
 
 #include <modules/bitstream/aac/aac_specific_config.h>
 #include <modules/bitstream/h264/h264_decoder_configuration_record.h>
@@ -40,32 +41,44 @@ namespace pvd
 		: pvd::PullStream(application, stream_info, url_list, properties)
 	{
 		_last_request_id = 0;
+		_event_fd = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
 		SetState(State::IDLE);
 		logtd("OvtStream Created : %d", GetId());
 	}
 
 	OvtStream::~OvtStream()
 	{
-		Release();
+		// Stop first to request STOP through the connection before releasing it
 		Stop();
+		Release();
+
+		if (_event_fd != -1)
+		{
+			::close(_event_fd);
+		}
+
 		logtd("OvtStream Terminated : %d", GetId());
 	}
 
 	void OvtStream::Release()
 	{
-		if (_client_socket != nullptr)
+		if (_connection != nullptr)
 		{
-			_client_socket->Close();
+			// If the connection is not shared, it is closed when released
+			_connection->DetachObserver(_session_id);
+			_connection.reset();
 		}
 
+		_session_id = 0;
 		_curr_url = nullptr;
 
-		std::lock_guard<std::shared_mutex> mlock(_packetizer_lock);
-		if (_packetizer != nullptr)
-		{
-			_packetizer->Release();
-			_packetizer.reset();
-		}
+		std::lock_guard<std::mutex> lock(_received_packets_lock);
+		_received_packets.clear();
+		_received_bytes = 0;
+		_connection_closed = false;
+		_in_media_packet = false;
+		_dropping_media_packet = false;
+		_waiting_key_frame = false;
 	}
 
 	bool OvtStream::StartStream(const std::shared_ptr<const ov::Url> &url)
@@ -78,11 +91,6 @@ namespace pvd
 
 		_curr_url = url;
 
-		if (_packetizer == nullptr)
-		{
-			_packetizer = std::make_shared<OvtPacketizer>(OvtPacketizerInterface::GetSharedPtr());
-		}
-
 		ov::StopWatch stop_watch;
 
 		// For statistics
@@ -106,6 +114,7 @@ namespace pvd
 		if (!RequestPlay())
 		{
 			SetState(Stream::State::ERROR);
+			Release();
 			return false;
 		}
 		_origin_response_time_msec = stop_watch.Elapsed();
@@ -149,6 +158,17 @@ namespace pvd
 		return true;
 	}
 
+	uint16_t OvtStream::GetProbePort(const std::shared_ptr<const ov::Url> &url)
+	{
+		// SRT is not probed as it is over UDP
+		if (OvtConnection::GetSocketType(url) != ov::SocketType::Tcp)
+		{
+			return 0;
+		}
+
+		return static_cast<uint16_t>(url->Port());
+	}
+
 	std::shared_ptr<pvd::OvtProvider> OvtStream::GetOvtProvider()
 	{
 		return std::static_pointer_cast<OvtProvider>(_application->GetParentProvider());
@@ -175,39 +195,12 @@ namespace pvd
 			return false;
 		}
 
-		auto pool = GetOvtProvider()->GetClientSocketPool();
-
-		if (pool == nullptr)
-		{
-			// Provider is not initialized
-			return false;
-		}
-
-		auto socket_address = ov::SocketAddress::CreateAndGetFirst(_curr_url->Host(), _curr_url->Port());
-
-		_client_socket = pool->AllocSocket(socket_address.GetFamily());
-
-		if (_client_socket == nullptr)
+		// The connection to the origin is shared with the other streams if the origin supports multiplexing
+		_connection = GetOvtProvider()->GetConnection(_curr_url);
+		if (_connection == nullptr)
 		{
 			SetState(State::ERROR);
-			logte("To create client socket is failed.");
-
-			_client_socket = nullptr;
-			return false;
-		}
-
-		_client_socket->SetSockOpt<int>(IPPROTO_TCP, TCP_NODELAY, 1);
-		_client_socket->SetSockOpt<int>(IPPROTO_TCP, TCP_QUICKACK, 1);
-		_client_socket->MakeBlocking();
-
-		struct timeval tv = {1, 500000};  // 1.5 sec
-		_client_socket->SetRecvTimeout(tv);
-
-		auto error = _client_socket->Connect(socket_address, 1500);
-		if (error != nullptr)
-		{
-			SetState(State::ERROR);
-			logte("Cannot connect to origin server (%s) : %s:%d", error->GetMessage().CStr(), _curr_url->Host().CStr(), _curr_url->Port());
+			logte("Cannot connect to origin server : %s:%d", _curr_url->Host().CStr(), _curr_url->Port());
 			return false;
 		}
 
@@ -225,15 +218,14 @@ namespace pvd
 
 		Json::Value root;
 
-		_last_request_id++;
+		_last_request_id = _connection->IssueRequestId();
 		root["id"] = _last_request_id;
 		root["application"] = "describe";
 		root["target"] = _curr_url->Source().CStr();
 
 		auto message = ov::Json::Stringify(root).ToData(false);
 
-		std::shared_lock<std::shared_mutex> lock(_packetizer_lock);
-		if (_packetizer->PacketizeMessage(OVT_PAYLOAD_TYPE_MESSAGE_REQUEST, ov::Clock::NowMSec(), message) == false)
+		if (_connection->SendRequest(_last_request_id, message) == false)
 		{
 			return false;
 		}
@@ -492,15 +484,15 @@ namespace pvd
 		}
 
 		Json::Value root;
-		_last_request_id++;
+		_last_request_id = _connection->IssueRequestId();
 		root["id"] = _last_request_id;
 		root["application"] = "play";
 		root["target"] = _curr_url->Source().CStr();
 
 		auto message = ov::Json::Stringify(root).ToData(false);
 
-		std::shared_lock<std::shared_mutex> lock(_packetizer_lock);
-		if (_packetizer->PacketizeMessage(OVT_PAYLOAD_TYPE_MESSAGE_REQUEST, ov::Clock::NowMSec(), message) == false)
+		// The media packets of the session are routed to this stream as soon as the origin responds
+		if (_connection->SendRequest(_last_request_id, message, GetSharedPtrAs<OvtStream>()) == false)
 		{
 			logte("%s/%s(%u) - Could not request to play. Socket send error", GetApplicationInfo().GetName().CStr(), GetName().CStr(), GetId());
 			return false;
@@ -565,119 +557,183 @@ namespace pvd
 			return false;
 		}
 
+		// A legacy origin does not assign the session id (the connection is not multiplexed)
+		Json::Value &json_session_id = object.GetJsonValue()["contents"]["sessionId"];
+		if (_connection->IsMultiplexed())
+		{
+			if (json_session_id.isUInt() == false)
+			{
+				SetState(State::ERROR);
+				logte("An invalid response : There is no session id");
+				return false;
+			}
+
+			_session_id = json_session_id.asUInt();
+		}
+
 		SetState(State::PLAYING);
 		return true;
 	}
 
 	bool OvtStream::RequestStop()
 	{
-		if (GetState() != State::PLAYING)
+		if (GetState() != State::PLAYING || _connection == nullptr)
 		{
 			return false;
 		}
 
+		// The packets of the session are not needed anymore
+		_connection->DetachObserver(_session_id);
+
 		Json::Value root;
-		_last_request_id++;
+		_last_request_id = _connection->IssueRequestId();
 		root["id"] = _last_request_id;
 		root["application"] = "stop";
 		root["target"] = _curr_url->Source().CStr();
+		if (_connection->IsMultiplexed())
+		{
+			root["sessionId"] = _session_id;
+		}
 
 		auto message = ov::Json::Stringify(root).ToData(false);
 
-		std::shared_lock<std::shared_mutex> lock(_packetizer_lock);
-		if (_packetizer->PacketizeMessage(OVT_PAYLOAD_TYPE_MESSAGE_REQUEST, ov::Clock::NowMSec(), message) == false)
+		// The response is not waited
+		return _connection->SendMessage(0, message);
+	}
+
+	std::shared_ptr<ov::Data> OvtStream::ReceiveMessage()
+	{
+		auto message = _connection->WaitForResponse(_last_request_id, OVT_TIMEOUT_MSEC);
+		if (message == nullptr)
 		{
-			return false;
+			logte("%s/%s(%u) - Could not receive message : %s", GetApplicationInfo().GetName().CStr(), GetName().CStr(), GetId(), _connection->IsClosed() ? "disconnected" : "timed out");
+			SetState(State::ERROR);
+			return nullptr;
 		}
 
-		return true;
+		return message;
 	}
 
-	bool OvtStream::OnOvtPacketized(std::shared_ptr<OvtPacket> &packet)
+	void OvtStream::OnOvtPacketReceived(const std::shared_ptr<OvtPacket> &packet)
 	{
-		if (_client_socket->Send(packet->GetData()) == false)
+		std::lock_guard<std::mutex> lock(_received_packets_lock);
+
+		if (CheckFlowControl(packet) == false)
 		{
-			SetState(State::ERROR);
-			logte("Could not send message");
-			return false;
+			return;
 		}
 
-		return true;
+		_received_packets.push_back(packet);
+		_received_bytes += packet->PacketLength();
+
+		uint64_t value = 1;
+		[[maybe_unused]] auto result = ::write(_event_fd, &value, sizeof(value));
 	}
 
-	std::shared_ptr<ov::Data> OvtStream::ReceiveMessage()
+	void OvtStream::OnOvtConnectionClosed()
 	{
-		while (true)
-		{
-			auto result = ReceivePacket();
-			if (result == false)
-			{
-				logte("%s/%s(%u) - Could not receive packet : err(%d)", GetApplicationInfo().GetName().CStr(), GetName().CStr(), GetId(), static_cast<uint8_t>(result));
-				SetState(State::ERROR);
-				return nullptr;
-			}
+		std::lock_guard<std::mutex> lock(_received_packets_lock);
 
-			if (_depacketizer.IsAvailableMessage())
-			{
-				auto message = _depacketizer.PopMessage();
-				return message;
-			}
-		}
+		_connection_closed = true;
 
-		return nullptr;
+		uint64_t value = 1;
+		[[maybe_unused]] auto result = ::write(_event_fd, &value, sizeof(value));
 	}
 
-	bool OvtStream::ReceivePacket(bool non_block)
+	bool OvtStream::CheckFlowControl(const std::shared_ptr<OvtPacket> &packet)
 	{
-		uint8_t buffer[65535];
-		size_t read_bytes = 0ULL;
+		if (packet->PayloadType() != OVT_PAYLOAD_TYPE_MEDIA_PACKET)
+		{
+			return true;
+		}
 
-		auto error = _client_socket->Recv(buffer, 65535, &read_bytes, non_block);
-		if (read_bytes == 0)
+		// A media packet is fragmented into several OVT packets, so it is dropped or accepted as a whole
+		if (_in_media_packet == false)
 		{
-			if (error != nullptr)
+			// The first fragment starts with the header of the media packet
+			bool is_video = false;
+			bool is_key_frame = false;
+			if (packet->PayloadLength() >= MEDIA_PACKET_HEADER_SIZE)
 			{
-				logte("[%s/%s] An error occurred while receiving packet: %s", GetApplicationName(), GetName().CStr(), error->What());
-				_client_socket->Close();
-				SetState(State::ERROR);
-				return false;
+				auto payload = packet->Payload();
+				is_video = static_cast<cmn::MediaType>(payload[28]) == cmn::MediaType::Video;
+				is_key_frame = static_cast<MediaPacketFlag>(payload[29]) == MediaPacketFlag::Key;
 			}
-			else
+
+			if (_received_bytes > OVT_STREAM_MAX_QUEUED_BYTES)
 			{
-				if (non_block == true)
+				if (_dropping_media_packet == false)
 				{
-					// retry later
-					return true;
+					logtw("%s/%s(%u) - The stream cannot keep up with the origin, the media packets are dropped until the next key frame (queued: %zu bytes)",
+						  GetApplicationInfo().GetName().CStr(), GetName().CStr(), GetId(), _received_bytes);
 				}
-				else
+
+				_dropping_media_packet = true;
+				_waiting_key_frame = true;
+			}
+			else if (is_video && _waiting_key_frame && (is_key_frame == false))
+			{
+				// The next video frames cannot be decoded without the dropped one
+				_dropping_media_packet = true;
+			}
+			else
+			{
+				_dropping_media_packet = false;
+
+				if (is_video && is_key_frame)
 				{
-					// timeout
-					return false;
+					_waiting_key_frame = false;
 				}
 			}
 		}
 
-		if (_depacketizer.AppendPacket(buffer, read_bytes) == false)
-		{
-			logte("[%s/%s] An error occurred while parsing packet: Invalid packet", GetApplicationName(), GetName().CStr());
-			return false;
-		}
+		_in_media_packet = (packet->Marker() == false);
 
-		return true;
+		return (_dropping_media_packet == false);
 	}
 
 	int OvtStream::GetFileDescriptorForDetectingEvent()
 	{
-		return _client_socket->GetNativeHandle();
+		return _event_fd;
+	}
+
+	bool OvtStream::DepacketizeReceivedPackets()
+	{
+		uint64_t value;
+		[[maybe_unused]] auto result = ::read(_event_fd, &value, sizeof(value));
+
+		std::deque<std::shared_ptr<OvtPacket>> packets;
+		bool connection_closed;
+		{
+			std::lock_guard<std::mutex> lock(_received_packets_lock);
+			packets.swap(_received_packets);
+			_received_bytes = 0;
+			connection_closed = _connection_closed;
+		}
+
+		if (connection_closed)
+		{
+			logte("[%s/%s] The connection to the origin is closed", GetApplicationName(), GetName().CStr());
+			return false;
+		}
+
+		for (const auto &packet : packets)
+		{
+			if (_depacketizer.AppendPacket(packet) == false)
+			{
+				logte("[%s/%s] An error occurred while parsing packet: Invalid packet", GetApplicationName(), GetName().CStr());
+				return false;
+			}
+		}
+
+		return true;
 	}
 
 	PullStream::ProcessMediaResult OvtStream::ProcessMediaPacket()
 	{
-		// Non block
-		auto result = ReceivePacket(true);
-		if (result == false)
+		if (DepacketizeReceivedPackets() == false)
 		{
-			logte("%s/%s(%u) - Could not receive packet : err(%d)", GetApplicationInfo().GetName().CStr(), GetName().CStr(), GetId(), static_cast<uint8_t>(result));
+			logte("%s/%s(%u) - Could not receive packet", GetApplicationInfo().GetName().CStr(), GetName().CStr(), GetId());
 			SetState(State::ERROR);
 			return ProcessMediaResult::PROCESS_MEDIA_FAILURE;
 		}
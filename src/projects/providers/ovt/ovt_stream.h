@@ -8,20 +8,24 @@
 #include <base/ovlibrary/url.h>
 #include <base/ovlibrary/semaphore.h>
 #include <modules/ovt_packetizer/ovt_packet.h>
-#include <modules/ovt_packetizer/ovt_packetizer.h>
 #include <modules/ovt_packetizer/ovt_depacketizer.h>
 #include <monitoring/monitoring.h>
 
 #include <base/provider/pull_provider/application.h>
 #include <base/provider/pull_provider/stream.h>
 
+#include "ovt_connection.h"
+
 #define OVT_TIMEOUT_MSEC		3000
+// If the packets waiting to be processed exceed this size, the stream drops the media packets until the next key frame,
+// so a slow stream does not delay the other streams sharing the connection
+#define OVT_STREAM_MAX_QUEUED_BYTES		(16 * 1024 * 1024)
 
 namespace pvd
 {
 	class OvtProvider;
 
-	class OvtStream : public pvd::PullStream, public OvtPacketizerInterface
+	class OvtStream : public pvd::PullStream, public OvtConnectionObserver
 	{
 	public:
 		static std::shared_ptr<OvtStream> Create(const std::shared_ptr<pvd::PullApplication> &application, const uint32_t stream_id, const ov::String &stream_name,	const std::vector<ov::String> &url_list, const std::shared_ptr<pvd::PullStreamProperties> &properties);
@@ -29,12 +33,15 @@ namespace pvd
 		OvtStream(const std::shared_ptr<pvd::PullApplication> &application, const info::Stream &stream_info, const std::vector<ov::String> &url_list, const std::shared_ptr<pvd::PullStreamProperties> &properties);
 		~OvtStream() final;
 
-		bool OnOvtPacketized(std::shared_ptr<OvtPacket> &packet) override;
+		// OvtConnectionObserver Interface
+		void OnOvtPacketReceived(const std::shared_ptr<OvtPacket> &packet) override;
+		void OnOvtConnectionClosed() override;
 
 		ProcessMediaEventTrigger GetProcessMediaEventTriggerMode() override {
 			return ProcessMediaEventTrigger::TRIGGER_EPOLL;
 		}
 
+		// The event is signaled when the packets are received from the connection
 		int GetFileDescriptorForDetectingEvent() override;
 		// If this stream belongs to the Pull provider, 
 		// this function is called periodically by the StreamMotor of application. 
@@ -42,22 +49,12 @@ namespace pvd
 		PullStream::ProcessMediaResult ProcessMediaPacket() override;
 
 	private:
-
-		enum class ReceivePacketResult : uint8_t
-		{
-			COMPLETE,
-			INCOMPLETE,
-			DISCONNECTED,
-			ERROR, 
-			TIMEOUT,
-			ALREADY_COMPLETED,
-		};
-
 		std::shared_ptr<pvd::OvtProvider> GetOvtProvider();
 
 		bool StartStream(const std::shared_ptr<const ov::Url> &url) override; // Start
 		bool RestartStream(const std::shared_ptr<const ov::Url> &url) override; // Failover
 		bool StopStream() override; // Stop
+		uint16_t GetProbePort(const std::shared_ptr<const ov::Url> &url) override;
 
 		bool ConnectOrigin();
 		bool RequestDescribe();
@@ -65,14 +62,19 @@ namespace pvd
 		bool RequestPlay();
 		bool ReceivePlay(uint32_t request_id);
 		bool RequestStop();
-		bool ReceiveStop(uint32_t request_id, const std::shared_ptr<OvtPacket> &packet);
-		
-		bool ReceivePacket(bool non_block = false);
+
 		std::shared_ptr<ov::Data> ReceiveMessage();
 
+		// Per-stream flow control, returns false if the packet should be dropped (_received_packets_lock must be held)
+		bool CheckFlowControl(const std::shared_ptr<OvtPacket> &packet);
+		// Moves the received packets to the depacketizer, returns false if the connection is closed
+		bool DepacketizeReceivedPackets();
+
 		void Release();
 
-		std::shared_ptr<ov::Socket> _client_socket = nullptr;
+		std::shared_ptr<OvtConnection> _connection = nullptr;
+		// OVT Session ID assigned by the origin (0 if the connection is not multiplexed)
+		uint32_t _session_id = 0;
 		std::shared_ptr<const ov::Url> _curr_url = nullptr;
 
 		uint32_t _last_request_id;
@@ -80,8 +82,18 @@ namespace pvd
 		int64_t _origin_request_time_msec = 0;
 		int64_t _origin_response_time_msec = 0;
 
-		std::shared_mutex	_packetizer_lock;
-		std::shared_ptr<OvtPacketizer>	_packetizer;
+		// The packets routed from the connection, and the eventfd to wake up StreamMotor
+		int _event_fd = -1;
+		std::mutex _received_packets_lock;
+		std::deque<std::shared_ptr<OvtPacket>> _received_packets;
+		size_t _received_bytes = 0;
+		bool _connection_closed = false;
+
+		// Flow control state (protected by _received_packets_lock)
+		bool _in_media_packet = false;
+		bool _dropping_media_packet = false;
+		bool _waiting_key_frame = false;
+
 		OvtDepacketizer _depacketizer;
 		std::shared_ptr<mon::StreamMetrics> _stream_metrics;
 
@@ -0,0 +1,138 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "amf_packet_template.h"
+
+#include <base/ovlibrary/ovlibrary.h>
+
+AmfPacketTemplate &AmfPacketTemplate::Null()
+{
+	_payload.push_back(static_cast<uint8_t>(AmfTypeMarker::Null));
+	return *this;
+}
+
+AmfPacketTemplate &AmfPacketTemplate::Number(double number)
+{
+	uint8_t buffer[1 + 8];
+	Append(buffer, AmfUtil::EncodeNumber(buffer, number));
+	return *this;
+}
+
+AmfPacketTemplate &AmfPacketTemplate::String(const char *string)
+{
+	_payload.push_back(static_cast<uint8_t>(AmfTypeMarker::String));
+	AppendString(string);
+	return *this;
+}
+
+AmfPacketTemplate &AmfPacketTemplate::BeginObject()
+{
+	_payload.push_back(static_cast<uint8_t>(AmfTypeMarker::Object));
+	return *this;
+}
+
+AmfPacketTemplate &AmfPacketTemplate::BeginEcmaArray()
+{
+	// The count of the properties (0 = infinite), as AmfObjectArray::Encode() does
+	const uint8_t header[] = {static_cast<uint8_t>(AmfTypeMarker::EcmaArray), 0x00, 0x00, 0x00, 0x00};
+	Append(header, sizeof(header));
+	return *this;
+}
+
+AmfPacketTemplate &AmfPacketTemplate::EndObject()
+{
+	// Empty name + end marker
+	const uint8_t trailer[] = {0x00, 0x00, static_cast<uint8_t>(AmfTypeMarker::ObjectEnd)};
+	Append(trailer, sizeof(trailer));
+	return *this;
+}
+
+AmfPacketTemplate &AmfPacketTemplate::Key(const char *name)
+{
+	AppendString(name);
+	return *this;
+}
+
+AmfPacketTemplate &AmfPacketTemplate::Placeholder()
+{
+	_placeholder_offsets.push_back(_payload.size());
+	return *this;
+}
+
+std::shared_ptr<std::vector<uint8_t>> AmfPacketTemplate::Make(std::initializer_list<Value> values) const
+{
+	if (values.size() != _placeholder_offsets.size())
+	{
+		OV_ASSERT(false, "The count of values (%zu) is not the same as the placeholders (%zu)", values.size(), _placeholder_offsets.size());
+		return nullptr;
+	}
+
+	size_t total_size = _payload.size();
+
+	for (const auto &value : values)
+	{
+		total_size += GetEncodedSize(value);
+	}
+
+	auto body = std::make_shared<std::vector<uint8_t>>(total_size);
+	auto current = body->data();
+	size_t payload_offset = 0;
+	auto offset = _placeholder_offsets.begin();
+
+	for (const auto &value : values)
+	{
+		auto fixed_size = *offset - payload_offset;
+		::memcpy(current, _payload.data() + payload_offset, fixed_size);
+		current += fixed_size;
+		payload_offset = *offset;
+
+		current = Encode(current, value);
+		++offset;
+	}
+
+	::memcpy(current, _payload.data() + payload_offset, _payload.size() - payload_offset);
+
+	return body;
+}
+
+void AmfPacketTemplate::Append(const void *data, size_t length)
+{
+	auto bytes = static_cast<const uint8_t *>(data);
+	_payload.insert(_payload.end(), bytes, bytes + length);
+}
+
+void AmfPacketTemplate::AppendString(const char *string)
+{
+	auto length = static_cast<uint16_t>(::strlen(string));
+
+	_payload.push_back(static_cast<uint8_t>(length >> 8));
+	_payload.push_back(static_cast<uint8_t>(length & 0xFF));
+	Append(string, length);
+}
+
+size_t AmfPacketTemplate::GetEncodedSize(const Value &value)
+{
+	// marker + number, or marker + length + string
+	return value.is_number ? (1 + 8) : (1 + 2 + ::strlen(value.string));
+}
+
+uint8_t *AmfPacketTemplate::Encode(uint8_t *buffer, const Value &value)
+{
+	if (value.is_number)
+	{
+		return buffer + AmfUtil::EncodeNumber(buffer, value.number);
+	}
+
+	auto length = static_cast<uint16_t>(::strlen(value.string));
+
+	*(buffer++) = static_cast<uint8_t>(AmfTypeMarker::String);
+	*(buffer++) = static_cast<uint8_t>(length >> 8);
+	*(buffer++) = static_cast<uint8_t>(length & 0xFF);
+	::memcpy(buffer, value.string, length);
+
+	return buffer + length;
+}
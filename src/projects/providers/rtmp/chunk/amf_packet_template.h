@@ -0,0 +1,78 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <initializer_list>
+#include <memory>
+#include <vector>
+
+#include "amf_document.h"
+
+// Precomputed AMF0 encoding of a message whose structure is fixed, such as _result/onStatus responses.
+//
+// The template is built once, and only the values declared by Placeholder() are encoded when a message is made.
+//
+// static const auto result = AmfPacketTemplate()
+// 	.String("_result")
+// 	.Placeholder()
+// 	.BeginObject()
+// 	.Key("code")
+// 	.String("NetConnection.Connect.Success")
+// 	.EndObject();
+//
+// auto body = result.Make({transaction_id});
+class AmfPacketTemplate
+{
+public:
+	// A value that fills a placeholder
+	struct Value
+	{
+		Value(double number)  // NOLINT
+			: is_number(true),
+			  number(number)
+		{
+		}
+
+		Value(const char *string)  // NOLINT
+			: string(string)
+		{
+		}
+
+		bool is_number = false;
+		double number = 0.0;
+		const char *string = nullptr;
+	};
+
+	AmfPacketTemplate &Null();
+	AmfPacketTemplate &Number(double number);
+	AmfPacketTemplate &String(const char *string);
+
+	AmfPacketTemplate &BeginObject();
+	AmfPacketTemplate &BeginEcmaArray();
+	// Ends an object/ECMA array
+	AmfPacketTemplate &EndObject();
+	// The name of the next property of an object/ECMA array
+	AmfPacketTemplate &Key(const char *name);
+
+	// A number/string that is given to Make() (in the order of the calls)
+	AmfPacketTemplate &Placeholder();
+
+	// Returns nullptr if the count of <values> is not the same as the count of the placeholders
+	std::shared_ptr<std::vector<uint8_t>> Make(std::initializer_list<Value> values) const;
+
+protected:
+	void Append(const void *data, size_t length);
+	void AppendString(const char *string);
+
+	static size_t GetEncodedSize(const Value &value);
+	static uint8_t *Encode(uint8_t *buffer, const Value &value);
+
+	std::vector<uint8_t> _payload;
+	// The offsets in _payload where the placeholders are inserted
+	std::vector<size_t> _placeholder_offsets;
+};
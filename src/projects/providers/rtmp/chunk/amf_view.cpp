@@ -0,0 +1,246 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "amf_view.h"
+
+#include <base/ovlibrary/ovlibrary.h>
+
+bool AmfView::Decode(const void *data, size_t length)
+{
+	_values.clear();
+	_properties.clear();
+
+	if (data == nullptr)
+	{
+		return false;
+	}
+
+	auto current = static_cast<const uint8_t *>(data);
+	auto remained = length;
+
+	while (remained > 0)
+	{
+		int32_t value_index = -1;
+		auto size = DecodeValue(current, remained, 0, {}, &value_index);
+
+		if (size == 0)
+		{
+			break;
+		}
+
+		_properties.push_back(value_index);
+
+		current += size;
+		remained -= size;
+	}
+
+	return _properties.empty() == false;
+}
+
+const AmfViewValue *AmfView::GetProperty(size_t index) const
+{
+	return (index < _properties.size()) ? &(_values[_properties[index]]) : nullptr;
+}
+
+const AmfViewValue *AmfView::GetProperty(size_t index, AmfDataType type) const
+{
+	auto property = GetProperty(index);
+
+	return ((property != nullptr) && (property->type == type)) ? property : nullptr;
+}
+
+const AmfViewValue *AmfView::FindProperty(const AmfViewValue *object, std::string_view name) const
+{
+	if ((object == nullptr) || ((object->type != AmfDataType::Object) && (object->type != AmfDataType::Array)))
+	{
+		return nullptr;
+	}
+
+	for (auto index = object->first_child; index >= 0; index = _values[index].next_sibling)
+	{
+		if (_values[index].name == name)
+		{
+			return &(_values[index]);
+		}
+	}
+
+	return nullptr;
+}
+
+const AmfViewValue *AmfView::FindProperty(const AmfViewValue *object, std::string_view name, AmfDataType type) const
+{
+	auto property = FindProperty(object, name);
+
+	return ((property != nullptr) && (property->type == type)) ? property : nullptr;
+}
+
+size_t AmfView::DecodeValue(const uint8_t *data, size_t length, int depth, std::string_view name, int32_t *value_index)
+{
+	if (length < 1)
+	{
+		return 0;
+	}
+
+	AmfViewValue value;
+	size_t size = 1;
+
+	value.name = name;
+
+	switch (static_cast<AmfTypeMarker>(data[0]))
+	{
+		case AmfTypeMarker::Null:
+			value.type = AmfDataType::Null;
+			break;
+
+		case AmfTypeMarker::Undefined:
+			value.type = AmfDataType::Undefined;
+			break;
+
+		case AmfTypeMarker::Number: {
+			if (length < (1 + 8))
+			{
+				return 0;
+			}
+
+			uint64_t bits;
+			::memcpy(&bits, data + 1, sizeof(bits));
+			bits = ov::BE64ToHost(bits);
+			::memcpy(&value.number, &bits, sizeof(bits));
+
+			value.type = AmfDataType::Number;
+			size = 1 + 8;
+			break;
+		}
+
+		case AmfTypeMarker::Boolean:
+			if (length < (1 + 1))
+			{
+				return 0;
+			}
+
+			value.type = AmfDataType::Boolean;
+			value.boolean = (data[1] != 0);
+			size = 1 + 1;
+			break;
+
+		case AmfTypeMarker::String: {
+			if (length < (1 + 2))
+			{
+				return 0;
+			}
+
+			size_t string_length = (data[1] << 8) | data[2];
+
+			if (length < (1 + 2 + string_length))
+			{
+				return 0;
+			}
+
+			value.type = AmfDataType::String;
+			value.string = std::string_view(reinterpret_cast<const char *>(data + 1 + 2), string_length);
+			size = 1 + 2 + string_length;
+			break;
+		}
+
+		case AmfTypeMarker::Object:
+		case AmfTypeMarker::EcmaArray: {
+			if (depth >= AMF_VIEW_MAX_DEPTH)
+			{
+				return 0;
+			}
+
+			bool is_object = (static_cast<AmfTypeMarker>(data[0]) == AmfTypeMarker::Object);
+			// EcmaArray has the count of the properties (which is not used)
+			size_t header_size = is_object ? 1 : (1 + 4);
+
+			if (length < header_size)
+			{
+				return 0;
+			}
+
+			value.type = is_object ? AmfDataType::Object : AmfDataType::Array;
+
+			// The object is added before the properties to be referenced by them
+			*value_index = static_cast<int32_t>(_values.size());
+			_values.push_back(value);
+
+			auto properties_size = DecodeProperties(data + header_size, length - header_size, depth + 1, *value_index);
+
+			return (properties_size == 0) ? 0 : (header_size + properties_size);
+		}
+
+		default:
+			return 0;
+	}
+
+	*value_index = static_cast<int32_t>(_values.size());
+	_values.push_back(value);
+
+	return size;
+}
+
+size_t AmfView::DecodeProperties(const uint8_t *data, size_t length, int depth, int32_t parent_index)
+{
+	size_t offset = 0;
+	int32_t last_index = -1;
+
+	while (offset < length)
+	{
+		// AmfDocument also accepts the end marker without the empty name
+		if (data[offset] == static_cast<uint8_t>(AmfTypeMarker::ObjectEnd))
+		{
+			return offset + 1;
+		}
+
+		if ((length - offset) < 2)
+		{
+			return 0;
+		}
+
+		size_t name_length = (data[offset] << 8) | data[offset + 1];
+		offset += 2;
+
+		if (name_length == 0)
+		{
+			// The end marker follows
+			continue;
+		}
+
+		if ((length - offset) < name_length)
+		{
+			return 0;
+		}
+
+		std::string_view name(reinterpret_cast<const char *>(data + offset), name_length);
+		offset += name_length;
+
+		int32_t value_index = -1;
+		auto size = DecodeValue(data + offset, length - offset, depth, name, &value_index);
+
+		if (size == 0)
+		{
+			return 0;
+		}
+
+		offset += size;
+
+		// _values may be reallocated while decoding, so it is accessed by the index
+		if (last_index < 0)
+		{
+			_values[parent_index].first_child = value_index;
+		}
+		else
+		{
+			_values[last_index].next_sibling = value_index;
+		}
+
+		last_index = value_index;
+	}
+
+	// The end marker is missing
+	return 0;
+}
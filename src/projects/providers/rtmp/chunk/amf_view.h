@@ -0,0 +1,69 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <string_view>
+#include <vector>
+
+#include "amf_document.h"
+
+// The max depth of nested objects/arrays that AmfView decodes
+#define AMF_VIEW_MAX_DEPTH 32
+
+struct AmfViewValue
+{
+	AmfDataType type = AmfDataType::Null;
+	double number = 0.0;
+	bool boolean = false;
+	// Refers to the payload
+	std::string_view string;
+
+	// The name of the property if the value is a property of an object/array (refers to the payload)
+	std::string_view name;
+	// Object/Array: The index of the first property (-1 if empty)
+	int32_t first_child = -1;
+	// The index of the next property of the same object/array (-1 if it is the last one)
+	int32_t next_sibling = -1;
+};
+
+// Decodes an AMF0 message into a flat list of values that refers to the payload, instead of a tree of
+// heap-allocated AmfProperty/AmfObject with copied strings.
+//
+// The values are stored in one vector that keeps its capacity across Decode() calls, so an instance that is
+// reused for every message decodes commands without allocation. The payload must be kept while the values are used.
+class AmfView
+{
+public:
+	// Returns false if nothing is decoded.
+	// Like AmfDocument::Decode(), the values before the first value that cannot be decoded are kept.
+	bool Decode(const void *data, size_t length);
+
+	size_t GetPropertyCount() const
+	{
+		return _properties.size();
+	}
+
+	// Returns nullptr if <index> is out of range
+	const AmfViewValue *GetProperty(size_t index) const;
+	// Returns the top-level property only if the type is matched
+	const AmfViewValue *GetProperty(size_t index, AmfDataType type) const;
+
+	// Returns nullptr if <object> is not an object/array, or it does not have <name>
+	const AmfViewValue *FindProperty(const AmfViewValue *object, std::string_view name) const;
+	// Returns the property only if the type is matched
+	const AmfViewValue *FindProperty(const AmfViewValue *object, std::string_view name, AmfDataType type) const;
+
+protected:
+	// Returns the number of bytes decoded (0 if failed)
+	size_t DecodeValue(const uint8_t *data, size_t length, int depth, std::string_view name, int32_t *value_index);
+	size_t DecodeProperties(const uint8_t *data, size_t length, int depth, int32_t parent_index);
+
+	std::vector<AmfViewValue> _values;
+	// Indices of the top-level values
+	std::vector<int32_t> _properties;
+};
@@ -176,6 +176,8 @@ enum class RtmpCodecType : int32_t
 {
     Unknown,
     H264,    //	H264/X264 avc1(7)
+    H265,    //	H265 hvc1 (Enhanced RTMP FourCC)
+    AV1,    //	AV1 av01 (Enhanced RTMP FourCC)
     AAC,    //	AAC          mp4a(10)
     MP3,  //	MP3(2)
     SPEEX,//	SPEEX(11)
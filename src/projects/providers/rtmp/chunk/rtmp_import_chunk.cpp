@@ -77,6 +77,10 @@ int RtmpImportChunk::Import(const std::shared_ptr<const ov::Data> &data, bool *i
 			return -1LL;
 		}
 
+		// The chunk payloads are accumulated directly into a buffer of the message length
+		_payload = std::make_shared<ov::Data>(chunk_header->payload_size);
+		_remained_chunk_size = std::min(_chunk_size, static_cast<size_t>(chunk_header->payload_size));
+
 		_chunk_map[chunk_header->basic_header.stream_id] = chunk_header;
 		last_chunk_header = std::move(chunk_header);
 	}
@@ -103,21 +107,22 @@ int RtmpImportChunk::Import(const std::shared_ptr<const ov::Data> &data, bool *i
 		last_chunk_header = item->second;
 	}
 
-	if (stream.IsRemained(last_chunk_header->expected_payload_size) == false)
-	{
-		// Need more data
-		OV_ASSERT2(parsed_bytes >= 0);
+	auto payload_bytes = ImportPayload(last_chunk_header, data, stream);
 
-		return parsed_bytes;
+	if (payload_bytes < 0LL)
+	{
+		return -1LL;
 	}
 
-	auto message = FinalizeMessage(last_chunk_header, stream);
-
-	if (message == nullptr)
+	if (_payload->GetLength() < last_chunk_header->payload_size)
 	{
-		return -1LL;
+		// Need more data (the payload received so far is kept in _payload)
+		return parsed_bytes + payload_bytes;
 	}
 
+	auto message = std::make_shared<RtmpMessage>(last_chunk_header, std::move(_payload));
+	_payload = nullptr;
+
 	logtd("Finalized message: %s", message->header->ToString().CStr());
 
 	_message_queue.Enqueue(message);
@@ -125,7 +130,7 @@ int RtmpImportChunk::Import(const std::shared_ptr<const ov::Data> &data, bool *i
 	*is_completed = true;
 	_parser.Reset();
 
-	return parsed_bytes + last_chunk_header->expected_payload_size;
+	return parsed_bytes + payload_bytes;
 }
 
 int64_t RtmpImportChunk::CalculateRolledTimestamp(int64_t last_timestamp, int64_t parsed_timestamp)
@@ -335,75 +340,65 @@ bool RtmpImportChunk::CalculateForType3Header(const std::shared_ptr<RtmpChunkHea
 	return (type_3_count >= 0);
 }
 
-std::shared_ptr<const RtmpMessage> RtmpImportChunk::FinalizeMessage(const std::shared_ptr<const RtmpChunkHeader> &chunk_header, ov::ByteStream &stream)
+off_t RtmpImportChunk::ImportPayload(const std::shared_ptr<const RtmpChunkHeader> &chunk_header, const std::shared_ptr<const ov::Data> &data, ov::ByteStream &stream)
 {
-	// We need to exclude the type 3 headers
-	int index = 0;
+	if (_payload == nullptr)
+	{
+		OV_ASSERT2(false);
+		return -1LL;
+	}
+
+	// The type 3 headers in the middle of the message are excluded
 	int basic_header_size = chunk_header->basic_header_size;
-	size_t payload_size = chunk_header->expected_payload_size;
 	const auto *expected_type_3_header = &(chunk_header->expected_type_3_header);
-	auto payload_data = std::make_shared<ov::Data>(chunk_header->payload_size);
-	const uint8_t *current = stream.GetRemainData()->GetDataAs<uint8_t>();
-	int extended_header_size = 0;
+	int type_3_header_size = basic_header_size + (chunk_header->is_extended ? sizeof(RtmpChunkHeader::extended_timestamp) : 0);
+	off_t start_offset = stream.GetOffset();
 
-	if (chunk_header->is_extended)
+	while (_payload->GetLength() < chunk_header->payload_size)
 	{
-		extended_header_size = sizeof(RtmpChunkHeader::extended_timestamp);
-	}
+		const uint8_t *current = data->GetDataAs<uint8_t>() + stream.GetOffset();
 
-	while (payload_size > 0)
-	{
-		if (index > 0)
+		if (_remained_chunk_size == 0)
 		{
-			if (payload_size < static_cast<size_t>(basic_header_size + extended_header_size))
+			if (stream.IsRemained(type_3_header_size) == false)
 			{
-				logte("Not enough data: %zu bytes, expected: %zu bytes", payload_size, basic_header_size + extended_header_size);
-				return nullptr;
+				// Need more data
+				break;
 			}
 
 			// Make sure that the message type of payload is type 3 and matches what was expected
 			if (::memcmp(current, expected_type_3_header, basic_header_size) != 0)
 			{
-				logte("Invalid message is received: offset: %lld\nexpected:\n%s\nbut:\n%s",
-					  (chunk_header->expected_payload_size - payload_size),
+				logte("Invalid message is received: offset: %zu\nexpected:\n%s\nbut:\n%s",
+					  _payload->GetLength(),
 					  ov::Dump(expected_type_3_header, basic_header_size).CStr(),
 					  ov::Dump(current, basic_header_size).CStr());
 
-				return nullptr;
+				return -1LL;
 			}
 
 			// skip type 3 header
-			current += basic_header_size + extended_header_size;
-			payload_size -= basic_header_size + extended_header_size;
+			stream.Skip(type_3_header_size);
+			current += type_3_header_size;
+
+			_remained_chunk_size = std::min(_chunk_size, chunk_header->payload_size - _payload->GetLength());
 		}
 
-		size_t read_size = std::min(_chunk_size, payload_size);
+		size_t read_size = std::min(_remained_chunk_size, stream.Remained());
 
-		if (payload_size < read_size)
+		if (read_size == 0)
 		{
-			logte("Not enough data: %zu bytes, expected: %zu bytes", payload_size, read_size);
-			return nullptr;
+			// Need more data
+			break;
 		}
 
-		payload_data->Append(current, read_size);
-
-		index++;
+		_payload->Append(current, read_size);
+		stream.Skip(read_size);
 
-		current += read_size;
-		payload_size -= read_size;
+		_remained_chunk_size -= read_size;
 	}
 
-	if (payload_data->GetLength() != chunk_header->payload_size)
-	{
-		OV_ASSERT(
-			payload_data->GetLength() != chunk_header->payload_size,
-			"Payload length: %zu, Expected: %zu", payload_data->GetLength(), chunk_header->payload_size);
-		return nullptr;
-	}
-
-	auto message = std::make_shared<RtmpMessage>(chunk_header, std::move(payload_data));
-
-	return message;
+	return stream.GetOffset() - start_offset;
 }
 
 std::shared_ptr<const RtmpMessage> RtmpImportChunk::GetMessage()
@@ -445,6 +440,7 @@ void RtmpImportChunk::SetStreamName(const ov::String &stream_name)
 void RtmpImportChunk::Destroy()
 {
 	_chunk_map.clear();
+	_payload = nullptr;
 
 	_message_queue.Stop();
 	_message_queue.Clear();
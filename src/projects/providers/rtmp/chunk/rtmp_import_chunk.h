@@ -45,7 +45,8 @@ private:
 
 	bool ProcessChunkHeader(const std::shared_ptr<RtmpChunkHeader> &chunk_header, const std::shared_ptr<const RtmpChunkHeader> &last_chunk_header);
 	bool CalculateForType3Header(const std::shared_ptr<RtmpChunkHeader> &chunk_header);
-	std::shared_ptr<const RtmpMessage> FinalizeMessage(const std::shared_ptr<const RtmpChunkHeader> &chunk_header, ov::ByteStream &stream);
+	// Appends the chunk payloads in the stream to _payload, and returns the number of bytes used (-1 on error)
+	off_t ImportPayload(const std::shared_ptr<const RtmpChunkHeader> &chunk_header, const std::shared_ptr<const ov::Data> &data, ov::ByteStream &stream);
 
 	std::map<uint32_t, std::shared_ptr<const RtmpChunkHeader>> _chunk_map;
 	ov::Queue<std::shared_ptr<const RtmpMessage>> _message_queue { nullptr, 500 };
@@ -53,6 +54,11 @@ private:
 
 	RtmpChunkParser _parser;
 
+	// The payload of the message being reassembled
+	std::shared_ptr<ov::Data> _payload;
+	// Number of payload bytes remaining until the next type 3 header
+	size_t _remained_chunk_size = 0;
+
 	info::VHostAppName _vhost_app_name;
 	ov::String _stream_name;
 };
@@ -0,0 +1,170 @@
+//==============================================================================
+//
+//  RtmpProvider
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "rtmp_ingest_worker_pool.h"
+
+#include "rtmp_provider_private.h"
+#include "rtmp_stream.h"
+
+namespace pvd
+{
+	bool RtmpIngestWorkerPool::Worker::Start(size_t index)
+	{
+		_stop_thread_flag = false;
+
+		try
+		{
+			_thread = std::thread(&Worker::WorkerThread, this);
+		}
+		catch (const std::system_error &e)
+		{
+			_stop_thread_flag = true;
+			logte("Could not start RTMP ingest worker #%zu: %s", index, e.what());
+			return false;
+		}
+
+		auto name = ov::String::FormatString("RtmpIngest%zu", index);
+		::pthread_setname_np(_thread.native_handle(), name.CStr());
+
+		return true;
+	}
+
+	void RtmpIngestWorkerPool::Worker::Stop()
+	{
+		if (_stop_thread_flag.exchange(true))
+		{
+			return;
+		}
+
+		_event.Notify();
+
+		if (_thread.joinable())
+		{
+			_thread.join();
+		}
+
+		std::lock_guard lock_guard(_mutex);
+		_stream_queue.clear();
+	}
+
+	void RtmpIngestWorkerPool::Worker::Schedule(const std::shared_ptr<RtmpStream> &stream)
+	{
+		{
+			std::lock_guard lock_guard(_mutex);
+			_stream_queue.push_back(stream);
+		}
+
+		_event.Notify();
+	}
+
+	void RtmpIngestWorkerPool::Worker::WorkerThread()
+	{
+		ov::ThreadRegistry::Registration registration("RtmpIngestWorker");
+
+		while (_stop_thread_flag == false)
+		{
+			_event.Wait();
+
+			std::shared_ptr<RtmpStream> stream;
+
+			{
+				std::lock_guard lock_guard(_mutex);
+
+				if (_stream_queue.empty())
+				{
+					continue;
+				}
+
+				stream = std::move(_stream_queue.front());
+				_stream_queue.pop_front();
+			}
+
+			if (stream->ProcessReceivedData())
+			{
+				// More data was received while processing, so process it after the other streams
+				Schedule(stream);
+			}
+		}
+	}
+
+	RtmpIngestWorkerPool::~RtmpIngestWorkerPool()
+	{
+		Stop();
+	}
+
+	bool RtmpIngestWorkerPool::Start(size_t worker_count)
+	{
+		std::lock_guard lock_guard(_mutex);
+
+		// The workers are not recreated, so Schedule() can access _worker_list without locking
+		if (_worker_list.empty() == false)
+		{
+			logte("RTMP ingest worker pool is already started");
+			return false;
+		}
+
+		worker_count = std::max<size_t>(worker_count, 1);
+
+		for (size_t index = 0; index < worker_count; index++)
+		{
+			auto worker = std::make_shared<Worker>();
+
+			if (worker->Start(index) == false)
+			{
+				for (auto &started_worker : _worker_list)
+				{
+					started_worker->Stop();
+				}
+
+				_worker_list.clear();
+				return false;
+			}
+
+			_worker_list.push_back(worker);
+		}
+
+		_is_running = true;
+
+		logti("RTMP ingest worker pool is started with %zu workers", worker_count);
+
+		return true;
+	}
+
+	bool RtmpIngestWorkerPool::Stop()
+	{
+		std::lock_guard lock_guard(_mutex);
+
+		if (_is_running.exchange(false) == false)
+		{
+			return true;
+		}
+
+		for (auto &worker : _worker_list)
+		{
+			worker->Stop();
+		}
+
+		return true;
+	}
+
+	size_t RtmpIngestWorkerPool::GetNextWorkerIndex()
+	{
+		return _next_worker_index++;
+	}
+
+	bool RtmpIngestWorkerPool::Schedule(size_t worker_index, const std::shared_ptr<RtmpStream> &stream)
+	{
+		if ((_is_running == false) || (stream == nullptr))
+		{
+			return false;
+		}
+
+		_worker_list[worker_index % _worker_list.size()]->Schedule(stream);
+
+		return true;
+	}
+}  // namespace pvd
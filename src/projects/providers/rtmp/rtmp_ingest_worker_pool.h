@@ -0,0 +1,71 @@
+//==============================================================================
+//
+//  RtmpProvider
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/ovlibrary/ovlibrary.h>
+
+#include <atomic>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+namespace pvd
+{
+	class RtmpStream;
+
+	// Parses the data received by RtmpProvider on dedicated threads instead of the socket worker
+	//
+	// A stream is always processed by the same worker, so the data of a connection is parsed in the order
+	// it was received, and a slow stream only delays the streams that share its worker.
+	class RtmpIngestWorkerPool
+	{
+	public:
+		~RtmpIngestWorkerPool();
+
+		bool Start(size_t worker_count);
+		bool Stop();
+
+		bool IsRunning() const
+		{
+			return _is_running;
+		}
+
+		// Returns the index of the worker that will process a new stream (round robin)
+		size_t GetNextWorkerIndex();
+
+		// Returns false if the pool is not running
+		bool Schedule(size_t worker_index, const std::shared_ptr<RtmpStream> &stream);
+
+	protected:
+		class Worker
+		{
+		public:
+			bool Start(size_t index);
+			void Stop();
+
+			void Schedule(const std::shared_ptr<RtmpStream> &stream);
+
+		protected:
+			void WorkerThread();
+
+			std::atomic<bool> _stop_thread_flag{true};
+			std::thread _thread;
+
+			ov::Semaphore _event;
+
+			std::mutex _mutex;
+			std::deque<std::shared_ptr<RtmpStream>> _stream_queue;
+		};
+
+		std::atomic<bool> _is_running{false};
+
+		std::mutex _mutex;
+		std::vector<std::shared_ptr<Worker>> _worker_list;
+		std::atomic<size_t> _next_worker_index{0};
+	};
+}  // namespace pvd
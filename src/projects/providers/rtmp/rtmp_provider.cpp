@@ -139,6 +139,13 @@ namespace pvd
 			  GetProviderName(),
 			  ov::String::Join(rtmp_address_string_list, ", ").CStr());
 
+		auto &ingest_worker_config = server.GetModules().GetRtmpIngestWorker();
+		if (ingest_worker_config.IsEnabled())
+		{
+			_ingest_max_buffer_size = std::max(ingest_worker_config.GetMaxBufferSize(), 0);
+			_ingest_worker_pool.Start(std::max(ingest_worker_config.GetWorkerCount(), 1));
+		}
+
 		return Provider::Start();
 	}
 
@@ -153,6 +160,8 @@ namespace pvd
 		}
 		_physical_port_list.clear();
 
+		_ingest_worker_pool.Stop();
+
 		return Provider::Stop();
 	}
 
@@ -186,6 +195,11 @@ namespace pvd
 		auto channel_id = remote->GetNativeHandle();
 		auto stream = RtmpStream::Create(StreamSourceType::Rtmp, channel_id, remote, GetSharedPtrAs<pvd::PushProvider>());
 
+		if (_ingest_worker_pool.IsRunning())
+		{
+			stream->SetIngestWorkerIndex(_ingest_worker_pool.GetNextWorkerIndex());
+		}
+
 		logti("A RTMP client has connected from %s", remote->ToString().CStr());
 
 		PushProvider::OnChannelCreated(channel_id, stream);
@@ -199,6 +213,29 @@ namespace pvd
 		DumpDataToFile(remote, address, data);
 #endif	// DEBUG
 
+		if (_ingest_worker_pool.IsRunning())
+		{
+			auto stream = std::static_pointer_cast<RtmpStream>(GetChannel(remote->GetNativeHandle()));
+
+			if (stream == nullptr)
+			{
+				return;
+			}
+
+			if (stream->EnqueueReceivedData(data, _ingest_max_buffer_size))
+			{
+				if (_ingest_worker_pool.Schedule(stream->GetIngestWorkerIndex(), stream) == false)
+				{
+					// The pool is stopped, so process it here
+					while (stream->ProcessReceivedData())
+					{
+					}
+				}
+			}
+
+			return;
+		}
+
 		PushProvider::OnDataReceived(remote->GetNativeHandle(), data);
 	}
 
@@ -19,6 +19,7 @@
 #include <orchestrator/orchestrator.h>
 
 #include "base/provider/push_provider/provider.h"
+#include "rtmp_ingest_worker_pool.h"
 
 namespace pvd
 {
@@ -75,5 +76,9 @@ namespace pvd
 
 	private:
 		std::vector<std::shared_ptr<PhysicalPort>> _physical_port_list;
+
+		// If the RtmpIngestWorker module is enabled, the received data is parsed by this pool instead of the socket worker
+		RtmpIngestWorkerPool _ingest_worker_pool;
+		size_t _ingest_max_buffer_size = 0;
 	};
 }
\ No newline at end of file
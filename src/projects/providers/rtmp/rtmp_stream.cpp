@@ -11,8 +11,11 @@
 
 #include <base/info/media_extradata.h>
 #include <base/mediarouter/media_type.h>
+#include <base/ovlibrary/byte_io.h>
 #include <modules/bitstream/aac/aac_specific_config.h>
+#include <modules/bitstream/av1/av1_codec_configuration_record.h>
 #include <modules/bitstream/h264/h264_decoder_configuration_record.h>
+#include <modules/bitstream/h265/h265_decoder_configuration_record.h>
 #include <modules/containers/flv/flv_parser.h>
 #include <orchestrator/orchestrator.h>
 
@@ -108,6 +111,8 @@ namespace pvd
 
 		// For debug statistics
 		_stream_check_time = time(nullptr);
+
+		CreateIngestCapture(mdl::IngestCapture::Format::Flv);
 	}
 
 	RtmpStream::~RtmpStream()
@@ -233,31 +238,96 @@ namespace pvd
 		return true;
 	}
 
-	void RtmpStream::OnAmfConnect(const std::shared_ptr<const RtmpChunkHeader> &header, AmfDocument &document, double transaction_id)
+	bool RtmpStream::EnqueueReceivedData(const std::shared_ptr<const ov::Data> &data, size_t max_buffer_size)
+	{
+		std::lock_guard lock_guard(_received_data_queue_mutex);
+
+		_received_data_queue.push_back(data);
+		_received_data_queue_size += data->GetLength();
+		_max_received_data_queue_size = max_buffer_size;
+
+		if ((_received_data_queue_size >= max_buffer_size) && (_remote->IsReadPaused() == false))
+		{
+			// Stop reading from the socket, so the peer is throttled by the TCP receive window instead of buffering more
+			logtd("Pause reading from %s (%zu bytes are queued)", _remote->ToString().CStr(), _received_data_queue_size);
+			_remote->PauseRead();
+		}
+
+		if (_is_ingest_scheduled)
+		{
+			return false;
+		}
+
+		_is_ingest_scheduled = true;
+		return true;
+	}
+
+	bool RtmpStream::ProcessReceivedData()
+	{
+		std::deque<std::shared_ptr<const ov::Data>> data_list;
+
+		{
+			std::lock_guard lock_guard(_received_data_queue_mutex);
+			std::swap(data_list, _received_data_queue);
+		}
+
+		size_t processed_size = 0;
+
+		for (const auto &data : data_list)
+		{
+			if (OnDataReceived(data))
+			{
+				UpdateLastReceivedTime();
+			}
+
+			processed_size += data->GetLength();
+		}
+
+		std::lock_guard lock_guard(_received_data_queue_mutex);
+
+		_received_data_queue_size -= processed_size;
+
+		// PauseRead()/ResumeRead() are called with the lock, so they are not reordered
+		if (_remote->IsReadPaused() && (_received_data_queue_size <= (_max_received_data_queue_size / 2)))
+		{
+			logtd("Resume reading from %s (%zu bytes are queued)", _remote->ToString().CStr(), _received_data_queue_size);
+			_remote->ResumeRead();
+		}
+
+		if (_received_data_queue.empty())
+		{
+			_is_ingest_scheduled = false;
+			return false;
+		}
+
+		return true;
+	}
+
+	void RtmpStream::OnAmfConnect(const std::shared_ptr<const RtmpChunkHeader> &header, const AmfView &document, double transaction_id)
 	{
 		double object_encoding = 0.0;
 
-		if (document.GetProperty(2) != nullptr && document.GetProperty(2)->GetType() == AmfDataType::Object)
+		auto object = document.GetProperty(2, AmfDataType::Object);
+		if (object != nullptr)
 		{
-			AmfObject *object = document.GetProperty(2)->GetObject();
-			int32_t index;
+			const AmfViewValue *property;
 
 			// object encoding
-			if ((index = object->FindName("objectEncoding")) >= 0 && object->GetType(index) == AmfDataType::Number)
+			if ((property = document.FindProperty(object, "objectEncoding", AmfDataType::Number)) != nullptr)
 			{
-				object_encoding = object->GetNumber(index);
+				object_encoding = property->number;
 			}
 
 			// app name set
-			if ((index = object->FindName("app")) >= 0 && object->GetType(index) == AmfDataType::String)
+			if ((property = document.FindProperty(object, "app", AmfDataType::String)) != nullptr)
 			{
-				_app_name = object->GetString(index);
+				_app_name = ov::String(property->string.data(), property->string.length());
 			}
 
 			// app url set
-			if ((index = object->FindName("tcUrl")) >= 0 && object->GetType(index) == AmfDataType::String)
+			if ((property = document.FindProperty(object, "tcUrl", AmfDataType::String)) != nullptr)
 			{
-				_tc_url = object->GetString(index);
+				_tc_url = ov::String(property->string.data(), property->string.length());
 			}
 		}
 
@@ -319,7 +389,7 @@ namespace pvd
 		}
 	}
 
-	void RtmpStream::OnAmfCreateStream(const std::shared_ptr<const RtmpChunkHeader> &header, AmfDocument &document, double transaction_id)
+	void RtmpStream::OnAmfCreateStream(const std::shared_ptr<const RtmpChunkHeader> &header, const AmfView &document, double transaction_id)
 	{
 		if (!SendAmfCreateStreamResult(header->basic_header.stream_id, transaction_id))
 		{
@@ -431,10 +501,11 @@ namespace pvd
 		return true;
 	}
 
-	void RtmpStream::OnAmfFCPublish(const std::shared_ptr<const RtmpChunkHeader> &header, AmfDocument &document, double transaction_id)
+	void RtmpStream::OnAmfFCPublish(const std::shared_ptr<const RtmpChunkHeader> &header, const AmfView &document, double transaction_id)
 	{
-		if (_stream_name.IsEmpty() && document.GetProperty(3) != nullptr &&
-			document.GetProperty(3)->GetType() == AmfDataType::String)
+		auto stream_name = document.GetProperty(3, AmfDataType::String);
+
+		if (_stream_name.IsEmpty() && (stream_name != nullptr))
 		{
 			// TODO: check if the chunk stream id is already exist, and generates new rtmp_stream_id and client_id.
 			if (!SendAmfOnFCPublish(header->basic_header.stream_id, _rtmp_stream_id, _client_id))
@@ -443,7 +514,7 @@ namespace pvd
 				return;
 			}
 
-			_full_url.Format("%s/%s", _tc_url.CStr(), document.GetProperty(3)->GetString());
+			_full_url.Format("%s/%.*s", _tc_url.CStr(), static_cast<int>(stream_name->string.length()), stream_name->string.data());
 			SetFullUrl(_full_url);
 			CheckAccessControl();
 
@@ -455,13 +526,15 @@ namespace pvd
 		}
 	}
 
-	void RtmpStream::OnAmfPublish(const std::shared_ptr<const RtmpChunkHeader> &header, AmfDocument &document, double transaction_id)
+	void RtmpStream::OnAmfPublish(const std::shared_ptr<const RtmpChunkHeader> &header, const AmfView &document, double transaction_id)
 	{
 		if (_stream_name.IsEmpty())
 		{
-			if (document.GetProperty(3) != nullptr && document.GetProperty(3)->GetType() == AmfDataType::String)
+			auto stream_name = document.GetProperty(3, AmfDataType::String);
+
+			if (stream_name != nullptr)
 			{
-				_full_url.Format("%s/%s", _tc_url.CStr(), document.GetProperty(3)->GetString());
+				_full_url.Format("%s/%.*s", _tc_url.CStr(), static_cast<int>(stream_name->string.length()), stream_name->string.data());
 				SetFullUrl(_full_url);
 				CheckAccessControl();
 
@@ -478,9 +551,9 @@ namespace pvd
 				//Reject
 				SendAmfOnStatus(header->basic_header.stream_id,
 								_rtmp_stream_id,
-								(char *)"error",
-								(char *)"NetStream.Publish.Rejected",
-								(char *)"Authentication Failed.", _client_id);
+								"error",
+								"NetStream.Publish.Rejected",
+								"Authentication Failed.", _client_id);
 
 				return;
 			}
@@ -498,9 +571,9 @@ namespace pvd
 		// 시작 상태 값 전송
 		if (!SendAmfOnStatus((uint32_t)_chunk_stream_id,
 							 _rtmp_stream_id,
-							 (char *)"status",
-							 (char *)"NetStream.Publish.Start",
-							 (char *)"Publishing",
+							 "status",
+							 "NetStream.Publish.Start",
+							 "Publishing",
 							 _client_id))
 		{
 			logte("SendAmfOnStatus Fail");
@@ -611,6 +684,23 @@ namespace pvd
 			{
 				video_codec_type = RtmpCodecType::H264;
 			}
+			// Enhanced RTMP - FourCC as a string or as a number
+			else if (object->GetType(index) == AmfDataType::String && strcmp("hvc1", object->GetString(index)) == 0)
+			{
+				video_codec_type = RtmpCodecType::H265;
+			}
+			else if (object->GetType(index) == AmfDataType::Number && object->GetNumber(index) == static_cast<double>(FlvVideoFourCc::HEVC))
+			{
+				video_codec_type = RtmpCodecType::H265;
+			}
+			else if (object->GetType(index) == AmfDataType::String && strcmp("av01", object->GetString(index)) == 0)
+			{
+				video_codec_type = RtmpCodecType::AV1;
+			}
+			else if (object->GetType(index) == AmfDataType::Number && object->GetNumber(index) == static_cast<double>(FlvVideoFourCc::AV1))
+			{
+				video_codec_type = RtmpCodecType::AV1;
+			}
 		}
 
 		// Video Framerate
@@ -723,7 +813,7 @@ namespace pvd
 			audio_samplesize = object->GetNumber(index);
 		}  // Audio Sample Size
 
-		if ((video_Available == true && video_codec_type != RtmpCodecType::H264) || 
+		if ((video_Available == true && video_codec_type != RtmpCodecType::H264 && video_codec_type != RtmpCodecType::H265 && video_codec_type != RtmpCodecType::AV1) || 
 			(audio_Available == true &&  audio_codec_type != RtmpCodecType::AAC))
 		{
 			logtw("AmfMeta has incompatible codec information. - stream(%s/%s) id(%u/%u) video(%s) audio(%s)",
@@ -750,7 +840,7 @@ namespace pvd
 		return true;
 	}
 
-	void RtmpStream::OnAmfDeleteStream(const std::shared_ptr<const RtmpChunkHeader> &header, AmfDocument &document, double transaction_id)
+	void RtmpStream::OnAmfDeleteStream(const std::shared_ptr<const RtmpChunkHeader> &header, const AmfView &document, double transaction_id)
 	{
 		logtd("Delete Stream - stream(%s/%s) id(%u/%u)", _vhost_app_name.CStr(), _stream_name.CStr(), _app_id, GetId());
 
@@ -929,6 +1019,12 @@ namespace pvd
 
 			bool result = true;
 
+			if (GetIngestCapture() != nullptr)
+			{
+				// Before the payload is converted in place
+				CaptureMessage(message);
+			}
+
 			switch (message->header->completed.type_id)
 			{
 				case RTMP_MSGID_AUDIO_MESSAGE:
@@ -966,6 +1062,82 @@ namespace pvd
 		return true;
 	}
 
+	// Returns the length of the AMF0 string at <offset> including the marker/length, or 0 if it is not a string
+	static size_t ReadAmfString(const ov::Data &data, size_t offset, std::string_view &value)
+	{
+		auto buffer = data.GetDataAs<uint8_t>();
+		auto length = data.GetLength();
+
+		if (((offset + 3) > length) || (buffer[offset] != static_cast<uint8_t>(AmfTypeMarker::String)))
+		{
+			return 0;
+		}
+
+		size_t string_length = ByteReader<uint16_t>::ReadBigEndian(buffer + offset + 1);
+		if ((offset + 3 + string_length) > length)
+		{
+			return 0;
+		}
+
+		value = std::string_view(reinterpret_cast<const char *>(buffer + offset + 3), string_length);
+		return 3 + string_length;
+	}
+
+	void RtmpStream::CaptureMessage(const std::shared_ptr<const RtmpMessage> &message)
+	{
+		const auto &header = message->header->completed;
+		std::shared_ptr<const ov::Data> payload = message->payload;
+		auto data = payload->GetDataAs<uint8_t>();
+		auto length = payload->GetLength();
+
+		if (length < 2)
+		{
+			return;
+		}
+
+		mdl::IngestCapture::FlvTagType type;
+		bool sticky = false;
+
+		switch (header.type_id)
+		{
+			case RTMP_MSGID_AUDIO_MESSAGE:
+				type = mdl::IngestCapture::FlvTagType::Audio;
+				// AAC sequence header, or SequenceStart of Enhanced RTMP (ExHeader)
+				sticky = (((data[0] >> 4) == 10) && (data[1] == 0)) ||
+						 (((data[0] >> 4) == 9) && ((data[0] & 0x0F) == 0));
+				break;
+
+			case RTMP_MSGID_VIDEO_MESSAGE:
+				type = mdl::IngestCapture::FlvTagType::Video;
+				// AVC/HEVC sequence header, or SequenceStart of Enhanced RTMP (IsExHeader)
+				sticky = OV_CHECK_FLAG(data[0], 0x80)
+							 ? ((data[0] & 0x0F) == 0)
+							 : ((((data[0] & 0x0F) == 7) || ((data[0] & 0x0F) == 12)) && (data[1] == 0));
+				break;
+
+			case RTMP_MSGID_AMF0_DATA_MESSAGE: {
+				type = mdl::IngestCapture::FlvTagType::ScriptData;
+
+				// "@setDataFrame" is a command to the server, and the file has the data that follows it
+				std::string_view name;
+				auto name_length = ReadAmfString(*payload, 0, name);
+				if ((name_length > 0) && (name == RTMP_CMD_DATA_SETDATAFRAME))
+				{
+					payload = payload->Subdata(name_length);
+					name_length = ReadAmfString(*payload, 0, name);
+				}
+
+				sticky = (name_length > 0) && (name == RTMP_CMD_DATA_ONMETADATA);
+				break;
+			}
+
+			default:
+				return;
+		}
+
+		GetIngestCapture()->AppendFlvTag(type, header.timestamp, payload, sticky);
+	}
+
 	bool RtmpStream::ReceiveSetChunkSize(const std::shared_ptr<const RtmpMessage> &message)
 	{
 		auto chunk_size = RtmpMuxUtil::ReadInt32(message->payload->GetData());
@@ -1060,31 +1232,34 @@ namespace pvd
 
 	void RtmpStream::ReceiveAmfCommandMessage(const std::shared_ptr<const RtmpMessage> &message)
 	{
-		AmfDocument document;
-		ov::String message_name;
+		auto &document = _amf_command_view;
+		std::string_view message_name;
 		double transaction_id = 0.0;
 
 		OV_ASSERT2(message->header != nullptr);
 		OV_ASSERT2(message->payload != nullptr);
 
-		if (document.Decode(message->payload->GetData(), message->header->payload_size) == 0)
+		// The names/strings in the document refer to the payload, so they are valid only in this function
+		if (document.Decode(message->payload->GetData(), std::min<size_t>(message->header->payload_size, message->payload->GetLength())) == false)
 		{
 			logte("AmfDocument Size 0 ");
 			return;
 		}
 
 		// Message Name
-		if (document.GetProperty(0) == nullptr || document.GetProperty(0)->GetType() != AmfDataType::String)
+		auto name_property = document.GetProperty(0, AmfDataType::String);
+		if (name_property == nullptr)
 		{
 			logte("Message Name Fail");
 			return;
 		}
-		message_name = document.GetProperty(0)->GetString();
+		message_name = name_property->string;
 
 		// Message Transaction ID 얻기
-		if (document.GetProperty(1) != nullptr && document.GetProperty(1)->GetType() == AmfDataType::Number)
+		auto transaction_id_property = document.GetProperty(1, AmfDataType::Number);
+		if (transaction_id_property != nullptr)
 		{
-			transaction_id = document.GetProperty(1)->GetNumber();
+			transaction_id = transaction_id_property->number;
 		}
 
 		// 처리
@@ -1117,7 +1292,7 @@ namespace pvd
 		}
 		else
 		{
-			logtd("Unknown Amf0CommandMessage - Message(%s:%.1f)", message_name.CStr(), transaction_id);
+			logtd("Unknown Amf0CommandMessage - Message(%.*s:%.1f)", static_cast<int>(message_name.length()), message_name.data(), transaction_id);
 			return;
 		}
 	}
@@ -1398,6 +1573,23 @@ namespace pvd
 		{
 			_media_info->video_stream_coming = true;
 
+			// Enhanced RTMP signals the codec with the FourCC of every video tag, so it doesn't depend on the metadata
+			if ((payload->GetLength() > 0) && OV_CHECK_FLAG(payload->GetDataAs<uint8_t>()[0], 0x80))
+			{
+				FlvVideoData flv_video;
+				if (FlvVideoData::Parse(payload->GetDataAs<uint8_t>(), payload->GetLength(), flv_video))
+				{
+					if (flv_video.CodecId() == FlvVideoCodecId::HEVC)
+					{
+						_media_info->video_codec_type = RtmpCodecType::H265;
+					}
+					else if (flv_video.CodecId() == FlvVideoCodecId::AV1)
+					{
+						_media_info->video_codec_type = RtmpCodecType::AV1;
+					}
+				}
+			}
+
 			if (CheckReadyToPublish() == true)
 			{
 				if (PublishStream() == false)
@@ -1435,6 +1627,13 @@ namespace pvd
 				return false;
 			}
 
+			if (flv_video.IsExHeader() &&
+				(flv_video.ExPacketType() == FlvVideoExPacketType::METADATA || flv_video.ExPacketType() == FlvVideoExPacketType::MPEG2TS_SEQUENCE_START))
+			{
+				// Nothing to do
+				return true;
+			}
+
 			if (flv_video.CompositionTime() < 0L)
 			{
 				if (_negative_cts_detected == false)
@@ -1469,13 +1668,40 @@ namespace pvd
 			{
 				packet_type = cmn::PacketType::SEQUENCE_HEADER;
 
-				// AVCDecoderConfigurationRecord Unit Test
-				AVCDecoderConfigurationRecord record;
-				AVCDecoderConfigurationRecord::Parse(flv_video.Payload(), flv_video.PayloadLength(), record);
+				if (flv_video.CodecId() == FlvVideoCodecId::HEVC)
+				{
+					HEVCDecoderConfigurationRecord record;
+					if (HEVCDecoderConfigurationRecord::Parse(flv_video.Payload(), flv_video.PayloadLength(), record) == false)
+					{
+						logte("Could not parse HEVCDecoderConfigurationRecord (%s/%s)", _vhost_app_name.CStr(), GetName().CStr());
+						return false;
+					}
+
+					_hevc_nal_length_size = record.LengthOfNALUnit();
+					logtd("HEVCDecoderConfigurationRecord: %s", record.GetInfoString().CStr());
+				}
+				else if (flv_video.CodecId() == FlvVideoCodecId::AV1)
+				{
+					AV1CodecConfigurationRecord record;
+					if (AV1CodecConfigurationRecord::Parse(flv_video.Payload(), flv_video.PayloadLength(), record) == false)
+					{
+						logte("Could not parse AV1CodecConfigurationRecord (%s/%s)", _vhost_app_name.CStr(), GetName().CStr());
+						return false;
+					}
+
+					logtd("AV1CodecConfigurationRecord: %s", record.GetInfoString().CStr());
+				}
+				else
+				{
+					// AVCDecoderConfigurationRecord Unit Test
+					AVCDecoderConfigurationRecord record;
+					AVCDecoderConfigurationRecord::Parse(flv_video.Payload(), flv_video.PayloadLength(), record);
+				}
 			}
 			else if (flv_video.PacketType() == FlvAvcPacketType::AVC_NALU)
 			{
-				packet_type = cmn::PacketType::NALU;
+				// AV1 coded frames are OBUs (Low Overhead Bitstream Format), they can be used as they are
+				packet_type = (flv_video.CodecId() == FlvVideoCodecId::AV1) ? cmn::PacketType::RAW : cmn::PacketType::NALU;
 			}
 			else if (flv_video.PacketType() == FlvAvcPacketType::AVC_END_SEQUENCE)
 			{
@@ -1483,15 +1709,44 @@ namespace pvd
 				return true;
 			}
 
-			auto data = std::make_shared<ov::Data>(flv_video.Payload(), flv_video.PayloadLength());
+			// Refer to the payload of the message without copying (the FLV video tag header is skipped)
+			std::shared_ptr<ov::Data> data;
+			auto bitstream_format = cmn::BitstreamFormat::H264_AVCC;  // RTMP's packet type is AVCC
+
+			if (flv_video.CodecId() == FlvVideoCodecId::HEVC)
+			{
+				bitstream_format = cmn::BitstreamFormat::H265_ANNEXB;
+
+				if (packet_type == cmn::PacketType::NALU)
+				{
+					// Length-prefixed NAL units -> AnnexB
+					data = ConvertHevcToAnnexB(message->payload, flv_video.Payload() - message->payload->GetDataAs<uint8_t>(), flv_video.PayloadLength());
+					if (data == nullptr)
+					{
+						logte("Could not convert HEVC frame to AnnexB (%s/%s)", _vhost_app_name.CStr(), GetName().CStr());
+						return false;
+					}
+				}
+			}
+			else if (flv_video.CodecId() == FlvVideoCodecId::AV1)
+			{
+				bitstream_format = cmn::BitstreamFormat::AV1;
+			}
+
+			if (data == nullptr)
+			{
+				data = message->payload->Subdata(flv_video.Payload() - message->payload->GetDataAs<uint8_t>(), flv_video.PayloadLength());
+			}
+
 			auto video_frame = std::make_shared<MediaPacket>(GetMsid(),
 															 cmn::MediaType::Video,
 															 RTMP_VIDEO_TRACK_ID,
 															 data,
 															 pts,
 															 dts,
-															 cmn::BitstreamFormat::H264_AVCC,  // RTMP's packet type is AVCC
+															 bitstream_format,
 															 packet_type);
+			video_frame->SetIngestTime(ov::Clock::NowUSec());
 
 			SendFrame(video_frame);
 
@@ -1548,6 +1803,69 @@ namespace pvd
 		return true;
 	}
 
+	// Enhanced RTMP carries HEVC as length-prefixed NAL units (ISO/IEC 14496-15)
+	std::shared_ptr<ov::Data> RtmpStream::ConvertHevcToAnnexB(const std::shared_ptr<ov::Data> &payload, off_t offset, size_t length)
+	{
+		const uint8_t START_CODE[4] = {0x00, 0x00, 0x00, 0x01};
+		const size_t length_size = _hevc_nal_length_size;
+
+		if (length_size == sizeof(START_CODE))
+		{
+			// NALUnitLength fields are replaced with start codes in place, so the frame isn't copied
+			auto bitstream = payload->GetWritableDataAs<uint8_t>() + offset;
+			size_t position = 0;
+
+			while (position < length)
+			{
+				if ((length - position) < length_size)
+				{
+					return nullptr;
+				}
+
+				size_t nal_length = ByteReader<uint32_t>::ReadBigEndian(bitstream + position);
+				if (nal_length > (length - position - length_size))
+				{
+					return nullptr;
+				}
+
+				::memcpy(bitstream + position, START_CODE, sizeof(START_CODE));
+				position += length_size + nal_length;
+			}
+
+			return payload->Subdata(offset, length);
+		}
+
+		auto bitstream = payload->GetDataAs<uint8_t>() + offset;
+		auto converted_data = std::make_shared<ov::Data>(length + (length / 2));
+		size_t position = 0;
+
+		while (position < length)
+		{
+			if ((length - position) < length_size)
+			{
+				return nullptr;
+			}
+
+			size_t nal_length = 0;
+			for (size_t index = 0; index < length_size; index++)
+			{
+				nal_length = (nal_length << 8) | bitstream[position + index];
+			}
+			position += length_size;
+
+			if (nal_length > (length - position))
+			{
+				return nullptr;
+			}
+
+			converted_data->Append(START_CODE, sizeof(START_CODE));
+			converted_data->Append(bitstream + position, nal_length);
+			position += nal_length;
+		}
+
+		return converted_data;
+	}
+
 	//====================================================================================================
 	// Chunk Message - Audio Message
 	// * Packet structure
@@ -1661,7 +1979,8 @@ namespace pvd
 				packet_type = cmn::PacketType::RAW;
 			}
 
-			auto data = std::make_shared<ov::Data>(flv_audio.Payload(), flv_audio.PayloadLength());
+			// Refer to the payload of the message without copying (the FLV audio tag header is skipped)
+			auto data = message->payload->Subdata(flv_audio.Payload() - message->payload->GetDataAs<uint8_t>(), flv_audio.PayloadLength());
 			auto frame = std::make_shared<MediaPacket>(GetMsid(),
 													   cmn::MediaType::Audio,
 													   RTMP_AUDIO_TRACK_ID,
@@ -1670,6 +1989,7 @@ namespace pvd
 													   dts,
 													   cmn::BitstreamFormat::AAC_RAW,
 													   packet_type);
+			frame->SetIngestTime(ov::Clock::NowUSec());
 
 			SendFrame(frame);
 
@@ -1781,8 +2101,21 @@ namespace pvd
 
 			new_track->SetId(RTMP_VIDEO_TRACK_ID);
 			new_track->SetMediaType(cmn::MediaType::Video);
-			new_track->SetCodecId(cmn::MediaCodecId::H264);
-			new_track->SetOriginBitstream(cmn::BitstreamFormat::H264_AVCC);
+			if (media_info->video_codec_type == RtmpCodecType::H265)
+			{
+				new_track->SetCodecId(cmn::MediaCodecId::H265);
+				new_track->SetOriginBitstream(cmn::BitstreamFormat::H265_ANNEXB);
+			}
+			else if (media_info->video_codec_type == RtmpCodecType::AV1)
+			{
+				new_track->SetCodecId(cmn::MediaCodecId::Av1);
+				new_track->SetOriginBitstream(cmn::BitstreamFormat::AV1);
+			}
+			else
+			{
+				new_track->SetCodecId(cmn::MediaCodecId::H264);
+				new_track->SetOriginBitstream(cmn::BitstreamFormat::H264_AVCC);
+			}
 			new_track->SetTimeBase(1, 1000);
 			new_track->SetVideoTimestampScale(1.0);
 
@@ -1994,26 +2327,14 @@ namespace pvd
 		return SendUserControlMessage(RTMP_UCMID_STREAMEOF, body);
 	}
 
-	bool RtmpStream::SendAmfCommand(std::shared_ptr<RtmpMuxMessageHeader> &message_header, AmfDocument &document)
+	bool RtmpStream::SendAmfCommand(std::shared_ptr<RtmpMuxMessageHeader> &message_header, std::shared_ptr<std::vector<uint8_t>> body)
 	{
-		auto body = std::make_shared<std::vector<uint8_t>>(2048);
-		uint32_t body_size = 0;
-
-		if (message_header == nullptr)
-		{
-			return false;
-		}
-
-		// body
-		body_size = document.Encode(body->data());
-
-		if (body_size == 0)
+		if ((message_header == nullptr) || (body == nullptr))
 		{
 			return false;
 		}
 
-		message_header->body_size = body_size;
-		body->resize(body_size);
+		message_header->body_size = body->size();
 
 		return SendMessagePacket(message_header, body);
 	}
@@ -2025,37 +2346,40 @@ namespace pvd
 																	 RTMP_MSGID_AMF0_COMMAND_MESSAGE,
 																	 0,
 																	 0);
-		AmfDocument document;
-		AmfObject *object = nullptr;
-		AmfArray *array = nullptr;
-
-		// _result
-		document.AddProperty(RTMP_ACK_NAME_RESULT);
-		document.AddProperty(transaction_id);
-
-		// properties
-		object = new AmfObject;
-		object->AddProperty("fmsVer", "FMS/3,5,2,654");
-		object->AddProperty("capabilities", 31.0);
-		object->AddProperty("mode", 1.0);
-
-		document.AddProperty(object);
-
-		// information
-		object = new AmfObject;
-		object->AddProperty("level", "status");
-		object->AddProperty("code", "NetConnection.Connect.Success");
-		object->AddProperty("description", "Connection succeeded.");
-		object->AddProperty("clientid", _client_id);
-		object->AddProperty("objectEncoding", object_encoding);
-
-		array = new AmfArray;
-		array->AddProperty("version", "3,5,2,654");
-		object->AddProperty("data", array);
-
-		document.AddProperty(object);
-
-		return SendAmfCommand(message_header, document);
+		static const auto connect_result = AmfPacketTemplate()
+											   // _result
+											   .String(RTMP_ACK_NAME_RESULT)
+											   // transaction_id
+											   .Placeholder()
+											   // properties
+											   .BeginObject()
+											   .Key("fmsVer")
+											   .String("FMS/3,5,2,654")
+											   .Key("capabilities")
+											   .Number(31.0)
+											   .Key("mode")
+											   .Number(1.0)
+											   .EndObject()
+											   // information
+											   .BeginObject()
+											   .Key("level")
+											   .String("status")
+											   .Key("code")
+											   .String("NetConnection.Connect.Success")
+											   .Key("description")
+											   .String("Connection succeeded.")
+											   .Key("clientid")
+											   .Placeholder()
+											   .Key("objectEncoding")
+											   .Placeholder()
+											   .Key("data")
+											   .BeginEcmaArray()
+											   .Key("version")
+											   .String("3,5,2,654")
+											   .EndObject()
+											   .EndObject();
+
+		return SendAmfCommand(message_header, connect_result.Make({transaction_id, _client_id, object_encoding}));
 	}
 
 	bool RtmpStream::SendAmfOnFCPublish(uint32_t chunk_stream_id, uint32_t stream_id, double client_id)
@@ -2065,22 +2389,22 @@ namespace pvd
 																	 RTMP_MSGID_AMF0_COMMAND_MESSAGE,
 																	 _rtmp_stream_id,
 																	 0);
-		AmfDocument document;
-		AmfObject *object = nullptr;
-
-		document.AddProperty(RTMP_CMD_NAME_ONFCPUBLISH);
-		document.AddProperty(0.0);
-		document.AddProperty(AmfDataType::Null);
-
-		object = new AmfObject;
-		object->AddProperty("level", "status");
-		object->AddProperty("code", "NetStream.Publish.Start");
-		object->AddProperty("description", "FCPublish");
-		object->AddProperty("clientid", client_id);
-
-		document.AddProperty(object);
-
-		return SendAmfCommand(message_header, document);
+		static const auto on_fc_publish = AmfPacketTemplate()
+											  .String(RTMP_CMD_NAME_ONFCPUBLISH)
+											  .Number(0.0)
+											  .Null()
+											  .BeginObject()
+											  .Key("level")
+											  .String("status")
+											  .Key("code")
+											  .String("NetStream.Publish.Start")
+											  .Key("description")
+											  .String("FCPublish")
+											  .Key("clientid")
+											  .Placeholder()
+											  .EndObject();
+
+		return SendAmfCommand(message_header, on_fc_publish.Make({client_id}));
 	}
 
 	bool RtmpStream::SendAmfCreateStreamResult(uint32_t chunk_stream_id, double transaction_id)
@@ -2090,24 +2414,25 @@ namespace pvd
 																	 RTMP_MSGID_AMF0_COMMAND_MESSAGE,
 																	 0,
 																	 0);
-		AmfDocument document;
+		static const auto create_stream_result = AmfPacketTemplate()
+													 .String(RTMP_ACK_NAME_RESULT)
+													 // transaction_id
+													 .Placeholder()
+													 .Null()
+													 // stream id
+													 .Placeholder();
 
 		// 스트림ID 정하기
 		_rtmp_stream_id = 1;
 
-		document.AddProperty(RTMP_ACK_NAME_RESULT);
-		document.AddProperty(transaction_id);
-		document.AddProperty(AmfDataType::Null);
-		document.AddProperty((double)_rtmp_stream_id);
-
-		return SendAmfCommand(message_header, document);
+		return SendAmfCommand(message_header, create_stream_result.Make({transaction_id, (double)_rtmp_stream_id}));
 	}
 
 	bool RtmpStream::SendAmfOnStatus(uint32_t chunk_stream_id,
 									 uint32_t stream_id,
-									 char *level,
-									 char *code,
-									 char *description,
+									 const char *level,
+									 const char *code,
+									 const char *description,
 									 double client_id)
 	{
 		auto message_header = std::make_shared<RtmpMuxMessageHeader>(chunk_stream_id,
@@ -2115,22 +2440,22 @@ namespace pvd
 																	 RTMP_MSGID_AMF0_COMMAND_MESSAGE,
 																	 stream_id,
 																	 0);
-		AmfDocument document;
-		AmfObject *object = nullptr;
-
-		document.AddProperty(RTMP_CMD_NAME_ONSTATUS);
-		document.AddProperty(0.0);
-		document.AddProperty(AmfDataType::Null);
-
-		object = new AmfObject;
-		object->AddProperty("level", level);
-		object->AddProperty("code", code);
-		object->AddProperty("description", description);
-		object->AddProperty("clientid", client_id);
-
-		document.AddProperty(object);
-
-		return SendAmfCommand(message_header, document);
+		static const auto on_status = AmfPacketTemplate()
+										  .String(RTMP_CMD_NAME_ONSTATUS)
+										  .Number(0.0)
+										  .Null()
+										  .BeginObject()
+										  .Key("level")
+										  .Placeholder()
+										  .Key("code")
+										  .Placeholder()
+										  .Key("description")
+										  .Placeholder()
+										  .Key("clientid")
+										  .Placeholder()
+										  .EndObject();
+
+		return SendAmfCommand(message_header, on_status.Make({level, code, description, client_id}));
 	}
 
 	ov::String RtmpStream::GetCodecString(RtmpCodecType codec_type)
@@ -2142,6 +2467,12 @@ namespace pvd
 			case RtmpCodecType::H264:
 				codec_string = "h264";
 				break;
+			case RtmpCodecType::H265:
+				codec_string = "h265";
+				break;
+			case RtmpCodecType::AV1:
+				codec_string = "av1";
+				break;
 			case RtmpCodecType::AAC:
 				codec_string = "aac";
 				break;
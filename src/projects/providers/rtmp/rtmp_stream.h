@@ -9,11 +9,16 @@
 
 #pragma once
 
+#include <deque>
+#include <mutex>
+
 #include "base/common_types.h"
 #include "base/provider/push_provider/stream.h"
 #include "modules/access_control/access_controller.h"
 
 #include "chunk/amf_document.h"
+#include "chunk/amf_packet_template.h"
+#include "chunk/amf_view.h"
 #include "chunk/rtmp_chunk_parser.h"
 #include "chunk/rtmp_export_chunk.h"
 #include "chunk/rtmp_handshake.h"
@@ -52,6 +57,29 @@ namespace pvd
 		}
 		bool OnDataReceived(const std::shared_ptr<const ov::Data> &data) override;
 
+		// ------------------------------------------
+		// Decoupled ingest (RtmpIngestWorker module)
+		// ------------------------------------------
+		void SetIngestWorkerIndex(size_t index)
+		{
+			_ingest_worker_index = index;
+		}
+
+		size_t GetIngestWorkerIndex() const
+		{
+			return _ingest_worker_index;
+		}
+
+		// Called on the socket worker to queue the received data.
+		// Returns true if the stream needs to be scheduled to the ingest worker.
+		//
+		// If the queued data exceeds max_buffer_size, the read of the socket is paused
+		// until half of the queued data is processed.
+		bool EnqueueReceivedData(const std::shared_ptr<const ov::Data> &data, size_t max_buffer_size);
+		// Called on the ingest worker to process the queued data.
+		// Returns true if more data was queued while processing.
+		bool ProcessReceivedData();
+
 	protected:
 		bool Start() override;
 
@@ -60,11 +88,11 @@ namespace pvd
 		
 	private:
 		// AMF Event
-		void OnAmfConnect(const std::shared_ptr<const RtmpChunkHeader> &header, AmfDocument &document, double transaction_id);
-		void OnAmfCreateStream(const std::shared_ptr<const RtmpChunkHeader> &header, AmfDocument &document, double transaction_id);
-		void OnAmfFCPublish(const std::shared_ptr<const RtmpChunkHeader> &header, AmfDocument &document, double transaction_id);
-		void OnAmfPublish(const std::shared_ptr<const RtmpChunkHeader> &header, AmfDocument &document, double transaction_id);
-		void OnAmfDeleteStream(const std::shared_ptr<const RtmpChunkHeader> &header, AmfDocument &document, double transaction_id);
+		void OnAmfConnect(const std::shared_ptr<const RtmpChunkHeader> &header, const AmfView &document, double transaction_id);
+		void OnAmfCreateStream(const std::shared_ptr<const RtmpChunkHeader> &header, const AmfView &document, double transaction_id);
+		void OnAmfFCPublish(const std::shared_ptr<const RtmpChunkHeader> &header, const AmfView &document, double transaction_id);
+		void OnAmfPublish(const std::shared_ptr<const RtmpChunkHeader> &header, const AmfView &document, double transaction_id);
+		void OnAmfDeleteStream(const std::shared_ptr<const RtmpChunkHeader> &header, const AmfView &document, double transaction_id);
 		bool OnAmfMetaData(const std::shared_ptr<const RtmpChunkHeader> &header, AmfDocument &document, int32_t object_index);
 
 
@@ -80,15 +108,15 @@ namespace pvd
 		bool SendStreamBegin();
 		bool SendStreamEnd();
 		bool SendAcknowledgementSize();
-		bool SendAmfCommand(std::shared_ptr<RtmpMuxMessageHeader> &message_header, AmfDocument &document);
+		bool SendAmfCommand(std::shared_ptr<RtmpMuxMessageHeader> &message_header, std::shared_ptr<std::vector<uint8_t>> body);
 		bool SendAmfConnectResult(uint32_t chunk_stream_id, double transaction_id, double object_encoding);
 		bool SendAmfOnFCPublish(uint32_t chunk_stream_id, uint32_t stream_id, double client_id);
 		bool SendAmfCreateStreamResult(uint32_t chunk_stream_id, double transaction_id);
 		bool SendAmfOnStatus(uint32_t chunk_stream_id,
 							uint32_t stream_id,
-							char *level,
-							char *code,
-							char *description,
+							const char *level,
+							const char *code,
+							const char *description,
 							double client_id);
 
 		// Parsing handshake messages
@@ -110,6 +138,9 @@ namespace pvd
 
 		bool ReceiveAudioMessage(const std::shared_ptr<const RtmpMessage> &message);
 		bool ReceiveVideoMessage(const std::shared_ptr<const RtmpMessage> &message);
+		// Appends the audio/video/data message to the ingest capture as an FLV tag
+		void CaptureMessage(const std::shared_ptr<const RtmpMessage> &message);
+		std::shared_ptr<ov::Data> ConvertHevcToAnnexB(const std::shared_ptr<ov::Data> &payload, off_t offset, size_t length);
 
 		ov::String GetCodecString(RtmpCodecType codec_type);
 		ov::String GetEncoderTypeString(RtmpEncoderType encoder_type);
@@ -133,6 +164,9 @@ namespace pvd
 		std::shared_ptr<RtmpExportChunk> _export_chunk;
 		std::shared_ptr<RtmpMediaInfo> _media_info;
 
+		// Reused for every command message to keep the capacity of the decoded values
+		AmfView _amf_command_view;
+
 		std::vector<std::shared_ptr<const RtmpMessage>> _stream_message_cache;
 		uint32_t _stream_message_cache_video_count = 0;
 		uint32_t _stream_message_cache_audio_count = 0;
@@ -169,6 +203,14 @@ namespace pvd
 		// Received data buffer
 		std::shared_ptr<ov::Data> 	_remained_data = nullptr;
 
+		// Data waiting for the ingest worker
+		size_t _ingest_worker_index = 0;
+		std::mutex _received_data_queue_mutex;
+		std::deque<std::shared_ptr<const ov::Data>> _received_data_queue;
+		size_t _received_data_queue_size = 0;
+		size_t _max_received_data_queue_size = 0;
+		bool _is_ingest_scheduled = false;
+
 		// Singed Policy
 		uint64_t _stream_expired_msec = 0;
 
@@ -177,6 +219,9 @@ namespace pvd
 		int64_t _first_pts_offset = 0;
 		int64_t _first_dts_offset = 0;
 
+		// Enhanced RTMP - lengthSizeMinusOne + 1 of HEVCDecoderConfigurationRecord
+		uint8_t _hevc_nal_length_size = 4;
+
 		// Data frame
 		int64_t _last_video_pts = 0;
 		ov::StopWatch _last_video_pts_clock;
@@ -15,14 +15,6 @@ LOCAL_LDFLAGS := \
  
 LOCAL_TARGET := rtsp_provider
 
-LOCAL_SOURCE_FILES := $(LOCAL_SOURCE_FILES) \
-    $(call get_sub_source_list,rtp) \
-    $(call get_sub_source_list,rtcp)
-LOCAL_HEADER_FILES := $(LOCAL_HEADER_FILES) \
-    $(call get_sub_header_list,rtp) \
-    $(call get_sub_header_list,rtcp)
-
-$(call add_pkg_config,openssl)
 $(call add_pkg_config,srt)
 
 include $(BUILD_STATIC_LIBRARY)
@@ -1,8 +0,0 @@
-#pragma once
-
-#include "rtcp_packet_header.h"
-
-enum RtcpPacketType
-{
-    SenderReport = 200
-};
@@ -1,28 +1,30 @@
+//==============================================================================
+//
+//  RtspApplication
+//
+//  Created by Getroot
+//  Copyright (c) 2023 AirenSoft. All rights reserved.
+//
+//==============================================================================
+
 #include "rtsp_application.h"
 #include "rtsp_stream.h"
+#include "rtsp_provider_private.h"
 
-#include "base/provider/application.h"
+#include "base/provider/push_provider/application.h"
 #include "base/info/stream.h"
 
-#define OV_LOG_TAG "RtspApplication"
-
-std::shared_ptr<RtspApplication> RtspApplication::Create(const std::shared_ptr<Provider> &provider, const info::Application &application_info)
-{
-	auto application = std::make_shared<RtspApplication>(application_info);
-	application->Start();
-	return application;
-}
-
-RtspApplication::RtspApplication(const info::Application &application_info)
-	: Application(application_info)
+namespace pvd
 {
-}
-
-std::shared_ptr<pvd::Stream> RtspApplication::CreateStream()
-{
-	logtd("OnStreamCreated");
-
-	auto stream = RtspStream::Create(GetSharedPtrAs<pvd::Application>());
+	std::shared_ptr<RtspApplication> RtspApplication::Create(const std::shared_ptr<PushProvider> &provider, const info::Application &application_info)
+	{
+		auto application = std::make_shared<RtspApplication>(provider, application_info);
+		application->Start();
+		return application;
+	}
 
-	return stream;
+	RtspApplication::RtspApplication(const std::shared_ptr<PushProvider> &provider, const info::Application &application_info)
+		: PushApplication(provider, application_info)
+	{
+	}
 }
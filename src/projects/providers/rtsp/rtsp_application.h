@@ -1,23 +1,26 @@
+//==============================================================================
+//
+//  RtspProvider
+//
+//  Created by Getroot
+//  Copyright (c) 2023 AirenSoft. All rights reserved.
+//
+//==============================================================================
+
 #pragma once
 
 #include "base/common_types.h"
+#include "base/provider/push_provider/application.h"
+#include "base/provider/push_provider/stream.h"
 
-#include "base/provider/application.h"
-#include "base/provider/stream.h"
-
-using namespace pvd;
-
-class RtspApplication : public Application
+namespace pvd
 {
-
-public:
-	static std::shared_ptr<RtspApplication> Create(const std::shared_ptr<Provider> &provider, const info::Application &application_info);
-
-	explicit RtspApplication(const info::Application &info);
-	
-	~RtspApplication() override = default;
-
-	std::shared_ptr<pvd::Stream> CreateStream();
-
-private:
-};
\ No newline at end of file
+	class RtspApplication : public PushApplication
+	{
+	public:
+		static std::shared_ptr<RtspApplication> Create(const std::shared_ptr<PushProvider> &provider, const info::Application &application_info);
+
+		explicit RtspApplication(const std::shared_ptr<PushProvider> &provider, const info::Application &info);
+		~RtspApplication() override = default;
+	};
+}
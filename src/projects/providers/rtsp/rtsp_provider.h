@@ -1,29 +1,37 @@
+//==============================================================================
+//
+//  RtspProvider
+//
+//  Created by Getroot
+//  Copyright (c) 2023 AirenSoft. All rights reserved.
+//
+//==============================================================================
 #pragma once
 
-#include <unistd.h>
-#include <stdint.h>
-#include <memory>
-#include <unordered_map>
-
 #include <base/ovlibrary/ovlibrary.h>
+#include <orchestrator/orchestrator.h>
 
-#include "base/provider/provider.h"
-#include "base/provider/application.h"
-#include "base/mediarouter/media_buffer.h"
-#include "base/mediarouter/media_type.h"
-
-#include "rtsp_server.h"
-#include "rtsp_observer.h"
+#include "base/provider/push_provider/provider.h"
 
 namespace pvd
 {
-    class RtspProvider : public pvd::Provider, public RtspObserver
-    {
-    public:
-        explicit RtspProvider(const cfg::Server &server_config, std::shared_ptr<MediaRouteInterface> router);
-        ~RtspProvider() override;
+	// Receives the streams pushed by ANNOUNCE/RECORD over RTSP (RTP/AVP/TCP interleaved only).
+	// The connections are processed on the socket workers of the physical port (<WorkerCount> of <Bind><Providers><RTSP>)
+	class RtspProvider : public pvd::PushProvider, protected PhysicalPortObserver
+	{
+	public:
+		static std::shared_ptr<RtspProvider> Create(const cfg::Server &server_config, const std::shared_ptr<MediaRouteInterface> &router);
+
+		explicit RtspProvider(const cfg::Server &server_config, const std::shared_ptr<MediaRouteInterface> &router);
+		~RtspProvider() override;
 
-        ProviderStreamDirection GetProviderStreamDirection() const override
+		bool Start() override;
+		bool Stop() override;
+
+		//--------------------------------------------------------------------
+		// Implementation of Provider's pure virtual functions
+		//--------------------------------------------------------------------
+		ProviderStreamDirection GetProviderStreamDirection() const override
 		{
 			return ProviderStreamDirection::Push;
 		}
@@ -33,40 +41,34 @@ namespace pvd
 			return ProviderType::Rtsp;
 		}
 
-        const char* GetProviderName() const override
-	    {
-		    return "RTSPProvider";
-	    }
+		const char *GetProviderName() const override
+		{
+			return "RTSPProvider";
+		}
 
-        bool Start() override;
+	protected:
+		//--------------------------------------------------------------------
+		// Implementation of Provider's pure virtual functions
+		//--------------------------------------------------------------------
+		bool OnCreateHost(const info::Host &host_info) override;
+		bool OnDeleteHost(const info::Host &host_info) override;
+		std::shared_ptr<pvd::Application> OnCreateProviderApplication(const info::Application &application_info) override;
+		bool OnDeleteProviderApplication(const std::shared_ptr<pvd::Application> &application) override;
 
-        static std::shared_ptr<RtspProvider> Create(const cfg::Server &server_config, std::shared_ptr<MediaRouteInterface> router);
+		//--------------------------------------------------------------------
+		// Implementation of PhysicalPortObserver
+		//--------------------------------------------------------------------
+		void OnConnected(const std::shared_ptr<ov::Socket> &remote) override;
 
-        // RtspObserver
-        bool OnStreamAnnounced(const ov::String &app_name, 
-            const ov::String &stream_name,
-            const RtspMediaInfo &media_info,
-            info::application_id_t &application_id,
-            uint32_t &stream_id) override;
-        bool OnVideoData(info::application_id_t application_id,
-            uint32_t stream_id,
-            uint8_t track_id,
-            uint32_t timestamp,
-            const std::shared_ptr<std::vector<uint8_t>> &data,
-            uint8_t flags,
-            std::unique_ptr<FragmentationHeader> fragmentation_header) override;
-        bool OnAudioData(info::application_id_t application_id,
-            uint32_t stream_id,
-            uint8_t track_id,
-            uint32_t timestamp,
-            const std::shared_ptr<std::vector<uint8_t>> &data) override;
-        bool OnStreamTeardown(info::application_id_t application_id, uint32_t stream_id) override;
+		void OnDataReceived(const std::shared_ptr<ov::Socket> &remote,
+							const ov::SocketAddress &address,
+							const std::shared_ptr<const ov::Data> &data) override;
 
-    protected:
-        std::shared_ptr<pvd::Application> OnCreateProviderApplication(const info::Application &application_info) override;
-        bool OnDeleteProviderApplication(const std::shared_ptr<pvd::Application> &application) override;
+		void OnDisconnected(const std::shared_ptr<ov::Socket> &remote,
+							PhysicalPortDisconnectReason reason,
+							const std::shared_ptr<const ov::Error> &error) override;
 
-    private:
-        std::shared_ptr<RtspServer> rtsp_server_;
-    };
-}  // namespace pvd
\ No newline at end of file
+	private:
+		std::vector<std::shared_ptr<PhysicalPort>> _physical_port_list;
+	};
+}  // namespace pvd
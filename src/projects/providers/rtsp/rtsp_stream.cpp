@@ -1,17 +1,850 @@
+//==============================================================================
+//
+//  RtspProvider
+//
+//  Created by Getroot
+//  Copyright (c) 2023 AirenSoft. All rights reserved.
+//
+//==============================================================================
+
 #include "rtsp_stream.h"
 
-std::shared_ptr<RtspStream> RtspStream::Create(const std::shared_ptr<pvd::Application> &application)
+#include <base/info/application.h>
+#include <base/ovlibrary/byte_io.h>
+#include <modules/rtp_rtcp/rtp_depacketizer_mpeg4_generic_audio.h>
+#include <orchestrator/orchestrator.h>
+
+#include "base/provider/push_provider/application.h"
+#include "base/provider/push_provider/provider.h"
+#include "rtsp_provider_private.h"
+
+namespace pvd
 {
-    auto stream = std::make_shared<RtspStream>(application);
-    return stream;
-}
+	std::shared_ptr<RtspStream> RtspStream::Create(uint32_t channel_id, const std::shared_ptr<ov::Socket> &client_socket, const std::shared_ptr<PushProvider> &provider)
+	{
+		auto stream = std::make_shared<RtspStream>(channel_id, client_socket, provider);
+		if (stream != nullptr)
+		{
+			stream->Start();
+		}
+		return stream;
+	}
 
-RtspStream::RtspStream(const std::shared_ptr<pvd::Application> &application)
-	: pvd::Stream(application, StreamSourceType::Rtsp)
-{	
-}
+	RtspStream::RtspStream(uint32_t channel_id, const std::shared_ptr<ov::Socket> &client_socket, const std::shared_ptr<PushProvider> &provider)
+		: PushStream(StreamSourceType::Rtsp, channel_id, provider),
+		  Node(NodeType::Rtsp),
+		  _vhost_app_name(info::VHostAppName::InvalidVHostAppName())
+	{
+		logtd("Stream has been created");
 
+		_remote = client_socket;
+		SetMediaSource(_remote->GetRemoteAddressAsUrl());
 
-RtspStream::~RtspStream()
-{
-}
+		CreateIngestCapture(mdl::IngestCapture::Format::Pcap);
+	}
+
+	RtspStream::~RtspStream()
+	{
+		logtd("Stream has been terminated finally");
+	}
+
+	bool RtspStream::Start()
+	{
+		SetState(Stream::State::PLAYING);
+
+		return PushStream::Start();
+	}
+
+	bool RtspStream::Stop()
+	{
+		if (GetState() == Stream::State::STOPPED)
+		{
+			return true;
+		}
+
+		// Send Close to Admission Webhooks
+		auto requested_url = GetRequestedUrl();
+		auto final_url = GetFinalUrl();
+		if (_remote && requested_url && final_url)
+		{
+			auto remote_address{_remote->GetRemoteAddress()};
+			if (remote_address)
+			{
+				auto request_info = std::make_shared<AccessController::RequestInfo>(requested_url, remote_address, requested_url->ToUrlString(true) == final_url->ToUrlString(true) ? nullptr : final_url);
+
+				GetProvider()->SendCloseAdmissionWebhooks(request_info);
+			}
+		}
+
+		if (_rtp_rtcp != nullptr)
+		{
+			_rtp_rtcp->Stop();
+		}
+
+		ov::Node::Stop();
+
+		if (_remote->GetState() == ov::SocketState::Connected)
+		{
+			_remote->Close();
+		}
+
+		return PushStream::Stop();
+	}
+
+	bool RtspStream::OnDataReceived(const std::shared_ptr<const ov::Data> &data)
+	{
+		if (GetState() == Stream::State::ERROR || GetState() == Stream::State::STOPPED)
+		{
+			return false;
+		}
+
+		// Check stream expired by signed policy
+		if (CheckStreamExpired() == true)
+		{
+			logti("Stream has expired by signed policy (%s/%s)", _vhost_app_name.CStr(), GetName().CStr());
+			Stop();
+			return false;
+		}
+
+		// The socket gives a new buffer for each receive, so the demuxer can refer to it
+		if (_rtsp_demuxer.AppendPacket(data) == false)
+		{
+			logte("Could not parse the RTSP packet from %s", _remote->ToString().CStr());
+			Stop();
+			return false;
+		}
+
+		while (_rtsp_demuxer.IsAvailableMessage())
+		{
+			auto message = _rtsp_demuxer.PopMessage();
+			if (message->GetMessageType() != RtspMessageType::REQUEST)
+			{
+				logtw("An unexpected RTSP message is received from %s: %s", _remote->ToString().CStr(), message->DumpHeader().CStr());
+				continue;
+			}
+
+			if (OnRequestReceived(message) == false)
+			{
+				return false;
+			}
+		}
+
+		while (_rtsp_demuxer.IsAvailableData())
+		{
+			// RTP or RTCP
+			auto rtsp_data = _rtsp_demuxer.PopData();
+
+			if (IsPublished() == false)
+			{
+				// Not recording yet
+				continue;
+			}
+
+			// RtpRtcpInterface(RtspStream) <--> [RTP_RTCP Node] <--> [*Edge Node(RtspStream)] ---Send--> {Socket}
+			//							        					     					    <--Recv--- {Socket}
+			SendDataToPrevNode(rtsp_data);
+		}
+
+		return true;
+	}
+
+	bool RtspStream::OnRequestReceived(const std::shared_ptr<RtspMessage> &request)
+	{
+		logtd("RTSP request from %s\n%s", _remote->ToString().CStr(), request->DumpHeader().CStr());
+
+		auto method = request->GetMethodStr().UpperCaseString();
+
+		if (method == "OPTIONS")
+		{
+			return OnOptions(request);
+		}
+		else if (method == "ANNOUNCE")
+		{
+			return OnAnnounce(request);
+		}
+		else if (method == "SETUP")
+		{
+			return OnSetup(request);
+		}
+		else if (method == "RECORD")
+		{
+			return OnRecord(request);
+		}
+		else if (method == "TEARDOWN")
+		{
+			return OnTeardown(request);
+		}
+		else if ((method == "GET_PARAMETER") || (method == "SET_PARAMETER"))
+		{
+			// Keep-alive
+			return SendResponse(MakeResponse(request, 200, "OK"));
+		}
+
+		return SendErrorResponse(request, 501, "Not Implemented", false);
+	}
+
+	bool RtspStream::OnOptions(const std::shared_ptr<RtspMessage> &request)
+	{
+		auto response = MakeResponse(request, 200, "OK");
+		response->AddHeaderField(std::make_shared<RtspHeaderField>(RtspHeaderFieldType::Public, "OPTIONS, ANNOUNCE, SETUP, RECORD, TEARDOWN, GET_PARAMETER, SET_PARAMETER"));
+
+		return SendResponse(response);
+	}
+
+	bool RtspStream::OnAnnounce(const std::shared_ptr<RtspMessage> &request)
+	{
+		if (_announced == true)
+		{
+			return SendErrorResponse(request, 455, "Method Not Valid in This State", false);
+		}
+
+		_url = ov::Url::Parse(request->GetRequestUri());
+		if ((_url == nullptr) || _url->App().IsEmpty() || _url->Stream().IsEmpty())
+		{
+			logte("Invalid RTSP URL: %s", request->GetRequestUri().CStr());
+			return SendErrorResponse(request, 400, "Bad Request", true);
+		}
+
+		// PORT can be omitted (554), but SignedPolicy requires this information.
+		if (_url->Port() == 0)
+		{
+			_url->SetPort(_remote->GetLocalAddress()->Port());
+		}
+
+		_publish_url = _url;
+		SetRequestedUrl(_url);
+		SetFinalUrl(_url);
+
+		if (CheckAccessControl() == false)
+		{
+			return SendErrorResponse(request, 403, "Forbidden", true);
+		}
+
+		auto body = request->GetBody();
+		if ((body == nullptr) || (_sdp.FromString(body->ToString()) == false))
+		{
+			logte("Could not parse the SDP of ANNOUNCE from %s", _remote->ToString().CStr());
+			return SendErrorResponse(request, 400, "Bad Request", true);
+		}
+
+		_vhost_app_name = ocst::Orchestrator::GetInstance()->ResolveApplicationNameFromDomain(_publish_url->Host(), _publish_url->App());
+
+		if (GetProvider()->GetApplicationByName(_vhost_app_name) == nullptr)
+		{
+			logte("Could not find application: %s/%s", _vhost_app_name.CStr(), _publish_url->Stream().CStr());
+			return SendErrorResponse(request, 404, "Not Found", true);
+		}
+
+		SetName(_publish_url->Stream());
+
+		_session_id = ov::Random::GenerateString(16);
+		_rtp_rtcp = std::make_shared<RtpRtcp>(RtpRtcpInterface::GetSharedPtr());
+		_announced = true;
+
+		logti("RTSP stream is announced: %s/%s from %s", _vhost_app_name.CStr(), GetName().CStr(), _remote->ToString().CStr());
+
+		return SendResponse(MakeResponse(request, 200, "OK"));
+	}
+
+	bool RtspStream::OnSetup(const std::shared_ptr<RtspMessage> &request)
+	{
+		if ((_announced == false) || IsPublished())
+		{
+			return SendErrorResponse(request, 455, "Method Not Valid in This State", false);
+		}
+
+		auto transport_field = request->GetHeaderFieldAs<RtspHeaderTransportField>(RtspHeaderField::FieldTypeToString(RtspHeaderFieldType::Transport));
+		if ((transport_field == nullptr) || (transport_field->IsInterleavedParsed() == false) ||
+			(transport_field->GetLowerTransport().UpperCaseString() != "TCP"))
+		{
+			// Only RTP/AVP/TCP (interleaved) is supported
+			logtw("Unsupported transport is requested from %s: %s", _remote->ToString().CStr(), (transport_field != nullptr) ? transport_field->GetValue().CStr() : "(none)");
+			return SendErrorResponse(request, 461, "Unsupported Transport", false);
+		}
+
+		auto rtp_channel = transport_field->GetInterleavedChannelStart();
+		auto rtcp_channel = transport_field->GetInterleavedChannelEnd();
+		if ((rtp_channel > UINT8_MAX) || (rtcp_channel > UINT8_MAX) || (GetTrack(rtp_channel) != nullptr))
+		{
+			return SendErrorResponse(request, 400, "Bad Request", false);
+		}
+
+		auto media_desc = FindMediaDescription(request->GetRequestUri());
+		if (media_desc == nullptr)
+		{
+			logte("Could not find the media of %s in the SDP", request->GetRequestUri().CStr());
+			return SendErrorResponse(request, 404, "Not Found", false);
+		}
+
+		if (AddTrackFromMedia(static_cast<uint8_t>(rtp_channel), media_desc) == false)
+		{
+			return SendErrorResponse(request, 415, "Unsupported Media Type", false);
+		}
+
+		_setup_media_list.insert(media_desc);
+
+		auto response = MakeResponse(request, 200, "OK");
+		response->AddHeaderField(std::make_shared<RtspHeaderTransportField>(rtp_channel, rtcp_channel, transport_field->GetSsrc()));
+
+		return SendResponse(response);
+	}
+
+	bool RtspStream::OnRecord(const std::shared_ptr<RtspMessage> &request)
+	{
+		if ((_announced == false) || IsPublished())
+		{
+			return SendErrorResponse(request, 455, "Method Not Valid in This State", false);
+		}
+
+		if (GetTracks().empty())
+		{
+			logte("There is no track to record: %s/%s", _vhost_app_name.CStr(), GetName().CStr());
+			return SendErrorResponse(request, 455, "Method Not Valid in This State", true);
+		}
+
+		// Edge(this) <-> RtpRtcp <-> RtpRtcpInterface(this)
+		_rtp_rtcp->RegisterPrevNode(nullptr);
+		_rtp_rtcp->RegisterNextNode(ov::Node::GetSharedPtr());
+		_rtp_rtcp->Start();
+
+		RegisterPrevNode(_rtp_rtcp);
+		RegisterNextNode(nullptr);
+		ov::Node::Start();
+
+		if (PublishChannel(_vhost_app_name) == false)
+		{
+			logte("Could not publish the RTSP stream: %s/%s", _vhost_app_name.CStr(), GetName().CStr());
+			return SendErrorResponse(request, 500, "Internal Server Error", true);
+		}
+
+		_record_request_time.Start();
+
+		logti("RTSP stream is recording: %s/%s (%zu tracks)", _vhost_app_name.CStr(), GetName().CStr(), GetTracks().size());
+
+		return SendResponse(MakeResponse(request, 200, "OK"));
+	}
+
+	bool RtspStream::OnTeardown(const std::shared_ptr<RtspMessage> &request)
+	{
+		logti("RTSP stream is torn down: %s/%s", _vhost_app_name.CStr(), GetName().CStr());
+
+		SendResponse(MakeResponse(request, 200, "OK"));
+		Stop();
+
+		return false;
+	}
+
+	std::shared_ptr<RtspMessage> RtspStream::MakeResponse(const std::shared_ptr<RtspMessage> &request, uint32_t status_code, const ov::String &reason_phrase)
+	{
+		auto response = std::make_shared<RtspMessage>(status_code, request->GetCSeq(), reason_phrase);
+		response->AddHeaderField(std::make_shared<RtspHeaderField>(RtspHeaderFieldType::Server, RTSP_SERVER_NAME));
+
+		if (_session_id.IsEmpty() == false)
+		{
+			response->AddHeaderField(std::make_shared<RtspHeaderSessionField>(_session_id));
+		}
+
+		return response;
+	}
+
+	bool RtspStream::SendResponse(const std::shared_ptr<RtspMessage> &response)
+	{
+		auto message = response->GetMessage();
+		if (message == nullptr)
+		{
+			return false;
+		}
+
+		logtd("RTSP response to %s\n%s", _remote->ToString().CStr(), response->DumpHeader().CStr());
+
+		return _remote->Send(message);
+	}
+
+	bool RtspStream::SendErrorResponse(const std::shared_ptr<RtspMessage> &request, uint32_t status_code, const ov::String &reason_phrase, bool close)
+	{
+		logtw("%s request from %s is rejected: %u %s", request->GetMethodStr().CStr(), _remote->ToString().CStr(), status_code, reason_phrase.CStr());
+
+		SendResponse(MakeResponse(request, status_code, reason_phrase));
+
+		if (close)
+		{
+			Stop();
+			return false;
+		}
+
+		return true;
+	}
+
+	std::shared_ptr<const MediaDescription> RtspStream::FindMediaDescription(const ov::String &request_uri) const
+	{
+		std::shared_ptr<const MediaDescription> not_setup_media_desc = nullptr;
+
+		for (const auto &media_desc : _sdp.GetMediaList())
+		{
+			if (_setup_media_list.find(media_desc) != _setup_media_list.end())
+			{
+				continue;
+			}
+
+			// a=control:streamid=0 or a=control:rtsp://host/app/stream/streamid=0
+			auto control = media_desc->GetControl();
+			if ((control.IsEmpty() == false) && ((request_uri == control) || request_uri.HasSuffix(ov::String::FormatString("/%s", control.CStr()))))
+			{
+				return media_desc;
+			}
+
+			if (not_setup_media_desc == nullptr)
+			{
+				not_setup_media_desc = media_desc;
+			}
+		}
+
+		// Some encoders do not put the control in the URI, so the medias are set up in the order of the SDP
+		return not_setup_media_desc;
+	}
+
+	bool RtspStream::AddTrackFromMedia(uint8_t channel, const std::shared_ptr<const MediaDescription> &media_desc)
+	{
+		auto first_payload = media_desc->GetFirstPayload();
+		if (first_payload == nullptr)
+		{
+			logte("Failed to get the first Payload type of peer sdp");
+			return false;
+		}
+
+		// Make track
+		auto track = std::make_shared<MediaTrack>();
+		RtpDepacketizingManager::SupportedDepacketizerType depacketizer_type;
+
+		// The RTP channel is used as the track ID
+		track->SetId(channel);
+		track->SetTimeBase(1, first_payload->GetCodecRate());
+		track->SetVideoTimestampScale(1.0);
+
+		switch (first_payload->GetCodec())
+		{
+			case PayloadAttr::SupportCodec::H264:
+				track->SetMediaType(cmn::MediaType::Video);
+				track->SetCodecId(cmn::MediaCodecId::H264);
+				track->SetOriginBitstream(cmn::BitstreamFormat::H264_RTP_RFC_6184);
+				_h264_extradata_nalu = first_payload->GetH264ExtraDataAsAnnexB();
+				depacketizer_type = RtpDepacketizingManager::SupportedDepacketizerType::H264;
+				break;
+
+			case PayloadAttr::SupportCodec::H265:
+				track->SetMediaType(cmn::MediaType::Video);
+				track->SetCodecId(cmn::MediaCodecId::H265);
+				track->SetOriginBitstream(cmn::BitstreamFormat::H265_RTP_RFC_7798);
+				depacketizer_type = RtpDepacketizingManager::SupportedDepacketizerType::H265;
+				break;
+
+			case PayloadAttr::SupportCodec::VP8:
+				track->SetMediaType(cmn::MediaType::Video);
+				track->SetCodecId(cmn::MediaCodecId::Vp8);
+				track->SetOriginBitstream(cmn::BitstreamFormat::VP8_RTP_RFC_7741);
+				depacketizer_type = RtpDepacketizingManager::SupportedDepacketizerType::VP8;
+				break;
+
+			case PayloadAttr::SupportCodec::MPEG4_GENERIC:
+				track->SetMediaType(cmn::MediaType::Audio);
+				track->SetCodecId(cmn::MediaCodecId::Aac);
+				track->SetOriginBitstream(cmn::BitstreamFormat::AAC_MPEG4_GENERIC);
+				track->GetChannel().SetCount(std::atoi(first_payload->GetCodecParams()));
+				depacketizer_type = RtpDepacketizingManager::SupportedDepacketizerType::MPEG4_GENERIC_AUDIO;
+				break;
+
+			case PayloadAttr::SupportCodec::OPUS:
+				track->SetMediaType(cmn::MediaType::Audio);
+				track->SetCodecId(cmn::MediaCodecId::Opus);
+				track->SetOriginBitstream(cmn::BitstreamFormat::OPUS_RTP_RFC_7587);
+				track->GetChannel().SetCount(std::atoi(first_payload->GetCodecParams()));
+				depacketizer_type = RtpDepacketizingManager::SupportedDepacketizerType::OPUS;
+				break;
+
+			default:
+				logte("%s - Unsupported codec  : %s", GetName().CStr(), first_payload->GetCodecParams().CStr());
+				return false;
+		}
+
+		// Add Depacketizer
+		if (AddDepacketizer(channel, depacketizer_type) == false)
+		{
+			logte("%s - Could not add depacketizer for channel %u codec  : %s", GetName().CStr(), channel, first_payload->GetCodecParams().CStr());
+			return false;
+		}
+
+		// Set Parameters
+		if (depacketizer_type == RtpDepacketizingManager::SupportedDepacketizerType::MPEG4_GENERIC_AUDIO)
+		{
+			RtpDepacketizerMpeg4GenericAudio::Mode mpeg4_mode;
+			if (first_payload->GetMpeg4GenericMode() == PayloadAttr::Mpeg4GenericMode::AAC_lbr)
+			{
+				mpeg4_mode = RtpDepacketizerMpeg4GenericAudio::Mode::AAC_lbr;
+			}
+			else if (first_payload->GetMpeg4GenericMode() == PayloadAttr::Mpeg4GenericMode::AAC_hbr)
+			{
+				mpeg4_mode = RtpDepacketizerMpeg4GenericAudio::Mode::AAC_hbr;
+			}
+			else
+			{
+				logte("%s - It is not supported MPEG4-GENERIC audio mode : %s", GetName().CStr(), first_payload->GetFmtp().CStr());
+				return false;
+			}
+
+			auto mpeg4_config = first_payload->GetMpeg4GenericConfig();
+			if (mpeg4_config == nullptr)
+			{
+				logte("%s - Could not parse MPEG4-GENERIC audio config : %s", GetName().CStr(), first_payload->GetFmtp().CStr());
+				return false;
+			}
+
+			auto depacketizer = std::dynamic_pointer_cast<RtpDepacketizerMpeg4GenericAudio>(GetDepacketizer(channel));
+			if (depacketizer->SetConfigParams(mpeg4_mode, first_payload->GetMpeg4GenericSizeLength(), first_payload->GetMpeg4GenericIndexLength(), first_payload->GetMpeg4GenericIndexDeltaLength(), mpeg4_config) == false)
+			{
+				logte("%s - Could not parse MPEG4-GENERIC audio config : %s", GetName().CStr(), first_payload->GetFmtp().CStr());
+				return false;
+			}
+		}
+
+		Stream::AddTrack(track);
+
+		_rtp_rtcp->AddRtpReceiver(channel, track);
+		_lip_sync_clock.RegisterClock(channel, track->GetTimeBase().GetExpr());
+
+		return true;
+	}
+
+	bool RtspStream::AddDepacketizer(uint8_t channel, RtpDepacketizingManager::SupportedDepacketizerType codec_id)
+	{
+		auto depacketizer = RtpDepacketizingManager::Create(codec_id);
+		if (depacketizer == nullptr)
+		{
+			logte("%s - Could not create depacketizer : codec_id(%d)", GetName().CStr(), static_cast<uint8_t>(codec_id));
+			return false;
+		}
+
+		_depacketizers[channel] = depacketizer;
+
+		return true;
+	}
+
+	std::shared_ptr<RtpDepacketizingManager> RtspStream::GetDepacketizer(uint8_t channel)
+	{
+		auto it = _depacketizers.find(channel);
+		if (it == _depacketizers.end())
+		{
+			return nullptr;
+		}
+
+		return it->second;
+	}
+
+	bool RtspStream::CheckAccessControl()
+	{
+		// Check SignedPolicy
+		auto [result, signed_policy] = GetProvider()->VerifyBySignedPolicy(_url, _remote->GetRemoteAddress());
+		if (result == AccessController::VerificationResult::Pass)
+		{
+			_stream_expired_msec = signed_policy->GetStreamExpireEpochMSec();
+		}
+		else if (result == AccessController::VerificationResult::Error)
+		{
+			logtw("SingedPolicy error : %s", _url->ToUrlString().CStr());
+			return false;
+		}
+		else if (result == AccessController::VerificationResult::Fail)
+		{
+			logtw("%s", signed_policy->GetErrMessage().CStr());
+			return false;
+		}
+
+		auto request_info = std::make_shared<AccessController::RequestInfo>(_url, _remote->GetRemoteAddress());
+
+		auto [webhooks_result, admission_webhooks] = GetProvider()->VerifyByAdmissionWebhooks(request_info);
+		if (webhooks_result == AccessController::VerificationResult::Off)
+		{
+			return true;
+		}
+		else if (webhooks_result == AccessController::VerificationResult::Pass)
+		{
+			// Lifetime
+			if (admission_webhooks->GetLifetime() != 0)
+			{
+				// Choice smaller value
+				auto stream_expired_msec_from_webhooks = ov::Clock::NowMSec() + admission_webhooks->GetLifetime();
+				if (_stream_expired_msec == 0 || stream_expired_msec_from_webhooks < _stream_expired_msec)
+				{
+					_stream_expired_msec = stream_expired_msec_from_webhooks;
+				}
+			}
+
+			// Redirect URL
+			if (admission_webhooks->GetNewURL() != nullptr)
+			{
+				_publish_url = admission_webhooks->GetNewURL();
+				SetFinalUrl(_publish_url);
+			}
+
+			return true;
+		}
+		else if (webhooks_result == AccessController::VerificationResult::Error)
+		{
+			logtw("AdmissionWebhooks error : %s", _url->ToUrlString().CStr());
+			return false;
+		}
+		else if (webhooks_result == AccessController::VerificationResult::Fail)
+		{
+			logtw("AdmissionWebhooks error : %s", admission_webhooks->GetErrReason().CStr());
+			return false;
+		}
+
+		return false;
+	}
+
+	bool RtspStream::CheckStreamExpired()
+	{
+		if (_stream_expired_msec != 0 && _stream_expired_msec < ov::Clock::NowMSec())
+		{
+			return true;
+		}
+
+		return false;
+	}
+
+	void RtspStream::UpdateLipSyncMetrics(uint32_t track_id)
+	{
+		auto stats = _lip_sync_clock.GetStats(track_id);
+		if (stats.has_value() == false)
+		{
+			return;
+		}
+
+		auto stream_metrics = StreamMetrics(*this);
+		if (stream_metrics == nullptr)
+		{
+			return;
+		}
+
+		stream_metrics->GetLipSyncMetrics(track_id)->Update(stats->sender_report_count, stats->drift_ppm, stats->alignment_error_us, stats->correction_us);
+	}
+
+	// From RtpRtcp node
+	void RtspStream::OnRtpFrameReceived(const std::vector<std::shared_ptr<RtpPacket>> &rtp_packets)
+	{
+		auto first_rtp_packet = rtp_packets.front();
+		auto channel = first_rtp_packet->GetRtspChannel();
+		logtp("%s", first_rtp_packet->Dump().CStr());
+
+		auto track = GetTrack(channel);
+		if (track == nullptr)
+		{
+			logte("%s - Could not find track : channel_id(%u)", GetName().CStr(), channel);
+			return;
+		}
+
+		auto depacketizer = GetDepacketizer(channel);
+		if (depacketizer == nullptr)
+		{
+			logte("%s - Could not find depacketizer : channel_id(%u)", GetName().CStr(), channel);
+			return;
+		}
+
+		auto &ingest_capture = GetIngestCapture();
+
+		// The H.264 depacketizer copies every payload into a newly assembled frame,
+		// so the payloads can refer to the RTP packets instead of being copied twice
+		bool is_h264 = track->GetCodecId() == cmn::MediaCodecId::H264;
+
+		std::vector<std::shared_ptr<ov::Data>> payload_list;
+		payload_list.reserve(rtp_packets.size());
+		for (const auto &packet : rtp_packets)
+		{
+			if (ingest_capture != nullptr)
+			{
+				ingest_capture->Append(packet->GetData());
+			}
+
+			payload_list.push_back(std::make_shared<ov::Data>(packet->Payload(), packet->PayloadSize(), is_h264));
+		}
+
+		auto bitstream = depacketizer->ParseAndAssembleFrame(payload_list);
+		if (bitstream == nullptr)
+		{
+			logte("%s - Could not depacketize packet : channel_id(%u)", GetName().CStr(), channel);
+			return;
+		}
+
+		cmn::BitstreamFormat bitstream_format;
+		cmn::PacketType packet_type;
+
+		switch (track->GetCodecId())
+		{
+			case cmn::MediaCodecId::H264:
+				// Our H264 depacketizer always converts packet to AnnexB
+				bitstream_format = cmn::BitstreamFormat::H264_ANNEXB;
+				packet_type = cmn::PacketType::NALU;
+				break;
+
+			case cmn::MediaCodecId::H265:
+				// Our H265 depacketizer always converts packet to AnnexB
+				bitstream_format = cmn::BitstreamFormat::H265_ANNEXB;
+				packet_type = cmn::PacketType::NALU;
+				break;
+
+			case cmn::MediaCodecId::Opus:
+				bitstream_format = cmn::BitstreamFormat::OPUS;
+				packet_type = cmn::PacketType::RAW;
+				break;
+
+			// Our AAC depacketizer always converts packet to ADTS
+			case cmn::MediaCodecId::Aac:
+				bitstream_format = cmn::BitstreamFormat::AAC_ADTS;
+				packet_type = cmn::PacketType::RAW;
+				break;
+
+			case cmn::MediaCodecId::Vp8:
+				bitstream_format = cmn::BitstreamFormat::VP8;
+				packet_type = cmn::PacketType::RAW;
+				break;
+
+			// It can't be reached here because it has already failed in GetDepacketizer.
+			default:
+				return;
+		}
+
+		if (_pts_calculation_method == PtsCalculationMethod::UNDER_DECISION)
+		{
+			if (GetTracks().size() == 1)
+			{
+				logti("Since this stream has a single track, it computes PTS alone without RTCP SR.");
+				_pts_calculation_method = PtsCalculationMethod::SINGLE_DELTA;
+			}
+			else if (_lip_sync_clock.IsEnabled() == true)
+			{
+				logti("Since this stream has received an RTCP SR, it counts the PTS with the SR.");
+				_pts_calculation_method = PtsCalculationMethod::WITH_RTCP_SR;
+			}
+			// If it exceeds 5 seconds, it is calculated independently without RTCP SR.
+			else if (_record_request_time.Elapsed() > 5000)
+			{
+				logtw("Since the RTCP SR was not received within 5 seconds, the PTS is calculated for each track without RTCP SR. (Lip-Sync may be out of sync)");
+				_pts_calculation_method = PtsCalculationMethod::SINGLE_DELTA;
+			}
+		}
+
+		int64_t timestamp = 0;
+		if (_pts_calculation_method == PtsCalculationMethod::WITH_RTCP_SR)
+		{
+			auto pts = _lip_sync_clock.CalcPTS(channel, first_rtp_packet->Timestamp());
+			if (pts.has_value() == false)
+			{
+				logtd("not yet received sr packet : %u", first_rtp_packet->Ssrc());
+				// Prevents the stream from being deleted because there is no input data
+				MonitorInstance->IncreaseBytesIn(*Stream::GetSharedPtr(), bitstream->GetLength());
+				return;
+			}
+
+			timestamp = AdjustTimestampByBase(channel, pts.value(), pts.value(), std::numeric_limits<uint64_t>::max());
+		}
+		else if (_pts_calculation_method == PtsCalculationMethod::SINGLE_DELTA)
+		{
+			timestamp = AdjustTimestampByDelta(channel, first_rtp_packet->Timestamp(), std::numeric_limits<uint32_t>::max());
+		}
+		else
+		{
+			logtd("Haven't decided how to calculate pts yet.");
+			// Prevents the stream from being deleted because there is no input data
+			MonitorInstance->IncreaseBytesIn(*Stream::GetSharedPtr(), bitstream->GetLength());
+			return;
+		}
+
+		auto frame = std::make_shared<MediaPacket>(GetMsid(),
+												   track->GetMediaType(),
+												   track->GetId(),
+												   bitstream,
+												   timestamp,
+												   timestamp,
+												   bitstream_format,
+												   packet_type);
+
+		logtp("Send Frame : track_id(%d) codec_id(%d) bitstream_format(%d) packet_type(%d) data_length(%d) pts(%u)", track->GetId(), track->GetCodecId(), bitstream_format, packet_type, bitstream->GetLength(), first_rtp_packet->Timestamp());
+
+		// Send SPS/PPS of the SDP (sprop-parameter-sets) if stream is H264
+		if (_sent_sequence_header == false && track->GetCodecId() == cmn::MediaCodecId::H264 && _h264_extradata_nalu != nullptr)
+		{
+			auto media_packet = std::make_shared<MediaPacket>(GetMsid(),
+															  track->GetMediaType(),
+															  track->GetId(),
+															  _h264_extradata_nalu,
+															  timestamp,
+															  timestamp,
+															  cmn::BitstreamFormat::H264_ANNEXB,
+															  cmn::PacketType::NALU);
+			SendFrame(media_packet);
+			_sent_sequence_header = true;
+		}
+
+		SendFrame(frame);
+	}
+
+	// From RtpRtcp node
+	void RtspStream::OnRtcpReceived(const std::shared_ptr<RtcpInfo> &rtcp_info)
+	{
+		// RTCP Channel is RTP Channel + 1
+		auto channel = rtcp_info->GetRtspChannel() - 1;
+		// Receive Sender Report
+		if (rtcp_info->GetPacketType() == RtcpPacketType::SR)
+		{
+			auto sr = std::dynamic_pointer_cast<SenderReport>(rtcp_info);
+			if (_lip_sync_clock.UpdateSenderReportTime(channel, sr->GetMsw(), sr->GetLsw(), sr->GetTimestamp()) == true)
+			{
+				// The track ID is the RTP channel
+				UpdateLipSyncMetrics(channel);
+			}
+		}
+	}
+
+	// ov::Node Interface
+	// RtpRtcp <-> Edge(this)
+	bool RtspStream::OnDataReceivedFromPrevNode(NodeType from_node, const std::shared_ptr<ov::Data> &data)
+	{
+		if (ov::Node::GetNodeState() != ov::Node::NodeState::Started)
+		{
+			logtd("Node has not started, so the received data has been canceled.");
+			return false;
+		}
+
+		// Receiver reports
+		if (from_node != NodeType::Rtcp)
+		{
+			return false;
+		}
+
+		auto rtcp_packet = _rtp_rtcp->GetLastSentRtcpPacket();
+		if (rtcp_packet == nullptr)
+		{
+			return false;
+		}
+
+		// RTCP Channel ID is RTP channel ID + 1
+		uint8_t channel_id = rtcp_packet->GetRtcpInfo()->GetRtspChannel() + 1;
+
+		// $ + 1 bytes channel id + 2 bytes length + payload
+		auto channel_data = std::make_shared<ov::Data>(RTSP_INTERLEAVED_DATA_HEADER_LEN + data->GetLength());
+		channel_data->SetLength(RTSP_INTERLEAVED_DATA_HEADER_LEN);
+		auto ptr = channel_data->GetWritableDataAs<uint8_t>();
+
+		ptr[0] = '$';
+		ptr[1] = channel_id;
+		ByteWriter<uint16_t>::WriteBigEndian(&ptr[2], data->GetLength());
+		channel_data->Append(data);
+
+		return _remote->Send(channel_data);
+	}
+
+	// RtspStream Node has not a lower node so it will not be called
+	bool RtspStream::OnDataReceivedFromNextNode(NodeType from_node, const std::shared_ptr<const ov::Data> &data)
+	{
+		return true;
+	}
+}  // namespace pvd
@@ -1,18 +1,132 @@
+//==============================================================================
+//
+//  RtspProvider
+//
+//  Created by Getroot
+//  Copyright (c) 2023 AirenSoft. All rights reserved.
+//
+//==============================================================================
+
 #pragma once
 
-#include "base/common_types.h"
-#include "base/provider/stream.h"
+#include <base/common_types.h>
+#include <base/ovlibrary/url.h>
+#include <base/provider/push_provider/stream.h>
+#include <modules/access_control/access_controller.h>
+#include <modules/rtp_rtcp/lip_sync_clock.h>
+#include <modules/rtp_rtcp/rtp_depacketizing_manager.h>
+#include <modules/rtp_rtcp/rtp_rtcp.h>
+#include <modules/rtsp/header_fields/rtsp_header_fields.h>
+#include <modules/rtsp/rtsp_demuxer.h>
+#include <modules/rtsp/rtsp_message.h>
+#include <modules/sdp/session_description.h>
 
-using namespace pvd;
+#define RTSP_SERVER_NAME "OvenMediaEngine"
 
-class RtspStream : public pvd::Stream
+namespace pvd
 {
-public:
-	static std::shared_ptr<RtspStream> Create(const std::shared_ptr<pvd::Application> &application);
+	/*
+	Process of publishing (RTP/AVP/TCP interleaved only)
+
+	 C->S : OPTIONS
+	 C->S : ANNOUNCE (SDP)
+	 C->S : SETUP (Transport: RTP/AVP/TCP;unicast;interleaved=0-1) for each media
+	 C->S : RECORD
+	 C->S : $<channel><length><RTP/RTCP> ...
+	 C->S : TEARDOWN
+	*/
+	class RtspStream : public pvd::PushStream, public RtpRtcpInterface, public ov::Node
+	{
+	public:
+		static std::shared_ptr<RtspStream> Create(uint32_t channel_id, const std::shared_ptr<ov::Socket> &client_socket, const std::shared_ptr<PushProvider> &provider);
+
+		explicit RtspStream(uint32_t channel_id, const std::shared_ptr<ov::Socket> &client_socket, const std::shared_ptr<PushProvider> &provider);
+		~RtspStream() final;
+
+		bool Start() override;
+		bool Stop() override;
+
+		// ------------------------------------------
+		// Implementation of PushStream
+		// ------------------------------------------
+		PushStreamType GetPushStreamType() override
+		{
+			return PushStream::PushStreamType::INTERLEAVED;
+		}
+		bool OnDataReceived(const std::shared_ptr<const ov::Data> &data) override;
+
+		// RtpRtcpInterface Implementation
+		void OnRtpFrameReceived(const std::vector<std::shared_ptr<RtpPacket>> &rtp_packets) override;
+		void OnRtcpReceived(const std::shared_ptr<RtcpInfo> &rtcp_info) override;
+
+		// ov::Node Interface
+		bool OnDataReceivedFromPrevNode(NodeType from_node, const std::shared_ptr<ov::Data> &data) override;
+		bool OnDataReceivedFromNextNode(NodeType from_node, const std::shared_ptr<const ov::Data> &data) override;
+
+	private:
+		bool OnRequestReceived(const std::shared_ptr<RtspMessage> &request);
+
+		bool OnOptions(const std::shared_ptr<RtspMessage> &request);
+		bool OnAnnounce(const std::shared_ptr<RtspMessage> &request);
+		bool OnSetup(const std::shared_ptr<RtspMessage> &request);
+		bool OnRecord(const std::shared_ptr<RtspMessage> &request);
+		bool OnTeardown(const std::shared_ptr<RtspMessage> &request);
+
+		// Makes a response with the Server/Session fields
+		std::shared_ptr<RtspMessage> MakeResponse(const std::shared_ptr<RtspMessage> &request, uint32_t status_code, const ov::String &reason_phrase);
+		bool SendResponse(const std::shared_ptr<RtspMessage> &response);
+		// Sends an error response, and closes the connection if <close> is true
+		bool SendErrorResponse(const std::shared_ptr<RtspMessage> &request, uint32_t status_code, const ov::String &reason_phrase, bool close);
+
+		// Finds the media of the SETUP request by the control attribute
+		std::shared_ptr<const MediaDescription> FindMediaDescription(const ov::String &request_uri) const;
+		// Creates the track of <media_desc> received through the interleaved channel <channel>
+		bool AddTrackFromMedia(uint8_t channel, const std::shared_ptr<const MediaDescription> &media_desc);
+
+		bool AddDepacketizer(uint8_t channel, RtpDepacketizingManager::SupportedDepacketizerType codec_id);
+		std::shared_ptr<RtpDepacketizingManager> GetDepacketizer(uint8_t channel);
+
+		bool CheckAccessControl();
+		bool CheckStreamExpired();
+
+		void UpdateLipSyncMetrics(uint32_t track_id);
+
+		std::shared_ptr<ov::Socket> _remote;
+
+		RtspDemuxer _rtsp_demuxer;
+
+		ov::String _session_id;
+
+		std::shared_ptr<ov::Url> _url;
+		std::shared_ptr<ov::Url> _publish_url;
+		info::VHostAppName _vhost_app_name;
+
+		// Signed policy / admission webhooks
+		uint64_t _stream_expired_msec = 0;
+
+		SessionDescription _sdp;
+		bool _announced = false;
+		// The medias that have been set up
+		std::set<std::shared_ptr<const MediaDescription>> _setup_media_list;
+
+		// Rtp
+		std::shared_ptr<RtpRtcp> _rtp_rtcp;
+		// Channel (Track ID) : Depacketizer
+		std::map<uint8_t, std::shared_ptr<RtpDepacketizingManager>> _depacketizers;
+
+		LipSyncClock _lip_sync_clock;
+		ov::StopWatch _record_request_time;
+
+		enum class PtsCalculationMethod : uint8_t
+		{
+			UNDER_DECISION,
+			SINGLE_DELTA,
+			WITH_RTCP_SR
+		};
 
-public:
-	explicit RtspStream(const std::shared_ptr<pvd::Application> &application);
-	~RtspStream() final;
+		PtsCalculationMethod _pts_calculation_method = PtsCalculationMethod::UNDER_DECISION;
 
-private:
-};
\ No newline at end of file
+		std::shared_ptr<ov::Data> _h264_extradata_nalu = nullptr;
+		bool _sent_sequence_header = false;
+	};
+}  // namespace pvd
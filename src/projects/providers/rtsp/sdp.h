@@ -1,8 +0,0 @@
-#pragma once
-
-#include "rtsp_media_info.h"
-
-#include <cstdint>
-#include <vector>
-
-bool ParseSdp(const std::vector<uint8_t> &sdp, RtspMediaInfo &rtsp_media_info);
\ No newline at end of file
@@ -12,6 +12,7 @@
 #include <base/info/application.h>
 #include <base/ovlibrary/byte_io.h>
 #include <modules/rtp_rtcp/rtp_depacketizer_mpeg4_generic_audio.h>
+#include <modules/rtp_rtcp/rtp_depacketizer_h264.h>
 
 #include "rtspc_provider.h"
 
@@ -44,6 +45,10 @@ namespace pvd
 		: pvd::PullStream(application, stream_info, url_list, properties), Node(NodeType::Rtsp)
 	{
 		SetState(State::IDLE);
+
+		_key_frame_only = application->GetConfig().GetProviders().GetRtspPullProvider().IsKeyFrameOnly();
+		_predictive_lip_sync = application->GetConfig().GetProviders().GetRtspPullProvider().IsPredictiveLipSync();
+		_lip_sync_clock.SetPredictive(_predictive_lip_sync);
 	}
 
 	RtspcStream::~RtspcStream()
@@ -52,6 +57,23 @@ namespace pvd
 		Release();
 	}
 
+	void RtspcStream::UpdateLipSyncMetrics(uint32_t track_id)
+	{
+		auto stats = _lip_sync_clock.GetStats(track_id);
+		if (stats.has_value() == false)
+		{
+			return;
+		}
+
+		auto stream_metrics = StreamMetrics(*this);
+		if (stream_metrics == nullptr)
+		{
+			return;
+		}
+
+		stream_metrics->GetLipSyncMetrics(track_id)->Update(stats->sender_report_count, stats->drift_ppm, stats->alignment_error_us, stats->correction_us);
+	}
+
 	std::shared_ptr<pvd::RtspcProvider> RtspcStream::GetRtspcProvider()
 	{
 		return std::static_pointer_cast<RtspcProvider>(_application->GetParentProvider());
@@ -175,6 +197,12 @@ namespace pvd
 		return true;
 	}
 
+	uint16_t RtspcStream::GetProbePort(const std::shared_ptr<const ov::Url> &url)
+	{
+		// 554 is default port of RTSP
+		return (url->Port() == 0) ? 554 : static_cast<uint16_t>(url->Port());
+	}
+
 	bool RtspcStream::ConnectTo()
 	{
 		if (GetState() == State::PLAYING || GetState() == State::TERMINATED)
@@ -936,10 +964,15 @@ namespace pvd
 			return;
 		}
 
+		// The H.264 depacketizer copies every payload into a newly assembled frame,
+		// so the payloads can refer to the RTP packets instead of being copied twice
+		bool is_h264 = track->GetCodecId() == cmn::MediaCodecId::H264;
+
 		std::vector<std::shared_ptr<ov::Data>> payload_list;
+		payload_list.reserve(rtp_packets.size());
 		for (const auto &packet : rtp_packets)
 		{
-			auto payload = std::make_shared<ov::Data>(packet->Payload(), packet->PayloadSize());
+			auto payload = std::make_shared<ov::Data>(packet->Payload(), packet->PayloadSize(), is_h264);
 			payload_list.push_back(payload);
 		}
 
@@ -950,6 +983,14 @@ namespace pvd
 			return;
 		}
 
+		if (_key_frame_only == true && is_h264 == true &&
+			std::static_pointer_cast<RtpDepacketizerH264>(depacketizer)->IsKeyframe() == false)
+		{
+			// Prevents the stream from being deleted because there is no input data
+			MonitorInstance->IncreaseBytesIn(*Stream::GetSharedPtr(), bitstream->GetLength());
+			return;
+		}
+
 		cmn::BitstreamFormat bitstream_format;
 		cmn::PacketType packet_type;
 
@@ -994,6 +1035,11 @@ namespace pvd
 				logti("Since this stream has received an RTCP SR, it counts the PTS with the SR.");
 				_pts_calculation_method = PtsCalculationMethod::WITH_RTCP_SR;
 			}
+			else if (_predictive_lip_sync == true)
+			{
+				logti("Since predictive lip sync is enabled, it counts the PTS from the arrival time until an RTCP SR is received.");
+				_pts_calculation_method = PtsCalculationMethod::WITH_RTCP_SR;
+			}
 			// If it exceeds 5 seconds, it is calculated independently without RTCP SR.
 			else if (_lip_sync_clock.IsEnabled() == false && _play_request_time.Elapsed() > 5000)
 			{
@@ -1073,7 +1119,11 @@ namespace pvd
 		if (rtcp_info->GetPacketType() == RtcpPacketType::SR)
 		{
 			auto sr = std::dynamic_pointer_cast<SenderReport>(rtcp_info);
-			_lip_sync_clock.UpdateSenderReportTime(channel, sr->GetMsw(), sr->GetLsw(), sr->GetTimestamp());
+			if (_lip_sync_clock.UpdateSenderReportTime(channel, sr->GetMsw(), sr->GetLsw(), sr->GetTimestamp()) == true)
+			{
+				// The track ID is the RTP channel
+				UpdateLipSyncMetrics(channel);
+			}
 		}
 	}
 
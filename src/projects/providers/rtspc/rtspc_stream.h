@@ -102,6 +102,7 @@ namespace pvd
 		bool StartStream(const std::shared_ptr<const ov::Url> &url) override; // Start
 		bool RestartStream(const std::shared_ptr<const ov::Url> &url) override; // Failover
 		bool StopStream() override; // Stop
+		uint16_t GetProbePort(const std::shared_ptr<const ov::Url> &url) override;
 
 		bool ConnectTo();
 		bool RequestDescribe();
@@ -160,6 +161,7 @@ namespace pvd
 		std::map<uint8_t, uint32_t>			_timestamp_map;
 
 		LipSyncClock 						_lip_sync_clock;
+		void UpdateLipSyncMetrics(uint32_t track_id);
 		ov::StopWatch						_play_request_time;
 
 		enum class PtsCalculationMethod : uint8_t
@@ -173,6 +175,11 @@ namespace pvd
 
 		bool _sent_sequence_header = false;
 
+		// If true, non-key H.264 frames are dropped here so that nothing downstream has to decode them
+		bool _key_frame_only = false;
+		// Forwards the packets before the RTCP SR arrives (See LipSyncClock::SetPredictive())
+		bool _predictive_lip_sync = false;
+
 		// Statistics
 		int64_t _origin_request_time_msec = 0;
 		int64_t _origin_response_time_msec = 0;
@@ -64,42 +64,53 @@ namespace pvd
 			return true;
 		}
 
-		std::vector<ov::SocketAddress> address_list;
-		try
-		{
-			address_list = ov::SocketAddress::Create(server_config.GetIPList(), static_cast<uint16_t>(port_config.GetPort()));
-		}
-		catch (const ov::Error &e)
-		{
-			logte("Could not listen for %s Server: %s", GetProviderName(), e.What());
-			return false;
-		}
-
+		// libsrt accepts only one listener per UDP port, so the load is distributed over multiple ports
+		// (each port has its own multiplexer and receive thread in libsrt)
 		bool result = true;
 		std::vector<ov::String> address_string_list;
 		std::vector<std::shared_ptr<PhysicalPort>> physical_port_list;
 
 		auto physical_port_manager = PhysicalPortManager::GetInstance();
 
-		for (const auto &address : address_list)
+		for (const auto &port : port_config.GetPortList())
 		{
-			auto physical_port = physical_port_manager->CreatePort(
-				"SRT", ov::SocketType::Srt, address, worker_count, 0, 0,
-				[=](const std::shared_ptr<ov::Socket> &socket) -> std::shared_ptr<ov::Error> {
-					return SrtOptionProcessor::SetOptions(socket, srt_bind_config.GetOptions());
-				});
-
-			if (physical_port == nullptr)
+			std::vector<ov::SocketAddress> address_list;
+			try
+			{
+				address_list = ov::SocketAddress::Create(server_config.GetIPList(), static_cast<uint16_t>(port));
+			}
+			catch (const ov::Error &e)
 			{
-				logte("Could not initialize phyiscal port for %s on %s", GetProviderName(), address.ToString().CStr());
+				logte("Could not listen for %s Server: %s", GetProviderName(), e.What());
 				result = false;
 				break;
 			}
 
-			address_string_list.emplace_back(address.ToString());
+			for (const auto &address : address_list)
+			{
+				auto physical_port = physical_port_manager->CreatePort(
+					"SRT", ov::SocketType::Srt, address, worker_count, 0, 0,
+					[=](const std::shared_ptr<ov::Socket> &socket) -> std::shared_ptr<ov::Error> {
+						return SrtOptionProcessor::SetOptions(socket, srt_bind_config.GetOptions());
+					});
+
+				if (physical_port == nullptr)
+				{
+					logte("Could not initialize phyiscal port for %s on %s", GetProviderName(), address.ToString().CStr());
+					result = false;
+					break;
+				}
 
-			physical_port->AddObserver(this);
-			physical_port_list.push_back(physical_port);
+				address_string_list.emplace_back(address.ToString());
+
+				physical_port->AddObserver(this);
+				physical_port_list.push_back(physical_port);
+			}
+
+			if (result == false)
+			{
+				break;
+			}
 		}
 
 		if (result)
@@ -10,6 +10,7 @@
 #include "webrtc_private.h"
 #include "webrtc_application.h"
 
+#include <modules/rtp_rtcp/rtp_header_extension/rtp_header_extension_sdes.h>
 #include <modules/rtp_rtcp/rtp_header_extension/rtp_header_extension_transport_cc.h>
 
 namespace pvd
@@ -103,14 +104,30 @@ namespace pvd
 		payload->SetRtpmap(payload_type_num++, "H264", 90000);
 		payload->SetFmtp(ov::String::FormatString("packetization-mode=1;profile-level-id=%x;level-asymmetry-allowed=1",	0x42e01f));
 		payload->EnableRtcpFb(PayloadAttr::RtcpFbType::CcmFir, true);
+		payload->EnableRtcpFb(PayloadAttr::RtcpFbType::Nack, true);
 		payload->EnableRtcpFb(PayloadAttr::RtcpFbType::NackPli, true);
 		payload->EnableRtcpFb(PayloadAttr::RtcpFbType::TransportCc, true);
 		video_media_desc->AddPayload(payload);
 
+		// H265
+		payload = std::make_shared<PayloadAttr>();
+		payload->SetRtpmap(payload_type_num++, "H265", 90000);
+		payload->EnableRtcpFb(PayloadAttr::RtcpFbType::CcmFir, true);
+		payload->EnableRtcpFb(PayloadAttr::RtcpFbType::Nack, true);
+		payload->EnableRtcpFb(PayloadAttr::RtcpFbType::NackPli, true);
+
+		if (transport_cc_enabled)
+		{
+			payload->EnableRtcpFb(PayloadAttr::RtcpFbType::TransportCc, true);
+		}
+
+		video_media_desc->AddPayload(payload);
+
 		// VP8
 		payload = std::make_shared<PayloadAttr>();
 		payload->SetRtpmap(payload_type_num++, "VP8", 90000);
 		payload->EnableRtcpFb(PayloadAttr::RtcpFbType::CcmFir, true);
+		payload->EnableRtcpFb(PayloadAttr::RtcpFbType::Nack, true);
 		payload->EnableRtcpFb(PayloadAttr::RtcpFbType::NackPli, true);
 		
 		if (transport_cc_enabled)
@@ -228,7 +245,7 @@ namespace pvd
 			// mid
 			answer_media_desc->SetMid(offer_media_desc->GetMid());
 
-			// extmaps : now only support transport-cc
+			// extmaps : now only support transport-cc, mid and rtp-stream-id
 
 			// transport-cc
 			uint8_t extmap_id = 0;
@@ -238,6 +255,29 @@ namespace pvd
 				answer_media_desc->AddExtmap(extmap_id, extmap_attribute);
 			}
 
+			// mid : to find the track of the packets if the SSRC is not in the offer
+			if (offer_media_desc->FindExtmapItem(RTP_HEADER_EXTENSION_MID_ATTRIBUTE, extmap_id, extmap_attribute))
+			{
+				answer_media_desc->AddExtmap(extmap_id, extmap_attribute);
+			}
+
+			// rtp-stream-id : simulcast layers are identified by the RID, since their SSRCs are not in the offer
+			if ((offer_media_desc->GetMediaType() == MediaDescription::MediaType::Video) &&
+				(offer_media_desc->IsSimulcast() == true) &&
+				(offer_media_desc->GetSimulcastDirection() == "send") &&
+				offer_media_desc->FindExtmapItem(RTP_HEADER_EXTENSION_RID_ATTRIBUTE, extmap_id, extmap_attribute))
+			{
+				answer_media_desc->AddExtmap(extmap_id, extmap_attribute);
+
+				// Receives all layers, each layer becomes a track of the stream
+				for (const auto &rid : offer_media_desc->GetSimulcastRidList())
+				{
+					answer_media_desc->AddRid(rid);
+				}
+
+				answer_media_desc->SetSimulcast("recv", offer_media_desc->GetSimulcastRidList());
+			}
+
 			// a=candidate
 			for (const auto &ice_candidate : ice_candidates)
 			{
@@ -248,6 +288,7 @@ namespace pvd
 			for (auto &offer_payload : offer_media_desc->GetPayloadList())
 			{
 				if (offer_payload->GetCodec() != PayloadAttr::SupportCodec::H264 && 
+					offer_payload->GetCodec() != PayloadAttr::SupportCodec::H265 && 
 					offer_payload->GetCodec() != PayloadAttr::SupportCodec::VP8 && 
 					offer_payload->GetCodec() != PayloadAttr::SupportCodec::OPUS)
 				{
@@ -267,6 +308,12 @@ namespace pvd
 					answer_payload->EnableRtcpFb(PayloadAttr::RtcpFbType::CcmFir, true);
 				}
 
+				// NACK
+				if (offer_payload->IsRtcpFbEnabled(PayloadAttr::RtcpFbType::Nack))
+				{
+					answer_payload->EnableRtcpFb(PayloadAttr::RtcpFbType::Nack, true);
+				}
+
 				// NACK PLI
 				if (offer_payload->IsRtcpFbEnabled(PayloadAttr::RtcpFbType::NackPli))
 				{
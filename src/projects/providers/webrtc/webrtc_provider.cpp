@@ -500,6 +500,7 @@ namespace pvd
 		stream->SetMediaSource(request->GetRemote()->GetRemoteAddressAsUrl());
 		stream->SetRequestedUrl(requested_url);
 		stream->SetFinalUrl(final_url);
+		stream->SetPredictiveLipSync(application->GetConfig().GetProviders().GetWebrtcProvider().IsPredictiveLipSync());
 
 		// The stream of the webrtc provider has already completed signaling at this point.
 		if (PublishChannel(stream->GetId(), final_vhost_app_name, stream) == false)
@@ -658,6 +659,11 @@ namespace pvd
 	WhipObserver::Answer WebRTCProvider::OnSdpOffer(const std::shared_ptr<const http::svr::HttpRequest> &request,
 													const std::shared_ptr<const SessionDescription> &offer_sdp)
 	{
+		if (offer_sdp == nullptr)
+		{
+			return {http::StatusCode::BadRequest, "SDP offer is required"};
+		}
+
 		auto remote_address = request->GetRemote()->GetRemoteAddress();
 		auto final_url = request->GetParsedUri();
 		if (final_url == nullptr || final_url->Host().IsEmpty() || final_url->App().IsEmpty() || final_url->Stream().IsEmpty())
@@ -788,6 +794,7 @@ namespace pvd
 		stream->SetMediaSource(request->GetRemote()->GetRemoteAddressAsUrl());
 		stream->SetRequestedUrl(requested_url);
 		stream->SetFinalUrl(final_url);
+		stream->SetPredictiveLipSync(application->GetConfig().GetProviders().GetWebrtcProvider().IsPredictiveLipSync());
 
 		if (PublishChannel(stream->GetId(), final_vhost_app_name, stream) == false)
 		{
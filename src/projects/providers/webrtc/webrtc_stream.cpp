@@ -47,6 +47,8 @@ namespace pvd
 		_ice_port = ice_port;
 		_certificate = certificate;
 		_session_key = ov::Random::GenerateString(8);
+
+		CreateIngestCapture(mdl::IngestCapture::Format::Pcap);
 	}
 
 	WebRTCStream::~WebRTCStream()
@@ -135,7 +137,9 @@ namespace pvd
 					return false;
 				}
 
-				audio_track->SetId(ssrc);
+				auto track_id = (ssrc != 0) ? ssrc : IssueUniqueTrackId();
+
+				audio_track->SetId(track_id);
 				audio_track->SetMediaType(cmn::MediaType::Audio);
 				audio_track->SetTimeBase(1, samplerate);
 				audio_track->SetAudioTimestampScale(1.0);
@@ -149,13 +153,16 @@ namespace pvd
 					audio_track->GetChannel().SetLayout(cmn::AudioChannel::Layout::LayoutStereo);
 				}
 
-				if (AddDepacketizer(ssrc, depacketizer_type) == false)
+				if (AddDepacketizer(track_id, depacketizer_type) == false)
 				{
 					return false;
 				}
 
 				AddTrack(audio_track);
-				_rtp_rtcp->AddRtpReceiver(ssrc, audio_track);
+				if (AddRtpReceiver(local_media_desc, ssrc, audio_track) == false)
+				{
+					return false;
+				}
 
 				if (_rtp_rtcp->IsTransportCcFeedbackEnabled() == false && first_payload->IsRtcpFbEnabled(PayloadAttr::RtcpFbType::TransportCc) == true)
 				{
@@ -168,52 +175,69 @@ namespace pvd
 					}
 				}
 
-				_lip_sync_clock.RegisterClock(ssrc, audio_track->GetTimeBase().GetExpr());
+				_lip_sync_clock.RegisterClock(track_id, audio_track->GetTimeBase().GetExpr());
 			}
 			else
 			{
-				auto ssrc = peer_media_desc->GetSsrc();
-				ssrc_list.push_back(ssrc);
-
 				// a=rtpmap:100 H264/90000
-				auto codec = first_payload->GetCodec();
-				auto timebase = first_payload->GetCodecRate();
-				RtpDepacketizingManager::SupportedDepacketizerType depacketizer_type;
+				if (local_media_desc->IsSimulcast())
+				{
+					// Each layer becomes a video track, which is identified by the RID since the SSRCs are not in the offer
+					uint8_t rid_extension_id = 0;
+					ov::String rid_extension_uri;
+					if (local_media_desc->FindExtmapItem(RTP_HEADER_EXTENSION_RID_ATTRIBUTE, rid_extension_id, rid_extension_uri) == false)
+					{
+						logte("%s - Simulcast is negotiated without the rtp-stream-id extension", GetName().CStr());
+						return false;
+					}
 
-				auto video_track = std::make_shared<MediaTrack>();
+					_rtp_rtcp->SetRidExtensionId(rid_extension_id);
 
-				video_track->SetId(ssrc);
-				video_track->SetMediaType(cmn::MediaType::Video);
+					for (const auto &rid : local_media_desc->GetSimulcastRidList())
+					{
+						auto video_track = AddVideoTrack(IssueUniqueTrackId(), first_payload);
+						if (video_track == nullptr)
+						{
+							return false;
+						}
 
-				if (codec == PayloadAttr::SupportCodec::H264)
-				{
-					video_track->SetCodecId(cmn::MediaCodecId::H264);
-					video_track->SetOriginBitstream(cmn::BitstreamFormat::H264_RTP_RFC_6184);
-					_h264_extradata_nalu = first_payload->GetH264ExtraDataAsAnnexB();
-					depacketizer_type = RtpDepacketizingManager::SupportedDepacketizerType::H264;
-				}
-				else if (codec == PayloadAttr::SupportCodec::VP8)
-				{
-					video_track->SetCodecId(cmn::MediaCodecId::Vp8);
-					video_track->SetOriginBitstream(cmn::BitstreamFormat::VP8_RTP_RFC_7741);
-					depacketizer_type = RtpDepacketizingManager::SupportedDepacketizerType::VP8;
+						video_track->SetPublicName(rid);
+
+						if (_rtp_rtcp->AddRtpReceiverByRid(rid, video_track->GetId(), video_track) == false)
+						{
+							return false;
+						}
+
+						logti("%s - Simulcast layer (rid: %s) is added as track %u", GetName().CStr(), rid.CStr(), video_track->GetId());
+					}
 				}
 				else
 				{
-					logte("%s - Unsupported video codec  : %s", GetName().CStr(), first_payload->GetCodecParams().CStr());
-					return false;
-				}
+					auto ssrc = peer_media_desc->GetSsrc();
+					ssrc_list.push_back(ssrc);
+
+					auto video_track = AddVideoTrack((ssrc != 0) ? ssrc : IssueUniqueTrackId(), first_payload);
+					if (video_track == nullptr)
+					{
+						return false;
+					}
 
-				video_track->SetTimeBase(1, timebase);
-				video_track->SetVideoTimestampScale(1.0);
+					if (AddRtpReceiver(local_media_desc, ssrc, video_track) == false)
+					{
+						return false;
+					}
+				}
 
-				if (AddDepacketizer(ssrc, depacketizer_type) == false)
+				// The lost packets are requested with NACK, and a key frame is requested if a frame cannot be recovered in time
+				if (first_payload->IsRtcpFbEnabled(PayloadAttr::RtcpFbType::Nack) == true)
 				{
-					return false;
+					_rtp_rtcp->EnableNackFeedback();
 				}
 
-				AddTrack(video_track);
-				_rtp_rtcp->AddRtpReceiver(ssrc, video_track);
+				if (first_payload->IsRtcpFbEnabled(PayloadAttr::RtcpFbType::NackPli) == true)
+				{
+					_rtp_rtcp->EnableKeyframeRequest();
+				}
 
 				if (_rtp_rtcp->IsTransportCcFeedbackEnabled() == false && first_payload->IsRtcpFbEnabled(PayloadAttr::RtcpFbType::TransportCc) == true)
 				{
@@ -225,8 +249,6 @@ namespace pvd
 						_rtp_rtcp->EnableTransportCcFeedback(transport_cc_extension_id);
 					}
 				}
-				
-				_lip_sync_clock.RegisterClock(ssrc, video_track->GetTimeBase().GetExpr());
 			}
 		}
 
@@ -245,8 +267,6 @@ namespace pvd
 		RegisterNextNode(nullptr);
 		ov::Node::Start();
 
-		_fir_timer.Start();
-
 		_sent_sequence_header = false;
 
 		return pvd::Stream::Start();
@@ -257,7 +277,101 @@ namespace pvd
 		return _session_key;
 	}
 
-	bool WebRTCStream::AddDepacketizer(uint8_t payload_type, RtpDepacketizingManager::SupportedDepacketizerType codec_id)
+	void WebRTCStream::SetPredictiveLipSync(bool predictive)
+	{
+		_lip_sync_clock.SetPredictive(predictive);
+	}
+
+	void WebRTCStream::UpdateLipSyncMetrics(uint32_t track_id)
+	{
+		auto stats = _lip_sync_clock.GetStats(track_id);
+		if (stats.has_value() == false)
+		{
+			return;
+		}
+
+		auto stream_metrics = StreamMetrics(*this);
+		if (stream_metrics == nullptr)
+		{
+			return;
+		}
+
+		stream_metrics->GetLipSyncMetrics(track_id)->Update(stats->sender_report_count, stats->drift_ppm, stats->alignment_error_us, stats->correction_us);
+	}
+
+	std::shared_ptr<MediaTrack> WebRTCStream::AddVideoTrack(uint32_t track_id, const std::shared_ptr<const PayloadAttr> &payload)
+	{
+		auto codec = payload->GetCodec();
+		auto timebase = payload->GetCodecRate();
+		RtpDepacketizingManager::SupportedDepacketizerType depacketizer_type;
+
+		auto video_track = std::make_shared<MediaTrack>();
+
+		video_track->SetId(track_id);
+		video_track->SetMediaType(cmn::MediaType::Video);
+
+		if (codec == PayloadAttr::SupportCodec::H264)
+		{
+			video_track->SetCodecId(cmn::MediaCodecId::H264);
+			video_track->SetOriginBitstream(cmn::BitstreamFormat::H264_RTP_RFC_6184);
+			_h264_extradata_nalu = payload->GetH264ExtraDataAsAnnexB();
+			depacketizer_type = RtpDepacketizingManager::SupportedDepacketizerType::H264;
+		}
+		else if (codec == PayloadAttr::SupportCodec::H265)
+		{
+			video_track->SetCodecId(cmn::MediaCodecId::H265);
+			video_track->SetOriginBitstream(cmn::BitstreamFormat::H265_RTP_RFC_7798);
+			depacketizer_type = RtpDepacketizingManager::SupportedDepacketizerType::H265;
+		}
+		else if (codec == PayloadAttr::SupportCodec::VP8)
+		{
+			video_track->SetCodecId(cmn::MediaCodecId::Vp8);
+			video_track->SetOriginBitstream(cmn::BitstreamFormat::VP8_RTP_RFC_7741);
+			depacketizer_type = RtpDepacketizingManager::SupportedDepacketizerType::VP8;
+		}
+		else
+		{
+			logte("%s - Unsupported video codec  : %s", GetName().CStr(), payload->GetCodecParams().CStr());
+			return nullptr;
+		}
+
+		video_track->SetTimeBase(1, timebase);
+		video_track->SetVideoTimestampScale(1.0);
+
+		if (AddDepacketizer(track_id, depacketizer_type) == false)
+		{
+			return nullptr;
+		}
+
+		AddTrack(video_track);
+
+		_lip_sync_clock.RegisterClock(track_id, video_track->GetTimeBase().GetExpr());
+
+		return video_track;
+	}
+
+	bool WebRTCStream::AddRtpReceiver(const std::shared_ptr<const MediaDescription> &local_media_desc, uint32_t ssrc, const std::shared_ptr<MediaTrack> &track)
+	{
+		if (ssrc != 0)
+		{
+			return _rtp_rtcp->AddRtpReceiver(ssrc, track);
+		}
+
+		// Some peers do not put the SSRC in the offer, then the packets are mapped by the MID
+		uint8_t mid_extension_id = 0;
+		ov::String mid_extension_uri;
+		if (local_media_desc->FindExtmapItem(RTP_HEADER_EXTENSION_MID_ATTRIBUTE, mid_extension_id, mid_extension_uri) == false)
+		{
+			logte("%s - There is no SSRC or mid extension in the offer of %s", GetName().CStr(), local_media_desc->GetMediaTypeStr().CStr());
+			return false;
+		}
+
+		_rtp_rtcp->SetMidExtensionId(mid_extension_id);
+
+		return _rtp_rtcp->AddRtpReceiverByMid(local_media_desc->GetMid(), track->GetId(), track);
+	}
+
+	bool WebRTCStream::AddDepacketizer(uint32_t track_id, RtpDepacketizingManager::SupportedDepacketizerType codec_id)
 	{
 		// Depacketizer
 		auto depacketizer = RtpDepacketizingManager::Create(codec_id);
@@ -267,14 +381,14 @@ namespace pvd
 			return false;
 		}
 
-		_depacketizers[payload_type] = depacketizer;
+		_depacketizers[track_id] = depacketizer;
 
 		return true;
 	}
 
-	std::shared_ptr<RtpDepacketizingManager> WebRTCStream::GetDepacketizer(uint8_t payload_type)
+	std::shared_ptr<RtpDepacketizingManager> WebRTCStream::GetDepacketizer(uint32_t track_id)
 	{
-		auto it = _depacketizers.find(payload_type);
+		auto it = _depacketizers.find(track_id);
 		if (it == _depacketizers.end())
 		{
 			return nullptr;
@@ -340,26 +454,42 @@ namespace pvd
 	{
 		auto first_rtp_packet = rtp_packets.front();
 		auto ssrc = first_rtp_packet->Ssrc();
+		// Set by RtpRtcp, it is the SSRC unless the track is mapped by the RID/MID
+		auto track_id = first_rtp_packet->GetTrackId();
 		logtp("%s", first_rtp_packet->Dump().CStr());
 
-		auto track = GetTrack(ssrc);
+		auto track = GetTrack(track_id);
 		if (track == nullptr)
 		{
-			logte("%s - Could not find track : ssrc(%u)", GetName().CStr(), ssrc);
+			logte("%s - Could not find track : ssrc(%u) track(%u)", GetName().CStr(), ssrc, track_id);
 			return;
 		}
 
-		auto depacketizer = GetDepacketizer(ssrc);
+		auto depacketizer = GetDepacketizer(track_id);
 		if (depacketizer == nullptr)
 		{
-			logte("%s - Could not find depacketizer : ssrc(%u", GetName().CStr(), ssrc);
+			logte("%s - Could not find depacketizer : ssrc(%u) track(%u)", GetName().CStr(), ssrc, track_id);
 			return;
 		}
 
+		if (ssrc != track_id)
+		{
+			// To find the clock of the sender report
+			_ssrc_track_ids[ssrc] = track_id;
+		}
+
+		auto &ingest_capture = GetIngestCapture();
+
 		std::vector<std::shared_ptr<ov::Data>> payload_list;
 		for (const auto &packet : rtp_packets)
 		{
 			logtp("%s", packet->Dump().CStr());
+
+			if (ingest_capture != nullptr)
+			{
+				ingest_capture->Append(packet->GetData());
+			}
+
 			auto payload = std::make_shared<ov::Data>(packet->Payload(), packet->PayloadSize());
 			payload_list.push_back(payload);
 		}
@@ -382,6 +512,12 @@ namespace pvd
 				packet_type = cmn::PacketType::NALU;
 				break;
 
+			case cmn::MediaCodecId::H265:
+				// Our H265 depacketizer always converts packet to Annex B
+				bitstream_format = cmn::BitstreamFormat::H265_ANNEXB;
+				packet_type = cmn::PacketType::NALU;
+				break;
+
 			case cmn::MediaCodecId::Opus:
 				bitstream_format = cmn::BitstreamFormat::OPUS;
 				packet_type = cmn::PacketType::RAW;
@@ -397,7 +533,7 @@ namespace pvd
 				return;
 		}
 
-		auto pts = _lip_sync_clock.CalcPTS(first_rtp_packet->Ssrc(), first_rtp_packet->Timestamp());
+		auto pts = _lip_sync_clock.CalcPTS(track_id, first_rtp_packet->Timestamp());
 		if(pts.has_value() == false)
 		{
 			logtd("not yet received sr packet : %u", first_rtp_packet->Ssrc());
@@ -417,6 +553,24 @@ namespace pvd
 												   bitstream_format,
 												   packet_type);
 
+		// The WebRTC publisher relays these packets instead of packetizing the frame again (video only, see RtpPacketizer::Relay())
+		if ((track->GetMediaType() == cmn::MediaType::Video) && GetApplicationInfo().GetConfig().GetPublishers().GetWebrtcPublisher().IsRtpRelayEnabled())
+		{
+			std::vector<std::shared_ptr<const RtpPacket>> origin_rtp_packets;
+			origin_rtp_packets.reserve(rtp_packets.size());
+
+			for (const auto &packet : rtp_packets)
+			{
+				// Padding only packets (e.g. bandwidth probing) are not relayed
+				if (packet->PayloadSize() > 0)
+				{
+					origin_rtp_packets.push_back(packet);
+				}
+			}
+
+			frame->SetOriginRtpPackets(std::move(origin_rtp_packets));
+		}
+
 		logtp("Send Frame : track_id(%d) codec_id(%d) bitstream_format(%d) packet_type(%d) data_length(%d) pts(%u)", track->GetId(), track->GetCodecId(), bitstream_format, packet_type, bitstream->GetLength(), first_rtp_packet->Timestamp());
 
 		// This may not work since almost WebRTC browser sends SRS/PPS in-band
@@ -436,10 +590,15 @@ namespace pvd
 
 		SendFrame(frame);
 
-		// Send FIR to reduce keyframe interval
-		if (_fir_timer.IsElapsed(3000) && track->GetMediaType() == cmn::MediaType::Video)
+		// Send FIR to reduce keyframe interval (of each simulcast layer, so the viewers can switch the layers quickly)
+		auto &fir_timer = _fir_timers[track_id];
+		if (fir_timer.IsStart() == false)
+		{
+			fir_timer.Start();
+		}
+		else if (fir_timer.IsElapsed(3000) && track->GetMediaType() == cmn::MediaType::Video)
 		{
-			_fir_timer.Update();
+			fir_timer.Update();
 			//_rtp_rtcp->SendPLI(first_rtp_packet->Ssrc());
 			_rtp_rtcp->SendFIR(first_rtp_packet->Ssrc());
 		}
@@ -454,7 +613,18 @@ namespace pvd
 		if (rtcp_info->GetPacketType() == RtcpPacketType::SR)
 		{
 			auto sr = std::dynamic_pointer_cast<SenderReport>(rtcp_info);
-			_lip_sync_clock.UpdateSenderReportTime(sr->GetSenderSsrc(), sr->GetMsw(), sr->GetLsw(), sr->GetTimestamp());
+
+			auto track_id = sr->GetSenderSsrc();
+			auto ssrc_it = _ssrc_track_ids.find(track_id);
+			if (ssrc_it != _ssrc_track_ids.end())
+			{
+				track_id = ssrc_it->second;
+			}
+
+			if (_lip_sync_clock.UpdateSenderReportTime(track_id, sr->GetMsw(), sr->GetLsw(), sr->GetTimestamp()) == true)
+			{
+				UpdateLipSyncMetrics(track_id);
+			}
 		}
 	}
 
@@ -48,6 +48,9 @@ namespace pvd
 		// Get the session key of the stream
 		ov::String GetSessionKey() const;
 
+		// Forwards the packets before the RTCP SR arrives (See LipSyncClock::SetPredictive())
+		void SetPredictiveLipSync(bool predictive);
+
 		// ------------------------------------------
 		// Implementation of PushStream
 		// ------------------------------------------
@@ -66,10 +69,16 @@ namespace pvd
 		bool OnDataReceivedFromNextNode(NodeType from_node, const std::shared_ptr<const ov::Data> &data) override;
 
 	private:
-		bool AddDepacketizer(uint8_t payload_type, RtpDepacketizingManager::SupportedDepacketizerType codec_id);
-		std::shared_ptr<RtpDepacketizingManager> GetDepacketizer(uint8_t payload_type);
+		// Creates the video track of <payload> and its depacketizer
+		std::shared_ptr<MediaTrack> AddVideoTrack(uint32_t track_id, const std::shared_ptr<const PayloadAttr> &payload);
+		// Adds the RTP receiver of the track by the SSRC of the offer, or by the MID if the offer has no SSRC
+		bool AddRtpReceiver(const std::shared_ptr<const MediaDescription> &local_media_desc, uint32_t ssrc, const std::shared_ptr<MediaTrack> &track);
+
+		bool AddDepacketizer(uint32_t track_id, RtpDepacketizingManager::SupportedDepacketizerType codec_id);
+		std::shared_ptr<RtpDepacketizingManager> GetDepacketizer(uint32_t track_id);
 
-		ov::StopWatch _fir_timer;
+		// Track ID : FIR timer
+		std::map<uint32_t, ov::StopWatch> _fir_timers;
 
 		ov::String _session_key;
 
@@ -85,10 +94,14 @@ namespace pvd
 		bool								_rtx_enabled = false;
 		std::shared_mutex					_start_stop_lock;
 
-		// Payload type, Depacketizer
-		std::map<uint8_t, std::shared_ptr<RtpDepacketizingManager>> _depacketizers;
+		// Track ID, Depacketizer
+		std::map<uint32_t, std::shared_ptr<RtpDepacketizingManager>> _depacketizers;
 
+		// The clocks are registered by the track ID
 		LipSyncClock 						_lip_sync_clock;
+		void UpdateLipSyncMetrics(uint32_t track_id);
+		// SSRC : Track ID, of the tracks mapped by the RID/MID (e.g. simulcast layers)
+		std::unordered_map<uint32_t, uint32_t> _ssrc_track_ids;
 
 		std::shared_ptr<ov::Data> _h264_extradata_nalu = nullptr;
 		bool _sent_sequence_header = false;
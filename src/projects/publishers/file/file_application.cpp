@@ -18,6 +18,18 @@ std::shared_ptr<FileApplication> FileApplication::Create(const std::shared_ptr<p
 FileApplication::FileApplication(const std::shared_ptr<pub::Publisher> &publisher, const info::Application &application_info)
 	: Application(publisher, application_info)
 {
+	// Data packets are not supported
+	SetSubscription(MediaRouteSubscription().SetMediaTypes({cmn::MediaType::Video, cmn::MediaType::Audio}));
+
+	auto file_config = application_info.GetConfig().GetPublishers().GetFilePublisher();
+
+	bool is_parsed;
+	const auto &cross_domains = file_config.GetCrossDomainList(&is_parsed);
+
+	if (is_parsed)
+	{
+		_cors_manager.SetCrossDomains(application_info.GetName(), cross_domains);
+	}
 }
 
 FileApplication::~FileApplication()
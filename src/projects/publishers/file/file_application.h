@@ -3,6 +3,7 @@
 #include <base/common_types.h>
 #include <base/info/session.h>
 #include <base/publisher/application.h>
+#include <modules/http/http.h>
 
 #include "file_stream.h"
 #include "file_userdata.h"
@@ -16,6 +17,11 @@ namespace pub
 		FileApplication(const std::shared_ptr<pub::Publisher> &publisher, const info::Application &application_info);
 		~FileApplication() final;
 
+		const http::CorsManager &GetCorsManager() const
+		{
+			return _cors_manager;
+		}
+
 	private:
 		bool Start() override;
 		bool Stop() override;
@@ -38,5 +44,7 @@ namespace pub
 
 	private:
 		FileUserdataSets _userdata_sets;
+
+		http::CorsManager _cors_manager;
 	};
 }  // namespace pub
\ No newline at end of file
@@ -0,0 +1,22 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "file_interceptor.h"
+
+#include "file_private.h"
+
+bool FileInterceptor::IsInterceptorForRequest(const std::shared_ptr<const http::svr::HttpExchange> &client)
+{
+	const auto request = client->GetRequest();
+
+	if (request->GetMethod() != http::Method::Get)
+	{
+		return false;
+	}
+
+	return request->GetRequestTarget().IndexOf("/" FILE_VOD_PATH_PREFIX "/") >= 0;
+}
@@ -0,0 +1,29 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <modules/http/server/http_server.h>
+
+// The recorded files are served at http[s]://<host>:<port>/<app>/_vod/<path relative to the RootPath>
+#define FILE_VOD_PATH_PREFIX "_vod"
+
+class FileInterceptor : public http::svr::DefaultInterceptor
+{
+public:
+	FileInterceptor()
+	{
+	}
+
+	~FileInterceptor() = default;
+
+protected:
+	//--------------------------------------------------------------------
+	// Implementation of HttpRequestInterceptorInterface
+	//--------------------------------------------------------------------
+	bool IsInterceptorForRequest(const std::shared_ptr<const http::svr::HttpExchange> &client) override;
+};
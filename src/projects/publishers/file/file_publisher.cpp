@@ -1,9 +1,14 @@
 #include "file_publisher.h"
 
+#include <base/ovlibrary/file.h>
 #include <base/ovlibrary/url.h>
 
 #include "file_private.h"
 
+// Without sendfile() (TLS without kTLS, HTTP/2), the file is read into the send queue of the socket,
+// so a range is served by pieces of this size to keep the queue under the limit
+#define FILE_VOD_MAX_BUFFERED_RANGE_SIZE (8 * 1024 * 1024)
+
 namespace pub
 {
 	std::shared_ptr<FilePublisher> FilePublisher::Create(const cfg::Server &server_config, const std::shared_ptr<MediaRouteInterface> &router)
@@ -30,24 +35,153 @@ namespace pub
 		logtd("FilePublisher has been terminated finally");
 	}
 
+	bool FilePublisher::PrepareHttpServers(
+		const std::vector<ov::String> &ip_list,
+		const bool is_port_configured, const uint16_t port,
+		const bool is_tls_port_configured, const uint16_t tls_port,
+		const int worker_count)
+	{
+		auto http_server_manager = http::svr::HttpServerManager::GetInstance();
+
+		std::vector<std::shared_ptr<http::svr::HttpServer>> http_server_list;
+		std::vector<std::shared_ptr<http::svr::HttpsServer>> https_server_list;
+
+		if (http_server_manager->CreateServers(
+				GetPublisherName(), "File",
+				&http_server_list, &https_server_list,
+				ip_list,
+				is_port_configured, port,
+				is_tls_port_configured, tls_port,
+				nullptr,
+				false,
+				[&](const ov::SocketAddress &address, bool is_https, const std::shared_ptr<http::svr::HttpServer> &http_server) {
+					http_server->AddInterceptor(CreateInterceptor());
+				},
+				worker_count))
+		{
+			_http_server_list = std::move(http_server_list);
+			_https_server_list = std::move(https_server_list);
+
+			return true;
+		}
+
+		http_server_manager->ReleaseServers(&http_server_list);
+		http_server_manager->ReleaseServers(&https_server_list);
+
+		return false;
+	}
+
 	bool FilePublisher::Start()
 	{
-		return Publisher::Start();
+		auto server_config = GetServerConfig();
+
+		// The recorded files are served only if the port is configured
+		const auto &file_bind_config = server_config.GetBind().GetPublishers().GetFile();
+		if (file_bind_config.IsParsed() == false)
+		{
+			return Publisher::Start();
+		}
+
+		bool is_configured = false;
+		auto worker_count = file_bind_config.GetWorkerCount(&is_configured);
+		worker_count = is_configured ? worker_count : HTTP_SERVER_USE_DEFAULT_COUNT;
+
+		bool is_port_configured;
+		auto &port_config = file_bind_config.GetPort(&is_port_configured);
+
+		bool is_tls_port_configured;
+		auto &tls_port_config = file_bind_config.GetTlsPort(&is_tls_port_configured);
+
+		if ((is_port_configured == false) && (is_tls_port_configured == false))
+		{
+			logtw("Serving the recorded files is disabled - No port is configured");
+			return Publisher::Start();
+		}
+
+		return PrepareHttpServers(
+				   server_config.GetIPList(),
+				   is_port_configured, port_config.GetPort(),
+				   is_tls_port_configured, tls_port_config.GetPort(),
+				   worker_count) &&
+			   Publisher::Start();
 	}
 
 	bool FilePublisher::Stop()
 	{
+		auto manager = http::svr::HttpServerManager::GetInstance();
+
+		_http_server_list_mutex.lock();
+		auto http_server_list = std::move(_http_server_list);
+		auto https_server_list = std::move(_https_server_list);
+		_http_server_list_mutex.unlock();
+
+		manager->ReleaseServers(&http_server_list);
+		manager->ReleaseServers(&https_server_list);
+
 		return Publisher::Stop();
 	}
 
 	bool FilePublisher::OnCreateHost(const info::Host &host_info)
 	{
-		return true;
+		bool result = true;
+		auto certificate = host_info.GetCertificate();
+
+		if (certificate != nullptr)
+		{
+			std::lock_guard lock_guard{_http_server_list_mutex};
+
+			for (auto &https_server : _https_server_list)
+			{
+				if (https_server->InsertCertificate(certificate) != nullptr)
+				{
+					result = false;
+				}
+			}
+		}
+
+		return result;
 	}
 
 	bool FilePublisher::OnDeleteHost(const info::Host &host_info)
 	{
-		return true;
+		bool result = true;
+		auto certificate = host_info.GetCertificate();
+
+		if (certificate != nullptr)
+		{
+			std::lock_guard lock_guard{_http_server_list_mutex};
+
+			for (auto &https_server : _https_server_list)
+			{
+				if (https_server->RemoveCertificate(certificate) != nullptr)
+				{
+					result = false;
+				}
+			}
+		}
+
+		return result;
+	}
+
+	bool FilePublisher::OnUpdateCertificate(const info::Host &host_info)
+	{
+		bool result = true;
+		auto certificate = host_info.GetCertificate();
+
+		if (certificate != nullptr)
+		{
+			std::lock_guard lock_guard{_http_server_list_mutex};
+
+			for (auto &https_server : _https_server_list)
+			{
+				if (https_server->InsertCertificate(certificate) != nullptr)
+				{
+					result = false;
+				}
+			}
+		}
+
+		return result;
 	}
 
 	std::shared_ptr<pub::Application> FilePublisher::OnCreatePublisherApplication(const info::Application &application_info)
@@ -71,4 +205,264 @@ namespace pub
 
 		return true;
 	}
-}  // namespace pub
\ No newline at end of file
+
+	static ov::String GetHttpDate(time_t time)
+	{
+		struct tm tm;
+		char buffer[64];
+
+		::gmtime_r(&time, &tm);
+		::strftime(buffer, sizeof(buffer), "%a, %d %b %Y %H:%M:%S GMT", &tm);
+
+		return buffer;
+	}
+
+	static ov::String GetContentType(const ov::String &path)
+	{
+		auto extension = ov::PathManager::ExtractExtension(path);
+
+		if ((extension == "mp4") || (extension == "m4v"))
+		{
+			return "video/mp4";
+		}
+		else if (extension == "m4a")
+		{
+			return "audio/mp4";
+		}
+		else if (extension == "ts")
+		{
+			return "video/MP2T";
+		}
+		else if (extension == "webm")
+		{
+			return "video/webm";
+		}
+		else if (extension == "mp3")
+		{
+			return "audio/mpeg";
+		}
+		else if (extension == "xml")
+		{
+			return "application/xml";
+		}
+
+		return "application/octet-stream";
+	}
+
+	// Parses a single byte range (multiple ranges are not supported, and the whole file is sent for them).
+	// Returns false if the range is not satisfiable
+	static bool ParseRange(const ov::String &range_header, size_t file_size, bool *is_range, size_t *start, size_t *end)
+	{
+		*is_range = false;
+		*start = 0;
+		*end = file_size - 1;
+
+		if ((range_header.HasPrefix("bytes=") == false) || (range_header.IndexOf(',') >= 0))
+		{
+			return true;
+		}
+
+		auto range = range_header.Substring(6).Trim();
+		auto hyphen = range.IndexOf('-');
+
+		if (hyphen < 0)
+		{
+			return true;
+		}
+
+		auto first = range.Substring(0, hyphen).Trim();
+		auto last = range.Substring(hyphen + 1).Trim();
+
+		if (first.IsEmpty())
+		{
+			// bytes=-<suffix length>
+			auto suffix_length = ov::Converter::ToUInt64(last);
+
+			if ((last.IsEmpty()) || (suffix_length == 0) || (file_size == 0))
+			{
+				return false;
+			}
+
+			*start = file_size - std::min<size_t>(suffix_length, file_size);
+		}
+		else
+		{
+			*start = ov::Converter::ToUInt64(first);
+
+			if (last.IsEmpty() == false)
+			{
+				*end = std::min<size_t>(ov::Converter::ToUInt64(last), file_size - 1);
+			}
+
+			if ((*start >= file_size) || (*start > *end))
+			{
+				return false;
+			}
+		}
+
+		*is_range = true;
+		return true;
+	}
+
+	std::shared_ptr<FileInterceptor> FilePublisher::CreateInterceptor()
+	{
+		auto http_interceptor = std::make_shared<FileInterceptor>();
+
+		http_interceptor->Register(http::Method::Get, R"(^/[^/]+/)" FILE_VOD_PATH_PREFIX R"(/.+)", [this](const std::shared_ptr<http::svr::HttpExchange> &exchange) -> http::svr::NextHandler {
+			auto request = exchange->GetRequest();
+			auto response = exchange->GetResponse();
+			auto remote_address = request->GetRemote()->GetRemoteAddress();
+
+			auto send_error = [&](http::StatusCode status_code, const ov::String &message) -> http::svr::NextHandler {
+				response->AppendString(message);
+				response->SetStatusCode(status_code);
+				response->Response();
+				exchange->Release();
+
+				return http::svr::NextHandler::DoNotCall;
+			};
+
+			auto request_url = request->GetParsedUri();
+			if (request_url == nullptr)
+			{
+				logtw("Could not parse request url: %s", request->GetRequestTarget().CStr());
+				return send_error(http::StatusCode::BadRequest, "Could not parse request url");
+			}
+
+			// /<app>/_vod/<relative path>
+			auto prefix = ov::String::FormatString("/%s/" FILE_VOD_PATH_PREFIX "/", request_url->App().CStr());
+			if ((request_url->App().IsEmpty()) || (request_url->Path().HasPrefix(prefix) == false))
+			{
+				return send_error(http::StatusCode::BadRequest, "Invalid request url");
+			}
+
+			auto relative_path = ov::Url::Decode(request_url->Path().Substring(prefix.GetLength()));
+			if (relative_path.IsEmpty() || (relative_path.IndexOf("..") >= 0))
+			{
+				return send_error(http::StatusCode::Forbidden, "Forbidden");
+			}
+
+			auto vhost_app_name = ocst::Orchestrator::GetInstance()->ResolveApplicationNameFromDomain(request_url->Host(), request_url->App());
+			auto application = std::static_pointer_cast<FileApplication>(GetApplicationByName(vhost_app_name));
+			if (application == nullptr)
+			{
+				return send_error(http::StatusCode::NotFound, "Could not found application of file publisher");
+			}
+
+			// Access Control (the admission webhooks are for streams, so only the signed policy is verified)
+			if (IsAccessControlEnabled(request_url))
+			{
+				auto [signed_policy_result, signed_policy] = Publisher::VerifyBySignedPolicy(request_url, remote_address);
+
+				if (signed_policy_result == AccessController::VerificationResult::Error)
+				{
+					return send_error(http::StatusCode::Unauthorized, "Could not verify the signed policy");
+				}
+				else if (signed_policy_result == AccessController::VerificationResult::Fail)
+				{
+					logtw("%s", signed_policy->GetErrMessage().CStr());
+					return send_error(http::StatusCode::Unauthorized, signed_policy->GetErrMessage());
+				}
+			}
+
+			application->GetCorsManager().SetupHttpCorsHeader(vhost_app_name, request, response);
+
+			// The files under the RootPath are served, and nothing is served if RootPath is not configured
+			auto root_path = application->GetConfig().GetPublishers().GetFilePublisher().GetRootPath();
+			auto canonical_root = root_path.IsEmpty() ? "" : ov::PathManager::GetCanonicalPath(root_path.CStr());
+			if (canonical_root.IsEmpty())
+			{
+				return send_error(http::StatusCode::NotFound, "Not found");
+			}
+
+			// Symbolic links must not escape the RootPath
+			auto canonical_path = ov::PathManager::GetCanonicalPath(ov::PathManager::Combine(canonical_root, relative_path).CStr());
+			if (canonical_path.HasPrefix(canonical_root + "/") == false)
+			{
+				return send_error(http::StatusCode::NotFound, "Not found");
+			}
+
+			auto file = ov::OpenedFile::Open(canonical_path);
+			if (file == nullptr)
+			{
+				return send_error(http::StatusCode::NotFound, "Not found");
+			}
+
+			const auto &stat = file->GetStat();
+			auto file_size = file->GetSize();
+			auto etag = ov::String::FormatString("\"%jx-%zx-%jx\"", static_cast<uintmax_t>(stat.st_ino), file_size, static_cast<uintmax_t>(stat.st_mtime));
+
+			response->SetHeader("ETag", etag);
+			response->SetHeader("Last-Modified", GetHttpDate(stat.st_mtime));
+			response->SetHeader("Accept-Ranges", "bytes");
+
+			auto if_none_match = request->GetHeader("If-None-Match");
+			if ((if_none_match.IsEmpty() == false) && ((if_none_match == "*") || (if_none_match.IndexOf(etag) >= 0)))
+			{
+				response->SetStatusCode(http::StatusCode::NotModified);
+				response->Response();
+				exchange->Release();
+				return http::svr::NextHandler::DoNotCall;
+			}
+
+			// The Range is ignored if the file is changed (If-Range with an ETag)
+			auto range_header = request->GetHeader("Range");
+			auto if_range = request->GetHeader("If-Range");
+			if ((if_range.IsEmpty() == false) && (if_range != etag))
+			{
+				range_header = "";
+			}
+
+			bool is_range;
+			size_t start;
+			size_t end;
+			if (ParseRange(range_header, file_size, &is_range, &start, &end) == false)
+			{
+				response->SetHeader("Content-Range", ov::String::FormatString("bytes */%zu", file_size));
+				return send_error(http::StatusCode::RangeNotSatisfiable, "Range not satisfiable");
+			}
+
+			if ((response->IsSendFileAvailable() == false) && (file_size > 0) && ((end - start + 1) > FILE_VOD_MAX_BUFFERED_RANGE_SIZE))
+			{
+				// The players request the rest with the next Range
+				end = start + FILE_VOD_MAX_BUFFERED_RANGE_SIZE - 1;
+				is_range = true;
+			}
+
+			auto length = (file_size > 0) ? (end - start + 1) : 0;
+
+			response->SetHeader("Content-Type", GetContentType(canonical_path));
+
+			if (is_range)
+			{
+				response->SetHeader("Content-Range", ov::String::FormatString("bytes %zu-%zu/%zu", start, end, file_size));
+				response->SetStatusCode(http::StatusCode::PartialContent);
+			}
+			else
+			{
+				response->SetStatusCode(http::StatusCode::OK);
+			}
+
+			// Recordings are usually read from the start to the end, and the pages stay in the page cache
+			// (no POSIX_FADV_DONTNEED), so the recent recordings requested by many viewers are read from the disk once
+			file->AdviseSequential();
+
+			if ((length > 0) && (response->AppendFile(file, static_cast<off_t>(start), length) == false))
+			{
+				return send_error(http::StatusCode::InternalServerError, "Could not send the file");
+			}
+
+			auto sent_size = response->Response();
+			exchange->Release();
+
+			if (sent_size < 0)
+			{
+				logtd("Could not send the file: %s (%s)", canonical_path.CStr(), request->GetRemote()->ToString().CStr());
+			}
+
+			return http::svr::NextHandler::DoNotCall;
+		});
+
+		return http_interceptor;
+	}
+}  // namespace pub
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <modules/http/server/http_server_manager.h>
 #include <orchestrator/orchestrator.h>
 
 #include "base/common_types.h"
@@ -8,6 +9,7 @@
 #include "base/ovlibrary/url.h"
 #include "base/publisher/publisher.h"
 #include "file_application.h"
+#include "file_interceptor.h"
 #include "file_userdata.h"
 
 namespace pub
@@ -21,6 +23,13 @@ namespace pub
 		~FilePublisher() override;
 		bool Stop() override;
 
+	protected:
+		bool PrepareHttpServers(
+			const std::vector<ov::String> &ip_list,
+			const bool is_port_configured, const uint16_t port,
+			const bool is_tls_port_configured, const uint16_t tls_port,
+			const int worker_count);
+
 	private:
 		bool Start() override;
 
@@ -38,9 +47,16 @@ namespace pub
 
 		bool OnCreateHost(const info::Host &host_info) override;
 		bool OnDeleteHost(const info::Host &host_info) override;
+		bool OnUpdateCertificate(const info::Host &host_info) override;
 		std::shared_ptr<pub::Application> OnCreatePublisherApplication(const info::Application &application_info) override;
 		bool OnDeletePublisherApplication(const std::shared_ptr<pub::Application> &application) override;
 
+		std::shared_ptr<FileInterceptor> CreateInterceptor();
+
+		std::mutex _http_server_list_mutex;
+		std::vector<std::shared_ptr<http::svr::HttpServer>> _http_server_list;
+		std::vector<std::shared_ptr<http::svr::HttpsServer>> _https_server_list;
+
 	public:
 		enum FilePublisherStatusCode
 		{
@@ -153,6 +153,11 @@ namespace pub
 			_writer->SetTimestampRecalcMode(FileWriter::TIMESTAMP_STARTZERO_MODE);
 		}
 
+		if (output_format == "mp4")
+		{
+			_writer->SetFragmentedMp4(IsFragmentedMp4());
+		}
+
 		logtd("Create temporary file(%s)", _writer->GetPath().CStr());
 
 		for (auto &track_item : GetStream()->GetTracks())
@@ -190,6 +195,7 @@ namespace pub
 			track_info->SetHeight(track->GetHeight());
 			track_info->SetSample(track->GetSample());
 			track_info->SetChannel(track->GetChannel());
+			track_info->SetMediaTrack(track);
 
 			// Set DecoderSpecificInfo
 			if (track->GetCodecId() == cmn::MediaCodecId::H264)
@@ -396,13 +402,7 @@ namespace pub
 
 		if (_writer != nullptr)
 		{
-			bool ret = _writer->PutData(
-				session_packet->GetTrackId(),
-				session_packet->GetPts(),
-				session_packet->GetDts(),
-				session_packet->GetFlag(),
-				session_packet->GetBitstreamFormat(),
-				session_packet->GetData());
+			bool ret = _writer->PutData(session_packet);
 
 			if (ret == false)
 			{
@@ -417,6 +417,7 @@ namespace pub
 
 			GetRecord()->UpdateRecordTime();
 			GetRecord()->IncreaseRecordBytes(session_packet->GetData()->GetLength());
+			GetRecord()->SetWriterStatistics(_writer->GetDroppedPacketCount(), _writer->GetAverageWriteLatencyUs(), _writer->GetMaxWriteLatencyUs());
 		}
 	}
 
@@ -438,6 +439,14 @@ namespace pub
 		return file_config.GetRootPath();
 	}
 
+	bool FileSession::IsFragmentedMp4()
+	{
+		auto app_config = std::static_pointer_cast<info::Application>(GetApplication())->GetConfig();
+		auto file_config = app_config.GetPublishers().GetFilePublisher();
+
+		return file_config.IsFragmentedMp4();
+	}
+
 	ov::String FileSession::GetOutputTempFilePath(std::shared_ptr<info::Record> &record)
 	{
 		ov::String tmp_directory = ov::PathManager::ExtractPath(record->GetOutputFilePath());
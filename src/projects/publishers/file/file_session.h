@@ -34,6 +34,7 @@ namespace pub
 
 	private:
 		ov::String GetRootPath();
+		bool IsFragmentedMp4();
 		ov::String GetOutputTempFilePath(std::shared_ptr<info::Record> &record);
 		ov::String GetOutputFilePath();
 		ov::String GetOutputFileInfoPath();
@@ -10,7 +10,8 @@
 #include "llhls_chunklist.h"
 #include "llhls_private.h"
 
-#include <base/ovlibrary/zip.h>
+// Maximum number of the chunklists with query strings kept for a version of the chunklist
+#define MAX_CACHED_QUERY_CHUNKLIST_COUNT 64
 
 LLHlsChunklist::LLHlsChunklist(const ov::String &url, const std::shared_ptr<const MediaTrack> &track, uint32_t target_duration, double part_target_duration, const ov::String &map_uri)
 {
@@ -106,7 +107,7 @@ bool LLHlsChunklist::AppendSegmentInfo(const SegmentInfo &info)
 
 	segment->SetCompleted();
 
-	UpdateCacheForDefaultChunklist();
+	UpdateCachedChunklists();
 	if (is_new_segment)
 	{
 		_last_segment_sequence = info.GetSequence();
@@ -143,7 +144,7 @@ bool LLHlsChunklist::AppendPartialSegmentInfo(uint32_t segment_sequence, const S
 
 	segment->InsertPartialSegmentInfo(std::make_shared<SegmentInfo>(info));
 	
-	UpdateCacheForDefaultChunklist();
+	UpdateCachedChunklists();
 	_last_partial_segment_sequence = info.GetSequence();
 
 	return true;
@@ -160,22 +161,122 @@ bool LLHlsChunklist::RemoveSegmentInfo(uint32_t segment_sequence)
 	return true;
 }
 
-void LLHlsChunklist::UpdateCacheForDefaultChunklist()
+void LLHlsChunklist::Reset(int64_t first_segment_sequence)
 {
-	ov::String chunklist = MakeChunklist("", false, false);
 	{
-		// lock 
-		std::lock_guard<std::shared_mutex> lock(_cached_default_chunklist_guard);
-		_cached_default_chunklist = chunklist;
+		std::unique_lock<std::shared_mutex> lock(_segments_guard);
+
+		_segments.clear();
+		_deleted_segments = first_segment_sequence;
+
+		_last_segment_sequence = first_segment_sequence - 1;
+		_last_partial_segment_sequence = -1;
 	}
 
+	UpdateCachedChunklists();
+}
+
+void LLHlsChunklist::UpdateCachedChunklists()
+{
+	auto version = ++_chunklist_version;
+
+	for (auto legacy : {false, true})
 	{
-		// lock 
-		std::lock_guard<std::shared_mutex> lock(_cached_default_chunklist_gzip_guard);
-		_cached_default_chunklist_gzip = ov::Zip::CompressGzip(chunklist.ToData(false));
+		auto cached_chunklist = std::make_shared<CachedChunklist>();
+
+		cached_chunklist->version = version;
+		cached_chunklist->created_time_ms = ov::Clock::NowMSec();
+		cached_chunklist->chunklist = MakeChunklist("", false, legacy, false, 0, &cached_chunklist->query_positions);
+		cached_chunklist->data = cached_chunklist->chunklist.ToData(false);
+		cached_chunklist->gzip = Compress(cached_chunklist->data->Clone(), http::ContentEncoding::Gzip);
+
+		// lock
+		std::lock_guard<std::shared_mutex> lock(_cached_chunklists_guard);
+		auto &current = _cached_chunklists[legacy ? 1 : 0];
+		if ((current == nullptr) || (current->version < version))
+		{
+			current = cached_chunklist;
+		}
 	}
 }
 
+std::shared_ptr<LLHlsChunklist::CachedChunklist> LLHlsChunklist::GetCachedChunklist(bool legacy, int64_t max_age_ms) const
+{
+	auto index = legacy ? 1 : 0;
+
+	if (max_age_ms <= 0)
+	{
+		std::shared_lock<std::shared_mutex> lock(_cached_chunklists_guard);
+		return _cached_chunklists[index];
+	}
+
+	{
+		std::shared_lock<std::shared_mutex> lock(_cached_chunklists_guard);
+		auto &micro_cached = _micro_cached_chunklists[index];
+
+		if ((micro_cached != nullptr) && (micro_cached->GetAgeMs() < max_age_ms))
+		{
+			return micro_cached;
+		}
+	}
+
+	std::lock_guard<std::shared_mutex> lock(_cached_chunklists_guard);
+	auto &micro_cached = _micro_cached_chunklists[index];
+
+	// Another thread may have replaced it
+	if ((micro_cached == nullptr) || (micro_cached->GetAgeMs() >= max_age_ms))
+	{
+		micro_cached = _cached_chunklists[index];
+	}
+
+	return micro_cached;
+}
+
+void LLHlsChunklist::SetCompressionLevels(int gzip_level, int brotli_quality)
+{
+	_gzip_level = gzip_level;
+	_brotli_quality = brotli_quality;
+}
+
+std::shared_ptr<const ov::Data> LLHlsChunklist::Compress(const std::shared_ptr<ov::Data> &data, http::ContentEncoding encoding) const
+{
+	switch (encoding)
+	{
+		case http::ContentEncoding::Gzip:
+			return ov::Zip::CompressGzip(data, _gzip_level);
+		case http::ContentEncoding::Brotli:
+			return ov::Zip::CompressBrotli(data, _brotli_quality);
+		case http::ContentEncoding::Identity:
+		default:
+			return data;
+	}
+}
+
+ov::String LLHlsChunklist::SpliceQueryString(const CachedChunklist &cached_chunklist, const ov::String &query_string) const
+{
+	if (query_string.IsEmpty())
+	{
+		return cached_chunklist.chunklist;
+	}
+
+	const auto &chunklist = cached_chunklist.chunklist;
+	auto query = ov::String::FormatString("?%s", query_string.CStr());
+
+	ov::String playlist(chunklist.GetLength() + (query.GetLength() * cached_chunklist.query_positions.size()));
+	size_t offset = 0;
+
+	for (auto position : cached_chunklist.query_positions)
+	{
+		playlist.Append(chunklist.CStr() + offset, position - offset);
+		playlist.Append(query.CStr(), query.GetLength());
+		offset = position;
+	}
+
+	playlist.Append(chunklist.CStr() + offset, chunklist.GetLength() - offset);
+
+	return playlist;
+}
+
 bool LLHlsChunklist::SaveOldSegmentInfo(std::shared_ptr<SegmentInfo> &segment_info)
 {
 	if (_keep_old_segments == false)
@@ -228,7 +329,7 @@ bool LLHlsChunklist::GetLastSequenceNumber(int64_t &msn, int64_t &psn) const
 	return true;
 }
 
-ov::String LLHlsChunklist::MakeChunklist(const ov::String &query_string, bool skip, bool legacy, bool vod, uint32_t vod_start_segment_number) const
+ov::String LLHlsChunklist::MakeChunklist(const ov::String &query_string, bool skip, bool legacy, bool vod, uint32_t vod_start_segment_number, std::vector<size_t> *query_positions) const
 {
 	if (_segments.size() == 0)
 	{
@@ -245,6 +346,18 @@ ov::String LLHlsChunklist::MakeChunklist(const ov::String &query_string, bool sk
 
 	ov::String playlist(20480);
 
+	auto append_query_string = [&]() {
+		if (query_positions != nullptr)
+		{
+			query_positions->push_back(playlist.GetLength());
+		}
+
+		if (query_string.IsEmpty() == false)
+		{
+			playlist.AppendFormat("?%s", query_string.CStr());
+		}
+	};
+
 	playlist.AppendFormat("#EXTM3U\n");
 
 	playlist.AppendFormat("#EXT-X-VERSION:%d\n", 6);
@@ -265,10 +378,7 @@ ov::String LLHlsChunklist::MakeChunklist(const ov::String &query_string, bool sk
 
 	playlist.AppendFormat("#EXT-X-MEDIA-SEQUENCE:%u\n", vod == false ? _segments[0]->GetSequence() : 0);
 	playlist.AppendFormat("#EXT-X-MAP:URI=\"%s", _map_uri.CStr());
-	if (query_string.IsEmpty() == false)
-	{
-		playlist.AppendFormat("?%s", query_string.CStr());
-	}
+	append_query_string();
 	playlist.AppendFormat("\"\n");
 
 	std::shared_lock<std::shared_mutex> segment_lock(_segments_guard);
@@ -285,10 +395,7 @@ ov::String LLHlsChunklist::MakeChunklist(const ov::String &query_string, bool sk
 			playlist.AppendFormat("#EXT-X-PROGRAM-DATE-TIME:%s\n", ov::Converter::ToISO8601String(tp).CStr());
 			playlist.AppendFormat("#EXTINF:%lf,\n", segment->GetDuration());
 			playlist.AppendFormat("%s", segment->GetUrl().CStr());
-			if (query_string.IsEmpty() == false)
-			{
-				playlist.AppendFormat("?%s", query_string.CStr());
-			}
+			append_query_string();
 			playlist.Append("\n");
 		}
 	}
@@ -314,10 +421,7 @@ ov::String LLHlsChunklist::MakeChunklist(const ov::String &query_string, bool sk
 				{
 					playlist.AppendFormat("#EXT-X-PART:DURATION=%lf,URI=\"%s",
 										partial_segment->GetDuration(), partial_segment->GetUrl().CStr());
-					if (query_string.IsEmpty() == false)
-					{
-						playlist.AppendFormat("?%s", query_string.CStr());
-					}
+					append_query_string();
 					playlist.AppendFormat("\"");
 					if (_track->GetMediaType() == cmn::MediaType::Video && partial_segment->IsIndependent() == true)
 					{
@@ -330,10 +434,7 @@ ov::String LLHlsChunklist::MakeChunklist(const ov::String &query_string, bool sk
 						partial_segment == segment->GetPartialSegments().back())
 					{
 						playlist.AppendFormat("#EXT-X-PRELOAD-HINT:TYPE=PART,URI=\"%s", partial_segment->GetNextUrl().CStr());
-						if (query_string.IsEmpty() == false)
-						{
-							playlist.AppendFormat("?%s", query_string.CStr());
-						}
+						append_query_string();
 						playlist.AppendFormat("\"\n");
 					}
 				}
@@ -344,10 +445,7 @@ ov::String LLHlsChunklist::MakeChunklist(const ov::String &query_string, bool sk
 		{
 			playlist.AppendFormat("#EXTINF:%lf,\n", segment->GetDuration());
 			playlist.AppendFormat("%s", segment->GetUrl().CStr());
-			if (query_string.IsEmpty() == false)
-			{
-				playlist.AppendFormat("?%s", query_string.CStr());
-			}
+			append_query_string();
 			playlist.Append("\n");
 		}
 	}
@@ -367,10 +465,7 @@ ov::String LLHlsChunklist::MakeChunklist(const ov::String &query_string, bool sk
 			}
 
 			playlist.AppendFormat("#EXT-X-RENDITION-REPORT:URI=\"%s", rendition->GetUrl().CStr());
-			if (query_string.IsEmpty() == false)
-			{
-				playlist.AppendFormat("?%s", query_string.CStr());
-			}
+			append_query_string();
 			playlist.AppendFormat("\"");
 
 			// LAST-MSN, LAST-PART
@@ -413,11 +508,13 @@ ov::String LLHlsChunklist::ToString(const ov::String &query_string, bool skip, b
 		return "";
 	}
 
-	if (query_string.IsEmpty() && skip == false && legacy == false && vod == false && vod_start_segment_number == 0 && !_cached_default_chunklist.IsEmpty())
+	if (vod == false)
 	{
-		// return cached chunklist for default chunklist
-		std::shared_lock<std::shared_mutex> lock(_cached_default_chunklist_guard);
-		return _cached_default_chunklist;
+		auto cached_chunklist = GetCachedChunklist(legacy);
+		if (cached_chunklist != nullptr)
+		{
+			return SpliceQueryString(*cached_chunklist, query_string);
+		}
 	}
 
 	return MakeChunklist(query_string, skip, legacy, vod, vod_start_segment_number);
@@ -425,11 +522,67 @@ ov::String LLHlsChunklist::ToString(const ov::String &query_string, bool skip, b
 
 std::shared_ptr<const ov::Data> LLHlsChunklist::ToGzipData(const ov::String &query_string, bool skip, bool legacy) const
 {
-	if (query_string.IsEmpty() && skip == false && legacy == false && _cached_default_chunklist_gzip != nullptr)
+	return ToData(query_string, skip, legacy, http::ContentEncoding::Gzip);
+}
+
+std::shared_ptr<const ov::Data> LLHlsChunklist::ToData(const ov::String &query_string, bool skip, bool legacy, http::ContentEncoding encoding, int64_t max_age_ms, int64_t *age_ms, ov::String *etag) const
+{
+	auto cached_chunklist = GetCachedChunklist(legacy, max_age_ms);
+	if (cached_chunklist == nullptr)
+	{
+		return Compress(ToString(query_string, skip, legacy).ToData(false), encoding);
+	}
+
+	if (age_ms != nullptr)
+	{
+		*age_ms = cached_chunklist->GetAgeMs();
+	}
+
+	if (etag != nullptr)
+	{
+		*etag = MakeLLHlsPlaylistETag(_instance_id, cached_chunklist->version, query_string, legacy, encoding);
+	}
+
+	if (query_string.IsEmpty())
+	{
+		switch (encoding)
+		{
+			case http::ContentEncoding::Gzip:
+				return cached_chunklist->gzip;
+
+			case http::ContentEncoding::Brotli: {
+				std::lock_guard<std::mutex> lock(cached_chunklist->query_data_map_guard);
+				if (cached_chunklist->brotli == nullptr)
+				{
+					cached_chunklist->brotli = Compress(cached_chunklist->data->Clone(), encoding);
+				}
+				return cached_chunklist->brotli;
+			}
+
+			case http::ContentEncoding::Identity:
+			default:
+				return cached_chunklist->data;
+		}
+	}
+
+	// The requests with the same query string (the same token) share the data until the chunklist is updated
+	auto key = std::make_pair(query_string, encoding);
+	{
+		std::lock_guard<std::mutex> lock(cached_chunklist->query_data_map_guard);
+		auto item = cached_chunklist->query_data_map.find(key);
+		if (item != cached_chunklist->query_data_map.end())
+		{
+			return item->second;
+		}
+	}
+
+	auto data = Compress(SpliceQueryString(*cached_chunklist, query_string).ToData(false), encoding);
+
+	std::lock_guard<std::mutex> lock(cached_chunklist->query_data_map_guard);
+	if (cached_chunklist->query_data_map.size() < MAX_CACHED_QUERY_CHUNKLIST_COUNT)
 	{
-		std::shared_lock<std::shared_mutex> lock(_cached_default_chunklist_gzip_guard);
-		return _cached_default_chunklist_gzip;
+		cached_chunklist->query_data_map.emplace(key, data);
 	}
 
-	return ov::Zip::CompressGzip(ToString(query_string, skip, legacy).ToData(false));
+	return data;
 }
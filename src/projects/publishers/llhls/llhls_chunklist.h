@@ -9,8 +9,10 @@
 #pragma once
 
 #include <base/ovlibrary/ovlibrary.h>
+#include <base/ovlibrary/zip.h>
 #include <base/info/media_track.h>
 #include <base/mediarouter/media_buffer.h>
+#include <modules/http/http_datastructure.h>
 
 class LLHlsChunklist
 {
@@ -172,13 +174,22 @@ public:
 	const std::shared_ptr<const MediaTrack> &GetTrack() const;
 
 	void SetPartHoldBack(const float &part_hold_back);
+	void SetCompressionLevels(int gzip_level, int brotli_quality);
 
 	bool AppendSegmentInfo(const SegmentInfo &info);
 	bool AppendPartialSegmentInfo(uint32_t segment_sequence, const SegmentInfo &info);
 	bool RemoveSegmentInfo(uint32_t segment_sequence);
+	// Removes all segments, and the next segment starts from <first_segment_sequence> (when the packaging of the track is restarted)
+	void Reset(int64_t first_segment_sequence);
 
 	ov::String ToString(const ov::String &query_string, bool skip, bool legacy, bool vod = false, uint32_t vod_start_segment_number = 0) const;
 	std::shared_ptr<const ov::Data> ToGzipData(const ov::String &query_string, bool skip, bool legacy) const;
+	// The same data object is returned for the identical requests until the chunklist is updated.
+	// If <max_age_ms> is greater than 0, the chunklist rendered within <max_age_ms> is reused (micro-cache for the
+	// requests without delivery directives), and its age is stored in <age_ms>.
+	// <etag> is set to the strong ETag of the returned representation (empty if the chunklist is not cached yet).
+	// The Brotli-compressed chunklist is made for the first request of a version, and shared by the others.
+	std::shared_ptr<const ov::Data> ToData(const ov::String &query_string, bool skip, bool legacy, http::ContentEncoding encoding, int64_t max_age_ms = 0, int64_t *age_ms = nullptr, ov::String *etag = nullptr) const;
 
 	std::shared_ptr<SegmentInfo> GetSegmentInfo(uint32_t segment_sequence) const;
 	bool GetLastSequenceNumber(int64_t &msn, int64_t &psn) const;
@@ -187,7 +198,8 @@ private:
 	int64_t GetSegmentIndex(uint32_t segment_sequence) const;
 	bool SaveOldSegmentInfo(std::shared_ptr<SegmentInfo> &segment_info);
 
-	ov::String MakeChunklist(const ov::String &query_string, bool skip, bool legacy, bool vod = false, uint32_t vod_start_segment_number = 0) const;
+	// If <query_positions> is not nullptr, the offsets of the URIs where the query string is appended are stored
+	ov::String MakeChunklist(const ov::String &query_string, bool skip, bool legacy, bool vod = false, uint32_t vod_start_segment_number = 0, std::vector<size_t> *query_positions = nullptr) const;
 
 	std::shared_ptr<const MediaTrack> _track;
 
@@ -212,11 +224,48 @@ private:
 	std::map<int32_t, std::shared_ptr<LLHlsChunklist>> _renditions;
 	mutable std::shared_mutex _renditions_guard;
 
-	ov::String _cached_default_chunklist;
-	mutable std::shared_mutex _cached_default_chunklist_guard;
+	// A chunklist rendered without query string, and the query string is spliced in at <query_positions>
+	struct CachedChunklist
+	{
+		uint64_t version = 0;
+		uint64_t created_time_ms = 0;
 
-	std::shared_ptr<ov::Data> _cached_default_chunklist_gzip;
-	mutable std::shared_mutex _cached_default_chunklist_gzip_guard;
+		int64_t GetAgeMs() const
+		{
+			return static_cast<int64_t>(ov::Clock::NowMSec() - created_time_ms);
+		}
 
-	void UpdateCacheForDefaultChunklist();
+		ov::String chunklist;
+		std::vector<size_t> query_positions;
+		std::shared_ptr<const ov::Data> data;
+		std::shared_ptr<const ov::Data> gzip;
+		// Made when it is requested first (guarded by query_data_map_guard)
+		std::shared_ptr<const ov::Data> brotli;
+
+		// (query string, encoding) -> data of the chunklist with the query string
+		std::map<std::pair<ov::String, http::ContentEncoding>, std::shared_ptr<const ov::Data>> query_data_map;
+		std::mutex query_data_map_guard;
+	};
+
+	// _HLS_skip=YES is not implemented yet, so the delta form is the same as the full form
+	// and the chunklists are cached for each of the legacy and low-latency forms
+	std::shared_ptr<CachedChunklist> GetCachedChunklist(bool legacy, int64_t max_age_ms = 0) const;
+	ov::String SpliceQueryString(const CachedChunklist &cached_chunklist, const ov::String &query_string) const;
+	std::shared_ptr<const ov::Data> Compress(const std::shared_ptr<ov::Data> &data, http::ContentEncoding encoding) const;
+
+	int _gzip_level = Z_DEFAULT_COMPRESSION;
+	int _brotli_quality = OV_ZIP_DEFAULT_BROTLI_QUALITY;
+
+	// Increased whenever a segment or a partial segment is updated
+	std::atomic<uint64_t> _chunklist_version{0};
+	// Makes the ETags different from the ones of the previous chunklist of the same URL (e.g. the stream is recreated)
+	const uint32_t _instance_id = ov::Random::GenerateUInt32(0);
+
+	// [0]: low-latency, [1]: legacy
+	std::shared_ptr<CachedChunklist> _cached_chunklists[2];
+	// The chunklists served to the requests with max-age, replaced when they get older than max-age
+	mutable std::shared_ptr<CachedChunklist> _micro_cached_chunklists[2];
+	mutable std::shared_mutex _cached_chunklists_guard;
+
+	void UpdateCachedChunklists();
 };
\ No newline at end of file
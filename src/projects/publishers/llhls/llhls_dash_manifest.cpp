@@ -0,0 +1,178 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "llhls_dash_manifest.h"
+#include "llhls_private.h"
+
+#include <iomanip>
+
+#include <modules/bitstream/codec_media_type.h>
+
+LLHlsDashManifest::LLHlsDashManifest(int64_t availability_start_time_ms, int64_t max_segment_duration_ms, int64_t time_shift_buffer_depth_ms)
+	: _availability_start_time_ms(availability_start_time_ms),
+	  _max_segment_duration_ms(max_segment_duration_ms),
+	  _time_shift_buffer_depth_ms(time_shift_buffer_depth_ms)
+{
+}
+
+void LLHlsDashManifest::AddRepresentation(const std::shared_ptr<const MediaTrack> &track, const ov::String &initialization, const ov::String &media_template, const std::vector<Segment> &segments)
+{
+	_representations.push_back({track, initialization, media_template, segments});
+}
+
+ov::String LLHlsDashManifest::ToString(const ov::String &query_string) const
+{
+	std::ostringstream xml;
+
+	// & must be escaped in the attributes
+	auto escaped_query_string = query_string.Replace("&", "&amp;");
+
+	xml << std::fixed << std::setprecision(3)
+		<< R"(<?xml version="1.0" encoding="utf-8"?>)" << std::endl
+
+		// MPD
+		<< R"(<MPD xmlns:xsi="http://www.w3.org/2001/XMLSchema-instance")" << std::endl
+		<< R"(	xmlns="urn:mpeg:dash:schema:mpd:2011")" << std::endl
+		<< R"(	profiles="urn:mpeg:dash:profile:isoff-live:2011,http://dashif.org/guidelines/dash-if-simple")" << std::endl
+		<< R"(	type="dynamic")" << std::endl
+		<< R"(	minimumUpdatePeriod="PT)" << (_max_segment_duration_ms / 1000.0) << R"(S")" << std::endl
+		<< R"(	publishTime=")" << ov::Time::MakeUtcMillisecond().CStr() << R"(")" << std::endl
+		<< R"(	availabilityStartTime=")" << ov::Time::MakeUtcMillisecond(_availability_start_time_ms).CStr() << R"(")" << std::endl
+		<< R"(	timeShiftBufferDepth="PT)" << (_time_shift_buffer_depth_ms / 1000.0) << R"(S")" << std::endl
+		<< R"(	maxSegmentDuration="PT)" << (_max_segment_duration_ms / 1000.0) << R"(S")" << std::endl
+		<< R"(	minBufferTime="PT)" << (_max_segment_duration_ms / 1000.0) << R"(S">)" << std::endl;
+
+	xml
+		// <Period>
+		<< R"(	<Period id="0" start="PT0S">)" << std::endl;
+
+	WriteAdaptationSet(xml, cmn::MediaType::Video, escaped_query_string);
+	WriteAdaptationSet(xml, cmn::MediaType::Audio, escaped_query_string);
+
+	xml
+		// </Period>
+		<< R"(	</Period>)" << std::endl
+
+		// The segments are announced by the wall clock, so the clock of the player is synchronized with the server
+		<< R"(	<UTCTiming schemeIdUri="urn:mpeg:dash:utc:direct:2014" value=")" << ov::Time::MakeUtcMillisecond().CStr() << R"(" />)" << std::endl
+
+		// </MPD>
+		<< R"(</MPD>)" << std::endl;
+
+	return xml.str().c_str();
+}
+
+void LLHlsDashManifest::WriteAdaptationSet(std::ostringstream &xml, cmn::MediaType media_type, const ov::String &query_string) const
+{
+	bool has_representation = false;
+
+	for (const auto &representation : _representations)
+	{
+		const auto &track = representation._track;
+
+		if ((track->GetMediaType() != media_type) || representation._segments.empty())
+		{
+			continue;
+		}
+
+		if (has_representation == false)
+		{
+			auto content_type = StringFromMediaType(media_type).LowerCaseString();
+
+			xml
+				// <AdaptationSet>
+				<< R"(		<AdaptationSet )"
+				<< R"(contentType=")" << content_type.CStr() << R"(" )"
+				<< R"(mimeType=")" << content_type.CStr() << R"(/mp4" )"
+				<< R"(segmentAlignment="true" )"
+				<< R"(startWithSAP="1">)" << std::endl;
+
+			has_representation = true;
+		}
+
+		xml
+			// <Representation>
+			<< R"(			<Representation )"
+			<< R"(id=")" << track->GetId() << R"(" )"
+			<< R"(codecs=")" << CodecMediaType::GetCodecsParameter(track).CStr() << R"(" )"
+			<< R"(bandwidth=")" << track->GetBitrate() << R"(" )";
+
+		if (media_type == cmn::MediaType::Video)
+		{
+			xml
+				<< R"(width=")" << track->GetWidth() << R"(" )"
+				<< R"(height=")" << track->GetHeight() << R"(" )"
+				<< R"(frameRate=")" << track->GetFrameRate() << R"(">)" << std::endl;
+		}
+		else
+		{
+			xml
+				<< R"(audioSamplingRate=")" << track->GetSampleRate() << R"(">)" << std::endl
+
+				// <AudioChannelConfiguration />
+				<< R"(				<AudioChannelConfiguration )"
+				<< R"(schemeIdUri="urn:mpeg:dash:23003:3:audio_channel_configuration:2011" )"
+				<< R"(value=")" << track->GetChannel().GetCounts() << R"(" />)" << std::endl;
+		}
+
+		auto query_suffix = query_string.IsEmpty() ? ov::String("") : ov::String::FormatString("?%s", query_string.CStr());
+
+		xml
+			// <SegmentTemplate>
+			<< R"(				<SegmentTemplate )"
+			<< R"(timescale=")" << static_cast<int64_t>(track->GetTimeBase().GetTimescale()) << R"(" )"
+			<< R"(startNumber=")" << representation._segments.front().number << R"(" )"
+			<< R"(initialization=")" << representation._initialization.CStr() << query_suffix.CStr() << R"(" )"
+			<< R"(media=")" << representation._media_template.CStr() << query_suffix.CStr() << R"(">)" << std::endl
+
+			// <SegmentTimeline>
+			<< R"(					<SegmentTimeline>)" << std::endl;
+
+		// The consecutive segments with the same duration are written as a <S> with the repeat count
+		const auto &segments = representation._segments;
+		size_t index = 0;
+
+		while (index < segments.size())
+		{
+			auto &segment = segments[index];
+			size_t repeat_count = 0;
+
+			while ((index + repeat_count + 1 < segments.size()) &&
+				   (segments[index + repeat_count + 1].duration == segment.duration) &&
+				   (segments[index + repeat_count + 1].start_time == segment.start_time + segment.duration * static_cast<int64_t>(repeat_count + 1)))
+			{
+				repeat_count++;
+			}
+
+			xml << R"(						<S t=")" << segment.start_time << R"(" d=")" << segment.duration << R"(")";
+
+			if (repeat_count > 0)
+			{
+				xml << R"( r=")" << repeat_count << R"(")";
+			}
+
+			xml << R"( />)" << std::endl;
+
+			index += repeat_count + 1;
+		}
+
+		xml
+			// </SegmentTimeline>
+			<< R"(					</SegmentTimeline>)" << std::endl
+			// </SegmentTemplate>
+			<< R"(				</SegmentTemplate>)" << std::endl
+			// </Representation>
+			<< R"(			</Representation>)" << std::endl;
+	}
+
+	if (has_representation)
+	{
+		xml
+			// </AdaptationSet>
+			<< R"(		</AdaptationSet>)" << std::endl;
+	}
+}
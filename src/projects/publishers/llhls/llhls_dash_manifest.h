@@ -0,0 +1,51 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <sstream>
+
+#include <base/ovlibrary/ovlibrary.h>
+#include <base/info/media_track.h>
+
+// Writes a dynamic MPD that references the initialization sections and the segments of the LL-HLS storage,
+// so DASH players can play the same CMAF segments without packaging the stream again.
+class LLHlsDashManifest
+{
+public:
+	struct Segment
+	{
+		int64_t number;
+		// In the timescale of the track
+		int64_t start_time;
+		int64_t duration;
+	};
+
+	LLHlsDashManifest(int64_t availability_start_time_ms, int64_t max_segment_duration_ms, int64_t time_shift_buffer_depth_ms);
+
+	// <media_template> is the URL of the segments that contains $Number$
+	void AddRepresentation(const std::shared_ptr<const MediaTrack> &track, const ov::String &initialization, const ov::String &media_template, const std::vector<Segment> &segments);
+
+	ov::String ToString(const ov::String &query_string) const;
+
+private:
+	struct Representation
+	{
+		std::shared_ptr<const MediaTrack> _track;
+		ov::String _initialization;
+		ov::String _media_template;
+		std::vector<Segment> _segments;
+	};
+
+	void WriteAdaptationSet(std::ostringstream &xml, cmn::MediaType media_type, const ov::String &query_string) const;
+
+	int64_t _availability_start_time_ms = 0;
+	int64_t _max_segment_duration_ms = 0;
+	int64_t _time_shift_buffer_depth_ms = 0;
+
+	std::vector<Representation> _representations;
+};
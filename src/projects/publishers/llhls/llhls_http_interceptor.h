@@ -22,7 +22,8 @@ protected:
 		{
 			// playlist.m3u8 is for legacy HLS
 			if ((request->GetRequestTarget() != "playlist.m3u8"	&& request->GetRequestTarget().IndexOf(".m3u8") >= 0) || 
-				request->GetRequestTarget().IndexOf("llhls.m4s") >= 0)
+				request->GetRequestTarget().IndexOf("llhls.m4s") >= 0 ||
+				request->GetRequestTarget().IndexOf("llhls.mpd") >= 0)
 			{
 				return true;
 			}
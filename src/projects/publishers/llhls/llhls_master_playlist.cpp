@@ -162,6 +162,12 @@ std::shared_ptr<LLHlsMasterPlaylist::MediaGroup> LLHlsMasterPlaylist::GetMediaGr
 	return it->second;
 }
 
+void LLHlsMasterPlaylist::SetCompressionLevels(int gzip_level, int brotli_quality)
+{
+	_gzip_level = gzip_level;
+	_brotli_quality = brotli_quality;
+}
+
 void LLHlsMasterPlaylist::UpdateCacheForDefaultPlaylist()
 {
 	ov::String playlist = MakePlaylist("", false);
@@ -174,7 +180,12 @@ void LLHlsMasterPlaylist::UpdateCacheForDefaultPlaylist()
 	{
 		// lock 
 		std::lock_guard<std::shared_mutex> lock(_cached_default_playlist_gzip_guard);
-		_cached_default_playlist_gzip = ov::Zip::CompressGzip(playlist.ToData(false));
+		_cached_default_playlist_gzip = ov::Zip::CompressGzip(playlist.ToData(false), _gzip_level);
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(_cached_default_playlist_brotli_guard);
+		_cached_default_playlist_brotli = nullptr;
 	}
 }
 
@@ -332,5 +343,37 @@ std::shared_ptr<const ov::Data> LLHlsMasterPlaylist::ToGzipData(const ov::String
 		return _cached_default_playlist_gzip;
 	}
 
-	return  ov::Zip::CompressGzip(ToString(chunk_query_string, legacy).ToData(false));
-}
\ No newline at end of file
+	return  ov::Zip::CompressGzip(ToString(chunk_query_string, legacy).ToData(false), _gzip_level);
+}
+
+std::shared_ptr<const ov::Data> LLHlsMasterPlaylist::ToData(const ov::String &chunk_query_string, bool legacy, http::ContentEncoding encoding, ov::String *etag) const
+{
+	if (etag != nullptr)
+	{
+		*etag = MakeLLHlsPlaylistETag(_instance_id, 0, chunk_query_string, legacy, encoding);
+	}
+
+	switch (encoding)
+	{
+		case http::ContentEncoding::Gzip:
+			return ToGzipData(chunk_query_string, legacy);
+
+		case http::ContentEncoding::Brotli:
+			if (chunk_query_string.IsEmpty() && legacy == false)
+			{
+				std::lock_guard<std::mutex> lock(_cached_default_playlist_brotli_guard);
+				if (_cached_default_playlist_brotli == nullptr)
+				{
+					_cached_default_playlist_brotli = ov::Zip::CompressBrotli(ToString(chunk_query_string, legacy).ToData(false), _brotli_quality);
+				}
+
+				return _cached_default_playlist_brotli;
+			}
+
+			return ov::Zip::CompressBrotli(ToString(chunk_query_string, legacy).ToData(false), _brotli_quality);
+
+		case http::ContentEncoding::Identity:
+		default:
+			return ToString(chunk_query_string, legacy).ToData(false);
+	}
+}
@@ -9,8 +9,10 @@
 #pragma once
 
 #include <base/ovlibrary/ovlibrary.h>
+#include <base/ovlibrary/zip.h>
 #include <base/info/media_track_group.h>
 #include <base/mediarouter/media_buffer.h>
+#include <modules/http/http_datastructure.h>
 
 class LLHlsMasterPlaylist
 {
@@ -20,10 +22,13 @@ public:
 	bool AddMediaCandidateGroup(const std::shared_ptr<const MediaTrackGroup> &track_group, std::function<ov::String(const std::shared_ptr<const MediaTrack> &track)> chunk_uri_generator);
 	bool AddStreamInfo(const ov::String &video_group_id, const ov::String &audio_group_id);
 
+	void SetCompressionLevels(int gzip_level, int brotli_quality);
 	void UpdateCacheForDefaultPlaylist();
 
 	ov::String ToString(const ov::String &chunk_query_string, bool legacy, bool include_path=true) const;
 	std::shared_ptr<const ov::Data> ToGzipData(const ov::String &chunk_query_string, bool legacy) const;
+	// <etag> is set to the strong ETag of the returned representation
+	std::shared_ptr<const ov::Data> ToData(const ov::String &chunk_query_string, bool legacy, http::ContentEncoding encoding, ov::String *etag = nullptr) const;
 
 private:
 	struct MediaInfo
@@ -107,5 +112,15 @@ private:
 	std::shared_ptr<ov::Data> _cached_default_playlist_gzip = nullptr;
 	mutable std::shared_mutex _cached_default_playlist_gzip_guard;
 
+	// Made when it is requested first
+	mutable std::shared_ptr<const ov::Data> _cached_default_playlist_brotli = nullptr;
+	mutable std::mutex _cached_default_playlist_brotli_guard;
+
+	int _gzip_level = Z_DEFAULT_COMPRESSION;
+	int _brotli_quality = OV_ZIP_DEFAULT_BROTLI_QUALITY;
+
+	// The master playlist is not changed after it is created, so the instance ID is enough for the version of ETag
+	const uint32_t _instance_id = ov::Random::GenerateUInt32(0);
+
 	ov::String MakePlaylist(const ov::String &chunk_query_string, bool legacy, bool include_path=true) const;
 };
\ No newline at end of file
@@ -1,3 +1,20 @@
 #pragma once
 
+#include <base/ovcrypto/crc_32.h>
+#include <base/ovlibrary/ovlibrary.h>
+#include <modules/http/http_datastructure.h>
+
 #define OV_LOG_TAG                      "LLHLS Publisher"
+
+// Strong ETag of a playlist representation
+//
+// <instance_id> is random for each playlist object, so a recreated stream (or a restarted server) does not reuse the ETags,
+// <version> is the version of the content, and the query string and the encoding make the other representations different.
+inline ov::String MakeLLHlsPlaylistETag(uint32_t instance_id, uint64_t version, const ov::String &query_string, bool legacy, http::ContentEncoding encoding)
+{
+	return ov::String::FormatString("\"%08x-%" PRIx64 "-%08x%s%s\"",
+									instance_id, version,
+									ov::Crc32::Calculate(query_string.CStr(), query_string.GetLength()),
+									legacy ? "-l" : "",
+									(encoding == http::ContentEncoding::Gzip) ? "-gz" : (encoding == http::ContentEncoding::Brotli) ? "-br" : "");
+}
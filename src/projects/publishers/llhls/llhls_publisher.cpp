@@ -200,12 +200,37 @@ bool LLHlsPublisher::OnDeletePublisherApplication(const std::shared_ptr<pub::App
 	return true;
 }
 
+http::svr::NextHandler LLHlsPublisher::RespondDraining(const std::shared_ptr<LLHlsApplication> &application, const info::VHostAppName &vhost_app_name,
+													   const std::shared_ptr<http::svr::HttpExchange> &exchange, const std::shared_ptr<const ov::Url> &requested_url)
+{
+	auto request = exchange->GetRequest();
+	auto response = exchange->GetResponse();
+
+	auto redirect_url = ocst::Orchestrator::GetInstance()->GetDrainRedirectUrl(requested_url);
+	if (redirect_url != nullptr)
+	{
+		logtd("The server is draining, redirecting to %s", redirect_url->ToUrlString().CStr());
+		response->SetStatusCode(http::StatusCode::TemporaryRedirect);
+		response->SetHeader("Location", redirect_url->ToUrlString(true));
+	}
+	else
+	{
+		logtd("The server is draining, rejecting %s", requested_url->ToUrlString().CStr());
+		response->SetStatusCode(http::StatusCode::ServiceUnavailable);
+		response->SetHeader("Retry-After", ov::Converter::ToString(OCST_DRAIN_RETRY_AFTER_SEC));
+	}
+
+	application->GetCorsManager().SetupHttpCorsHeader(vhost_app_name, request, response);
+
+	return http::svr::NextHandler::DoNotCall;
+}
+
 std::shared_ptr<LLHlsHttpInterceptor> LLHlsPublisher::CreateInterceptor()
 {
 	auto http_interceptor = std::make_shared<LLHlsHttpInterceptor>();
 
 	// Register Request Handler
-	http_interceptor->Register(http::Method::Options, R"((.+\.m3u8$)|(.+llhls\.m4s$))", [this](const std::shared_ptr<http::svr::HttpExchange> &exchange) -> http::svr::NextHandler {
+	http_interceptor->Register(http::Method::Options, R"((.+\.m3u8$)|(.+llhls\.m4s$)|(.+llhls\.mpd$))", [this](const std::shared_ptr<http::svr::HttpExchange> &exchange) -> http::svr::NextHandler {
 		auto connection = exchange->GetConnection();
 		auto request = exchange->GetRequest();
 		auto response = exchange->GetResponse();
@@ -244,7 +269,7 @@ std::shared_ptr<LLHlsHttpInterceptor> LLHlsPublisher::CreateInterceptor()
 		return http::svr::NextHandler::DoNotCall;
 	});
 
-	http_interceptor->Register(http::Method::Get, R"((.+\.m3u8$)|(.+llhls\.m4s$))", [this](const std::shared_ptr<http::svr::HttpExchange> &exchange) -> http::svr::NextHandler {
+	http_interceptor->Register(http::Method::Get, R"((.+\.m3u8$)|(.+llhls\.m4s$)|(.+llhls\.mpd$))", [this](const std::shared_ptr<http::svr::HttpExchange> &exchange) -> http::svr::NextHandler {
 		auto connection = exchange->GetConnection();
 		auto request = exchange->GetRequest();
 		auto response = exchange->GetResponse();
@@ -267,16 +292,27 @@ std::shared_ptr<LLHlsHttpInterceptor> LLHlsPublisher::CreateInterceptor()
 
 		logtd("LLHLS requested(connection : %u): %s", connection->GetId(), request->GetUri().CStr());
 
-		auto vhost_app_name = ocst::Orchestrator::GetInstance()->ResolveApplicationNameFromDomain(final_url->Host(), final_url->App());
-		
+		// Playlist/segment/part requests of a stream resolved before skip the Orchestrator and the application/stream maps
+		auto routing_version = ocst::Orchestrator::GetInstance()->GetDomainRoutingVersion();
+		auto vhost_app_name = info::VHostAppName::InvalidVHostAppName();
+		auto cached_stream = GetResolvedStream(final_url, &vhost_app_name);
+		if (cached_stream == nullptr)
+		{
+			vhost_app_name = ocst::Orchestrator::GetInstance()->ResolveApplicationNameFromDomain(final_url->Host(), final_url->App());
+		}
+
 		auto host_name = final_url->Host();
 		auto stream_name = final_url->Stream();
 
 		uint64_t session_life_time = 0;
 		bool access_control_enabled = IsAccessControlEnabled(final_url);
 
+		// Master playlist (.m3u8 and NOT *chunklist*.m3u8) or MPD is the entry point of a player
+		bool is_entry_request = (final_url->File().IndexOf(".m3u8") > 0 && final_url->File().IndexOf("chunklist") == -1) ||
+								(final_url->File().IndexOf(".mpd") > 0);
+
 		// Check if the request is for the master playlist
-		if (access_control_enabled == true && (final_url->File().IndexOf(".m3u8") > 0 && final_url->File().IndexOf("chunklist") == -1))
+		if (access_control_enabled == true && is_entry_request == true)
 		{
 			auto [signed_policy_result, signed_policy] = Publisher::VerifyBySignedPolicy(final_url, remote_address);
 			if (signed_policy_result == AccessController::VerificationResult::Pass)
@@ -327,6 +363,7 @@ std::shared_ptr<LLHlsHttpInterceptor> LLHlsPublisher::CreateInterceptor()
 					}
 
 					vhost_app_name = ocst::Orchestrator::GetInstance()->ResolveApplicationNameFromDomain(final_url->Host(), final_url->App());
+					cached_stream = nullptr;
 					host_name = final_url->Host();
 					stream_name = final_url->Stream();
 				}
@@ -352,29 +389,44 @@ std::shared_ptr<LLHlsHttpInterceptor> LLHlsPublisher::CreateInterceptor()
 			return http::svr::NextHandler::DoNotCall;
 		}
 
-		auto application = std::static_pointer_cast<LLHlsApplication>(GetApplicationByName(vhost_app_name));
-		if (application == nullptr)
+		auto stream = cached_stream;
+		std::shared_ptr<LLHlsApplication> application;
+
+		if (stream != nullptr)
 		{
-			logte("Could not found application: %s", vhost_app_name.CStr());
-			response->SetStatusCode(http::StatusCode::NotFound);
-			return http::svr::NextHandler::DoNotCall;
+			application = std::static_pointer_cast<LLHlsApplication>(stream->GetApplication());
 		}
-
-		auto origin_mode = application->IsOriginMode();
-
-		auto stream = application->GetStream(final_url->Stream());
-		if (stream == nullptr)
+		else
 		{
-			// If the stream does not exists, request to the provider
-			stream = PullStream(final_url, vhost_app_name, host_name, stream_name);
-			if (stream == nullptr)
+			application = std::static_pointer_cast<LLHlsApplication>(GetApplicationByName(vhost_app_name));
+			if (application == nullptr)
 			{
-				logte("Could not pull the stream : %s", final_url->Stream().CStr());
+				logte("Could not found application: %s", vhost_app_name.CStr());
 				response->SetStatusCode(http::StatusCode::NotFound);
 				return http::svr::NextHandler::DoNotCall;
 			}
+
+			stream = application->GetStream(final_url->Stream());
+			if ((stream == nullptr) && ocst::Orchestrator::GetInstance()->IsDraining())
+			{
+				// Nobody is watching the stream here, so it is not pulled
+				return RespondDraining(application, vhost_app_name, exchange, requested_url);
+			}
+			else if (stream == nullptr)
+			{
+				// If the stream does not exists, request to the provider
+				stream = PullStream(final_url, vhost_app_name, host_name, stream_name);
+				if (stream == nullptr)
+				{
+					logte("Could not pull the stream : %s", final_url->Stream().CStr());
+					response->SetStatusCode(http::StatusCode::NotFound);
+					return http::svr::NextHandler::DoNotCall;
+				}
+			}
 		}
 
+		auto origin_mode = application->IsOriginMode();
+
 		if (stream->WaitUntilStart(10000) == false)
 		{
 			logtw("(%s/%s) stream has not started.", vhost_app_name.CStr(), stream_name.CStr());
@@ -382,10 +434,15 @@ std::shared_ptr<LLHlsHttpInterceptor> LLHlsPublisher::CreateInterceptor()
 			return http::svr::NextHandler::DoNotCall;
 		}
 
+		if (cached_stream == nullptr)
+		{
+			CacheResolvedStream(final_url, routing_version, vhost_app_name, stream);
+		}
+
 		std::shared_ptr<LLHlsSession> session = nullptr;
 
-		// Master playlist (.m3u8 and NOT *chunklist*.m3u8)
-		if (final_url->File().IndexOf(".m3u8") > 0 && final_url->File().IndexOf("chunklist") == -1)
+		// Master playlist (.m3u8 and NOT *chunklist*.m3u8) or MPD
+		if (is_entry_request == true)
 		{
 			session_id_t session_id = connection->GetId();
 
@@ -401,6 +458,11 @@ std::shared_ptr<LLHlsHttpInterceptor> LLHlsPublisher::CreateInterceptor()
 
 			if (session == nullptr || session->GetStream() != stream)
 			{
+				if (ocst::Orchestrator::GetInstance()->IsDraining())
+				{
+					return RespondDraining(application, vhost_app_name, exchange, requested_url);
+				}
+
 				// New HTTP Connection
 				session = LLHlsSession::Create(session_id, origin_mode, "", stream->GetApplication(), stream, request->GetHeader("USER-AGENT"), session_life_time);
 				if (session == nullptr)
@@ -448,6 +510,10 @@ std::shared_ptr<LLHlsHttpInterceptor> LLHlsPublisher::CreateInterceptor()
 					response->SetStatusCode(http::StatusCode::Unauthorized);
 					return http::svr::NextHandler::DoNotCall;
 				}
+				else if (ocst::Orchestrator::GetInstance()->IsDraining())
+				{
+					return RespondDraining(application, vhost_app_name, exchange, requested_url);
+				}
 				else
 				{
 					// New HTTP Connection
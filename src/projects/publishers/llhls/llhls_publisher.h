@@ -53,6 +53,10 @@ private:
 	bool OnDeletePublisherApplication(const std::shared_ptr<pub::Application> &application) override;
 	std::shared_ptr<LLHlsHttpInterceptor> CreateInterceptor();
 
+	// Responds to a new viewer while the server is draining: 307 to an alternative server, or 503 if there is no alternative
+	http::svr::NextHandler RespondDraining(const std::shared_ptr<LLHlsApplication> &application, const info::VHostAppName &vhost_app_name,
+										   const std::shared_ptr<http::svr::HttpExchange> &exchange, const std::shared_ptr<const ov::Url> &requested_url);
+
 	std::mutex _http_server_list_mutex;
 	std::vector<std::shared_ptr<http::svr::HttpServer>> _http_server_list;
 	std::vector<std::shared_ptr<http::svr::HttpsServer>> _https_server_list;
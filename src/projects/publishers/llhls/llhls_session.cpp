@@ -7,11 +7,18 @@
 //
 //==============================================================================
 #include <modules/http/server/http_exchange.h>
+#include <modules/http/server/http2/http2_response.h>
 #include "llhls_session.h"
 #include "llhls_application.h"
 #include "llhls_stream.h"
 #include "llhls_private.h"
 
+// From 1ms to 16s
+static ov::Histogram part_to_first_byte_histogram(
+	"ome_llhls_part_to_first_byte_seconds",
+	"Time from the completion of a LL-HLS part until its response starts to be sent",
+	0.000001, 1000, 16 * 1000 * 1000);
+
 std::shared_ptr<LLHlsSession> LLHlsSession::Create(session_id_t session_id, 
 												const bool &origin_mode,
 												const ov::String &session_key,
@@ -77,6 +84,8 @@ bool LLHlsSession::Start()
 	_segment_max_age = cache_control.GetSegmentMaxAge();
 	_partial_segment_max_age = cache_control.GetPartialSegmentMaxAge();
 
+	_brotli_enabled = llhls_conf.GetCompression().IsBrotliEnabled();
+
 	return Session::Start();
 }
 
@@ -131,7 +140,7 @@ bool LLHlsSession::IsNoConnection() const
 }
 
 // pub::Session Interface
-void LLHlsSession::SendOutgoingData(const std::any &notification)
+void LLHlsSession::SendOutgoingPackets(const pub::PacketBatch<LLHlsStream::PlaylistUpdatedEvent> &events)
 {
 	// Check expired time
 	if(_session_life_time != 0 && _session_life_time < ov::Clock::NowMSec())
@@ -139,22 +148,13 @@ void LLHlsSession::SendOutgoingData(const std::any &notification)
 		return;
 	}
 
-	std::shared_ptr<LLHlsStream::PlaylistUpdatedEvent> event;
-	try
+	for (const auto &event : events)
 	{
-		event = std::any_cast<std::shared_ptr<LLHlsStream::PlaylistUpdatedEvent>>(notification);
-		if (event == nullptr)
+		if (event != nullptr)
 		{
-			return;
+			OnPlaylistUpdated(event->track_id, event->msn, event->part);
 		}
 	}
-	catch (const std::bad_any_cast& e)
-	{
-		logtc("LLHlsSession : Invalid notification type : %s", e.what());
-		return;
-	}
-
-	OnPlaylistUpdated(event->track_id, event->msn, event->part);
 }
 
 void LLHlsSession::OnMessageReceived(const std::any &message)
@@ -223,7 +223,7 @@ void LLHlsSession::OnMessageReceived(const std::any &message)
 		return;
 	}
 
-	if (_origin_mode == false && file_type != RequestType::Playlist && file_type != RequestType::Chunklist)
+	if (_origin_mode == false && file_type != RequestType::Playlist && file_type != RequestType::Chunklist && file_type != RequestType::DashManifest)
 	{
 		// All requests except playlist have a stream key
 		if (stream_key != llhls_stream->GetStreamKey())
@@ -252,6 +252,9 @@ void LLHlsSession::OnMessageReceived(const std::any &message)
 		ResponsePlaylist(exchange, file, legacy);
 		break;
 	}
+	case RequestType::DashManifest:
+		ResponseDashManifest(exchange, file);
+		break;
 	case RequestType::Chunklist:
 	{
 		int64_t msn = -1, part = -1;
@@ -307,14 +310,25 @@ bool LLHlsSession::ParseFileName(const ov::String &file_name, RequestType &type,
 {
 	// Split to filename.ext
 	auto name_ext_items = file_name.Split(".");
-	if (name_ext_items.size() < 2 || (name_ext_items[1] != "m4s" && name_ext_items[1] != "m3u8"))
+	if (name_ext_items.size() < 2 || (name_ext_items[1] != "m4s" && name_ext_items[1] != "m3u8" && name_ext_items[1] != "mpd"))
 	{
 		logtw("Invalid file name requested: %s", file_name.CStr());
 		return false;
 	}
 
 	auto name_items = name_ext_items[0].Split("_");
-	if (name_ext_items[1] == "m3u8" && name_items[0] != "chunklist")
+	if (name_ext_items[1] == "mpd")
+	{
+		// llhls.mpd
+		if (file_name != DEFAULT_DASH_MANIFEST_NAME)
+		{
+			logtw("Invalid file name requested: %s", file_name.CStr());
+			return false;
+		}
+
+		type = RequestType::DashManifest;
+	}
+	else if (name_ext_items[1] == "m3u8" && name_items[0] != "chunklist")
 	{
 		// *.m3u8 and NOT chunklist*.m3u8
 		type = RequestType::Playlist;
@@ -394,14 +408,8 @@ void LLHlsSession::ResponsePlaylist(const std::shared_ptr<http::svr::HttpExchang
 	auto response = exchange->GetResponse();
 	auto request_uri = exchange->GetRequest()->GetParsedUri();
 
-	ov::String content_encoding = "identity";
-	bool gzip = false;
-	auto encodings = request->GetHeader("Accept-Encoding");
-	if (encodings.IndexOf("gzip") >= 0 || encodings.IndexOf("*") >= 0)
-	{
-		gzip = true;
-		content_encoding = "gzip";
-	}
+	auto encoding = http::NegotiateContentEncoding(request->GetHeader("Accept-Encoding"), _brotli_enabled);
+	auto content_encoding = http::StringFromContentEncoding(encoding);
 
 	// Get the playlist
 	auto query_string = ov::String::FormatString("session=%u_%s", GetId(), _session_key.CStr());
@@ -427,15 +435,20 @@ void LLHlsSession::ResponsePlaylist(const std::shared_ptr<http::svr::HttpExchang
 		query_string.AppendFormat("stream_key=%s", stream_key.CStr());
 	}
 
-	auto [result, playlist] = llhls_stream->GetMasterPlaylist(file_name, query_string, gzip, legacy);
+	ov::String etag;
+	auto [result, playlist] = llhls_stream->GetMasterPlaylist(file_name, query_string, encoding, legacy, true, &etag);
 	if (result == LLHlsStream::RequestResult::Success)
 	{
+		// The players and the caches revalidating the playlist get 304 without the body
+		bool not_modified = http::IsETagMatched(request->GetHeader("If-None-Match"), etag);
+
 		// Send the playlist
-		response->SetStatusCode(http::StatusCode::OK);
+		response->SetStatusCode(not_modified ? http::StatusCode::NotModified : http::StatusCode::OK);
 		// Set Content-Type header
 		response->SetHeader("Content-Type", "application/vnd.apple.mpegurl");
-		// gzip compression
+		// gzip/br compression
 		response->SetHeader("Content-Encoding", content_encoding);
+		response->SetHeader("Vary", "Accept-Encoding");
 
 		// Cache-Control header
 		// When the stream is recreated, llhls.m3u8 file is changed.
@@ -455,7 +468,15 @@ void LLHlsSession::ResponsePlaylist(const std::shared_ptr<http::svr::HttpExchang
 			response->SetHeader("Cache-Control", cache_control);
 		}
 
-		response->AppendData(playlist);
+		if (etag.IsEmpty() == false)
+		{
+			response->SetHeader("ETag", etag);
+		}
+
+		if (not_modified == false)
+		{
+			response->AppendData(playlist);
+		}
 
 		MonitorInstance->OnSessionConnected(*GetStream(), PublisherType::LLHls);
 		_number_of_players += 1;
@@ -475,6 +496,67 @@ void LLHlsSession::ResponsePlaylist(const std::shared_ptr<http::svr::HttpExchang
 	ResponseData(exchange);
 }
 
+void LLHlsSession::ResponseDashManifest(const std::shared_ptr<http::svr::HttpExchange> &exchange, const ov::String &file_name)
+{
+	auto llhls_stream = std::static_pointer_cast<LLHlsStream>(GetStream());
+	if (llhls_stream == nullptr)
+	{
+		return;
+	}
+
+	auto response = exchange->GetResponse();
+	auto request_uri = exchange->GetRequest()->GetParsedUri();
+
+	// The segments are requested with the same query string as the chunklists
+	auto query_string = ov::String::FormatString("session=%u_%s", GetId(), _session_key.CStr());
+
+	if (_origin_mode == true)
+	{
+		query_string.Clear();
+	}
+
+	if (request_uri->HasQueryKey("stream_key"))
+	{
+		if (query_string.IsEmpty() == false)
+		{
+			query_string += "&";
+		}
+
+		query_string.AppendFormat("stream_key=%s", request_uri->GetQueryValue("stream_key").CStr());
+	}
+
+	auto [result, manifest] = llhls_stream->GetDashManifest(query_string);
+	if (result == LLHlsStream::RequestResult::Success)
+	{
+		response->SetStatusCode(http::StatusCode::OK);
+		response->SetHeader("Content-Type", "application/dash+xml");
+
+		// MPD is updated every segment
+		response->SetHeader("Cache-Control", "no-cache, no-store");
+
+		response->AppendData(manifest);
+
+		// MPD is requested repeatedly, so it is counted only for the first time
+		if (_number_of_players == 0)
+		{
+			MonitorInstance->OnSessionConnected(*GetStream(), PublisherType::LLHls);
+			_number_of_players += 1;
+		}
+	}
+	else if (result == LLHlsStream::RequestResult::Accepted)
+	{
+		// MPD is transmitted when more than one segment (any track) is created
+		AddPendingRequest(exchange, RequestType::DashManifest, file_name, 0, 1, 0, false, false);
+		return;
+	}
+	else
+	{
+		response->SetStatusCode(http::StatusCode::NotFound);
+	}
+
+	ResponseData(exchange);
+}
+
 void LLHlsSession::ResponseChunklist(const std::shared_ptr<http::svr::HttpExchange> &exchange, const ov::String &file_name, const int32_t &track_id, int64_t msn, int64_t part, bool skip, bool legacy)
 {
 	auto llhls_stream = std::static_pointer_cast<LLHlsStream>(GetStream());
@@ -488,22 +570,19 @@ void LLHlsSession::ResponseChunklist(const std::shared_ptr<http::svr::HttpExchan
 	auto response = exchange->GetResponse();
 	bool has_delivery_directives = request_uri->HasQueryKey("_HLS_msn");
 
+	// Keeps the packaging of the track running (or restarts it) while it is requested (OnDemandPackaging)
+	llhls_stream->OnTrackRequested(track_id, true);
+
 	if (msn == -1 && part == -1)
 	{
 		// If there are not enough segments and chunks in the beginning, 
 		// the player cannot start playing, so the request is pending until at least one segment is created.
-		msn = 2;
+		msn = llhls_stream->GetInitialSegmentNumber(track_id);
 		part = 0;
 	}
 
-	ov::String content_encoding = "identity";
-	bool gzip = false;
-	auto encodings = request->GetHeader("Accept-Encoding");
-	if (encodings.IndexOf("gzip") >= 0 || encodings.IndexOf("*") >= 0)
-	{
-		gzip = true;
-		content_encoding = "gzip";
-	}
+	auto encoding = http::NegotiateContentEncoding(request->GetHeader("Accept-Encoding"), _brotli_enabled);
+	auto content_encoding = http::StringFromContentEncoding(encoding);
 
 	// Get the chunklist
 	auto query_string = ov::String::FormatString("session=%u_%s", GetId(), _session_key.CStr());
@@ -528,15 +607,25 @@ void LLHlsSession::ResponseChunklist(const std::shared_ptr<http::svr::HttpExchan
 		query_string.AppendFormat("stream_key=%s", stream_key.CStr());
 	}
 
-	auto [result, chunklist] = llhls_stream->GetChunklist(query_string, track_id, msn, part, skip, gzip, legacy);
+	// Requests without delivery directives are answered from a chunklist rendered within max-age (micro-caching),
+	// so the caches in front of the server get the same chunklist with its Age
+	int64_t max_age_ms = ((has_delivery_directives == false) && (_chunklist_max_age > 0)) ? (_chunklist_max_age * 1000LL) : 0LL;
+	int64_t age_ms = -1;
+
+	ov::String etag;
+
+	auto [result, chunklist] = llhls_stream->GetChunklist(query_string, track_id, msn, part, skip, encoding, legacy, max_age_ms, &age_ms, &etag);
 	if (result == LLHlsStream::RequestResult::Success)
 	{
+		bool not_modified = http::IsETagMatched(request->GetHeader("If-None-Match"), etag);
+
 		// Send the chunklist
-		response->SetStatusCode(http::StatusCode::OK);
+		response->SetStatusCode(not_modified ? http::StatusCode::NotModified : http::StatusCode::OK);
 		// Set Content-Type header
 		response->SetHeader("Content-Type", "application/vnd.apple.mpegurl");
-		// gzip compression
+		// gzip/br compression
 		response->SetHeader("Content-Encoding", content_encoding);
+		response->SetHeader("Vary", "Accept-Encoding");
 
 		// Cache-Control header
 		ov::String cache_control;
@@ -551,6 +640,11 @@ void LLHlsSession::ResponseChunklist(const std::shared_ptr<http::svr::HttpExchan
 				else
 				{
 					cache_control = ov::String::FormatString("max-age=%d", _chunklist_max_age);
+
+					if ((max_age_ms > 0) && (age_ms >= 0))
+					{
+						response->SetHeader("Age", ov::Converter::ToString(age_ms / 1000));
+					}
 				}
 				response->SetHeader("Cache-Control", cache_control);
 			}
@@ -571,7 +665,15 @@ void LLHlsSession::ResponseChunklist(const std::shared_ptr<http::svr::HttpExchan
 			}
 		}
 
-		response->AppendData(chunklist);
+		if (etag.IsEmpty() == false)
+		{
+			response->SetHeader("ETag", etag);
+		}
+
+		if (not_modified == false)
+		{
+			response->AppendData(chunklist);
+		}
 
 		// If a client uses previously cached llhls.m3u8 and requests chunklist
 		if (_number_of_players == 0)
@@ -659,6 +761,8 @@ void LLHlsSession::ResponseSegment(const std::shared_ptr<http::svr::HttpExchange
 
 	auto response = exchange->GetResponse();
 
+	llhls_stream->OnTrackRequested(track_id, false);
+
 	// Get the segment
 	auto [result, segment] = llhls_stream->GetSegment(track_id, segment_number);
 	if (result == LLHlsStream::RequestResult::Success)
@@ -710,43 +814,89 @@ void LLHlsSession::ResponsePartialSegment(const std::shared_ptr<http::svr::HttpE
 
 	auto response = exchange->GetResponse();
 
+	llhls_stream->OnTrackRequested(track_id, false);
+
+	// The header can be sent ahead of the part (see below)
+	auto http2_response = std::dynamic_pointer_cast<http::svr::h2::Http2Response>(response);
+	auto is_header_sent = response->IsHeaderSent();
+
 	// Get the partial segment
-	auto [result, partial_segment] = llhls_stream->GetChunk(track_id, segment_number, partial_number);
-	if (result == LLHlsStream::RequestResult::Success)
+	auto [result, chunk] = llhls_stream->GetChunk(track_id, segment_number, partial_number);
+	if ((result == LLHlsStream::RequestResult::Success) || (result == LLHlsStream::RequestResult::Accepted))
 	{
-		// Send the partial segment
-		response->SetStatusCode(http::StatusCode::OK);
-		// Set Content-Type header
-		if (GetStream()->GetTrack(track_id)->GetMediaType() == cmn::MediaType::Video)
+		if (is_header_sent == false)
 		{
-			response->SetHeader("Content-Type", "video/mp4");
-		}
-		else
-		{
-			response->SetHeader("Content-Type", "audio/mp4");
-		}
-
-		if (_partial_segment_max_age >= 0)
-		{
-			ov::String cache_control;
-			if (_partial_segment_max_age == 0)
+			// Send the partial segment
+			response->SetStatusCode(http::StatusCode::OK);
+			// Set Content-Type header
+			if (GetStream()->GetTrack(track_id)->GetMediaType() == cmn::MediaType::Video)
 			{
-				cache_control = ov::String::FormatString("no-cache, no-store");
+				response->SetHeader("Content-Type", "video/mp4");
 			}
 			else
 			{
-				cache_control = ov::String::FormatString("max-age=%d", _partial_segment_max_age);
+				response->SetHeader("Content-Type", "audio/mp4");
 			}
-			response->SetHeader("Cache-Control", cache_control);
+
+			if (_partial_segment_max_age >= 0)
+			{
+				ov::String cache_control;
+				if (_partial_segment_max_age == 0)
+				{
+					cache_control = ov::String::FormatString("no-cache, no-store");
+				}
+				else
+				{
+					cache_control = ov::String::FormatString("max-age=%d", _partial_segment_max_age);
+				}
+				response->SetHeader("Cache-Control", cache_control);
+			}
+		}
+
+		if (result == LLHlsStream::RequestResult::Accepted)
+		{
+			// The part that is not yet made is the one in EXT-X-PRELOAD-HINT. On HTTP/2, its HEADERS frame is sent
+			// now (without END_STREAM), so only the DATA frames are left to be sent when the part is completed.
+			if ((http2_response != nullptr) && (is_header_sent == false))
+			{
+				http2_response->SetKeepStream(true);
+
+				auto sent_size = response->Response();
+				if (sent_size > 0)
+				{
+					MonitorInstance->IncreaseBytesOut(*GetStream(), PublisherType::LLHls, sent_size);
+				}
+			}
+
+			// Hold
+			AddPendingRequest(exchange, RequestType::PartialSegment, file_name, track_id, segment_number, partial_number, false, false);
+			return;
 		}
 
-		response->AppendData(partial_segment);
+		if (http2_response != nullptr)
+		{
+			http2_response->SetKeepStream(false);
+		}
+
+		response->AppendData(chunk->GetData());
+
+		// If the request has been held, this is the delay until the completed part starts to be sent
+		part_to_first_byte_histogram.Record(ov::Clock::NowUSec() - chunk->GetCreatedTime());
 	}
-	else if (result == LLHlsStream::RequestResult::Accepted)
+	else if (is_header_sent)
 	{
-		// Hold
-		AddPendingRequest(exchange, RequestType::PartialSegment, file_name, track_id, segment_number, partial_number, false, false);
-		return ;
+		// 200 OK is already sent, so the status cannot be changed
+		logtw("[%s/%s/%u] Partial segment (%d/%lld/%lld) could not be sent after its header",
+			  GetApplication()->GetName().CStr(), GetStream()->GetName().CStr(), GetId(),
+			  track_id, segment_number, partial_number);
+
+		if (http2_response != nullptr)
+		{
+			http2_response->ResetStream(HTTP2_ERROR_CODE_INTERNAL_ERROR);
+		}
+
+		exchange->Release();
+		return;
 	}
 	else
 	{
@@ -776,50 +926,77 @@ void LLHlsSession::ResponseData(const std::shared_ptr<http::svr::HttpExchange> &
 void LLHlsSession::OnPlaylistUpdated(const int32_t &track_id, const int64_t &msn, const int64_t &part)
 {
 	logtd("LLHlsSession::OnPlaylistUpdated track_id: %d, msn: %lld, part: %lld", track_id, msn, part);
-	// Find the pending request
-	auto it = _pending_requests.begin();
-	while (it != _pending_requests.end())
+
+	if (_pending_request_count == 0)
+	{
+		return;
+	}
+
+	// Collect the requests to resume first, because the response functions can add a pending request again
+	std::vector<PendingRequest> ready_requests;
+
+	auto playlist_it = _pending_playlist_requests.begin();
+	while (playlist_it != _pending_playlist_requests.end())
 	{
-		if ( (it->type == RequestType::Playlist) &&
-			 ((it->segment_number < msn) || (it->segment_number <= msn && it->partial_number <= part)) )
+		if ((playlist_it->segment_number < msn) || (playlist_it->segment_number <= msn && playlist_it->partial_number <= part))
 		{
-			// Send the playlist
-			auto exchange = it->exchange;
-			ResponsePlaylist(exchange, it->file_name, it->legacy);
-			it = _pending_requests.erase(it);
+			ready_requests.push_back(std::move(*playlist_it));
+			playlist_it = _pending_playlist_requests.erase(playlist_it);
 		}
-		else if ( (it->track_id == track_id) && 
-			 ((it->segment_number < msn) || (it->segment_number <= msn && it->partial_number <= part)) )
+		else
 		{
-			// Resume the request
-			switch (it->type)
-			{
-			case RequestType::Chunklist:
-				ResponseChunklist(it->exchange, it->file_name, it->track_id, it->segment_number, it->partial_number, it->skip, it->legacy);
-				break;
-			case RequestType::PartialSegment:
-				ResponsePartialSegment(it->exchange, it->file_name, it->track_id, it->segment_number, it->partial_number);
-				break;
-			case RequestType::Segment:
-				ResponseSegment(it->exchange, it->file_name, it->track_id, it->segment_number);
-				break;
-			case RequestType::Playlist:
-				// Playlist is processed already above
-			case RequestType::InitializationSegment:
-				// Initialization segment request is not pending 
-			default:
-				// Assertion
-				OV_ASSERT2(false);
-				break;
-			}
+			++playlist_it;
+		}
+	}
+
+	auto track_it = _pending_requests.find(track_id);
+	if (track_it != _pending_requests.end())
+	{
+		auto &request_map = track_it->second;
+		// (segment_number < msn) || (segment_number == msn && partial_number <= part)
+		auto end = request_map.upper_bound({msn, part});
+
+		for (auto it = request_map.begin(); it != end; ++it)
+		{
+			ready_requests.push_back(std::move(it->second));
+		}
+
+		request_map.erase(request_map.begin(), end);
 
-			// Remove the request
-			it = _pending_requests.erase(it);
+		if (request_map.empty())
+		{
+			_pending_requests.erase(track_it);
 		}
-		else
+	}
+
+	_pending_request_count -= ready_requests.size();
+
+	for (auto &request : ready_requests)
+	{
+		// Resume the request
+		switch (request.type)
 		{
-			// Next
-			++it;
+		case RequestType::Playlist:
+			ResponsePlaylist(request.exchange, request.file_name, request.legacy);
+			break;
+		case RequestType::DashManifest:
+			ResponseDashManifest(request.exchange, request.file_name);
+			break;
+		case RequestType::Chunklist:
+			ResponseChunklist(request.exchange, request.file_name, request.track_id, request.segment_number, request.partial_number, request.skip, request.legacy);
+			break;
+		case RequestType::PartialSegment:
+			ResponsePartialSegment(request.exchange, request.file_name, request.track_id, request.segment_number, request.partial_number);
+			break;
+		case RequestType::Segment:
+			ResponseSegment(request.exchange, request.file_name, request.track_id, request.segment_number);
+			break;
+		case RequestType::InitializationSegment:
+			// Initialization segment request is not pending 
+		default:
+			// Assertion
+			OV_ASSERT2(false);
+			break;
 		}
 	}
 }
@@ -838,15 +1015,24 @@ bool LLHlsSession::AddPendingRequest(const std::shared_ptr<http::svr::HttpExchan
 	request.exchange = exchange;
 
 	// Add the request to the pending list
-	_pending_requests.push_back(request);
+	if (type == RequestType::Playlist || type == RequestType::DashManifest)
+	{
+		_pending_playlist_requests.push_back(std::move(request));
+	}
+	else
+	{
+		_pending_requests[track_id].emplace(std::make_pair(segment_number, partial_number), std::move(request));
+	}
+
+	_pending_request_count++;
 
-	if (_pending_requests.size() > MAX_PENDING_REQUESTS)
+	if (_pending_request_count > MAX_PENDING_REQUESTS)
 	{
 		logtd("[%s/%s/%u] Too many pending requests (%u)", 
 				GetApplication()->GetName().CStr(),
 				GetStream()->GetName().CStr(),
 				GetId(),
-				_pending_requests.size());
+				_pending_request_count);
 	}
 
 	return true;
@@ -9,13 +9,16 @@
 #pragma once
 
 #include <base/publisher/session.h>
+#include <base/publisher/stream_packet_queue.h>
 #include <list>
 
 #include <modules/access_control/access_controller.h>
 
+#include "llhls_stream.h"
+
 #define MAX_PENDING_REQUESTS 10
 
-class LLHlsSession : public pub::Session
+class LLHlsSession : public pub::Session, public pub::PacketSink<LLHlsStream::PlaylistUpdatedEvent>
 {
 public:
 	static std::shared_ptr<LLHlsSession> Create(session_id_t session_id, 
@@ -47,9 +50,11 @@ public:
 	bool Stop() override;
 
 	// pub::Session Interface
-	void SendOutgoingData(const std::any &packet) override;
 	void OnMessageReceived(const std::any &message) override;
 
+	// pub::PacketSink Interface
+	void SendOutgoingPackets(const pub::PacketBatch<LLHlsStream::PlaylistUpdatedEvent> &events) override;
+
 	void OnPlayerConnected();
 	uint32_t GetPlayerCount() const;
 
@@ -72,11 +77,13 @@ private:
 		InitializationSegment,
 		Segment,
 		PartialSegment,
+		DashManifest,
 	};
 
 	bool ParseFileName(const ov::String &file_name, RequestType &type, int32_t &track_id, int64_t &segment_number, int64_t &partial_number, ov::String &stream_key) const;
 
 	void ResponsePlaylist(const std::shared_ptr<http::svr::HttpExchange> &exchange, const ov::String &file_name, bool legacy);
+	void ResponseDashManifest(const std::shared_ptr<http::svr::HttpExchange> &exchange, const ov::String &file_name);
 	void ResponseChunklist(const std::shared_ptr<http::svr::HttpExchange> &exchange, const ov::String &file_name, const int32_t &track_id, int64_t msn, int64_t part, bool skip, bool legacy);
 	void ResponseInitializationSegment(const std::shared_ptr<http::svr::HttpExchange> &exchange, const ov::String &file_name, const int32_t &track_id);
 	void ResponseSegment(const std::shared_ptr<http::svr::HttpExchange> &exchange, const ov::String &file_name, const int32_t &track_id, const int64_t &segment_number);
@@ -103,7 +110,13 @@ private:
 	bool AddPendingRequest(const std::shared_ptr<http::svr::HttpExchange> &exchange, const RequestType &type, const ov::String &file_name, const int32_t &track_id, const int64_t &segment_number, const int64_t &partial_number, const bool &skip, const bool &legacy);
 
 	// Session runs on a single thread, so it doesn't need mutex
-	std::list<PendingRequest> _pending_requests;
+	// Playlist requests wait for the first segment of any track
+	std::list<PendingRequest> _pending_playlist_requests;
+	// track_id : (segment number, partial number) -> requests waiting for the partial segment
+	// A playlist update of (msn, part) wakes up the requests from the beginning to upper_bound((msn, part)),
+	// so the requests that are not ready yet are not visited
+	std::map<int32_t, std::multimap<std::pair<int64_t, int64_t>, PendingRequest>> _pending_requests;
+	size_t _pending_request_count = 0;
 
 	// ID list of connections requesting this session
 	// Connection ID : last request time
@@ -122,6 +135,9 @@ private:
 	int _segment_max_age = -1;
 	int _partial_segment_max_age = -1;
 
+	// Whether the playlists are compressed with Brotli for the players accepting "br"
+	bool _brotli_enabled = true;
+
 	bool _origin_mode = false;
 
 	ov::String _user_agent;
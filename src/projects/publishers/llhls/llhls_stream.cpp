@@ -8,6 +8,7 @@
 //==============================================================================
 #include "llhls_stream.h"
 
+#include "base/ovlibrary/directory.h"
 #include "base/publisher/application.h"
 #include "base/publisher/stream.h"
 #include "llhls_application.h"
@@ -36,7 +37,7 @@ bool LLHlsStream::Start()
 		return false;
 	}
 
-	if (CreateStreamWorker(_worker_count) == false)
+	if (CreateStreamWorker<PlaylistUpdatedEvent>(_worker_count) == false)
 	{
 		return false;
 	}
@@ -50,13 +51,32 @@ bool LLHlsStream::Start()
 
 	_packager_config.chunk_duration_ms = llhls_config.GetChunkDuration() * 1000.0;
 	_packager_config.segment_duration_ms = llhls_config.GetSegmentDuration() * 1000.0;
+	_packager_config.segment_alignment = llhls_config.IsSegmentAlignmentEnabled();
 	_storage_config.max_segments = llhls_config.GetSegmentCount();
 	_storage_config.segment_duration_ms = llhls_config.GetSegmentDuration() * 1000;
 	_storage_config.dvr_enabled = dvr_config.IsEnabled();
 	_storage_config.dvr_storage_path = dvr_config.GetTempStoragePath();
 	_storage_config.dvr_duration_sec = dvr_config.GetMaxDuration();
 
+	auto stream_metrics = StreamMetrics(*this);
+	if (stream_metrics != nullptr)
+	{
+		_storage_config.memory_metrics = stream_metrics->GetMemoryMetrics();
+	}
+
 	_configured_part_hold_back = llhls_config.GetPartHoldBack();
+	_gzip_level = llhls_config.GetCompression().GetGzipLevel();
+	_brotli_quality = llhls_config.GetCompression().GetBrotliQuality();
+	_dash_manifest_enabled = llhls_config.IsDashManifestEnabled();
+
+	_on_demand_packaging = llhls_config.IsOnDemandPackagingEnabled();
+	_on_demand_idle_timeout_ms = static_cast<int64_t>(llhls_config.GetOnDemandIdleTimeout()) * 1000;
+	if (_on_demand_packaging && _storage_config.dvr_enabled)
+	{
+		// The segments of DVR must be continuous
+		logtw("LLHlsStream(%s/%s) - OnDemandPackaging is disabled because DVR is enabled", GetApplication()->GetName().CStr(), GetName().CStr());
+		_on_demand_packaging = false;
+	}
 
 	// Find data track
 	auto data_track = GetFirstTrackByType(cmn::MediaType::Data);
@@ -65,6 +85,7 @@ bool LLHlsStream::Start()
 	for (const auto &[id, track] : _tracks)
 	{
 		if ((track->GetCodecId() == cmn::MediaCodecId::H264) ||
+			(track->GetCodecId() == cmn::MediaCodecId::Av1) ||
 			(track->GetCodecId() == cmn::MediaCodecId::Aac))
 		{
 			if (AddPackager(track, data_track) == false)
@@ -73,6 +94,14 @@ bool LLHlsStream::Start()
 				return false;
 			}
 
+			if (_on_demand_packaging)
+			{
+				// All tracks are packaged from the beginning until they are idle
+				auto state = std::make_shared<OnDemandTrackState>();
+				state->last_requested_time_ms = ov::Clock::NowMSec();
+				_on_demand_track_states.emplace(track->GetId(), state);
+			}
+
 			// For default llhls.m3u8
 			if (first_video_track == nullptr && track->GetMediaType() == cmn::MediaType::Video)
 			{
@@ -230,6 +259,7 @@ uint64_t LLHlsStream::GetMaxChunkDurationMS() const
 std::shared_ptr<LLHlsMasterPlaylist> LLHlsStream::CreateMasterPlaylist(const std::shared_ptr<const info::Playlist> &playlist) const
 {
 	auto master_playlist = std::make_shared<LLHlsMasterPlaylist>();
+	master_playlist->SetCompressionLevels(_gzip_level, _brotli_quality);
 
 	ov::String chunk_path;
 	ov::String app_name = GetApplicationInfo().GetName().GetAppName();
@@ -263,6 +293,7 @@ std::shared_ptr<LLHlsMasterPlaylist> LLHlsStream::CreateMasterPlaylist(const std
 		}
 
 		if ((track->GetCodecId() != cmn::MediaCodecId::H264) &&
+			(track->GetCodecId() != cmn::MediaCodecId::Av1) &&
 			(track->GetCodecId() != cmn::MediaCodecId::Aac))
 		{
 			continue;
@@ -279,7 +310,7 @@ std::shared_ptr<LLHlsMasterPlaylist> LLHlsStream::CreateMasterPlaylist(const std
 		auto video_track = GetFirstTrackByVariant(rendition->GetVideoVariantName());
 		auto audio_track = GetFirstTrackByVariant(rendition->GetAudioVariantName());
 
-		if ((video_track != nullptr && video_track->GetCodecId() != cmn::MediaCodecId::H264) ||
+		if ((video_track != nullptr && video_track->GetCodecId() != cmn::MediaCodecId::H264 && video_track->GetCodecId() != cmn::MediaCodecId::Av1) ||
 			(audio_track != nullptr && audio_track->GetCodecId() != cmn::MediaCodecId::Aac))
 		{
 			logtw("LLHlsStream(%s/%s) - Exclude the rendition(%s) from the %s.m3u8 due to unsupported codec", GetApplication()->GetName().CStr(), GetName().CStr(),
@@ -324,7 +355,7 @@ bool LLHlsStream::DumpMasterPlaylist(const std::shared_ptr<mdl::Dump> &item)
 
 	for (auto &playlist : item->GetPlaylists())
 	{
-		auto [result, data] = GetMasterPlaylist(playlist, "", false, false, false);
+		auto [result, data] = GetMasterPlaylist(playlist, "", http::ContentEncoding::Identity, false, false);
 		if (result != RequestResult::Success)
 		{
 			logtw("Could not get master playlist(%s) for dump", playlist.CStr());
@@ -463,7 +494,7 @@ bool LLHlsStream::DumpData(const std::shared_ptr<mdl::Dump> &item, const ov::Str
 	return item->DumpData(file_name, data);
 }
 
-std::tuple<LLHlsStream::RequestResult, std::shared_ptr<const ov::Data>> LLHlsStream::GetMasterPlaylist(const ov::String &file_name, const ov::String &chunk_query_string, bool gzip, bool legacy, bool include_path)
+std::tuple<LLHlsStream::RequestResult, std::shared_ptr<const ov::Data>> LLHlsStream::GetMasterPlaylist(const ov::String &file_name, const ov::String &chunk_query_string, http::ContentEncoding encoding, bool legacy, bool include_path, ov::String *etag)
 {
 	if (GetState() != State::STARTED)
 	{
@@ -507,15 +538,16 @@ std::tuple<LLHlsStream::RequestResult, std::shared_ptr<const ov::Data>> LLHlsStr
 		return {RequestResult::NotFound, nullptr};
 	}
 
-	if (gzip == true)
+	if (include_path == false)
 	{
-		return {RequestResult::Success, master_playlist->ToGzipData(chunk_query_string, legacy)};
+		// For dump
+		return {RequestResult::Success, master_playlist->ToString(chunk_query_string, legacy, include_path).ToData(false)};
 	}
 
-	return {RequestResult::Success, master_playlist->ToString(chunk_query_string, legacy, include_path).ToData(false)};
+	return {RequestResult::Success, master_playlist->ToData(chunk_query_string, legacy, encoding, etag)};
 }
 
-std::tuple<LLHlsStream::RequestResult, std::shared_ptr<const ov::Data>> LLHlsStream::GetChunklist(const ov::String &query_string, const int32_t &track_id, int64_t msn, int64_t psn, bool skip, bool gzip, bool legacy) const
+std::tuple<LLHlsStream::RequestResult, std::shared_ptr<const ov::Data>> LLHlsStream::GetChunklist(const ov::String &query_string, const int32_t &track_id, int64_t msn, int64_t psn, bool skip, http::ContentEncoding encoding, bool legacy, int64_t max_age_ms, int64_t *age_ms, ov::String *etag) const
 {
 	auto chunklist = GetChunklistWriter(track_id);
 	if (chunklist == nullptr)
@@ -545,12 +577,8 @@ std::tuple<LLHlsStream::RequestResult, std::shared_ptr<const ov::Data>> LLHlsStr
 		}
 	}
 
-	if (gzip == true)
-	{
-		return {RequestResult::Success, chunklist->ToGzipData(query_string, skip, legacy)};
-	}
-
-	return {RequestResult::Success, chunklist->ToString(query_string, skip, legacy).ToData(false)};
+	// The identical requests share the same data
+	return {RequestResult::Success, chunklist->ToData(query_string, skip, legacy, encoding, max_age_ms, age_ms, etag)};
 }
 
 std::tuple<LLHlsStream::RequestResult, std::shared_ptr<ov::Data>> LLHlsStream::GetInitializationSegment(const int32_t &track_id) const
@@ -584,7 +612,7 @@ std::tuple<LLHlsStream::RequestResult, std::shared_ptr<ov::Data>> LLHlsStream::G
 	return {RequestResult::Success, segment->GetData()};
 }
 
-std::tuple<LLHlsStream::RequestResult, std::shared_ptr<ov::Data>> LLHlsStream::GetChunk(const int32_t &track_id, const int64_t &segment_number, const int64_t &chunk_number) const
+std::tuple<LLHlsStream::RequestResult, std::shared_ptr<bmff::FMP4Chunk>> LLHlsStream::GetChunk(const int32_t &track_id, const int64_t &segment_number, const int64_t &chunk_number) const
 {
 	logtd("LLHlsStream(%s) - GetChunk(%d, %ld, %ld)", GetName().CStr(), track_id, segment_number, chunk_number);
 
@@ -616,7 +644,81 @@ std::tuple<LLHlsStream::RequestResult, std::shared_ptr<ov::Data>> LLHlsStream::G
 		return {RequestResult::NotFound, nullptr};
 	}
 
-	return {RequestResult::Success, chunk->GetData()};
+	return {RequestResult::Success, chunk};
+}
+
+std::tuple<LLHlsStream::RequestResult, std::shared_ptr<const ov::Data>> LLHlsStream::GetDashManifest(const ov::String &chunk_query_string)
+{
+	if (_dash_manifest_enabled == false)
+	{
+		return {RequestResult::NotFound, nullptr};
+	}
+
+	// MPD contains all tracks, so all of them are packaged while DASH players are watching
+	for (const auto &[track_id, state] : _on_demand_track_states)
+	{
+		OnTrackRequested(track_id, true);
+	}
+
+	if (IsReadyToPlay() == false)
+	{
+		return {RequestResult::Accepted, nullptr};
+	}
+
+	// The timestamps of the tracks start from the creation of the input stream (same as EXT-X-PROGRAM-DATE-TIME)
+	auto availability_start_time_ms = std::chrono::duration_cast<std::chrono::milliseconds>(GetInputStreamCreatedTime().time_since_epoch()).count();
+	auto manifest = LLHlsDashManifest(availability_start_time_ms, _storage_config.segment_duration_ms, _storage_config.segment_duration_ms * _storage_config.max_segments);
+
+	std::shared_lock<std::shared_mutex> storage_lock(_storage_map_lock);
+
+	for (const auto &[track_id, storage] : _storage_map)
+	{
+		auto track = GetTrack(track_id);
+		auto last_segment_number = storage->GetLastSegmentNumber();
+		if ((track == nullptr) || (last_segment_number < 0))
+		{
+			continue;
+		}
+
+		std::vector<LLHlsDashManifest::Segment> segments;
+		auto timescale = track->GetTimeBase().GetTimescale();
+
+		// Only the segments in memory are announced even if DVR is enabled
+		auto first_segment_number = std::max<int64_t>(0, last_segment_number - _storage_config.max_segments + 1);
+		for (auto segment_number = last_segment_number; segment_number >= first_segment_number; segment_number--)
+		{
+			auto segment = storage->GetMediaSegment(segment_number);
+			if (segment == nullptr)
+			{
+				break;
+			}
+
+			// The segment being written is not announced
+			if (segment->IsCompleted() == false)
+			{
+				continue;
+			}
+
+			int64_t start_time = segment->GetStartTimestamp();
+			int64_t duration = std::llround(segment->GetDuration() * timescale / 1000.0);
+
+			// Fill the rounding errors of the duration, so there is no gap in SegmentTimeline
+			if (segments.empty() == false)
+			{
+				duration = segments.back().start_time - start_time;
+			}
+
+			segments.push_back({segment->GetNumber(), start_time, duration});
+		}
+
+		std::reverse(segments.begin(), segments.end());
+
+		manifest.AddRepresentation(track, GetInitializationSegmentName(track_id), GetSegmentNameTemplate(track_id), segments);
+	}
+
+	storage_lock.unlock();
+
+	return {RequestResult::Success, manifest.ToString(chunk_query_string).ToData(false)};
 }
 
 void LLHlsStream::BufferMediaPacketUntilReadyToPlay(const std::shared_ptr<MediaPacket> &media_packet)
@@ -741,24 +843,188 @@ bool LLHlsStream::AppendMediaPacket(const std::shared_ptr<MediaPacket> &media_pa
 	}
 
 	if ((track->GetCodecId() == cmn::MediaCodecId::H264) ||
+		(track->GetCodecId() == cmn::MediaCodecId::Av1) ||
 		(track->GetCodecId() == cmn::MediaCodecId::Aac))
 	{
-		// Get Packager
-		auto packager = GetPackager(track->GetId());
-		if (packager == nullptr)
+		auto state = GetOnDemandTrackState(track->GetId());
+		if (state == nullptr)
 		{
-			logtw("Could not find packager. track id: %d", track->GetId());
-			return false;
+			return AppendSample(track, media_packet, nullptr);
 		}
 
-		logtd("AppendSample : track(%d) length(%d)", media_packet->GetTrackId(), media_packet->GetDataLength());
+		std::lock_guard<std::mutex> lock(state->mutex);
+
+		if (state->active == false)
+		{
+			return true;
+		}
+
+		if ((static_cast<int64_t>(ov::Clock::NowMSec()) - state->last_requested_time_ms) > _on_demand_idle_timeout_ms)
+		{
+			// Nobody has requested the track during the timeout, so the packaging is stopped until the next chunklist request
+			state->active = false;
+
+			logti("LLHlsStream(%s/%s) - Packaging of track(%d) is stopped because it is idle", GetApplication()->GetName().CStr(), GetName().CStr(), track->GetId());
+			return true;
+		}
+
+		return AppendSample(track, media_packet, state.get());
+	}
+
+	return true;
+}
+
+bool LLHlsStream::AppendSample(const std::shared_ptr<const MediaTrack> &track, const std::shared_ptr<MediaPacket> &media_packet, OnDemandTrackState *state)
+{
+	if (state != nullptr)
+	{
+		// The packets of the GOP cache can be delivered again after the restart
+		if (media_packet->GetDts() <= state->last_dts)
+		{
+			return true;
+		}
+
+		// A segment must start with a key frame
+		if (state->waiting_for_key_frame)
+		{
+			if (media_packet->GetFlag() != MediaPacketFlag::Key)
+			{
+				return true;
+			}
+
+			state->waiting_for_key_frame = false;
+		}
 
-		packager->AppendSample(media_packet);
+		state->last_dts = media_packet->GetDts();
 	}
 
+	// Get Packager
+	auto packager = GetPackager(track->GetId());
+	if (packager == nullptr)
+	{
+		logtw("Could not find packager. track id: %d", track->GetId());
+		return false;
+	}
+
+	logtd("AppendSample : track(%d) length(%d)", media_packet->GetTrackId(), media_packet->GetDataLength());
+
+	packager->AppendSample(media_packet);
+
 	return true;
 }
 
+std::shared_ptr<LLHlsStream::OnDemandTrackState> LLHlsStream::GetOnDemandTrackState(const int32_t &track_id) const
+{
+	auto it = _on_demand_track_states.find(track_id);
+	if (it == _on_demand_track_states.end())
+	{
+		return nullptr;
+	}
+
+	return it->second;
+}
+
+void LLHlsStream::OnTrackRequested(const int32_t &track_id, bool start_if_idle)
+{
+	auto state = GetOnDemandTrackState(track_id);
+	if (state == nullptr)
+	{
+		return;
+	}
+
+	state->last_requested_time_ms = ov::Clock::NowMSec();
+
+	if ((start_if_idle == false) || (state->active == true))
+	{
+		return;
+	}
+
+	std::lock_guard<std::mutex> lock(state->mutex);
+
+	if (state->active == true)
+	{
+		// Restarted by another request
+		return;
+	}
+
+	if (RestartPackaging(track_id, *state) == false)
+	{
+		logte("LLHlsStream(%s/%s) - Could not restart packaging of track(%d)", GetApplication()->GetName().CStr(), GetName().CStr(), track_id);
+		return;
+	}
+
+	state->active = true;
+
+	logti("LLHlsStream(%s/%s) - Packaging of track(%d) is restarted from segment %" PRId64, GetApplication()->GetName().CStr(), GetName().CStr(), track_id, state->first_segment_number.load());
+}
+
+bool LLHlsStream::RestartPackaging(const int32_t &track_id, OnDemandTrackState &state)
+{
+	auto track = GetTrack(track_id);
+	auto old_storage = GetStorage(track_id);
+	auto chunklist = GetChunklistWriter(track_id);
+
+	if ((track == nullptr) || (old_storage == nullptr) || (chunklist == nullptr))
+	{
+		return false;
+	}
+
+	// The segment numbers continue, so the URLs of the old segments are not reused (e.g. by the caches of CDN)
+	auto first_segment_number = old_storage->GetLastSegmentNumber() + 1;
+
+	// The old segments are discontinuous with the new segments, so the packaging starts from an empty storage
+	auto tag = ov::String::FormatString("%s/%s", GetApplicationInfo().GetName().CStr(), GetName().CStr());
+	auto storage = std::make_shared<bmff::FMP4Storage>(bmff::FMp4StorageObserver::GetSharedPtr(), track, _storage_config, tag);
+	storage->SetFirstSegmentNumber(first_segment_number);
+
+	auto packager = std::make_shared<bmff::FMP4Packager>(storage, track, GetFirstTrackByType(cmn::MediaType::Data), _packager_config);
+	if (packager->CreateInitializationSegment() == false)
+	{
+		return false;
+	}
+
+	chunklist->Reset(first_segment_number);
+
+	{
+		std::lock_guard<std::shared_mutex> storage_lock(_storage_map_lock);
+		_storage_map[track_id] = storage;
+	}
+
+	{
+		std::lock_guard<std::shared_mutex> packager_lock(_packager_map_lock);
+		_packager_map[track_id] = packager;
+	}
+
+	state.first_segment_number = first_segment_number;
+	state.last_dts = std::numeric_limits<int64_t>::min();
+	state.waiting_for_key_frame = (track->GetMediaType() == cmn::MediaType::Video);
+
+	// The first segment is filled with the last GOP immediately instead of waiting for the next key frame
+	for (const auto &media_packet : GetGopCache())
+	{
+		if (media_packet->GetTrackId() == track_id)
+		{
+			AppendSample(track, media_packet, &state);
+		}
+	}
+
+	return true;
+}
+
+int64_t LLHlsStream::GetInitialSegmentNumber(const int32_t &track_id) const
+{
+	auto state = GetOnDemandTrackState(track_id);
+	if ((state == nullptr) || (state->first_segment_number == 0))
+	{
+		// If there are not enough segments and chunks in the beginning,
+		// the player cannot start playing, so the request is pending until the third segment is created.
+		return 2;
+	}
+
+	// The first segment after the restart is filled with the GOP cache, so the player can start with the next segment
+	return state->first_segment_number + 1;
+}
+
 // Create and Get fMP4 packager with track info, storage and packager_config
 bool LLHlsStream::AddPackager(const std::shared_ptr<const MediaTrack> &media_track, const std::shared_ptr<const MediaTrack> &data_track)
 {
@@ -787,6 +1053,7 @@ bool LLHlsStream::AddPackager(const std::shared_ptr<const MediaTrack> &media_tra
 													  segment_duration,
 													  chunk_duration,
 													  GetInitializationSegmentName(track_id));
+	chunklist->SetCompressionLevels(_gzip_level, _brotli_quality);
 
 	{
 		std::lock_guard<std::shared_mutex> storage_lock(_storage_map_lock);
@@ -872,6 +1139,15 @@ ov::String LLHlsStream::GetSegmentName(const int32_t &track_id, const int64_t &s
 									_stream_key.CStr());
 }
 
+ov::String LLHlsStream::GetSegmentNameTemplate(const int32_t &track_id) const
+{
+	// seg_<track id>_$Number$_<media type>_<random str>_llhls.m4s
+	return ov::String::FormatString("seg_%d_$Number$_%s_%s_llhls.m4s",
+									track_id,
+									StringFromMediaType(GetTrack(track_id)->GetMediaType()).LowerCaseString().CStr(),
+									_stream_key.CStr());
+}
+
 ov::String LLHlsStream::GetPartialSegmentName(const int32_t &track_id, const int64_t &segment_number, const int64_t &partial_number) const
 {
 	// part_<track id>_<segment number>_<partial number>_<media type>_<random str>_llhls.m4s
@@ -1050,11 +1326,9 @@ void LLHlsStream::OnMediaSegmentDeleted(const int32_t &track_id, const uint32_t
 
 void LLHlsStream::NotifyPlaylistUpdated(const int32_t &track_id, const int64_t &msn, const int64_t &part)
 {
-	// Make std::any for broadcast
 	// I think make_shared is better than copy sizeof(PlaylistUpdatedEvent) to all sessions
 	auto event = std::make_shared<PlaylistUpdatedEvent>(track_id, msn, part);
-	auto notification = std::make_any<std::shared_ptr<PlaylistUpdatedEvent>>(event);
-	BroadcastPacket(notification);
+	BroadcastPacket(event);
 }
 
 int64_t LLHlsStream::GetMinimumLastSegmentNumber() const
@@ -1245,4 +1519,112 @@ std::vector<std::shared_ptr<const mdl::Dump>> LLHlsStream::GetDumpInfoList()
 		dump_list.push_back(it.second);
 	}
 	return dump_list;
-}
\ No newline at end of file
+}
+std::tuple<bool, ov::String> LLHlsStream::ExportClip(const ov::String &file_path, double duration_ms, ClipInfo &clip_info)
+{
+	std::shared_lock<std::shared_mutex> storage_lock(_storage_map_lock);
+	auto storage_map = _storage_map;
+	storage_lock.unlock();
+
+	if (storage_map.empty())
+	{
+		return {false, "The stream is not ready"};
+	}
+
+	// The segments of the tracks are cut at the same time, so the clip has the same segment numbers for all tracks.
+	// The duration is counted on the first video track (or the first track if there is no video)
+	bmff::FMP4ClipBuilder builder;
+	std::shared_ptr<bmff::FMP4Storage> reference_storage;
+	bool reference_is_video = false;
+	int64_t last_segment_number = std::numeric_limits<int64_t>::max();
+
+	for (const auto &[track_id, storage] : storage_map)
+	{
+		auto track = GetTrack(track_id);
+		if (storage == nullptr || track == nullptr)
+		{
+			return {false, ov::String::FormatString("Could not find track %d", track_id)};
+		}
+
+		if (builder.AddTrack(track_id, track->GetTimeBase().GetTimescale(), storage->GetInitializationSection()) == false)
+		{
+			return {false, ov::String::FormatString("Initialization segment of track %d is not ready", track_id)};
+		}
+
+		auto is_video = (track->GetMediaType() == cmn::MediaType::Video);
+		if (reference_storage == nullptr || (reference_is_video == false && is_video))
+		{
+			reference_storage = storage;
+			reference_is_video = is_video;
+		}
+
+		// The last segment is being written
+		auto segment_number = storage->GetLastSegmentNumber();
+		auto segment = (segment_number >= 0) ? storage->GetMediaSegment(segment_number) : nullptr;
+		if (segment == nullptr || segment->IsCompleted() == false)
+		{
+			segment_number--;
+		}
+
+		last_segment_number = std::min(last_segment_number, segment_number);
+	}
+
+	int64_t first_segment_number = last_segment_number + 1;
+	double clip_duration_ms = 0.0;
+
+	while (first_segment_number > 0 && clip_duration_ms < duration_ms)
+	{
+		auto segment = reference_storage->GetMediaSegment(first_segment_number - 1);
+		if (segment == nullptr || segment->IsCompleted() == false)
+		{
+			// Deleted, or beyond the DVR window
+			break;
+		}
+
+		clip_duration_ms += segment->GetDuration();
+		first_segment_number--;
+	}
+
+	if (first_segment_number > last_segment_number)
+	{
+		return {false, "There is no completed segment"};
+	}
+
+	for (auto segment_number = first_segment_number; segment_number <= last_segment_number; segment_number++)
+	{
+		for (const auto &[track_id, storage] : storage_map)
+		{
+			auto segment = storage->GetMediaSegment(segment_number);
+			if (segment == nullptr || segment->IsCompleted() == false || builder.AppendSegment(track_id, segment->GetData()) == false)
+			{
+				return {false, ov::String::FormatString("Segment %ld of track %d is not available", segment_number, track_id)};
+			}
+		}
+	}
+
+	auto clip = builder.Build();
+	if (clip == nullptr)
+	{
+		return {false, "Could not build the clip"};
+	}
+
+	if (ov::CreateDirectories(ov::PathManager::ExtractPath(file_path)) == false)
+	{
+		return {false, ov::String::FormatString("Could not create the directory of %s", file_path.CStr())};
+	}
+
+	if (ov::DumpToFile(file_path, clip) == nullptr)
+	{
+		return {false, ov::String::FormatString("Could not write %s", file_path.CStr())};
+	}
+
+	clip_info.file_path = file_path;
+	clip_info.size = clip->GetLength();
+	clip_info.duration_ms = clip_duration_ms;
+	clip_info.first_segment_number = first_segment_number;
+	clip_info.last_segment_number = last_segment_number;
+
+	logti("Clip exported: stream_name = %s, file = %s, segments = %ld-%ld, duration = %.0f ms, size = %zu", GetName().CStr(), file_path.CStr(), first_segment_number, last_segment_number, clip_duration_ms, clip_info.size);
+
+	return {true, ""};
+}
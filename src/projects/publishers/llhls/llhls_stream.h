@@ -16,10 +16,13 @@
 #include "monitoring/monitoring.h"
 
 #include "modules/containers/bmff/fmp4_packager/fmp4_packager.h"
+#include "modules/containers/bmff/fmp4_packager/fmp4_clip_builder.h"
 #include "llhls_master_playlist.h"
 #include "llhls_chunklist.h"
+#include "llhls_dash_manifest.h"
 
 #define DEFAULT_PLAYLIST_NAME	"llhls.m3u8"
+#define DEFAULT_DASH_MANIFEST_NAME	"llhls.mpd"
 
 
 // max initial media packet buffer size, for OOM protection
@@ -65,11 +68,20 @@ public:
 
 	uint64_t GetMaxChunkDurationMS() const;
 
-	std::tuple<RequestResult, std::shared_ptr<const ov::Data>> GetMasterPlaylist(const ov::String &file_name, const ov::String &chunk_query_string, bool gzip, bool legacy, bool include_path=true);
-	std::tuple<RequestResult, std::shared_ptr<const ov::Data>> GetChunklist(const ov::String &chunk_query_string, const int32_t &track_id, int64_t msn, int64_t psn, bool skip, bool gzip, bool legacy) const;
+	std::tuple<RequestResult, std::shared_ptr<const ov::Data>> GetMasterPlaylist(const ov::String &file_name, const ov::String &chunk_query_string, http::ContentEncoding encoding, bool legacy, bool include_path=true, ov::String *etag = nullptr);
+	// If <max_age_ms> is greater than 0, a chunklist rendered within <max_age_ms> can be returned, and its age is stored in <age_ms>
+	std::tuple<RequestResult, std::shared_ptr<const ov::Data>> GetChunklist(const ov::String &chunk_query_string, const int32_t &track_id, int64_t msn, int64_t psn, bool skip, http::ContentEncoding encoding, bool legacy, int64_t max_age_ms = 0, int64_t *age_ms = nullptr, ov::String *etag = nullptr) const;
 	std::tuple<RequestResult, std::shared_ptr<ov::Data>> GetInitializationSegment(const int32_t &track_id) const;
 	std::tuple<RequestResult, std::shared_ptr<ov::Data>> GetSegment(const int32_t &track_id, const int64_t &segment_number) const;
-	std::tuple<RequestResult, std::shared_ptr<ov::Data>> GetChunk(const int32_t &track_id, const int64_t &segment_number, const int64_t &chunk_number) const;
+	std::tuple<RequestResult, std::shared_ptr<bmff::FMP4Chunk>> GetChunk(const int32_t &track_id, const int64_t &segment_number, const int64_t &chunk_number) const;
+	// MPD of the completed segments of all tracks (DashManifest option)
+	std::tuple<RequestResult, std::shared_ptr<const ov::Data>> GetDashManifest(const ov::String &chunk_query_string);
+
+	// OnDemandPackaging: a request of the track keeps its packaging running, and if <start_if_idle> is true,
+	// the packaging of the track that has been stopped by the idle timeout is restarted
+	void OnTrackRequested(const int32_t &track_id, bool start_if_idle);
+	// The segment number that a chunklist request without delivery directives waits for
+	int64_t GetInitialSegmentNumber(const int32_t &track_id) const;
 
 	// <result, error message>
 	std::tuple<bool, ov::String> StartDump(const std::shared_ptr<info::Dump> &dump_info);
@@ -79,6 +91,19 @@ public:
 	// Get dumps
 	std::vector<std::shared_ptr<const mdl::Dump>> GetDumpInfoList();
 
+	struct ClipInfo
+	{
+		ov::String file_path;
+		size_t size = 0;
+		double duration_ms = 0.0;
+		int64_t first_segment_number = -1;
+		int64_t last_segment_number = -1;
+	};
+	// Writes a fragmented MP4 of the last <duration_ms> (at least) of the completed segments (including the DVR segments) to <file_path>.
+	// The stored fragments are copied without re-muxing (see bmff::FMP4ClipBuilder)
+	// <result, error message>
+	std::tuple<bool, ov::String> ExportClip(const ov::String &file_path, double duration_ms, ClipInfo &clip_info);
+
 private:
 	bool Start() override;
 	bool Stop() override;
@@ -106,10 +131,37 @@ private:
 	ov::String GetChunklistName(const int32_t &track_id) const;
 	ov::String GetInitializationSegmentName(const int32_t &track_id) const;
 	ov::String GetSegmentName(const int32_t &track_id, const int64_t &segment_number) const;
+	// GetSegmentName() with $Number$ for the SegmentTemplate of MPD
+	ov::String GetSegmentNameTemplate(const int32_t &track_id) const;
 	ov::String GetPartialSegmentName(const int32_t &track_id, const int64_t &segment_number, const int64_t &partial_number) const;
 	ov::String GetNextPartialSegmentName(const int32_t &track_id, const int64_t &segment_number, const int64_t &partial_number) const;
 
+	// State of a track for OnDemandPackaging
+	struct OnDemandTrackState
+	{
+		// Serializes the packaging of the track and the restart
+		std::mutex mutex;
+
+		std::atomic<bool> active{true};
+		std::atomic<int64_t> last_requested_time_ms{0};
+
+		// The first segment number since the packaging is (re)started
+		std::atomic<int64_t> first_segment_number{0};
+
+		// To skip the packets that are replayed from the GOP cache and delivered again
+		int64_t last_dts = std::numeric_limits<int64_t>::min();
+		bool waiting_for_key_frame = false;
+	};
+
 	bool AppendMediaPacket(const std::shared_ptr<MediaPacket> &media_packet);
+	// <state> is nullptr if OnDemandPackaging is disabled, otherwise <state->mutex> must be locked
+	bool AppendSample(const std::shared_ptr<const MediaTrack> &track, const std::shared_ptr<MediaPacket> &media_packet, OnDemandTrackState *state);
+
+	// nullptr if OnDemandPackaging is disabled
+	std::shared_ptr<OnDemandTrackState> GetOnDemandTrackState(const int32_t &track_id) const;
+	// Starts the packaging of the track with a new storage/packager, and fills the first segment with the GOP cache.
+	// <state.mutex> must be locked.
+	bool RestartPackaging(const int32_t &track_id, OnDemandTrackState &state);
 
 	bool IsReadyToPlay() const;
 	bool CheckPlaylistReady();
@@ -143,6 +195,17 @@ private:
 
 	double _configured_part_hold_back = 0;
 
+	// <Compression> of the playlists
+	int _gzip_level = Z_DEFAULT_COMPRESSION;
+	int _brotli_quality = OV_ZIP_DEFAULT_BROTLI_QUALITY;
+
+	bool _dash_manifest_enabled = false;
+
+	bool _on_demand_packaging = false;
+	int64_t _on_demand_idle_timeout_ms = 0;
+	// Track ID : OnDemandTrackState (created in Start() and never changed after)
+	std::map<int32_t, std::shared_ptr<OnDemandTrackState>> _on_demand_track_states;
+
 	std::map<ov::String, std::shared_ptr<LLHlsMasterPlaylist>> _master_playlists;
 	std::mutex _master_playlists_lock;
 
@@ -16,6 +16,8 @@ std::shared_ptr<MpegtsPushApplication> MpegtsPushApplication::Create(const std::
 MpegtsPushApplication::MpegtsPushApplication(const std::shared_ptr<pub::Publisher> &publisher, const info::Application &application_info)
 	: PushApplication(publisher, application_info)
 {
+	// Data packets are not supported
+	SetSubscription(MediaRouteSubscription().SetMediaTypes({cmn::MediaType::Video, cmn::MediaType::Audio}));
 }
 
 MpegtsPushApplication::~MpegtsPushApplication()
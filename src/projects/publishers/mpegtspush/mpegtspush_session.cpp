@@ -126,6 +126,18 @@ bool MpegtsPushSession::Start()
 		return false;
 	}
 
+	// Start with the last GOP so that the output begins with a key frame without waiting for the next one
+	_gop_cache_last_dts_map.clear();
+	for (const auto &packet : GetStream()->GetGopCache())
+	{
+		if (PutPacket(packet) == false)
+		{
+			return false;
+		}
+
+		_gop_cache_last_dts_map[packet->GetTrackId()] = packet->GetDts();
+	}
+
 	return Session::Start();
 }
 
@@ -171,32 +183,50 @@ void MpegtsPushSession::SendOutgoingData(const std::any &packet)
 
 	std::lock_guard<std::shared_mutex> lock(_mutex);
 
-	if(_writer != nullptr)
-    {
-	  	bool ret = _writer->PutData(
-			session_packet->GetTrackId(), 
-			session_packet->GetPts(),
-			session_packet->GetDts(), 
-			session_packet->GetFlag(), 
-			session_packet->GetBitstreamFormat(),
-			session_packet->GetData());
-
-		if(ret == false)
+	if (_gop_cache_last_dts_map.empty() == false)
+	{
+		auto item = _gop_cache_last_dts_map.find(session_packet->GetTrackId());
+		if (item != _gop_cache_last_dts_map.end())
 		{
-			logte("Failed to send packet");
+			if (session_packet->GetDts() <= item->second)
+			{
+				// Already sent from the GOP cache
+				return;
+			}
+
+			_gop_cache_last_dts_map.erase(item);
+		}
+	}
 
-			SetState(SessionState::Error);
-			GetPush()->SetState(info::Push::PushState::Error);
-			
-			_writer->Stop();
-			_writer = nullptr;
+	PutPacket(session_packet);
+}
 
-			return;
-		} 
+bool MpegtsPushSession::PutPacket(const std::shared_ptr<MediaPacket> &packet)
+{
+	if(_writer == nullptr)
+	{
+		return false;
+	}
+
+	bool ret = _writer->PutData(packet);
+
+	if(ret == false)
+	{
+		logte("Failed to send packet");
+
+		SetState(SessionState::Error);
+		GetPush()->SetState(info::Push::PushState::Error);
+		
+		_writer->Stop();
+		_writer = nullptr;
+
+		return false;
+	} 
+
+	GetPush()->UpdatePushTime();
+	GetPush()->IncreasePushBytes(packet->GetData()->GetLength());
 
-		GetPush()->UpdatePushTime();
-		GetPush()->IncreasePushBytes(session_packet->GetData()->GetLength());		
-    }    
+	return true;
 }
 
 void MpegtsPushSession::SetPush(std::shared_ptr<info::Push> &push)
@@ -26,9 +26,16 @@ public:
 	std::shared_ptr<info::Push>& GetPush();
 	
 private:
+	// Must be called with _mutex locked
+	bool PutPacket(const std::shared_ptr<MediaPacket> &packet);
+
 	std::shared_ptr<info::Push> _push;
 	
 	std::shared_mutex _mutex;
 	
 	std::shared_ptr<MpegtsWriter> _writer;
+
+	// Last DTS of each track sent from the GOP cache.
+	// Packets that were also queued to this session while the GOP cache was being sent are skipped.
+	std::map<MediaTrackId, int64_t> _gop_cache_last_dts_map;
 };
@@ -13,7 +13,8 @@ std::shared_ptr<OvtApplication> OvtApplication::Create(const std::shared_ptr<pub
 OvtApplication::OvtApplication(const std::shared_ptr<pub::Publisher> &publisher, const info::Application &application_info)
 		: Application(publisher, application_info)
 {
-
+	// Data packets are not supported
+	SetSubscription(MediaRouteSubscription().SetMediaTypes({cmn::MediaType::Video, cmn::MediaType::Audio}));
 }
 
 OvtApplication::~OvtApplication()
@@ -64,13 +64,27 @@ bool OvtPublisher::Start()
 	auto worker_count = ovt_config.GetWorkerCount(&is_configured);
 	worker_count = is_configured ? worker_count : PHYSICAL_PORT_USE_DEFAULT_COUNT;
 
+	PhysicalPort::OnSocketCreated on_socket_created = nullptr;
+	if (port_config.GetSocketType() == ov::SocketType::Srt)
+	{
+		on_socket_created = [](const std::shared_ptr<ov::Socket> &socket) -> std::shared_ptr<ov::Error> {
+			// OVT is a byte stream, so a packet must be retransmitted instead of being skipped even if it is too late
+			if (socket->SetSockOpt<bool>(SRTO_TLPKTDROP, false) == false)
+			{
+				return ov::Error::CreateError(OV_LOG_TAG, "Could not disable SRTO_TLPKTDROP");
+			}
+
+			return nullptr;
+		};
+	}
+
 	bool result = true;
 	std::vector<std::shared_ptr<PhysicalPort>> server_port_list;
 	std::vector<ov::String> address_string_list;
 
 	for (auto &address : address_list)
 	{
-		auto server_port = PhysicalPortManager::GetInstance()->CreatePort("OvtPub", port_config.GetSocketType(), address, worker_count);
+		auto server_port = PhysicalPortManager::GetInstance()->CreatePort("OvtPub", port_config.GetSocketType(), address, worker_count, 0, 0, on_socket_created);
 
 		if (server_port == nullptr)
 		{
@@ -175,6 +189,12 @@ bool OvtPublisher::RemoveDepacketizer(int remote_id)
 	return true;
 }
 
+bool OvtPublisher::IsMultiplexedRemote(int remote_id)
+{
+	std::lock_guard<std::mutex> guard(_multiplexed_remotes_lock);
+	return _multiplexed_remotes.find(remote_id) != _multiplexed_remotes.end();
+}
+
 void OvtPublisher::OnConnected(const std::shared_ptr<ov::Socket> &remote)
 {
 	// NOTHING
@@ -233,7 +253,11 @@ void OvtPublisher::OnDataReceived(const std::shared_ptr<ov::Socket> &remote,
 			return;
 		}
 
-		if (app.UpperCaseString() == "DESCRIBE")
+		if (app.UpperCaseString() == "HELLO")
+		{
+			HandleHelloRequest(remote, request_id);
+		}
+		else if (app.UpperCaseString() == "DESCRIBE")
 		{
 			HandleDescribeRequest(remote, request_id, url);
 		}
@@ -243,7 +267,9 @@ void OvtPublisher::OnDataReceived(const std::shared_ptr<ov::Socket> &remote,
 		}
 		else if (app.UpperCaseString() == "STOP")
 		{
-			HandleStopRequest(remote, 0, request_id, url);
+			// Legacy clients do not send the session id (they use a connection per session)
+			Json::Value &json_session_id = object.GetJsonValue()["sessionId"];
+			HandleStopRequest(remote, json_session_id.isUInt() ? json_session_id.asUInt() : 0, request_id, url);
 		}
 		else
 		{
@@ -276,6 +302,22 @@ void OvtPublisher::OnDisconnected(const std::shared_ptr<ov::Socket> &remote,
 	}
 	UnlinkRemoteFromStream(remote->GetNativeHandle());
 	RemoveDepacketizer(remote->GetNativeHandle());
+
+	std::lock_guard<std::mutex> guard(_multiplexed_remotes_lock);
+	_multiplexed_remotes.erase(remote->GetNativeHandle());
+}
+
+void OvtPublisher::HandleHelloRequest(const std::shared_ptr<ov::Socket> &remote, uint32_t request_id)
+{
+	{
+		std::lock_guard<std::mutex> guard(_multiplexed_remotes_lock);
+		_multiplexed_remotes.insert(remote->GetNativeHandle());
+	}
+
+	Json::Value contents;
+	contents["multiplex"] = true;
+
+	ResponseResult(remote, 0, "hello", request_id, 200, "ok", contents);
 }
 
 void OvtPublisher::HandleDescribeRequest(const std::shared_ptr<ov::Socket> &remote, const uint32_t request_id, const std::shared_ptr<const ov::Url> &url)
@@ -350,8 +392,14 @@ void OvtPublisher::HandlePlayRequest(const std::shared_ptr<ov::Socket> &remote,
 		return;
 	}
 
-	// Session ID is remote socket's ID
-	auto session = OvtSession::Create(app, stream, remote->GetNativeHandle(), remote);
+	auto session_id = ++_last_issued_session_id;
+	if (session_id == 0)
+	{
+		// 0 is used for the messages that do not belong to a session
+		session_id = ++_last_issued_session_id;
+	}
+
+	auto session = OvtSession::Create(app, stream, session_id, remote, IsMultiplexedRemote(remote->GetNativeHandle()));
 	if (session == nullptr)
 	{
 		ov::String msg;
@@ -362,7 +410,10 @@ void OvtPublisher::HandlePlayRequest(const std::shared_ptr<ov::Socket> &remote,
 
 	LinkRemoteWithStream(remote->GetNativeHandle(), stream);
 
-	ResponseResult(remote, session->GetId(), "play", request_id, 200, "ok");
+	Json::Value contents;
+	contents["sessionId"] = session->GetId();
+
+	ResponseResult(remote, session->GetId(), "play", request_id, 200, "ok", contents);
 
 	stream->AddSession(session);
 }
@@ -382,8 +433,19 @@ void OvtPublisher::HandleStopRequest(const std::shared_ptr<ov::Socket> &remote,
 
 	ResponseResult(remote, session_id, "stop", request_id, 200, "ok");
 
-	// Session ID is remote socket's ID
-	stream->RemoveSession(remote->GetNativeHandle());
+	if (session_id == 0)
+	{
+		// The connection has only one session of the stream
+		stream->RemoveSessionByConnectorId(remote->GetNativeHandle());
+		return;
+	}
+
+	// The session must belong to the connection
+	auto session = std::static_pointer_cast<OvtSession>(stream->GetSession(session_id));
+	if (session != nullptr && session->GetConnector()->GetNativeHandle() == remote->GetNativeHandle())
+	{
+		stream->RemoveSession(session_id);
+	}
 }
 
 void OvtPublisher::ResponseResult(const std::shared_ptr<ov::Socket> &remote, uint32_t session_id, const ov::String app, uint32_t request_id, uint32_t code, const ov::String &msg)
@@ -428,6 +490,7 @@ void OvtPublisher::SendResponse(const std::shared_ptr<ov::Socket> &remote, uint3
 			return;
 		}
 
+		packet->SetSessionId(session_id);
 		remote->Send(packet->GetData());
 	}
 }
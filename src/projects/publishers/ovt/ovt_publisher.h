@@ -49,6 +49,7 @@ private:
 	void OnDisconnected(const std::shared_ptr<ov::Socket> &remote, PhysicalPortDisconnectReason reason, const std::shared_ptr<const ov::Error> &error) override;
 	//--------------------------------------------------------------------
 
+	void HandleHelloRequest(const std::shared_ptr<ov::Socket> &remote, uint32_t request_id);
 	void HandleDescribeRequest(const std::shared_ptr<ov::Socket> &remote, uint32_t request_id, const std::shared_ptr<const ov::Url> &url);
 	void HandlePlayRequest(const std::shared_ptr<ov::Socket> &remote, uint32_t request_id, const std::shared_ptr<const ov::Url> &url);
 	void HandleStopRequest(const std::shared_ptr<ov::Socket> &remote, uint32_t session_id, uint32_t request_id, const std::shared_ptr<const ov::Url> &url);
@@ -64,6 +65,8 @@ private:
 	std::shared_ptr<OvtDepacketizer> GetDepacketizer(int remote_id);
 	bool RemoveDepacketizer(int remote_id);
 
+	bool IsMultiplexedRemote(int remote_id);
+
 	std::mutex _server_port_list_mutex;
 	std::vector<std::shared_ptr<PhysicalPort>> _server_port_list;
 
@@ -72,4 +75,11 @@ private:
 	std::map<int, std::shared_ptr<OvtDepacketizer>> _depacketizers;
 	// When a client is disconnected ungracefully, this map helps to find stream and delete the session quickly
 	std::multimap<int, std::shared_ptr<OvtStream>> _remote_stream_map;
+
+	// The remotes that carry several sessions over one connection (requested by HELLO)
+	std::mutex _multiplexed_remotes_lock;
+	std::set<int> _multiplexed_remotes;
+
+	// OVT Session ID must be unique in a connection, because the sessions of several streams can share it
+	std::atomic<uint32_t> _last_issued_session_id{0};
 };
@@ -2,6 +2,7 @@
 #include <base/ovlibrary/byte_io.h>
 #include <base/publisher/stream.h>
 #include <modules/ovt_packetizer/ovt_packet.h>
+#include <modules/ovt_packetizer/ovt_packetizer.h>
 #include <monitoring/monitoring.h>
 #include "ovt_session.h"
 #include "ovt_private.h"
@@ -9,10 +10,11 @@
 std::shared_ptr<OvtSession> OvtSession::Create(const std::shared_ptr<pub::Application> &application,
 										  	   const std::shared_ptr<pub::Stream> &stream,
 										  	   uint32_t session_id,
-										  	   const std::shared_ptr<ov::Socket> &connector)
+										  	   const std::shared_ptr<ov::Socket> &connector,
+										  	   bool multiplexed)
 {
 	auto session_info = info::Session(*std::static_pointer_cast<info::Stream>(stream), session_id);
-	auto session = std::make_shared<OvtSession>(session_info, application, stream, connector);
+	auto session = std::make_shared<OvtSession>(session_info, application, stream, connector, multiplexed);
 	if(!session->Start())
 	{
 		return nullptr;
@@ -23,12 +25,17 @@ std::shared_ptr<OvtSession> OvtSession::Create(const std::shared_ptr<pub::Applic
 OvtSession::OvtSession(const info::Session &session_info,
 		   const std::shared_ptr<pub::Application> &application,
 		   const std::shared_ptr<pub::Stream> &stream,
-		   const std::shared_ptr<ov::Socket> &connector)
+		   const std::shared_ptr<ov::Socket> &connector,
+		   bool multiplexed)
    : pub::Session(session_info, application, stream)
 {
 	_connector = connector;
+	_multiplexed = multiplexed;
 	_sent_ready = false;
 
+	// A slow subscriber skips to the next keyframe instead of being disconnected
+	_connector->SetSendBufferPolicy(ov::SendBufferPolicy::DropByOwner);
+
 	MonitorInstance->OnSessionConnected(*GetStream(), PublisherType::Ovt);
 }
 
@@ -49,29 +56,36 @@ bool OvtSession::Start()
 bool OvtSession::Stop()
 {
 	logtd("OvtSession(%d) has stopped", GetId());
-	_connector->Close();
-	
+
+	if (_multiplexed)
+	{
+		// The other sessions are still using the connection
+		if (GetState() != SessionState::Stopped)
+		{
+			SendStopNotification();
+		}
+	}
+	else
+	{
+		_connector->Close();
+	}
+
 	return Session::Stop();
 }
 
-void OvtSession::SendOutgoingData(const std::any &packet)
+void OvtSession::SendOutgoingPackets(const pub::PacketBatch<OvtPacket> &packets)
 {
-	std::shared_ptr<OvtPacket> session_packet;
-
-	try 
+	for (const auto &session_packet : packets)
 	{
-        session_packet = std::any_cast<std::shared_ptr<OvtPacket>>(packet);
-		if(session_packet == nullptr)
+		if (session_packet != nullptr)
 		{
-			return;
+			SendOvtPacket(session_packet);
 		}
-    }
-    catch(const std::bad_any_cast& e) 
-	{
-        logtd("An incorrect type of packet was input from the stream. (%s)", e.what());
-		return;
-    }
+	}
+}
 
+void OvtSession::SendOvtPacket(const std::shared_ptr<OvtPacket> &session_packet)
+{
 	// OvtSession should send full packet so it will start to send from next packet of marker packet.
 	if(_sent_ready == false)
 	{
@@ -83,11 +97,83 @@ void OvtSession::SendOutgoingData(const std::any &packet)
 		return;
 	}
 
-	// Set OVT Session ID into packet
-	auto copy_packet = std::make_shared<OvtPacket>(*session_packet);
-	copy_packet->SetSessionId(GetId());
+	if (session_packet->PayloadType() == OVT_PAYLOAD_TYPE_MEDIA_PACKET)
+	{
+		// The packets of a MediaPacket are sent or dropped together, so the subscriber can always reassemble it
+		auto at_boundary = _at_media_packet_boundary;
+		_at_media_packet_boundary = session_packet->Marker();
+
+		if (at_boundary)
+		{
+			if (_waiting_for_keyframe)
+			{
+				// Resumes from a video keyframe (or from any packet if there is no video)
+				if ((_connector->IsSendBufferFull() == false) &&
+					(session_packet->IsKeyframe() || (GetStream()->HasVideoTrack() == false)))
+				{
+					logti("OvtSession(%d) resumes sending from a keyframe (%" PRIu64 " media packets were dropped)", GetId(), _dropped_media_packet_count);
+
+					_waiting_for_keyframe = false;
+					_dropped_media_packet_count = 0;
+				}
+			}
+			else if (_connector->IsSendBufferFull())
+			{
+				logtw("OvtSession(%d) drops the media packets until the next keyframe, because the send buffer is full (%zu bytes)", GetId(), _connector->GetQueuedBytes());
+
+				_waiting_for_keyframe = true;
+			}
+
+			if (_waiting_for_keyframe)
+			{
+				_dropped_media_packet_count++;
+			}
+		}
+
+		if (_waiting_for_keyframe)
+		{
+			return;
+		}
+	}
+
+	// Only the header is copied to set OVT Session ID, and the payload buffers (the data of MediaPacket)
+	// are shared by all sessions of the stream, they are written with a vectored send
+	auto data_list = session_packet->GetDataList();
+	auto header = std::make_shared<ov::Data>(data_list[0]->GetData(), OVT_FIXED_HEADER_SIZE);
+	ByteWriter<uint32_t>::WriteBigEndian(header->GetWritableDataAs<uint8_t>() + 12, GetId());
+
+	if (data_list[0]->GetLength() > OVT_FIXED_HEADER_SIZE)
+	{
+		// The payload is copied into the packet (e.g. message)
+		data_list.insert(data_list.begin() + 1, data_list[0]->Subdata(OVT_FIXED_HEADER_SIZE));
+	}
+	data_list[0] = header;
+
+	_connector->Send(data_list);
+}
+
+void OvtSession::SendStopNotification()
+{
+	Json::Value root;
+
+	root["id"] = 0;
+	root["application"] = "stop";
+	root["code"] = 200;
+	root["message"] = "Stream has been stopped";
+
+	OvtPacketizer packetizer;
+	if (packetizer.PacketizeMessage(OVT_PAYLOAD_TYPE_MESSAGE_RESPONSE, ov::Clock::NowMSec(), ov::Json::Stringify(root).ToData(false)) == false)
+	{
+		return;
+	}
+
+	while (packetizer.IsAvailablePackets())
+	{
+		auto packet = packetizer.PopPacket();
+		packet->SetSessionId(GetId());
 
-	_connector->Send(copy_packet->GetData());
+		_connector->Send(packet->GetData());
+	}
 }
 
 const std::shared_ptr<ov::Socket> OvtSession::GetConnector()
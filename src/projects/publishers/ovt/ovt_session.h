@@ -3,30 +3,47 @@
 #include <base/info/media_track.h>
 #include <base/ovsocket/socket.h>
 #include <base/publisher/session.h>
+#include <base/publisher/stream_packet_queue.h>
 
-class OvtSession : public pub::Session
+class OvtPacket;
+
+class OvtSession : public pub::Session, public pub::PacketSink<OvtPacket>
 {
 public:
 	static std::shared_ptr<OvtSession> Create(const std::shared_ptr<pub::Application> &application,
 											  const std::shared_ptr<pub::Stream> &stream,
 											  uint32_t ovt_session_id,
-											  const std::shared_ptr<ov::Socket> &connector);
+											  const std::shared_ptr<ov::Socket> &connector,
+											  bool multiplexed = false);
 
 	OvtSession(const info::Session &session_info,
 			const std::shared_ptr<pub::Application> &application,
 			const std::shared_ptr<pub::Stream> &stream,
-			const std::shared_ptr<ov::Socket> &connector);
+			const std::shared_ptr<ov::Socket> &connector,
+			bool multiplexed);
 	~OvtSession() override;
 
 	bool Start() override;
 	bool Stop() override;
 
-	void SendOutgoingData(const std::any &packet) override;
 	void OnMessageReceived(const std::any &message) override;
 
+	// pub::PacketSink Interface
+	void SendOutgoingPackets(const pub::PacketBatch<OvtPacket> &packets) override;
+
 	const std::shared_ptr<ov::Socket> GetConnector();
 
 private:
+	void SendOvtPacket(const std::shared_ptr<OvtPacket> &session_packet);
+	void SendStopNotification();
+
 	std::shared_ptr<ov::Socket>		_connector;
+	// The connector is shared with the other sessions, so it must not be closed by this session
+	bool							_multiplexed;
 	bool 							_sent_ready;
+	// The media packets are dropped until the next keyframe because the send buffer of the connector is full
+	bool							_waiting_for_keyframe = false;
+	// The packet to be sent is the first packet of a MediaPacket
+	bool							_at_media_packet_boundary = true;
+	uint64_t						_dropped_media_packet_count = 0;
 };
@@ -37,7 +37,7 @@ bool OvtStream::Start()
 		return false;
 	}
 
-	if(!CreateStreamWorker(_worker_count))
+	if(!CreateStreamWorker<OvtPacket>(_worker_count))
 	{
 		return false;
 	}
@@ -206,11 +206,10 @@ void OvtStream::SendAudioFrame(const std::shared_ptr<MediaPacket> &media_packet)
 bool OvtStream::OnOvtPacketized(std::shared_ptr<OvtPacket> &packet)
 {
 	// Broadcasting
-	auto stream_packet = std::make_any<std::shared_ptr<OvtPacket>>(packet);
-	BroadcastPacket(stream_packet);
+	BroadcastPacket(packet);
 	
 	
-	MonitorInstance->IncreaseBytesOut(*pub::Stream::GetSharedPtrAs<info::Stream>(), PublisherType::Ovt, packet->GetData()->GetLength() * GetSessionCount());
+	MonitorInstance->IncreaseBytesOut(*pub::Stream::GetSharedPtrAs<info::Stream>(), PublisherType::Ovt, packet->PacketLength() * GetSessionCount());
 
 	return true;
 }
@@ -234,6 +233,9 @@ bool OvtStream::RemoveSessionByConnectorId(int connector_id)
 
 	logtd("RemoveSessionByConnectorId : all(%d) connector(%d)", sessions.size(), connector_id);
 
+	bool removed = false;
+
+	// A multiplexed connection can have several sessions of the stream
 	for(const auto &item : sessions)
 	{
 		auto session = std::static_pointer_cast<OvtSession>(item.second);
@@ -242,9 +244,9 @@ bool OvtStream::RemoveSessionByConnectorId(int connector_id)
 		if(session->GetConnector()->GetNativeHandle() == connector_id)
 		{
 			RemoveSession(session->GetId());
-			return true;
+			removed = true;
 		}
 	}
 
-	return false;
+	return removed;
 }
\ No newline at end of file
@@ -16,3 +16,4 @@
 #include "./mpegtspush/mpegtspush_publisher.h"
 #include "./rtmppush/rtmppush_publisher.h"
 #include "./thumbnail/thumbnail_publisher.h"
+#include "./srt/srt_publisher.h"
@@ -16,6 +16,8 @@ std::shared_ptr<RtmpPushApplication> RtmpPushApplication::Create(const std::shar
 RtmpPushApplication::RtmpPushApplication(const std::shared_ptr<pub::Publisher> &publisher, const info::Application &application_info)
 	: PushApplication(publisher, application_info)
 {
+	// Data packets are not supported
+	SetSubscription(MediaRouteSubscription().SetMediaTypes({cmn::MediaType::Video, cmn::MediaType::Audio}));
 }
 
 RtmpPushApplication::~RtmpPushApplication()
@@ -0,0 +1,972 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "rtmppush_sender.h"
+
+#include <fcntl.h>
+#include <limits.h>
+#include <modules/bitstream/aac/aac_converter.h>
+#include <modules/bitstream/h264/h264_converter.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <random>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include "rtmppush_private.h"
+
+#define RTMP_PUSH_DEFAULT_PORT 1935
+#define RTMP_PUSH_RECEIVE_BUFFER_SIZE (16 * 1024)
+// If the video frames stop while the audio continues, the audio tags are sent without waiting for the video
+#define RTMP_PUSH_MAX_PENDING_TAGS 64
+
+// Size of the FLV tag header in an aggregate message (type, data size, timestamp, timestamp extended, stream id)
+#define FLV_TAG_HEADER_SIZE 11
+// FrameType | CodecID, AVCPacketType, CompositionTime
+#define FLV_VIDEO_HEADER_SIZE 5
+// SoundFormat | SoundRate | SoundSize | SoundType, AACPacketType
+#define FLV_AUDIO_HEADER_SIZE 2
+
+#define FLV_CODEC_ID_AVC 7
+#define FLV_SOUND_FORMAT_AAC 10
+
+#define FLV_AVC_PACKET_TYPE_SEQUENCE_HEADER 0
+#define FLV_AVC_PACKET_TYPE_NALU 1
+#define FLV_AAC_PACKET_TYPE_SEQUENCE_HEADER 0
+#define FLV_AAC_PACKET_TYPE_RAW 1
+
+bool RtmpPushSender::IsSupportUrl(const ov::String &url)
+{
+	// RTMPS needs TLS, which is left to FFmpeg
+	return url.LowerCaseString().HasPrefix("rtmp://");
+}
+
+RtmpPushSender::RtmpPushSender(const Config &config)
+	: _config(config)
+{
+}
+
+RtmpPushSender::~RtmpPushSender()
+{
+	Stop();
+}
+
+bool RtmpPushSender::AddTrack(const std::shared_ptr<const MediaTrack> &track)
+{
+	switch (track->GetCodecId())
+	{
+		case cmn::MediaCodecId::H264:
+			_has_video_track = true;
+			break;
+
+		case cmn::MediaCodecId::Aac:
+			break;
+
+		default:
+			logtw("Could not supported codec. track_id:%d, codec_id: %d", track->GetId(), track->GetCodecId());
+			return false;
+	}
+
+	_tracks[track->GetId()] = track;
+
+	return true;
+}
+
+bool RtmpPushSender::Start(const ov::String &url)
+{
+	auto parsed_url = ov::Url::Parse(url);
+	if (parsed_url == nullptr)
+	{
+		logte("Invalid URL: %s", url.CStr());
+		return false;
+	}
+
+	// rtmp://<host>[:<port>]/<app>/<stream>, the app may contain '/' (same as tcUrl of RtmpWriter)
+	auto path = parsed_url->Path();
+	auto stream_index = path.IndexOfRev('/');
+
+	if (stream_index <= 0)
+	{
+		logte("Could not find the app and the stream name in the URL: %s", url.CStr());
+		return false;
+	}
+
+	auto app = path.Substring(1, stream_index - 1);
+	_stream_name = path.Substring(stream_index + 1);
+
+	if (parsed_url->HasQueryString())
+	{
+		_stream_name.AppendFormat("?%s", parsed_url->Query().CStr());
+	}
+
+	auto tc_url = ov::String::FormatString("%s://%s", parsed_url->Scheme().CStr(), parsed_url->Host().CStr());
+	if (parsed_url->Port() != 0)
+	{
+		tc_url.AppendFormat(":%u", parsed_url->Port());
+	}
+	tc_url.AppendFormat("/%s", app.CStr());
+
+	if ((Connect(parsed_url->Host(), (parsed_url->Port() != 0) ? parsed_url->Port() : RTMP_PUSH_DEFAULT_PORT) == false) ||
+		(Handshake() == false))
+	{
+		Stop();
+		return false;
+	}
+
+	_import_chunk = std::make_shared<RtmpImportChunk>(RTMP_DEFAULT_CHUNK_SIZE);
+	_received_data = std::make_shared<ov::Data>();
+
+	if ((SendSetChunkSize() == false) ||
+		(SendConnect(app, tc_url) == false) ||
+		(SendPublish(_stream_name) == false) ||
+		(SendMetaData() == false) ||
+		(SendSequenceHeaders() == false))
+	{
+		Stop();
+		return false;
+	}
+
+	logti("RTMP push has started. url(%s/%s) chunk size(%u) aggregation(%s)",
+		  tc_url.CStr(), _stream_name.CStr(), _config.chunk_size, _config.aggregate_messages ? "true" : "false");
+
+	return true;
+}
+
+bool RtmpPushSender::Connect(const ov::String &host, uint32_t port)
+{
+	addrinfo hints = {};
+	addrinfo *result = nullptr;
+
+	hints.ai_family = AF_UNSPEC;
+	hints.ai_socktype = SOCK_STREAM;
+
+	auto error = ::getaddrinfo(host.CStr(), ov::Converter::ToString(port).CStr(), &hints, &result);
+	if (error != 0)
+	{
+		logte("Could not resolve %s:%u (%s)", host.CStr(), port, ::gai_strerror(error));
+		return false;
+	}
+
+	timeval timeout = {_config.timeout_ms / 1000, (_config.timeout_ms % 1000) * 1000};
+
+	for (auto address = result; address != nullptr; address = address->ai_next)
+	{
+		_socket = ::socket(address->ai_family, address->ai_socktype | SOCK_CLOEXEC, address->ai_protocol);
+
+		if (_socket < 0)
+		{
+			continue;
+		}
+
+		// The timeouts are applied to connect() as well
+		::setsockopt(_socket, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+		::setsockopt(_socket, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+
+		if (::connect(_socket, address->ai_addr, address->ai_addrlen) == 0)
+		{
+			break;
+		}
+
+		::close(_socket);
+		_socket = -1;
+	}
+
+	::freeaddrinfo(result);
+
+	if (_socket < 0)
+	{
+		logte("Could not connect to %s:%u (%s)", host.CStr(), port, ov::Error::CreateErrorFromErrno()->What());
+		return false;
+	}
+
+	// Each message is written at once, so there is nothing to wait for
+	int no_delay = 1;
+	::setsockopt(_socket, IPPROTO_TCP, TCP_NODELAY, &no_delay, sizeof(no_delay));
+
+	return true;
+}
+
+bool RtmpPushSender::Handshake()
+{
+	// Simple handshake: C0 + C1 (time, zero, random) -> S0 + S1 + S2 -> C2 (echo of S1)
+	uint8_t c0c1[1 + RTMP_HANDSHAKE_PACKET_SIZE] = {RTMP_HANDSHAKE_VERSION};
+	std::mt19937 random_number(static_cast<uint32_t>(ov::Clock::NowMSec()));
+
+	for (int index = 9; index < static_cast<int>(sizeof(c0c1)); index++)
+	{
+		c0c1[index] = static_cast<uint8_t>(random_number() % 256);
+	}
+
+	if (WriteData(c0c1, sizeof(c0c1)) == false)
+	{
+		logte("Could not send the handshake (C0 + C1)");
+		return false;
+	}
+
+	uint8_t s0s1s2[1 + RTMP_HANDSHAKE_PACKET_SIZE * 2];
+	size_t received = 0;
+
+	while (received < sizeof(s0s1s2))
+	{
+		auto read_bytes = ::recv(_socket, s0s1s2 + received, sizeof(s0s1s2) - received, 0);
+
+		if (read_bytes <= 0)
+		{
+			if ((read_bytes < 0) && (errno == EINTR))
+			{
+				continue;
+			}
+
+			logte("Could not receive the handshake (S0 + S1 + S2)");
+			return false;
+		}
+
+		received += read_bytes;
+	}
+
+	if (s0s1s2[0] != RTMP_HANDSHAKE_VERSION)
+	{
+		logte("Unsupported RTMP version: %d", s0s1s2[0]);
+		return false;
+	}
+
+	if (WriteData(s0s1s2 + 1, RTMP_HANDSHAKE_PACKET_SIZE) == false)
+	{
+		logte("Could not send the handshake (C2)");
+		return false;
+	}
+
+	return true;
+}
+
+bool RtmpPushSender::SendSetChunkSize()
+{
+	uint8_t body[4];
+	RtmpMuxUtil::WriteInt32(body, _config.chunk_size);
+
+	// The chunk size is applied to the messages after this one
+	if (SendMessage(RTMP_CHUNK_STREAM_ID_URGENT, RTMP_MSGID_SET_CHUNK_SIZE, 0, 0, {{body, sizeof(body)}}) == false)
+	{
+		return false;
+	}
+
+	return true;
+}
+
+bool RtmpPushSender::SendConnect(const ov::String &app, const ov::String &tc_url)
+{
+	AmfDocument document;
+
+	auto object = new AmfObject;
+	object->AddProperty("app", app.CStr());
+	object->AddProperty("type", "nonprivate");
+	object->AddProperty("flashVer", "FMLE/3.0 (compatible; FMSc/1.0)");
+	object->AddProperty("tcUrl", tc_url.CStr());
+
+	document.AddProperty(RTMP_CMD_NAME_CONNECT);
+	document.AddProperty(RTMP_CMD_TRID_CONNECT);
+	document.AddProperty(object);
+
+	if (SendAmfCommand(RTMP_CHUNK_STREAM_ID_CONTROL, 0, document) == false)
+	{
+		return false;
+	}
+
+	ov::String error_code;
+
+	bool result = WaitForMessage([&](const std::shared_ptr<const RtmpMessage> &message) -> bool {
+		if (message->header->completed.type_id != RTMP_MSGID_AMF0_COMMAND_MESSAGE)
+		{
+			return false;
+		}
+
+		AmfDocument response;
+		if ((response.Decode(message->payload->GetData(), message->payload->GetLength()) == 0) || (response.GetPropertyCount() < 2) ||
+			(response.GetProperty(0)->GetType() != AmfDataType::String) || (response.GetProperty(1)->GetNumber() != RTMP_CMD_TRID_CONNECT))
+		{
+			return false;
+		}
+
+		if (::strcmp(response.GetProperty(0)->GetString(), RTMP_ACK_NAME_RESULT) != 0)
+		{
+			error_code = response.GetProperty(0)->GetString();
+		}
+
+		return true;
+	});
+
+	if ((result == false) || (error_code.IsEmpty() == false))
+	{
+		logte("Could not connect to the app: %s (%s)", app.CStr(), error_code.CStr());
+		return false;
+	}
+
+	return true;
+}
+
+bool RtmpPushSender::SendPublish(const ov::String &stream_name)
+{
+	AmfDocument release_stream;
+	release_stream.AddProperty(RTMP_CMD_NAME_RELEASESTREAM);
+	release_stream.AddProperty(RTMP_CMD_TRID_RELEASESTREAM);
+	release_stream.AddProperty(AmfDataType::Null);
+	release_stream.AddProperty(stream_name.CStr());
+
+	AmfDocument fc_publish;
+	fc_publish.AddProperty(RTMP_CMD_NAME_FCPUBLISH);
+	fc_publish.AddProperty(RTMP_CMD_TRID_FCPUBLISH);
+	fc_publish.AddProperty(AmfDataType::Null);
+	fc_publish.AddProperty(stream_name.CStr());
+
+	// Transaction IDs after the ones defined in rtmp_define.h
+	_transaction_id = RTMP_CMD_TRID_FCUNPUBLISH + 1.0;
+	auto create_stream_transaction_id = _transaction_id++;
+
+	AmfDocument create_stream;
+	create_stream.AddProperty(RTMP_CMD_NAME_CREATESTREAM);
+	create_stream.AddProperty(create_stream_transaction_id);
+	create_stream.AddProperty(AmfDataType::Null);
+
+	if ((SendAmfCommand(RTMP_CHUNK_STREAM_ID_CONTROL, 0, release_stream) == false) ||
+		(SendAmfCommand(RTMP_CHUNK_STREAM_ID_CONTROL, 0, fc_publish) == false) ||
+		(SendAmfCommand(RTMP_CHUNK_STREAM_ID_CONTROL, 0, create_stream) == false))
+	{
+		return false;
+	}
+
+	bool is_created = false;
+
+	bool result = WaitForMessage([&](const std::shared_ptr<const RtmpMessage> &message) -> bool {
+		if (message->header->completed.type_id != RTMP_MSGID_AMF0_COMMAND_MESSAGE)
+		{
+			return false;
+		}
+
+		AmfDocument response;
+		if ((response.Decode(message->payload->GetData(), message->payload->GetLength()) == 0) || (response.GetPropertyCount() < 2) ||
+			(response.GetProperty(0)->GetType() != AmfDataType::String) || (response.GetProperty(1)->GetNumber() != create_stream_transaction_id))
+		{
+			// Responses of releaseStream and FCPublish
+			return false;
+		}
+
+		if ((::strcmp(response.GetProperty(0)->GetString(), RTMP_ACK_NAME_RESULT) == 0) &&
+			(response.GetPropertyCount() >= 4) && (response.GetProperty(3)->GetType() == AmfDataType::Number))
+		{
+			_rtmp_stream_id = static_cast<uint32_t>(response.GetProperty(3)->GetNumber());
+			is_created = true;
+		}
+
+		return true;
+	});
+
+	if ((result == false) || (is_created == false))
+	{
+		logte("Could not create a stream: %s", stream_name.CStr());
+		return false;
+	}
+
+	AmfDocument publish;
+	publish.AddProperty(RTMP_CMD_NAME_PUBLISH);
+	publish.AddProperty(RTMP_CMD_TRID_PUBLISH);
+	publish.AddProperty(AmfDataType::Null);
+	publish.AddProperty(stream_name.CStr());
+	publish.AddProperty("live");
+
+	if (SendAmfCommand(RTMP_CHUNK_STREAM_ID_MEDIA, _rtmp_stream_id, publish) == false)
+	{
+		return false;
+	}
+
+	ov::String status_code;
+
+	result = WaitForMessage([&](const std::shared_ptr<const RtmpMessage> &message) -> bool {
+		if (message->header->completed.type_id != RTMP_MSGID_AMF0_COMMAND_MESSAGE)
+		{
+			return false;
+		}
+
+		AmfDocument response;
+		if ((response.Decode(message->payload->GetData(), message->payload->GetLength()) == 0) || (response.GetPropertyCount() < 4) ||
+			(response.GetProperty(0)->GetType() != AmfDataType::String) || (::strcmp(response.GetProperty(0)->GetString(), RTMP_CMD_NAME_ONSTATUS) != 0) ||
+			(response.GetProperty(3)->GetType() != AmfDataType::Object))
+		{
+			return false;
+		}
+
+		auto object = response.GetProperty(3)->GetObject();
+		auto index = object->FindName("code");
+
+		status_code = (index >= 0) ? object->GetString(index) : "";
+
+		return true;
+	});
+
+	if ((result == false) || (status_code != "NetStream.Publish.Start"))
+	{
+		logte("Could not publish the stream: %s (%s)", stream_name.CStr(), status_code.CStr());
+		return false;
+	}
+
+	return true;
+}
+
+bool RtmpPushSender::SendMetaData()
+{
+	AmfDocument document;
+
+	auto array = new AmfArray;
+
+	for (const auto &[track_id, track] : _tracks)
+	{
+		if (track->GetMediaType() == cmn::MediaType::Video)
+		{
+			array->AddProperty("width", static_cast<double>(track->GetWidth()));
+			array->AddProperty("height", static_cast<double>(track->GetHeight()));
+			array->AddProperty("framerate", track->GetFrameRate());
+			array->AddProperty("videocodecid", static_cast<double>(FLV_CODEC_ID_AVC));
+			array->AddProperty("videodatarate", track->GetBitrate() / 1000.0);
+		}
+		else if (track->GetMediaType() == cmn::MediaType::Audio)
+		{
+			array->AddProperty("audiocodecid", static_cast<double>(FLV_SOUND_FORMAT_AAC));
+			array->AddProperty("audiosamplerate", static_cast<double>(track->GetSampleRate()));
+			array->AddProperty("audiochannels", static_cast<double>(track->GetChannel().GetCounts()));
+			array->AddProperty("audiodatarate", track->GetBitrate() / 1000.0);
+		}
+	}
+
+	array->AddProperty("encoder", "OvenMediaEngine");
+
+	document.AddProperty(RTMP_CMD_DATA_SETDATAFRAME);
+	document.AddProperty(RTMP_CMD_DATA_ONMETADATA);
+	document.AddProperty(array);
+
+	return SendAmfCommand(RTMP_CHUNK_STREAM_ID_MEDIA, _rtmp_stream_id, document, RTMP_MSGID_AMF0_DATA_MESSAGE);
+}
+
+bool RtmpPushSender::SendSequenceHeaders()
+{
+	for (const auto &[track_id, track] : _tracks)
+	{
+		Tag tag;
+		tag.timestamp = 0;
+
+		if (track->GetCodecId() == cmn::MediaCodecId::H264)
+		{
+			uint8_t header[FLV_VIDEO_HEADER_SIZE] = {0x10 | FLV_CODEC_ID_AVC, FLV_AVC_PACKET_TYPE_SEQUENCE_HEADER, 0, 0, 0};
+
+			tag.type_id = RTMP_MSGID_VIDEO_MESSAGE;
+			tag.header = std::make_shared<ov::Data>(header, sizeof(header));
+			tag.data = track->GetCodecComponentData(MediaTrack::CodecComponentDataType::AVCDecoderConfigurationRecord);
+		}
+		else
+		{
+			uint8_t header[FLV_AUDIO_HEADER_SIZE] = {(FLV_SOUND_FORMAT_AAC << 4) | 0x0F, FLV_AAC_PACKET_TYPE_SEQUENCE_HEADER};
+
+			tag.type_id = RTMP_MSGID_AUDIO_MESSAGE;
+			tag.header = std::make_shared<ov::Data>(header, sizeof(header));
+			tag.data = track->GetCodecComponentData(MediaTrack::CodecComponentDataType::AACSpecificConfig);
+		}
+
+		if (tag.data == nullptr)
+		{
+			logtw("There is no decoder configuration. track_id:%d", track_id);
+			continue;
+		}
+
+		if (SendTag(tag) == false)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+bool RtmpPushSender::PutData(const std::shared_ptr<const MediaPacket> &packet)
+{
+	if (_socket < 0)
+	{
+		return false;
+	}
+
+	auto track_item = _tracks.find(packet->GetTrackId());
+	if (track_item == _tracks.end())
+	{
+		// Without a track, it's not an error. Ignore.
+		return true;
+	}
+
+	if (ReceivePendingMessages() == false)
+	{
+		return false;
+	}
+
+	auto &track = track_item->second;
+	auto expr = track->GetTimeBase().GetExpr() * RTMP_TIME_SCALE;
+
+	Tag tag;
+	tag.timestamp = static_cast<uint32_t>(packet->GetDts() * expr);
+
+	switch (packet->GetBitstreamFormat())
+	{
+		case cmn::BitstreamFormat::H264_AVCC:
+		case cmn::BitstreamFormat::H264_ANNEXB: {
+			auto composition_time = static_cast<int32_t>((packet->GetPts() - packet->GetDts()) * expr);
+			uint8_t header[FLV_VIDEO_HEADER_SIZE] = {
+				static_cast<uint8_t>(((packet->GetFlag() == MediaPacketFlag::Key) ? 0x10 : 0x20) | FLV_CODEC_ID_AVC),
+				FLV_AVC_PACKET_TYPE_NALU};
+			RtmpMuxUtil::WriteInt24(header + 2, composition_time);
+
+			tag.type_id = RTMP_MSGID_VIDEO_MESSAGE;
+			tag.header = std::make_shared<ov::Data>(header, sizeof(header));
+			// The converted bitstream is cached in the packet, which is shared by all push sessions of the stream
+			tag.data = (packet->GetBitstreamFormat() == cmn::BitstreamFormat::H264_ANNEXB) ? H264Converter::ConvertAnnexbToAvcc(packet) : packet->GetData();
+			break;
+		}
+
+		case cmn::BitstreamFormat::AAC_RAW:
+		case cmn::BitstreamFormat::AAC_ADTS: {
+			uint8_t header[FLV_AUDIO_HEADER_SIZE] = {(FLV_SOUND_FORMAT_AAC << 4) | 0x0F, FLV_AAC_PACKET_TYPE_RAW};
+
+			tag.type_id = RTMP_MSGID_AUDIO_MESSAGE;
+			tag.header = std::make_shared<ov::Data>(header, sizeof(header));
+			tag.data = (packet->GetBitstreamFormat() == cmn::BitstreamFormat::AAC_ADTS) ? AacConverter::ConvertAdtsToRaw(packet) : packet->GetData();
+			break;
+		}
+
+		default:
+			// Unsupported bitstream foramt
+			return false;
+	}
+
+	if (tag.data == nullptr)
+	{
+		logte("Could not convert the bitstream. track_id:%d", packet->GetTrackId());
+		return false;
+	}
+
+	if ((_config.aggregate_messages == false) || (_has_video_track == false))
+	{
+		return SendTag(tag);
+	}
+
+	// The audio tags are sent with the next video frame in an aggregate message
+	_pending_tags.push_back(tag);
+
+	if ((tag.type_id == RTMP_MSGID_VIDEO_MESSAGE) || (_pending_tags.size() >= RTMP_PUSH_MAX_PENDING_TAGS))
+	{
+		return SendAggregateMessage();
+	}
+
+	return true;
+}
+
+bool RtmpPushSender::Stop()
+{
+	if (_socket < 0)
+	{
+		return true;
+	}
+
+	if (_rtmp_stream_id != 0)
+	{
+		SendAggregateMessage();
+
+		AmfDocument fc_unpublish;
+		fc_unpublish.AddProperty(RTMP_CMD_NAME_FCUNPUBLISH);
+		fc_unpublish.AddProperty(RTMP_CMD_TRID_FCUNPUBLISH);
+		fc_unpublish.AddProperty(AmfDataType::Null);
+		fc_unpublish.AddProperty(_stream_name.CStr());
+
+		AmfDocument delete_stream;
+		delete_stream.AddProperty(RTMP_CMD_NAME_DELETESTREAM);
+		delete_stream.AddProperty(RTMP_CMD_TRID_DELETESTREAM);
+		delete_stream.AddProperty(AmfDataType::Null);
+		delete_stream.AddProperty(static_cast<double>(_rtmp_stream_id));
+
+		// The connection is closed regardless of the result
+		SendAmfCommand(RTMP_CHUNK_STREAM_ID_CONTROL, 0, fc_unpublish);
+		SendAmfCommand(RTMP_CHUNK_STREAM_ID_CONTROL, 0, delete_stream);
+
+		_rtmp_stream_id = 0;
+	}
+
+	::close(_socket);
+	_socket = -1;
+
+	_pending_tags.clear();
+
+	return true;
+}
+
+bool RtmpPushSender::WaitForMessage(const std::function<bool(const std::shared_ptr<const RtmpMessage> &message)> &condition)
+{
+	uint8_t buffer[RTMP_PUSH_RECEIVE_BUFFER_SIZE];
+
+	while (true)
+	{
+		// Parses the data received so far, the rest is kept for the next call
+		std::shared_ptr<const ov::Data> current_data = _received_data;
+		bool is_found = false;
+
+		while ((is_found == false) && (current_data->IsEmpty() == false))
+		{
+			bool is_completed = false;
+			auto import_size = _import_chunk->Import(current_data, &is_completed);
+
+			if (import_size == 0)
+			{
+				// Need more data
+				break;
+			}
+			else if (import_size < 0)
+			{
+				logte("An error occurred while parse RTMP data: %d", import_size);
+				return false;
+			}
+
+			current_data = current_data->Subdata(import_size);
+
+			while (is_completed)
+			{
+				auto message = _import_chunk->GetMessage();
+
+				if ((message == nullptr) || (message->payload == nullptr))
+				{
+					break;
+				}
+
+				if (HandleMessage(message) == false)
+				{
+					return false;
+				}
+
+				if (condition(message))
+				{
+					is_found = true;
+				}
+			}
+		}
+
+		_received_data = current_data->Clone();
+
+		if (is_found)
+		{
+			return true;
+		}
+
+		auto read_bytes = ::recv(_socket, buffer, sizeof(buffer), 0);
+
+		if (read_bytes <= 0)
+		{
+			if ((read_bytes < 0) && (errno == EINTR))
+			{
+				continue;
+			}
+
+			logte("Could not receive the response from the server (%s)", (read_bytes == 0) ? "Disconnected" : ov::Error::CreateErrorFromErrno()->What());
+			return false;
+		}
+
+		_received_bytes += read_bytes;
+		_received_data->Append(buffer, read_bytes);
+	}
+}
+
+bool RtmpPushSender::ReceivePendingMessages()
+{
+	uint8_t buffer[RTMP_PUSH_RECEIVE_BUFFER_SIZE];
+
+	while (true)
+	{
+		auto read_bytes = ::recv(_socket, buffer, sizeof(buffer), MSG_DONTWAIT | MSG_PEEK);
+
+		if (read_bytes == 0)
+		{
+			logte("The server has closed the connection");
+			return false;
+		}
+		else if (read_bytes < 0)
+		{
+			// Nothing to read
+			return ((errno == EAGAIN) || (errno == EWOULDBLOCK) || (errno == EINTR));
+		}
+
+		// Some data has arrived, so the rest of the message can be read with blocking
+		if (WaitForMessage([](const std::shared_ptr<const RtmpMessage> &message) -> bool { return true; }) == false)
+		{
+			return false;
+		}
+	}
+}
+
+bool RtmpPushSender::HandleMessage(const std::shared_ptr<const RtmpMessage> &message)
+{
+	switch (message->header->completed.type_id)
+	{
+		case RTMP_MSGID_SET_CHUNK_SIZE: {
+			auto chunk_size = RtmpMuxUtil::ReadInt32(message->payload->GetData());
+
+			if (chunk_size <= 0)
+			{
+				logte("ChunkSize Fail - Size(%d) ***", chunk_size);
+				return false;
+			}
+
+			_import_chunk->SetChunkSize(chunk_size);
+			break;
+		}
+
+		case RTMP_MSGID_WINDOWACKNOWLEDGEMENT_SIZE:
+			_window_ack_size = RtmpMuxUtil::ReadInt32(message->payload->GetData());
+			break;
+
+		case RTMP_MSGID_USER_CONTROL_MESSAGE: {
+			if ((message->payload->GetLength() >= 6) && (RtmpMuxUtil::ReadInt16(message->payload->GetData()) == RTMP_UCMID_PINGREQUEST))
+			{
+				uint8_t body[6];
+				RtmpMuxUtil::WriteInt16(body, RTMP_UCMID_PINGRESPONSE);
+				::memcpy(body + 2, message->payload->GetDataAs<uint8_t>() + 2, 4);
+
+				if (SendMessage(RTMP_CHUNK_STREAM_ID_URGENT, RTMP_MSGID_USER_CONTROL_MESSAGE, 0, 0, {{body, sizeof(body)}}) == false)
+				{
+					return false;
+				}
+			}
+			break;
+		}
+
+		case RTMP_MSGID_AMF0_COMMAND_MESSAGE: {
+			AmfDocument document;
+
+			if ((document.Decode(message->payload->GetData(), message->payload->GetLength()) > 0) && (document.GetPropertyCount() >= 4) &&
+				(document.GetProperty(0)->GetType() == AmfDataType::String) && (::strcmp(document.GetProperty(0)->GetString(), RTMP_CMD_NAME_ONSTATUS) == 0) &&
+				(document.GetProperty(3)->GetType() == AmfDataType::Object))
+			{
+				auto object = document.GetProperty(3)->GetObject();
+				auto level_index = object->FindName("level");
+				auto code_index = object->FindName("code");
+
+				if ((level_index >= 0) && (code_index >= 0) && (::strcmp(object->GetString(level_index), "error") == 0))
+				{
+					logtw("The server has returned an error: %s", object->GetString(code_index));
+				}
+			}
+			break;
+		}
+
+		default:
+			break;
+	}
+
+	if ((_window_ack_size > 0) && (_received_bytes - _acknowledged_bytes >= _window_ack_size))
+	{
+		uint8_t body[4];
+		RtmpMuxUtil::WriteInt32(body, static_cast<uint32_t>(_received_bytes));
+
+		_acknowledged_bytes = _received_bytes;
+
+		return SendMessage(RTMP_CHUNK_STREAM_ID_URGENT, RTMP_MSGID_ACKNOWLEDGEMENT, 0, 0, {{body, sizeof(body)}});
+	}
+
+	return true;
+}
+
+bool RtmpPushSender::SendAmfCommand(uint32_t chunk_stream_id, uint32_t stream_id, AmfDocument &document, uint8_t type_id)
+{
+	uint8_t body[2048];
+	auto body_size = document.Encode(body);
+
+	if (body_size == 0)
+	{
+		return false;
+	}
+
+	return SendMessage(chunk_stream_id, type_id, 0, stream_id, {{body, static_cast<size_t>(body_size)}});
+}
+
+bool RtmpPushSender::SendTag(const Tag &tag)
+{
+	return SendMessage(RTMP_CHUNK_STREAM_ID_MEDIA, tag.type_id, tag.timestamp, _rtmp_stream_id,
+					   {{const_cast<uint8_t *>(tag.header->GetDataAs<uint8_t>()), tag.header->GetLength()},
+						{const_cast<uint8_t *>(tag.data->GetDataAs<uint8_t>()), tag.data->GetLength()}});
+}
+
+bool RtmpPushSender::SendAggregateMessage()
+{
+	if (_pending_tags.empty())
+	{
+		return true;
+	}
+
+	if (_pending_tags.size() == 1)
+	{
+		auto result = SendTag(_pending_tags.front());
+		_pending_tags.clear();
+		return result;
+	}
+
+	// Aggregate message: (FLV tag header + tag data + back pointer) * N
+	// The timestamp of the message is the same as the first tag, so the timestamps of the tags are used as they are
+	std::vector<uint8_t> tag_headers(_pending_tags.size() * FLV_TAG_HEADER_SIZE);
+	std::vector<uint8_t> back_pointers(_pending_tags.size() * 4);
+	std::vector<iovec> payload;
+
+	payload.reserve(_pending_tags.size() * 4);
+
+	for (size_t index = 0; index < _pending_tags.size(); index++)
+	{
+		const auto &tag = _pending_tags[index];
+		auto data_size = tag.header->GetLength() + tag.data->GetLength();
+		auto tag_header = tag_headers.data() + index * FLV_TAG_HEADER_SIZE;
+		auto back_pointer = back_pointers.data() + index * 4;
+
+		RtmpMuxUtil::WriteInt8(tag_header, tag.type_id);
+		RtmpMuxUtil::WriteInt24(tag_header + 1, data_size);
+		RtmpMuxUtil::WriteInt24(tag_header + 4, tag.timestamp & 0xFFFFFF);
+		RtmpMuxUtil::WriteInt8(tag_header + 7, (tag.timestamp >> 24) & 0xFF);
+		RtmpMuxUtil::WriteInt24(tag_header + 8, 0);
+
+		RtmpMuxUtil::WriteInt32(back_pointer, FLV_TAG_HEADER_SIZE + data_size);
+
+		payload.push_back({tag_header, FLV_TAG_HEADER_SIZE});
+		payload.push_back({const_cast<uint8_t *>(tag.header->GetDataAs<uint8_t>()), tag.header->GetLength()});
+		payload.push_back({const_cast<uint8_t *>(tag.data->GetDataAs<uint8_t>()), tag.data->GetLength()});
+		payload.push_back({back_pointer, 4});
+	}
+
+	auto result = SendMessage(RTMP_CHUNK_STREAM_ID_MEDIA, RTMP_MSGID_AGGREGATE_MESSAGE, _pending_tags.front().timestamp, _rtmp_stream_id, payload);
+
+	_pending_tags.clear();
+
+	return result;
+}
+
+bool RtmpPushSender::SendMessage(uint32_t chunk_stream_id, uint8_t type_id, uint32_t timestamp, uint32_t stream_id, const std::vector<iovec> &payload)
+{
+	size_t message_length = 0;
+
+	for (const auto &item : payload)
+	{
+		message_length += item.iov_len;
+	}
+
+	// The chunk size of the server is applied after the Set Chunk Size message
+	size_t chunk_size = (type_id == RTMP_MSGID_SET_CHUNK_SIZE) ? RTMP_DEFAULT_CHUNK_SIZE : _config.chunk_size;
+	size_t chunk_count = std::max<size_t>((message_length + chunk_size - 1) / chunk_size, 1);
+	bool is_extended = (timestamp >= RTMP_EXTEND_TIMESTAMP);
+	size_t extended_size = is_extended ? RTMP_EXTEND_TIMESTAMP_SIZE : 0;
+
+	// Type 0 header for the first chunk and Type 3 headers for the others
+	std::vector<uint8_t> headers((1 + 11 + extended_size) + (chunk_count - 1) * (1 + extended_size));
+	std::vector<iovec> vector;
+
+	vector.reserve(chunk_count * 2 + payload.size());
+
+	auto header = headers.data();
+
+	header[0] = static_cast<uint8_t>(RtmpChunkType::T0) | chunk_stream_id;
+	RtmpMuxUtil::WriteInt24(header + 1, is_extended ? RTMP_EXTEND_TIMESTAMP : timestamp);
+	RtmpMuxUtil::WriteInt24(header + 4, message_length);
+	RtmpMuxUtil::WriteInt8(header + 7, type_id);
+	RtmpMuxUtil::WriteInt32LE(header + 8, stream_id);
+
+	if (is_extended)
+	{
+		RtmpMuxUtil::WriteInt32(header + 12, timestamp);
+	}
+
+	vector.push_back({header, 12 + extended_size});
+	header += 12 + extended_size;
+
+	size_t payload_index = 0;
+	size_t payload_offset = 0;
+	size_t written_length = 0;
+
+	while (written_length < message_length)
+	{
+		if ((written_length > 0) && (written_length % chunk_size == 0))
+		{
+			header[0] = static_cast<uint8_t>(RtmpChunkType::T3) | chunk_stream_id;
+
+			if (is_extended)
+			{
+				RtmpMuxUtil::WriteInt32(header + 1, timestamp);
+			}
+
+			vector.push_back({header, 1 + extended_size});
+			header += 1 + extended_size;
+		}
+
+		auto &item = payload[payload_index];
+		auto length = std::min(item.iov_len - payload_offset, chunk_size - (written_length % chunk_size));
+
+		if (length > 0)
+		{
+			vector.push_back({static_cast<uint8_t *>(item.iov_base) + payload_offset, length});
+		}
+
+		payload_offset += length;
+		written_length += length;
+
+		if (payload_offset == item.iov_len)
+		{
+			payload_index++;
+			payload_offset = 0;
+		}
+	}
+
+	return WriteVector(vector);
+}
+
+bool RtmpPushSender::WriteVector(std::vector<iovec> &vector)
+{
+	size_t index = 0;
+
+	while (index < vector.size())
+	{
+		auto count = std::min<size_t>(vector.size() - index, IOV_MAX);
+		auto written = ::writev(_socket, vector.data() + index, static_cast<int>(count));
+
+		if (written < 0)
+		{
+			if (errno == EINTR)
+			{
+				continue;
+			}
+
+			// EAGAIN means the send timeout
+			logte("Could not send data to the server (%s)", ov::Error::CreateErrorFromErrno()->What());
+			return false;
+		}
+
+		// Skips the written items and adjusts the partially written one
+		while ((index < vector.size()) && (written >= static_cast<ssize_t>(vector[index].iov_len)))
+		{
+			written -= vector[index].iov_len;
+			index++;
+		}
+
+		if (written > 0)
+		{
+			vector[index].iov_base = static_cast<uint8_t *>(vector[index].iov_base) + written;
+			vector[index].iov_len -= written;
+		}
+	}
+
+	return true;
+}
+
+bool RtmpPushSender::WriteData(const void *data, size_t length)
+{
+	std::vector<iovec> vector = {{const_cast<void *>(data), length}};
+
+	return WriteVector(vector);
+}
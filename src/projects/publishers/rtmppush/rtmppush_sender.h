@@ -0,0 +1,99 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/info/media_track.h>
+#include <base/mediarouter/media_buffer.h>
+#include <base/ovlibrary/ovlibrary.h>
+#include <providers/rtmp/chunk/amf_document.h>
+#include <providers/rtmp/chunk/rtmp_import_chunk.h>
+
+#include <sys/uio.h>
+
+// Publishes a stream to an RTMP server without libavformat.
+//
+// FFmpeg's RTMP client always sends with the default chunk size (128 bytes) and writes each chunk with a separate system call.
+// This sender negotiates a large chunk size, merges the audio messages and the next video frame into an aggregate message,
+// and writes each message (all of its chunks) with a single writev().
+class RtmpPushSender
+{
+public:
+	struct Config
+	{
+		uint32_t chunk_size = RTMP_DEFAULT_CHUNK_SIZE;
+		bool aggregate_messages = true;
+		// Timeout of connecting and each send/receive
+		int32_t timeout_ms = 5000;
+	};
+
+	static bool IsSupportUrl(const ov::String &url);
+
+	RtmpPushSender(const Config &config);
+	~RtmpPushSender();
+
+	bool AddTrack(const std::shared_ptr<const MediaTrack> &track);
+
+	// Connects to <url> and starts publishing (blocking)
+	bool Start(const ov::String &url);
+	bool PutData(const std::shared_ptr<const MediaPacket> &packet);
+	bool Stop();
+
+private:
+	// An FLV tag waiting to be sent in an aggregate message
+	struct Tag
+	{
+		uint8_t type_id;
+		uint32_t timestamp;
+		std::shared_ptr<const ov::Data> header;
+		std::shared_ptr<const ov::Data> data;
+	};
+
+	bool Connect(const ov::String &host, uint32_t port);
+	bool Handshake();
+	bool SendConnect(const ov::String &app, const ov::String &tc_url);
+	bool SendPublish(const ov::String &stream_name);
+	bool SendSetChunkSize();
+	bool SendMetaData();
+	bool SendSequenceHeaders();
+
+	// Reads the messages from the server until <condition> returns true
+	bool WaitForMessage(const std::function<bool(const std::shared_ptr<const RtmpMessage> &message)> &condition);
+	// Reads the messages the server sent while publishing (acknowledgement, ping) without blocking
+	bool ReceivePendingMessages();
+	bool HandleMessage(const std::shared_ptr<const RtmpMessage> &message);
+
+	bool SendAmfCommand(uint32_t chunk_stream_id, uint32_t stream_id, AmfDocument &document, uint8_t type_id = RTMP_MSGID_AMF0_COMMAND_MESSAGE);
+	bool SendTag(const Tag &tag);
+	bool SendAggregateMessage();
+	// Chunks a message of <header> + <data> with the negotiated chunk size and writes it with a writev()
+	bool SendMessage(uint32_t chunk_stream_id, uint8_t type_id, uint32_t timestamp, uint32_t stream_id, const std::vector<iovec> &payload);
+	bool WriteVector(std::vector<iovec> &vector);
+	bool WriteData(const void *data, size_t length);
+
+	Config _config;
+
+	int _socket = -1;
+
+	std::map<int32_t, std::shared_ptr<const MediaTrack>> _tracks;
+	bool _has_video_track = false;
+
+	std::shared_ptr<RtmpImportChunk> _import_chunk;
+	// The data that is not parsed yet
+	std::shared_ptr<ov::Data> _received_data;
+	ov::String _stream_name;
+	uint32_t _rtmp_stream_id = 0;
+	double _transaction_id = 0.0;
+
+	// The audio tags that will be merged with the next video frame
+	std::vector<Tag> _pending_tags;
+
+	// Window acknowledgement size of the server and the bytes received since the last acknowledgement
+	uint32_t _window_ack_size = 0;
+	uint64_t _received_bytes = 0;
+	uint64_t _acknowledged_bytes = 0;
+};
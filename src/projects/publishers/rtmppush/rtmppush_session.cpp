@@ -1,6 +1,7 @@
 #include <base/info/stream.h>
 #include <base/publisher/stream.h>
 
+#include "rtmppush_application.h"
 #include "rtmppush_session.h"
 #include "rtmppush_private.h"
 
@@ -50,23 +51,36 @@ bool RtmpPushSession::Start()
 
 	std::lock_guard<std::shared_mutex> lock(_mutex);
 
-	_writer = RtmpWriter::Create();
-	if(_writer == nullptr)
+	auto push_config = GetApplication()->GetConfig().GetPublishers().GetRtmpPushPublisher();
+
+	if (push_config.IsNativeSender() && RtmpPushSender::IsSupportUrl(rtmp_url))
 	{
-		SetState(SessionState::Error);	
-		GetPush()->SetState(info::Push::PushState::Error);		
+		RtmpPushSender::Config sender_config;
+		sender_config.chunk_size = std::max(push_config.GetChunkSize(), RTMP_DEFAULT_CHUNK_SIZE);
+		sender_config.aggregate_messages = push_config.IsAggregateMessages();
 
-		return false;
+		_sender = std::make_shared<RtmpPushSender>(sender_config);
 	}
-
-	if(_writer->SetPath(rtmp_url, "flv") == false)
+	else
 	{
-		SetState(SessionState::Error);
-		GetPush()->SetState(info::Push::PushState::Error);		
+		_writer = RtmpWriter::Create();
+		if(_writer == nullptr)
+		{
+			SetState(SessionState::Error);	
+			GetPush()->SetState(info::Push::PushState::Error);		
 
-		_writer = nullptr;
+			return false;
+		}
 
-		return false;
+		if(_writer->SetPath(rtmp_url, "flv") == false)
+		{
+			SetState(SessionState::Error);
+			GetPush()->SetState(info::Push::PushState::Error);		
+
+			_writer = nullptr;
+
+			return false;
+		}
 	}
 
 	for(auto &track_item : GetStream()->GetTracks())
@@ -93,6 +107,12 @@ bool RtmpPushSession::Start()
 			continue;
 		}
 
+		if (_sender != nullptr)
+		{
+			_sender->AddTrack(track);
+			continue;
+		}
+
 		auto track_info = RtmpTrackInfo::Create();
 		track_info->SetCodecId( track->GetCodecId() );
 		track_info->SetBitrate( track->GetBitrate() );
@@ -123,8 +143,19 @@ bool RtmpPushSession::Start()
 		}
 	}
 
+	if (_sender != nullptr)
+	{
+		if (_sender->Start(rtmp_url) == false)
+		{
+			_sender = nullptr;
+			SetState(SessionState::Error);
+			GetPush()->SetState(info::Push::PushState::Error);
+
+			return false;
+		}
+	}
 	// Notice: If there are more than one video track, RTMP Push is not created and returns an error. You must use 1 video track.
-	if(_writer->Start() == false)
+	else if(_writer->Start() == false)
 	{
 		_writer = nullptr;
 		SetState(SessionState::Error);
@@ -133,6 +164,18 @@ bool RtmpPushSession::Start()
 		return false;
 	}
 
+	// Start with the last GOP so that the output begins with a key frame without waiting for the next one
+	_gop_cache_last_dts_map.clear();
+	for (const auto &packet : GetStream()->GetGopCache())
+	{
+		if (PutPacket(packet) == false)
+		{
+			return false;
+		}
+
+		_gop_cache_last_dts_map[packet->GetTrackId()] = packet->GetDts();
+	}
+
 	return Session::Start();
 }
 
@@ -140,13 +183,22 @@ bool RtmpPushSession::Stop()
 {
 	std::lock_guard<std::shared_mutex> lock(_mutex);
 
-	if(_writer != nullptr)
+	if((_writer != nullptr) || (_sender != nullptr))
 	{
 		GetPush()->SetState(info::Push::PushState::Stopping);
 		GetPush()->UpdatePushStartTime();
 
-		_writer->Stop();
-		_writer = nullptr;
+		if (_writer != nullptr)
+		{
+			_writer->Stop();
+			_writer = nullptr;
+		}
+
+		if (_sender != nullptr)
+		{
+			_sender->Stop();
+			_sender = nullptr;
+		}
 
 		GetPush()->SetState(info::Push::PushState::Stopped);
 		GetPush()->IncreaseSequence();	
@@ -178,32 +230,62 @@ void RtmpPushSession::SendOutgoingData(const std::any &packet)
 
 	std::lock_guard<std::shared_mutex> lock(_mutex);
 
-	if(_writer != nullptr)
-    {
-	  	bool ret = _writer->PutData(
-			session_packet->GetTrackId(), 
-			session_packet->GetPts(),
-			session_packet->GetDts(), 
-			session_packet->GetFlag(), 
-			session_packet->GetBitstreamFormat(),
-			session_packet->GetData());
+	if (_gop_cache_last_dts_map.empty() == false)
+	{
+		auto item = _gop_cache_last_dts_map.find(session_packet->GetTrackId());
+		if (item != _gop_cache_last_dts_map.end())
+		{
+			if (session_packet->GetDts() <= item->second)
+			{
+				// Already sent from the GOP cache
+				return;
+			}
+
+			_gop_cache_last_dts_map.erase(item);
+		}
+	}
 
-		if(ret == false)
+	PutPacket(session_packet);
+}
+
+bool RtmpPushSession::PutPacket(const std::shared_ptr<MediaPacket> &packet)
+{
+	if (_sender != nullptr)
+	{
+		if (_sender->PutData(packet) == false)
 		{
 			logte("Failed to send packet");
 
 			SetState(SessionState::Error);
 			GetPush()->SetState(info::Push::PushState::Error);
-			
-			_writer->Stop();
-			_writer = nullptr;
 
-			return;
-		} 
+			_sender->Stop();
+			_sender = nullptr;
+
+			return false;
+		}
+	}
+	else if(_writer == nullptr)
+	{
+		return false;
+	}
+	else if(_writer->PutData(packet) == false)
+	{
+		logte("Failed to send packet");
+
+		SetState(SessionState::Error);
+		GetPush()->SetState(info::Push::PushState::Error);
+		
+		_writer->Stop();
+		_writer = nullptr;
+
+		return false;
+	} 
+
+	GetPush()->UpdatePushTime();
+	GetPush()->IncreasePushBytes(packet->GetData()->GetLength());
 
-		GetPush()->UpdatePushTime();
-		GetPush()->IncreasePushBytes(session_packet->GetData()->GetLength());		
-    } 
+	return true;
 }
 
 void RtmpPushSession::SetPush(std::shared_ptr<info::Push> &push)
@@ -3,6 +3,8 @@
 #include <base/info/media_track.h>
 #include <base/publisher/session.h>
 #include <modules/rtmp/rtmp_writer.h>
+
+#include "rtmppush_sender.h"
 #include "base/info/push.h"
 
 class RtmpPushSession : public pub::Session
@@ -26,9 +28,18 @@ public:
 	std::shared_ptr<info::Push>& GetPush();
 	
 private:
+	// Must be called with _mutex locked
+	bool PutPacket(const std::shared_ptr<MediaPacket> &packet);
+
 	std::shared_ptr<info::Push> _push;
 	
 	std::shared_mutex _mutex;
 	
 	std::shared_ptr<RtmpWriter> _writer;
+	// Used instead of _writer if NativeSender is enabled
+	std::shared_ptr<RtmpPushSender> _sender;
+
+	// Last DTS of each track sent from the GOP cache.
+	// Packets that were also queued to this session while the GOP cache was being sent are skipped.
+	std::map<MediaTrackId, int64_t> _gop_cache_last_dts_map;
 };
@@ -17,6 +17,9 @@
 #include "cmaf_packetizer.h"
 #include "cmaf_private.h"
 
+// A request for the next segment is held at most this time (the segment is expected to start within a segment duration)
+#define CMAF_PENDING_REQUEST_TIMEOUT_IN_MSEC (10 * 1000)
+
 std::shared_ptr<SegmentStreamInterceptor> CmafStreamServer::CreateInterceptor()
 {
 	return std::make_shared<CmafInterceptor>();
@@ -45,7 +48,21 @@ bool CmafStreamServer::ProcessSegmentRequest(const std::shared_ptr<http::svr::Ht
 		std::unique_lock<std::mutex> lock(_http_chunk_guard);
 
 		auto chunk_item = _http_chunk_list.find(key);
-		if (chunk_item != _http_chunk_list.end())
+
+		// The segment next to the segment being created is requested by the players that join at the end of
+		// the segment, so the request is held until its first chunk is written instead of responding 404
+		bool is_next_segment = false;
+
+		if ((chunk_item == _http_chunk_list.end()) && ((type == DashFileType::VideoSegment) || (type == DashFileType::AudioSegment)))
+		{
+			auto sequence_key = ov::String::FormatString("%s/%s/%s", request_info.vhost_app_name.CStr(), request_info.stream_name.CStr(), is_video ? "video" : "audio");
+			auto sequence_item = _last_sequence_number_map.find(sequence_key);
+
+			is_next_segment = (sequence_item != _last_sequence_number_map.end()) &&
+							  (ov::Converter::ToUInt32(request_info.file_name.CStr()) == (sequence_item->second + 1));
+		}
+
+		if ((chunk_item != _http_chunk_list.end()) || is_next_segment)
 		{
 			// Find stream info
 			std::shared_ptr<pub::Stream> stream_info;
@@ -57,16 +74,19 @@ bool CmafStreamServer::ProcessSegmentRequest(const std::shared_ptr<http::svr::Ht
 					stream_info = segment_publisher->GetStreamAs<pub::Stream>(request_info.vhost_app_name, request_info.stream_name);
 					if (stream_info != nullptr)
 					{
-						// For statistics
-						auto segment_request_info = SegmentRequestInfo(
-							GetPublisherType(),
-							*std::static_pointer_cast<info::Stream>(stream_info),
-							client->GetRequest()->GetRemote()->GetRemoteAddress()->GetIpAddress(),
-							static_cast<int>(chunk_item->second->sequence_number),
-							is_video ? SegmentDataType::Video : SegmentDataType::Audio,
-							static_cast<int64_t>(chunk_item->second->duration_in_msec / 1000));
-
-						segment_publisher->UpdateSegmentRequestInfo(segment_request_info);
+						if (chunk_item != _http_chunk_list.end())
+						{
+							// For statistics
+							auto segment_request_info = SegmentRequestInfo(
+								GetPublisherType(),
+								*std::static_pointer_cast<info::Stream>(stream_info),
+								client->GetRequest()->GetRemote()->GetRemoteAddress()->GetIpAddress(),
+								static_cast<int>(chunk_item->second->sequence_number),
+								is_video ? SegmentDataType::Video : SegmentDataType::Audio,
+								static_cast<int64_t>(chunk_item->second->duration_in_msec / 1000));
+
+							segment_publisher->UpdateSegmentRequestInfo(segment_request_info);
+						}
 
 						break;
 					}
@@ -78,32 +98,27 @@ bool CmafStreamServer::ProcessSegmentRequest(const std::shared_ptr<http::svr::Ht
 				// The stream has been deleted, but if it remains in the Worker queue, this code will run.
 				response->SetStatusCode(http::StatusCode::NotFound);
 				_http_chunk_list.clear();
+				_last_sequence_number_map.clear();
 
 				return false;
 			}
 
 			client->SetExtra(stream_info);
 
-			// The file is being created
-			logtd("Requested file is being created");
-
-			// Set HTTP header
-			response->SetHeader("Content-Type", is_video ? "video/mp4" : "audio/mp4");
-
-			// Enable chunked transfer
-			response->SetChunkedTransfer();
+			if (chunk_item == _http_chunk_list.end())
+			{
+				logtd("Requested file will be created: %s", key.CStr());
 
-			// Append data to HTTP response
-			response->AppendData(chunk_item->second->chunked_data);
-			auto sent_bytes = response->Response();
+				ExpirePendingClients();
+				_pending_client_map[key].push_back({client, ov::Clock::NowMSec()});
 
-			auto stream = GetStream(client);
-			if (stream != nullptr)
-			{
-				MonitorInstance->IncreaseBytesOut(*stream_info, GetPublisherType(), sent_bytes);
+				return true;
 			}
 
-			chunk_item->second->client_list.push_back(client);
+			// The file is being created
+			logtd("Requested file is being created");
+
+			StartChunkedResponse(client, chunk_item->second);
 
 			return true;
 		}
@@ -112,6 +127,67 @@ bool CmafStreamServer::ProcessSegmentRequest(const std::shared_ptr<http::svr::Ht
 	return DashStreamServer::ProcessSegmentRequest(client, request_info, segment_type);
 }
 
+void CmafStreamServer::StartChunkedResponse(const std::shared_ptr<http::svr::HttpExchange> &client, const std::shared_ptr<CmafHttpChunkedData> &chunked_data)
+{
+	auto response = std::static_pointer_cast<http::svr::h1::Http1Response>(client->GetResponse());
+
+	// Set HTTP header
+	response->SetHeader("Content-Type", chunked_data->is_video ? "video/mp4" : "audio/mp4");
+
+	// Enable chunked transfer
+	response->SetChunkedTransfer();
+
+	// Append the chunks written so far to HTTP response (each of them is sent as an HTTP chunk)
+	for (const auto &chunk : chunked_data->chunk_list)
+	{
+		response->AppendData(chunk);
+	}
+
+	auto sent_bytes = response->Response();
+
+	auto stream = GetStream(client);
+	if ((stream != nullptr) && (sent_bytes > 0))
+	{
+		MonitorInstance->IncreaseBytesOut(*stream, GetPublisherType(), sent_bytes);
+	}
+
+	chunked_data->client_list.push_back(client);
+}
+
+void CmafStreamServer::ExpirePendingClients()
+{
+	auto now = ov::Clock::NowMSec();
+
+	for (auto item = _pending_client_map.begin(); item != _pending_client_map.end();)
+	{
+		auto &pending_client_list = item->second;
+
+		pending_client_list.erase(
+			std::remove_if(pending_client_list.begin(), pending_client_list.end(), [now](const CmafPendingClient &pending_client) -> bool {
+				if ((now - pending_client.requested_time_in_msec) < CMAF_PENDING_REQUEST_TIMEOUT_IN_MSEC)
+				{
+					return false;
+				}
+
+				auto response = pending_client.client->GetResponse();
+				response->SetStatusCode(http::StatusCode::NotFound);
+				response->Response();
+
+				return true;
+			}),
+			pending_client_list.end());
+
+		if (pending_client_list.empty())
+		{
+			item = _pending_client_map.erase(item);
+		}
+		else
+		{
+			++item;
+		}
+	}
+}
+
 void CmafStreamServer::OnCmafChunkDataPush(const ov::String &app_name, const ov::String &stream_name,
 										   const ov::String &file_name,
 										   const uint32_t sequence_number,
@@ -131,7 +207,26 @@ void CmafStreamServer::OnCmafChunkDataPush(const ov::String &app_name, const ov:
 			  app_name.CStr(), stream_name.CStr(), StringFromPublisherType(GetPublisherType()).CStr(),
 			  file_name.CStr(), chunk_data->GetLength());
 
-		_http_chunk_list.emplace(key, std::make_shared<CmafHttpChunkedData>(sequence_number, duration_in_msec, chunk_data));
+		auto chunked_data = std::make_shared<CmafHttpChunkedData>(sequence_number, duration_in_msec, is_video);
+		chunked_data->AddChunkData(chunk_data);
+
+		_http_chunk_list.emplace(key, chunked_data);
+		_last_sequence_number_map[ov::String::FormatString("%s/%s/%s", app_name.CStr(), stream_name.CStr(), is_video ? "video" : "audio")] = sequence_number;
+
+		// Resume the requests that arrived before the first chunk
+		auto pending_item = _pending_client_map.find(key);
+		if (pending_item != _pending_client_map.end())
+		{
+			for (auto &pending_client : pending_item->second)
+			{
+				StartChunkedResponse(pending_client.client, chunked_data);
+			}
+
+			_pending_client_map.erase(pending_item);
+		}
+
+		ExpirePendingClients();
+
 		return;
 	}
 
@@ -31,25 +31,40 @@ protected:
 	struct CmafHttpChunkedData
 	{
 	public:
-		CmafHttpChunkedData(const uint32_t sequence_number, const uint64_t duration_in_msec, const std::shared_ptr<const ov::Data> &data)
+		CmafHttpChunkedData(const uint32_t sequence_number, const uint64_t duration_in_msec, bool is_video)
 			: sequence_number(sequence_number),
-			  duration_in_msec(duration_in_msec)
+			  duration_in_msec(duration_in_msec),
+			  is_video(is_video)
 		{
-			chunked_data = std::make_shared<ov::Data>(104 * 1024);
-			chunked_data->Append(data);
 		}
 
+		// The chunks are not modified after they are written, so they are shared by all clients
+		// (they can still be in the send queue of the sockets)
 		void AddChunkData(const std::shared_ptr<const ov::Data> &data)
 		{
-			chunked_data->Append(data);
+			chunk_list.push_back(data);
 		}
 
 		uint32_t sequence_number = 0U;
 		uint64_t duration_in_msec = 0U;
-		std::shared_ptr<ov::Data> chunked_data;
+		bool is_video = false;
+		std::vector<std::shared_ptr<const ov::Data>> chunk_list;
 		std::vector<std::shared_ptr<http::svr::HttpExchange>> client_list;
 	};
 
+	// A request for the segment next to the segment being created (the first chunk is not written yet)
+	struct CmafPendingClient
+	{
+		std::shared_ptr<http::svr::HttpExchange> client;
+		uint64_t requested_time_in_msec = 0;
+	};
+
+	// Sends the header and the chunks written so far, and then the client receives the chunks appended later
+	// (must be called while _http_chunk_guard is locked)
+	void StartChunkedResponse(const std::shared_ptr<http::svr::HttpExchange> &client, const std::shared_ptr<CmafHttpChunkedData> &chunked_data);
+	// Responds 404 to the pending clients that waited too long (must be called while _http_chunk_guard is locked)
+	void ExpirePendingClients();
+
 	//--------------------------------------------------------------------
 	// Overriding functions of DashStreamServer
 	//--------------------------------------------------------------------
@@ -73,5 +88,10 @@ protected:
 	// A temporary queue for the intermediate chunks
 	// Key: [app name]/[stream name]/[file name]
 	std::unordered_map<ov::String, std::shared_ptr<CmafHttpChunkedData>> _http_chunk_list;
+	// The sequence number of the last segment that is being created (or created)
+	// Key: [app name]/[stream name]/[video or audio]
+	std::unordered_map<ov::String, uint32_t> _last_sequence_number_map;
+	// Key: [app name]/[stream name]/[file name]
+	std::unordered_map<ov::String, std::vector<CmafPendingClient>> _pending_client_map;
 	std::mutex _http_chunk_guard;
 };
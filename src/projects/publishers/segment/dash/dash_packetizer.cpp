@@ -531,34 +531,11 @@ bool DashPacketizer::AppendAudioPacket(const std::shared_ptr<const MediaPacket>
 	return result;
 }
 
-bool DashPacketizer::UpdatePlayList()
+ov::String DashPacketizer::MakeMpdBody() const
 {
 	std::ostringstream xml;
 
-	if (IsReadyForStreaming() == false)
-	{
-		return false;
-	}
-
-	ov::String publish_time = ov::Time::MakeUtcSecond();
-
-	logtd("Trying to update playlist for DASH with availabilityStartTime: %s, publishTime: %s", _start_time.CStr(), publish_time.CStr());
-
-	xml << std::fixed << std::setprecision(3)
-		<< R"(<?xml version="1.0" encoding="utf-8"?>)" << std::endl
-
-		// MPD
-		<< R"(<MPD xmlns:xsi="http://www.w3.org/2001/XMLSchema-instance")" << std::endl
-		<< R"(	xmlns="urn:mpeg:dash:schema:mpd:2011")" << std::endl
-		<< R"(	xsi:schemaLocation="urn:mpeg:DASH:schema:MPD:2011 http://standards.iso.org/ittf/PubliclyAvailableStandards/MPEG-DASH_schema_files/DASH-MPD.xsd")" << std::endl
-		<< R"(	profiles="urn:mpeg:dash:profile:isoff-live:2011")" << std::endl
-		<< R"(	type="dynamic")" << std::endl
-		<< R"(	minimumUpdatePeriod="PT30S")" << std::endl
-		<< R"(	publishTime=")" << publish_time.CStr() << R"(")" << std::endl
-		<< R"(	availabilityStartTime=")" << _start_time.CStr() << R"(")" << std::endl
-		<< R"(	timeShiftBufferDepth="PT)" << (_segment_save_count * _segment_duration) << R"(S")" << std::endl
-		<< R"(	maxSegmentDuration="PT)" << _segment_duration << R"(S")" << std::endl
-		<< R"(	minBufferTime="PT)" << _segment_duration << R"(S">)" << std::endl;
+	xml << std::fixed << std::setprecision(3);
 
 	{
 		xml
@@ -687,6 +664,51 @@ bool DashPacketizer::UpdatePlayList()
 		// </MPD>
 		<< R"(</MPD>)";
 
+	return xml.str().c_str();
+}
+
+bool DashPacketizer::UpdatePlayList()
+{
+	std::ostringstream xml;
+
+	if (IsReadyForStreaming() == false)
+	{
+		return false;
+	}
+
+	ov::String publish_time = ov::Time::MakeUtcSecond();
+
+	logtd("Trying to update playlist for DASH with availabilityStartTime: %s, publishTime: %s", _start_time.CStr(), publish_time.CStr());
+
+	xml << std::fixed << std::setprecision(3)
+		<< R"(<?xml version="1.0" encoding="utf-8"?>)" << std::endl
+
+		// MPD
+		<< R"(<MPD xmlns:xsi="http://www.w3.org/2001/XMLSchema-instance")" << std::endl
+		<< R"(	xmlns="urn:mpeg:dash:schema:mpd:2011")" << std::endl
+		<< R"(	xsi:schemaLocation="urn:mpeg:DASH:schema:MPD:2011 http://standards.iso.org/ittf/PubliclyAvailableStandards/MPEG-DASH_schema_files/DASH-MPD.xsd")" << std::endl
+		<< R"(	profiles="urn:mpeg:dash:profile:isoff-live:2011")" << std::endl
+		<< R"(	type="dynamic")" << std::endl
+		<< R"(	minimumUpdatePeriod="PT30S")" << std::endl
+		<< R"(	publishTime=")" << publish_time.CStr() << R"(")" << std::endl
+		<< R"(	availabilityStartTime=")" << _start_time.CStr() << R"(")" << std::endl
+		<< R"(	timeShiftBufferDepth="PT)" << (_segment_save_count * _segment_duration) << R"(S")" << std::endl
+		<< R"(	maxSegmentDuration="PT)" << _segment_duration << R"(S")" << std::endl
+		<< R"(	minBufferTime="PT)" << _segment_duration << R"(S">)" << std::endl;
+
+	// The elements after the header are not changed by the segments, so they are serialized only when the tracks are changed
+	auto video_bitrate = (_video_track != nullptr) ? _video_track->GetBitrate() : 0;
+	auto audio_bitrate = (_audio_track != nullptr) ? _audio_track->GetBitrate() : 0;
+
+	if (_mpd_body.IsEmpty() || (video_bitrate != _mpd_body_video_bitrate) || (audio_bitrate != _mpd_body_audio_bitrate))
+	{
+		_mpd_body = MakeMpdBody();
+		_mpd_body_video_bitrate = video_bitrate;
+		_mpd_body_audio_bitrate = audio_bitrate;
+	}
+
+	xml << _mpd_body.CStr();
+
 	ov::String play_list = xml.str().c_str();
 
 	SetPlayList(play_list);
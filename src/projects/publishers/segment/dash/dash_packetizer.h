@@ -69,6 +69,8 @@ protected:
 
 	bool GetSegmentInfos(ov::String *video_urls, ov::String *audio_urls, double *time_shift_buffer_depth, double *minimum_update_period, size_t segment_count);
 
+	// <Period> ~ </MPD>
+	ov::String MakeMpdBody() const;
 	virtual bool UpdatePlayList();
 
 	void SetReadyForStreaming() noexcept override;
@@ -100,6 +102,11 @@ protected:
 	int64_t _start_time_ms = -1LL;
 
 	ov::String _pixel_aspect_ratio;
+
+	// Cached by UpdatePlayList() until the bitrate of a track is changed
+	ov::String _mpd_body;
+	int32_t _mpd_body_video_bitrate = 0;
+	int32_t _mpd_body_audio_bitrate = 0;
 	double _mpd_min_buffer_time;
 
 	// Unit: Timebase of the track
@@ -12,6 +12,7 @@
 #include <publishers/segment/segment_stream/packetizer/packetizer_define.h>
 
 #include "../segment_publisher.h"
+#include "../segment_stream/segment_stream.h"
 #include "../segment_stream/time_interceptor.h"
 #include "dash_define.h"
 #include "dash_private.h"
@@ -149,11 +150,27 @@ bool DashStreamServer::ProcessPlayListRequest(const std::shared_ptr<http::svr::H
 	response->SetHeader("Pragma", "no-cache");
 	response->SetHeader("Expires", "0");
 
-	response->AppendString(play_list);
+	auto stream_info = GetStream(exchange);
+
+	// The MPD (and the gzipped one) is built once when it is updated, and shared by the responses
+	auto encodings = exchange->GetRequest()->GetHeader("Accept-Encoding");
+	bool gzip = (encodings.IndexOf("gzip") >= 0) || (encodings.IndexOf("*") >= 0);
+	auto segment_stream = std::dynamic_pointer_cast<SegmentStream>(stream_info);
+	std::shared_ptr<const ov::Data> play_list_data;
+
+	if ((segment_stream != nullptr) && segment_stream->GetPlayListData(gzip, play_list_data))
+	{
+		response->SetHeader("Content-Encoding", gzip ? "gzip" : "identity");
+		response->AppendData(play_list_data);
+	}
+	else
+	{
+		response->AppendString(play_list);
+	}
+
 	auto sent_bytes = response->Response();
 	exchange->Release();
 
-	auto stream_info = GetStream(exchange);
 	if (stream_info != nullptr)
 	{
 		MonitorInstance->IncreaseBytesOut(*stream_info, GetPublisherType(), sent_bytes);
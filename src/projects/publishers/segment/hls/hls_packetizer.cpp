@@ -478,13 +478,18 @@ bool HlsPacketizer::SetSegmentData(int64_t timestamp, int64_t timestamp_in_ms, i
 {
 	auto file_name = ov::String::FormatString("%u.ts", _sequence_number);
 
-	auto segment_item = _video_segment_queue.Append(
+	auto new_segment_item = std::make_shared<SegmentItem>(
 		SegmentDataType::Both, _sequence_number++,
 		file_name,
 		timestamp, timestamp_in_ms,
 		duration, duration_in_ms,
 		data);
 
+	// A segment is never modified after it is created, but the file names are reused when the stream is recreated
+	new_segment_item->etag = ov::String::FormatString("\"%x-%" PRIx64 "-%zx\"", new_segment_item->sequence_number, ov::Clock::NowMSec(), data->GetLength());
+
+	auto segment_item = _video_segment_queue.Append(new_segment_item);
+
 	DumpSegmentToFile(segment_item);
 
 	if (
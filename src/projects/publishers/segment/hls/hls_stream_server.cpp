@@ -9,6 +9,7 @@
 #include "hls_stream_server.h"
 
 #include "../segment_publisher.h"
+#include "../segment_stream/segment_stream.h"
 #include "hls_private.h"
 
 bool HlsStreamServer::ProcessStreamRequest(const std::shared_ptr<http::svr::HttpExchange> &exchange,
@@ -74,12 +75,33 @@ bool HlsStreamServer::ProcessPlayListRequest(const std::shared_ptr<http::svr::Ht
 	response->SetHeader("Cache-Control", "no-cache, no-store, must-revalidate");
 	response->SetHeader("Pragma", "no-cache");
 	response->SetHeader("Expires", "0");
+	response->SetHeader("Vary", "Accept-Encoding");
+
+	auto stream_info = GetStream(exchange);
+
+	// The playlist (and the gzipped one) is built once when it is updated, and shared by the responses
+	// (only gzip is prepared, so Brotli is not negotiated)
+	auto encoding = http::NegotiateContentEncoding(exchange->GetRequest()->GetHeader("Accept-Encoding"), false);
+	bool gzip = (encoding == http::ContentEncoding::Gzip);
+	auto segment_stream = std::dynamic_pointer_cast<SegmentStream>(stream_info);
+	std::shared_ptr<const ov::Data> play_list_data;
+
+	if ((segment_stream != nullptr) && segment_stream->GetPlayListData(gzip, play_list_data))
+	{
+		if (gzip)
+		{
+			response->SetHeader("Content-Encoding", http::StringFromContentEncoding(encoding));
+		}
+		response->AppendData(play_list_data);
+	}
+	else
+	{
+		response->AppendString(play_list);
+	}
 
-	response->AppendString(play_list);
 	auto sent_bytes = response->Response();
 	exchange->Release();
 
-	auto stream_info = GetStream(exchange);
 	if (stream_info != nullptr)
 	{
 		MonitorInstance->IncreaseBytesOut(*stream_info, GetPublisherType(), sent_bytes);
@@ -115,6 +137,22 @@ bool HlsStreamServer::ProcessSegmentRequest(const std::shared_ptr<http::svr::Htt
 
 	// Set HTTP header
 	response->SetHeader("Content-Type", "video/MP2T");
+
+	if (segment->etag.IsEmpty() == false)
+	{
+		response->SetHeader("ETag", segment->etag);
+
+		if (http::IsETagMatched(exchange->GetRequest()->GetHeader("If-None-Match"), segment->etag))
+		{
+			response->SetStatusCode(http::StatusCode::NotModified);
+			response->Response();
+			exchange->Release();
+
+			return true;
+		}
+	}
+
+	// The segment is immutable, so the response refers to it instead of copying it
 	response->AppendData(segment->data);
 	auto sent_bytes = response->Response();
 
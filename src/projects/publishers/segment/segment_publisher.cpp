@@ -188,7 +188,21 @@ bool SegmentPublisher::OnSegmentRequest(const std::shared_ptr<http::svr::HttpExc
 	auto &stream_name = request_info.stream_name;
 	auto &file_name = request_info.file_name;
 
-	auto stream = GetStreamAs<SegmentStream>(vhost_app_name, stream_name);
+	// Segment requests of a stream resolved before skip the application/stream maps
+	auto request_url = client->GetRequest()->GetParsedUri();
+	auto routing_version = ocst::Orchestrator::GetInstance()->GetDomainRoutingVersion();
+	auto cached_vhost_app_name = info::VHostAppName::InvalidVHostAppName();
+	auto stream = std::static_pointer_cast<SegmentStream>(GetResolvedStream(request_url, &cached_vhost_app_name));
+
+	if ((stream == nullptr) || (cached_vhost_app_name == vhost_app_name) == false)
+	{
+		stream = GetStreamAs<SegmentStream>(vhost_app_name, stream_name);
+
+		if ((stream != nullptr) && (request_url != nullptr) && (request_url->Stream() == stream_name))
+		{
+			CacheResolvedStream(request_url, routing_version, vhost_app_name, stream);
+		}
+	}
 
 	if (stream != nullptr)
 	{
@@ -8,6 +8,7 @@
 //==============================================================================
 #include "packetizer.h"
 
+#include <base/ovlibrary/zip.h>
 #include <modules/bitstream/aac/aac_converter.h>
 #include <modules/bitstream/h264/h264_converter.h>
 
@@ -51,9 +52,14 @@ uint64_t Packetizer::ConvertTimeScale(uint64_t time, const cmn::Timebase &from_t
 
 void Packetizer::SetPlayList(const ov::String &play_list)
 {
+	auto play_list_data = play_list.ToData(false);
+	auto play_list_gzip = ov::Zip::CompressGzip(play_list_data);
+
 	std::unique_lock<std::mutex> lock(_play_list_mutex);
 
 	_play_list = play_list;
+	_play_list_data = std::move(play_list_data);
+	_play_list_gzip = std::move(play_list_gzip);
 }
 
 bool Packetizer::IsReadyForStreaming() const noexcept
@@ -185,3 +191,17 @@ bool Packetizer::GetPlayList(ov::String &play_list)
 
 	return true;
 }
+
+bool Packetizer::GetPlayListData(bool gzip, std::shared_ptr<const ov::Data> &play_list)
+{
+	if (IsReadyForStreaming() == false)
+	{
+		logtd("Manifest was requested before the stream began");
+		return false;
+	}
+
+	std::unique_lock<std::mutex> lock(_play_list_mutex);
+	play_list = gzip ? _play_list_gzip : _play_list_data;
+
+	return (play_list != nullptr);
+}
@@ -53,6 +53,8 @@ public:
 
 	virtual bool IsReadyForStreaming() const noexcept;
 	virtual bool GetPlayList(ov::String &play_list);
+	// The playlist built by the last SetPlayList(), shared by the responses instead of copied for each request
+	bool GetPlayListData(bool gzip, std::shared_ptr<const ov::Data> &play_list);
 
 	bool GetVideoPlaySegments(std::vector<std::shared_ptr<SegmentItem>> &segment_datas);
 	bool GetAudioPlaySegments(std::vector<std::shared_ptr<SegmentItem>> &segment_datas);
@@ -89,6 +91,9 @@ protected:
 
 	mutable std::mutex _play_list_mutex;
 	ov::String _play_list;
+	std::shared_ptr<const ov::Data> _play_list_data;
+	// Compressed once when the playlist is updated
+	std::shared_ptr<const ov::Data> _play_list_gzip;
 
 	SegmentQueue _video_segment_queue;
 	// HLS packetizer doesn't use _audio_segment_queue
@@ -79,6 +79,9 @@ public:
 	int64_t duration_in_ms = 0L;
 	std::shared_ptr<const ov::Data> data;
 
+	// Strong validator of the data (empty if the publisher does not use it)
+	ov::String etag;
+
 	bool discontinuity = false;
 };
 
@@ -70,6 +70,16 @@ bool SegmentStream::GetPlayList(ov::String &play_list)
 	return false;
 }
 
+bool SegmentStream::GetPlayListData(bool gzip, std::shared_ptr<const ov::Data> &play_list)
+{
+	if (_packetizer != nullptr)
+	{
+		return _packetizer->GetPlayListData(gzip, play_list);
+	}
+
+	return false;
+}
+
 std::shared_ptr<const SegmentItem> SegmentStream::GetSegmentData(const ov::String &file_name) const
 {
 	if (_packetizer == nullptr)
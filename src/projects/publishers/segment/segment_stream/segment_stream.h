@@ -36,6 +36,7 @@ public:
 	}
 
 	bool GetPlayList(ov::String &play_list);
+	bool GetPlayListData(bool gzip, std::shared_ptr<const ov::Data> &play_list);
 
 	std::shared_ptr<const SegmentItem> GetSegmentData(const ov::String &file_name) const;
 
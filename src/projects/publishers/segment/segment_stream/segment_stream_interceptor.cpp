@@ -19,9 +19,9 @@ SegmentStreamInterceptor::~SegmentStreamInterceptor()
 	_worker_manager.Stop();
 }
 
-bool SegmentStreamInterceptor::Start(int thread_count, const SegmentProcessHandler &process_handler)
+bool SegmentStreamInterceptor::Start(const ov::String &name, int thread_count, const SegmentProcessHandler &process_handler)
 {
-	return _worker_manager.Start(thread_count, process_handler);
+	return _worker_manager.Start(name, thread_count, process_handler);
 }
 
 http::svr::InterceptorResult SegmentStreamInterceptor::OnRequestCompleted(const std::shared_ptr<http::svr::HttpExchange> &exchange)
@@ -22,7 +22,8 @@ public:
 	SegmentStreamInterceptor();
 	~SegmentStreamInterceptor() override;
 
-	bool Start(int thread_count, const SegmentProcessHandler &process_handler);
+	// <name> is the name of the publisher (used for the statistics of the workers)
+	bool Start(const ov::String &name, int thread_count, const SegmentProcessHandler &process_handler);
 
 	http::svr::InterceptorResult OnRequestCompleted(const std::shared_ptr<http::svr::HttpExchange> &exchange) override;
 	bool IsInterceptorForRequest(const std::shared_ptr<const http::svr::HttpExchange> &client) override;
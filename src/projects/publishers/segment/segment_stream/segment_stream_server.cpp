@@ -168,7 +168,7 @@ bool SegmentStreamServer::PrepareInterceptors(
 	result = result && ((http_server == nullptr) || http_server->AddInterceptor(segment_stream_interceptor));
 	result = result && ((https_server == nullptr) || https_server->AddInterceptor(segment_stream_interceptor));
 
-	result = result && segment_stream_interceptor->Start(thread_count, process_handler);
+	result = result && segment_stream_interceptor->Start(GetPublisherName(), thread_count, process_handler);
 
 	return result;
 }
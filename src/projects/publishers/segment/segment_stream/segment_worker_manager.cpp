@@ -1,8 +1,17 @@
 #include "segment_worker_manager.h"
 #include "segment_stream_private.h"
 
+#include <config/config_manager.h>
 #include <modules/http/server/http_connection.h>
 
+namespace
+{
+	std::mutex manager_list_mutex;
+	std::vector<const SegmentWorkerManager *> manager_list;
+
+	const int64_t latency_bucket_list[SEGMENT_WORKER_LATENCY_BUCKET_COUNT - 1] = SEGMENT_WORKER_LATENCY_BUCKETS;
+}  // namespace
+
 //====================================================================================================
 // SegmentWorker constructorc
 //====================================================================================================
@@ -22,7 +31,7 @@ SegmentWorker::~SegmentWorker()
 //====================================================================================================
 // SegmentWorker start
 //====================================================================================================
-bool SegmentWorker::Start(const SegmentProcessHandler &process_handler)
+bool SegmentWorker::Start(const SegmentProcessHandler &process_handler, const CompleteHandler &complete_handler)
 {
 	if (!_stop_thread_flag)
 	{
@@ -30,6 +39,8 @@ bool SegmentWorker::Start(const SegmentProcessHandler &process_handler)
 	}
 
 	_process_handler = process_handler;
+	_complete_handler = complete_handler;
+	_last_processed_time_msec = ov::Clock::NowMSec();
 
 	_stop_thread_flag = false;
 	_worker_thread = std::thread(&SegmentWorker::WorkerThread, this);
@@ -65,7 +76,8 @@ bool SegmentWorker::Stop()
 bool SegmentWorker::PushConnection(const std::shared_ptr<http::svr::HttpExchange> &exchange)
 {
 	std::unique_lock<std::mutex> lock(_work_info_guard);
-	_http_exchange_list_to_process.push(exchange);
+	_http_exchange_list_to_process.push({exchange, std::chrono::steady_clock::now()});
+	_queue_depth++;
 
 	_queue_event.Notify();
 
@@ -75,17 +87,54 @@ bool SegmentWorker::PushConnection(const std::shared_ptr<http::svr::HttpExchange
 //====================================================================================================
 // pop work info
 //====================================================================================================
-std::shared_ptr<http::svr::HttpExchange> SegmentWorker::PopExchange()
+bool SegmentWorker::PopWorkItem(WorkItem &item)
 {
 	std::unique_lock<std::mutex> lock(_work_info_guard);
 
 	if (_http_exchange_list_to_process.empty())
-		return nullptr;
+		return false;
 
-	auto work_info = _http_exchange_list_to_process.front();
+	item = std::move(_http_exchange_list_to_process.front());
 	_http_exchange_list_to_process.pop();
 
-	return work_info;
+	return true;
+}
+
+int64_t SegmentWorker::GetIdleTimeMSec() const
+{
+	if (_queue_depth > 0)
+	{
+		return 0;
+	}
+
+	return static_cast<int64_t>(ov::Clock::NowMSec()) - _last_processed_time_msec;
+}
+
+void SegmentWorker::UpdateLatency(int64_t latency_usec)
+{
+	size_t bucket = 0;
+
+	while ((bucket < (SEGMENT_WORKER_LATENCY_BUCKET_COUNT - 1)) && (latency_usec > latency_bucket_list[bucket]))
+	{
+		bucket++;
+	}
+
+	_latency_histogram[bucket]++;
+}
+
+SegmentWorkerStats SegmentWorker::GetStats() const
+{
+	SegmentWorkerStats stats;
+
+	stats.queue_depth = _queue_depth;
+	stats.processed_count = _processed_count;
+
+	for (const auto &count : _latency_histogram)
+	{
+		stats.latency_histogram.push_back(count);
+	}
+
+	return stats;
 }
 
 //====================================================================================================
@@ -93,14 +142,16 @@ std::shared_ptr<http::svr::HttpExchange> SegmentWorker::PopExchange()
 //====================================================================================================
 void SegmentWorker::WorkerThread()
 {
+	ov::ThreadRegistry::Registration registration("SegmentWorker");
+
 	while (!_stop_thread_flag)
 	{
 		// quequ event wait
 		_queue_event.Wait();
 
-		auto exchange = PopExchange();
+		WorkItem item;
 
-		if (exchange == nullptr)
+		if (PopWorkItem(item) == false)
 		{
 			if (_stop_thread_flag == false)
 			{
@@ -111,27 +162,70 @@ void SegmentWorker::WorkerThread()
 			continue;
 		}
 
+		auto &exchange = item.exchange;
+
 		if (_process_handler(exchange) == false)
 		{
 			logtd("Segment process handler fail - target(%s)", exchange->GetRequest()->ToString().CStr());
 		}
+
+		UpdateLatency(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - item.queued_time).count());
+		_processed_count++;
+		_last_processed_time_msec = ov::Clock::NowMSec();
+
+		if (_complete_handler != nullptr)
+		{
+			_complete_handler(exchange);
+		}
+
+		// Decreased after the complete handler, so the worker is not removed before the handler returns
+		_queue_depth--;
 	}
 }
 
 //====================================================================================================
 // Start
 //====================================================================================================
-bool SegmentWorkerManager::Start(int worker_count, const SegmentProcessHandler &process_handler)
+bool SegmentWorkerManager::Start(const ov::String &name, int worker_count, const SegmentProcessHandler &process_handler)
 {
 	if (worker_count <= 0)
 		return false;
 
-	// Create WorkerThread
-	for (int index = 0; index < worker_count; index++)
+	auto &autoscale_config = cfg::ConfigManager::GetInstance()->GetServer()->GetModules().GetSegmentWorkerAutoscale();
+
+	_name = name;
+	_process_handler = process_handler;
+
+	_min_worker_count = worker_count;
+	_max_worker_count = worker_count;
+	_is_autoscale_enabled = autoscale_config.IsEnabled();
+
+	if (_is_autoscale_enabled)
 	{
-		auto worker = std::make_shared<SegmentWorker>();
-		worker->Start(process_handler);
-		_workers.push_back(worker);
+		auto max_worker_count = autoscale_config.GetMaxWorkerCount();
+		max_worker_count = (max_worker_count > 0) ? max_worker_count : static_cast<int>(std::thread::hardware_concurrency());
+
+		_max_worker_count = std::max(_min_worker_count, static_cast<size_t>(std::max(max_worker_count, 1)));
+		_scale_up_queue_depth = static_cast<size_t>(std::max(autoscale_config.GetScaleUpQueueDepth(), 1));
+		_idle_timeout_msec = std::max(autoscale_config.GetIdleTimeout(), 0);
+
+		logti("%s segment workers are scaled from %zu to %zu (queue depth: %zu, idle timeout: %lld ms)",
+			  _name.CStr(), _min_worker_count, _max_worker_count, _scale_up_queue_depth, _idle_timeout_msec);
+	}
+
+	{
+		std::lock_guard<std::mutex> lock_guard(_worker_mutex);
+
+		// Create WorkerThread
+		for (int index = 0; index < worker_count; index++)
+		{
+			AddWorker();
+		}
+	}
+
+	{
+		std::lock_guard<std::mutex> lock_guard(manager_list_mutex);
+		manager_list.push_back(this);
 	}
 
 	return true;
@@ -142,7 +236,20 @@ bool SegmentWorkerManager::Start(int worker_count, const SegmentProcessHandler &
 //====================================================================================================
 bool SegmentWorkerManager::Stop()
 {
-	for (const auto &worker : _workers)
+	{
+		std::lock_guard<std::mutex> lock_guard(manager_list_mutex);
+		manager_list.erase(std::remove(manager_list.begin(), manager_list.end(), this), manager_list.end());
+	}
+
+	std::vector<std::shared_ptr<SegmentWorker>> workers;
+
+	{
+		std::lock_guard<std::mutex> lock_guard(_worker_mutex);
+		workers = _workers;
+	}
+
+	// The workers call OnExchangeCompleted(), so they are stopped without the lock
+	for (const auto &worker : workers)
 	{
 		worker->Stop();
 	}
@@ -150,41 +257,169 @@ bool SegmentWorkerManager::Stop()
 	return true;
 }
 
+std::shared_ptr<SegmentWorker> SegmentWorkerManager::AddWorker()
+{
+	auto worker = std::make_shared<SegmentWorker>();
+
+	worker->Start(_process_handler, [this](const std::shared_ptr<http::svr::HttpExchange> &exchange) {
+		OnExchangeCompleted(exchange);
+	});
+
+	_workers.push_back(worker);
+
+	return worker;
+}
+
+size_t SegmentWorkerManager::SelectWorker(uint32_t connection_id)
+{
+	auto worker_count = _workers.size();
+	// The worker of the connection when the workers are not busy
+	auto home_index = connection_id % worker_count;
+
+	if ((_is_autoscale_enabled == false) || (_workers[home_index]->GetQueueDepth() < _scale_up_queue_depth))
+	{
+		return home_index;
+	}
+
+	// Find the least loaded worker
+	auto selected_index = home_index;
+
+	for (size_t index = 0; index < worker_count; index++)
+	{
+		if (_workers[index]->GetQueueDepth() < _workers[selected_index]->GetQueueDepth())
+		{
+			selected_index = index;
+		}
+	}
+
+	if ((_workers[selected_index]->GetQueueDepth() >= _scale_up_queue_depth) && (worker_count < _max_worker_count))
+	{
+		AddWorker();
+
+		logti("%s segment worker is added (%zu workers)", _name.CStr(), _workers.size());
+
+		selected_index = worker_count;
+	}
+
+	return selected_index;
+}
+
+std::shared_ptr<SegmentWorker> SegmentWorkerManager::RemoveIdleWorker()
+{
+	if ((_is_autoscale_enabled == false) || (_workers.size() <= _min_worker_count))
+	{
+		return nullptr;
+	}
+
+	// Only the last worker is removed, so the indices of the other workers are not changed
+	auto worker = _workers.back();
+
+	// The queue depth includes the request being processed, so no connection is bound to the worker if it is 0
+	if ((worker->GetQueueDepth() > 0) || (worker->GetIdleTimeMSec() < _idle_timeout_msec))
+	{
+		return nullptr;
+	}
+
+	_workers.pop_back();
+
+	logti("%s segment worker is removed (%zu workers)", _name.CStr(), _workers.size());
+
+	return worker;
+}
+
+void SegmentWorkerManager::OnExchangeCompleted(const std::shared_ptr<http::svr::HttpExchange> &exchange)
+{
+	std::lock_guard<std::mutex> lock_guard(_worker_mutex);
+
+	auto item = _connection_affinity_map.find(exchange->GetConnection()->GetId());
+
+	if (item == _connection_affinity_map.end())
+	{
+		return;
+	}
+
+	if (--item->second.in_flight_count == 0)
+	{
+		_connection_affinity_map.erase(item);
+	}
+}
+
+SegmentWorkerManagerStats SegmentWorkerManager::GetStats() const
+{
+	SegmentWorkerManagerStats stats;
+
+	stats.name = _name;
+
+	std::lock_guard<std::mutex> lock_guard(_worker_mutex);
+
+	for (const auto &worker : _workers)
+	{
+		stats.worker_list.push_back(worker->GetStats());
+	}
+
+	return stats;
+}
+
+std::vector<SegmentWorkerManagerStats> SegmentWorkerManager::GetStatsList()
+{
+	std::vector<SegmentWorkerManagerStats> stats_list;
+
+	std::lock_guard<std::mutex> lock_guard(manager_list_mutex);
+
+	for (const auto &manager : manager_list)
+	{
+		stats_list.push_back(manager->GetStats());
+	}
+
+	return stats_list;
+}
+
 //====================================================================================================
 // Worker Add
 //====================================================================================================
-#define MAX_WORKER_INDEX 100000000
 bool SegmentWorkerManager::PushConnection(const std::shared_ptr<http::svr::HttpExchange> &exchange)
 {
-	int place = 0;
-	if (exchange->GetConnection()->GetConnectionType() == http::ConnectionType::Http10 || 
-		exchange->GetConnection()->GetConnectionType() == http::ConnectionType::Http11)
+	auto connection_type = exchange->GetConnection()->GetConnectionType();
+
+	// HTTP/1.1 pipelining must be placed in the same thread as requests must be responded to in the order in which they were requested.
+	// HTTP/2.0 can give a response to a exchange(stream) in any order, but it is also kept in the same thread to avoid the handover.
+	if ((connection_type != http::ConnectionType::Http10) &&
+		(connection_type != http::ConnectionType::Http11) &&
+		(connection_type != http::ConnectionType::Http20))
 	{
-		// HTTP/1.1 pipelining must be placed in the same thread as requests must be responded to in the order in which they were requested.
-		place = exchange->GetConnection()->GetId() % _workers.size();
+		logte("Invalid connection type of exchange (%s) - target(%s)", exchange->GetRequest()->ToString().CStr(),
+			  StringFromConnectionType(connection_type).CStr());
+		return false;
 	}
-	else if (exchange->GetConnection()->GetConnectionType() == http::ConnectionType::Http20)
+
+	std::shared_ptr<SegmentWorker> worker_to_stop;
+
 	{
-		// HTTP/2.0 can give a response to a exchange(stream) in any order.
-		if (_worker_index < MAX_WORKER_INDEX)
+		std::lock_guard<std::mutex> lock_guard(_worker_mutex);
+
+		if (_workers.empty())
 		{
-			_worker_index++;
+			return false;
 		}
-		else
+
+		auto connection_id = exchange->GetConnection()->GetId();
+		auto &affinity = _connection_affinity_map[connection_id];
+
+		if (affinity.in_flight_count == 0)
 		{
-			_worker_index = 0;
+			worker_to_stop = RemoveIdleWorker();
+			affinity.worker_index = SelectWorker(connection_id);
 		}
-		
-		place = exchange->GetConnection()->GetId() % _workers.size();
+
+		affinity.in_flight_count++;
+
+		_workers[affinity.worker_index]->PushConnection(exchange);
 	}
-	else
+
+	if (worker_to_stop != nullptr)
 	{
-		logte("Invalid connection type of exchange (%s) - target(%s)", exchange->GetRequest()->ToString(), 
-		StringFromConnectionType(exchange->GetConnection()->GetConnectionType()));
-		return false;
+		worker_to_stop->Stop();
 	}
-	
-	_workers[place]->PushConnection(exchange);
 
 	return true;
 }
@@ -12,30 +12,74 @@
 #include <base/ovlibrary/semaphore.h>
 #include <modules/http/server/http_exchange.h>
 
+#include <array>
+#include <atomic>
 #include <queue>
 #include <string>
 
 using SegmentProcessHandler = std::function<bool(const std::shared_ptr<http::svr::HttpExchange> &exchange)>;
+
+// Upper bounds of the latency buckets in microseconds (the last bucket has no upper bound)
+#define SEGMENT_WORKER_LATENCY_BUCKETS {500, 1000, 5000, 10000, 50000, 100000, 500000}
+#define SEGMENT_WORKER_LATENCY_BUCKET_COUNT 8
+
+struct SegmentWorkerStats
+{
+	// Number of the requests queued or being processed
+	size_t queue_depth = 0;
+	uint64_t processed_count = 0;
+	// Time from queued to processed, indexed by the bucket of SEGMENT_WORKER_LATENCY_BUCKETS
+	std::vector<uint64_t> latency_histogram;
+};
+
+struct SegmentWorkerManagerStats
+{
+	ov::String name;
+	std::vector<SegmentWorkerStats> worker_list;
+};
+
 //====================================================================================================
 // SegmentWorker
 //====================================================================================================
 class SegmentWorker
 {
 public:
+	// Called by the worker thread after <exchange> is processed
+	using CompleteHandler = std::function<void(const std::shared_ptr<http::svr::HttpExchange> &exchange)>;
+
 	SegmentWorker();
 	~SegmentWorker();
 
-	bool Start(const SegmentProcessHandler &process_handler);
+	bool Start(const SegmentProcessHandler &process_handler, const CompleteHandler &complete_handler);
 	bool Stop();
 
 	bool PushConnection(const std::shared_ptr<http::svr::HttpExchange> &exchange);
-	std::shared_ptr<http::svr::HttpExchange> PopExchange();
+
+	size_t GetQueueDepth() const
+	{
+		return _queue_depth;
+	}
+
+	// Elapsed time since the last request is processed
+	int64_t GetIdleTimeMSec() const;
+
+	SegmentWorkerStats GetStats() const;
 
 private:
+	struct WorkItem
+	{
+		std::shared_ptr<http::svr::HttpExchange> exchange;
+		std::chrono::steady_clock::time_point queued_time;
+	};
+
+	bool PopWorkItem(WorkItem &item);
+
 	void WorkerThread();
 
+	void UpdateLatency(int64_t latency_usec);
+
 private:
-	std::queue<std::shared_ptr<http::svr::HttpExchange>> _http_exchange_list_to_process;
+	std::queue<WorkItem> _http_exchange_list_to_process;
 	std::mutex _work_info_guard;
 	ov::Semaphore _queue_event;
 
@@ -43,6 +87,12 @@ private:
 	std::thread _worker_thread;
 
 	SegmentProcessHandler _process_handler;
+	CompleteHandler _complete_handler;
+
+	std::atomic<size_t> _queue_depth{0};
+	std::atomic<uint64_t> _processed_count{0};
+	std::array<std::atomic<uint64_t>, SEGMENT_WORKER_LATENCY_BUCKET_COUNT> _latency_histogram{};
+	std::atomic<int64_t> _last_processed_time_msec{0};
 };
 
 //====================================================================================================
@@ -55,12 +105,45 @@ public:
 	~SegmentWorkerManager() = default;
 
 public:
-	bool Start(int worker_count, const SegmentProcessHandler &process_handler);
+	// <name> is used to identify the workers in the statistics
+	bool Start(const ov::String &name, int worker_count, const SegmentProcessHandler &process_handler);
 	bool Stop();
 	bool PushConnection(const std::shared_ptr<http::svr::HttpExchange> &exchange);
 
+	SegmentWorkerManagerStats GetStats() const;
+	// Statistics of all running managers
+	static std::vector<SegmentWorkerManagerStats> GetStatsList();
+
+private:
+	// The requests of a connection are processed by the same worker while any of them is queued,
+	// so the responses are sent in the order of the requests (HTTP/1.1 pipelining), and the connection
+	// is not handed over between the cores.
+	struct ConnectionAffinity
+	{
+		size_t worker_index = 0;
+		size_t in_flight_count = 0;
+	};
+
+	// Must be called while _worker_mutex is locked
+	std::shared_ptr<SegmentWorker> AddWorker();
+	size_t SelectWorker(uint32_t connection_id);
+	// Returns the worker to stop if the last worker is idle
+	std::shared_ptr<SegmentWorker> RemoveIdleWorker();
+
+	void OnExchangeCompleted(const std::shared_ptr<http::svr::HttpExchange> &exchange);
+
 private:
-	int _worker_index = 0;
+	ov::String _name;
+	SegmentProcessHandler _process_handler;
+
+	bool _is_autoscale_enabled = false;
+	size_t _min_worker_count = 0;
+	size_t _max_worker_count = 0;
+	size_t _scale_up_queue_depth = 0;
+	int64_t _idle_timeout_msec = 0;
 
+	mutable std::mutex _worker_mutex;
 	std::vector<std::shared_ptr<SegmentWorker>> _workers;
-};
\ No newline at end of file
+	// Key: ID of the connection
+	std::unordered_map<uint32_t, ConnectionAffinity> _connection_affinity_map;
+};
@@ -0,0 +1,57 @@
+#include "srt_application.h"
+
+#include "srt_private.h"
+#include "srt_session.h"
+#include "srt_stream.h"
+
+std::shared_ptr<SrtApplication> SrtApplication::Create(const std::shared_ptr<pub::Publisher> &publisher, const info::Application &application_info)
+{
+	auto application = std::make_shared<SrtApplication>(publisher, application_info);
+	application->Start();
+	return application;
+}
+
+SrtApplication::SrtApplication(const std::shared_ptr<pub::Publisher> &publisher, const info::Application &application_info)
+	: Application(publisher, application_info)
+{
+	// Data packets are not supported
+	SetSubscription(MediaRouteSubscription().SetMediaTypes({cmn::MediaType::Video, cmn::MediaType::Audio}));
+}
+
+SrtApplication::~SrtApplication()
+{
+	Stop();
+	logtd("SrtApplication(%d) has been terminated finally", GetId());
+}
+
+bool SrtApplication::Start()
+{
+	return Application::Start();
+}
+
+bool SrtApplication::Stop()
+{
+	return Application::Stop();
+}
+
+std::shared_ptr<pub::Stream> SrtApplication::CreateStream(const std::shared_ptr<info::Stream> &info, uint32_t worker_count)
+{
+	logtd("SrtApplication::CreateStream : %s/%u", info->GetName().CStr(), info->GetId());
+	return SrtStream::Create(GetSharedPtrAs<pub::Application>(), *info, worker_count);
+}
+
+bool SrtApplication::DeleteStream(const std::shared_ptr<info::Stream> &info)
+{
+	logtd("SrtApplication::DeleteStream : %s/%u", info->GetName().CStr(), info->GetId());
+
+	auto stream = std::static_pointer_cast<SrtStream>(GetStream(info->GetId()));
+	if (stream == nullptr)
+	{
+		logte("SrtApplication::Delete stream failed. Cannot find stream (%s)", info->GetName().CStr());
+		return false;
+	}
+
+	logtd("SrtApplication %s/%s stream has been deleted", GetName().CStr(), stream->GetName().CStr());
+
+	return true;
+}
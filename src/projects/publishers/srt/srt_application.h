@@ -0,0 +1,23 @@
+#pragma once
+
+#include <base/common_types.h>
+#include <base/info/session.h>
+#include <base/publisher/application.h>
+
+#include "srt_stream.h"
+
+class SrtApplication : public pub::Application
+{
+public:
+	static std::shared_ptr<SrtApplication> Create(const std::shared_ptr<pub::Publisher> &publisher, const info::Application &application_info);
+	SrtApplication(const std::shared_ptr<pub::Publisher> &publisher, const info::Application &application_info);
+	~SrtApplication() final;
+
+private:
+	bool Start() override;
+	bool Stop() override;
+
+	// Application Implementation
+	std::shared_ptr<pub::Stream> CreateStream(const std::shared_ptr<info::Stream> &info, uint32_t worker_count) override;
+	bool DeleteStream(const std::shared_ptr<info::Stream> &info) override;
+};
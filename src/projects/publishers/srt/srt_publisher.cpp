@@ -0,0 +1,314 @@
+#include "srt_publisher.h"
+
+#include <base/ovlibrary/url.h>
+#include <modules/physical_port/physical_port_manager.h>
+#include <modules/srt/srt.h>
+
+#include "srt_private.h"
+#include "srt_session.h"
+
+std::shared_ptr<SrtPublisher> SrtPublisher::Create(const cfg::Server &server_config, const std::shared_ptr<MediaRouteInterface> &router)
+{
+	auto obj = std::make_shared<SrtPublisher>(server_config, router);
+
+	if (!obj->Start())
+	{
+		return nullptr;
+	}
+
+	return obj;
+}
+
+SrtPublisher::SrtPublisher(const cfg::Server &server_config, const std::shared_ptr<MediaRouteInterface> &router)
+	: Publisher(server_config, router)
+{
+}
+
+SrtPublisher::~SrtPublisher()
+{
+	logtd("SrtPublisher has been terminated finally");
+}
+
+bool SrtPublisher::Start()
+{
+	auto &server_config = GetServerConfig();
+	auto &srt_bind_config = server_config.GetBind().GetPublishers().GetSrt();
+
+	if (srt_bind_config.IsParsed() == false)
+	{
+		logtw("%s is disabled by configuration", GetPublisherName());
+		return true;
+	}
+
+	bool is_configured;
+	auto &port_config = srt_bind_config.GetPort(&is_configured);
+
+	if (is_configured == false)
+	{
+		logtw("%s is disabled - No port is configured", GetPublisherName());
+		return true;
+	}
+
+	std::vector<ov::SocketAddress> address_list;
+	try
+	{
+		address_list = ov::SocketAddress::Create(server_config.GetIPList(), static_cast<uint16_t>(port_config.GetPort()));
+	}
+	catch (const ov::Error &e)
+	{
+		logte("Could not listen for %s Server: %s", GetPublisherName(), e.What());
+		return false;
+	}
+
+	auto worker_count = srt_bind_config.GetWorkerCount(&is_configured);
+	worker_count = is_configured ? worker_count : PHYSICAL_PORT_USE_DEFAULT_COUNT;
+
+	bool result = true;
+	std::vector<std::shared_ptr<PhysicalPort>> server_port_list;
+	std::vector<ov::String> address_string_list;
+
+	auto physical_port_manager = PhysicalPortManager::GetInstance();
+
+	for (auto &address : address_list)
+	{
+		auto server_port = physical_port_manager->CreatePort(
+			"SrtPub", ov::SocketType::Srt, address, worker_count, 0, 0,
+			[=](const std::shared_ptr<ov::Socket> &socket) -> std::shared_ptr<ov::Error> {
+				return SrtOptionProcessor::SetOptions(socket, srt_bind_config.GetOptions());
+			});
+
+		if (server_port == nullptr)
+		{
+			logte("Could not listen for %s on %s", GetPublisherName(), address.ToString().CStr());
+			result = false;
+			break;
+		}
+
+		server_port->AddObserver(this);
+		server_port_list.push_back(server_port);
+
+		address_string_list.emplace_back(address.ToString());
+	}
+
+	if (result)
+	{
+		logti("%s is listening on %s/%s...",
+			  GetPublisherName(),
+			  ov::String::Join(address_string_list, ", ").CStr(),
+			  ov::StringFromSocketType(ov::SocketType::Srt));
+
+		{
+			std::lock_guard lock_guard{_server_port_list_mutex};
+			_server_port_list = std::move(server_port_list);
+		}
+
+		return Publisher::Start();
+	}
+
+	for (auto &server_port : server_port_list)
+	{
+		server_port->RemoveObserver(this);
+		physical_port_manager->DeletePort(server_port);
+	}
+
+	return false;
+}
+
+bool SrtPublisher::Stop()
+{
+	_server_port_list_mutex.lock();
+	auto server_port_list = std::move(_server_port_list);
+	_server_port_list_mutex.unlock();
+
+	auto physical_port_manager = PhysicalPortManager::GetInstance();
+
+	for (auto &server_port : server_port_list)
+	{
+		server_port->RemoveObserver(this);
+		physical_port_manager->DeletePort(server_port);
+	}
+
+	return Publisher::Stop();
+}
+
+bool SrtPublisher::OnCreateHost(const info::Host &host_info)
+{
+	return true;
+}
+
+bool SrtPublisher::OnDeleteHost(const info::Host &host_info)
+{
+	return true;
+}
+
+std::shared_ptr<pub::Application> SrtPublisher::OnCreatePublisherApplication(const info::Application &application_info)
+{
+	if (IsModuleAvailable() == false)
+	{
+		return nullptr;
+	}
+
+	return SrtApplication::Create(SrtPublisher::GetSharedPtrAs<pub::Publisher>(), application_info);
+}
+
+bool SrtPublisher::OnDeletePublisherApplication(const std::shared_ptr<pub::Application> &application)
+{
+	return true;
+}
+
+void SrtPublisher::OnConnected(const std::shared_ptr<ov::Socket> &remote)
+{
+	logti("The SRT client has connected : %s [%s]", remote->ToString().CStr(), remote->GetStreamId().CStr());
+
+	// streamid format is below
+	// urlencode(srt://host[:port]/app/stream?query=value)
+	auto streamid = remote->GetStreamId();
+	auto decoded_url = ov::Url::Decode(streamid);
+	auto final_url = ov::Url::Parse(decoded_url);
+	if (final_url == nullptr)
+	{
+		logte("SRT's streamid must be in the following format, percent encoded. srt://{host}[:port]/{app}/{stream}?{query}={value} : %s", streamid.CStr());
+		remote->Close();
+		return;
+	}
+
+	auto requested_url = final_url;
+	auto remote_address = remote->GetRemoteAddress();
+
+	// SingedPolicy
+	auto [signed_policy_result, signed_policy] = VerifyBySignedPolicy(final_url, remote_address);
+	if (signed_policy_result == AccessController::VerificationResult::Error)
+	{
+		remote->Close();
+		return;
+	}
+	else if (signed_policy_result == AccessController::VerificationResult::Fail)
+	{
+		logtw("%s", signed_policy->GetErrMessage().CStr());
+		remote->Close();
+		return;
+	}
+
+	// AdmissionWebhooks
+	auto request_info = std::make_shared<AccessController::RequestInfo>(final_url, remote_address);
+
+	auto [webhooks_result, admission_webhooks] = VerifyByAdmissionWebhooks(request_info);
+	if (webhooks_result == AccessController::VerificationResult::Pass)
+	{
+		// Redirect URL
+		if (admission_webhooks->GetNewURL() != nullptr)
+		{
+			final_url = admission_webhooks->GetNewURL();
+		}
+	}
+	else if (webhooks_result == AccessController::VerificationResult::Error)
+	{
+		logtw("AdmissionWebhooks error : %s", final_url->ToUrlString().CStr());
+		remote->Close();
+		return;
+	}
+	else if (webhooks_result == AccessController::VerificationResult::Fail)
+	{
+		logtw("AdmissionWebhooks error : %s", admission_webhooks->GetErrReason().CStr());
+		remote->Close();
+		return;
+	}
+
+	auto vhost_app_name = ocst::Orchestrator::GetInstance()->ResolveApplicationNameFromDomain(final_url->Host(), final_url->App());
+	auto stream_name = final_url->Stream();
+
+	auto app = GetApplicationByName(vhost_app_name);
+	if (app == nullptr)
+	{
+		logte("Could not find vhost/app: %s", vhost_app_name.CStr());
+		remote->Close();
+		return;
+	}
+
+	// If the stream does not exist, request it to the origin
+	auto stream = std::static_pointer_cast<SrtStream>(PullStream(final_url, vhost_app_name, final_url->Host(), stream_name));
+	if (stream == nullptr)
+	{
+		logte("Could not find or pull the stream: [%s/%s]", vhost_app_name.CStr(), stream_name.CStr());
+		remote->Close();
+		return;
+	}
+
+	if (stream->WaitUntilStart(3000) == false)
+	{
+		logte("(%s/%s) stream has not started.", vhost_app_name.CStr(), stream_name.CStr());
+		remote->Close();
+		return;
+	}
+
+	auto session = SrtSession::Create(app, stream, stream->IssueUniqueSessionId(), remote);
+	if (session == nullptr)
+	{
+		logte("Internal Error : Cannot create session for %s", remote->ToString().CStr());
+		remote->Close();
+		return;
+	}
+
+	session->SetUrls(requested_url, final_url);
+
+	{
+		std::lock_guard<std::mutex> lock_guard(_remote_stream_map_mutex);
+		_remote_stream_map[remote->GetNativeHandle()] = stream;
+	}
+
+	stream->AddSession(session);
+}
+
+void SrtPublisher::OnDataReceived(const std::shared_ptr<ov::Socket> &remote,
+								  const ov::SocketAddress &address,
+								  const std::shared_ptr<const ov::Data> &data)
+{
+	// Nothing to receive from the caller
+}
+
+void SrtPublisher::OnDisconnected(const std::shared_ptr<ov::Socket> &remote,
+								  PhysicalPortDisconnectReason reason,
+								  const std::shared_ptr<const ov::Error> &error)
+{
+	std::shared_ptr<SrtStream> stream;
+
+	{
+		std::lock_guard<std::mutex> lock_guard(_remote_stream_map_mutex);
+
+		auto item = _remote_stream_map.find(remote->GetNativeHandle());
+		if (item == _remote_stream_map.end())
+		{
+			// It probably rejected on OnConnected
+			return;
+		}
+
+		stream = item->second;
+		_remote_stream_map.erase(item);
+	}
+
+	logti("The SRT client has disconnected: [%s/%s], remote: %s", stream->GetApplicationName(), stream->GetName().CStr(), remote->ToString().CStr());
+
+	for (const auto &[session_id, item] : stream->GetAllSessions())
+	{
+		auto session = std::static_pointer_cast<SrtSession>(item);
+
+		if (session->GetConnector()->GetNativeHandle() != remote->GetNativeHandle())
+		{
+			continue;
+		}
+
+		// Send Close to Admission Webhooks
+		auto requested_url = session->GetRequestedUrl();
+		auto final_url = session->GetFinalUrl();
+		auto remote_address = remote->GetRemoteAddress();
+		if (requested_url && final_url && remote_address)
+		{
+			auto request_info = std::make_shared<AccessController::RequestInfo>(requested_url, remote_address, requested_url->ToUrlString(true) == final_url->ToUrlString(true) ? nullptr : final_url);
+
+			SendCloseAdmissionWebhooks(request_info);
+		}
+
+		stream->RemoveSession(session_id);
+		break;
+	}
+}
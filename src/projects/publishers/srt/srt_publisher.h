@@ -0,0 +1,57 @@
+#pragma once
+
+#include <orchestrator/orchestrator.h>
+
+#include "base/common_types.h"
+#include "base/mediarouter/mediarouter_application_interface.h"
+#include "base/ovlibrary/url.h"
+#include "base/publisher/publisher.h"
+#include "srt_application.h"
+
+// Listens for SRT callers and sends them the stream specified by the streamid as MPEG-TS
+//
+// streamid format (percent encoded): srt://{host}[:port]/{app}/{stream}[?{query}={value}]
+class SrtPublisher : public pub::Publisher, public PhysicalPortObserver
+{
+public:
+	static std::shared_ptr<SrtPublisher> Create(const cfg::Server &server_config, const std::shared_ptr<MediaRouteInterface> &router);
+
+	SrtPublisher(const cfg::Server &server_config, const std::shared_ptr<MediaRouteInterface> &router);
+	~SrtPublisher() override;
+	bool Stop() override;
+
+private:
+	bool Start() override;
+
+	//--------------------------------------------------------------------
+	// Implementation of Publisher
+	//--------------------------------------------------------------------
+	PublisherType GetPublisherType() const override
+	{
+		return PublisherType::Srt;
+	}
+	const char *GetPublisherName() const override
+	{
+		return "SRTPublisher";
+	}
+
+	bool OnCreateHost(const info::Host &host_info) override;
+	bool OnDeleteHost(const info::Host &host_info) override;
+	std::shared_ptr<pub::Application> OnCreatePublisherApplication(const info::Application &application_info) override;
+	bool OnDeletePublisherApplication(const std::shared_ptr<pub::Application> &application) override;
+
+	//--------------------------------------------------------------------
+	// Implementation of PhysicalPortObserver
+	//--------------------------------------------------------------------
+	void OnConnected(const std::shared_ptr<ov::Socket> &remote) override;
+	void OnDataReceived(const std::shared_ptr<ov::Socket> &remote, const ov::SocketAddress &address, const std::shared_ptr<const ov::Data> &data) override;
+	void OnDisconnected(const std::shared_ptr<ov::Socket> &remote, PhysicalPortDisconnectReason reason, const std::shared_ptr<const ov::Error> &error) override;
+	//--------------------------------------------------------------------
+
+	std::mutex _server_port_list_mutex;
+	std::vector<std::shared_ptr<PhysicalPort>> _server_port_list;
+
+	// remote id : stream
+	std::mutex _remote_stream_map_mutex;
+	std::map<int, std::shared_ptr<SrtStream>> _remote_stream_map;
+};
@@ -0,0 +1,109 @@
+#include "srt_session.h"
+
+#include <base/info/stream.h>
+#include <base/publisher/stream.h>
+#include <monitoring/monitoring.h>
+
+#include "srt_private.h"
+#include "srt_stream.h"
+
+std::shared_ptr<SrtSession> SrtSession::Create(const std::shared_ptr<pub::Application> &application,
+											   const std::shared_ptr<pub::Stream> &stream,
+											   uint32_t session_id,
+											   const std::shared_ptr<ov::Socket> &connector)
+{
+	auto session_info = info::Session(*std::static_pointer_cast<info::Stream>(stream), session_id);
+	auto session = std::make_shared<SrtSession>(session_info, application, stream, connector);
+	if (!session->Start())
+	{
+		return nullptr;
+	}
+	return session;
+}
+
+SrtSession::SrtSession(const info::Session &session_info,
+					   const std::shared_ptr<pub::Application> &application,
+					   const std::shared_ptr<pub::Stream> &stream,
+					   const std::shared_ptr<ov::Socket> &connector)
+	: pub::Session(session_info, application, stream),
+	  _connector(connector)
+{
+	_data_list.reserve(MAX_STREAM_PACKET_BATCH_SIZE);
+
+	MonitorInstance->OnSessionConnected(*GetStream(), PublisherType::Srt);
+}
+
+SrtSession::~SrtSession()
+{
+	Stop();
+	logtd("SrtSession(%d) has been terminated finally", GetId());
+
+	MonitorInstance->OnSessionDisconnected(*GetStream(), PublisherType::Srt);
+}
+
+bool SrtSession::Start()
+{
+	logtd("SrtSession(%d) has started", GetId());
+	return Session::Start();
+}
+
+bool SrtSession::Stop()
+{
+	logtd("SrtSession(%d) has stopped", GetId());
+	_connector->Close();
+
+	return Session::Stop();
+}
+
+void SrtSession::SendOutgoingPackets(const pub::PacketBatch<SrtData> &packets)
+{
+	for (const auto &packet : packets)
+	{
+		if (packet == nullptr)
+		{
+			continue;
+		}
+
+		if (_sent_ready == false)
+		{
+			if (packet->IsKeyframe() == false)
+			{
+				continue;
+			}
+
+			_sent_ready = true;
+		}
+
+		_data_list.push_back(packet->GetData());
+	}
+
+	if (_data_list.empty())
+	{
+		return;
+	}
+
+	// The TS packets are shared with other sessions, so they are sent without copying
+	_connector->Send(_data_list);
+	_data_list.clear();
+}
+
+const std::shared_ptr<ov::Socket> &SrtSession::GetConnector() const
+{
+	return _connector;
+}
+
+void SrtSession::SetUrls(const std::shared_ptr<const ov::Url> &requested_url, const std::shared_ptr<const ov::Url> &final_url)
+{
+	_requested_url = requested_url;
+	_final_url = final_url;
+}
+
+std::shared_ptr<const ov::Url> SrtSession::GetRequestedUrl() const
+{
+	return _requested_url;
+}
+
+std::shared_ptr<const ov::Url> SrtSession::GetFinalUrl() const
+{
+	return _final_url;
+}
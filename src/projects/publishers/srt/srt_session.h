@@ -0,0 +1,47 @@
+#pragma once
+
+#include <base/info/media_track.h>
+#include <base/ovlibrary/url.h>
+#include <base/ovsocket/socket.h>
+#include <base/publisher/session.h>
+#include <base/publisher/stream_packet_queue.h>
+
+class SrtData;
+
+class SrtSession : public pub::Session, public pub::PacketSink<SrtData>
+{
+public:
+	static std::shared_ptr<SrtSession> Create(const std::shared_ptr<pub::Application> &application,
+											  const std::shared_ptr<pub::Stream> &stream,
+											  uint32_t session_id,
+											  const std::shared_ptr<ov::Socket> &connector);
+
+	SrtSession(const info::Session &session_info,
+			   const std::shared_ptr<pub::Application> &application,
+			   const std::shared_ptr<pub::Stream> &stream,
+			   const std::shared_ptr<ov::Socket> &connector);
+	~SrtSession() override;
+
+	bool Start() override;
+	bool Stop() override;
+
+	// pub::PacketSink Interface
+	void SendOutgoingPackets(const pub::PacketBatch<SrtData> &packets) override;
+
+	const std::shared_ptr<ov::Socket> &GetConnector() const;
+
+	// Used to send the close event to AdmissionWebhooks
+	void SetUrls(const std::shared_ptr<const ov::Url> &requested_url, const std::shared_ptr<const ov::Url> &final_url);
+	std::shared_ptr<const ov::Url> GetRequestedUrl() const;
+	std::shared_ptr<const ov::Url> GetFinalUrl() const;
+
+private:
+	std::shared_ptr<ov::Socket> _connector;
+
+	std::shared_ptr<const ov::Url> _requested_url;
+	std::shared_ptr<const ov::Url> _final_url;
+
+	// The session starts to send from a keyframe, so the decoder of the client can start decoding immediately
+	bool _sent_ready = false;
+	std::vector<std::shared_ptr<const ov::Data>> _data_list;
+};
@@ -0,0 +1,220 @@
+#include "srt_stream.h"
+
+#include "base/publisher/application.h"
+#include "base/publisher/stream.h"
+#include "srt_private.h"
+
+std::shared_ptr<SrtStream> SrtStream::Create(const std::shared_ptr<pub::Application> application,
+											 const info::Stream &info,
+											 uint32_t worker_count)
+{
+	auto stream = std::make_shared<SrtStream>(application, info, worker_count);
+	return stream;
+}
+
+SrtStream::SrtStream(const std::shared_ptr<pub::Application> application,
+					 const info::Stream &info,
+					 uint32_t worker_count)
+	: Stream(application, info),
+	  _worker_count(worker_count)
+{
+	logtd("SrtStream(%s/%s) has been started", GetApplicationName(), GetName().CStr());
+}
+
+SrtStream::~SrtStream()
+{
+	logtd("SrtStream(%s/%s) has been terminated finally", GetApplicationName(), GetName().CStr());
+}
+
+bool SrtStream::Start()
+{
+	if (GetState() != Stream::State::CREATED)
+	{
+		return false;
+	}
+
+	if (!CreateStreamWorker<SrtData>(_worker_count))
+	{
+		return false;
+	}
+
+	auto writer = CreateWriter();
+	if (writer == nullptr)
+	{
+		logtw("SrtStream(%s/%s) - There is no track to be sent over SRT", GetApplicationName(), GetName().CStr());
+	}
+
+	{
+		std::lock_guard<std::mutex> lock_guard(_writer_lock);
+		_writer = writer;
+	}
+
+	logtd("SrtStream(%d) has been started", GetId());
+
+	return Stream::Start();
+}
+
+bool SrtStream::Stop()
+{
+	if (GetState() != Stream::State::STARTED)
+	{
+		return false;
+	}
+
+	logtd("SrtStream(%u) has been stopped", GetId());
+
+	std::unique_lock<std::mutex> lock(_writer_lock);
+	auto writer = std::move(_writer);
+	lock.unlock();
+
+	if (writer != nullptr)
+	{
+		writer->Stop();
+	}
+
+	return Stream::Stop();
+}
+
+std::shared_ptr<MpegtsWriter> SrtStream::CreateWriter()
+{
+	for (const auto &[track_id, track] : _tracks)
+	{
+		switch (track->GetCodecId())
+		{
+			case cmn::MediaCodecId::H264:
+			case cmn::MediaCodecId::H265:
+				if (_video_track_id == -1)
+				{
+					_video_track_id = track_id;
+				}
+				break;
+
+			case cmn::MediaCodecId::Aac:
+			case cmn::MediaCodecId::Mp3:
+				if (_audio_track_id == -1)
+				{
+					_audio_track_id = track_id;
+				}
+				break;
+
+			default:
+				break;
+		}
+	}
+
+	if ((_video_track_id == -1) && (_audio_track_id == -1))
+	{
+		return nullptr;
+	}
+
+	auto writer = MpegtsWriter::Create();
+
+	if (writer->SetPath(ov::String::FormatString("srt://%s/%s", GetApplicationName(), GetName().CStr()), "mpegts") == false)
+	{
+		return nullptr;
+	}
+
+	for (auto track_id : {_video_track_id, _audio_track_id})
+	{
+		if (track_id == -1)
+		{
+			continue;
+		}
+
+		auto &track = _tracks[track_id];
+
+		auto track_info = MpegtsTrackInfo::Create();
+		track_info->SetCodecId(track->GetCodecId());
+		track_info->SetBitrate(track->GetBitrate());
+		track_info->SetTimeBase(track->GetTimeBase());
+		track_info->SetWidth(track->GetWidth());
+		track_info->SetHeight(track->GetHeight());
+		track_info->SetSample(track->GetSample());
+		track_info->SetChannel(track->GetChannel());
+
+		// Set DecoderSpecificInfo
+		if (track->GetCodecId() == cmn::MediaCodecId::H264)
+		{
+			track_info->SetExtradata(track->GetCodecComponentData(MediaTrack::CodecComponentDataType::AVCDecoderConfigurationRecord));
+		}
+		else if (track->GetCodecId() == cmn::MediaCodecId::H265)
+		{
+			track_info->SetExtradata(track->GetCodecComponentData(MediaTrack::CodecComponentDataType::HEVCDecoderConfigurationRecord));
+		}
+		else if (track->GetCodecId() == cmn::MediaCodecId::Aac)
+		{
+			track_info->SetExtradata(track->GetCodecComponentData(MediaTrack::CodecComponentDataType::AACSpecificConfig));
+		}
+
+		if (writer->AddTrack(track->GetMediaType(), track->GetId(), track_info) == false)
+		{
+			logtw("Failed to add track(%d) to the TS muxer", track->GetId());
+		}
+	}
+
+	// OnTsPackets() is called in PutData() (with _writer_lock)
+	writer->SetTsPacketCallback([this](const std::shared_ptr<const ov::Data> &ts_packets) {
+		OnTsPackets(ts_packets);
+	});
+
+	if (writer->Start() == false)
+	{
+		return nullptr;
+	}
+
+	return writer;
+}
+
+void SrtStream::SendVideoFrame(const std::shared_ptr<MediaPacket> &media_packet)
+{
+	SendFrame(media_packet);
+}
+
+void SrtStream::SendAudioFrame(const std::shared_ptr<MediaPacket> &media_packet)
+{
+	SendFrame(media_packet);
+}
+
+void SrtStream::SendFrame(const std::shared_ptr<MediaPacket> &media_packet)
+{
+	if (GetState() != Stream::State::STARTED)
+	{
+		return;
+	}
+
+	auto track_id = media_packet->GetTrackId();
+	if ((track_id != _video_track_id) && (track_id != _audio_track_id))
+	{
+		return;
+	}
+
+	// Nobody is watching, so there is no need to mux
+	// (A session that joins later starts from the next keyframe)
+	if (GetSessionCount() == 0)
+	{
+		return;
+	}
+
+	std::lock_guard<std::mutex> lock_guard(_writer_lock);
+
+	if (_writer == nullptr)
+	{
+		return;
+	}
+
+	// Every audio frame can be a starting point if there is no video
+	_is_keyframe_muxing = (_video_track_id == -1) ||
+						  ((track_id == _video_track_id) && (media_packet->GetFlag() == MediaPacketFlag::Key));
+
+	if (_writer->PutData(media_packet) == false)
+	{
+		logtw("Could not mux the frame of track(%d) for SRT (%s/%s)", track_id, GetApplicationName(), GetName().CStr());
+	}
+}
+
+void SrtStream::OnTsPackets(const std::shared_ptr<const ov::Data> &ts_packets)
+{
+	BroadcastPacket(std::make_shared<SrtData>(ts_packets, _is_keyframe_muxing));
+
+	MonitorInstance->IncreaseBytesOut(*pub::Stream::GetSharedPtrAs<info::Stream>(), PublisherType::Srt, ts_packets->GetLength() * GetSessionCount());
+}
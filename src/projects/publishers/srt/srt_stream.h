@@ -0,0 +1,69 @@
+#pragma once
+
+#include <base/common_types.h>
+#include <base/publisher/stream.h>
+#include <modules/mpegts/mpegts_writer.h>
+
+#include "monitoring/monitoring.h"
+
+// TS packets muxed from a frame, shared by all sessions of a stream
+class SrtData
+{
+public:
+	SrtData(const std::shared_ptr<const ov::Data> &data, bool is_keyframe)
+		: _data(data),
+		  _is_keyframe(is_keyframe)
+	{
+	}
+
+	const std::shared_ptr<const ov::Data> &GetData() const
+	{
+		return _data;
+	}
+
+	// Whether the TS packets contain a video keyframe (with PAT/PMT in front of it)
+	bool IsKeyframe() const
+	{
+		return _is_keyframe;
+	}
+
+private:
+	std::shared_ptr<const ov::Data> _data;
+	bool _is_keyframe;
+};
+
+// Muxes MPEG-TS once per stream and broadcasts the same TS packets to all SRT sessions
+class SrtStream : public pub::Stream
+{
+public:
+	static std::shared_ptr<SrtStream> Create(const std::shared_ptr<pub::Application> application,
+											 const info::Stream &info,
+											 uint32_t worker_count);
+	explicit SrtStream(const std::shared_ptr<pub::Application> application,
+					   const info::Stream &info,
+					   uint32_t worker_count);
+	~SrtStream() final;
+
+	void SendVideoFrame(const std::shared_ptr<MediaPacket> &media_packet) override;
+	void SendAudioFrame(const std::shared_ptr<MediaPacket> &media_packet) override;
+	void SendDataFrame(const std::shared_ptr<MediaPacket> &media_packet) override {}  // Not supported
+
+private:
+	bool Start() override;
+	bool Stop() override;
+
+	std::shared_ptr<MpegtsWriter> CreateWriter();
+	void SendFrame(const std::shared_ptr<MediaPacket> &media_packet);
+	// Called by MpegtsWriter in SendFrame()
+	void OnTsPackets(const std::shared_ptr<const ov::Data> &ts_packets);
+
+	uint32_t _worker_count = 0;
+
+	std::mutex _writer_lock;
+	std::shared_ptr<MpegtsWriter> _writer;
+	// Whether the frame being muxed is a video keyframe (protected by _writer_lock)
+	bool _is_keyframe_muxing = false;
+	// Only the first video track and the first audio track are muxed (-1: not used)
+	int32_t _video_track_id = -1;
+	int32_t _audio_track_id = -1;
+};
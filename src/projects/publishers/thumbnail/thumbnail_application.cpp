@@ -13,6 +13,9 @@ std::shared_ptr<ThumbnailApplication> ThumbnailApplication::Create(const std::sh
 ThumbnailApplication::ThumbnailApplication(const std::shared_ptr<pub::Publisher> &publisher, const info::Application &application_info)
 	: Application(publisher, application_info)
 {
+	// Only the image tracks are used, and the audio/data packets don't have to be queued
+	SetSubscription(MediaRouteSubscription().SetMediaTypes({cmn::MediaType::Video}));
+
 	auto thumbnail_config = application_info.GetConfig().GetPublishers().GetThumbnailPublisher();
 
 	bool is_parsed;
@@ -228,7 +228,15 @@ std::shared_ptr<ThumbnailInterceptor> ThumbnailPublisher::CreateInterceptor()
 			return http::svr::NextHandler::DoNotCall;
 		}
 
-		auto vhost_app_name = ocst::Orchestrator::GetInstance()->ResolveApplicationNameFromDomain(request_url->Host(), request_url->App());
+		// Requests of a stream resolved before skip the Orchestrator and the application/stream maps
+		auto routing_version = ocst::Orchestrator::GetInstance()->GetDomainRoutingVersion();
+		auto vhost_app_name = info::VHostAppName::InvalidVHostAppName();
+		auto cached_stream = GetResolvedStream(request_url, &vhost_app_name);
+		if (cached_stream == nullptr)
+		{
+			vhost_app_name = ocst::Orchestrator::GetInstance()->ResolveApplicationNameFromDomain(request_url->Host(), request_url->App());
+		}
+
 		if (vhost_app_name.IsValid() == false)
 		{
 			logte("Could not resolve application name from domain: %s", request_url->Host().CStr());
@@ -236,7 +244,8 @@ std::shared_ptr<ThumbnailInterceptor> ThumbnailPublisher::CreateInterceptor()
 			return http::svr::NextHandler::DoNotCall;
 		}
 
-		auto app_info = std::static_pointer_cast<info::Application>(GetApplicationByName(vhost_app_name));
+		auto application = std::static_pointer_cast<ThumbnailApplication>((cached_stream != nullptr) ? cached_stream->GetApplication() : GetApplicationByName(vhost_app_name));
+		auto app_info = std::static_pointer_cast<info::Application>(application);
 		if (app_info == nullptr)
 		{
 			logtw("Could not found application");
@@ -297,6 +306,7 @@ std::shared_ptr<ThumbnailInterceptor> ThumbnailPublisher::CreateInterceptor()
 					}
 
 					vhost_app_name = ocst::Orchestrator::GetInstance()->ResolveApplicationNameFromDomain(request_url->Host(), request_url->App());
+					cached_stream = nullptr;
 					host_name = request_url->Host();
 					stream_name = request_url->Stream();
 				}
@@ -325,7 +335,11 @@ std::shared_ptr<ThumbnailInterceptor> ThumbnailPublisher::CreateInterceptor()
 		auto thumbnail_config = app_config.GetPublishers().GetThumbnailPublisher();
 
 		// Check CORS
-		auto application = std::static_pointer_cast<ThumbnailApplication>(GetApplicationByName(vhost_app_name));
+		if (cached_stream == nullptr)
+		{
+			application = std::static_pointer_cast<ThumbnailApplication>(GetApplicationByName(vhost_app_name));
+		}
+
 		if (application == nullptr)
 		{
 			response->AppendString("Could not found application of thumbnail publisher");
@@ -340,7 +354,7 @@ std::shared_ptr<ThumbnailInterceptor> ThumbnailPublisher::CreateInterceptor()
 		application->GetCorsManager().SetupHttpCorsHeader(vhost_app_name, request, response);
 
 		// Check Stream
-		auto stream = GetStream(vhost_app_name, request_url->Stream());		
+		auto stream = (cached_stream != nullptr) ? cached_stream : GetStream(vhost_app_name, request_url->Stream());
 		if (stream == nullptr)
 		{
 			// If the stream does not exists, request to the provider
@@ -366,6 +380,11 @@ std::shared_ptr<ThumbnailInterceptor> ThumbnailPublisher::CreateInterceptor()
 			return http::svr::NextHandler::DoNotCall;
 		}
 
+		if (cached_stream == nullptr)
+		{
+			CacheResolvedStream(request_url, routing_version, vhost_app_name, stream);
+		}
+
 		// Check Extentions
 		auto media_codec_id = cmn::MediaCodecId::None;
 		if (request_url->File().LowerCaseString().IndexOf(".jpg") >= 0)
@@ -13,20 +13,27 @@
 
 std::shared_ptr<RtcApplication> RtcApplication::Create(const std::shared_ptr<pub::Publisher> &publisher,
 													   const info::Application &application_info,
+													   const std::shared_ptr<Certificate> &certificate,
 													   const std::shared_ptr<IcePort> &ice_port,
 													   const std::shared_ptr<RtcSignallingServer> &rtc_signalling)
 {
-	auto application = std::make_shared<RtcApplication>(publisher, application_info, ice_port, rtc_signalling);
+	auto application = std::make_shared<RtcApplication>(publisher, application_info, certificate, ice_port, rtc_signalling);
 	application->Start();
 	return application;
 }
 
 RtcApplication::RtcApplication(const std::shared_ptr<pub::Publisher> &publisher,
 							   const info::Application &application_info,
+							   const std::shared_ptr<Certificate> &certificate,
 							   const std::shared_ptr<IcePort> &ice_port,
 							   const std::shared_ptr<RtcSignallingServer> &rtc_signalling)
 	: Application(publisher, application_info)
 {
+	// Data packets are not supported (there is no data channel)
+	SetSubscription(MediaRouteSubscription().SetMediaTypes({cmn::MediaType::Video, cmn::MediaType::Audio}));
+
+	// The certificate of the publisher is shared by all applications, so the DTLS sessions can be resumed across them
+	_certificate = certificate;
 	_ice_port = ice_port;
 	_rtc_signalling = rtc_signalling;
 }
@@ -24,10 +24,12 @@ class RtcApplication : public pub::Application
 public:
 	static std::shared_ptr<RtcApplication> Create(const std::shared_ptr<pub::Publisher> &publisher, 
 												  const info::Application &application_info,
+												  const std::shared_ptr<Certificate> &certificate,
 	                                              const std::shared_ptr<IcePort> &ice_port,
 	                                              const std::shared_ptr<RtcSignallingServer> &rtc_signalling);
 	RtcApplication(const std::shared_ptr<pub::Publisher> &publisher,
 				   const info::Application &application_info,
+				   const std::shared_ptr<Certificate> &certificate,
 	               const std::shared_ptr<IcePort> &ice_port,
 	               const std::shared_ptr<RtcSignallingServer> &rtc_signalling);
 	~RtcApplication() final;
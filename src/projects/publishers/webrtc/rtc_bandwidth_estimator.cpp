@@ -0,0 +1,325 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "rtc_bandwidth_estimator.h"
+
+#include <cmath>
+
+#include "rtc_private.h"
+
+// Packets sent within this time are handled as a group
+#define BWE_BURST_TIME_US				5000
+// Trendline filter
+#define BWE_TRENDLINE_WINDOW_SIZE		20
+#define BWE_TRENDLINE_SMOOTHING			0.9
+#define BWE_TRENDLINE_THRESHOLD_GAIN	4.0
+#define BWE_MAX_NUM_OF_DELTAS			60
+// Adaptive threshold
+#define BWE_THRESHOLD_K_UP				0.0087
+#define BWE_THRESHOLD_K_DOWN			0.039
+#define BWE_THRESHOLD_MIN				6.0
+#define BWE_THRESHOLD_MAX				600.0
+#define BWE_OVERUSE_TIME_THRESHOLD_MS	10.0
+// AIMD
+#define BWE_INCREASE_FACTOR				1.08
+#define BWE_DECREASE_FACTOR				0.85
+#define BWE_MIN_BITRATE					30000.0
+#define BWE_MAX_BITRATE					100000000.0
+
+RtcBandwidthEstimator::RtcBandwidthEstimator(uint64_t initial_bitrate)
+	: _estimated_bitrate(std::clamp(static_cast<double>(initial_bitrate), BWE_MIN_BITRATE, BWE_MAX_BITRATE))
+{
+}
+
+void RtcBandwidthEstimator::OnTransportFeedback(const std::vector<PacketResult> &results, int64_t now_us)
+{
+	size_t lost_count = 0;
+
+	for (const auto &result : results)
+	{
+		if (result.received == false)
+		{
+			lost_count++;
+			continue;
+		}
+
+		// Reordered packets are ignored
+		if (_current_group.IsValid() && result.send_time_us < _current_group.first_send_time_us)
+		{
+			continue;
+		}
+
+		if (_current_group.IsValid() == false)
+		{
+			_current_group.first_send_time_us = result.send_time_us;
+		}
+		else if ((result.send_time_us - _current_group.first_send_time_us) > BWE_BURST_TIME_US)
+		{
+			OnPacketGroupCompleted(_current_group);
+
+			_previous_group = _current_group;
+			_current_group = PacketGroup();
+			_current_group.first_send_time_us = result.send_time_us;
+		}
+
+		_current_group.last_send_time_us = std::max(_current_group.last_send_time_us, result.send_time_us);
+		_current_group.last_arrival_time_us = std::max(_current_group.last_arrival_time_us, result.arrival_time_us);
+		_current_group.size += result.size;
+	}
+
+	UpdateAcknowledgedBitrate(results);
+
+	double loss_ratio = results.empty() ? 0.0 : static_cast<double>(lost_count) / static_cast<double>(results.size());
+	UpdateRate(loss_ratio, now_us);
+}
+
+void RtcBandwidthEstimator::OnPacketGroupCompleted(const PacketGroup &group)
+{
+	if (_previous_group.IsValid() == false)
+	{
+		return;
+	}
+
+	double send_delta_ms = static_cast<double>(group.last_send_time_us - _previous_group.last_send_time_us) / 1000.0;
+	double arrival_delta_ms = static_cast<double>(group.last_arrival_time_us - _previous_group.last_arrival_time_us) / 1000.0;
+
+	UpdateTrendline(send_delta_ms, arrival_delta_ms, group.last_arrival_time_us / 1000);
+}
+
+void RtcBandwidthEstimator::UpdateTrendline(double send_delta_ms, double arrival_delta_ms, int64_t arrival_time_ms)
+{
+	double delay_variation_ms = arrival_delta_ms - send_delta_ms;
+
+	_num_of_deltas = std::min<size_t>(_num_of_deltas + 1, BWE_MAX_NUM_OF_DELTAS);
+
+	if (_first_arrival_time_ms < 0)
+	{
+		_first_arrival_time_ms = arrival_time_ms;
+	}
+
+	_accumulated_delay_ms += delay_variation_ms;
+	_smoothed_delay_ms = (BWE_TRENDLINE_SMOOTHING * _smoothed_delay_ms) + ((1.0 - BWE_TRENDLINE_SMOOTHING) * _accumulated_delay_ms);
+
+	_delay_history.emplace_back(static_cast<double>(arrival_time_ms - _first_arrival_time_ms), _smoothed_delay_ms);
+	if (_delay_history.size() > BWE_TRENDLINE_WINDOW_SIZE)
+	{
+		_delay_history.pop_front();
+	}
+
+	if (_delay_history.size() == BWE_TRENDLINE_WINDOW_SIZE)
+	{
+		// Linear regression: the slope of the smoothed delay over the arrival time
+		double sum_x = 0.0, sum_y = 0.0;
+		for (const auto &[x, y] : _delay_history)
+		{
+			sum_x += x;
+			sum_y += y;
+		}
+
+		double average_x = sum_x / _delay_history.size();
+		double average_y = sum_y / _delay_history.size();
+		double numerator = 0.0, denominator = 0.0;
+
+		for (const auto &[x, y] : _delay_history)
+		{
+			numerator += (x - average_x) * (y - average_y);
+			denominator += (x - average_x) * (x - average_x);
+		}
+
+		if (denominator != 0.0)
+		{
+			_trend = numerator / denominator;
+		}
+	}
+
+	Detect(_trend, send_delta_ms, arrival_time_ms);
+}
+
+void RtcBandwidthEstimator::Detect(double trend, double send_delta_ms, int64_t now_ms)
+{
+	if (_num_of_deltas < 2)
+	{
+		_usage = Usage::Normal;
+		return;
+	}
+
+	double modified_trend = _num_of_deltas * trend * BWE_TRENDLINE_THRESHOLD_GAIN;
+
+	if (modified_trend > _threshold)
+	{
+		if (_time_over_using_ms < 0)
+		{
+			// Initialize the timer. Assume that we've been over-using half of the time since the previous sample.
+			_time_over_using_ms = send_delta_ms / 2;
+		}
+		else
+		{
+			_time_over_using_ms += send_delta_ms;
+		}
+
+		_overuse_counter++;
+
+		if ((_time_over_using_ms > BWE_OVERUSE_TIME_THRESHOLD_MS) && (_overuse_counter > 1) && (trend >= _previous_trend))
+		{
+			_time_over_using_ms = 0;
+			_overuse_counter = 0;
+			_usage = Usage::Overusing;
+		}
+	}
+	else if (modified_trend < -_threshold)
+	{
+		_time_over_using_ms = -1;
+		_overuse_counter = 0;
+		_usage = Usage::Underusing;
+	}
+	else
+	{
+		_time_over_using_ms = -1;
+		_overuse_counter = 0;
+		_usage = Usage::Normal;
+	}
+
+	_previous_trend = trend;
+
+	UpdateThreshold(modified_trend, now_ms);
+}
+
+void RtcBandwidthEstimator::UpdateThreshold(double modified_trend, int64_t now_ms)
+{
+	if (_last_threshold_update_ms < 0)
+	{
+		_last_threshold_update_ms = now_ms;
+	}
+
+	// Spikes are not used to update the threshold
+	if (std::fabs(modified_trend) > (_threshold + 15.0))
+	{
+		_last_threshold_update_ms = now_ms;
+		return;
+	}
+
+	double k = (std::fabs(modified_trend) < _threshold) ? BWE_THRESHOLD_K_DOWN : BWE_THRESHOLD_K_UP;
+	int64_t time_delta_ms = std::min<int64_t>(now_ms - _last_threshold_update_ms, 100);
+
+	_threshold += k * (std::fabs(modified_trend) - _threshold) * time_delta_ms;
+	_threshold = std::clamp(_threshold, BWE_THRESHOLD_MIN, BWE_THRESHOLD_MAX);
+
+	_last_threshold_update_ms = now_ms;
+}
+
+void RtcBandwidthEstimator::UpdateAcknowledgedBitrate(const std::vector<PacketResult> &results)
+{
+	int64_t first_arrival_time_us = -1, last_arrival_time_us = -1;
+	size_t received_bytes = 0;
+
+	for (const auto &result : results)
+	{
+		if (result.received == false)
+		{
+			continue;
+		}
+
+		if (first_arrival_time_us < 0 || result.arrival_time_us < first_arrival_time_us)
+		{
+			first_arrival_time_us = result.arrival_time_us;
+		}
+
+		last_arrival_time_us = std::max(last_arrival_time_us, result.arrival_time_us);
+		received_bytes += result.size;
+	}
+
+	// Too short to measure
+	if ((last_arrival_time_us - first_arrival_time_us) < 10000)
+	{
+		return;
+	}
+
+	double bitrate = static_cast<double>(received_bytes * 8) * 1000000.0 / static_cast<double>(last_arrival_time_us - first_arrival_time_us);
+
+	_acknowledged_bitrate = (_acknowledged_bitrate == 0.0) ? bitrate : (0.8 * _acknowledged_bitrate) + (0.2 * bitrate);
+}
+
+void RtcBandwidthEstimator::UpdateRate(double loss_ratio, int64_t now_us)
+{
+	if (_last_rate_update_us < 0)
+	{
+		_last_rate_update_us = now_us;
+	}
+
+	double elapsed_seconds = std::min(static_cast<double>(now_us - _last_rate_update_us) / 1000000.0, 1.0);
+	_last_rate_update_us = now_us;
+
+	// State transition
+	switch (_usage)
+	{
+		case Usage::Overusing:
+			_rate_control_state = RateControlState::Decrease;
+			break;
+
+		case Usage::Underusing:
+			_rate_control_state = RateControlState::Hold;
+			break;
+
+		case Usage::Normal:
+			if (_rate_control_state == RateControlState::Hold)
+			{
+				_rate_control_state = RateControlState::Increase;
+			}
+			break;
+	}
+
+	switch (_rate_control_state)
+	{
+		case RateControlState::Increase:
+			// The loss is too much to increase
+			if (loss_ratio < 0.02)
+			{
+				_estimated_bitrate *= std::pow(BWE_INCREASE_FACTOR, elapsed_seconds);
+
+				// Don't go too far from what is actually received
+				if (_acknowledged_bitrate > 0.0)
+				{
+					_estimated_bitrate = std::min(_estimated_bitrate, (1.5 * _acknowledged_bitrate) + 10000.0);
+				}
+			}
+			break;
+
+		case RateControlState::Decrease:
+			// The decrease is based on what is actually received, so it does not fall repeatedly while the queue is drained
+			_estimated_bitrate = std::min(_estimated_bitrate, BWE_DECREASE_FACTOR * ((_acknowledged_bitrate > 0.0) ? _acknowledged_bitrate : _estimated_bitrate));
+			_rate_control_state = RateControlState::Hold;
+			// The over-use was handled
+			_usage = Usage::Normal;
+			break;
+
+		case RateControlState::Hold:
+			break;
+	}
+
+	// Loss-based control
+	if (loss_ratio > 0.1)
+	{
+		_estimated_bitrate = std::min(_estimated_bitrate, (1.0 - (0.5 * loss_ratio)) * ((_acknowledged_bitrate > 0.0) ? _acknowledged_bitrate : _estimated_bitrate));
+	}
+
+	_estimated_bitrate = std::clamp(_estimated_bitrate, BWE_MIN_BITRATE, BWE_MAX_BITRATE);
+}
+
+uint64_t RtcBandwidthEstimator::GetEstimatedBitrate() const
+{
+	return static_cast<uint64_t>(_estimated_bitrate);
+}
+
+uint64_t RtcBandwidthEstimator::GetAcknowledgedBitrate() const
+{
+	return static_cast<uint64_t>(_acknowledged_bitrate);
+}
+
+RtcBandwidthEstimator::Usage RtcBandwidthEstimator::GetUsage() const
+{
+	return _usage;
+}
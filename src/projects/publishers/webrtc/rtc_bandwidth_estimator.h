@@ -0,0 +1,106 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/ovlibrary/ovlibrary.h>
+
+#include <deque>
+#include <vector>
+
+// Send-side bandwidth estimator with the transport-wide congestion control feedback.
+// It follows the delay-based controller of Google Congestion Control (draft-ietf-rmcat-gcc-02):
+//  - The trend of the one-way delay variation of packet groups is estimated with linear regression (trendline filter)
+//  - Over-use/under-use is detected with an adaptive threshold
+//  - The rate is controlled with AIMD (multiplicative increase, decrease to 85% of the acknowledged bitrate)
+// The loss-based controller reduces the rate when the loss is more than 10%.
+class RtcBandwidthEstimator
+{
+public:
+	struct PacketResult
+	{
+		// Send time of the sender (microseconds)
+		int64_t send_time_us = 0;
+		// Arrival time of the receiver (microseconds, the clock is different from the sender)
+		int64_t arrival_time_us = 0;
+		size_t size = 0;
+		bool received = false;
+	};
+
+	enum class Usage : uint8_t
+	{
+		Normal,
+		Overusing,
+		Underusing
+	};
+
+	RtcBandwidthEstimator(uint64_t initial_bitrate);
+
+	// results: The packets of a feedback in order of the transport-wide sequence number
+	void OnTransportFeedback(const std::vector<PacketResult> &results, int64_t now_us);
+
+	uint64_t GetEstimatedBitrate() const;
+	uint64_t GetAcknowledgedBitrate() const;
+	Usage GetUsage() const;
+
+private:
+	enum class RateControlState : uint8_t
+	{
+		Hold,
+		Increase,
+		Decrease
+	};
+
+	// Packets sent within a burst (5 ms) are handled as a group
+	struct PacketGroup
+	{
+		int64_t first_send_time_us = -1;
+		int64_t last_send_time_us = -1;
+		int64_t last_arrival_time_us = -1;
+		size_t size = 0;
+
+		bool IsValid() const
+		{
+			return first_send_time_us >= 0;
+		}
+	};
+
+	void OnPacketGroupCompleted(const PacketGroup &group);
+	void UpdateTrendline(double send_delta_ms, double arrival_delta_ms, int64_t arrival_time_ms);
+	void Detect(double trend, double send_delta_ms, int64_t now_ms);
+	void UpdateThreshold(double modified_trend, int64_t now_ms);
+
+	void UpdateAcknowledgedBitrate(const std::vector<PacketResult> &results);
+	void UpdateRate(double loss_ratio, int64_t now_us);
+
+	// Delay-based
+	PacketGroup _current_group;
+	PacketGroup _previous_group;
+
+	double _accumulated_delay_ms = 0.0;
+	double _smoothed_delay_ms = 0.0;
+	int64_t _first_arrival_time_ms = -1;
+	size_t _num_of_deltas = 0;
+	// (arrival time, smoothed delay)
+	std::deque<std::pair<double, double>> _delay_history;
+	double _trend = 0.0;
+
+	double _threshold = 12.5;
+	int64_t _last_threshold_update_ms = -1;
+	double _time_over_using_ms = -1.0;
+	int _overuse_counter = 0;
+	double _previous_trend = 0.0;
+	Usage _usage = Usage::Normal;
+
+	// Acknowledged bitrate
+	double _acknowledged_bitrate = 0.0;
+
+	// AIMD
+	RateControlState _rate_control_state = RateControlState::Increase;
+	double _estimated_bitrate = 0.0;
+	int64_t _last_rate_update_us = -1;
+};
@@ -23,6 +23,10 @@ enum class FixedRtcPayloadType : uint8_t
 	H264_RTX_PAYLOAD_TYPE = 99,
 	H265_PAYLOAD_TYPE = 100,
 	H265_RTX_PAYLOAD_TYPE = 101,
+	AV1_PAYLOAD_TYPE = 102,
+	AV1_RTX_PAYLOAD_TYPE = 103,
+	VP9_PAYLOAD_TYPE = 104,
+	VP9_RTX_PAYLOAD_TYPE = 105,
 	OPUS_PAYLOAD_TYPE = 110,
 	RED_PAYLOAD_TYPE = 120,
 	RED_RTX_PAYLOAD_TYPE = 121,
@@ -45,6 +49,14 @@ static cmn::MediaCodecId CodecIdFromPayloadType(FixedRtcPayloadType payload_type
 			return cmn::MediaCodecId::H265;
 		case FixedRtcPayloadType::H265_RTX_PAYLOAD_TYPE:
 			return cmn::MediaCodecId::H265;
+		case FixedRtcPayloadType::AV1_PAYLOAD_TYPE:
+			return cmn::MediaCodecId::Av1;
+		case FixedRtcPayloadType::AV1_RTX_PAYLOAD_TYPE:
+			return cmn::MediaCodecId::Av1;
+		case FixedRtcPayloadType::VP9_PAYLOAD_TYPE:
+			return cmn::MediaCodecId::Vp9;
+		case FixedRtcPayloadType::VP9_RTX_PAYLOAD_TYPE:
+			return cmn::MediaCodecId::Vp9;
 		case FixedRtcPayloadType::OPUS_PAYLOAD_TYPE:	
 			return cmn::MediaCodecId::Opus;
 		default:
@@ -74,6 +86,12 @@ static uint8_t PayloadTypeFromCodecId(cmn::MediaCodecId codec_id)
 		case cmn::MediaCodecId::H265: 
 			payload_type = static_cast<uint8_t>(FixedRtcPayloadType::H265_PAYLOAD_TYPE);
 			break;
+		case cmn::MediaCodecId::Av1:
+			payload_type = static_cast<uint8_t>(FixedRtcPayloadType::AV1_PAYLOAD_TYPE);
+			break;
+		case cmn::MediaCodecId::Vp9:
+			payload_type = static_cast<uint8_t>(FixedRtcPayloadType::VP9_PAYLOAD_TYPE);
+			break;
 		case cmn::MediaCodecId::Opus:
 			payload_type = static_cast<uint8_t>(FixedRtcPayloadType::OPUS_PAYLOAD_TYPE);
 			break;
@@ -100,6 +118,12 @@ static uint8_t RtxPayloadTypeFromCodecId(cmn::MediaCodecId codec_id)
 		case cmn::MediaCodecId::H265:
 			payload_type = static_cast<uint8_t>(FixedRtcPayloadType::H265_RTX_PAYLOAD_TYPE);
 			break;
+		case cmn::MediaCodecId::Av1:
+			payload_type = static_cast<uint8_t>(FixedRtcPayloadType::AV1_RTX_PAYLOAD_TYPE);
+			break;
+		case cmn::MediaCodecId::Vp9:
+			payload_type = static_cast<uint8_t>(FixedRtcPayloadType::VP9_RTX_PAYLOAD_TYPE);
+			break;
 		default:
 			// No support codecs
 			return 0;
@@ -0,0 +1,114 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "rtc_pacer.h"
+
+#include "rtc_private.h"
+
+// The budget is not accumulated more than this time, to avoid a burst after idle
+#define PACER_MAX_BUDGET_TIME_US	10000
+// The queue is drained within this time even if the pacing bitrate is lower
+#define PACER_MAX_QUEUE_TIME_US		250000
+
+void RtcPacer::SetPacingBitrate(uint64_t bitrate)
+{
+	_pacing_bitrate = bitrate;
+}
+
+uint64_t RtcPacer::GetPacingBitrate() const
+{
+	return _pacing_bitrate;
+}
+
+void RtcPacer::Enqueue(const std::shared_ptr<RtpPacket> &packet)
+{
+	if (_queue.empty())
+	{
+		// Start over, the budget of the idle time is not used
+		_last_refill_time_us = -1;
+	}
+
+	_queued_bytes += packet->GetData()->GetLength();
+	_queue.push_back({packet, static_cast<int64_t>(ov::Clock::NowUSec())});
+}
+
+std::shared_ptr<RtpPacket> RtcPacer::Dequeue(int64_t *queueing_delay_us)
+{
+	if (_queue.empty())
+	{
+		return nullptr;
+	}
+
+	// The pacing bitrate is unknown, so the packets are not paced
+	if (_pacing_bitrate != 0)
+	{
+		RefillBudget();
+
+		if (_budget_bytes <= 0)
+		{
+			return nullptr;
+		}
+	}
+
+	auto queued_packet = std::move(_queue.front());
+	_queue.pop_front();
+
+	auto length = queued_packet.packet->GetData()->GetLength();
+	_queued_bytes -= length;
+
+	if (_pacing_bitrate != 0)
+	{
+		_budget_bytes -= length;
+	}
+
+	if (queueing_delay_us != nullptr)
+	{
+		*queueing_delay_us = ov::Clock::NowUSec() - queued_packet.enqueued_time_us;
+	}
+
+	return queued_packet.packet;
+}
+
+bool RtcPacer::IsEmpty() const
+{
+	return _queue.empty();
+}
+
+size_t RtcPacer::GetQueuedBytes() const
+{
+	return _queued_bytes;
+}
+
+void RtcPacer::RefillBudget()
+{
+	auto now_us = ov::Clock::NowUSec();
+
+	if (_last_refill_time_us < 0)
+	{
+		// A packet can be sent immediately
+		_last_refill_time_us = now_us;
+		_budget_bytes = std::max<int64_t>(_budget_bytes, 1);
+		return;
+	}
+
+	int64_t elapsed_us = std::min<int64_t>(now_us - _last_refill_time_us, PACER_MAX_BUDGET_TIME_US);
+	if (elapsed_us <= 0)
+	{
+		return;
+	}
+
+	_last_refill_time_us = now_us;
+
+	// If too many packets are queued, the pacing bitrate is increased to drain the queue in time
+	uint64_t drain_bitrate = static_cast<uint64_t>(_queued_bytes * 8) * 1000000 / PACER_MAX_QUEUE_TIME_US;
+	uint64_t bitrate = std::max(_pacing_bitrate, drain_bitrate);
+
+	int64_t max_budget_bytes = static_cast<int64_t>(bitrate * PACER_MAX_BUDGET_TIME_US / 8 / 1000000);
+
+	_budget_bytes += static_cast<int64_t>(bitrate * elapsed_us / 8 / 1000000);
+	_budget_bytes = std::min(_budget_bytes, std::max<int64_t>(max_budget_bytes, 1));
+}
@@ -0,0 +1,50 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/ovlibrary/ovlibrary.h>
+#include <modules/rtp_rtcp/rtp_packet.h>
+
+#include <deque>
+
+// Leaky bucket pacer of a session.
+// The packets of a video frame are generated at once, so sending them in a burst fills the queue of the bottleneck link
+// and it is seen as the congestion. The pacer spreads the packets at the pacing bitrate.
+// It is not thread-safe, the caller must protect it.
+class RtcPacer
+{
+public:
+	// 0 means the packets are not paced
+	void SetPacingBitrate(uint64_t bitrate);
+	uint64_t GetPacingBitrate() const;
+
+	void Enqueue(const std::shared_ptr<RtpPacket> &packet);
+	// Returns nullptr if the queue is empty or the budget is exhausted.
+	// queueing_delay_us: time that the packet has waited in the queue
+	std::shared_ptr<RtpPacket> Dequeue(int64_t *queueing_delay_us = nullptr);
+
+	bool IsEmpty() const;
+	size_t GetQueuedBytes() const;
+
+private:
+	void RefillBudget();
+
+	struct QueuedPacket
+	{
+		std::shared_ptr<RtpPacket> packet;
+		int64_t enqueued_time_us = 0;
+	};
+
+	std::deque<QueuedPacket> _queue;
+	size_t _queued_bytes = 0;
+
+	uint64_t _pacing_bitrate = 0;
+	// Bytes that can be sent now (it may be negative when a large packet is sent)
+	int64_t _budget_bytes = 0;
+	int64_t _last_refill_time_us = -1;
+};
@@ -161,6 +161,14 @@ bool RtcSession::Start()
 	_current_rendition = _playlist->GetFirstRendition();
 	RecordAutoSelectedRendition(_current_rendition, true);
 
+	_pacing_enabled = std::static_pointer_cast<RtcStream>(GetStream())->IsPacingEnabled();
+	_interactive = std::static_pointer_cast<RtcStream>(GetStream())->IsInteractive();
+	// No video is negotiated (e.g. an audio-only stream such as a radio)
+	_audio_only = (_video_payload_type == 0);
+
+	auto initial_bitrate = _current_rendition->GetBitrates();
+	_bandwidth_estimator = std::make_shared<RtcBandwidthEstimator>(initial_bitrate > 0 ? initial_bitrate : RTC_SESSION_INITIAL_ESTIMATED_BITRATE);
+
 	auto current_video_track = _current_rendition->GetVideoTrack();
 	auto current_audio_track = _current_rendition->GetAudioTrack();
 
@@ -191,6 +199,7 @@ bool RtcSession::Start()
 
 	_abr_test_watch.Start();
 	_bitrate_estimate_watch.Start();
+	_temporal_layer_loss_free_watch.Start();
 
 	return Session::Start();
 }
@@ -259,7 +268,7 @@ bool RtcSession::RequestChangeRendition(const ov::String &rendition_name)
 		return false;
 	}
 
-	std::lock_guard<std::shared_mutex> lock(_change_rendition_lock);
+	std::unique_lock<std::shared_mutex> lock(_change_rendition_lock);
 
 	if (rendition == _current_rendition)
 	{
@@ -269,12 +278,16 @@ bool RtcSession::RequestChangeRendition(const ov::String &rendition_name)
 
 	_next_rendition = rendition;
 
+	lock.unlock();
+
+	RequestKeyFrameOfRendition(rendition);
+
 	return true;
 }
 
 bool RtcSession::RequestChangeRendition(SwitchOver switch_over)
 {
-	std::lock_guard<std::shared_mutex> lock(_change_rendition_lock);
+	std::unique_lock<std::shared_mutex> lock(_change_rendition_lock);
 
 	// Changing
 	if (_next_rendition != nullptr)
@@ -299,11 +312,32 @@ bool RtcSession::RequestChangeRendition(SwitchOver switch_over)
 		_estimated_bitrates, _current_rendition->GetName().CStr(), _current_rendition->GetBitrates(), next_rendition->GetName().CStr(), next_rendition->GetBitrates());
 
 		_next_rendition = next_rendition;
+
+		lock.unlock();
+
+		RequestKeyFrameOfRendition(next_rendition);
 	}
 
 	return true;
 }
 
+void RtcSession::RequestKeyFrameOfRendition(const std::shared_ptr<const RtcRendition> &rendition)
+{
+	auto video_track = rendition->GetVideoTrack();
+	if (video_track == nullptr)
+	{
+		// Audio only rendition is changed immediately
+		return;
+	}
+
+	// The rendition is changed at its next keyframe (see IsSelectedPacket()), so the transcoder makes one now
+	// instead of waiting for the end of the GOP. If the track is not encoded (bypassed), the next keyframe of the source is used.
+	if (GetStream()->RequestKeyFrame(video_track->GetId()) == false)
+	{
+		logtd("Could not request a keyframe of the rendition (%s), it is changed at the next keyframe", rendition->GetName().CStr());
+	}
+}
+
 bool RtcSession::SetAutoAbr(bool auto_abr)
 {
 	_auto_abr = auto_abr;
@@ -313,6 +347,12 @@ bool RtcSession::SetAutoAbr(bool auto_abr)
 
 bool RtcSession::SendPlaylistInfo(const std::shared_ptr<const RtcPlaylist> &playlist) const
 {
+	if (_ws_session == nullptr)
+	{
+		// WHEP session has no signalling channel for the notifications
+		return false;
+	}
+
 	auto ws_response = std::static_pointer_cast<http::svr::ws::WebSocketResponse>(_ws_session->GetResponse());
 	if(ws_response == nullptr)
 	{
@@ -333,6 +373,12 @@ bool RtcSession::SendPlaylistInfo(const std::shared_ptr<const RtcPlaylist> &play
 
 bool RtcSession::SendRenditionChanged(const std::shared_ptr<const RtcRendition> &rendition) const
 {
+	if (_ws_session == nullptr)
+	{
+		// WHEP session has no signalling channel for the notifications
+		return false;
+	}
+
 	auto ws_response = std::static_pointer_cast<http::svr::ws::WebSocketResponse>(_ws_session->GetResponse());
 	if(ws_response == nullptr)
 	{
@@ -402,6 +448,10 @@ void RtcSession::ChangeRendition()
 	_current_rendition = _next_rendition;
 	_next_rendition = nullptr;
 
+	// The temporal layers are selected again with the bitrate of the new rendition
+	_max_temporal_layer_id = RTC_SESSION_ALL_TEMPORAL_LAYERS;
+	_next_max_temporal_layer_id = RTC_SESSION_ALL_TEMPORAL_LAYERS;
+
 	lock.unlock();
 
 	SendRenditionChanged(_current_rendition);
@@ -424,7 +474,7 @@ uint8_t RtcSession::GetOriginPayloadTypeFromRedRtpPacket(const std::shared_ptr<c
 	return rtp_payload_type;
 }
 
-bool RtcSession::IsSelectedPacket(const std::shared_ptr<const RtpPacket> &rtp_packet)
+bool RtcSession::IsSelectedPacket(const std::shared_ptr<RtpPacket> &rtp_packet)
 {
 	std::shared_lock<std::shared_mutex> change_lock(_change_rendition_lock);
 	auto next_rendition = _next_rendition;
@@ -457,6 +507,20 @@ bool RtcSession::IsSelectedPacket(const std::shared_ptr<const RtpPacket> &rtp_pa
 		return false;
 	}
 
+	if (rtp_packet->IsVideoPacket())
+	{
+		// Change the temporal layer at the first packet of the base layer frame
+		if (rtp_packet->GetTemporalLayerId() == 0 && rtp_packet->IsFirstPacketOfFrame())
+		{
+			_max_temporal_layer_id = _next_max_temporal_layer_id.load();
+		}
+
+		if (rtp_packet->GetTemporalLayerId() > _max_temporal_layer_id)
+		{
+			return false;
+		}
+	}
+
 	uint32_t rtp_payload_type = rtp_packet->PayloadType(); 
 
 	if(rtp_payload_type == _audio_payload_type || 
@@ -471,7 +535,7 @@ bool RtcSession::IsSelectedPacket(const std::shared_ptr<const RtpPacket> &rtp_pa
 	return false;
 }
 
-void RtcSession::SendOutgoingData(const std::any &packet)
+void RtcSession::SendOutgoingPackets(const pub::PacketBatch<RtpPacket> &packets)
 {
 	// ABR Test Codes
 	// if (_changed == false && _abr_test_watch.IsElapsed(5000))
@@ -501,60 +565,167 @@ void RtcSession::SendOutgoingData(const std::any &packet)
 		return;
 	}
 
-	std::shared_ptr<RtpPacket> session_packet;
+	size_t sent_bytes = 0;
+	bool has_paced_packets = false;
 
-	try 
 	{
-        session_packet = std::any_cast<std::shared_ptr<RtpPacket>>(packet);
-		if(session_packet == nullptr)
+		std::lock_guard<std::mutex> pacer_lock(_pacer_lock);
+
+		for (const auto &session_packet : packets)
 		{
-			return;
+			// Check the packet is selected.
+			if (session_packet == nullptr || IsSelectedPacket(session_packet) == false)
+			{
+				continue;
+			}
+
+			if (_audio_only == true)
+			{
+				// Nothing is paced
+				sent_bytes += SendRtpPacket(session_packet);
+				continue;
+			}
+
+			// Audio packets are small and sensitive to the delay, so they are not paced.
+			// In the interactive mode, only a key frame is large enough to be lost in a burst,
+			// and the packets queued before are sent first to keep the order.
+			if (_pacing_enabled == true && session_packet->IsVideoPacket() == true &&
+				(_interactive == false || session_packet->IsKeyframe() == true || _pacer.IsEmpty() == false))
+			{
+				_pacer.Enqueue(session_packet);
+			}
+			else
+			{
+				sent_bytes += SendRtpPacket(session_packet);
+			}
 		}
-    }
-    catch(const std::bad_any_cast& e) 
+
+		sent_bytes += DrainPacer();
+		has_paced_packets = (_pacer.IsEmpty() == false);
+	}
+
+	if (sent_bytes > 0)
 	{
-        logtd("An incorrect type of packet was input from the stream.");
-		return;
-    }
+		MonitorInstance->IncreaseBytesOut(*GetStream(), PublisherType::Webrtc, sent_bytes);
+	}
 
-	// Check the packet is selected.
-	if (IsSelectedPacket(session_packet) == false)
+	// The rest is sent by the pacing timer of the publisher
+	if (has_paced_packets == true)
 	{
-		return;
+		_publisher->RequestPacing(pub::Session::GetSharedPtrAs<RtcSession>());
 	}
+}
 
-	// RTP Session must be copied and sent because data is altered due to SRTP.
-	auto copy_packet = std::make_shared<RtpPacket>(*session_packet);
+bool RtcSession::SendPacedPackets()
+{
+	std::shared_lock<std::shared_mutex> lock(_start_stop_lock);
 
-	if (copy_packet->IsVideoPacket())
+	if (pub::Session::GetState() != SessionState::Started)
 	{
-		copy_packet->SetSequenceNumber(_video_rtp_sequence_number++);
+		return false;
 	}
-	else
+
+	size_t sent_bytes = 0;
+	bool has_paced_packets = false;
+
+	{
+		std::lock_guard<std::mutex> pacer_lock(_pacer_lock);
+
+		sent_bytes = DrainPacer();
+		has_paced_packets = (_pacer.IsEmpty() == false);
+	}
+
+	if (sent_bytes > 0)
+	{
+		MonitorInstance->IncreaseBytesOut(*GetStream(), PublisherType::Webrtc, sent_bytes);
+	}
+
+	return has_paced_packets;
+}
+
+size_t RtcSession::DrainPacer()
+{
+	if (_pacer.IsEmpty())
+	{
+		return 0;
+	}
+
+	_pacer.SetPacingBitrate(GetPacingBitrate());
+
+	size_t sent_bytes = 0;
+
+	while (true)
 	{
-		copy_packet->SetSequenceNumber(_audio_rtp_sequence_number++);
+		int64_t queueing_delay_us = 0;
+		auto session_packet = _pacer.Dequeue(&queueing_delay_us);
+		if (session_packet == nullptr)
+		{
+			break;
+		}
+
+		if ((session_packet->IsFirstPacketOfFrame() == true) && ((_paced_frame_count++ % MEDIA_PACKET_TRACE_SAMPLING_INTERVAL) == 0))
+		{
+			auto stream_metrics = StreamMetrics(*GetStream());
+			if (stream_metrics != nullptr)
+			{
+				stream_metrics->GetLatencyMetrics()->RecordBufferingDelay(mon::BufferingStage::Pacer, queueing_delay_us);
+			}
+		}
+
+		sent_bytes += SendRtpPacket(session_packet);
 	}
 
+	return sent_bytes;
+}
+
+uint64_t RtcSession::GetPacingBitrate()
+{
+	std::shared_lock<std::shared_mutex> change_lock(_change_rendition_lock);
+	auto rendition_bitrates = _current_rendition->GetBitrates();
+	change_lock.unlock();
+
+	// 0 means unknown, then the packets are not paced
+	return static_cast<uint64_t>(RTC_SESSION_PACING_FACTOR * std::max(_estimated_bitrates, static_cast<double>(rendition_bitrates)));
+}
+
+size_t RtcSession::SendRtpPacket(const std::shared_ptr<RtpPacket> &session_packet)
+{
+	// The packet is shared by all sessions of the stream, and the data is altered due to SRTP.
+	// So only the serialized packet is copied (into a pooled buffer) and the header fields of the session
+	// are rewritten in the copy, instead of cloning the RtpPacket instance.
+	auto source_data = session_packet->GetData();
+	auto data = std::make_shared<ov::Data>(std::max(source_data->GetCapacity(), source_data->GetLength()));
+	data->Append(source_data.get());
+
+	auto buffer = data->GetWritableDataAs<uint8_t>();
+	uint16_t sequence_number = session_packet->IsVideoPacket() ? _video_rtp_sequence_number++ : _audio_rtp_sequence_number++;
+
+	ByteWriter<uint16_t>::WriteBigEndian(&buffer[2], sequence_number);
+
 	// Set transport-wide sequence number
-	SetTransportWideSequenceNumber(copy_packet, _wide_sequence_number);
-	SetAbsSendTime(copy_packet, ov::Clock::NowMSec());
+	auto has_wide_sequence_number = SetTransportWideSequenceNumber(session_packet, buffer, _wide_sequence_number);
+	SetAbsSendTime(session_packet, buffer, ov::Clock::NowMSec());
 
 	// rtp_rtcp -> srtp -> dtls -> Edge Node(RtcSession)
 
 	// Packet loss simulation codes
 	// if (ov::Random::GenerateUInt32(1, 33) != 10)
 	{
-		_rtp_rtcp->SendRtpPacket(copy_packet);
+		_rtp_rtcp->SendRtpPacket(session_packet, data);
 	}
 
-	RecordRtpSent(copy_packet, session_packet->SequenceNumber(), _wide_sequence_number);
+	// The audio packets are not retransmitted, so they are recorded only for the feedback of transport-cc
+	if (session_packet->IsVideoPacket() || has_wide_sequence_number)
+	{
+		RecordRtpSent(session_packet, sequence_number, session_packet->SequenceNumber(), has_wide_sequence_number, _wide_sequence_number, data->GetLength());
+	}
 
 	_wide_sequence_number ++;
 
-	MonitorInstance->IncreaseBytesOut(*GetStream(), PublisherType::Webrtc, copy_packet->GetData()->GetLength());
+	return data->GetLength();
 }
 
-bool RtcSession::SetTransportWideSequenceNumber(const std::shared_ptr<RtpPacket> &rtp_packet, uint16_t wide_sequence_number)
+bool RtcSession::SetTransportWideSequenceNumber(const std::shared_ptr<const RtpPacket> &rtp_packet, uint8_t *buffer, uint16_t wide_sequence_number)
 {
 	auto extension_buffer = rtp_packet->Extension(RTP_HEADER_EXTENSION_TRANSPORT_CC_ID);
 	if (extension_buffer == nullptr)
@@ -563,13 +734,14 @@ bool RtcSession::SetTransportWideSequenceNumber(const std::shared_ptr<RtpPacket>
 	}
 
 	auto payload_offset = rtp_packet->GetExtensionType() == RtpHeaderExtension::HeaderType::ONE_BYTE_HEADER ? 1 : 2;
-	
-	ByteWriter<uint16_t>::WriteBigEndian(extension_buffer + payload_offset, wide_sequence_number);
+	auto extension_offset = extension_buffer - rtp_packet->Buffer();
+
+	ByteWriter<uint16_t>::WriteBigEndian(buffer + extension_offset + payload_offset, wide_sequence_number);
 
 	return true;
 }
 
-bool RtcSession::SetAbsSendTime(const std::shared_ptr<RtpPacket> &rtp_packet, uint64_t time_ms)
+bool RtcSession::SetAbsSendTime(const std::shared_ptr<const RtpPacket> &rtp_packet, uint8_t *buffer, uint64_t time_ms)
 {
 	auto extension_buffer = rtp_packet->Extension(RTP_HEADER_EXTENSION_ABS_SEND_TIME_ID);
 	if (extension_buffer == nullptr)
@@ -578,74 +750,105 @@ bool RtcSession::SetAbsSendTime(const std::shared_ptr<RtpPacket> &rtp_packet, ui
 	}
 
 	auto payload_offset = rtp_packet->GetExtensionType() == RtpHeaderExtension::HeaderType::ONE_BYTE_HEADER ? 1 : 2;
+	auto extension_offset = extension_buffer - rtp_packet->Buffer();
 
 	auto abs_send_time = RtpHeaderExtensionAbsSendTime::MsToAbsSendTime(time_ms);
-	ByteWriter<uint24_t>::WriteBigEndian(extension_buffer + payload_offset, abs_send_time);
+	ByteWriter<uint24_t>::WriteBigEndian(buffer + extension_offset + payload_offset, abs_send_time);
 
 	return true;
 }
 
-bool RtcSession::RecordRtpSent(const std::shared_ptr<const RtpPacket> &rtp_packet, uint16_t origin_sequence_number, uint16_t wide_sequence_number)
+void RtcSession::RecordRtpSent(const std::shared_ptr<const RtpPacket> &rtp_packet, uint16_t sequence_number, uint16_t origin_sequence_number, bool has_wide_sequence_number, uint16_t wide_sequence_number, size_t sent_bytes)
 {
-	if (rtp_packet == nullptr)
+	auto now = std::chrono::system_clock::now();
+
+	std::lock_guard<std::shared_mutex> lock(_rtp_record_map_lock);
+
+	if (rtp_packet->IsVideoPacket())
 	{
-		return false;
+		if (_video_rtp_sent_logs.empty())
+		{
+			_video_rtp_sent_logs.resize(MAX_RTP_RECORDS);
+		}
+
+		auto &sent_log = _video_rtp_sent_logs[sequence_number % MAX_RTP_RECORDS];
+		sent_log._sequence_number = sequence_number;
+		sent_log._origin_sequence_number = origin_sequence_number;
+		sent_log._track_id = rtp_packet->GetTrackId();
+		sent_log._payload_type = rtp_packet->PayloadType();
+		sent_log._sent_time = now;
+		sent_log._retransmitted_time = {};
 	}
 
-	auto sent_log = std::make_shared<RtpSentLog>();
-	sent_log->_sequence_number = rtp_packet->SequenceNumber();
-	sent_log->_wide_sequence_number = wide_sequence_number;
-	sent_log->_track_id = rtp_packet->GetTrackId();
-	sent_log->_payload_type = rtp_packet->PayloadType();
-	sent_log->_origin_sequence_number = origin_sequence_number;
-	sent_log->_timestamp = rtp_packet->Timestamp();
-	sent_log->_marker = rtp_packet->Marker();
-	sent_log->_ssrc = rtp_packet->Ssrc();
+	if (has_wide_sequence_number)
+	{
+		if (_wide_rtp_sent_logs.empty())
+		{
+			_wide_rtp_sent_logs.resize(MAX_RTP_RECORDS);
+		}
 
-	sent_log->_sent_bytes = rtp_packet->GetData()->GetLength();
-	sent_log->_sent_time = std::chrono::system_clock::now();
+		auto &sent_log = _wide_rtp_sent_logs[wide_sequence_number % MAX_RTP_RECORDS];
+		sent_log._wide_sequence_number = wide_sequence_number;
+		sent_log._sent_bytes = static_cast<uint32_t>(sent_bytes);
+		sent_log._sent_time = now;
+	}
+}
 
-	auto video_rtp_key = sent_log->_sequence_number % MAX_RTP_RECORDS;
-	auto wide_rtp_key = sent_log->_wide_sequence_number % MAX_RTP_RECORDS;
+bool RtcSession::TraceRtpSentByVideoSeqNo(uint16_t sequence_number, RtpSentLog &sent_log)
+{
+	std::shared_lock<std::shared_mutex> lock(_rtp_record_map_lock);
 
-	std::lock_guard<std::shared_mutex> lock(_rtp_record_map_lock);
+	if (_video_rtp_sent_logs.empty())
+	{
+		return false;
+	}
 
-	if (rtp_packet->IsVideoPacket())
+	const auto &slot = _video_rtp_sent_logs[sequence_number % MAX_RTP_RECORDS];
+	if (slot._sent_time.time_since_epoch().count() == 0 || slot._sequence_number != sequence_number)
 	{
-		_video_rtp_sent_record_map[video_rtp_key] = sent_log;
+		return false;
 	}
-	_wide_rtp_sent_record_map[wide_rtp_key] = sent_log;
+
+	sent_log = slot;
 
 	return true;
 }
 
-std::shared_ptr<RtcSession::RtpSentLog> RtcSession::TraceRtpSentByVideoSeqNo(uint16_t sequence_number)
+// Get RTP Sent Log from RTP History
+bool RtcSession::TraceRtpSentByWideSeqNo(uint16_t wide_sequence_number, WideRtpSentLog &sent_log)
 {
 	std::shared_lock<std::shared_mutex> lock(_rtp_record_map_lock);
 
-	auto key = sequence_number % MAX_RTP_RECORDS;
-	auto it = _video_rtp_sent_record_map.find(key);
-	if (it == _video_rtp_sent_record_map.end())
+	if (_wide_rtp_sent_logs.empty())
 	{
-		return nullptr;
+		return false;
 	}
 
-	return it->second;
+	const auto &slot = _wide_rtp_sent_logs[wide_sequence_number % MAX_RTP_RECORDS];
+	if (slot._sent_time.time_since_epoch().count() == 0 || slot._wide_sequence_number != wide_sequence_number)
+	{
+		return false;
+	}
+
+	sent_log = slot;
+
+	return true;
 }
 
-// Get RTP Sent Log from RTP History
-std::shared_ptr<RtcSession::RtpSentLog> RtcSession::TraceRtpSentByWideSeqNo(uint16_t wide_sequence_number)
+void RtcSession::SetRtpRetransmittedTime(uint16_t sequence_number, const std::chrono::system_clock::time_point &time)
 {
-	std::shared_lock<std::shared_mutex> lock(_rtp_record_map_lock);
+	std::lock_guard<std::shared_mutex> lock(_rtp_record_map_lock);
 
-	auto key = wide_sequence_number % MAX_RTP_RECORDS;
-	auto it = _wide_rtp_sent_record_map.find(key);
-	if (it == _wide_rtp_sent_record_map.end())
+	if (_video_rtp_sent_logs.empty())
 	{
-		return nullptr;
+		return;
 	}
 
-	return it->second;
+	auto &slot = _video_rtp_sent_logs[sequence_number % MAX_RTP_RECORDS];
+	if (slot._sequence_number == sequence_number)
+	{
+		slot._retransmitted_time = time;
+	}
 }
 
 void RtcSession::OnRtpFrameReceived(const std::vector<std::shared_ptr<RtpPacket>> &rtp_packets)
@@ -690,6 +893,33 @@ void RtcSession::OnRtcpReceived(const std::shared_ptr<RtcpInfo> &rtcp_info)
 	//rtcp_info->DebugPrint();
 }
 
+void RtcSession::OnRtcpCompoundReceived()
+{
+	if (_pending_rtx_packets.empty())
+	{
+		return;
+	}
+
+	std::vector<std::shared_ptr<RtpPacket>> rtx_packets;
+	rtx_packets.swap(_pending_rtx_packets);
+
+	if (pub::Session::GetState() != SessionState::Started)
+	{
+		return;
+	}
+
+	size_t sent_bytes = 0;
+	for (const auto &rtx_packet : rtx_packets)
+	{
+		sent_bytes += rtx_packet->GetData()->GetLength();
+	}
+
+	if (_rtp_rtcp->SendRtpPackets(rtx_packets) == true)
+	{
+		MonitorInstance->IncreaseBytesOut(*GetStream(), PublisherType::Webrtc, sent_bytes);
+	}
+}
+
 bool RtcSession::ProcessReceiverReport(const std::shared_ptr<RtcpInfo> &rtcp_info)
 {
 	auto rr = std::static_pointer_cast<ReceiverReport>(rtcp_info);
@@ -701,6 +931,33 @@ bool RtcSession::ProcessReceiverReport(const std::shared_ptr<RtcpInfo> &rtcp_inf
 
 	//rr->DebugPrint();
 
+	for (size_t i = 0; i < rr->GetReportBlockCount(); i++)
+	{
+		auto report_block = rr->GetReportBlock(i);
+		if (report_block == nullptr)
+		{
+			continue;
+		}
+
+		if (report_block->GetLastSr() != 0 && (report_block->GetSrcSsrc() == _video_ssrc || report_block->GetSrcSsrc() == _audio_ssrc))
+		{
+			// RTT = now - LSR - DLSR (the middle 32 bits of NTP, in units of 1/65536 seconds)
+			uint32_t ntp_msw = 0, ntp_lsw = 0;
+			ov::Clock::GetNtpTime(ntp_msw, ntp_lsw);
+			uint32_t elapsed_since_sr = ((ntp_msw << 16) | (ntp_lsw >> 16)) - report_block->GetLastSr();
+
+			if (elapsed_since_sr >= report_block->GetDelaySinceLastSr())
+			{
+				_rtt_ms = (static_cast<int64_t>(elapsed_since_sr - report_block->GetDelaySinceLastSr()) * 1000) >> 16;
+			}
+		}
+
+		if (report_block->GetSrcSsrc() == _video_ssrc)
+		{
+			ChangeTemporalLayerByLoss(report_block->GetFractionLost());
+		}
+	}
+
 	return true;
 }
 
@@ -723,31 +980,90 @@ bool RtcSession::ProcessNACK(const std::shared_ptr<RtcpInfo> &rtcp_info)
 		return false;
 	}
 
+	auto now = std::chrono::system_clock::now();
+	// If the RTT is not measured yet, only the packets that are already too old are skipped
+	auto rtt_ms = std::max<int64_t>(_rtt_ms, 0);
+
 	// Retransmission
 	for(size_t i=0; i<nack->GetLostIdCount(); i++)
 	{
 		auto seq_no = nack->GetLostId(i);
-		auto sent_log = TraceRtpSentByVideoSeqNo(seq_no);
-		if (sent_log == nullptr)
+		RtpSentLog sent_log;
+		if (TraceRtpSentByVideoSeqNo(seq_no, sent_log) == false)
 		{
 			continue;
 		}
 
-		logtd("RTX requested(%d) - TrackID(%u) PayloadType(%d) OriginSeqNo(%u)", seq_no, sent_log->_track_id, sent_log->_payload_type, sent_log->_origin_sequence_number);
+		// The retransmitted packet arrives after about half of the RTT
+		auto elapsed_ms = std::chrono::duration_cast<std::chrono::milliseconds>(now - sent_log._sent_time).count();
+		if (elapsed_ms + (rtt_ms / 2) > RTC_SESSION_RTX_PLAYOUT_DEADLINE_MS)
+		{
+			logtd("RTX skipped(%d) - Too late to be played (elapsed: %" PRId64 " ms, rtt: %" PRId64 " ms)", seq_no, static_cast<int64_t>(elapsed_ms), rtt_ms);
+			continue;
+		}
 
-		auto rtx_packet = stream->GetRtxRtpPacket(sent_log->_track_id, sent_log->_payload_type, sent_log->_origin_sequence_number);
-		if(rtx_packet != nullptr)
+		// The previous retransmission may be still on the way
+		if (sent_log._retransmitted_time.time_since_epoch().count() != 0 &&
+			std::chrono::duration_cast<std::chrono::milliseconds>(now - sent_log._retransmitted_time).count() < rtt_ms)
 		{
-			auto copy_rtx_packet = std::make_shared<RtxRtpPacket>(*rtx_packet);
-			copy_rtx_packet->SetSequenceNumber(_rtx_sequence_number++);
-			copy_rtx_packet->SetOriginalSequenceNumber(sent_log->_sequence_number);
-			return _rtp_rtcp->SendRtpPacket(copy_rtx_packet);
+			continue;
 		}
+
+		logtd("RTX requested(%d) - TrackID(%u) PayloadType(%d) OriginSeqNo(%u)", seq_no, sent_log._track_id, sent_log._payload_type, sent_log._origin_sequence_number);
+
+		auto rtx_packet = stream->GetRtxRtpPacket(sent_log._track_id, sent_log._payload_type, sent_log._origin_sequence_number);
+		if(rtx_packet == nullptr)
+		{
+			continue;
+		}
+
+		// Under burst loss, the retransmissions must not starve the media of this session and the other sessions
+		if (ConsumeRtxBudget(rtx_packet->GetData()->GetLength()) == false)
+		{
+			logtd("RTX skipped(%d) - Retransmission budget exhausted", seq_no);
+			break;
+		}
+
+		// The RTX packet is created for this request, so it can be modified without copying
+		rtx_packet->SetSequenceNumber(_rtx_sequence_number++);
+		rtx_packet->SetOriginalSequenceNumber(sent_log._sequence_number);
+		SetRtpRetransmittedTime(seq_no, now);
+
+		_pending_rtx_packets.push_back(rtx_packet);
 	}
 
 	return true;
 }
 
+bool RtcSession::ConsumeRtxBudget(size_t bytes)
+{
+	auto now_us = static_cast<int64_t>(ov::Clock::NowUSec());
+	auto bitrate = (_estimated_bitrates > 0) ? _estimated_bitrates : static_cast<double>(RTC_SESSION_INITIAL_ESTIMATED_BITRATE);
+	auto budget_bytes_per_sec = bitrate * RTC_SESSION_RTX_BUDGET_PERCENT / 100.0 / 8.0;
+	auto max_budget_bytes = static_cast<int64_t>(budget_bytes_per_sec * RTC_SESSION_RTX_BUDGET_WINDOW_MS / 1000.0);
+
+	if (_rtx_budget_refill_time_us < 0)
+	{
+		_rtx_budget_bytes = max_budget_bytes;
+	}
+	else
+	{
+		_rtx_budget_bytes += static_cast<int64_t>(budget_bytes_per_sec * (now_us - _rtx_budget_refill_time_us) / 1000000.0);
+		_rtx_budget_bytes = std::min(_rtx_budget_bytes, max_budget_bytes);
+	}
+
+	_rtx_budget_refill_time_us = now_us;
+
+	if (_rtx_budget_bytes <= 0)
+	{
+		return false;
+	}
+
+	_rtx_budget_bytes -= static_cast<int64_t>(bytes);
+
+	return true;
+}
+
 bool RtcSession::ProcessTransportCc(const std::shared_ptr<RtcpInfo> &rtcp_info)
 {
 	auto transport_cc = std::static_pointer_cast<TransportCc>(rtcp_info);
@@ -758,76 +1074,56 @@ bool RtcSession::ProcessTransportCc(const std::shared_ptr<RtcpInfo> &rtcp_info)
 		return false;
 	}
 
-	uint64_t sent_bytes = 0;
-	int64_t sent_duration = 0;
-
-	// For debug
-	// logtd("TransportCC - SenderSsrc(%u) MediaSsrc(%u) PacketStatusCount(%u)", transport_cc->GetSenderSsrc(), transport_cc->GetMediaSsrc(), transport_cc->GetPacketStatusCount());
+	std::vector<RtcBandwidthEstimator::PacketResult> results;
+	results.reserve(transport_cc->GetPacketStatusCount());
 
-	// for (size_t i = 0; i < transport_cc->GetPacketStatusCount(); i++)
-	// {
-	// 	auto packet_status = transport_cc->GetPacketFeedbackInfo(i);
-	// 	auto sent_log = TraceRtpSentByWideSeqNo(packet_status->_wide_sequence_number);
-	// 	if (sent_log == nullptr)
-	// 	{
-	// 		logte("TransportCC - No sent log found for seqno(%u)", packet_status->_wide_sequence_number);
-	// 		continue;
-	// 	}
-
-	// 	logtd("%s", sent_log->ToString().CStr());
-	// }
+	// The reference time is in multiples of 64ms, and the received delta is in multiples of 250us from the previous received packet
+	int64_t arrival_time_us = static_cast<int64_t>(transport_cc->GetReferenceTime()) * 64000;
 
-	// return true;
-
-	for (size_t i = 1; i < transport_cc->GetPacketStatusCount(); i++)
+	for (size_t i = 0; i < transport_cc->GetPacketStatusCount(); i++)
 	{
 		auto packet_status = transport_cc->GetPacketFeedbackInfo(i);
-		auto sent_log = TraceRtpSentByWideSeqNo(packet_status->_wide_sequence_number);
-		if (sent_log == nullptr)
-		{
-			logte("TransportCC - No sent log found for seqno(%u)", packet_status->_wide_sequence_number);
-			continue;
-		}
-		auto prev_sent_log = TraceRtpSentByWideSeqNo(packet_status->_wide_sequence_number - 1);
-		if (prev_sent_log == nullptr)
+
+		if (packet_status->_received == true)
 		{
-			logtd("TransportCC - No prev sent log found for seqno(%u)", packet_status->_wide_sequence_number - 1);
-			continue;
+			arrival_time_us += static_cast<int64_t>(packet_status->_received_delta) * 250;
 		}
 
-		// Calc delta of sent_log and prev_sent_log
-		int32_t sent_delta_time = (std::chrono::duration_cast<std::chrono::microseconds>(sent_log->_sent_time - prev_sent_log->_sent_time).count()) / 250; 
-
-		auto duration = packet_status->_received_delta - sent_delta_time;
-		if (duration <= 0)
+		WideRtpSentLog sent_log;
+		if (TraceRtpSentByWideSeqNo(packet_status->_wide_sequence_number, sent_log) == false)
 		{
-			//duration = 1;
+			logtd("TransportCC - No sent log found for seqno(%u)", packet_status->_wide_sequence_number);
+			continue;
 		}
 
-		sent_bytes += sent_log->_sent_bytes;
-		sent_duration += duration;
+		RtcBandwidthEstimator::PacketResult result;
+		result.send_time_us = std::chrono::duration_cast<std::chrono::microseconds>(sent_log._sent_time.time_since_epoch()).count();
+		result.arrival_time_us = arrival_time_us;
+		result.size = sent_log._sent_bytes;
+		result.received = packet_status->_received;
 
-		logtd("WideSeqNo(%u) Refer(%u) RecvDelta(%u) SentDelta(%u) SentBytes(%u) Duration(%d)", packet_status->_wide_sequence_number, transport_cc->GetReferenceTime(), packet_status->_received_delta, sent_delta_time, sent_log->_sent_bytes, duration);
+		results.push_back(result);
 	}
 
-	if (sent_bytes > 0)
+	if (results.empty())
 	{
-		double sent_seconds = static_cast<double>(sent_duration) / 4000.0;
+		return false;
+	}
+
+	_bandwidth_estimator->OnTransportFeedback(results, ov::Clock::NowUSec());
 
-		_total_sent_seconds += sent_seconds;
-		_total_sent_bytes += sent_bytes;
-		_estimated_bitrates = static_cast<double>((_total_sent_bytes * 8)) / _total_sent_seconds;
+	_previous_estimated_bitrate = _estimated_bitrates;
+	_estimated_bitrates = _bandwidth_estimator->GetEstimatedBitrate();
 
-		if (_bitrate_estimate_watch.IsElapsed(1000) == true)
+	if (_bitrate_estimate_watch.IsElapsed(1000) == true)
+	{
+		_bitrate_estimate_watch.Update();
+		if (ChangeTemporalLayerIfNeeded() == false)
 		{
-			_bitrate_estimate_watch.Update();
 			ChangeRenditionIfNeeded();
-
-			logtd("Estimated Bandwidth(%f) TotalSentBytes(%u) TotalSentSeconds(%f)", static_cast<double>(_total_sent_bytes * 8) / _total_sent_seconds, _total_sent_bytes, _total_sent_seconds);
-
-			_total_sent_seconds = 0;
-			_total_sent_bytes = 0;
 		}
+
+		logtd("TransportCC Estimated Bandwidth(%" PRIu64 ") Acknowledged Bitrate(%" PRIu64 ")", _bandwidth_estimator->GetEstimatedBitrate(), _bandwidth_estimator->GetAcknowledgedBitrate());
 	}
 
 	return true;
@@ -845,7 +1141,10 @@ bool RtcSession::ProcessRemb(const std::shared_ptr<RtcpInfo> &rtcp_info)
 	if (_bitrate_estimate_watch.IsElapsed(1000) == true)
 	{
 		_bitrate_estimate_watch.Update();
-		ChangeRenditionIfNeeded();
+		if (ChangeTemporalLayerIfNeeded() == false)
+		{
+			ChangeRenditionIfNeeded();
+		}
 	}
 
 	return true;
@@ -888,6 +1187,119 @@ void RtcSession::ChangeRenditionIfNeeded()
 	}
 }
 
+uint8_t RtcSession::GetHighestTemporalLayerId(const std::shared_ptr<const MediaTrack> &video_track) const
+{
+	if (video_track == nullptr)
+	{
+		return 0;
+	}
+
+	switch (video_track->GetCodecId())
+	{
+		case cmn::MediaCodecId::Vp9:
+			return (video_track->GetTemporalLayers() > 1) ? (video_track->GetTemporalLayers() - 1) : 0;
+
+		case cmn::MediaCodecId::H264:
+			// The pictures that are not referenced (nal_ref_idc == 0) are in the temporal layer 1
+			return 1;
+
+		default:
+			break;
+	}
+
+	return 0;
+}
+
+void RtcSession::ChangeTemporalLayerByLoss(uint8_t fraction_lost)
+{
+	std::shared_lock<std::shared_mutex> change_lock(_change_rendition_lock);
+	auto current_rendition = _current_rendition;
+	change_lock.unlock();
+
+	uint8_t highest_layer_id = GetHighestTemporalLayerId(current_rendition->GetVideoTrack());
+	if (highest_layer_id == 0)
+	{
+		return;
+	}
+
+	uint8_t current_layer_id = std::min(_next_max_temporal_layer_id.load(), highest_layer_id);
+
+	// fraction_lost is a fixed point number with the binary point at the left edge (1/256)
+	if (fraction_lost > RTC_SESSION_TEMPORAL_LAYER_DROP_FRACTION_LOST)
+	{
+		_temporal_layer_loss_free_watch.Update();
+
+		if (current_layer_id > 0)
+		{
+			logtd("ChangeTemporalLayerByLoss - Drop the temporal layer %u (fraction lost: %u/256)", current_layer_id, fraction_lost);
+			_next_max_temporal_layer_id = current_layer_id - 1;
+		}
+	}
+	else if (fraction_lost > 0)
+	{
+		_temporal_layer_loss_free_watch.Update();
+	}
+	else if (current_layer_id < highest_layer_id && _temporal_layer_loss_free_watch.IsElapsed(RTC_SESSION_TEMPORAL_LAYER_RESTORE_INTERVAL_MS))
+	{
+		_temporal_layer_loss_free_watch.Update();
+
+		logtd("ChangeTemporalLayerByLoss - Add the temporal layer %u", current_layer_id + 1);
+		_next_max_temporal_layer_id = current_layer_id + 1;
+	}
+}
+
+bool RtcSession::ChangeTemporalLayerIfNeeded()
+{
+	if (_auto_abr == false)
+	{
+		return false;
+	}
+
+	std::shared_lock<std::shared_mutex> change_lock(_change_rendition_lock);
+	auto current_rendition = _current_rendition;
+	change_lock.unlock();
+
+	auto video_track = current_rendition->GetVideoTrack();
+	// Only the VP9 encoder makes the temporal layers
+	if (video_track == nullptr || video_track->GetCodecId() != cmn::MediaCodecId::Vp9 || video_track->GetTemporalLayers() <= 1)
+	{
+		return false;
+	}
+
+	auto audio_bitrates = (current_rendition->GetAudioTrack() != nullptr) ? current_rendition->GetAudioTrack()->GetBitrate() : 0;
+	uint8_t highest_layer_id = video_track->GetTemporalLayers() - 1;
+	uint8_t current_layer_id = std::min(_next_max_temporal_layer_id.load(), highest_layer_id);
+
+	// The temporal layers are dropped before changing to the lower rendition, and added before changing to the higher rendition.
+	// Same thresholds as the rendition are used.
+	if (1.1 * _estimated_bitrates <= (audio_bitrates + video_track->GetTemporalLayerBitrate(current_layer_id)))
+	{
+		if (current_layer_id == 0)
+		{
+			// Even the base layer is too much, so the rendition should be changed
+			return false;
+		}
+
+		logtd("ChangeTemporalLayerIfNeeded - Drop the temporal layer %u", current_layer_id);
+		_next_max_temporal_layer_id = current_layer_id - 1;
+		return true;
+	}
+
+	if (current_layer_id == highest_layer_id)
+	{
+		// All layers are sent, so the higher rendition can be tried
+		return false;
+	}
+
+	if (0.75 * _estimated_bitrates > (audio_bitrates + video_track->GetTemporalLayerBitrate(current_layer_id + 1)))
+	{
+		logtd("ChangeTemporalLayerIfNeeded - Add the temporal layer %u", current_layer_id + 1);
+		_next_max_temporal_layer_id = current_layer_id + 1;
+	}
+
+	return true;
+}
+
 bool RtcSession::RecordAutoSelectedRendition(const std::shared_ptr<const RtcRendition> &rendition, bool higher_quality)
 {
 	if (rendition == nullptr)
@@ -991,6 +1403,17 @@ bool RtcSession::OnDataReceivedFromPrevNode(NodeType from_node, const std::share
 	return _ice_port->Send(GetId(), data);
 }
 
+bool RtcSession::OnDataListReceivedFromPrevNode(NodeType from_node, const std::vector<std::shared_ptr<ov::Data>> &data_list)
+{
+	if(ov::Node::GetNodeState() != ov::Node::NodeState::Started)
+	{
+		logtd("Node has not started, so the received data has been canceled.");
+		return false;
+	}
+
+	return _ice_port->Send(GetId(), std::vector<std::shared_ptr<const ov::Data>>(data_list.begin(), data_list.end()));
+}
+
 // RtcSession Node has not a lower node so it will not be called
 bool RtcSession::OnDataReceivedFromNextNode(NodeType from_node, const std::shared_ptr<const ov::Data> &data)
 {
@@ -13,14 +13,33 @@
 
 #include "base/info/media_track.h"
 #include "base/publisher/session.h"
+#include "base/publisher/stream_packet_queue.h"
 #include "modules/sdp/session_description.h"
 #include "modules/ice/ice_port.h"
 #include "modules/rtp_rtcp/rtp_rtcp.h"
 #include "modules/rtp_rtcp/rtp_packetizer_interface.h"
 #include "modules/dtls_srtp/dtls_transport.h"
 
+#include "rtc_bandwidth_estimator.h"
+#include "rtc_pacer.h"
 #include "rtc_playlist.h"
 
+#define RTC_SESSION_ALL_TEMPORAL_LAYERS		0x07
+// An upper temporal layer is dropped when the receiver reports the loss more than 10% (26/256)
+#define RTC_SESSION_TEMPORAL_LAYER_DROP_FRACTION_LOST	26
+// The dropped layer is added again after no loss is reported for this time
+#define RTC_SESSION_TEMPORAL_LAYER_RESTORE_INTERVAL_MS	5000
+// The estimated bitrate of transport-cc starts from the bitrate of the first rendition, or this value if it is unknown
+#define RTC_SESSION_INITIAL_ESTIMATED_BITRATE	1000000
+// The packets are paced at this multiple of the bitrate, so that a large frame (e.g. key frame) does not wait long
+#define RTC_SESSION_PACING_FACTOR	2.5
+// Retransmissions can use up to this percent of the estimated bitrate
+#define RTC_SESSION_RTX_BUDGET_PERCENT	20
+// The unused retransmission budget is not accumulated more than this time
+#define RTC_SESSION_RTX_BUDGET_WINDOW_MS	500
+// A packet retransmitted later than this time after it was sent arrives too late to be played
+#define RTC_SESSION_RTX_PLAYOUT_DEADLINE_MS	1000
+
 /*	Node Connection
  * [  RTP_RTCP ]
  * [SRTP] [SCTP]				
@@ -35,7 +54,7 @@ class WebRtcPublisher;
 class RtcApplication;
 class RtcStream;
 
-class RtcSession : public pub::Session, public RtpRtcpInterface, public ov::Node
+class RtcSession : public pub::Session, public pub::PacketSink<RtpPacket>, public RtpRtcpInterface, public ov::Node
 {
 public:
 	static std::shared_ptr<RtcSession> Create(const std::shared_ptr<WebRtcPublisher> &publisher,
@@ -79,27 +98,44 @@ public:
 	const std::shared_ptr<http::svr::ws::WebSocketSession>& GetWSClient();
 
 	// pub::Session Interface
-	void SendOutgoingData(const std::any &packet) override;
 	void OnMessageReceived(const std::any &message) override;
+
+	// pub::PacketSink Interface
+	void SendOutgoingPackets(const pub::PacketBatch<RtpPacket> &packets) override;
+	// Sends the packets queued in the pacer as many as the budget allows. Returns true if packets remain in the queue.
+	bool SendPacedPackets();
 	
 	// RtpRtcp Interface
 	void OnRtpFrameReceived(const std::vector<std::shared_ptr<RtpPacket>> &rtp_packets) override;
 	void OnRtcpReceived(const std::shared_ptr<RtcpInfo> &rtcp_info) override;
+	void OnRtcpCompoundReceived() override;
 
 	// ov::Node Interface
 	bool OnDataReceivedFromPrevNode(NodeType from_node, const std::shared_ptr<ov::Data> &data) override;
 	bool OnDataReceivedFromNextNode(NodeType from_node, const std::shared_ptr<const ov::Data> &data) override;
+	bool OnDataListReceivedFromPrevNode(NodeType from_node, const std::vector<std::shared_ptr<ov::Data>> &data_list) override;
 
 private:
+	// Returns the number of bytes sent
+	size_t SendRtpPacket(const std::shared_ptr<RtpPacket> &session_packet);
+	// _pacer_lock must be held
+	size_t DrainPacer();
+	uint64_t GetPacingBitrate();
+
 	bool ProcessReceiverReport(const std::shared_ptr<RtcpInfo> &rtcp_info);
 	bool ProcessNACK(const std::shared_ptr<RtcpInfo> &rtcp_info);
+	// Returns false if the retransmission budget is exhausted
+	bool ConsumeRtxBudget(size_t bytes);
 	bool ProcessTransportCc(const std::shared_ptr<RtcpInfo> &rtcp_info);
 	bool ProcessRemb(const std::shared_ptr<RtcpInfo> &rtcp_info);
-	bool IsSelectedPacket(const std::shared_ptr<const RtpPacket> &rtp_packet);
+	// Takes the packet as it is broadcast, since converting it to shared_ptr<const RtpPacket> costs a reference count per packet per session
+	bool IsSelectedPacket(const std::shared_ptr<RtpPacket> &rtp_packet);
 
 	uint8_t GetOriginPayloadTypeFromRedRtpPacket(const std::shared_ptr<const RedRtpPacket> &red_rtp_packet);
 
 	void ChangeRendition();
+	// Requests a keyframe of the video track of <rendition> which the session is switching to
+	void RequestKeyFrameOfRendition(const std::shared_ptr<const RtcRendition> &rendition);
 	
 	bool SendPlaylistInfo(const std::shared_ptr<const RtcPlaylist> &playlist) const;
 	bool SendRenditionChanged(const std::shared_ptr<const RtcRendition> &rendition) const;
@@ -125,6 +161,12 @@ private:
 	bool								_rtx_enabled = false;
 
 	uint16_t							_rtx_sequence_number = 1;
+	// The RTX packets requested by the NACKs of an RTCP compound packet are sent together
+	std::vector<std::shared_ptr<RtpPacket>>	_pending_rtx_packets;
+	int64_t								_rtx_budget_bytes = 0;
+	int64_t								_rtx_budget_refill_time_us = -1;
+	// Measured with the receiver report, -1 if unknown
+	int64_t								_rtt_ms = -1;
 	uint64_t							_session_expired_time = 0;
 
 	std::shared_mutex					_start_stop_lock;
@@ -137,6 +179,24 @@ private:
 	std::shared_ptr<const RtcRendition>	_next_rendition = nullptr;
 	std::shared_mutex					_change_rendition_lock;
 
+	// For temporal scalability (the upper temporal layers are dropped when the bandwidth is not enough)
+	// The highest temporal layer id to send
+	std::atomic<uint8_t>				_max_temporal_layer_id = RTC_SESSION_ALL_TEMPORAL_LAYERS;
+	// It is applied at the next frame of the base layer, because the upper layers refer to it
+	std::atomic<uint8_t>				_next_max_temporal_layer_id = RTC_SESSION_ALL_TEMPORAL_LAYERS;
+
+	// The video packets are paced. The pacer is drained by the stream worker and the pacing timer of the publisher,
+	// so the lock also serializes SendRtpPacket().
+	bool _pacing_enabled = true;
+	// In the interactive mode, only the bursts of the key frames are paced (the other frames are sent at once)
+	bool _interactive = false;
+	// No video is sent, so the packets bypass the pacer and are not recorded for the retransmission
+	bool _audio_only = false;
+	RtcPacer _pacer;
+	std::mutex _pacer_lock;
+	// To sample the delay of the pacer (every MEDIA_PACKET_TRACE_SAMPLING_INTERVAL frames)
+	uint32_t _paced_frame_count = 0;
+
 	uint16_t _video_rtp_sequence_number = 0;
 	uint16_t _audio_rtp_sequence_number = 0;
 	uint16_t _wide_sequence_number = 0;
@@ -144,54 +204,65 @@ private:
 	ov::StopWatch _abr_test_watch;
 	bool _changed = false;
 
+	// The sent logs are kept in fixed rings (indexed by sequence number % MAX_RTP_RECORDS) of compact records,
+	// which are allocated when the first packet is recorded. A slot is valid only if its sequence number matches.
+
+	// For NACK (video only)
 	struct RtpSentLog
 	{
-		uint16_t _wide_sequence_number = 0;
 		uint16_t _sequence_number = 0;
-
+		uint16_t _origin_sequence_number = 0;
 		uint32_t _track_id = 0;
 		uint8_t _payload_type = 0;
-		uint16_t _origin_sequence_number = 0;
 
-		uint32_t _ssrc = 0;
-		uint32_t _timestamp = 0;
-		bool _marker = false;
+		// Epoch if the slot is empty
+		std::chrono::system_clock::time_point _sent_time;
+		// Epoch if it has not been retransmitted
+		std::chrono::system_clock::time_point _retransmitted_time;
+	};
 
+	// For TRANSPORT-CC
+	struct WideRtpSentLog
+	{
+		uint16_t _wide_sequence_number = 0;
 		uint32_t _sent_bytes = 0;
-		std::chrono::system_clock::time_point _sent_time;
 
-		ov::String ToString()
-		{
-			return ov::String::FormatString("WideSeq(%d) SSRC(%u) Seq(%d) Track(%d) PT(%d) Timestamp(%u) Marker(%s) OriginSeq(%d) SentBytes(%u)", 
-				_wide_sequence_number, _ssrc, _sequence_number, _track_id, _payload_type, _timestamp, _marker==true?"O":"X",_origin_sequence_number, _sent_bytes);
-		}
+		// Epoch if the slot is empty
+		std::chrono::system_clock::time_point _sent_time;
 	};
 
-	bool RecordRtpSent(const std::shared_ptr<const RtpPacket> &rtp_packet, uint16_t origin_sequence_number, uint16_t wide_sequence_number);
+	void RecordRtpSent(const std::shared_ptr<const RtpPacket> &rtp_packet, uint16_t sequence_number, uint16_t origin_sequence_number, bool has_wide_sequence_number, uint16_t wide_sequence_number, size_t sent_bytes);
 
 	std::shared_mutex _rtp_record_map_lock;
-	// For NACK
-	// video sequence number % MAX_RTP_RECORDS : RtpSentRecord
-	std::unordered_map<uint16_t, std::shared_ptr<RtpSentLog>> _video_rtp_sent_record_map;
-	// For TRANSPORT-CC
-	// wide sequence number % MAX_RTP_RECORDS : RtpSentRecord
-	std::unordered_map<uint16_t, std::shared_ptr<RtpSentLog>> _wide_rtp_sent_record_map;
+	// video sequence number % MAX_RTP_RECORDS : RtpSentLog
+	std::vector<RtpSentLog> _video_rtp_sent_logs;
+	// wide sequence number % MAX_RTP_RECORDS : WideRtpSentLog (empty if transport-cc is not negotiated)
+	std::vector<WideRtpSentLog> _wide_rtp_sent_logs;
 
-	std::shared_ptr<RtpSentLog> TraceRtpSentByVideoSeqNo(uint16_t sequence_number);
-	std::shared_ptr<RtpSentLog> TraceRtpSentByWideSeqNo(uint16_t wide_sequence_number);
+	// The logs are copied, since the slots are overwritten by the sending thread
+	bool TraceRtpSentByVideoSeqNo(uint16_t sequence_number, RtpSentLog &sent_log);
+	bool TraceRtpSentByWideSeqNo(uint16_t wide_sequence_number, WideRtpSentLog &sent_log);
+	void SetRtpRetransmittedTime(uint16_t sequence_number, const std::chrono::system_clock::time_point &time);
 
-	bool SetTransportWideSequenceNumber(const std::shared_ptr<RtpPacket> &rtp_packet, uint16_t wide_sequence_number);
-	bool SetAbsSendTime(const std::shared_ptr<RtpPacket> &rtp_packet, uint64_t time_ms);
+	// rtp_packet: The layout of the header extensions is obtained from this packet
+	// buffer: The serialized packet to modify (a copy of rtp_packet)
+	bool SetTransportWideSequenceNumber(const std::shared_ptr<const RtpPacket> &rtp_packet, uint8_t *buffer, uint16_t wide_sequence_number);
+	bool SetAbsSendTime(const std::shared_ptr<const RtpPacket> &rtp_packet, uint8_t *buffer, uint64_t time_ms);
 
 	// For Estimated bitrate
-	double _total_sent_seconds = 0;
-	uint64_t _total_sent_bytes = 0;
+	std::shared_ptr<RtcBandwidthEstimator> _bandwidth_estimator;
 	double _estimated_bitrates = 0;
 	ov::StopWatch _bitrate_estimate_watch;
 
 	// Auto switch rendition
 	bool _auto_abr = true;
 	void ChangeRenditionIfNeeded();
+	// Returns true if the temporal layer is going to be changed
+	bool ChangeTemporalLayerIfNeeded();
+	// Changes the temporal layer with the fraction lost of the receiver report
+	void ChangeTemporalLayerByLoss(uint8_t fraction_lost);
+	uint8_t GetHighestTemporalLayerId(const std::shared_ptr<const MediaTrack> &video_track) const;
+	ov::StopWatch _temporal_layer_loss_free_watch;
 	
 	// true means Don't know yet
 	bool IsNextRenditionGoodChoice(const std::shared_ptr<const RtcRendition> &rendition);
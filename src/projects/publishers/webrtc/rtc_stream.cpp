@@ -112,7 +112,7 @@ bool RtcStream::Start()
 		return false;
 	}
 
-	if (!CreateStreamWorker(_worker_count))
+	if (!CreateStreamWorker<RtpPacket>(_worker_count))
 	{
 		return false;
 	}
@@ -122,11 +122,23 @@ bool RtcStream::Start()
 	_rtx_enabled = webrtc_config.IsRtxEnabled();
 	_ulpfec_enabled = webrtc_config.IsUlpfecEnalbed();
 	_jitter_buffer_enabled = webrtc_config.IsJitterBufferEnabled();
+	_pacing_enabled = webrtc_config.IsPacingEnabled();
 
 	auto playoutDelay = webrtc_config.GetPlayoutDelay(&_playout_delay_enabled);
 	_playout_delay_min = playoutDelay.GetMin();
 	_playout_delay_max = playoutDelay.GetMax();
 
+	_interactive = webrtc_config.IsInteractive();
+	_rtp_relay_enabled = webrtc_config.IsRtpRelayEnabled();
+	if (_interactive == true)
+	{
+		// The player renders the frames as soon as they are decoded
+		_jitter_buffer_enabled = false;
+		_playout_delay_enabled = true;
+		_playout_delay_min = 0;
+		_playout_delay_max = 0;
+	}
+
 	if (webrtc_config.GetBandwidthEstimationType() == WebRtcBandwidthEstimationType::TransportCc)
 	{
 		_transport_cc_enabled = true;
@@ -148,7 +160,6 @@ bool RtcStream::Start()
 	std::shared_ptr<MediaTrack> _first_video_track = nullptr;
 	std::shared_ptr<MediaTrack> _first_audio_track = nullptr;
 
-	// Create Packetizer
 	for (auto &[track_id, track] : GetTracks())
 	{
 		if (IsSupportedCodec(track->GetCodecId()) == false)
@@ -165,6 +176,28 @@ bool RtcStream::Start()
 		{
 			_first_audio_track = track;
 		}
+	}
+
+	_audio_only = (_first_video_track == nullptr) && (_first_audio_track != nullptr);
+	if (_audio_only == true)
+	{
+		// RTX and ULPFEC protect the video only (the loss of audio is concealed by the in-band FEC of Opus),
+		// the jitter buffer aligns the audio with the video, and the estimated bandwidth is used to switch the video renditions.
+		// So the audio packets are sent without them (and without the header extensions for the bandwidth estimation).
+		_rtx_enabled = false;
+		_ulpfec_enabled = false;
+		_jitter_buffer_enabled = false;
+		_transport_cc_enabled = false;
+		_remb_enabled = false;
+	}
+
+	// Create Packetizer
+	for (auto &[track_id, track] : GetTracks())
+	{
+		if (IsSupportedCodec(track->GetCodecId()) == false)
+		{
+			continue;
+		}
 
 		AddPacketizer(track);
 
@@ -182,20 +215,23 @@ bool RtcStream::Start()
 	// Create Default Playlist for no file name (ws://domain/app/stream)
 	_default_playlist_name = ov::Random::GenerateString(8);
 	auto rtc_master_playlist = std::make_shared<RtcMasterPlaylist>(_default_playlist_name, _default_playlist_name);
-	rtc_master_playlist->SetWebRtcAutoAbr(false);
-	rtc_master_playlist->AddRendition(std::make_shared<RtcRendition>("default", _first_video_track, _first_audio_track));
+	// If the input has the simulcast layers, the session switches the layers by the estimated bandwidth
+	rtc_master_playlist->SetWebRtcAutoAbr(GetVideoLayers(_first_video_track).size() > 1);
+	AddRenditions(rtc_master_playlist, "default", _first_video_track, _first_audio_track);
 
 	// lock
 	std::lock_guard<std::shared_mutex> lock(_rtc_master_playlist_map_lock);
 	_rtc_master_playlist_map[_default_playlist_name] = rtc_master_playlist;
 
-	logti("WebRTC Stream has been created : %s/%u\nRtx(%s) Ulpfec(%s) JitterBuffer(%s) PlayoutDelay(%s min:%d max: %d)", 
+	logti("WebRTC Stream has been created : %s/%u\nRtx(%s) Ulpfec(%s) JitterBuffer(%s) PlayoutDelay(%s min:%d max: %d) Interactive(%s) AudioOnly(%s)", 
 									GetName().CStr(), GetId(),
 									ov::Converter::ToString(_rtx_enabled).CStr(),
 									ov::Converter::ToString(_ulpfec_enabled).CStr(),
 									ov::Converter::ToString(_jitter_buffer_enabled).CStr(),
 									ov::Converter::ToString(_playout_delay_enabled).CStr(),
-									_playout_delay_min, _playout_delay_max);
+									_playout_delay_min, _playout_delay_max,
+									ov::Converter::ToString(_interactive).CStr(),
+									ov::Converter::ToString(_audio_only).CStr());
 	
 	return Stream::Start();
 }
@@ -228,8 +264,10 @@ bool RtcStream::IsSupportedCodec(cmn::MediaCodecId codec_id)
 	switch (codec_id)
 	{
 	case cmn::MediaCodecId::H264:
-	//case cmn::MediaCodecId::H265:
+	case cmn::MediaCodecId::H265:
 	case cmn::MediaCodecId::Vp8:
+	case cmn::MediaCodecId::Vp9:
+	case cmn::MediaCodecId::Av1:
 	case cmn::MediaCodecId::Opus:
 		return true;
 	default:
@@ -306,12 +344,58 @@ std::shared_ptr<RtcMasterPlaylist> RtcStream::CreateRtcMasterPlaylist(const ov::
 			continue;
 		}
 
-		rtc_master_playlist->AddRendition(std::make_shared<RtcRendition>(rendition->GetName(), video_track, audio_track));
+		AddRenditions(rtc_master_playlist, rendition->GetName(), video_track, audio_track);
 	}
 
 	return rtc_master_playlist;
 }
 
+std::vector<std::shared_ptr<MediaTrack>> RtcStream::GetVideoLayers(const std::shared_ptr<MediaTrack> &video_track) const
+{
+	std::vector<std::shared_ptr<MediaTrack>> layers;
+
+	if (video_track == nullptr)
+	{
+		return layers;
+	}
+
+	auto group = GetMediaTrackGroup(video_track->GetVariantName());
+	if (group == nullptr)
+	{
+		return {video_track};
+	}
+
+	for (const auto &track : group->GetTracks())
+	{
+		if ((track->GetMediaType() == cmn::MediaType::Video) && (track->GetCodecId() == video_track->GetCodecId()))
+		{
+			layers.push_back(track);
+		}
+	}
+
+	return layers;
+}
+
+void RtcStream::AddRenditions(const std::shared_ptr<RtcMasterPlaylist> &rtc_master_playlist, const ov::String &name,
+							  const std::shared_ptr<MediaTrack> &video_track, const std::shared_ptr<MediaTrack> &audio_track) const
+{
+	auto layers = GetVideoLayers(video_track);
+	if (layers.size() <= 1)
+	{
+		rtc_master_playlist->AddRendition(std::make_shared<RtcRendition>(name, video_track, audio_track));
+		return;
+	}
+
+	// The layers are forwarded as they are, so a viewer receives one of them without transcoding
+	for (size_t index = 0; index < layers.size(); index++)
+	{
+		auto &layer = layers[index];
+		auto layer_name = layer->GetPublicName().IsEmpty() ? ov::Converter::ToString(index) : layer->GetPublicName();
+
+		rtc_master_playlist->AddRendition(std::make_shared<RtcRendition>(ov::String::FormatString("%s_%s", name.CStr(), layer_name.CStr()), layer, audio_track));
+	}
+}
+
 std::shared_ptr<const SessionDescription> RtcStream::GetSessionDescription(const ov::String &file_name)
 {
 	if(GetState() != State::STARTED)
@@ -532,9 +616,15 @@ std::shared_ptr<PayloadAttr> RtcStream::MakePayloadAttr(const std::shared_ptr<co
 		case MediaCodecId::Vp8:
 			payload->SetRtpmap(PayloadTypeFromCodecId(track->GetCodecId()), "VP8", 90000);
 			break;
+		case MediaCodecId::Vp9:
+			payload->SetRtpmap(PayloadTypeFromCodecId(track->GetCodecId()), "VP9", 90000);
+			break;
 		case MediaCodecId::H265:
 			payload->SetRtpmap(PayloadTypeFromCodecId(track->GetCodecId()), "H265", 90000);
 			break;
+		case MediaCodecId::Av1:
+			payload->SetRtpmap(PayloadTypeFromCodecId(track->GetCodecId()), "AV1", 90000);
+			break;
 		case MediaCodecId::H264:
 			payload->SetRtpmap(PayloadTypeFromCodecId(track->GetCodecId()), "H264", 90000);
 
@@ -617,8 +707,7 @@ std::shared_ptr<PayloadAttr> RtcStream::MakeRtxPayloadAttr(const std::shared_ptr
 
 bool RtcStream::OnRtpPacketized(std::shared_ptr<RtpPacket> packet)
 {
-	auto stream_packet = std::make_any<std::shared_ptr<RtpPacket>>(packet);
-	BroadcastPacket(stream_packet);
+	BroadcastPacket(packet);
 
 	if (_rtx_enabled == true)
 	{
@@ -664,10 +753,27 @@ void RtcStream::PushToJitterBuffer(const std::shared_ptr<MediaPacket> &media_pac
 		return;
 	}
 
+	if ((media_packet->GetTrace() != nullptr) && (_jitter_buffer_traced_packet == nullptr))
+	{
+		_jitter_buffer_traced_packet = media_packet;
+		_jitter_buffer_traced_time_us = ov::Clock::NowUSec();
+	}
+
 	_jitter_buffer_delay.PushMediaPacket(media_packet);
 
 	while(auto media_packet = _jitter_buffer_delay.PopNextMediaPacket())
 	{
+		if (media_packet == _jitter_buffer_traced_packet)
+		{
+			auto stream_metrics = StreamMetrics(*this);
+			if (stream_metrics != nullptr)
+			{
+				stream_metrics->GetLatencyMetrics()->RecordBufferingDelay(mon::BufferingStage::JitterBuffer, ov::Clock::NowUSec() - _jitter_buffer_traced_time_us);
+			}
+
+			_jitter_buffer_traced_packet = nullptr;
+		}
+
 		if(media_packet->GetMediaType() == cmn::MediaType::Video)
 		{
 			PacketizeVideoFrame(media_packet);
@@ -695,6 +801,31 @@ void RtcStream::PacketizeVideoFrame(const std::shared_ptr<MediaPacket> &media_pa
 		// In the future, when OME uses codec-specific features, certain information is obtained from media_packet.
 		codec_info.codec_specific.vp8 = CodecSpecificInfoVp8();
 	}
+	else if (codec_info.codec_type == MediaCodecId::Vp9)
+	{
+		auto &vp9 = codec_info.codec_specific.vp9;
+		auto &index = _vp9_picture_indexes[media_track->GetId()];
+
+		vp9 = CodecSpecificInfoVp9();
+
+		// 15 bits picture id
+		index.picture_id = (index.picture_id + 1) & 0x7FFF;
+		vp9.picture_id = index.picture_id;
+
+		vp9.num_temporal_layers = media_track->GetTemporalLayers();
+		vp9.temporal_idx = media_packet->GetTemporalLayerId();
+		if (vp9.temporal_idx == 0)
+		{
+			index.tl0_pic_idx++;
+		}
+		vp9.tl0_pic_idx = index.tl0_pic_idx;
+		// The frames of the upper layers refer to the frames of the lower layers only
+		vp9.temporal_up_switch = (vp9.temporal_idx > 0);
+
+		vp9.inter_pic_predicted = (media_packet->GetFlag() != MediaPacketFlag::Key);
+		vp9.width = media_track->GetWidth();
+		vp9.height = media_track->GetHeight();
+	}
 	else if (codec_info.codec_type == MediaCodecId::H264 ||
 			 codec_info.codec_type == MediaCodecId::H265)
 	{
@@ -704,6 +835,7 @@ void RtcStream::PacketizeVideoFrame(const std::shared_ptr<MediaPacket> &media_pa
 	memset(&rtp_video_header, 0, sizeof(RTPVideoHeader));
 
 	MakeRtpVideoHeader(&codec_info, &rtp_video_header);
+	rtp_video_header.temporal_idx = media_packet->GetTemporalLayerId();
 
 	// RTP Packetizing
 	auto packetizer = GetPacketizer(media_track->GetId());
@@ -716,6 +848,12 @@ void RtcStream::PacketizeVideoFrame(const std::shared_ptr<MediaPacket> &media_pa
 	// video timescale is always 90000hz in WebRTC
 	auto timestamp = ((double)media_packet->GetPts() * media_track->GetTimeBase().GetExpr() * 90000);
 	auto ntp_timestamp = ov::Converter::SecondsToNtpTs((double)media_packet->GetPts() * media_track->GetTimeBase().GetExpr());
+
+	if (IsRelayable(media_track, media_packet))
+	{
+		packetizer->Relay(frame_type, timestamp, ntp_timestamp, media_packet->GetOriginRtpPackets(), media_packet->GetTemporalLayerId());
+		return;
+	}
 	auto data = media_packet->GetData();
 	auto fragmentation = media_packet->GetFragHeader();
 
@@ -728,6 +866,25 @@ void RtcStream::PacketizeVideoFrame(const std::shared_ptr<MediaPacket> &media_pa
 						  &rtp_video_header);
 }
 
+bool RtcStream::IsRelayable(const std::shared_ptr<const MediaTrack> &media_track, const std::shared_ptr<const MediaPacket> &media_packet) const
+{
+	if ((_rtp_relay_enabled == false) || (media_track->IsBypass() == false) || media_packet->GetOriginRtpPackets().empty())
+	{
+		return false;
+	}
+
+	switch (media_track->GetCodecId())
+	{
+		case cmn::MediaCodecId::H264:
+		case cmn::MediaCodecId::H265:
+		case cmn::MediaCodecId::Vp8:
+			return true;
+
+		default:
+			return false;
+	}
+}
+
 void RtcStream::PacketizeAudioFrame(const std::shared_ptr<MediaPacket> &media_packet)
 {
 	auto media_track = GetTrack(media_packet->GetTrackId());
@@ -739,6 +896,11 @@ void RtcStream::PacketizeAudioFrame(const std::shared_ptr<MediaPacket> &media_pa
 		return;
 	}
 
+	if ((media_track->GetCodecId() == cmn::MediaCodecId::Opus) && (IsOpusDtxFrameToSkip(media_track, media_packet) == true))
+	{
+		return;
+	}
+
 	auto frame_type = (media_packet->GetFlag() == MediaPacketFlag::Key) ? FrameType::AudioFrameKey : FrameType::AudioFrameDelta;
 	auto timestamp = media_packet->GetPts();
 	auto ntp_timestamp = ov::Converter::SecondsToNtpTs((double)media_packet->GetPts() * media_track->GetTimeBase().GetExpr());
@@ -754,6 +916,32 @@ void RtcStream::PacketizeAudioFrame(const std::shared_ptr<MediaPacket> &media_pa
 						  nullptr);
 }
 
+bool RtcStream::IsOpusDtxFrameToSkip(const std::shared_ptr<const MediaTrack> &media_track, const std::shared_ptr<const MediaPacket> &media_packet)
+{
+	auto track_id = media_track->GetId();
+
+	if (media_packet->GetDataLength() > RTC_STREAM_OPUS_DTX_MAX_FRAME_SIZE)
+	{
+		// Not silent
+		_opus_dtx_sent_pts_ms.erase(track_id);
+		return false;
+	}
+
+	// The first DTX frame of the silence is forwarded so that the player starts the comfort noise,
+	// and the next ones are forwarded at RTC_STREAM_OPUS_DTX_INTERVAL_MS only
+	auto pts_ms = static_cast<int64_t>(media_packet->GetPts() * media_track->GetTimeBase().GetExpr() * 1000.0);
+	auto item = _opus_dtx_sent_pts_ms.find(track_id);
+
+	if ((item != _opus_dtx_sent_pts_ms.end()) && ((pts_ms - item->second) < RTC_STREAM_OPUS_DTX_INTERVAL_MS))
+	{
+		return true;
+	}
+
+	_opus_dtx_sent_pts_ms[track_id] = pts_ms;
+
+	return false;
+}
+
 uint16_t RtcStream::AllocateVP8PictureID()
 {
 	_vp8_picture_id++;
@@ -795,6 +983,28 @@ void RtcStream::MakeRtpVideoHeader(const CodecSpecificInfo *info, RTPVideoHeader
 			rtp_video_header->codec_header.h26X.packetization_mode = info->codec_specific.h26X.packetization_mode;
 			rtp_video_header->simulcast_idx = info->codec_specific.h26X.simulcast_idx;
 			return;
+
+		case cmn::MediaCodecId::Vp9:
+			rtp_video_header->codec = cmn::MediaCodecId::Vp9;
+			rtp_video_header->codec_header.vp9.InitRTPVideoHeaderVP9();
+			rtp_video_header->codec_header.vp9.picture_id = info->codec_specific.vp9.picture_id;
+			rtp_video_header->codec_header.vp9.inter_pic_predicted = info->codec_specific.vp9.inter_pic_predicted;
+			rtp_video_header->codec_header.vp9.num_temporal_layers = info->codec_specific.vp9.num_temporal_layers;
+			if (info->codec_specific.vp9.num_temporal_layers > 1)
+			{
+				rtp_video_header->codec_header.vp9.temporal_idx = info->codec_specific.vp9.temporal_idx;
+				rtp_video_header->codec_header.vp9.temporal_up_switch = info->codec_specific.vp9.temporal_up_switch;
+				rtp_video_header->codec_header.vp9.tl0_pic_idx = info->codec_specific.vp9.tl0_pic_idx;
+			}
+			rtp_video_header->codec_header.vp9.width = info->codec_specific.vp9.width;
+			rtp_video_header->codec_header.vp9.height = info->codec_specific.vp9.height;
+			rtp_video_header->simulcast_idx = info->codec_specific.vp9.simulcast_idx;
+			return;
+
+		case cmn::MediaCodecId::Av1:
+			// The AV1 packetizer doesn't need the codec specific header (the aggregation header is made from OBUs)
+			rtp_video_header->codec = cmn::MediaCodecId::Av1;
+			return;
 		default:
 			break;
 	}
@@ -871,9 +1081,10 @@ std::shared_ptr<RtpPacketizer> RtcStream::GetPacketizer(uint32_t id)
 	return _packetizers[id];
 }
 
-ov::String RtcStream::GetRtpHistoryKey(uint32_t track_id, uint8_t payload_type)
+uint64_t RtcStream::GetRtpHistoryKey(uint32_t track_id, uint8_t payload_type)
 {
-	return ov::String::FormatString("%u:%u", track_id, payload_type);
+	// It is looked up for every packet, so the key is not formatted as a string
+	return (static_cast<uint64_t>(track_id) << 8) | payload_type;
 }
 
 void RtcStream::AddRtpHistory(const std::shared_ptr<const MediaTrack> &track)
@@ -886,7 +1097,15 @@ void RtcStream::AddRtpHistory(const std::shared_ptr<const MediaTrack> &track)
 		return;
 	}
 
+	std::shared_ptr<mon::MemoryMetrics> memory_metrics;
+	auto stream_metrics = StreamMetrics(*this);
+	if (stream_metrics != nullptr)
+	{
+		memory_metrics = stream_metrics->GetMemoryMetrics();
+	}
+
 	auto history = std::make_shared<RtpHistory>(origin_payload_type, rtx_payload_type, _video_rtx_ssrc, MAX_RTP_RECORDS);
+	history->SetMemoryMetrics(memory_metrics);
 	_rtp_history_map[GetRtpHistoryKey(track->GetId(), origin_payload_type)] = history;
 
 	if (_ulpfec_enabled == true)
@@ -894,6 +1113,7 @@ void RtcStream::AddRtpHistory(const std::shared_ptr<const MediaTrack> &track)
 		auto red_pt = static_cast<uint8_t>(FixedRtcPayloadType::RED_PAYLOAD_TYPE);
 		auto red_rtx_pt = static_cast<uint8_t>(FixedRtcPayloadType::RED_RTX_PAYLOAD_TYPE);
 		auto red_history = std::make_shared<RtpHistory>(red_pt, red_rtx_pt, _video_rtx_ssrc, MAX_RTP_RECORDS);
+		red_history->SetMemoryMetrics(memory_metrics);
 
 		_rtp_history_map[GetRtpHistoryKey(track->GetId(), red_pt)] = red_history;
 	}
@@ -901,14 +1121,13 @@ void RtcStream::AddRtpHistory(const std::shared_ptr<const MediaTrack> &track)
 
 std::shared_ptr<RtpHistory> RtcStream::GetHistory(uint32_t track_id, uint8_t origin_payload_type)
 {
-	auto key = GetRtpHistoryKey(track_id, origin_payload_type);
-
-	if (_rtp_history_map.find(key) == _rtp_history_map.end())
+	auto it = _rtp_history_map.find(GetRtpHistoryKey(track_id, origin_payload_type));
+	if (it == _rtp_history_map.end())
 	{
 		return nullptr;
 	}
 
-	return _rtp_history_map[key];
+	return it->second;
 }
 
 std::shared_ptr<RtxRtpPacket> RtcStream::GetRtxRtpPacket(uint32_t track_id, uint8_t origin_payload_type, uint16_t origin_sequence_number)
@@ -925,4 +1144,19 @@ std::shared_ptr<RtxRtpPacket> RtcStream::GetRtxRtpPacket(uint32_t track_id, uint
 	}
 
 	return history->GetRtxRtpPacket(origin_sequence_number);
-}
\ No newline at end of file
+}
+
+bool RtcStream::IsPacingEnabled() const
+{
+	return _pacing_enabled;
+}
+
+bool RtcStream::IsInteractive() const
+{
+	return _interactive;
+}
+
+bool RtcStream::IsAudioOnly() const
+{
+	return _audio_only;
+}
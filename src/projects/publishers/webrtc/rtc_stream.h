@@ -1,128 +1,168 @@
-//==============================================================================
-//
-//  OvenMediaEngine
-//
-//  Created by Getroot
-//  Copyright (c) 2018 AirenSoft. All rights reserved.
-//
-//==============================================================================
-#pragma once
-
-#include <base/ovcrypto/certificate.h>
-#include <base/common_types.h>
-#include <base/info/stream.h>
-#include <base/publisher/stream.h>
-#include <modules/ice/ice_port.h>
-#include <modules/sdp/session_description.h>
-#include <modules/rtp_rtcp/rtp_rtcp_defines.h>
-#include <modules/rtp_rtcp/rtp_history.h>
-#include <modules/jitter_buffer/jitter_buffer.h>
-
-#include "rtc_session.h"
-#include "rtc_playlist.h"
-
-class RtcStream : public pub::Stream, public RtpPacketizerInterface
-{
-public:
-	static std::shared_ptr<RtcStream> Create(const std::shared_ptr<pub::Application> application,
-	                                         const info::Stream &info,
-	                                         uint32_t worker_count);
-
-	explicit RtcStream(const std::shared_ptr<pub::Application> application,
-	                   const info::Stream &info,
-					   uint32_t worker_count);
-	~RtcStream() final;
-
-	std::shared_ptr<const SessionDescription> GetSessionDescription(const ov::String &file_name);
-	std::shared_ptr<const RtcPlaylist> GetRtcPlaylist(const ov::String &file_name, cmn::MediaCodecId video_codec_id, cmn::MediaCodecId audio_codec_id);
-
-	void SendVideoFrame(const std::shared_ptr<MediaPacket> &media_packet) override;
-	void SendAudioFrame(const std::shared_ptr<MediaPacket> &media_packet) override;
-	void SendDataFrame(const std::shared_ptr<MediaPacket> &media_packet) override {} // Not supported
-
-	std::shared_ptr<RtxRtpPacket> GetRtxRtpPacket(uint32_t track_id, uint8_t origin_payload_type, uint16_t origin_sequence_number);
-
-	// RtpRtcpPacketizerInterface Implementation
-	bool OnRtpPacketized(std::shared_ptr<RtpPacket> packet) override;
-
-private:
-	bool Start() override;
-	bool Stop() override;
-	bool OnStreamUpdated(const std::shared_ptr<info::Stream> &info) override;
-
-	bool IsSupportedCodec(cmn::MediaCodecId codec_id);
-
-	std::shared_ptr<SessionDescription> CreateSessionDescription(const ov::String &file_name = "");
-
-	std::shared_ptr<const RtcMasterPlaylist> GetRtcMasterPlaylist(const ov::String &file_name);
-	std::shared_ptr<RtcMasterPlaylist> CreateRtcMasterPlaylist(const ov::String &file_name);
-
-	std::shared_ptr<MediaDescription> MakeVideoDescription() const;
-	std::shared_ptr<MediaDescription> MakeAudioDescription() const;
-
-	std::shared_ptr<PayloadAttr> MakePayloadAttr(const std::shared_ptr<const MediaTrack> &track) const;
-	std::shared_ptr<PayloadAttr> MakeRtxPayloadAttr(const std::shared_ptr<const MediaTrack> &track) const;
-
-	void MakeRtpVideoHeader(const CodecSpecificInfo *info, RTPVideoHeader *rtp_video_header);
-	uint16_t AllocateVP8PictureID();
-
-	bool StorePacketForRTX(std::shared_ptr<RtpPacket> &packet);
-
-	void PushToJitterBuffer(const std::shared_ptr<MediaPacket> &media_packet);
-	void PacketizeVideoFrame(const std::shared_ptr<MediaPacket> &media_packet);
-	void PacketizeAudioFrame(const std::shared_ptr<MediaPacket> &media_packet);
-
-	void AddPacketizer(const std::shared_ptr<const MediaTrack> &track);
-	std::shared_ptr<RtpPacketizer> GetPacketizer(uint32_t track_id);
-
-	ov::String GetRtpHistoryKey(uint32_t track_id, uint8_t payload_type);
-	void AddRtpHistory(const std::shared_ptr<const MediaTrack> &track);
-	std::shared_ptr<RtpHistory> GetHistory(uint32_t track_id, uint8_t origin_payload_type);
-
-
-	uint32_t GetSsrc(cmn::MediaType media_type);
-
-	// SDP related info
-	ov::String _msid;
-	ov::String _cname;
-
-	// VP8 Picture ID
-	uint16_t _vp8_picture_id;
-
-	std::shared_ptr<Certificate> _certificate;
-
-	// Track ID, Packetizer
-	std::shared_mutex _packetizers_lock;
-	std::map<uint32_t, std::shared_ptr<RtpPacketizer>> _packetizers;
-
-	// RtpHistoryKey string, RtpHistory
-	std::map<ov::String, std::shared_ptr<RtpHistory>> _rtp_history_map;
-
-	uint32_t _video_ssrc = 0;
-	uint32_t _video_rtx_ssrc = 0;
-	uint32_t _audio_ssrc = 0;
-
-	bool _rtx_enabled = true;
-	bool _ulpfec_enabled = true;
-	bool _jitter_buffer_enabled = false;
-	bool _playout_delay_enabled = false;
-	int _playout_delay_min = 0;
-	int _playout_delay_max = 0;
-
-	bool _transport_cc_enabled = false;
-	bool _remb_enabled = false;
-
-	uint32_t _worker_count = 0;
-
-	JitterBufferDelay	_jitter_buffer_delay;
-
-	ov::String _default_playlist_name;
-
-	// Playlist File Name : SessionDescription
-	std::map<ov::String, std::shared_ptr<const SessionDescription>> _offer_sdp_map;
-	std::shared_mutex _offer_sdp_lock;
-
-	// Playlist File Name : RtcPlaylist
-	std::map<ov::String, std::shared_ptr<const RtcMasterPlaylist>> _rtc_master_playlist_map;
-	std::shared_mutex _rtc_master_playlist_map_lock;
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2018 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/ovcrypto/certificate.h>
+#include <base/common_types.h>
+#include <base/info/stream.h>
+#include <base/publisher/stream.h>
+#include <modules/ice/ice_port.h>
+#include <modules/sdp/session_description.h>
+#include <modules/rtp_rtcp/rtp_rtcp_defines.h>
+#include <modules/rtp_rtcp/rtp_history.h>
+#include <modules/jitter_buffer/jitter_buffer.h>
+
+#include "rtc_session.h"
+#include "rtc_playlist.h"
+
+// An Opus packet of this size or less is a DTX (silence) frame, which does not need to be transmitted (See opus_encode())
+#define RTC_STREAM_OPUS_DTX_MAX_FRAME_SIZE	2
+// While the audio is silent, a DTX frame is forwarded at this interval so that the player keeps generating comfort noise
+#define RTC_STREAM_OPUS_DTX_INTERVAL_MS		400
+
+class RtcStream : public pub::Stream, public RtpPacketizerInterface
+{
+public:
+	static std::shared_ptr<RtcStream> Create(const std::shared_ptr<pub::Application> application,
+	                                         const info::Stream &info,
+	                                         uint32_t worker_count);
+
+	explicit RtcStream(const std::shared_ptr<pub::Application> application,
+	                   const info::Stream &info,
+					   uint32_t worker_count);
+	~RtcStream() final;
+
+	std::shared_ptr<const SessionDescription> GetSessionDescription(const ov::String &file_name);
+	std::shared_ptr<const RtcPlaylist> GetRtcPlaylist(const ov::String &file_name, cmn::MediaCodecId video_codec_id, cmn::MediaCodecId audio_codec_id);
+
+	void SendVideoFrame(const std::shared_ptr<MediaPacket> &media_packet) override;
+	void SendAudioFrame(const std::shared_ptr<MediaPacket> &media_packet) override;
+	void SendDataFrame(const std::shared_ptr<MediaPacket> &media_packet) override {} // Not supported
+
+	std::shared_ptr<RtxRtpPacket> GetRtxRtpPacket(uint32_t track_id, uint8_t origin_payload_type, uint16_t origin_sequence_number);
+
+	bool IsPacingEnabled() const;
+	bool IsInteractive() const;
+	// The stream has no video track, so the video-only stages (RTX, ULPFEC, jitter buffer, bandwidth estimation) are skipped
+	bool IsAudioOnly() const;
+
+	// RtpRtcpPacketizerInterface Implementation
+	bool OnRtpPacketized(std::shared_ptr<RtpPacket> packet) override;
+
+private:
+	bool Start() override;
+	bool Stop() override;
+	bool OnStreamUpdated(const std::shared_ptr<info::Stream> &info) override;
+
+	bool IsSupportedCodec(cmn::MediaCodecId codec_id);
+
+	std::shared_ptr<SessionDescription> CreateSessionDescription(const ov::String &file_name = "");
+
+	std::shared_ptr<const RtcMasterPlaylist> GetRtcMasterPlaylist(const ov::String &file_name);
+	std::shared_ptr<RtcMasterPlaylist> CreateRtcMasterPlaylist(const ov::String &file_name);
+
+	// The video tracks of the group of <video_track> with the same codec (e.g. the simulcast layers of a WebRTC input)
+	std::vector<std::shared_ptr<MediaTrack>> GetVideoLayers(const std::shared_ptr<MediaTrack> &video_track) const;
+	// Adds a rendition, or a rendition per layer if the video track has several layers
+	void AddRenditions(const std::shared_ptr<RtcMasterPlaylist> &rtc_master_playlist, const ov::String &name,
+					   const std::shared_ptr<MediaTrack> &video_track, const std::shared_ptr<MediaTrack> &audio_track) const;
+
+	std::shared_ptr<MediaDescription> MakeVideoDescription() const;
+	std::shared_ptr<MediaDescription> MakeAudioDescription() const;
+
+	std::shared_ptr<PayloadAttr> MakePayloadAttr(const std::shared_ptr<const MediaTrack> &track) const;
+	std::shared_ptr<PayloadAttr> MakeRtxPayloadAttr(const std::shared_ptr<const MediaTrack> &track) const;
+
+	void MakeRtpVideoHeader(const CodecSpecificInfo *info, RTPVideoHeader *rtp_video_header);
+	uint16_t AllocateVP8PictureID();
+
+	bool StorePacketForRTX(std::shared_ptr<RtpPacket> &packet);
+
+	void PushToJitterBuffer(const std::shared_ptr<MediaPacket> &media_packet);
+	void PacketizeVideoFrame(const std::shared_ptr<MediaPacket> &media_packet);
+	// The packets of a bypassed track from a WebRTC input can be relayed if the payload format is the same as the packetizer's
+	bool IsRelayable(const std::shared_ptr<const MediaTrack> &media_track, const std::shared_ptr<const MediaPacket> &media_packet) const;
+	void PacketizeAudioFrame(const std::shared_ptr<MediaPacket> &media_packet);
+	// Opus DTX frames are thinned out while the audio is silent (See RTC_STREAM_OPUS_DTX_INTERVAL_MS)
+	bool IsOpusDtxFrameToSkip(const std::shared_ptr<const MediaTrack> &media_track, const std::shared_ptr<const MediaPacket> &media_packet);
+
+	void AddPacketizer(const std::shared_ptr<const MediaTrack> &track);
+	std::shared_ptr<RtpPacketizer> GetPacketizer(uint32_t track_id);
+
+	uint64_t GetRtpHistoryKey(uint32_t track_id, uint8_t payload_type);
+	void AddRtpHistory(const std::shared_ptr<const MediaTrack> &track);
+	std::shared_ptr<RtpHistory> GetHistory(uint32_t track_id, uint8_t origin_payload_type);
+
+
+	uint32_t GetSsrc(cmn::MediaType media_type);
+
+	// SDP related info
+	ov::String _msid;
+	ov::String _cname;
+
+	// VP8 Picture ID
+	uint16_t _vp8_picture_id;
+
+	// VP9 Picture ID and TL0PICIDX of each track
+	struct Vp9PictureIndex
+	{
+		uint16_t picture_id = 0;
+		uint8_t tl0_pic_idx = 0;
+	};
+	std::map<uint32_t, Vp9PictureIndex> _vp9_picture_indexes;
+
+	std::shared_ptr<Certificate> _certificate;
+
+	// Track ID, Packetizer
+	std::shared_mutex _packetizers_lock;
+	std::map<uint32_t, std::shared_ptr<RtpPacketizer>> _packetizers;
+
+	// RtpHistoryKey, RtpHistory
+	std::unordered_map<uint64_t, std::shared_ptr<RtpHistory>> _rtp_history_map;
+
+	uint32_t _video_ssrc = 0;
+	uint32_t _video_rtx_ssrc = 0;
+	uint32_t _audio_ssrc = 0;
+
+	bool _rtx_enabled = true;
+	bool _ulpfec_enabled = true;
+	bool _jitter_buffer_enabled = false;
+	bool _playout_delay_enabled = false;
+	int _playout_delay_min = 0;
+	int _playout_delay_max = 0;
+
+	bool _transport_cc_enabled = false;
+	bool _remb_enabled = false;
+	bool _pacing_enabled = true;
+	// Sub-200ms mode (See cfg::vhost::app::pub::WebrtcPublisher::IsInteractive())
+	bool _interactive = false;
+	// See cfg::vhost::app::pub::WebrtcPublisher::IsRtpRelayEnabled()
+	bool _rtp_relay_enabled = false;
+	bool _audio_only = false;
+
+	// Track ID : PTS (ms) of the last DTX frame forwarded in the current silence (not in the map while the audio is not silent)
+	std::unordered_map<uint32_t, int64_t> _opus_dtx_sent_pts_ms;
+
+	uint32_t _worker_count = 0;
+
+	JitterBufferDelay	_jitter_buffer_delay;
+	// A traced packet in the jitter buffer, to report the delay of the jitter buffer
+	std::shared_ptr<MediaPacket> _jitter_buffer_traced_packet;
+	int64_t _jitter_buffer_traced_time_us = 0;
+
+	ov::String _default_playlist_name;
+
+	// Playlist File Name : SessionDescription
+	std::map<ov::String, std::shared_ptr<const SessionDescription>> _offer_sdp_map;
+	std::shared_mutex _offer_sdp_lock;
+
+	// Playlist File Name : RtcPlaylist
+	std::map<ov::String, std::shared_ptr<const RtcMasterPlaylist>> _rtc_master_playlist_map;
+	std::shared_mutex _rtc_master_playlist_map_lock;
 };
\ No newline at end of file
@@ -18,6 +18,11 @@
 #include "rtc_stream.h"
 #include "webrtc_publisher_signalling_interceptor.h"
 
+// The interval to send the paced packets
+#define WEBRTC_PUBLISHER_PACING_INTERVAL_MS	5
+// The time to wait for the answer of a WHEP client after the offer is sent
+#define WEBRTC_PUBLISHER_WHEP_OFFER_TIMEOUT_MS 30000
+
 std::shared_ptr<WebRtcPublisher> WebRtcPublisher::Create(const cfg::Server &server_config, const std::shared_ptr<MediaRouteInterface> &router)
 {
 	auto webrtc = std::make_shared<WebRtcPublisher>(server_config, router);
@@ -68,14 +73,30 @@ bool WebRtcPublisher::StartSignallingServer(const cfg::Server &server_config, co
 			server_config.GetIPList(),
 			is_port_configured, port_config.GetPort(),
 			is_tls_port_configured, tls_port_config.GetPort(),
-			worker_count, interceptor))
+			worker_count, interceptor) == false)
 	{
-		_signalling_server = std::move(signalling_server);
+		return false;
+	}
 
-		return true;
+	// WHEP (?direction=whep) is served on the same ports, without a WebSocket connection per viewer
+	auto whep_server = std::make_shared<WhipServer>(webrtc_bind_config, "whep");
+
+	if (whep_server->Start(
+			WhipObserver::GetSharedPtr(),
+			GetPublisherName(), "WhepSig",
+			server_config.GetIPList(),
+			is_port_configured, port_config.GetPort(),
+			is_tls_port_configured, tls_port_config.GetPort(),
+			worker_count) == false)
+	{
+		signalling_server->Stop();
+		return false;
 	}
 
-	return false;
+	_signalling_server = std::move(signalling_server);
+	_whep_server = std::move(whep_server);
+
+	return true;
 }
 
 bool WebRtcPublisher::StartICEPorts(const cfg::Server &server_config, const cfg::bind::cmm::Webrtc &webrtc_bind_config)
@@ -106,9 +127,26 @@ bool WebRtcPublisher::Start()
 		return true;
 	}
 
+	_certificate = std::make_shared<Certificate>();
+
+	auto error = _certificate->Generate();
+	if (error != nullptr)
+	{
+		logte("Cannot create certificate: %s", error->What());
+		return false;
+	}
+
 	if (StartSignallingServer(server_config, webrtc_bind_config) &&
 		StartICEPorts(server_config, webrtc_bind_config))
 	{
+		_pacing_timer.Push(
+			[this](void *parameter) -> ov::DelayQueueAction {
+				SendPacedPackets();
+				return ov::DelayQueueAction::Repeat;
+			},
+			WEBRTC_PUBLISHER_PACING_INTERVAL_MS);
+		_pacing_timer.Start();
+
 		return Publisher::Start();
 	}
 
@@ -116,6 +154,11 @@ bool WebRtcPublisher::Start()
 
 	_signalling_server->Stop();
 
+	if (_whep_server)
+	{
+		_whep_server->Stop();
+	}
+
 	IcePortManager::GetInstance()->Release(IcePortObserver::GetSharedPtr());
 
 	return false;
@@ -123,6 +166,8 @@ bool WebRtcPublisher::Start()
 
 bool WebRtcPublisher::Stop()
 {
+	_pacing_timer.Stop();
+
 	IcePortManager::GetInstance()->Release(IcePortObserver::GetSharedPtr());
 
 	if (_signalling_server)
@@ -131,9 +176,51 @@ bool WebRtcPublisher::Stop()
 		_signalling_server->Stop();
 	}
 
+	if (_whep_server)
+	{
+		_whep_server->Stop();
+	}
+
 	return Publisher::Stop();
 }
 
+void WebRtcPublisher::RequestPacing(const std::shared_ptr<RtcSession> &session)
+{
+	std::lock_guard<std::mutex> lock(_pacing_sessions_lock);
+	_pacing_sessions.emplace(session->GetId(), session);
+}
+
+void WebRtcPublisher::SendPacedPackets()
+{
+	std::unique_lock<std::mutex> lock(_pacing_sessions_lock);
+	auto pacing_sessions = _pacing_sessions;
+	lock.unlock();
+
+	std::vector<session_id_t> completed_session_ids;
+
+	for (const auto &[session_id, weak_session] : pacing_sessions)
+	{
+		auto session = weak_session.lock();
+
+		// Remove the session if the queue is empty or the session is stopped
+		if (session == nullptr || session->SendPacedPackets() == false)
+		{
+			completed_session_ids.push_back(session_id);
+		}
+	}
+
+	if (completed_session_ids.empty())
+	{
+		return;
+	}
+
+	lock.lock();
+	for (const auto &session_id : completed_session_ids)
+	{
+		_pacing_sessions.erase(session_id);
+	}
+}
+
 bool WebRtcPublisher::DisconnectSessionInternal(const std::shared_ptr<RtcSession> &session)
 {
 	auto stream = std::dynamic_pointer_cast<RtcStream>(session->GetStream());
@@ -149,6 +236,11 @@ bool WebRtcPublisher::DisconnectSessionInternal(const std::shared_ptr<RtcSession
 
 bool WebRtcPublisher::OnCreateHost(const info::Host &host_info)
 {
+	if (_whep_server != nullptr && host_info.GetCertificate() != nullptr)
+	{
+		_whep_server->InsertCertificate(host_info.GetCertificate());
+	}
+
 	if (_signalling_server != nullptr && host_info.GetCertificate() != nullptr)
 	{
 		return _signalling_server->InsertCertificate(host_info.GetCertificate());
@@ -159,6 +251,11 @@ bool WebRtcPublisher::OnCreateHost(const info::Host &host_info)
 
 bool WebRtcPublisher::OnDeleteHost(const info::Host &host_info)
 {
+	if (_whep_server != nullptr && host_info.GetCertificate() != nullptr)
+	{
+		_whep_server->RemoveCertificate(host_info.GetCertificate());
+	}
+
 	if (_signalling_server != nullptr && host_info.GetCertificate() != nullptr)
 	{
 		return _signalling_server->RemoveCertificate(host_info.GetCertificate());
@@ -168,6 +265,11 @@ bool WebRtcPublisher::OnDeleteHost(const info::Host &host_info)
 
 bool WebRtcPublisher::OnUpdateCertificate(const info::Host &host_info)
 {
+	if (_whep_server != nullptr && host_info.GetCertificate() != nullptr)
+	{
+		_whep_server->InsertCertificate(host_info.GetCertificate());
+	}
+
 	if (_signalling_server != nullptr && host_info.GetCertificate() != nullptr)
 	{
 		return _signalling_server->InsertCertificate(host_info.GetCertificate());
@@ -183,11 +285,27 @@ std::shared_ptr<pub::Application> WebRtcPublisher::OnCreatePublisherApplication(
 		return nullptr;
 	}
 
-	return RtcApplication::Create(pub::Publisher::GetSharedPtrAs<pub::Publisher>(), application_info, _ice_port, _signalling_server);
+	if (_whep_server != nullptr)
+	{
+		auto cross_domains = application_info.GetConfig().GetPublishers().GetWebrtcPublisher().GetCrossDomainList();
+		if (cross_domains.empty())
+		{
+			// WHEP is requested by the players in browsers, so allow all domains unless it is configured
+			cross_domains.push_back("*");
+		}
+		_whep_server->SetCors(application_info.GetName(), cross_domains);
+	}
+
+	return RtcApplication::Create(pub::Publisher::GetSharedPtrAs<pub::Publisher>(), application_info, _certificate, _ice_port, _signalling_server);
 }
 
 bool WebRtcPublisher::OnDeletePublisherApplication(const std::shared_ptr<pub::Application> &application)
 {
+	if (_whep_server != nullptr)
+	{
+		_whep_server->EraseCors(application->GetName());
+	}
+
 	return true;
 }
 
@@ -199,19 +317,54 @@ bool WebRtcPublisher::OnDeletePublisherApplication(const std::shared_ptr<pub::Ap
 std::shared_ptr<const SessionDescription> WebRtcPublisher::OnRequestOffer(const std::shared_ptr<http::svr::ws::WebSocketSession> &ws_session,
 																		  const info::VHostAppName &vhost_app_name, const ov::String &host_name, const ov::String &stream_name,
 																		  std::vector<RtcIceCandidate> *ice_candidates, bool &tcp_relay)
+{
+	auto orchestrator = ocst::Orchestrator::GetInstance();
+	if (orchestrator->IsDraining())
+	{
+		// RtcSignallingServer responds 503 with the URL of an alternative server (empty if there is no alternative)
+		auto redirect_url = orchestrator->GetDrainRedirectUrl(ws_session->GetRequest()->GetParsedUri());
+		ws_session->AddUserData("drain_redirect", (redirect_url != nullptr) ? redirect_url->ToUrlString(true) : ov::String(""));
+
+		return nullptr;
+	}
+
+	OfferContext context;
+	http::StatusCode status_code;
+
+	auto session_description = CreateOffer(ws_session->GetRequest(), vhost_app_name, host_name, stream_name, ice_candidates, tcp_relay, context, status_code);
+	if (session_description == nullptr)
+	{
+		return nullptr;
+	}
+
+	// Passed AccessControl
+	ws_session->AddUserData("authorized", true);
+	ws_session->AddUserData("final_url", context.final_url->ToUrlString(true));
+	ws_session->AddUserData("requested_url", context.requested_url->ToUrlString(true));
+	ws_session->AddUserData("stream_expired", context.session_life_time);
+
+	return session_description;
+}
+
+std::shared_ptr<SessionDescription> WebRtcPublisher::CreateOffer(const std::shared_ptr<const http::svr::HttpRequest> &request,
+																 const info::VHostAppName &vhost_app_name, const ov::String &host_name, const ov::String &stream_name,
+																 std::vector<RtcIceCandidate> *ice_candidates, bool &tcp_relay,
+																 OfferContext &context, http::StatusCode &status_code)
 {
 	info::VHostAppName final_vhost_app_name = vhost_app_name;
 	ov::String final_host_name = host_name;
 	ov::String final_stream_name = stream_name;
 
 	[[maybe_unused]] RequestStreamResult result = RequestStreamResult::init;
-	auto request = ws_session->GetRequest();
+	status_code = http::StatusCode::Unauthorized;
+
 	auto remote_address = request->GetRemote()->GetRemoteAddress();
 	auto uri = request->GetUri();
 	auto final_url = ov::Url::Parse(uri);
 	if (final_url == nullptr)
 	{
 		logte("Could not parse the url: %s", uri.CStr());
+		status_code = http::StatusCode::BadRequest;
 		return nullptr;
 	}
 
@@ -325,6 +478,8 @@ std::shared_ptr<const SessionDescription> WebRtcPublisher::OnRequestOffer(const
 		result = RequestStreamResult::local_success;
 	}
 
+	status_code = http::StatusCode::NotFound;
+
 	if (stream == nullptr)
 	{
 		logte("Cannot find stream (%s/%s)", final_vhost_app_name.CStr(), final_stream_name.CStr());
@@ -363,13 +518,13 @@ std::shared_ptr<const SessionDescription> WebRtcPublisher::OnRequestOffer(const
 
 	session_description->SetOrigin("OvenMediaEngine", ov::Unique::GenerateUint32(), 2, "IN", 4, "127.0.0.1");
 	session_description->SetIceUfrag(_ice_port->GenerateUfrag());
-	session_description->Update();
+	// The media sections of the stream's offer are reused as they are
+	session_description->UpdateSessionLevel();
 
 	// Passed AccessControl
-	ws_session->AddUserData("authorized", true);
-	ws_session->AddUserData("final_url", final_url->ToUrlString(true));
-	ws_session->AddUserData("requested_url", requested_url->ToUrlString(true));
-	ws_session->AddUserData("stream_expired", session_life_time);
+	context.requested_url = requested_url;
+	context.final_url = final_url;
+	context.session_life_time = session_life_time;
 
 	return session_description;
 }
@@ -435,14 +590,18 @@ bool WebRtcPublisher::OnAddRemoteDescription(const std::shared_ptr<http::svr::ws
 		return false;
 	}
 
+	return CreateSession(ws_session, requested_url, final_url, session_life_time, offer_sdp, peer_sdp) != nullptr;
+}
+
+std::shared_ptr<RtcSession> WebRtcPublisher::CreateSession(const std::shared_ptr<http::svr::ws::WebSocketSession> &ws_session,
+														   const std::shared_ptr<ov::Url> &requested_url, const std::shared_ptr<ov::Url> &final_url, uint64_t session_life_time,
+														   const std::shared_ptr<const SessionDescription> &offer_sdp,
+														   const std::shared_ptr<const SessionDescription> &peer_sdp)
+{
 	auto final_vhost_app_name = ocst::Orchestrator::GetInstance()->ResolveApplicationNameFromDomain(final_url->Host(), final_url->App());
 	auto final_stream_name = final_url->Stream();
 	auto final_file_name = final_url->File();
 
-	// SignedPolicy and SignedToken
-	auto request = ws_session->GetRequest();
-	auto remote_address = request->GetRemote()->GetRemoteAddress();
-
 	ov::String remote_sdp_text = peer_sdp->ToString();
 	logtd("OnAddRemoteDescription: %s", remote_sdp_text.CStr());
 
@@ -451,7 +610,7 @@ bool WebRtcPublisher::OnAddRemoteDescription(const std::shared_ptr<http::svr::ws
 	if (!stream)
 	{
 		logte("Cannot find stream (%s/%s)", final_vhost_app_name.CStr(), final_stream_name.CStr());
-		return false;
+		return nullptr;
 	}
 
 	auto session = RtcSession::Create(Publisher::GetSharedPtrAs<WebRtcPublisher>(), application, stream, final_file_name, offer_sdp, peer_sdp, _ice_port, ws_session);
@@ -468,10 +627,10 @@ bool WebRtcPublisher::OnAddRemoteDescription(const std::shared_ptr<http::svr::ws
 	else
 	{
 		logte("Cannot create session for (%s/%s/%s)", final_vhost_app_name.CStr(), final_stream_name.CStr(), final_file_name.CStr());
-		return false;
+		return nullptr;
 	}
 
-	return true;
+	return session;
 }
 
 bool WebRtcPublisher::OnChangeRendition(const std::shared_ptr<http::svr::ws::WebSocketSession> &ws_session,
@@ -608,6 +767,194 @@ bool WebRtcPublisher::OnIceCandidate(const std::shared_ptr<http::svr::ws::WebSoc
 	return true;
 }
 
+/*
+ * WHEP Implementation
+ */
+
+// Called when a WHEP client requests the offer (POST without a body)
+WhipObserver::Answer WebRtcPublisher::OnSdpOffer(const std::shared_ptr<const http::svr::HttpRequest> &request,
+												 const std::shared_ptr<const SessionDescription> &offer_sdp)
+{
+	if (offer_sdp != nullptr)
+	{
+		// The packetizers of the stream use the payload types of OME, so the offer must be made by OME
+		return {http::StatusCode::NotAcceptable, "OvenMediaEngine makes the offer: POST without a body, then PATCH the answer (application/sdp) to the Location"};
+	}
+
+	auto requested_url = request->GetParsedUri();
+	if (requested_url == nullptr || requested_url->Host().IsEmpty() || requested_url->App().IsEmpty() || requested_url->Stream().IsEmpty())
+	{
+		return {http::StatusCode::BadRequest, "Invalid URI"};
+	}
+
+	auto vhost_app_name = ocst::Orchestrator::GetInstance()->ResolveApplicationNameFromDomain(requested_url->Host(), requested_url->App());
+
+	std::vector<RtcIceCandidate> ice_candidates;
+	bool tcp_relay = false;
+	OfferContext context;
+	http::StatusCode status_code;
+
+	auto session_description = CreateOffer(request, vhost_app_name, requested_url->Host(), requested_url->Stream(), &ice_candidates, tcp_relay, context, status_code);
+	if (session_description == nullptr)
+	{
+		return {status_code, "Could not create the offer"};
+	}
+
+	// There is no trickle ICE, so the candidates are written in the offer
+	for (const auto &candidate : ice_candidates)
+	{
+		session_description->AddBundleIceCandidate(std::make_shared<IceCandidate>(candidate));
+	}
+	session_description->UpdateSessionLevel();
+
+	auto whep_session = std::make_shared<WhepSession>();
+	whep_session->offer_sdp = session_description;
+	whep_session->context = context;
+	whep_session->remote_address = request->GetRemote()->GetRemoteAddress();
+	whep_session->user_agent = request->GetHeader("USER-AGENT");
+
+	auto session_key = ov::Random::GenerateString(16);
+	auto now = ov::Clock::NowMSec();
+
+	{
+		std::lock_guard<std::mutex> lock(_whep_sessions_lock);
+
+		// Forget the offers that have not been answered in time
+		while (_whep_offer_expiry_queue.empty() == false)
+		{
+			auto &[expired_time, expired_key] = _whep_offer_expiry_queue.front();
+			if (expired_time > now)
+			{
+				break;
+			}
+
+			auto item = _whep_sessions.find(expired_key);
+			if ((item != _whep_sessions.end()) && (item->second->answered == false))
+			{
+				_whep_sessions.erase(item);
+			}
+
+			_whep_offer_expiry_queue.pop_front();
+		}
+
+		_whep_sessions.emplace(session_key, whep_session);
+		_whep_offer_expiry_queue.emplace_back(now + WEBRTC_PUBLISHER_WHEP_OFFER_TIMEOUT_MS, session_key);
+	}
+
+	return {session_key, ov::Random::GenerateString(8), session_description, context.final_url->Host(), context.final_url->App(), http::StatusCode::Created};
+}
+
+// Called when a WHEP client PATCHes the answer
+WhipObserver::Answer WebRtcPublisher::OnSdpAnswer(const std::shared_ptr<const http::svr::HttpRequest> &request,
+												  const ov::String &session_key,
+												  const std::shared_ptr<const SessionDescription> &answer_sdp)
+{
+	std::shared_ptr<WhepSession> whep_session;
+
+	{
+		std::lock_guard<std::mutex> lock(_whep_sessions_lock);
+
+		auto item = _whep_sessions.find(session_key);
+		if (item == _whep_sessions.end())
+		{
+			return {http::StatusCode::NotFound, "Could not find the session"};
+		}
+
+		whep_session = item->second;
+		if (whep_session->answered)
+		{
+			return {http::StatusCode::Conflict, "The answer is already received"};
+		}
+
+		whep_session->answered = true;
+	}
+
+	auto &context = whep_session->context;
+	auto session = CreateSession(nullptr, context.requested_url, context.final_url, context.session_life_time, whep_session->offer_sdp, answer_sdp);
+
+	std::unique_lock<std::mutex> lock(_whep_sessions_lock);
+
+	auto item = _whep_sessions.find(session_key);
+	if (session == nullptr)
+	{
+		if (item != _whep_sessions.end())
+		{
+			_whep_sessions.erase(item);
+		}
+
+		return {http::StatusCode::InternalServerError, "Could not create the session"};
+	}
+
+	whep_session->session = session;
+
+	if (item == _whep_sessions.end())
+	{
+		// Deleted while the session was being created
+		lock.unlock();
+		CloseWhepSession(whep_session);
+
+		return {http::StatusCode::NotFound, "Could not find the session"};
+	}
+
+	_whep_session_keys.emplace(session->GetId(), session_key);
+
+	return {http::StatusCode::NoContent, ""};
+}
+
+WhipObserver::Answer WebRtcPublisher::OnSessionDelete(const std::shared_ptr<const http::svr::HttpRequest> &request,
+													  const ov::String &session_key)
+{
+	std::unique_lock<std::mutex> lock(_whep_sessions_lock);
+
+	auto item = _whep_sessions.find(session_key);
+	if (item == _whep_sessions.end())
+	{
+		return {http::StatusCode::NotFound, "Could not find the session"};
+	}
+
+	auto whep_session = item->second;
+	_whep_sessions.erase(item);
+
+	if (whep_session->session != nullptr)
+	{
+		_whep_session_keys.erase(whep_session->session->GetId());
+	}
+
+	lock.unlock();
+
+	CloseWhepSession(whep_session);
+
+	auto &final_url = whep_session->context.final_url;
+
+	return {http::StatusCode::OK, final_url->Host(), final_url->App()};
+}
+
+void WebRtcPublisher::CloseWhepSession(const std::shared_ptr<WhepSession> &whep_session)
+{
+	auto &session = whep_session->session;
+	if (session == nullptr)
+	{
+		// Not answered yet
+		return;
+	}
+
+	logti("WHEP session is closed : (%s/%s/%u)", session->GetStream()->GetApplicationName(), session->GetStream()->GetName().CStr(), session->GetId());
+
+	// Send Close to Admission Webhooks
+	auto &requested_url = whep_session->context.requested_url;
+	auto &final_url = whep_session->context.final_url;
+	if (whep_session->remote_address && requested_url && final_url)
+	{
+		auto request_info = std::make_shared<AccessController::RequestInfo>(requested_url, whep_session->remote_address, requested_url->ToUrlString(true) == final_url->ToUrlString(true) ? nullptr : final_url, whep_session->user_agent);
+
+		SendCloseAdmissionWebhooks(request_info);
+	}
+
+	DisconnectSessionInternal(session);
+
+	_ice_port->RemoveSession(session->GetId());
+}
+
 /*
  * IcePort Implementation
  */
@@ -644,6 +991,36 @@ void WebRtcPublisher::OnStateChanged(IcePort &port, uint32_t session_id, IcePort
 		case IcePortConnectionState::Closed: {
 			logti("IcePort is disconnected. : (%s/%s/%u) reason(%d)", stream->GetApplicationName(), stream->GetName().CStr(), session->GetId(), state);
 
+			if (session->GetWSClient() == nullptr)
+			{
+				// WHEP session, which has no signalling connection to close
+				std::shared_ptr<WhepSession> whep_session;
+
+				{
+					std::lock_guard<std::mutex> lock(_whep_sessions_lock);
+
+					auto key_item = _whep_session_keys.find(session->GetId());
+					if (key_item != _whep_session_keys.end())
+					{
+						auto item = _whep_sessions.find(key_item->second);
+						if (item != _whep_sessions.end())
+						{
+							whep_session = item->second;
+							_whep_sessions.erase(item);
+						}
+
+						_whep_session_keys.erase(key_item);
+					}
+				}
+
+				if (whep_session != nullptr)
+				{
+					CloseWhepSession(whep_session);
+				}
+
+				break;
+			}
+
 			_signalling_server->Disconnect(session->GetApplication()->GetName(), session->GetStream()->GetName(), session->GetPeerSDP());
 
 			//DisconnectSessionInternal(session);
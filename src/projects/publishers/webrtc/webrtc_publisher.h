@@ -15,11 +15,13 @@
 #include "base/ovlibrary/delay_queue.h"
 #include "base/ovlibrary/message_thread.h"
 #include "base/publisher/publisher.h"
+#include "modules/whip/whip_server.h"
 #include "rtc_application.h"
 
 class WebRtcPublisher : public pub::Publisher,
 						public IcePortObserver,
-						public RtcSignallingObserver
+						public RtcSignallingObserver,
+						public WhipObserver
 {
 public:
 	static std::shared_ptr<WebRtcPublisher> Create(const cfg::Server &server_config, const std::shared_ptr<MediaRouteInterface> &router);
@@ -29,6 +31,9 @@ public:
 
 	bool Stop() override;
 
+	// The session has the packets that are not sent yet in the pacer, they are sent by the pacing timer
+	void RequestPacing(const std::shared_ptr<RtcSession> &session);
+
 	// IcePortObserver Implementation
 	void OnStateChanged(IcePort &port, uint32_t session_id, IcePortConnectionState state, std::any user_data) override;
 	void OnDataReceived(IcePort &port, uint32_t session_id, std::shared_ptr<const ov::Data> data, std::any user_data) override;
@@ -57,6 +62,15 @@ public:
 					   const std::shared_ptr<const SessionDescription> &offer_sdp,
 					   const std::shared_ptr<const SessionDescription> &peer_sdp) override;
 
+	// WhipObserver Implementation (WHEP)
+	WhipObserver::Answer OnSdpOffer(const std::shared_ptr<const http::svr::HttpRequest> &request,
+									const std::shared_ptr<const SessionDescription> &offer_sdp) override;
+	WhipObserver::Answer OnSdpAnswer(const std::shared_ptr<const http::svr::HttpRequest> &request,
+									 const ov::String &session_key,
+									 const std::shared_ptr<const SessionDescription> &answer_sdp) override;
+	WhipObserver::Answer OnSessionDelete(const std::shared_ptr<const http::svr::HttpRequest> &request,
+										 const ov::String &session_key) override;
+
 protected:
 	bool StartSignallingServer(const cfg::Server &server_config, const cfg::bind::cmm::Webrtc &webrtc_bind_config);
 	bool StartICEPorts(const cfg::Server &server_config, const cfg::bind::cmm::Webrtc &webrtc_bind_config);
@@ -77,9 +91,43 @@ private:
 		transfer_completed,
 	};
 
+	// The result of the access control of a playback request
+	struct OfferContext
+	{
+		std::shared_ptr<ov::Url> requested_url;
+		std::shared_ptr<ov::Url> final_url;
+		uint64_t session_life_time = 0;
+	};
+
+	// A viewer that is signalled with WHEP
+	struct WhepSession
+	{
+		std::shared_ptr<const SessionDescription> offer_sdp;
+		OfferContext context;
+		std::shared_ptr<ov::SocketAddress> remote_address;
+		ov::String user_agent;
+
+		bool answered = false;
+		// nullptr until the answer is received
+		std::shared_ptr<RtcSession> session;
+	};
+
 	bool Start() override;
 	bool DisconnectSessionInternal(const std::shared_ptr<RtcSession> &session);
 
+	// Verifies the request and makes the offer for the requested stream (<status_code> is set if failed)
+	std::shared_ptr<SessionDescription> CreateOffer(const std::shared_ptr<const http::svr::HttpRequest> &request,
+													const info::VHostAppName &vhost_app_name, const ov::String &host_name, const ov::String &stream_name,
+													std::vector<RtcIceCandidate> *ice_candidates, bool &tcp_relay,
+													OfferContext &context, http::StatusCode &status_code);
+	// <ws_session> is nullptr for WHEP
+	std::shared_ptr<RtcSession> CreateSession(const std::shared_ptr<http::svr::ws::WebSocketSession> &ws_session,
+											  const std::shared_ptr<ov::Url> &requested_url, const std::shared_ptr<ov::Url> &final_url, uint64_t session_life_time,
+											  const std::shared_ptr<const SessionDescription> &offer_sdp,
+											  const std::shared_ptr<const SessionDescription> &peer_sdp);
+	void CloseWhepSession(const std::shared_ptr<WhepSession> &whep_session);
+	void SendPacedPackets();
+
 	//--------------------------------------------------------------------
 	// Implementation of Publisher
 	//--------------------------------------------------------------------
@@ -104,7 +152,23 @@ private:
 
 	std::shared_ptr<IcePort> _ice_port;
 	std::shared_ptr<RtcSignallingServer> _signalling_server;
+	std::shared_ptr<WhipServer> _whep_server;
+	// ECDSA (P-256) certificate for DTLS, shared by all applications
+	std::shared_ptr<Certificate> _certificate;
 
 	// for special purpose log - Deprecated
 	// ov::DelayQueue _timer;
+
+	ov::DelayQueue _pacing_timer{"RtcPacer"};
+	// session id : session
+	std::map<session_id_t, std::weak_ptr<RtcSession>> _pacing_sessions;
+	std::mutex _pacing_sessions_lock;
+
+	std::mutex _whep_sessions_lock;
+	// session key (in the Location of WHEP) : WHEP session
+	std::unordered_map<ov::String, std::shared_ptr<WhepSession>> _whep_sessions;
+	// session id : session key
+	std::unordered_map<session_id_t, ov::String> _whep_session_keys;
+	// (expiry time, session key) of the offers in the order they were sent
+	std::deque<std::pair<uint64_t, ov::String>> _whep_offer_expiry_queue;
 };
@@ -9,6 +9,7 @@
 #pragma once
 
 #include "../transcoder_context.h"
+#include "../transcoder_pipeline_scheduler.h"
 
 extern "C"
 {
@@ -31,6 +32,7 @@ extern "C"
 #include <algorithm>
 #include <cstdint>
 #include <memory>
+#include <optional>
 #include <thread>
 #include <vector>
 
@@ -64,6 +66,33 @@ public:
 
 	virtual void SendBuffer(std::shared_ptr<const InputType> buf) = 0;
 
+	// Average waiting time of the inputs in the queue
+	int64_t GetInputWaitingTimeInUs() const
+	{
+		return _input_buffer.GetWaitingTimeInUs();
+	}
+
 protected:
-	ov::ManagedQueue<std::shared_ptr<const InputType>> _input_buffer;
+	// Waits for an input on the codec thread, but returns immediately on TranscodePipelineScheduler
+	std::optional<std::shared_ptr<const InputType>> DequeueInput()
+	{
+		auto input = _input_buffer.Dequeue((_pipeline_stage != nullptr) ? 0 : ov::Infinite);
+
+		if (input.has_value() && (input.value() != nullptr))
+		{
+			OnInputDequeued(*input.value());
+		}
+
+		return input;
+	}
+
+	// Called when an input is taken out of _input_buffer
+	virtual void OnInputDequeued(const InputType &input)
+	{
+	}
+
+	ov::ManagedQueue<std::shared_ptr<const InputType>, ov::ManagedQueueRingBuffer<512>> _input_buffer;
+
+	// Not nullptr if the codec runs as a stage of TranscodePipelineScheduler instead of its own thread
+	std::shared_ptr<TranscodePipelineScheduler::Stage> _pipeline_stage;
 };
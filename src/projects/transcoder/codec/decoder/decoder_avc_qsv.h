@@ -25,5 +25,5 @@ public:
 
 	bool Configure(std::shared_ptr<MediaTrack> context) override;
 
-	void CodecThread() override;
+	TranscodeStepResult ProcessStep() override;
 };
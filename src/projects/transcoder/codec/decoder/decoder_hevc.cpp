@@ -34,12 +34,16 @@ bool DecoderHEVC::Configure(std::shared_ptr<MediaTrack> context)
 
 	_context->time_base = ffmpeg::Conv::TimebaseToAVRational(GetTimebase());
 
+	SetThreadingParams();
+
 	if (::avcodec_open2(_context, _codec, nullptr) < 0)
 	{
 		logte("Could not open codec: %s (%d)", ::avcodec_get_name(GetCodecID()), GetCodecID());
 		return false;
 	}
 
+	UpdateCodecMetrics();
+
 	// Create packet parser
 	_parser = ::av_parser_init(_codec->id);
 	if (_parser == nullptr)
@@ -50,184 +54,179 @@ bool DecoderHEVC::Configure(std::shared_ptr<MediaTrack> context)
 
 	_parser->flags |= PARSER_FLAG_COMPLETE_FRAMES;
 
-	// Generates a thread that reads and encodes frames in the input_buffer queue and places them in the output queue.
-	try
-	{
-		_kill_flag = false;
-
-		_codec_thread = std::thread(&TranscodeDecoder::CodecThread, this);
-		pthread_setname_np(_codec_thread.native_handle(), ov::String::FormatString("Dec%s", avcodec_get_name(GetCodecID())).CStr());
-	}
-	catch (const std::system_error &e)
+	if (StartCodec(ov::String::FormatString("Dec%s", avcodec_get_name(GetCodecID()))) == false)
 	{
-		logte("Failed to start decoder thread");
-		_kill_flag = true;
 		return false;
 	}
 
 	return true;
 }
 
-void DecoderHEVC::CodecThread()
+TranscodeStepResult DecoderHEVC::ProcessStep()
 {
-	while (!_kill_flag)
+	auto obj = DequeueInput();
+	if (obj.has_value() == false)
 	{
-		auto obj = _input_buffer.Dequeue();
-		if (obj.has_value() == false)
-		{
-			// logte("An error occurred while dequeue : no data");
-			continue;
-		}
+		// logte("An error occurred while dequeue : no data");
+		return TranscodeStepResult::NoInput;
+	}
 
-		auto buffer = std::move(obj.value());
+	auto buffer = std::move(obj.value());
 
-		auto packet_data = buffer->GetData();
+	auto packet_data = buffer->GetData();
 
-		int64_t remained_size = packet_data->GetLength();
-		off_t offset = 0LL;
-		int64_t pts = (buffer->GetPts() == -1LL) ? AV_NOPTS_VALUE : buffer->GetPts();
-		int64_t dts = (buffer->GetDts() == -1LL) ? AV_NOPTS_VALUE : buffer->GetDts();
-		[[maybe_unused]] int64_t duration = (buffer->GetDuration() == -1LL) ? AV_NOPTS_VALUE : buffer->GetDuration();
+	int64_t remained_size = packet_data->GetLength();
+	off_t offset = 0LL;
+	int64_t pts = (buffer->GetPts() == -1LL) ? AV_NOPTS_VALUE : buffer->GetPts();
+	int64_t dts = (buffer->GetDts() == -1LL) ? AV_NOPTS_VALUE : buffer->GetDts();
+	[[maybe_unused]] int64_t duration = (buffer->GetDuration() == -1LL) ? AV_NOPTS_VALUE : buffer->GetDuration();
 
-		auto data = packet_data->GetDataAs<uint8_t>();
+	auto data = packet_data->GetDataAs<uint8_t>();
 
-		while (remained_size > 0)
-		{
-			::av_packet_unref(_pkt);
+	while (remained_size > 0)
+	{
+		::av_packet_unref(_pkt);
 
-			int parsed_size = ::av_parser_parse2(_parser, _context, &_pkt->data, &_pkt->size,
-												 data + offset, static_cast<int>(remained_size), pts, dts, 0);
+		int parsed_size = ::av_parser_parse2(_parser, _context, &_pkt->data, &_pkt->size,
+											 data + offset, static_cast<int>(remained_size), pts, dts, 0);
 
-			if (parsed_size < 0)
+		if (parsed_size < 0)
+		{
+			logte("An error occurred while parsing: %d", parsed_size);
+			break;
+		}
+
+		if (_pkt->size > 0)
+		{
+			_pkt->pts = _parser->pts;
+			_pkt->dts = _parser->dts;
+			_pkt->flags = (_parser->key_frame == 1) ? AV_PKT_FLAG_KEY : 0;
+			_pkt->duration = _pkt->dts - _parser->last_dts;
+			if (_pkt->duration <= 0LL)
 			{
-				logte("An error occurred while parsing: %d", parsed_size);
-				break;
+				// It may not be the exact packet duration.
+				// However, in general, this method is applied under the assumption that the duration of all packets is similar.
+				_pkt->duration = duration;
 			}
 
-			if (_pkt->size > 0)
+			int ret = ::avcodec_send_packet(_context, _pkt);
+			if (ret == 0)
 			{
-				_pkt->pts = _parser->pts;
-				_pkt->dts = _parser->dts;
-				_pkt->flags = (_parser->key_frame == 1) ? AV_PKT_FLAG_KEY : 0;
-				_pkt->duration = _pkt->dts - _parser->last_dts;
-				if (_pkt->duration <= 0LL)
-				{
-					// It may not be the exact packet duration.
-					// However, in general, this method is applied under the assumption that the duration of all packets is similar.
-					_pkt->duration = duration;
-				}
-
-				int ret = ::avcodec_send_packet(_context, _pkt);
-
-				if (ret == AVERROR(EAGAIN))
-				{
-					// Need more data
-				}
-				else if (ret == AVERROR_EOF)
-				{
-					logte("An error occurred while sending a packet for decoding: End of file (%d)", ret);
-					break;
-				}
-				else if (ret == AVERROR(EINVAL))
-				{
-					logte("An error occurred while sending a packet for decoding: Invalid argument (%d)", ret);
-					break;
-				}
-				else if (ret == AVERROR(ENOMEM))
-				{
-					logte("An error occurred while sending a packet for decoding: No memory (%d)", ret);
-					break;
-				}
-				else if (ret == AVERROR_INVALIDDATA)
-				{
-					// If only SPS/PPS Nalunit is entered in the decoder, an invalid data error occurs.
-					// There is no particular problem.
-					logtd("Invalid data found when processing input (%d)", ret);
-					break;
-				}
-				else if (ret < 0)
-				{
-					char err_msg[1024];
-					av_strerror(ret, err_msg, sizeof(err_msg));
-					logte("An error occurred while sending a packet for decoding: Unhandled error (%d:%s) ", ret, err_msg);
-				}
+				OnPacketSent(_pkt->pts);
 			}
 
-			OV_ASSERT(
-				remained_size >= parsed_size,
-				"Current data size MUST greater than parsed_size, but data size: %ld, parsed_size: %ld",
-				remained_size, parsed_size);
-
-			offset += parsed_size;
-			remained_size -= parsed_size;
-		}
-
-		///////////////////////////////
-		// Receive from decoder
-		///////////////////////////////
-		while (true)
-		{
-			// Check the decoded frame is available
-			int ret = ::avcodec_receive_frame(_context, _frame);
-
 			if (ret == AVERROR(EAGAIN))
 			{
-				break;
+				// Need more data
 			}
 			else if (ret == AVERROR_EOF)
 			{
-				logtw("Error receiving a packet for decoding : AVERROR_EOF");
+				logte("An error occurred while sending a packet for decoding: End of file (%d)", ret);
 				break;
 			}
-			else if (ret < 0)
+			else if (ret == AVERROR(EINVAL))
+			{
+				logte("An error occurred while sending a packet for decoding: Invalid argument (%d)", ret);
+				break;
+			}
+			else if (ret == AVERROR(ENOMEM))
 			{
-				logte("Error receiving a packet for decoding : %d", ret);
+				logte("An error occurred while sending a packet for decoding: No memory (%d)", ret);
 				break;
 			}
-			else
+			else if (ret == AVERROR_INVALIDDATA)
+			{
+				// If only SPS/PPS Nalunit is entered in the decoder, an invalid data error occurs.
+				// There is no particular problem.
+				logtd("Invalid data found when processing input (%d)", ret);
+				break;
+			}
+			else if (ret < 0)
 			{
-				bool need_to_change_notify = false;
+				char err_msg[1024];
+				av_strerror(ret, err_msg, sizeof(err_msg));
+				logte("An error occurred while sending a packet for decoding: Unhandled error (%d:%s) ", ret, err_msg);
+			}
+		}
 
-				// Update codec information if needed
-				if (_change_format == false)
-				{
-					ret = ::avcodec_parameters_from_context(_codec_par, _context);
-
-					if (ret == 0)
-					{
-						auto codec_info = ShowCodecParameters(_context, _codec_par);
-						logti("[%s/%s(%u)] input track information: %s",
-							  _stream_info.GetApplicationInfo().GetName().CStr(),
-							  _stream_info.GetName().CStr(),
-							  _stream_info.GetId(),
-							  codec_info.CStr());
-
-						_change_format = true;
-
-						// If the format is changed, notify to another module
-						need_to_change_notify = true;
-					}
-					else
-					{
-						logte("Could not obtain codec parameters from context %p", _context);
-					}
-				}
+		OV_ASSERT(
+			remained_size >= parsed_size,
+			"Current data size MUST greater than parsed_size, but data size: %ld, parsed_size: %ld",
+			remained_size, parsed_size);
+
+		offset += parsed_size;
+		remained_size -= parsed_size;
+	}
+
+	///////////////////////////////
+	// Receive from decoder
+	///////////////////////////////
+	while (true)
+	{
+		// Check the decoded frame is available
+		int ret = ::avcodec_receive_frame(_context, _frame);
+
+		if (ret == AVERROR(EAGAIN))
+		{
+			break;
+		}
+		else if (ret == AVERROR_EOF)
+		{
+			logtw("Error receiving a packet for decoding : AVERROR_EOF");
+			break;
+		}
+		else if (ret < 0)
+		{
+			logte("Error receiving a packet for decoding : %d", ret);
+			break;
+		}
+		else
+		{
+			bool need_to_change_notify = false;
+
+			// Update codec information if needed
+			if (_change_format == false)
+			{
+				ret = ::avcodec_parameters_from_context(_codec_par, _context);
 
-				// If there is no duration, the duration is calculated by framerate and timebase.
-				if(_frame->pkt_duration <= 0LL && _context->framerate.num > 0 && _context->framerate.den > 0)
+				if (ret == 0)
 				{
-					_frame->pkt_duration = (int64_t)( ((double)_context->framerate.den / (double)_context->framerate.num) / ((double) GetRefTrack()->GetTimeBase().GetNum() / (double) GetRefTrack()->GetTimeBase().GetDen()) );
+					auto codec_info = ShowCodecParameters(_context, _codec_par);
+					logti("[%s/%s(%u)] input track information: %s",
+						  _stream_info.GetApplicationInfo().GetName().CStr(),
+						  _stream_info.GetName().CStr(),
+						  _stream_info.GetId(),
+						  codec_info.CStr());
+
+					_change_format = true;
+
+					// If the format is changed, notify to another module
+					need_to_change_notify = true;
 				}
-				
-				auto decoded_frame = ffmpeg::Conv::ToMediaFrame(cmn::MediaType::Video, _frame);
-				::av_frame_unref(_frame);
-				if (decoded_frame == nullptr)
+				else
 				{
-					continue;
+					logte("Could not obtain codec parameters from context %p", _context);
 				}
+			}
 
-				SendOutputBuffer(need_to_change_notify ? TranscodeResult::FormatChanged : TranscodeResult::DataReady, std::move(decoded_frame));
+			// If there is no duration, the duration is calculated by framerate and timebase.
+			if(_frame->pkt_duration <= 0LL && _context->framerate.num > 0 && _context->framerate.den > 0)
+			{
+				_frame->pkt_duration = (int64_t)( ((double)_context->framerate.den / (double)_context->framerate.num) / ((double) GetRefTrack()->GetTimeBase().GetNum() / (double) GetRefTrack()->GetTimeBase().GetDen()) );
 			}
+			
+			OnFrameReceived(_frame->pts);
+
+			auto decoded_frame = ffmpeg::Conv::ToMediaFrame(cmn::MediaType::Video, _frame);
+			::av_frame_unref(_frame);
+			if (decoded_frame == nullptr)
+			{
+				continue;
+			}
+
+			SendOutputBuffer(need_to_change_notify ? TranscodeResult::FormatChanged : TranscodeResult::DataReady, std::move(decoded_frame));
 		}
 	}
+
+	return TranscodeStepResult::Processed;
 }
@@ -26,5 +26,5 @@ public:
 
 	bool Configure(std::shared_ptr<MediaTrack> context) override;
 
-    void CodecThread() override;
+    TranscodeStepResult ProcessStep() override;
 };
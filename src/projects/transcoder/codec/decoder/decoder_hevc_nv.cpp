@@ -33,19 +33,8 @@ bool DecoderHEVCxNV::Configure(std::shared_ptr<MediaTrack> context)
 		return false;
 	}
 
-	try
+	if (StartCodec(ov::String::FormatString("Dec%sNV", avcodec_get_name(GetCodecID()))) == false)
 	{
-		_kill_flag = false;
-
-		_codec_thread = std::thread(&TranscodeDecoder::CodecThread, this);
-		pthread_setname_np(_codec_thread.native_handle(), ov::String::FormatString("Dec%sNV", avcodec_get_name(GetCodecID())).CStr());
-	}
-	catch (const std::system_error &e)
-	{
-		logte("Failed to start decoder thread");
-
-		_kill_flag = true;
-
 		return false;
 	}
 
@@ -71,7 +60,7 @@ bool DecoderHEVCxNV::InitCodec()
 	_context->time_base = ffmpeg::Conv::TimebaseToAVRational(GetTimebase());
 	_context->pkt_timebase = ffmpeg::Conv::TimebaseToAVRational(GetTimebase());
 
-	_context->hw_device_ctx = ::av_buffer_ref(TranscodeGPU::GetInstance()->GetDeviceContext());
+	_context->hw_device_ctx = ::av_buffer_ref(TranscodeGPU::GetInstance()->GetDeviceContext(GetRefTrack()->GetHardwareAccelDeviceId()));
 	_context->flags |= AV_CODEC_FLAG_LOW_DELAY;
 
 	if (::avcodec_open2(_context, _codec, nullptr) < 0)
@@ -92,191 +81,191 @@ void DecoderHEVCxNV::UninitCodec()
 	_context = nullptr;
 }
 
-void DecoderHEVCxNV::CodecThread()
+TranscodeStepResult DecoderHEVCxNV::ProcessStep()
 {
-	while (!_kill_flag)
+	auto obj = DequeueInput();
+	if (obj.has_value() == false)
 	{
-		auto obj = _input_buffer.Dequeue();
-		if (obj.has_value() == false)
-		{
-			// logte("An error occurred while dequeue : no data");
-			continue;
-		}
+		// logte("An error occurred while dequeue : no data");
+		return TranscodeStepResult::NoInput;
+	}
 
-		auto buffer = std::move(obj.value());
-		auto packet_data = buffer->GetData();
+	auto buffer = std::move(obj.value());
+	auto packet_data = buffer->GetData();
 
-		off_t offset = 0LL;
-		int64_t remained = packet_data->GetLength();
-		int64_t pts = (buffer->GetPts() == -1LL) ? AV_NOPTS_VALUE : buffer->GetPts();
-		int64_t dts = (buffer->GetDts() == -1LL) ? AV_NOPTS_VALUE : buffer->GetDts();
-		[[maybe_unused]] int64_t duration = (buffer->GetDuration() == -1LL) ? AV_NOPTS_VALUE : buffer->GetDuration();
-		auto data = packet_data->GetDataAs<uint8_t>();
+	off_t offset = 0LL;
+	int64_t remained = packet_data->GetLength();
+	int64_t pts = (buffer->GetPts() == -1LL) ? AV_NOPTS_VALUE : buffer->GetPts();
+	int64_t dts = (buffer->GetDts() == -1LL) ? AV_NOPTS_VALUE : buffer->GetDts();
+	[[maybe_unused]] int64_t duration = (buffer->GetDuration() == -1LL) ? AV_NOPTS_VALUE : buffer->GetDuration();
+	auto data = packet_data->GetDataAs<uint8_t>();
 
-		while (remained > 0)
+	while (remained > 0)
+	{
+		::av_packet_unref(_pkt);
+
+		int parsed_size = ::av_parser_parse2(_parser, _context, &_pkt->data, &_pkt->size, data + offset, static_cast<int>(remained), pts, dts, 0);
+		if (parsed_size < 0)
 		{
-			::av_packet_unref(_pkt);
+			logte("An error occurred while parsing: %d", parsed_size);
+			break;
+		}
 
-			int parsed_size = ::av_parser_parse2(_parser, _context, &_pkt->data, &_pkt->size, data + offset, static_cast<int>(remained), pts, dts, 0);
-			if (parsed_size < 0)
+		// NVIDIA H.265 decoder does not support dynamic resolution streams.
+		// So, when a resolution change is detected, the codec is reset and recreated.
+		if (_context->width != 0 && _context->height != 0 && (_parser->width != _context->width || _parser->height != _context->height))
+		{
+			logti("Changed input resolution of %u track. (%dx%d -> %dx%d)", GetRefTrack()->GetId(), _context->width, _context->height, _parser->width, _parser->height);
+
+			UninitCodec();
+
+			if(InitCodec() == false)
 			{
-				logte("An error occurred while parsing: %d", parsed_size);
 				break;
 			}
+		}
 
-			// NVIDIA H.265 decoder does not support dynamic resolution streams.
-			// So, when a resolution change is detected, the codec is reset and recreated.
-			if (_context->width != 0 && _context->height != 0 && (_parser->width != _context->width || _parser->height != _context->height))
+		if (_pkt->size > 0)
+		{
+			_pkt->pts = _parser->pts;
+			_pkt->dts = _parser->dts;
+			_pkt->flags = (_parser->key_frame == 1) ? AV_PKT_FLAG_KEY : 0;
+			_pkt->duration = _pkt->dts - _parser->last_dts;
+			if (_pkt->duration <= 0LL)
 			{
-				logti("Changed input resolution of %u track. (%dx%d -> %dx%d)", GetRefTrack()->GetId(), _context->width, _context->height, _parser->width, _parser->height);
+				// It may not be the exact packet duration.
+				// However, in general, this method is applied under the assumption that the duration of all packets is similar.
+				_pkt->duration = duration;
+			}
 
-				UninitCodec();
+			int ret = ::avcodec_send_packet(_context, _pkt);
 
-				if(InitCodec() == false)
-				{
-					break;
-				}
+			if (ret == AVERROR(EAGAIN))
+			{
+				// Need more data
 			}
-
-			if (_pkt->size > 0)
+			else if (ret == AVERROR_EOF)
 			{
-				_pkt->pts = _parser->pts;
-				_pkt->dts = _parser->dts;
-				_pkt->flags = (_parser->key_frame == 1) ? AV_PKT_FLAG_KEY : 0;
-				_pkt->duration = _pkt->dts - _parser->last_dts;
-				if (_pkt->duration <= 0LL)
-				{
-					// It may not be the exact packet duration.
-					// However, in general, this method is applied under the assumption that the duration of all packets is similar.
-					_pkt->duration = duration;
-				}
-
-				int ret = ::avcodec_send_packet(_context, _pkt);
-
-				if (ret == AVERROR(EAGAIN))
-				{
-					// Need more data
-				}
-				else if (ret == AVERROR_EOF)
-				{
-					logte("An error occurred while sending a packet for decoding: End of file (%d)", ret);
-					break;
-				}
-				else if (ret == AVERROR(EINVAL))
-				{
-					logte("An error occurred while sending a packet for decoding: Invalid argument (%d)", ret);
-					break;
-				}
-				else if (ret == AVERROR(ENOMEM))
-				{
-					logte("An error occurred while sending a packet for decoding: No memory (%d)", ret);
-					break;
-				}
-				else if (ret == AVERROR_INVALIDDATA)
-				{
-					// If only SPS/PPS Nalunit is entered in the decoder, an invalid data error occurs.
-					// There is no particular problem.
-					logtd("Invalid data found when processing input (%d)", ret);
-					break;
-				}
-				else if (ret < 0)
-				{
-					char err_msg[1024];
-					::av_strerror(ret, err_msg, sizeof(err_msg));
-					logte("An error occurred while sending a packet for decoding: Unhandled error (%d:%s) ", ret, err_msg);
-				}
+				logte("An error occurred while sending a packet for decoding: End of file (%d)", ret);
+				break;
 			}
-
-			OV_ASSERT(
-				remained >= parsed_size,
-				"Current data size MUST greater than parsed_size, but data size: %ld, parsed_size: %ld",
-				remained, parsed_size);
-
-			offset += parsed_size;
-			remained -= parsed_size;
-		}
-
-		/////////////////////////////////////////////////////////////////////////////////////////////////////////
-		while (true)
-		{
-			// Check the decoded frame is available
-			int ret = ::avcodec_receive_frame(_context, _frame);
-
-			if (ret == AVERROR(EAGAIN))
+			else if (ret == AVERROR(EINVAL))
 			{
+				logte("An error occurred while sending a packet for decoding: Invalid argument (%d)", ret);
 				break;
 			}
-			else if (ret == AVERROR_EOF)
+			else if (ret == AVERROR(ENOMEM))
 			{
-				logtw("Error receiving a packet for decoding : AVERROR_EOF");
+				logte("An error occurred while sending a packet for decoding: No memory (%d)", ret);
 				break;
 			}
-			else if (ret < 0)
+			else if (ret == AVERROR_INVALIDDATA)
 			{
-				logte("Error receiving a packet for decoding : %d", ret);
+				// If only SPS/PPS Nalunit is entered in the decoder, an invalid data error occurs.
+				// There is no particular problem.
+				logtd("Invalid data found when processing input (%d)", ret);
 				break;
 			}
-			else
+			else if (ret < 0)
 			{
-				bool need_to_change_notify = false;
+				char err_msg[1024];
+				::av_strerror(ret, err_msg, sizeof(err_msg));
+				logte("An error occurred while sending a packet for decoding: Unhandled error (%d:%s) ", ret, err_msg);
+			}
+		}
 
-				// Update codec information if needed
-				if (_change_format == false)
-				{
-					ret = ::avcodec_parameters_from_context(_codec_par, _context);
-					if (ret == 0)
-					{
-						auto codec_info = ShowCodecParameters(_context, _codec_par);
-						logti("[%s/%s(%u)] input stream information: %s",
-							  _stream_info.GetApplicationInfo().GetName().CStr(), _stream_info.GetName().CStr(), _stream_info.GetId(), codec_info.CStr());
-
-						_change_format = true;
-
-						// If the format is changed, notify to another module
-						need_to_change_notify = true;
-					}
-					else
-					{
-						logte("Could not obtain codec parameters from context %p", _context);
-					}
-				}
+		OV_ASSERT(
+			remained >= parsed_size,
+			"Current data size MUST greater than parsed_size, but data size: %ld, parsed_size: %ld",
+			remained, parsed_size);
 
-				AVFrame *sw_frame = ::av_frame_alloc();
-				AVFrame *tmp_frame = NULL;
+		offset += parsed_size;
+		remained -= parsed_size;
+	}
+
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////
+	while (true)
+	{
+		// Check the decoded frame is available
+		int ret = ::avcodec_receive_frame(_context, _frame);
 
-				if (_frame->format == AV_PIX_FMT_CUDA)
+		if (ret == AVERROR(EAGAIN))
+		{
+			break;
+		}
+		else if (ret == AVERROR_EOF)
+		{
+			logtw("Error receiving a packet for decoding : AVERROR_EOF");
+			break;
+		}
+		else if (ret < 0)
+		{
+			logte("Error receiving a packet for decoding : %d", ret);
+			break;
+		}
+		else
+		{
+			bool need_to_change_notify = false;
+
+			// Update codec information if needed
+			if (_change_format == false)
+			{
+				ret = ::avcodec_parameters_from_context(_codec_par, _context);
+				if (ret == 0)
 				{
-					/* retrieve data from GPU to CPU */
-					if ((ret = ::av_hwframe_transfer_data(sw_frame, _frame, 0)) < 0)
-					{
-						logte("Error transferring the data to system memory\n");
-						continue;
-					}
-					tmp_frame = sw_frame;
+					auto codec_info = ShowCodecParameters(_context, _codec_par);
+					logti("[%s/%s(%u)] input stream information: %s",
+						  _stream_info.GetApplicationInfo().GetName().CStr(), _stream_info.GetName().CStr(), _stream_info.GetId(), codec_info.CStr());
+
+					_change_format = true;
+
+					// If the format is changed, notify to another module
+					need_to_change_notify = true;
 				}
 				else
 				{
-					tmp_frame = _frame;
+					logte("Could not obtain codec parameters from context %p", _context);
 				}
-				tmp_frame->pts = _frame->pts;
+			}
 
-				// If there is no duration, the duration is calculated by framerate and timebase.
-				if(_frame->pkt_duration <= 0LL && _context->framerate.num > 0 && _context->framerate.den > 0)
-				{
-					_frame->pkt_duration = (int64_t)( ((double)_context->framerate.den / (double)_context->framerate.num) / ((double) GetRefTrack()->GetTimeBase().GetNum() / (double) GetRefTrack()->GetTimeBase().GetDen()) );
-				}
+			AVFrame *sw_frame = ::av_frame_alloc();
+			AVFrame *tmp_frame = NULL;
 
-				auto decoded_frame = ffmpeg::Conv::ToMediaFrame(cmn::MediaType::Video, tmp_frame);
-				if (decoded_frame == nullptr)
+			// In zero-copy mode, the CUDA frame is passed to the filter as it is
+			if ((_frame->format == AV_PIX_FMT_CUDA) && (TranscodeGPU::GetInstance()->IsZeroCopyNV() == false))
+			{
+				/* retrieve data from GPU to CPU */
+				if ((ret = ::av_hwframe_transfer_data(sw_frame, _frame, 0)) < 0)
 				{
+					logte("Error transferring the data to system memory\n");
 					continue;
 				}
+				tmp_frame = sw_frame;
+			}
+			else
+			{
+				tmp_frame = _frame;
+			}
+			tmp_frame->pts = _frame->pts;
 
-				::av_frame_unref(_frame);
-				::av_frame_free(&sw_frame);
+			// If there is no duration, the duration is calculated by framerate and timebase.
+			if(_frame->pkt_duration <= 0LL && _context->framerate.num > 0 && _context->framerate.den > 0)
+			{
+				_frame->pkt_duration = (int64_t)( ((double)_context->framerate.den / (double)_context->framerate.num) / ((double) GetRefTrack()->GetTimeBase().GetNum() / (double) GetRefTrack()->GetTimeBase().GetDen()) );
+			}
 
-				SendOutputBuffer(need_to_change_notify ? TranscodeResult::FormatChanged : TranscodeResult::DataReady, std::move(decoded_frame));
+			auto decoded_frame = ffmpeg::Conv::ToMediaFrame(cmn::MediaType::Video, tmp_frame);
+			if (decoded_frame == nullptr)
+			{
+				continue;
 			}
+
+			::av_frame_unref(_frame);
+			::av_frame_free(&sw_frame);
+
+			SendOutputBuffer(need_to_change_notify ? TranscodeResult::FormatChanged : TranscodeResult::DataReady, std::move(decoded_frame));
 		}
 	}
+
+	return TranscodeStepResult::Processed;
 }
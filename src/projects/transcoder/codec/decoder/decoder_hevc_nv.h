@@ -29,5 +29,5 @@ public:
 
 	void UninitCodec();
 
-	void CodecThread() override;
+	TranscodeStepResult ProcessStep() override;
 };
@@ -50,202 +50,189 @@ bool DecoderOPUS::Configure(std::shared_ptr<MediaTrack> context)
 
 	_parser->flags |= PARSER_FLAG_COMPLETE_FRAMES;
 
-	// Generates a thread that reads and encodes frames in the input_buffer queue and places them in the output queue.
-	try
+	if (StartCodec(ov::String::FormatString("Dec%s", avcodec_get_name(GetCodecID()))) == false)
 	{
-		_kill_flag = false;
-
-		_codec_thread = std::thread(&TranscodeDecoder::CodecThread, this);
-		pthread_setname_np(_codec_thread.native_handle(), ov::String::FormatString("Dec%s", avcodec_get_name(GetCodecID())).CStr());
-	}
-	catch (const std::system_error &e)
-	{
-		logte("Failed to start decoder thread");
-		_kill_flag = true;
 		return false;
 	}
 
 	return true;
 }
 
-void DecoderOPUS::CodecThread()
+TranscodeStepResult DecoderOPUS::ProcessStep()
 {
-	bool no_data_to_encode = false;
-
-	while (!_kill_flag)
+	/////////////////////////////////////////////////////////////////////
+	// Sending a packet to decoder
+	/////////////////////////////////////////////////////////////////////
+	if (_cur_pkt == nullptr && (_input_buffer.IsEmpty() == false || _no_data_to_encode == true))
 	{
-		/////////////////////////////////////////////////////////////////////
-		// Sending a packet to decoder
-		/////////////////////////////////////////////////////////////////////
-		if (_cur_pkt == nullptr && (_input_buffer.IsEmpty() == false || no_data_to_encode == true))
+		auto obj = DequeueInput();
+		if (obj.has_value() == false)
 		{
-			auto obj = _input_buffer.Dequeue();
-			if (obj.has_value() == false)
-			{
-				continue;
-			}
+			return TranscodeStepResult::NoInput;
+		}
+
+		_no_data_to_encode = false;
+		_cur_pkt = std::move(obj.value());
+		if (_cur_pkt != nullptr)
+		{
+			_cur_data = _cur_pkt->GetData();
+			_pkt_offset = 0;
+		}
+
+		if ((_cur_data == nullptr) || (_cur_data->GetLength() == 0))
+		{
+			return TranscodeStepResult::Processed;
+		}
+	}
 
-			no_data_to_encode = false;
-			_cur_pkt = std::move(obj.value());
-			if (_cur_pkt != nullptr)
+	if (_cur_data != nullptr)
+	{
+		while (_cur_data->GetLength() > _pkt_offset)
+		{
+			int32_t parsed_size = ::av_parser_parse2(
+				_parser,
+				_context,
+				&_pkt->data, &_pkt->size,
+				_cur_data->GetDataAs<uint8_t>() + _pkt_offset,
+				static_cast<int32_t>(_cur_data->GetLength() - _pkt_offset),
+				_cur_pkt->GetPts(), _cur_pkt->GetPts(),
+				0);
+
+			// Failed to parsing
+			if (parsed_size <= 0)
 			{
-				_cur_data = _cur_pkt->GetData();
+				logte("Error while parsing\n");
+				_cur_pkt = nullptr;
+				_cur_data = nullptr;
 				_pkt_offset = 0;
+				break;
 			}
 
-			if ((_cur_data == nullptr) || (_cur_data->GetLength() == 0))
+			if (_pkt->size > 0)
 			{
-				continue;
-			}
-		}
+				_pkt->pts = _parser->pts;
+				_pkt->dts = _parser->dts;
+				_pkt->flags = (_parser->key_frame == 1) ? AV_PKT_FLAG_KEY : 0;
+				if (_pkt->pts != AV_NOPTS_VALUE && _parser->last_pts != AV_NOPTS_VALUE)
+				{
+					_pkt->duration = _pkt->pts - _parser->last_pts;
+				}
+				else
+				{
+					_pkt->duration = 0;
+				}
 
-		if (_cur_data != nullptr)
-		{
-			while (_cur_data->GetLength() > _pkt_offset)
-			{
-				int32_t parsed_size = ::av_parser_parse2(
-					_parser,
-					_context,
-					&_pkt->data, &_pkt->size,
-					_cur_data->GetDataAs<uint8_t>() + _pkt_offset,
-					static_cast<int32_t>(_cur_data->GetLength() - _pkt_offset),
-					_cur_pkt->GetPts(), _cur_pkt->GetPts(),
-					0);
-
-				// Failed to parsing
-				if (parsed_size <= 0)
+				int ret = ::avcodec_send_packet(_context, _pkt);
+
+				if (ret == AVERROR(EAGAIN))
 				{
-					logte("Error while parsing\n");
-					_cur_pkt = nullptr;
-					_cur_data = nullptr;
-					_pkt_offset = 0;
+					// Need more data
+					// *result = TranscodeResult::Again;
 					break;
 				}
-
-				if (_pkt->size > 0)
+				else if (ret == AVERROR_EOF)
 				{
-					_pkt->pts = _parser->pts;
-					_pkt->dts = _parser->dts;
-					_pkt->flags = (_parser->key_frame == 1) ? AV_PKT_FLAG_KEY : 0;
-					if (_pkt->pts != AV_NOPTS_VALUE && _parser->last_pts != AV_NOPTS_VALUE)
-					{
-						_pkt->duration = _pkt->pts - _parser->last_pts;
-					}
-					else
-					{
-						_pkt->duration = 0;
-					}
-
-					int ret = ::avcodec_send_packet(_context, _pkt);
-
-					if (ret == AVERROR(EAGAIN))
-					{
-						// Need more data
-						// *result = TranscodeResult::Again;
-						break;
-					}
-					else if (ret == AVERROR_EOF)
-					{
-						logte("Error sending a packet for decoding : AVERROR_EOF");
-						break;
-					}
-					else if (ret == AVERROR(EINVAL))
-					{
-						logte("Error sending a packet for decoding : AVERROR(EINVAL)");
-						break;
-					}
-					else if (ret == AVERROR(ENOMEM))
-					{
-						logte("Error sending a packet for decoding : AVERROR(ENOMEM)");
-						break;
-					}
-					else if (ret < 0)
-					{
-						char err_msg[1024];
-						av_strerror(ret, err_msg, sizeof(err_msg));
-						logte("An error occurred while sending a packet for decoding: Unhandled error (%d:%s) ", ret, err_msg);
-					}
+					logte("Error sending a packet for decoding : AVERROR_EOF");
+					break;
 				}
-
-				if (parsed_size > 0)
+				else if (ret == AVERROR(EINVAL))
 				{
-					OV_ASSERT(_cur_data->GetLength() >= (size_t)parsed_size, "Current data size MUST greater than parsed_size, but data size: %ld, parsed_size: %ld", _cur_data->GetLength(), parsed_size);
-
-					_pkt_offset += parsed_size;
+					logte("Error sending a packet for decoding : AVERROR(EINVAL)");
+					break;
+				}
+				else if (ret == AVERROR(ENOMEM))
+				{
+					logte("Error sending a packet for decoding : AVERROR(ENOMEM)");
+					break;
+				}
+				else if (ret < 0)
+				{
+					char err_msg[1024];
+					av_strerror(ret, err_msg, sizeof(err_msg));
+					logte("An error occurred while sending a packet for decoding: Unhandled error (%d:%s) ", ret, err_msg);
 				}
-
-				break;
 			}
 
-			if (_cur_data->GetLength() <= _pkt_offset)
+			if (parsed_size > 0)
 			{
-				_cur_pkt = nullptr;
-				_cur_data = nullptr;
-				_pkt_offset = 0;
+				OV_ASSERT(_cur_data->GetLength() >= (size_t)parsed_size, "Current data size MUST greater than parsed_size, but data size: %ld, parsed_size: %ld", _cur_data->GetLength(), parsed_size);
+
+				_pkt_offset += parsed_size;
 			}
-		}
 
-		/////////////////////////////////////////////////////////////////////
-		// Receive a frame from decoder
-		/////////////////////////////////////////////////////////////////////
-		// Check the decoded frame is available
-		int ret = ::avcodec_receive_frame(_context, _frame);
-		if (ret == AVERROR(EAGAIN))
-		{
-			no_data_to_encode = true;
-			continue;
+			break;
 		}
-		else if (ret == AVERROR_EOF)
-		{
-			logte("Error receiving a packet for decoding : AVERROR_EOF");
-			continue;
-		}
-		else if (ret < 0)
+
+		if (_cur_data->GetLength() <= _pkt_offset)
 		{
-			logte("Error receiving a packet for decoding : %d", ret);
-			continue;
+			_cur_pkt = nullptr;
+			_cur_data = nullptr;
+			_pkt_offset = 0;
 		}
-		else
+	}
+
+	/////////////////////////////////////////////////////////////////////
+	// Receive a frame from decoder
+	/////////////////////////////////////////////////////////////////////
+	// Check the decoded frame is available
+	int ret = ::avcodec_receive_frame(_context, _frame);
+	if (ret == AVERROR(EAGAIN))
+	{
+		_no_data_to_encode = true;
+		return TranscodeStepResult::Processed;
+	}
+	else if (ret == AVERROR_EOF)
+	{
+		logte("Error receiving a packet for decoding : AVERROR_EOF");
+		return TranscodeStepResult::Processed;
+	}
+	else if (ret < 0)
+	{
+		logte("Error receiving a packet for decoding : %d", ret);
+		return TranscodeStepResult::Processed;
+	}
+	else
+	{
+		bool need_to_change_notify = false;
+
+		// Update codec informations if needed
+		if (_change_format == false)
 		{
-			bool need_to_change_notify = false;
+			ret = ::avcodec_parameters_from_context(_codec_par, _context);
 
-			// Update codec informations if needed
-			if (_change_format == false)
+			if (ret == 0)
 			{
-				ret = ::avcodec_parameters_from_context(_codec_par, _context);
-
-				if (ret == 0)
-				{
-					auto codec_info = ShowCodecParameters(_context, _codec_par);
+				auto codec_info = ShowCodecParameters(_context, _codec_par);
 
-					logti("[%s/%s(%u)] input stream information: %s",
-						  _stream_info.GetApplicationInfo().GetName().CStr(), _stream_info.GetName().CStr(), _stream_info.GetId(), codec_info.CStr());
+				logti("[%s/%s(%u)] input stream information: %s",
+					  _stream_info.GetApplicationInfo().GetName().CStr(), _stream_info.GetName().CStr(), _stream_info.GetId(), codec_info.CStr());
 
-					_change_format = true;
+				_change_format = true;
 
-					// If the format is changed, notify to another module
-					need_to_change_notify = true;
-				}
-				else
-				{
-					logte("Could not obtain codec parameters from context %p", _context);
-				}
+				// If the format is changed, notify to another module
+				need_to_change_notify = true;
+			}
+			else
+			{
+				logte("Could not obtain codec parameters from context %p", _context);
 			}
+		}
 
-			// If there is no duration, the duration is calculated by timebase.
-			_frame->pkt_duration = (_frame->pkt_duration <= 0LL) ? ffmpeg::Conv::GetDurationPerFrame(cmn::MediaType::Audio, GetRefTrack(), _frame) : _frame->pkt_duration;
+		// If there is no duration, the duration is calculated by timebase.
+		_frame->pkt_duration = (_frame->pkt_duration <= 0LL) ? ffmpeg::Conv::GetDurationPerFrame(cmn::MediaType::Audio, GetRefTrack(), _frame) : _frame->pkt_duration;
 
-			// If the decoded audio frame does not have a PTS, Increase frame duration time in PTS of previous frame
-			_frame->pts = (_frame->pts == AV_NOPTS_VALUE) ? (_last_pkt_pts + _frame->pkt_duration) : _frame->pts;
+		// If the decoded audio frame does not have a PTS, Increase frame duration time in PTS of previous frame
+		_frame->pts = (_frame->pts == AV_NOPTS_VALUE) ? (_last_pkt_pts + _frame->pkt_duration) : _frame->pts;
 
-			auto output_frame = ffmpeg::Conv::ToMediaFrame(cmn::MediaType::Audio, _frame);
-			::av_frame_unref(_frame);
-			if (output_frame == nullptr)
-				continue;
+		auto output_frame = ffmpeg::Conv::ToMediaFrame(cmn::MediaType::Audio, _frame);
+		::av_frame_unref(_frame);
+		if (output_frame == nullptr)
+			return TranscodeStepResult::Processed;
 
-			_last_pkt_pts = output_frame->GetPts();
+		_last_pkt_pts = output_frame->GetPts();
 
-			SendOutputBuffer(need_to_change_notify ? TranscodeResult::FormatChanged : TranscodeResult::DataReady, std::move(output_frame));
-		}
+		SendOutputBuffer(need_to_change_notify ? TranscodeResult::FormatChanged : TranscodeResult::DataReady, std::move(output_frame));
 	}
+
+	return TranscodeStepResult::Processed;
 }
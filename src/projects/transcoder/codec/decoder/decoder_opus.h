@@ -28,9 +28,11 @@ public:
 	std::shared_ptr<const ov::Data> _cur_data = nullptr;
 
 	int64_t _last_pkt_pts = 0;
+	// The decoder has no frame to output until the next packet is sent
+	bool _no_data_to_encode = false;
 
 	bool Configure(std::shared_ptr<MediaTrack> context) override;
 
-	void CodecThread() override;
+	TranscodeStepResult ProcessStep() override;
 
 };
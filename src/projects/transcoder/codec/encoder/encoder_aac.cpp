@@ -59,85 +59,73 @@ bool EncoderAAC::Configure(std::shared_ptr<MediaTrack> context)
 
 	GetRefTrack()->SetAudioSamplesPerFrame(_codec_context->frame_size);
 
-	// Generates a thread that reads and encodes frames in the input_buffer queue and places them in the output queue.
-	try
+	if (StartCodec(ov::String::FormatString("Enc%s", avcodec_get_name(GetCodecID()))) == false)
 	{
-		_kill_flag = false;
-
-		_codec_thread = std::thread(&EncoderAAC::CodecThread, this);
-		pthread_setname_np(_codec_thread.native_handle(), ov::String::FormatString("Enc%s", avcodec_get_name(GetCodecID())).CStr());
-	}
-	catch (const std::system_error &e)
-	{
-		logte("Failed to start encoder thread.");
-		_kill_flag = true;
-
 		return false;
 	}
 
 	return true;
 }
 
-void EncoderAAC::CodecThread()
+TranscodeStepResult EncoderAAC::ProcessStep()
 {
-	while (!_kill_flag)
+	auto obj = DequeueInput();
+	if (obj.has_value() == false)
+		return TranscodeStepResult::NoInput;
+
+	auto media_frame = std::move(obj.value());
+
+	///////////////////////////////////////////////////
+	// Request frame encoding to codec
+	///////////////////////////////////////////////////
+	auto av_frame = ffmpeg::Conv::ToAVFrame(cmn::MediaType::Audio, media_frame);
+	if (!av_frame)
 	{
-		auto obj = _input_buffer.Dequeue();
-		if (obj.has_value() == false)
-			continue;
+		logte("Could not allocate the frame data");
+		return TranscodeStepResult::Stopped;
+	}
 
-		auto media_frame = std::move(obj.value());
+	int ret = SendFrameToCodec(av_frame, *media_frame);
+	if (ret < 0)
+	{
+		logte("Error sending a frame for encoding : %d", ret);
+	}
 
-		///////////////////////////////////////////////////
-		// Request frame encoding to codec
-		///////////////////////////////////////////////////
-		auto av_frame = ffmpeg::Conv::ToAVFrame(cmn::MediaType::Audio, media_frame);
-		if (!av_frame)
+	///////////////////////////////////////////////////
+	// The encoded packet is taken from the codec.
+	///////////////////////////////////////////////////
+	while (true)
+	{
+		int ret = ::avcodec_receive_packet(_codec_context, _packet);
+		if (ret == AVERROR(EAGAIN))
 		{
-			logte("Could not allocate the frame data");
 			break;
 		}
-
-		int ret = ::avcodec_send_frame(_codec_context, av_frame);
-		if (ret < 0)
+		else if (ret == AVERROR_EOF && ret < 0)
 		{
-			logte("Error sending a frame for encoding : %d", ret);
+			logte("Error receiving a packet for decoding : %d", ret);
+			break;
 		}
-
-		///////////////////////////////////////////////////
-		// The encoded packet is taken from the codec.
-		///////////////////////////////////////////////////
-		while (true)
+		else
 		{
-			int ret = ::avcodec_receive_packet(_codec_context, _packet);
-			if (ret == AVERROR(EAGAIN))
-			{
-				break;
-			}
-			else if (ret == AVERROR_EOF && ret < 0)
+			auto media_packet = ffmpeg::Conv::ToMediaPacket(_packet, cmn::MediaType::Audio, cmn::BitstreamFormat::AAC_ADTS, cmn::PacketType::RAW);
+			if (media_packet == nullptr)
 			{
-				logte("Error receiving a packet for decoding : %d", ret);
+				logte("Could not allocate the media packet");
 				break;
 			}
-			else
+
+			::av_packet_unref(_packet);
+
+			// TODO : If the pts value are under zero, the dash packetizer does not work.
+			if (media_packet->GetPts() < 0)
 			{
-				auto media_packet = ffmpeg::Conv::ToMediaPacket(_packet, cmn::MediaType::Audio, cmn::BitstreamFormat::AAC_ADTS, cmn::PacketType::RAW);
-				if (media_packet == nullptr)
-				{
-					logte("Could not allocate the media packet");
-					break;
-				}
-
-				::av_packet_unref(_packet);
-
-				// TODO : If the pts value are under zero, the dash packetizer does not work.
-				if (media_packet->GetPts() < 0)
-				{
-					continue;
-				}
-
-				SendOutputBuffer(std::move(media_packet));
+				continue;
 			}
+
+			SendOutputBuffer(std::move(media_packet));
 		}
 	}
+
+	return TranscodeStepResult::Processed;
 }
@@ -0,0 +1,173 @@
+//==============================================================================
+//
+//  Transcode
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "encoder_av1_svt.h"
+
+#include "../../transcoder_private.h"
+
+bool EncoderAV1xSVT::SetCodecParams()
+{
+	_codec_context->bit_rate = GetRefTrack()->GetBitrate();
+	_codec_context->rc_max_rate = _codec_context->bit_rate;
+	_codec_context->rc_min_rate = _codec_context->bit_rate;
+	_codec_context->sample_aspect_ratio = (AVRational){1, 1};
+	_codec_context->time_base = ffmpeg::Conv::TimebaseToAVRational(GetRefTrack()->GetTimeBase());
+	_codec_context->framerate = ::av_d2q((GetRefTrack()->GetFrameRate() > 0) ? GetRefTrack()->GetFrameRate() : GetRefTrack()->GetEstimateFrameRate(), AV_TIME_BASE);
+	_codec_context->max_b_frames = 0;
+	_codec_context->pix_fmt = (AVPixelFormat)GetSupportedFormat();
+	_codec_context->width = GetRefTrack()->GetWidth();
+	_codec_context->height = GetRefTrack()->GetHeight();
+
+	// Set KeyFrame Interval
+	_codec_context->gop_size = (GetRefTrack()->GetKeyFrameInterval() == 0) ? (_codec_context->framerate.num / _codec_context->framerate.den) : GetRefTrack()->GetKeyFrameInterval();
+	ConfigureKeyFrameAlignment();
+	
+	// The frames are not reordered to keep the latency low
+
+	// -1(Default) => FFMIN(FFMAX(4, av_cpu_count() / 3), 8) 
+	// 0 => Auto
+	// >1 => Set
+	_codec_context->thread_count = GetRefTrack()->GetThreadCount() < 0 ? FFMIN(FFMAX(4, av_cpu_count() / 3), 8) : GetRefTrack()->GetThreadCount();
+
+	// Rate control: 1 => VBR (bit_rate is used as the target bitrate)
+	::av_opt_set_int(_codec_context->priv_data, "rc", 1, 0);
+
+	// Preset (Encoder mode of SVT-AV1, the higher is the faster)
+	auto preset = GetRefTrack()->GetPreset().LowerCaseString();
+	if (preset.IsEmpty() == true)
+	{
+		::av_opt_set_int(_codec_context->priv_data, "preset", 8, 0);
+	}
+	else
+	{
+		if (preset == "slower")
+		{
+			::av_opt_set_int(_codec_context->priv_data, "preset", 4, 0);
+		}
+		else if (preset == "slow")
+		{
+			::av_opt_set_int(_codec_context->priv_data, "preset", 6, 0);
+		}
+		else if (preset == "medium")
+		{
+			::av_opt_set_int(_codec_context->priv_data, "preset", 7, 0);
+		}
+		else if (preset == "fast" || preset == "faster")
+		{
+			::av_opt_set_int(_codec_context->priv_data, "preset", 8, 0);
+		}
+		else
+		{
+			logtw("Unknown preset: %s", preset.CStr());
+		}
+	}
+
+	return true;
+}
+
+bool EncoderAV1xSVT::Configure(std::shared_ptr<MediaTrack> context)
+{
+	if (TranscodeEncoder::Configure(context) == false)
+	{
+		return false;
+	}
+
+	auto codec_id = GetCodecID();
+
+	// There can be several AV1 encoders (libaom, rav1e, ...), so it is found by name
+	const AVCodec *codec = ::avcodec_find_encoder_by_name("libsvtav1");
+	if (codec == nullptr)
+	{
+		logte("Could not find encoder: libsvtav1 (%s)", ::avcodec_get_name(codec_id));
+		return false;
+	}
+
+	_codec_context = ::avcodec_alloc_context3(codec);
+	if (_codec_context == nullptr)
+	{
+		logte("Could not allocate codec context for %s (%d)", ::avcodec_get_name(codec_id), codec_id);
+		return false;
+	}
+
+	if (SetCodecParams() == false)
+	{
+		logte("Could not set codec parameters for %s (%d)", ::avcodec_get_name(codec_id), codec_id);
+		return false;
+	}
+
+	if (::avcodec_open2(_codec_context, codec, nullptr) < 0)
+	{
+		logte("Could not open codec");
+		return false;
+	}
+
+	if (StartCodec(ov::String::FormatString("Enc%s", avcodec_get_name(GetCodecID()))) == false)
+	{
+		return false;
+	}
+
+	return true;
+}
+
+TranscodeStepResult EncoderAV1xSVT::ProcessStep()
+{
+	auto obj = DequeueInput();
+	if (obj.has_value() == false)
+		return TranscodeStepResult::NoInput;
+
+	auto media_frame = std::move(obj.value());
+
+	///////////////////////////////////////////////////
+	// Request frame encoding to codec
+	///////////////////////////////////////////////////
+	auto av_frame = ffmpeg::Conv::ToAVFrame(cmn::MediaType::Video, media_frame);
+	if (!av_frame)
+	{
+		logte("Could not allocate the frame data");
+		return TranscodeStepResult::Stopped;
+	}
+
+	int ret = SendFrameToCodec(av_frame, *media_frame);
+	if (ret < 0)
+	{
+		logte("Error sending a frame for encoding : %d", ret);
+	}
+
+	///////////////////////////////////////////////////
+	// The encoded packet is taken from the codec.
+	///////////////////////////////////////////////////
+	while (true)
+	{
+		// Check frame is available
+		int ret = ::avcodec_receive_packet(_codec_context, _packet);
+		if (ret == AVERROR(EAGAIN))
+		{
+			// More packets are needed for encoding.
+			break;
+		}
+		else if (ret == AVERROR_EOF && ret < 0)
+		{
+			logte("Error receiving a packet for decoding : %d", ret);
+			break;
+		}
+		else
+		{
+			auto media_packet = ffmpeg::Conv::ToMediaPacket(_packet, cmn::MediaType::Video, cmn::BitstreamFormat::AV1, cmn::PacketType::RAW);
+			if (media_packet == nullptr)
+			{
+				logte("Could not allocate the media packet");
+				break;
+			}
+
+			::av_packet_unref(_packet);
+
+			SendOutputBuffer(std::move(media_packet));
+		}
+	}
+
+	return TranscodeStepResult::Processed;
+}
@@ -0,0 +1,41 @@
+//==============================================================================
+//
+//  Transcode
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include "../../transcoder_encoder.h"
+
+class EncoderAV1xSVT : public TranscodeEncoder
+{
+public:
+	EncoderAV1xSVT(const info::Stream &stream_info)
+		: TranscodeEncoder(stream_info)
+	{
+	}
+
+	AVCodecID GetCodecID() const noexcept override
+	{
+		return AV_CODEC_ID_AV1;
+	}
+
+	int GetSupportedFormat() const noexcept override
+	{
+		return AV_PIX_FMT_YUV420P;
+	}
+
+	cmn::BitstreamFormat GetBitstreamFormat() const noexcept override
+	{
+		return cmn::BitstreamFormat::AV1;
+	}
+
+	bool Configure(std::shared_ptr<MediaTrack> context) override;
+
+	TranscodeStepResult ProcessStep() override;
+
+private:
+	bool SetCodecParams() override;
+};
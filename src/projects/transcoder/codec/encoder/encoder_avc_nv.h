@@ -23,10 +23,7 @@ public:
 		return AV_CODEC_ID_H264;
 	}
 
-	int GetSupportedFormat() const noexcept override 
-	{
-		return AV_PIX_FMT_NV12;
-	}
+	int GetSupportedFormat() const noexcept override;
 
 	cmn::BitstreamFormat GetBitstreamFormat() const noexcept override
 	{
@@ -35,7 +32,7 @@ public:
 	
 	bool Configure(std::shared_ptr<MediaTrack> context) override;
 
-	void CodecThread() override;
+	TranscodeStepResult ProcessStep() override;
 
 private:
 	bool SetCodecParams() override;	
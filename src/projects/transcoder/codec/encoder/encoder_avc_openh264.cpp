@@ -25,6 +25,7 @@ bool EncoderAVCxOpenH264::SetCodecParams()
 
 	// Set KeyFrame Interval
 	_codec_context->gop_size = (GetRefTrack()->GetKeyFrameInterval() == 0) ? (_codec_context->framerate.num / _codec_context->framerate.den) : GetRefTrack()->GetKeyFrameInterval();
+	ConfigureKeyFrameAlignment();
 
 	// -1(Default) => FFMIN(FFMAX(4, av_cpu_count() / 3), 8) 
 	// 0 => Auto
@@ -32,6 +33,13 @@ bool EncoderAVCxOpenH264::SetCodecParams()
 	_codec_context->thread_count = GetRefTrack()->GetThreadCount() < 0 ? FFMIN(FFMAX(4, av_cpu_count() / 3), 8) : GetRefTrack()->GetThreadCount();
 	_codec_context->slices = _codec_context->thread_count;
 
+	if (GetRefTrack()->IsLowLatency())
+	{
+		// OpenH264 never holds frames (no B-frames and no lookahead), and does not support intra refresh.
+		// A frame is split into at least 4 slices, and the packetizer sends each slice (NAL unit) in its own RTP packets
+		_codec_context->slices = std::max(_codec_context->slices, 4);
+	}
+
 	::av_opt_set(_codec_context->priv_data, "coder", "default", 0);
 
 	// Use the high profile to remove this log.
@@ -147,84 +155,69 @@ bool EncoderAVCxOpenH264::Configure(std::shared_ptr<MediaTrack> context)
 		return false;
 	}
 
-	// Generates a thread that reads and encodes frames in the input_buffer queue and places them in the output queue.
-	try
+	if (StartCodec(ov::String::FormatString("Enc%s", avcodec_get_name(GetCodecID()))) == false)
 	{
-		_kill_flag = false;
-
-		_codec_thread = std::thread(&TranscodeEncoder::CodecThread, this);
-		pthread_setname_np(_codec_thread.native_handle(), ov::String::FormatString("Enc%s", avcodec_get_name(GetCodecID())).CStr());
-	}
-	catch (const std::system_error &e)
-	{
-		logte("Failed to start encoder thread.");
-		_kill_flag = true;
-
 		return false;
 	}
 
 	return true;
 }
 
-void EncoderAVCxOpenH264::CodecThread()
+TranscodeStepResult EncoderAVCxOpenH264::ProcessStep()
 {
-	while (!_kill_flag)
+	auto obj = DequeueInput();
+	if (obj.has_value() == false)
+		return TranscodeStepResult::NoInput;
+
+	auto media_frame = std::move(obj.value());
+
+	///////////////////////////////////////////////////
+	// Request frame encoding to codec
+	///////////////////////////////////////////////////
+	auto av_frame = ffmpeg::Conv::ToAVFrame(cmn::MediaType::Video, media_frame);
+	if (!av_frame)
 	{
-		auto obj = _input_buffer.Dequeue();
-		if (obj.has_value() == false)
-			continue;
+		logte("Could not allocate the video frame data");
+		return TranscodeStepResult::Stopped;
+	}
 
-		auto media_frame = std::move(obj.value());
+	int ret = SendFrameToCodec(av_frame, *media_frame);
+	if (ret < 0)
+	{
+		logte("Error sending a frame for encoding : %d", ret);
+	}
 
-		///////////////////////////////////////////////////
-		// Request frame encoding to codec
-		///////////////////////////////////////////////////
-		auto av_frame = ffmpeg::Conv::ToAVFrame(cmn::MediaType::Video, media_frame);
-		if (!av_frame)
+	///////////////////////////////////////////////////
+	// The encoded packet is taken from the codec.
+	///////////////////////////////////////////////////
+	while (true)
+	{
+		// Check frame is available
+		int ret = ::avcodec_receive_packet(_codec_context, _packet);
+		if (ret == AVERROR(EAGAIN))
 		{
-			logte("Could not allocate the video frame data");
+			// More packets are needed for encoding.
 			break;
 		}
-
-		// AV_Frame.pict_type must be set to AV_PICTURE_TYPE_NONE. This will ensure that the keyframe interval option is applied correctly.
-		av_frame->pict_type = AV_PICTURE_TYPE_NONE;
-
-		int ret = ::avcodec_send_frame(_codec_context, av_frame);
-		if (ret < 0)
+		else if (ret == AVERROR_EOF && ret < 0)
 		{
-			logte("Error sending a frame for encoding : %d", ret);
+			logte("Error receiving a packet for decoding : %d", ret);
+			break;
 		}
-
-		///////////////////////////////////////////////////
-		// The encoded packet is taken from the codec.
-		///////////////////////////////////////////////////
-		while (true)
+		else
 		{
-			// Check frame is available
-			int ret = ::avcodec_receive_packet(_codec_context, _packet);
-			if (ret == AVERROR(EAGAIN))
-			{
-				// More packets are needed for encoding.
-				break;
-			}
-			else if (ret == AVERROR_EOF && ret < 0)
+			auto media_packet = ffmpeg::Conv::ToMediaPacket(_packet, cmn::MediaType::Video, cmn::BitstreamFormat::H264_ANNEXB, cmn::PacketType::NALU);
+			if (media_packet == nullptr)
 			{
-				logte("Error receiving a packet for decoding : %d", ret);
+				logte("Could not allocate the media packet");
 				break;
 			}
-			else
-			{
-				auto media_packet = ffmpeg::Conv::ToMediaPacket(_packet, cmn::MediaType::Video, cmn::BitstreamFormat::H264_ANNEXB, cmn::PacketType::NALU);
-				if (media_packet == nullptr)
-				{
-					logte("Could not allocate the media packet");
-					break;
-				}
 
-				::av_packet_unref(_packet);
+			::av_packet_unref(_packet);
 
-				SendOutputBuffer(std::move(media_packet));
-			}
+			SendOutputBuffer(std::move(media_packet));
 		}
 	}
+
+	return TranscodeStepResult::Processed;
 }
@@ -35,7 +35,7 @@ public:
 
 	bool Configure(std::shared_ptr<MediaTrack> context) override;
 
-	void CodecThread() override;
+	TranscodeStepResult ProcessStep() override;
 
 private:
 	bool SetCodecParams() override;
@@ -10,8 +10,15 @@
 
 #include <unistd.h>
 
+#include "../../transcoder_gpu.h"
 #include "../../transcoder_private.h"
 
+int EncoderHEVCxNV::GetSupportedFormat() const noexcept
+{
+	// In zero-copy mode, the filter outputs CUDA frames
+	return TranscodeGPU::GetInstance()->IsZeroCopyNV() ? AV_PIX_FMT_CUDA : AV_PIX_FMT_NV12;
+}
+
 bool EncoderHEVCxNV::SetCodecParams()
 {
 	_codec_context->framerate = ::av_d2q((GetRefTrack()->GetFrameRate() > 0) ? GetRefTrack()->GetFrameRate() : GetRefTrack()->GetEstimateFrameRate(), AV_TIME_BASE);
@@ -26,6 +33,7 @@ bool EncoderHEVCxNV::SetCodecParams()
 	_codec_context->width = GetRefTrack()->GetWidth();
 	_codec_context->height = GetRefTrack()->GetHeight();
 	_codec_context->gop_size = (GetRefTrack()->GetKeyFrameInterval() == 0) ? (_codec_context->framerate.num / _codec_context->framerate.den) : GetRefTrack()->GetKeyFrameInterval();
+	ConfigureKeyFrameAlignment();
 
 	// Preset
 	if (GetRefTrack()->GetPreset() == "slower")
@@ -57,6 +65,20 @@ bool EncoderHEVCxNV::SetCodecParams()
 	::av_opt_set(_codec_context->priv_data, "tune", "ull", 0);
 	::av_opt_set(_codec_context->priv_data, "rc", "cbr", 0);
 
+	// Low latency
+	if (GetRefTrack()->IsLowLatency())
+	{
+		// No frame is held in the encoder (no B-frames, no lookahead, no output delay)
+		_codec_context->max_b_frames = 0;
+		::av_opt_set_int(_codec_context->priv_data, "zerolatency", 1, 0);
+		::av_opt_set_int(_codec_context->priv_data, "rc-lookahead", 0, 0);
+		::av_opt_set_int(_codec_context->priv_data, "delay", 0, 0);
+		// The picture is refreshed by intra blocks over <gop_size> frames instead of IDR frames, so the frame size does not spike
+		::av_opt_set_int(_codec_context->priv_data, "intra-refresh", 1, 0);
+		// A frame is split into slices, and the packetizer sends each slice (NAL unit) in its own RTP packets
+		_codec_context->slices = 4;
+	}
+
 	return true;
 }
 
@@ -84,6 +106,7 @@ bool EncoderHEVCxNV::Configure(std::shared_ptr<MediaTrack> context)
 		logte("Could not allocate codec context for %s (%d)", ::avcodec_get_name(codec_id), codec_id);
 		return false;
 	}
+	_codec_context->hw_device_ctx = ::av_buffer_ref(TranscodeGPU::GetInstance()->GetDeviceContext(GetRefTrack()->GetHardwareAccelDeviceId()));
 
 	if (SetCodecParams() == false)
 	{
@@ -91,88 +114,86 @@ bool EncoderHEVCxNV::Configure(std::shared_ptr<MediaTrack> context)
 		return false;
 	}
 
+	if (_codec_context->pix_fmt == AV_PIX_FMT_CUDA)
+	{
+		_codec_context->hw_frames_ctx = TranscodeGPU::GetInstance()->CreateFramesContextNV(TranscodeGPU::GetInstance()->GetDeviceContext(GetRefTrack()->GetHardwareAccelDeviceId()), _codec_context->width, _codec_context->height);
+		if (_codec_context->hw_frames_ctx == nullptr)
+		{
+			logte("Could not create the frames context for %s (%d)", ::avcodec_get_name(codec_id), codec_id);
+			return false;
+		}
+	}
+
 	if (::avcodec_open2(_codec_context, codec, nullptr) < 0)
 	{
 		logte("Could not open codec: %s (%d)", codec->name, codec->id);
 		return false;
 	}
 
-	// Generates a thread that reads and encodes frames in the input_buffer queue and places them in the output queue.
-	try
-	{
-		_kill_flag = false;
-
-		_codec_thread = std::thread(&EncoderHEVCxNV::CodecThread, this);
-		pthread_setname_np(_codec_thread.native_handle(), ov::String::FormatString("Enc%sNV", avcodec_get_name(GetCodecID())).CStr());
-	}
-	catch (const std::system_error &e)
+	if (StartCodec(ov::String::FormatString("Enc%sNV", avcodec_get_name(GetCodecID()))) == false)
 	{
-		logte("Failed to start encoder thread.");
-		_kill_flag = true;
-
 		return false;
 	}
 
 	return true;
 }
 
-void EncoderHEVCxNV::CodecThread()
+TranscodeStepResult EncoderHEVCxNV::ProcessStep()
 {
-	while (!_kill_flag)
-	{
-		auto obj = _input_buffer.Dequeue();
-		if (obj.has_value() == false)
-			continue;
+	auto obj = DequeueInput();
+	if (obj.has_value() == false)
+		return TranscodeStepResult::NoInput;
 
 
-		auto media_frame = std::move(obj.value());
+	auto media_frame = std::move(obj.value());
 
-		///////////////////////////////////////////////////
-		// Request frame encoding to codec
-		///////////////////////////////////////////////////
-		auto av_frame = ffmpeg::Conv::ToAVFrame(cmn::MediaType::Video, media_frame);
-		if(!av_frame)
+	///////////////////////////////////////////////////
+	// Request frame encoding to codec
+	///////////////////////////////////////////////////
+	auto av_frame = ffmpeg::Conv::ToAVFrame(cmn::MediaType::Video, media_frame);
+	if(!av_frame)
+	{
+		logte("Could not allocate the frame data");
+		return TranscodeStepResult::Stopped;
+	}
+
+	int ret = SendFrameToCodec(av_frame, *media_frame);
+	if (ret < 0)
+	{
+		logte("Error sending a frame for encoding : %d", ret);
+	}
+
+	///////////////////////////////////////////////////
+	// The encoded packet is taken from the codec.
+	///////////////////////////////////////////////////
+	while (true)
+	{
+		// Check frame is available
+		int ret = ::avcodec_receive_packet(_codec_context, _packet);
+		if (ret == AVERROR(EAGAIN))
 		{
-			logte("Could not allocate the frame data");
+			// More packets are needed for encoding.
 			break;
 		}
-
-		int ret = ::avcodec_send_frame(_codec_context, av_frame);
-		if (ret < 0)
+		else if (ret == AVERROR_EOF && ret < 0)
 		{
-			logte("Error sending a frame for encoding : %d", ret);
+			logte("Error receiving a packet for decoding : %d", ret);
+			break;
 		}
-
-		///////////////////////////////////////////////////
-		// The encoded packet is taken from the codec.
-		///////////////////////////////////////////////////
-		while (true)
+		else
 		{
-			// Check frame is available
-			int ret = ::avcodec_receive_packet(_codec_context, _packet);
-			if (ret == AVERROR(EAGAIN))
-			{
-				// More packets are needed for encoding.
-				break;
-			}
-			else if (ret == AVERROR_EOF && ret < 0)
+			auto media_packet = ffmpeg::Conv::ToMediaPacket(_packet, cmn::MediaType::Video, cmn::BitstreamFormat::H265_ANNEXB, cmn::PacketType::NALU);
+			if (media_packet == nullptr)
 			{
-				logte("Error receiving a packet for decoding : %d", ret);
+				logte("Could not allocate the media packet");
 				break;
 			}
-			else
-			{
-				auto media_packet = ffmpeg::Conv::ToMediaPacket(_packet, cmn::MediaType::Video, cmn::BitstreamFormat::H265_ANNEXB, cmn::PacketType::NALU);
-				if (media_packet == nullptr)
-				{
-					logte("Could not allocate the media packet");
-					break;
-				}
 
-				::av_packet_unref(_packet);
+			::av_packet_unref(_packet);
 
-				SendOutputBuffer(std::move(media_packet));
-			}
+			SendOutputBuffer(std::move(media_packet));
 		}
 	}
+
+	return TranscodeStepResult::Processed;
 }
@@ -0,0 +1,127 @@
+//==============================================================================
+//
+//  Transcode
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "encoder_jpeg_qsv.h"
+
+#include <unistd.h>
+
+#include "../../transcoder_private.h"
+
+bool EncoderJPEGxQSV::SetCodecParams()
+{
+	_codec_context->codec_type = AVMEDIA_TYPE_VIDEO;
+	_codec_context->framerate = ::av_d2q((GetRefTrack()->GetFrameRate() > 0) ? GetRefTrack()->GetFrameRate() : GetRefTrack()->GetEstimateFrameRate(), AV_TIME_BASE);
+	_codec_context->time_base = ::av_inv_q(::av_mul_q(_codec_context->framerate, (AVRational){_codec_context->ticks_per_frame, 1}));
+	_codec_context->pix_fmt = (AVPixelFormat)GetSupportedFormat();
+	_codec_context->width = GetRefTrack()->GetWidth();
+	_codec_context->height = GetRefTrack()->GetHeight();
+	_codec_context->global_quality = ENCODER_JPEG_QSV_QUALITY;
+
+	return true;
+}
+
+bool EncoderJPEGxQSV::Configure(std::shared_ptr<MediaTrack> context)
+{
+	if (TranscodeEncoder::Configure(context) == false)
+	{
+		return false;
+	}
+
+	auto codec_id = GetCodecID();
+
+	const AVCodec *codec = ::avcodec_find_encoder_by_name("mjpeg_qsv");
+	if (codec == nullptr)
+	{
+		logte("Could not find encoder: %d (%s)", codec_id, ::avcodec_get_name(codec_id));
+		return false;
+	}
+
+	_codec_context = ::avcodec_alloc_context3(codec);
+	if (_codec_context == nullptr)
+	{
+		logte("Could not allocate codec context for %s (%d)", ::avcodec_get_name(codec_id), codec_id);
+		return false;
+	}
+
+	if (SetCodecParams() == false)
+	{
+		logte("Could not set codec parameters for %s (%d)", ::avcodec_get_name(codec_id), codec_id);
+		return false;
+	}
+
+	if (::avcodec_open2(_codec_context, codec, nullptr) < 0)
+	{
+		logte("Could not open codec: %s (%d)", codec->name, codec->id);
+		return false;
+	}
+
+	if (StartCodec(ov::String::FormatString("Enc%sQsv", avcodec_get_name(GetCodecID()))) == false)
+	{
+		return false;
+	}
+
+	return true;
+}
+
+TranscodeStepResult EncoderJPEGxQSV::ProcessStep()
+{
+	auto obj = DequeueInput();
+	if (obj.has_value() == false)
+		return TranscodeStepResult::NoInput;
+
+	auto media_frame = std::move(obj.value());
+
+	///////////////////////////////////////////////////
+	// Request frame encoding to codec
+	///////////////////////////////////////////////////
+	auto av_frame = ffmpeg::Conv::ToAVFrame(cmn::MediaType::Video, media_frame);
+	if (!av_frame)
+	{
+		logte("Could not allocate the frame data");
+		return TranscodeStepResult::Stopped;
+	}
+
+	int ret = SendFrameToCodec(av_frame, *media_frame);
+	if (ret < 0)
+	{
+		logte("Error sending a frame for encoding : %d", ret);
+	}
+
+	///////////////////////////////////////////////////
+	// The encoded packet is taken from the codec.
+	///////////////////////////////////////////////////
+	while (true)
+	{
+		// Check frame is available
+		int ret = ::avcodec_receive_packet(_codec_context, _packet);
+		if (ret == AVERROR(EAGAIN))
+		{
+			// More packets are needed for encoding.
+			break;
+		}
+		else if (ret == AVERROR_EOF && ret < 0)
+		{
+			logte("Error receiving a packet for decoding : %d", ret);
+			break;
+		}
+		else
+		{
+			auto media_packet = ffmpeg::Conv::ToMediaPacket(_packet, cmn::MediaType::Video, cmn::BitstreamFormat::JPEG, cmn::PacketType::RAW);
+			if (media_packet == nullptr)
+			{
+				logte("Could not allocate the media packet");
+				break;
+			}
+
+			::av_packet_unref(_packet);
+
+			SendOutputBuffer(std::move(media_packet));
+		}
+	}
+
+	return TranscodeStepResult::Processed;
+}
@@ -0,0 +1,44 @@
+//==============================================================================
+//
+//  Transcode
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include "../../transcoder_encoder.h"
+
+// Quality of the JPEG (1 ~ 100) that mjpeg_qsv uses in place of the quantizer scale of the software encoder
+#define ENCODER_JPEG_QSV_QUALITY	85
+
+class EncoderJPEGxQSV : public TranscodeEncoder
+{
+public:
+	EncoderJPEGxQSV(const info::Stream &stream_info)
+		: TranscodeEncoder(stream_info)
+	{
+	}
+
+	AVCodecID GetCodecID() const noexcept override
+	{
+		return AV_CODEC_ID_MJPEG;
+	}
+
+	int GetSupportedFormat() const noexcept override
+	{
+		return AV_PIX_FMT_NV12;
+	}
+
+	cmn::BitstreamFormat GetBitstreamFormat() const noexcept override
+	{
+		return cmn::BitstreamFormat::JPEG;
+	}
+
+	bool Configure(std::shared_ptr<MediaTrack> context) override;
+
+	TranscodeStepResult ProcessStep() override;
+
+private:
+	bool SetCodecParams() override;
+};
@@ -112,29 +112,21 @@ bool EncoderOPUS::Configure(std::shared_ptr<MediaTrack> context)
 
 	// Setting the maximum size of PCM data to be encoded
 	_buffer = std::make_shared<ov::Data>(max_opus_frame_count * estimated_channel_count * estimated_frame_size);
+	// "1275 * 3 + 7" formula is used in opusenc.c:813
+	// or, use the formula in "AudioEncoderOpusImpl::SufficientOutputBufferSize()" of the native code.
+	_encode_buffer = std::make_shared<ov::Data>(1275 * 3 + 7);
 	_format = cmn::AudioSample::Format::None;
 	_current_pts = -1;
 
-	// Generates a thread that reads and encodes frames in the input_buffer queue and places them in the output queue.
-	try
+	if (StartCodec(ov::String::FormatString("Enc%s", avcodec_get_name(GetCodecID()))) == false)
 	{
-		_kill_flag = false;
-
-		_codec_thread = std::thread(&EncoderOPUS::CodecThread, this);
-		pthread_setname_np(_codec_thread.native_handle(), ov::String::FormatString("Enc%s", avcodec_get_name(GetCodecID())).CStr());
-	}
-	catch (const std::system_error &e)
-	{
-		logte("Failed to start encoder thread.");
-		_kill_flag = true;
-
 		return false;
 	}
 
 	return true;
 }
 
-void EncoderOPUS::CodecThread()
+TranscodeStepResult EncoderOPUS::ProcessStep()
 {
 	// Reference : https://opus-codec.org/docs/opus_api-1.1.3/group__opus__encoder.html#gad2d6bf6a9ffb6674879d7605ed073e25
 	// Number of samples per channel in the input signal. This must be an Opus frame size for the encoder's sampling rate.
@@ -142,138 +134,153 @@ void EncoderOPUS::CodecThread()
 
 	const unsigned int bytes_to_encode = _frame_size * GetRefTrack()->GetChannel().GetCounts() * GetRefTrack()->GetSample().GetSampleSize();
 
-	while (!_kill_flag)
+	// PCM data of <bytes_to_encode> bytes to encode (_buffer, or the frame itself)
+	const void *pcm_data = nullptr;
+	// Keeps the frame alive while it is encoded without copying it into _buffer
+	std::shared_ptr<const MediaFrame> direct_frame;
+
+	// If there is no data to encode, the data is fetched from the queue.
+	if (_buffer->GetLength() < bytes_to_encode)
 	{
-		// If there is no data to encode, the data is fetched from the queue.
-		if (_buffer->GetLength() < bytes_to_encode)
-		{
-			auto obj = _input_buffer.Dequeue();
-			if (obj.has_value() == false)
-				continue;
+		auto obj = DequeueInput();
+		if (obj.has_value() == false)
+			return TranscodeStepResult::NoInput;
 
-			auto media_frame = std::move(obj.value());
-			OV_ASSERT2(media_frame != nullptr);
+		auto media_frame = std::move(obj.value());
+		OV_ASSERT2(media_frame != nullptr);
 
-			// const MediaFrame *frame = media_frame.get();
-			auto av_frame = ffmpeg::Conv::ToAVFrame(cmn::MediaType::Audio, media_frame);
-			if (!av_frame)
-			{
-				logte("Could not allocate the frame data");
-				break;
-			}
+		// const MediaFrame *frame = media_frame.get();
+		auto av_frame = ffmpeg::Conv::ToAVFrame(cmn::MediaType::Audio, media_frame);
+		if (!av_frame)
+		{
+			logte("Could not allocate the frame data");
+			return TranscodeStepResult::Stopped;
+		}
 
-			// Store frame informations
-			_format = media_frame->GetFormat<cmn::AudioSample::Format>();
+		// Store frame informations
+		_format = media_frame->GetFormat<cmn::AudioSample::Format>();
 
-			// Update current pts if the first PTS or PTS goes over frame_size.
-			if (_current_pts == -1 || abs(_current_pts - media_frame->GetPts()) > _frame_size)
-			{
-				_current_pts = media_frame->GetPts();
-			}
+		// Update current pts if the first PTS or PTS goes over frame_size.
+		if (_current_pts == -1 || abs(_current_pts - media_frame->GetPts()) > _frame_size)
+		{
+			_current_pts = media_frame->GetPts();
+		}
 
-			// Append frame data into the buffer
-			if (media_frame->GetChannelCount() == 1)
-			{
-				// Just copy data into buffer
-				_buffer->Append(av_frame->data[0], av_frame->linesize[0]);
-			}
-			else if (media_frame->GetChannelCount() >= 2)
+		bool is_interleaved = (media_frame->GetChannelCount() == 1) || (_format == cmn::AudioSample::Format::S16) || (_format == cmn::AudioSample::Format::Flt);
+
+		// FilterResampler outputs <_frame_size> samples per frame (asetnsamples), so the frame can be encoded as it is
+		if ((_buffer->GetLength() == 0) && is_interleaved && (media_frame->GetNbSamples() == static_cast<int>(_frame_size)))
+		{
+			pcm_data = av_frame->data[0];
+			direct_frame = std::move(media_frame);
+		}
+		// Append frame data into the buffer
+		else if (media_frame->GetChannelCount() == 1)
+		{
+			// Just copy data into buffer
+			_buffer->Append(av_frame->data[0], av_frame->linesize[0]);
+		}
+		else if (media_frame->GetChannelCount() >= 2)
+		{
+			// Currently, OME's OPUS encoder supports up to 2 channels
+			switch (_format)
 			{
-				// Currently, OME's OPUS encoder supports up to 2 channels
-				switch (_format)
-				{
-					case cmn::AudioSample::Format::S16P:
-					case cmn::AudioSample::Format::FltP: {
-						// Need to interleave if sample type is planar
-						off_t current_offset = _buffer->GetLength();
-
-						// Reserve extra spaces
-						// size_t total_bytes = av_frame->linesize[0] + av_frame->linesize[1];
-						auto total_bytes = static_cast<uint32_t>(media_frame->GetBytesPerSample() * media_frame->GetNbSamples()) * media_frame->GetChannelCount();
-						_buffer->SetLength(current_offset + total_bytes);
-
-						if (_format == cmn::AudioSample::Format::S16P)
-						{
-							// S16P
-							ov::Interleave<int16_t>(_buffer->GetWritableDataAs<uint8_t>() + current_offset, av_frame->data[0], av_frame->data[1], media_frame->GetNbSamples());
-							_format = cmn::AudioSample::Format::S16;
-						}
-						else
-						{
-							// FltP
-							ov::Interleave<float>(_buffer->GetWritableDataAs<uint8_t>() + current_offset, av_frame->data[0], av_frame->data[1], media_frame->GetNbSamples());
-							_format = cmn::AudioSample::Format::Flt;
-						}
-						break;
+				case cmn::AudioSample::Format::S16P:
+				case cmn::AudioSample::Format::FltP: {
+					// Need to interleave if sample type is planar
+					off_t current_offset = _buffer->GetLength();
+
+					// Reserve extra spaces
+					// size_t total_bytes = av_frame->linesize[0] + av_frame->linesize[1];
+					auto total_bytes = static_cast<uint32_t>(media_frame->GetBytesPerSample() * media_frame->GetNbSamples()) * media_frame->GetChannelCount();
+					_buffer->SetLength(current_offset + total_bytes);
+
+					if (_format == cmn::AudioSample::Format::S16P)
+					{
+						// S16P
+						ov::Interleave<int16_t>(_buffer->GetWritableDataAs<uint8_t>() + current_offset, av_frame->data[0], av_frame->data[1], media_frame->GetNbSamples());
+						_format = cmn::AudioSample::Format::S16;
 					}
+					else
+					{
+						// FltP
+						ov::Interleave<float>(_buffer->GetWritableDataAs<uint8_t>() + current_offset, av_frame->data[0], av_frame->data[1], media_frame->GetNbSamples());
+						_format = cmn::AudioSample::Format::Flt;
+					}
+					break;
+				}
 
-					case cmn::AudioSample::Format::S16:
-					case cmn::AudioSample::Format::Flt:
-						// Do not need to interleave if sample type is non-planar
-						_buffer->Append(av_frame->data[0], av_frame->linesize[0]);
-						break;
+				case cmn::AudioSample::Format::S16:
+				case cmn::AudioSample::Format::Flt:
+					// Do not need to interleave if sample type is non-planar
+					_buffer->Append(av_frame->data[0], av_frame->linesize[0]);
+					break;
 
-					default:
-						logte("Not supported format: %d", _format);
-						break;
-				}
+				default:
+					logte("Not supported format: %d", _format);
+					break;
 			}
 		}
+	}
 
+	if (pcm_data == nullptr)
+	{
 		if (_buffer->GetLength() < bytes_to_encode)
 		{
 			// There is no data to encode
 			// logte("There is no data to encode");
-			continue;
+			return TranscodeStepResult::Processed;
 		}
-		OV_ASSERT2(_current_pts >= 0);
-		OV_ASSERT2(_buffer->GetLength() >= bytes_to_encode);
-
-		// "1275 * 3 + 7" formula is used in opusenc.c:813
-		// or, use the formula in "AudioEncoderOpusImpl::SufficientOutputBufferSize()" of the native code.
-		std::shared_ptr<ov::Data> encoded = std::make_shared<ov::Data>(1275 * 3 + 7);
-		encoded->SetLength(encoded->GetCapacity());
-
-		// result of opus_encode[_float] function
-		//  The length of the encoded packet (in bytes) on success or a negative error code (see Error codes) on failure.
-		int encoded_bytes = -1;
-		// Encode
-		switch (_format)
-		{
-			case cmn::AudioSample::Format::S16:
-				encoded_bytes = ::opus_encode(_encoder, _buffer->GetDataAs<const opus_int16>(), _frame_size, encoded->GetWritableDataAs<unsigned char>(), static_cast<opus_int32>(encoded->GetCapacity()));
-				break;
 
-			case cmn::AudioSample::Format::Flt:
-				encoded_bytes = ::opus_encode_float(_encoder, _buffer->GetDataAs<float>(), _frame_size, encoded->GetWritableDataAs<unsigned char>(), static_cast<opus_int32>(encoded->GetCapacity()));
-				break;
+		pcm_data = _buffer->GetData();
+	}
+	OV_ASSERT2(_current_pts >= 0);
 
-			default:
-				continue;
-		}
+	// result of opus_encode[_float] function
+	//  The length of the encoded packet (in bytes) on success or a negative error code (see Error codes) on failure.
+	int encoded_bytes = -1;
+	// Encode
+	switch (_format)
+	{
+		case cmn::AudioSample::Format::S16:
+			encoded_bytes = ::opus_encode(_encoder, static_cast<const opus_int16 *>(pcm_data), _frame_size, _encode_buffer->GetWritableDataAs<unsigned char>(), static_cast<opus_int32>(_encode_buffer->GetCapacity()));
+			break;
 
-		if (encoded_bytes < 0)
-		{
-			logte("An error occurred while encode data %zu bytes. error:%d", _buffer->GetLength(), encoded_bytes);
-			continue;
-		}
+		case cmn::AudioSample::Format::Flt:
+			encoded_bytes = ::opus_encode_float(_encoder, static_cast<const float *>(pcm_data), _frame_size, _encode_buffer->GetWritableDataAs<unsigned char>(), static_cast<opus_int32>(_encode_buffer->GetCapacity()));
+			break;
+
+		default:
+			return TranscodeStepResult::Processed;
+	}
 
-		encoded->SetLength(static_cast<size_t>(encoded_bytes));
+	if (encoded_bytes < 0)
+	{
+		logte("An error occurred while encode data %zu bytes. error:%d", _buffer->GetLength(), encoded_bytes);
+		return TranscodeStepResult::Processed;
+	}
 
-		// Data is encoded successfully
-		// dequeue <bytes_to_encoded> bytes
+	// The packet only allocates the encoded bytes instead of the maximum packet size
+	auto encoded = std::make_shared<ov::Data>(_encode_buffer->GetData(), static_cast<size_t>(encoded_bytes));
+
+	// Data is encoded successfully
+	// dequeue <bytes_to_encoded> bytes
+	if (direct_frame == nullptr)
+	{
 		auto buffer = _buffer->GetWritableDataAs<uint8_t>();
 		::memmove(buffer, buffer + bytes_to_encode, _buffer->GetLength() - bytes_to_encode);
 		_buffer->SetLength(_buffer->GetLength() - bytes_to_encode);
+	}
 
-		int64_t duration = _frame_size;
+	int64_t duration = _frame_size;
 
-		auto packet_buffer = std::make_shared<MediaPacket>(0, cmn::MediaType::Audio, 0, encoded, _current_pts, _current_pts, duration, MediaPacketFlag::Key);
-		packet_buffer->SetBitstreamFormat(cmn::BitstreamFormat::OPUS);
-		packet_buffer->SetPacketType(cmn::PacketType::RAW);
+	auto packet_buffer = std::make_shared<MediaPacket>(0, cmn::MediaType::Audio, 0, encoded, _current_pts, _current_pts, duration, MediaPacketFlag::Key);
+	packet_buffer->SetBitstreamFormat(cmn::BitstreamFormat::OPUS);
+	packet_buffer->SetPacketType(cmn::PacketType::RAW);
 
-		_current_pts += duration;
+	_current_pts += duration;
 
-		SendOutputBuffer(std::move(packet_buffer));
-	}
+	SendOutputBuffer(std::move(packet_buffer));
+
+	return TranscodeStepResult::Processed;
 }
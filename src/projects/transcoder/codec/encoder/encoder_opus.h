@@ -41,13 +41,15 @@ public:
 
 	// void SendBuffer(std::shared_ptr<const MediaFrame> frame) override;
 
-	void CodecThread() override;
+	TranscodeStepResult ProcessStep() override;
 
 private:
 	bool SetCodecParams() override;
 	
 protected:
 	std::shared_ptr<ov::Data> _buffer;
+	// Reused for every packet to encode into
+	std::shared_ptr<ov::Data> _encode_buffer;
 	int _expert_frame_duration;
 	cmn::AudioSample::Format _format;
 	int64_t _current_pts;
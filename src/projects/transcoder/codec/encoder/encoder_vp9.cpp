@@ -0,0 +1,212 @@
+//==============================================================================
+//
+//  Transcode
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "encoder_vp9.h"
+
+#include "../../transcoder_private.h"
+
+bool EncoderVP9::SetCodecParams()
+{
+	_codec_context->bit_rate = GetRefTrack()->GetBitrate();
+	_codec_context->rc_max_rate = _codec_context->bit_rate;
+	_codec_context->rc_min_rate = _codec_context->bit_rate;
+	_codec_context->sample_aspect_ratio = (AVRational){1, 1};
+	_codec_context->time_base = ffmpeg::Conv::TimebaseToAVRational(GetRefTrack()->GetTimeBase());
+	_codec_context->framerate = ::av_d2q((GetRefTrack()->GetFrameRate() > 0) ? GetRefTrack()->GetFrameRate() : GetRefTrack()->GetEstimateFrameRate(), AV_TIME_BASE);
+	_codec_context->max_b_frames = 0;
+	_codec_context->pix_fmt = (AVPixelFormat)GetSupportedFormat();
+	_codec_context->width = GetRefTrack()->GetWidth();
+	_codec_context->height = GetRefTrack()->GetHeight();
+
+	// Set KeyFrame Interval
+	_codec_context->gop_size = (GetRefTrack()->GetKeyFrameInterval() == 0) ? (_codec_context->framerate.num / _codec_context->framerate.den) : GetRefTrack()->GetKeyFrameInterval();
+	ConfigureKeyFrameAlignment();
+	
+	// Frames are not reordered (no alt-ref frame), so one packet comes out for every input frame
+	::av_opt_set_int(_codec_context->priv_data, "lag-in-frames", 0, 0);
+	::av_opt_set_int(_codec_context->priv_data, "row-mt", 1, 0);
+
+	// -1(Default) => FFMIN(FFMAX(4, av_cpu_count() / 3), 8) 
+	// 0 => Auto
+	// >1 => Set
+	_codec_context->thread_count = GetRefTrack()->GetThreadCount() < 0 ? FFMIN(FFMAX(4, av_cpu_count() / 3), 8) : GetRefTrack()->GetThreadCount();
+
+	// Preset
+	::av_opt_set(_codec_context->priv_data, "quality", "realtime", 0);
+
+	auto preset = GetRefTrack()->GetPreset().LowerCaseString();
+	if (preset.IsEmpty() == true)
+	{
+		::av_opt_set_int(_codec_context->priv_data, "cpu-used", 7, 0);
+	}
+	else
+	{
+		if (preset == "slower")
+		{
+			::av_opt_set_int(_codec_context->priv_data, "cpu-used", 4, 0);
+		}
+		else if (preset == "slow")
+		{
+			::av_opt_set_int(_codec_context->priv_data, "cpu-used", 5, 0);
+		}
+		else if (preset == "medium")
+		{
+			::av_opt_set_int(_codec_context->priv_data, "cpu-used", 6, 0);
+		}
+		else if (preset == "fast")
+		{
+			::av_opt_set_int(_codec_context->priv_data, "cpu-used", 7, 0);
+		}
+		else if (preset == "faster")
+		{
+			::av_opt_set_int(_codec_context->priv_data, "cpu-used", 8, 0);
+		}
+		else
+		{
+			logtw("Unknown preset: %s", preset.CStr());
+		}
+	}
+
+	// Temporal scalability
+	// The upper layers can be dropped by the WebRTC sessions whose bandwidth is not enough.
+	// The layers use the pattern of ts_layering_mode of libvpx, which has fixed ratios of the bitrate.
+	auto temporal_layers = GetRefTrack()->GetTemporalLayers();
+	if (temporal_layers > 1)
+	{
+		auto track = GetRefTrack();
+		ov::String ts_parameters;
+
+		if (temporal_layers == 2)
+		{
+			// 0-1-0-1... (60%, 100%)
+			ts_parameters.Format("ts_number_layers=2:ts_target_bitrate=%d,%d:ts_rate_decimator=2,1:ts_periodicity=2:ts_layer_id=0,1:ts_layering_mode=2",
+								 track->GetTemporalLayerBitrate(0) / 1000, track->GetTemporalLayerBitrate(1) / 1000);
+			_temporal_layer_pattern = {0, 1};
+		}
+		else
+		{
+			// 0-2-1-2... (50%, 75%, 100%)
+			ts_parameters.Format("ts_number_layers=3:ts_target_bitrate=%d,%d,%d:ts_rate_decimator=4,2,1:ts_periodicity=4:ts_layer_id=0,2,1,2:ts_layering_mode=3",
+								 track->GetTemporalLayerBitrate(0) / 1000, track->GetTemporalLayerBitrate(1) / 1000, track->GetTemporalLayerBitrate(2) / 1000);
+			_temporal_layer_pattern = {0, 2, 1, 2};
+		}
+
+		// A frame of the upper layer can be lost (dropped) without breaking the decoding of the other frames
+		::av_opt_set_int(_codec_context->priv_data, "error-resilient", 1, 0);
+		::av_opt_set(_codec_context->priv_data, "ts-parameters", ts_parameters.CStr(), 0);
+	}
+
+	return true;
+}
+
+bool EncoderVP9::Configure(std::shared_ptr<MediaTrack> context)
+{
+	if (TranscodeEncoder::Configure(context) == false)
+	{
+		return false;
+	}
+
+	auto codec_id = GetCodecID();
+
+	const AVCodec *codec = ::avcodec_find_encoder(codec_id);
+	if (codec == nullptr)
+	{
+		logte("Could not find encoder: %d (%s)", codec_id, ::avcodec_get_name(codec_id));
+		return false;
+	}
+
+	_codec_context = ::avcodec_alloc_context3(codec);
+	if (_codec_context == nullptr)
+	{
+		logte("Could not allocate codec context for %s (%d)", ::avcodec_get_name(codec_id), codec_id);
+		return false;
+	}
+
+	if (SetCodecParams() == false)
+	{
+		logte("Could not set codec parameters for %s (%d)", ::avcodec_get_name(codec_id), codec_id);
+		return false;
+	}
+
+	if (::avcodec_open2(_codec_context, codec, nullptr) < 0)
+	{
+		logte("Could not open codec");
+		return false;
+	}
+
+	if (StartCodec(ov::String::FormatString("Enc%s", avcodec_get_name(GetCodecID()))) == false)
+	{
+		return false;
+	}
+
+	return true;
+}
+
+TranscodeStepResult EncoderVP9::ProcessStep()
+{
+	auto obj = DequeueInput();
+	if (obj.has_value() == false)
+		return TranscodeStepResult::NoInput;
+
+	auto media_frame = std::move(obj.value());
+
+	///////////////////////////////////////////////////
+	// Request frame encoding to codec
+	///////////////////////////////////////////////////
+	auto av_frame = ffmpeg::Conv::ToAVFrame(cmn::MediaType::Video, media_frame);
+	if (!av_frame)
+	{
+		logte("Could not allocate the frame data");
+		return TranscodeStepResult::Stopped;
+	}
+
+	int ret = SendFrameToCodec(av_frame, *media_frame);
+	if (ret < 0)
+	{
+		logte("Error sending a frame for encoding : %d", ret);
+	}
+
+	///////////////////////////////////////////////////
+	// The encoded packet is taken from the codec.
+	///////////////////////////////////////////////////
+	while (true)
+	{
+		// Check frame is available
+		int ret = ::avcodec_receive_packet(_codec_context, _packet);
+		if (ret == AVERROR(EAGAIN))
+		{
+			// More packets are needed for encoding.
+			break;
+		}
+		else if (ret == AVERROR_EOF && ret < 0)
+		{
+			logte("Error receiving a packet for decoding : %d", ret);
+			break;
+		}
+		else
+		{
+			auto media_packet = ffmpeg::Conv::ToMediaPacket(_packet, cmn::MediaType::Video, cmn::BitstreamFormat::VP9, cmn::PacketType::RAW);
+			if (media_packet == nullptr)
+			{
+				logte("Could not allocate the media packet");
+				break;
+			}
+
+			if (_temporal_layer_pattern.empty() == false)
+			{
+				media_packet->SetTemporalLayerId(_temporal_layer_pattern[_temporal_layer_index]);
+				_temporal_layer_index = (_temporal_layer_index + 1) % _temporal_layer_pattern.size();
+			}
+
+			::av_packet_unref(_packet);
+
+			SendOutputBuffer(std::move(media_packet));
+		}
+	}
+
+	return TranscodeStepResult::Processed;
+}
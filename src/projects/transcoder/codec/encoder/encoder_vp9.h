@@ -0,0 +1,46 @@
+//==============================================================================
+//
+//  Transcode
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include "../../transcoder_encoder.h"
+
+class EncoderVP9 : public TranscodeEncoder
+{
+public:
+	EncoderVP9(const info::Stream &stream_info)
+		: TranscodeEncoder(stream_info)
+	{
+	}
+
+	AVCodecID GetCodecID() const noexcept override
+	{
+		return AV_CODEC_ID_VP9;
+	}
+
+	int GetSupportedFormat() const noexcept override
+	{
+		return AV_PIX_FMT_YUV420P;
+	}
+
+	cmn::BitstreamFormat GetBitstreamFormat() const noexcept override
+	{
+		return cmn::BitstreamFormat::VP9;
+	}
+
+	bool Configure(std::shared_ptr<MediaTrack> context) override;
+
+	TranscodeStepResult ProcessStep() override;
+
+private:
+	bool SetCodecParams() override;
+
+	// The temporal layer id of each frame in the pattern of ts_layering_mode (libvpx)
+	std::vector<uint8_t> _temporal_layer_pattern;
+	// Index of the next output frame in the pattern
+	size_t _temporal_layer_index = 0;
+};
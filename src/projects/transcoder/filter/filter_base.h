@@ -74,8 +74,26 @@ public:
 		_input_buffer.SetUrn(alias.CStr());
 	}
 
+	// The filters with the same key run on the same NUMA node of TranscodePipelineScheduler
+	void SetPipelineAffinityKey(size_t affinity_key)
+	{
+		_pipeline_affinity_key = affinity_key;
+	}
+
+	// Average waiting time of the frames in the input queue
+	int64_t GetInputWaitingTimeInUs() const
+	{
+		return _input_buffer.GetWaitingTimeInUs();
+	}
+
 protected:
-	ov::ManagedQueue<std::shared_ptr<MediaFrame>> _input_buffer;
+	// Waits for an input on the filter thread, but returns immediately on TranscodePipelineScheduler
+	std::optional<std::shared_ptr<MediaFrame>> DequeueInput()
+	{
+		return _input_buffer.Dequeue((_pipeline_stage != nullptr) ? 0 : ov::Infinite);
+	}
+
+	ov::ManagedQueue<std::shared_ptr<MediaFrame>, ov::ManagedQueueRingBuffer<512>> _input_buffer;
 
 	AVFrame *_frame = nullptr;
 	AVFilterContext *_buffersink_ctx = nullptr;
@@ -96,5 +114,9 @@ protected:
 	bool _kill_flag = false;
 	std::thread _thread_work;
 
+	size_t _pipeline_affinity_key = 0;
+	// Not nullptr if the filter runs as a stage of TranscodePipelineScheduler instead of its own thread
+	std::shared_ptr<TranscodePipelineScheduler::Stage> _pipeline_stage;
+
 	CompleteHandler _complete_handler;
 };
@@ -0,0 +1,384 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+
+#include "filter_multi_rescaler.h"
+
+#include <base/ovlibrary/ovlibrary.h>
+
+#include <numeric>
+
+#include "../transcoder_gpu.h"
+#include "../transcoder_private.h"
+
+#define MAX_QUEUE_SIZE 500
+
+FilterMultiRescaler::FilterMultiRescaler()
+{
+	_frame = ::av_frame_alloc();
+
+	_outputs = ::avfilter_inout_alloc();
+
+	_input_buffer.SetThreshold(MAX_QUEUE_SIZE);
+
+	OV_ASSERT2(_frame != nullptr);
+	OV_ASSERT2(_outputs != nullptr);
+}
+
+FilterMultiRescaler::~FilterMultiRescaler()
+{
+	Stop();
+
+	OV_SAFE_FUNC(_frame, nullptr, ::av_frame_free, &);
+
+	OV_SAFE_FUNC(_inputs, nullptr, ::avfilter_inout_free, &);
+	OV_SAFE_FUNC(_outputs, nullptr, ::avfilter_inout_free, &);
+
+	OV_SAFE_FUNC(_filter_graph, nullptr, ::avfilter_graph_free, &);
+
+	_input_buffer.Clear();
+}
+
+bool FilterMultiRescaler::IsSupported(const std::shared_ptr<MediaTrack> &input_track, const std::shared_ptr<MediaTrack> &output_track)
+{
+	if ((input_track->GetColorspace() == AV_PIX_FMT_CUDA) || (output_track->GetColorspace() == AV_PIX_FMT_CUDA))
+	{
+		return false;
+	}
+
+	// Same condition as the scale_cuda path of FilterRescaler
+	if (output_track->GetHardwareAccel() == true &&
+		TranscodeGPU::GetInstance()->IsSupportedNV() == true &&
+		input_track->GetColorspace() == AV_PIX_FMT_NV12 &&
+		output_track->GetColorspace() == AV_PIX_FMT_NV12)
+	{
+		return false;
+	}
+
+	return true;
+}
+
+bool FilterMultiRescaler::Configure(const std::shared_ptr<MediaTrack> &input_track, const std::shared_ptr<MediaTrack> &output_track)
+{
+	return Configure(input_track, std::vector<std::shared_ptr<MediaTrack>>{output_track});
+}
+
+bool FilterMultiRescaler::Configure(const std::shared_ptr<MediaTrack> &input_track, const std::vector<std::shared_ptr<MediaTrack>> &output_tracks)
+{
+	if (output_tracks.empty())
+	{
+		logte("There is no output track for rescaling");
+		return false;
+	}
+
+	_input_track = input_track;
+	_output_track = output_tracks.front();
+	_output_tracks = output_tracks;
+
+	AVRational input_timebase = ffmpeg::Conv::TimebaseToAVRational(input_track->GetTimeBase());
+
+	for (auto &output_track : output_tracks)
+	{
+		AVRational output_timebase = ffmpeg::Conv::TimebaseToAVRational(output_track->GetTimeBase());
+
+		if (::isnan(::av_q2d(::av_div_q(input_timebase, output_timebase))))
+		{
+			logte("Invalid timebase: input: %d/%d, output: %d/%d",
+				  input_timebase.num, input_timebase.den,
+				  output_timebase.num, output_timebase.den);
+
+			return false;
+		}
+	}
+
+	_scale = ::av_q2d(::av_div_q(input_timebase, ffmpeg::Conv::TimebaseToAVRational(_output_track->GetTimeBase())));
+
+	const AVFilter *buffersrc = ::avfilter_get_by_name("buffer");
+	const AVFilter *buffersink = ::avfilter_get_by_name("buffersink");
+	int ret;
+	_filter_graph = ::avfilter_graph_alloc();
+
+	if ((_filter_graph == nullptr) || (_outputs == nullptr))
+	{
+		logte("Could not allocate variables for filter graph: %p, %p", _filter_graph, _outputs);
+		return false;
+	}
+
+	// Limit the number of filter threads to 4. I think 4 thread is usually enough for video filtering processing.
+	_filter_graph->nb_threads = 4;
+
+	// Prepare the input parameters
+	std::vector<ov::String> src_params = {
+		ov::String::FormatString("video_size=%dx%d", input_track->GetWidth(), input_track->GetHeight()),
+		ov::String::FormatString("pix_fmt=%d", input_track->GetColorspace()),
+		ov::String::FormatString("time_base=%s", input_track->GetTimeBase().GetStringExpr().CStr()),
+		ov::String::FormatString("pixel_aspect=%d/%d", 1, 1)};
+
+	ov::String src_args = ov::String::Join(src_params, ":");
+
+	ret = ::avfilter_graph_create_filter(&_buffersrc_ctx, buffersrc, "in", src_args, nullptr, _filter_graph);
+	if (ret < 0)
+	{
+		logte("Could not create video buffer source filter for rescaling: %d", ret);
+		return false;
+	}
+
+	// Prepare output filters
+	_buffersink_ctx_list.assign(output_tracks.size(), nullptr);
+
+	for (size_t index = 0; index < output_tracks.size(); index++)
+	{
+		auto name = ov::String::FormatString("out%zu", index);
+
+		ret = ::avfilter_graph_create_filter(&_buffersink_ctx_list[index], buffersink, name, nullptr, nullptr, _filter_graph);
+		if (ret < 0)
+		{
+			logte("Could not create video buffer sink filter for rescaling: %d", ret);
+			return false;
+		}
+
+		enum AVPixelFormat pix_fmts[] = {(AVPixelFormat)output_tracks[index]->GetColorspace(), AV_PIX_FMT_NONE};
+		ret = av_opt_set_int_list(_buffersink_ctx_list[index], "pix_fmts", pix_fmts, AV_PIX_FMT_NONE, AV_OPT_SEARCH_CHILDREN);
+		if (ret < 0)
+		{
+			logte("Could not set output pixel format for rescaling: %d", ret);
+			return false;
+		}
+
+		auto input = ::avfilter_inout_alloc();
+		if (input == nullptr)
+		{
+			logte("Could not allocate the output of filter graph");
+			return false;
+		}
+
+		input->name = ::av_strdup(name);
+		input->filter_ctx = _buffersink_ctx_list[index];
+		input->pad_idx = 0;
+		input->next = _inputs;
+		_inputs = input;
+	}
+
+	_buffersink_ctx = _buffersink_ctx_list.front();
+
+	// Scale from the largest output to the smallest output
+	std::vector<size_t> order(output_tracks.size());
+	std::iota(order.begin(), order.end(), 0);
+	std::stable_sort(order.begin(), order.end(), [&output_tracks](size_t a, size_t b) -> bool {
+		return (static_cast<int64_t>(output_tracks[a]->GetWidth()) * output_tracks[a]->GetHeight()) >
+			   (static_cast<int64_t>(output_tracks[b]->GetWidth()) * output_tracks[b]->GetHeight());
+	});
+
+	std::vector<ov::String> chains;
+	ov::String source_label = "in";
+
+	for (size_t position = 0; position < order.size(); position++)
+	{
+		auto output_index = order[position];
+		auto &output_track = output_tracks[output_index];
+		bool is_last = (position + 1 == order.size());
+
+		auto chain = ov::String::FormatString("[%s]scale=%dx%d:flags=bilinear", source_label.CStr(), output_track->GetWidth(), output_track->GetHeight());
+
+		// Filters of this output only
+		std::vector<ov::String> filters;
+
+		if (output_track->GetFrameRateByConfig() > 0.0f)
+		{
+			filters.push_back(ov::String::FormatString("fps=fps=%.2f:round=near", output_track->GetFrameRateByConfig()));
+		}
+
+		filters.push_back(ov::String::FormatString("settb=%s", output_track->GetTimeBase().GetStringExpr().CStr()));
+
+		if (is_last)
+		{
+			chain.AppendFormat(",%s[out%zu]", ov::String::Join(filters, ",").CStr(), output_index);
+			chains.push_back(chain);
+		}
+		else
+		{
+			// The next output is scaled from this output
+			chain.AppendFormat(",split=2[branch%zu][next%zu]", position, position);
+			chains.push_back(chain);
+			chains.push_back(ov::String::FormatString("[branch%zu]%s[out%zu]", position, ov::String::Join(filters, ",").CStr(), output_index));
+
+			source_label = ov::String::FormatString("next%zu", position);
+		}
+	}
+
+	ov::String output_filters = ov::String::Join(chains, ";");
+
+	_outputs->name = ::av_strdup("in");
+	_outputs->filter_ctx = _buffersrc_ctx;
+	_outputs->pad_idx = 0;
+	_outputs->next = nullptr;
+
+	if ((ret = ::avfilter_graph_parse_ptr(_filter_graph, output_filters, &_inputs, &_outputs, nullptr)) < 0)
+	{
+		logte("Could not parse filter string for rescaling: %d (%s)", ret, output_filters.CStr());
+		return false;
+	}
+
+	if ((ret = ::avfilter_graph_config(_filter_graph, nullptr)) < 0)
+	{
+		logte("Could not validate filter graph for rescaling: %d", ret);
+		return false;
+	}
+
+	logti("Multi-output rescaler is enabled for track #%u using parameters. input: %s / outputs: %s", input_track->GetId(), src_args.CStr(), output_filters.CStr());
+
+	_input_width = input_track->GetWidth();
+	_input_height = input_track->GetHeight();
+
+	return true;
+}
+
+int32_t FilterMultiRescaler::SendBuffer(std::shared_ptr<MediaFrame> buffer)
+{
+	_input_buffer.Enqueue(std::move(buffer));
+
+	if (_pipeline_stage != nullptr)
+	{
+		_pipeline_stage->Notify();
+	}
+
+	return 0;
+}
+
+bool FilterMultiRescaler::Start()
+{
+	auto scheduler = TranscodePipelineScheduler::GetInstance();
+
+	if (scheduler->IsRunning())
+	{
+		_kill_flag = false;
+
+		_pipeline_stage = scheduler->CreateStage(
+			"MultiRescaler", _pipeline_affinity_key,
+			[this]() -> TranscodeStepResult {
+				return ProcessStep();
+			},
+			[this]() -> bool {
+				return (_input_buffer.IsEmpty() == false);
+			});
+
+		return (_pipeline_stage != nullptr);
+	}
+
+	try
+	{
+		_kill_flag = false;
+
+		_thread_work = std::thread(&FilterMultiRescaler::FilterThread, this);
+		pthread_setname_np(_thread_work.native_handle(), "MultiRescaler");
+	}
+	catch (const std::system_error &e)
+	{
+		_kill_flag = true;
+
+		logte("Failed to start multi-output rescaling filter thread");
+		return false;
+	}
+
+	return true;
+}
+
+void FilterMultiRescaler::Stop()
+{
+	_kill_flag = true;
+
+	_input_buffer.Stop();
+
+	if (_pipeline_stage != nullptr)
+	{
+		// The stage is not released here because SendBuffer() may be using it
+		_pipeline_stage->Detach();
+	}
+
+	if (_thread_work.joinable())
+	{
+		_thread_work.join();
+		logtd("multi-output rescaling filter thread has ended");
+	}
+}
+
+void FilterMultiRescaler::FilterThread()
+{
+	ov::ThreadRegistry::Registration registration("Filter");
+
+	logtd("Start multi-output rescaling filter thread");
+
+	while (!_kill_flag)
+	{
+		if (ProcessStep() == TranscodeStepResult::Stopped)
+		{
+			break;
+		}
+	}
+}
+
+TranscodeStepResult FilterMultiRescaler::ProcessStep()
+{
+	auto obj = DequeueInput();
+	if (obj.has_value() == false)
+		return TranscodeStepResult::NoInput;
+
+	auto media_frame = std::move(obj.value());
+
+	auto av_frame = ffmpeg::Conv::ToAVFrame(cmn::MediaType::Video, media_frame);
+	if (!av_frame)
+	{
+		logte("Could not allocate the video frame data");
+		return TranscodeStepResult::Stopped;
+	}
+
+	int ret = ::av_buffersrc_add_frame_flags(_buffersrc_ctx, av_frame, AV_BUFFERSRC_FLAG_KEEP_REF);
+	if (ret < 0)
+	{
+		logte("An error occurred while feeding the video filtergraph: format: %d, pts: %lld, size: %d", av_frame->format, av_frame->pts, _input_buffer.Size());
+
+		return TranscodeStepResult::Processed;
+	}
+
+	for (size_t output_index = 0; output_index < _buffersink_ctx_list.size(); output_index++)
+	{
+		while (true)
+		{
+			ret = ::av_buffersink_get_frame(_buffersink_ctx_list[output_index], _frame);
+			if (ret == AVERROR(EAGAIN))
+			{
+				// Need more data
+				break;
+			}
+			else if (ret == AVERROR_EOF)
+			{
+				logte("End of file error(%d)", ret);
+				break;
+			}
+			else if (ret < 0)
+			{
+				logte("Unknown error is occurred while get frame. error(%d)", ret);
+				break;
+			}
+
+			_frame->pict_type = AV_PICTURE_TYPE_NONE;
+			auto output_frame = ffmpeg::Conv::ToMediaFrame(cmn::MediaType::Video, _frame);
+			::av_frame_unref(_frame);
+			if (output_frame == nullptr)
+			{
+				continue;
+			}
+
+			if (_output_complete_handler != nullptr && _kill_flag == false)
+			{
+				_output_complete_handler(output_index, std::move(output_frame));
+			}
+		}
+	}
+
+	return TranscodeStepResult::Processed;
+}
@@ -0,0 +1,59 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+
+#pragma once
+
+#include "../transcoder_context.h"
+#include "base/mediarouter/media_buffer.h"
+#include "base/mediarouter/media_type.h"
+#include "filter_base.h"
+
+// Scales a video track to the multiple resolutions of an ABR ladder in a filter graph
+//
+// The outputs are scaled in a cascade (from the largest output to the smallest output), so each output is
+// scaled from the previous output instead of the input, and the pixel format is converted only once.
+//
+// Filter graph:
+//     [buffer] -> [scale] -> [split] -> [fps] -> [settb] -> [buffersink] (largest output)
+//                               |
+//                               +-----> [scale] -> [split] -> ... (next output)
+class FilterMultiRescaler : public FilterBase
+{
+public:
+	// <output_index> is the index of the output track passed to Configure()
+	typedef std::function<void(size_t output_index, std::shared_ptr<MediaFrame>)> OutputCompleteHandler;
+
+	FilterMultiRescaler();
+	~FilterMultiRescaler();
+
+	// Only the outputs scaled by software can be in the graph
+	static bool IsSupported(const std::shared_ptr<MediaTrack> &input_track, const std::shared_ptr<MediaTrack> &output_track);
+
+	bool Configure(const std::shared_ptr<MediaTrack> &input_track, const std::shared_ptr<MediaTrack> &output_track) override;
+	bool Configure(const std::shared_ptr<MediaTrack> &input_track, const std::vector<std::shared_ptr<MediaTrack>> &output_tracks);
+
+	void SetOutputCompleteHandler(OutputCompleteHandler complete_handler)
+	{
+		_output_complete_handler = std::move(complete_handler);
+	}
+
+	int32_t SendBuffer(std::shared_ptr<MediaFrame> buffer) override;
+
+	void FilterThread();
+	TranscodeStepResult ProcessStep();
+
+	bool Start() override;
+	void Stop() override;
+
+protected:
+	std::vector<std::shared_ptr<MediaTrack>> _output_tracks;
+	// Indexed by the output index
+	std::vector<AVFilterContext *> _buffersink_ctx_list;
+
+	OutputCompleteHandler _output_complete_handler;
+};
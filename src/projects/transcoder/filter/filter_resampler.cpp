@@ -151,6 +151,24 @@ bool FilterResampler::Configure(const std::shared_ptr<MediaTrack> &input_track,
 
 bool FilterResampler::Start()
 {
+	auto scheduler = TranscodePipelineScheduler::GetInstance();
+
+	if (scheduler->IsRunning())
+	{
+		_kill_flag = false;
+
+		_pipeline_stage = scheduler->CreateStage(
+			"Resampler", _pipeline_affinity_key,
+			[this]() -> TranscodeStepResult {
+				return ProcessStep();
+			},
+			[this]() -> bool {
+				return (_input_buffer.IsEmpty() == false);
+			});
+
+		return (_pipeline_stage != nullptr);
+	}
+
 	// Generates a thread that reads and encodes frames in the input_buffer queue and places them in the output queue.
 	try
 	{
@@ -177,6 +195,12 @@ void FilterResampler::Stop()
 
 	_input_buffer.Stop();
 
+	if (_pipeline_stage != nullptr)
+	{
+		// The stage is not released here because SendBuffer() may be using it
+		_pipeline_stage->Detach();
+	}
+
 	if (_thread_work.joinable())
 	{
 		_thread_work.join();
@@ -186,70 +210,87 @@ void FilterResampler::Stop()
 
 void FilterResampler::FilterThread()
 {
+	ov::ThreadRegistry::Registration registration("Filter");
+
 	logtd("Start resampler filter thread.");
 
 	while (!_kill_flag)
 	{
-		auto obj = _input_buffer.Dequeue();
-		if (obj.has_value() == false)
-			continue;
+		if (ProcessStep() == TranscodeStepResult::Stopped)
+		{
+			break;
+		}
+	}
+}
 
-		auto media_frame = std::move(obj.value());
+TranscodeStepResult FilterResampler::ProcessStep()
+{
+	auto obj = DequeueInput();
+	if (obj.has_value() == false)
+		return TranscodeStepResult::NoInput;
 
-		auto av_frame = ffmpeg::Conv::ToAVFrame(cmn::MediaType::Video, media_frame);
-		if (!av_frame)
+	auto media_frame = std::move(obj.value());
+
+	auto av_frame = ffmpeg::Conv::ToAVFrame(cmn::MediaType::Video, media_frame);
+	if (!av_frame)
+	{
+		logte("Could not allocate the frame data");
+		return TranscodeStepResult::Stopped;
+	}
+
+	int ret = ::av_buffersrc_add_frame_flags(_buffersrc_ctx, av_frame, AV_BUFFERSRC_FLAG_KEEP_REF);
+	if (ret < 0)
+	{
+		logte("An error occurred while feeding the audio filtergraph: pts: %lld, linesize: %d, srate: %d, layout: %d, channels: %d, format: %d, rq: %d", _frame->pts, _frame->linesize[0], _frame->sample_rate, _frame->channel_layout, _frame->channels, _frame->format, _input_buffer.Size());
+		return TranscodeStepResult::Processed;
+	}
+
+	while (true)
+	{
+		int ret = ::av_buffersink_get_frame(_buffersink_ctx, _frame);
+
+		if (ret == AVERROR(EAGAIN))
 		{
-			logte("Could not allocate the frame data");
 			break;
 		}
-
-		int ret = ::av_buffersrc_add_frame_flags(_buffersrc_ctx, av_frame, AV_BUFFERSRC_FLAG_KEEP_REF);
-		if (ret < 0)
+		else if (ret == AVERROR_EOF)
 		{
-			logte("An error occurred while feeding the audio filtergraph: pts: %lld, linesize: %d, srate: %d, layout: %d, channels: %d, format: %d, rq: %d", _frame->pts, _frame->linesize[0], _frame->sample_rate, _frame->channel_layout, _frame->channels, _frame->format, _input_buffer.Size());
-			continue;
+			logte("Error receiving a packet for decoding : AVERROR_EOF");
+			break;
 		}
-
-		while (true)
+		else if (ret < 0)
 		{
-			int ret = ::av_buffersink_get_frame(_buffersink_ctx, _frame);
-
-			if (ret == AVERROR(EAGAIN))
-			{
-				break;
-			}
-			else if (ret == AVERROR_EOF)
-			{
-				logte("Error receiving a packet for decoding : AVERROR_EOF");
-				break;
-			}
-			else if (ret < 0)
+			logte("Error receiving a packet for decoding : %d", ret);
+			break;
+		}
+		else
+		{
+			auto output_frame = ffmpeg::Conv::ToMediaFrame(cmn::MediaType::Audio, _frame);
+			::av_frame_unref(_frame);
+			if (output_frame == nullptr)
 			{
-				logte("Error receiving a packet for decoding : %d", ret);
-				break;
+				logte("Could not allocate the frame data");
+				continue;
 			}
-			else
+
+			if (_complete_handler != nullptr && _kill_flag == false)
 			{
-				auto output_frame = ffmpeg::Conv::ToMediaFrame(cmn::MediaType::Audio, _frame);
-				::av_frame_unref(_frame);
-				if (output_frame == nullptr)
-				{
-					logte("Could not allocate the frame data");
-					continue;
-				}
-
-				if (_complete_handler != nullptr && _kill_flag == false)
-				{
-					_complete_handler(std::move(output_frame));
-				}
+				_complete_handler(std::move(output_frame));
 			}
 		}
 	}
+
+	return TranscodeStepResult::Processed;
 }
 
 int32_t FilterResampler::SendBuffer(std::shared_ptr<MediaFrame> buffer)
 {
 	_input_buffer.Enqueue(std::move(buffer));
 
+	if (_pipeline_stage != nullptr)
+	{
+		_pipeline_stage->Notify();
+	}
+
 	return 0;
 }
@@ -25,6 +25,7 @@ public:
 	int32_t SendBuffer(std::shared_ptr<MediaFrame> buffer) override;
 
 	void FilterThread();
+	TranscodeStepResult ProcessStep();
 
 	bool Start() override;
 	void Stop() override;
@@ -49,20 +49,6 @@ bool FilterRescaler::Configure(const std::shared_ptr<MediaTrack> &input_track, c
 	_input_track = input_track;
 	_output_track = output_track;
 
-	const AVFilter *buffersrc = ::avfilter_get_by_name("buffer");
-	const AVFilter *buffersink = ::avfilter_get_by_name("buffersink");
-	int ret;
-	_filter_graph = ::avfilter_graph_alloc();
-
-	if ((_filter_graph == nullptr) || (_inputs == nullptr) || (_outputs == nullptr))
-	{
-		logte("Could not allocate variables for filter graph: %p, %p, %p", _filter_graph, _inputs, _outputs);
-		return false;
-	}
-
-	// Limit the number of filter threads to 4. I think 4 thread is usually enough for video filtering processing.
-	_filter_graph->nb_threads = 4;
-
 	AVRational input_timebase = ffmpeg::Conv::TimebaseToAVRational(input_track->GetTimeBase());
 	AVRational output_timebase = ffmpeg::Conv::TimebaseToAVRational(output_track->GetTimeBase());
 
@@ -77,6 +63,38 @@ bool FilterRescaler::Configure(const std::shared_ptr<MediaTrack> &input_track, c
 		return false;
 	}
 
+	_input_width = input_track->GetWidth();
+	_input_height = input_track->GetHeight();
+
+	if (input_track->GetColorspace() == AV_PIX_FMT_CUDA)
+	{
+		// The buffer source needs the frames context of the decoder, so the filter graph is created with the first frame
+		logti("Rescaler is enabled for track #%u, and waits for the first CUDA frame", input_track->GetId());
+		return true;
+	}
+
+	return InitializeFilterGraph(nullptr);
+}
+
+bool FilterRescaler::InitializeFilterGraph(AVBufferRef *hw_frames_context)
+{
+	auto &input_track = _input_track;
+	auto &output_track = _output_track;
+
+	const AVFilter *buffersrc = ::avfilter_get_by_name("buffer");
+	const AVFilter *buffersink = ::avfilter_get_by_name("buffersink");
+	int ret;
+	_filter_graph = ::avfilter_graph_alloc();
+
+	if ((_filter_graph == nullptr) || (_inputs == nullptr) || (_outputs == nullptr))
+	{
+		logte("Could not allocate variables for filter graph: %p, %p, %p", _filter_graph, _inputs, _outputs);
+		return false;
+	}
+
+	// Limit the number of filter threads to 4. I think 4 thread is usually enough for video filtering processing.
+	_filter_graph->nb_threads = 4;
+
 	// Prepare filters
 	//
 	// Filter graph:
@@ -85,7 +103,7 @@ bool FilterRescaler::Configure(const std::shared_ptr<MediaTrack> &input_track, c
 	// Prepare the input parameters
 	std::vector<ov::String> src_params = {
 		ov::String::FormatString("video_size=%dx%d", input_track->GetWidth(), input_track->GetHeight()),
-		ov::String::FormatString("pix_fmt=%d", input_track->GetColorspace()),
+		ov::String::FormatString("pix_fmt=%d", (hw_frames_context != nullptr) ? AV_PIX_FMT_CUDA : input_track->GetColorspace()),
 		ov::String::FormatString("time_base=%s", input_track->GetTimeBase().GetStringExpr().CStr()),
 		ov::String::FormatString("pixel_aspect=%d/%d", 1, 1)};
 
@@ -99,6 +117,29 @@ bool FilterRescaler::Configure(const std::shared_ptr<MediaTrack> &input_track, c
 		return false;
 	}
 
+	if (hw_frames_context != nullptr)
+	{
+		// The CUDA frames of the decoder are fed without copying them to the host memory
+		AVBufferSrcParameters *src_parameters = ::av_buffersrc_parameters_alloc();
+		if (src_parameters == nullptr)
+		{
+			logte("Could not allocate the parameters of video buffer source filter");
+			return false;
+		}
+
+		src_parameters->format = AV_PIX_FMT_CUDA;
+		src_parameters->hw_frames_ctx = hw_frames_context;
+
+		ret = ::av_buffersrc_parameters_set(_buffersrc_ctx, src_parameters);
+		::av_free(src_parameters);
+
+		if (ret < 0)
+		{
+			logte("Could not set the frames context of video buffer source filter: %d", ret);
+			return false;
+		}
+	}
+
 	// Prepare output filters
 	ret = ::avfilter_graph_create_filter(&_buffersink_ctx, buffersink, "out", nullptr, nullptr, _filter_graph);
 	if (ret < 0)
@@ -122,13 +163,26 @@ bool FilterRescaler::Configure(const std::shared_ptr<MediaTrack> &input_track, c
 		filters.push_back(ov::String::FormatString("fps=fps=%.2f:round=near", output_track->GetFrameRateByConfig()));
 	}
 
-	if (output_track->GetHardwareAccel() == true &&
+	if (hw_frames_context != nullptr)
+	{
+		// The frames stay in the GPU memory, and are downloaded only for the encoders other than NVENC
+		filters.push_back(ov::String::FormatString("scale_cuda=%d:%d%s",
+												   output_track->GetWidth(), output_track->GetHeight(),
+												   (output_track->GetColorspace() == AV_PIX_FMT_CUDA) ? "" : ",hwdownload,format=nv12"));
+	}
+	else if (output_track->GetColorspace() == AV_PIX_FMT_CUDA)
+	{
+		// The frames of the software decoder are uploaded to the GPU for NVENC
+		filters.push_back(ov::String::FormatString("format=nv12,hwupload,scale_cuda=%d:%d",
+												   output_track->GetWidth(), output_track->GetHeight()));
+	}
+	else if (output_track->GetHardwareAccel() == true &&
 		TranscodeGPU::GetInstance()->IsSupportedNV() == true &&
 		input_track->GetColorspace() == AV_PIX_FMT_NV12 &&
 		output_track->GetColorspace() == AV_PIX_FMT_NV12)
 	{
-		filters.push_back(ov::String::FormatString("hwupload_cuda,scale_cuda=%d:%d,hwdownload",
-												   output_track->GetWidth(), output_track->GetHeight()));
+		filters.push_back(ov::String::FormatString("hwupload_cuda=device=%d,scale_cuda=%d:%d,hwdownload",
+												   output_track->GetHardwareAccelDeviceId(), output_track->GetWidth(), output_track->GetHeight()));
 	}
 	else
 	{
@@ -156,6 +210,17 @@ bool FilterRescaler::Configure(const std::shared_ptr<MediaTrack> &input_track, c
 		return false;
 	}
 
+	for (unsigned int index = 0; index < _filter_graph->nb_filters; index++)
+	{
+		auto filter = _filter_graph->filters[index];
+
+		// hwupload uploads the frames to the device of NVENC
+		if (::strcmp(filter->filter->name, "hwupload") == 0)
+		{
+			filter->hw_device_ctx = ::av_buffer_ref(TranscodeGPU::GetInstance()->GetDeviceContext(output_track->GetHardwareAccelDeviceId()));
+		}
+	}
+
 	if ((ret = ::avfilter_graph_config(_filter_graph, nullptr)) < 0)
 	{
 		logte("Could not validate filter graph for rescaling: %d", ret);
@@ -164,10 +229,6 @@ bool FilterRescaler::Configure(const std::shared_ptr<MediaTrack> &input_track, c
 
 	logti("Rescaler is enabled for track #%u using parameters. input: %s / outputs: %s", input_track->GetId(), src_args.CStr(), output_filters.CStr());
 
-	_input_width = input_track->GetWidth();
-	_input_height = input_track->GetHeight();
-
-
 	return true;
 }
 
@@ -175,11 +236,34 @@ int32_t FilterRescaler::SendBuffer(std::shared_ptr<MediaFrame> buffer)
 {
 	_input_buffer.Enqueue(std::move(buffer));
 
+	if (_pipeline_stage != nullptr)
+	{
+		_pipeline_stage->Notify();
+	}
+
 	return 0;
 }
 
 bool FilterRescaler::Start()
 {
+	auto scheduler = TranscodePipelineScheduler::GetInstance();
+
+	if (scheduler->IsRunning())
+	{
+		_kill_flag = false;
+
+		_pipeline_stage = scheduler->CreateStage(
+			"Rescaler", _pipeline_affinity_key,
+			[this]() -> TranscodeStepResult {
+				return ProcessStep();
+			},
+			[this]() -> bool {
+				return (_input_buffer.IsEmpty() == false);
+			});
+
+		return (_pipeline_stage != nullptr);
+	}
+
 	// Generates a thread that reads and encodes frames in the input_buffer queue and places them in the output queue.
 	try
 	{
@@ -205,6 +289,12 @@ void FilterRescaler::Stop()
 
 	_input_buffer.Stop();
 
+	if (_pipeline_stage != nullptr)
+	{
+		// The stage is not released here because SendBuffer() may be using it
+		_pipeline_stage->Detach();
+	}
+
 	if (_thread_work.joinable())
 	{
 		_thread_work.join();
@@ -214,64 +304,81 @@ void FilterRescaler::Stop()
 
 void FilterRescaler::FilterThread()
 {
+	ov::ThreadRegistry::Registration registration("Filter");
+
 	logtd("Start rescaling filter thread");
 
 	while (!_kill_flag)
 	{
-		auto obj = _input_buffer.Dequeue();
-		if (obj.has_value() == false)
-			continue;
+		if (ProcessStep() == TranscodeStepResult::Stopped)
+		{
+			break;
+		}
+	}
+}
+
+TranscodeStepResult FilterRescaler::ProcessStep()
+{
+	auto obj = DequeueInput();
+	if (obj.has_value() == false)
+		return TranscodeStepResult::NoInput;
+
+	auto media_frame = std::move(obj.value());
+
+	auto av_frame = ffmpeg::Conv::ToAVFrame(cmn::MediaType::Video, media_frame);
+	if (!av_frame)
+	{
+		logte("Could not allocate the video frame data");
+		return TranscodeStepResult::Stopped;
+	}
+
+	if ((_filter_graph == nullptr) && (InitializeFilterGraph(av_frame->hw_frames_ctx) == false))
+	{
+		return TranscodeStepResult::Stopped;
+	}
 
-		auto media_frame = std::move(obj.value());
+	int ret = ::av_buffersrc_add_frame_flags(_buffersrc_ctx, av_frame, AV_BUFFERSRC_FLAG_KEEP_REF);
+	if (ret < 0)
+	{
+		logte("An error occurred while feeding the audio filtergraph: format: %d, pts: %lld, linesize: %d, size: %d", _frame->format, _frame->pts, _frame->linesize[0], _input_buffer.Size());
 
-		auto av_frame = ffmpeg::Conv::ToAVFrame(cmn::MediaType::Video, media_frame);
-		if (!av_frame)
+		return TranscodeStepResult::Processed;
+	}
+
+	while (true)
+	{
+		int ret = ::av_buffersink_get_frame(_buffersink_ctx, _frame);
+		if (ret == AVERROR(EAGAIN))
 		{
-			logte("Could not allocate the video frame data");
+			// Need more data
 			break;
 		}
-
-		int ret = ::av_buffersrc_add_frame_flags(_buffersrc_ctx, av_frame, AV_BUFFERSRC_FLAG_KEEP_REF);
-		if (ret < 0)
+		else if (ret == AVERROR_EOF)
 		{
-			logte("An error occurred while feeding the audio filtergraph: format: %d, pts: %lld, linesize: %d, size: %d", _frame->format, _frame->pts, _frame->linesize[0], _input_buffer.Size());
-
-			continue;
+			logte("End of file error(%d)", ret);
+			break;
 		}
-
-		while (true)
+		else if (ret < 0)
 		{
-			int ret = ::av_buffersink_get_frame(_buffersink_ctx, _frame);
-			if (ret == AVERROR(EAGAIN))
-			{
-				// Need more data
-				break;
-			}
-			else if (ret == AVERROR_EOF)
-			{
-				logte("End of file error(%d)", ret);
-				break;
-			}
-			else if (ret < 0)
+			logte("Unknown error is occurred while get frame. error(%d)", ret);
+			break;
+		}
+		else
+		{
+			_frame->pict_type = AV_PICTURE_TYPE_NONE;
+			auto output_frame = ffmpeg::Conv::ToMediaFrame(cmn::MediaType::Video, _frame);
+			::av_frame_unref(_frame);
+			if (output_frame == nullptr)
 			{
-				logte("Unknown error is occurred while get frame. error(%d)", ret);
-				break;
+				continue;
 			}
-			else
+
+			if (_complete_handler != nullptr && _kill_flag == false)
 			{
-				_frame->pict_type = AV_PICTURE_TYPE_NONE;
-				auto output_frame = ffmpeg::Conv::ToMediaFrame(cmn::MediaType::Video, _frame);
-				::av_frame_unref(_frame);
-				if (output_frame == nullptr)
-				{
-					continue;
-				}
-
-				if (_complete_handler != nullptr && _kill_flag == false)
-				{
-					_complete_handler(std::move(output_frame));
-				}
+				_complete_handler(std::move(output_frame));
 			}
 		}
 	}
+
+	return TranscodeStepResult::Processed;
 }
@@ -25,9 +25,12 @@ public:
 	int32_t SendBuffer(std::shared_ptr<MediaFrame> buffer) override;
 
 	void FilterThread();
+	TranscodeStepResult ProcessStep();
 
 	bool Start() override;
 	void Stop() override;
 
 protected:
+	// If <hw_frames_context> is not nullptr, the CUDA frames of it are scaled on the GPU
+	bool InitializeFilterGraph(AVBufferRef *hw_frames_context);
 };
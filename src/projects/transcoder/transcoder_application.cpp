@@ -40,10 +40,8 @@ bool TranscodeApplication::Start()
 {
 	if(_application_info.GetConfig().GetOutputProfiles().IsHardwareAcceleration() == true)
 	{
-		if (TranscodeGPU::GetInstance()->Initialize() == false)
-		{
-			logtw("There is no supported hardware accelerator");
-		}
+		// The streams that use the GPU wait until the probe is finished
+		TranscodeGPU::GetInstance()->InitializeAsync();
 	}
 
 	return true;
@@ -156,3 +154,25 @@ bool TranscodeApplication::OnSendFrame(const std::shared_ptr<info::Stream> &stre
 
 	return stream->Push(packet);
 }
+
+bool TranscodeApplication::OnKeyFrameRequested(const std::shared_ptr<info::Stream> &stream_info, MediaTrackId track_id)
+{
+	// <stream_info> is an output stream, and the TranscoderStream is found by its input stream
+	auto input_stream = stream_info->GetLinkedInputStream();
+	if (input_stream == nullptr)
+	{
+		return false;
+	}
+
+	std::unique_lock<std::mutex> lock(_mutex);
+
+	auto stream_bucket = _streams.find(input_stream->GetId());
+	if (stream_bucket == _streams.end())
+	{
+		return false;
+	}
+
+	auto stream = stream_bucket->second;
+
+	return stream->RequestKeyFrame(stream_info->GetId(), track_id);
+}
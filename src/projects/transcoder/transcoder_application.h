@@ -54,6 +54,11 @@ public:
 
 	bool OnSendFrame(const std::shared_ptr<info::Stream> &stream, const std::shared_ptr<MediaPacket> &packet) override;
 
+	////////////////////////////////////////////////////////////////////////////////////////////////
+	// MediaRouteApplicationConnector Implementation
+	////////////////////////////////////////////////////////////////////////////////////////////////
+	bool OnKeyFrameRequested(const std::shared_ptr<info::Stream> &stream, MediaTrackId track_id) override;
+
 private:
 	const info::Application _application_info;
 
@@ -0,0 +1,144 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "transcoder_benchmark.h"
+
+#include "transcoder_gpu.h"
+#include "transcoder_load_controller.h"
+#include "transcoder_private.h"
+
+void TranscodeBenchmark::Start()
+{
+	if (_enabled.exchange(true))
+	{
+		return;
+	}
+
+	logti("Transcoder benchmark is enabled. The File provider sends the packets as fast as possible.");
+
+	_report_thread = std::thread(&TranscodeBenchmark::ReportThread, this);
+	pthread_setname_np(_report_thread.native_handle(), "TcBenchmark");
+}
+
+void TranscodeBenchmark::Stop()
+{
+	{
+		std::lock_guard lock_guard(_stop_mutex);
+
+		if (_enabled.exchange(false) == false)
+		{
+			return;
+		}
+	}
+
+	_stop_condition.notify_all();
+	_capacity_condition.notify_all();
+
+	if (_report_thread.joinable())
+	{
+		_report_thread.join();
+	}
+}
+
+void TranscodeBenchmark::RecordInput(Stage stage, int64_t queue_waiting_time_in_us)
+{
+	auto &counter = _stage_counters[static_cast<size_t>(stage)];
+
+	counter.input_count++;
+	counter.total_waiting_time_in_us += std::max<int64_t>(queue_waiting_time_in_us, 0);
+
+	// The frames waiting for the filters are limited by the decoders
+	if (stage != Stage::Filter)
+	{
+		_in_flight_count++;
+	}
+}
+
+void TranscodeBenchmark::RecordOutput(Stage stage)
+{
+	_stage_counters[static_cast<size_t>(stage)].output_count++;
+
+	if (stage == Stage::Filter)
+	{
+		return;
+	}
+
+	// The count can be unbalanced when a decoder/encoder drops the input
+	if (--_in_flight_count < 0)
+	{
+		_in_flight_count = 0;
+	}
+
+	if (_in_flight_count < TRANSCODE_BENCHMARK_MAX_IN_FLIGHT_COUNT)
+	{
+		_capacity_condition.notify_one();
+	}
+}
+
+void TranscodeBenchmark::ReportThread()
+{
+	auto last_time = std::chrono::steady_clock::now();
+
+	while (true)
+	{
+		{
+			std::unique_lock lock(_stop_mutex);
+			if (_stop_condition.wait_for(lock, std::chrono::milliseconds(TRANSCODE_BENCHMARK_REPORT_INTERVAL_IN_MSEC), [this]() -> bool { return _enabled == false; }))
+			{
+				break;
+			}
+		}
+
+		auto now = std::chrono::steady_clock::now();
+		Report(std::chrono::duration<double>(now - last_time).count());
+		last_time = now;
+	}
+}
+
+void TranscodeBenchmark::Report(double elapsed_in_sec)
+{
+	if (elapsed_in_sec <= 0.0)
+	{
+		return;
+	}
+
+	ov::String report;
+
+	for (size_t index = 0; index < static_cast<size_t>(Stage::NumberOfStages); index++)
+	{
+		auto &counter = _stage_counters[index];
+
+		auto input_count = counter.input_count.load();
+		auto total_waiting_time_in_us = counter.total_waiting_time_in_us.load();
+		auto output_count = counter.output_count.load();
+
+		auto input_count_delta = input_count - counter.last_input_count;
+		auto waiting_time_delta = total_waiting_time_in_us - counter.last_total_waiting_time_in_us;
+		auto output_count_delta = output_count - counter.last_output_count;
+
+		counter.last_input_count = input_count;
+		counter.last_total_waiting_time_in_us = total_waiting_time_in_us;
+		counter.last_output_count = output_count;
+
+		report.AppendFormat("%s%s: %.1f fps (queue waiting: %.2f ms)",
+							(index == 0) ? "" : ", ",
+							StringFromStage(static_cast<Stage>(index)),
+							output_count_delta / elapsed_in_sec,
+							(input_count_delta > 0) ? (waiting_time_delta / 1000.0 / input_count_delta) : 0.0);
+	}
+
+	report.AppendFormat(", CPU: %.1f%%", TranscodeLoadController::GetInstance()->GetCpuUsage());
+
+	// The utilization of the devices is not available without the vendor libraries (e.g. NVML), so the load is shown as the number of the streams
+	auto gpu = TranscodeGPU::GetInstance();
+	for (int32_t gpu_id = 0; gpu_id < gpu->GetDeviceCount(); gpu_id++)
+	{
+		report.AppendFormat(", GPU%d: %zu streams", gpu_id, gpu->GetStreamCount(gpu_id));
+	}
+
+	logti("[Benchmark] %s", report.CStr());
+}
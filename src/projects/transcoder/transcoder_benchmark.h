@@ -0,0 +1,114 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/ovlibrary/ovlibrary.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+// The throughput of the stages is reported at this interval
+#define TRANSCODE_BENCHMARK_REPORT_INTERVAL_IN_MSEC 1000
+// The source waits while more packets/frames than this are waiting to be decoded/encoded
+#define TRANSCODE_BENCHMARK_MAX_IN_FLIGHT_COUNT 120
+// The source is resumed after this time even if the transcoder is still behind (e.g. a frame is dropped by the decoder)
+#define TRANSCODE_BENCHMARK_MAX_WAITING_TIME_IN_MSEC 100
+
+// Measures the throughput of the transcoder (-b, --bench-transcode).
+//
+// While it is enabled, the File provider sends the packets as fast as the transcoder can process them instead of
+// the real-time, and the fps and the average queue waiting time of each stage are logged periodically.
+class TranscodeBenchmark : public ov::Singleton<TranscodeBenchmark>
+{
+public:
+	enum class Stage : int32_t
+	{
+		Decoder,
+		Filter,
+		Encoder,
+
+		NumberOfStages
+	};
+
+	static constexpr const char *StringFromStage(Stage stage)
+	{
+		switch (stage)
+		{
+			case Stage::Decoder:
+				return "Decoder";
+			case Stage::Filter:
+				return "Filter";
+			case Stage::Encoder:
+				return "Encoder";
+			case Stage::NumberOfStages:
+				break;
+		}
+
+		return "Unknown";
+	}
+
+	TranscodeBenchmark() = default;
+
+	void Start();
+	void Stop();
+
+	bool IsEnabled() const
+	{
+		return _enabled;
+	}
+
+	// A packet/frame is sent to a stage. <queue_waiting_time_in_us> is the current waiting time of the input queue of the stage.
+	void RecordInput(Stage stage, int64_t queue_waiting_time_in_us);
+
+	// A frame/packet is output from a stage
+	void RecordOutput(Stage stage);
+
+	// Called by the source of the benchmark after sending a packet. Blocks while the transcoder is behind.
+	void WaitForCapacity()
+	{
+		if (_in_flight_count < TRANSCODE_BENCHMARK_MAX_IN_FLIGHT_COUNT)
+		{
+			return;
+		}
+
+		std::unique_lock lock(_capacity_mutex);
+		_capacity_condition.wait_for(lock, std::chrono::milliseconds(TRANSCODE_BENCHMARK_MAX_WAITING_TIME_IN_MSEC), [this]() -> bool {
+			return (_in_flight_count < TRANSCODE_BENCHMARK_MAX_IN_FLIGHT_COUNT) || (_enabled == false);
+		});
+	}
+
+protected:
+	struct StageCounter
+	{
+		std::atomic<uint64_t> input_count{0};
+		std::atomic<uint64_t> total_waiting_time_in_us{0};
+		std::atomic<uint64_t> output_count{0};
+
+		uint64_t last_input_count = 0;
+		uint64_t last_total_waiting_time_in_us = 0;
+		uint64_t last_output_count = 0;
+	};
+
+	void ReportThread();
+	void Report(double elapsed_in_sec);
+
+	std::atomic<bool> _enabled{false};
+	std::thread _report_thread;
+
+	std::mutex _stop_mutex;
+	std::condition_variable _stop_condition;
+
+	// Number of the packets/frames waiting to be decoded/encoded
+	std::atomic<int64_t> _in_flight_count{0};
+	std::mutex _capacity_mutex;
+	std::condition_variable _capacity_condition;
+
+	StageCounter _stage_counters[static_cast<size_t>(Stage::NumberOfStages)];
+};
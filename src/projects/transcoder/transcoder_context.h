@@ -173,11 +173,18 @@ public:
 		return _flags;
 	}
 
+	// The frame is in the GPU memory (e.g. AV_PIX_FMT_CUDA)
+	bool IsHWFrame() const
+	{
+		return (_priv_data != nullptr) && (_priv_data->hw_frames_ctx != nullptr);
+	}
+
 	// 데이터를 빈값으로 채움
 	// FillZero
 	void FillZeroData()
 	{
-		if(!_priv_data) {
+		// The planes of a hardware frame are not in the host memory
+		if(!_priv_data || IsHWFrame()) {
 			return;
 		}
 
@@ -21,6 +21,8 @@
 #include "transcoder_private.h"
 
 #define MAX_QUEUE_SIZE 500
+// The packets that do not produce a frame (e.g. dropped by the decoder) are forgotten after this count
+#define MAX_SENT_PACKET_COUNT 128
 
 std::shared_ptr<TranscodeDecoder> TranscodeDecoder::Create(int32_t decoder_id, const info::Stream &info, std::shared_ptr<MediaTrack> track, CompleteHandler complete_handler)
 {
@@ -163,6 +165,11 @@ TranscodeDecoder::~TranscodeDecoder()
 	}
 
 	_input_buffer.Clear();
+
+	if (_memory_metrics != nullptr)
+	{
+		_memory_metrics->Add(mon::MemoryComponent::TranscoderInput, -_input_buffer_bytes.exchange(0));
+	}
 }
 
 std::shared_ptr<MediaTrack> &TranscodeDecoder::GetRefTrack()
@@ -190,12 +197,133 @@ bool TranscodeDecoder::Configure(std::shared_ptr<MediaTrack> track)
 
 	_track = track;
 
+	auto stream_metrics = StreamMetrics(_stream_info);
+	if ((stream_metrics != nullptr) && (_track != nullptr))
+	{
+		_metrics = stream_metrics->GetDecoderMetrics(_track->GetId());
+		_memory_metrics = stream_metrics->GetMemoryMetrics();
+	}
+
 	return (_track != nullptr);
 }
 
+void TranscodeDecoder::SetThreadingParams()
+{
+	auto &video_config = _stream_info.GetApplicationInfo().GetConfig().GetDecodes().GetVideo();
+	auto thread_type = video_config.GetThreadType().LowerCaseString();
+
+	// 0: The number of CPU cores + 1 (decided by FFmpeg)
+	_context->thread_count = video_config.GetThreadCount();
+
+	if (thread_type == "frame")
+	{
+		// Each thread decodes a frame, so the output is delayed by (thread_count - 1) frames
+		_context->thread_type = FF_THREAD_FRAME;
+	}
+	else if (thread_type == "slice")
+	{
+		// The slices of a frame are decoded in parallel, so there is no delay (only if the stream has multiple slices)
+		_context->thread_type = FF_THREAD_SLICE;
+	}
+	else
+	{
+		_context->thread_type = FF_THREAD_FRAME | FF_THREAD_SLICE;
+	}
+
+	if ((_track != nullptr) && _track->IsKeyFrameOnlyDecoding())
+	{
+		// The key frames are seconds apart, so frame threading would hold the thumbnails for (thread_count - 1) key frames
+		_context->thread_type = FF_THREAD_SLICE;
+		// The artifacts of skipping the deblocking filter are hardly visible in the thumbnails
+		_context->skip_loop_filter = AVDISCARD_ALL;
+		_context->flags2 |= AV_CODEC_FLAG2_FAST;
+	}
+}
+
+void TranscodeDecoder::UpdateCodecMetrics()
+{
+	if (_metrics == nullptr)
+	{
+		return;
+	}
+
+	ov::String thread_type;
+
+	switch (_context->active_thread_type)
+	{
+		case FF_THREAD_FRAME:
+			thread_type = "frame";
+			break;
+		case FF_THREAD_SLICE:
+			thread_type = "slice";
+			break;
+		default:
+			thread_type = "none";
+			break;
+	}
+
+	_metrics->SetCodec(_context->codec->name, _context->thread_count, thread_type);
+}
+
+void TranscodeDecoder::OnPacketSent(int64_t pts)
+{
+	if ((_metrics == nullptr) || (pts == AV_NOPTS_VALUE))
+	{
+		return;
+	}
+
+	_sent_packet_time_map[pts] = std::chrono::steady_clock::now();
+
+	if (_sent_packet_time_map.size() > MAX_SENT_PACKET_COUNT)
+	{
+		_sent_packet_time_map.erase(_sent_packet_time_map.begin());
+	}
+}
+
+void TranscodeDecoder::OnFrameReceived(int64_t pts)
+{
+	if (_metrics == nullptr)
+	{
+		return;
+	}
+
+	auto item = _sent_packet_time_map.find(pts);
+	if (item == _sent_packet_time_map.end())
+	{
+		return;
+	}
+
+	auto latency = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - item->second).count();
+	_sent_packet_time_map.erase(item);
+
+	_metrics->OnFrameDecoded(latency);
+}
+
 void TranscodeDecoder::SendBuffer(std::shared_ptr<const MediaPacket> packet)
 {
+	if (_memory_metrics != nullptr)
+	{
+		int64_t length = packet->GetDataLength();
+		_input_buffer_bytes += length;
+		_memory_metrics->Add(mon::MemoryComponent::TranscoderInput, length);
+	}
+
 	_input_buffer.Enqueue(std::move(packet));
+
+	if (_pipeline_stage != nullptr)
+	{
+		_pipeline_stage->Notify();
+	}
+}
+
+void TranscodeDecoder::OnInputDequeued(const MediaPacket &packet)
+{
+	if (_memory_metrics != nullptr)
+	{
+		int64_t length = packet.GetDataLength();
+		_input_buffer_bytes -= length;
+		_memory_metrics->Add(mon::MemoryComponent::TranscoderInput, -length);
+	}
 }
 
 void TranscodeDecoder::SendOutputBuffer(TranscodeResult result, std::shared_ptr<MediaFrame> frame)
@@ -208,12 +336,79 @@ void TranscodeDecoder::SendOutputBuffer(TranscodeResult result, std::shared_ptr<
 	}
 }
 
+bool TranscodeDecoder::StartCodec(const ov::String &thread_name)
+{
+	_kill_flag = false;
+
+	auto scheduler = TranscodePipelineScheduler::GetInstance();
+
+	// The codecs of the output streams run on the same NUMA node as the input stream
+	auto input_stream = _stream_info.GetLinkedInputStream();
+	auto affinity_key = (input_stream != nullptr) ? input_stream->GetId() : _stream_info.GetId();
+
+	if (scheduler->IsRunning())
+	{
+		_pipeline_stage = scheduler->CreateStage(
+			thread_name, affinity_key,
+			[this]() -> TranscodeStepResult {
+				return ProcessStep();
+			},
+			[this]() -> bool {
+				return (_input_buffer.IsEmpty() == false);
+			});
+
+		return (_pipeline_stage != nullptr);
+	}
+
+	// Generates a thread that reads and decodes the items in the input_buffer queue
+	try
+	{
+		_codec_thread = std::thread(&TranscodeDecoder::CodecThread, this);
+		pthread_setname_np(_codec_thread.native_handle(), thread_name.CStr());
+
+		// Same node as the stages of the stream on TranscodePipelineScheduler
+		if (cfg::ConfigManager::GetInstance()->GetServer()->GetModules().GetNumaAffinity().IsEnabled() &&
+			(ov::Platform::SetThreadNumaNode(_codec_thread, affinity_key) == false))
+		{
+			logtw("Could not set the NUMA node of %s", thread_name.CStr());
+		}
+	}
+	catch (const std::system_error &e)
+	{
+		logte("Failed to start decoder thread");
+		_kill_flag = true;
+
+		return false;
+	}
+
+	return true;
+}
+
+void TranscodeDecoder::CodecThread()
+{
+	ov::ThreadRegistry::Registration registration("Decoder", _stream_info.GetApplicationName(), _stream_info.GetName());
+
+	while (!_kill_flag)
+	{
+		if (ProcessStep() == TranscodeStepResult::Stopped)
+		{
+			break;
+		}
+	}
+}
+
 void TranscodeDecoder::Stop()
 {
 	_kill_flag = true;
 
 	_input_buffer.Stop();
 
+	if (_pipeline_stage != nullptr)
+	{
+		// The stage is not released here because SendBuffer() may be using it
+		_pipeline_stage->Detach();
+	}
+
 	if (_codec_thread.joinable())
 	{
 		_codec_thread.join();
@@ -8,6 +8,11 @@
 //==============================================================================
 #pragma once
 
+#include <monitoring/monitoring.h>
+
+#include <chrono>
+#include <map>
+
 #include "base/info/stream.h"
 #include "codec/codec_base.h"
 
@@ -33,8 +38,6 @@ public:
 
 	cmn::Timebase GetTimebase();
 
-	virtual void CodecThread() = 0;
-
 	virtual void Stop();
 
 	void SetCompleteHandler(CompleteHandler complete_handler)
@@ -43,8 +46,27 @@ public:
 	}
 
 protected:
+	// Starts the decoding loop on its own thread, or as a stage of TranscodePipelineScheduler if it is running
+	bool StartCodec(const ov::String &thread_name);
+	void CodecThread();
+
+	// Runs an iteration of the decoding loop (the inputs are taken by DequeueInput())
+	virtual TranscodeStepResult ProcessStep() = 0;
+
 	static const ov::String ShowCodecParameters(const AVCodecContext *context, const AVCodecParameters *parameters);
 
+	// Sets the threading of a software decoder from <Decodes><Video> of the application (before avcodec_open2())
+	void SetThreadingParams();
+	// Exports the codec and the threading of the opened decoder to DecoderMetrics
+	void UpdateCodecMetrics();
+
+	// Measure the time from sending a packet to receiving the frame of it (by PTS)
+	void OnPacketSent(int64_t pts);
+	void OnFrameReceived(int64_t pts);
+
+	// Reports the bytes of the packets in _input_buffer to the memory metrics of the stream
+	void OnInputDequeued(const MediaPacket &packet) override;
+
 	int32_t _decoder_id;
 
 	std::shared_ptr<MediaTrack> _track;
@@ -64,4 +86,11 @@ protected:
 	std::thread _codec_thread;
 
 	CompleteHandler _complete_handler;
+
+	std::shared_ptr<mon::DecoderMetrics> _metrics;
+	std::shared_ptr<mon::MemoryMetrics> _memory_metrics;
+	// Bytes of the packets in _input_buffer
+	std::atomic<int64_t> _input_buffer_bytes = 0;
+	// PTS, Time when the packet is sent to the decoder
+	std::map<int64_t, std::chrono::steady_clock::time_point> _sent_packet_time_map;
 };
@@ -11,6 +11,7 @@
 #include <utility>
 
 #include "codec/encoder/encoder_aac.h"
+#include "codec/encoder/encoder_av1_svt.h"
 #include "codec/encoder/encoder_avc_nv.h"
 #include "codec/encoder/encoder_avc_openh264.h"
 #include "codec/encoder/encoder_avc_qsv.h"
@@ -18,14 +19,30 @@
 #include "codec/encoder/encoder_hevc_nv.h"
 #include "codec/encoder/encoder_hevc_qsv.h"
 #include "codec/encoder/encoder_jpeg.h"
+#include "codec/encoder/encoder_jpeg_qsv.h"
 #include "codec/encoder/encoder_opus.h"
 #include "codec/encoder/encoder_png.h"
 #include "codec/encoder/encoder_vp8.h"
+#include "codec/encoder/encoder_vp9.h"
 #include "transcoder_gpu.h"
 #include "transcoder_private.h"
 
 #define USE_LEGACY_LIBOPUS false
 #define MAX_QUEUE_SIZE 500
+// The frames that have not come out of the encoder (e.g. dropped by the encoder) are forgotten after this number of frames
+#define MAX_PENDING_FRAME_COUNT 128
+// While the keyframes are aligned, the GOP of the encoder is this times longer than the interval, so the encoder does not make a keyframe of its own between the forced ones
+#define KEY_FRAME_ALIGNMENT_GOP_MULTIPLIER 4
+// Minimum interval between the keyframes forced by RequestKeyFrame()
+#define ENCODER_KEY_FRAME_REQUEST_MIN_INTERVAL_MS 500
+// The average time to encode a frame is reported to TranscodeLoadController every this number of frames
+#define ENCODE_TIME_REPORT_FRAME_COUNT 30
+
+// From 128us to 16s
+static ov::Histogram encoding_latency_histogram(
+	"ome_transcode_frame_latency_seconds",
+	"Time from the frame is queued to the encoder until its packet comes out",
+	0.000001, 128, 16 * 1000 * 1000);
 
 TranscodeEncoder::TranscodeEncoder(info::Stream stream_info) : 
 	_stream_info(stream_info)
@@ -130,8 +147,36 @@ std::shared_ptr<TranscodeEncoder> TranscodeEncoder::Create(int32_t encoder_id, c
 				goto done;
 			}
 
+			break;
+		case cmn::MediaCodecId::Vp9:
+			encoder = std::make_shared<EncoderVP9>(info);
+			if (encoder != nullptr && encoder->Configure(output_track) == true)
+			{
+				output_track->SetCodecLibraryId(cmn::MediaCodecLibraryId::LIBVPX);
+				goto done;
+			}
+
+			break;
+		case cmn::MediaCodecId::Av1:
+			encoder = std::make_shared<EncoderAV1xSVT>(info);
+			if (encoder != nullptr && encoder->Configure(output_track) == true)
+			{
+				output_track->SetCodecLibraryId(cmn::MediaCodecLibraryId::LIBSVTAV1);
+				goto done;
+			}
+
 			break;
 		case cmn::MediaCodecId::Jpeg:
+			if ( (use_hwaccel == true) && TranscodeGPU::GetInstance()->IsSupportedQSV() == true && (library_id == cmn::MediaCodecLibraryId::AUTO || library_id == cmn::MediaCodecLibraryId::QSV))
+			{
+				encoder = std::make_shared<EncoderJPEGxQSV>(info);
+				if (encoder != nullptr && encoder->Configure(output_track) == true)
+				{
+					output_track->SetCodecLibraryId(cmn::MediaCodecLibraryId::QSV);
+					goto done;
+				}
+			}
+
 			encoder = std::make_shared<EncoderJPEG>(info);
 			if (encoder != nullptr && encoder->Configure(output_track) == true)
 			{
@@ -215,25 +260,297 @@ std::shared_ptr<MediaTrack> &TranscodeEncoder::GetRefTrack()
 	return _track;
 }
 
+void TranscodeEncoder::SetDegradationLevel(TranscodeDegradationLevel level)
+{
+	_degradation_level = level;
+}
+
+TranscodeDegradationLevel TranscodeEncoder::GetDegradationLevel() const
+{
+	return _degradation_level;
+}
+
+void TranscodeEncoder::RequestKeyFrame()
+{
+	_key_frame_requested = true;
+}
+
+void TranscodeEncoder::ConfigureKeyFrameAlignment()
+{
+	_key_frame_alignment_interval_us = 0;
+	_last_key_frame_interval_index = INT64_MIN;
+
+	if (_codec_context == nullptr)
+	{
+		return;
+	}
+
+	// NVENC and QSV make the forced keyframes (aligned or requested) I frames instead of IDR frames unless these are set (the other encoders ignore them)
+	::av_opt_set_int(_codec_context->priv_data, "forced-idr", 1, 0);
+	::av_opt_set_int(_codec_context->priv_data, "forced_idr", 1, 0);
+
+	if (GetRefTrack()->IsKeyFrameAligned() == false)
+	{
+		return;
+	}
+
+	if ((_codec_context->gop_size <= 0) || (_codec_context->framerate.num <= 0) || (_codec_context->framerate.den <= 0))
+	{
+		logtw("The keyframes of track(%d) cannot be aligned because the keyframe interval is unknown", GetRefTrack()->GetId());
+		return;
+	}
+
+	// The renditions of different frame rates have the same interval in seconds if <KeyFrameInterval> is proportional to <Framerate>
+	_key_frame_alignment_interval_us = ::av_rescale(_codec_context->gop_size, 1000000LL * _codec_context->framerate.den, _codec_context->framerate.num);
+
+	_codec_context->gop_size *= KEY_FRAME_ALIGNMENT_GOP_MULTIPLIER;
+
+	logti("The keyframes of track(%d) are aligned every %" PRId64 " us", GetRefTrack()->GetId(), _key_frame_alignment_interval_us);
+}
+
+bool TranscodeEncoder::ShouldForceKeyFrame(int64_t pts)
+{
+	if (_key_frame_requested)
+	{
+		auto now_ms = ov::Clock::NowMSec();
+
+		if ((now_ms - _last_requested_key_frame_time_ms) >= ENCODER_KEY_FRAME_REQUEST_MIN_INTERVAL_MS)
+		{
+			_key_frame_requested = false;
+			_last_requested_key_frame_time_ms = now_ms;
+
+			return true;
+		}
+	}
+
+	if (_key_frame_alignment_interval_us <= 0)
+	{
+		return false;
+	}
+
+	auto timebase = GetTimebase();
+	if ((timebase.GetNum() <= 0) || (timebase.GetDen() <= 0))
+	{
+		return false;
+	}
+
+	auto pts_us = ::av_rescale(pts, 1000000LL * timebase.GetNum(), timebase.GetDen());
+
+	// Floor division, the timestamps may be negative
+	auto index = pts_us / _key_frame_alignment_interval_us;
+	if ((pts_us % _key_frame_alignment_interval_us) < 0)
+	{
+		index--;
+	}
+
+	if (index == _last_key_frame_interval_index)
+	{
+		return false;
+	}
+
+	_last_key_frame_interval_index = index;
+
+	return true;
+}
+
+void TranscodeEncoder::ApplyForcedKeyFrame(AVFrame *av_frame, const MediaFrame &media_frame)
+{
+	if ((_codec_context == nullptr) || (_codec_context->codec_type != AVMEDIA_TYPE_VIDEO))
+	{
+		return;
+	}
+
+	av_frame->pict_type = ShouldForceKeyFrame(media_frame.GetPts()) ? AV_PICTURE_TYPE_I : AV_PICTURE_TYPE_NONE;
+}
+
+int TranscodeEncoder::SendFrameToCodec(AVFrame *av_frame, const MediaFrame &media_frame)
+{
+	ApplyForcedKeyFrame(av_frame, media_frame);
+
+	return ::avcodec_send_frame(_codec_context, av_frame);
+}
+
 void TranscodeEncoder::SendBuffer(std::shared_ptr<const MediaFrame> frame)
 {
+	switch (_degradation_level)
+	{
+		case TranscodeDegradationLevel::None:
+			break;
+
+		case TranscodeDegradationLevel::HalfFrameRate:
+			// The frames are dropped before they are queued, so the encoder spends no time on them
+			if ((_degraded_frame_count++ % 2) != 0)
+			{
+				return;
+			}
+			break;
+
+		case TranscodeDegradationLevel::Skip:
+			return;
+	}
+
+	{
+		std::lock_guard lock_guard(_pending_frame_lock);
+
+		if (_pending_frame_list.size() >= MAX_PENDING_FRAME_COUNT)
+		{
+			_pending_frame_list.pop_front();
+		}
+
+		_pending_frame_list.emplace_back(frame->GetPts(), ov::Clock::NowUSec());
+	}
+
 	_input_buffer.Enqueue(std::move(frame));
+
+	if (_pipeline_stage != nullptr)
+	{
+		_pipeline_stage->Notify();
+	}
 }
 
 void TranscodeEncoder::SendOutputBuffer(std::shared_ptr<MediaPacket> packet)
 {
+	{
+		std::lock_guard lock_guard(_pending_frame_lock);
+
+		// The packets may come out in a different order from the frames (e.g. B-frames)
+		auto pts = packet->GetPts();
+		auto it = std::find_if(_pending_frame_list.begin(), _pending_frame_list.end(), [pts](const std::pair<int64_t, uint64_t> &item) -> bool {
+			return item.first == pts;
+		});
+
+		if (it != _pending_frame_list.end())
+		{
+			encoding_latency_histogram.Record(ov::Clock::NowUSec() - it->second);
+			_pending_frame_list.erase(it);
+		}
+	}
+
+	// A keyframe of the encoder's own GOP (or an aligned one) also serves the pending request
+	if (packet->GetFlag() == MediaPacketFlag::Key)
+	{
+		_key_frame_requested = false;
+	}
+
 	if (_complete_handler)
 	{
 		_complete_handler(_encoder_id, std::move(packet));
 	}
 }
 
+bool TranscodeEncoder::StartCodec(const ov::String &thread_name)
+{
+	_kill_flag = false;
+
+	auto scheduler = TranscodePipelineScheduler::GetInstance();
+
+	// The codecs of the output streams run on the same NUMA node as the input stream
+	auto input_stream = _stream_info.GetLinkedInputStream();
+	auto affinity_key = (input_stream != nullptr) ? input_stream->GetId() : _stream_info.GetId();
+
+	if (scheduler->IsRunning())
+	{
+		_pipeline_stage = scheduler->CreateStage(
+			thread_name, affinity_key,
+			[this]() -> TranscodeStepResult {
+				return ProcessStepAndMeasure();
+			},
+			[this]() -> bool {
+				return (_input_buffer.IsEmpty() == false);
+			});
+
+		return (_pipeline_stage != nullptr);
+	}
+
+	// Generates a thread that reads and encodes the items in the input_buffer queue
+	try
+	{
+		_codec_thread = std::thread(&TranscodeEncoder::CodecThread, this);
+		pthread_setname_np(_codec_thread.native_handle(), thread_name.CStr());
+
+		// Same node as the stages of the stream on TranscodePipelineScheduler
+		if (cfg::ConfigManager::GetInstance()->GetServer()->GetModules().GetNumaAffinity().IsEnabled() &&
+			(ov::Platform::SetThreadNumaNode(_codec_thread, affinity_key) == false))
+		{
+			logtw("Could not set the NUMA node of %s", thread_name.CStr());
+		}
+	}
+	catch (const std::system_error &e)
+	{
+		logte("Failed to start encoder thread");
+		_kill_flag = true;
+
+		return false;
+	}
+
+	return true;
+}
+
+void TranscodeEncoder::CodecThread()
+{
+	ov::ThreadRegistry::Registration registration("Encoder", _stream_info.GetApplicationName(), _stream_info.GetName());
+
+	while (!_kill_flag)
+	{
+		if (ProcessStepAndMeasure() == TranscodeStepResult::Stopped)
+		{
+			break;
+		}
+	}
+}
+
+void TranscodeEncoder::OnInputDequeued(const MediaFrame &frame)
+{
+	if ((_track != nullptr) && (_track->GetMediaType() == cmn::MediaType::Video) && TranscodeLoadController::GetInstance()->IsAdmissionEnabled())
+	{
+		_dequeued_time_us = static_cast<int64_t>(ov::Clock::NowUSec());
+	}
+}
+
+TranscodeStepResult TranscodeEncoder::ProcessStepAndMeasure()
+{
+	_dequeued_time_us = 0;
+
+	auto result = ProcessStep();
+
+	if ((result != TranscodeStepResult::Processed) || (_dequeued_time_us == 0))
+	{
+		return result;
+	}
+
+	// Wall time from the frame is taken out of the queue until its packets are taken from the codec
+	_encode_time_sum_us += static_cast<int64_t>(ov::Clock::NowUSec()) - _dequeued_time_us;
+	_encode_time_count++;
+
+	if (_encode_time_count >= ENCODE_TIME_REPORT_FRAME_COUNT)
+	{
+		auto library_id = _track->GetCodecLibraryId();
+		bool hwaccel = (library_id == cmn::MediaCodecLibraryId::NVENC) || (library_id == cmn::MediaCodecLibraryId::QSV);
+
+		TranscodeLoadController::GetInstance()->RecordEncodeTime(
+			_track->GetCodecId(), hwaccel,
+			static_cast<int64_t>(_track->GetWidth()) * _track->GetHeight(),
+			static_cast<double>(_encode_time_sum_us) / _encode_time_count);
+
+		_encode_time_sum_us = 0;
+		_encode_time_count = 0;
+	}
+
+	return result;
+}
+
 void TranscodeEncoder::Stop()
 {
 	_kill_flag = true;
 
 	_input_buffer.Stop();
 
+	if (_pipeline_stage != nullptr)
+	{
+		// The stage is not released here because SendBuffer() may be using it
+		_pipeline_stage->Detach();
+	}
+
 	if (_codec_thread.joinable())
 	{
 		_codec_thread.join();
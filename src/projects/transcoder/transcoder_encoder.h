@@ -10,6 +10,7 @@
 
 #include "base/info/stream.h"
 #include "codec/codec_base.h"
+#include "transcoder_load_controller.h"
 
 class TranscodeEncoder : public TranscodeBase<MediaFrame, MediaPacket>
 {
@@ -32,12 +33,18 @@ public:
 
 	std::shared_ptr<MediaTrack> &GetRefTrack();
 
-	virtual void CodecThread() = 0;
-
 	virtual void Stop();
 
 	cmn::Timebase GetTimebase() const;
 
+	// Set by TranscoderStream when the transcoder is overloaded
+	void SetDegradationLevel(TranscodeDegradationLevel level);
+	TranscodeDegradationLevel GetDegradationLevel() const;
+
+	// Requests a keyframe on demand (e.g. a WebRTC viewer switching to this rendition).
+	// The requests made before the next frame are coalesced into one keyframe, and at most one keyframe is forced
+	// every ENCODER_KEY_FRAME_REQUEST_MIN_INTERVAL_MS (the later requests are deferred, not dropped).
+	void RequestKeyFrame();
 
 public:
 
@@ -50,6 +57,30 @@ private:
 	virtual bool SetCodecParams() = 0;
 
 protected:
+	// Starts the encoding loop on its own thread, or as a stage of TranscodePipelineScheduler if it is running
+	bool StartCodec(const ov::String &thread_name);
+	void CodecThread();
+
+	// Runs an iteration of the encoding loop (the inputs are taken by DequeueInput())
+	virtual TranscodeStepResult ProcessStep() = 0;
+	// Runs ProcessStep() and reports the time to encode a frame to TranscodeLoadController (admission control)
+	TranscodeStepResult ProcessStepAndMeasure();
+	void OnInputDequeued(const MediaFrame &frame) override;
+
+	// Called by the video encoders after gop_size and framerate of _codec_context are set.
+	// If the keyframes of the track are aligned, the keyframe interval is fixed in time and the encoder is configured to make IDR frames when they are forced.
+	void ConfigureKeyFrameAlignment();
+	// Whether the frame of <pts> is the first one in a new keyframe interval on the timeline of the input stream.
+	// The renditions of the stream start their intervals at the same timestamps, so the keyframes forced by this are aligned across them.
+	// It is also true if a keyframe has been requested by RequestKeyFrame().
+	bool ShouldForceKeyFrame(int64_t pts);
+	// Sets pict_type of the video frame to AV_PICTURE_TYPE_I if ShouldForceKeyFrame() is true, and to AV_PICTURE_TYPE_NONE otherwise
+	// (so the encoder places the other keyframes by its own keyframe interval).
+	void ApplyForcedKeyFrame(AVFrame *av_frame, const MediaFrame &media_frame);
+	// Sends <av_frame> converted from <media_frame> to _codec_context. The encoders must send the frames through this, not avcodec_send_frame(),
+	// so that the keyframes are aligned and the requested keyframes are made.
+	int SendFrameToCodec(AVFrame *av_frame, const MediaFrame &media_frame);
+
 	std::shared_ptr<MediaTrack> _track = nullptr;
 
 	int32_t _encoder_id;
@@ -70,4 +101,27 @@ protected:
 
 	CompleteHandler _complete_handler;
 
+	// PTS and the time (us) of the frames sent to the encoder, to measure the latency of each frame
+	std::mutex _pending_frame_lock;
+	std::deque<std::pair<int64_t, uint64_t>> _pending_frame_list;
+
+	// Time when the frame being encoded was dequeued (0 if it is not measured)
+	int64_t _dequeued_time_us = 0;
+	// Sum of the times to encode the frames that are not reported yet
+	int64_t _encode_time_sum_us = 0;
+	int64_t _encode_time_count = 0;
+
+	// Keyframe interval in microseconds if the keyframes are aligned (0 if not)
+	int64_t _key_frame_alignment_interval_us = 0;
+	// Index of the keyframe interval of the last forced keyframe (pts / interval)
+	int64_t _last_key_frame_interval_index = INT64_MIN;
+
+	// Set by RequestKeyFrame(), and cleared when a keyframe comes out of the encoder
+	std::atomic<bool> _key_frame_requested{false};
+	// Time when the last requested keyframe was forced (ms)
+	uint64_t _last_requested_key_frame_time_ms = 0;
+
+	std::atomic<TranscodeDegradationLevel> _degradation_level{TranscodeDegradationLevel::None};
+	// Number of the frames received while the encoder is degraded
+	uint64_t _degraded_frame_count = 0;
 };
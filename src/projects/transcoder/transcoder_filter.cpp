@@ -1,5 +1,6 @@
 #include "transcoder_filter.h"
 
+#include "filter/filter_multi_rescaler.h"
 #include "filter/filter_resampler.h"
 #include "filter/filter_rescaler.h"
 #include "transcoder_gpu.h"
@@ -40,6 +41,31 @@ bool TranscodeFilter::Configure(int32_t filter_id,
 	return CreateFilter();
 }
 
+bool TranscodeFilter::Configure(const std::vector<int32_t> &filter_ids,
+								const std::shared_ptr<info::Stream> &input_stream_info, std::shared_ptr<MediaTrack> input_track,
+								const std::vector<std::shared_ptr<MediaTrack>> &output_tracks,
+								CompleteHandler complete_handler)
+{
+	logtd("Create a multi-output transcode filter. InputTrack(%d). Outputs(%zu)", input_track->GetId(), output_tracks.size());
+
+	if ((filter_ids.empty()) || (filter_ids.size() != output_tracks.size()))
+	{
+		logte("Invalid outputs of multi-output filter: filters(%zu), tracks(%zu)", filter_ids.size(), output_tracks.size());
+		return false;
+	}
+
+	_filter_id = filter_ids.front();
+	_filter_ids = filter_ids;
+	_input_stream_info = input_stream_info;
+	_input_track = input_track;
+	_output_track = output_tracks.front();
+	_output_tracks = output_tracks;
+	_complete_handler = complete_handler;
+	_threshold_ts_increment = (int64_t)_input_track->GetTimeBase().GetTimescale() * PTS_INCREMENT_LIMIT;
+
+	return CreateFilter();
+}
+
 bool TranscodeFilter::CreateFilter()
 {
 	if (_impl != nullptr)
@@ -48,24 +74,37 @@ bool TranscodeFilter::CreateFilter()
 		delete _impl;
 	}
 
-	switch (_input_track->GetMediaType())
+	if (_filter_ids.empty() == false)
 	{
-		case MediaType::Audio:
-			_impl = new FilterResampler();
-			break;
-		case MediaType::Video:
-			_impl = new FilterRescaler();
-			break;
-		default:
-			logte("Unsupported media type in filter");
-			return false;
+		auto multi_rescaler = new FilterMultiRescaler();
+		_impl = multi_rescaler;
+
+		multi_rescaler->SetOutputCompleteHandler(bind(&TranscodeFilter::OnOutputComplete, this, std::placeholders::_1, std::placeholders::_2));
+	}
+	else
+	{
+		switch (_input_track->GetMediaType())
+		{
+			case MediaType::Audio:
+				_impl = new FilterResampler();
+				break;
+			case MediaType::Video:
+				_impl = new FilterRescaler();
+				break;
+			default:
+				logte("Unsupported media type in filter");
+				return false;
+		}
 	}
 
 	auto urn = info::ManagedQueue::URN(_input_stream_info->GetApplicationName(), _input_stream_info->GetName().CStr(), "trs", ov::String::FormatString("filter_%s", cmn::GetMediaTypeString(_input_track->GetMediaType()).LowerCaseString().CStr()));
 	_impl->SetQueueUrn(urn.CStr());
+	_impl->SetPipelineAffinityKey(_input_stream_info->GetId());
 	_impl->SetCompleteHandler(bind(&TranscodeFilter::OnComplete, this, std::placeholders::_1));
 
-	bool success = _impl->Configure(_input_track, _output_track);
+	bool success = (_filter_ids.empty() == false)
+					   ? static_cast<FilterMultiRescaler *>(_impl)->Configure(_input_track, _output_tracks)
+					   : _impl->Configure(_input_track, _output_track);
 	if (success == false)
 	{
 		logte("Could not create filter");
@@ -83,6 +122,11 @@ void TranscodeFilter::Stop() {
 	}
 }
 
+int64_t TranscodeFilter::GetInputWaitingTimeInUs() const
+{
+	return (_impl != nullptr) ? _impl->GetInputWaitingTimeInUs() : 0;
+}
+
 bool TranscodeFilter::SendBuffer(std::shared_ptr<MediaFrame> buffer)
 {
 	if (IsNeedUpdate(buffer) == true)
@@ -136,6 +180,14 @@ void TranscodeFilter::OnComplete(std::shared_ptr<MediaFrame> frame) {
 	}
 }
 
+void TranscodeFilter::OnOutputComplete(size_t output_index, std::shared_ptr<MediaFrame> frame)
+{
+	if (_complete_handler && (output_index < _filter_ids.size()))
+	{
+		_complete_handler(_filter_ids[output_index], frame);
+	}
+}
+
 cmn::Timebase TranscodeFilter::GetInputTimebase() const
 {
 	return _impl->GetInputTimebase();
@@ -33,10 +33,19 @@ public:
 		const std::shared_ptr<info::Stream> &output_stream_info, std::shared_ptr<MediaTrack> output_track,
 		CompleteHandler complete_handler);
 
+	// The outputs of a video track are scaled by a filter (FilterMultiRescaler).
+	// The frames of <output_tracks>[i] are delivered with <filter_ids>[i].
+	bool Configure(
+		const std::vector<int32_t> &filter_ids,
+		const std::shared_ptr<info::Stream> &input_stream_info, std::shared_ptr<MediaTrack> input_track,
+		const std::vector<std::shared_ptr<MediaTrack>> &output_tracks,
+		CompleteHandler complete_handler);
+
 	bool SendBuffer(std::shared_ptr<MediaFrame> buffer);
 
 	void Stop(); 
 	cmn::Timebase GetInputTimebase() const;
+	int64_t GetInputWaitingTimeInUs() const;
 	cmn::Timebase GetOutputTimebase() const;
 
 	int64_t _last_pts = -1LL;
@@ -55,6 +64,7 @@ public:
 	}
 
 	void OnComplete(std::shared_ptr<MediaFrame> frame);
+	void OnOutputComplete(size_t output_index, std::shared_ptr<MediaFrame> frame);
 
 private:
 	bool CreateFilter();
@@ -62,6 +72,10 @@ private:
 
 	int32_t _filter_id;
 
+	// Not empty if the filter has multiple outputs
+	std::vector<int32_t> _filter_ids;
+	std::vector<std::shared_ptr<MediaTrack>> _output_tracks;
+
 	FilterBase *_impl;
 
 	CompleteHandler _complete_handler;
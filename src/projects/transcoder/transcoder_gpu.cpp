@@ -8,72 +8,381 @@
 //==============================================================================
 #include "transcoder_gpu.h"
 
+#include <config/config_manager.h>
+#include <sys/utsname.h>
+
 #include "transcoder_private.h"
 
+// Maximum number of NVIDIA GPUs to look up
+#define MAX_CUDA_DEVICE_COUNT 16
+// The result of the probe is cached in the config directory, and used while the drivers are not changed
+#define GPU_PROBE_CACHE_FILE_NAME ".gpu_probe_cache"
+#define GPU_PROBE_NVIDIA_VERSION_PATH "/proc/driver/nvidia/version"
+
 TranscodeGPU::TranscodeGPU()
 {
 	_supported_qsv = false;
 	_supported_cuda = false;
-	_device_context = nullptr;
+	_zero_copy_nv = false;
+}
+
+void TranscodeGPU::InitializeAsync()
+{
+	std::lock_guard lock_guard(_probe_mutex);
+
+	if (_probe_future.valid())
+	{
+		return;
+	}
+
+	logtd("Trying to initialize a hardware accelerator in the background");
+
+	// The contexts of the GPUs are created in a thread (initializing the driver takes seconds),
+	// while the other modules are initialized
+	_probe_future = std::async(std::launch::async, [this]() -> bool {
+						ov::ThreadRegistry::Registration registration("GPUProbe");
+
+						auto result = Probe();
+						_probed = true;
+
+						return result;
+					}).share();
 }
 
 bool TranscodeGPU::Initialize()
 {
-	if(_initialized)
+	InitializeAsync();
+
+	WaitForProbe();
+
+	return _initialized;
+}
+
+bool TranscodeGPU::WaitForProbe()
+{
+	if (_probed.load(std::memory_order_acquire))
+	{
 		return true;
-		
-	Uninitialize();
+	}
+
+	std::shared_future<bool> probe_future;
+
+	{
+		std::lock_guard lock_guard(_probe_mutex);
+		probe_future = _probe_future;
+	}
+
+	if (probe_future.valid() == false)
+	{
+		return false;
+	}
+
+	ov::StopWatch stop_watch;
+	stop_watch.Start();
+
+	probe_future.wait();
+
+	if (stop_watch.Elapsed() > 0)
+	{
+		logtd("Waited %" PRId64 "ms for the hardware accelerator to be initialized", stop_watch.Elapsed());
+	}
+
+	return true;
+}
+
+bool TranscodeGPU::Probe()
+{
+	ov::StopWatch stop_watch;
+	stop_watch.Start();
+
+	ProbeCache cache;
+	bool is_cached = LoadProbeCache(&cache);
+
+	bool result = false;
+
+	if (is_cached)
+	{
+		logtd("Using the cached result of the hardware accelerator probe (QSV: %s, CUDA devices: %d)", cache.supported_qsv ? "true" : "false", cache.cuda_device_count);
+
+		if (cache.supported_qsv)
+		{
+			result = ProbeQSV();
+		}
+		else if (cache.cuda_device_count > 0)
+		{
+			result = ProbeCUDA(cache.cuda_device_count);
+		}
+
+		if (result == false)
+		{
+			// The hardware has been changed without updating the driver
+			logtw("The cached result of the hardware accelerator probe is not valid. Probing again...");
+			is_cached = false;
+		}
+	}
+
+	if (is_cached == false)
+	{
+		result = ProbeQSV() || ProbeCUDA(0);
+
+		cache.driver_key = GetDriverKey();
+		cache.supported_qsv = _supported_qsv;
+		cache.cuda_device_count = _supported_cuda ? GetDeviceCount() : 0;
+
+		SaveProbeCache(cache);
+	}
+
+	if (result && _supported_cuda)
+	{
+		auto &module_config = cfg::ConfigManager::GetInstance()->GetServer()->GetModules();
+		_zero_copy_nv = module_config.GetZeroCopyGPU().IsEnabled();
 
-	logtd("Trying to initialize a hardware accelerator");
+		if (_zero_copy_nv)
+		{
+			logti("Decoded frames stay in the GPU memory until they are encoded (ZeroCopyGPU)");
+		}
+	}
 
-	int ret = ::av_hwdevice_ctx_create(&_device_context, AV_HWDEVICE_TYPE_QSV, "/dev/dri/render128", NULL, 0);
+	if (result == false)
+	{
+		logtw("There is no supported hardware accelerator");
+	}
+
+	logti("Hardware accelerator probe is finished in %" PRId64 "ms (QSV: %s, CUDA devices: %d%s)",
+		  stop_watch.Elapsed(), _supported_qsv ? "true" : "false", _supported_cuda ? GetDeviceCount() : 0, is_cached ? ", cached" : "");
+
+	return result;
+}
+
+bool TranscodeGPU::ProbeQSV()
+{
+	AVBufferRef *device_context = nullptr;
+
+	int ret = ::av_hwdevice_ctx_create(&device_context, AV_HWDEVICE_TYPE_QSV, "/dev/dri/render128", NULL, 0);
 	if (ret < 0)
 	{
-		av_buffer_unref(&_device_context);
-		_device_context = nullptr;
+		av_buffer_unref(&device_context);
 		_supported_qsv = false;
+
+		return false;
+	}
+
+	_supported_qsv = true;
+	_initialized = true;
+	_device_context_list.push_back(device_context);
+
+	{
+		std::lock_guard<std::mutex> lock_guard(_stream_count_mutex);
+		_stream_count_list.assign(_device_context_list.size(), 0);
+	}
+
+	auto constraints = av_hwdevice_get_hwframe_constraints(device_context, nullptr);
+	logti("Supported Intel QuickSync hardware accelerator. hw.pixfmt: %d, sw.pixfmt : %d",
+		  *constraints->valid_hw_formats,
+		  *constraints->valid_sw_formats);
+	av_hwframe_constraints_free(&constraints);
+
+	return true;
+}
+
+bool TranscodeGPU::ProbeCUDA(int32_t device_count)
+{
+	std::vector<AVBufferRef *> device_context_list;
+
+	// The device string of CUDA is the index of the GPU
+	auto create_device_context = [](int32_t gpu_id) -> AVBufferRef * {
+		AVBufferRef *device_context = nullptr;
+
+		int ret = ::av_hwdevice_ctx_create(&device_context, AV_HWDEVICE_TYPE_CUDA, ov::String::FormatString("%d", gpu_id).CStr(), NULL, 0);
+		if (ret < 0)
+		{
+			av_buffer_unref(&device_context);
+			return nullptr;
+		}
+
+		return device_context;
+	};
+
+	if (device_count > 0)
+	{
+		std::vector<std::future<AVBufferRef *>> future_list;
+
+		for (int32_t gpu_id = 0; gpu_id < std::min(device_count, MAX_CUDA_DEVICE_COUNT); gpu_id++)
+		{
+			future_list.push_back(std::async(std::launch::async, create_device_context, gpu_id));
+		}
+
+		bool succeeded = true;
+
+		for (auto &future : future_list)
+		{
+			auto device_context = future.get();
+			succeeded = succeeded && (device_context != nullptr);
+
+			device_context_list.push_back(device_context);
+		}
+
+		if (succeeded == false)
+		{
+			for (auto &device_context : device_context_list)
+			{
+				av_buffer_unref(&device_context);
+			}
+
+			return false;
+		}
 	}
 	else
 	{
-		_supported_qsv = true;
-		_initialized = true;
-		auto constraints = av_hwdevice_get_hwframe_constraints(_device_context, nullptr);
-		logti("Supported Intel QuickSync hardware accelerator. hw.pixfmt: %d, sw.pixfmt : %d",
+		for (int gpu_id = 0; gpu_id < MAX_CUDA_DEVICE_COUNT; gpu_id++)
+		{
+			auto device_context = create_device_context(gpu_id);
+			if (device_context == nullptr)
+			{
+				break;
+			}
+
+			device_context_list.push_back(device_context);
+		}
+	}
+
+	if (device_context_list.empty())
+	{
+		return false;
+	}
+
+	for (size_t gpu_id = 0; gpu_id < device_context_list.size(); gpu_id++)
+	{
+		auto device_context = device_context_list[gpu_id];
+		_device_context_list.push_back(device_context);
+
+		auto constraints = av_hwdevice_get_hwframe_constraints(device_context, nullptr);
+		logti("Supported NVIDIA CUDA hardware accelerator. gpu: %zu, hw.pixfmt: %d, sw.pixfmt : %d",
+			  gpu_id,
 			  *constraints->valid_hw_formats,
 			  *constraints->valid_sw_formats);
+		av_hwframe_constraints_free(&constraints);
+	}
 
+	_initialized = true;
+	_supported_cuda = true;
 
-		return true;
+	{
+		std::lock_guard<std::mutex> lock_guard(_stream_count_mutex);
+		_stream_count_list.assign(_device_context_list.size(), 0);
 	}
 
-	ret = ::av_hwdevice_ctx_create(&_device_context, AV_HWDEVICE_TYPE_CUDA, "/dev/dri/render128", NULL, 0);
-	if (ret < 0)
+	return true;
+}
+
+ov::String TranscodeGPU::GetDriverKey()
+{
+	ov::String driver_key;
+
+	struct utsname uts;
+	if (::uname(&uts) == 0)
 	{
-		av_buffer_unref(&_device_context);
-		_device_context = nullptr;
+		// The Intel driver is a part of the kernel
+		driver_key = uts.release;
 	}
-	else
+
+	// e.g. NVRM version: NVIDIA UNIX x86_64 Kernel Module  535.104.05  Sat Aug 19 01:15:15 UTC 2023
+	// (the size of a file in /proc is 0, so it is read by a line)
+	auto file = ::fopen(GPU_PROBE_NVIDIA_VERSION_PATH, "r");
+	if (file != nullptr)
 	{
-		_initialized = true;
-		_supported_cuda = true;
-		auto constraints = av_hwdevice_get_hwframe_constraints(_device_context, nullptr);
-		logti("Supported NVIDIA CUDA hardware accelerator. hw.pixfmt: %d, sw.pixfmt : %d",
-			  *constraints->valid_hw_formats,
-			  *constraints->valid_sw_formats);
+		char line[256];
 
-		return true;
+		if (::fgets(line, sizeof(line), file) != nullptr)
+		{
+			driver_key.AppendFormat("|%s", ov::String(line).Trim().CStr());
+		}
+
+		::fclose(file);
 	}
 
-	return false;
+	return driver_key;
+}
+
+ov::String TranscodeGPU::GetProbeCachePath()
+{
+	return ov::PathManager::Combine(cfg::ConfigManager::GetInstance()->GetConfigPath(), GPU_PROBE_CACHE_FILE_NAME);
+}
+
+bool TranscodeGPU::LoadProbeCache(ProbeCache *cache)
+{
+	auto data = ov::LoadFromFile(GetProbeCachePath());
+	if (data == nullptr)
+	{
+		return false;
+	}
+
+	ov::String driver_key;
+
+	// <key>=<value> per line
+	for (auto &line : data->ToString().Split("\n"))
+	{
+		auto tokens = line.Split("=", 2);
+		if (tokens.size() != 2)
+		{
+			continue;
+		}
+
+		if (tokens[0] == "driver")
+		{
+			driver_key = tokens[1];
+		}
+		else if (tokens[0] == "qsv")
+		{
+			cache->supported_qsv = (tokens[1] == "1");
+		}
+		else if (tokens[0] == "cuda_devices")
+		{
+			cache->cuda_device_count = ov::Converter::ToInt32(tokens[1]);
+		}
+	}
+
+	// The devices may be changed with the driver
+	if (driver_key != GetDriverKey())
+	{
+		return false;
+	}
+
+	// A host without any accelerator is probed every time, since the probe fails fast
+	return cache->supported_qsv || (cache->cuda_device_count > 0);
+}
+
+void TranscodeGPU::SaveProbeCache(const ProbeCache &cache)
+{
+	if ((cache.supported_qsv == false) && (cache.cuda_device_count == 0))
+	{
+		return;
+	}
+
+	auto content = ov::String::FormatString("driver=%s\nqsv=%d\ncuda_devices=%d\n",
+											cache.driver_key.CStr(), cache.supported_qsv ? 1 : 0, cache.cuda_device_count);
+
+	auto path = GetProbeCachePath();
+	if (ov::DumpToFile(path, content.CStr(), content.GetLength()) == nullptr)
+	{
+		logtd("Could not write the cache of the hardware accelerator probe: %s", path.CStr());
+	}
 }
 
 bool TranscodeGPU::Uninitialize()
 {
-	// Uninitialize device context of Intel Quicksync
-	if (_device_context != nullptr)
+	WaitForProbe();
+
+	for (auto &device_context : _device_context_list)
+	{
+		av_buffer_unref(&device_context);
+	}
+
+	_device_context_list.clear();
+
 	{
-		av_buffer_unref(&_device_context);
-		_device_context = nullptr;
+		std::lock_guard<std::mutex> lock_guard(_stream_count_mutex);
+		_stream_count_list.clear();
 	}
 
 	return true;
@@ -81,16 +390,129 @@ bool TranscodeGPU::Uninitialize()
 
 AVBufferRef* TranscodeGPU::GetDeviceContext()
 {
-	return _device_context;
+	return GetDeviceContext(0);
+}
+
+AVBufferRef *TranscodeGPU::GetDeviceContext(int32_t gpu_id)
+{
+	WaitForProbe();
+
+	if ((gpu_id < 0) || (gpu_id >= GetDeviceCount()))
+	{
+		return nullptr;
+	}
+
+	return _device_context_list[gpu_id];
+}
+
+int32_t TranscodeGPU::GetDeviceCount()
+{
+	WaitForProbe();
+
+	return static_cast<int32_t>(_device_context_list.size());
+}
+
+
+int32_t TranscodeGPU::AcquireDevice()
+{
+	WaitForProbe();
+
+	std::lock_guard<std::mutex> lock_guard(_stream_count_mutex);
+
+	int32_t selected_gpu_id = -1;
+
+	for (int32_t gpu_id = 0; gpu_id < static_cast<int32_t>(_stream_count_list.size()); gpu_id++)
+	{
+		if ((selected_gpu_id < 0) || (_stream_count_list[gpu_id] < _stream_count_list[selected_gpu_id]))
+		{
+			selected_gpu_id = gpu_id;
+		}
+	}
+
+	if (selected_gpu_id >= 0)
+	{
+		_stream_count_list[selected_gpu_id]++;
+
+		logtd("GPU %d is assigned to a stream (streams: %zu)", selected_gpu_id, _stream_count_list[selected_gpu_id]);
+	}
+
+	return selected_gpu_id;
+}
+
+void TranscodeGPU::ReleaseDevice(int32_t gpu_id)
+{
+	std::lock_guard<std::mutex> lock_guard(_stream_count_mutex);
+
+	if ((gpu_id < 0) || (gpu_id >= static_cast<int32_t>(_stream_count_list.size())) || (_stream_count_list[gpu_id] == 0))
+	{
+		return;
+	}
+
+	_stream_count_list[gpu_id]--;
+
+	logtd("GPU %d is released from a stream (streams: %zu)", gpu_id, _stream_count_list[gpu_id]);
 }
 
+size_t TranscodeGPU::GetStreamCount(int32_t gpu_id)
+{
+	std::lock_guard<std::mutex> lock_guard(_stream_count_mutex);
+
+	if ((gpu_id < 0) || (gpu_id >= static_cast<int32_t>(_stream_count_list.size())))
+	{
+		return 0;
+	}
+
+	return _stream_count_list[gpu_id];
+}
 
 bool TranscodeGPU::IsSupportedQSV()
 {
+	WaitForProbe();
+
 	return _supported_qsv;
 }
 
 bool TranscodeGPU::IsSupportedNV()
 {
+	WaitForProbe();
+
 	return _supported_cuda;
-}
\ No newline at end of file
+}
+
+bool TranscodeGPU::IsZeroCopyNV()
+{
+	WaitForProbe();
+
+	return _supported_cuda && _zero_copy_nv;
+}
+
+AVBufferRef *TranscodeGPU::CreateFramesContextNV(AVBufferRef *device_context, int width, int height)
+{
+	if (device_context == nullptr)
+	{
+		return nullptr;
+	}
+
+	AVBufferRef *frames_context = ::av_hwframe_ctx_alloc(device_context);
+	if (frames_context == nullptr)
+	{
+		logte("Could not allocate the CUDA frames context");
+		return nullptr;
+	}
+
+	auto frames = reinterpret_cast<AVHWFramesContext *>(frames_context->data);
+	frames->format = AV_PIX_FMT_CUDA;
+	frames->sw_format = AV_PIX_FMT_NV12;
+	frames->width = width;
+	frames->height = height;
+
+	int ret = ::av_hwframe_ctx_init(frames_context);
+	if (ret < 0)
+	{
+		logte("Could not initialize the CUDA frames context (%dx%d): %d", width, height, ret);
+		::av_buffer_unref(&frames_context);
+		return nullptr;
+	}
+
+	return frames_context;
+}
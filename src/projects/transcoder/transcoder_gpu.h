@@ -10,6 +10,8 @@
 
 #include <base/ovlibrary/ovlibrary.h>
 
+#include <future>
+
 #include "codec/codec_base.h"
 
 class TranscodeGPU : public ov::Singleton<TranscodeGPU>
@@ -17,19 +19,73 @@ class TranscodeGPU : public ov::Singleton<TranscodeGPU>
 public:
 	TranscodeGPU();
 
+	// Starts probing the hardware accelerators in the background (it does nothing if it has been started).
+	// The methods below wait until the probe is finished, so only the streams that use the GPU wait for it
+	void InitializeAsync();
+	// Waits until the probe is finished. Returns false if there is no supported hardware accelerator
 	bool Initialize();
 	bool Uninitialize();
 
+	// Returns the device context of the first GPU
 	AVBufferRef *GetDeviceContext();
+	// Returns nullptr if there is no GPU of <gpu_id>
+	AVBufferRef *GetDeviceContext(int32_t gpu_id);
+	int32_t GetDeviceCount();
+
+	// Assigns the GPU that has the fewest streams to a stream. Returns -1 if there is no GPU.
+	int32_t AcquireDevice();
+	void ReleaseDevice(int32_t gpu_id);
+	// Number of the streams assigned to <gpu_id>
+	size_t GetStreamCount(int32_t gpu_id);
 
 	bool IsSupportedQSV();
 	bool IsSupportedNV();
 
+	// If true, the frames decoded by NVDEC stay in the GPU memory (AV_PIX_FMT_CUDA) until they are encoded by NVENC
+	bool IsZeroCopyNV();
+
+	// Creates a pool of the CUDA frames of <width>x<height> (NV12) on <device_context>
+	AVBufferRef *CreateFramesContextNV(AVBufferRef *device_context, int width, int height);
+
 protected:
+	struct ProbeCache
+	{
+		// Identifies the drivers (the kernel release and the version of the NVIDIA driver)
+		ov::String driver_key;
+		bool supported_qsv = false;
+		int32_t cuda_device_count = 0;
+	};
+
+	// Returns true if the probe has been finished, after waiting for it if it is in progress.
+	// Returns false if the probe has not been started
+	bool WaitForProbe();
+
+	bool Probe();
+	bool ProbeQSV();
+	// If <device_count> is known (cached), the contexts of the GPUs are created concurrently without probing the next GPU.
+	// Otherwise, the GPUs are probed one by one until it fails
+	bool ProbeCUDA(int32_t device_count);
+
+	static ov::String GetDriverKey();
+	static ov::String GetProbeCachePath();
+	static bool LoadProbeCache(ProbeCache *cache);
+	static void SaveProbeCache(const ProbeCache &cache);
+
+	std::mutex _probe_mutex;
+	std::shared_future<bool> _probe_future;
+	// Set when the probe is finished, so the methods called for every frame don't touch the future
+	std::atomic<bool> _probed{false};
+
 	bool _initialized = false;
 	bool _supported_qsv;
 	bool _supported_cuda;
+	bool _zero_copy_nv;
+
+	// QSV: a device, CUDA: a device per GPU
+	std::vector<AVBufferRef *> _device_context_list;
 
-	AVBufferRef *_device_context;
+	std::mutex _stream_count_mutex;
+	// Indexed by gpu_id
+	std::vector<size_t> _stream_count_list;
 
-};
\ No newline at end of file
+};
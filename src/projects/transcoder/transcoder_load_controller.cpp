@@ -0,0 +1,269 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "transcoder_load_controller.h"
+
+#include <config/config_manager.h>
+
+#include <fstream>
+#include <thread>
+
+#include "transcoder_gpu.h"
+#include "transcoder_private.h"
+
+#define CPU_USAGE_MEASUREMENT_INTERVAL_IN_MSEC 1000
+// A rendition is restored if the load is lower than this ratio of the thresholds
+#define RELAXED_LOAD_RATIO 0.8
+// Microseconds to encode a frame of a megapixel (H.264) until the encoders of the codec are observed
+#define DEFAULT_SW_ENCODE_TIME_PER_MEGAPIXEL 5000.0
+#define DEFAULT_HW_ENCODE_TIME_PER_MEGAPIXEL 1000.0
+// Weight of a new observation in the moving average of the encoding time
+#define ENCODE_TIME_SMOOTHING_FACTOR 0.1
+
+TranscodeLoadController::TranscodeLoadController()
+{
+	auto &config = cfg::ConfigManager::GetInstance()->GetServer()->GetModules().GetTranscodeDegradation();
+
+	_enabled = config.IsEnabled();
+	_cpu_threshold = std::clamp(config.GetCpuThreshold(), 1, 100);
+	_queue_waiting_time_threshold_in_us = static_cast<int64_t>(std::max(config.GetQueueWaitingTimeThreshold(), 1)) * 1000;
+	_check_interval = std::max(config.GetCheckInterval(), 100);
+
+	if (_enabled)
+	{
+		logti("Transcode degradation is enabled (CPU: %.0f%%, Queue waiting time: %" PRId64 "ms, Interval: %" PRIu64 "ms)",
+			  _cpu_threshold, _queue_waiting_time_threshold_in_us / 1000, _check_interval);
+	}
+
+	auto &admission_config = cfg::ConfigManager::GetInstance()->GetServer()->GetModules().GetTranscodeAdmission();
+
+	_admission_enabled = admission_config.IsEnabled();
+	_max_cpu_usage_ratio = std::clamp(admission_config.GetMaxCpuUsage(), 1, 100) / 100.0;
+	_max_gpu_usage_ratio = std::clamp(admission_config.GetMaxGpuUsage(), 1, 100) / 100.0;
+
+	if (_admission_enabled)
+	{
+		_task_queue.Start();
+
+		logti("Transcode admission control is enabled (CPU: %.0f%% of %u cores, GPU: %.0f%%)",
+			  _max_cpu_usage_ratio * 100.0, std::thread::hardware_concurrency(), _max_gpu_usage_ratio * 100.0);
+	}
+}
+
+TranscodeLoadController::LoadState TranscodeLoadController::GetLoadState(int64_t max_waiting_time_in_us)
+{
+	auto cpu_usage = GetCpuUsage();
+
+	if ((cpu_usage >= _cpu_threshold) || (max_waiting_time_in_us >= _queue_waiting_time_threshold_in_us))
+	{
+		return LoadState::Overloaded;
+	}
+
+	if ((cpu_usage < (_cpu_threshold * RELAXED_LOAD_RATIO)) && (max_waiting_time_in_us < (_queue_waiting_time_threshold_in_us * RELAXED_LOAD_RATIO)))
+	{
+		return LoadState::Relaxed;
+	}
+
+	return LoadState::Normal;
+}
+
+double TranscodeLoadController::GetCpuUsage()
+{
+	std::lock_guard<std::mutex> lock_guard(_cpu_mutex);
+
+	auto now = ov::Clock::NowMSec();
+
+	if ((now - _last_cpu_check_time) < CPU_USAGE_MEASUREMENT_INTERVAL_IN_MSEC)
+	{
+		return _cpu_usage;
+	}
+
+	_last_cpu_check_time = now;
+
+	// Format: cpu user nice system idle iowait irq softirq steal ...
+	std::ifstream fs("/proc/stat");
+	std::string name;
+	uint64_t values[8] = {0};
+
+	if ((fs >> name) && (name == "cpu"))
+	{
+		for (auto &value : values)
+		{
+			fs >> value;
+		}
+	}
+	else
+	{
+		return _cpu_usage;
+	}
+
+	uint64_t total = 0;
+	for (auto value : values)
+	{
+		total += value;
+	}
+	// idle + iowait
+	uint64_t idle = values[3] + values[4];
+
+	if ((_last_cpu_total > 0) && (total > _last_cpu_total))
+	{
+		auto total_diff = total - _last_cpu_total;
+		auto idle_diff = idle - std::min(idle, _last_cpu_idle);
+
+		_cpu_usage = 100.0 * static_cast<double>(total_diff - std::min(total_diff, idle_diff)) / static_cast<double>(total_diff);
+	}
+
+	_last_cpu_total = total;
+	_last_cpu_idle = idle;
+
+	return _cpu_usage;
+}
+
+double TranscodeLoadController::EstimateEncodeTime(cmn::MediaCodecId codec_id, bool hwaccel, int64_t pixels)
+{
+	double megapixels = static_cast<double>(pixels) / (1000.0 * 1000.0);
+
+	{
+		std::lock_guard<std::mutex> lock_guard(_admission_mutex);
+
+		auto it = _encode_time_per_megapixel.find({codec_id, hwaccel});
+		if (it != _encode_time_per_megapixel.end())
+		{
+			return it->second * megapixels;
+		}
+	}
+
+	if (hwaccel)
+	{
+		return DEFAULT_HW_ENCODE_TIME_PER_MEGAPIXEL * megapixels;
+	}
+
+	// Relative to H.264 (OpenH264)
+	double factor = 1.0;
+	switch (codec_id)
+	{
+		case cmn::MediaCodecId::Vp8:
+			factor = 1.5;
+			break;
+		case cmn::MediaCodecId::Vp9:
+			factor = 3.0;
+			break;
+		case cmn::MediaCodecId::Av1:
+			factor = 4.0;
+			break;
+		default:
+			break;
+	}
+
+	return DEFAULT_SW_ENCODE_TIME_PER_MEGAPIXEL * factor * megapixels;
+}
+
+void TranscodeLoadController::RecordEncodeTime(cmn::MediaCodecId codec_id, bool hwaccel, int64_t pixels, double elapsed_us)
+{
+	if (pixels <= 0)
+	{
+		return;
+	}
+
+	double time_per_megapixel = elapsed_us / (static_cast<double>(pixels) / (1000.0 * 1000.0));
+
+	std::lock_guard<std::mutex> lock_guard(_admission_mutex);
+
+	auto it = _encode_time_per_megapixel.find({codec_id, hwaccel});
+	if (it == _encode_time_per_megapixel.end())
+	{
+		_encode_time_per_megapixel[{codec_id, hwaccel}] = time_per_megapixel;
+		return;
+	}
+
+	it->second += (time_per_megapixel - it->second) * ENCODE_TIME_SMOOTHING_FACTOR;
+}
+
+double TranscodeLoadController::GetReservedRatio()
+{
+	double cpu_capacity = std::thread::hardware_concurrency() * _max_cpu_usage_ratio;
+	double gpu_capacity = TranscodeGPU::GetInstance()->GetDeviceCount() * _max_gpu_usage_ratio;
+
+	std::lock_guard<std::mutex> lock_guard(_admission_mutex);
+
+	double ratio = (cpu_capacity > 0.0) ? (_reserved.cpu / cpu_capacity) : 0.0;
+
+	if (gpu_capacity > 0.0)
+	{
+		ratio = std::max(ratio, _reserved.gpu / gpu_capacity);
+	}
+
+	return ratio;
+}
+
+bool TranscodeLoadController::Reserve(info::stream_id_t stream_id, const EncodeCost &cost, ov::String *reason)
+{
+	double cpu_capacity = std::thread::hardware_concurrency() * _max_cpu_usage_ratio;
+	double gpu_capacity = TranscodeGPU::GetInstance()->GetDeviceCount() * _max_gpu_usage_ratio;
+
+	std::lock_guard<std::mutex> lock_guard(_admission_mutex);
+
+	// The stream may be prepared again (e.g. the input is changed)
+	auto it = _reservations.find(stream_id);
+	if (it != _reservations.end())
+	{
+		_reserved.cpu -= it->second.cpu;
+		_reserved.gpu -= it->second.gpu;
+		_reservations.erase(it);
+	}
+
+	if ((cost.cpu > 0.0) && ((_reserved.cpu + cost.cpu) > cpu_capacity))
+	{
+		if (reason != nullptr)
+		{
+			reason->Format("CPU capacity exceeded (required: %.2f cores, reserved: %.2f cores, capacity: %.2f cores)", cost.cpu, _reserved.cpu, cpu_capacity);
+		}
+
+		return false;
+	}
+
+	if ((cost.gpu > 0.0) && ((_reserved.gpu + cost.gpu) > gpu_capacity))
+	{
+		if (reason != nullptr)
+		{
+			reason->Format("GPU capacity exceeded (required: %.2f GPUs, reserved: %.2f GPUs, capacity: %.2f GPUs)", cost.gpu, _reserved.gpu, gpu_capacity);
+		}
+
+		return false;
+	}
+
+	_reservations[stream_id] = cost;
+	_reserved.cpu += cost.cpu;
+	_reserved.gpu += cost.gpu;
+
+	return true;
+}
+
+void TranscodeLoadController::Release(info::stream_id_t stream_id)
+{
+	std::lock_guard<std::mutex> lock_guard(_admission_mutex);
+
+	auto it = _reservations.find(stream_id);
+	if (it == _reservations.end())
+	{
+		return;
+	}
+
+	_reserved.cpu = std::max(0.0, _reserved.cpu - it->second.cpu);
+	_reserved.gpu = std::max(0.0, _reserved.gpu - it->second.gpu);
+	_reservations.erase(it);
+}
+
+void TranscodeLoadController::PostTask(std::function<void()> task)
+{
+	_task_queue.Push(
+		[task](void *parameter) -> ov::DelayQueueAction {
+			task();
+			return ov::DelayQueueAction::Stop;
+		},
+		0);
+}
@@ -0,0 +1,118 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/info/stream.h>
+#include <base/mediarouter/media_type.h>
+#include <base/ovlibrary/delay_queue.h>
+#include <base/ovlibrary/ovlibrary.h>
+
+#include <map>
+#include <mutex>
+
+enum class TranscodeDegradationLevel : int32_t
+{
+	// All frames are encoded
+	None = 0,
+	// Every other frame is dropped before encoding
+	HalfFrameRate,
+	// No frame is encoded
+	Skip,
+};
+
+// Decides whether the transcoder is overloaded from the CPU usage of the host and the waiting time of the encoder queues
+//
+// Each TranscoderStream degrades its lowest-priority video rendition a level at a time while it is overloaded,
+// and restores the highest-priority degraded rendition a level at a time after the load is relaxed.
+//
+// Admission control (<TranscodeAdmission>): the cost of a video encoder is the time to encode a frame multiplied by the frame rate,
+// which is the number of the CPU cores (or GPUs) it keeps busy. The time to encode a frame is estimated per megapixel for each codec
+// and software/hardware encoder, from the times observed from the running encoders (or the defaults until they are observed).
+// A stream reserves the cost of its encoders when it is prepared, and is rejected if it does not fit in the remaining capacity.
+class TranscodeLoadController : public ov::Singleton<TranscodeLoadController>
+{
+public:
+	struct EncodeCost
+	{
+		// CPU cores used by the software encoders
+		double cpu = 0.0;
+		// GPUs used by the hardware encoders
+		double gpu = 0.0;
+	};
+
+	enum class LoadState : int32_t
+	{
+		Normal,
+		// A rendition must be degraded
+		Overloaded,
+		// A rendition can be restored
+		Relaxed,
+	};
+
+	TranscodeLoadController();
+
+	bool IsEnabled() const
+	{
+		return _enabled;
+	}
+
+	uint64_t GetCheckInterval() const
+	{
+		return _check_interval;
+	}
+
+	// <max_waiting_time_in_us> is the longest average waiting time of the encoder queues of a stream
+	LoadState GetLoadState(int64_t max_waiting_time_in_us);
+
+	// CPU usage of the host (0~100). It is measured from /proc/stat at most once per second.
+	double GetCpuUsage();
+
+	bool IsAdmissionEnabled() const
+	{
+		return _admission_enabled;
+	}
+
+	// Time to encode a frame of <pixels> in microseconds
+	double EstimateEncodeTime(cmn::MediaCodecId codec_id, bool hwaccel, int64_t pixels);
+	// Called by the video encoders with the average time to encode a frame of <pixels> in microseconds
+	void RecordEncodeTime(cmn::MediaCodecId codec_id, bool hwaccel, int64_t pixels, double elapsed_us);
+
+	// Ratio of the reserved encoding capacity (0~1, the larger of the CPU and the GPUs)
+	double GetReservedRatio();
+
+	// Reserves <cost> for the stream if it fits in the remaining capacity. Otherwise returns false with the capacity in <reason>.
+	bool Reserve(info::stream_id_t stream_id, const EncodeCost &cost, ov::String *reason);
+	void Release(info::stream_id_t stream_id);
+
+	// Runs <task> on the thread of the controller, out of the callbacks of the stream (e.g. to terminate a rejected stream)
+	void PostTask(std::function<void()> task);
+
+protected:
+	bool _enabled = false;
+	double _cpu_threshold = 0.0;
+	int64_t _queue_waiting_time_threshold_in_us = 0;
+	uint64_t _check_interval = 0;
+
+	std::mutex _cpu_mutex;
+	uint64_t _last_cpu_check_time = 0;
+	uint64_t _last_cpu_total = 0;
+	uint64_t _last_cpu_idle = 0;
+	double _cpu_usage = 0.0;
+
+	bool _admission_enabled = false;
+	double _max_cpu_usage_ratio = 0.0;
+	double _max_gpu_usage_ratio = 0.0;
+
+	std::mutex _admission_mutex;
+	// Microseconds to encode a frame of a megapixel (moving average), by codec and hwaccel
+	std::map<std::pair<cmn::MediaCodecId, bool>, double> _encode_time_per_megapixel;
+	std::map<info::stream_id_t, EncodeCost> _reservations;
+	EncodeCost _reserved;
+
+	ov::DelayQueue _task_queue{"TrsAdmission"};
+};
@@ -0,0 +1,311 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "transcoder_pipeline_scheduler.h"
+
+#include <pthread.h>
+#include <sched.h>
+
+#include "transcoder_private.h"
+
+// Idle workers wake up periodically to check for stealable stages
+#define TRANSCODE_PIPELINE_IDLE_TIMEOUT_IN_MSEC 100
+// Yield to the other stages after processing this number of steps
+#define TRANSCODE_PIPELINE_MAX_STEPS_PER_RUN 8
+
+
+void TranscodePipelineScheduler::Stage::Notify()
+{
+	if ((_is_detached == false) && (_is_scheduled.exchange(true) == false))
+	{
+		GetInstance()->Schedule(GetSharedPtr());
+	}
+}
+
+void TranscodePipelineScheduler::Stage::Detach()
+{
+	_is_detached = true;
+
+	// Wait for RunTask() running on a worker
+	std::lock_guard<std::mutex> lock_guard(_run_mutex);
+}
+
+bool TranscodePipelineScheduler::Stage::RunTask()
+{
+	std::lock_guard<std::mutex> lock_guard(_run_mutex);
+
+	auto result = TranscodeStepResult::NoInput;
+
+	for (int step = 0; (step < TRANSCODE_PIPELINE_MAX_STEPS_PER_RUN) && (_is_detached == false); step++)
+	{
+		result = _step();
+
+		if (result == TranscodeStepResult::Stopped)
+		{
+			logtw("Pipeline stage %s is stopped", _name.CStr());
+			_is_detached = true;
+		}
+
+		if (result != TranscodeStepResult::Processed)
+		{
+			break;
+		}
+	}
+
+	_is_scheduled = false;
+
+	if (_is_detached)
+	{
+		return false;
+	}
+
+	// Inputs queued after the flag was cleared are scheduled by Notify() or here, but not twice
+	return ((result == TranscodeStepResult::Processed) || _has_input()) && (_is_scheduled.exchange(true) == false);
+}
+
+TranscodePipelineScheduler::~TranscodePipelineScheduler()
+{
+	Stop();
+}
+
+void TranscodePipelineScheduler::LoadNodes(size_t thread_count)
+{
+	_node_list.clear();
+
+	auto node_count = ov::Platform::GetNumaNodeCount();
+
+	for (size_t node_index = 0; node_index < node_count; node_index++)
+	{
+		auto node = std::make_shared<Node>();
+		node->cpu_list = ov::Platform::GetNumaNodeCpuList(node_index);
+		_node_list.push_back(node);
+	}
+
+	if (_node_list.size() <= 1)
+	{
+		// Do not pin the workers if there is only one node
+		_node_list.clear();
+		_node_list.push_back(std::make_shared<Node>());
+	}
+
+	// Do not keep the nodes that have no worker
+	if (_node_list.size() > thread_count)
+	{
+		_node_list.resize(thread_count);
+	}
+}
+
+bool TranscodePipelineScheduler::Start(size_t thread_count)
+{
+	std::lock_guard lock_guard(_mutex);
+
+	if (_is_running)
+	{
+		logte("Transcode pipeline scheduler is already running");
+		return false;
+	}
+
+	if (thread_count == 0)
+	{
+		thread_count = std::max(std::thread::hardware_concurrency(), 1U);
+	}
+
+	LoadNodes(thread_count);
+
+	_worker_list.clear();
+
+	auto node_count = _node_list.size();
+
+	for (size_t index = 0; index < thread_count; index++)
+	{
+		auto worker = std::make_shared<Worker>();
+
+		worker->node_index = index % node_count;
+		_node_list[worker->node_index]->worker_index_list.push_back(index);
+
+		_worker_list.push_back(worker);
+	}
+
+	_is_running = true;
+
+	for (size_t index = 0; index < thread_count; index++)
+	{
+		auto &worker = _worker_list[index];
+		auto &node = _node_list[worker->node_index];
+
+		worker->thread = std::thread(&TranscodePipelineScheduler::WorkerThread, this, index);
+
+		auto name = ov::String::FormatString("TrPipe%zu", index);
+		::pthread_setname_np(worker->thread.native_handle(), name.CStr());
+
+		if (node->cpu_list.empty() == false)
+		{
+			cpu_set_t cpu_set;
+			CPU_ZERO(&cpu_set);
+
+			for (auto cpu : node->cpu_list)
+			{
+				CPU_SET(cpu, &cpu_set);
+			}
+
+			if (::pthread_setaffinity_np(worker->thread.native_handle(), sizeof(cpu_set), &cpu_set) != 0)
+			{
+				logtw("Could not set the CPU affinity of %s to NUMA node %zu", name.CStr(), worker->node_index);
+			}
+		}
+	}
+
+	logti("Transcode pipeline scheduler is started with %zu threads on %zu NUMA node(s)", thread_count, node_count);
+
+	return true;
+}
+
+bool TranscodePipelineScheduler::Stop()
+{
+	std::lock_guard lock_guard(_mutex);
+
+	if (_is_running.exchange(false) == false)
+	{
+		return true;
+	}
+
+	for (auto &node : _node_list)
+	{
+		std::lock_guard idle_lock_guard(node->idle_mutex);
+		node->idle_condition.notify_all();
+	}
+
+	for (auto &worker : _worker_list)
+	{
+		if (worker->thread.joinable())
+		{
+			worker->thread.join();
+		}
+
+		std::lock_guard worker_lock_guard(worker->mutex);
+		worker->stage_queue.clear();
+	}
+
+	for (auto &node : _node_list)
+	{
+		node->queued_count = 0;
+	}
+
+	return true;
+}
+
+std::shared_ptr<TranscodePipelineScheduler::Stage> TranscodePipelineScheduler::CreateStage(const ov::String &name, size_t affinity_key, Stage::StepFunction step, Stage::HasInputFunction has_input)
+{
+	if (_is_running == false)
+	{
+		return nullptr;
+	}
+
+	auto node_index = affinity_key % _node_list.size();
+	auto &node = _node_list[node_index];
+	auto worker_index = node->worker_index_list[node->next_worker++ % node->worker_index_list.size()];
+
+	logtd("Pipeline stage %s is assigned to worker %zu (NUMA node %zu)", name.CStr(), worker_index, node_index);
+
+	return std::make_shared<Stage>(name, node_index, worker_index, std::move(step), std::move(has_input));
+}
+
+void TranscodePipelineScheduler::Schedule(const std::shared_ptr<Stage> &stage)
+{
+	if (_is_running == false)
+	{
+		return;
+	}
+
+	auto &worker = _worker_list[stage->_worker_index];
+	auto &node = _node_list[stage->_node_index];
+
+	{
+		std::lock_guard lock_guard(worker->mutex);
+		worker->stage_queue.push_back(stage);
+	}
+
+	node->queued_count++;
+
+	// Either this thread sees the idle worker, or the idle worker sees queued_count
+	if (node->idle_count > 0)
+	{
+		std::lock_guard lock_guard(node->idle_mutex);
+		node->idle_condition.notify_one();
+	}
+}
+
+std::shared_ptr<TranscodePipelineScheduler::Stage> TranscodePipelineScheduler::PopStage(size_t index)
+{
+	{
+		auto &worker = _worker_list[index];
+		std::lock_guard lock_guard(worker->mutex);
+
+		if (worker->stage_queue.empty() == false)
+		{
+			auto stage = std::move(worker->stage_queue.front());
+			worker->stage_queue.pop_front();
+			return stage;
+		}
+	}
+
+	// Steal a stage from the other workers of the same node
+	auto &worker_index_list = _node_list[_worker_list[index]->node_index]->worker_index_list;
+
+	for (auto victim_index : worker_index_list)
+	{
+		if (victim_index == index)
+		{
+			continue;
+		}
+
+		auto &victim = _worker_list[victim_index];
+		std::lock_guard lock_guard(victim->mutex);
+
+		if (victim->stage_queue.empty() == false)
+		{
+			auto stage = std::move(victim->stage_queue.back());
+			victim->stage_queue.pop_back();
+			return stage;
+		}
+	}
+
+	return nullptr;
+}
+
+void TranscodePipelineScheduler::WorkerThread(size_t index)
+{
+	ov::ThreadRegistry::Registration registration("TranscodeScheduler");
+
+	auto &node = _node_list[_worker_list[index]->node_index];
+
+	while (_is_running)
+	{
+		auto stage = PopStage(index);
+
+		if (stage == nullptr)
+		{
+			std::unique_lock lock(node->idle_mutex);
+
+			node->idle_count++;
+			node->idle_condition.wait_for(lock, std::chrono::milliseconds(TRANSCODE_PIPELINE_IDLE_TIMEOUT_IN_MSEC), [this, &node]() -> bool {
+				return (node->queued_count > 0) || (_is_running == false);
+			});
+			node->idle_count--;
+
+			continue;
+		}
+
+		node->queued_count--;
+
+		if (stage->RunTask())
+		{
+			// Requeue to the worker of the stage to keep the other stages running
+			Schedule(stage);
+		}
+	}
+}
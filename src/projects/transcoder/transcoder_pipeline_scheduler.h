@@ -0,0 +1,145 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/ovlibrary/ovlibrary.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+enum class TranscodeStepResult : int32_t
+{
+	// The stage has processed (a part of) an input, and may have more to process
+	Processed,
+	// There is no input to process
+	NoInput,
+	// The stage cannot continue (the loop of the codec/filter is ended)
+	Stopped,
+};
+
+// A bounded worker pool that runs the decoders, filters and encoders of all streams as tasks,
+// instead of a thread for each of them
+//
+// The workers are distributed over the NUMA nodes and pinned to the CPUs of their node.
+// All stages with the same affinity key (the id of the stream) run on the workers of the same node,
+// so the frames of a stream stay in the memory of the node. An idle worker steals the stages queued
+// to the other workers of its node.
+class TranscodePipelineScheduler
+{
+public:
+	class Stage : public ov::EnableSharedFromThis<Stage>
+	{
+	public:
+		typedef std::function<TranscodeStepResult()> StepFunction;
+		typedef std::function<bool()> HasInputFunction;
+
+		Stage(const ov::String &name, size_t node_index, size_t worker_index, StepFunction step, HasInputFunction has_input)
+			: _name(name),
+			  _node_index(node_index),
+			  _worker_index(worker_index),
+			  _step(std::move(step)),
+			  _has_input(std::move(has_input))
+		{
+		}
+
+		const ov::String &GetName() const
+		{
+			return _name;
+		}
+
+		// Called when an input is queued to the stage
+		void Notify();
+
+		// Waits for the running step to finish, and the stage is never run again
+		void Detach();
+
+	protected:
+		friend class TranscodePipelineScheduler;
+
+		// Returns true if the stage has more work and must be scheduled again
+		bool RunTask();
+
+		ov::String _name;
+
+		size_t _node_index;
+		size_t _worker_index;
+
+		StepFunction _step;
+		HasInputFunction _has_input;
+
+		std::mutex _run_mutex;
+		std::atomic<bool> _is_scheduled{false};
+		std::atomic<bool> _is_detached{false};
+	};
+
+	static TranscodePipelineScheduler *GetInstance()
+	{
+		static TranscodePipelineScheduler instance;
+		return &instance;
+	}
+
+	// If <thread_count> is 0, the number of CPU cores is used
+	bool Start(size_t thread_count);
+	bool Stop();
+
+	bool IsRunning() const
+	{
+		return _is_running;
+	}
+
+	// Returns nullptr if the scheduler is not running
+	std::shared_ptr<Stage> CreateStage(const ov::String &name, size_t affinity_key, Stage::StepFunction step, Stage::HasInputFunction has_input);
+
+protected:
+	struct Worker
+	{
+		size_t node_index = 0;
+
+		std::mutex mutex;
+		std::deque<std::shared_ptr<Stage>> stage_queue;
+
+		std::thread thread;
+	};
+
+	struct Node
+	{
+		std::vector<int> cpu_list;
+		// Indices of _worker_list
+		std::vector<size_t> worker_index_list;
+		std::atomic<size_t> next_worker{0};
+
+		// Number of stages queued in the workers of the node
+		std::atomic<size_t> queued_count{0};
+
+		std::mutex idle_mutex;
+		std::condition_variable idle_condition;
+		std::atomic<size_t> idle_count{0};
+	};
+
+	TranscodePipelineScheduler() = default;
+	~TranscodePipelineScheduler();
+
+	// Loads the CPUs of the NUMA nodes (See ov::Platform::GetNumaNodeCount()). If there is only one node, the workers are not pinned.
+	void LoadNodes(size_t thread_count);
+
+	void Schedule(const std::shared_ptr<Stage> &stage);
+
+	void WorkerThread(size_t index);
+	std::shared_ptr<Stage> PopStage(size_t index);
+
+	std::atomic<bool> _is_running{false};
+
+	std::mutex _mutex;
+	// Not changed while the scheduler is running
+	std::vector<std::shared_ptr<Node>> _node_list;
+	std::vector<std::shared_ptr<Worker>> _worker_list;
+};
@@ -0,0 +1,191 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "transcoder_shared_decoder.h"
+
+#include <config/config_manager.h>
+
+#include "transcoder_private.h"
+
+namespace
+{
+	std::mutex registry_mutex;
+	// key: TranscodeSharedDecoder::MakeKey()
+	std::map<ov::String, std::shared_ptr<TranscodeSharedDecoder>> registry;
+}  // namespace
+
+ov::String TranscodeSharedDecoder::MakeKey(const info::Stream &stream, const std::shared_ptr<MediaTrack> &track)
+{
+	auto &module_config = cfg::ConfigManager::GetInstance()->GetServer()->GetModules();
+
+	if (module_config.GetSharedDecoder().IsEnabled() == false)
+	{
+		return "";
+	}
+
+	// Only the streams relayed from the same origin stream have the same input
+	auto origin_stream_uuid = stream.GetOriginStreamUUID();
+
+	if (origin_stream_uuid.IsEmpty())
+	{
+		return "";
+	}
+
+	// The decoded frames of a hardware decoder are only shared by the streams on the same GPU
+	return ov::String::FormatString("%s/%u/%d/%s",
+									origin_stream_uuid.CStr(),
+									track->GetId(),
+									static_cast<int>(track->GetCodecId()),
+									track->GetHardwareAccel() ? ov::String::FormatString("hw%d", track->GetHardwareAccelDeviceId()).CStr() : "sw");
+}
+
+std::shared_ptr<TranscodeSharedDecoder> TranscodeSharedDecoder::Subscribe(const ov::String &key, const void *subscriber, int32_t decoder_id, CompleteHandler complete_handler, const DecoderCreator &creator)
+{
+	std::lock_guard<std::mutex> lock_guard(registry_mutex);
+
+	std::shared_ptr<TranscodeSharedDecoder> shared_decoder;
+
+	auto item = registry.find(key);
+
+	if (item == registry.end())
+	{
+		shared_decoder = std::shared_ptr<TranscodeSharedDecoder>(new TranscodeSharedDecoder(key));
+
+		// The decoder is stopped before shared_decoder is released (in Unsubscribe())
+		auto shared_decoder_ptr = shared_decoder.get();
+		shared_decoder->_decoder = creator([shared_decoder_ptr](TranscodeResult result, int32_t owner_decoder_id, std::shared_ptr<MediaFrame> decoded_frame) {
+			shared_decoder_ptr->OnDecodedFrame(result, owner_decoder_id, std::move(decoded_frame));
+		});
+
+		if (shared_decoder->_decoder == nullptr)
+		{
+			return nullptr;
+		}
+
+		registry[key] = shared_decoder;
+
+		logti("Shared decoder is created: %s", key.CStr());
+	}
+	else
+	{
+		shared_decoder = item->second;
+
+		logti("Shared decoder is reused: %s", key.CStr());
+	}
+
+	std::lock_guard<std::shared_mutex> subscriber_lock_guard(shared_decoder->_subscriber_mutex);
+
+	shared_decoder->_subscriber_list.push_back({subscriber, decoder_id, std::move(complete_handler)});
+	shared_decoder->_owner = shared_decoder->_subscriber_list.front().id;
+
+	return shared_decoder;
+}
+
+void TranscodeSharedDecoder::Unsubscribe(const std::shared_ptr<TranscodeSharedDecoder> &shared_decoder, const void *subscriber)
+{
+	if (shared_decoder == nullptr)
+	{
+		return;
+	}
+
+	bool is_last_subscriber = false;
+
+	{
+		std::lock_guard<std::mutex> lock_guard(registry_mutex);
+		std::lock_guard<std::shared_mutex> subscriber_lock_guard(shared_decoder->_subscriber_mutex);
+
+		auto &subscriber_list = shared_decoder->_subscriber_list;
+
+		subscriber_list.erase(std::remove_if(subscriber_list.begin(), subscriber_list.end(), [subscriber](const Subscriber &item) -> bool {
+								  return item.id == subscriber;
+							  }),
+							  subscriber_list.end());
+
+		if (subscriber_list.empty())
+		{
+			shared_decoder->_owner = nullptr;
+
+			auto item = registry.find(shared_decoder->_key);
+			if ((item != registry.end()) && (item->second == shared_decoder))
+			{
+				registry.erase(item);
+			}
+
+			is_last_subscriber = true;
+		}
+		else
+		{
+			// Packets of the next subscriber are fed from its next keyframe, since the decoder cannot continue
+			// the GOP of the previous owner from the packets of another stream
+			if (shared_decoder->_owner != subscriber_list.front().id)
+			{
+				shared_decoder->_waiting_for_key_frame = true;
+				shared_decoder->_owner = subscriber_list.front().id;
+
+				logti("The owner of the shared decoder is changed, waiting for the next keyframe: %s", shared_decoder->_key.CStr());
+			}
+		}
+	}
+
+	if (is_last_subscriber)
+	{
+		shared_decoder->_decoder->Stop();
+
+		logti("Shared decoder is released: %s", shared_decoder->_key.CStr());
+	}
+}
+
+void TranscodeSharedDecoder::SendBuffer(const void *subscriber, std::shared_ptr<const MediaPacket> packet)
+{
+	if (_owner != subscriber)
+	{
+		return;
+	}
+
+	if (_waiting_for_key_frame)
+	{
+		if ((packet->GetMediaType() == cmn::MediaType::Video) && (packet->GetFlag() != MediaPacketFlag::Key))
+		{
+			return;
+		}
+
+		_waiting_for_key_frame = false;
+	}
+
+	_decoder->SendBuffer(std::move(packet));
+}
+
+void TranscodeSharedDecoder::OnDecodedFrame(TranscodeResult result, int32_t decoder_id, std::shared_ptr<MediaFrame> decoded_frame)
+{
+	std::shared_lock<std::shared_mutex> subscriber_lock(_subscriber_mutex);
+
+	auto count = _subscriber_list.size();
+
+	for (size_t index = 0; index < count; index++)
+	{
+		auto &subscriber = _subscriber_list[index];
+		auto frame = decoded_frame;
+
+		// The frame is modified by the subscribers (track id), so each subscriber except the last one gets a copy
+		if ((frame != nullptr) && (index + 1 < count))
+		{
+			frame = decoded_frame->CloneFrame();
+
+			if (frame == nullptr)
+			{
+				continue;
+			}
+		}
+
+		if (frame != nullptr)
+		{
+			frame->SetTrackId(subscriber.decoder_id);
+		}
+
+		subscriber.complete_handler(result, subscriber.decoder_id, std::move(frame));
+	}
+}
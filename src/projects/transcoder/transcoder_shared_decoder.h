@@ -0,0 +1,73 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Copyright (c) 2026 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <shared_mutex>
+
+#include "transcoder_decoder.h"
+
+// A decoder shared by the TranscoderStreams whose input tracks come from the same origin stream
+// (e.g. the streams relayed by OVT from the same origin stream into multiple applications)
+//
+// Only the owner (the oldest subscriber) feeds packets to the decoder, and the decoded frames are delivered
+// to all subscribers with their own decoder id. When the owner unsubscribes, the next subscriber becomes the owner,
+// and its packets are fed from its next keyframe (the owner may leave in the middle of a GOP).
+class TranscodeSharedDecoder
+{
+public:
+	typedef TranscodeDecoder::CompleteHandler CompleteHandler;
+	typedef std::function<std::shared_ptr<TranscodeDecoder>(CompleteHandler complete_handler)> DecoderCreator;
+
+	// Returns an empty string if the track cannot be shared (or the SharedDecoder module is disabled)
+	static ov::String MakeKey(const info::Stream &stream, const std::shared_ptr<MediaTrack> &track);
+
+	// Returns the decoder shared by <key>. If there is no decoder for <key>, a new decoder is created by <creator>
+	static std::shared_ptr<TranscodeSharedDecoder> Subscribe(const ov::String &key, const void *subscriber, int32_t decoder_id, CompleteHandler complete_handler, const DecoderCreator &creator);
+	// The decoder is stopped when the last subscriber unsubscribes.
+	// After this returns, <complete_handler> of the subscriber is no longer called.
+	static void Unsubscribe(const std::shared_ptr<TranscodeSharedDecoder> &shared_decoder, const void *subscriber);
+
+	const std::shared_ptr<TranscodeDecoder> &GetDecoder() const
+	{
+		return _decoder;
+	}
+
+	// Packets from the subscribers other than the owner are ignored.
+	// After the owner is changed, the video packets are ignored until the next keyframe of the new owner.
+	void SendBuffer(const void *subscriber, std::shared_ptr<const MediaPacket> packet);
+
+	ov::String GetKey() const
+	{
+		return _key;
+	}
+
+protected:
+	struct Subscriber
+	{
+		const void *id;
+		int32_t decoder_id;
+		CompleteHandler complete_handler;
+	};
+
+	TranscodeSharedDecoder(const ov::String &key)
+		: _key(key)
+	{
+	}
+
+	void OnDecodedFrame(TranscodeResult result, int32_t decoder_id, std::shared_ptr<MediaFrame> decoded_frame);
+
+	ov::String _key;
+	std::shared_ptr<TranscodeDecoder> _decoder;
+
+	// The first item is the owner
+	std::shared_mutex _subscriber_mutex;
+	std::vector<Subscriber> _subscriber_list;
+	std::atomic<const void *> _owner{nullptr};
+	// Set when the owner is changed, and cleared by the next keyframe
+	std::atomic<bool> _waiting_for_key_frame{false};
+};
@@ -10,8 +10,13 @@
 #include "transcoder_stream.h"
 
 #include <config/config_manager.h>
+#include <monitoring/monitoring.h>
+#include <orchestrator/orchestrator.h>
 
+#include "filter/filter_multi_rescaler.h"
 #include "transcoder_application.h"
+#include "transcoder_benchmark.h"
+#include "transcoder_gpu.h"
 #include "transcoder_private.h"
 
 #define MAX_QUEUE_SIZE 100
@@ -58,6 +63,10 @@ bool TranscoderStream::Stop()
 
 	RemoveAllComponents();
 
+	ReleaseGpu();
+
+	TranscodeLoadController::GetInstance()->Release(GetStreamId());
+
 	// Notify to delete the stream created on the MediaRouter
 	NotifyDeleteStreams();
 
@@ -127,6 +136,11 @@ bool TranscoderStream::StartInternal()
 		return false;
 	}
 
+	if (ReserveEncodingCapacity() == false)
+	{
+		return false;
+	}
+
 	if (CreateDecoders() == 0)
 	{
 		logti("No decoder generated");
@@ -189,11 +203,20 @@ void TranscoderStream::RemoveDecoders()
 	
 	for (auto &it : _decoders)
 	{
+		auto shared_decoder_it = _shared_decoders.find(it.first);
+		if (shared_decoder_it != _shared_decoders.end())
+		{
+			// The decoder is stopped when the last stream unsubscribes
+			TranscodeSharedDecoder::Unsubscribe(shared_decoder_it->second, this);
+			continue;
+		}
+
 		auto object = it.second;
 		object->Stop();
 		object.reset();
 	}
 	_decoders.clear();
+	_shared_decoders.clear();
 }
 
 void TranscoderStream::RemoveFilters()
@@ -203,10 +226,14 @@ void TranscoderStream::RemoveFilters()
 	for (auto &it : _filters)
 	{
 		auto object = it.second;
-		object->Stop();
+		if (object != nullptr)
+		{
+			object->Stop();
+		}
 		object.reset();
 	}
 	_filters.clear();
+	_grouped_filter_ids.clear();
 }
 
 void TranscoderStream::RemoveEncoders()
@@ -278,6 +305,36 @@ bool TranscoderStream::Push(std::shared_ptr<MediaPacket> packet)
 	return true;
 }
 
+bool TranscoderStream::RequestKeyFrame(info::stream_id_t output_stream_id, MediaTrackId output_track_id)
+{
+	std::shared_lock<std::shared_mutex> lock(_encoder_map_mutex);
+
+	for (const auto &[encoder_id, output_tracks] : _link_encoder_to_outputs)
+	{
+		for (const auto &[output_stream, track_id] : output_tracks)
+		{
+			if ((output_stream->GetId() != output_stream_id) || (track_id != output_track_id))
+			{
+				continue;
+			}
+
+			auto encoder_it = _encoders.find(encoder_id);
+			if (encoder_it == _encoders.end())
+			{
+				// The encoder is not created yet, the first frame is a keyframe anyway
+				return false;
+			}
+
+			logtd("%s Keyframe requested. stream(%u) track(%u) encoder(%u)", _log_prefix.CStr(), output_stream_id, output_track_id, encoder_id);
+			encoder_it->second->RequestKeyFrame();
+
+			return true;
+		}
+	}
+
+	return false;
+}
+
 // Dynamically generated applications are created by default with BYPASS profiles.
 int32_t TranscoderStream::CreateOutputStreamDynamic()
 {
@@ -425,6 +482,14 @@ std::shared_ptr<info::Stream> TranscoderStream::CreateOutputStream(const cfg::vh
 						continue;
 					}
 
+					if (profile.IsKeyFrameOnly())
+					{
+						// The key frames are selected at the framerate before decoding,
+						// so the frames must not be resampled (duplicated) by the filter
+						_key_frame_only_output_tracks[output_track->GetId()] = profile.GetFramerate();
+						output_track->SetFrameRateByConfig(0.0);
+					}
+
 					stream->AddTrack(output_track);
 
 					auto profile_sign = GetIdentifiedForImageProfile(input_track_id, profile);
@@ -523,11 +588,102 @@ int32_t TranscoderStream::BuildComposite()
 		created_count++;
 	}
 
+	BuildKeyFrameOnlyDecoders();
+
 	logtd("%s", GetInfoStringComposite().CStr());
 
 	return created_count;
 }
 
+void TranscoderStream::BuildKeyFrameOnlyDecoders()
+{
+	_key_frame_only_decoders.clear();
+
+	if (_key_frame_only_output_tracks.empty())
+	{
+		return;
+	}
+
+	for (auto &[input_track_id, decoder_id] : _link_input_to_decoder)
+	{
+		// A shared decoder also feeds the streams of other applications that may need all frames
+		auto input_track = GetInputTrack(input_track_id);
+		if ((input_track == nullptr) || (TranscodeSharedDecoder::MakeKey(*_input_stream, input_track).IsEmpty() == false))
+		{
+			continue;
+		}
+
+		bool key_frame_only = true;
+		// The shortest interval of the outputs is used
+		int64_t interval_us = -1;
+
+		for (auto filter_id : _link_decoder_to_filters[decoder_id])
+		{
+			auto encoder_id = _link_filter_to_encoder[filter_id];
+
+			for (auto &[output_stream, output_track_id] : _link_encoder_to_outputs[encoder_id])
+			{
+				auto it = _key_frame_only_output_tracks.find(output_track_id);
+				if (it == _key_frame_only_output_tracks.end())
+				{
+					key_frame_only = false;
+					break;
+				}
+
+				auto framerate = it->second;
+				auto output_interval_us = (framerate > 0.0) ? static_cast<int64_t>(1000000.0 / framerate) : 0;
+
+				interval_us = (interval_us < 0) ? output_interval_us : std::min(interval_us, output_interval_us);
+			}
+
+			if (key_frame_only == false)
+			{
+				break;
+			}
+		}
+
+		if (key_frame_only && (interval_us >= 0))
+		{
+			_key_frame_only_decoders[decoder_id].interval_us = interval_us;
+
+			logti("%s Decoder(%d) decodes only the key frames (interval: %" PRId64 " ms)", _log_prefix.CStr(), decoder_id, interval_us / 1000);
+		}
+	}
+}
+
+bool TranscoderStream::IsSkippableForKeyFrameOnly(int32_t decoder_id, const std::shared_ptr<MediaPacket> &packet)
+{
+	auto it = _key_frame_only_decoders.find(decoder_id);
+	if (it == _key_frame_only_decoders.end())
+	{
+		return false;
+	}
+
+	if (packet->GetFlag() != MediaPacketFlag::Key)
+	{
+		return true;
+	}
+
+	auto input_track = _input_stream->GetTrack(packet->GetTrackId());
+	if (input_track == nullptr)
+	{
+		return false;
+	}
+
+	auto &context = it->second;
+	auto pts_us = static_cast<int64_t>(packet->GetPts() * input_track->GetTimeBase().GetExpr() * 1000000);
+
+	// If the timestamp goes back (e.g. the input is switched), the key frame is decoded
+	if ((context.last_decoded_pts_us >= 0) && (pts_us >= context.last_decoded_pts_us) && ((pts_us - context.last_decoded_pts_us) < context.interval_us))
+	{
+		return true;
+	}
+
+	context.last_decoded_pts_us = pts_us;
+
+	return false;
+}
+
 // LOG for DEBUG
 ov::String TranscoderStream::GetInfoStringComposite()
 {
@@ -603,22 +759,150 @@ void TranscoderStream::AddComposite(
 {
 	auto key = std::make_pair(profile_sign, input_track->GetMediaType());
 
-	if (_composite_map.find(key) == _composite_map.end())
+	auto composite_it = _composite_map.find(key);
+	if (composite_it == _composite_map.end())
 	{
 		auto composite = std::make_shared<CompositeContext>(_last_composite_id++);
 		composite->SetInput(input_stream, input_track);
 
-		_composite_map[key] = composite;
+		composite_it = _composite_map.emplace(key, composite).first;
+
+		logtd("%s Composite #%u is created for %s (%s/%s)", _log_prefix.CStr(), composite->GetId(), profile_sign.CStr(), output_stream->GetName().CStr(), output_track->GetVariantName().CStr());
 	}
+	else
+	{
+		// The output track shares the decoder/filter/encoder of the composite (the encoding is done once)
+		logtd("%s Composite #%u is shared with %s/%s (%s)", _log_prefix.CStr(), composite_it->second->GetId(), output_stream->GetName().CStr(), output_track->GetVariantName().CStr(), profile_sign.CStr());
+	}
+
+	composite_it->second->AddOutput(output_stream, output_track);
+}
+
+
+void TranscoderStream::AcquireGpu()
+{
+	if ((_gpu_id >= 0) || (_application_info.GetConfig().GetOutputProfiles().IsHardwareAcceleration() == false))
+	{
+		return;
+	}
+
+	_gpu_id = TranscodeGPU::GetInstance()->AcquireDevice();
+
+	if (_gpu_id < 0)
+	{
+		return;
+	}
+
+	logti("%s GPU %d is assigned (%d GPUs, %zu streams on the GPU)", _log_prefix.CStr(), _gpu_id, TranscodeGPU::GetInstance()->GetDeviceCount(), TranscodeGPU::GetInstance()->GetStreamCount(_gpu_id));
+
+	UpdateGpuOfStreamMetrics(*_input_stream);
+}
+
+bool TranscoderStream::ReserveEncodingCapacity()
+{
+	auto controller = TranscodeLoadController::GetInstance();
+	if (controller->IsAdmissionEnabled() == false)
+	{
+		return true;
+	}
+
+	auto use_hwaccel = _application_info.GetConfig().GetOutputProfiles().IsHardwareAcceleration();
+	auto gpu = TranscodeGPU::GetInstance();
+
+	TranscodeLoadController::EncodeCost cost;
+
+	for (auto &[key, composite] : _composite_map)
+	{
+		// The outputs of an encoder share it
+		auto output_tracks_it = _link_encoder_to_outputs.find(composite->GetId());
+		if ((output_tracks_it == _link_encoder_to_outputs.end()) || output_tracks_it->second.empty())
+		{
+			continue;
+		}
+
+		auto &[output_stream, output_track_id] = output_tracks_it->second.front();
+		auto output_track = output_stream->GetTrack(output_track_id);
+		auto input_track = composite->GetInputTrack();
+		if ((output_track == nullptr) || (output_track->GetMediaType() != cmn::MediaType::Video) || output_track->IsBypass())
+		{
+			continue;
+		}
+
+		// The resolution and the frame rate follow the input if they are not configured
+		int64_t width = output_track->GetWidth();
+		int64_t height = output_track->GetHeight();
+		if ((width <= 0) || (height <= 0))
+		{
+			width = input_track->GetWidth();
+			height = input_track->GetHeight();
+		}
+
+		double framerate = output_track->GetFrameRate();
+		if (framerate <= 0.0)
+		{
+			framerate = (input_track->GetFrameRate() > 0.0) ? input_track->GetFrameRate() : input_track->GetEstimateFrameRate();
+		}
+
+		auto codec_id = output_track->GetCodecId();
+		bool hwaccel = use_hwaccel &&
+					   ((codec_id == cmn::MediaCodecId::H264) || (codec_id == cmn::MediaCodecId::H265)) &&
+					   (gpu->IsSupportedNV() || gpu->IsSupportedQSV());
+
+		auto encoder_cost = controller->EstimateEncodeTime(codec_id, hwaccel, width * height) * framerate / (1000.0 * 1000.0);
+
+		(hwaccel ? cost.gpu : cost.cpu) += encoder_cost;
+	}
+
+	ov::String reason;
+	if (controller->Reserve(GetStreamId(), cost, &reason))
+	{
+		logti("%s Encoding capacity has been reserved (CPU: %.2f cores, GPU: %.2f)", _log_prefix.CStr(), cost.cpu, cost.gpu);
+		return true;
+	}
+
+	logte("%s The stream is rejected by the admission control: %s", _log_prefix.CStr(), reason.CStr());
 
-	_composite_map[key]->AddOutput(output_stream, output_track);
+	// The deletion of the input stream is notified to this application, so it is terminated out of this callback
+	auto vhost_app_name = _application_info.GetName();
+	auto stream_name = _input_stream->GetName();
+	controller->PostTask([vhost_app_name, stream_name]() {
+		ocst::Orchestrator::GetInstance()->TerminateStream(vhost_app_name, stream_name);
+	});
+
+	return false;
 }
 
+void TranscoderStream::ReleaseGpu()
+{
+	if (_gpu_id < 0)
+	{
+		return;
+	}
+
+	TranscodeGPU::GetInstance()->ReleaseDevice(_gpu_id);
+	_gpu_id = -1;
+
+	UpdateGpuOfStreamMetrics(*_input_stream);
+}
+
+void TranscoderStream::UpdateGpuOfStreamMetrics(const info::Stream &stream)
+{
+	auto stream_metrics = StreamMetrics(stream);
+	if (stream_metrics != nullptr)
+	{
+		stream_metrics->SetGpuId(_gpu_id);
+	}
+}
 
 int32_t TranscoderStream::CreateDecoders()
 {
 	int32_t created_decoder_count = 0;
 
+	if (_link_input_to_decoder.empty() == false)
+	{
+		AcquireGpu();
+	}
+
 	for (auto &[input_track_id, decoder_id] : _link_input_to_decoder)
 	{
 		auto track_item = _input_stream->GetTracks().find(input_track_id);
@@ -632,6 +916,8 @@ int32_t TranscoderStream::CreateDecoders()
 		// Get hardware acceleration is enabled
 		auto use_hwaccel = _application_info.GetConfig().GetOutputProfiles().IsHardwareAcceleration();
 		track->SetHardwareAccel(use_hwaccel);
+		track->SetHardwareAccelDeviceId(std::max(_gpu_id, 0));
+		track->SetKeyFrameOnlyDecoding(_key_frame_only_decoders.find(decoder_id) != _key_frame_only_decoders.end());
 
 		// Deprecated
 		// Set the number of b frames for compatibility with specific encoders.
@@ -663,7 +949,29 @@ bool TranscoderStream::CreateDecoder(int32_t decoder_id, std::shared_ptr<MediaTr
 		return true;
 	}
 
-	auto decoder = TranscodeDecoder::Create(decoder_id, *_input_stream, input_track, bind(&TranscoderStream::OnDecodedFrame, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3));
+	auto complete_handler = bind(&TranscoderStream::OnDecodedFrame, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3);
+
+	auto shared_key = TranscodeSharedDecoder::MakeKey(*_input_stream, input_track);
+	if (shared_key.IsEmpty() == false)
+	{
+		auto shared_decoder = TranscodeSharedDecoder::Subscribe(shared_key, this, decoder_id, complete_handler, [&](TranscodeSharedDecoder::CompleteHandler shared_handler) {
+			return TranscodeDecoder::Create(decoder_id, *_input_stream, input_track, std::move(shared_handler));
+		});
+
+		if (shared_decoder == nullptr)
+		{
+			logte("[%s/%s(%u)] Shared decoder allocation failed", _input_stream->GetApplicationName(), _input_stream->GetName().CStr(), _input_stream->GetId());
+
+			return false;
+		}
+
+		_shared_decoders[decoder_id] = shared_decoder;
+		_decoders[decoder_id] = shared_decoder->GetDecoder();
+
+		return true;
+	}
+
+	auto decoder = TranscodeDecoder::Create(decoder_id, *_input_stream, input_track, complete_handler);
 	if (decoder == nullptr)
 	{
 		logte("[%s/%s(%u)] Decoder allocation failed", _input_stream->GetApplicationName(), _input_stream->GetName().CStr(), _input_stream->GetId());
@@ -709,6 +1017,7 @@ int32_t TranscoderStream::CreateEncoders(MediaFrame *buffer)
 
 			auto use_hwaccel = _application_info.GetConfig().GetOutputProfiles().IsHardwareAcceleration();
 			output_track->SetHardwareAccel(use_hwaccel);
+			output_track->SetHardwareAccelDeviceId(std::max(_gpu_id, 0));
 
 			if (CreateEncoder(encoder_id, output_stream, output_track) == false)
 			{
@@ -778,6 +1087,8 @@ int32_t TranscoderStream::CreateFilters(MediaFrame *buffer)
 	auto filter_ids = decoder_to_filters_it->second;
 
 	// 2. Get Output Track of Encoders
+	std::vector<std::pair<int32_t, std::shared_ptr<MediaTrack>>> filter_outputs;
+
 	for (auto &filter_id : filter_ids)
 	{
 		MediaTrackId encoder_id = _link_filter_to_encoder[filter_id];
@@ -787,9 +1098,40 @@ int32_t TranscoderStream::CreateFilters(MediaFrame *buffer)
 			continue;
 		}
 
-		auto output_track = _encoders[encoder_id]->GetRefTrack();
+		filter_outputs.emplace_back(filter_id, _encoders[encoder_id]->GetRefTrack());
+	}
+
+	// 3. The video outputs scaled by software are scaled in a filter graph
+	auto &module_config = cfg::ConfigManager::GetInstance()->GetServer()->GetModules();
+
+	if ((input_track->GetMediaType() == cmn::MediaType::Video) && module_config.GetMultiOutputRescaler().IsEnabled())
+	{
+		std::vector<int32_t> grouped_filter_ids;
+		std::vector<std::shared_ptr<MediaTrack>> grouped_output_tracks;
+
+		for (auto &[filter_id, output_track] : filter_outputs)
+		{
+			if (FilterMultiRescaler::IsSupported(input_track, output_track))
+			{
+				grouped_filter_ids.push_back(filter_id);
+				grouped_output_tracks.push_back(output_track);
+			}
+		}
+
+		if ((grouped_filter_ids.size() > 1) && CreateMultiOutputFilter(grouped_filter_ids, input_track, grouped_output_tracks))
+		{
+			created_count += grouped_filter_ids.size();
+
+			filter_outputs.erase(std::remove_if(filter_outputs.begin(), filter_outputs.end(), [&grouped_filter_ids](const auto &item) -> bool {
+									 return std::find(grouped_filter_ids.begin(), grouped_filter_ids.end(), item.first) != grouped_filter_ids.end();
+								 }),
+								 filter_outputs.end());
+		}
+	}
 
-		logtd("%s Create Filter. Decoder(%d) > Filter(%d) > Encoder(%d)", _log_prefix.CStr(), decoder_id, filter_id, encoder_id);
+	for (auto &[filter_id, output_track] : filter_outputs)
+	{
+		logtd("%s Create Filter. Decoder(%d) > Filter(%d) > Encoder(%d)", _log_prefix.CStr(), decoder_id, filter_id, _link_filter_to_encoder[filter_id]);
 		if(CreateFilter(filter_id, input_track, output_track) == false)
 		{
 			continue;
@@ -801,17 +1143,67 @@ int32_t TranscoderStream::CreateFilters(MediaFrame *buffer)
 	return created_count;
 }
 
+bool TranscoderStream::CreateMultiOutputFilter(const std::vector<int32_t> &filter_ids, std::shared_ptr<MediaTrack> input_track, const std::vector<std::shared_ptr<MediaTrack>> &output_tracks)
+{
+	std::lock_guard<std::shared_mutex> filter_lock(_filter_map_mutex);
+
+	// remove the previous created filters
+	for (auto &filter_id : filter_ids)
+	{
+		auto filter_it = _filters.find(filter_id);
+		if ((filter_it != _filters.end()) && (filter_it->second != nullptr))
+		{
+			filter_it->second->Stop();
+			filter_it->second = nullptr;
+		}
+
+		_grouped_filter_ids.erase(filter_id);
+	}
+
+	auto input_stream = GetInputStream();
+	if (input_stream == nullptr)
+	{
+		logte("%s Could not found input stream", _log_prefix.CStr());
+		return false;
+	}
+
+	auto filter = std::make_shared<TranscodeFilter>();
+
+	if (filter->Configure(filter_ids, input_stream, input_track, output_tracks, bind(&TranscoderStream::OnFilteredFrame, this, std::placeholders::_1, std::placeholders::_2)) != true)
+	{
+		logte("%s Failed to create multi-output filter. Filter(%d), Outputs(%zu)", _log_prefix.CStr(), filter_ids.front(), filter_ids.size());
+		filter->Stop();
+		return false;
+	}
+
+	for (auto &filter_id : filter_ids)
+	{
+		_filters[filter_id] = filter;
+
+		if (filter_id != filter_ids.front())
+		{
+			_grouped_filter_ids.insert(filter_id);
+		}
+	}
+
+	logti("%s Multi-output filter is created. Decoder(%d) > Filters(%zu)", _log_prefix.CStr(), input_track->GetId(), filter_ids.size());
+
+	return true;
+}
+
 bool TranscoderStream::CreateFilter(int32_t filter_id, std::shared_ptr<MediaTrack> input_track, std::shared_ptr<MediaTrack> output_track)
 {
 	std::lock_guard<std::shared_mutex> filter_lock(_filter_map_mutex);
 
 	// remove the previous created filter
-	if (_filters.find(filter_id) != _filters.end())
+	if ((_filters.find(filter_id) != _filters.end()) && (_filters[filter_id] != nullptr))
 	{
 		_filters[filter_id]->Stop();
 		_filters[filter_id] = nullptr;
 	}
 
+	_grouped_filter_ids.erase(filter_id);
+
 	auto input_stream = GetInputStream();
 	if(input_stream == nullptr)
 	{
@@ -1002,14 +1394,20 @@ void TranscoderStream::DecodePacket(std::shared_ptr<MediaPacket> packet)
 {
 	MediaTrackId input_track_id = packet->GetTrackId();
 
+	auto input_to_decoder_it = _link_input_to_decoder.find(input_track_id);
+	bool has_decoder = (input_to_decoder_it != _link_input_to_decoder.end());
+
 	// 1. bypass track processing.
 	auto output_streams_it = _link_input_to_outputs.find(input_track_id);
 	if (output_streams_it != _link_input_to_outputs.end())
 	{
 		auto &output_tracks = output_streams_it->second;
+		size_t remained_output_count = output_tracks.size();
 
 		for (auto &[output_stream, output_track_id] : output_tracks)
 		{
+			remained_output_count--;
+
 			auto input_track = _input_stream->GetTrack(input_track_id);
 			if (input_track == nullptr)
 			{
@@ -1024,10 +1422,27 @@ void TranscoderStream::DecodePacket(std::shared_ptr<MediaPacket> packet)
 				continue;
 			}
 
-			auto clone_packet = packet->ClonePacket();
+			// The payload of the input is already normalized (Annex B/ADTS) by MediaRouter and is not modified after that,
+			// so the outputs share it instead of copying it.
+			// The last output takes the packet itself if nobody else (decoder, other observers) refers to it.
+			std::shared_ptr<MediaPacket> clone_packet;
+			if ((remained_output_count == 0) && (has_decoder == false) && (packet.use_count() == 1))
+			{
+				clone_packet = std::move(packet);
+			}
+			else
+			{
+				clone_packet = packet->ClonePacket(false);
+			}
 
 			clone_packet->SetTrackId(output_track_id);
 
+			// The bypassed packet goes through the remaining stages separately from the packet being decoded
+			if ((clone_packet->GetTrace() != nullptr) && (has_decoder == true))
+			{
+				clone_packet->SetTrace(clone_packet->GetTrace()->Clone());
+			}
+
 			// PTS/DTS recalculation based on output timebase
 			double scale = input_track->GetTimeBase().GetExpr() / output_track->GetTimeBase().GetExpr();
 			clone_packet->SetPts((int64_t)((double)clone_packet->GetPts() * scale));
@@ -1038,21 +1453,49 @@ void TranscoderStream::DecodePacket(std::shared_ptr<MediaPacket> packet)
 	}
 
 	// 2. decoding track processing
-	auto input_to_decoder_it = _link_input_to_decoder.find(input_track_id);
-	if (input_to_decoder_it == _link_input_to_decoder.end())
+	if (has_decoder == false)
 	{
 		return;
 	}
 	auto decoder_id = input_to_decoder_it->second;
 
+	if (IsSkippableForKeyFrameOnly(decoder_id, packet))
+	{
+		return;
+	}
+
+	if (packet->GetTrace() != nullptr)
+	{
+		auto input_track = _input_stream->GetTrack(input_track_id);
+		if (input_track != nullptr)
+		{
+			AddPendingTrace(input_track->GetMediaType(), packet->GetPts() * input_track->GetTimeBase().GetExpr() * 1000000, packet->GetTrace());
+		}
+	}
+
 	std::shared_lock<std::shared_mutex> lock(_decoder_map_mutex);
 
+	auto shared_decoder_it = _shared_decoders.find(decoder_id);
+	if (shared_decoder_it != _shared_decoders.end())
+	{
+		// Only the packets of the owner stream are decoded
+		shared_decoder_it->second->SendBuffer(this, std::move(packet));
+		return;
+	}
+
 	auto decoder_it = _decoders.find(decoder_id);
 	if (decoder_it == _decoders.end())
 	{
 		return;
 	}
 	auto decoder = decoder_it->second;
+
+	auto benchmark = TranscodeBenchmark::GetInstance();
+	if (benchmark->IsEnabled())
+	{
+		benchmark->RecordInput(TranscodeBenchmark::Stage::Decoder, decoder->GetInputWaitingTimeInUs());
+	}
+
 	decoder->SendBuffer(std::move(packet));
 }
 
@@ -1189,6 +1632,18 @@ void TranscoderStream::OnDecodedFrame(TranscodeResult result, int32_t decoder_id
 			// Record the timestamp of the last decoded frame. managed by microseconds.
 			_last_decoded_frame_pts[decoder_id] = decoded_frame->GetPts() * input_track->GetTimeBase().GetExpr() * 1000000;
 
+			auto trace = FindPendingTrace(input_track->GetMediaType(), _last_decoded_frame_pts[decoder_id]);
+			if (trace != nullptr)
+			{
+				trace->Mark(PacketTraceStage::TranscoderDecoded);
+			}
+
+			auto benchmark = TranscodeBenchmark::GetInstance();
+			if (benchmark->IsEnabled())
+			{
+				benchmark->RecordOutput(TranscodeBenchmark::Stage::Decoder);
+			}
+
 			// The last decoded frame is kept and used as a filling frame in the blank section.
 			SetLastDecodedFrame(decoder_id, decoded_frame);
 
@@ -1205,7 +1660,9 @@ void TranscoderStream::OnDecodedFrame(TranscodeResult result, int32_t decoder_id
 
 void TranscoderStream::SetLastDecodedFrame(int32_t decoder_id, std::shared_ptr<MediaFrame> &decoded_frame)
 {
-	_last_decoded_frames[decoder_id] = decoded_frame->CloneFrame();
+	// The decoded frame is not modified after it is sent to the filters, so it is kept without a clone
+	// (GetLastDecodedFrame() returns a clone)
+	_last_decoded_frames[decoder_id] = decoded_frame;
 }
 
 std::shared_ptr<MediaFrame> TranscoderStream::GetLastDecodedFrame(int32_t decoder_id)
@@ -1256,6 +1713,16 @@ TranscodeResult TranscoderStream::FilterFrame(int32_t filter_id, std::shared_ptr
 	}
 
 	auto filter = filter_it->second.get();
+	if (filter == nullptr)
+	{
+		return TranscodeResult::NoData;
+	}
+
+	auto benchmark = TranscodeBenchmark::GetInstance();
+	if (benchmark->IsEnabled())
+	{
+		benchmark->RecordInput(TranscodeBenchmark::Stage::Filter, filter->GetInputWaitingTimeInUs());
+	}
 
 	if (filter->SendBuffer(std::move(decoded_frame)) == false)
 	{
@@ -1269,6 +1736,12 @@ void TranscoderStream::OnFilteredFrame(int32_t filter_id, std::shared_ptr<MediaF
 {
 	filtered_frame->SetTrackId(filter_id);
 
+	auto benchmark = TranscodeBenchmark::GetInstance();
+	if (benchmark->IsEnabled())
+	{
+		benchmark->RecordOutput(TranscodeBenchmark::Stage::Filter);
+	}
+
 	EncodeFrame(std::move(filtered_frame));
 }
 
@@ -1292,11 +1765,118 @@ TranscodeResult TranscoderStream::EncodeFrame(std::shared_ptr<const MediaFrame>
 	}
 	auto encoder = encoder_map_it->second.get();
 
+	// The trace is shared by the renditions until it is encoded, so this is the time of the first rendition
+	auto trace = FindPendingTrace(frame->GetMediaType(), frame->GetPts() * encoder->GetTimebase().GetExpr() * 1000000);
+	if (trace != nullptr)
+	{
+		trace->Mark(PacketTraceStage::TranscoderFiltered);
+	}
+
+	auto benchmark = TranscodeBenchmark::GetInstance();
+	if (benchmark->IsEnabled())
+	{
+		benchmark->RecordInput(TranscodeBenchmark::Stage::Encoder, encoder->GetInputWaitingTimeInUs());
+	}
+
 	encoder->SendBuffer(std::move(frame));
 
+	lock.unlock();
+
+	UpdateDegradation();
+
 	return TranscodeResult::NoData;
 }
 
+void TranscoderStream::UpdateDegradation()
+{
+	auto controller = TranscodeLoadController::GetInstance();
+
+	if (controller->IsEnabled() == false)
+	{
+		return;
+	}
+
+	// Only a thread checks it per interval
+	auto now = ov::Clock::NowMSec();
+	auto last_check_time = _last_degradation_check_time.load();
+
+	if (((now - last_check_time) < controller->GetCheckInterval()) ||
+		(_last_degradation_check_time.compare_exchange_strong(last_check_time, now) == false))
+	{
+		return;
+	}
+
+	std::shared_lock<std::shared_mutex> lock(_encoder_map_mutex);
+
+	int64_t max_waiting_time_in_us = 0;
+	std::vector<std::shared_ptr<TranscodeEncoder>> video_encoders;
+
+	for (auto &[encoder_id, encoder] : _encoders)
+	{
+		max_waiting_time_in_us = std::max(max_waiting_time_in_us, encoder->GetInputWaitingTimeInUs());
+
+		if (encoder->GetRefTrack()->GetMediaType() == cmn::MediaType::Video)
+		{
+			video_encoders.push_back(encoder);
+		}
+	}
+
+	// The rendition of the highest bitrate is the main rendition, and it is never degraded
+	if (video_encoders.size() < 2)
+	{
+		return;
+	}
+
+	std::stable_sort(video_encoders.begin(), video_encoders.end(), [](const std::shared_ptr<TranscodeEncoder> &a, const std::shared_ptr<TranscodeEncoder> &b) -> bool {
+		return a->GetRefTrack()->GetBitrate() > b->GetRefTrack()->GetBitrate();
+	});
+
+	switch (controller->GetLoadState(max_waiting_time_in_us))
+	{
+		case TranscodeLoadController::LoadState::Overloaded:
+			// Degrade the lowest-priority rendition that can be degraded more
+			for (auto it = video_encoders.rbegin(); it != (video_encoders.rend() - 1); ++it)
+			{
+				auto &encoder = *it;
+				auto level = encoder->GetDegradationLevel();
+
+				if (level != TranscodeDegradationLevel::Skip)
+				{
+					level = (level == TranscodeDegradationLevel::None) ? TranscodeDegradationLevel::HalfFrameRate : TranscodeDegradationLevel::Skip;
+					encoder->SetDegradationLevel(level);
+
+					logtw("%s Transcoder is overloaded (CPU: %.1f%%, Queue waiting time: %" PRId64 "us). Track(%u) is degraded to %s",
+						  _log_prefix.CStr(), controller->GetCpuUsage(), max_waiting_time_in_us, encoder->GetRefTrack()->GetId(),
+						  (level == TranscodeDegradationLevel::HalfFrameRate) ? "half frame rate" : "skip");
+					break;
+				}
+			}
+			break;
+
+		case TranscodeLoadController::LoadState::Relaxed:
+			// Restore the highest-priority degraded rendition first
+			for (auto &encoder : video_encoders)
+			{
+				auto level = encoder->GetDegradationLevel();
+
+				if (level != TranscodeDegradationLevel::None)
+				{
+					level = (level == TranscodeDegradationLevel::Skip) ? TranscodeDegradationLevel::HalfFrameRate : TranscodeDegradationLevel::None;
+					encoder->SetDegradationLevel(level);
+
+					logti("%s Transcoder load is relaxed. Track(%u) is restored to %s",
+						  _log_prefix.CStr(), encoder->GetRefTrack()->GetId(),
+						  (level == TranscodeDegradationLevel::HalfFrameRate) ? "half frame rate" : "full frame rate");
+					break;
+				}
+			}
+			break;
+
+		case TranscodeLoadController::LoadState::Normal:
+			break;
+	}
+}
+
 // Callback is called from the encoder for packets that have been encoded.
 void TranscoderStream::OnEncodedPacket(int32_t encoder_id, std::shared_ptr<MediaPacket> encoded_packet)
 {
@@ -1313,6 +1893,30 @@ void TranscoderStream::OnEncodedPacket(int32_t encoder_id, std::shared_ptr<Media
 	}
 	auto output_tracks = encoder_to_outputs_it->second;
 
+	auto benchmark = TranscodeBenchmark::GetInstance();
+	if (benchmark->IsEnabled())
+	{
+		benchmark->RecordOutput(TranscodeBenchmark::Stage::Encoder);
+	}
+
+	if ((_pending_trace_count > 0) && (output_tracks.empty() == false))
+	{
+		auto &[output_stream, output_track_id] = output_tracks.front();
+		auto output_track = output_stream->GetTrack(output_track_id);
+
+		if (output_track != nullptr)
+		{
+			auto trace = FindPendingTrace(encoded_packet->GetMediaType(), encoded_packet->GetPts() * output_track->GetTimeBase().GetExpr() * 1000000);
+			if (trace != nullptr)
+			{
+				// Each rendition has its own trace from now on
+				trace = trace->Clone();
+				trace->Mark(PacketTraceStage::TranscoderEncoded);
+				encoded_packet->SetTrace(trace);
+			}
+		}
+	}
+
 	// If a track exists to output, copy the encoded packet and send it to that track.
 	for (auto &[output_stream, output_track_id] : output_tracks)
 	{
@@ -1324,6 +1928,43 @@ void TranscoderStream::OnEncodedPacket(int32_t encoder_id, std::shared_ptr<Media
 	}
 }
 
+void TranscoderStream::AddPendingTrace(cmn::MediaType media_type, int64_t pts_us, const std::shared_ptr<MediaPacketTrace> &trace)
+{
+	std::lock_guard<std::mutex> lock(_pending_trace_mutex);
+
+	auto now = MediaPacketTrace::Now();
+
+	while ((_pending_traces.empty() == false) &&
+		   ((_pending_traces.size() >= TRANSCODER_MAX_PENDING_TRACE_COUNT) || ((now - _pending_traces.front().added_time) > TRANSCODER_PENDING_TRACE_TIMEOUT_US)))
+	{
+		_pending_traces.pop_front();
+	}
+
+	_pending_traces.push_back({media_type, pts_us, now, trace});
+	_pending_trace_count = _pending_traces.size();
+}
+
+std::shared_ptr<MediaPacketTrace> TranscoderStream::FindPendingTrace(cmn::MediaType media_type, int64_t pts_us)
+{
+	if (_pending_trace_count == 0)
+	{
+		return nullptr;
+	}
+
+	std::lock_guard<std::mutex> lock(_pending_trace_mutex);
+
+	for (auto &pending_trace : _pending_traces)
+	{
+		// The PTS may be slightly changed by the rescaling of the timebase
+		if ((pending_trace.media_type == media_type) && (std::abs(pending_trace.pts_us - pts_us) <= 1000))
+		{
+			return pending_trace.trace;
+		}
+	}
+
+	return nullptr;
+}
+
 void TranscoderStream::NotifyCreateStreams()
 {
 	for (auto &[output_stream_name, output_stream] : _output_streams)
@@ -1332,7 +1973,10 @@ void TranscoderStream::NotifyCreateStreams()
 		if (ret == false)
 		{
 			logtw("%s Could not create stream. [%s/%s(%u)]", _log_prefix.CStr(), _application_info.GetName().CStr(), output_stream->GetName().CStr(), output_stream->GetId());
+			continue;
 		}
+
+		UpdateGpuOfStreamMetrics(*output_stream);
 	}
 }
 
@@ -1391,18 +2035,25 @@ void TranscoderStream::SpreadToFilters(int32_t decoder_id, std::shared_ptr<Media
 
 		return;
 	}
-	auto filter_ids = filters->second;
+	std::vector<MediaTrackId> filter_ids;
 
-	for (auto &filter_id : filter_ids)
 	{
-		auto frame_clone = frame->CloneFrame();
-		if (frame_clone == nullptr)
-		{
-			logte("%s Failed to clone frame", _log_prefix.CStr());
+		std::shared_lock<std::shared_mutex> lock(_filter_map_mutex);
 
-			continue;
+		for (auto &filter_id : filters->second)
+		{
+			// The frame is sent once to a multi-output filter
+			if (_grouped_filter_ids.find(filter_id) == _grouped_filter_ids.end())
+			{
+				filter_ids.push_back(filter_id);
+			}
 		}
+	}
 
-		FilterFrame(filter_id, std::move(frame_clone));
+	// The filters only read the decoded frame (it is fed to the filter graph with AV_BUFFERSRC_FLAG_KEEP_REF),
+	// so all filters share the frame and its buffers from the pool of the decoder instead of a clone per filter
+	for (auto &filter_id : filter_ids)
+	{
+		FilterFrame(filter_id, frame);
 	}
 }
@@ -11,8 +11,10 @@
 #include <base/info/application.h>
 
 #include <cstdint>
+#include <deque>
 #include <memory>
 #include <queue>
+#include <set>
 #include <vector>
 
 #include "base/info/stream.h"
@@ -22,8 +24,14 @@
 #include "transcoder_decoder.h"
 #include "transcoder_encoder.h"
 #include "transcoder_filter.h"
+#include "transcoder_shared_decoder.h"
 #include "transcoder_stream_internal.h"
 
+// The traces of the sampled packets are matched with the frames by PTS, and are dropped after this time if they are not matched
+#define TRANSCODER_PENDING_TRACE_TIMEOUT_US		(5 * 1000 * 1000)
+// Maximum number of the traces waiting to be matched
+#define TRANSCODER_MAX_PENDING_TRACE_COUNT		64
+
 class TranscodeApplication;
 
 class TranscoderStream : public ov::EnableSharedFromThis<TranscoderStream>, public TranscoderStreamInternal
@@ -89,6 +97,10 @@ public:
 	bool Update(const std::shared_ptr<info::Stream> &stream);
 	bool Push(std::shared_ptr<MediaPacket> packet);
 
+	// Requests a keyframe from the encoder of the output track.
+	// Returns false if this stream does not have the track or it is not encoded (bypassed).
+	bool RequestKeyFrame(info::stream_id_t output_stream_id, MediaTrackId output_track_id);
+
 	// Notify event to mediarouter
 	void NotifyCreateStreams();
 	void NotifyDeleteStreams();
@@ -103,6 +115,12 @@ private:
 
 	bool _is_stopped = true;
 
+	// GPU assigned by TranscodeGPU (-1: not assigned)
+	int32_t _gpu_id = -1;
+
+	// Time when the degradation of the renditions was last checked by TranscodeLoadController (ms)
+	std::atomic<uint64_t> _last_degradation_check_time{0};
+
 	TranscodeApplication *_parent;
 
 	const info::Application _application_info;
@@ -143,11 +161,16 @@ private:
 	// Decoder Component
 	// DECODER_ID, DECODER
 	std::map<MediaTrackId, std::shared_ptr<TranscodeDecoder>> _decoders;
+	// Decoders shared with the streams of other applications (DECODER_ID, SHARED_DECODER)
+	std::map<MediaTrackId, std::shared_ptr<TranscodeSharedDecoder>> _shared_decoders;
 	std::map<MediaTrackId, std::shared_ptr<MediaFrame>> _last_decoded_frames;
 
 	// Filter Component
 	// FILTER_ID, FILTER
 	std::map<MediaTrackId, std::shared_ptr<TranscodeFilter>> _filters;
+	// Filters that share a multi-output filter with the first filter of the group (FILTER_ID)
+	// Frames are only sent to the first filter of the group
+	std::set<MediaTrackId> _grouped_filter_ids;
 
 	// Encoder Component
 	// ENCODER_ID, ENCODER
@@ -157,6 +180,40 @@ private:
 	// DECODER_ID, Timestamp(microseconds)
 	std::map<MediaTrackId, int64_t> _last_decoded_frame_pts;
 
+	// Output tracks of the image profiles that take only the key frames
+	// OUTPUT_TRACK_ID, Framerate of the profile
+	std::map<MediaTrackId, double> _key_frame_only_output_tracks;
+
+	// Decoders that are fed only with the key frames since all of their outputs are the key frame only images
+	struct KeyFrameOnlyContext
+	{
+		// Minimum interval between the decoded key frames (0: all key frames are decoded)
+		int64_t interval_us = 0;
+		int64_t last_decoded_pts_us = -1;
+	};
+	// DECODER_ID, KeyFrameOnlyContext
+	std::map<MediaTrackId, KeyFrameOnlyContext> _key_frame_only_decoders;
+
+	void BuildKeyFrameOnlyDecoders();
+	bool IsSkippableForKeyFrameOnly(int32_t decoder_id, const std::shared_ptr<MediaPacket> &packet);
+
+	// The traces of the sampled packets (see MediaPacketTrace) which are being transcoded.
+	// Decoders/filters/encoders don't carry the trace, so the frames are matched with the traces by PTS.
+	struct PendingTrace
+	{
+		cmn::MediaType media_type;
+		int64_t pts_us;
+		int64_t added_time;
+		std::shared_ptr<MediaPacketTrace> trace;
+	};
+	std::mutex _pending_trace_mutex;
+	std::deque<PendingTrace> _pending_traces;
+	// To skip the lookup without locking if there is no trace
+	std::atomic<size_t> _pending_trace_count{0};
+
+	void AddPendingTrace(cmn::MediaType media_type, int64_t pts_us, const std::shared_ptr<MediaPacketTrace> &trace);
+	std::shared_ptr<MediaPacketTrace> FindPendingTrace(cmn::MediaType media_type, int64_t pts_us);
+
 
 	std::shared_ptr<MediaTrack> GetInputTrack(MediaTrackId track_id);
 	std::shared_ptr<info::Stream> GetInputStream();
@@ -178,11 +235,21 @@ private:
 
 	ov::String GetInfoStringComposite();
 
+	// Admission control: reserves the estimated cost of the video encoders of this stream.
+	// If it does not fit in the remaining capacity, the input stream is terminated so it does not degrade the running streams.
+	bool ReserveEncodingCapacity();
+
+	// Assigns the least-loaded GPU to this stream if hardware acceleration is enabled
+	void AcquireGpu();
+	void ReleaseGpu();
+	void UpdateGpuOfStreamMetrics(const info::Stream &stream);
+
 	int32_t CreateDecoders();
 	bool CreateDecoder(int32_t decoder_id, std::shared_ptr<MediaTrack> input_track);
 
 	int32_t CreateFilters(MediaFrame *buffer);
 	bool CreateFilter(int32_t filter_id, std::shared_ptr<MediaTrack> input_track, std::shared_ptr<MediaTrack> output_track);
+	bool CreateMultiOutputFilter(const std::vector<int32_t> &filter_ids, std::shared_ptr<MediaTrack> input_track, const std::vector<std::shared_ptr<MediaTrack>> &output_tracks);
 	std::shared_ptr<MediaTrack> GetInputTrackOfFilter(int32_t decoder_id);
 
 	int32_t CreateEncoders(MediaFrame *buffer);
@@ -209,6 +276,8 @@ private:
 
 	// Step 3: Encode (Encode the filtered frame to packets)
 	TranscodeResult EncodeFrame(std::shared_ptr<const MediaFrame> frame);
+	// Degrades or restores a video rendition according to the load of the transcoder
+	void UpdateDegradation();
 	void OnEncodedPacket(int32_t encoder_id, std::shared_ptr<MediaPacket> encoded_packet);
 
 	// Send encoded packet to mediarouter via transcoder application
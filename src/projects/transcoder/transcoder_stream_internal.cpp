@@ -19,6 +19,11 @@ TranscoderStreamInternal::~TranscoderStreamInternal()
 {
 }
 
+// The identifiers are the canonical form of all parameters that change the encoded bitstream.
+// The output tracks of all output profiles with the same identifier share one decoder/filter/encoder,
+// so a parameter must not be missed (the profiles would share a wrong encoder),
+// and the names/letter cases in the configuration must not make a difference (the same encoder would be created twice).
+// ThreadCount and BypassIfMatch are not included, since they do not change the bitstream of the encoder.
 ov::String TranscoderStreamInternal::GetIdentifiedForVideoProfile(const uint32_t track_id, const cfg::vhost::app::oprf::VideoProfile &profile)
 {
 	if (profile.IsBypass() == true)
@@ -26,35 +31,31 @@ ov::String TranscoderStreamInternal::GetIdentifiedForVideoProfile(const uint32_t
 		return ov::String::FormatString("In_T%d_Out_Pbypass", track_id);
 	}
 
-	auto unique_profile_name = ov::String::FormatString("In_T%d_Out_C%s-%d-%.02f-%d-%d",
+	return ov::String::FormatString("In_T%d_Out_C%s-%d-%.02f-%d-%d-Pr%s-Pf%s-K%d%s-B%d-L%d-T%d",
 									track_id,
-									profile.GetCodec().CStr(),
+									profile.GetCodec().LowerCaseString().CStr(),
 									profile.GetBitrate(),
 									profile.GetFramerate(),
 									profile.GetWidth(),
-									profile.GetHeight());
-
-	if(profile.GetPreset().IsEmpty() == false)
-	{
-		unique_profile_name +=  ov::String::FormatString("-Pr%s", profile.GetPreset().CStr());
-	}
-
-	if(profile.GetProfile().IsEmpty() == false)
-	{
-		unique_profile_name +=  ov::String::FormatString("-Pf%s", profile.GetProfile().CStr());
-	}
-
-	return unique_profile_name;
+									profile.GetHeight(),
+									profile.GetPreset().LowerCaseString().CStr(),
+									profile.GetProfile().LowerCaseString().CStr(),
+									profile.GetKeyFrameInterval(),
+									profile.IsKeyFrameAlignment() ? "a" : "",
+									profile.GetBFrames(),
+									profile.IsLowLatency() ? 1 : 0,
+									profile.GetTemporalLayers());
 }
 
 ov::String TranscoderStreamInternal::GetIdentifiedForImageProfile(const uint32_t track_id, const cfg::vhost::app::oprf::ImageProfile &profile)
 {
-	return ov::String::FormatString("In_T%d_Out_C%s-%.02f-%d-%d",
+	return ov::String::FormatString("In_T%d_Out_C%s-%.02f-%d-%d%s",
 									track_id,
-									profile.GetCodec().CStr(),
+									profile.GetCodec().LowerCaseString().CStr(),
 									profile.GetFramerate(),
 									profile.GetWidth(),
-									profile.GetHeight());
+									profile.GetHeight(),
+									profile.IsKeyFrameOnly() ? "-K" : "");
 }
 
 ov::String TranscoderStreamInternal::GetIdentifiedForAudioProfile(const uint32_t track_id, const cfg::vhost::app::oprf::AudioProfile &profile)
@@ -66,7 +67,7 @@ ov::String TranscoderStreamInternal::GetIdentifiedForAudioProfile(const uint32_t
 
 	return ov::String::FormatString("In_T%d_Out_C%s-%d-%d-%d",
 									track_id,
-									profile.GetCodec().CStr(),
+									profile.GetCodec().LowerCaseString().CStr(),
 									profile.GetBitrate(),
 									profile.GetSamplerate(),
 									profile.GetChannel());
@@ -87,6 +88,7 @@ cmn::Timebase TranscoderStreamInternal::GetDefaultTimebaseByCodecId(cmn::MediaCo
 		case cmn::MediaCodecId::H265:
 		case cmn::MediaCodecId::Vp8:
 		case cmn::MediaCodecId::Vp9:
+		case cmn::MediaCodecId::Av1:
 		case cmn::MediaCodecId::Flv:
 		case cmn::MediaCodecId::Jpeg:
 		case cmn::MediaCodecId::Png:
@@ -184,6 +186,9 @@ std::shared_ptr<MediaTrack> TranscoderStreamInternal::CreateOutputTrack(const st
 		output_track->SetPreset(profile.GetPreset());
 		output_track->SetThreadCount(profile.GetThreadCount());
 		output_track->SetBFrames(profile.GetBFrames());
+		output_track->SetKeyFrameAligned(profile.IsKeyFrameAlignment());
+		output_track->SetLowLatency(profile.IsLowLatency());
+		output_track->SetTemporalLayers(profile.GetTemporalLayers());
 		output_track->SetProfile(profile.GetProfile());
 	}
 